@@ -0,0 +1,425 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+extern crate iceoryx2_bb_loggers;
+
+use core::time::Duration;
+use std::sync::Mutex;
+use std::time::Instant;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
+use benchmark_common::sweep;
+use clap::{Parser, ValueEnum};
+use iceoryx2::prelude::*;
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, Ordering};
+use iceoryx2_bb_posix::barrier::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_posix::thread::thread_scope;
+
+const DURATION_IN_MS: u64 = 1000;
+const SUPPORTED_VALUE_SIZES: [usize; 6] = [8, 64, 512, 4096, 16384, 65536];
+
+type BenchmarkResult<T> = Result<T, Box<dyn core::error::Error>>;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum WriteMode {
+    Copy,
+    Loan,
+}
+
+impl WriteMode {
+    fn name(&self) -> &'static str {
+        match self {
+            WriteMode::Copy => "update_with_copy",
+            WriteMode::Loan => "loan_uninit",
+        }
+    }
+}
+
+struct Setup {
+    value_size: usize,
+    number_of_keys: usize,
+    number_of_readers: usize,
+    write_mode: WriteMode,
+    cache_line_aligned_entries: bool,
+}
+
+#[derive(Default)]
+struct OperationMeasurement {
+    operations: u64,
+    time: Duration,
+    histogram: LatencyHistogram,
+}
+
+impl OperationMeasurement {
+    fn record(&mut self, latency: Duration) {
+        self.operations += 1;
+        self.time += latency;
+        self.histogram.record(latency);
+    }
+
+    fn merge(&mut self, other: &OperationMeasurement) {
+        self.operations += other.operations;
+        self.time += other.time;
+        self.histogram.merge(&other.histogram);
+    }
+}
+
+#[derive(Default)]
+struct ReaderMeasurement {
+    get: OperationMeasurement,
+    is_up_to_date: OperationMeasurement,
+    outdated_reads: u64,
+}
+
+struct Measurement {
+    time: Duration,
+    readers: ReaderMeasurement,
+    update: OperationMeasurement,
+}
+
+fn perform_benchmark<T: Service>(args: &Args, setup: &Setup) -> BenchmarkResult<Measurement> {
+    match setup.value_size {
+        8 => perform_benchmark_with_value_size::<T, 8>(args, setup),
+        64 => perform_benchmark_with_value_size::<T, 64>(args, setup),
+        512 => perform_benchmark_with_value_size::<T, 512>(args, setup),
+        4096 => perform_benchmark_with_value_size::<T, 4096>(args, setup),
+        16384 => perform_benchmark_with_value_size::<T, 16384>(args, setup),
+        65536 => perform_benchmark_with_value_size::<T, 65536>(args, setup),
+        v => Err(format!(
+            "the value size {v} is not supported, use one of {SUPPORTED_VALUE_SIZES:?}"
+        )
+        .into()),
+    }
+}
+
+/// One writer updates all entries round robin while every reader reads them round robin.
+/// The fewer keys the blackboard has, the more often a reader hits the entry that is
+/// currently written.
+fn perform_benchmark_with_value_size<T: Service, const VALUE_SIZE: usize>(
+    args: &Args,
+    setup: &Setup,
+) -> BenchmarkResult<Measurement> {
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let mut creator = node
+        .service_builder(&ServiceName::new("blackboard")?)
+        .blackboard_creator::<u64>()
+        .max_readers(setup.number_of_readers)
+        .cache_line_aligned_entries(setup.cache_line_aligned_entries);
+    for key in 0..setup.number_of_keys as u64 {
+        creator = creator.add::<[u8; VALUE_SIZE]>(key, [0u8; VALUE_SIZE]);
+    }
+    let service = creator.create()?;
+
+    let number_of_cpu_cores = SystemInfo::NumberOfCpuCores.value().max(1);
+    let cpu_core_of =
+        |participant: usize| (args.first_cpu_core + participant) % number_of_cpu_cores;
+
+    let start_benchmark_barrier_handle = BarrierHandle::new();
+    let start_benchmark_barrier = BarrierBuilder::new((setup.number_of_readers + 2) as u32)
+        .create(&start_benchmark_barrier_handle)
+        .unwrap();
+
+    let stop = AtomicBool::new(false);
+    let readers = Mutex::new(ReaderMeasurement::default());
+    let update = Mutex::new(OperationMeasurement::default());
+    let mut start = Instant::now();
+
+    thread_scope(|s| {
+        s.thread_builder().affinity(&[cpu_core_of(0)]).spawn(|| {
+            let writer = service.writer_builder().create().unwrap();
+            let mut entries: Vec<_> = (0..setup.number_of_keys as u64)
+                .map(|key| Some(writer.entry::<[u8; VALUE_SIZE]>(&key).unwrap()))
+                .collect();
+            let mut value = [0u8; VALUE_SIZE];
+            let mut measurement = OperationMeasurement::default();
+
+            start_benchmark_barrier.wait();
+
+            let mut n = 0;
+            while !stop.load(Ordering::Relaxed) {
+                let index = n % entries.len();
+                let entry = entries[index].take().unwrap();
+                value[0] = n as u8;
+
+                let start = Instant::now();
+                let entry = match setup.write_mode {
+                    WriteMode::Copy => {
+                        entry.update_with_copy(value);
+                        entry
+                    }
+                    WriteMode::Loan => {
+                        let mut entry_value = entry.loan_uninit();
+                        unsafe {
+                            entry_value
+                                .value_mut()
+                                .as_mut_ptr()
+                                .cast::<u8>()
+                                .write_bytes(n as u8, VALUE_SIZE);
+                            entry_value.assume_init_and_update()
+                        }
+                    }
+                };
+                measurement.record(start.elapsed());
+
+                entries[index] = Some(entry);
+                n += 1;
+            }
+
+            *update.lock().unwrap() = measurement;
+        })?;
+
+        for participant in 0..setup.number_of_readers {
+            s.thread_builder()
+                .affinity(&[cpu_core_of(1 + participant)])
+                .spawn(|| {
+                    let reader = service.reader_builder().create().unwrap();
+                    let entries: Vec<_> = (0..setup.number_of_keys as u64)
+                        .map(|key| reader.entry::<[u8; VALUE_SIZE]>(&key).unwrap())
+                        .collect();
+                    let mut measurement = ReaderMeasurement::default();
+
+                    start_benchmark_barrier.wait();
+
+                    let mut n = 0;
+                    while !stop.load(Ordering::Relaxed) {
+                        let entry = &entries[n % entries.len()];
+
+                        let start = Instant::now();
+                        let value = entry.get();
+                        measurement.get.record(start.elapsed());
+
+                        let start = Instant::now();
+                        let is_up_to_date = entry.is_up_to_date(&value);
+                        measurement.is_up_to_date.record(start.elapsed());
+
+                        // the value was updated while or shortly after it was read, the upper
+                        // bound of the reads that had to be retried
+                        if !is_up_to_date {
+                            measurement.outdated_reads += 1;
+                        }
+
+                        core::hint::black_box(&value);
+                        n += 1;
+                    }
+
+                    let mut readers = readers.lock().unwrap();
+                    readers.get.merge(&measurement.get);
+                    readers.is_up_to_date.merge(&measurement.is_up_to_date);
+                    readers.outdated_reads += measurement.outdated_reads;
+                })?;
+        }
+
+        start_benchmark_barrier.wait();
+        start = Instant::now();
+
+        std::thread::sleep(Duration::from_millis(args.duration_in_ms));
+        stop.store(true, Ordering::Relaxed);
+
+        Ok(())
+    })?;
+
+    Ok(Measurement {
+        time: start.elapsed(),
+        readers: readers.into_inner().unwrap(),
+        update: update.into_inner().unwrap(),
+    })
+}
+
+fn run<T: Service>(args: &Args) {
+    let mut setups = Vec::new();
+    for write_mode in args.write_mode.modes() {
+        for cache_line_aligned_entries in args.entry_layout.cache_line_aligned_entries() {
+            for number_of_readers in sweep::powers_of_two(args.max_readers) {
+                for number_of_keys in &args.keys {
+                    for value_size in &args.value_sizes {
+                        setups.push(Setup {
+                            value_size: *value_size,
+                            number_of_keys: (*number_of_keys).max(1),
+                            number_of_readers,
+                            write_mode: *write_mode,
+                            cache_line_aligned_entries: *cache_line_aligned_entries,
+                        });
+                    }
+                }
+            }
+        }
+    }
+
+    for setup in setups {
+        match perform_benchmark::<T>(args, &setup) {
+            Ok(measurement) => report::<T>(args, &setup, &measurement),
+            Err(e) => eprintln!(
+                "{} ::: Value Size: {}, Keys: {}, Readers: {} ::: skipped ({e})",
+                core::any::type_name::<T>(),
+                setup.value_size,
+                setup.number_of_keys,
+                setup.number_of_readers
+            ),
+        }
+    }
+}
+
+fn report<T: Service>(args: &Args, setup: &Setup, measurement: &Measurement) {
+    let time_s = measurement.time.as_secs_f64();
+    let per_second = |operations: u64| {
+        if time_s > 0.0 {
+            operations as f64 / time_s
+        } else {
+            0.0
+        }
+    };
+
+    let operation_report = |benchmark: &str, operation: &OperationMeasurement| {
+        Report::new_for_operations(
+            benchmark,
+            core::any::type_name::<T>(),
+            operation.operations,
+            operation.time,
+            &operation.histogram,
+        )
+        .parameter("value_size", setup.value_size)
+        .parameter("keys", setup.number_of_keys)
+        .parameter("readers", setup.number_of_readers)
+        .parameter("write_mode", setup.write_mode.name())
+        .parameter(
+            "cache_line_aligned_entries",
+            setup.cache_line_aligned_entries,
+        )
+        .parameter("operations_per_s", per_second(operation.operations))
+    };
+
+    let readers = &measurement.readers;
+    let outdated_reads = if readers.get.operations > 0 {
+        readers.outdated_reads as f64 / readers.get.operations as f64
+    } else {
+        0.0
+    };
+
+    operation_report("blackboard_get", &readers.get)
+        .parameter("outdated_read_ratio", outdated_reads)
+        .emit(args.json);
+    operation_report("blackboard_is_up_to_date", &readers.is_up_to_date).emit(args.json);
+    operation_report("blackboard_update", &measurement.update).emit(args.json);
+}
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum WriteModeSelection {
+    UpdateWithCopy,
+    LoanUninit,
+    All,
+}
+
+impl WriteModeSelection {
+    fn modes(&self) -> &'static [WriteMode] {
+        match self {
+            WriteModeSelection::UpdateWithCopy => &[WriteMode::Copy],
+            WriteModeSelection::LoanUninit => &[WriteMode::Loan],
+            WriteModeSelection::All => &[WriteMode::Copy, WriteMode::Loan],
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum EntryLayoutSelection {
+    Packed,
+    CacheLineAligned,
+    All,
+}
+
+impl EntryLayoutSelection {
+    fn cache_line_aligned_entries(&self) -> &'static [bool] {
+        match self {
+            EntryLayoutSelection::Packed => &[false],
+            EntryLayoutSelection::CacheLineAligned => &[true],
+            EntryLayoutSelection::All => &[false, true],
+        }
+    }
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// The duration in milliseconds every setup is measured
+    #[clap(long, default_value_t = DURATION_IN_MS)]
+    duration_in_ms: u64,
+    /// Run benchmark for every service setup
+    #[clap(short, long)]
+    bench_all: bool,
+    /// Run benchmark for the IPC zero copy setup
+    #[clap(long)]
+    bench_ipc: bool,
+    /// Run benchmark for the process local setup
+    #[clap(long)]
+    bench_local: bool,
+    /// Activate full log output
+    #[clap(short, long)]
+    debug_mode: bool,
+    /// The cpu core of the writer, every reader uses the next core
+    #[clap(long, default_value_t = 0)]
+    first_cpu_core: usize,
+    /// The greatest number of active readers, the benchmark sweeps 1, 2, 4, ... up to it
+    #[clap(long, default_value_t = 4)]
+    max_readers: usize,
+    /// The comma separated numbers of keys of the blackboard
+    #[clap(short, long, value_delimiter = ',', default_value = "1,16,256")]
+    keys: Vec<usize>,
+    /// The comma separated value sizes in bytes, supported are 8, 64, 512, 4096, 16384 and 65536
+    #[clap(
+        short,
+        long,
+        value_delimiter = ',',
+        default_value = "8,64,512,4096,65536"
+    )]
+    value_sizes: Vec<usize>,
+    /// How the writer updates the entries
+    #[clap(long, value_enum, default_value_t = WriteModeSelection::All)]
+    write_mode: WriteModeSelection,
+    /// Whether the entries are packed or padded to a cache line
+    #[clap(long, value_enum, default_value_t = EntryLayoutSelection::All)]
+    entry_layout: EntryLayoutSelection,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+
+    if args.debug_mode {
+        set_log_level(LogLevel::Trace);
+    } else {
+        set_log_level(LogLevel::Error);
+    }
+
+    let mut at_least_one_benchmark_did_run = false;
+
+    if args.bench_ipc || args.bench_all {
+        run::<ipc::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if args.bench_local || args.bench_all {
+        run::<local::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if !at_least_one_benchmark_did_run {
+        println!(
+            "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+        );
+    }
+
+    Ok(())
+}
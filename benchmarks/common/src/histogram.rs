@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+
+/// Number of bits that are used to resolve a value within its power of two. With 7 bits the
+/// relative error of every recorded value is below 1%.
+const SUB_BUCKET_BITS: u32 = 7;
+const SUB_BUCKET_COUNT: usize = 1 << SUB_BUCKET_BITS;
+const NUMBER_OF_BUCKETS: usize = (u64::BITS - SUB_BUCKET_BITS + 1) as usize * SUB_BUCKET_COUNT;
+
+/// A histogram of latencies with logarithmically growing buckets, in the style of an
+/// HDR histogram. Values below 128 ns are recorded exactly, larger values with a relative
+/// error below 1%. Recording is a constant time operation without allocation, so that it
+/// can be performed in the hot loop of a benchmark.
+#[derive(Debug, Clone)]
+pub struct LatencyHistogram {
+    counts: Vec<u64>,
+    total_count: u64,
+    min: u64,
+    max: u64,
+    sum: u128,
+    sum_of_squares: u128,
+}
+
+impl Default for LatencyHistogram {
+    fn default() -> Self {
+        Self {
+            counts: vec![0; NUMBER_OF_BUCKETS],
+            total_count: 0,
+            min: u64::MAX,
+            max: 0,
+            sum: 0,
+            sum_of_squares: 0,
+        }
+    }
+}
+
+impl LatencyHistogram {
+    /// Creates a new empty [`LatencyHistogram`].
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Records a single latency.
+    pub fn record(&mut self, latency: Duration) {
+        let value = latency.as_nanos().min(u64::MAX as u128) as u64;
+
+        self.counts[Self::index_of(value)] += 1;
+        self.total_count += 1;
+        self.min = self.min.min(value);
+        self.max = self.max.max(value);
+        self.sum += value as u128;
+        self.sum_of_squares += value as u128 * value as u128;
+    }
+
+    /// Records half of the measured round trip time as latency. The benchmarks measure
+    /// A --> B --> A, therefore this corresponds to the latency of a single transmission.
+    pub fn record_round_trip(&mut self, round_trip: Duration) {
+        self.record(round_trip / 2);
+    }
+
+    /// Adds all latencies recorded by `other`, for instance to combine the histograms of
+    /// multiple participants.
+    pub fn merge(&mut self, other: &LatencyHistogram) {
+        for (count, other_count) in self.counts.iter_mut().zip(other.counts.iter()) {
+            *count += other_count;
+        }
+        self.total_count += other.total_count;
+        self.min = self.min.min(other.min);
+        self.max = self.max.max(other.max);
+        self.sum += other.sum;
+        self.sum_of_squares += other.sum_of_squares;
+    }
+
+    /// Returns the number of recorded latencies.
+    pub fn len(&self) -> u64 {
+        self.total_count
+    }
+
+    /// Returns true when no latency was recorded.
+    pub fn is_empty(&self) -> bool {
+        self.total_count == 0
+    }
+
+    /// Returns the smallest recorded latency in nanoseconds.
+    pub fn min(&self) -> u64 {
+        if self.is_empty() { 0 } else { self.min }
+    }
+
+    /// Returns the largest recorded latency in nanoseconds.
+    pub fn max(&self) -> u64 {
+        self.max
+    }
+
+    /// Returns the arithmetic mean of all recorded latencies in nanoseconds.
+    pub fn mean(&self) -> f64 {
+        if self.is_empty() {
+            return 0.0;
+        }
+
+        self.sum as f64 / self.total_count as f64
+    }
+
+    /// Returns the standard deviation of all recorded latencies in nanoseconds.
+    pub fn jitter(&self) -> f64 {
+        if self.is_empty() {
+            return 0.0;
+        }
+
+        let mean = self.mean();
+        let variance = self.sum_of_squares as f64 / self.total_count as f64 - mean * mean;
+        variance.max(0.0).sqrt()
+    }
+
+    /// Returns the latency in nanoseconds below or equal to which `percentile` percent of all
+    /// recorded latencies are. The result is the upper bound of the corresponding bucket but
+    /// never larger than [`LatencyHistogram::max()`].
+    pub fn percentile(&self, percentile: f64) -> u64 {
+        if self.is_empty() {
+            return 0;
+        }
+
+        let percentile = percentile.clamp(0.0, 100.0);
+        let target = ((percentile / 100.0 * self.total_count as f64).ceil() as u64).max(1);
+
+        let mut count = 0;
+        for (index, bucket) in self.counts.iter().enumerate() {
+            count += bucket;
+            if count >= target {
+                return Self::highest_value_of(index).min(self.max);
+            }
+        }
+
+        self.max
+    }
+
+    fn index_of(value: u64) -> usize {
+        if value < SUB_BUCKET_COUNT as u64 {
+            return value as usize;
+        }
+
+        let magnitude = u64::BITS - 1 - value.leading_zeros();
+        let shift = magnitude - SUB_BUCKET_BITS;
+        (shift as usize + 1) * SUB_BUCKET_COUNT + (value >> shift) as usize - SUB_BUCKET_COUNT
+    }
+
+    fn highest_value_of(index: usize) -> u64 {
+        if index < SUB_BUCKET_COUNT {
+            return index as u64;
+        }
+
+        let shift = (index / SUB_BUCKET_COUNT - 1) as u32;
+        let sub_bucket = (index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT) as u64;
+        (sub_bucket << shift) + ((1u64 << shift) - 1)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn small_values_are_recorded_exactly() {
+        let mut sut = LatencyHistogram::new();
+        for n in 0..100 {
+            sut.record(Duration::from_nanos(n));
+        }
+
+        assert_eq!(sut.len(), 100);
+        assert_eq!(sut.min(), 0);
+        assert_eq!(sut.max(), 99);
+        assert_eq!(sut.percentile(50.0), 49);
+        assert_eq!(sut.percentile(99.0), 98);
+        assert_eq!(sut.percentile(100.0), 99);
+    }
+
+    #[test]
+    fn large_values_have_a_relative_error_below_one_percent() {
+        for value in [128u64, 1000, 12345, 987654, 1 << 40, u64::MAX] {
+            let index = LatencyHistogram::index_of(value);
+            let highest = LatencyHistogram::highest_value_of(index);
+
+            assert!(highest >= value);
+            assert!((highest - value) as f64 <= value as f64 / 100.0);
+            assert!(index < NUMBER_OF_BUCKETS);
+        }
+    }
+
+    #[test]
+    fn mean_and_jitter_are_computed_from_recorded_values() {
+        let mut sut = LatencyHistogram::new();
+        sut.record(Duration::from_nanos(10));
+        sut.record(Duration::from_nanos(30));
+
+        assert_eq!(sut.mean(), 20.0);
+        assert_eq!(sut.jitter(), 10.0);
+    }
+
+    #[test]
+    fn merged_histogram_contains_the_values_of_both() {
+        let mut sut = LatencyHistogram::new();
+        sut.record(Duration::from_nanos(10));
+        let mut other = LatencyHistogram::new();
+        other.record(Duration::from_nanos(30));
+        other.record(Duration::from_nanos(50));
+
+        sut.merge(&other);
+
+        assert_eq!(sut.len(), 3);
+        assert_eq!(sut.min(), 10);
+        assert_eq!(sut.max(), 50);
+        assert_eq!(sut.mean(), 30.0);
+        assert_eq!(sut.percentile(50.0), 30);
+    }
+
+    #[test]
+    fn empty_histogram_reports_zero() {
+        let sut = LatencyHistogram::new();
+
+        assert!(sut.is_empty());
+        assert_eq!(sut.min(), 0);
+        assert_eq!(sut.max(), 0);
+        assert_eq!(sut.percentile(99.0), 0);
+        assert_eq!(sut.mean(), 0.0);
+    }
+}
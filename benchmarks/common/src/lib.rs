@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![warn(missing_docs)]
+
+//! Building blocks shared by the iceoryx2 benchmarks. Every benchmark records the latency of
+//! each iteration into a [`LatencyHistogram`](crate::histogram::LatencyHistogram) and
+//! emits a [`Report`](crate::report::Report) with the percentiles, either human readable or
+//! as JSON.
+//!
+//! ```
+//! use core::time::Duration;
+//! use benchmark_common::histogram::LatencyHistogram;
+//! use benchmark_common::report::Report;
+//!
+//! let mut histogram = LatencyHistogram::new();
+//! for n in 0..1000 {
+//!     histogram.record_round_trip(Duration::from_nanos(200 + n));
+//! }
+//!
+//! Report::new("example", "local", 1000, Duration::from_micros(700), &histogram)
+//!     .parameter("payload_size", 8)
+//!     .emit(true);
+//! ```
+
+/// The CPU time consumed by the process.
+pub mod cpu_time;
+/// A latency histogram with constant time recording and percentile queries.
+pub mod histogram;
+/// The human readable and machine readable result of a benchmark run.
+pub mod report;
+/// Parameter sweeps shared by the benchmarks.
+pub mod sweep;
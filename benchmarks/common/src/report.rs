@@ -0,0 +1,262 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+
+use serde::Serialize;
+use serde_json::{Map, Value};
+
+use crate::histogram::LatencyHistogram;
+
+/// The latency distribution of a benchmark run in nanoseconds.
+#[derive(Debug, Clone, Serialize)]
+pub struct LatencyStatistics {
+    /// The smallest recorded latency
+    pub min: u64,
+    /// The arithmetic mean of all recorded latencies
+    pub mean: f64,
+    /// The median
+    pub p50: u64,
+    /// The 90th percentile
+    pub p90: u64,
+    /// The 99th percentile
+    pub p99: u64,
+    /// The 99.9th percentile
+    pub p99_9: u64,
+    /// The largest recorded latency
+    pub max: u64,
+    /// The standard deviation of all recorded latencies
+    pub jitter: f64,
+}
+
+impl From<&LatencyHistogram> for LatencyStatistics {
+    fn from(histogram: &LatencyHistogram) -> Self {
+        Self {
+            min: histogram.min(),
+            mean: histogram.mean(),
+            p50: histogram.percentile(50.0),
+            p90: histogram.percentile(90.0),
+            p99: histogram.percentile(99.0),
+            p99_9: histogram.percentile(99.9),
+            max: histogram.max(),
+            jitter: histogram.jitter(),
+        }
+    }
+}
+
+/// The result of a single benchmark run. It can be printed in a human readable form with
+/// [`Report::print()`] or as a single line of JSON with [`Report::print_json()`] so that
+/// the results can be collected and compared over releases.
+#[derive(Debug, Clone, Serialize)]
+pub struct Report {
+    benchmark: String,
+    setup: String,
+    iterations: u64,
+    time_s: f64,
+    average_latency_ns: u128,
+    latency_ns: LatencyStatistics,
+    parameters: Map<String, Value>,
+}
+
+impl Report {
+    /// Creates a new [`Report`]. `setup` describes the variant of the benchmark, e.g. the
+    /// service type, `time` is the total runtime of all `iterations`. The average latency is
+    /// the runtime divided by `2 * iterations` since every iteration is a round trip.
+    pub fn new(
+        benchmark: &str,
+        setup: &str,
+        iterations: u64,
+        time: Duration,
+        histogram: &LatencyHistogram,
+    ) -> Self {
+        Self {
+            benchmark: benchmark.into(),
+            setup: setup.into(),
+            iterations,
+            time_s: time.as_secs_f64(),
+            average_latency_ns: time.as_nanos() / (iterations.max(1) as u128 * 2),
+            latency_ns: histogram.into(),
+            parameters: Map::new(),
+        }
+    }
+
+    /// Creates a new [`Report`] for benchmarks that measure single operations instead of round
+    /// trips. The average latency is the runtime divided by `iterations`.
+    pub fn new_for_operations(
+        benchmark: &str,
+        setup: &str,
+        iterations: u64,
+        time: Duration,
+        histogram: &LatencyHistogram,
+    ) -> Self {
+        Self {
+            average_latency_ns: time.as_nanos() / iterations.max(1) as u128,
+            ..Self::new(benchmark, setup, iterations, time, histogram)
+        }
+    }
+
+    /// Adds a benchmark specific parameter to the [`Report`], e.g. the payload size.
+    pub fn parameter<V: Into<Value>>(mut self, name: &str, value: V) -> Self {
+        self.parameters.insert(name.into(), value.into());
+        self
+    }
+
+    /// Prints the [`Report`] either as JSON or in a human readable form.
+    pub fn emit(&self, as_json: bool) {
+        if as_json {
+            self.print_json();
+        } else {
+            self.print();
+        }
+    }
+
+    /// Prints the [`Report`] in a human readable form.
+    pub fn print(&self) {
+        let parameters = format_parameters(&self.parameters);
+        let latency = &self.latency_ns;
+        println!(
+            "[{}] {} ::: Iterations: {}, Time: {} s, Latency: {} ns{}",
+            self.benchmark,
+            self.setup,
+            self.iterations,
+            self.time_s,
+            self.average_latency_ns,
+            parameters
+        );
+        println!(
+            "[{}] {} ::: p50: {} ns, p90: {} ns, p99: {} ns, p99.9: {} ns, max: {} ns, jitter: {:.1} ns",
+            self.benchmark,
+            self.setup,
+            latency.p50,
+            latency.p90,
+            latency.p99,
+            latency.p99_9,
+            latency.max,
+            latency.jitter
+        );
+    }
+
+    /// Prints the [`Report`] as a single line of JSON.
+    pub fn print_json(&self) {
+        print_json(self);
+    }
+}
+
+/// The result of a throughput benchmark run. Like the [`Report`] it can be printed in a human
+/// readable form or as a single line of JSON.
+#[derive(Debug, Clone, Serialize)]
+pub struct ThroughputReport {
+    benchmark: String,
+    setup: String,
+    time_s: f64,
+    messages_sent: u64,
+    messages_received: u64,
+    sent_messages_per_s: f64,
+    received_messages_per_s: f64,
+    received_bytes_per_s: f64,
+    cpu_time_per_message_ns: Option<f64>,
+    parameters: Map<String, Value>,
+}
+
+impl ThroughputReport {
+    /// Creates a new [`ThroughputReport`]. `time` is the duration in which `messages_sent`
+    /// messages with a size of `payload_size` were sent and `messages_received` were
+    /// received, summed up over all senders and receivers.
+    pub fn new(
+        benchmark: &str,
+        setup: &str,
+        time: Duration,
+        payload_size: usize,
+        messages_sent: u64,
+        messages_received: u64,
+    ) -> Self {
+        let time_s = time.as_secs_f64();
+        let per_second = |value: f64| if time_s > 0.0 { value / time_s } else { 0.0 };
+
+        Self {
+            benchmark: benchmark.into(),
+            setup: setup.into(),
+            time_s,
+            messages_sent,
+            messages_received,
+            sent_messages_per_s: per_second(messages_sent as f64),
+            received_messages_per_s: per_second(messages_received as f64),
+            received_bytes_per_s: per_second(messages_received as f64 * payload_size as f64),
+            cpu_time_per_message_ns: None,
+            parameters: Map::new(),
+        }
+        .parameter("payload_size", payload_size)
+    }
+
+    /// Sets the CPU time the whole process consumed during the run. It is distributed over
+    /// all received messages.
+    pub fn cpu_time(mut self, cpu_time: Duration) -> Self {
+        self.cpu_time_per_message_ns =
+            Some(cpu_time.as_nanos() as f64 / self.messages_received.max(1) as f64);
+        self
+    }
+
+    /// Adds a benchmark specific parameter to the [`ThroughputReport`], e.g. the number of
+    /// senders.
+    pub fn parameter<V: Into<Value>>(mut self, name: &str, value: V) -> Self {
+        self.parameters.insert(name.into(), value.into());
+        self
+    }
+
+    /// Prints the [`ThroughputReport`] either as JSON or in a human readable form.
+    pub fn emit(&self, as_json: bool) {
+        if as_json {
+            print_json(self);
+        } else {
+            self.print();
+        }
+    }
+
+    /// Prints the [`ThroughputReport`] in a human readable form.
+    pub fn print(&self) {
+        let cpu_time = match self.cpu_time_per_message_ns {
+            Some(v) => format!("{v:.1} ns"),
+            None => "n/a".into(),
+        };
+
+        println!(
+            "[{}] {} ::: Time: {} s{}, Sent: {:.0} msg/s, Received: {:.0} msg/s, {:.3} MiB/s, CPU per message: {}",
+            self.benchmark,
+            self.setup,
+            self.time_s,
+            format_parameters(&self.parameters),
+            self.sent_messages_per_s,
+            self.received_messages_per_s,
+            self.received_bytes_per_s / (1024.0 * 1024.0),
+            cpu_time
+        );
+    }
+}
+
+fn format_parameters(parameters: &Map<String, Value>) -> String {
+    let mut result = String::new();
+    for (name, value) in parameters {
+        match value {
+            Value::String(value) => result.push_str(&format!(", {name}: {value}")),
+            value => result.push_str(&format!(", {name}: {value}")),
+        }
+    }
+
+    result
+}
+
+fn print_json<T: Serialize>(report: &T) {
+    match serde_json::to_string(report) {
+        Ok(json) => println!("{json}"),
+        Err(e) => eprintln!("Unable to serialize the benchmark report ({e:?})."),
+    }
+}
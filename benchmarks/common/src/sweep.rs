@@ -0,0 +1,32 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+/// Returns 1, 2, 4, ... up to and including `max`. It is used to sweep a parameter, like
+/// the number of ports, of a benchmark.
+///
+/// ```
+/// use benchmark_common::sweep::powers_of_two;
+///
+/// assert_eq!(powers_of_two(6), vec![1, 2, 4, 6]);
+/// assert_eq!(powers_of_two(0), vec![1]);
+/// ```
+pub fn powers_of_two(max: usize) -> Vec<usize> {
+    let mut values = Vec::new();
+    let mut value = 1;
+    while value < max {
+        values.push(value);
+        value *= 2;
+    }
+    values.push(max.max(1));
+
+    values
+}
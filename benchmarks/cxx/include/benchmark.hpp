@@ -0,0 +1,240 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_BENCHMARKS_BENCHMARK_HPP
+#define IOX2_BENCHMARKS_BENCHMARK_HPP
+
+#include "iox2/service_type.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace iox2::benchmark {
+
+/// Synchronizes a fixed number of threads, every thread blocks until all threads have arrived.
+class Barrier {
+  public:
+    explicit Barrier(const uint64_t number_of_threads)
+        : m_number_of_threads { number_of_threads } {
+    }
+
+    void wait() {
+        m_arrived.fetch_add(1, std::memory_order_acq_rel);
+        while (m_arrived.load(std::memory_order_acquire) < m_number_of_threads) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    uint64_t m_number_of_threads;
+    std::atomic<uint64_t> m_arrived { 0 };
+};
+
+/// Pins the calling thread to the provided cpu core. It is a best effort operation, the
+/// benchmark runs unpinned when the platform does not support it.
+inline void pin_current_thread_to(const uint64_t cpu_core) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu_core, &cpu_set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+        std::cerr << "Unable to pin the thread to cpu core " << cpu_core << ", running unpinned." << std::endl;
+    }
+#else
+    static_cast<void>(cpu_core);
+#endif
+}
+
+/// Spawns a participant of the benchmark on the provided cpu core.
+template <typename Callable>
+auto spawn_participant(const uint64_t cpu_core, Callable&& callable) -> std::thread {
+    return std::thread([cpu_core, callable = std::forward<Callable>(callable)]() mutable {
+        pin_current_thread_to(cpu_core);
+        callable();
+    });
+}
+
+/// Returns the name of the service type in the output format of the benchmarks.
+constexpr auto service_type_name(const ServiceType service_type) -> const char* {
+    return service_type == ServiceType::Ipc ? "iox2::ServiceType::Ipc" : "iox2::ServiceType::Local";
+}
+
+/// Measures the time that has passed since it was created.
+class Stopwatch {
+  public:
+    Stopwatch()
+        : m_start { std::chrono::steady_clock::now() } {
+    }
+
+    auto elapsed() const -> std::chrono::nanoseconds {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+    }
+
+  private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+inline auto as_secs_f64(const std::chrono::nanoseconds duration) -> double {
+    return std::chrono::duration<double>(duration).count();
+}
+
+/// A minimal command line parser that accepts the same flags as the `clap` based Rust
+/// benchmarks, e.g. `--iterations 1000`, `--iterations=1000` or `-i 1000`.
+class Arguments {
+  public:
+    struct Flag {
+        std::string long_name;
+        char short_name;
+        std::string description;
+        bool* value;
+    };
+
+    struct Option {
+        std::string long_name;
+        char short_name;
+        std::string description;
+        uint64_t* value;
+    };
+
+    Arguments(const char* name, const char* about)
+        : m_name { name }
+        , m_about { about } {
+    }
+
+    auto flag(const char* long_name, const char short_name, const char* description, bool& value) -> Arguments& {
+        m_flags.push_back(Flag { long_name, short_name, description, &value });
+        return *this;
+    }
+
+    auto option(const char* long_name, const char short_name, const char* description, uint64_t& value)
+        -> Arguments& {
+        m_options.push_back(Option { long_name, short_name, description, &value });
+        return *this;
+    }
+
+    /// Parses the command line. On `--help` the usage is printed and the process exits, on
+    /// an invalid argument the usage is printed and the process exits with an error.
+    void parse(const int argc, char** argv) {
+        for (int n = 1; n < argc; ++n) {
+            std::string argument { argv[n] };
+            if (argument == "--help" || argument == "-h") {
+                print_usage();
+                std::exit(EXIT_SUCCESS);
+            }
+
+            std::string value;
+            bool has_value = false;
+            const auto separator = argument.find('=');
+            if (argument.rfind("--", 0) == 0 && separator != std::string::npos) {
+                value = argument.substr(separator + 1);
+                argument = argument.substr(0, separator);
+                has_value = true;
+            }
+
+            if (auto* flag = find_flag(argument); flag != nullptr && !has_value) {
+                *flag->value = true;
+                continue;
+            }
+
+            auto* option = find_option(argument);
+            if (option == nullptr) {
+                fail(std::string("unexpected argument '") + argv[n] + "'");
+            }
+
+            if (!has_value) {
+                if (n + 1 >= argc) {
+                    fail("a value is required for '" + argument + "'");
+                }
+                value = argv[++n];
+            }
+
+            try {
+                size_t parsed_characters = 0;
+                *option->value = std::stoull(value, &parsed_characters);
+                if (parsed_characters != value.size()) {
+                    fail("invalid value '" + value + "' for '" + argument + "'");
+                }
+            } catch (const std::exception&) {
+                fail("invalid value '" + value + "' for '" + argument + "'");
+            }
+        }
+    }
+
+  private:
+    auto find_flag(const std::string& argument) -> Flag* {
+        for (auto& flag : m_flags) {
+            if (argument == "--" + flag.long_name
+                || (flag.short_name != '\0' && argument == std::string { '-', flag.short_name })) {
+                return &flag;
+            }
+        }
+        return nullptr;
+    }
+
+    auto find_option(const std::string& argument) -> Option* {
+        for (auto& option : m_options) {
+            if (argument == "--" + option.long_name
+                || (option.short_name != '\0' && argument == std::string { '-', option.short_name })) {
+                return &option;
+            }
+        }
+        return nullptr;
+    }
+
+    [[noreturn]] void fail(const std::string& message) const {
+        std::cerr << "error: " << message << std::endl << std::endl;
+        print_usage();
+        std::exit(EXIT_FAILURE);
+    }
+
+    static auto names(const std::string& long_name, const char short_name) -> std::string {
+        return short_name != '\0' ? std::string { '-', short_name } + ", --" + long_name : "    --" + long_name;
+    }
+
+    void print_usage() const {
+        std::cout << m_about << std::endl << std::endl;
+        std::cout << "Usage: " << m_name << " [OPTIONS]" << std::endl << std::endl;
+        std::cout << "Options:" << std::endl;
+        for (const auto& option : m_options) {
+            std::cout << "  " << names(option.long_name, option.short_name) << " <VALUE>" << std::endl;
+            std::cout << "          " << option.description << " [default: " << *option.value << "]" << std::endl;
+        }
+        for (const auto& flag : m_flags) {
+            std::cout << "  " << names(flag.long_name, flag.short_name) << std::endl;
+            std::cout << "          " << flag.description << std::endl;
+        }
+        std::cout << "  -h, --help" << std::endl;
+        std::cout << "          Print help" << std::endl;
+    }
+
+    const char* m_name;
+    const char* m_about;
+    std::vector<Flag> m_flags;
+    std::vector<Option> m_options;
+};
+
+} // namespace iox2::benchmark
+
+#endif
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "benchmark.hpp"
+#include "iox2/iceoryx2.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+using namespace iox2;
+using namespace iox2::benchmark;
+
+constexpr uint64_t ITERATIONS = 1000000;
+constexpr uint64_t EVENT_ID_MAX_VALUE = 128;
+
+struct Args {
+    uint64_t iterations { ITERATIONS };
+    bool bench_all { false };
+    bool bench_ipc { false };
+    bool bench_local { false };
+    uint64_t max_event_id { EVENT_ID_MAX_VALUE };
+    bool debug_mode { false };
+    uint64_t cpu_core_participant_1 { 0 };
+    uint64_t cpu_core_participant_2 { 1 };
+    uint64_t number_of_additional_notifiers { 0 };
+    uint64_t number_of_additional_listeners { 0 };
+};
+
+template <ServiceType S>
+void perform_benchmark(const Args& args) {
+    auto node = NodeBuilder().create<S>().value();
+
+    auto service_a2b = node.service_builder(ServiceName::create("a2b").value())
+                           .event()
+                           .max_notifiers(1 + args.number_of_additional_notifiers)
+                           .max_listeners(1 + args.number_of_additional_listeners)
+                           .event_id_max_value(args.max_event_id)
+                           .create()
+                           .value();
+
+    auto service_b2a = node.service_builder(ServiceName::create("b2a").value())
+                           .event()
+                           .max_notifiers(1 + args.number_of_additional_notifiers)
+                           .max_listeners(1 + args.number_of_additional_listeners)
+                           .event_id_max_value(args.max_event_id)
+                           .create()
+                           .value();
+
+    std::vector<Notifier<S>> additional_notifiers;
+    std::vector<Listener<S>> additional_listeners;
+
+    for (uint64_t n = 0; n < args.number_of_additional_notifiers; ++n) {
+        additional_notifiers.push_back(service_a2b.notifier_builder().create().value());
+        additional_notifiers.push_back(service_b2a.notifier_builder().create().value());
+    }
+
+    for (uint64_t n = 0; n < args.number_of_additional_listeners; ++n) {
+        additional_listeners.push_back(service_a2b.listener_builder().create().value());
+        additional_listeners.push_back(service_b2a.listener_builder().create().value());
+    }
+
+    Barrier startup_barrier { 3 };
+    Barrier start_benchmark_barrier { 3 };
+
+    auto t1 = spawn_participant(args.cpu_core_participant_1, [&] {
+        auto notifier_a2b = service_a2b.notifier_builder().create().value();
+        auto listener_b2a = service_b2a.listener_builder().create().value();
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        notifier_a2b.notify().value();
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            while (listener_b2a.blocking_wait([](EventActivation) {}).value() == 0) { }
+            notifier_a2b.notify().value();
+        }
+    });
+
+    auto t2 = spawn_participant(args.cpu_core_participant_2, [&] {
+        auto notifier_b2a = service_b2a.notifier_builder().create().value();
+        auto listener_a2b = service_a2b.listener_builder().create().value();
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            while (listener_a2b.blocking_wait([](EventActivation) {}).value() == 0) { }
+            notifier_b2a.notify().value();
+        }
+    });
+
+    startup_barrier.wait();
+    const Stopwatch stopwatch;
+    start_benchmark_barrier.wait();
+
+    t1.join();
+    t2.join();
+
+    const auto stop = stopwatch.elapsed();
+    std::cout << service_type_name(S) << " ::: MaxEventId: " << args.max_event_id
+              << ", Iterations: " << args.iterations << ", Time: " << as_secs_f64(stop)
+              << " s, Latency: " << stop.count() / (args.iterations * 2) << " ns" << std::endl;
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    Args args;
+    Arguments("benchmark-cxx-event", "Event latency benchmark of the C++ bindings")
+        .option("iterations", 'i', "Number of iterations the A --> B --> A communication is repeated", args.iterations)
+        .flag("bench-all", 'b', "Run benchmark for every service setup", args.bench_all)
+        .flag("bench-ipc", '\0', "Run benchmark for the IPC zero copy setup", args.bench_ipc)
+        .flag("bench-local", '\0', "Run benchmark for the process local setup", args.bench_local)
+        .option("max-event-id", 'm', "The greatest supported EventId", args.max_event_id)
+        .flag("debug-mode", 'd', "Activate full log output", args.debug_mode)
+        .option("cpu-core-participant-1",
+                '\0',
+                "The cpu core that shall be used by participant 1",
+                args.cpu_core_participant_1)
+        .option("cpu-core-participant-2",
+                '\0',
+                "The cpu core that shall be used by participant 2",
+                args.cpu_core_participant_2)
+        .option("number-of-additional-notifiers",
+                '\0',
+                "The number of additional notifiers per service in the setup",
+                args.number_of_additional_notifiers)
+        .option("number-of-additional-listeners",
+                '\0',
+                "The number of additional listeners per service in the setup",
+                args.number_of_additional_listeners)
+        .parse(argc, argv);
+
+    iox2::set_log_level(args.debug_mode ? iox2::LogLevel::Trace : iox2::LogLevel::Error);
+
+    auto at_least_one_benchmark_did_run = false;
+
+    if (args.bench_ipc || args.bench_all) {
+        perform_benchmark<iox2::ServiceType::Ipc>(args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if (args.bench_local || args.bench_all) {
+        perform_benchmark<iox2::ServiceType::Local>(args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if (!at_least_one_benchmark_did_run) {
+        std::cout << "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+                  << std::endl;
+    }
+
+    return 0;
+}
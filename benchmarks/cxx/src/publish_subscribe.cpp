@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "benchmark.hpp"
+#include "iox2/iceoryx2.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace iox2;
+using namespace iox2::benchmark;
+
+constexpr uint64_t ITERATIONS = 10000000;
+constexpr uint64_t PAYLOAD_SIZE = 8192;
+
+struct Args {
+    uint64_t iterations { ITERATIONS };
+    bool bench_all { false };
+    bool bench_ipc { false };
+    bool bench_local { false };
+    bool debug_mode { false };
+    uint64_t cpu_core_participant_1 { 0 };
+    uint64_t cpu_core_participant_2 { 1 };
+    uint64_t payload_size { PAYLOAD_SIZE };
+    bool send_copy { false };
+    bool non_temporal_copy { false };
+    uint64_t number_of_additional_publishers { 0 };
+    uint64_t number_of_additional_subscribers { 0 };
+};
+
+template <ServiceType S>
+void perform_benchmark(const Args& args) {
+    using Payload = bb::Slice<uint8_t>;
+
+    auto node = NodeBuilder().create<S>().value();
+
+    auto service_a2b = node.service_builder(ServiceName::create("a2b").value())
+                           .template publish_subscribe<Payload>()
+                           .max_publishers(1 + args.number_of_additional_publishers)
+                           .max_subscribers(1 + args.number_of_additional_subscribers)
+                           .history_size(0)
+                           .subscriber_max_buffer_size(1)
+                           .enable_safe_overflow(true)
+                           .create()
+                           .value();
+
+    auto service_b2a = node.service_builder(ServiceName::create("b2a").value())
+                           .template publish_subscribe<Payload>()
+                           .max_publishers(1 + args.number_of_additional_publishers)
+                           .max_subscribers(1 + args.number_of_additional_subscribers)
+                           .history_size(0)
+                           .subscriber_max_buffer_size(1)
+                           .enable_safe_overflow(true)
+                           .create()
+                           .value();
+
+    std::vector<Publisher<S, Payload, void>> additional_publishers;
+    std::vector<Subscriber<S, Payload, void>> additional_subscribers;
+
+    for (uint64_t n = 0; n < args.number_of_additional_publishers; ++n) {
+        additional_publishers.push_back(service_a2b.publisher_builder().create().value());
+        additional_publishers.push_back(service_b2a.publisher_builder().create().value());
+    }
+
+    for (uint64_t n = 0; n < args.number_of_additional_subscribers; ++n) {
+        additional_subscribers.push_back(service_a2b.subscriber_builder().create().value());
+        additional_subscribers.push_back(service_b2a.subscriber_builder().create().value());
+    }
+
+    Barrier startup_barrier { 3 };
+    Barrier start_benchmark_barrier { 3 };
+
+    const auto copy_strategy = args.non_temporal_copy ? CopyStrategy::NonTemporal : CopyStrategy::Regular;
+
+    auto t1 = spawn_participant(args.cpu_core_participant_1, [&] {
+        auto sender_a2b = service_a2b.publisher_builder()
+                              .initial_max_slice_len(args.payload_size)
+                              .copy_strategy(copy_strategy)
+                              .create()
+                              .value();
+        auto receiver_b2a = service_b2a.subscriber_builder().create().value();
+        std::vector<uint8_t> source(args.payload_size, 0);
+        bb::ImmutableSlice<uint8_t> source_slice { source.data(), source.size() };
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        if (args.send_copy) {
+            for (uint64_t n = 0; n < args.iterations; ++n) {
+                sender_a2b.send_slice_copy(source_slice).value();
+                while (!receiver_b2a.receive().value().has_value()) { }
+            }
+        } else {
+            auto sample = assume_init(sender_a2b.loan_slice_uninit(args.payload_size).value());
+            for (uint64_t n = 0; n < args.iterations; ++n) {
+                send(std::move(sample)).value();
+                sample = assume_init(sender_a2b.loan_slice_uninit(args.payload_size).value());
+                while (!receiver_b2a.receive().value().has_value()) { }
+            }
+        }
+    });
+
+    auto t2 = spawn_participant(args.cpu_core_participant_2, [&] {
+        auto sender_b2a = service_b2a.publisher_builder()
+                              .initial_max_slice_len(args.payload_size)
+                              .copy_strategy(copy_strategy)
+                              .create()
+                              .value();
+        auto receiver_a2b = service_a2b.subscriber_builder().create().value();
+        std::vector<uint8_t> source(args.payload_size, 0);
+        bb::ImmutableSlice<uint8_t> source_slice { source.data(), source.size() };
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            if (args.send_copy) {
+                while (!receiver_a2b.receive().value().has_value()) { }
+
+                sender_b2a.send_slice_copy(source_slice).value();
+            } else {
+                auto sample = assume_init(sender_b2a.loan_slice_uninit(args.payload_size).value());
+
+                while (!receiver_a2b.receive().value().has_value()) { }
+
+                send(std::move(sample)).value();
+            }
+        }
+    });
+
+    startup_barrier.wait();
+    const Stopwatch stopwatch;
+    start_benchmark_barrier.wait();
+
+    t1.join();
+    t2.join();
+
+    const auto stop = stopwatch.elapsed();
+    std::cout << service_type_name(S) << " ::: Iterations: " << args.iterations << ", Time: " << as_secs_f64(stop)
+              << " s, Latency: " << stop.count() / (args.iterations * 2) << " ns, Sample Size: " << args.payload_size
+              << ", Copy Strategy: " << (args.non_temporal_copy ? "NonTemporal" : "Regular") << std::endl;
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    Args args;
+    Arguments("benchmark-cxx-publish-subscribe", "Publish-subscribe latency benchmark of the C++ bindings")
+        .option("iterations", 'i', "Number of iterations the A --> B --> A communication is repeated", args.iterations)
+        .flag("bench-all", 'b', "Run benchmark for every service setup", args.bench_all)
+        .flag("bench-ipc", '\0', "Run benchmark for the IPC zero copy setup", args.bench_ipc)
+        .flag("bench-local", '\0', "Run benchmark for the process local setup", args.bench_local)
+        .flag("debug-mode", 'd', "Activate full log output", args.debug_mode)
+        .option("cpu-core-participant-1",
+                '\0',
+                "The cpu core that shall be used by participant 1",
+                args.cpu_core_participant_1)
+        .option("cpu-core-participant-2",
+                '\0',
+                "The cpu core that shall be used by participant 2",
+                args.cpu_core_participant_2)
+        .option("payload-size", 'p', "The size in bytes of the payload that shall be used", args.payload_size)
+        .flag("send-copy", '\0', "Send a copy of the payload instead of performing true zero-copy", args.send_copy)
+        .flag("non-temporal-copy",
+              '\0',
+              "Use streaming stores that bypass the cache when the payload is copied with '--send-copy'",
+              args.non_temporal_copy)
+        .option("number-of-additional-publishers",
+                '\0',
+                "The number of additional publishers per service in the setup",
+                args.number_of_additional_publishers)
+        .option("number-of-additional-subscribers",
+                '\0',
+                "The number of additional subscribers per service in the setup",
+                args.number_of_additional_subscribers)
+        .parse(argc, argv);
+
+    iox2::set_log_level(args.debug_mode ? iox2::LogLevel::Trace : iox2::LogLevel::Error);
+
+    auto at_least_one_benchmark_did_run = false;
+
+    if (args.bench_ipc || args.bench_all) {
+        perform_benchmark<iox2::ServiceType::Ipc>(args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if (args.bench_local || args.bench_all) {
+        perform_benchmark<iox2::ServiceType::Local>(args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if (!at_least_one_benchmark_did_run) {
+        std::cout << "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "benchmark.hpp"
+#include "iox2/iceoryx2.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace iox2;
+using namespace iox2::benchmark;
+
+constexpr uint64_t ITERATIONS = 10000000;
+
+struct Args {
+    uint64_t iterations { ITERATIONS };
+    bool debug_mode { false };
+    uint64_t cpu_core_participant_1 { 0 };
+    uint64_t cpu_core_participant_2 { 1 };
+    uint64_t number_of_additional_servers { 0 };
+    uint64_t number_of_additional_clients { 0 };
+};
+
+template <ServiceType S>
+using BenchmarkService = PortFactoryRequestResponse<S, uint64_t, void, uint64_t, void>;
+
+template <ServiceType S>
+auto create_service(Node<S>& node, const char* name, const Args& args) -> BenchmarkService<S> {
+    return node.service_builder(ServiceName::create(name).value())
+        .template request_response<uint64_t, uint64_t>()
+        .max_servers(1 + args.number_of_additional_servers)
+        .max_clients(1 + args.number_of_additional_clients)
+        .max_response_buffer_size(1)
+        .create()
+        .value();
+}
+
+/// Creates the additional ports that are connected to the services but never communicate,
+/// they quantify the overhead of the fan-out.
+template <ServiceType S>
+class AdditionalPorts {
+  public:
+    AdditionalPorts(const BenchmarkService<S>& service_a2b, const BenchmarkService<S>& service_b2a, const Args& args) {
+        for (uint64_t n = 0; n < args.number_of_additional_clients; ++n) {
+            m_clients.push_back(service_a2b.client_builder().create().value());
+            m_clients.push_back(service_b2a.client_builder().create().value());
+        }
+
+        for (uint64_t n = 0; n < args.number_of_additional_servers; ++n) {
+            m_servers.push_back(service_a2b.server_builder().create().value());
+            m_servers.push_back(service_b2a.server_builder().create().value());
+        }
+    }
+
+  private:
+    std::vector<Client<S, uint64_t, void, uint64_t, void>> m_clients;
+    std::vector<Server<S, uint64_t, void, uint64_t, void>> m_servers;
+};
+
+template <ServiceType S>
+void perform_response_stream_benchmark(const Args& args) {
+    auto node = NodeBuilder().create<S>().value();
+
+    auto service_a2b = create_service(node, "a2b", args);
+    auto service_b2a = create_service(node, "b2a", args);
+    const AdditionalPorts<S> additional_ports { service_a2b, service_b2a, args };
+
+    Barrier startup_barrier { 3 };
+    Barrier start_benchmark_barrier { 3 };
+
+    auto t1 = spawn_participant(args.cpu_core_participant_1, [&] {
+        auto client_a2b = service_a2b.client_builder().create().value();
+        auto server_b2a = service_b2a.server_builder().create().value();
+
+        startup_barrier.wait();
+        auto pending_response = client_a2b.send_copy(0).value();
+        while (!server_b2a.has_requests().value()) { }
+        auto active_request = std::move(server_b2a.receive().value().value());
+        start_benchmark_barrier.wait();
+
+        auto response = assume_init(active_request.loan_uninit().value());
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            send(std::move(response)).value();
+            response = assume_init(active_request.loan_uninit().value());
+            while (!pending_response.receive().value().has_value()) { }
+        }
+    });
+
+    auto t2 = spawn_participant(args.cpu_core_participant_2, [&] {
+        auto server_a2b = service_a2b.server_builder().create().value();
+        auto client_b2a = service_b2a.client_builder().create().value();
+
+        startup_barrier.wait();
+        auto pending_response = client_b2a.send_copy(0).value();
+        while (!server_a2b.has_requests().value()) { }
+        auto active_request = std::move(server_a2b.receive().value().value());
+        start_benchmark_barrier.wait();
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            auto response = assume_init(active_request.loan_uninit().value());
+            while (!pending_response.receive().value().has_value()) { }
+
+            send(std::move(response)).value();
+        }
+    });
+
+    startup_barrier.wait();
+    const Stopwatch stopwatch;
+    start_benchmark_barrier.wait();
+
+    t1.join();
+    t2.join();
+
+    const auto stop = stopwatch.elapsed();
+    std::cout << "[RESPONSE_STREAM] " << service_type_name(S) << " ::: Iterations: " << args.iterations
+              << ", Time: " << as_secs_f64(stop) << " s, Latency: " << stop.count() / (args.iterations * 2) << " ns"
+              << std::endl;
+}
+
+template <ServiceType S>
+void perform_request_benchmark(const Args& args) {
+    auto node = NodeBuilder().create<S>().value();
+
+    auto service_a2b = create_service(node, "a2b", args);
+    auto service_b2a = create_service(node, "b2a", args);
+    const AdditionalPorts<S> additional_ports { service_a2b, service_b2a, args };
+
+    Barrier startup_barrier { 3 };
+    Barrier start_benchmark_barrier { 3 };
+
+    auto t1 = spawn_participant(args.cpu_core_participant_1, [&] {
+        auto client_a2b = service_a2b.client_builder().create().value();
+        auto server_b2a = service_b2a.server_builder().create().value();
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        auto request = assume_init(client_a2b.loan_uninit().value());
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            send(std::move(request)).value();
+            request = assume_init(client_a2b.loan_uninit().value());
+            while (!server_b2a.receive().value().has_value()) { }
+        }
+    });
+
+    auto t2 = spawn_participant(args.cpu_core_participant_2, [&] {
+        auto client_b2a = service_b2a.client_builder().create().value();
+        auto server_a2b = service_a2b.server_builder().create().value();
+
+        startup_barrier.wait();
+        start_benchmark_barrier.wait();
+
+        for (uint64_t n = 0; n < args.iterations; ++n) {
+            auto request = assume_init(client_b2a.loan_uninit().value());
+            while (!server_a2b.receive().value().has_value()) { }
+
+            send(std::move(request)).value();
+        }
+    });
+
+    startup_barrier.wait();
+    const Stopwatch stopwatch;
+    start_benchmark_barrier.wait();
+
+    t1.join();
+    t2.join();
+
+    const auto stop = stopwatch.elapsed();
+    std::cout << "[REQUESTS] " << service_type_name(S) << " ::: Iterations: " << args.iterations
+              << ", Time: " << as_secs_f64(stop) << " s, Latency: " << stop.count() / (args.iterations * 2) << " ns"
+              << std::endl;
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    Args args;
+    Arguments("benchmark-cxx-request-response", "Request-response latency benchmark of the C++ bindings")
+        .option("iterations", 'i', "Number of iterations the A --> B --> A communication is repeated", args.iterations)
+        .flag("debug-mode", 'd', "Activate full log output", args.debug_mode)
+        .option("cpu-core-participant-1",
+                '\0',
+                "The cpu core that shall be used by participant 1",
+                args.cpu_core_participant_1)
+        .option("cpu-core-participant-2",
+                '\0',
+                "The cpu core that shall be used by participant 2",
+                args.cpu_core_participant_2)
+        .option("number-of-additional-servers",
+                '\0',
+                "The number of additional servers per service in the setup",
+                args.number_of_additional_servers)
+        .option("number-of-additional-clients",
+                '\0',
+                "The number of additional clients per service in the setup",
+                args.number_of_additional_clients)
+        .parse(argc, argv);
+
+    iox2::set_log_level(args.debug_mode ? iox2::LogLevel::Trace : iox2::LogLevel::Error);
+
+    perform_request_benchmark<iox2::ServiceType::Ipc>(args);
+    perform_request_benchmark<iox2::ServiceType::Local>(args);
+    perform_response_stream_benchmark<iox2::ServiceType::Ipc>(args);
+    perform_response_stream_benchmark<iox2::ServiceType::Local>(args);
+
+    return 0;
+}
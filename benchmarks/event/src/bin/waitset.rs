@@ -0,0 +1,403 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+extern crate iceoryx2_bb_loggers;
+
+use core::time::Duration;
+use std::time::Instant;
+
+use benchmark_common::cpu_time::process_cpu_time;
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
+use clap::{Parser, ValueEnum};
+use iceoryx2::prelude::*;
+use iceoryx2_bb_posix::barrier::*;
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_posix::thread::ThreadBuilder;
+use iceoryx2_cal::event::Event;
+use iceoryx2_cal::event::event_state::counting_bit_set::RelocatableCountingBitSet;
+
+// the deadlines and intervals of the background attachments never expire during a run
+const BACKGROUND_TIMEOUT: Duration = Duration::from_secs(3600);
+
+type BenchmarkResult<T> = Result<T, Box<dyn core::error::Error>>;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum AttachmentKind {
+    Notification,
+    Deadline,
+    Interval,
+}
+
+impl AttachmentKind {
+    fn name(&self) -> &'static str {
+        match self {
+            AttachmentKind::Notification => "notification",
+            AttachmentKind::Deadline => "deadline",
+            AttachmentKind::Interval => "interval",
+        }
+    }
+}
+
+struct Setup {
+    reactor_backend: ReactorBackend,
+    attachment_kind: AttachmentKind,
+    number_of_attachments: usize,
+}
+
+struct Measurement {
+    wake_up_time: Duration,
+    wake_up: LatencyHistogram,
+    dispatch_time: Duration,
+    dispatch: LatencyHistogram,
+    dispatched_attachments: u64,
+    idle_time: Duration,
+    idle: LatencyHistogram,
+    idle_cpu_time: Option<Duration>,
+}
+
+/// The [`WaitSet`] has `number_of_attachments` attachments. One of them is the listener of
+/// `a2b` that is woken up by a second thread, all others are background attachments of the
+/// [`AttachmentKind`] of the [`Setup`].
+fn perform_benchmark<T: Service>(args: &Args, setup: &Setup) -> BenchmarkResult<Measurement>
+where
+    <T::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+{
+    let number_of_background_attachments = setup.number_of_attachments.saturating_sub(1);
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let service_a2b = node
+        .service_builder(&ServiceName::new("waitset_a2b")?)
+        .event()
+        .create()?;
+    let service_b2a = node
+        .service_builder(&ServiceName::new("waitset_b2a")?)
+        .event()
+        .create()?;
+    let service_background = node
+        .service_builder(&ServiceName::new("waitset_background")?)
+        .event()
+        .max_listeners(number_of_background_attachments.max(1))
+        .create()?;
+
+    let listener_a2b = service_a2b.listener_builder().create()?;
+    let notifier_b2a = service_b2a.notifier_builder().create()?;
+    let notifier_background = service_background.notifier_builder().create()?;
+
+    let mut background_listeners = Vec::new();
+    if setup.attachment_kind != AttachmentKind::Interval {
+        for _ in 0..number_of_background_attachments {
+            background_listeners.push(service_background.listener_builder().create()?);
+        }
+    }
+
+    let waitset = WaitSetBuilder::new()
+        .reactor_backend(setup.reactor_backend)
+        .waiting_thread_affinity(&[args.cpu_core_participant_1])
+        .create::<T>()?;
+
+    let mut background_guards = Vec::with_capacity(number_of_background_attachments);
+    match setup.attachment_kind {
+        AttachmentKind::Notification => {
+            for listener in &background_listeners {
+                background_guards.push(waitset.attach_notification(listener)?);
+            }
+        }
+        AttachmentKind::Deadline => {
+            for listener in &background_listeners {
+                background_guards.push(waitset.attach_deadline(listener, BACKGROUND_TIMEOUT)?);
+            }
+        }
+        AttachmentKind::Interval => {
+            for _ in 0..number_of_background_attachments {
+                background_guards.push(waitset.attach_interval(BACKGROUND_TIMEOUT)?);
+            }
+        }
+    }
+    let guard_a2b = waitset.attach_notification(&listener_a2b)?;
+
+    // wake-up latency: the second thread notifies the listener of a2b and waits until
+    // the WaitSet thread responds on b2a
+    let startup_barrier_handle = BarrierHandle::new();
+    let startup_barrier = BarrierBuilder::new(2)
+        .create(&startup_barrier_handle)
+        .unwrap();
+
+    let mut wake_up = LatencyHistogram::new();
+    let t1 = ThreadBuilder::new()
+        .affinity(&[args.cpu_core_participant_2])
+        .priority(255)
+        .spawn(|| {
+            let notifier_a2b = service_a2b.notifier_builder().create().unwrap();
+            let listener_b2a = service_b2a.listener_builder().create().unwrap();
+
+            startup_barrier.wait();
+
+            for _ in 0..args.iterations {
+                let round_trip = Instant::now();
+                notifier_a2b.notify().expect("failed to notify");
+                while listener_b2a.blocking_wait(|_| {}).unwrap() == 0 {}
+                wake_up.record_round_trip(round_trip.elapsed());
+            }
+        })?;
+
+    startup_barrier.wait();
+    let start = Instant::now();
+    let mut responses = 0;
+    while responses < args.iterations {
+        waitset.wait_and_process_once(|attachment_id| {
+            if attachment_id.has_event_from(&guard_a2b) {
+                while listener_a2b.try_wait(|_| {}).unwrap() != 0 {}
+                notifier_b2a.notify().expect("failed to notify");
+                responses += 1;
+            }
+            CallbackProgression::Continue
+        })?;
+    }
+    drop(t1);
+    let wake_up_time = start.elapsed();
+
+    // per-cycle dispatch cost: the notifications are not consumed, so every cycle
+    // dispatches all ready attachments again without blocking
+    notifier_background.notify()?;
+    service_a2b.notifier_builder().create()?.notify()?;
+
+    let mut dispatch = LatencyHistogram::new();
+    let mut dispatched_attachments = 0u64;
+    let start = Instant::now();
+    for _ in 0..args.iterations {
+        let cycle = Instant::now();
+        waitset.wait_and_process_once(|_| {
+            dispatched_attachments += 1;
+            CallbackProgression::Continue
+        })?;
+        dispatch.record(cycle.elapsed());
+    }
+    let dispatch_time = start.elapsed();
+
+    while listener_a2b.try_wait(|_| {})? != 0 {}
+    for listener in &background_listeners {
+        while listener.try_wait(|_| {})? != 0 {}
+    }
+
+    // CPU when idle: no attachment becomes ready until the timeout is hit
+    let mut idle = LatencyHistogram::new();
+    let idle_timeout = Duration::from_millis(args.idle_duration_in_ms);
+    let cpu_time_at_start = process_cpu_time();
+    let start = Instant::now();
+    waitset.wait_and_process_once_with_timeout(|_| CallbackProgression::Continue, idle_timeout)?;
+    let idle_time = start.elapsed();
+    let idle_cpu_time = match (cpu_time_at_start, process_cpu_time()) {
+        (Some(start), Some(stop)) => Some(stop.saturating_sub(start)),
+        _ => None,
+    };
+    idle.record(idle_time);
+
+    drop(guard_a2b);
+    drop(background_guards);
+
+    Ok(Measurement {
+        wake_up_time,
+        wake_up,
+        dispatch_time,
+        dispatch,
+        dispatched_attachments,
+        idle_time,
+        idle,
+        idle_cpu_time,
+    })
+}
+
+fn run<T: Service>(args: &Args)
+where
+    <T::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+{
+    for reactor_backend in args.reactor_backend.backends() {
+        for attachment_kind in args.attachment_kind.kinds() {
+            for number_of_attachments in &args.attachments {
+                let setup = Setup {
+                    reactor_backend: *reactor_backend,
+                    attachment_kind: *attachment_kind,
+                    number_of_attachments: (*number_of_attachments).max(1),
+                };
+
+                match perform_benchmark::<T>(args, &setup) {
+                    Ok(measurement) => report::<T>(args, &setup, &measurement),
+                    Err(e) => eprintln!(
+                        "{} ::: {:?} ::: {} x {} ::: skipped ({e})",
+                        core::any::type_name::<T>(),
+                        setup.reactor_backend,
+                        setup.number_of_attachments,
+                        setup.attachment_kind.name()
+                    ),
+                }
+            }
+        }
+    }
+}
+
+fn report<T: Service>(args: &Args, setup: &Setup, measurement: &Measurement) {
+    let with_setup = |report: Report| {
+        report
+            .parameter("reactor_backend", format!("{:?}", setup.reactor_backend))
+            .parameter("attachment_kind", setup.attachment_kind.name())
+            .parameter("attachments", setup.number_of_attachments)
+    };
+
+    with_setup(Report::new(
+        "waitset_wake_up",
+        core::any::type_name::<T>(),
+        args.iterations,
+        measurement.wake_up_time,
+        &measurement.wake_up,
+    ))
+    .emit(args.json);
+
+    with_setup(Report::new_for_operations(
+        "waitset_dispatch",
+        core::any::type_name::<T>(),
+        args.iterations,
+        measurement.dispatch_time,
+        &measurement.dispatch,
+    ))
+    .parameter(
+        "ready_attachments",
+        measurement.dispatched_attachments / args.iterations.max(1),
+    )
+    .emit(args.json);
+
+    let idle = with_setup(Report::new_for_operations(
+        "waitset_idle",
+        core::any::type_name::<T>(),
+        1,
+        measurement.idle_time,
+        &measurement.idle,
+    ));
+    match measurement.idle_cpu_time {
+        Some(cpu_time) => idle.parameter("cpu_time_ns", cpu_time.as_nanos() as u64),
+        None => idle,
+    }
+    .emit(args.json);
+}
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum ReactorBackendSelection {
+    Recommended,
+    IoUring,
+    All,
+}
+
+impl ReactorBackendSelection {
+    fn backends(&self) -> &'static [ReactorBackend] {
+        match self {
+            ReactorBackendSelection::Recommended => &[ReactorBackend::Recommended],
+            ReactorBackendSelection::IoUring => &[ReactorBackend::IoUring],
+            ReactorBackendSelection::All => &[ReactorBackend::Recommended, ReactorBackend::IoUring],
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum AttachmentKindSelection {
+    Notification,
+    Deadline,
+    Interval,
+    All,
+}
+
+impl AttachmentKindSelection {
+    fn kinds(&self) -> &'static [AttachmentKind] {
+        match self {
+            AttachmentKindSelection::Notification => &[AttachmentKind::Notification],
+            AttachmentKindSelection::Deadline => &[AttachmentKind::Deadline],
+            AttachmentKindSelection::Interval => &[AttachmentKind::Interval],
+            AttachmentKindSelection::All => &[
+                AttachmentKind::Notification,
+                AttachmentKind::Deadline,
+                AttachmentKind::Interval,
+            ],
+        }
+    }
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// Number of wake-ups and dispatch cycles that are measured for every setup
+    #[clap(short, long, default_value_t = 10000)]
+    iterations: u64,
+    /// Run benchmark for every service setup
+    #[clap(short, long)]
+    bench_all: bool,
+    /// Run benchmark for the IPC zero copy setup
+    #[clap(long)]
+    bench_ipc: bool,
+    /// Run benchmark for the process local setup
+    #[clap(long)]
+    bench_local: bool,
+    /// The comma separated numbers of attachments of the WaitSet
+    #[clap(long, value_delimiter = ',', default_value = "1,10,100,1000,5000")]
+    attachments: Vec<usize>,
+    /// The kind of the background attachments
+    #[clap(long, value_enum, default_value_t = AttachmentKindSelection::All)]
+    attachment_kind: AttachmentKindSelection,
+    /// The reactor backend of the WaitSet
+    #[clap(long, value_enum, default_value_t = ReactorBackendSelection::All)]
+    reactor_backend: ReactorBackendSelection,
+    /// The duration in milliseconds the idle WaitSet waits while its CPU time is measured
+    #[clap(long, default_value_t = 1000)]
+    idle_duration_in_ms: u64,
+    /// Activate full log output
+    #[clap(short, long)]
+    debug_mode: bool,
+    /// The cpu core that shall be used by the thread that waits on the WaitSet
+    #[clap(long, default_value_t = 0)]
+    cpu_core_participant_1: usize,
+    /// The cpu core that shall be used by the thread that wakes up the WaitSet
+    #[clap(long, default_value_t = 1)]
+    cpu_core_participant_2: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+
+    if args.debug_mode {
+        set_log_level(LogLevel::Trace);
+    } else {
+        set_log_level(LogLevel::Error);
+    }
+
+    let mut at_least_one_benchmark_did_run = false;
+
+    if args.bench_ipc || args.bench_all {
+        run::<ipc::Service>(&args);
+        run::<ipc_threadsafe::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if args.bench_local || args.bench_all {
+        run::<local::Service>(&args);
+        run::<local_threadsafe::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if !at_least_one_benchmark_did_run {
+        println!(
+            "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+        );
+    }
+
+    Ok(())
+}
@@ -10,6 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use std::time::Instant;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_posix::barrier::*;
@@ -61,6 +65,8 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(&[args.cpu_core_participant_1])
         .priority(255)
@@ -73,8 +79,11 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
 
             notifier_a2b.notify().expect("failed to notify");
 
+            let mut round_trip = Instant::now();
             for _ in 0..args.iterations {
                 while listener_b2a.blocking_wait(|_| {}).unwrap() == 0 {}
+                histogram.record_round_trip(round_trip.elapsed());
+                round_trip = Instant::now();
                 notifier_a2b.notify().expect("failed to notify");
             }
         });
@@ -103,14 +112,15 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: MaxEventId: {}, Iterations: {}, Time: {} s, Latency: {} ns",
+    Report::new(
+        "event",
         core::any::type_name::<T>(),
-        args.max_event_id,
-        args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2)
-    );
+        args.iterations as u64,
+        stop,
+        &histogram,
+    )
+    .parameter("max_event_id", args.max_event_id)
+    .emit(args.json);
 
     Ok(())
 }
@@ -151,6 +161,9 @@ struct Args {
     /// The number of additional listeners per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_listeners: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -10,8 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use core::mem::MaybeUninit;
+use std::time::Instant;
 
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_posix::barrier::*;
@@ -67,6 +69,14 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let copy_strategy = if args.non_temporal_copy {
+        CopyStrategy::NonTemporal
+    } else {
+        CopyStrategy::Regular
+    };
+
+    let mut histogram = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(&[args.cpu_core_participant_1])
         .priority(255)
@@ -74,35 +84,44 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             let sender_a2b = service_a2b
                 .publisher_builder()
                 .initial_max_slice_len(args.payload_size)
+                .copy_strategy(copy_strategy)
                 .create()
                 .unwrap();
             let receiver_b2a = service_b2a.subscriber_builder().create().unwrap();
+            let source = vec![0u8; args.payload_size];
 
             startup_barrier.wait();
             start_benchmark_barrier.wait();
 
             let mut sample = if args.send_copy {
-                let mut sample = sender_a2b.loan_slice_uninit(args.payload_size).unwrap();
-                sample.payload_mut().fill(MaybeUninit::new(0));
-                unsafe { sample.assume_init() }
+                None
             } else {
-                unsafe {
+                Some(unsafe {
                     sender_a2b
                         .loan_slice_uninit(args.payload_size)
                         .unwrap()
                         .assume_init()
-                }
+                })
             };
 
             for _ in 0..args.iterations {
-                sample.send().unwrap();
-                sample = unsafe {
-                    sender_a2b
-                        .loan_slice_uninit(args.payload_size)
-                        .unwrap()
-                        .assume_init()
-                };
+                let round_trip = Instant::now();
+                match sample.take() {
+                    Some(s) => {
+                        s.send().unwrap();
+                        sample = Some(unsafe {
+                            sender_a2b
+                                .loan_slice_uninit(args.payload_size)
+                                .unwrap()
+                                .assume_init()
+                        });
+                    }
+                    None => {
+                        sender_a2b.send_slice_copy(&source).unwrap();
+                    }
+                }
                 while receiver_b2a.receive().unwrap().is_none() {}
+                histogram.record_round_trip(round_trip.elapsed());
             }
         });
 
@@ -113,30 +132,32 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
             let sender_b2a = service_b2a
                 .publisher_builder()
                 .initial_max_slice_len(args.payload_size)
+                .copy_strategy(copy_strategy)
                 .create()
                 .unwrap();
             let receiver_a2b = service_a2b.subscriber_builder().create().unwrap();
+            let source = vec![0u8; args.payload_size];
 
             startup_barrier.wait();
             start_benchmark_barrier.wait();
 
             for _ in 0..args.iterations {
-                let sample = if args.send_copy {
-                    let mut sample = sender_b2a.loan_slice_uninit(args.payload_size).unwrap();
-                    sample.payload_mut().fill(MaybeUninit::new(0));
-                    unsafe { sample.assume_init() }
+                if args.send_copy {
+                    while receiver_a2b.receive().unwrap().is_none() {}
+
+                    sender_b2a.send_slice_copy(&source).unwrap();
                 } else {
-                    unsafe {
+                    let sample = unsafe {
                         sender_b2a
                             .loan_slice_uninit(args.payload_size)
                             .unwrap()
                             .assume_init()
-                    }
-                };
+                    };
 
-                while receiver_a2b.receive().unwrap().is_none() {}
+                    while receiver_a2b.receive().unwrap().is_none() {}
 
-                sample.send().unwrap();
+                    sample.send().unwrap();
+                }
             }
         });
 
@@ -148,14 +169,16 @@ fn perform_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core::error:
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns, Sample Size: {}",
+    Report::new(
+        "publish-subscribe",
         core::any::type_name::<T>(),
         args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-        args.payload_size
-    );
+        stop,
+        &histogram,
+    )
+    .parameter("sample_size", args.payload_size)
+    .parameter("copy_strategy", format!("{copy_strategy:?}"))
+    .emit(args.json);
 
     Ok(())
 }
@@ -191,12 +214,20 @@ struct Args {
     /// how expensive serialization can be.
     #[clap(long)]
     send_copy: bool,
+    /// Use streaming stores that bypass the cache when the payload is copied with
+    /// '--send-copy'. Run with different '--payload-size's to find the size from which on it
+    /// pays off.
+    #[clap(long)]
+    non_temporal_copy: bool,
     /// The number of additional publishers per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_publishers: usize,
     /// The number of additional subscribers per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_subscribers: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -12,6 +12,10 @@
 
 extern crate iceoryx2_bb_loggers;
 
+use std::time::Instant;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
 use clap::Parser;
 use iceoryx2_bb_lock_free::spsc::index_queue::FixedSizeIndexQueue;
 use iceoryx2_bb_lock_free::spsc::queue::Queue;
@@ -71,6 +75,8 @@ fn perform_benchmark<Q: PushPop>(
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(&[args.cpu_core_participant_1])
         .priority(255)
@@ -79,8 +85,10 @@ fn perform_benchmark<Q: PushPop>(
             start_benchmark_barrier.wait();
 
             for _ in 0..args.iterations {
+                let round_trip = Instant::now();
                 queue_a2b.push(0);
                 while !queue_b2a.pop() {}
+                histogram.record_round_trip(round_trip.elapsed());
             }
         });
 
@@ -106,13 +114,14 @@ fn perform_benchmark<Q: PushPop>(
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "{} ::: Iterations: {}, Time: {} s, Latency: {} ns",
+    Report::new(
+        "queue",
         core::any::type_name::<Q>(),
         args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+        stop,
+        &histogram,
+    )
+    .emit(args.json);
 
     Ok(())
 }
@@ -129,6 +138,9 @@ struct Args {
     /// The cpu core that shall be used by participant 2
     #[clap(long, default_value_t = 1)]
     cpu_core_participant_2: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
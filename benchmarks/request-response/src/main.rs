@@ -10,6 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use std::time::Instant;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
 use clap::Parser;
 use iceoryx2::prelude::*;
 use iceoryx2_bb_posix::barrier::*;
@@ -63,6 +67,8 @@ fn perform_response_stream_benchmark<T: Service>(
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(&[args.cpu_core_participant_1])
         .priority(255)
@@ -81,9 +87,11 @@ fn perform_response_stream_benchmark<T: Service>(
             let mut response = unsafe { active_request.loan_uninit().unwrap().assume_init() };
 
             for _ in 0..args.iterations {
+                let round_trip = Instant::now();
                 response.send().unwrap();
                 response = unsafe { active_request.loan_uninit().unwrap().assume_init() };
                 while pending_response.receive().unwrap().is_none() {}
+                histogram.record_round_trip(round_trip.elapsed());
             }
         });
 
@@ -118,13 +126,14 @@ fn perform_response_stream_benchmark<T: Service>(
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "[RESPONSE_STREAM] {} ::: Iterations: {}, Time: {} s, Latency: {} ns",
+    Report::new(
+        "request-response/response-stream",
         core::any::type_name::<T>(),
         args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+        stop,
+        &histogram,
+    )
+    .emit(args.json);
 
     Ok(())
 }
@@ -172,6 +181,8 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
         .create(&start_benchmark_barrier_handle)
         .unwrap();
 
+    let mut histogram = LatencyHistogram::new();
+
     let t1 = ThreadBuilder::new()
         .affinity(&[args.cpu_core_participant_1])
         .priority(255)
@@ -185,9 +196,11 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
             let mut request = unsafe { client_a2b.loan_uninit().unwrap().assume_init() };
 
             for _ in 0..args.iterations {
+                let round_trip = Instant::now();
                 request.send().unwrap();
                 request = unsafe { client_a2b.loan_uninit().unwrap().assume_init() };
                 while server_b2a.receive().unwrap().is_none() {}
+                histogram.record_round_trip(round_trip.elapsed());
             }
         });
 
@@ -217,13 +230,14 @@ fn perform_request_benchmark<T: Service>(args: &Args) -> Result<(), Box<dyn core
     drop(t2);
 
     let stop = start.elapsed().expect("failed to measure time");
-    println!(
-        "[REQUESTS] {} ::: Iterations: {}, Time: {} s, Latency: {} ns",
+    Report::new(
+        "request-response/request",
         core::any::type_name::<T>(),
         args.iterations,
-        stop.as_secs_f64(),
-        stop.as_nanos() / (args.iterations as u128 * 2),
-    );
+        stop,
+        &histogram,
+    )
+    .emit(args.json);
 
     Ok(())
 }
@@ -249,6 +263,9 @@ struct Args {
     /// The number of additional clients per service in the setup.
     #[clap(long, default_value_t = 0)]
     number_of_additional_clients: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
 }
 
 fn main() -> Result<(), Box<dyn core::error::Error>> {
@@ -0,0 +1,366 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+extern crate iceoryx2_bb_loggers;
+
+use core::time::Duration;
+use std::sync::Mutex;
+use std::time::Instant;
+
+use benchmark_common::histogram::LatencyHistogram;
+use benchmark_common::report::Report;
+use benchmark_common::sweep;
+use clap::Parser;
+use iceoryx2::node::NodeView;
+use iceoryx2::prelude::*;
+use iceoryx2::service::port_factory::publish_subscribe::PortFactory as PublishSubscribePortFactory;
+use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
+use iceoryx2_bb_posix::barrier::*;
+use iceoryx2_bb_posix::thread::thread_scope;
+
+type BenchmarkResult<T> = Result<T, Box<dyn core::error::Error>>;
+
+struct OperationMeasurement {
+    operation: &'static str,
+    concurrent_starters: usize,
+    measurement: Measurement,
+}
+
+impl OperationMeasurement {
+    fn sequential(operation: &'static str, measurement: Measurement) -> Self {
+        Self {
+            operation,
+            concurrent_starters: 1,
+            measurement,
+        }
+    }
+}
+
+struct Measurement {
+    iterations: u64,
+    time: Duration,
+    histogram: LatencyHistogram,
+}
+
+impl Measurement {
+    fn new() -> Self {
+        Self {
+            iterations: 0,
+            time: Duration::ZERO,
+            histogram: LatencyHistogram::new(),
+        }
+    }
+
+    fn record(&mut self, latency: Duration) {
+        self.iterations += 1;
+        self.time += latency;
+        self.histogram.record(latency);
+    }
+}
+
+/// Times `operation` for every iteration. The value returned by the operation is dropped
+/// after the time was taken, so that only the operation itself is measured.
+fn measure<R, F: FnMut(u64) -> BenchmarkResult<R>>(
+    iterations: u64,
+    mut operation: F,
+) -> BenchmarkResult<Measurement> {
+    let mut measurement = Measurement::new();
+    for n in 0..iterations {
+        let start = Instant::now();
+        let result = operation(n)?;
+        measurement.record(start.elapsed());
+        drop(result);
+    }
+
+    Ok(measurement)
+}
+
+fn service_name(prefix: &str, n: u64) -> BenchmarkResult<ServiceName> {
+    Ok(ServiceName::new(&format!(
+        "startup/{}/{prefix}/{n}",
+        std::process::id()
+    ))?)
+}
+
+fn create_target_service<T: Service>(
+    args: &Args,
+    node: &Node<T>,
+) -> BenchmarkResult<PublishSubscribePortFactory<T, u64, ()>> {
+    Ok(node
+        .service_builder(&service_name("target", 0)?)
+        .publish_subscribe::<u64>()
+        .max_publishers(args.max_concurrent_starters + 1)
+        .max_nodes(args.max_concurrent_starters + 2)
+        .create()?)
+}
+
+fn perform_benchmark<T: Service>(
+    args: &Args,
+    number_of_existing_services: usize,
+) -> BenchmarkResult<Vec<OperationMeasurement>> {
+    let node = NodeBuilder::new().create::<T>()?;
+
+    // the existing services are only registered, every operation below has to look at or
+    // next to them
+    let mut existing_services = Vec::with_capacity(number_of_existing_services);
+    for n in 0..number_of_existing_services {
+        existing_services.push(
+            node.service_builder(&service_name("existing", n as u64)?)
+                .event()
+                .create()?,
+        );
+    }
+
+    let target_service = create_target_service(args, &node)?;
+    let target_name = target_service.name().clone();
+    let mut measurements = Vec::new();
+
+    measurements.push(OperationMeasurement::sequential(
+        "node_create",
+        measure(args.iterations, |_| Ok(NodeBuilder::new().create::<T>()?))?,
+    ));
+
+    measurements.push(OperationMeasurement::sequential(
+        "service_create",
+        measure(args.iterations, |n| {
+            Ok(node
+                .service_builder(&service_name("create", n)?)
+                .publish_subscribe::<u64>()
+                .create()?)
+        })?,
+    ));
+
+    measurements.push(OperationMeasurement::sequential(
+        "service_open",
+        measure(args.iterations, |_| {
+            Ok(node
+                .service_builder(&target_name)
+                .publish_subscribe::<u64>()
+                .open()?)
+        })?,
+    ));
+
+    measurements.push(OperationMeasurement::sequential(
+        "service_open_or_create",
+        measure(args.iterations, |_| {
+            Ok(node
+                .service_builder(&target_name)
+                .publish_subscribe::<u64>()
+                .open_or_create()?)
+        })?,
+    ));
+
+    measurements.push(OperationMeasurement::sequential(
+        "publisher_create",
+        measure(args.iterations, |_| {
+            Ok(target_service.publisher_builder().create()?)
+        })?,
+    ));
+
+    measurements.push(OperationMeasurement::sequential(
+        "service_list",
+        measure(args.iterations, |_| {
+            Ok(T::list(node.config(), |_| CallbackProgression::Continue)?)
+        })?,
+    ));
+
+    if let Some(measurement) = measure_dead_node_cleanup(args, &node)? {
+        measurements.push(OperationMeasurement::sequential(
+            "dead_node_cleanup",
+            measurement,
+        ));
+    }
+
+    for concurrent_starters in sweep::powers_of_two(args.max_concurrent_starters) {
+        measurements.push(OperationMeasurement {
+            operation: "process_start",
+            concurrent_starters,
+            measurement: measure_concurrent_starters(args, &target_name, concurrent_starters)?,
+        });
+    }
+
+    drop(existing_services);
+    Ok(measurements)
+}
+
+/// Measures the cleanup of one dead node. It returns [`None`] when the service type cannot
+/// leave a dead node behind.
+fn measure_dead_node_cleanup<T: Service>(
+    args: &Args,
+    node: &Node<T>,
+) -> BenchmarkResult<Option<Measurement>> {
+    let mut measurement = Measurement::new();
+    for _ in 0..args.iterations {
+        let dead_node = NodeBuilder::new().create::<T>()?;
+        let dead_node_id = *dead_node.id();
+        dead_node.abandon();
+
+        let mut is_dead = false;
+        Node::<T>::list(node.config(), |state| {
+            if let NodeState::Dead(state) = state {
+                if *state.id() == dead_node_id {
+                    is_dead = true;
+                    return CallbackProgression::Stop;
+                }
+            }
+            CallbackProgression::Continue
+        })?;
+        if !is_dead {
+            return Ok(None);
+        }
+
+        let start = Instant::now();
+        node.try_cleanup_dead_nodes();
+        measurement.record(start.elapsed());
+    }
+
+    Ok(Some(measurement))
+}
+
+/// Every starter creates its own node, opens the target service and creates a publisher,
+/// the typical startup of a process. All starters begin at the same time.
+fn measure_concurrent_starters<T: Service>(
+    args: &Args,
+    target_name: &ServiceName,
+    number_of_starters: usize,
+) -> BenchmarkResult<Measurement> {
+    let measurement = Mutex::new(Measurement::new());
+
+    for _ in 0..args.iterations.div_ceil(number_of_starters as u64) {
+        let barrier_handle = BarrierHandle::new();
+        let barrier = BarrierBuilder::new(number_of_starters as u32)
+            .create(&barrier_handle)
+            .unwrap();
+
+        thread_scope(|s| {
+            for _ in 0..number_of_starters {
+                s.thread_builder().spawn(|| {
+                    barrier.wait();
+
+                    let start = Instant::now();
+                    let node = NodeBuilder::new().create::<T>().unwrap();
+                    let service = node
+                        .service_builder(target_name)
+                        .publish_subscribe::<u64>()
+                        .open_or_create()
+                        .unwrap();
+                    let publisher = service.publisher_builder().create().unwrap();
+                    let latency = start.elapsed();
+
+                    drop(publisher);
+                    measurement.lock().unwrap().record(latency);
+                })?;
+            }
+
+            Ok(())
+        })?;
+    }
+
+    Ok(measurement.into_inner().unwrap())
+}
+
+fn run<T: Service>(args: &Args) {
+    for number_of_existing_services in &args.existing_services {
+        match perform_benchmark::<T>(args, *number_of_existing_services) {
+            Ok(measurements) => {
+                for OperationMeasurement {
+                    operation,
+                    concurrent_starters,
+                    measurement,
+                } in measurements
+                {
+                    Report::new_for_operations(
+                        "startup",
+                        core::any::type_name::<T>(),
+                        measurement.iterations,
+                        measurement.time,
+                        &measurement.histogram,
+                    )
+                    .parameter("operation", operation)
+                    .parameter("existing_services", *number_of_existing_services)
+                    .parameter("concurrent_starters", concurrent_starters)
+                    .emit(args.json);
+                }
+            }
+            Err(e) => eprintln!(
+                "{} ::: Existing Services: {} ::: skipped ({e})",
+                core::any::type_name::<T>(),
+                number_of_existing_services
+            ),
+        }
+    }
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// Number of times every operation is measured
+    #[clap(short, long, default_value_t = 100)]
+    iterations: u64,
+    /// Run benchmark for every service setup
+    #[clap(short, long)]
+    bench_all: bool,
+    /// Run benchmark for the IPC zero copy setup
+    #[clap(long)]
+    bench_ipc: bool,
+    /// Run benchmark for the process local setup
+    #[clap(long)]
+    bench_local: bool,
+    /// Activate full log output
+    #[clap(short, long)]
+    debug_mode: bool,
+    /// The comma separated numbers of services that exist while the operations are measured
+    #[clap(
+        short,
+        long,
+        value_delimiter = ',',
+        default_value = "10,100,1000,10000"
+    )]
+    existing_services: Vec<usize>,
+    /// The greatest number of processes that start at the same time, the benchmark sweeps
+    /// 1, 2, 4, ... up to it
+    #[clap(long, default_value_t = 4)]
+    max_concurrent_starters: usize,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+
+    if args.debug_mode {
+        set_log_level(LogLevel::Trace);
+    } else {
+        set_log_level(LogLevel::Error);
+    }
+
+    let mut at_least_one_benchmark_did_run = false;
+
+    if args.bench_ipc || args.bench_all {
+        run::<ipc::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if args.bench_local || args.bench_all {
+        run::<local::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if !at_least_one_benchmark_did_run {
+        println!(
+            "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+        );
+    }
+
+    Ok(())
+}
@@ -0,0 +1,315 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+extern crate iceoryx2_bb_loggers;
+
+use core::time::Duration;
+use std::time::Instant;
+
+use benchmark_common::cpu_time::process_cpu_time;
+use benchmark_common::report::ThroughputReport;
+use benchmark_common::sweep;
+use clap::{Parser, ValueEnum};
+use iceoryx2::prelude::*;
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64, Ordering};
+use iceoryx2_bb_posix::barrier::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_posix::thread::thread_scope;
+
+const DURATION_IN_MS: u64 = 1000;
+
+struct Setup {
+    number_of_publishers: usize,
+    number_of_subscribers: usize,
+    payload_size: usize,
+    backpressure_strategy: BackpressureStrategy,
+}
+
+struct Measurement {
+    time: Duration,
+    cpu_time: Option<Duration>,
+    messages_sent: u64,
+    messages_received: u64,
+}
+
+fn perform_benchmark<T: Service>(
+    args: &Args,
+    setup: &Setup,
+) -> Result<Measurement, Box<dyn core::error::Error>> {
+    let service_name = ServiceName::new("throughput")?;
+    let node = NodeBuilder::new().create::<T>()?;
+
+    let service = node
+        .service_builder(&service_name)
+        .publish_subscribe::<[u8]>()
+        .max_publishers(setup.number_of_publishers)
+        .max_subscribers(setup.number_of_subscribers)
+        .history_size(0)
+        .subscriber_max_buffer_size(args.subscriber_buffer_size)
+        .enable_safe_overflow(false)
+        .create()?;
+
+    let publisher_builder = || {
+        service
+            .publisher_builder()
+            .initial_max_slice_len(setup.payload_size)
+            .backpressure_strategy(setup.backpressure_strategy)
+    };
+
+    // the data segment of large payloads may exceed the available memory, acquire it once
+    // upfront so that the setup can be skipped instead of failing inside a participant
+    drop(publisher_builder().create()?);
+
+    let number_of_cpu_cores = SystemInfo::NumberOfCpuCores.value().max(1);
+    let cpu_core_of =
+        |participant: usize| (args.first_cpu_core + participant) % number_of_cpu_cores;
+
+    let start_benchmark_barrier_handle = BarrierHandle::new();
+    let start_benchmark_barrier =
+        BarrierBuilder::new((setup.number_of_publishers + setup.number_of_subscribers + 1) as u32)
+            .create(&start_benchmark_barrier_handle)
+            .unwrap();
+
+    let stop = AtomicBool::new(false);
+    let finished_publishers = AtomicU64::new(0);
+    let messages_sent = AtomicU64::new(0);
+    let messages_received = AtomicU64::new(0);
+
+    let mut start = Instant::now();
+    let mut cpu_time_at_start = None;
+
+    thread_scope(|s| {
+        for participant in 0..setup.number_of_publishers {
+            s.thread_builder()
+                .affinity(&[cpu_core_of(participant)])
+                .spawn(|| {
+                    let publisher = publisher_builder().create().unwrap();
+                    let source = vec![0u8; setup.payload_size];
+                    let mut sent = 0;
+
+                    start_benchmark_barrier.wait();
+
+                    while !stop.load(Ordering::Relaxed) {
+                        if args.send_copy {
+                            publisher.send_slice_copy(&source).unwrap();
+                        } else {
+                            let sample = publisher.loan_slice_uninit(setup.payload_size).unwrap();
+                            unsafe { sample.assume_init() }.send().unwrap();
+                        }
+                        sent += 1;
+                    }
+
+                    messages_sent.fetch_add(sent, Ordering::Relaxed);
+                    finished_publishers.fetch_add(1, Ordering::Release);
+                })?;
+        }
+
+        for participant in 0..setup.number_of_subscribers {
+            s.thread_builder()
+                .affinity(&[cpu_core_of(setup.number_of_publishers + participant)])
+                .spawn(|| {
+                    let subscriber = service.subscriber_builder().create().unwrap();
+                    let mut received = 0;
+
+                    start_benchmark_barrier.wait();
+
+                    loop {
+                        if subscriber.receive().unwrap().is_some() {
+                            received += 1;
+                        } else if finished_publishers.load(Ordering::Acquire)
+                            == setup.number_of_publishers as u64
+                            && !subscriber.has_samples().unwrap()
+                        {
+                            break;
+                        }
+                    }
+
+                    messages_received.fetch_add(received, Ordering::Relaxed);
+                })?;
+        }
+
+        start_benchmark_barrier.wait();
+        start = Instant::now();
+        cpu_time_at_start = process_cpu_time();
+
+        std::thread::sleep(Duration::from_millis(args.duration_in_ms));
+        stop.store(true, Ordering::Relaxed);
+
+        Ok(())
+    })?;
+
+    let cpu_time = match (cpu_time_at_start, process_cpu_time()) {
+        (Some(start), Some(stop)) => Some(stop.saturating_sub(start)),
+        _ => None,
+    };
+
+    Ok(Measurement {
+        time: start.elapsed(),
+        cpu_time,
+        messages_sent: messages_sent.load(Ordering::Relaxed),
+        messages_received: messages_received.load(Ordering::Relaxed),
+    })
+}
+
+fn run<T: Service>(args: &Args) {
+    for backpressure_strategy in args.backpressure_strategy.strategies() {
+        for number_of_publishers in sweep::powers_of_two(args.max_publishers) {
+            for number_of_subscribers in sweep::powers_of_two(args.max_subscribers) {
+                for payload_size in &args.payload_sizes {
+                    let setup = Setup {
+                        number_of_publishers,
+                        number_of_subscribers,
+                        payload_size: *payload_size,
+                        backpressure_strategy: *backpressure_strategy,
+                    };
+
+                    match perform_benchmark::<T>(args, &setup) {
+                        Ok(measurement) => report::<T>(args, &setup, &measurement),
+                        Err(e) => eprintln!(
+                            "{} ::: Publishers: {}, Subscribers: {}, Payload Size: {} ::: skipped ({e})",
+                            core::any::type_name::<T>(),
+                            number_of_publishers,
+                            number_of_subscribers,
+                            payload_size
+                        ),
+                    }
+                }
+            }
+        }
+    }
+}
+
+fn report<T: Service>(args: &Args, setup: &Setup, measurement: &Measurement) {
+    let mut report = ThroughputReport::new(
+        "throughput",
+        core::any::type_name::<T>(),
+        measurement.time,
+        setup.payload_size,
+        measurement.messages_sent,
+        measurement.messages_received,
+    )
+    .parameter("publishers", setup.number_of_publishers)
+    .parameter("subscribers", setup.number_of_subscribers)
+    .parameter(
+        "backpressure_strategy",
+        format!("{:?}", setup.backpressure_strategy),
+    )
+    .parameter("send_copy", args.send_copy);
+
+    if let Some(cpu_time) = measurement.cpu_time {
+        report = report.cpu_time(cpu_time);
+    }
+
+    report.emit(args.json);
+}
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+enum BackpressureSelection {
+    RetryUntilDelivered,
+    DiscardData,
+    All,
+}
+
+impl BackpressureSelection {
+    fn strategies(&self) -> &'static [BackpressureStrategy] {
+        match self {
+            BackpressureSelection::RetryUntilDelivered => {
+                &[BackpressureStrategy::RetryUntilDelivered]
+            }
+            BackpressureSelection::DiscardData => &[BackpressureStrategy::DiscardData],
+            BackpressureSelection::All => &[
+                BackpressureStrategy::RetryUntilDelivered,
+                BackpressureStrategy::DiscardData,
+            ],
+        }
+    }
+}
+
+#[derive(Parser, Debug)]
+#[clap(version, about, long_about = None)]
+struct Args {
+    /// The duration in milliseconds every setup is measured
+    #[clap(long, default_value_t = DURATION_IN_MS)]
+    duration_in_ms: u64,
+    /// Run benchmark for every service setup
+    #[clap(short, long)]
+    bench_all: bool,
+    /// Run benchmark for the IPC zero copy setup
+    #[clap(long)]
+    bench_ipc: bool,
+    /// Run benchmark for the process local setup
+    #[clap(long)]
+    bench_local: bool,
+    /// Activate full log output
+    #[clap(short, long)]
+    debug_mode: bool,
+    /// The cpu core of the first participant, every further participant uses the next core
+    #[clap(long, default_value_t = 0)]
+    first_cpu_core: usize,
+    /// The greatest number of active publishers, the benchmark sweeps 1, 2, 4, ... up to it
+    #[clap(long, default_value_t = 1)]
+    max_publishers: usize,
+    /// The greatest number of active subscribers, the benchmark sweeps 1, 2, 4, ... up to it
+    #[clap(long, default_value_t = 4)]
+    max_subscribers: usize,
+    /// The comma separated payload sizes in bytes that shall be used
+    #[clap(
+        short,
+        long,
+        value_delimiter = ',',
+        default_value = "8,64,512,4096,32768,262144,2097152,16777216,67108864"
+    )]
+    payload_sizes: Vec<usize>,
+    /// The backpressure strategy of the publishers
+    #[clap(long, value_enum, default_value_t = BackpressureSelection::All)]
+    backpressure_strategy: BackpressureSelection,
+    /// The buffer size of every subscriber
+    #[clap(long, default_value_t = 4)]
+    subscriber_buffer_size: usize,
+    /// Send a copy of the payload instead of performing true zero-copy. Without it the
+    /// payload is never touched and the bytes/s describe the logical bandwidth only.
+    #[clap(long)]
+    send_copy: bool,
+    /// Print the results as JSON, one object per benchmark run.
+    #[clap(long)]
+    json: bool,
+}
+
+fn main() -> Result<(), Box<dyn core::error::Error>> {
+    let args = Args::parse();
+
+    if args.debug_mode {
+        set_log_level(LogLevel::Trace);
+    } else {
+        set_log_level(LogLevel::Error);
+    }
+
+    let mut at_least_one_benchmark_did_run = false;
+
+    if args.bench_ipc || args.bench_all {
+        run::<ipc::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if args.bench_local || args.bench_all {
+        run::<local::Service>(&args);
+        at_least_one_benchmark_did_run = true;
+    }
+
+    if !at_least_one_benchmark_did_run {
+        println!(
+            "Please use either '--bench-all' or select a specific benchmark. See `--help` for details."
+        );
+    }
+
+    Ok(())
+}
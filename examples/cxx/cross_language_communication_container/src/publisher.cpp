@@ -20,6 +20,10 @@
 
 constexpr iox2::bb::Duration CYCLE_TIME = iox2::bb::Duration::from_secs(1);
 
+// the payload and the user header are shared with the Rust process, their layout must match
+static_assert(iox2::bb::StaticVector<uint64_t, 32>::has_rust_layout(), "payload incompatible with Rust"); // NOLINT
+static_assert(iox2::bb::StaticString<64>::has_rust_layout(), "user header incompatible with Rust");     // NOLINT
+
 auto main() -> int {
     using namespace iox2;
     set_log_level_from_env_or(LogLevel::Info);
@@ -39,4 +39,10 @@ if(NOT ICEORYX2_BB_CXX_OPTIONS_AND_PARAMS_LISTED)
         DEFAULT_VALUE ""
     )
 
+    add_param(
+        NAME IOX2_MIN_LOG_LEVEL
+        DESCRIPTION "The minimal log level of the C++ logging macros that is compiled in, one of Off, Fatal, Error, Warn, Info, Debug or Trace"
+        DEFAULT_VALUE "Trace"
+    )
+
 endif()
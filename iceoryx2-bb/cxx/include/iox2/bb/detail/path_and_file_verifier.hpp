@@ -52,6 +52,55 @@ enum class RelativePathComponents : uint8_t {
     Accept
 };
 
+enum class PathSeparators : uint8_t {
+    Reject,
+    Accept
+};
+
+/// @brief returns true if the character is a path separator of the platform, otherwise false
+constexpr auto is_path_separator(const char character) noexcept -> bool {
+    bool is_separator { false };
+    for (const auto separator : platform::IOX2_PATH_SEPARATORS) {
+        is_separator |= (character == separator);
+    }
+    return is_separator;
+}
+
+/// @brief returns true if 'first' <= character <= 'last'
+constexpr auto is_in_ascii_range(const char character, const char first, const char last) noexcept -> bool {
+    // a single unsigned comparison instead of two signed ones
+    return static_cast<uint8_t>(static_cast<uint8_t>(character) - static_cast<uint8_t>(first))
+           <= static_cast<uint8_t>(static_cast<uint8_t>(last) - static_cast<uint8_t>(first));
+}
+
+/// @brief returns true if the character is allowed in a path entry, see is_valid_path_entry
+/// @note  all conditions are combined with bitwise operators so that they are evaluated without branches
+constexpr auto is_valid_path_entry_character(const char character) noexcept -> bool {
+    // AXIVION Next Construct AutosarC++19_03-M4.5.3 : We are explicitly checking for ASCII characters which have defined consecutive values
+    return is_in_ascii_range(character, ASCII_A, ASCII_Z)
+           | is_in_ascii_range(character, ASCII_CAPITAL_A, ASCII_CAPITAL_Z)
+           | is_in_ascii_range(character, ASCII_0, ASCII_9) | (character == ASCII_DASH) | (character == ASCII_DOT)
+           | (character == ASCII_COLON) | (character == ASCII_UNDERSCORE);
+}
+
+/// @brief checks if all characters of [data, data + size) are allowed in a path entry and, when
+///        accepted, are path separators
+/// @note  the loop has no early exit on purpose, this allows compilers to vectorize it since
+///        the character classes are checked with branch free comparisons
+inline auto does_contain_only_path_entry_characters(const char* data,
+                                                    const uint64_t size,
+                                                    const PathSeparators path_separators) noexcept -> bool {
+    const bool accept_separators { path_separators == PathSeparators::Accept };
+    uint8_t is_valid { 1U };
+    for (uint64_t i { 0 }; i < size; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are ensured by the caller
+        const char character { data[i] };
+        is_valid &= static_cast<uint8_t>(is_valid_path_entry_character(character)
+                                         || (accept_separators && is_path_separator(character)));
+    }
+    return is_valid == 1U;
+}
+
 /// @brief checks if the given string is a valid path entry. A path entry is the string between
 ///        two path separators.
 /// @note A valid path entry for iceoryx must be platform independent and also supported
@@ -98,26 +147,8 @@ inline auto is_valid_path_entry(const bb::StaticString<StringCapacity>& name,
 
     const auto name_size = name.size();
 
-    for (uint64_t i { 0 }; i < name_size; ++i) {
-        // AXIVION Next Construct AutosarC++19_03-A3.9.1: Not used as an integer but as actual character
-        // NOLINTNEXTLINE(readability-identifier-length)
-        const char c { name.unchecked_access()[i] };
-
-        // AXIVION DISABLE STYLE FaultDetection-UnusedAssignments : False positive, variable IS used
-        // AXIVION DISABLE STYLE AutosarC++19_03-A0.1.1 : False positive, variable IS used
-        // AXIVION DISABLE STYLE AutosarC++19_03-M4.5.3 : We are explicitly checking for ASCII characters which have defined consecutive values
-        const bool is_small_letter { (ASCII_A <= c) && (c <= ASCII_Z) };
-        const bool is_capital_letter { (ASCII_CAPITAL_A <= c) && (c <= ASCII_CAPITAL_Z) };
-        const bool is_number { (ASCII_0 <= c) && (c <= ASCII_9) };
-        const bool is_special_character { ((c == ASCII_DASH) || (c == ASCII_DOT))
-                                          || ((c == ASCII_COLON) || (c == ASCII_UNDERSCORE)) };
-        // AXIVION ENABLE STYLE AutosarC++19_03-M4.5.3
-        // AXIVION ENABLE STYLE AutosarC++19_03-A0.1.1
-        // AXIVION ENABLE STYLE FaultDetection-UnusedAssignments
-
-        if ((!is_small_letter && !is_capital_letter) && (!is_number && !is_special_character)) {
-            return false;
-        }
+    if (!does_contain_only_path_entry_characters(name.unchecked_access().c_str(), name_size, PathSeparators::Reject)) {
+        return false;
     }
 
     if (name_size == 0) {
@@ -226,13 +257,7 @@ inline auto does_end_with_path_separator(const bb::StaticString<StringCapacity>&
     // AXIVION Next Construct AutosarC++19_03-A3.9.1: Not used as an integer but as actual character
     const char last_character { *name.code_units().back_element() };
 
-    // NOLINTNEXTLINE(readability-use-anyofallof)
-    for (const auto separator : platform::IOX2_PATH_SEPARATORS) {
-        if (last_character == separator) {
-            return true;
-        }
-    }
-    return false;
+    return is_path_separator(last_character);
 }
 
 } // namespace detail
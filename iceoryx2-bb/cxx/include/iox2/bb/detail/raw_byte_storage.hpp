@@ -14,9 +14,12 @@
 #define IOX2_INCLUDE_GUARD_BB_DETAIL_RAW_BYTE_STORAGE_HPP
 
 #include "iox2/bb/detail/attributes.hpp"
+#include "iox2/bb/detail/rust_layout.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <new>
 #include <type_traits>
@@ -124,6 +127,14 @@ class RawByteStorage {
         return m_size;
     }
 
+    /// Returns true if the memory layout is identical to the one of the Rust
+    /// `iceoryx2_bb_container::vector::StaticVec<T, Capacity>`.
+    static constexpr auto has_rust_static_vec_layout() noexcept -> bool {
+        constexpr RustContainerLayout LAYOUT = rust_static_vec_layout<T>(Capacity);
+        return offsetof(RawByteStorage, m_bytes) == 0 && offsetof(RawByteStorage, m_size) == LAYOUT.offset_of_len
+               && sizeof(RawByteStorage) == LAYOUT.size && alignof(RawByteStorage) == LAYOUT.alignment;
+    }
+
     // @pre size() < Capacity
     template <typename... Args>
     constexpr void emplace_back(Args&&... args) {
@@ -146,6 +157,30 @@ class RawByteStorage {
         rotate_from_back(index, m_size - count);
     }
 
+    // @pre size() + count <= Capacity
+    constexpr void append_range(T const* source, uint64_t count) {
+        append_range(source, count, std::is_trivially_copyable<T> {});
+    }
+
+    // @pre (index <= size()) && (size() + count <= Capacity) && (source does not point into this storage)
+    constexpr void insert_range_at(uint64_t index, T const* source, uint64_t count) {
+        insert_range_at(index, source, count, std::is_trivially_copyable<T> {});
+    }
+
+    // @pre (size() <= new_size) && (new_size <= Capacity)
+    constexpr void grow_default_initialized(uint64_t new_size) {
+        while (m_size < new_size) {
+            new (pointer_from_index(m_size)) T;
+            ++m_size;
+        }
+    }
+
+    // @pre (new_size <= Capacity) && std::is_trivial<T>
+    constexpr void resize_uninitialized(uint64_t new_size) {
+        static_assert(std::is_trivial<T>::value, "Elements can only be left uninitialized for trivial types.");
+        m_size = new_size;
+    }
+
     // @pre (index < size())
     constexpr void erase_at(uint64_t index) {
         remove_at(index, 1);
@@ -161,12 +196,7 @@ class RawByteStorage {
 
     // @pre (index + range_size <= size())
     constexpr void remove_at(uint64_t index, uint64_t range_size) {
-// gcc 15 generates a false positive here, where range checks performed
-// by outer functions are not taken into account correctly
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-        std::move(pointer_from_index(index + range_size), pointer_from_index(m_size), pointer_from_index(index));
-#pragma GCC diagnostic pop
+        remove_at(index, range_size, std::is_trivially_copyable<T> {});
     }
 
     // @pre target_size < size()
@@ -219,6 +249,56 @@ class RawByteStorage {
         ret.size_is_unsigned = std::is_unsigned<decltype(m_size)>::value;
         return ret;
     }
+
+  private:
+    // the overloads taking std::true_type are selected for trivially copyable T and copy the
+    // object representation of all elements at once
+
+    constexpr void append_range(T const* source, uint64_t count, std::true_type /* is_trivially_copyable */) {
+        if (count != 0) {
+            std::memcpy(pointer_from_index(m_size), source, count * sizeof(T));
+            m_size += count;
+        }
+    }
+
+    constexpr void append_range(T const* source, uint64_t count, std::false_type /* is_trivially_copyable */) {
+        for (uint64_t i = 0; i < count; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic), bounds are ensured by the caller
+            emplace_back(source[i]);
+        }
+    }
+
+    constexpr void
+    insert_range_at(uint64_t index, T const* source, uint64_t count, std::true_type /* is_trivially_copyable */) {
+        if (count != 0) {
+            std::memmove(pointer_from_index(index + count), pointer_from_index(index), (m_size - index) * sizeof(T));
+            std::memcpy(pointer_from_index(index), source, count * sizeof(T));
+            m_size += count;
+        }
+    }
+
+    constexpr void
+    insert_range_at(uint64_t index, T const* source, uint64_t count, std::false_type /* is_trivially_copyable */) {
+        append_range(source, count, std::false_type {});
+        rotate_from_back(index, m_size - count);
+    }
+
+    constexpr void remove_at(uint64_t index, uint64_t range_size, std::true_type /* is_trivially_copyable */) {
+        if (range_size != 0) {
+            std::memmove(pointer_from_index(index),
+                         pointer_from_index(index + range_size),
+                         (m_size - index - range_size) * sizeof(T));
+        }
+    }
+
+    constexpr void remove_at(uint64_t index, uint64_t range_size, std::false_type /* is_trivially_copyable */) {
+// gcc 15 generates a false positive here, where range checks performed
+// by outer functions are not taken into account correctly
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+        std::move(pointer_from_index(index + range_size), pointer_from_index(m_size), pointer_from_index(index));
+#pragma GCC diagnostic pop
+    }
 };
 } // namespace detail
 } // namespace bb
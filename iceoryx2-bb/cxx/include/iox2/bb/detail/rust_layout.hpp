@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_DETAIL_RUST_LAYOUT_HPP
+#define IOX2_INCLUDE_GUARD_BB_DETAIL_RUST_LAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace iox2 {
+namespace bb {
+namespace detail {
+
+/// The memory layout of a `#[repr(C)]` container of `iceoryx2-bb-container` that consists of
+/// an inline data array followed by a `u64` length.
+struct RustContainerLayout {
+    uint64_t size;
+    uint64_t alignment;
+    uint64_t size_of_data;
+    uint64_t offset_of_len;
+};
+
+// the alignment of a 'u64' as struct member, it can differ from 'alignof(uint64_t)', e.g. on x86
+struct RustU64MemberAlignment {
+    char padding;
+    uint64_t value;
+};
+
+constexpr auto rust_align_up(uint64_t value, uint64_t alignment) -> uint64_t {
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+constexpr auto rust_max(uint64_t lhs, uint64_t rhs) -> uint64_t {
+    return lhs < rhs ? rhs : lhs;
+}
+
+constexpr auto rust_container_layout(uint64_t size_of_data, uint64_t alignment_of_data) -> RustContainerLayout {
+    constexpr uint64_t U64_ALIGNMENT = offsetof(RustU64MemberAlignment, value);
+    const uint64_t alignment = rust_max(alignment_of_data, U64_ALIGNMENT);
+    const uint64_t offset_of_len = rust_align_up(size_of_data, U64_ALIGNMENT);
+    return RustContainerLayout { rust_align_up(offset_of_len + sizeof(uint64_t), alignment),
+                                 alignment,
+                                 size_of_data,
+                                 offset_of_len };
+}
+
+/// The layout of `iceoryx2_bb_container::vector::StaticVec<T, CAPACITY>`, which consists of
+/// `data: [MaybeUninit<T>; CAPACITY]` and `len: u64`.
+template <typename T>
+constexpr auto rust_static_vec_layout(uint64_t capacity) -> RustContainerLayout {
+    return rust_container_layout(sizeof(T) * capacity, alignof(T));
+}
+
+/// The layout of `iceoryx2_bb_container::string::StaticString<CAPACITY>`, which consists of
+/// `data: [MaybeUninit<u8>; CAPACITY]`, `terminator: u8` and `len: u64`.
+constexpr auto rust_static_string_layout(uint64_t capacity) -> RustContainerLayout {
+    return rust_container_layout(capacity + 1, 1);
+}
+
+} // namespace detail
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_DETAIL_RUST_LAYOUT_HPP
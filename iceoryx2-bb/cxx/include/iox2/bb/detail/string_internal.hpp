@@ -46,6 +46,30 @@ template <uint64_t N>
 auto get_data(const CharArray<N>& data) -> const char* {
     return &data[0];
 }
+
+/// A set of code units with constant time lookup. Used to search for any character of a
+/// character sequence without comparing every code unit against every character of the sequence.
+class CodeUnitSet {
+  public:
+    CodeUnitSet(const char* data, uint64_t size) noexcept {
+        for (uint64_t i = 0; i < size; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are ensured by the caller
+            auto const code_unit = static_cast<uint8_t>(data[i]);
+            m_bits[code_unit / BITS_PER_WORD] |= (uint64_t { 1 } << (code_unit % BITS_PER_WORD));
+        }
+    }
+
+    auto contains(char character) const noexcept -> bool {
+        auto const code_unit = static_cast<uint8_t>(character);
+        return ((m_bits[code_unit / BITS_PER_WORD] >> (code_unit % BITS_PER_WORD)) & 1U) == 1U;
+    }
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD = 64;
+    static constexpr uint64_t NUMBER_OF_CODE_UNITS = 256;
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    uint64_t m_bits[NUMBER_OF_CODE_UNITS / BITS_PER_WORD] = {};
+};
 } // namespace detail
 } // namespace bb
 } // namespace iox2
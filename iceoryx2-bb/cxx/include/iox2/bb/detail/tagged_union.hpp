@@ -0,0 +1,238 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_DETAIL_TAGGED_UNION_HPP
+#define IOX2_INCLUDE_GUARD_BB_DETAIL_TAGGED_UNION_HPP
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+namespace detail {
+
+/// The smallest unsigned integer that can hold the tag of a tagged union with `NumberOfAlternatives`.
+template <uint64_t NumberOfAlternatives>
+using MinimalTagType = std::conditional_t<
+    (NumberOfAlternatives <= (static_cast<uint64_t>(std::numeric_limits<uint8_t>::max()) + 1)),
+    uint8_t,
+    std::conditional_t<(NumberOfAlternatives <= (static_cast<uint64_t>(std::numeric_limits<uint16_t>::max()) + 1)),
+                       uint16_t,
+                       uint32_t>>;
+
+template <typename... Ts>
+struct MaxSizeOf;
+
+template <>
+struct MaxSizeOf<> : std::integral_constant<uint64_t, 0> { };
+
+template <typename T, typename... Rest>
+struct MaxSizeOf<T, Rest...>
+    : std::integral_constant<uint64_t,
+                             (sizeof(T) > MaxSizeOf<Rest...>::value) ? sizeof(T) : MaxSizeOf<Rest...>::value> { };
+
+template <typename... Ts>
+struct AllTriviallyCopyable;
+
+template <>
+struct AllTriviallyCopyable<> : std::true_type { };
+
+template <typename T, typename... Rest>
+struct AllTriviallyCopyable<T, Rest...>
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value && AllTriviallyCopyable<Rest...>::value> { };
+
+template <uint64_t Index, typename... Ts>
+struct TypeAtIndex;
+
+template <typename T, typename... Rest>
+struct TypeAtIndex<0, T, Rest...> {
+    using Type = T;
+};
+
+template <uint64_t Index, typename T, typename... Rest>
+struct TypeAtIndex<Index, T, Rest...> {
+    using Type = typename TypeAtIndex<Index - 1, Rest...>::Type;
+};
+
+/// The index of the first occurrence of `T` in `Ts`, sizeof...(Ts) when `T` is not contained.
+template <typename T, typename... Ts>
+struct IndexOfType;
+
+template <typename T>
+struct IndexOfType<T> : std::integral_constant<uint64_t, 0> { };
+
+template <typename T, typename First, typename... Rest>
+struct IndexOfType<T, First, Rest...>
+    : std::integral_constant<uint64_t,
+                             std::is_same<T, First>::value ? 0 : 1 + IndexOfType<T, Rest...>::value> { };
+
+template <typename T, typename... Ts>
+struct CountOfType;
+
+template <typename T>
+struct CountOfType<T> : std::integral_constant<uint64_t, 0> { };
+
+template <typename T, typename First, typename... Rest>
+struct CountOfType<T, First, Rest...>
+    : std::integral_constant<uint64_t, (std::is_same<T, First>::value ? 1 : 0) + CountOfType<T, Rest...>::value> { };
+
+/// Dispatches the special member functions to the alternative that is selected by the runtime tag.
+template <uint64_t Index, typename... Ts>
+struct TaggedUnionOperations;
+
+template <uint64_t Index>
+struct TaggedUnionOperations<Index> {
+    static void destroy(uint64_t /* unused */, void* /* unused */) noexcept {
+    }
+
+    static void copy_construct(uint64_t /* unused */, void* /* unused */, const void* /* unused */) {
+    }
+
+    static void move_construct(uint64_t /* unused */, void* /* unused */, void* /* unused */) {
+    }
+
+    static auto equal(uint64_t /* unused */, const void* /* unused */, const void* /* unused */) -> bool {
+        return false;
+    }
+};
+
+template <uint64_t Index, typename T, typename... Rest>
+struct TaggedUnionOperations<Index, T, Rest...> {
+    using Next = TaggedUnionOperations<Index + 1, Rest...>;
+
+    static void destroy(uint64_t tag, void* storage) noexcept {
+        if (tag == Index) {
+            static_cast<T*>(storage)->~T();
+        } else {
+            Next::destroy(tag, storage);
+        }
+    }
+
+    static void copy_construct(uint64_t tag, void* destination, const void* source) {
+        if (tag == Index) {
+            new (destination) T(*static_cast<const T*>(source));
+        } else {
+            Next::copy_construct(tag, destination, source);
+        }
+    }
+
+    static void move_construct(uint64_t tag, void* destination, void* source) {
+        if (tag == Index) {
+            new (destination) T(std::move(*static_cast<T*>(source)));
+        } else {
+            Next::move_construct(tag, destination, source);
+        }
+    }
+
+    static auto equal(uint64_t tag, const void* lhs, const void* rhs) -> bool {
+        if (tag == Index) {
+            return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+        }
+        return Next::equal(tag, lhs, rhs);
+    }
+};
+
+/// The members of a tagged union. The memory layout is equal to a Rust `#[repr(C, u8)]` enum
+/// (or `#[repr(C, u16)]`, `#[repr(C, u32)]` for large numbers of alternatives) with one
+/// tuple variant per alternative: the tag is followed by the storage of the alternatives at
+/// the largest alignment of all alternatives.
+template <typename... Ts>
+class TaggedUnionStorage {
+    static_assert(sizeof...(Ts) > 0, "A tagged union requires at least one alternative.");
+
+  public:
+    using TagType = MinimalTagType<sizeof...(Ts)>;
+    using Operations = TaggedUnionOperations<0, Ts...>;
+
+  protected:
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes) accessed by the derived special member layer
+    TagType m_tag { 0 };
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,misc-non-private-member-variables-in-classes) raw storage
+    alignas(Ts...) char m_bytes[MaxSizeOf<Ts...>::value];
+
+    auto storage() noexcept -> void* {
+        return &m_bytes[0];
+    }
+
+    auto storage() const noexcept -> const void* {
+        return &m_bytes[0];
+    }
+};
+
+/// Provides the special member functions of a tagged union. When all alternatives are trivially
+/// copyable they are left to the compiler, so that the tagged union is trivially copyable as well.
+template <bool IsTriviallyCopyable, typename... Ts>
+class TaggedUnionBase;
+
+template <typename... Ts>
+class TaggedUnionBase<true, Ts...> : public TaggedUnionStorage<Ts...> {
+  protected:
+    void destroy() noexcept {
+    }
+};
+
+template <typename... Ts>
+class TaggedUnionBase<false, Ts...> : public TaggedUnionStorage<Ts...> {
+    using Storage = TaggedUnionStorage<Ts...>;
+
+  public:
+    TaggedUnionBase() = default;
+
+    TaggedUnionBase(const TaggedUnionBase& rhs) {
+        Storage::Operations::copy_construct(rhs.m_tag, this->storage(), rhs.storage());
+        this->m_tag = rhs.m_tag;
+    }
+
+    TaggedUnionBase(TaggedUnionBase&& rhs) noexcept {
+        Storage::Operations::move_construct(rhs.m_tag, this->storage(), rhs.storage());
+        this->m_tag = rhs.m_tag;
+    }
+
+    ~TaggedUnionBase() {
+        destroy();
+    }
+
+    auto operator=(const TaggedUnionBase& rhs) -> TaggedUnionBase& {
+        if (this != &rhs) {
+            destroy();
+            Storage::Operations::copy_construct(rhs.m_tag, this->storage(), rhs.storage());
+            this->m_tag = rhs.m_tag;
+        }
+        return *this;
+    }
+
+    auto operator=(TaggedUnionBase&& rhs) noexcept -> TaggedUnionBase& {
+        if (this != &rhs) {
+            destroy();
+            Storage::Operations::move_construct(rhs.m_tag, this->storage(), rhs.storage());
+            this->m_tag = rhs.m_tag;
+        }
+        return *this;
+    }
+
+  protected:
+    void destroy() noexcept {
+        Storage::Operations::destroy(this->m_tag, this->storage());
+    }
+};
+
+template <typename... Ts>
+using TaggedUnion = TaggedUnionBase<AllTriviallyCopyable<Ts...>::value, Ts...>;
+
+} // namespace detail
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_DETAIL_TAGGED_UNION_HPP
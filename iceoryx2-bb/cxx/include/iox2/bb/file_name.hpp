@@ -52,20 +52,8 @@ namespace detail {
 inline auto
 file_name_does_contain_invalid_characters(const bb::StaticString<platform::IOX2_MAX_FILENAME_LENGTH>& value) noexcept
     -> bool {
-    // NOLINTNEXTLINE(readability-use-anyofallof) not yet supported in all compilers
-    for (const char c : value.unchecked_access()) { // NOLINT(readability-identifier-length)
-        const bool is_small_letter { ASCII_A <= c && c <= ASCII_Z };
-        const bool is_capital_letter { ASCII_CAPITAL_A <= c && c <= ASCII_CAPITAL_Z };
-        const bool is_number { ASCII_0 <= c && c <= ASCII_9 };
-        const bool is_special_character { c == ASCII_DASH || c == ASCII_DOT || c == ASCII_COLON
-                                          || c == ASCII_UNDERSCORE };
-
-        if ((!is_small_letter && !is_capital_letter) && (!is_number && !is_special_character)) {
-            return true;
-        }
-    }
-
-    return false;
+    return !does_contain_only_path_entry_characters(
+        value.unchecked_access().c_str(), value.size(), PathSeparators::Reject);
 }
 
 inline auto
@@ -53,30 +53,8 @@ namespace detail {
 inline auto
 file_path_does_contain_invalid_characters(const bb::StaticString<platform::IOX2_MAX_PATH_LENGTH>& value) noexcept
     -> bool {
-    // NOLINTNEXTLINE(readability-identifier-length)
-    for (const char c : value.unchecked_access()) {
-        const bool is_small_letter { ASCII_A <= c && c <= ASCII_Z };
-        const bool is_capital_letter { ASCII_CAPITAL_A <= c && c <= ASCII_CAPITAL_Z };
-        const bool is_number { ASCII_0 <= c && c <= ASCII_9 };
-        const bool is_special_character { c == ASCII_DASH || c == ASCII_DOT || c == ASCII_COLON
-                                          || c == ASCII_UNDERSCORE };
-
-        const bool is_path_separator { [&]() -> bool {
-            // NOLINTNEXTLINE(readability-use-anyofallof) not yet supported in all compilers
-            for (const auto separator : platform::IOX2_PATH_SEPARATORS) {
-                if (c == separator) {
-                    return true;
-                }
-            }
-            return false;
-        }() };
-
-        if ((!is_small_letter && !is_capital_letter) && (!is_number && !is_special_character) && !is_path_separator) {
-            return true;
-        }
-    }
-
-    return false;
+    return !does_contain_only_path_entry_characters(
+        value.unchecked_access().c_str(), value.size(), PathSeparators::Accept);
 }
 
 inline auto
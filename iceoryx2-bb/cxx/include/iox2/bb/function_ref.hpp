@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_BB_FUNCTION_REF_HPP
+#define IOX2_BB_FUNCTION_REF_HPP
+
+#include "iox2/bb/detail/assertions.hpp"
+#include "iox2/legacy/type_traits.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+template <typename Signature>
+class FunctionRef;
+
+/// @brief A non-owning reference to a callable with a given signature
+///
+///        In contrast to iox2::bb::StaticFunction it does not copy the callable, it consists only of a
+///        pointer to the callable and a pointer to the function that invokes it. It is intended to be
+///        passed by value to functions that invoke the callable only until they return, like the
+///        callbacks of WaitSet::wait_and_process() or Listener::try_wait().
+///
+/// @note  The referenced callable must outlive the FunctionRef. Lambdas passed directly as argument
+///        live until the end of the full expression and can be safely referenced for the duration of the
+///        call. A FunctionRef shall not be stored beyond that.
+///
+/// @tparam ReturnType  The return type of the referenced callable.
+/// @tparam Args        The arguments of the referenced callable.
+template <typename ReturnType, typename... Args>
+class FunctionRef<ReturnType(Args...)> final {
+  public:
+    /// @brief construct from a functor (including lambdas and iox2::bb::StaticFunction)
+    template <typename Functor,
+              typename = std::enable_if_t<
+                  std::is_class<std::remove_reference_t<Functor>>::value
+                      && !std::is_same<std::decay_t<Functor>, FunctionRef>::value
+                      && legacy::is_invocable_r<ReturnType, std::remove_reference_t<Functor>&, Args...>::value,
+                  void>>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions, bugprone-forwarding-reference-overload) implicit conversion at the call site is the purpose of the type, the copy constructor is excluded
+    constexpr FunctionRef(Functor&& functor) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) the constness is restored in 'invoke'
+        : m_callable(const_cast<void*>(static_cast<const void*>(std::addressof(functor))))
+        , m_invoker(&invoke<std::remove_reference_t<Functor>>) {
+    }
+
+    /// @brief construct from a free function pointer
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit conversion at the call site is the purpose of the type
+    FunctionRef(ReturnType (*function)(Args...)) noexcept
+        // AXIVION Next Construct AutosarC++19_03-A5.2.4: reinterpret_cast is required for type erasure,
+        // the pointer is only used as its original function pointer type after reconversion
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        : m_callable(reinterpret_cast<void*>(function))
+        , m_invoker(&invoke_free_function) {
+        IOX2_ENFORCE(function != nullptr, "parameter must not be a 'nullptr'");
+    }
+
+    constexpr FunctionRef(const FunctionRef&) noexcept = default;
+    constexpr FunctionRef(FunctionRef&&) noexcept = default;
+    ~FunctionRef() = default;
+
+    auto operator=(const FunctionRef&) noexcept -> FunctionRef& = default;
+    auto operator=(FunctionRef&&) noexcept -> FunctionRef& = default;
+
+    /// @brief invoke the referenced callable
+    /// @param args arguments to invoke the referenced callable with
+    /// @return return value of the referenced callable
+    auto operator()(Args... args) const -> ReturnType {
+        return m_invoker(m_callable, std::forward<Args>(args)...);
+    }
+
+  private:
+    template <typename CallableType>
+    static auto invoke(void* callable, Args&&... args) -> ReturnType {
+        return (*static_cast<CallableType*>(callable))(std::forward<Args>(args)...);
+    }
+
+    static auto invoke_free_function(void* callable, Args&&... args) -> ReturnType {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) type erasure, see constructor
+        return (reinterpret_cast<ReturnType (*)(Args...)>(callable))(std::forward<Args>(args)...);
+    }
+
+    void* m_callable;
+    ReturnType (*m_invoker)(void*, Args&&...);
+};
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_BB_FUNCTION_REF_HPP
@@ -0,0 +1,166 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_MPMC_QUEUE_HPP
+#define IOX2_INCLUDE_GUARD_BB_MPMC_QUEUE_HPP
+
+#include "iox2/bb/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+
+/// A bounded, lock-free FIFO queue with compile-time fixed capacity that can be used
+/// concurrently by any number of producers and consumers of the same process.
+///
+/// Every slot carries a sequence number that hands the exclusive ownership of the slot back and
+/// forth between producers and consumers. Therefore, the elements are moved in and out of the
+/// queue without any lock and move-only types like `Sample` or `ActiveRequest` can be handed
+/// over to other threads.
+template <typename T, uint64_t Capacity>
+class MpmcQueue {
+    static_assert(Capacity > 0, "Static container with capacity 0 is not allowed.");
+
+  public:
+    using ValueType = T;
+    using SizeType = uint64_t;
+
+    MpmcQueue() noexcept {
+        for (uint64_t i = 0; i < Capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue(MpmcQueue&&) = delete;
+    auto operator=(const MpmcQueue&) -> MpmcQueue& = delete;
+    auto operator=(MpmcQueue&&) -> MpmcQueue& = delete;
+
+    /// Destroys all remaining elements. Must not be called concurrently with any other method.
+    ~MpmcQueue() {
+        while (pop().has_value()) { }
+    }
+
+    /// Attempts to move `value` to the back of the queue.
+    /// @return true on success.
+    ///         false if the queue is full, `value` is left untouched.
+    auto try_push(T&& value) -> bool {
+        return try_emplace(std::move(value));
+    }
+
+    /// Attempts to copy `value` to the back of the queue.
+    /// @return true on success.
+    ///         false if the queue is full.
+    auto try_push(const T& value) -> bool {
+        return try_emplace(value);
+    }
+
+    /// Attempts to construct a new element from the constructor arguments `args` at the back of the queue.
+    /// @return true on success.
+    ///         false if the queue is full, `args` are left untouched.
+    template <typename... Args>
+    auto try_emplace(Args&&... args) -> bool {
+        auto position = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = m_slots[position % Capacity];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position) {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    new (slot.pointer()) T(std::forward<Args>(args)...);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < position) {
+                return false;
+            } else {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Removes the oldest element from the queue.
+    /// @return Nullopt if the queue is empty.
+    ///         Otherwise the removed element.
+    auto pop() -> bb::Optional<T> {
+        auto position = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = m_slots[position % Capacity];
+            const auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position + 1) {
+                if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    bb::Optional<T> value(std::move(*slot.pointer()));
+                    slot.pointer()->~T();
+                    slot.sequence.store(position + Capacity, std::memory_order_release);
+                    return value;
+                }
+            } else if (sequence < position + 1) {
+                return bb::NULLOPT;
+            } else {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Returns true when the slot for the next push is free. With a single producer, the next
+    /// `try_push()` of that producer is guaranteed to succeed.
+    auto has_space() const -> bool {
+        const auto position = m_tail.load(std::memory_order_relaxed);
+        return m_slots[position % Capacity].sequence.load(std::memory_order_acquire) == position;
+    }
+
+    /// Retrieves the number of elements in the queue. When the queue is used concurrently the
+    /// value is only a snapshot.
+    auto size() const -> SizeType {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    /// Checks whether the queue is empty. When the queue is used concurrently the value is only a snapshot.
+    auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    /// Retrieves the static capacity of the queue.
+    static constexpr auto capacity() noexcept -> SizeType {
+        return Capacity;
+    }
+
+  private:
+    static constexpr uint64_t CACHE_LINE_SIZE = 64;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence { 0 };
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) raw storage, will not be used as array
+        alignas(T) char bytes[sizeof(T)];
+
+        auto pointer() -> T* {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) required for storage access
+            return reinterpret_cast<T*>(&bytes[0]);
+        }
+    };
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) inplace storage
+    Slot m_slots[Capacity];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_head { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_tail { 0 };
+};
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_MPMC_QUEUE_HPP
@@ -0,0 +1,212 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_RELOCATABLE_OPTIONAL_HPP
+#define IOX2_INCLUDE_GUARD_BB_RELOCATABLE_OPTIONAL_HPP
+
+#include "iox2/bb/detail/assertions.hpp"
+#include "iox2/bb/detail/tagged_union.hpp"
+#include "iox2/bb/optional.hpp"
+
+#include <memory>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+namespace detail {
+/// The empty alternative of a `RelocatableOptional`.
+struct RelocatableNone {
+    friend constexpr auto operator==(RelocatableNone /* unused */, RelocatableNone /* unused */) -> bool {
+        return true;
+    }
+};
+} // namespace detail
+
+/// An optional value with a defined memory layout. In contrast to `bb::Optional`, which can be
+/// exchanged with `std::optional`, it can be placed in shared memory and exchanged between
+/// processes and languages. It is trivially copyable when `T` is trivially copyable.
+///
+/// The memory layout is equal to the Rust `iceoryx2_bb_container::relocatable_option::RelocatableOption<T>`,
+/// an `u8` tag (0 for none, 1 for some) followed by the value at the alignment of `T`.
+template <typename T>
+class RelocatableOptional : public detail::TaggedUnion<detail::RelocatableNone, T> {
+    static_assert(!std::is_reference<T>::value, "RelocatableOptional cannot hold references.");
+    static_assert(std::is_standard_layout<T>::value,
+                  "RelocatableOptional can only be used with standard layout types.");
+
+    using Base = detail::TaggedUnion<detail::RelocatableNone, T>;
+
+    static constexpr typename Base::TagType NONE = 0;
+    static constexpr typename Base::TagType SOME = 1;
+
+  public:
+    using ValueType = T;
+
+    // constructors
+    RelocatableOptional() noexcept {
+        this->m_tag = NONE;
+    }
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit like bb::Optional
+    RelocatableOptional(NulloptT /* unused */) noexcept
+        : RelocatableOptional() {
+    }
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit like bb::Optional
+    RelocatableOptional(T const& value) {
+        construct(value);
+    }
+
+    // NOLINTNEXTLINE(hicpp-explicit-conversions) implicit like bb::Optional
+    RelocatableOptional(T&& value) {
+        construct(std::move(value));
+    }
+
+    auto operator=(NulloptT /* unused */) noexcept -> RelocatableOptional& {
+        reset();
+        return *this;
+    }
+
+    /// Checks whether the optional contains a value.
+    auto has_value() const noexcept -> bool {
+        return this->m_tag == SOME;
+    }
+
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /// Returns a reference to the contained value.
+    /// @pre has_value()
+    auto value() & -> T& {
+        IOX2_ENFORCE(has_value(), "Trying to access the value on an empty RelocatableOptional!");
+        return *pointer();
+    }
+
+    /// Returns a reference to the contained value.
+    /// @pre has_value()
+    auto value() const& -> T const& {
+        IOX2_ENFORCE(has_value(), "Trying to access the value on an empty RelocatableOptional!");
+        return *pointer();
+    }
+
+    /// Returns the contained value.
+    /// @pre has_value()
+    auto value() && -> T&& {
+        IOX2_ENFORCE(has_value(), "Trying to access the value on an empty RelocatableOptional!");
+        return std::move(*pointer());
+    }
+
+    auto operator*() & -> T& {
+        return value();
+    }
+
+    auto operator*() const& -> T const& {
+        return value();
+    }
+
+    auto operator->() -> T* {
+        return std::addressof(value());
+    }
+
+    auto operator->() const -> T const* {
+        return std::addressof(value());
+    }
+
+    /// Returns a copy of the contained value or `fallback` when the optional is empty.
+    template <typename U>
+    auto value_or(U&& fallback) const& -> T {
+        return has_value() ? *pointer() : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /// Destroys the contained value and constructs a new one from the constructor arguments `args`.
+    /// @return A reference to the new value.
+    template <typename... Args>
+    auto emplace(Args&&... args) -> T& {
+        reset();
+        return construct(std::forward<Args>(args)...);
+    }
+
+    /// Destroys the contained value, afterwards the optional is empty.
+    void reset() noexcept {
+        this->destroy();
+        this->m_tag = NONE;
+    }
+
+    /// Converts into a `bb::Optional` with a copy of the contained value.
+    auto to_optional() const -> bb::Optional<T> {
+        if (has_value()) {
+            return *pointer();
+        }
+        return bb::NULLOPT;
+    }
+
+    // comparison operators
+    friend auto operator==(RelocatableOptional const& lhs, RelocatableOptional const& rhs) -> bool {
+        return lhs.m_tag == rhs.m_tag && Base::Operations::equal(lhs.m_tag, lhs.storage(), rhs.storage());
+    }
+
+    friend auto operator!=(RelocatableOptional const& lhs, RelocatableOptional const& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+
+    friend auto operator==(RelocatableOptional const& lhs, NulloptT /* unused */) -> bool {
+        return !lhs.has_value();
+    }
+
+    friend auto operator!=(RelocatableOptional const& lhs, NulloptT /* unused */) -> bool {
+        return lhs.has_value();
+    }
+
+  private:
+    auto pointer() -> T* {
+        return static_cast<T*>(this->storage());
+    }
+
+    auto pointer() const -> T const* {
+        return static_cast<T const*>(this->storage());
+    }
+
+    // @pre !has_value()
+    template <typename... Args>
+    auto construct(Args&&... args) -> T& {
+        auto* value = new (this->storage()) T(std::forward<Args>(args)...);
+        this->m_tag = SOME;
+        return *value;
+    }
+};
+
+template <typename>
+struct IsRelocatableOptional : std::false_type { };
+
+template <typename T>
+struct IsRelocatableOptional<RelocatableOptional<T>> : std::true_type { };
+
+} // namespace bb
+} // namespace iox2
+
+template <typename T>
+auto operator<<(std::ostream& stream, const iox2::bb::RelocatableOptional<T>& value) -> std::ostream& {
+    stream << "RelocatableOptional { ";
+    if (value.has_value()) {
+        stream << "value: " << value.value();
+    } else {
+        stream << "NULLOPT";
+    }
+    stream << " }";
+    return stream;
+}
+
+#endif // IOX2_INCLUDE_GUARD_BB_RELOCATABLE_OPTIONAL_HPP
@@ -14,10 +14,15 @@
 #define IOX2_BB_SLICE_HPP
 
 #include "iox2/bb/detail/assertions.hpp"
+#include "iox2/bb/detail/attributes.hpp"
 
 #include <cstdint>
 #include <type_traits>
 
+#if IOX2_CXX_STANDARD_VERSION >= 202002L
+#include <ranges>
+#endif
+
 namespace iox2 {
 namespace bb {
 
@@ -25,6 +30,9 @@ namespace bb {
 ///
 /// A Slice provides a view into a contiguous sequence of elements without owning the memory.
 /// It allows for efficient access and iteration over a portion of a contiguous data structure.
+/// The iterators are plain pointers, therefore a Slice can be used directly with the standard
+/// algorithms, including the parallel execution policies, and with C++20 it models a
+/// contiguous and borrowed range that can be converted into a `std::span`.
 ///
 /// @tparam T The type of elements in the slice. Can be const-qualified for read-only slices.
 template <typename T>
@@ -33,6 +41,7 @@ class Slice {
     using Iterator = T*;
     using ConstIterator = const T*;
     using ValueType = std::remove_const_t<T>;
+    using SizeType = uint64_t;
 
     /// @brief Constructs a Slice object.
     /// @param[in] data Pointer to the beginning of the data.
@@ -47,6 +56,14 @@ class Slice {
     /// @return The number of elements in the slice.
     auto number_of_elements() const -> uint64_t;
 
+    /// @brief Returns the number of elements in the slice.
+    /// @return The number of elements in the slice.
+    auto size() const -> SizeType;
+
+    /// @brief Checks if the slice contains no elements.
+    /// @return true if the slice is empty, otherwise false.
+    auto empty() const -> bool;
+
     /// @brief Accesses the element at the specified index (const version).
     /// @param[in] n The index of the element to access.
     /// @return A const reference to the element at the specified index.
@@ -83,6 +100,32 @@ class Slice {
     /// @return A pointer to the first element of the slice.
     auto data() -> Iterator;
 
+    /// @brief Returns a slice of the elements in the range [offset, offset + count) (const version).
+    /// @param[in] offset The index of the first element of the returned slice.
+    /// @param[in] count The number of elements of the returned slice.
+    /// @return A read-only slice that refers to the same memory.
+    /// @pre offset + count must not exceed the number of elements in the slice.
+    auto subspan(uint64_t offset, uint64_t count) const -> Slice<const ValueType>;
+
+    /// @brief Returns a slice of the elements in the range [offset, offset + count) (non-const version).
+    /// @param[in] offset The index of the first element of the returned slice.
+    /// @param[in] count The number of elements of the returned slice.
+    /// @return A slice that refers to the same memory.
+    /// @pre offset + count must not exceed the number of elements in the slice.
+    auto subspan(uint64_t offset, uint64_t count) -> Slice<T>;
+
+    /// @brief Returns a slice of all elements starting from offset (const version).
+    /// @param[in] offset The index of the first element of the returned slice.
+    /// @return A read-only slice that refers to the same memory.
+    /// @pre offset must not exceed the number of elements in the slice.
+    auto subspan(uint64_t offset) const -> Slice<const ValueType>;
+
+    /// @brief Returns a slice of all elements starting from offset (non-const version).
+    /// @param[in] offset The index of the first element of the returned slice.
+    /// @return A slice that refers to the same memory.
+    /// @pre offset must not exceed the number of elements in the slice.
+    auto subspan(uint64_t offset) -> Slice<T>;
+
   private:
     T* m_data;
     uint64_t m_number_of_elements;
@@ -111,6 +154,16 @@ auto Slice<T>::number_of_elements() const -> uint64_t {
     return m_number_of_elements;
 }
 
+template <typename T>
+auto Slice<T>::size() const -> SizeType {
+    return m_number_of_elements;
+}
+
+template <typename T>
+auto Slice<T>::empty() const -> bool {
+    return m_number_of_elements == 0;
+}
+
 template <typename T>
 auto Slice<T>::operator[](const uint64_t n) const -> const ValueType& {
     IOX2_ASSERT(n < m_number_of_elements, "Index out of bounds");
@@ -154,6 +207,30 @@ auto Slice<T>::data() const -> ConstIterator {
     return m_data;
 }
 
+template <typename T>
+auto Slice<T>::subspan(const uint64_t offset, const uint64_t count) const -> Slice<const ValueType> {
+    IOX2_ASSERT(offset <= m_number_of_elements && count <= m_number_of_elements - offset, "Subspan out of bounds");
+    return Slice<const ValueType>(m_data + offset, count);
+}
+
+template <typename T>
+auto Slice<T>::subspan(const uint64_t offset, const uint64_t count) -> Slice<T> {
+    IOX2_ASSERT(offset <= m_number_of_elements && count <= m_number_of_elements - offset, "Subspan out of bounds");
+    return Slice<T>(m_data + offset, count);
+}
+
+template <typename T>
+auto Slice<T>::subspan(const uint64_t offset) const -> Slice<const ValueType> {
+    IOX2_ASSERT(offset <= m_number_of_elements, "Subspan out of bounds");
+    return Slice<const ValueType>(m_data + offset, m_number_of_elements - offset);
+}
+
+template <typename T>
+auto Slice<T>::subspan(const uint64_t offset) -> Slice<T> {
+    IOX2_ASSERT(offset <= m_number_of_elements, "Subspan out of bounds");
+    return Slice<T>(m_data + offset, m_number_of_elements - offset);
+}
+
 template <typename>
 struct IsSlice {
     static constexpr bool VALUE = false;
@@ -167,4 +244,12 @@ struct IsSlice<Slice<T>> {
 } // namespace bb
 } // namespace iox2
 
+#if IOX2_CXX_STANDARD_VERSION >= 202002L
+/// @brief A Slice does not own the elements it refers to. Therefore, std::span and the range
+///        adaptors can refer to the elements of a temporary Slice, like the one returned by
+///        Sample::payload().
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<iox2::bb::Slice<T>> = true;
+#endif
+
 #endif // IOX2_BB_SLICE_HPP
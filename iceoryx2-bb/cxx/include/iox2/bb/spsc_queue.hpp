@@ -0,0 +1,277 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_SPSC_QUEUE_HPP
+#define IOX2_INCLUDE_GUARD_BB_SPSC_QUEUE_HPP
+
+#include "iox2/bb/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+
+/// A bounded, lock-free FIFO queue with compile-time fixed capacity for exactly one producer
+/// and one consumer thread of the same process. It is the C++ counterpart of the Rust
+/// `iceoryx2_bb_lock_free::spsc::queue::Queue` but also supports move-only types like
+/// `Sample` or `ActiveRequest`.
+///
+/// Elements are added via the `SpscQueue::Producer` and removed via the `SpscQueue::Consumer`.
+/// At most one of each can be acquired at a time, they are released when they go out of scope.
+template <typename T, uint64_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0, "Static container with capacity 0 is not allowed.");
+
+  public:
+    using ValueType = T;
+    using SizeType = uint64_t;
+
+    /// Adds elements to the `SpscQueue`. It must be used by only one thread at a time.
+    class Producer {
+      public:
+        Producer(const Producer&) = delete;
+        Producer(Producer&& rhs) noexcept
+            : m_queue { rhs.m_queue } {
+            rhs.m_queue = nullptr;
+        }
+        auto operator=(const Producer&) -> Producer& = delete;
+        auto operator=(Producer&& rhs) noexcept -> Producer& {
+            if (this != &rhs) {
+                release();
+                m_queue = rhs.m_queue;
+                rhs.m_queue = nullptr;
+            }
+            return *this;
+        }
+
+        ~Producer() {
+            release();
+        }
+
+        /// Attempts to move `value` to the back of the queue.
+        /// @return true on success.
+        ///         false if the queue is full, `value` is left untouched.
+        auto try_push(T&& value) -> bool {
+            return m_queue->try_emplace(std::move(value));
+        }
+
+        /// Attempts to copy `value` to the back of the queue.
+        /// @return true on success.
+        ///         false if the queue is full.
+        auto try_push(const T& value) -> bool {
+            return m_queue->try_emplace(value);
+        }
+
+        /// Attempts to construct a new element from the constructor arguments `args` at the back of the queue.
+        /// @return true on success.
+        ///         false if the queue is full, `args` are left untouched.
+        template <typename... Args>
+        auto try_emplace(Args&&... args) -> bool {
+            return m_queue->try_emplace(std::forward<Args>(args)...);
+        }
+
+      private:
+        friend class SpscQueue;
+
+        explicit Producer(SpscQueue& queue)
+            : m_queue { &queue } {
+        }
+
+        void release() {
+            if (m_queue != nullptr) {
+                // SYNC POINT: producer, sync the internal state with the next producer in another thread
+                m_queue->m_has_producer.store(true, std::memory_order_release);
+                m_queue = nullptr;
+            }
+        }
+
+        SpscQueue* m_queue;
+    };
+
+    /// Removes elements from the `SpscQueue`. It must be used by only one thread at a time.
+    class Consumer {
+      public:
+        Consumer(const Consumer&) = delete;
+        Consumer(Consumer&& rhs) noexcept
+            : m_queue { rhs.m_queue } {
+            rhs.m_queue = nullptr;
+        }
+        auto operator=(const Consumer&) -> Consumer& = delete;
+        auto operator=(Consumer&& rhs) noexcept -> Consumer& {
+            if (this != &rhs) {
+                release();
+                m_queue = rhs.m_queue;
+                rhs.m_queue = nullptr;
+            }
+            return *this;
+        }
+
+        ~Consumer() {
+            release();
+        }
+
+        /// Removes the oldest element from the queue.
+        /// @return Nullopt if the queue is empty.
+        ///         Otherwise the removed element.
+        auto pop() -> bb::Optional<T> {
+            return m_queue->pop();
+        }
+
+      private:
+        friend class SpscQueue;
+
+        explicit Consumer(SpscQueue& queue)
+            : m_queue { &queue } {
+        }
+
+        void release() {
+            if (m_queue != nullptr) {
+                // SYNC POINT: consumer, sync the internal state with the next consumer in another thread
+                m_queue->m_has_consumer.store(true, std::memory_order_release);
+                m_queue = nullptr;
+            }
+        }
+
+        SpscQueue* m_queue;
+    };
+
+    SpscQueue() noexcept = default;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    auto operator=(const SpscQueue&) -> SpscQueue& = delete;
+    auto operator=(SpscQueue&&) -> SpscQueue& = delete;
+
+    /// Destroys all remaining elements. The `Producer` and `Consumer` must be released before.
+    ~SpscQueue() {
+        while (pop().has_value()) { }
+    }
+
+    /// Returns the `Producer` of the queue.
+    /// @return Nullopt if the producer was already acquired and not yet released.
+    auto acquire_producer() -> bb::Optional<Producer> {
+        bool expected = true;
+        // SYNC POINT: producer, sync the internal state with the previous producer in another thread
+        if (m_has_producer.compare_exchange_strong(
+                expected, false, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return Producer(*this);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Returns the `Consumer` of the queue.
+    /// @return Nullopt if the consumer was already acquired and not yet released.
+    auto acquire_consumer() -> bb::Optional<Consumer> {
+        bool expected = true;
+        // SYNC POINT: consumer, sync the internal state with the previous consumer in another thread
+        if (m_has_consumer.compare_exchange_strong(
+                expected, false, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return Consumer(*this);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Retrieves the number of elements in the queue. When the queue is used concurrently the
+    /// value is only a snapshot.
+    auto size() const -> SizeType {
+        const auto positions = acquire_read_and_write_position();
+        return positions.write - positions.read;
+    }
+
+    /// Checks whether the queue is empty. When the queue is used concurrently the value is only a snapshot.
+    auto empty() const -> bool {
+        return size() == 0;
+    }
+
+    /// Checks whether the queue is full. When the queue is used concurrently the value is only a snapshot.
+    auto full() const -> bool {
+        return size() == Capacity;
+    }
+
+    /// Retrieves the static capacity of the queue.
+    static constexpr auto capacity() noexcept -> SizeType {
+        return Capacity;
+    }
+
+  private:
+    static constexpr uint64_t CACHE_LINE_SIZE = 64;
+
+    struct Positions {
+        uint64_t write;
+        uint64_t read;
+    };
+
+    template <typename... Args>
+    auto try_emplace(Args&&... args) -> bool {
+        const auto current_write_position = m_write_position.load(std::memory_order_relaxed);
+        // SYNC POINT with the `m_read_position` store in `pop`
+        const auto current_read_position = m_read_position.load(std::memory_order_acquire);
+        if (current_write_position == current_read_position + Capacity) {
+            return false;
+        }
+
+        new (pointer_from_position(current_write_position)) T(std::forward<Args>(args)...);
+        // SYNC POINT with the `m_write_position` load in `pop`, the element must be constructed
+        // before it is signaled as ready
+        m_write_position.store(current_write_position + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto pop() -> bb::Optional<T> {
+        const auto current_read_position = m_read_position.load(std::memory_order_relaxed);
+        // SYNC POINT with the `m_write_position` store in `try_emplace`
+        if (current_read_position == m_write_position.load(std::memory_order_acquire)) {
+            return bb::NULLOPT;
+        }
+
+        auto* element = pointer_from_position(current_read_position);
+        bb::Optional<T> value(std::move(*element));
+        element->~T();
+        // SYNC POINT with the `m_read_position` load in `try_emplace`, the element must be
+        // destroyed before its slot is signaled as free
+        m_read_position.store(current_read_position + 1, std::memory_order_release);
+        return value;
+    }
+
+    auto acquire_read_and_write_position() const -> Positions {
+        while (true) {
+            const auto write_position = m_write_position.load(std::memory_order_relaxed);
+            const auto read_position = m_read_position.load(std::memory_order_relaxed);
+
+            if (write_position == m_write_position.load(std::memory_order_relaxed)
+                && read_position == m_read_position.load(std::memory_order_relaxed)) {
+                return { write_position, read_position };
+            }
+        }
+    }
+
+    auto pointer_from_position(uint64_t position) -> T* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic) index is always smaller than Capacity
+        return reinterpret_cast<T*>(&m_bytes[0]) + (position % Capacity);
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) raw storage, will not be used as array
+    alignas(T) char m_bytes[sizeof(T) * Capacity];
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_write_position { 0 };
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_read_position { 0 };
+    std::atomic<bool> m_has_producer { true };
+    std::atomic<bool> m_has_consumer { true };
+};
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_SPSC_QUEUE_HPP
@@ -0,0 +1,342 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_STATIC_FLAT_MAP_HPP
+#define IOX2_INCLUDE_GUARD_BB_STATIC_FLAT_MAP_HPP
+
+#include "iox2/bb/detail/attributes.hpp"
+#include "iox2/bb/optional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+namespace detail {
+constexpr auto static_flat_map_slot_count(uint64_t capacity) -> uint64_t {
+    // keeps the load factor at or below 7/8 so that probe sequences stay short
+    uint64_t const min_slots = capacity + (capacity / 7) + 1;
+    uint64_t slots = 1;
+    while (slots < min_slots) {
+        slots *= 2;
+    }
+    return slots;
+}
+} // namespace detail
+
+/// A hash map with compile-time fixed static capacity and contiguous inplace storage. It uses
+/// open addressing with linear probing and stores one control byte per slot, so that a probe
+/// sequence mostly touches a single contiguous byte array before a key is compared.
+///
+/// The map does not contain any pointers and can be placed in shared memory. All processes that
+/// access the same map must use the same `Hash`.
+template <typename K, typename V, uint64_t Capacity, typename Hash = std::hash<K>>
+class StaticFlatMap {
+    static_assert(Capacity > 0, "Static container with capacity 0 is not allowed.");
+    static_assert(std::is_standard_layout<K>::value, "Containers can only be used with standard layout types.");
+    static_assert(std::is_standard_layout<V>::value, "Containers can only be used with standard layout types.");
+
+  public:
+    using KeyType = K;
+    using ValueType = V;
+    using SizeType = uint64_t;
+    using OptionalReference = bb::Optional<std::reference_wrapper<V>>;
+    using OptionalConstReference = bb::Optional<std::reference_wrapper<V const>>;
+
+  private:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    static constexpr uint64_t SLOT_COUNT = detail::static_flat_map_slot_count(Capacity);
+    static constexpr uint8_t CONTROL_EMPTY = 0x80;
+    static constexpr uint8_t CONTROL_HASH_MASK = 0x7F;
+    static constexpr uint64_t CONTROL_HASH_BITS = 7;
+
+    SizeType m_size { 0 };
+    // CONTROL_EMPTY for a vacant slot, otherwise the lower 7 bits of the hash of its key
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) inplace storage
+    uint8_t m_control[SLOT_COUNT];
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) raw storage, will not be used as array
+    alignas(Entry) char m_bytes[sizeof(Entry) * SLOT_COUNT];
+
+  public:
+    // constructors
+    StaticFlatMap() noexcept
+        : m_bytes {} {
+        mark_all_slots_empty();
+    }
+
+    StaticFlatMap(StaticFlatMap const& rhs)
+        : StaticFlatMap() {
+        copy_slots_from(rhs);
+    }
+
+    StaticFlatMap(StaticFlatMap&& rhs) noexcept
+        : StaticFlatMap() {
+        move_slots_from(rhs);
+    }
+
+    // destructor
+    ~StaticFlatMap() {
+        clear();
+    }
+
+    // assignment
+    auto operator=(StaticFlatMap const& rhs) -> StaticFlatMap& {
+        if (&rhs != this) {
+            clear();
+            copy_slots_from(rhs);
+        }
+        return *this;
+    }
+
+    auto operator=(StaticFlatMap&& rhs) noexcept -> StaticFlatMap& {
+        if (&rhs != this) {
+            clear();
+            move_slots_from(rhs);
+        }
+        return *this;
+    }
+
+    /// Attempts to insert `value` under `key`.
+    /// @return true on success.
+    ///         false if the map is full or already contains `key`.
+    auto try_insert(K const& key, V const& value) -> bool {
+        return try_emplace(key, value);
+    }
+
+    /// Attempts to construct a new value from the constructor arguments `args` under `key`.
+    /// @return true on success.
+    ///         false if the map is full or already contains `key`.
+    template <typename... Args, std::enable_if_t<std::is_constructible<V, Args...>::value, bool> = true>
+    auto try_emplace(K const& key, Args&&... args) -> bool {
+        auto const hash = hash_of(key);
+        if (find_slot(key, hash) != SLOT_COUNT || full()) {
+            return false;
+        }
+
+        auto slot = home_slot(hash);
+        while (m_control[slot] != CONTROL_EMPTY) {
+            slot = next_slot(slot);
+        }
+
+        new (entry(slot)) Entry { key, V(std::forward<Args>(args)...) };
+        m_control[slot] = control_byte(hash);
+        ++m_size;
+        return true;
+    }
+
+    /// Attempts to retrieve the value stored under `key`.
+    /// @return Nullopt if the map does not contain `key`.
+    ///         Otherwise a reference to the value.
+    auto get(K const& key) -> OptionalReference {
+        auto const slot = find_slot(key, hash_of(key));
+        if (slot != SLOT_COUNT) {
+            return entry(slot)->value;
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the value stored under `key`.
+    /// @return Nullopt if the map does not contain `key`.
+    ///         Otherwise a reference to the value.
+    auto get(K const& key) const -> OptionalConstReference {
+        auto const slot = find_slot(key, hash_of(key));
+        if (slot != SLOT_COUNT) {
+            return entry(slot)->value;
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Checks whether the map contains `key`.
+    auto contains(K const& key) const -> bool {
+        return find_slot(key, hash_of(key)) != SLOT_COUNT;
+    }
+
+    /// Removes the value stored under `key`.
+    /// @return true if `key` was contained in the map.
+    ///         false otherwise.
+    auto remove(K const& key) -> bool {
+        auto const slot = find_slot(key, hash_of(key));
+        if (slot == SLOT_COUNT) {
+            return false;
+        }
+
+        entry(slot)->~Entry();
+        m_control[slot] = CONTROL_EMPTY;
+        --m_size;
+        close_gap(slot);
+        return true;
+    }
+
+    /// Removes all elements from the map.
+    void clear() {
+        for (uint64_t slot = 0; slot < SLOT_COUNT && !empty(); ++slot) {
+            if (m_control[slot] != CONTROL_EMPTY) {
+                entry(slot)->~Entry();
+                m_control[slot] = CONTROL_EMPTY;
+                --m_size;
+            }
+        }
+    }
+
+    /// Calls `callback` with the key and a reference to the value of every element. The
+    /// iteration order is unspecified.
+    template <typename F>
+    void for_each(F&& callback) {
+        for (uint64_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (m_control[slot] != CONTROL_EMPTY) {
+                callback(static_cast<K const&>(entry(slot)->key), entry(slot)->value);
+            }
+        }
+    }
+
+    /// Calls `callback` with the key and a reference to the value of every element. The
+    /// iteration order is unspecified.
+    template <typename F>
+    void for_each(F&& callback) const {
+        for (uint64_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (m_control[slot] != CONTROL_EMPTY) {
+                callback(entry(slot)->key, entry(slot)->value);
+            }
+        }
+    }
+
+    /// Retrieves the static capacity of the map.
+    static constexpr auto capacity() noexcept -> SizeType {
+        return Capacity;
+    }
+
+    /// Retrieves the number of elements in the map.
+    auto size() const noexcept -> SizeType {
+        return m_size;
+    }
+
+    /// Checks whether the map is currently empty.
+    auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    /// Checks whether the map is currently full.
+    auto full() const noexcept -> bool {
+        return size() == Capacity;
+    }
+
+  private:
+    static auto hash_of(K const& key) -> uint64_t {
+        // the finalizer of splitmix64, std::hash is the identity for integers on most platforms
+        // and would place consecutive keys into a single probe sequence
+        // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        auto hash = static_cast<uint64_t>(Hash {}(key));
+        hash = (hash ^ (hash >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27U)) * 0x94D049BB133111EBULL;
+        return hash ^ (hash >> 31U);
+        // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+
+    static auto control_byte(uint64_t hash) -> uint8_t {
+        return static_cast<uint8_t>(hash & CONTROL_HASH_MASK);
+    }
+
+    static auto home_slot(uint64_t hash) -> uint64_t {
+        return (hash >> CONTROL_HASH_BITS) & (SLOT_COUNT - 1);
+    }
+
+    static auto next_slot(uint64_t slot) -> uint64_t {
+        return (slot + 1) & (SLOT_COUNT - 1);
+    }
+
+    auto entry(uint64_t slot) -> Entry* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic), slot is always smaller than SLOT_COUNT
+        return reinterpret_cast<Entry*>(&m_bytes[0]) + slot;
+    }
+
+    auto entry(uint64_t slot) const -> Entry const* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic), slot is always smaller than SLOT_COUNT
+        return reinterpret_cast<Entry const*>(&m_bytes[0]) + slot;
+    }
+
+    // returns SLOT_COUNT when the key is not contained, the probe sequence always ends since
+    // SLOT_COUNT > Capacity guarantees at least one empty slot
+    auto find_slot(K const& key, uint64_t hash) const -> uint64_t {
+        auto const control = control_byte(hash);
+        for (auto slot = home_slot(hash); m_control[slot] != CONTROL_EMPTY; slot = next_slot(slot)) {
+            if (m_control[slot] == control && entry(slot)->key == key) {
+                return slot;
+            }
+        }
+        return SLOT_COUNT;
+    }
+
+    // backward shift deletion, moves all following elements of the probe sequence whose home
+    // slot is not between the gap and their current slot into the gap, therefore, no tombstones
+    // are required and lookups never degrade
+    void close_gap(uint64_t gap) {
+        for (auto slot = next_slot(gap); m_control[slot] != CONTROL_EMPTY; slot = next_slot(slot)) {
+            auto const home = home_slot(hash_of(entry(slot)->key));
+            auto const distance_to_home = (slot - home) & (SLOT_COUNT - 1);
+            auto const distance_to_gap = (slot - gap) & (SLOT_COUNT - 1);
+            if (distance_to_home >= distance_to_gap) {
+                new (entry(gap)) Entry(std::move(*entry(slot)));
+                m_control[gap] = m_control[slot];
+                entry(slot)->~Entry();
+                m_control[slot] = CONTROL_EMPTY;
+                gap = slot;
+            }
+        }
+    }
+
+    void mark_all_slots_empty() {
+        for (auto& control : m_control) {
+            control = CONTROL_EMPTY;
+        }
+    }
+
+    // @pre empty()
+    void copy_slots_from(StaticFlatMap const& rhs) {
+        for (uint64_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (rhs.m_control[slot] != CONTROL_EMPTY) {
+                new (entry(slot)) Entry(*rhs.entry(slot));
+                m_control[slot] = rhs.m_control[slot];
+            }
+        }
+        m_size = rhs.m_size;
+    }
+
+    // @pre empty()
+    void move_slots_from(StaticFlatMap& rhs) {
+        for (uint64_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (rhs.m_control[slot] != CONTROL_EMPTY) {
+                new (entry(slot)) Entry(std::move_if_noexcept(*rhs.entry(slot)));
+                m_control[slot] = rhs.m_control[slot];
+            }
+        }
+        m_size = rhs.m_size;
+    }
+};
+
+template <typename>
+struct IsStaticFlatMap : std::false_type { };
+
+template <typename K, typename V, uint64_t N, typename H>
+struct IsStaticFlatMap<StaticFlatMap<K, V, N, H>> : std::true_type { };
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_STATIC_FLAT_MAP_HPP
@@ -0,0 +1,360 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_STATIC_QUEUE_HPP
+#define IOX2_INCLUDE_GUARD_BB_STATIC_QUEUE_HPP
+
+#include "iox2/bb/detail/attributes.hpp"
+#include "iox2/bb/optional.hpp"
+#include "iox2/bb/slice.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+
+/// A FIFO ring buffer with compile-time fixed static capacity and contiguous inplace storage.
+/// Elements are pushed to the back and popped from the front in O(1).
+///
+/// The memory layout is equal to the Rust `iceoryx2_bb_container::queue::FixedSizeQueue<T, Capacity>`
+/// on 64-bit platforms, therefore it can be used in zero-copy payloads that are exchanged with Rust.
+template <typename T, uint64_t Capacity>
+class StaticQueue {
+    static_assert(Capacity > 0, "Static container with capacity 0 is not allowed.");
+    static_assert(std::is_standard_layout<T>::value, "Containers can only be used with standard layout types.");
+
+  public:
+    using ValueType = T;
+    using SizeType = uint64_t;
+    using Reference = T&;
+    using ConstReference = T const&;
+    using OptionalReference = bb::Optional<std::reference_wrapper<T>>;
+    using OptionalConstReference = bb::Optional<std::reference_wrapper<T const>>;
+
+    /// The content of the queue as two contiguous slices, the elements of `first` are older than
+    /// the elements of `second`. `second` is empty when the content does not wrap around.
+    template <typename S>
+    struct Slices {
+        S first;
+        S second;
+    };
+
+  private:
+    // Equal to the Rust `RelocatableQueue` that manages the storage of the `FixedSizeQueue`.
+    struct State {
+        // distance in bytes from this member to the storage, used by the Rust relocatable pointer
+        int64_t data_distance;
+        // number of elements that were pushed so far, the next element is written to
+        // `start % Capacity`
+        uint64_t start;
+        uint64_t len;
+        uint64_t capacity;
+        bool is_initialized;
+    };
+
+    State m_state;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) raw storage, will not be used as array
+    alignas(T) char m_bytes[sizeof(T) * Capacity];
+
+  public:
+    // constructors
+    StaticQueue() noexcept
+        : m_state { 0, 0, 0, Capacity, true }
+        , m_bytes {} {
+        update_data_distance();
+    }
+
+    StaticQueue(StaticQueue const& rhs)
+        : StaticQueue() {
+        for (uint64_t i = 0; i < rhs.size(); ++i) {
+            unchecked_emplace(*rhs.pointer_from_index(i));
+        }
+    }
+
+    StaticQueue(StaticQueue&& rhs) noexcept
+        : StaticQueue() {
+        for (uint64_t i = 0; i < rhs.size(); ++i) {
+            unchecked_emplace(std::move_if_noexcept(*rhs.pointer_from_index(i)));
+        }
+    }
+
+    // destructor
+    ~StaticQueue() {
+        clear();
+    }
+
+    // assignment
+    auto operator=(StaticQueue const& rhs) -> StaticQueue& {
+        if (&rhs != this) {
+            clear();
+            for (uint64_t i = 0; i < rhs.size(); ++i) {
+                unchecked_emplace(*rhs.pointer_from_index(i));
+            }
+        }
+        return *this;
+    }
+
+    auto operator=(StaticQueue&& rhs) noexcept -> StaticQueue& {
+        if (&rhs != this) {
+            clear();
+            for (uint64_t i = 0; i < rhs.size(); ++i) {
+                unchecked_emplace(std::move_if_noexcept(*rhs.pointer_from_index(i)));
+            }
+        }
+        return *this;
+    }
+
+    /// Attempts to construct a new element from the constructor arguments `args` at the back of the queue.
+    /// @return true on success.
+    ///         false if the queue is full.
+    template <typename... Args, std::enable_if_t<std::is_constructible<T, Args...>::value, bool> = true>
+    auto try_emplace(Args&&... args) -> bool {
+        if (full()) {
+            return false;
+        }
+        unchecked_emplace(std::forward<Args>(args)...);
+        return true;
+    }
+
+    /// Attempts to insert a single `value` at the back of the queue.
+    /// This function will copy the input value into place.
+    /// @return true on success.
+    ///         false if the queue is full.
+    auto try_push(T const& value) -> bool {
+        return try_emplace(value);
+    }
+
+    /// Attempts to insert a single `value` at the back of the queue.
+    /// This function will move the input value into place.
+    /// @return true on success.
+    ///         false if the queue is full.
+    auto try_push(T&& value) -> bool {
+        return try_emplace(std::move(value));
+    }
+
+    /// Inserts `value` at the back of the queue. When the queue is full, the oldest element is
+    /// removed first.
+    /// @return Nullopt if the queue was not full.
+    ///         Otherwise the removed oldest element.
+    auto push_with_overflow(T value) -> bb::Optional<T> {
+        bb::Optional<T> overflow;
+        if (full()) {
+            overflow = pop();
+        }
+        unchecked_emplace(std::move(value));
+        return overflow;
+    }
+
+    /// Removes the oldest element from the front of the queue.
+    /// @return Nullopt if the queue is empty.
+    ///         Otherwise the removed element.
+    auto pop() -> bb::Optional<T> {
+        bb::Optional<T> ret;
+        if (!empty()) {
+            T* element = pointer_from_index(0);
+            ret = std::move(*element);
+            element->~T();
+            --m_state.len;
+        }
+        return ret;
+    }
+
+    /// Removes all elements from the queue.
+    void clear() {
+        while (!empty()) {
+            pointer_from_index(0)->~T();
+            --m_state.len;
+        }
+    }
+
+    /// Retrieves the static capacity of the queue.
+    static constexpr auto capacity() noexcept -> SizeType {
+        return Capacity;
+    }
+
+    /// Retrieves the number of elements in the queue.
+    auto size() const noexcept -> SizeType {
+        return m_state.len;
+    }
+
+    /// Checks whether the queue is currently empty.
+    auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    /// Checks whether the queue is currently full.
+    auto full() const noexcept -> bool {
+        return size() == Capacity;
+    }
+
+    /// Attempts to retrieve the element at `index`, where index 0 is the oldest element.
+    /// @return Nullopt if `index` is not 0 <= `index` < size().
+    ///         Otherwise a reference to the element at the requested index.
+    auto element_at(SizeType index) -> OptionalReference {
+        if (index < size()) {
+            return *pointer_from_index(index);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the element at `index`, where index 0 is the oldest element.
+    /// @return Nullopt if `index` is not 0 <= `index` < size().
+    ///         Otherwise a reference to the element at the requested index.
+    auto element_at(SizeType index) const -> OptionalConstReference {
+        if (index < size()) {
+            return *pointer_from_index(index);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the oldest element.
+    /// @return Nullopt if size() == 0.
+    ///         Otherwise a reference to the oldest element.
+    auto front_element() -> OptionalReference {
+        return element_at(0);
+    }
+
+    /// Attempts to retrieve the oldest element.
+    /// @return Nullopt if size() == 0.
+    ///         Otherwise a reference to the oldest element.
+    auto front_element() const -> OptionalConstReference {
+        return element_at(0);
+    }
+
+    /// Attempts to retrieve the most recent element.
+    /// @return Nullopt if size() == 0.
+    ///         Otherwise a reference to the most recent element.
+    auto back_element() -> OptionalReference {
+        if (!empty()) {
+            return *pointer_from_index(size() - 1);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the most recent element.
+    /// @return Nullopt if size() == 0.
+    ///         Otherwise a reference to the most recent element.
+    auto back_element() const -> OptionalConstReference {
+        if (!empty()) {
+            return *pointer_from_index(size() - 1);
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Returns the content of the queue as two contiguous slices without copying it.
+    auto as_slices() -> Slices<MutableSlice<T>> {
+        auto const first_len = first_slice_len();
+        return { MutableSlice<T>(pointer_from_index(0), first_len),
+                 MutableSlice<T>(storage(), size() - first_len) };
+    }
+
+    /// Returns the content of the queue as two contiguous slices without copying it.
+    auto as_slices() const -> Slices<ImmutableSlice<T>> {
+        auto const first_len = first_slice_len();
+        return { ImmutableSlice<T>(pointer_from_index(0), first_len),
+                 ImmutableSlice<T>(storage(), size() - first_len) };
+    }
+
+    // comparison operators
+    friend auto operator==(StaticQueue const& lhs, StaticQueue const& rhs) -> bool {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (uint64_t i = 0; i < lhs.size(); ++i) {
+            if (!(*lhs.pointer_from_index(i) == *rhs.pointer_from_index(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend auto operator!=(StaticQueue const& lhs, StaticQueue const& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+
+  private:
+    void update_data_distance() {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast), required to calculate the relative distance
+        m_state.data_distance = static_cast<int64_t>(reinterpret_cast<intptr_t>(&m_bytes[0])
+                                                     - reinterpret_cast<intptr_t>(&m_state.data_distance));
+    }
+
+    auto storage() -> T* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast), required for storage access
+        return reinterpret_cast<T*>(&m_bytes[0]);
+    }
+
+    auto storage() const -> T const* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast), required for storage access
+        return reinterpret_cast<T const*>(&m_bytes[0]);
+    }
+
+    auto first_slot() const -> uint64_t {
+        return (m_state.start - m_state.len) % Capacity;
+    }
+
+    auto first_slice_len() const -> uint64_t {
+        auto const until_end = Capacity - first_slot();
+        return size() < until_end ? size() : until_end;
+    }
+
+    // @pre index < Capacity
+    auto pointer_from_index(uint64_t index) -> T* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic), bounds are ensured by the callers
+        return storage() + ((first_slot() + index) % Capacity);
+    }
+
+    // @pre index < Capacity
+    auto pointer_from_index(uint64_t index) const -> T const* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic), bounds are ensured by the callers
+        return storage() + ((first_slot() + index) % Capacity);
+    }
+
+    // @pre !full()
+    template <typename... Args>
+    void unchecked_emplace(Args&&... args) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic), index is always smaller than Capacity
+        new (storage() + (m_state.start % Capacity)) T(std::forward<Args>(args)...);
+        ++m_state.start;
+        ++m_state.len;
+    }
+};
+
+template <typename>
+struct IsStaticQueue : std::false_type { };
+
+template <typename T, uint64_t N>
+struct IsStaticQueue<StaticQueue<T, N>> : std::true_type { };
+
+} // namespace bb
+} // namespace iox2
+
+template <typename T, uint64_t N>
+auto operator<<(std::ostream& stream, const iox2::bb::StaticQueue<T, N>& value) -> std::ostream& {
+    stream << "StaticQueue::<" << N << "> { m_size: " << value.size() << ", m_data: [ ";
+    for (uint64_t idx = 0; idx < value.size(); ++idx) {
+        if (idx != 0) {
+            stream << ", ";
+        }
+        stream << value.element_at(idx)->get();
+    }
+    stream << " ] }";
+    return stream;
+}
+
+#endif // IOX2_INCLUDE_GUARD_BB_STATIC_QUEUE_HPP
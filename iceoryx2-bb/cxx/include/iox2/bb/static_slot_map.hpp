@@ -0,0 +1,311 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_STATIC_SLOT_MAP_HPP
+#define IOX2_INCLUDE_GUARD_BB_STATIC_SLOT_MAP_HPP
+
+#include "iox2/bb/detail/attributes.hpp"
+#include "iox2/bb/optional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+
+/// The key of an element in a `StaticSlotMap`. Like the Rust
+/// `iceoryx2_bb_container::slotmap::SlotMapKey` it is the index of the slot that contains the
+/// element.
+class SlotMapKey {
+  public:
+    constexpr explicit SlotMapKey(uint64_t value) noexcept
+        : m_value { value } {
+    }
+
+    constexpr auto value() const noexcept -> uint64_t {
+        return m_value;
+    }
+
+    friend constexpr auto operator==(SlotMapKey const& lhs, SlotMapKey const& rhs) -> bool {
+        return lhs.m_value == rhs.m_value;
+    }
+
+    friend constexpr auto operator!=(SlotMapKey const& lhs, SlotMapKey const& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+
+  private:
+    uint64_t m_value;
+};
+
+/// A container with compile-time fixed static capacity and contiguous inplace storage that
+/// returns a `SlotMapKey` for every inserted element. Insertion, lookup and removal are O(1).
+/// A key stays valid until its element is removed, afterwards it can be handed out again.
+///
+/// The slot map does not contain any pointers and can be placed in shared memory.
+template <typename T, uint64_t Capacity>
+class StaticSlotMap {
+    static_assert(Capacity > 0, "Static container with capacity 0 is not allowed.");
+    static_assert(std::is_standard_layout<T>::value, "Containers can only be used with standard layout types.");
+
+  public:
+    using ValueType = T;
+    using SizeType = uint64_t;
+    using OptionalReference = bb::Optional<std::reference_wrapper<T>>;
+    using OptionalConstReference = bb::Optional<std::reference_wrapper<T const>>;
+
+  private:
+    static constexpr uint64_t END_OF_FREE_LIST = Capacity;
+
+    SizeType m_size { 0 };
+    uint64_t m_free_list_head { 0 };
+    // for vacant slots the next vacant slot, undefined for occupied slots
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) inplace storage
+    uint64_t m_next_free[Capacity];
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) inplace storage
+    bool m_is_occupied[Capacity];
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays) raw storage, will not be used as array
+    alignas(T) char m_bytes[sizeof(T) * Capacity];
+
+  public:
+    // constructors
+    StaticSlotMap() noexcept
+        : m_bytes {} {
+        reset_free_list();
+    }
+
+    StaticSlotMap(StaticSlotMap const& rhs)
+        : StaticSlotMap() {
+        copy_slots_from(rhs);
+    }
+
+    StaticSlotMap(StaticSlotMap&& rhs) noexcept
+        : StaticSlotMap() {
+        move_slots_from(rhs);
+    }
+
+    // destructor
+    ~StaticSlotMap() {
+        clear();
+    }
+
+    // assignment
+    auto operator=(StaticSlotMap const& rhs) -> StaticSlotMap& {
+        if (&rhs != this) {
+            clear();
+            copy_slots_from(rhs);
+        }
+        return *this;
+    }
+
+    auto operator=(StaticSlotMap&& rhs) noexcept -> StaticSlotMap& {
+        if (&rhs != this) {
+            clear();
+            move_slots_from(rhs);
+        }
+        return *this;
+    }
+
+    /// Attempts to construct a new element from the constructor arguments `args`.
+    /// @return Nullopt if the slot map is full.
+    ///         Otherwise the key of the new element.
+    template <typename... Args, std::enable_if_t<std::is_constructible<T, Args...>::value, bool> = true>
+    auto try_emplace(Args&&... args) -> bb::Optional<SlotMapKey> {
+        if (full()) {
+            return bb::NULLOPT;
+        }
+
+        auto const slot = m_free_list_head;
+        new (pointer_from_slot(slot)) T(std::forward<Args>(args)...);
+        m_free_list_head = m_next_free[slot];
+        m_is_occupied[slot] = true;
+        ++m_size;
+        return SlotMapKey(slot);
+    }
+
+    /// Attempts to insert a copy of `value`.
+    /// @return Nullopt if the slot map is full.
+    ///         Otherwise the key of the new element.
+    auto try_insert(T const& value) -> bb::Optional<SlotMapKey> {
+        return try_emplace(value);
+    }
+
+    /// Attempts to insert `value` by moving it into place.
+    /// @return Nullopt if the slot map is full.
+    ///         Otherwise the key of the new element.
+    auto try_insert(T&& value) -> bb::Optional<SlotMapKey> {
+        return try_emplace(std::move(value));
+    }
+
+    /// Returns the key that the next inserted element will receive.
+    /// @return Nullopt if the slot map is full.
+    auto next_free_key() const -> bb::Optional<SlotMapKey> {
+        if (full()) {
+            return bb::NULLOPT;
+        }
+        return SlotMapKey(m_free_list_head);
+    }
+
+    /// Attempts to retrieve the element stored under `key`.
+    /// @return Nullopt if `key` does not refer to an element.
+    ///         Otherwise a reference to the element.
+    auto get(SlotMapKey key) -> OptionalReference {
+        if (contains(key)) {
+            return *pointer_from_slot(key.value());
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the element stored under `key`.
+    /// @return Nullopt if `key` does not refer to an element.
+    ///         Otherwise a reference to the element.
+    auto get(SlotMapKey key) const -> OptionalConstReference {
+        if (contains(key)) {
+            return *pointer_from_slot(key.value());
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Checks whether `key` refers to an element.
+    auto contains(SlotMapKey key) const -> bool {
+        return key.value() < Capacity && m_is_occupied[key.value()];
+    }
+
+    /// Removes the element stored under `key`.
+    /// @return true if `key` referred to an element.
+    ///         false otherwise.
+    auto remove(SlotMapKey key) -> bool {
+        if (!contains(key)) {
+            return false;
+        }
+        release_slot(key.value());
+        return true;
+    }
+
+    /// Removes all elements from the slot map.
+    void clear() {
+        for (uint64_t slot = 0; slot < Capacity && !empty(); ++slot) {
+            if (m_is_occupied[slot]) {
+                release_slot(slot);
+            }
+        }
+    }
+
+    /// Calls `callback` with the key and a reference to every element in ascending key order.
+    template <typename F>
+    void for_each(F&& callback) {
+        for (uint64_t slot = 0; slot < Capacity; ++slot) {
+            if (m_is_occupied[slot]) {
+                callback(SlotMapKey(slot), *pointer_from_slot(slot));
+            }
+        }
+    }
+
+    /// Calls `callback` with the key and a reference to every element in ascending key order.
+    template <typename F>
+    void for_each(F&& callback) const {
+        for (uint64_t slot = 0; slot < Capacity; ++slot) {
+            if (m_is_occupied[slot]) {
+                callback(SlotMapKey(slot), *pointer_from_slot(slot));
+            }
+        }
+    }
+
+    /// Retrieves the static capacity of the slot map.
+    static constexpr auto capacity() noexcept -> SizeType {
+        return Capacity;
+    }
+
+    /// Retrieves the number of elements in the slot map.
+    auto size() const noexcept -> SizeType {
+        return m_size;
+    }
+
+    /// Checks whether the slot map is currently empty.
+    auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    /// Checks whether the slot map is currently full.
+    auto full() const noexcept -> bool {
+        return size() == Capacity;
+    }
+
+  private:
+    auto pointer_from_slot(uint64_t slot) -> T* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic), slot is always smaller than Capacity
+        return reinterpret_cast<T*>(&m_bytes[0]) + slot;
+    }
+
+    auto pointer_from_slot(uint64_t slot) const -> T const* {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic), slot is always smaller than Capacity
+        return reinterpret_cast<T const*>(&m_bytes[0]) + slot;
+    }
+
+    // @pre m_is_occupied[slot]
+    void release_slot(uint64_t slot) {
+        pointer_from_slot(slot)->~T();
+        m_is_occupied[slot] = false;
+        m_next_free[slot] = m_free_list_head;
+        m_free_list_head = slot;
+        --m_size;
+    }
+
+    void reset_free_list() {
+        for (uint64_t slot = 0; slot < Capacity; ++slot) {
+            m_next_free[slot] = slot + 1;
+            m_is_occupied[slot] = false;
+        }
+        m_free_list_head = 0;
+    }
+
+    // the keys of rhs stay valid, therefore, the free list is rebuilt in ascending slot order
+    // @pre empty()
+    template <typename Source, typename Construct>
+    void take_slots_from(Source& rhs, Construct construct) {
+        uint64_t* next_free_link = &m_free_list_head;
+        for (uint64_t slot = 0; slot < Capacity; ++slot) {
+            if (rhs.m_is_occupied[slot]) {
+                construct(pointer_from_slot(slot), *rhs.pointer_from_slot(slot));
+                m_is_occupied[slot] = true;
+            } else {
+                *next_free_link = slot;
+                next_free_link = &m_next_free[slot];
+            }
+        }
+        *next_free_link = END_OF_FREE_LIST;
+        m_size = rhs.m_size;
+    }
+
+    void copy_slots_from(StaticSlotMap const& rhs) {
+        take_slots_from(rhs, [](T* destination, T const& source) { new (destination) T(source); });
+    }
+
+    void move_slots_from(StaticSlotMap& rhs) {
+        take_slots_from(rhs, [](T* destination, T& source) { new (destination) T(std::move_if_noexcept(source)); });
+    }
+};
+
+template <typename>
+struct IsStaticSlotMap : std::false_type { };
+
+template <typename T, uint64_t N>
+struct IsStaticSlotMap<StaticSlotMap<T, N>> : std::true_type { };
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_STATIC_SLOT_MAP_HPP
@@ -14,6 +14,7 @@
 #define IOX2_INCLUDE_GUARD_BB_STATIC_STRING_HPP
 
 #include "iox2/bb/detail/attributes.hpp"
+#include "iox2/bb/detail/rust_layout.hpp"
 #include "iox2/bb/detail/string_internal.hpp"
 #include "iox2/bb/optional.hpp"
 #include "iox2/legacy/type_traits.hpp"
@@ -325,9 +326,13 @@ class StaticString {
 
             auto str_data = detail::get_data(str);
             auto str_size = detail::get_size(str);
+            if (str_size == 1) {
+                return m_parent->find_code_unit(str_data[0], pos);
+            }
+
+            detail::CodeUnitSet const code_units(str_data, str_size);
             for (auto position = pos; position < m_parent->m_size; ++position) {
-                auto found = memchr(str_data, m_parent->m_string[position], static_cast<size_t>(str_size));
-                if (found != nullptr) {
+                if (code_units.contains(m_parent->m_string[position])) {
                     return position;
                 }
             }
@@ -348,16 +353,13 @@ class StaticString {
             }
 
             auto position = std::min(static_cast<uint64_t>(pos), m_parent->m_size - 1);
-            auto str_data = detail::get_data(str);
-            auto str_size = detail::get_size(str);
+            detail::CodeUnitSet const code_units(detail::get_data(str), detail::get_size(str));
             for (; position > 0; --position) {
-                auto found = memchr(str_data, m_parent->m_string[position], str_size);
-                if (found != nullptr) {
+                if (code_units.contains(m_parent->m_string[position])) {
                     return position;
                 }
             }
-            auto found = memchr(str_data, m_parent->m_string[0], static_cast<size_t>(str_size));
-            if (found != nullptr) {
+            if (code_units.contains(m_parent->m_string[0])) {
                 return 0U;
             }
             return bb::NULLOPT;
@@ -584,6 +586,15 @@ class StaticString {
         return N;
     }
 
+    /// Returns true if the memory layout is identical to the one of the Rust
+    /// `iceoryx2_bb_container::string::StaticString<N>`, so that the string can be
+    /// used as payload for cross-language communication.
+    static constexpr auto has_rust_layout() noexcept -> bool {
+        constexpr detail::RustContainerLayout LAYOUT = detail::rust_static_string_layout(N);
+        return offsetof(StaticString, m_string) == 0 && offsetof(StaticString, m_size) == LAYOUT.offset_of_len
+               && sizeof(StaticString) == LAYOUT.size && alignof(StaticString) == LAYOUT.alignment;
+    }
+
     constexpr auto size() const noexcept -> SizeType {
         return m_size;
     }
@@ -669,6 +680,15 @@ class StaticString {
         return (character > 0) && (character <= CODE_UNIT_UPPER_BOUND);
     }
 
+    // @pre pos <= size()
+    auto find_code_unit(char character, SizeType pos) const -> bb::Optional<SizeType> {
+        auto found = memchr(&m_string[pos], character, static_cast<size_t>(m_size - pos));
+        if (found == nullptr) {
+            return bb::NULLOPT;
+        }
+        return static_cast<SizeType>(static_cast<char const*>(found) - &m_string[0]);
+    }
+
     auto compare(StaticString const& other) const -> int64_t {
         auto const other_size = other.size();
         auto const res = memcmp(&m_string[0], &other.m_string[0], std::min(m_size, static_cast<uint64_t>(other_size)));
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INCLUDE_GUARD_BB_STATIC_VARIANT_HPP
+#define IOX2_INCLUDE_GUARD_BB_STATIC_VARIANT_HPP
+
+#include "iox2/bb/detail/tagged_union.hpp"
+#include "iox2/bb/optional.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace iox2 {
+namespace bb {
+
+/// Selects the alternative of a `StaticVariant` that shall be constructed.
+template <uint64_t Index>
+struct InPlaceIndex { };
+
+/// A tagged union that always contains exactly one of the alternatives `Ts`. It is trivially
+/// copyable when all alternatives are trivially copyable.
+///
+/// The memory layout is equal to a Rust `#[repr(C, u8)]` enum with one tuple variant per
+/// alternative, declared in the same order, e.g. `StaticVariant<uint32_t, double>` is
+/// equal to `#[repr(C, u8)] enum E { A(u32), B(f64) }`. With more than 256 alternatives the
+/// tag becomes an `u16` (`#[repr(C, u16)]`). Therefore, it can be used in zero-copy payloads
+/// that are exchanged with Rust.
+template <typename... Ts>
+class StaticVariant : public detail::TaggedUnion<Ts...> {
+    static_assert(sizeof...(Ts) > 0, "StaticVariant requires at least one alternative.");
+    static_assert(!std::is_reference<typename detail::TypeAtIndex<0, Ts...>::Type>::value,
+                  "StaticVariant cannot hold references.");
+
+    using Base = detail::TaggedUnion<Ts...>;
+
+    template <typename T>
+    using EnableIfUniqueAlternative =
+        std::enable_if_t<detail::CountOfType<std::decay_t<T>, Ts...>::value == 1, bool>;
+
+  public:
+    template <uint64_t Index>
+    using AlternativeAt = typename detail::TypeAtIndex<Index, Ts...>::Type;
+
+    template <uint64_t Index>
+    using OptionalReferenceAt = bb::Optional<std::reference_wrapper<AlternativeAt<Index>>>;
+    template <uint64_t Index>
+    using OptionalConstReferenceAt = bb::Optional<std::reference_wrapper<AlternativeAt<Index> const>>;
+
+    /// The number of alternatives.
+    static constexpr uint64_t NUMBER_OF_ALTERNATIVES = sizeof...(Ts);
+
+    /// Default-constructs the first alternative.
+    template <typename First = AlternativeAt<0>,
+              std::enable_if_t<std::is_default_constructible<First>::value, bool> = true>
+    StaticVariant() noexcept(std::is_nothrow_default_constructible<First>::value) {
+        construct<0>();
+    }
+
+    /// Constructs the alternative at `Index` from the constructor arguments `args`.
+    template <uint64_t Index, typename... Args, std::enable_if_t<(Index < sizeof...(Ts)), bool> = true>
+    explicit StaticVariant(InPlaceIndex<Index> /* unused */, Args&&... args) {
+        construct<Index>(std::forward<Args>(args)...);
+    }
+
+    /// Constructs the alternative that has the type of `value`, which must occur exactly once in `Ts`.
+    template <typename T, EnableIfUniqueAlternative<T> = true>
+    // NOLINTNEXTLINE(hicpp-explicit-conversions,bugprone-forwarding-reference-overload) implicit like std::variant, the copy constructor is excluded since StaticVariant is not an alternative
+    StaticVariant(T&& value) {
+        construct<detail::IndexOfType<std::decay_t<T>, Ts...>::value>(std::forward<T>(value));
+    }
+
+    /// Returns the index of the contained alternative.
+    auto index() const noexcept -> uint64_t {
+        return this->m_tag;
+    }
+
+    /// Checks whether the contained alternative is of type `T`.
+    template <typename T, EnableIfUniqueAlternative<T> = true>
+    auto holds_alternative() const noexcept -> bool {
+        return index() == detail::IndexOfType<T, Ts...>::value;
+    }
+
+    /// Destroys the contained alternative and constructs the alternative at `Index` from `args`.
+    /// @return A reference to the new alternative.
+    template <uint64_t Index, typename... Args>
+    auto emplace_at_index(Args&&... args) -> AlternativeAt<Index>& {
+        static_assert(Index < sizeof...(Ts), "Index out of bounds.");
+        this->destroy();
+        return construct<Index>(std::forward<Args>(args)...);
+    }
+
+    /// Destroys the contained alternative and constructs the alternative of type `T` from `args`.
+    /// @return A reference to the new alternative.
+    template <typename T, typename... Args, EnableIfUniqueAlternative<T> = true>
+    auto emplace(Args&&... args) -> T& {
+        return emplace_at_index<detail::IndexOfType<T, Ts...>::value>(std::forward<Args>(args)...);
+    }
+
+    /// Attempts to retrieve the alternative at `Index`.
+    /// @return Nullopt if the contained alternative has a different index.
+    ///         Otherwise a reference to the alternative.
+    template <uint64_t Index>
+    auto get_at_index() -> OptionalReferenceAt<Index> {
+        static_assert(Index < sizeof...(Ts), "Index out of bounds.");
+        if (index() == Index) {
+            return *static_cast<AlternativeAt<Index>*>(this->storage());
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the alternative at `Index`.
+    /// @return Nullopt if the contained alternative has a different index.
+    ///         Otherwise a reference to the alternative.
+    template <uint64_t Index>
+    auto get_at_index() const -> OptionalConstReferenceAt<Index> {
+        static_assert(Index < sizeof...(Ts), "Index out of bounds.");
+        if (index() == Index) {
+            return *static_cast<const AlternativeAt<Index>*>(this->storage());
+        }
+        return bb::NULLOPT;
+    }
+
+    /// Attempts to retrieve the alternative of type `T`.
+    /// @return Nullopt if the contained alternative is of a different type.
+    ///         Otherwise a reference to the alternative.
+    template <typename T, EnableIfUniqueAlternative<T> = true>
+    auto get() -> bb::Optional<std::reference_wrapper<T>> {
+        return get_at_index<detail::IndexOfType<T, Ts...>::value>();
+    }
+
+    /// Attempts to retrieve the alternative of type `T`.
+    /// @return Nullopt if the contained alternative is of a different type.
+    ///         Otherwise a reference to the alternative.
+    template <typename T, EnableIfUniqueAlternative<T> = true>
+    auto get() const -> bb::Optional<std::reference_wrapper<T const>> {
+        return get_at_index<detail::IndexOfType<T, Ts...>::value>();
+    }
+
+    // comparison operators
+    friend auto operator==(StaticVariant const& lhs, StaticVariant const& rhs) -> bool {
+        return lhs.index() == rhs.index() && Base::Operations::equal(lhs.index(), lhs.storage(), rhs.storage());
+    }
+
+    friend auto operator!=(StaticVariant const& lhs, StaticVariant const& rhs) -> bool {
+        return !(lhs == rhs);
+    }
+
+  private:
+    // @pre the storage does not contain a constructed alternative
+    template <uint64_t Index, typename... Args>
+    auto construct(Args&&... args) -> AlternativeAt<Index>& {
+        auto* alternative = new (this->storage()) AlternativeAt<Index>(std::forward<Args>(args)...);
+        this->m_tag = static_cast<typename Base::TagType>(Index);
+        return *alternative;
+    }
+};
+
+template <typename>
+struct IsStaticVariant : std::false_type { };
+
+template <typename... Ts>
+struct IsStaticVariant<StaticVariant<Ts...>> : std::true_type { };
+
+} // namespace bb
+} // namespace iox2
+
+#endif // IOX2_INCLUDE_GUARD_BB_STATIC_VARIANT_HPP
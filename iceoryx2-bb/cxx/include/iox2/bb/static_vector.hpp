@@ -123,6 +123,50 @@ class StaticVector {
         }
     };
 
+    /// Mutable access to the unused storage behind the last element of a vector of trivial types.
+    /// Elements can be written directly into the storage, e.g. by memcpy or DMA, and are added
+    /// to the vector with `commit()` without being initialized first.
+    class UninitializedTail {
+        friend class StaticVector;
+
+      private:
+        StaticVector* m_parent;
+
+        constexpr explicit UninitializedTail(StaticVector& parent)
+            : m_parent(&parent) {
+        }
+
+      public:
+        ~UninitializedTail() = default;
+        UninitializedTail(UninitializedTail const&) = delete;
+        // NOTE: can be changed to '= delete' when C++17 becomes mandatory and we can rely on RVO
+        UninitializedTail(UninitializedTail&&) = default;
+        auto operator=(UninitializedTail const&) -> UninitializedTail& = delete;
+        auto operator=(UninitializedTail&&) -> UninitializedTail& = delete;
+
+        /// Pointer to the storage of the element behind the current last element.
+        constexpr auto data() noexcept -> Pointer {
+            return m_parent->m_storage.pointer_from_index(m_parent->size());
+        }
+
+        /// Number of elements that can be written to `data()`.
+        constexpr auto available() const noexcept -> SizeType {
+            return Capacity - m_parent->size();
+        }
+
+        /// Appends the first `count` elements that were written to `data()` to the vector.
+        /// @return true on success.
+        ///         false if `count` exceeds `available()`.
+        constexpr auto commit(SizeType count) -> bool {
+            if (count <= available()) {
+                m_parent->m_storage.resize_uninitialized(m_parent->size() + count);
+                return true;
+            } else {
+                return false;
+            }
+        }
+    };
+
   private:
     template <typename, uint64_t>
     friend class StaticVector;
@@ -158,6 +202,14 @@ class StaticVector {
     auto operator=(StaticVector const&) -> StaticVector& = default;
     auto operator=(StaticVector&&) -> StaticVector& = default;
 
+    /// Returns true if the memory layout is identical to the one of the Rust
+    /// `iceoryx2_bb_container::vector::StaticVec<T, Capacity>`, so that the vector can be
+    /// used as payload for cross-language communication.
+    static constexpr auto has_rust_layout() noexcept -> bool {
+        return StorageType::has_rust_static_vec_layout() && offsetof(StaticVector, m_storage) == 0
+               && sizeof(StaticVector) == sizeof(StorageType) && alignof(StaticVector) == alignof(StorageType);
+    }
+
     template <uint64_t N>
     static constexpr auto from_value(const T& value) -> StaticVector {
         static_assert(N <= Capacity, "Trying to initialize a StaticVector beyond its capacity!");
@@ -205,11 +257,8 @@ class StaticVector {
     static constexpr auto from_range_unchecked(Iter it_begin, Sentinel it_end) -> bb::Optional<StaticVector> {
         // we define ret here to encourage return-value-optimization
         bb::Optional<StaticVector> ret = StaticVector {};
-        for (auto it = it_begin; it != it_end; ++it) {
-            if (!ret->try_push_back(*it)) {
-                ret = bb::NULLOPT;
-                break;
-            }
+        if (!ret->try_append_range(it_begin, it_end)) {
+            ret = bb::NULLOPT;
         }
         return ret;
     }
@@ -330,15 +379,7 @@ class StaticVector {
                   bool> = true>
     constexpr auto try_insert_at_unchecked(SizeType index, Iter it_begin, Sentinel it_end) -> bool {
         if (index <= m_storage.size()) {
-            auto const old_size = size();
-            for (auto it = it_begin; it != it_end; ++it) {
-                if (!try_push_back(*it)) {
-                    m_storage.shrink_from_back(old_size);
-                    return false;
-                }
-            }
-            m_storage.rotate_from_back(index, old_size);
-            return true;
+            return insert_range_at(index, it_begin, it_end, IsPointerRange<Iter, Sentinel> {});
         } else {
             return false;
         }
@@ -352,6 +393,53 @@ class StaticVector {
         return try_insert_at_unchecked(index, init_list.begin(), init_list.end());
     }
 
+    /// Attempts to append the elements from the range [`it_begin`, `it_end`) at the back of the vector.
+    /// When the range is given as pointers and `T` is trivially copyable, all elements are copied at once.
+    /// Users must ensure that `it_end` is reachable from `it_begin` without causing undefined behaviour.
+    /// @return true on success.
+    ///         false if the operation would exceed the vector's capacity, the vector remains unchanged.
+    template <typename Iter,
+              typename Sentinel,
+              std::enable_if_t<
+                  std::is_constructible<T, decltype(*std::declval<Iter>())>::value
+                      && std::is_convertible<decltype(std::declval<Iter>() == std::declval<Sentinel>()), bool>::value,
+                  bool> = true>
+    constexpr auto try_append_range(Iter it_begin, Sentinel it_end) -> bool {
+        return insert_range_at(m_storage.size(), it_begin, it_end, IsPointerRange<Iter, Sentinel> {});
+    }
+
+    /// Changes the size of the vector to `count` without initializing added elements. The values of
+    /// added elements are indeterminate and must be written before they are read, e.g. by filling them
+    /// in place via `unchecked_access().data()`.
+    /// @return true on success.
+    ///         false if `count` exceeds the vector's capacity.
+    template <typename U = T, std::enable_if_t<std::is_trivial<U>::value, bool> = true>
+    constexpr auto resize_uninitialized(SizeType count) -> bool {
+        if (count <= Capacity) {
+            m_storage.resize_uninitialized(count);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    /// Changes the size of the vector to `count`. Added elements are default-initialized, which leaves
+    /// them uninitialized when `T` is a trivial type, removed elements are destroyed.
+    /// @return true on success.
+    ///         false if `count` exceeds the vector's capacity.
+    template <typename U = T, std::enable_if_t<std::is_default_constructible<U>::value, bool> = true>
+    constexpr auto resize_default_init(SizeType count) -> bool {
+        if (count > Capacity) {
+            return false;
+        }
+        if (count < m_storage.size()) {
+            m_storage.shrink_from_back(count);
+        } else {
+            m_storage.grow_default_initialized(count);
+        }
+        return true;
+    }
+
     /// Clears all elements from the vector.
     /// After this operation, the vector will be empty.
     constexpr void clear() {
@@ -477,6 +565,12 @@ class StaticVector {
         return UncheckedConstAccessor { *this };
     }
 
+    /// Access to the unused storage of the vector to append elements without initializing them first.
+    template <typename U = T, std::enable_if_t<std::is_trivial<U>::value, bool> = true>
+    auto uninitialized_tail() -> UninitializedTail {
+        return UninitializedTail { *this };
+    }
+
     // comparison operators
     friend auto operator==(StaticVector const& lhs, StaticVector const& rhs) -> bool {
         return std::equal(lhs.unchecked_access().begin(),
@@ -503,6 +597,49 @@ class StaticVector {
         ret.storage_metrics = m_storage.static_memory_layout_metrics();
         return ret;
     }
+
+  private:
+    template <typename Iter, typename Sentinel>
+    using IsPointerRange =
+        std::integral_constant<bool,
+                               std::is_pointer<Iter>::value && std::is_same<Iter, Sentinel>::value
+                                   && std::is_same<std::remove_cv_t<std::remove_pointer_t<Iter>>, T>::value>;
+
+    auto is_in_storage(T const* ptr) const -> bool {
+        std::less<T const*> const less;
+        return !less(ptr, m_storage.pointer_from_index(0)) && less(ptr, m_storage.pointer_from_index(Capacity));
+    }
+
+    // @pre index <= size()
+    template <typename Iter, typename Sentinel>
+    constexpr auto insert_range_at(SizeType index, Iter it_begin, Sentinel it_end, std::true_type /* is_pointer_range */)
+        -> bool {
+        auto const count = static_cast<SizeType>(it_end - it_begin);
+        if (m_storage.size() + count > Capacity) {
+            return false;
+        }
+        // elements of this vector are moved while inserting, therefore they must be copied one by one
+        if (count != 0 && is_in_storage(it_begin) && index != m_storage.size()) {
+            return insert_range_at(index, it_begin, it_end, std::false_type {});
+        }
+        m_storage.insert_range_at(index, it_begin, count);
+        return true;
+    }
+
+    // @pre index <= size()
+    template <typename Iter, typename Sentinel>
+    constexpr auto
+    insert_range_at(SizeType index, Iter it_begin, Sentinel it_end, std::false_type /* is_pointer_range */) -> bool {
+        auto const old_size = size();
+        for (auto it = it_begin; it != it_end; ++it) {
+            if (!try_push_back(*it)) {
+                m_storage.shrink_from_back(old_size);
+                return false;
+            }
+        }
+        m_storage.rotate_from_back(index, old_size);
+        return true;
+    }
 };
 
 template <typename>
@@ -28,6 +28,12 @@
 #include "iox2/legacy/log/building_blocks/console_logger.hpp"
 #include "iox2/legacy/log/building_blocks/logger.hpp"
 
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) compile time configuration which is set by the build system
+#ifndef IOX2_MIN_LOG_LEVEL
+#define IOX2_MIN_LOG_LEVEL Trace
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
 namespace iox2 {
 namespace legacy {
 namespace log {
@@ -42,9 +48,10 @@ using TestingLoggerBase = internal::Logger<ConsoleLogger>;
 static constexpr bool IGNORE_ACTIVE_LOG_LEVEL { false };
 
 /// @brief The minimal log level which will be compiled into the application. All log levels below this will be
-/// optimized out at compile time
+/// optimized out at compile time, including the evaluation of the logged data. It is set with the
+/// 'IOX2_MIN_LOG_LEVEL' define to one of the 'LogLevel' enumerators, e.g. '-DIOX2_MIN_LOG_LEVEL=Info'.
 /// @note This is different than IGNORE_ACTIVE_LOG_LEVEL since the active log level could still be set to off at runtime
-static constexpr LogLevel MINIMAL_LOG_LEVEL { LogLevel::Trace /* TODO: build::IOX2_MINIMAL_LOG_LEVEL */ };
+static constexpr LogLevel MINIMAL_LOG_LEVEL { LogLevel::IOX2_MIN_LOG_LEVEL };
 
 } // namespace log
 } // namespace legacy
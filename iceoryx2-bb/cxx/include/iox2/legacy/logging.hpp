@@ -21,6 +21,12 @@ namespace iox2 {
 namespace legacy {
 namespace log {
 namespace internal {
+/// @brief Returns true if log messages of the given log level are compiled into the application. Since it is a
+/// constant expression, the IOX2_LOG macro and the evaluation of its arguments are removed at compile time otherwise.
+constexpr auto is_log_level_compiled_in(LogLevel log_level) noexcept -> bool {
+    return log_level <= MINIMAL_LOG_LEVEL;
+}
+
 /// @brief Convenience function for the IOX2_LOG_INTERNAL macro
 inline auto is_log_level_active(LogLevel log_level) noexcept -> bool {
     // AXIVION Next Construct FaultDetection-DeadBranches this is a configurable compile time option to be able to
@@ -28,7 +34,7 @@ inline auto is_log_level_active(LogLevel log_level) noexcept -> bool {
     // AXIVION Next Construct AutosarC++19_03-M0.1.2 see justification for FaultDetection-DeadBranches
     // AXIVION Next Construct AutosarC++19_03-M0.1.9 see justification for FaultDetection-DeadBranches
     // AXIVION Next Construct AutosarC++19_03-M5.14.1 getLogLevel is a static method without side effects
-    return ((log_level) <= MINIMAL_LOG_LEVEL)
+    return is_log_level_compiled_in(log_level)
            && (IGNORE_ACTIVE_LOG_LEVEL || ((log_level) <= log::Logger::getLogLevel()));
 }
 } // namespace internal
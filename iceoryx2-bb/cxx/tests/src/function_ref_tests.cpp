@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/function_ref.hpp"
+#include "iox2/bb/static_function.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+using iox2::bb::FunctionRef;
+using iox2::bb::StaticFunction;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+class FunctionRefFixture : public DetectLeakedObservablesFixture { };
+
+static_assert(sizeof(FunctionRef<void()>) == 2 * sizeof(void*), "FunctionRef must consist of two pointers");
+static_assert(std::is_trivially_copyable<FunctionRef<int32_t(int32_t)>>::value,
+              "FunctionRef must be trivially copyable");
+
+auto call(FunctionRef<int32_t(int32_t)> callback, int32_t value) -> int32_t {
+    return callback(value);
+}
+
+auto free_function(int32_t value) -> int32_t {
+    return value + 1;
+}
+
+TEST(FunctionRef, invokes_lambda) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(call([](int32_t value) { return value * 2; }, 21), 42);
+}
+
+TEST(FunctionRef, invokes_free_function) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(call(free_function, 41), 42);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(call(&free_function, 41), 42);
+}
+
+TEST(FunctionRef, refers_to_the_state_of_the_callable) {
+    int32_t counter = 0;
+    auto increment = [&counter](int32_t value) {
+        counter += value;
+        return counter;
+    };
+
+    FunctionRef<int32_t(int32_t)> const sut(increment);
+    EXPECT_EQ(sut(1), 1);
+    EXPECT_EQ(sut(2), 3);
+    EXPECT_EQ(counter, 3);
+}
+
+TEST(FunctionRef, invokes_mutable_lambda_in_place) {
+    auto counting = [calls = 0](int32_t) mutable { return ++calls; };
+
+    EXPECT_EQ(call(counting, 0), 1);
+    EXPECT_EQ(call(counting, 0), 2);
+    EXPECT_EQ(counting(0), 3);
+}
+
+TEST(FunctionRef, invokes_static_function) {
+    StaticFunction<int32_t(int32_t)> const function([](int32_t value) { return value - 1; });
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(call(function, 43), 42);
+}
+
+TEST(FunctionRef, copy_refers_to_the_same_callable) {
+    int32_t calls = 0;
+    auto callable = [&calls]() { ++calls; };
+    FunctionRef<void()> const sut(callable);
+    FunctionRef<void()> const copy(sut);
+
+    sut();
+    copy();
+    EXPECT_EQ(calls, 2);
+}
+
+TEST_F(FunctionRefFixture, does_not_copy_or_move_the_callable) {
+    Observable observable { 1 };
+    auto callable = [observable](int32_t value) { return observable.id + value; };
+    auto const instances = Observable::s_counter.total_instances;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(call(callable, 41), 42);
+    EXPECT_EQ(Observable::s_counter.total_instances, instances);
+}
+
+TEST_F(FunctionRefFixture, forwards_reference_arguments_without_copy) {
+    Observable observable { 3 };
+    auto callable = [](Observable& value) { value.id = 4; };
+    auto const instances = Observable::s_counter.total_instances;
+
+    FunctionRef<void(Observable&)> const sut(callable);
+    sut(observable);
+    EXPECT_EQ(observable.id, 4);
+    EXPECT_EQ(Observable::s_counter.total_instances, instances);
+}
+} // namespace
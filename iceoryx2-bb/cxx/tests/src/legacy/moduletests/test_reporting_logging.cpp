@@ -83,4 +83,23 @@ TEST(LoggingLogLevelThreshold_test, LogLevel) {
     }
 }
 
+TEST(LoggingLogLevelThreshold_test, OnlyLogLevelsUpToTheMinimalLogLevelAreCompiledIn) {
+    ::testing::Test::RecordProperty("TEST_ID", "adea3a2e-370e-4e46-ae2c-be733b07729c");
+
+    // must be usable in a constant expression so that the log statements are removed at compile time
+    constexpr bool IS_OFF_COMPILED_IN =
+        iox2::legacy::log::internal::is_log_level_compiled_in(iox2::legacy::log::LogLevel::Off);
+    EXPECT_TRUE(IS_OFF_COMPILED_IN);
+
+    for (const auto logLevel : { iox2::legacy::log::LogLevel::Fatal,
+                                 iox2::legacy::log::LogLevel::Error,
+                                 iox2::legacy::log::LogLevel::Warn,
+                                 iox2::legacy::log::LogLevel::Info,
+                                 iox2::legacy::log::LogLevel::Debug,
+                                 iox2::legacy::log::LogLevel::Trace }) {
+        EXPECT_THAT(iox2::legacy::log::internal::is_log_level_compiled_in(logLevel),
+                    Eq(logLevel <= iox2::legacy::log::MINIMAL_LOG_LEVEL));
+    }
+}
+
 } // namespace
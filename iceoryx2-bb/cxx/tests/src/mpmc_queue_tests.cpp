@@ -0,0 +1,149 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/mpmc_queue.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+using iox2::bb::MpmcQueue;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+constexpr uint64_t CAPACITY = 4;
+
+class MpmcQueueFixture : public DetectLeakedObservablesFixture { };
+
+TEST(MpmcQueue, new_queue_is_empty) {
+    MpmcQueue<uint32_t, CAPACITY> const sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_TRUE(sut.has_space());
+    ASSERT_EQ(sut.size(), 0);
+    ASSERT_EQ(sut.capacity(), CAPACITY);
+}
+
+TEST(MpmcQueue, elements_are_popped_in_fifo_order) {
+    MpmcQueue<uint32_t, CAPACITY> sut;
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_push(i));
+        ASSERT_EQ(sut.size(), i + 1);
+    }
+    ASSERT_FALSE(sut.has_space());
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.pop().has_value());
+}
+
+TEST(MpmcQueue, push_into_full_queue_fails_and_leaves_value_untouched) {
+    MpmcQueue<std::unique_ptr<uint32_t>, CAPACITY> sut;
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_push(std::make_unique<uint32_t>(i)));
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    auto value = std::make_unique<uint32_t>(42);
+    ASSERT_FALSE(sut.try_push(std::move(value)));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved) value is not moved on failure
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 42);
+}
+
+TEST(MpmcQueue, queue_wraps_around) {
+    MpmcQueue<uint32_t, CAPACITY> sut;
+
+    constexpr uint32_t NUMBER_OF_ELEMENTS = CAPACITY * 5;
+    for (uint32_t i = 0; i < NUMBER_OF_ELEMENTS; ++i) {
+        ASSERT_TRUE(sut.try_emplace(i));
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+}
+
+TEST_F(MpmcQueueFixture, remaining_elements_are_destroyed_with_the_queue) {
+    {
+        MpmcQueue<Observable, CAPACITY> sut;
+        ASSERT_TRUE(sut.try_emplace());
+        ASSERT_TRUE(sut.try_push(Observable {}));
+        EXPECT_EQ(Observable::s_counter.total_instances, 2);
+    }
+    EXPECT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST_F(MpmcQueueFixture, pop_moves_the_element_out_of_the_queue) {
+    MpmcQueue<Observable, CAPACITY> sut;
+    ASSERT_TRUE(sut.try_emplace());
+
+    auto value = sut.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_GE(Observable::s_counter.was_move_constructed, 1);
+    EXPECT_EQ(Observable::s_counter.was_copy_constructed, 0);
+    EXPECT_EQ(Observable::s_counter.total_instances, 1);
+}
+
+TEST(MpmcQueue, every_element_is_received_exactly_once_with_concurrent_producers_and_consumers) {
+    constexpr uint64_t NUMBER_OF_THREADS = 4;
+    constexpr uint64_t ELEMENTS_PER_PRODUCER = 2500;
+    constexpr uint64_t NUMBER_OF_ELEMENTS = NUMBER_OF_THREADS * ELEMENTS_PER_PRODUCER;
+    MpmcQueue<uint64_t, CAPACITY> sut;
+    std::vector<std::atomic<uint32_t>> received(NUMBER_OF_ELEMENTS);
+    std::atomic<uint64_t> number_of_received { 0 };
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < NUMBER_OF_THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0; i < ELEMENTS_PER_PRODUCER;) {
+                if (sut.try_push(t * ELEMENTS_PER_PRODUCER + i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            while (number_of_received.load() < NUMBER_OF_ELEMENTS) {
+                auto value = sut.pop();
+                if (value.has_value()) {
+                    received[value.value()].fetch_add(1);
+                    number_of_received.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(sut.empty());
+    for (const auto& counter : received) {
+        ASSERT_EQ(counter.load(), 1);
+    }
+}
+} // namespace
@@ -50,6 +50,23 @@ TEST(PathAndFileVerifier, is_valid_file_name__correct_internal_ascii_aliases) {
     EXPECT_EQ(ASCII_UNDERSCORE, '_');
 }
 
+TEST(PathAndFileVerifier, path_entry_character_classification_is_correct) {
+    ::testing::Test::RecordProperty("TEST_ID", "27b93cc9-979a-4c93-a5a7-ec8b37e73adb");
+    constexpr int32_t NUMBER_OF_CODE_UNITS = 256;
+    for (int32_t i = 0; i < NUMBER_OF_CODE_UNITS; ++i) {
+        const auto character = static_cast<char>(i);
+        EXPECT_EQ(is_valid_path_entry_character(character), is_valid_file_character(character));
+        EXPECT_EQ(does_contain_only_path_entry_characters(&character, 1, PathSeparators::Reject),
+                  is_valid_file_character(character));
+        EXPECT_EQ(does_contain_only_path_entry_characters(&character, 1, PathSeparators::Accept),
+                  is_valid_file_character(character) || is_path_separator(character));
+    }
+    EXPECT_TRUE(is_path_separator('/'));
+    EXPECT_TRUE(does_contain_only_path_entry_characters("a/b", 3, PathSeparators::Accept));
+    EXPECT_FALSE(does_contain_only_path_entry_characters("a/b", 3, PathSeparators::Reject));
+    EXPECT_TRUE(does_contain_only_path_entry_characters("", 0, PathSeparators::Reject));
+}
+
 TEST(PathAndFileVerifier, is_valid_file_name__empty_name_is_invalid) {
     ::testing::Test::RecordProperty("TEST_ID", "b2b7aa63-c67e-4915-a906-e3b4779ab772");
     EXPECT_FALSE(is_valid_file_name(StaticString<FILE_PATH_LENGTH>()));
@@ -0,0 +1,118 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/relocatable_optional.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+namespace {
+using iox2::bb::RelocatableOptional;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+class RelocatableOptionalFixture : public DetectLeakedObservablesFixture { };
+
+static_assert(std::is_standard_layout<RelocatableOptional<uint64_t>>::value,
+              "RelocatableOptional must be standard layout");
+static_assert(std::is_trivially_copyable<RelocatableOptional<uint64_t>>::value,
+              "RelocatableOptional of a trivially copyable type must be trivially copyable");
+static_assert(!std::is_trivially_copyable<RelocatableOptional<Observable>>::value,
+              "RelocatableOptional of a non-trivial type must not be trivially copyable");
+
+// layout of the Rust RelocatableOption<T>: u8 tag followed by the value at the alignment of T
+static_assert(sizeof(RelocatableOptional<uint64_t>) == 16, "RelocatableOptional must match the Rust layout");
+static_assert(alignof(RelocatableOptional<uint64_t>) == 8, "RelocatableOptional must match the Rust layout");
+static_assert(sizeof(RelocatableOptional<uint16_t>) == 4, "RelocatableOptional must match the Rust layout");
+static_assert(sizeof(RelocatableOptional<uint8_t>) == 2, "RelocatableOptional must match the Rust layout");
+
+TEST(RelocatableOptional, default_constructor_initializes_to_empty) {
+    RelocatableOptional<int32_t> const sut;
+    ASSERT_FALSE(sut.has_value());
+    ASSERT_EQ(sut, iox2::bb::NULLOPT);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.value_or(12), 12);
+}
+
+TEST(RelocatableOptional, construction_from_value_contains_value) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    RelocatableOptional<int32_t> const sut(42);
+    ASSERT_TRUE(sut.has_value());
+    ASSERT_NE(sut, iox2::bb::NULLOPT);
+    EXPECT_EQ(*sut, 42);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.value_or(12), 42);
+}
+
+TEST(RelocatableOptional, tag_is_equal_to_rust_discriminant) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    RelocatableOptional<uint32_t> const some(77);
+    RelocatableOptional<uint32_t> const none;
+    EXPECT_EQ(*reinterpret_cast<const uint8_t*>(&some), 1); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_EQ(*reinterpret_cast<const uint8_t*>(&none), 0); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    EXPECT_EQ(*reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(&some) + 4), 77);
+}
+
+TEST(RelocatableOptional, emplace_and_reset_change_content) {
+    RelocatableOptional<int32_t> sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.emplace(5), 5);
+    ASSERT_TRUE(sut.has_value());
+
+    sut.reset();
+    ASSERT_FALSE(sut.has_value());
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    sut = 9;
+    EXPECT_EQ(sut.value(), 9);
+    sut = iox2::bb::NULLOPT;
+    ASSERT_FALSE(sut.has_value());
+}
+
+TEST(RelocatableOptional, to_optional_copies_content) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    RelocatableOptional<int32_t> const sut(3);
+    auto const converted = sut.to_optional();
+    ASSERT_TRUE(converted.has_value());
+    EXPECT_EQ(converted.value(), 3);
+    ASSERT_FALSE(RelocatableOptional<int32_t>().to_optional().has_value());
+}
+
+TEST_F(RelocatableOptionalFixture, copy_move_and_reset_handle_non_trivial_value) {
+    {
+        RelocatableOptional<Observable> source(Observable { 2 });
+        RelocatableOptional<Observable> const copy(source);
+        EXPECT_EQ(copy->id, 2);
+
+        RelocatableOptional<Observable> moved(std::move(source));
+        EXPECT_EQ(moved->id, 2);
+
+        moved.reset();
+        ASSERT_EQ(Observable::s_counter.total_instances, 2);
+
+        moved = copy;
+        EXPECT_EQ(moved->id, 2);
+    }
+    ASSERT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST(RelocatableOptional, stream_operator_prints_content) {
+    std::stringstream stream;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    stream << RelocatableOptional<int32_t>(5) << " " << RelocatableOptional<int32_t>();
+    EXPECT_EQ(stream.str(), "RelocatableOptional { value: 5 } RelocatableOptional { NULLOPT }");
+}
+} // namespace
@@ -15,7 +15,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <numeric>
+
+#if IOX2_CXX_STANDARD_VERSION >= 202002L
+#include <span>
+#endif
 
 namespace {
 using namespace ::testing;
@@ -123,4 +129,89 @@ TEST(SliceTest, can_iterate_const_immutable_slice) {
     ASSERT_EQ(iterations, SLICE_MAX_LENGTH);
 }
 
+TEST(SliceTest, size_and_empty_return_the_number_of_elements) {
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+
+    auto elements = std::array<DummyData, SLICE_MAX_LENGTH> {};
+
+    auto slice = ImmutableSlice<DummyData>(elements.data(), SLICE_MAX_LENGTH);
+    ASSERT_THAT(slice.size(), Eq(SLICE_MAX_LENGTH));
+    ASSERT_FALSE(slice.empty());
+
+    auto empty_slice = ImmutableSlice<DummyData>(elements.data(), 0);
+    ASSERT_THAT(empty_slice.size(), Eq(0));
+    ASSERT_TRUE(empty_slice.empty());
+}
+
+TEST(SliceTest, subspan_refers_to_the_requested_elements) {
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+    constexpr uint64_t OFFSET = 3;
+    constexpr uint64_t COUNT = 4;
+
+    auto elements = std::array<uint64_t, SLICE_MAX_LENGTH> {};
+    std::iota(elements.begin(), elements.end(), 0);
+
+    auto slice = MutableSlice<uint64_t>(elements.data(), SLICE_MAX_LENGTH);
+    auto sut = slice.subspan(OFFSET, COUNT);
+    ASSERT_THAT(sut.size(), Eq(COUNT));
+    ASSERT_THAT(sut.data(), Eq(elements.data() + OFFSET));
+
+    auto tail = slice.subspan(OFFSET);
+    ASSERT_THAT(tail.size(), Eq(SLICE_MAX_LENGTH - OFFSET));
+    ASSERT_THAT(tail.data(), Eq(elements.data() + OFFSET));
+
+    auto empty_tail = slice.subspan(SLICE_MAX_LENGTH);
+    ASSERT_TRUE(empty_tail.empty());
+}
+
+TEST(SliceTest, subspan_of_const_slice_is_immutable) {
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+
+    auto elements = std::array<DummyData, SLICE_MAX_LENGTH> {};
+
+    const auto slice = MutableSlice<DummyData>(elements.data(), SLICE_MAX_LENGTH);
+    auto sut = slice.subspan(1, 2);
+    ASSERT_TRUE(std::is_const<std::remove_pointer_t<decltype(sut.begin())>>::value);
+    ASSERT_TRUE(std::is_const<std::remove_pointer_t<decltype(sut.data())>>::value);
+
+    auto mutable_slice = MutableSlice<DummyData>(elements.data(), SLICE_MAX_LENGTH);
+    auto mutable_sut = mutable_slice.subspan(1, 2);
+    ASSERT_FALSE(std::is_const<std::remove_pointer_t<decltype(mutable_sut.begin())>>::value);
+}
+
+TEST(SliceTest, works_with_random_access_algorithms) {
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+
+    auto elements = std::array<uint64_t, SLICE_MAX_LENGTH> {};
+    std::iota(elements.rbegin(), elements.rend(), 0);
+
+    auto slice = MutableSlice<uint64_t>(elements.data(), SLICE_MAX_LENGTH);
+    std::sort(slice.begin(), slice.end());
+    ASSERT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+
+    auto immutable_slice = ImmutableSlice<uint64_t>(elements.data(), SLICE_MAX_LENGTH);
+    auto sum = std::accumulate(immutable_slice.begin(), immutable_slice.end(), uint64_t { 0 });
+    ASSERT_THAT(sum, Eq(SLICE_MAX_LENGTH * (SLICE_MAX_LENGTH - 1) / 2));
+}
+
+#if IOX2_CXX_STANDARD_VERSION >= 202002L
+TEST(SliceTest, can_be_converted_into_span) {
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+
+    auto elements = std::array<uint64_t, SLICE_MAX_LENGTH> {};
+
+    auto slice = MutableSlice<uint64_t>(elements.data(), SLICE_MAX_LENGTH);
+    std::span<uint64_t> mutable_span = slice;
+    ASSERT_THAT(mutable_span.data(), Eq(elements.data()));
+    ASSERT_THAT(mutable_span.size(), Eq(SLICE_MAX_LENGTH));
+
+    std::span<const uint64_t> immutable_span = ImmutableSlice<uint64_t>(elements.data(), SLICE_MAX_LENGTH);
+    ASSERT_THAT(immutable_span.data(), Eq(elements.data()));
+    ASSERT_THAT(immutable_span.size(), Eq(SLICE_MAX_LENGTH));
+
+    static_assert(std::ranges::contiguous_range<ImmutableSlice<uint64_t>>);
+    static_assert(std::ranges::borrowed_range<ImmutableSlice<uint64_t>>);
+}
+#endif
+
 } // namespace
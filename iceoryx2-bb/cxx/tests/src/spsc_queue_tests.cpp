@@ -0,0 +1,177 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/spsc_queue.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace {
+using iox2::bb::SpscQueue;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+constexpr uint64_t CAPACITY = 4;
+
+class SpscQueueFixture : public DetectLeakedObservablesFixture { };
+
+TEST(SpscQueue, new_queue_is_empty) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.full());
+    ASSERT_EQ(sut.size(), 0);
+    ASSERT_EQ(sut.capacity(), CAPACITY);
+}
+
+TEST(SpscQueue, producer_and_consumer_can_be_acquired_only_once) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    {
+        auto producer = sut.acquire_producer();
+        auto consumer = sut.acquire_consumer();
+        ASSERT_TRUE(producer.has_value());
+        ASSERT_TRUE(consumer.has_value());
+        ASSERT_FALSE(sut.acquire_producer().has_value());
+        ASSERT_FALSE(sut.acquire_consumer().has_value());
+    }
+    ASSERT_TRUE(sut.acquire_producer().has_value());
+    ASSERT_TRUE(sut.acquire_consumer().has_value());
+}
+
+TEST(SpscQueue, moved_from_producer_does_not_release_the_producer) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    auto producer = sut.acquire_producer();
+    {
+        auto moved_producer = std::move(producer.value());
+        ASSERT_FALSE(sut.acquire_producer().has_value());
+    }
+    ASSERT_TRUE(sut.acquire_producer().has_value());
+}
+
+TEST(SpscQueue, elements_are_popped_in_fifo_order) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    auto producer = sut.acquire_producer();
+    auto consumer = sut.acquire_consumer();
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        ASSERT_TRUE(producer->try_push(i));
+    }
+    ASSERT_TRUE(sut.full());
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        auto value = consumer->pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(consumer->pop().has_value());
+}
+
+TEST(SpscQueue, push_into_full_queue_fails_and_leaves_value_untouched) {
+    SpscQueue<std::unique_ptr<uint32_t>, CAPACITY> sut;
+    auto producer = sut.acquire_producer();
+
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        ASSERT_TRUE(producer->try_push(std::make_unique<uint32_t>(i)));
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    auto value = std::make_unique<uint32_t>(42);
+    ASSERT_FALSE(producer->try_push(std::move(value)));
+    // NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved) value is not moved on failure
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 42);
+}
+
+TEST(SpscQueue, queue_wraps_around) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    auto producer = sut.acquire_producer();
+    auto consumer = sut.acquire_consumer();
+
+    constexpr uint32_t NUMBER_OF_ELEMENTS = CAPACITY * 5;
+    for (uint32_t i = 0; i < NUMBER_OF_ELEMENTS; ++i) {
+        ASSERT_TRUE(producer->try_emplace(i));
+        auto value = consumer->pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value.value(), i);
+    }
+}
+
+TEST_F(SpscQueueFixture, remaining_elements_are_destroyed_with_the_queue) {
+    {
+        SpscQueue<Observable, CAPACITY> sut;
+        auto producer = sut.acquire_producer();
+        ASSERT_TRUE(producer->try_emplace());
+        ASSERT_TRUE(producer->try_push(Observable {}));
+        EXPECT_EQ(Observable::s_counter.total_instances, 2);
+    }
+    EXPECT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST(SpscQueue, move_assigned_producer_releases_the_previous_producer) {
+    SpscQueue<uint32_t, CAPACITY> sut;
+    SpscQueue<uint32_t, CAPACITY> other;
+    auto producer = sut.acquire_producer();
+    auto other_producer = other.acquire_producer();
+
+    producer.value() = std::move(other_producer.value());
+    ASSERT_TRUE(sut.acquire_producer().has_value());
+    ASSERT_FALSE(other.acquire_producer().has_value());
+}
+
+TEST_F(SpscQueueFixture, pop_moves_the_element_out_of_the_queue) {
+    SpscQueue<Observable, CAPACITY> sut;
+    auto producer = sut.acquire_producer();
+    auto consumer = sut.acquire_consumer();
+    ASSERT_TRUE(producer->try_emplace());
+
+    auto value = consumer->pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_GE(Observable::s_counter.was_move_constructed, 1);
+    EXPECT_EQ(Observable::s_counter.was_copy_constructed, 0);
+    EXPECT_EQ(Observable::s_counter.total_instances, 1);
+}
+
+TEST(SpscQueue, elements_are_transferred_between_threads_in_fifo_order) {
+    constexpr uint64_t NUMBER_OF_ELEMENTS = 10000;
+    SpscQueue<uint64_t, CAPACITY> sut;
+
+    std::thread producer_thread([&] {
+        auto producer = sut.acquire_producer();
+        for (uint64_t i = 0; i < NUMBER_OF_ELEMENTS;) {
+            if (producer->try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto consumer = sut.acquire_consumer();
+    for (uint64_t i = 0; i < NUMBER_OF_ELEMENTS;) {
+        auto value = consumer->pop();
+        if (value.has_value()) {
+            ASSERT_EQ(value.value(), i);
+            ++i;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer_thread.join();
+    ASSERT_TRUE(sut.empty());
+}
+} // namespace
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/static_flat_map.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+constexpr uint64_t const G_CAPACITY = 16;
+
+using Sut = iox2::bb::StaticFlatMap<uint64_t, int32_t, G_CAPACITY>;
+
+class StaticFlatMapFixture : public DetectLeakedObservablesFixture { };
+
+// all keys collide in the same home slot and form a single probe sequence
+struct CollidingHash {
+    auto operator()(uint64_t) const -> size_t {
+        return 0;
+    }
+};
+
+static_assert(std::is_standard_layout<Sut>::value, "StaticFlatMap must be standard layout");
+
+TEST(StaticFlatMap, default_constructor_initializes_to_empty) {
+    Sut const sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.full());
+    ASSERT_EQ(sut.size(), 0);
+    ASSERT_EQ(sut.capacity(), G_CAPACITY);
+    ASSERT_FALSE(sut.contains(0));
+}
+
+TEST(StaticFlatMap, inserted_values_can_be_retrieved) {
+    Sut sut;
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_insert(i * 3, static_cast<int32_t>(i)));
+    }
+    ASSERT_TRUE(sut.full());
+
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        auto value = sut.get(i * 3);
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(value->get(), static_cast<int32_t>(i));
+        EXPECT_FALSE(sut.contains((i * 3) + 1));
+    }
+}
+
+TEST(StaticFlatMap, try_insert_fails_when_key_exists) {
+    Sut sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    ASSERT_TRUE(sut.try_insert(7, 1));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    ASSERT_FALSE(sut.try_insert(7, 2));
+    ASSERT_EQ(sut.size(), 1);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.get(7)->get(), 1);
+}
+
+TEST(StaticFlatMap, try_insert_fails_when_full) {
+    Sut sut;
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_insert(i, 0));
+    }
+    ASSERT_FALSE(sut.try_insert(G_CAPACITY, 0));
+    ASSERT_EQ(sut.size(), G_CAPACITY);
+}
+
+TEST(StaticFlatMap, values_can_be_modified_through_get) {
+    Sut sut;
+    ASSERT_TRUE(sut.try_insert(1, 1));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    sut.get(1)->get() = 42;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(static_cast<Sut const&>(sut).get(1)->get(), 42);
+}
+
+TEST(StaticFlatMap, remove_keeps_colliding_keys_reachable) {
+    iox2::bb::StaticFlatMap<uint64_t, int32_t, G_CAPACITY, CollidingHash> sut;
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_insert(i, static_cast<int32_t>(i)));
+    }
+
+    for (uint64_t i = 0; i < G_CAPACITY; i += 2) {
+        ASSERT_TRUE(sut.remove(i));
+        ASSERT_FALSE(sut.remove(i));
+    }
+    ASSERT_EQ(sut.size(), G_CAPACITY / 2);
+
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        EXPECT_EQ(sut.contains(i), i % 2 == 1);
+    }
+}
+
+TEST(StaticFlatMap, repeated_insert_and_remove_does_not_exhaust_the_map) {
+    Sut sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    for (uint64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(sut.try_insert(i, static_cast<int32_t>(i)));
+        if (sut.full()) {
+            ASSERT_TRUE(sut.remove(i - (G_CAPACITY - 1)));
+        }
+    }
+    ASSERT_EQ(sut.size(), G_CAPACITY - 1);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.get(999)->get(), 999);
+}
+
+TEST(StaticFlatMap, for_each_visits_every_element) {
+    Sut sut;
+    uint64_t key_sum = 0;
+    for (uint64_t i = 1; i <= G_CAPACITY; ++i) {
+        ASSERT_TRUE(sut.try_insert(i, static_cast<int32_t>(i)));
+        key_sum += i;
+    }
+
+    uint64_t visited_key_sum = 0;
+    sut.for_each([&](uint64_t const& key, int32_t& value) {
+        EXPECT_EQ(static_cast<uint64_t>(value), key);
+        visited_key_sum += key;
+    });
+    EXPECT_EQ(visited_key_sum, key_sum);
+}
+
+TEST(StaticFlatMap, copy_constructor_copies_content) {
+    Sut src;
+    ASSERT_TRUE(src.try_insert(1, 2));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    ASSERT_TRUE(src.try_insert(3, 4));
+
+    Sut const sut(src);
+    ASSERT_EQ(sut.size(), 2);
+    EXPECT_EQ(sut.get(1)->get(), 2);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    EXPECT_EQ(sut.get(3)->get(), 4);
+}
+
+TEST_F(StaticFlatMapFixture, destructor_remove_and_clear_destroy_all_elements) {
+    {
+        iox2::bb::StaticFlatMap<uint64_t, Observable, G_CAPACITY> sut;
+        for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+            ASSERT_TRUE(sut.try_emplace(i, static_cast<int32_t>(i)));
+        }
+        ASSERT_TRUE(sut.remove(0));
+        ASSERT_EQ(Observable::s_counter.total_instances, static_cast<int32_t>(G_CAPACITY - 1));
+
+        sut.clear();
+        ASSERT_TRUE(sut.empty());
+        ASSERT_EQ(Observable::s_counter.total_instances, 0);
+
+        ASSERT_TRUE(sut.try_emplace(1, 1));
+        ASSERT_TRUE(sut.try_emplace(2, 2));
+    }
+    ASSERT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST_F(StaticFlatMapFixture, move_constructor_moves_elements) {
+    iox2::bb::StaticFlatMap<uint64_t, Observable, G_CAPACITY> src;
+    ASSERT_TRUE(src.try_emplace(1, 1));
+    ASSERT_TRUE(src.try_emplace(2, 2));
+    Observable::s_counter.was_move_constructed = 0;
+
+    iox2::bb::StaticFlatMap<uint64_t, Observable, G_CAPACITY> const sut(std::move(src));
+    ASSERT_EQ(sut.size(), 2);
+    EXPECT_EQ(Observable::s_counter.was_move_constructed, 2);
+    EXPECT_EQ(sut.get(1)->get().id, 1);
+    EXPECT_EQ(sut.get(2)->get().id, 2);
+}
+} // namespace
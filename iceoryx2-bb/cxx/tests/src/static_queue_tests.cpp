@@ -0,0 +1,199 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/static_queue.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+namespace {
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+constexpr uint64_t const G_CAPACITY = 5;
+
+class StaticQueueFixture : public DetectLeakedObservablesFixture { };
+
+static_assert(std::is_standard_layout<iox2::bb::StaticQueue<int32_t, G_CAPACITY>>::value,
+              "StaticQueue must be standard layout");
+
+// layout of the Rust FixedSizeQueue<i32, 5>: 40 bytes state followed by the data
+static_assert(sizeof(iox2::bb::StaticQueue<int32_t, G_CAPACITY>) == 64, "StaticQueue must match the Rust layout");
+static_assert(alignof(iox2::bb::StaticQueue<int32_t, G_CAPACITY>) == 8, "StaticQueue must match the Rust layout");
+static_assert(sizeof(iox2::bb::StaticQueue<uint8_t, 1>) == 48, "StaticQueue must match the Rust layout");
+
+TEST(StaticQueue, default_constructor_initializes_to_empty) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> const sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.full());
+    ASSERT_EQ(sut.size(), 0);
+    ASSERT_EQ(sut.capacity(), G_CAPACITY);
+}
+
+TEST(StaticQueue, pop_returns_elements_in_fifo_order) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        ASSERT_TRUE(sut.try_push(i));
+    }
+    ASSERT_TRUE(sut.full());
+
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        auto value = sut.pop();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, i);
+    }
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.pop().has_value());
+}
+
+TEST(StaticQueue, try_push_fails_when_full) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        ASSERT_TRUE(sut.try_emplace(i));
+    }
+
+    ASSERT_FALSE(sut.try_push(1));
+    ASSERT_EQ(sut.size(), G_CAPACITY);
+    EXPECT_EQ(sut.front_element()->get(), 0);
+}
+
+TEST(StaticQueue, push_with_overflow_removes_oldest_element) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        ASSERT_FALSE(sut.push_with_overflow(i).has_value());
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    auto overflow = sut.push_with_overflow(42);
+    ASSERT_TRUE(overflow.has_value());
+    EXPECT_EQ(*overflow, 0);
+    ASSERT_EQ(sut.size(), G_CAPACITY);
+    EXPECT_EQ(sut.front_element()->get(), 1);
+    EXPECT_EQ(sut.back_element()->get(), 42);
+}
+
+TEST(StaticQueue, element_at_is_relative_to_the_oldest_element) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    for (int32_t i = 0; i < 8; ++i) {
+        IOX2_DISCARD_RESULT(sut.push_with_overflow(i));
+    }
+
+    for (uint64_t i = 0; i < G_CAPACITY; ++i) {
+        EXPECT_EQ(sut.element_at(i)->get(), static_cast<int32_t>(i + 3));
+    }
+    ASSERT_FALSE(sut.element_at(G_CAPACITY).has_value());
+}
+
+TEST(StaticQueue, as_slices_returns_single_slice_when_content_does_not_wrap) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    ASSERT_TRUE(sut.try_push(1));
+    ASSERT_TRUE(sut.try_push(2));
+
+    auto const slices = static_cast<iox2::bb::StaticQueue<int32_t, G_CAPACITY> const&>(sut).as_slices();
+    ASSERT_EQ(slices.first.size(), 2);
+    EXPECT_EQ(slices.first[0], 1);
+    EXPECT_EQ(slices.first[1], 2);
+    ASSERT_TRUE(slices.second.empty());
+}
+
+TEST(StaticQueue, as_slices_returns_two_slices_when_content_wraps) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    for (int32_t i = 0; i < 7; ++i) {
+        IOX2_DISCARD_RESULT(sut.push_with_overflow(i));
+    }
+
+    auto slices = sut.as_slices();
+    ASSERT_EQ(slices.first.size() + slices.second.size(), G_CAPACITY);
+    ASSERT_EQ(slices.first.size(), 3);
+    EXPECT_EQ(slices.first[0], 2);
+    EXPECT_EQ(slices.first[2], 4);
+    ASSERT_EQ(slices.second.size(), 2);
+    EXPECT_EQ(slices.second[0], 5);
+    EXPECT_EQ(slices.second[1], 6);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    slices.second[1] = 73;
+    EXPECT_EQ(sut.back_element()->get(), 73);
+}
+
+TEST(StaticQueue, copy_constructor_copies_content_in_order) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> src;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    for (int32_t i = 0; i < 7; ++i) {
+        IOX2_DISCARD_RESULT(src.push_with_overflow(i));
+    }
+
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> const sut(src);
+    ASSERT_EQ(sut, src);
+    ASSERT_FALSE(sut != src);
+}
+
+TEST(StaticQueue, copy_assignment_replaces_content) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> src;
+    ASSERT_TRUE(src.try_push(1));
+    ASSERT_TRUE(src.try_push(2));
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    ASSERT_TRUE(sut.try_push(99));
+
+    sut = src;
+    ASSERT_EQ(sut, src);
+}
+
+TEST_F(StaticQueueFixture, destructor_and_clear_destroy_all_elements) {
+    {
+        iox2::bb::StaticQueue<Observable, G_CAPACITY> sut;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        for (int32_t i = 0; i < 7; ++i) {
+            IOX2_DISCARD_RESULT(sut.push_with_overflow(Observable { i }));
+        }
+        sut.clear();
+        ASSERT_TRUE(sut.empty());
+        ASSERT_EQ(Observable::s_counter.total_instances, 0);
+
+        ASSERT_TRUE(sut.try_emplace(1));
+        ASSERT_TRUE(sut.try_emplace(2));
+    }
+    ASSERT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST_F(StaticQueueFixture, move_constructor_moves_elements) {
+    iox2::bb::StaticQueue<Observable, G_CAPACITY> src;
+    ASSERT_TRUE(src.try_emplace(1));
+    ASSERT_TRUE(src.try_emplace(2));
+    Observable::s_counter.was_move_constructed = 0;
+
+    iox2::bb::StaticQueue<Observable, G_CAPACITY> const sut(std::move(src));
+    ASSERT_EQ(sut.size(), 2);
+    EXPECT_EQ(Observable::s_counter.was_move_constructed, 2);
+    EXPECT_EQ(sut.front_element()->get().id, 1);
+    EXPECT_EQ(sut.back_element()->get().id, 2);
+}
+
+TEST(StaticQueue, stream_operator_prints_elements_from_oldest_to_newest) {
+    iox2::bb::StaticQueue<int32_t, G_CAPACITY> sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    for (int32_t i = 0; i < 6; ++i) {
+        IOX2_DISCARD_RESULT(sut.push_with_overflow(i));
+    }
+
+    std::stringstream stream;
+    stream << sut;
+    EXPECT_EQ(stream.str(), "StaticQueue::<5> { m_size: 5, m_data: [ 1, 2, 3, 4, 5 ] }");
+}
+} // namespace
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/static_slot_map.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+using iox2::bb::SlotMapKey;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+constexpr uint64_t const G_CAPACITY = 8;
+
+using Sut = iox2::bb::StaticSlotMap<int32_t, G_CAPACITY>;
+
+class StaticSlotMapFixture : public DetectLeakedObservablesFixture { };
+
+static_assert(std::is_standard_layout<Sut>::value, "StaticSlotMap must be standard layout");
+
+TEST(StaticSlotMap, default_constructor_initializes_to_empty) {
+    Sut const sut;
+    ASSERT_TRUE(sut.empty());
+    ASSERT_FALSE(sut.full());
+    ASSERT_EQ(sut.size(), 0);
+    ASSERT_EQ(sut.capacity(), G_CAPACITY);
+    ASSERT_FALSE(sut.contains(SlotMapKey(0)));
+}
+
+TEST(StaticSlotMap, inserted_elements_can_be_retrieved_by_key) {
+    Sut sut;
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        auto key = sut.try_insert(i);
+        ASSERT_TRUE(key.has_value());
+        EXPECT_EQ(sut.get(*key)->get(), i);
+    }
+    ASSERT_TRUE(sut.full());
+    ASSERT_FALSE(sut.try_insert(0).has_value());
+    ASSERT_FALSE(sut.next_free_key().has_value());
+}
+
+TEST(StaticSlotMap, next_free_key_is_the_key_of_the_next_insert) {
+    Sut sut;
+    auto next_key = sut.next_free_key();
+    ASSERT_TRUE(next_key.has_value());
+    auto key = sut.try_insert(1);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(*key, *next_key);
+}
+
+TEST(StaticSlotMap, removed_key_becomes_invalid_and_is_reused) {
+    Sut sut;
+    auto first = sut.try_insert(1);
+    auto second = sut.try_insert(2);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+
+    ASSERT_TRUE(sut.remove(*first));
+    ASSERT_FALSE(sut.remove(*first));
+    ASSERT_FALSE(sut.get(*first).has_value());
+    EXPECT_EQ(sut.get(*second)->get(), 2);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    auto third = sut.try_insert(3);
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(*third, *first);
+}
+
+TEST(StaticSlotMap, out_of_range_key_is_not_contained) {
+    Sut sut;
+    ASSERT_TRUE(sut.try_insert(1).has_value());
+    ASSERT_FALSE(sut.contains(SlotMapKey(G_CAPACITY)));
+    ASSERT_FALSE(sut.remove(SlotMapKey(G_CAPACITY)));
+}
+
+TEST(StaticSlotMap, for_each_visits_elements_in_ascending_key_order) {
+    Sut sut;
+    for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+        ASSERT_TRUE(sut.try_insert(i).has_value());
+    }
+    ASSERT_TRUE(sut.remove(SlotMapKey(1)));
+
+    uint64_t visited = 0;
+    uint64_t previous_key = 0;
+    sut.for_each([&](SlotMapKey key, int32_t& value) {
+        EXPECT_EQ(static_cast<uint64_t>(value), key.value());
+        if (visited != 0) {
+            EXPECT_GT(key.value(), previous_key);
+        }
+        previous_key = key.value();
+        ++visited;
+    });
+    EXPECT_EQ(visited, G_CAPACITY - 1);
+}
+
+TEST(StaticSlotMap, copy_preserves_keys_and_free_slots) {
+    Sut src;
+    auto first = src.try_insert(1);
+    auto second = src.try_insert(2);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    ASSERT_TRUE(src.remove(*first));
+
+    Sut sut(src);
+    ASSERT_EQ(sut.size(), 1);
+    EXPECT_EQ(sut.get(*second)->get(), 2);
+    for (uint64_t i = 0; i < G_CAPACITY - 1; ++i) {
+        ASSERT_TRUE(sut.try_insert(0).has_value());
+    }
+    ASSERT_TRUE(sut.full());
+    EXPECT_EQ(sut.get(*second)->get(), 2);
+}
+
+TEST_F(StaticSlotMapFixture, destructor_remove_and_clear_destroy_all_elements) {
+    {
+        iox2::bb::StaticSlotMap<Observable, G_CAPACITY> sut;
+        for (int32_t i = 0; i < static_cast<int32_t>(G_CAPACITY); ++i) {
+            ASSERT_TRUE(sut.try_emplace(i).has_value());
+        }
+        ASSERT_TRUE(sut.remove(SlotMapKey(0)));
+        ASSERT_EQ(Observable::s_counter.total_instances, static_cast<int32_t>(G_CAPACITY - 1));
+
+        sut.clear();
+        ASSERT_TRUE(sut.empty());
+        ASSERT_EQ(Observable::s_counter.total_instances, 0);
+
+        ASSERT_TRUE(sut.try_emplace(1).has_value());
+    }
+    ASSERT_EQ(Observable::s_counter.total_instances, 0);
+}
+
+TEST_F(StaticSlotMapFixture, move_constructor_moves_elements) {
+    iox2::bb::StaticSlotMap<Observable, G_CAPACITY> src;
+    auto key = src.try_emplace(1);
+    ASSERT_TRUE(key.has_value());
+    Observable::s_counter.was_move_constructed = 0;
+
+    iox2::bb::StaticSlotMap<Observable, G_CAPACITY> const sut(std::move(src));
+    ASSERT_EQ(sut.size(), 1);
+    EXPECT_EQ(Observable::s_counter.was_move_constructed, 1);
+    EXPECT_EQ(sut.get(*key)->get().id, 1);
+}
+} // namespace
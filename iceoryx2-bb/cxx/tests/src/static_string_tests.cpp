@@ -25,6 +25,12 @@ namespace {
 template <class...>
 using DetectT = void;
 
+// the layout must match iceoryx2_bb_container::string::StaticString to be usable as cross-language payload
+static_assert(iox2::bb::StaticString<1>::has_rust_layout(), "StaticString must have the Rust layout");
+static_assert(iox2::bb::StaticString<7>::has_rust_layout(), "StaticString must have the Rust layout");
+static_assert(iox2::bb::StaticString<8>::has_rust_layout(), "StaticString must have the Rust layout");
+static_assert(iox2::bb::StaticString<64>::has_rust_layout(), "StaticString must have the Rust layout");
+
 template <uint64_t N>
 inline auto free_space_is_all_zeroes(iox2::bb::StaticString<N> const& str) -> bool {
     using DifferenceType = typename iox2::bb::StaticString<N>::DifferenceType;
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/static_variant.hpp"
+
+#include "testing/observable.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+using iox2::bb::InPlaceIndex;
+using iox2::bb::StaticVariant;
+using iox2::bb::testing::DetectLeakedObservablesFixture;
+using iox2::bb::testing::Observable;
+
+class StaticVariantFixture : public DetectLeakedObservablesFixture { };
+
+using TrivialVariant = StaticVariant<uint8_t, uint64_t, int32_t>;
+
+static_assert(std::is_standard_layout<TrivialVariant>::value, "StaticVariant must be standard layout");
+static_assert(std::is_trivially_copyable<TrivialVariant>::value,
+              "StaticVariant of trivially copyable alternatives must be trivially copyable");
+static_assert(!std::is_trivially_copyable<StaticVariant<int32_t, Observable>>::value,
+              "StaticVariant with a non-trivial alternative must not be trivially copyable");
+
+// layout of the Rust #[repr(C, u8)] enum { A(u8), B(u64), C(i32) }: u8 tag followed by the union at offset 8
+static_assert(sizeof(TrivialVariant) == 16, "StaticVariant must match the Rust layout");
+static_assert(alignof(TrivialVariant) == 8, "StaticVariant must match the Rust layout");
+static_assert(sizeof(StaticVariant<uint8_t, uint16_t>) == 4, "StaticVariant must use an u8 tag");
+
+TEST(StaticVariant, default_constructor_constructs_first_alternative) {
+    TrivialVariant const sut;
+    ASSERT_EQ(sut.index(), 0);
+    ASSERT_TRUE(sut.holds_alternative<uint8_t>());
+    EXPECT_EQ(sut.get<uint8_t>()->get(), 0);
+}
+
+TEST(StaticVariant, construction_from_value_selects_alternative_by_type) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    TrivialVariant const sut(uint64_t { 42 });
+    ASSERT_EQ(sut.index(), 1);
+    ASSERT_TRUE(sut.holds_alternative<uint64_t>());
+    ASSERT_FALSE(sut.get<uint8_t>().has_value());
+    EXPECT_EQ(sut.get<uint64_t>()->get(), 42);
+}
+
+TEST(StaticVariant, construction_with_index_selects_alternative_by_index) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    StaticVariant<int32_t, int32_t> const sut(InPlaceIndex<1> {}, 73);
+    ASSERT_EQ(sut.index(), 1);
+    ASSERT_FALSE(sut.get_at_index<0>().has_value());
+    EXPECT_EQ(sut.get_at_index<1>()->get(), 73);
+}
+
+TEST(StaticVariant, emplace_replaces_alternative) {
+    TrivialVariant sut;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    sut.emplace<int32_t>(-5);
+    ASSERT_EQ(sut.index(), 2);
+    EXPECT_EQ(sut.get<int32_t>()->get(), -5);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    sut.emplace_at_index<1>(12U);
+    ASSERT_EQ(sut.index(), 1);
+    EXPECT_EQ(sut.get_at_index<1>()->get(), 12);
+}
+
+TEST(StaticVariant, equality_compares_index_and_value) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    TrivialVariant const sut(int32_t { 7 });
+    EXPECT_EQ(sut, TrivialVariant(int32_t { 7 }));
+    EXPECT_NE(sut, TrivialVariant(int32_t { 8 }));
+    EXPECT_NE(sut, TrivialVariant(uint64_t { 7 }));
+}
+
+TEST_F(StaticVariantFixture, copy_and_move_preserve_non_trivial_alternative) {
+    using Sut = StaticVariant<int32_t, Observable>;
+    Sut source(Observable { 4 });
+
+    Sut const copy(source);
+    ASSERT_TRUE(copy.holds_alternative<Observable>());
+    EXPECT_EQ(copy.get<Observable>()->get().id, 4);
+
+    Observable::s_counter.was_move_constructed = 0;
+    Sut moved(std::move(source));
+    EXPECT_EQ(Observable::s_counter.was_move_constructed, 1);
+    EXPECT_EQ(moved.get<Observable>()->get().id, 4);
+
+    moved = copy;
+    EXPECT_EQ(moved.get<Observable>()->get().id, 4);
+}
+
+TEST_F(StaticVariantFixture, emplace_and_destructor_destroy_contained_alternative) {
+    {
+        StaticVariant<int32_t, Observable> sut(Observable { 1 });
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        sut.emplace<int32_t>(3);
+        ASSERT_EQ(Observable::s_counter.total_instances, 0);
+
+        sut.emplace<Observable>(2);
+        ASSERT_EQ(Observable::s_counter.total_instances, 1);
+    }
+    ASSERT_EQ(Observable::s_counter.total_instances, 0);
+}
+} // namespace
@@ -17,6 +17,8 @@
 
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -34,6 +36,20 @@ int32_t const G_TEST_ARRAY[G_TEST_ARRAY_SIZE] = { 4, 9, 77, 32, -5 };
 static_assert(std::is_standard_layout<iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE>>::value,
               "StaticVector must be standard layout");
 
+struct alignas(16) OverAlignedElement {
+    uint8_t value;
+};
+
+// the layout must match iceoryx2_bb_container::vector::StaticVec to be usable as cross-language payload
+static_assert(iox2::bb::StaticVector<uint8_t, 3>::has_rust_layout(), "StaticVector must have the Rust layout");
+static_assert(iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE>::has_rust_layout(),
+              "StaticVector must have the Rust layout");
+static_assert(iox2::bb::StaticVector<uint64_t, 32>::has_rust_layout(), "StaticVector must have the Rust layout");
+static_assert(iox2::bb::StaticVector<OverAlignedElement, 3>::has_rust_layout(),
+              "StaticVector must have the Rust layout");
+static_assert(iox2::bb::StaticVector<iox2::bb::StaticVector<uint16_t, 3>, 2>::has_rust_layout(),
+              "StaticVector must have the Rust layout");
+
 // NOLINTBEGIN(cppcoreguidelines-pro-bounds-avoid-unchecked-container-access) fine to use in tests
 
 TEST(StaticVector, default_constructor_initializes_to_empty) {
@@ -1049,6 +1065,130 @@ TEST(StaticVector, try_insert_at_unchecked_init_list_fails_for_exceeding_capacit
     EXPECT_EQ(sut.unchecked_access()[1], 2);
 }
 
+TEST(StaticVector, try_insert_at_unchecked_inserts_a_range_of_its_own_elements) {
+    iox2::bb::StaticVector<int32_t, 2 * G_TEST_ARRAY_SIZE> sut(G_TEST_ARRAY);
+    auto const* data = sut.unchecked_access().data();
+    ASSERT_TRUE(sut.try_insert_at_unchecked(1, data, data + 3));
+    ASSERT_EQ(sut.size(), G_TEST_ARRAY_SIZE + 3);
+    EXPECT_EQ(sut.unchecked_access()[0], G_TEST_ARRAY[0]);
+    EXPECT_EQ(sut.unchecked_access()[1], G_TEST_ARRAY[0]);
+    EXPECT_EQ(sut.unchecked_access()[2], G_TEST_ARRAY[1]);
+    EXPECT_EQ(sut.unchecked_access()[3], G_TEST_ARRAY[2]);
+    EXPECT_EQ(sut.unchecked_access()[4], G_TEST_ARRAY[1]);
+    EXPECT_EQ(sut.unchecked_access()[5], G_TEST_ARRAY[2]);
+    EXPECT_EQ(sut.unchecked_access()[6], G_TEST_ARRAY[3]);
+    EXPECT_EQ(sut.unchecked_access()[7], G_TEST_ARRAY[4]);
+}
+
+TEST(StaticVector, try_append_range_appends_elements_at_the_back) {
+    iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE + 1> sut;
+    ASSERT_TRUE(sut.try_emplace_back(1));
+    ASSERT_TRUE(sut.try_append_range(std::begin(G_TEST_ARRAY), std::end(G_TEST_ARRAY)));
+    ASSERT_EQ(sut.size(), G_TEST_ARRAY_SIZE + 1);
+    EXPECT_EQ(sut.unchecked_access()[0], 1);
+    for (size_t i = 0; i < G_TEST_ARRAY_SIZE; ++i) {
+        EXPECT_EQ(sut.unchecked_access()[i + 1], G_TEST_ARRAY[i]);
+    }
+}
+
+TEST(StaticVector, try_append_range_fails_for_exceeding_capacity_leaving_vector_contents_intact) {
+    iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE> sut;
+    ASSERT_TRUE(sut.try_emplace_back(1));
+    ASSERT_FALSE(sut.try_append_range(std::begin(G_TEST_ARRAY), std::end(G_TEST_ARRAY)));
+    ASSERT_EQ(sut.size(), 1);
+    EXPECT_EQ(sut.unchecked_access()[0], 1);
+}
+
+TEST(StaticVector, try_append_range_from_non_pointer_range) {
+    std::string const src = "whatever";
+    iox2::bb::StaticVector<char, G_TEST_ARRAY_SIZE + 4> sut;
+    ASSERT_TRUE(sut.try_append_range(src.begin(), src.end()));
+    ASSERT_EQ(sut.size(), src.size());
+    EXPECT_TRUE(std::equal(src.begin(), src.end(), sut.unchecked_access().begin()));
+    ASSERT_FALSE(sut.try_append_range(src.begin(), src.end()));
+    ASSERT_EQ(sut.size(), src.size());
+}
+
+TEST_F(StaticVectorFixture, try_append_range_copy_constructs_non_trivial_elements) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    Observable const src[2] = { Observable { 1 }, Observable { 2 } };
+    {
+        iox2::bb::StaticVector<Observable, G_TEST_ARRAY_SIZE> sut;
+        ASSERT_TRUE(sut.try_append_range(std::begin(src), std::end(src)));
+        ASSERT_EQ(sut.size(), 2);
+        EXPECT_EQ(sut.unchecked_access()[0].id, 1);
+        EXPECT_EQ(sut.unchecked_access()[1].id, 2);
+    }
+    expected_count().was_initialized = 2;
+    expected_count().was_copy_constructed = 2;
+    expected_count().was_destructed = 4;
+}
+
+TEST(StaticVector, resize_uninitialized_changes_the_size) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    constexpr uint64_t const LARGE_CAPACITY = 65536;
+    auto sut = std::make_unique<iox2::bb::StaticVector<uint32_t, LARGE_CAPACITY>>();
+    ASSERT_FALSE(sut->resize_uninitialized(LARGE_CAPACITY + 1));
+    ASSERT_TRUE(sut->empty());
+
+    ASSERT_TRUE(sut->resize_uninitialized(LARGE_CAPACITY));
+    ASSERT_EQ(sut->size(), LARGE_CAPACITY);
+    auto* data = sut->unchecked_access().data();
+    for (uint32_t i = 0; i < LARGE_CAPACITY; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) fine to use in tests
+        data[i] = i;
+    }
+    ASSERT_TRUE(sut->try_erase_at(0, LARGE_CAPACITY / 2));
+    ASSERT_EQ(sut->size(), LARGE_CAPACITY / 2);
+    EXPECT_EQ(sut->unchecked_access()[0], LARGE_CAPACITY / 2);
+
+    ASSERT_TRUE(sut->resize_uninitialized(1));
+    ASSERT_EQ(sut->size(), 1);
+    EXPECT_EQ(sut->unchecked_access()[0], LARGE_CAPACITY / 2);
+}
+
+TEST_F(StaticVectorFixture, resize_default_init_default_constructs_added_and_destroys_removed_elements) {
+    {
+        iox2::bb::StaticVector<Observable, G_TEST_ARRAY_SIZE> sut;
+        ASSERT_TRUE(sut.resize_default_init(3));
+        ASSERT_EQ(sut.size(), 3);
+        ASSERT_TRUE(sut.resize_default_init(1));
+        ASSERT_EQ(sut.size(), 1);
+        ASSERT_FALSE(sut.resize_default_init(G_TEST_ARRAY_SIZE + 1));
+        ASSERT_EQ(sut.size(), 1);
+    }
+    expected_count().was_initialized = 3;
+    expected_count().was_destructed = 3;
+}
+
+TEST(StaticVector, resize_default_init_keeps_existing_elements) {
+    iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE + 2> sut(G_TEST_ARRAY);
+    ASSERT_TRUE(sut.resize_default_init(G_TEST_ARRAY_SIZE + 2));
+    ASSERT_EQ(sut.size(), G_TEST_ARRAY_SIZE + 2);
+    for (size_t i = 0; i < G_TEST_ARRAY_SIZE; ++i) {
+        EXPECT_EQ(sut.unchecked_access()[i], G_TEST_ARRAY[i]);
+    }
+}
+
+TEST(StaticVector, uninitialized_tail_commit_appends_written_elements) {
+    iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE + 1> sut;
+    ASSERT_TRUE(sut.try_emplace_back(1));
+
+    auto tail = sut.uninitialized_tail();
+    ASSERT_EQ(tail.available(), G_TEST_ARRAY_SIZE);
+    std::memcpy(tail.data(), &G_TEST_ARRAY[0], sizeof(G_TEST_ARRAY));
+    ASSERT_FALSE(tail.commit(G_TEST_ARRAY_SIZE + 1));
+    ASSERT_EQ(sut.size(), 1);
+    ASSERT_TRUE(tail.commit(G_TEST_ARRAY_SIZE));
+    ASSERT_EQ(tail.available(), 0);
+
+    ASSERT_EQ(sut.size(), G_TEST_ARRAY_SIZE + 1);
+    EXPECT_EQ(sut.unchecked_access()[0], 1);
+    for (size_t i = 0; i < G_TEST_ARRAY_SIZE; ++i) {
+        EXPECT_EQ(sut.unchecked_access()[i + 1], G_TEST_ARRAY[i]);
+    }
+}
+
 TEST(StaticVector, clear_removes_all_elements) {
     iox2::bb::StaticVector<int32_t, G_TEST_ARRAY_SIZE + 1> sut(G_TEST_ARRAY);
     sut.clear();
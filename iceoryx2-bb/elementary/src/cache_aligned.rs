@@ -0,0 +1,110 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Places a value on its own cache line so that it does not share the line with values that
+//! are written by another thread or process (false sharing).
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_elementary::cache_aligned::*;
+//! use core::sync::atomic::{AtomicU64, Ordering};
+//!
+//! #[repr(C)]
+//! struct Positions {
+//!     // written by the producer
+//!     write_position: CacheAligned<AtomicU64>,
+//!     // written by the consumer
+//!     read_position: CacheAligned<AtomicU64>,
+//! }
+//!
+//! let positions = Positions {
+//!     write_position: CacheAligned::new(AtomicU64::new(0)),
+//!     read_position: CacheAligned::new(AtomicU64::new(0)),
+//! };
+//!
+//! positions.write_position.store(1, Ordering::Relaxed);
+//! assert_eq!(core::mem::align_of::<Positions>(), CACHE_LINE_ALIGNMENT);
+//! ```
+
+use core::ops::{Deref, DerefMut};
+
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+
+/// The alignment of [`CacheAligned`]. On x86_64 the adjacent cache line prefetcher fetches
+/// pairs of 64 byte lines and on aarch64 some cores use 128 byte lines, therefore two lines
+/// are used on those architectures.
+#[cfg(any(
+    target_arch = "x86_64",
+    target_arch = "aarch64",
+    target_arch = "powerpc64"
+))]
+pub const CACHE_LINE_ALIGNMENT: usize = 128;
+
+/// The alignment of [`CacheAligned`].
+#[cfg(not(any(
+    target_arch = "x86_64",
+    target_arch = "aarch64",
+    target_arch = "powerpc64"
+)))]
+pub const CACHE_LINE_ALIGNMENT: usize = 64;
+
+/// Aligns and pads `T` to [`CACHE_LINE_ALIGNMENT`]. The layout is well-defined and can be
+/// used in shared memory.
+#[cfg_attr(
+    any(
+        target_arch = "x86_64",
+        target_arch = "aarch64",
+        target_arch = "powerpc64"
+    ),
+    repr(C, align(128))
+)]
+#[cfg_attr(
+    not(any(
+        target_arch = "x86_64",
+        target_arch = "aarch64",
+        target_arch = "powerpc64"
+    )),
+    repr(C, align(64))
+)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct CacheAligned<T> {
+    value: T,
+}
+
+unsafe impl<T: ZeroCopySend> ZeroCopySend for CacheAligned<T> {}
+
+impl<T> CacheAligned<T> {
+    /// Creates a new [`CacheAligned`] value.
+    pub const fn new(value: T) -> Self {
+        Self { value }
+    }
+
+    /// Consumes the [`CacheAligned`] and returns the contained value.
+    pub fn into_inner(self) -> T {
+        self.value
+    }
+}
+
+impl<T> Deref for CacheAligned<T> {
+    type Target = T;
+
+    fn deref(&self) -> &Self::Target {
+        &self.value
+    }
+}
+
+impl<T> DerefMut for CacheAligned<T> {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.value
+    }
+}
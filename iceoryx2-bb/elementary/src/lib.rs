@@ -25,10 +25,12 @@ pub mod enum_gen;
 pub mod alignment;
 /// A strong type that represents the alignment part of [`core::alloc::Layout`]
 pub mod bump_allocator;
+pub mod cache_aligned;
 pub mod cyclic_tagger;
 pub mod lazy_singleton;
 pub mod math;
 pub mod package_version;
+pub mod prefetch;
 pub mod relocatable_ptr;
 pub mod scope_guard;
 pub mod static_assert;
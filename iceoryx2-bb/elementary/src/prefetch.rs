@@ -0,0 +1,52 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Software prefetch hints that ask the CPU to load memory into the cache before it is
+//! accessed, so that the memory latency overlaps with other work.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_elementary::prefetch::prefetch_read;
+//!
+//! let data = [0u8; 1024];
+//! prefetch_read(data.as_ptr(), data.len());
+//! // do something else while the data is loaded
+//! ```
+
+/// The distance between two prefetch instructions issued by [`prefetch_read()`], the size of
+/// a cache line.
+pub const PREFETCH_STRIDE: usize = 64;
+
+/// Hints the CPU to load the memory range starting at `ptr` with `len` bytes into the cache
+/// for reading. A prefetch never faults, therefore the memory does not need to be valid. On
+/// architectures without a stable prefetch instruction it does nothing.
+#[inline]
+pub fn prefetch_read(ptr: *const u8, len: usize) {
+    #[cfg(target_arch = "x86_64")]
+    {
+        let mut offset = 0;
+        while offset < len {
+            unsafe {
+                core::arch::x86_64::_mm_prefetch::<{ core::arch::x86_64::_MM_HINT_T0 }>(
+                    ptr.wrapping_add(offset) as *const i8,
+                )
+            };
+            offset += PREFETCH_STRIDE;
+        }
+    }
+
+    #[cfg(not(target_arch = "x86_64"))]
+    {
+        let _ = (ptr, len);
+    }
+}
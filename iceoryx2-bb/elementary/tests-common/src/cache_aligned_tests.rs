@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_elementary::cache_aligned::*;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+
+#[repr(C)]
+struct TwoSides {
+    first: CacheAligned<u64>,
+    second: CacheAligned<u64>,
+}
+
+#[test]
+pub fn cache_aligned_values_do_not_share_a_cache_line() {
+    let sut = TwoSides {
+        first: CacheAligned::new(123),
+        second: CacheAligned::new(456),
+    };
+
+    let first = &sut.first as *const CacheAligned<u64> as usize;
+    let second = &sut.second as *const CacheAligned<u64> as usize;
+
+    assert_that!(core::mem::align_of::<TwoSides>(), eq CACHE_LINE_ALIGNMENT);
+    assert_that!(first % CACHE_LINE_ALIGNMENT, eq 0);
+    assert_that!(second % CACHE_LINE_ALIGNMENT, eq 0);
+    assert_that!(second - first, ge CACHE_LINE_ALIGNMENT);
+}
+
+#[test]
+pub fn cache_aligned_provides_access_to_the_value() {
+    let mut sut = CacheAligned::new(789u64);
+    assert_that!(*sut, eq 789);
+
+    *sut = 1011;
+    assert_that!(*sut, eq 1011);
+    assert_that!(sut.into_inner(), eq 1011);
+}
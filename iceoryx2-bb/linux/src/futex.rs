@@ -0,0 +1,132 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Safe abstraction over the linux futex api. Any [`AtomicU32`] can be used as futex word,
+//! also when it resides in shared memory. [`futex_wait()`] blocks as long as the word
+//! contains the expected value until [`futex_wake()`] is called from another thread or
+//! process. The futex word itself is never modified by the kernel, the user defines the
+//! protocol.
+//!
+//! # Example
+//!
+//! ```
+//! # extern crate iceoryx2_bb_loggers;
+//!
+//! use iceoryx2_bb_concurrency::atomic::{AtomicU32, Ordering};
+//! use iceoryx2_bb_linux::futex::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let futex = AtomicU32::new(0);
+//!
+//! // returns immediately since the futex does not contain the expected value
+//! let result = futex_wait(&futex, 1, Some(core::time::Duration::from_millis(10)))?;
+//! assert_eq!(result, FutexWaitResult::ValueChanged);
+//!
+//! futex.fetch_add(1, Ordering::Relaxed);
+//! let number_of_woken_up_waiters = futex_wake(&futex, u32::MAX)?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::time::Duration;
+
+use iceoryx2_bb_concurrency::atomic::AtomicU32;
+use iceoryx2_bb_posix::clock::AsTimespec;
+use iceoryx2_log::fail;
+use iceoryx2_pal_os_api::linux;
+
+/// Error emitted by [`futex_wait()`].
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FutexWaitError {
+    /// An interrupt signal was raised
+    Interrupt,
+    /// An error that was not documented in the linux API was reported
+    UnknownError(i32),
+}
+
+impl core::fmt::Display for FutexWaitError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "FutexWaitError::{self:?}")
+    }
+}
+
+impl core::error::Error for FutexWaitError {}
+
+/// Error emitted by [`futex_wake()`].
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FutexWakeError {
+    /// An error that was not documented in the linux API was reported
+    UnknownError(i32),
+}
+
+impl core::fmt::Display for FutexWakeError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "FutexWakeError::{self:?}")
+    }
+}
+
+impl core::error::Error for FutexWakeError {}
+
+/// Describes why [`futex_wait()`] returned.
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum FutexWaitResult {
+    /// The waiter was woken up. The wake up can be spurious, the caller has to verify the
+    /// futex word.
+    WokenUp,
+    /// The futex word did not contain the expected value, the call did not block.
+    ValueChanged,
+    /// The provided timeout has passed.
+    Timeout,
+}
+
+/// Blocks as long as `futex` contains `expected` until it is woken up with [`futex_wake()`].
+/// When a `timeout` is provided, it blocks at most for the duration of the timeout.
+pub fn futex_wait(
+    futex: &AtomicU32,
+    expected: u32,
+    timeout: Option<Duration>,
+) -> Result<FutexWaitResult, FutexWaitError> {
+    let timeout = timeout.map(|t| t.as_timespec());
+    let timeout_ptr = match timeout {
+        Some(ref t) => t as *const _,
+        None => core::ptr::null(),
+    };
+
+    match unsafe { linux::futex_wait((futex as *const AtomicU32).cast(), expected, timeout_ptr) } {
+        0 => Ok(FutexWaitResult::WokenUp),
+        e if e == -linux::FUTEX_EAGAIN => Ok(FutexWaitResult::ValueChanged),
+        e if e == -linux::FUTEX_ETIMEDOUT => Ok(FutexWaitResult::Timeout),
+        e if e == -linux::FUTEX_EINTR => {
+            fail!(from "futex_wait()", with FutexWaitError::Interrupt,
+                "Unable to wait on futex since an interrupt signal was raised.");
+        }
+        e => {
+            fail!(from "futex_wait()", with FutexWaitError::UnknownError(-e),
+                "Unable to wait on futex due to an unknown error ({}).", -e);
+        }
+    }
+}
+
+/// Wakes up at most `number_of_waiters` that are blocked in [`futex_wait()`] on `futex`
+/// and returns how many were woken up. Use [`u32::MAX`] to wake up all waiters.
+pub fn futex_wake(futex: &AtomicU32, number_of_waiters: u32) -> Result<u32, FutexWakeError> {
+    let number_of_waiters = number_of_waiters.min(i32::MAX as u32);
+    match unsafe { linux::futex_wake((futex as *const AtomicU32).cast(), number_of_waiters) } {
+        n if n >= 0 => Ok(n as u32),
+        e => {
+            fail!(from "futex_wake()", with FutexWakeError::UnknownError(-e),
+                "Unable to wake up futex waiters due to an unknown error ({}).", -e);
+        }
+    }
+}
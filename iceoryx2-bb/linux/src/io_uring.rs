@@ -0,0 +1,717 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! [`IoUring`] is a safe abstraction over the linux io_uring interface that is restricted to
+//! the readiness notification of [`FileDescriptor`]s. Every attachment is backed by a one-shot
+//! poll request that is re-armed after it was reported, therefore [`IoUring`] is level triggered
+//! like [`Epoll`](crate::epoll::Epoll). The poll requests of new attachments and all re-armed
+//! poll requests are submitted together with the wait in one single `io_uring_enter()` syscall.
+//!
+//! # Example
+//!
+//! ```
+//! # extern crate iceoryx2_bb_loggers;
+//!
+//! use iceoryx2_bb_linux::io_uring::*;
+//! use iceoryx2_bb_posix::socket_pair::StreamingSocket;
+//! use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let io_uring = match IoUringBuilder::new().create() {
+//!     Ok(io_uring) => io_uring,
+//!     // io_uring can be disabled, see /proc/sys/kernel/io_uring_disabled
+//!     Err(_) => return Ok(()),
+//! };
+//! let (socket_1, socket_2) = StreamingSocket::create_pair()?;
+//!
+//! let io_uring_guard = io_uring.attach(socket_1.file_descriptor())?;
+//!
+//! socket_2.try_send(b"hello world")?;
+//!
+//! let number_of_triggers = io_uring.blocking_wait(|fd| {
+//!     if unsafe { fd.native_handle() == socket_1.file_descriptor().native_handle() } {
+//!         let mut raw_data = [0u8; 20];
+//!         socket_1.try_receive(&mut raw_data);
+//!     }
+//! })?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+extern crate alloc;
+
+use alloc::collections::BTreeMap;
+use alloc::vec::Vec;
+
+use core::time::Duration;
+
+use iceoryx2_bb_concurrency::cell::RefCell;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_log::{fail, warn};
+use iceoryx2_pal_os_api::linux;
+use iceoryx2_pal_posix::posix::{self};
+
+const POLL_REMOVE_USER_DATA: u64 = u64::MAX;
+
+/// Errors that can occur when [`IoUringBuilder::create()`] creates a new [`IoUring`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringCreateError {
+    /// The process file handle limit has been reached.
+    PerProcessFileHandleLimitReached,
+    /// The system wide file handle limit has been reached.
+    SystemWideFileHandleLimitReached,
+    /// The system has not enough memory to create the [`IoUring`] or to map its rings.
+    InsufficientMemory,
+    /// io_uring was disabled for the process, see `/proc/sys/kernel/io_uring_disabled`.
+    InsufficientPermissions,
+    /// The kernel does not support io_uring or lacks a required feature. At least linux 5.11
+    /// is required.
+    NotSupported,
+    /// The syscall [`linux::io_uring_setup()`] returned a broken [`FileDescriptor`].
+    SysCallReturnedInvalidFileDescriptor,
+    /// An error occurred that was not described in the linux man-page.
+    UnknownError(i32),
+}
+
+impl core::fmt::Display for IoUringCreateError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "IoUringCreateError::{self:?}")
+    }
+}
+
+impl core::error::Error for IoUringCreateError {}
+
+/// Can be emitted by [`IoUring::attach()`] when a new [`FileDescriptor`] shall be attached.
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringAttachmentError {
+    /// The [`FileDescriptor`] is already attached.
+    AlreadyAttached,
+    /// [`IoUring::capacity()`] [`FileDescriptor`]s are already attached.
+    ExceedsMaxSupportedAttachments,
+    /// An error occurred that was not described in the linux man-page.
+    UnknownError(i32),
+}
+
+impl core::fmt::Display for IoUringAttachmentError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "IoUringAttachmentError::{self:?}")
+    }
+}
+
+impl core::error::Error for IoUringAttachmentError {}
+
+/// Errors that can be returned by [`IoUring::try_wait()`], [`IoUring::timed_wait()`] or
+/// [`IoUring::blocking_wait()`].
+#[derive(Debug, Clone, Copy, Eq, PartialEq)]
+pub enum IoUringWaitError {
+    /// An interrupt signal was received (SIGINT).
+    Interrupt,
+    /// An error occurred that was not described in the linux man-page.
+    UnknownError(i32),
+}
+
+impl core::fmt::Display for IoUringWaitError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "IoUringWaitError::{self:?}")
+    }
+}
+
+impl core::error::Error for IoUringWaitError {}
+
+/// Returned by [`IoUring::attach()`] and represents an [`IoUring`] attachment. As soon as the
+/// [`IoUringGuard`] goes out of scope the attachment is detached.
+pub struct IoUringGuard<'io_uring, 'file_descriptor> {
+    io_uring: &'io_uring IoUring,
+    fd: &'file_descriptor FileDescriptor,
+}
+
+impl<'file_descriptor> IoUringGuard<'_, 'file_descriptor> {
+    /// Returns a reference of the attached [`FileDescriptor`]
+    pub fn file_descriptor(&self) -> &'file_descriptor FileDescriptor {
+        self.fd
+    }
+}
+
+impl Drop for IoUringGuard<'_, '_> {
+    fn drop(&mut self) {
+        self.io_uring.remove(unsafe { self.fd.native_handle() })
+    }
+}
+
+/// The builder to create a new [`IoUring`].
+#[derive(Debug)]
+pub struct IoUringBuilder {
+    capacity: usize,
+}
+
+impl Default for IoUringBuilder {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl IoUringBuilder {
+    /// Creates a new builder instance.
+    pub fn new() -> Self {
+        Self {
+            capacity: IoUring::default_capacity(),
+        }
+    }
+
+    /// Defines how many [`FileDescriptor`]s can be attached at most. The kernel rounds the
+    /// value up to the next power of two and clamps it to its supported maximum.
+    pub fn capacity(mut self, value: usize) -> Self {
+        self.capacity = value.clamp(1, u32::MAX as usize);
+        self
+    }
+
+    /// Creates a new [`IoUring`].
+    pub fn create(self) -> Result<IoUring, IoUringCreateError> {
+        let msg = "Unable to create io_uring";
+        let mut params = linux::io_uring_params {
+            flags: linux::IORING_SETUP_CLAMP,
+            ..Default::default()
+        };
+
+        let ring_fd = unsafe { linux::io_uring_setup(self.capacity as u32, &mut params) };
+        if ring_fd == -1 {
+            match posix::Errno::get() {
+                posix::Errno::EMFILE => {
+                    fail!(from self, with IoUringCreateError::PerProcessFileHandleLimitReached,
+                        "{msg} since it would exceed the process limit for file descriptors.");
+                }
+                posix::Errno::ENFILE => {
+                    fail!(from self, with IoUringCreateError::SystemWideFileHandleLimitReached,
+                        "{msg} since it would exceed the system limit for file descriptors.");
+                }
+                posix::Errno::ENOMEM => {
+                    fail!(from self, with IoUringCreateError::InsufficientMemory,
+                        "{msg} due to insufficient memory.");
+                }
+                posix::Errno::EPERM => {
+                    fail!(from self, with IoUringCreateError::InsufficientPermissions,
+                        "{msg} since io_uring is disabled for the process.");
+                }
+                posix::Errno::ENOSYS => {
+                    fail!(from self, with IoUringCreateError::NotSupported,
+                        "{msg} since the kernel does not support io_uring.");
+                }
+                e => {
+                    fail!(from self, with IoUringCreateError::UnknownError(e as i32),
+                        "{msg} since an unknown error occurred ({e:?}).");
+                }
+            }
+        }
+
+        let ring_fd = match FileDescriptor::new(ring_fd) {
+            Some(fd) => fd,
+            None => {
+                fail!(from self, with IoUringCreateError::SysCallReturnedInvalidFileDescriptor,
+                    "{msg} since the io_uring_setup() syscall returned an invalid file descriptor.");
+            }
+        };
+
+        let required_features =
+            linux::IORING_FEAT_SINGLE_MMAP | linux::IORING_FEAT_NODROP | linux::IORING_FEAT_EXT_ARG;
+        if params.features & required_features != required_features {
+            fail!(from self, with IoUringCreateError::NotSupported,
+                "{msg} since the kernel does not support all required io_uring features (supported: {:#x}, required: {:#x}).",
+                params.features, required_features);
+        }
+
+        let sq_ring_len =
+            params.sq_off.array as usize + params.sq_entries as usize * core::mem::size_of::<u32>();
+        let cq_ring_len = params.cq_off.cqes as usize
+            + params.cq_entries as usize * core::mem::size_of::<linux::io_uring_cqe>();
+
+        let rings = match RingMapping::new(
+            &ring_fd,
+            sq_ring_len.max(cq_ring_len),
+            linux::IORING_OFF_SQ_RING,
+        ) {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with e, "{msg} since the rings could not be mapped.");
+            }
+        };
+
+        let sqes = match RingMapping::new(
+            &ring_fd,
+            params.sq_entries as usize * core::mem::size_of::<linux::io_uring_sqe>(),
+            linux::IORING_OFF_SQES,
+        ) {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with e, "{msg} since the submission queue entries could not be mapped.");
+            }
+        };
+
+        let io_uring = unsafe {
+            IoUring {
+                sq_head: rings.at(params.sq_off.head),
+                sq_tail: rings.at(params.sq_off.tail),
+                sq_mask: *rings.at::<u32>(params.sq_off.ring_mask),
+                sq_entries: params.sq_entries,
+                sqes: sqes.at(0),
+                cq_head: rings.at(params.cq_off.head),
+                cq_tail: rings.at(params.cq_off.tail),
+                cq_mask: *rings.at::<u32>(params.cq_off.ring_mask),
+                cqes: rings.at(params.cq_off.cqes),
+                state: RefCell::new(State {
+                    attachments: BTreeMap::new(),
+                    next_generation: 0,
+                    sq_tail: linux::io_uring_load_acquire(rings.at(params.sq_off.tail)),
+                    to_submit: 0,
+                }),
+                _sqes_mapping: sqes,
+                _rings_mapping: rings,
+                ring_fd,
+            }
+        };
+
+        // every submission queue entry is always referenced by the array slot with the same index
+        let sq_array: *mut u32 = unsafe { io_uring._rings_mapping.at(params.sq_off.array) };
+        for index in 0..params.sq_entries {
+            unsafe { sq_array.add(index as usize).write(index) };
+        }
+
+        Ok(io_uring)
+    }
+}
+
+#[derive(Debug)]
+struct RingMapping {
+    base: *mut u8,
+    len: usize,
+}
+
+impl RingMapping {
+    fn new(
+        ring_fd: &FileDescriptor,
+        len: usize,
+        offset: posix::off_t,
+    ) -> Result<Self, IoUringCreateError> {
+        let base = unsafe {
+            posix::mmap(
+                core::ptr::null_mut(),
+                len,
+                posix::PROT_READ | posix::PROT_WRITE,
+                posix::MAP_SHARED,
+                ring_fd.native_handle(),
+                offset,
+            )
+        };
+
+        if base == posix::MAP_FAILED {
+            match posix::Errno::get() {
+                posix::Errno::ENOMEM => return Err(IoUringCreateError::InsufficientMemory),
+                e => return Err(IoUringCreateError::UnknownError(e as i32)),
+            }
+        }
+
+        Ok(Self {
+            base: base.cast(),
+            len,
+        })
+    }
+
+    unsafe fn at<T>(&self, offset: u32) -> *mut T {
+        unsafe { self.base.add(offset as usize).cast() }
+    }
+}
+
+impl Drop for RingMapping {
+    fn drop(&mut self) {
+        if unsafe { posix::munmap(self.base.cast(), self.len) } != 0 {
+            warn!(from self, "This should never happen! Unable to unmap the io_uring ring ({:?}).",
+                posix::Errno::get());
+        }
+    }
+}
+
+#[derive(Debug)]
+struct State {
+    // maps the native handle of every attachment to the generation that is encoded in the
+    // user data of its poll requests, this identifies completions of already detached
+    // attachments whose native handle was reused
+    attachments: BTreeMap<i32, u32>,
+    next_generation: u32,
+    sq_tail: u32,
+    to_submit: u32,
+}
+
+fn poll_user_data(native_handle: i32, generation: u32) -> u64 {
+    ((generation as u64) << 32) | native_handle as u32 as u64
+}
+
+enum WaitMode {
+    NoWait,
+    Timeout(Duration),
+    Infinite,
+}
+
+/// Abstraction of the linux io_uring restricted to readiness notifications.
+pub struct IoUring {
+    state: RefCell<State>,
+    sq_head: *mut u32,
+    sq_tail: *mut u32,
+    sq_mask: u32,
+    sq_entries: u32,
+    sqes: *mut linux::io_uring_sqe,
+    cq_head: *mut u32,
+    cq_tail: *mut u32,
+    cq_mask: u32,
+    cqes: *mut linux::io_uring_cqe,
+    _sqes_mapping: RingMapping,
+    _rings_mapping: RingMapping,
+    ring_fd: FileDescriptor,
+}
+
+// The raw pointers point into memory mappings that are owned by the IoUring itself and all
+// accesses from the user side are serialized by the RefCell.
+unsafe impl Send for IoUring {}
+
+impl core::fmt::Debug for IoUring {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "IoUring {{ ring_fd: {:?}, capacity: {} }}",
+            self.ring_fd,
+            self.capacity()
+        )
+    }
+}
+
+impl IoUring {
+    /// Returns the capacity that [`IoUringBuilder`] uses when nothing else is configured.
+    pub const fn default_capacity() -> usize {
+        512
+    }
+
+    /// Returns the number of [`FileDescriptor`]s that can be attached at most.
+    pub fn capacity(&self) -> usize {
+        self.sq_entries as usize
+    }
+
+    /// Returns `true` when [`IoUring`] has no attached [`FileDescriptor`]s, otherwise `false`.
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Returns the number of attached [`FileDescriptor`]s.
+    pub fn len(&self) -> usize {
+        self.state.borrow().attachments.len()
+    }
+
+    /// Attaches the [`FileDescriptor`] to [`IoUring`] so that it wakes up as soon as the
+    /// [`FileDescriptor`] has data to read, and returns an [`IoUringGuard`]. As soon as the
+    /// [`IoUringGuard`] goes out-of-scope the attachment is released.
+    /// The poll request is submitted with the next wait call.
+    pub fn attach<'io_uring, 'fd>(
+        &'io_uring self,
+        fd: &'fd FileDescriptor,
+    ) -> Result<IoUringGuard<'io_uring, 'fd>, IoUringAttachmentError> {
+        let msg = "Unable to attach file descriptor to io_uring";
+        let native_handle = unsafe { fd.native_handle() };
+        let mut state = self.state.borrow_mut();
+
+        if state.attachments.contains_key(&native_handle) {
+            fail!(from self, with IoUringAttachmentError::AlreadyAttached,
+                "{msg} since it is already attached.");
+        }
+
+        if state.attachments.len() >= self.capacity() {
+            fail!(from self, with IoUringAttachmentError::ExceedsMaxSupportedAttachments,
+                "{msg} since it would exceed the capacity of {}.", self.capacity());
+        }
+
+        let generation = state.next_generation;
+        if let Err(e) = self.push_poll_add(&mut state, native_handle, generation) {
+            fail!(from self, with IoUringAttachmentError::UnknownError(e),
+                "{msg} since the poll request could not be queued ({e}).");
+        }
+
+        state.next_generation = generation.wrapping_add(1);
+        state.attachments.insert(native_handle, generation);
+
+        Ok(IoUringGuard { io_uring: self, fd })
+    }
+
+    /// Non-blocking call, that returns the number of activated attachments and calls the provided
+    /// callback for every activated attachment with its [`FileDescriptor`].
+    pub fn try_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_call: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait_impl(WaitMode::NoWait, fd_call)
+    }
+
+    /// Blocking call, that returns the number of activated attachments and calls the provided
+    /// callback for every activated attachment with its [`FileDescriptor`].
+    /// If the timeout has passed and no activation has happened it will return 0.
+    pub fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_call: F,
+        timeout: Duration,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait_impl(WaitMode::Timeout(timeout), fd_call)
+    }
+
+    /// Blocking call, that returns the number of activated attachments and calls the provided
+    /// callback for every activated attachment with its [`FileDescriptor`].
+    pub fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fd_call: F,
+    ) -> Result<usize, IoUringWaitError> {
+        self.wait_impl(WaitMode::Infinite, fd_call)
+    }
+
+    fn remove(&self, native_handle: i32) {
+        let mut state = self.state.borrow_mut();
+        let generation = match state.attachments.remove(&native_handle) {
+            Some(generation) => generation,
+            None => return,
+        };
+
+        let sqe = linux::io_uring_sqe {
+            opcode: linux::IORING_OP_POLL_REMOVE,
+            fd: -1,
+            addr: poll_user_data(native_handle, generation),
+            user_data: POLL_REMOVE_USER_DATA,
+            ..Default::default()
+        };
+
+        // the removal is submitted right away so that the kernel releases its reference to the
+        // file without waiting for the next wait call
+        if let Err(e) = self
+            .push_sqe(&mut state, sqe)
+            .and_then(|_| self.enter(&mut state, 0, 0, core::ptr::null(), 0))
+        {
+            warn!(from self,
+                "This should never happen! Failed to detach {native_handle} from io_uring due to ({e}). The stale poll request is ignored.");
+        }
+    }
+
+    fn push_poll_add(
+        &self,
+        state: &mut State,
+        native_handle: i32,
+        generation: u32,
+    ) -> Result<(), i32> {
+        self.push_sqe(
+            state,
+            linux::io_uring_sqe {
+                opcode: linux::IORING_OP_POLL_ADD,
+                fd: native_handle,
+                op_flags: linux::io_uring_poll_mask(linux::IO_URING_POLLIN),
+                user_data: poll_user_data(native_handle, generation),
+                ..Default::default()
+            },
+        )
+    }
+
+    fn push_sqe(&self, state: &mut State, sqe: linux::io_uring_sqe) -> Result<(), i32> {
+        let is_full = |state: &State| {
+            state
+                .sq_tail
+                .wrapping_sub(unsafe { linux::io_uring_load_acquire(self.sq_head) })
+                == self.sq_entries
+        };
+
+        if is_full(state) {
+            self.enter(state, 0, 0, core::ptr::null(), 0)?;
+            if is_full(state) {
+                return Err(linux::IO_URING_EBUSY);
+            }
+        }
+
+        let index = state.sq_tail & self.sq_mask;
+        unsafe { self.sqes.add(index as usize).write(sqe) };
+        state.sq_tail = state.sq_tail.wrapping_add(1);
+        unsafe { linux::io_uring_store_release(self.sq_tail, state.sq_tail) };
+        state.to_submit += 1;
+
+        Ok(())
+    }
+
+    fn enter(
+        &self,
+        state: &mut State,
+        min_complete: u32,
+        flags: u32,
+        arg: *const posix::void,
+        argsz: usize,
+    ) -> Result<u32, i32> {
+        let ret = unsafe {
+            linux::io_uring_enter(
+                self.ring_fd.native_handle(),
+                state.to_submit,
+                min_complete,
+                flags,
+                arg,
+                argsz,
+            )
+        };
+
+        if ret < 0 {
+            return Err(-ret);
+        }
+
+        state.to_submit -= ret as u32;
+        Ok(ret as u32)
+    }
+
+    fn harvest(&self, state: &mut State, activated: &mut Vec<i32>) {
+        let mut head = unsafe { linux::io_uring_load_acquire(self.cq_head) };
+        let tail = unsafe { linux::io_uring_load_acquire(self.cq_tail) };
+
+        while head != tail {
+            let cqe = unsafe { self.cqes.add((head & self.cq_mask) as usize).read() };
+            head = head.wrapping_add(1);
+
+            if cqe.user_data == POLL_REMOVE_USER_DATA {
+                continue;
+            }
+
+            let native_handle = cqe.user_data as u32 as i32;
+            let generation = (cqe.user_data >> 32) as u32;
+            if state.attachments.get(&native_handle) != Some(&generation) {
+                continue;
+            }
+
+            if cqe.res < 0 {
+                warn!(from self,
+                    "The poll request of the attached file descriptor {native_handle} failed ({}). It will not be reported anymore.",
+                    -cqe.res);
+                continue;
+            }
+
+            activated.push(native_handle);
+        }
+
+        unsafe { linux::io_uring_store_release(self.cq_head, head) };
+    }
+
+    fn wait_impl<F: FnMut(&FileDescriptor)>(
+        &self,
+        mode: WaitMode,
+        mut fd_call: F,
+    ) -> Result<usize, IoUringWaitError> {
+        let msg = "Unable to wait on io_uring";
+        let mut activated = Vec::new();
+
+        {
+            let mut state = self.state.borrow_mut();
+            self.harvest(&mut state, &mut activated);
+
+            let start = match mode {
+                WaitMode::Timeout(_) => Time::now_with_clock(ClockType::Monotonic).ok(),
+                _ => None,
+            };
+            let mut remaining = match mode {
+                WaitMode::Timeout(timeout) => timeout,
+                _ => Duration::ZERO,
+            };
+
+            while activated.is_empty() {
+                let timespec = linux::io_uring_kernel_timespec {
+                    tv_sec: remaining.as_secs() as _,
+                    tv_nsec: remaining.subsec_nanos() as _,
+                };
+                let arg = linux::io_uring_getevents_arg {
+                    ts: (&timespec as *const linux::io_uring_kernel_timespec) as u64,
+                    ..Default::default()
+                };
+
+                let result = match mode {
+                    WaitMode::NoWait => self.enter(
+                        &mut state,
+                        0,
+                        linux::IORING_ENTER_GETEVENTS,
+                        core::ptr::null(),
+                        0,
+                    ),
+                    WaitMode::Timeout(_) => self.enter(
+                        &mut state,
+                        1,
+                        linux::IORING_ENTER_GETEVENTS | linux::IORING_ENTER_EXT_ARG,
+                        (&arg as *const linux::io_uring_getevents_arg).cast(),
+                        core::mem::size_of::<linux::io_uring_getevents_arg>(),
+                    ),
+                    WaitMode::Infinite => self.enter(
+                        &mut state,
+                        1,
+                        linux::IORING_ENTER_GETEVENTS,
+                        core::ptr::null(),
+                        0,
+                    ),
+                };
+
+                let is_final_wakeup = match result {
+                    Ok(number_of_submissions) => number_of_submissions > 0,
+                    Err(linux::IO_URING_ETIME) | Err(linux::IO_URING_EBUSY) => true,
+                    Err(linux::IO_URING_EINTR) => {
+                        fail!(from self, with IoUringWaitError::Interrupt,
+                            "{msg} since an interrupt signal was raised.");
+                    }
+                    Err(e) => {
+                        fail!(from self, with IoUringWaitError::UnknownError(e),
+                            "{msg} due to an unknown failure ({e}).");
+                    }
+                };
+
+                self.harvest(&mut state, &mut activated);
+
+                // When the call also submitted requests, the kernel reports the submission
+                // instead of a timeout or interrupt of the wait, therefore only wakeups that
+                // were caused by completions of detached attachments are repeated.
+                if is_final_wakeup {
+                    break;
+                }
+
+                match (&mode, &start) {
+                    (WaitMode::NoWait, _) | (WaitMode::Timeout(_), None) => break,
+                    (WaitMode::Timeout(timeout), Some(start)) => {
+                        remaining = timeout.saturating_sub(start.elapsed().unwrap_or(*timeout));
+                        if remaining.is_zero() {
+                            break;
+                        }
+                    }
+                    (WaitMode::Infinite, _) => (),
+                }
+            }
+
+            for native_handle in &activated {
+                let generation = state.attachments[native_handle];
+                if let Err(e) = self.push_poll_add(&mut state, *native_handle, generation) {
+                    warn!(from self,
+                        "Unable to re-arm the poll request of the attached file descriptor {native_handle} ({e}). It will not be reported anymore.");
+                }
+            }
+        }
+
+        for native_handle in &activated {
+            match FileDescriptor::non_owning_new(*native_handle) {
+                Some(fd) => fd_call(&fd),
+                None => {
+                    warn!(from self,
+                        "The file descriptor {native_handle} is no longer valid but still attached to io_uring. Skipping attachment!");
+                }
+            }
+        }
+
+        Ok(activated.len())
+    }
+}
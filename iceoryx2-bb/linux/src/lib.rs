@@ -15,5 +15,11 @@
 #[cfg(target_os = "linux")]
 pub mod epoll;
 
+#[cfg(target_os = "linux")]
+pub mod futex;
+
+#[cfg(target_os = "linux")]
+pub mod io_uring;
+
 #[cfg(target_os = "linux")]
 pub mod signalfd;
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_concurrency::atomic::{AtomicU32, Ordering};
+use iceoryx2_bb_linux::futex::*;
+use iceoryx2_bb_posix::barrier::BarrierBuilder;
+use iceoryx2_bb_posix::barrier::BarrierHandle;
+use iceoryx2_bb_posix::barrier::Handle;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::clock::nanosleep;
+use iceoryx2_bb_posix::thread::thread_scope;
+use iceoryx2_bb_testing::{assert_that, watchdog::Watchdog};
+use iceoryx2_bb_testing_macros::test;
+
+const TIMEOUT: core::time::Duration = core::time::Duration::from_millis(50);
+
+#[test]
+pub fn wait_does_not_block_when_value_differs() {
+    let _watchdog = Watchdog::new();
+    let sut = AtomicU32::new(5);
+
+    assert_that!(futex_wait(&sut, 4, None), eq Ok(FutexWaitResult::ValueChanged));
+    assert_that!(futex_wait(&sut, 6, Some(TIMEOUT)), eq Ok(FutexWaitResult::ValueChanged));
+}
+
+#[test]
+pub fn timed_wait_blocks_for_at_least_timeout() {
+    let _watchdog = Watchdog::new();
+    let sut = AtomicU32::new(0);
+
+    let start = Time::now().unwrap();
+    assert_that!(futex_wait(&sut, 0, Some(TIMEOUT)), eq Ok(FutexWaitResult::Timeout));
+    assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+}
+
+#[test]
+pub fn wake_without_waiters_wakes_up_nobody() {
+    let sut = AtomicU32::new(0);
+
+    assert_that!(futex_wake(&sut, 1), eq Ok(0));
+    assert_that!(futex_wake(&sut, u32::MAX), eq Ok(0));
+}
+
+#[test]
+pub fn blocking_wait_wakes_up_by_wake() {
+    let _watchdog = Watchdog::new();
+    let sut = AtomicU32::new(0);
+
+    let handle = BarrierHandle::new();
+    let barrier = BarrierBuilder::new(2).create(&handle).unwrap();
+    thread_scope(|s| {
+        s.thread_builder().spawn(|| {
+            barrier.wait();
+            while sut.load(Ordering::Relaxed) == 0 {
+                assert_that!(futex_wait(&sut, 0, None), is_ok);
+            }
+        })?;
+
+        barrier.wait();
+        nanosleep(TIMEOUT).unwrap();
+
+        sut.store(1, Ordering::Relaxed);
+        assert_that!(futex_wake(&sut, u32::MAX), is_ok);
+        // thread should wake up now, if not the watchdog will let the unit test fail
+
+        Ok(())
+    })
+    .unwrap();
+}
@@ -0,0 +1,233 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::vec;
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, Ordering};
+use iceoryx2_bb_linux::io_uring::*;
+use iceoryx2_bb_posix::barrier::BarrierBuilder;
+use iceoryx2_bb_posix::barrier::BarrierHandle;
+use iceoryx2_bb_posix::barrier::Handle;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_bb_posix::clock::nanosleep;
+use iceoryx2_bb_posix::thread::thread_scope;
+use iceoryx2_bb_posix::{file_descriptor::FileDescriptorBased, socket_pair::StreamingSocket};
+use iceoryx2_bb_testing::{assert_that, test_requires, watchdog::Watchdog};
+use iceoryx2_bb_testing_macros::test;
+
+const TIMEOUT: core::time::Duration = core::time::Duration::from_millis(50);
+
+// io_uring can be unavailable or disabled by the kernel configuration or a seccomp filter
+fn io_uring_is_available() -> bool {
+    IoUringBuilder::new().create().is_ok()
+}
+
+#[test]
+pub fn when_guard_goes_out_of_scope_it_detaches_fd() {
+    test_requires!(io_uring_is_available());
+    const NUMBER_OF_ATTACHMENTS: usize = 12;
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let mut sockets = vec![];
+    for _ in 0..NUMBER_OF_ATTACHMENTS / 2 {
+        let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+        sockets.push(socket_1);
+        sockets.push(socket_2);
+    }
+
+    let mut guards = vec![];
+    for (n, socket) in sockets.iter().enumerate() {
+        assert_that!(sut.len(), eq n);
+        guards.push(sut.attach(socket.file_descriptor()).unwrap());
+    }
+
+    for n in 0..NUMBER_OF_ATTACHMENTS {
+        assert_that!(sut.len(), eq NUMBER_OF_ATTACHMENTS - n);
+        guards.pop();
+    }
+    assert_that!(sut.is_empty(), eq true);
+}
+
+#[test]
+pub fn attaching_the_same_fd_twice_fails() {
+    test_requires!(io_uring_is_available());
+    let (socket_1, _socket_2) = StreamingSocket::create_pair().unwrap();
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+    let result = sut.attach(socket_1.file_descriptor());
+
+    assert_that!(result.err(), eq Some(IoUringAttachmentError::AlreadyAttached));
+}
+
+#[test]
+pub fn attaching_more_fds_than_the_capacity_fails() {
+    test_requires!(io_uring_is_available());
+    let sut = IoUringBuilder::new().capacity(2).create().unwrap();
+
+    let mut sockets = vec![];
+    for _ in 0..=sut.capacity() / 2 {
+        let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+        sockets.push(socket_1);
+        sockets.push(socket_2);
+    }
+
+    let mut guards = vec![];
+    for socket in sockets.iter().take(sut.capacity()) {
+        guards.push(sut.attach(socket.file_descriptor()).unwrap());
+    }
+
+    let result = sut.attach(sockets[sut.capacity()].file_descriptor());
+    assert_that!(result.err(), eq Some(IoUringAttachmentError::ExceedsMaxSupportedAttachments));
+}
+
+#[test]
+pub fn attaching_one_fd_and_triggering_ready_to_read_works() {
+    test_requires!(io_uring_is_available());
+    let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+
+    let mut callback_was_called = false;
+    assert_that!(sut.try_wait(|_| {callback_was_called = true;}).unwrap(), eq 0);
+    assert_that!(callback_was_called, eq false);
+
+    socket_2.try_send(b"hello").unwrap();
+
+    let mut callback_was_called = false;
+    let number_of_triggers = sut
+        .try_wait(|fd| {
+            assert_that!(unsafe { fd.native_handle() }, eq unsafe { socket_1.file_descriptor().native_handle() });
+            callback_was_called = true;
+        })
+        .unwrap();
+
+    assert_that!(number_of_triggers, eq 1);
+    assert_that!(callback_was_called, eq true);
+}
+
+#[test]
+pub fn fd_triggers_until_all_data_is_consumed() {
+    test_requires!(io_uring_is_available());
+    let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+    socket_2.try_send(b"hello").unwrap();
+
+    for _ in 0..3 {
+        assert_that!(sut.try_wait(|_| {}).unwrap(), eq 1);
+    }
+    assert_that!(sut.timed_wait(|_| {}, TIMEOUT).unwrap(), eq 1);
+    assert_that!(sut.blocking_wait(|_| {}).unwrap(), eq 1);
+
+    let mut raw_data = [0u8; 8];
+    socket_1.try_receive(&mut raw_data).unwrap();
+
+    assert_that!(sut.try_wait(|_| {}).unwrap(), eq 0);
+}
+
+#[test]
+pub fn when_guard_is_removed_fd_no_longer_triggers() {
+    test_requires!(io_uring_is_available());
+    let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let guard = sut.attach(socket_1.file_descriptor()).unwrap();
+    assert_that!(sut.try_wait(|_| {}).unwrap(), eq 0);
+
+    drop(guard);
+    socket_2.try_send(b"hello").unwrap();
+
+    let mut callback_was_called = false;
+    assert_that!(sut.timed_wait(|_| {callback_was_called = true;}, TIMEOUT).unwrap(), eq 0);
+    assert_that!(callback_was_called, eq false);
+
+    let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+    assert_that!(sut.try_wait(|_| {}).unwrap(), eq 1);
+}
+
+#[test]
+pub fn attaching_multiple_fd_and_triggering_many_ready_to_read_works() {
+    test_requires!(io_uring_is_available());
+    const NUMBER_OF_ATTACHMENTS: usize = 12;
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let mut sockets = vec![];
+    for _ in 0..NUMBER_OF_ATTACHMENTS / 2 {
+        let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+        sockets.push(socket_1);
+        sockets.push(socket_2);
+    }
+
+    let mut guards = vec![];
+    for socket in &sockets {
+        guards.push(sut.attach(socket.file_descriptor()).unwrap());
+    }
+
+    for socket in &sockets {
+        socket.try_send(b"fuu").unwrap();
+    }
+
+    let mut callback_counter = 0;
+    let number_of_triggers = sut
+        .try_wait(|_| {
+            callback_counter += 1;
+        })
+        .unwrap();
+    assert_that!(number_of_triggers, eq NUMBER_OF_ATTACHMENTS);
+    assert_that!(callback_counter, eq NUMBER_OF_ATTACHMENTS);
+}
+
+#[test]
+pub fn timed_wait_blocks_for_at_least_timeout() {
+    test_requires!(io_uring_is_available());
+    let _watchdog = Watchdog::new();
+    let (socket_1, _socket_2) = StreamingSocket::create_pair().unwrap();
+    let sut = IoUringBuilder::new().create().unwrap();
+
+    let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+
+    let start = Time::now().unwrap();
+    let mut callback_was_called = false;
+    assert_that!(sut.timed_wait(|_| {callback_was_called = true;}, TIMEOUT).unwrap(), eq 0);
+    assert_that!(callback_was_called, eq false);
+    assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+}
+
+#[test]
+pub fn blocking_wait_wakes_up_by_trigger() {
+    test_requires!(io_uring_is_available());
+    let _watchdog = Watchdog::new();
+    let (socket_1, socket_2) = StreamingSocket::create_pair().unwrap();
+
+    let callback_was_called = AtomicBool::new(false);
+    let handle = BarrierHandle::new();
+    let barrier = BarrierBuilder::new(2).create(&handle).unwrap();
+    thread_scope(|s| {
+        s.thread_builder().spawn(|| {
+                let sut = IoUringBuilder::new().create().unwrap();
+                let _guard = sut.attach(socket_1.file_descriptor()).unwrap();
+                barrier.wait();
+                assert_that!(sut.blocking_wait(|_| {callback_was_called.store(true, Ordering::Relaxed);}).unwrap(), eq 1);
+            })?;
+
+        barrier.wait();
+        nanosleep(TIMEOUT).unwrap();
+        assert_that!(callback_was_called.load(Ordering::Relaxed), eq false);
+
+        socket_2.try_send(b"hello").unwrap();
+        // thread should wake up now, if not the watchdog will let the unit test fail
+
+        Ok(())
+    }).unwrap();
+}
@@ -18,4 +18,8 @@ extern crate iceoryx2_bb_loggers;
 #[cfg(target_os = "linux")]
 pub mod epoll_tests;
 #[cfg(target_os = "linux")]
+pub mod futex_tests;
+#[cfg(target_os = "linux")]
+pub mod io_uring_tests;
+#[cfg(target_os = "linux")]
 pub mod signal_fd_tests;
@@ -284,12 +284,17 @@ pub mod details {
             self.verify_init("reset_all()");
 
             for i in 0..self.array_capacity {
-                let value = unsafe { (*self.data_ptr.as_ptr().add(i)).swap(0, Ordering::Relaxed) };
+                let element = unsafe { &*self.data_ptr.as_ptr().add(i) };
+                // avoid the write, and the cache line invalidation, for empty elements
+                if element.load(Ordering::Relaxed) == 0 {
+                    continue;
+                }
+
+                let mut value = element.swap(0, Ordering::Relaxed);
                 let main_index = i * BITSET_ELEMENT_BITSIZE;
-                for b in 0..BITSET_ELEMENT_BITSIZE {
-                    if value & (1 << b) != 0 {
-                        callback(main_index + b);
-                    }
+                while value != 0 {
+                    callback(main_index + value.trailing_zeros() as usize);
+                    value &= value - 1;
                 }
             }
         }
@@ -72,7 +72,7 @@ use core::alloc::Layout;
 use core::fmt::Debug;
 use core::mem::MaybeUninit;
 use iceoryx2_bb_concurrency::atomic::Ordering;
-use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64};
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64, AtomicUsize};
 use iceoryx2_bb_concurrency::cell::{Cell, UnsafeCell};
 use iceoryx2_bb_elementary::bump_allocator::BumpAllocator;
 use iceoryx2_bb_elementary::math::align_to;
@@ -136,8 +136,10 @@ impl ContainerHandle {
 pub struct ContainerState<T: Copy + Debug> {
     container_id: u64,
     current_change_counter: u64,
+    used_capacity: usize,
     data: Vec<MaybeUninit<T>>,
     element_generation_counter: Vec<u64>,
+    changed_indices: Vec<usize>,
 }
 
 impl<T: Copy + Debug> ContainerState<T> {
@@ -145,8 +147,47 @@ impl<T: Copy + Debug> ContainerState<T> {
         Self {
             container_id,
             current_change_counter: 0,
+            used_capacity: 0,
             data: vec![MaybeUninit::uninit(); capacity],
             element_generation_counter: vec![0; capacity],
+            changed_indices: Vec::with_capacity(capacity),
+        }
+    }
+
+    /// Iterates over all elements that were added, replaced or removed with the last
+    /// [`Container::update_state()`] call and calls the callback for each of them, providing
+    /// the index of the element and a reference to the current value or [`None`] when the
+    /// element was removed.
+    ///
+    /// ```
+    /// # extern crate iceoryx2_bb_loggers;
+    ///
+    /// use iceoryx2_bb_lock_free::mpmc::container::*;
+    ///
+    /// let container = FixedSizeContainer::<u128, 128>::new();
+    ///
+    /// let mut state = container.get_state();
+    /// if unsafe { container.update_state(&mut state) } {
+    ///     state.for_each_changed(|index: usize, value: Option<&u128>| {
+    ///         println!("index: {}, value: {:?}", index, value);
+    ///         CallbackProgression::Continue
+    ///     });
+    /// }
+    /// ```
+    pub fn for_each_changed<F: FnMut(usize, Option<&T>) -> CallbackProgression>(
+        &self,
+        mut callback: F,
+    ) {
+        for index in self.changed_indices.iter().copied() {
+            let value = if Container::<T>::contains_data(self.element_generation_counter[index]) {
+                Some(unsafe { self.data[index].assume_init_ref() })
+            } else {
+                None
+            };
+
+            if callback(index, value) == CallbackProgression::Stop {
+                return;
+            }
         }
     }
 
@@ -168,7 +209,7 @@ impl<T: Copy + Debug> ContainerState<T> {
     /// });
     /// ```
     pub fn for_each<F: FnMut(usize, &T) -> CallbackProgression>(&self, mut callback: F) {
-        for index in 0..self.data.len() {
+        for index in 0..self.used_capacity {
             if Container::<T>::contains_data(self.element_generation_counter[index])
                 && callback(index, unsafe { self.data[index].assume_init_ref() })
                     == CallbackProgression::Stop
@@ -190,6 +231,10 @@ pub struct Container<T: Copy + Debug> {
     element_generation_counter_ptr: RelocatablePointer<AtomicU64>,
     data_ptr: RelocatablePointer<UnsafeCell<MaybeUninit<T>>>,
     capacity: usize,
+    // the indices are always acquired from the front, therefore every index above the
+    // highest index that was ever in use is empty and can be skipped in
+    // `Container::update_state()`
+    used_capacity: AtomicUsize,
     change_counter: AtomicU64,
     is_initialized: AtomicBool,
     container_id: UniqueId,
@@ -213,6 +258,7 @@ impl<T: Copy + Debug> RelocatableContainer for Container<T> {
                 distance_to_active_index as usize + capacity * core::mem::size_of::<AtomicBool>(),
             ) as isize),
             capacity,
+            used_capacity: AtomicUsize::new(0),
             change_counter: AtomicU64::new(0),
             index_set: unsafe { RobustUniqueIndexSet::new_uninit(capacity) },
             is_initialized: AtomicBool::new(false),
@@ -303,6 +349,12 @@ impl<T: Copy + Debug> Container<T> {
         self.len() == 0
     }
 
+    /// Returns the number of leading elements that were used at least once. Every element at
+    /// or above this index is empty and is not scanned by [`Container::update_state()`].
+    pub fn used_capacity(&self) -> usize {
+        self.used_capacity.load(Ordering::Relaxed)
+    }
+
     /// Adds a new element to the [`Container`]. If there is no more space available it returns
     /// [`None`], otherwise [`Some`] containing the the index value to the underlying element.
     ///
@@ -322,6 +374,10 @@ impl<T: Copy + Debug> Container<T> {
         unsafe {
             let index = self.index_set.acquire(owner_id)?;
 
+            // MUST HAPPEN BEFORE the change counter is incremented, a reader that sees the
+            // new change counter must also see the new used capacity
+            self.used_capacity.fetch_max(index + 1, Ordering::Release);
+
             let element_generation_counter =
                 &*self.element_generation_counter_ptr.as_ptr().add(index as _);
 
@@ -544,7 +600,8 @@ impl<T: Copy + Debug> Container<T> {
     }
 
     /// Syncs the [`ContainerState`] with the current state of the [`Container`]. If the state has
-    /// changed it returns true, otherwise false.
+    /// changed it returns true, otherwise false. The changed elements can be acquired with
+    /// [`ContainerState::for_each_changed()`].
     ///
     /// # Safety
     ///
@@ -561,6 +618,7 @@ impl<T: Copy + Debug> Container<T> {
         // MUST HAPPEN BEFORE all other operations
         let current_change_counter = self.change_counter.load(Ordering::Acquire);
 
+        previous_state.changed_indices.clear();
         if previous_state.current_change_counter == current_change_counter {
             return false;
         }
@@ -571,7 +629,11 @@ impl<T: Copy + Debug> Container<T> {
         let element_generation_counter_ptr =
             unsafe { self.element_generation_counter_ptr.as_ptr() };
 
-        for i in 0..self.capacity {
+        // the used capacity never shrinks, all elements above it are still empty
+        let used_capacity = self.used_capacity.load(Ordering::Acquire);
+        previous_state.used_capacity = used_capacity;
+
+        for i in 0..used_capacity {
             let element_generation_counter = unsafe { &*element_generation_counter_ptr.add(i) };
 
             // go through here element by element and do not start the operation from the
@@ -585,6 +647,10 @@ impl<T: Copy + Debug> Container<T> {
             let mut current_element_generation_count =
                 element_generation_counter.load(Ordering::Acquire);
 
+            if current_element_generation_count != previous_state.element_generation_counter[i] {
+                previous_state.changed_indices.push(i);
+            }
+
             loop {
                 if current_element_generation_count == previous_state.element_generation_counter[i]
                 {
@@ -715,6 +781,11 @@ impl<T: Copy + Debug, const CAPACITY: usize> FixedSizeContainer<T, CAPACITY> {
         self.container.is_empty()
     }
 
+    /// See [`Container::used_capacity()`]
+    pub fn used_capacity(&self) -> usize {
+        self.container.used_capacity()
+    }
+
     /// Adds a new element to the [`FixedSizeContainer`]. If there is no more space available it returns
     /// [`None`], otherwise [`Some`] containing the the index value to the underlying element.
     ///
@@ -20,6 +20,12 @@
 //!    when the data allocator provides shared memory.
 //!  * [`FixedSizeCountingBitSet`] - Bitset with a compile time fixed capacity.
 //!
+//! The counters are grouped into [`NUMBER_OF_SUMMARY_BITS`] groups and every group is
+//! represented by a summary bit that is set when a counter of the group is incremented.
+//! `reset_all()` visits only the groups whose summary bit is set. The costs of a drain are
+//! therefore proportional to the number of incremented counters and not to the capacity of
+//! the bitset.
+//!
 //!  # Example
 //!
 //!  ```
@@ -59,6 +65,12 @@ use iceoryx2_log::fatal_panic;
 
 type AtomicBaseType = AtomicU64;
 
+const SUMMARY_WORD_BITSIZE: usize = u64::BITS as usize;
+const NUMBER_OF_SUMMARY_WORDS: usize = 4;
+/// The number of groups a [`CountingBitSet`] is divided into. Every group has a summary bit
+/// that is set when one of its counters is incremented.
+pub const NUMBER_OF_SUMMARY_BITS: usize = NUMBER_OF_SUMMARY_WORDS * SUMMARY_WORD_BITSIZE;
+
 trait AtomicMax {
     fn max_value() -> u64;
 }
@@ -114,6 +126,8 @@ pub mod details {
     pub struct CountingBitSet<PointerType: PointerTrait<AtomicBaseType>> {
         data_ptr: PointerType,
         capacity: usize,
+        group_size: usize,
+        summary: [AtomicU64; NUMBER_OF_SUMMARY_WORDS],
         is_memory_initialized: AtomicBool,
     }
 
@@ -143,6 +157,8 @@ pub mod details {
             Self {
                 data_ptr,
                 capacity,
+                group_size: Self::group_size(capacity),
+                summary: [const { AtomicU64::new(0) }; NUMBER_OF_SUMMARY_WORDS],
                 is_memory_initialized: AtomicBool::new(true),
             }
         }
@@ -154,6 +170,8 @@ pub mod details {
                 Self {
                     data_ptr: RelocatablePointer::new_uninit(),
                     capacity,
+                    group_size: Self::group_size(capacity),
+                    summary: [const { AtomicU64::new(0) }; NUMBER_OF_SUMMARY_WORDS],
                     is_memory_initialized: AtomicBool::new(false),
                 }
             }
@@ -205,6 +223,11 @@ pub mod details {
             self.capacity
         }
 
+        pub(super) const fn group_size(capacity: usize) -> usize {
+            let group_size = capacity.div_ceil(NUMBER_OF_SUMMARY_BITS);
+            if group_size == 0 { 1 } else { group_size }
+        }
+
         #[inline(always)]
         fn verify_init(&self, source: &str) {
             debug_assert!(
@@ -226,7 +249,17 @@ pub mod details {
                 "This should never happen. Out of bounds access with index {id}."
             );
 
-            unsafe { &(*self.data_ptr.as_ptr().add(id)) }.fetch_add(1, Ordering::Relaxed) as _
+            let old_count =
+                unsafe { &(*self.data_ptr.as_ptr().add(id)) }.fetch_add(1, Ordering::Relaxed);
+
+            let group = id / self.group_size;
+            let summary_bit = 1 << (group % SUMMARY_WORD_BITSIZE);
+            let summary = &self.summary[group / SUMMARY_WORD_BITSIZE];
+            // release in combination with the acquire in reset_all() ensures that the
+            // increment is visible when the summary bit is consumed
+            summary.fetch_or(summary_bit, Ordering::Release);
+
+            old_count as _
         }
 
         /// Reset every bit in the [`CountingBitSet`] and call the provided callback for every bit
@@ -234,17 +267,36 @@ pub mod details {
         pub fn reset_all<F: FnMut(BitState)>(&self, mut callback: F) {
             self.verify_init("reset_all()");
 
-            for bit in 0..self.capacity {
-                let count =
-                    unsafe { (*self.data_ptr.as_ptr().add(bit)).swap(0, Ordering::Relaxed) };
-                if count == 0 {
+            for (n, summary) in self.summary.iter().enumerate() {
+                // avoid the write, and the cache line invalidation, for empty regions
+                if summary.load(Ordering::Relaxed) == 0 {
                     continue;
                 }
 
-                callback(BitState {
-                    bit,
-                    count: count as _,
-                })
+                let mut groups = summary.swap(0, Ordering::Acquire);
+                while groups != 0 {
+                    let group = n * SUMMARY_WORD_BITSIZE + groups.trailing_zeros() as usize;
+                    groups &= groups - 1;
+
+                    let begin = group * self.group_size;
+                    let end = (begin + self.group_size).min(self.capacity);
+                    for bit in begin..end {
+                        let counter = unsafe { &*self.data_ptr.as_ptr().add(bit) };
+                        if counter.load(Ordering::Relaxed) == 0 {
+                            continue;
+                        }
+
+                        let count = counter.swap(0, Ordering::Relaxed);
+                        if count == 0 {
+                            continue;
+                        }
+
+                        callback(BitState {
+                            bit,
+                            count: count as _,
+                        })
+                    }
+                }
             }
         }
     }
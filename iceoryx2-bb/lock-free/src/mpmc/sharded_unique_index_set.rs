@@ -0,0 +1,608 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A **threadsafe** and **lock-free** set of indices that distributes its indices over multiple
+//! [`UniqueIndexSet`] shards. Every shard has its own head, therefore concurrent acquisitions
+//! from different shards never contend on the same compare-and-swap operation. When a shard
+//! runs out of indices, the remaining shards are searched for a free index, so that every index
+//! of the set can be acquired from every shard hint.
+//!
+//! An index is always returned to the shard it was acquired from. It can be released from any
+//! thread or process.
+//!
+//! Use the [`ShardedUniqueIndexSet`] instead of the [`UniqueIndexSet`] when many threads or
+//! processes acquire indices at the same time, for instance during the startup of a system.
+//! The [`ShardedUniqueIndexSet`] does not support locking, see
+//! [`ReleaseMode::LockIfLastIndex`].
+//!
+//! # Example
+//!
+//! ```
+//! # extern crate iceoryx2_bb_loggers;
+//!
+//! use iceoryx2_bb_lock_free::mpmc::sharded_unique_index_set::*;
+//!
+//! const CAPACITY: usize = 128;
+//! const NUMBER_OF_SHARDS: usize = 8;
+//!
+//! let index_set = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+//!
+//! // use for instance the cpu core or the thread id as hint
+//! let shard_hint = 3;
+//! let new_index = match index_set.acquire_with_hint(shard_hint) {
+//!     Err(_) => panic!("Out of indices"),
+//!     Ok(i) => i,
+//! };
+//!
+//! println!("Acquired index {}", new_index.value());
+//!
+//! // return the index to its shard
+//! drop(new_index);
+//! ```
+
+use core::alloc::Layout;
+use core::fmt::Debug;
+use core::mem::MaybeUninit;
+
+use iceoryx2_bb_concurrency::atomic::Ordering;
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU32};
+use iceoryx2_bb_concurrency::cell::UnsafeCell;
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary::bump_allocator::BumpAllocator;
+use iceoryx2_bb_elementary::relocatable_ptr::RelocatablePointer;
+use iceoryx2_bb_elementary_traits::allocator::{AllocationError, BaseAllocator};
+use iceoryx2_bb_elementary_traits::pointer_trait::PointerTrait;
+use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_log::{fail, fatal_panic};
+
+use crate::mpmc::unique_index_set::UniqueIndexSet;
+use crate::mpmc::unique_index_set_enums::ReleaseMode;
+use crate::mpmc::unique_index_set_enums::UniqueIndexCreationError;
+use crate::mpmc::unique_index_set_enums::UniqueIndexSetAcquireFailure;
+
+/// The number of shards a [`ShardedUniqueIndexSet`] uses when it is created with
+/// [`RelocatableContainer::new_uninit()`].
+pub const DEFAULT_NUMBER_OF_SHARDS: usize = 8;
+
+/// Represents a [`ShardedUniqueIndex`]. When it goes out of scope it releases the index in the
+/// corresponding [`ShardedUniqueIndexSet`] or [`FixedSizeShardedUniqueIndexSet`].
+///
+/// The underlying value can be acquired with [`ShardedUniqueIndex::value()`].
+pub struct ShardedUniqueIndex<'a> {
+    value: u32,
+    index_set: &'a ShardedUniqueIndexSet,
+}
+
+impl Debug for ShardedUniqueIndex<'_> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "ShardedUniqueIndex {{ value: {}, index_set addr: {:#x} }}",
+            self.value,
+            core::ptr::addr_of!(self.index_set) as u64
+        )
+    }
+}
+
+impl ShardedUniqueIndex<'_> {
+    /// Returns the value of the index.
+    pub fn value(&self) -> u32 {
+        self.value
+    }
+}
+
+impl Drop for ShardedUniqueIndex<'_> {
+    fn drop(&mut self) {
+        unsafe { self.index_set.release_raw_index(self.value) };
+    }
+}
+
+#[derive(Debug, Clone, Copy)]
+struct ShardLayout {
+    number_of_shards: u32,
+    shard_capacity: u32,
+}
+
+impl ShardLayout {
+    const fn new(capacity: usize, number_of_shards: usize) -> Self {
+        let capacity = if capacity == 0 { 1 } else { capacity };
+        let number_of_shards = if number_of_shards == 0 {
+            1
+        } else if number_of_shards > capacity {
+            capacity
+        } else {
+            number_of_shards
+        };
+
+        let shard_capacity = capacity.div_ceil(number_of_shards);
+        Self {
+            // reduce the number of shards so that no shard is empty
+            number_of_shards: capacity.div_ceil(shard_capacity) as u32,
+            shard_capacity: shard_capacity as u32,
+        }
+    }
+
+    const fn capacity_of_shard(&self, capacity: u32, shard: u32) -> u32 {
+        let begin = shard * self.shard_capacity;
+        let remaining = capacity - begin;
+        if remaining < self.shard_capacity {
+            remaining
+        } else {
+            self.shard_capacity
+        }
+    }
+}
+
+/// A **non-movable** sharded set of unique indices with a runtime fixed capacity. The compile
+/// time version is called [`FixedSizeShardedUniqueIndexSet`]. See the
+/// [module documentation](self) for details.
+///
+/// # Example
+///
+/// ```
+/// # extern crate iceoryx2_bb_loggers;
+///
+/// use iceoryx2_bb_elementary::bump_allocator::*;
+/// use iceoryx2_bb_lock_free::mpmc::sharded_unique_index_set::*;
+/// use iceoryx2_bb_elementary_traits::relocatable_container::*;
+///
+/// const CAPACITY: usize = 128;
+/// const NUMBER_OF_SHARDS: usize = 4;
+/// let mut memory =
+///     [0u8; ShardedUniqueIndexSet::const_memory_size(CAPACITY, NUMBER_OF_SHARDS)];
+/// let allocator = BumpAllocator::new(core::ptr::NonNull::<u8>::new(memory.as_mut_ptr().cast())
+///     .expect("Precondition failed: Pointer to memory is null"),
+///     memory.len()
+///     );
+///
+/// let mut index_set =
+///     unsafe { ShardedUniqueIndexSet::new_uninit_with_shards(CAPACITY, NUMBER_OF_SHARDS) };
+/// unsafe { index_set.init(&allocator) }.expect("failed to allocate enough memory");
+///
+/// let new_index = match unsafe { index_set.acquire() } {
+///     Err(_) => panic!("Out of indices"),
+///     Ok(i) => i,
+/// };
+/// ```
+#[repr(C)]
+#[derive(Debug, ZeroCopySend)]
+pub struct ShardedUniqueIndexSet {
+    shards_ptr: RelocatablePointer<UniqueIndexSet>,
+    capacity: u32,
+    number_of_shards: u32,
+    shard_capacity: u32,
+    next_shard: AtomicU32,
+    is_memory_initialized: AtomicBool,
+}
+
+unsafe impl Sync for ShardedUniqueIndexSet {}
+unsafe impl Send for ShardedUniqueIndexSet {}
+
+impl RelocatableContainer for ShardedUniqueIndexSet {
+    unsafe fn new_uninit(capacity: usize) -> Self {
+        unsafe { Self::new_uninit_with_shards(capacity, DEFAULT_NUMBER_OF_SHARDS) }
+    }
+
+    unsafe fn init<T: BaseAllocator>(&mut self, allocator: &T) -> Result<(), AllocationError> {
+        let msg = "Failed to initialize";
+
+        if self.is_memory_initialized.load(Ordering::Relaxed) {
+            fatal_panic!(from self, "Memory already initialized. Initializing it twice may lead to undefined behavior.");
+        }
+
+        let layout = match Layout::array::<UniqueIndexSet>(self.number_of_shards as usize) {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with AllocationError::SizeTooLarge,
+                    "{msg} since the provided number of shards would exceed the maximum supported size. [{e:?}]");
+            }
+        };
+
+        unsafe {
+            self.shards_ptr
+                .init(fail!(from self, when allocator.allocate(layout),
+                "{msg} since the allocation of the shards failed."));
+
+            let shard_layout = self.shard_layout();
+            for n in 0..self.number_of_shards {
+                let shard = (self.shards_ptr.as_ptr() as *mut UniqueIndexSet).add(n as usize);
+                shard.write(UniqueIndexSet::new_uninit(
+                    shard_layout.capacity_of_shard(self.capacity, n) as usize,
+                ));
+                fail!(from self, when (*shard).init(allocator),
+                    "{msg} since the shard {n} could not be initialized.");
+            }
+        }
+
+        self.is_memory_initialized.store(true, Ordering::Relaxed);
+        Ok(())
+    }
+
+    fn memory_size(capacity: usize) -> usize {
+        Self::const_memory_size(capacity, DEFAULT_NUMBER_OF_SHARDS)
+    }
+}
+
+impl ShardedUniqueIndexSet {
+    /// Creates a new uninitialized [`ShardedUniqueIndexSet`] that distributes its `capacity`
+    /// over `number_of_shards` shards. The number of shards is reduced when it exceeds the
+    /// capacity.
+    ///
+    /// # Safety
+    ///
+    ///  * [`ShardedUniqueIndexSet::init()`] must be called once before it is used.
+    ///  * The allocator provided to [`ShardedUniqueIndexSet::init()`] must provide at least
+    ///    [`ShardedUniqueIndexSet::const_memory_size()`] bytes.
+    ///
+    pub unsafe fn new_uninit_with_shards(capacity: usize, number_of_shards: usize) -> Self {
+        debug_assert!(
+            capacity < 2usize.pow(24) - 1,
+            "The provided capacity exceeds the maximum supported capacity of the ShardedUniqueIndexSet"
+        );
+
+        let shard_layout = ShardLayout::new(capacity, number_of_shards);
+        Self {
+            shards_ptr: unsafe { RelocatablePointer::new_uninit() },
+            capacity: capacity as u32,
+            number_of_shards: shard_layout.number_of_shards,
+            shard_capacity: shard_layout.shard_capacity,
+            next_shard: AtomicU32::new(0),
+            is_memory_initialized: AtomicBool::new(false),
+        }
+    }
+
+    #[inline(always)]
+    fn verify_init(&self, source: &str) {
+        debug_assert!(
+            self.is_memory_initialized.load(Ordering::Relaxed),
+            "Undefined behavior when calling ShardedUniqueIndexSet::{source} and the object is not initialized."
+        );
+    }
+
+    fn shard_layout(&self) -> ShardLayout {
+        ShardLayout {
+            number_of_shards: self.number_of_shards,
+            shard_capacity: self.shard_capacity,
+        }
+    }
+
+    fn shard(&self, n: u32) -> &UniqueIndexSet {
+        debug_assert!(n < self.number_of_shards);
+        unsafe { &*self.shards_ptr.as_ptr().add(n as usize) }
+    }
+
+    /// The compile time version of [`ShardedUniqueIndexSet::memory_size()`] for a custom number
+    /// of shards.
+    pub const fn const_memory_size(capacity: usize, number_of_shards: usize) -> usize {
+        let shard_layout = ShardLayout::new(capacity, number_of_shards);
+        let number_of_shards = shard_layout.number_of_shards as usize;
+
+        core::mem::size_of::<UniqueIndexSet>() * number_of_shards
+            + core::mem::align_of::<UniqueIndexSet>()
+            - 1
+            + UniqueIndexSet::const_memory_size(shard_layout.shard_capacity as usize)
+                * number_of_shards
+    }
+
+    /// Returns the capacity of the [`ShardedUniqueIndexSet`].
+    pub fn capacity(&self) -> u32 {
+        self.capacity
+    }
+
+    /// Returns the number of shards.
+    pub fn number_of_shards(&self) -> u32 {
+        self.number_of_shards
+    }
+
+    /// Returns the number of borrowed indices of all shards. Since the shards are not read
+    /// atomically together, the value is only a snapshot when indices are acquired or released
+    /// concurrently.
+    pub fn borrowed_indices(&self) -> usize {
+        (0..self.number_of_shards)
+            .map(|n| self.shard(n).borrowed_indices())
+            .sum()
+    }
+
+    /// Acquires a new [`ShardedUniqueIndex`] from the next shard in a round robin fashion. If
+    /// the set does not contain any more indices it returns
+    /// [`UniqueIndexSetAcquireFailure::OutOfIndices`].
+    ///
+    /// # Safety
+    ///
+    /// * Ensure that [`ShardedUniqueIndexSet::init()`] was called once.
+    ///
+    pub unsafe fn acquire(&self) -> Result<ShardedUniqueIndex<'_>, UniqueIndexSetAcquireFailure> {
+        self.verify_init("acquire()");
+        unsafe { self.acquire_raw_index() }.map(|v| ShardedUniqueIndex {
+            value: v,
+            index_set: self,
+        })
+    }
+
+    /// Acquires a new [`ShardedUniqueIndex`] and starts the search in the shard that
+    /// corresponds to `shard_hint`. Callers that provide a hint that is stable for the
+    /// calling thread or cpu core, like the core id, acquire their indices mostly
+    /// from their own shard.
+    ///
+    /// # Safety
+    ///
+    /// * Ensure that [`ShardedUniqueIndexSet::init()`] was called once.
+    ///
+    pub unsafe fn acquire_with_hint(
+        &self,
+        shard_hint: usize,
+    ) -> Result<ShardedUniqueIndex<'_>, UniqueIndexSetAcquireFailure> {
+        self.verify_init("acquire_with_hint()");
+        unsafe { self.acquire_raw_index_with_hint(shard_hint) }.map(|v| ShardedUniqueIndex {
+            value: v,
+            index_set: self,
+        })
+    }
+
+    /// Acquires a raw ([`u32`]) index from the next shard in a round robin fashion. The
+    /// selection of the shard is a single atomic increment that never has to be retried.
+    /// The index **must** be returned manually with
+    /// [`ShardedUniqueIndexSet::release_raw_index()`].
+    ///
+    /// # Safety
+    ///
+    ///  * Ensure that [`ShardedUniqueIndexSet::init()`] was called once.
+    ///  * The index must be manually released with
+    ///    [`ShardedUniqueIndexSet::release_raw_index()`] otherwise the index is leaked.
+    pub unsafe fn acquire_raw_index(&self) -> Result<u32, UniqueIndexSetAcquireFailure> {
+        self.verify_init("acquire_raw_index()");
+        let shard_hint = self.next_shard.fetch_add(1, Ordering::Relaxed);
+        unsafe { self.acquire_raw_index_with_hint(shard_hint as usize) }
+    }
+
+    /// Acquires a raw ([`u32`]) index and starts the search in the shard that corresponds to
+    /// `shard_hint`. When the shard is empty, the index is taken from the next shard that
+    /// contains free indices. The index **must** be returned manually with
+    /// [`ShardedUniqueIndexSet::release_raw_index()`].
+    ///
+    /// # Safety
+    ///
+    ///  * Ensure that [`ShardedUniqueIndexSet::init()`] was called once.
+    ///  * The index must be manually released with
+    ///    [`ShardedUniqueIndexSet::release_raw_index()`] otherwise the index is leaked.
+    pub unsafe fn acquire_raw_index_with_hint(
+        &self,
+        shard_hint: usize,
+    ) -> Result<u32, UniqueIndexSetAcquireFailure> {
+        self.verify_init("acquire_raw_index_with_hint()");
+        let first_shard = (shard_hint % self.number_of_shards as usize) as u32;
+
+        for n in 0..self.number_of_shards {
+            let shard = (first_shard + n) % self.number_of_shards;
+            match unsafe { self.shard(shard).acquire_raw_index() } {
+                Ok(index) => return Ok(shard * self.shard_capacity + index),
+                Err(UniqueIndexSetAcquireFailure::OutOfIndices) => continue,
+                Err(e) => return Err(e),
+            }
+        }
+
+        Err(UniqueIndexSetAcquireFailure::OutOfIndices)
+    }
+
+    /// Releases a raw index into the shard it was acquired from.
+    ///
+    /// # Safety
+    ///
+    ///  * Ensure that [`ShardedUniqueIndexSet::init()`] was called once.
+    ///  * It must be ensured that the index was acquired before and is not released twice.
+    ///  * Shall be only used when the index was acquired with
+    ///    [`ShardedUniqueIndexSet::acquire_raw_index()`] or
+    ///    [`ShardedUniqueIndexSet::acquire_raw_index_with_hint()`]
+    pub unsafe fn release_raw_index(&self, index: u32) {
+        self.verify_init("release_raw_index()");
+        debug_assert!(index < self.capacity);
+
+        let shard = index / self.shard_capacity;
+        unsafe {
+            self.shard(shard)
+                .release_raw_index(index % self.shard_capacity, ReleaseMode::Default)
+        };
+    }
+}
+
+/// The compile time fixed size version of the [`ShardedUniqueIndexSet`].
+///
+/// # Example
+///
+/// ```
+/// # extern crate iceoryx2_bb_loggers;
+///
+/// use iceoryx2_bb_lock_free::mpmc::sharded_unique_index_set::*;
+///
+/// const CAPACITY: usize = 128;
+/// const NUMBER_OF_SHARDS: usize = 8;
+///
+/// let index_set = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+///
+/// let new_index = match index_set.acquire() {
+///     Err(_) => panic!("Out of indices"),
+///     Ok(i) => i,
+/// };
+/// ```
+#[derive(Debug)]
+#[repr(C)]
+pub struct FixedSizeShardedUniqueIndexSet<const CAPACITY: usize, const NUMBER_OF_SHARDS: usize> {
+    pub(crate) state: ShardedUniqueIndexSet,
+    shards: [MaybeUninit<UniqueIndexSet>; NUMBER_OF_SHARDS],
+    next_free_index: [UnsafeCell<u32>; CAPACITY],
+    next_free_index_plus_one: [UnsafeCell<u32>; NUMBER_OF_SHARDS],
+}
+
+impl<const CAPACITY: usize, const NUMBER_OF_SHARDS: usize> Default
+    for FixedSizeShardedUniqueIndexSet<CAPACITY, NUMBER_OF_SHARDS>
+{
+    fn default() -> Self {
+        Self::new_with_reduced_capacity(CAPACITY).expect("Does not exceed supported capacity.")
+    }
+}
+
+unsafe impl<const CAPACITY: usize, const NUMBER_OF_SHARDS: usize> Sync
+    for FixedSizeShardedUniqueIndexSet<CAPACITY, NUMBER_OF_SHARDS>
+{
+}
+unsafe impl<const CAPACITY: usize, const NUMBER_OF_SHARDS: usize> Send
+    for FixedSizeShardedUniqueIndexSet<CAPACITY, NUMBER_OF_SHARDS>
+{
+}
+
+impl<const CAPACITY: usize, const NUMBER_OF_SHARDS: usize>
+    FixedSizeShardedUniqueIndexSet<CAPACITY, NUMBER_OF_SHARDS>
+{
+    /// Creates a new [`FixedSizeShardedUniqueIndexSet`].
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Creates a new [`FixedSizeShardedUniqueIndexSet`] where the capacity is reduced. If the
+    /// capacity is greater than CAPACITY or zero it fails.
+    pub fn new_with_reduced_capacity(capacity: usize) -> Result<Self, UniqueIndexCreationError> {
+        let origin = "FixedSizeShardedUniqueIndexSet::new_with_reduced_capacity";
+        if capacity > CAPACITY {
+            fail!(from origin, with UniqueIndexCreationError::ProvidedCapacityGreaterThanMaxCapacity,
+                "Provided capacity value {} exceeds maximum supported capacity of {}.",
+                capacity, CAPACITY);
+        }
+
+        if capacity == 0 {
+            fail!(from origin, with UniqueIndexCreationError::ProvidedCapacityIsZero,
+                "Provided capacity value is zero.");
+        }
+
+        let mut new_self = Self {
+            state: unsafe {
+                ShardedUniqueIndexSet::new_uninit_with_shards(capacity, NUMBER_OF_SHARDS)
+            },
+            shards: core::array::from_fn(|_| MaybeUninit::uninit()),
+            next_free_index: core::array::from_fn(|_| UnsafeCell::new(0)),
+            next_free_index_plus_one: core::array::from_fn(|_| UnsafeCell::new(0)),
+        };
+
+        // SAFETY: Creating a pointer to an existing member is always not null
+        let data_ptr =
+            unsafe { core::ptr::NonNull::<u8>::new_unchecked(new_self.shards.as_mut_ptr().cast()) };
+
+        let allocator = BumpAllocator::new(
+            data_ptr,
+            size_of::<Self>() - core::mem::offset_of!(Self, shards),
+        );
+        unsafe {
+            new_self
+                .state
+                .init(&allocator)
+                .expect("All required memory is preallocated.")
+        };
+
+        Ok(new_self)
+    }
+
+    /// See [`ShardedUniqueIndexSet::acquire()`]
+    pub fn acquire(&self) -> Result<ShardedUniqueIndex<'_>, UniqueIndexSetAcquireFailure> {
+        unsafe { self.state.acquire() }
+    }
+
+    /// See [`ShardedUniqueIndexSet::acquire_with_hint()`]
+    pub fn acquire_with_hint(
+        &self,
+        shard_hint: usize,
+    ) -> Result<ShardedUniqueIndex<'_>, UniqueIndexSetAcquireFailure> {
+        unsafe { self.state.acquire_with_hint(shard_hint) }
+    }
+
+    /// See [`ShardedUniqueIndexSet::capacity()`]
+    pub fn capacity(&self) -> u32 {
+        self.state.capacity()
+    }
+
+    /// See [`ShardedUniqueIndexSet::number_of_shards()`]
+    pub fn number_of_shards(&self) -> u32 {
+        self.state.number_of_shards()
+    }
+
+    /// See [`ShardedUniqueIndexSet::acquire_raw_index()`]
+    ///
+    /// # Safety
+    ///
+    ///  * The acquired index must be returned manually with
+    ///    [`FixedSizeShardedUniqueIndexSet::release_raw_index()`]
+    ///
+    pub unsafe fn acquire_raw_index(&self) -> Result<u32, UniqueIndexSetAcquireFailure> {
+        unsafe { self.state.acquire_raw_index() }
+    }
+
+    /// See [`ShardedUniqueIndexSet::acquire_raw_index_with_hint()`]
+    ///
+    /// # Safety
+    ///
+    ///  * The acquired index must be returned manually with
+    ///    [`FixedSizeShardedUniqueIndexSet::release_raw_index()`]
+    ///
+    pub unsafe fn acquire_raw_index_with_hint(
+        &self,
+        shard_hint: usize,
+    ) -> Result<u32, UniqueIndexSetAcquireFailure> {
+        unsafe { self.state.acquire_raw_index_with_hint(shard_hint) }
+    }
+
+    /// See [`ShardedUniqueIndexSet::release_raw_index()`]
+    ///
+    /// # Safety
+    ///
+    ///  * The release index must have been acquired with
+    ///    [`FixedSizeShardedUniqueIndexSet::acquire_raw_index()`] or
+    ///    [`FixedSizeShardedUniqueIndexSet::acquire_raw_index_with_hint()`]
+    ///  * The index should not be released twice
+    ///
+    pub unsafe fn release_raw_index(&self, index: u32) {
+        unsafe { self.state.release_raw_index(index) }
+    }
+
+    /// See [`ShardedUniqueIndexSet::borrowed_indices()`]
+    pub fn borrowed_indices(&self) -> usize {
+        self.state.borrowed_indices()
+    }
+}
+
+#[cfg(test)]
+mod test {
+    extern crate iceoryx2_bb_loggers;
+
+    use iceoryx2_bb_testing::assert_that;
+
+    use super::ShardLayout;
+
+    #[test]
+    fn shard_layout_distributes_capacity_over_shards() {
+        let sut = ShardLayout::new(10, 4);
+
+        assert_that!(sut.number_of_shards, eq 4);
+        assert_that!(sut.shard_capacity, eq 3);
+        assert_that!(sut.capacity_of_shard(10, 0), eq 3);
+        assert_that!(sut.capacity_of_shard(10, 3), eq 1);
+    }
+
+    #[test]
+    fn shard_layout_does_not_create_empty_shards() {
+        let sut = ShardLayout::new(9, 4);
+        assert_that!(sut.number_of_shards, eq 3);
+        assert_that!(sut.shard_capacity, eq 3);
+
+        let sut = ShardLayout::new(2, 8);
+        assert_that!(sut.number_of_shards, eq 2);
+        assert_that!(sut.shard_capacity, eq 1);
+    }
+}
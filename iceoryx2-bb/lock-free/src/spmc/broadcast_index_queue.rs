@@ -0,0 +1,483 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A **threadsafe** **lock-free** single producer multi consumer broadcast ring which can
+//! store [`u64`] integers or indices. Every [`Reader`] owns its own cursor and receives every
+//! value, so the cost of [`Producer::push()`] does not depend on the number of readers. The
+//! producer never waits for readers, it overwrites the oldest value instead. A reader that
+//! falls behind by more than the capacity is informed with a [`BroadcastOverrun`] how many
+//! values it missed and continues with the oldest value still contained in the ring.
+//!
+//! # Example
+//!
+//! ```
+//! # extern crate iceoryx2_bb_loggers;
+//!
+//! use iceoryx2_bb_lock_free::spmc::broadcast_index_queue::*;
+//!
+//! const QUEUE_CAPACITY: usize = 128;
+//! let queue = FixedSizeBroadcastIndexQueue::<QUEUE_CAPACITY>::new();
+//!
+//! let mut reader_1 = queue.reader();
+//! let mut reader_2 = queue.reader();
+//!
+//! let mut producer = match queue.acquire_producer() {
+//!     None => panic!("a producer has been already acquired."),
+//!     Some(p) => p,
+//! };
+//!
+//! producer.push(1234);
+//!
+//! for reader in [&mut reader_1, &mut reader_2] {
+//!     match reader.pop() {
+//!         Ok(None) => println!("no new values"),
+//!         Ok(Some(v)) => println!("got {}", v),
+//!         Err(e) => println!("missed {} values", e.number_of_missed_values),
+//!     }
+//! }
+//! ```
+
+use core::{alloc::Layout, fmt::Debug};
+
+use iceoryx2_bb_concurrency::atomic::Ordering;
+use iceoryx2_bb_concurrency::atomic::fence;
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64};
+use iceoryx2_bb_elementary::cache_aligned::CacheAligned;
+use iceoryx2_bb_elementary::math::unaligned_mem_size;
+use iceoryx2_bb_elementary::{bump_allocator::BumpAllocator, relocatable_ptr::RelocatablePointer};
+use iceoryx2_bb_elementary_traits::{
+    owning_pointer::OwningPointer, pointer_trait::PointerTrait,
+    relocatable_container::RelocatableContainer,
+};
+use iceoryx2_log::{fail, fatal_panic};
+
+/// Returned by [`Reader::pop()`] when the [`Producer`] has overwritten values that the
+/// [`Reader`] has not yet read.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct BroadcastOverrun {
+    /// The number of values the [`Reader`] missed. The next [`Reader::pop()`] returns the
+    /// oldest value that is still stored in the queue.
+    pub number_of_missed_values: u64,
+}
+
+/// A single element of the [`BroadcastIndexQueue`]. The sequence number identifies the
+/// position of the stored value and whether it is currently being written.
+#[derive(Debug)]
+#[repr(C)]
+pub struct BroadcastSlot {
+    sequence: AtomicU64,
+    value: AtomicU64,
+}
+
+impl BroadcastSlot {
+    const fn new() -> Self {
+        Self {
+            sequence: AtomicU64::new(0),
+            value: AtomicU64::new(0),
+        }
+    }
+}
+
+/// The [`Producer`] of the [`BroadcastIndexQueue`]/[`FixedSizeBroadcastIndexQueue`] which can
+/// add values to it via [`Producer::push()`].
+#[derive(Debug)]
+pub struct Producer<'a, PointerType: PointerTrait<BroadcastSlot>> {
+    queue: &'a details::BroadcastIndexQueue<PointerType>,
+}
+
+impl<PointerType: PointerTrait<BroadcastSlot> + Debug> Producer<'_, PointerType> {
+    /// Adds a new value to the [`BroadcastIndexQueue`]/[`FixedSizeBroadcastIndexQueue`]. If
+    /// the queue is full the oldest value is overwritten.
+    pub fn push(&mut self, value: u64) {
+        unsafe { self.queue.push(value) }
+    }
+}
+
+impl<PointerType: PointerTrait<BroadcastSlot>> Drop for Producer<'_, PointerType> {
+    fn drop(&mut self) {
+        self.queue.has_producer.store(
+            true,
+            // SYNC POINT: producer
+            // sync the internal state with the next producer in another thread
+            Ordering::Release,
+        );
+    }
+}
+
+/// A [`Reader`] of the [`BroadcastIndexQueue`]/[`FixedSizeBroadcastIndexQueue`] which
+/// acquires values from it via [`Reader::pop()`]. Its cursor is stored only in the reader,
+/// therefore an arbitrary number of readers can be created.
+#[derive(Debug)]
+pub struct Reader<'a, PointerType: PointerTrait<BroadcastSlot>> {
+    queue: &'a details::BroadcastIndexQueue<PointerType>,
+    position: u64,
+}
+
+impl<PointerType: PointerTrait<BroadcastSlot> + Debug> Reader<'_, PointerType> {
+    /// Acquires the next value from the [`BroadcastIndexQueue`]/[`FixedSizeBroadcastIndexQueue`].
+    /// Returns [`None`] when no new value is available. If the [`Producer`] has overwritten
+    /// values that were not yet read, it returns a [`BroadcastOverrun`] and continues with the
+    /// oldest available value on the next call.
+    pub fn pop(&mut self) -> Result<Option<u64>, BroadcastOverrun> {
+        self.queue.pop(&mut self.position)
+    }
+
+    /// Returns true when the [`Reader`] has read all values that were pushed so far,
+    /// otherwise false.
+    /// Note: This method may make only sense in a non-concurrent setup since the information
+    ///       could be out-of-date as soon as it is acquired.
+    pub fn is_empty(&self) -> bool {
+        self.position == self.queue.write_position.load(Ordering::Relaxed)
+    }
+}
+
+/// Non-relocatable version of the broadcast index queue
+pub type BroadcastIndexQueue = details::BroadcastIndexQueue<OwningPointer<BroadcastSlot>>;
+
+/// Relocatable version of the broadcast index queue
+pub type RelocatableBroadcastIndexQueue =
+    details::BroadcastIndexQueue<RelocatablePointer<BroadcastSlot>>;
+
+pub mod details {
+    use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+
+    use super::*;
+
+    /// A threadsafe lock-free single producer multi consumer broadcast ring with a capacity
+    /// which can be set up at runtime, when the queue is created.
+    #[derive(Debug)]
+    #[repr(C)]
+    pub struct BroadcastIndexQueue<PointerType: PointerTrait<BroadcastSlot>> {
+        data_ptr: PointerType,
+        pub(super) has_producer: AtomicBool,
+        is_memory_initialized: AtomicBool,
+        capacity: usize,
+        // written only by the producer
+        pub(super) write_position: CacheAligned<AtomicU64>,
+    }
+
+    unsafe impl<PointerType: PointerTrait<BroadcastSlot> + ZeroCopySend> ZeroCopySend
+        for BroadcastIndexQueue<PointerType>
+    {
+    }
+    unsafe impl<PointerType: PointerTrait<BroadcastSlot>> Sync for BroadcastIndexQueue<PointerType> {}
+    unsafe impl<PointerType: PointerTrait<BroadcastSlot>> Send for BroadcastIndexQueue<PointerType> {}
+
+    impl BroadcastIndexQueue<OwningPointer<BroadcastSlot>> {
+        pub fn new(capacity: usize) -> Self {
+            let mut data_ptr = OwningPointer::<BroadcastSlot>::new_with_alloc(capacity);
+
+            for i in 0..capacity {
+                unsafe { data_ptr.as_mut_ptr().add(i).write(BroadcastSlot::new()) };
+            }
+
+            Self {
+                data_ptr,
+                capacity,
+                write_position: CacheAligned::new(AtomicU64::new(0)),
+                has_producer: AtomicBool::new(true),
+                is_memory_initialized: AtomicBool::new(true),
+            }
+        }
+    }
+
+    impl RelocatableContainer for BroadcastIndexQueue<RelocatablePointer<BroadcastSlot>> {
+        unsafe fn new_uninit(capacity: usize) -> Self {
+            unsafe {
+                Self {
+                    data_ptr: RelocatablePointer::new_uninit(),
+                    capacity,
+                    write_position: CacheAligned::new(AtomicU64::new(0)),
+                    has_producer: AtomicBool::new(true),
+                    is_memory_initialized: AtomicBool::new(false),
+                }
+            }
+        }
+
+        unsafe fn init<T: iceoryx2_bb_elementary_traits::allocator::BaseAllocator>(
+            &mut self,
+            allocator: &T,
+        ) -> Result<(), iceoryx2_bb_elementary_traits::allocator::AllocationError> {
+            if self.is_memory_initialized.load(Ordering::Relaxed) {
+                fatal_panic!(from self, "Memory already initialized. Initializing it twice may lead to undefined behavior.");
+            }
+            unsafe {
+                self.data_ptr.init(fail!(from self, when allocator
+            .allocate( Layout::from_size_align_unchecked(
+                    core::mem::size_of::<BroadcastSlot>() * self.capacity,
+                    core::mem::align_of::<BroadcastSlot>())),
+            "Failed to initialize since the allocation of the data memory failed."));
+
+                for i in 0..self.capacity {
+                    (self.data_ptr.as_ptr() as *mut BroadcastSlot)
+                        .add(i)
+                        .write(BroadcastSlot::new());
+                }
+            }
+            self.is_memory_initialized.store(true, Ordering::Relaxed);
+            Ok(())
+        }
+
+        fn memory_size(capacity: usize) -> usize {
+            Self::const_memory_size(capacity)
+        }
+    }
+
+    impl<PointerType: PointerTrait<BroadcastSlot> + Debug> BroadcastIndexQueue<PointerType> {
+        #[inline(always)]
+        fn verify_init(&self, source: &str) {
+            debug_assert!(
+                self.is_memory_initialized.load(Ordering::Relaxed),
+                "Undefined behavior when calling BroadcastIndexQueue::{source} and the object is not initialized."
+            );
+        }
+
+        /// Returns the amount of memory required to create a [`BroadcastIndexQueue`] with
+        /// the provided capacity.
+        pub const fn const_memory_size(capacity: usize) -> usize {
+            unaligned_mem_size::<BroadcastSlot>(capacity)
+        }
+
+        fn at(&self, position: u64) -> &BroadcastSlot {
+            unsafe {
+                &*self
+                    .data_ptr
+                    .as_ptr()
+                    .add((position % self.capacity as u64) as usize)
+            }
+        }
+
+        /// Acquires the [`Producer`] of the [`BroadcastIndexQueue`]. This is threadsafe and
+        /// lock-free without restrictions but when another thread has already acquired the
+        /// [`Producer`] it returns [`None`] since it is a single producer
+        /// [`BroadcastIndexQueue`].
+        /// ```
+        /// # extern crate iceoryx2_bb_loggers;
+        ///
+        /// use iceoryx2_bb_lock_free::spmc::broadcast_index_queue::*;
+        ///
+        /// const QUEUE_CAPACITY: usize = 128;
+        /// let queue = FixedSizeBroadcastIndexQueue::<QUEUE_CAPACITY>::new();
+        ///
+        /// let mut producer = match queue.acquire_producer() {
+        ///     None => panic!("a producer has been already acquired."),
+        ///     Some(p) => p,
+        /// };
+        ///
+        /// producer.push(1234);
+        /// ```
+        pub fn acquire_producer(&self) -> Option<Producer<'_, PointerType>> {
+            self.verify_init("acquire_producer()");
+            match self.has_producer.compare_exchange(
+                true,
+                false,
+                // SYNC POINT: producer
+                // sync the internal state with the next producer in another thread
+                Ordering::Acquire,
+                // the producer could not be acquired therefore we do not need to sync anything
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => Some(Producer { queue: self }),
+                Err(_) => None,
+            }
+        }
+
+        /// Creates a new [`Reader`] of the [`BroadcastIndexQueue`]. The [`Reader`] receives
+        /// all values that are pushed after its creation.
+        /// ```
+        /// # extern crate iceoryx2_bb_loggers;
+        ///
+        /// use iceoryx2_bb_lock_free::spmc::broadcast_index_queue::*;
+        ///
+        /// const QUEUE_CAPACITY: usize = 128;
+        /// let queue = FixedSizeBroadcastIndexQueue::<QUEUE_CAPACITY>::new();
+        ///
+        /// let mut reader = queue.reader();
+        ///
+        /// match reader.pop() {
+        ///     Ok(None) => println!("no new values"),
+        ///     Ok(Some(v)) => println!("got {}", v),
+        ///     Err(e) => println!("missed {} values", e.number_of_missed_values),
+        /// }
+        /// ```
+        pub fn reader(&self) -> Reader<'_, PointerType> {
+            self.verify_init("reader()");
+            Reader {
+                queue: self,
+                position: self.write_position.load(Ordering::Acquire),
+            }
+        }
+
+        /// Adds a value to the [`BroadcastIndexQueue`]. If the queue is full the oldest value
+        /// is overwritten.
+        ///
+        /// # Safety
+        ///
+        ///  * [`BroadcastIndexQueue::push()`] cannot be called concurrently. The user has
+        ///    to ensure that at most one thread access this method.
+        ///  * It has to be ensured that the memory is initialized with
+        ///    [`BroadcastIndexQueue::init()`].
+        pub unsafe fn push(&self, value: u64) {
+            // only the producer writes the write position
+            let write_position = self.write_position.load(Ordering::Relaxed);
+            let slot = self.at(write_position);
+
+            // an odd sequence number marks the slot as being written, readers that observe it
+            // discard the value they have read
+            slot.sequence
+                .store(2 * write_position + 1, Ordering::Relaxed);
+            fence(Ordering::Release);
+            slot.value.store(value, Ordering::Relaxed);
+
+            ////////////////
+            // SYNC POINT S
+            ////////////////
+            slot.sequence
+                .store(2 * write_position + 2, Ordering::Release);
+
+            ////////////////
+            // SYNC POINT W
+            ////////////////
+            self.write_position
+                .store(write_position + 1, Ordering::Release);
+        }
+
+        pub(super) fn pop(&self, position: &mut u64) -> Result<Option<u64>, BroadcastOverrun> {
+            let capacity = self.capacity as u64;
+
+            loop {
+                ////////////////
+                // SYNC POINT W
+                ////////////////
+                let write_position = self.write_position.load(Ordering::Acquire);
+                if *position == write_position {
+                    return Ok(None);
+                }
+
+                let oldest_position = write_position.saturating_sub(capacity);
+                if *position < oldest_position {
+                    let number_of_missed_values = oldest_position - *position;
+                    *position = oldest_position;
+                    return Err(BroadcastOverrun {
+                        number_of_missed_values,
+                    });
+                }
+
+                let slot = self.at(*position);
+                let expected_sequence = 2 * *position + 2;
+
+                ////////////////
+                // SYNC POINT S
+                ////////////////
+                let sequence_before = slot.sequence.load(Ordering::Acquire);
+                let value = slot.value.load(Ordering::Relaxed);
+                fence(Ordering::Acquire);
+                let sequence_after = slot.sequence.load(Ordering::Relaxed);
+
+                if sequence_before == expected_sequence && sequence_after == expected_sequence {
+                    *position += 1;
+                    return Ok(Some(value));
+                }
+
+                // the producer overwrote the slot while it was read, the next iteration
+                // reports the overrun
+            }
+        }
+
+        /// Returns the capacity of the [`BroadcastIndexQueue`].
+        pub const fn capacity(&self) -> usize {
+            self.capacity
+        }
+
+        /// Returns the number of values that were pushed into the [`BroadcastIndexQueue`]
+        /// since its creation.
+        /// Note: This method may make only sense in a non-concurrent setup since the information
+        ///       could be out-of-date as soon as it is acquired.
+        pub fn number_of_pushed_values(&self) -> u64 {
+            self.write_position.load(Ordering::Relaxed)
+        }
+    }
+}
+
+/// The compile-time fixed size version of the [`BroadcastIndexQueue`].
+#[derive(Debug)]
+#[repr(C)]
+pub struct FixedSizeBroadcastIndexQueue<const CAPACITY: usize> {
+    state: RelocatableBroadcastIndexQueue,
+    data: [BroadcastSlot; CAPACITY],
+}
+
+unsafe impl<const CAPACITY: usize> Sync for FixedSizeBroadcastIndexQueue<CAPACITY> {}
+unsafe impl<const CAPACITY: usize> Send for FixedSizeBroadcastIndexQueue<CAPACITY> {}
+
+impl<const CAPACITY: usize> Default for FixedSizeBroadcastIndexQueue<CAPACITY> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<const CAPACITY: usize> FixedSizeBroadcastIndexQueue<CAPACITY> {
+    /// Creates a new empty [`FixedSizeBroadcastIndexQueue`].
+    pub fn new() -> Self {
+        let mut new_self = Self {
+            state: unsafe { RelocatableBroadcastIndexQueue::new_uninit(CAPACITY) },
+            data: [const { BroadcastSlot::new() }; CAPACITY],
+        };
+
+        // SAFETY: Creating a pointer to an existing member is always not null
+        let data_ptr =
+            unsafe { core::ptr::NonNull::<u8>::new_unchecked(new_self.data.as_mut_ptr().cast()) };
+
+        let allocator = BumpAllocator::new(
+            data_ptr,
+            size_of::<Self>() - core::mem::offset_of!(Self, data),
+        );
+        unsafe {
+            new_self
+                .state
+                .init(&allocator)
+                .expect("All required memory is preallocated.")
+        };
+
+        new_self
+    }
+
+    /// See [`BroadcastIndexQueue::acquire_producer()`]
+    pub fn acquire_producer(&self) -> Option<Producer<'_, RelocatablePointer<BroadcastSlot>>> {
+        self.state.acquire_producer()
+    }
+
+    /// See [`BroadcastIndexQueue::reader()`]
+    pub fn reader(&self) -> Reader<'_, RelocatablePointer<BroadcastSlot>> {
+        self.state.reader()
+    }
+
+    /// See [`BroadcastIndexQueue::push()`]
+    ///
+    /// # Safety
+    ///
+    /// * It must be ensured that no other thread/process calls this method concurrently
+    ///
+    pub unsafe fn push(&self, value: u64) {
+        unsafe { self.state.push(value) }
+    }
+
+    /// See [`BroadcastIndexQueue::capacity()`]
+    pub const fn capacity(&self) -> usize {
+        self.state.capacity()
+    }
+
+    /// See [`BroadcastIndexQueue::number_of_pushed_values()`]
+    pub fn number_of_pushed_values(&self) -> u64 {
+        self.state.number_of_pushed_values()
+    }
+}
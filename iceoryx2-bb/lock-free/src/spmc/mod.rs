@@ -12,4 +12,5 @@
 
 //! Single producer multi consumer constructs
 
+pub mod broadcast_index_queue;
 pub mod unrestricted_atomic;
@@ -229,6 +229,46 @@ impl UnrestrictedAtomicMgmt {
         }
     }
 
+    #[doc(hidden)]
+    /// Returns a pointer to the cell that contains the latest value and the write cell that
+    /// must be passed to [`UnrestrictedAtomicMgmt::__internal_is_read_consistent()`] to
+    /// verify that the value was not modified while it was read in place.
+    ///
+    /// # Safety
+    ///
+    ///   * see Safety section of core::ptr::add
+    ///   * the value behind the pointer may be modified concurrently, it must be treated as
+    ///     invalid unless [`UnrestrictedAtomicMgmt::__internal_is_read_consistent()`] returns
+    ///     [`true`] after it was read
+    pub unsafe fn __internal_begin_read(
+        &self,
+        value_size: usize,
+        value_alignment: usize,
+        data_ptr: *const u8,
+    ) -> (*const u8, u64) {
+        /////////////////////////
+        // SYNC POINT - read
+        /////////////////////////
+        let write_cell = self.write_cell.load(Ordering::Acquire);
+        let data_cell_ptr = unsafe {
+            Self::__internal_get_data_cell(value_size, value_alignment, data_ptr, write_cell - 1)
+        };
+
+        (data_cell_ptr as *const u8, write_cell)
+    }
+
+    #[doc(hidden)]
+    /// Returns [`true`] when the cell acquired with
+    /// [`UnrestrictedAtomicMgmt::__internal_begin_read()`] was not modified in the meantime.
+    pub fn __internal_is_read_consistent(&self, write_cell: u64) -> bool {
+        /////////////////////////
+        // SYNC POINT - read, orders the in place read before the validation
+        /////////////////////////
+        self.write_cell
+            .compare_exchange(write_cell, write_cell, Ordering::AcqRel, Ordering::Relaxed)
+            .is_ok()
+    }
+
     /// # Safety
     ///
     ///   * see Safety section of core::ptr::add
@@ -47,9 +47,9 @@
 use core::{alloc::Layout, fmt::Debug};
 
 use iceoryx2_bb_concurrency::atomic::AtomicBool;
-use iceoryx2_bb_concurrency::atomic::AtomicU64;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
+use iceoryx2_bb_elementary::cache_aligned::CacheAligned;
 use iceoryx2_bb_elementary::math::unaligned_mem_size;
 use iceoryx2_bb_elementary::{bump_allocator::BumpAllocator, relocatable_ptr::RelocatablePointer};
 use iceoryx2_bb_elementary_traits::{
@@ -58,6 +58,8 @@ use iceoryx2_bb_elementary_traits::{
 };
 use iceoryx2_log::{fail, fatal_panic};
 
+use crate::spsc::OwnedPosition;
+
 /// The [`Producer`] of the [`IndexQueue`]/[`FixedSizeIndexQueue`] which can add values to it
 /// via [`Producer::push()`].
 pub struct Producer<'a, PointerType: PointerTrait<UnsafeCell<u64>> + Debug> {
@@ -70,6 +72,12 @@ impl<PointerType: PointerTrait<UnsafeCell<u64>> + Debug> Producer<'_, PointerTyp
     pub fn push(&mut self, t: u64) -> bool {
         unsafe { self.queue.push(t) }
     }
+
+    /// Adds as many values of `values` to the [`IndexQueue`]/[`FixedSizeIndexQueue`] as fit
+    /// into it and returns the number of added values.
+    pub fn push_many(&mut self, values: &[u64]) -> usize {
+        unsafe { self.queue.push_many(values) }
+    }
 }
 
 impl<PointerType: PointerTrait<UnsafeCell<u64>> + Debug> Drop for Producer<'_, PointerType> {
@@ -116,13 +124,15 @@ pub mod details {
     #[repr(C)]
     #[derive(Debug)]
     pub struct IndexQueue<PointerType: PointerTrait<UnsafeCell<u64>>> {
-        write_position: AtomicU64,
-        read_position: AtomicU64,
         pub(super) has_producer: AtomicBool,
         pub(super) has_consumer: AtomicBool,
         is_memory_initialized: AtomicBool,
         capacity: usize,
         data_ptr: PointerType,
+        // written only by the producer
+        write_position: CacheAligned<OwnedPosition>,
+        // written only by the consumer
+        read_position: CacheAligned<OwnedPosition>,
     }
 
     unsafe impl<PointerType: PointerTrait<UnsafeCell<u64>> + ZeroCopySend> ZeroCopySend
@@ -143,8 +153,8 @@ pub mod details {
             Self {
                 data_ptr,
                 capacity,
-                write_position: AtomicU64::new(0),
-                read_position: AtomicU64::new(0),
+                write_position: OwnedPosition::new(),
+                read_position: OwnedPosition::new(),
                 has_producer: AtomicBool::new(true),
                 has_consumer: AtomicBool::new(true),
                 is_memory_initialized: AtomicBool::new(true),
@@ -157,8 +167,8 @@ pub mod details {
             Self {
                 data_ptr: unsafe { RelocatablePointer::new_uninit() },
                 capacity,
-                write_position: AtomicU64::new(0),
-                read_position: AtomicU64::new(0),
+                write_position: OwnedPosition::new(),
+                read_position: OwnedPosition::new(),
                 has_producer: AtomicBool::new(true),
                 has_consumer: AtomicBool::new(true),
                 is_memory_initialized: AtomicBool::new(false),
@@ -307,15 +317,30 @@ pub mod details {
         ///   * Ensure that no concurrent push occurs. Only one thread at a time is allowed to call
         ///     push.
         pub unsafe fn push(&self, value: u64) -> bool {
-            let write_position = self.write_position.load(Ordering::Relaxed);
-            let is_full =
+            let write_position = self.write_position.position.load(Ordering::Relaxed);
+            let capacity = self.capacity as u64;
+
+            // the read position of the consumer is only loaded when the queue seems to be full
+            // with the last observed read position, otherwise the cache line of the consumer
+            // would be transferred on every push
+            if write_position
+                >= self
+                    .write_position
+                    .observed_peer_position
+                    .load(Ordering::Relaxed)
+                    + capacity
+            {
                 ////////////////
                 // SYNC POINT: reading value has finished
                 ////////////////
-                write_position == self.read_position.load(Ordering::Acquire) + self.capacity as u64;
+                let read_position = self.read_position.position.load(Ordering::Acquire);
+                self.write_position
+                    .observed_peer_position
+                    .store(read_position, Ordering::Relaxed);
 
-            if is_full {
-                return false;
+                if write_position == read_position + capacity {
+                    return false;
+                }
             }
 
             unsafe { self.at(write_position).write(value) };
@@ -323,25 +348,86 @@ pub mod details {
             // SYNC POINT: value content visible in pop
             ////////////////
             self.write_position
+                .position
                 .store(write_position + 1, Ordering::Release);
 
             true
         }
 
-        /// Acquires a value from the queue.
+        /// Pushes as many values of `values` into the queue as fit into it and returns the
+        /// number of pushed values. In contrast to repeated calls of [`IndexQueue::push()`] the
+        /// values are published to the consumer with a single store.
         ///
         /// # Safety
         ///
-        ///   * Ensure that no concurrent pop occurs. Only one thread at a time is allowed to call pop.
-        pub unsafe fn pop(&self) -> Option<u64> {
-            let read_position = self.read_position.load(Ordering::Relaxed);
+        ///   * Ensure that no concurrent push occurs. Only one thread at a time is allowed to call
+        ///     push.
+        pub unsafe fn push_many(&self, values: &[u64]) -> usize {
+            let write_position = self.write_position.position.load(Ordering::Relaxed);
+            let capacity = self.capacity as u64;
+
+            let mut free_slots = self
+                .write_position
+                .observed_peer_position
+                .load(Ordering::Relaxed)
+                + capacity
+                - write_position;
+            if free_slots < values.len() as u64 {
+                ////////////////
+                // SYNC POINT: reading value has finished
+                ////////////////
+                let read_position = self.read_position.position.load(Ordering::Acquire);
+                self.write_position
+                    .observed_peer_position
+                    .store(read_position, Ordering::Relaxed);
+                free_slots = read_position + capacity - write_position;
+            }
+
+            let number_of_values = (values.len() as u64).min(free_slots);
+            if number_of_values == 0 {
+                return 0;
+            }
+
+            for (n, value) in values.iter().take(number_of_values as usize).enumerate() {
+                unsafe { self.at(write_position + n as u64).write(*value) };
+            }
             ////////////////
             // SYNC POINT: value content visible in pop
             ////////////////
-            let is_empty = read_position == self.write_position.load(Ordering::Acquire);
+            self.write_position
+                .position
+                .store(write_position + number_of_values, Ordering::Release);
 
-            if is_empty {
-                return None;
+            number_of_values as usize
+        }
+
+        /// Acquires a value from the queue.
+        ///
+        /// # Safety
+        ///
+        ///   * Ensure that no concurrent pop occurs. Only one thread at a time is allowed to call pop.
+        pub unsafe fn pop(&self) -> Option<u64> {
+            let read_position = self.read_position.position.load(Ordering::Relaxed);
+
+            // the write position of the producer is only loaded when the queue seems to be
+            // empty with the last observed write position
+            if read_position
+                >= self
+                    .read_position
+                    .observed_peer_position
+                    .load(Ordering::Relaxed)
+            {
+                ////////////////
+                // SYNC POINT: value content visible in pop
+                ////////////////
+                let write_position = self.write_position.position.load(Ordering::Acquire);
+                self.read_position
+                    .observed_peer_position
+                    .store(write_position, Ordering::Relaxed);
+
+                if read_position == write_position {
+                    return None;
+                }
             }
 
             let value = unsafe { *self.at(read_position) };
@@ -349,6 +435,7 @@ pub mod details {
             // SYNC POINT: reading value has finished
             ////////////////
             self.read_position
+                .position
                 .store(read_position + 1, Ordering::Release);
 
             Some(value)
@@ -356,11 +443,11 @@ pub mod details {
 
         fn acquire_read_and_write_position(&self) -> (u64, u64) {
             loop {
-                let write_position = self.write_position.load(Ordering::Relaxed);
-                let read_position = self.read_position.load(Ordering::Relaxed);
+                let write_position = self.write_position.position.load(Ordering::Relaxed);
+                let read_position = self.read_position.position.load(Ordering::Relaxed);
 
-                if write_position == self.write_position.load(Ordering::Relaxed)
-                    && read_position == self.read_position.load(Ordering::Relaxed)
+                if write_position == self.write_position.position.load(Ordering::Relaxed)
+                    && read_position == self.read_position.position.load(Ordering::Relaxed)
                 {
                     return (write_position, read_position);
                 }
@@ -479,6 +566,17 @@ impl<const CAPACITY: usize> FixedSizeIndexQueue<CAPACITY> {
         unsafe { self.state.push(value) }
     }
 
+    /// Pushes as many values of `values` into the queue as fit into it and returns the number
+    /// of pushed values.
+    ///
+    /// # Safety
+    ///
+    ///   * Ensure that no concurrent push occurres. Only one thread at a time is allowed to call
+    ///     push.
+    pub unsafe fn push_many(&self, values: &[u64]) -> usize {
+        unsafe { self.state.push_many(values) }
+    }
+
     /// Acquires a value from the queue.
     ///
     /// # Safety
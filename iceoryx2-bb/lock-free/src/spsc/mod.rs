@@ -15,3 +15,28 @@
 pub mod index_queue;
 pub mod queue;
 pub mod safely_overflowing_index_queue;
+
+use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_elementary::cache_aligned::CacheAligned;
+
+/// A position of a queue that is written by only one side, either the producer or the consumer,
+/// together with the last position of the other side that this side has observed. Both share
+/// one cache line that is not shared with the other side so that the hot path of one side does
+/// not invalidate the cache line of the other side.
+#[repr(C)]
+#[derive(Debug)]
+pub(crate) struct OwnedPosition {
+    pub(crate) position: AtomicU64,
+    // A value the other side had at some point in time. Since positions only increase it is
+    // always less or equal to the current position of the other side.
+    pub(crate) observed_peer_position: AtomicU64,
+}
+
+impl OwnedPosition {
+    pub(crate) fn new() -> CacheAligned<Self> {
+        CacheAligned::new(Self {
+            position: AtomicU64::new(0),
+            observed_peer_position: AtomicU64::new(0),
+        })
+    }
+}
@@ -51,6 +51,7 @@ use iceoryx2_bb_concurrency::atomic::AtomicBool;
 use iceoryx2_bb_concurrency::atomic::AtomicU64;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
+use iceoryx2_bb_elementary::cache_aligned::CacheAligned;
 use iceoryx2_bb_elementary::math::unaligned_mem_size;
 use iceoryx2_bb_elementary::{bump_allocator::BumpAllocator, relocatable_ptr::RelocatablePointer};
 use iceoryx2_bb_elementary_traits::{
@@ -59,6 +60,8 @@ use iceoryx2_bb_elementary_traits::{
 };
 use iceoryx2_log::{fail, fatal_panic};
 
+use crate::spsc::OwnedPosition;
+
 /// The [`Producer`] of the [`SafelyOverflowingIndexQueue`]/[`FixedSizeSafelyOverflowingIndexQueue`]
 /// which can add values to it via [`Producer::push()`].
 #[derive(Debug)]
@@ -135,8 +138,12 @@ pub mod details {
         pub(super) has_consumer: AtomicBool,
         is_memory_initialized: AtomicBool,
         capacity: usize,
-        write_position: AtomicU64,
-        read_position: AtomicU64,
+        // the number of elements after which the queue overflows, never exceeds the capacity
+        active_capacity: AtomicU64,
+        // written only by the producer
+        write_position: CacheAligned<OwnedPosition>,
+        // written by the consumer and by the producer when it overflows
+        read_position: CacheAligned<OwnedPosition>,
     }
 
     unsafe impl<PointerType: PointerTrait<UnsafeCell<u64>> + ZeroCopySend> ZeroCopySend
@@ -163,8 +170,9 @@ pub mod details {
             Self {
                 data_ptr,
                 capacity,
-                write_position: AtomicU64::new(0),
-                read_position: AtomicU64::new(0),
+                active_capacity: AtomicU64::new(capacity as u64),
+                write_position: OwnedPosition::new(),
+                read_position: OwnedPosition::new(),
                 has_producer: AtomicBool::new(true),
                 has_consumer: AtomicBool::new(true),
                 is_memory_initialized: AtomicBool::new(true),
@@ -178,8 +186,9 @@ pub mod details {
                 Self {
                     data_ptr: RelocatablePointer::new_uninit(),
                     capacity,
-                    write_position: AtomicU64::new(0),
-                    read_position: AtomicU64::new(0),
+                    active_capacity: AtomicU64::new(capacity as u64),
+                    write_position: OwnedPosition::new(),
+                    read_position: OwnedPosition::new(),
                     has_producer: AtomicBool::new(true),
                     has_consumer: AtomicBool::new(true),
                     is_memory_initialized: AtomicBool::new(false),
@@ -330,9 +339,25 @@ pub mod details {
             ////////////////
             // required when push in overflow case is called non-concurrently from a different
             // thread
-            let write_position = self.write_position.load(Ordering::Acquire);
-            let read_position = self.read_position.load(Ordering::Relaxed);
-            let is_full = write_position == read_position + self.capacity as u64;
+            let write_position = self.write_position.position.load(Ordering::Acquire);
+            let capacity = self.active_capacity.load(Ordering::Relaxed);
+
+            // the read position of the consumer is only loaded when the queue seems to be full
+            // with the last observed read position, otherwise the cache line of the consumer
+            // would be transferred on every push
+            let mut read_position = self
+                .write_position
+                .observed_peer_position
+                .load(Ordering::Relaxed);
+            if write_position >= read_position + capacity {
+                read_position = self.read_position.position.load(Ordering::Relaxed);
+                self.write_position
+                    .observed_peer_position
+                    .store(read_position, Ordering::Relaxed);
+            }
+            // when the active capacity was reduced the queue may contain more elements than it
+            // allows, the overflow returns them one by one until the length is reduced
+            let is_full = write_position >= read_position + capacity;
 
             unsafe { self.at(write_position).write(value) };
 
@@ -340,26 +365,35 @@ pub mod details {
             // SYNC POINT W
             ////////////////
             self.write_position
+                .position
                 .store(write_position + 1, Ordering::Release);
 
-            if is_full
-                && self
-                    .read_position
-                    .compare_exchange(
-                        read_position,
-                        read_position + 1,
-                        ////////////////
-                        // SYNC POINT R
-                        ////////////////
-                        Ordering::AcqRel,
-                        Ordering::Relaxed,
-                    )
-                    .is_ok()
-            {
-                let value = unsafe { *self.at(read_position) };
-                Some(value)
-            } else {
-                None
+            if !is_full {
+                return None;
+            }
+
+            match self.read_position.position.compare_exchange(
+                read_position,
+                read_position + 1,
+                ////////////////
+                // SYNC POINT R
+                ////////////////
+                Ordering::AcqRel,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => {
+                    self.write_position
+                        .observed_peer_position
+                        .store(read_position + 1, Ordering::Relaxed);
+                    let value = unsafe { *self.at(read_position) };
+                    Some(value)
+                }
+                Err(current_read_position) => {
+                    self.write_position
+                        .observed_peer_position
+                        .store(current_read_position, Ordering::Relaxed);
+                    None
+                }
             }
         }
 
@@ -373,11 +407,11 @@ pub mod details {
         ///  * It has to be ensured that the memory is initialized with
         ///    [`SafelyOverflowingIndexQueue::init()`].
         pub unsafe fn pop(&self) -> Option<u64> {
-            let mut read_position = self.read_position.load(Ordering::Relaxed);
+            let mut read_position = self.read_position.position.load(Ordering::Relaxed);
             ////////////////
             // SYNC POINT W
             ////////////////
-            let is_empty = read_position == self.write_position.load(Ordering::Acquire);
+            let is_empty = read_position == self.write_position.position.load(Ordering::Acquire);
 
             if is_empty {
                 return None;
@@ -387,7 +421,7 @@ pub mod details {
             loop {
                 value = unsafe { *self.at(read_position) };
 
-                match self.read_position.compare_exchange(
+                match self.read_position.position.compare_exchange(
                     read_position,
                     read_position + 1,
                     Ordering::Relaxed,
@@ -404,13 +438,37 @@ pub mod details {
             Some(value)
         }
 
+        /// Returns the value that would be acquired by the next
+        /// [`SafelyOverflowingIndexQueue::pop()`] without removing it from the queue. When the
+        /// producer overflows the queue concurrently, the returned value can already be
+        /// removed, therefore it shall only be used as a hint.
+        ///
+        /// # Safety
+        ///
+        ///  * [`SafelyOverflowingIndexQueue::peek()`] cannot be called concurrently to
+        ///    [`SafelyOverflowingIndexQueue::pop()`]. The user has to ensure that at most one
+        ///    thread access these methods.
+        ///  * It has to be ensured that the memory is initialized with
+        ///    [`SafelyOverflowingIndexQueue::init()`].
+        pub unsafe fn peek(&self) -> Option<u64> {
+            let read_position = self.read_position.position.load(Ordering::Acquire);
+            ////////////////
+            // SYNC POINT W
+            ////////////////
+            if read_position == self.write_position.position.load(Ordering::Acquire) {
+                return None;
+            }
+
+            Some(unsafe { *self.at(read_position) })
+        }
+
         fn acquire_read_and_write_position(&self) -> (u64, u64) {
             loop {
-                let write_position = self.write_position.load(Ordering::Relaxed);
-                let read_position = self.read_position.load(Ordering::Relaxed);
+                let write_position = self.write_position.position.load(Ordering::Relaxed);
+                let read_position = self.read_position.position.load(Ordering::Relaxed);
 
-                if write_position == self.write_position.load(Ordering::Relaxed)
-                    && read_position == self.read_position.load(Ordering::Relaxed)
+                if write_position == self.write_position.position.load(Ordering::Relaxed)
+                    && read_position == self.read_position.position.load(Ordering::Relaxed)
                 {
                     return (write_position, read_position);
                 }
@@ -438,12 +496,30 @@ pub mod details {
             self.capacity
         }
 
+        /// Returns the number of elements the [`SafelyOverflowingIndexQueue`] holds before it
+        /// overflows. It is equal to [`SafelyOverflowingIndexQueue::capacity()`] unless it was
+        /// reduced with [`SafelyOverflowingIndexQueue::set_active_capacity()`].
+        pub fn active_capacity(&self) -> usize {
+            self.active_capacity.load(Ordering::Relaxed) as usize
+        }
+
+        /// Sets the number of elements the [`SafelyOverflowingIndexQueue`] holds before it
+        /// overflows. The value is clamped to `1..=`[`SafelyOverflowingIndexQueue::capacity()`]
+        /// and the adjusted value is returned. When the queue contains more elements than the
+        /// new active capacity they stay in the queue until they are acquired by the consumer
+        /// or returned by the next overflowing [`SafelyOverflowingIndexQueue::push()`].
+        pub fn set_active_capacity(&self, value: usize) -> usize {
+            let value = value.clamp(1, self.capacity);
+            self.active_capacity.store(value as u64, Ordering::Relaxed);
+            value
+        }
+
         /// Returns true when the [`SafelyOverflowingIndexQueue`] is full, otherwise false.
         /// Note: This method may make only sense in a non-concurrent setup since the information
         ///       could be out-of-date as soon as it is acquired.
         pub fn is_full(&self) -> bool {
             let (write_position, read_position) = self.acquire_read_and_write_position();
-            write_position == read_position + self.capacity as u64
+            write_position >= read_position + self.active_capacity.load(Ordering::Relaxed)
         }
     }
 }
@@ -533,11 +609,32 @@ impl<const CAPACITY: usize> FixedSizeSafelyOverflowingIndexQueue<CAPACITY> {
         unsafe { self.state.pop() }
     }
 
+    /// See [`SafelyOverflowingIndexQueue::peek()`]
+    ///
+    /// # Safety
+    ///
+    /// * It must be ensured that no other thread/process calls this method or
+    ///   [`FixedSizeSafelyOverflowingIndexQueue::pop()`] concurrently
+    ///
+    pub unsafe fn peek(&self) -> Option<u64> {
+        unsafe { self.state.peek() }
+    }
+
     /// See [`SafelyOverflowingIndexQueue::capacity()`]
     pub const fn capacity(&self) -> usize {
         self.state.capacity()
     }
 
+    /// See [`SafelyOverflowingIndexQueue::active_capacity()`]
+    pub fn active_capacity(&self) -> usize {
+        self.state.active_capacity()
+    }
+
+    /// See [`SafelyOverflowingIndexQueue::set_active_capacity()`]
+    pub fn set_active_capacity(&self, value: usize) -> usize {
+        self.state.set_active_capacity(value)
+    }
+
     /// See [`SafelyOverflowingIndexQueue::is_full()`]
     pub fn is_full(&self) -> bool {
         self.state.is_full()
@@ -19,7 +19,9 @@ pub mod mpmc_bitset_tests;
 pub mod mpmc_container_tests;
 pub mod mpmc_counting_bit_set_tests;
 pub mod mpmc_robust_unique_index_set_tests;
+pub mod mpmc_sharded_unique_index_set_tests;
 pub mod mpmc_unique_index_set_tests;
+pub mod spmc_broadcast_index_queue_tests;
 pub mod spmc_unrestricted_atomic_tests;
 pub mod spsc_index_queue_tests;
 pub mod spsc_queue_tests;
@@ -138,6 +138,46 @@ pub mod generic {
         });
     }
 
+    #[test]
+    pub fn used_capacity_covers_the_highest_index_in_use<
+        T: Debug + Copy + From<usize> + Into<usize> + ZeroCopySend,
+    >() {
+        let sut = FixedSizeContainer::<T, CAPACITY>::new();
+        assert_that!(sut.used_capacity(), eq 0);
+
+        let owner_id = OwnerId::new(2).unwrap();
+        let mut handles = vec![];
+        for i in 0..3 {
+            handles.push(sut.add(i.into(), owner_id).unwrap().1);
+        }
+        assert_that!(sut.used_capacity(), eq 3);
+
+        unsafe { sut.remove(handles.remove(1), ReleaseMode::Default).unwrap() };
+        assert_that!(sut.used_capacity(), eq 3);
+
+        let mut state = sut.get_state();
+        let mut contained_values: Vec<usize> = vec![];
+        state.for_each(|_, value: &T| {
+            contained_values.push((*value).into());
+            CallbackProgression::Continue
+        });
+        assert_that!(contained_values, eq vec![0, 2]);
+
+        // the free index is reused before the used capacity grows
+        handles.push(sut.add(7.into(), owner_id).unwrap().1);
+        assert_that!(sut.used_capacity(), eq 3);
+        handles.push(sut.add(9.into(), owner_id).unwrap().1);
+        assert_that!(sut.used_capacity(), eq 4);
+
+        assert_that!(unsafe { sut.update_state(&mut state) }, eq true);
+        let mut contained_values: Vec<usize> = vec![];
+        state.for_each(|_, value: &T| {
+            contained_values.push((*value).into());
+            CallbackProgression::Continue
+        });
+        assert_that!(contained_values, eq vec![0, 7, 2, 9]);
+    }
+
     #[test]
     pub fn double_remove_is_detected<T: Debug + Copy + From<usize> + Into<usize> + ZeroCopySend>() {
         let sut = FixedSizeContainer::<T, CAPACITY>::new();
@@ -431,6 +471,47 @@ pub mod generic {
         assert_that!(unsafe { sut.update_state(&mut state) }, eq true);
     }
 
+    #[test]
+    pub fn state_provides_only_changed_elements_after_update<
+        T: Debug + Copy + From<usize> + Into<usize> + ZeroCopySend,
+    >() {
+        let sut = FixedSizeContainer::<T, CAPACITY>::new();
+        let owner_id = OwnerId::new(9812).unwrap();
+        let mut stored_indices: Vec<ContainerHandle> = vec![];
+        for i in 0..CAPACITY / 2 {
+            stored_indices.push(sut.add(i.into(), owner_id).unwrap().1);
+        }
+        let mut state = sut.get_state();
+
+        assert_that!(unsafe { sut.update_state(&mut state) }, eq false);
+        let mut number_of_changes = 0;
+        state.for_each_changed(|_, _| {
+            number_of_changes += 1;
+            CallbackProgression::Continue
+        });
+        assert_that!(number_of_changes, eq 0);
+
+        let removed_handle = stored_indices.remove(0);
+        unsafe { sut.remove(removed_handle, ReleaseMode::Default).unwrap() };
+        let added_handle = sut.add(1234.into(), owner_id).unwrap().1;
+
+        assert_that!(unsafe { sut.update_state(&mut state) }, eq true);
+        let mut changes: BTreeMap<usize, Option<usize>> = BTreeMap::new();
+        state.for_each_changed(|index, value: Option<&T>| {
+            changes.insert(index, value.map(|v| (*v).into()));
+            CallbackProgression::Continue
+        });
+
+        if removed_handle.index() == added_handle.index() {
+            assert_that!(changes, len 1);
+            assert_that!(changes[&added_handle.index()], eq Some(1234));
+        } else {
+            assert_that!(changes, len 2);
+            assert_that!(changes[&removed_handle.index()], eq None);
+            assert_that!(changes[&added_handle.index()], eq Some(1234));
+        }
+    }
+
     #[test]
     pub fn concurrent_add_release_for_each<
         T: Debug + Copy + From<usize> + Into<usize> + Send + ZeroCopySend,
@@ -17,7 +17,7 @@ use iceoryx2_bb_elementary::bump_allocator::BumpAllocator;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
 use iceoryx2_bb_lock_free::mpmc::counting_bit_set::{
-    CountingBitSet, FixedSizeCountingBitSet, RelocatableCountingBitSet,
+    CountingBitSet, FixedSizeCountingBitSet, NUMBER_OF_SUMMARY_BITS, RelocatableCountingBitSet,
 };
 use iceoryx2_bb_posix::barrier::{BarrierBuilder, BarrierHandle, Handle};
 use iceoryx2_bb_posix::clock::nanosleep;
@@ -132,6 +132,33 @@ pub fn heap_based_counting_bitset_works() {
     }
 }
 
+#[test]
+pub fn sparse_bits_in_large_bitset_are_reset() {
+    const LARGE_CAPACITY: usize = NUMBER_OF_SUMMARY_BITS * 17 + 5;
+    let sut = CountingBitSet::new(LARGE_CAPACITY);
+    let bits = [0, 16, 17, 18, LARGE_CAPACITY / 2, LARGE_CAPACITY - 1];
+
+    for (n, bit) in bits.iter().enumerate() {
+        for _ in 0..=n {
+            sut.set(*bit);
+        }
+    }
+
+    let mut callback_counter = 0;
+    sut.reset_all(|state| {
+        assert_that!(state.bit(), eq bits[callback_counter]);
+        assert_that!(state.count(), eq callback_counter as u64 + 1);
+        callback_counter += 1;
+    });
+    assert_that!(callback_counter, eq bits.len());
+
+    callback_counter = 0;
+    sut.reset_all(|_| {
+        callback_counter += 1;
+    });
+    assert_that!(callback_counter, eq 0);
+}
+
 #[test]
 pub fn concurrent_set_and_reset_works() {
     let _watchdog = Watchdog::new();
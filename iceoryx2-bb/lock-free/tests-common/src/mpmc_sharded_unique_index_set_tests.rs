@@ -0,0 +1,225 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::collections::BTreeSet;
+use alloc::vec;
+use core::ptr::NonNull;
+use iceoryx2_bb_elementary::bump_allocator::BumpAllocator;
+use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
+use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_lock_free::mpmc::sharded_unique_index_set::*;
+use iceoryx2_bb_lock_free::mpmc::unique_index_set_enums::UniqueIndexSetAcquireFailure;
+use iceoryx2_bb_posix::barrier::{BarrierBuilder, BarrierHandle, Handle};
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_posix::thread::thread_scope;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+
+const CAPACITY: usize = 128;
+const NUMBER_OF_SHARDS: usize = 8;
+
+#[test]
+pub fn capacity_and_number_of_shards_are_set_correctly() {
+    let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+    assert_that!(sut.capacity(), eq CAPACITY as u32);
+    assert_that!(sut.number_of_shards(), eq NUMBER_OF_SHARDS as u32);
+
+    let sut =
+        FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new_with_reduced_capacity(
+            CAPACITY * 2,
+        );
+    assert_that!(sut, is_err);
+
+    let sut =
+        FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new_with_reduced_capacity(0);
+    assert_that!(sut, is_err);
+
+    let sut =
+        FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new_with_reduced_capacity(3);
+    assert_that!(sut, is_ok);
+    let sut = sut.unwrap();
+    assert_that!(sut.capacity(), eq 3);
+    assert_that!(sut.number_of_shards(), eq 3);
+}
+
+#[test]
+pub fn every_index_can_be_acquired_from_every_shard_hint() {
+    for shard_hint in 0..NUMBER_OF_SHARDS * 2 {
+        let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+        let mut ids = vec![];
+        let mut values = BTreeSet::new();
+
+        for _ in 0..CAPACITY {
+            let e = sut.acquire_with_hint(shard_hint);
+            assert_that!(e, is_ok);
+            let e = e.unwrap();
+            assert_that!(e.value(), lt CAPACITY as u32);
+            assert_that!(values.insert(e.value()), eq true);
+            ids.push(e);
+        }
+
+        let e = sut.acquire_with_hint(shard_hint);
+        assert_that!(e, is_err);
+        assert_that!(e.err().unwrap(), eq UniqueIndexSetAcquireFailure::OutOfIndices);
+    }
+}
+
+#[test]
+pub fn different_shard_hints_acquire_from_different_shards() {
+    const SHARD_CAPACITY: u32 = (CAPACITY / NUMBER_OF_SHARDS) as u32;
+    let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+
+    for shard_hint in 0..NUMBER_OF_SHARDS {
+        let e = sut.acquire_with_hint(shard_hint);
+        assert_that!(e, is_ok);
+        assert_that!(e.unwrap().value() / SHARD_CAPACITY, eq shard_hint as u32);
+    }
+}
+
+#[test]
+pub fn borrowed_indices_works() {
+    let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+    let mut ids = vec![];
+
+    for i in 0..CAPACITY {
+        assert_that!(sut.borrowed_indices(), eq i);
+        ids.push(sut.acquire().unwrap());
+    }
+    assert_that!(sut.borrowed_indices(), eq CAPACITY);
+
+    ids.clear();
+    assert_that!(sut.borrowed_indices(), eq 0);
+}
+
+#[test]
+pub fn acquire_and_release_raw_index_works() {
+    let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+    let mut ids = vec![];
+
+    for _ in 0..CAPACITY {
+        let e = unsafe { sut.acquire_raw_index() };
+        assert_that!(e, is_ok);
+        ids.push(e.unwrap());
+    }
+    assert_that!(unsafe { sut.acquire_raw_index() }, is_err);
+
+    for id in ids.drain(..) {
+        unsafe { sut.release_raw_index(id) };
+    }
+    assert_that!(sut.borrowed_indices(), eq 0);
+
+    for _ in 0..CAPACITY {
+        assert_that!(unsafe { sut.acquire_raw_index() }, is_ok);
+    }
+}
+
+#[test]
+pub fn acquire_and_release_works_with_uninitialized_memory() {
+    const CUSTOM_NUMBER_OF_SHARDS: usize = 5;
+    let memory = [0u8; ShardedUniqueIndexSet::const_memory_size(CAPACITY, CUSTOM_NUMBER_OF_SHARDS)];
+    let allocator = BumpAllocator::new(
+        NonNull::<u8>::iox2_from_ref(&memory[0]),
+        core::mem::size_of_val(&memory),
+    );
+
+    let mut sut =
+        unsafe { ShardedUniqueIndexSet::new_uninit_with_shards(CAPACITY, CUSTOM_NUMBER_OF_SHARDS) };
+    unsafe { assert_that!(sut.init(&allocator), is_ok) };
+    assert_that!(sut.number_of_shards(), eq CUSTOM_NUMBER_OF_SHARDS as u32);
+
+    let mut ids = vec![];
+    let mut values = BTreeSet::new();
+
+    unsafe {
+        for _ in 0..CAPACITY {
+            let e = sut.acquire();
+            assert_that!(e, is_ok);
+            assert_that!(values.insert(e.as_ref().unwrap().value()), eq true);
+            ids.push(e.unwrap());
+        }
+
+        assert_that!(sut.acquire(), is_err);
+        ids.clear();
+
+        for _ in 0..CAPACITY {
+            let e = sut.acquire();
+            assert_that!(e, is_ok);
+            ids.push(e.unwrap());
+        }
+    }
+}
+
+#[test]
+pub fn concurrent_acquire_release() {
+    const REPETITIONS: i64 = 10000;
+    let number_of_threads = (SystemInfo::NumberOfCpuCores.value()).clamp(2, usize::MAX);
+
+    let sut = FixedSizeShardedUniqueIndexSet::<CAPACITY, NUMBER_OF_SHARDS>::new();
+    let barrier_handle = BarrierHandle::new();
+    let barrier = BarrierBuilder::new(number_of_threads as u32)
+        .create(&barrier_handle)
+        .unwrap();
+
+    thread_scope(|s| {
+        for thread_id in 0..number_of_threads {
+            let sut = &sut;
+            let barrier = &barrier;
+            s.thread_builder()
+                .spawn(move || {
+                    let mut ids = vec![];
+                    let mut repetition = 0;
+
+                    barrier.wait();
+                    loop {
+                        match sut.acquire_with_hint(thread_id) {
+                            Ok(e) => {
+                                ids.push(e);
+                            }
+                            Err(UniqueIndexSetAcquireFailure::OutOfIndices) => {
+                                repetition += 1;
+                                ids.clear();
+                                if repetition == REPETITIONS {
+                                    break;
+                                }
+                            }
+                            Err(UniqueIndexSetAcquireFailure::IsLocked) => {
+                                assert_that!(true, eq false);
+                            }
+                        }
+                    }
+                })
+                .expect("failed to spawn thread");
+        }
+
+        Ok(())
+    })
+    .expect("failed to run thread scope");
+
+    // check if the sut is still in an consistent state
+    let mut ids = vec![];
+    let mut id_counter = [0u64; CAPACITY];
+
+    for _ in 0..CAPACITY {
+        let e = sut.acquire();
+        assert_that!(e, is_ok);
+        let e = e.unwrap();
+        id_counter[e.value() as usize] += 1;
+        ids.push(e);
+    }
+
+    for id in id_counter.iter() {
+        assert_that!(*id, eq 1);
+    }
+
+    let e = sut.acquire();
+    assert_that!(e, is_err);
+}
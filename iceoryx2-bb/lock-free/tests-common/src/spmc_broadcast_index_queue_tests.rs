@@ -0,0 +1,193 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::ptr::NonNull;
+
+use iceoryx2_bb_elementary::bump_allocator::BumpAllocator;
+use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
+use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
+use iceoryx2_bb_lock_free::spmc::broadcast_index_queue::*;
+use iceoryx2_bb_posix::barrier::{BarrierBuilder, BarrierHandle, Handle};
+use iceoryx2_bb_posix::thread::thread_scope;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+
+const CAPACITY: usize = 128;
+
+#[test]
+pub fn every_reader_receives_every_value() {
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+    let mut reader_1 = sut.reader();
+    let mut reader_2 = sut.reader();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+
+    assert_that!(sut.capacity(), eq CAPACITY);
+    assert_that!(reader_1.pop(), eq Ok(None));
+
+    for i in 0..CAPACITY {
+        sut_producer.push(i as u64);
+    }
+    assert_that!(sut.number_of_pushed_values(), eq CAPACITY as u64);
+
+    for reader in [&mut reader_1, &mut reader_2] {
+        for i in 0..CAPACITY {
+            assert_that!(reader.pop(), eq Ok(Some(i as u64)));
+        }
+        assert_that!(reader.pop(), eq Ok(None));
+        assert_that!(reader.is_empty(), eq true);
+    }
+}
+
+#[test]
+pub fn reader_receives_only_values_pushed_after_its_creation() {
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+
+    sut_producer.push(12);
+    let mut reader = sut.reader();
+    assert_that!(reader.is_empty(), eq true);
+
+    sut_producer.push(34);
+    assert_that!(reader.is_empty(), eq false);
+    assert_that!(reader.pop(), eq Ok(Some(34)));
+    assert_that!(reader.pop(), eq Ok(None));
+}
+
+#[test]
+pub fn only_one_producer_can_be_acquired() {
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+
+    let sut_producer = sut.acquire_producer();
+    assert_that!(sut_producer, is_some);
+    assert_that!(sut.acquire_producer(), is_none);
+
+    drop(sut_producer);
+    assert_that!(sut.acquire_producer(), is_some);
+}
+
+#[test]
+pub fn slow_reader_is_informed_about_missed_values() {
+    const NUMBER_OF_MISSED_VALUES: usize = 17;
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+    let mut reader = sut.reader();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+
+    for i in 0..CAPACITY + NUMBER_OF_MISSED_VALUES {
+        sut_producer.push(i as u64);
+    }
+
+    assert_that!(reader.pop(), eq Err(BroadcastOverrun {
+        number_of_missed_values: NUMBER_OF_MISSED_VALUES as u64
+    }));
+
+    for i in NUMBER_OF_MISSED_VALUES..CAPACITY + NUMBER_OF_MISSED_VALUES {
+        assert_that!(reader.pop(), eq Ok(Some(i as u64)));
+    }
+    assert_that!(reader.pop(), eq Ok(None));
+}
+
+#[test]
+pub fn overrun_of_one_reader_does_not_affect_others() {
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+    let mut slow_reader = sut.reader();
+    let mut fast_reader = sut.reader();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+
+    for i in 0..CAPACITY * 3 {
+        sut_producer.push(i as u64);
+        assert_that!(fast_reader.pop(), eq Ok(Some(i as u64)));
+    }
+
+    assert_that!(slow_reader.pop(), eq Err(BroadcastOverrun {
+        number_of_missed_values: (CAPACITY * 2) as u64
+    }));
+    assert_that!(slow_reader.pop(), eq Ok(Some((CAPACITY * 2) as u64)));
+    assert_that!(fast_reader.pop(), eq Ok(None));
+}
+
+#[test]
+pub fn broadcast_index_queue_works_with_uninitialized_memory() {
+    const CUSTOM_CAPACITY: usize = 13;
+    let memory = [0u8; BroadcastIndexQueue::const_memory_size(CUSTOM_CAPACITY) + 8];
+    let allocator = BumpAllocator::new(
+        NonNull::<u8>::iox2_from_ref(&memory[0]),
+        core::mem::size_of_val(&memory),
+    );
+
+    let mut sut = unsafe { RelocatableBroadcastIndexQueue::new_uninit(CUSTOM_CAPACITY) };
+    unsafe { assert_that!(sut.init(&allocator), is_ok) };
+    assert_that!(sut.capacity(), eq CUSTOM_CAPACITY);
+
+    let mut reader = sut.reader();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+    for i in 0..CUSTOM_CAPACITY {
+        sut_producer.push(i as u64);
+    }
+
+    for i in 0..CUSTOM_CAPACITY {
+        assert_that!(reader.pop(), eq Ok(Some(i as u64)));
+    }
+    assert_that!(reader.pop(), eq Ok(None));
+}
+
+#[test]
+pub fn concurrent_readers_receive_values_in_order_or_are_informed_about_overruns() {
+    const NUMBER_OF_READERS: u32 = 4;
+    const LIMIT: u64 = 100000;
+    let sut = FixedSizeBroadcastIndexQueue::<CAPACITY>::new();
+    let handle = BarrierHandle::new();
+    let barrier = BarrierBuilder::new(NUMBER_OF_READERS + 1)
+        .is_interprocess_capable(false)
+        .create(&handle)
+        .unwrap();
+
+    thread_scope(|s| {
+        s.thread_builder()
+            .spawn(|| {
+                let mut sut_producer = sut.acquire_producer().unwrap();
+                barrier.wait();
+                for i in 0..LIMIT {
+                    sut_producer.push(i);
+                }
+            })
+            .expect("failed to spawn thread");
+
+        for _ in 0..NUMBER_OF_READERS {
+            s.thread_builder()
+                .spawn(|| {
+                    let mut reader = sut.reader();
+                    let mut expected_value = 0;
+                    barrier.wait();
+
+                    while expected_value < LIMIT {
+                        match reader.pop() {
+                            Ok(Some(value)) => {
+                                assert_that!(value, eq expected_value);
+                                expected_value += 1;
+                            }
+                            Ok(None) => (),
+                            Err(overrun) => {
+                                assert_that!(overrun.number_of_missed_values, gt 0);
+                                expected_value += overrun.number_of_missed_values;
+                            }
+                        }
+                    }
+
+                    assert_that!(expected_value, eq LIMIT);
+                })
+                .expect("failed to spawn thread");
+        }
+
+        Ok(())
+    })
+    .expect("failed to run thread scope");
+}
@@ -458,3 +458,42 @@ pub fn mgmt_get_write_cell_works() {
         mgmt.__internal_release_producer();
     }
 }
+
+#[test]
+pub fn mgmt_in_place_read_is_invalidated_by_update() {
+    let _test_lock = TEST_LOCK.lock().unwrap();
+
+    const INITIAL_VALUE: u64 = 0;
+    const NEW_VALUE: u64 = 3;
+
+    let value_ptr: *const u64 = &NEW_VALUE;
+    let value_size = core::mem::size_of::<u64>();
+    let value_alignment = core::mem::align_of::<u64>();
+
+    let atomic = UnrestrictedAtomic::<u64>::new(INITIAL_VALUE);
+    let data_ptr = atomic.__internal_get_data_ptr();
+    let mgmt = atomic.__internal_get_mgmt();
+
+    unsafe {
+        let (read_ptr, write_cell) =
+            mgmt.__internal_begin_read(value_size, value_alignment, data_ptr);
+        assert_that!(*(read_ptr as *const u64), eq INITIAL_VALUE);
+        assert_that!(mgmt.__internal_is_read_consistent(write_cell), eq true);
+
+        assert_that!(mgmt.__internal_acquire_producer(), is_ok);
+        let write_cell_ptr =
+            mgmt.__internal_get_ptr_to_write_cell(value_size, value_alignment, data_ptr);
+        core::ptr::copy_nonoverlapping(value_ptr as *const u8, write_cell_ptr, value_size);
+        mgmt.__internal_update_write_cell();
+
+        // the previously started read observed an outdated value
+        assert_that!(mgmt.__internal_is_read_consistent(write_cell), eq false);
+
+        let (read_ptr, write_cell) =
+            mgmt.__internal_begin_read(value_size, value_alignment, data_ptr);
+        assert_that!(*(read_ptr as *const u64), eq NEW_VALUE);
+        assert_that!(mgmt.__internal_is_read_consistent(write_cell), eq true);
+
+        mgmt.__internal_release_producer();
+    }
+}
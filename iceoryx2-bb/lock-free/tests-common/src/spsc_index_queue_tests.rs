@@ -40,6 +40,35 @@ pub fn push_works_until_full() {
     assert_that!(sut, is_not_empty);
 }
 
+#[test]
+pub fn push_many_pushes_until_full() {
+    const CAPACITY: usize = 16;
+    let sut = FixedSizeIndexQueue::<CAPACITY>::new();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+    let mut sut_consumer = sut.acquire_consumer().unwrap();
+
+    let values: [u64; CAPACITY + 4] = core::array::from_fn(|i| i as u64);
+    assert_that!(sut_producer.push_many(&values[..5]), eq 5);
+    assert_that!(sut, len 5);
+    assert_that!(sut_producer.push_many(&values[5..]), eq CAPACITY - 5);
+    assert_that!(sut.is_full(), eq true);
+    assert_that!(sut_producer.push_many(&values[..1]), eq 0);
+
+    for i in 0..3 {
+        assert_that!(sut_consumer.pop(), eq Some(i));
+    }
+    assert_that!(sut_producer.push_many(&[100, 101, 102, 103]), eq 3);
+
+    for i in 3..CAPACITY as u64 {
+        assert_that!(sut_consumer.pop(), eq Some(i));
+    }
+    for i in 100..103 {
+        assert_that!(sut_consumer.pop(), eq Some(i));
+    }
+    assert_that!(sut_consumer.pop(), eq None);
+    assert_that!(sut_producer.push_many(&[]), eq 0);
+}
+
 #[test]
 pub fn pop_works_until_empty() {
     const CAPACITY: usize = 128;
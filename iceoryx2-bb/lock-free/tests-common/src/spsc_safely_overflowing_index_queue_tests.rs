@@ -75,6 +75,84 @@ pub fn pop_works_until_empty() {
     assert_that!(sut, is_empty);
 }
 
+#[test]
+pub fn peek_returns_next_value_without_removing_it() {
+    const CAPACITY: usize = 4;
+    let sut = FixedSizeSafelyOverflowingIndexQueue::<CAPACITY>::new();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+
+    assert_that!(unsafe { sut.peek() }, is_none);
+
+    for i in 0..CAPACITY + 1 {
+        sut_producer.push(i as u64);
+    }
+    assert_that!(unsafe { sut.peek() }, eq Some(1));
+    assert_that!(sut, len CAPACITY);
+
+    for i in 1..CAPACITY + 1 {
+        assert_that!(unsafe { sut.peek() }, eq Some(i as u64));
+        assert_that!(unsafe { sut.pop() }, eq Some(i as u64));
+    }
+    assert_that!(unsafe { sut.peek() }, is_none);
+}
+
+#[test]
+pub fn reduced_active_capacity_overflows_earlier() {
+    const CAPACITY: usize = 8;
+    const ACTIVE_CAPACITY: usize = 3;
+    let sut = FixedSizeSafelyOverflowingIndexQueue::<CAPACITY>::new();
+    assert_that!(sut.active_capacity(), eq CAPACITY);
+    assert_that!(sut.set_active_capacity(ACTIVE_CAPACITY), eq ACTIVE_CAPACITY);
+
+    let mut sut_producer = sut.acquire_producer().unwrap();
+    for i in 0..ACTIVE_CAPACITY {
+        assert_that!(sut_producer.push(i as u64), is_none);
+    }
+    assert_that!(sut.is_full(), eq true);
+    assert_that!(sut_producer.push(ACTIVE_CAPACITY as u64), eq Some(0));
+
+    assert_that!(sut.capacity(), eq CAPACITY);
+    assert_that!(sut, len ACTIVE_CAPACITY);
+}
+
+#[test]
+pub fn active_capacity_is_clamped_to_capacity() {
+    const CAPACITY: usize = 8;
+    let sut = FixedSizeSafelyOverflowingIndexQueue::<CAPACITY>::new();
+
+    assert_that!(sut.set_active_capacity(0), eq 1);
+    assert_that!(sut.set_active_capacity(CAPACITY + 1), eq CAPACITY);
+    assert_that!(sut.active_capacity(), eq CAPACITY);
+}
+
+#[test]
+pub fn shrinking_active_capacity_of_full_queue_keeps_length_bounded() {
+    const CAPACITY: usize = 8;
+    const ACTIVE_CAPACITY: usize = 2;
+    let sut = FixedSizeSafelyOverflowingIndexQueue::<CAPACITY>::new();
+    let mut sut_producer = sut.acquire_producer().unwrap();
+    for i in 0..CAPACITY {
+        assert_that!(sut_producer.push(i as u64), is_none);
+    }
+
+    sut.set_active_capacity(ACTIVE_CAPACITY);
+    assert_that!(sut.is_full(), eq true);
+
+    // every push returns the oldest element, the surplus stays until it is consumed
+    for i in 0..CAPACITY {
+        assert_that!(sut_producer.push((CAPACITY + i) as u64), eq Some(i as u64));
+        assert_that!(sut, len CAPACITY);
+    }
+
+    let mut sut_consumer = sut.acquire_consumer().unwrap();
+    for _ in 0..CAPACITY - ACTIVE_CAPACITY {
+        assert_that!(sut_consumer.pop(), is_some);
+    }
+    assert_that!(sut, len ACTIVE_CAPACITY);
+    assert_that!(sut_producer.push(1234), is_some);
+    assert_that!(sut, len ACTIVE_CAPACITY);
+}
+
 #[test]
 pub fn push_pop_alteration_works() {
     const CAPACITY: usize = 128;
@@ -0,0 +1,421 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A [`Logger`] that keeps the forwarding of log messages off the calling thread.
+//!
+//! The calling thread formats the message into a fixed size record of a lock-free ring
+//! buffer. It never allocates, locks or performs a system call. A background thread drains
+//! the ring and forwards every record to the wrapped [`Log`], e.g. the console logger, the
+//! file logger or a custom logger. When the ring is full, the record is discarded and counted
+//! so that a real-time thread is never blocked by a slow log sink.
+//!
+//! [`LogLevel::Fatal`] messages are forwarded synchronously after all pending records were
+//! drained, since the process usually terminates right after them.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2_bb_loggers::asynchronous;
+//! use iceoryx2_log_types::{Log, LogLevel};
+//!
+//! struct MyLogger;
+//!
+//! impl Log for MyLogger {
+//!     fn log(&self, _: LogLevel, origin: core::fmt::Arguments, message: core::fmt::Arguments) {
+//!         println!("{origin}: {message}");
+//!     }
+//! }
+//!
+//! static MY_LOGGER: MyLogger = MyLogger;
+//! static ASYNC_LOGGER: std::sync::LazyLock<asynchronous::Logger> =
+//!     std::sync::LazyLock::new(|| asynchronous::Logger::new(&MY_LOGGER));
+//!
+//! // iceoryx2_log::set_logger(&*ASYNC_LOGGER);
+//! ASYNC_LOGGER.log(LogLevel::Info, format_args!("main"), format_args!("hello"));
+//! ASYNC_LOGGER.flush();
+//! ```
+
+use alloc::boxed::Box;
+use alloc::sync::Arc;
+use core::fmt::Write;
+use core::time::Duration;
+
+use std::thread::JoinHandle;
+
+use iceoryx2_log_types::Log;
+use iceoryx2_log_types::LogLevel;
+use iceoryx2_pal_concurrency_sync::atomic::AtomicBool;
+use iceoryx2_pal_concurrency_sync::atomic::AtomicU64;
+use iceoryx2_pal_concurrency_sync::atomic::AtomicUsize;
+use iceoryx2_pal_concurrency_sync::atomic::Ordering;
+use iceoryx2_pal_concurrency_sync::cell::UnsafeCell;
+
+/// The default number of records the ring buffer can hold.
+pub const DEFAULT_CAPACITY: usize = 1024;
+/// The maximum length of the origin of a record, longer origins are truncated.
+pub const MAX_ORIGIN_LEN: usize = 256;
+/// The maximum length of the message of a record, longer messages are truncated.
+pub const MAX_MESSAGE_LEN: usize = 1024;
+
+const DRAIN_INTERVAL: Duration = Duration::from_millis(1);
+
+struct Text<const CAPACITY: usize> {
+    len: usize,
+    data: [u8; CAPACITY],
+}
+
+impl<const CAPACITY: usize> Text<CAPACITY> {
+    fn as_str(&self) -> &str {
+        // only complete utf-8 sequences are written in `write_str()`
+        unsafe { core::str::from_utf8_unchecked(&self.data[..self.len]) }
+    }
+}
+
+impl<const CAPACITY: usize> Write for Text<CAPACITY> {
+    fn write_str(&mut self, s: &str) -> core::fmt::Result {
+        let mut len = s.len().min(CAPACITY - self.len);
+        while !s.is_char_boundary(len) {
+            len -= 1;
+        }
+
+        self.data[self.len..self.len + len].copy_from_slice(&s.as_bytes()[..len]);
+        self.len += len;
+        Ok(())
+    }
+}
+
+struct Record {
+    log_level: LogLevel,
+    origin: Text<MAX_ORIGIN_LEN>,
+    message: Text<MAX_MESSAGE_LEN>,
+}
+
+struct Slot {
+    sequence: AtomicUsize,
+    record: UnsafeCell<Record>,
+}
+
+/// Bounded multi-producer ring buffer with a sequence number per slot. A producer reserves a
+/// slot by advancing the enqueue position, writes the record in place and publishes it by
+/// updating the sequence number of the slot.
+struct Queue {
+    slots: Box<[Slot]>,
+    mask: usize,
+    enqueue_position: AtomicUsize,
+    dequeue_position: AtomicUsize,
+    number_of_forwarded_records: AtomicUsize,
+    number_of_dropped_records: AtomicU64,
+    keep_running: AtomicBool,
+}
+
+unsafe impl Send for Queue {}
+unsafe impl Sync for Queue {}
+
+impl Queue {
+    fn new(capacity: usize) -> Self {
+        let capacity = capacity.max(2).next_power_of_two();
+
+        Self {
+            slots: (0..capacity)
+                .map(|n| Slot {
+                    sequence: AtomicUsize::new(n),
+                    record: UnsafeCell::new(Record {
+                        log_level: LogLevel::Trace,
+                        origin: Text {
+                            len: 0,
+                            data: [0; MAX_ORIGIN_LEN],
+                        },
+                        message: Text {
+                            len: 0,
+                            data: [0; MAX_MESSAGE_LEN],
+                        },
+                    }),
+                })
+                .collect(),
+            mask: capacity - 1,
+            enqueue_position: AtomicUsize::new(0),
+            dequeue_position: AtomicUsize::new(0),
+            number_of_forwarded_records: AtomicUsize::new(0),
+            number_of_dropped_records: AtomicU64::new(0),
+            keep_running: AtomicBool::new(true),
+        }
+    }
+
+    fn push(
+        &self,
+        log_level: LogLevel,
+        origin: core::fmt::Arguments,
+        message: core::fmt::Arguments,
+    ) -> bool {
+        let mut position = self.enqueue_position.load(Ordering::Relaxed);
+        let slot = loop {
+            let slot = &self.slots[position & self.mask];
+            let sequence = slot.sequence.load(Ordering::Acquire);
+
+            if sequence == position {
+                match self.enqueue_position.compare_exchange_weak(
+                    position,
+                    position + 1,
+                    Ordering::Relaxed,
+                    Ordering::Relaxed,
+                ) {
+                    Ok(_) => break slot,
+                    Err(current) => position = current,
+                }
+            } else if sequence < position {
+                // the slot still contains the record of the previous round
+                return false;
+            } else {
+                position = self.enqueue_position.load(Ordering::Relaxed);
+            }
+        };
+
+        // the slot was reserved exclusively by the successful compare exchange
+        let record = unsafe { &mut *slot.record.get() };
+        record.log_level = log_level;
+        record.origin.len = 0;
+        record.message.len = 0;
+        let _ = record.origin.write_fmt(origin);
+        let _ = record.message.write_fmt(message);
+
+        slot.sequence.store(position + 1, Ordering::Release);
+        true
+    }
+
+    /// Must only be called by the background thread.
+    fn pop<F: FnMut(&Record)>(&self, mut callback: F) -> bool {
+        let position = self.dequeue_position.load(Ordering::Relaxed);
+        let slot = &self.slots[position & self.mask];
+
+        if slot.sequence.load(Ordering::Acquire) != position + 1 {
+            return false;
+        }
+
+        callback(unsafe { &*slot.record.get() });
+
+        self.dequeue_position.store(position + 1, Ordering::Relaxed);
+        slot.sequence
+            .store(position + self.slots.len(), Ordering::Release);
+        self.number_of_forwarded_records
+            .fetch_add(1, Ordering::Release);
+        true
+    }
+
+    fn drain(&self, sink: &dyn Log) {
+        while self.pop(|record| {
+            sink.log(
+                record.log_level,
+                format_args!("{}", record.origin.as_str()),
+                format_args!("{}", record.message.as_str()),
+            )
+        }) {}
+    }
+}
+
+/// Forwards all log messages asynchronously via a lock-free ring buffer to another [`Log`].
+/// See the [module documentation](self) for details.
+pub struct Logger {
+    sink: &'static dyn Log,
+    queue: Arc<Queue>,
+    background_thread: Option<JoinHandle<()>>,
+}
+
+impl Logger {
+    /// Creates a new [`Logger`] with a ring buffer of [`DEFAULT_CAPACITY`] records that
+    /// forwards all messages to `sink`.
+    pub fn new(sink: &'static dyn Log) -> Self {
+        Self::with_capacity(sink, DEFAULT_CAPACITY)
+    }
+
+    /// Creates a new [`Logger`] that forwards all messages to `sink`. The capacity is rounded
+    /// up to the next power of two.
+    pub fn with_capacity(sink: &'static dyn Log, capacity: usize) -> Self {
+        let queue = Arc::new(Queue::new(capacity));
+
+        let background_thread = {
+            let queue = queue.clone();
+            std::thread::Builder::new()
+                .name("iox2-async-log".into())
+                .spawn(move || {
+                    let mut number_of_reported_drops = 0;
+                    while queue.keep_running.load(Ordering::Relaxed) {
+                        queue.drain(sink);
+
+                        let number_of_drops =
+                            queue.number_of_dropped_records.load(Ordering::Relaxed);
+                        if number_of_drops != number_of_reported_drops {
+                            sink.log(
+                                LogLevel::Warn,
+                                format_args!("iceoryx2_bb_loggers::asynchronous::Logger"),
+                                format_args!(
+                                    "{} log messages were discarded since the log buffer was full.",
+                                    number_of_drops - number_of_reported_drops
+                                ),
+                            );
+                            number_of_reported_drops = number_of_drops;
+                        }
+
+                        std::thread::park_timeout(DRAIN_INTERVAL);
+                    }
+                    queue.drain(sink);
+                })
+                .expect("Start background thread of the asynchronous logger.")
+        };
+
+        Self {
+            sink,
+            queue,
+            background_thread: Some(background_thread),
+        }
+    }
+
+    /// Returns the number of log messages that were discarded since the ring buffer was full.
+    pub fn number_of_dropped_messages(&self) -> u64 {
+        self.queue.number_of_dropped_records.load(Ordering::Relaxed)
+    }
+
+    /// Blocks until all log messages that were added before the call were forwarded.
+    pub fn flush(&self) {
+        let target = self.queue.enqueue_position.load(Ordering::Relaxed);
+        while self
+            .queue
+            .number_of_forwarded_records
+            .load(Ordering::Acquire)
+            < target
+        {
+            if let Some(background_thread) = &self.background_thread {
+                background_thread.thread().unpark();
+            }
+            std::thread::yield_now();
+        }
+    }
+}
+
+impl Drop for Logger {
+    fn drop(&mut self) {
+        self.queue.keep_running.store(false, Ordering::Relaxed);
+        if let Some(background_thread) = self.background_thread.take() {
+            background_thread.thread().unpark();
+            let _ = background_thread.join();
+        }
+    }
+}
+
+impl Log for Logger {
+    fn log(
+        &self,
+        log_level: LogLevel,
+        origin: core::fmt::Arguments,
+        formatted_message: core::fmt::Arguments,
+    ) {
+        if log_level == LogLevel::Fatal {
+            self.flush();
+            self.sink.log(log_level, origin, formatted_message);
+            return;
+        }
+
+        if !self.queue.push(log_level, origin, formatted_message) {
+            self.queue
+                .number_of_dropped_records
+                .fetch_add(1, Ordering::Relaxed);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use alloc::string::{String, ToString};
+    use alloc::vec::Vec;
+    use std::sync::Mutex;
+
+    struct CollectingLogger {
+        messages: Mutex<Vec<(String, String)>>,
+    }
+
+    impl Log for CollectingLogger {
+        fn log(&self, _: LogLevel, origin: core::fmt::Arguments, message: core::fmt::Arguments) {
+            self.messages
+                .lock()
+                .unwrap()
+                .push((origin.to_string(), message.to_string()));
+        }
+    }
+
+    fn collecting_logger() -> &'static CollectingLogger {
+        Box::leak(Box::new(CollectingLogger {
+            messages: Mutex::new(Vec::new()),
+        }))
+    }
+
+    #[test]
+    fn messages_are_forwarded_in_order() {
+        let sink = collecting_logger();
+        let sut = Logger::new(sink);
+
+        for n in 0..100 {
+            sut.log(LogLevel::Info, format_args!("origin"), format_args!("{n}"));
+        }
+        sut.flush();
+
+        let messages = sink.messages.lock().unwrap();
+        assert_eq!(messages.len(), 100);
+        for (n, (origin, message)) in messages.iter().enumerate() {
+            assert_eq!(origin, "origin");
+            assert_eq!(*message, n.to_string());
+        }
+    }
+
+    #[test]
+    fn too_long_messages_are_truncated_at_a_char_boundary() {
+        let sink = collecting_logger();
+        let sut = Logger::new(sink);
+
+        let long_message = "ä".repeat(MAX_MESSAGE_LEN);
+        sut.log(
+            LogLevel::Info,
+            format_args!(""),
+            format_args!("{long_message}"),
+        );
+        sut.flush();
+
+        let messages = sink.messages.lock().unwrap();
+        assert_eq!(messages[0].1.len(), MAX_MESSAGE_LEN);
+        assert!(long_message.starts_with(&messages[0].1));
+    }
+
+    #[test]
+    fn messages_from_multiple_threads_are_forwarded() {
+        const NUMBER_OF_THREADS: usize = 4;
+        const NUMBER_OF_MESSAGES: usize = 200;
+
+        let sink = collecting_logger();
+        let sut = Logger::with_capacity(sink, NUMBER_OF_THREADS * NUMBER_OF_MESSAGES);
+
+        std::thread::scope(|s| {
+            for t in 0..NUMBER_OF_THREADS {
+                let sut = &sut;
+                s.spawn(move || {
+                    for n in 0..NUMBER_OF_MESSAGES {
+                        sut.log(LogLevel::Info, format_args!("{t}"), format_args!("{n}"));
+                    }
+                });
+            }
+        });
+        sut.flush();
+
+        assert_eq!(
+            sink.messages.lock().unwrap().len() as u64 + sut.number_of_dropped_messages(),
+            (NUMBER_OF_THREADS * NUMBER_OF_MESSAGES) as u64
+        );
+    }
+}
@@ -45,6 +45,10 @@
 //!  * `file` - output log messages to the file
 //!  * `log` - utilize the `log` crate to output log messages
 //!  * `tracing` - utilize the `tracing` crate to output log messages
+//!
+//! With `std` the [`asynchronous::Logger`] is available. It wraps any other
+//! logger and forwards the log messages from a background thread so that
+//! real-time threads are never blocked by a slow log sink.
 
 #![cfg_attr(not(feature = "std"), no_std)]
 #![warn(clippy::alloc_instead_of_core)]
@@ -53,6 +57,8 @@
 
 use iceoryx2_log_types::Log;
 
+#[cfg(feature = "std")]
+pub mod asynchronous;
 #[cfg(feature = "buffer")]
 mod buffer;
 #[cfg(feature = "console")]
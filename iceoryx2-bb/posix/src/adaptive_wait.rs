@@ -18,6 +18,10 @@
 //! [`ADAPTIVE_WAIT_INITIAL_WAITING_TIME`] for the next [`ADAPTIVE_WAIT_INITIAL_REPETITIONS`].
 //! After that every further wait will wait [`ADAPTIVE_WAIT_FINAL_WAITING_TIME`]
 //!
+//! The escalation can be customized with [`AdaptiveWaitStrategy::Backoff`]. It busy spins
+//! with a cpu pause instruction, then yields and finally sleeps with an exponentially growing
+//! waiting time, see [`Backoff`].
+//!
 //! # Examples
 //! ```ignore
 //! # extern crate iceoryx2_bb_loggers;
@@ -46,9 +50,54 @@ use crate::config::{
 use crate::scheduler::yield_now;
 use iceoryx2_bb_elementary::enum_gen;
 use iceoryx2_log::fail;
+use serde::{Deserialize, Serialize};
+
+/// Defines the escalation of an [`AdaptiveWait`] with [`AdaptiveWaitStrategy::Backoff`].
+/// The first [`Backoff::spin_repetitions`] waits busy spin with a cpu pause instruction, the
+/// next [`Backoff::yield_repetitions`] waits yield the cpu and every further wait sleeps.
+/// The first sleep takes [`Backoff::initial_sleep`] and every following sleep doubles the
+/// waiting time until [`Backoff::max_sleep`] is reached.
+///
+/// On isolated cores a high number of spin repetitions reduces the reaction time, on shared
+/// cores a small number of spin and yield repetitions reduces the cpu load.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
+#[serde(rename_all = "kebab-case")]
+pub struct Backoff {
+    /// The number of waits that busy spin
+    pub spin_repetitions: u64,
+    /// The number of waits that yield the cpu after the spin phase
+    pub yield_repetitions: u64,
+    /// The waiting time of the first sleep
+    pub initial_sleep: Duration,
+    /// The upper limit of the exponentially growing waiting time
+    pub max_sleep: Duration,
+}
+
+impl Default for Backoff {
+    fn default() -> Self {
+        Self {
+            spin_repetitions: 0,
+            yield_repetitions: ADAPTIVE_WAIT_YIELD_REPETITIONS,
+            initial_sleep: ADAPTIVE_WAIT_INITIAL_WAITING_TIME,
+            max_sleep: ADAPTIVE_WAIT_FINAL_WAITING_TIME,
+        }
+    }
+}
+
+impl Backoff {
+    fn waiting_time(&self, number_of_sleeps: u64) -> Duration {
+        let factor = 1u32
+            .checked_shl(number_of_sleeps.min(31) as u32)
+            .unwrap_or(u32::MAX);
+        self.initial_sleep
+            .checked_mul(factor)
+            .unwrap_or(self.max_sleep)
+            .min(self.max_sleep)
+    }
+}
 
 /// Defines the wait behavior of the [`AdaptiveWait`] object.
-#[derive(Debug, Default, Clone, Copy)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
 pub enum AdaptiveWaitStrategy {
     #[default]
     /// Very responsive and quick reaction by a busy waiting for the first thousands of operations.
@@ -56,6 +105,8 @@ pub enum AdaptiveWaitStrategy {
     Adaptive,
     /// Lower load and the cost of the responsiveness.
     FixedTicks(Duration),
+    /// Spins, yields and sleeps with an exponential backoff as defined in [`Backoff`].
+    Backoff(Backoff),
 }
 
 /// The AdaptiveWaitBuilder is required to produce an [`AdaptiveWait`] object.
@@ -150,6 +201,11 @@ impl AdaptiveWait {
         self.clock_type
     }
 
+    /// Returns the time that has passed since the [`AdaptiveWait`] was created.
+    pub fn elapsed(&self) -> Result<Duration, TimeError> {
+        self.start_time.elapsed()
+    }
+
     /// Wait in a less busy wait.
     pub fn wait(&mut self) -> Result<Duration, AdaptiveWaitError> {
         let msg = "Failure while waiting";
@@ -249,6 +305,21 @@ impl AdaptiveWait {
                 fail!(from self, when nanosleep_with_clock(waiting_time, self.clock_type),
                     "{} due to a failure while sleeping.", msg);
             }
+            AdaptiveWaitStrategy::Backoff(backoff) => {
+                let number_of_spins_and_yields = backoff
+                    .spin_repetitions
+                    .saturating_add(backoff.yield_repetitions);
+                if self.yield_count <= backoff.spin_repetitions {
+                    core::hint::spin_loop();
+                } else if self.yield_count <= number_of_spins_and_yields {
+                    yield_now();
+                } else {
+                    let waiting_time =
+                        backoff.waiting_time(self.yield_count - number_of_spins_and_yields - 1);
+                    fail!(from self, when nanosleep_with_clock(waiting_time, self.clock_type),
+                        "{} due to a failure while sleeping.", msg);
+                }
+            }
         }
 
         Ok(())
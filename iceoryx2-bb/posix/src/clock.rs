@@ -14,6 +14,7 @@
 //!
 //! * [`Time`] - acquires the current system time and measures the elapsed time
 //! * [`ClockType`] - describes certain types of clocks
+//! * [`CycleClock`] - low overhead [`ClockType::Monotonic`] time based on the CPU cycle counter
 //! * [`nanosleep()`] & [`nanosleep_with_clock()`] - wait a defined amount of time on a custom
 //!   clock
 //! * [`AsTimeval`] - trait for easy [`posix::timeval`] conversion, required for low level posix
@@ -24,6 +25,10 @@
 use crate::handle_errno;
 use crate::system_configuration::Feature;
 use core::time::Duration;
+use iceoryx2_bb_concurrency::atomic::AtomicU8;
+use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_concurrency::atomic::Ordering;
+use iceoryx2_bb_concurrency::atomic::fence;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary::enum_gen;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
@@ -357,6 +362,367 @@ impl AsTimespec for Time {
     }
 }
 
+const NANOSECONDS_PER_SECOND: u64 = 1_000_000_000;
+// the multiplier from cycles to nanoseconds is a fixed point number with 32 fractional bits
+const CYCLE_MULTIPLIER_FRACTION_BITS: u32 = 32;
+// duration of the busy wait that calibrates a counter with an unknown frequency
+const CYCLE_CALIBRATION_DURATION: Duration = Duration::from_millis(10);
+// the counter is reanchored to the monotonic clock in this interval so that the calibration
+// error cannot accumulate and the clock of different processes stays in sync
+const CYCLE_RESYNC_INTERVAL: Duration = Duration::from_secs(1);
+
+const CYCLE_CLOCK_UNINITIALIZED: u8 = 0;
+const CYCLE_CLOCK_CALIBRATING: u8 = 1;
+const CYCLE_CLOCK_AVAILABLE: u8 = 2;
+const CYCLE_CLOCK_UNAVAILABLE: u8 = 3;
+
+mod cycle_counter {
+    /// Returns true when the counter is constant rate and synchronized between the cores.
+    #[cfg(target_arch = "x86_64")]
+    pub(super) fn is_invariant() -> bool {
+        use core::arch::x86_64::__cpuid;
+        const ADVANCED_POWER_MANAGEMENT_LEAF: u32 = 0x8000_0007;
+        const INVARIANT_TSC_BIT: u32 = 1 << 8;
+
+        let max_extended_leaf = unsafe { __cpuid(0x8000_0000) }.eax;
+        max_extended_leaf >= ADVANCED_POWER_MANAGEMENT_LEAF
+            && unsafe { __cpuid(ADVANCED_POWER_MANAGEMENT_LEAF) }.edx & INVARIANT_TSC_BIT != 0
+    }
+
+    /// The frequency is unknown and must be calibrated.
+    #[cfg(target_arch = "x86_64")]
+    pub(super) fn frequency() -> Option<u64> {
+        None
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    pub(super) fn read() -> u64 {
+        unsafe { core::arch::x86_64::_rdtsc() }
+    }
+
+    /// The generic timer of ARMv8 is specified as constant rate and system wide.
+    #[cfg(target_arch = "aarch64")]
+    pub(super) fn is_invariant() -> bool {
+        true
+    }
+
+    #[cfg(target_arch = "aarch64")]
+    pub(super) fn frequency() -> Option<u64> {
+        let frequency: u64;
+        unsafe {
+            core::arch::asm!("mrs {}, cntfrq_el0", out(reg) frequency, options(nomem, nostack))
+        };
+        if frequency == 0 {
+            None
+        } else {
+            Some(frequency)
+        }
+    }
+
+    #[cfg(target_arch = "aarch64")]
+    pub(super) fn read() -> u64 {
+        let counter: u64;
+        // the isb prevents that the counter is read speculatively ahead of preceding instructions
+        unsafe {
+            core::arch::asm!("isb", "mrs {}, cntvct_el0", out(reg) counter, options(nomem, nostack))
+        };
+        counter
+    }
+
+    #[cfg(not(any(target_arch = "x86_64", target_arch = "aarch64")))]
+    pub(super) fn is_invariant() -> bool {
+        false
+    }
+
+    #[cfg(not(any(target_arch = "x86_64", target_arch = "aarch64")))]
+    pub(super) fn frequency() -> Option<u64> {
+        None
+    }
+
+    #[cfg(not(any(target_arch = "x86_64", target_arch = "aarch64")))]
+    pub(super) fn read() -> u64 {
+        0
+    }
+}
+
+// The anchor relates a counter value to a point in time of the monotonic clock. It is guarded by
+// a sequence lock, an odd sequence number marks an ongoing update.
+struct CycleClockState {
+    state: AtomicU8,
+    sequence: AtomicU64,
+    anchor_cycles: AtomicU64,
+    anchor_nanoseconds: AtomicU64,
+    multiplier: AtomicU64,
+    resync_cycles: AtomicU64,
+    calibration_cycles: AtomicU64,
+    calibration_nanoseconds: AtomicU64,
+    has_fixed_frequency: AtomicU8,
+}
+
+static CYCLE_CLOCK: CycleClockState = CycleClockState {
+    state: AtomicU8::new(CYCLE_CLOCK_UNINITIALIZED),
+    sequence: AtomicU64::new(0),
+    anchor_cycles: AtomicU64::new(0),
+    anchor_nanoseconds: AtomicU64::new(0),
+    multiplier: AtomicU64::new(0),
+    resync_cycles: AtomicU64::new(0),
+    calibration_cycles: AtomicU64::new(0),
+    calibration_nanoseconds: AtomicU64::new(0),
+    has_fixed_frequency: AtomicU8::new(0),
+};
+
+fn monotonic_nanoseconds() -> Result<u64, TimeError> {
+    let now = Time::now_with_clock(ClockType::Monotonic)?;
+    Ok(now.seconds * NANOSECONDS_PER_SECOND + now.nanoseconds as u64)
+}
+
+fn cycles_to_nanoseconds(cycles: u64, multiplier: u64) -> u64 {
+    ((cycles as u128 * multiplier as u128) >> CYCLE_MULTIPLIER_FRACTION_BITS) as u64
+}
+
+fn nanoseconds_to_time(nanoseconds: u64) -> Time {
+    Time {
+        clock_type: ClockType::Monotonic,
+        seconds: nanoseconds / NANOSECONDS_PER_SECOND,
+        nanoseconds: (nanoseconds % NANOSECONDS_PER_SECOND) as u32,
+    }
+}
+
+/// A [`ClockType::Monotonic`] clock that reads the invariant time stamp counter on x86_64 and
+/// the virtual counter `CNTVCT_EL0` on aarch64 instead of calling `clock_gettime`. The counter
+/// is calibrated once per process and reanchored to the monotonic clock every second, therefore
+/// the acquired [`Time`] can be compared with [`Time::now_with_clock()`] and with the [`Time`]
+/// acquired in other processes, up to the calibration error of a few microseconds.
+///
+/// When the hardware does not provide an invariant counter, the [`CycleClock`] falls back to
+/// [`Time::now_with_clock()`].
+///
+/// # Examples
+/// ```
+/// # extern crate iceoryx2_bb_loggers;
+///
+/// use iceoryx2_bb_posix::clock::*;
+///
+/// let start = CycleClock::now().unwrap();
+/// let elapsed = CycleClock::elapsed_since(&start).unwrap();
+/// ```
+pub struct CycleClock;
+
+impl CycleClock {
+    /// Returns true when the [`CycleClock`] reads the cycle counter of the CPU and false when
+    /// it falls back to `clock_gettime`. The first call calibrates the counter.
+    pub fn is_hardware_accelerated() -> bool {
+        Self::initialize();
+        CYCLE_CLOCK.state.load(Ordering::Acquire) == CYCLE_CLOCK_AVAILABLE
+    }
+
+    /// Returns the current [`Time`] of the [`ClockType::Monotonic`] clock.
+    pub fn now() -> Result<Time, TimeError> {
+        match CYCLE_CLOCK.state.load(Ordering::Acquire) {
+            CYCLE_CLOCK_AVAILABLE => (),
+            CYCLE_CLOCK_UNINITIALIZED => {
+                Self::initialize();
+                return Time::now_with_clock(ClockType::Monotonic);
+            }
+            _ => return Time::now_with_clock(ClockType::Monotonic),
+        }
+
+        let sequence = CYCLE_CLOCK.sequence.load(Ordering::Acquire);
+        if sequence % 2 == 1 {
+            return Time::now_with_clock(ClockType::Monotonic);
+        }
+
+        let anchor_cycles = CYCLE_CLOCK.anchor_cycles.load(Ordering::Relaxed);
+        let anchor_nanoseconds = CYCLE_CLOCK.anchor_nanoseconds.load(Ordering::Relaxed);
+        let multiplier = CYCLE_CLOCK.multiplier.load(Ordering::Relaxed);
+        let resync_cycles = CYCLE_CLOCK.resync_cycles.load(Ordering::Relaxed);
+        fence(Ordering::Acquire);
+        if CYCLE_CLOCK.sequence.load(Ordering::Relaxed) != sequence {
+            return Time::now_with_clock(ClockType::Monotonic);
+        }
+
+        let cycles = cycle_counter::read().wrapping_sub(anchor_cycles);
+        if cycles >= resync_cycles {
+            return Self::resync(sequence);
+        }
+
+        Ok(nanoseconds_to_time(
+            anchor_nanoseconds + cycles_to_nanoseconds(cycles, multiplier),
+        ))
+    }
+
+    /// Returns the [`Duration`] that has passed since `time` was acquired with
+    /// [`CycleClock::now()`] or with [`Time::now_with_clock()`] and [`ClockType::Monotonic`].
+    pub fn elapsed_since(time: &Time) -> Result<Duration, TimeError> {
+        let now = Self::now()?;
+        Ok(now.as_duration().saturating_sub(time.as_duration()))
+    }
+
+    fn initialize() {
+        if CYCLE_CLOCK
+            .state
+            .compare_exchange(
+                CYCLE_CLOCK_UNINITIALIZED,
+                CYCLE_CLOCK_CALIBRATING,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            )
+            .is_err()
+        {
+            return;
+        }
+
+        let state = if Self::calibrate() {
+            CYCLE_CLOCK_AVAILABLE
+        } else {
+            CYCLE_CLOCK_UNAVAILABLE
+        };
+        CYCLE_CLOCK.state.store(state, Ordering::Release);
+    }
+
+    fn calibrate() -> bool {
+        if !cycle_counter::is_invariant() {
+            return false;
+        }
+
+        let (start_cycles, start_nanoseconds, multiplier) = match cycle_counter::frequency() {
+            Some(frequency) => {
+                let start_nanoseconds = match monotonic_nanoseconds() {
+                    Ok(v) => v,
+                    Err(_) => return false,
+                };
+                CYCLE_CLOCK.has_fixed_frequency.store(1, Ordering::Relaxed);
+                (
+                    cycle_counter::read(),
+                    start_nanoseconds,
+                    ((NANOSECONDS_PER_SECOND as u128) << CYCLE_MULTIPLIER_FRACTION_BITS)
+                        / frequency as u128,
+                )
+            }
+            None => {
+                let (start_cycles, start_nanoseconds) = match Self::sample() {
+                    Some(v) => v,
+                    None => return false,
+                };
+                let calibration_nanoseconds = CYCLE_CALIBRATION_DURATION.as_nanos() as u64;
+
+                let (end_cycles, end_nanoseconds) = loop {
+                    match Self::sample() {
+                        Some((cycles, nanoseconds))
+                            if nanoseconds - start_nanoseconds >= calibration_nanoseconds =>
+                        {
+                            break (cycles, nanoseconds);
+                        }
+                        Some(_) => core::hint::spin_loop(),
+                        None => return false,
+                    }
+                };
+
+                let cycles = end_cycles.wrapping_sub(start_cycles);
+                if cycles == 0 {
+                    return false;
+                }
+
+                (
+                    start_cycles,
+                    start_nanoseconds,
+                    (((end_nanoseconds - start_nanoseconds) as u128)
+                        << CYCLE_MULTIPLIER_FRACTION_BITS)
+                        / cycles as u128,
+                )
+            }
+        };
+
+        if multiplier == 0 || multiplier > u64::MAX as u128 {
+            return false;
+        }
+        let multiplier = multiplier as u64;
+        let resync_cycles = (((CYCLE_RESYNC_INTERVAL.as_nanos() as u128)
+            << CYCLE_MULTIPLIER_FRACTION_BITS)
+            / multiplier as u128)
+            .min(u64::MAX as u128) as u64;
+
+        CYCLE_CLOCK
+            .calibration_cycles
+            .store(start_cycles, Ordering::Relaxed);
+        CYCLE_CLOCK
+            .calibration_nanoseconds
+            .store(start_nanoseconds, Ordering::Relaxed);
+        CYCLE_CLOCK
+            .anchor_cycles
+            .store(start_cycles, Ordering::Relaxed);
+        CYCLE_CLOCK
+            .anchor_nanoseconds
+            .store(start_nanoseconds, Ordering::Relaxed);
+        CYCLE_CLOCK.multiplier.store(multiplier, Ordering::Relaxed);
+        CYCLE_CLOCK
+            .resync_cycles
+            .store(resync_cycles, Ordering::Relaxed);
+
+        true
+    }
+
+    // Reads the counter and the monotonic clock as close together as possible. The counter is
+    // read before and after the clock and the midpoint is used. The sample with the shortest
+    // read window is taken so that an interrupt between the reads does not distort it.
+    fn sample() -> Option<(u64, u64)> {
+        const NUMBER_OF_ATTEMPTS: usize = 8;
+        let mut best: Option<(u64, u64, u64)> = None;
+        for _ in 0..NUMBER_OF_ATTEMPTS {
+            let before = cycle_counter::read();
+            let nanoseconds = monotonic_nanoseconds().ok()?;
+            let window = cycle_counter::read().wrapping_sub(before);
+
+            if best.is_none_or(|(_, _, best_window)| window < best_window) {
+                best = Some((before.wrapping_add(window / 2), nanoseconds, window));
+            }
+        }
+
+        best.map(|(cycles, nanoseconds, _)| (cycles, nanoseconds))
+    }
+
+    // Moves the anchor to the current time. When the counter frequency was calibrated, the
+    // multiplier is refined with the whole interval since the calibration.
+    fn resync(sequence: u64) -> Result<Time, TimeError> {
+        let (cycles, nanoseconds) = match Self::sample() {
+            Some(v) => v,
+            None => return Time::now_with_clock(ClockType::Monotonic),
+        };
+
+        // only one thread updates the anchor, all others use the sampled time directly
+        if CYCLE_CLOCK
+            .sequence
+            .compare_exchange(sequence, sequence + 1, Ordering::Acquire, Ordering::Relaxed)
+            .is_ok()
+        {
+            if CYCLE_CLOCK.has_fixed_frequency.load(Ordering::Relaxed) == 0 {
+                let calibration_cycles =
+                    cycles.wrapping_sub(CYCLE_CLOCK.calibration_cycles.load(Ordering::Relaxed));
+                let calibration_nanoseconds = nanoseconds
+                    .saturating_sub(CYCLE_CLOCK.calibration_nanoseconds.load(Ordering::Relaxed));
+                if calibration_cycles != 0 {
+                    let multiplier = ((calibration_nanoseconds as u128)
+                        << CYCLE_MULTIPLIER_FRACTION_BITS)
+                        / calibration_cycles as u128;
+                    if multiplier != 0 && multiplier <= u64::MAX as u128 {
+                        CYCLE_CLOCK
+                            .multiplier
+                            .store(multiplier as u64, Ordering::Relaxed);
+                    }
+                }
+            }
+
+            CYCLE_CLOCK.anchor_cycles.store(cycles, Ordering::Relaxed);
+            CYCLE_CLOCK
+                .anchor_nanoseconds
+                .store(nanoseconds, Ordering::Relaxed);
+            CYCLE_CLOCK.sequence.store(sequence + 2, Ordering::Release);
+        }
+
+        Ok(nanoseconds_to_time(nanoseconds))
+    }
+}
+
 /// Suspends the current thread for a provided duration.
 ///
 /// # Examples
@@ -373,6 +739,62 @@ pub fn nanosleep(duration: Duration) -> Result<(), NanosleepError> {
     nanosleep_with_clock(duration, ClockType::default())
 }
 
+/// Suspends the current thread until the provided absolute [`Time`] of its [`ClockType`] is
+/// reached. In contrast to [`nanosleep()`], the wake up does not drift when the sleep is
+/// repeated for a fixed sequence of time points. Returns right away, when the time point is
+/// already in the past.
+///
+/// # Examples
+/// ```
+/// # extern crate iceoryx2_bb_loggers;
+///
+/// use iceoryx2_bb_posix::clock::*;
+/// use core::time::Duration;
+///
+/// let wake_up_time = Time::now_with_clock(ClockType::Monotonic).unwrap().as_duration()
+///     + Duration::from_millis(10);
+/// let wake_up_time = TimeBuilder::new()
+///     .clock_type(ClockType::Monotonic)
+///     .seconds(wake_up_time.as_secs())
+///     .nanoseconds(wake_up_time.subsec_nanos())
+///     .create();
+///
+/// nanosleep_until(wake_up_time).unwrap();
+/// ```
+pub fn nanosleep_until(time: Time) -> Result<(), NanosleepError> {
+    let timeout = time.as_timespec();
+    let mut time_left = posix::timespec {
+        tv_sec: 0,
+        tv_nsec: 0,
+    };
+
+    let mut remaining_sleeping_time = Duration::ZERO;
+    handle_errno!(NanosleepError, from "nanosleep_until",
+        errno_source unsafe {
+            let e = posix::clock_nanosleep(
+                time.clock_type.as_i32() as _,
+                posix::CLOCK_TIMER_ABSTIME,
+                &timeout,
+                &mut time_left,
+            ).into();
+
+            // an absolute sleep does not report the remaining time
+            if e == Errno::EINTR {
+                remaining_sleeping_time = Time::now_with_clock(time.clock_type)
+                    .map(|now| time.as_duration().saturating_sub(now.as_duration()))
+                    .unwrap_or(Duration::ZERO);
+            }
+            e
+        },
+        success Errno::ESUCCES => (),
+        Errno::EINTR => (InterruptedBySignal(remaining_sleeping_time),
+            "Interrupted \"nanosleep_until\": {{ time: {:?} }}, remaining sleeping time: {:?}", time, remaining_sleeping_time),
+        Errno::EINVAL => (DurationOutOfRange, "Invalid argument in \"nanosleep_until\". Either the time: {:?} is out of range or the clock type is invalid.", time),
+        Errno::ENOTSUP => (ClockTypeIsNotSupported, "Clock not supported in \"nanosleep_until\": {{ time: {:?} }}", time),
+        v => (UnknownError(v as i32), "Unknown error occurred in \"nanosleep_until\": {{ time: {:?} }}, ({})", time, v)
+    );
+}
+
 /// Suspends the current thread for a provided duration in a user provided [`ClockType`].
 ///
 /// # Attention
@@ -38,9 +38,9 @@
 //!     });
 //! ```
 
-use core::{fmt::Debug, time::Duration};
+use core::{cmp::Reverse, fmt::Debug, time::Duration};
 
-use alloc::vec;
+use alloc::collections::{BTreeMap, BinaryHeap};
 use alloc::vec::Vec;
 
 pub use iceoryx2_bb_elementary::CallbackProgression;
@@ -122,7 +122,8 @@ impl DeadlineQueueBuilder {
         let start_time = start_time.as_duration().as_nanos();
 
         Ok(DeadlineQueue {
-            attachments: RefCell::new(vec![]),
+            attachments: RefCell::new(BTreeMap::new()),
+            expirations: RefCell::new(BinaryHeap::new()),
             id_count: AtomicU64::new(0),
             clock_type: self.clock_type,
             previous_iteration: RefCell::new(start_time),
@@ -132,29 +133,50 @@ impl DeadlineQueueBuilder {
 
 #[derive(Debug)]
 struct Attachment {
-    index: u64,
     period: u128,
     start_time: u128,
 }
 
 impl Attachment {
-    fn new(index: u64, period: u128, clock_type: ClockType) -> Result<Self, TimeError> {
+    fn new(period: u128, clock_type: ClockType) -> Result<Self, TimeError> {
         let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
                                 "Failed to create DeadlineQueue attachment since the current time could not be acquired.");
         let start_time = start_time.as_duration().as_nanos();
 
-        Ok(Self {
-            index,
-            period,
-            start_time,
-        })
+        Ok(Self { period, start_time })
     }
 
-    fn reset(&mut self, clock_type: ClockType) -> Result<(), TimeError> {
-        let start_time = fail!(from "Attachment::new()", when Time::now_with_clock(clock_type),
-                                "Failed to reset DeadlineQueue attachment since the current time could not be acquired.");
-        self.start_time = start_time.as_duration().as_nanos();
-        Ok(())
+    /// Creates an attachment whose expirations are aligned to the absolute time of the clock,
+    /// so that they expire at `phase + n * period`. Attachments with the same period and
+    /// phase expire at the same time points, even when they are created by different
+    /// processes.
+    fn with_phase(period: u128, phase: u128, clock_type: ClockType) -> Result<Self, TimeError> {
+        let mut attachment = Self::new(period, clock_type)?;
+        if period != 0 {
+            let now = attachment.start_time;
+            // the latest time point of the grid that is not after now, or the first one when
+            // the clock has not yet reached it
+            let offset = (now + period - phase % period) % period;
+            attachment.start_time = if offset <= now {
+                now - offset
+            } else {
+                now + period - offset
+            };
+        }
+
+        Ok(attachment)
+    }
+
+    /// Returns the first period boundary after `last`. An attachment with a period of zero
+    /// expires always.
+    fn next_expiration(&self, last: u128) -> u128 {
+        match self.period {
+            0 => 0,
+            period => {
+                let elapsed_periods = (last.max(self.start_time) - self.start_time) / period;
+                self.start_time + (elapsed_periods + 1) * period
+            }
+        }
     }
 }
 
@@ -162,9 +184,17 @@ impl Attachment {
 /// [`DeadlineQueue::add_deadline_interval()`], to wait on them by acquiring the waiting time to the next deadline_queue
 /// with [`DeadlineQueue::duration_until_next_deadline()`] and to acquire all missed deadline_queues via
 /// [`DeadlineQueue::missed_deadlines()`].
+///
+/// The attachments are ordered by their next expiration in a min-heap, so that adding,
+/// resetting and removing a deadline as well as acquiring the next deadline is logarithmic
+/// in the number of attachments. A reset or removal does not touch the heap, the outdated
+/// entry is corrected when it reaches the top of the heap. Multiple deadlines can be reset
+/// with [`DeadlineQueue::reset_deadlines()`] and removed with
+/// [`DeadlineQueue::remove_deadlines()`] in one batch.
 #[derive(Debug)]
 pub struct DeadlineQueue {
-    attachments: RefCell<Vec<Attachment>>,
+    attachments: RefCell<BTreeMap<u64, Attachment>>,
+    expirations: RefCell<BinaryHeap<Reverse<(u128, u64)>>>,
     id_count: AtomicU64,
     previous_iteration: RefCell<u128>,
 
@@ -190,12 +220,34 @@ impl DeadlineQueue {
         &self,
         deadline: Duration,
     ) -> Result<DeadlineQueueGuard<'_>, TimeError> {
-        let current_idx = self.id_count.load(Ordering::Relaxed);
-        self.attachments.borrow_mut().push(Attachment::new(
-            current_idx,
+        self.add_attachment(Attachment::new(deadline.as_nanos(), self.clock_type)?)
+    }
+
+    /// Adds a cyclic deadline to the [`DeadlineQueue`] that expires at the absolute time
+    /// points `phase + n * deadline` of the underlying [`ClockType`] instead of relative to the
+    /// time when it was added. It returns an [`DeadlineQueueGuard`] to identify the attachment
+    /// uniquely.
+    pub fn add_deadline_interval_with_phase(
+        &self,
+        deadline: Duration,
+        phase: Duration,
+    ) -> Result<DeadlineQueueGuard<'_>, TimeError> {
+        self.add_attachment(Attachment::with_phase(
             deadline.as_nanos(),
+            phase.as_nanos(),
             self.clock_type,
-        )?);
+        )?)
+    }
+
+    fn add_attachment(&self, attachment: Attachment) -> Result<DeadlineQueueGuard<'_>, TimeError> {
+        let current_idx = self.id_count.load(Ordering::Relaxed);
+        let expiration = attachment.next_expiration(*self.previous_iteration.borrow());
+        self.attachments
+            .borrow_mut()
+            .insert(current_idx, attachment);
+        self.expirations
+            .borrow_mut()
+            .push(Reverse((expiration, current_idx)));
         self.id_count.fetch_add(1, Ordering::Relaxed);
 
         Ok(DeadlineQueueGuard {
@@ -205,25 +257,69 @@ impl DeadlineQueue {
     }
 
     fn remove(&self, index: u64) {
-        let mut index_to_remove = None;
-        for (n, attachment) in self.attachments.borrow().iter().enumerate() {
-            if attachment.index == index {
-                index_to_remove = Some(n);
-                break;
+        self.attachments.borrow_mut().remove(&index);
+        self.compact_expirations();
+    }
+
+    /// Removes all deadlines of the provided [`DeadlineQueueGuard`]s at once. It is equivalent
+    /// to dropping the guards but the outdated heap entries are cleaned up only once for the
+    /// whole batch.
+    pub fn remove_deadlines<
+        'deadline_queue,
+        I: IntoIterator<Item = DeadlineQueueGuard<'deadline_queue>>,
+    >(
+        &'deadline_queue self,
+        guards: I,
+    ) {
+        {
+            let mut attachments = self.attachments.borrow_mut();
+            for guard in guards {
+                if core::ptr::eq(guard.deadline_queue, self) {
+                    attachments.remove(&guard.index.0);
+                    core::mem::forget(guard);
+                }
             }
         }
 
-        if let Some(n) = index_to_remove {
-            self.attachments.borrow_mut().remove(n);
+        self.compact_expirations();
+    }
+
+    fn compact_expirations(&self) {
+        let attachments = self.attachments.borrow();
+
+        // the entries of removed attachments are dropped lazily when they reach the top, when
+        // they dominate the heap it is rebuilt to keep the memory bounded
+        let mut expirations = self.expirations.borrow_mut();
+        if expirations.len() > 2 * attachments.len() + 1 {
+            let last = *self.previous_iteration.borrow();
+            expirations.clear();
+            for (index, attachment) in attachments.iter() {
+                expirations.push(Reverse((attachment.next_expiration(last), *index)));
+            }
         }
     }
 
     /// Resets the attached deadline_queue and wait again the full time.
     pub fn reset(&self, index: DeadlineQueueIndex) -> Result<(), TimeError> {
-        for attachment in &mut *self.attachments.borrow_mut() {
-            if attachment.index == index.0 {
-                attachment.reset(self.clock_type)?;
-                break;
+        self.reset_deadlines([index])
+    }
+
+    /// Resets all provided deadlines so that they wait again the full time. The current time
+    /// is acquired only once for the whole batch.
+    pub fn reset_deadlines<I: IntoIterator<Item = DeadlineQueueIndex>>(
+        &self,
+        indices: I,
+    ) -> Result<(), TimeError> {
+        let now = fail!(from self, when Time::now_with_clock(self.clock_type),
+                        "Unable to reset the deadlines since the current time could not be acquired.");
+        let now = now.as_duration().as_nanos();
+
+        // the heap entries are not touched, an entry that expires too early is moved to its
+        // actual expiration when it reaches the top of the heap
+        let mut attachments = self.attachments.borrow_mut();
+        for index in indices {
+            if let Some(attachment) = attachments.get_mut(&index.0) {
+                attachment.start_time = now;
             }
         }
 
@@ -240,27 +336,44 @@ impl DeadlineQueue {
         let now = fail!(from self, when Time::now_with_clock(self.clock_type),
                         "Unable to return next duration since the current time could not be acquired.");
         let now = now.as_duration().as_nanos();
-        let mut has_missed_deadline = false;
-        self.handle_missed_deadlines(now, |_| {
-            has_missed_deadline = true;
-            CallbackProgression::Stop
-        });
-
-        if has_missed_deadline {
-            return Ok(Duration::ZERO);
+
+        match self.next_expiration() {
+            Some(expiration) if expiration <= now => Ok(Duration::ZERO),
+            Some(expiration) => {
+                // must be set after the return caused by a missed deadline, otherwise the user
+                // is unable to acquire the missed deadline
+                *self.previous_iteration.borrow_mut() = now;
+                Ok(Duration::from_nanos((expiration - now) as _))
+            }
+            None => Ok(Duration::MAX),
         }
+    }
 
-        // must be set after the return caused by a missed deadline, otherwise the user is unable
-        // to acquire the missed deadline
-        *self.previous_iteration.borrow_mut() = now;
+    /// Returns the earliest expiration of all attachments. Outdated heap entries of removed or
+    /// reset attachments are dropped or moved to their actual expiration on the way.
+    fn next_expiration(&self) -> Option<u128> {
+        let last = *self.previous_iteration.borrow();
+        let attachments = self.attachments.borrow();
+        let mut expirations = self.expirations.borrow_mut();
+
+        while let Some(Reverse((expiration, index))) = expirations.peek().copied() {
+            match attachments.get(&index) {
+                None => {
+                    expirations.pop();
+                }
+                Some(attachment) => {
+                    let actual_expiration = attachment.next_expiration(last);
+                    if actual_expiration == expiration {
+                        return Some(expiration);
+                    }
 
-        let mut min_time = u128::MAX;
-        for attachment in &*self.attachments.borrow() {
-            min_time =
-                min_time.min(attachment.period - (now - attachment.start_time) % attachment.period);
+                    expirations.pop();
+                    expirations.push(Reverse((actual_expiration, index)));
+                }
+            }
         }
 
-        Ok(Duration::from_nanos(min_time as _))
+        None
     }
 
     fn handle_missed_deadlines<F: FnMut(DeadlineQueueIndex) -> CallbackProgression>(
@@ -268,35 +381,36 @@ impl DeadlineQueue {
         now: u128,
         mut call: F,
     ) {
-        let last = *self.previous_iteration.borrow();
+        let mut missed_deadlines = Vec::new();
+        while let Some(expiration) = self.next_expiration() {
+            if now < expiration {
+                break;
+            }
 
-        for attachment in &*self.attachments.borrow() {
-            let duration_until_last = last.max(attachment.start_time) - attachment.start_time;
-            let duration_until_now = now - attachment.start_time;
-            match attachment.period {
-                0 => {
-                    if matches!(
-                        call(DeadlineQueueIndex(attachment.index)),
-                        CallbackProgression::Stop
-                    ) {
-                        return;
-                    }
-                }
-                _ => {
-                    let last = duration_until_last / attachment.period;
-                    let current = duration_until_now / attachment.period;
-
-                    if last < current
-                        && matches!(
-                            call(DeadlineQueueIndex(attachment.index)),
-                            CallbackProgression::Stop
-                        )
-                    {
-                        return;
-                    }
+            if let Some(Reverse((_, index))) = self.expirations.borrow_mut().pop() {
+                missed_deadlines.push(index);
+            }
+        }
+
+        // the missed attachments are rescheduled after now, which becomes the last iteration,
+        // before the callback is called so that it can add or remove deadlines
+        {
+            let attachments = self.attachments.borrow();
+            let mut expirations = self.expirations.borrow_mut();
+            for index in &missed_deadlines {
+                if let Some(attachment) = attachments.get(index) {
+                    expirations.push(Reverse((attachment.next_expiration(now), *index)));
                 }
             }
         }
+
+        // reported in the order in which the deadlines were added
+        missed_deadlines.sort_unstable();
+        for index in missed_deadlines {
+            if let CallbackProgression::Stop = call(DeadlineQueueIndex(index)) {
+                return;
+            }
+        }
     }
 
     /// Iterates over all missed deadlines and calls the provided callback for each of them
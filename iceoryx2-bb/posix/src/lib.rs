@@ -55,10 +55,12 @@ pub mod file_type;
 pub mod group;
 pub mod ipc_capable;
 pub mod memory;
+pub mod memory_fd;
 pub mod memory_lock;
 pub mod memory_mapping;
 pub mod metadata;
 pub mod mutex;
+pub mod numa;
 pub mod ownership;
 pub mod permission;
 pub mod process;
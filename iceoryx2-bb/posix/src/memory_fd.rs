@@ -0,0 +1,252 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Provides an anonymous [`MemoryFd`], a memory object that can be shared between processes but
+//! has no entry in the file system. It exists as long as a [`FileDescriptor`] or a memory
+//! mapping refers to it, therefore a crashed process cannot leave it behind.
+//!
+//! The [`MemoryFd`] is shared by sending its [`FileDescriptor`] to another process, for instance
+//! with the [`crate::socket_ancillary::SocketAncillary`] of a
+//! [`crate::unix_datagram_socket::UnixDatagramSender`]. The receiver acquires it with
+//! [`MemoryFd::from_file_descriptor()`]. Before the [`FileDescriptor`] is handed out, the size
+//! can be sealed with [`MemoryFd::seal_size()`] so that no receiver can shrink the memory
+//! of the other processes away.
+//!
+//! It is only supported on platforms where
+//! [`iceoryx2_pal_posix::posix::POSIX_SUPPORT_MEMORY_FD`] is true.
+//!
+//! # Example
+//!
+//! ```
+//! # extern crate iceoryx2_bb_loggers;
+//!
+//! use iceoryx2_bb_posix::memory_fd::*;
+//! use iceoryx2_bb_posix::memory_mapping::*;
+//! use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+//! use iceoryx2_bb_system_types::file_name::FileName;
+//! use iceoryx2_bb_container::semantic_string::*;
+//!
+//! if MemoryFd::does_support_memory_fd() {
+//!     let name = FileName::new(b"some_memory").unwrap();
+//!     let memory = MemoryFdBuilder::new(&name)
+//!                     .size(4096)
+//!                     .create()
+//!                     .expect("failed to create memory fd");
+//!
+//!     memory.seal_size().expect("failed to seal the size");
+//!
+//!     let mapping = MemoryMappingBuilder::from_file_descriptor(memory.file_descriptor().clone())
+//!                     .mapping_behavior(MappingBehavior::Shared)
+//!                     .initial_mapping_permission(MappingPermission::ReadWrite)
+//!                     .size(memory.size())
+//!                     .create()
+//!                     .expect("failed to map memory fd");
+//!
+//!     // send memory.file_descriptor() to another process
+//! }
+//! ```
+
+use iceoryx2_bb_container::semantic_string::*;
+use iceoryx2_bb_elementary::enum_gen;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_log::{fail, trace};
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_MEMORY_FD;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+use crate::file::{FileStatError, FileTruncateError};
+use crate::file_descriptor::*;
+use crate::handle_errno;
+
+enum_gen! { MemoryFdCreationError
+  entry:
+    UnsupportedSizeOfZero,
+    NotSupported,
+    InsufficientMemory,
+    PerProcessFileHandleLimitReached,
+    SystemWideFileHandleLimitReached,
+    NameTooLong,
+    UnknownError(i32)
+  mapping:
+    FileTruncateError,
+    FileStatError
+}
+
+enum_gen! { MemoryFdSealError
+  entry:
+    NotSupported,
+    SealingNotAllowed,
+    UnknownError(i32)
+}
+
+/// The builder for the [`MemoryFd`].
+#[derive(Debug)]
+pub struct MemoryFdBuilder {
+    name: FileName,
+    size: usize,
+    allow_sealing: bool,
+}
+
+impl MemoryFdBuilder {
+    /// Creates a new builder. The name has no meaning for the operating system, it is only
+    /// shown for debugging purposes, e.g. in `/proc/self/fd`, and does not have to be unique.
+    pub fn new(name: &FileName) -> Self {
+        Self {
+            name: *name,
+            size: 0,
+            allow_sealing: true,
+        }
+    }
+
+    /// The size of the [`MemoryFd`].
+    pub fn size(mut self, value: usize) -> Self {
+        self.size = value;
+        self
+    }
+
+    /// Defines if the [`MemoryFd`] can be sealed with [`MemoryFd::seal_size()`]. It is enabled
+    /// by default.
+    pub fn allow_sealing(mut self, value: bool) -> Self {
+        self.allow_sealing = value;
+        self
+    }
+
+    /// Creates the [`MemoryFd`]
+    pub fn create(self) -> Result<MemoryFd, MemoryFdCreationError> {
+        let msg = "Unable to create memory fd";
+
+        if !POSIX_SUPPORT_MEMORY_FD {
+            fail!(from self, with MemoryFdCreationError::NotSupported,
+                "{msg} since the platform does not support anonymous memory file descriptors.");
+        }
+
+        if self.size == 0 {
+            fail!(from self, with MemoryFdCreationError::UnsupportedSizeOfZero,
+                "{msg} since a size of 0 is not supported for a memory fd.");
+        }
+
+        let mut flags = posix::MFD_CLOEXEC;
+        if self.allow_sealing {
+            flags |= posix::MFD_ALLOW_SEALING;
+        }
+
+        let mut file_descriptor = match FileDescriptor::new(unsafe {
+            posix::memfd_create(self.name.as_c_str(), flags)
+        }) {
+            Some(fd) => fd,
+            None => {
+                handle_errno!(MemoryFdCreationError, from self,
+                    Errno::ENOSYS => (NotSupported, "{} since the kernel does not support memfd_create.", msg),
+                    Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+                    Errno::EMFILE => (PerProcessFileHandleLimitReached, "{} since the per-process file handle limit was reached.", msg),
+                    Errno::ENFILE => (SystemWideFileHandleLimitReached, "{} since the system-wide file handle limit was reached.", msg),
+                    Errno::EINVAL => (NameTooLong, "{} since the name \"{}\" is too long.", msg, self.name),
+                    v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+                );
+            }
+        };
+
+        fail!(from self, when file_descriptor.truncate(self.size),
+            "{} since the memory fd could not be resized to {} bytes.", msg, self.size);
+
+        let memory_fd = MemoryFd {
+            size: self.size,
+            file_descriptor,
+        };
+
+        trace!(from memory_fd, "created");
+        Ok(memory_fd)
+    }
+}
+
+/// An anonymous memory object identified only by its [`FileDescriptor`]. It is created with the
+/// [`MemoryFdBuilder`] or acquired from a received [`FileDescriptor`] with
+/// [`MemoryFd::from_file_descriptor()`].
+#[derive(Debug)]
+pub struct MemoryFd {
+    file_descriptor: FileDescriptor,
+    size: usize,
+}
+
+impl MemoryFd {
+    /// Returns true if the platform supports [`MemoryFd`]s, otherwise false.
+    pub fn does_support_memory_fd() -> bool {
+        POSIX_SUPPORT_MEMORY_FD
+    }
+
+    /// Takes over a [`FileDescriptor`] that refers to a [`MemoryFd`], for instance one that was
+    /// received from another process. The size is acquired from the memory object.
+    pub fn from_file_descriptor(
+        file_descriptor: FileDescriptor,
+    ) -> Result<MemoryFd, MemoryFdCreationError> {
+        let size = fail!(from "MemoryFd::from_file_descriptor()", when file_descriptor.metadata(),
+            "Unable to acquire the memory fd since its size could not be read.")
+        .size() as usize;
+
+        Ok(MemoryFd {
+            file_descriptor,
+            size,
+        })
+    }
+
+    /// Returns the size of the [`MemoryFd`].
+    pub fn size(&self) -> usize {
+        self.size
+    }
+
+    /// Seals the [`MemoryFd`] so that it can neither shrink nor grow anymore and that the seals
+    /// cannot be removed. Afterwards, every process that maps it can rely on its size.
+    pub fn seal_size(&self) -> Result<(), MemoryFdSealError> {
+        let msg = "Unable to seal the size of the memory fd";
+        if unsafe {
+            posix::fcntl_int(
+                self.file_descriptor.native_handle(),
+                posix::F_ADD_SEALS,
+                posix::F_SEAL_SHRINK | posix::F_SEAL_GROW | posix::F_SEAL_SEAL,
+            )
+        } == 0
+        {
+            trace!(from self, "sealed size");
+            return Ok(());
+        }
+
+        handle_errno!(MemoryFdSealError, from self,
+            Errno::ENOSYS => (NotSupported, "{} since the platform does not support sealing.", msg),
+            Errno::EPERM => (SealingNotAllowed, "{} since the memory fd was created without sealing support or is already sealed.", msg),
+            v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+        );
+    }
+
+    /// Returns true when the size of the [`MemoryFd`] is sealed, otherwise false.
+    pub fn is_size_sealed(&self) -> Result<bool, MemoryFdSealError> {
+        let msg = "Unable to acquire the seals of the memory fd";
+        let seals =
+            unsafe { posix::fcntl2(self.file_descriptor.native_handle(), posix::F_GET_SEALS) };
+        if seals >= 0 {
+            let size_seals = posix::F_SEAL_SHRINK | posix::F_SEAL_GROW;
+            return Ok(seals & size_seals == size_seals);
+        }
+
+        handle_errno!(MemoryFdSealError, from self,
+            Errno::ENOSYS => (NotSupported, "{} since the platform does not support sealing.", msg),
+            v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+        );
+    }
+}
+
+impl FileDescriptorBased for MemoryFd {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl FileDescriptorManagement for MemoryFd {}
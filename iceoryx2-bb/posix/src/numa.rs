@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Defines on which NUMA node the pages of a memory region are placed. On multi-socket systems
+//! memory that is placed on the node of the reading CPU avoids the cross-socket interconnect.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2_bb_posix::numa::*;
+//!
+//! // resolve the policy to the node the current thread is running on
+//! let policy = NumaPolicy::CreatingThreadNode.resolve();
+//! println!("effective policy: {:?}", policy);
+//! ```
+
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary::enum_gen;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_log::fail;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_NUMA_MEMORY_POLICY;
+use iceoryx2_pal_posix::posix::errno::Errno;
+use iceoryx2_pal_posix::*;
+
+/// The largest NUMA node index that can be addressed by a [`NumaPolicy`].
+pub const MAX_NUMA_NODE: u32 = 1023;
+
+const NODE_MASK_BITS_PER_ENTRY: usize = core::mem::size_of::<posix::ulong>() * 8;
+const NODE_MASK_LEN: usize = (MAX_NUMA_NODE as usize + 1) / NODE_MASK_BITS_PER_ENTRY;
+
+enum_gen! { NumaPolicyError
+  entry:
+    NotSupported,
+    InvalidNode,
+    InvalidAddressRange,
+    InsufficientMemory,
+    InsufficientPermissions,
+    UnknownError(i32)
+}
+
+/// Defines how the pages of a memory region are distributed across the NUMA nodes.
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq, Default, ZeroCopySend)]
+#[repr(C)]
+pub enum NumaPolicy {
+    /// The pages are placed on the node of the CPU that touches them first.
+    #[default]
+    Default,
+    /// The pages are preferably placed on the provided node. When the node is out of memory
+    /// the pages are placed on another node.
+    PreferredNode(u32),
+    /// The pages are interleaved across all nodes the process is allowed to use.
+    Interleave,
+    /// The pages are preferably placed on the node the thread which applies the policy is
+    /// running on.
+    CreatingThreadNode,
+}
+
+impl NumaPolicy {
+    /// Returns the NUMA node of the CPU the current thread is running on. If the platform does
+    /// not support NUMA memory policies it returns [`None`].
+    pub fn current_node() -> Option<u32> {
+        if !POSIX_SUPPORT_NUMA_MEMORY_POLICY {
+            return None;
+        }
+
+        let mut cpu: posix::uint = 0;
+        let mut node: posix::uint = 0;
+        if unsafe { posix::getcpu(&mut cpu, &mut node) } == 0 {
+            Some(node as _)
+        } else {
+            None
+        }
+    }
+
+    /// Returns the effective [`NumaPolicy`]. [`NumaPolicy::CreatingThreadNode`] is resolved into
+    /// [`NumaPolicy::PreferredNode`] of the current thread. If the platform does not support
+    /// NUMA memory policies [`NumaPolicy::Default`] is returned.
+    pub fn resolve(self) -> NumaPolicy {
+        if !POSIX_SUPPORT_NUMA_MEMORY_POLICY {
+            return NumaPolicy::Default;
+        }
+
+        match self {
+            NumaPolicy::CreatingThreadNode => match Self::current_node() {
+                Some(node) => NumaPolicy::PreferredNode(node),
+                None => NumaPolicy::Default,
+            },
+            v => v,
+        }
+    }
+
+    /// Applies the [`NumaPolicy`] to the memory region starting at `address` with a length of
+    /// `len` bytes. It only affects pages that are touched after the call. On success, it
+    /// returns the effective [`NumaPolicy`], see [`NumaPolicy::resolve()`].
+    ///
+    /// # Safety
+    ///
+    ///  * the memory range [address, address + len] must be mapped into the process space
+    ///  * the address must be a multiple of the page size
+    pub unsafe fn apply(self, address: *mut u8, len: usize) -> Result<NumaPolicy, NumaPolicyError> {
+        let msg = "Unable to apply the NUMA policy";
+        let origin = "NumaPolicy::apply()";
+        if !POSIX_SUPPORT_NUMA_MEMORY_POLICY {
+            fail!(from origin, with NumaPolicyError::NotSupported,
+                "{} {:?} since the platform does not support NUMA memory policies.", msg, self);
+        }
+
+        let policy = self.resolve();
+        let mut node_mask: [posix::ulong; NODE_MASK_LEN] = [0; NODE_MASK_LEN];
+        let mode = match policy {
+            NumaPolicy::Default | NumaPolicy::CreatingThreadNode => posix::MPOL_DEFAULT,
+            NumaPolicy::PreferredNode(node) => {
+                if node > MAX_NUMA_NODE {
+                    fail!(from origin, with NumaPolicyError::InvalidNode,
+                        "{} {:?} since the node exceeds the maximum supported node {}.", msg, self, MAX_NUMA_NODE);
+                }
+                let node = node as usize;
+                node_mask[node / NODE_MASK_BITS_PER_ENTRY] |=
+                    1 << (node % NODE_MASK_BITS_PER_ENTRY);
+                posix::MPOL_PREFERRED
+            }
+            NumaPolicy::Interleave => {
+                // the kernel restricts the mask to the nodes the process is allowed to use
+                node_mask.iter_mut().for_each(|v| *v = posix::ulong::MAX);
+                posix::MPOL_INTERLEAVE
+            }
+        };
+
+        let (node_mask_ptr, max_node) = if mode == posix::MPOL_DEFAULT {
+            (core::ptr::null(), 0)
+        } else {
+            (node_mask.as_ptr(), (MAX_NUMA_NODE + 1) as posix::ulong)
+        };
+
+        if unsafe { posix::mbind(address.cast(), len, mode, node_mask_ptr, max_node, 0) } == 0 {
+            return Ok(policy);
+        }
+
+        handle_errno!(NumaPolicyError, from origin,
+            Errno::EFAULT => (InvalidAddressRange, "{} {:?} since the memory range beginning from {:#16X} with a length of {} is not fully mapped.", msg, self, address as usize, len),
+            Errno::EINVAL => (InvalidNode, "{} {:?} since the node is not available or the address {:#16X} is not page aligned.", msg, self, address as usize),
+            Errno::ENOMEM => (InsufficientMemory, "{} {:?} due to insufficient kernel memory.", msg, self),
+            Errno::EPERM => (InsufficientPermissions, "{} {:?} due to insufficient permissions.", msg, self),
+            Errno::ENOSYS => (NotSupported, "{} {:?} since the system does not support NUMA memory policies.", msg, self),
+            v => (UnknownError(v as i32), "{} {:?} since an unknown error occurred ({}).", msg, self, v)
+        );
+    }
+}
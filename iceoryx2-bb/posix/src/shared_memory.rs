@@ -83,7 +83,9 @@ use iceoryx2_bb_system_types::path::*;
 use iceoryx2_log::{debug, error, fail, fatal_panic, trace, warn};
 use iceoryx2_pal_configuration::PATH_SEPARATOR;
 use iceoryx2_pal_posix::posix::POSIX_SUPPORT_ADVANCED_SIGNAL_HANDLING;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_HUGE_PAGE_ADVICE;
 use iceoryx2_pal_posix::posix::POSIX_SUPPORT_PERSISTENT_SHARED_MEMORY;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_TYPED_MEMORY;
 use iceoryx2_pal_posix::posix::errno::Errno;
 use iceoryx2_pal_posix::*;
 
@@ -95,6 +97,7 @@ use crate::memory_lock::{MemoryLock, MemoryLockCreationError};
 use crate::memory_mapping::{
     MappingBehavior, MemoryMapping, MemoryMappingBuilder, MemoryMappingCreationError,
 };
+use crate::numa::NumaPolicy;
 pub use crate::permission::Permission;
 use crate::signal::SignalHandler;
 use crate::system_configuration::Limit;
@@ -113,6 +116,7 @@ enum_gen! { SharedMemoryCreationError
     InvalidName,
     AlreadyExist,
     DoesNotExist,
+    TypedMemoryUnavailable,
     UnknownError(i32)
   mapping:
     FileTruncateError,
@@ -138,6 +142,9 @@ pub struct SharedMemoryBuilder {
     permission: Permission,
     creation_mode: Option<CreationMode>,
     zero_memory: bool,
+    use_huge_pages: bool,
+    numa_policy: NumaPolicy,
+    typed_memory: Option<FilePath>,
     access_mode: AccessMode,
     mapping_offset: isize,
     enforce_base_address: Option<u64>,
@@ -154,6 +161,9 @@ impl SharedMemoryBuilder {
             has_ownership: true,
             creation_mode: None,
             zero_memory: true,
+            use_huge_pages: false,
+            numa_policy: NumaPolicy::Default,
+            typed_memory: None,
             mapping_offset: 0,
             enforce_base_address: None,
         }
@@ -268,6 +278,32 @@ impl SharedMemoryCreationBuilder {
         self
     }
 
+    /// Requests that the shared memory is backed by transparent huge pages. This reduces the
+    /// number of TLB misses when large segments are accessed. When the platform or the system
+    /// configuration does not support huge pages for shared memory, a warning is emitted and
+    /// the shared memory is backed by regular pages.
+    pub fn use_huge_pages(mut self, value: bool) -> Self {
+        self.config.use_huge_pages = value;
+        self
+    }
+
+    /// Defines the [`NumaPolicy`] of the pages of the shared memory. When the policy cannot be
+    /// applied, a warning is emitted and the pages are placed on the node that touches them
+    /// first.
+    pub fn numa_policy(mut self, value: NumaPolicy) -> Self {
+        self.config.numa_policy = value;
+        self
+    }
+
+    /// Allocates the memory of the shared memory from the provided typed memory pool, for
+    /// instance `/memory/below4G`, instead of the general purpose memory. Typed memory is
+    /// only supported on QNX, on all other platforms the creation fails with
+    /// [`SharedMemoryCreationError::TypedMemoryUnavailable`].
+    pub fn typed_memory(mut self, value: &FilePath) -> Self {
+        self.config.typed_memory = Some(*value);
+        self
+    }
+
     /// The size of the shared memory.
     pub fn size(mut self, size: usize) -> Self {
         self.config.size = size;
@@ -353,7 +389,14 @@ impl SharedMemoryCreationBuilder {
             return Ok(shm);
         }
 
-        fail!(from self.config, when fd.truncate(self.config.size), "{} since the shared memory truncation failed.", msg);
+        match &self.config.typed_memory {
+            Some(typed_memory) => {
+                SharedMemory::allocate_typed_memory(&fd, typed_memory, &self.config)?
+            }
+            None => {
+                fail!(from self.config, when fd.truncate(self.config.size), "{} since the shared memory truncation failed.", msg);
+            }
+        }
 
         let actual_shm_size = fail!(from self.config, when fd.metadata(),
                 "{} since a failure occurred while acquiring the file attributes.", msg)
@@ -374,6 +417,23 @@ impl SharedMemoryCreationBuilder {
             mapping_offset: self.config.mapping_offset,
         };
 
+        if self.config.use_huge_pages {
+            shm.advise_huge_pages();
+        }
+
+        if self.config.numa_policy != NumaPolicy::Default {
+            let size = shm.memory_mapping.size();
+            if let Err(e) = unsafe {
+                self.config
+                    .numa_policy
+                    .apply(shm.memory_mapping.base_address_mut(), size)
+            } {
+                warn!(from shm,
+                    "Unable to apply the NUMA policy {:?} ({:?}). Falling back to first-touch placement.",
+                    self.config.numa_policy, e);
+            }
+        }
+
         if self.config.is_memory_locked {
             shm.memory_lock = Some(
                 fail!(from self.config, when unsafe { MemoryLock::new(shm.memory_mapping.base_address().cast(), shm.memory_mapping.size()) },
@@ -556,6 +616,68 @@ impl SharedMemory {
         self.memory_mapping.as_mut_slice()
     }
 
+    fn advise_huge_pages(&mut self) {
+        let msg = "Unable to back the shared memory with huge pages";
+        if !POSIX_SUPPORT_HUGE_PAGE_ADVICE {
+            warn!(from self,
+                "{} since the platform does not support it. Falling back to regular pages.", msg);
+            return;
+        }
+
+        if unsafe {
+            posix::madvise(
+                self.memory_mapping.base_address_mut().cast(),
+                self.memory_mapping.size(),
+                posix::MADV_HUGEPAGE,
+            )
+        } == 0
+        {
+            return;
+        }
+
+        match Errno::get() {
+            Errno::EINVAL => {
+                warn!(from self,
+                    "{} since transparent huge pages are not enabled for shared memory. Falling back to regular pages.", msg);
+            }
+            v => {
+                warn!(from self,
+                    "{} since an unknown error occurred ({}). Falling back to regular pages.", msg, v);
+            }
+        }
+    }
+
+    fn allocate_typed_memory(
+        fd: &FileDescriptor,
+        typed_memory: &FilePath,
+        config: &SharedMemoryBuilder,
+    ) -> Result<(), SharedMemoryCreationError> {
+        let msg = "Unable to allocate the shared memory from the typed memory";
+        if !POSIX_SUPPORT_TYPED_MEMORY {
+            fail!(from config, with SharedMemoryCreationError::TypedMemoryUnavailable,
+                "{} \"{}\" since the platform does not support typed memory.", msg, typed_memory);
+        }
+
+        if unsafe {
+            posix::shm_allocate_typed_memory(
+                fd.native_handle(),
+                typed_memory.as_c_str(),
+                config.size,
+            )
+        } == 0
+        {
+            return Ok(());
+        }
+
+        handle_errno!(SharedMemoryCreationError, from config,
+            Errno::EACCES => (InsufficientPermissions, "{} \"{}\" due to insufficient permissions.", msg, typed_memory),
+            Errno::ENOENT => (TypedMemoryUnavailable, "{} \"{}\" since the typed memory does not exist.", msg, typed_memory),
+            Errno::EINVAL => (TypedMemoryUnavailable, "{} \"{}\" since the typed memory cannot be used for shared memory.", msg, typed_memory),
+            Errno::ENOMEM => (InsufficientMemory, "{} \"{}\" since the typed memory has not enough memory left.", msg, typed_memory),
+            v => (UnknownError(v as i32), "{} \"{}\" since an unknown error occurred ({}).", msg, typed_memory, v)
+        );
+    }
+
     fn shm_create(
         name: &FileName,
         config: &SharedMemoryBuilder,
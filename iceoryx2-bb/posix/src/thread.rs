@@ -249,6 +249,14 @@ enum_gen! { ThreadSetAffinityError
     UnknownError(i32)
 }
 
+enum_gen! { ThreadSetSchedulerError
+  entry:
+    InsufficientPermissions,
+    ThreadNoLongerActive,
+    InvalidSchedulingParameters,
+    UnknownError(i32)
+}
+
 enum_gen! {
     ThreadGetNameError
   entry:
@@ -638,6 +646,15 @@ pub trait ThreadProperties {
     /// Sets the threads affinity to the provided set of cpu core ids. If one of
     /// the cpu core id's does not exist in the system the call will fail.
     fn set_affinity(&mut self, cpu_core_ids: &[usize]) -> Result<(), ThreadSetAffinityError>;
+
+    /// Sets the [`Scheduler`] of the thread together with its priority. The priority is
+    /// mapped uniformly onto the priority range of the [`Scheduler`], see
+    /// [`ThreadBuilder::priority()`].
+    fn set_scheduler(
+        &mut self,
+        scheduler: Scheduler,
+        priority: u8,
+    ) -> Result<(), ThreadSetSchedulerError>;
 }
 
 /// A thread handle can be used from within the thread to read or modify certain settings like the
@@ -758,6 +775,25 @@ impl ThreadProperties for ThreadHandle {
             v=> (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
         );
     }
+
+    fn set_scheduler(
+        &mut self,
+        scheduler: Scheduler,
+        priority: u8,
+    ) -> Result<(), ThreadSetSchedulerError> {
+        let msg = "Unable to set thread scheduler";
+        let mut param = posix::sched_param::new_zeroed();
+        param.sched_priority = scheduler.policy_specific_priority(priority);
+
+        handle_errno!(ThreadSetSchedulerError, from self,
+            errno_source unsafe { posix::pthread_setschedparam(self.handle, scheduler as i32, &param).into() },
+            success Errno::ESUCCES => (),
+            Errno::EPERM => (InsufficientPermissions, "{} to {:?} with priority {} due to insufficient permissions.", msg, scheduler, priority),
+            Errno::ESRCH => (ThreadNoLongerActive, "{} to {:?} with priority {} since the thread is no longer active.", msg, scheduler, priority),
+            Errno::EINVAL => (InvalidSchedulingParameters, "{} to {:?} with priority {} since the scheduling parameters are not supported.", msg, scheduler, priority),
+            v => (UnknownError(v as i32), "{} to {:?} with priority {} since an unknown error occurred ({}).", msg, scheduler, priority, v)
+        );
+    }
 }
 struct ThreadStartupArgs<'thread, T: Send + Debug + 'thread, F: FnOnce() -> T + Send + 'thread> {
     callback: F,
@@ -857,6 +893,14 @@ impl ThreadProperties for Thread {
     fn set_affinity(&mut self, cpu_core_ids: &[usize]) -> Result<(), ThreadSetAffinityError> {
         self.handle.set_affinity(cpu_core_ids)
     }
+
+    fn set_scheduler(
+        &mut self,
+        scheduler: Scheduler,
+        priority: u8,
+    ) -> Result<(), ThreadSetSchedulerError> {
+        self.handle.set_scheduler(scheduler, priority)
+    }
 }
 
 /// The scope guard that is living inside the [`thread_scope()`] call and which can be used
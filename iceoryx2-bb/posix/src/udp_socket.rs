@@ -68,7 +68,7 @@ use iceoryx2_bb_system_types::ipv4_address::{self, Ipv4Address};
 use iceoryx2_bb_system_types::port::{self, Port};
 use iceoryx2_log::{fail, fatal_panic, trace};
 use iceoryx2_pal_posix::posix::{self, MemZeroedStruct};
-use iceoryx2_pal_posix::posix::{Errno, SockAddrIn};
+use iceoryx2_pal_posix::posix::{Errno, IpMreq, SockAddrIn};
 
 use crate::file_descriptor::{FileDescriptor, FileDescriptorBased};
 use crate::file_descriptor_set::{
@@ -90,6 +90,7 @@ enum_gen! {
     AddressAlreadyInUse,
     AddressNotAvailable,
     AddressFamilyNotSupported,
+    InvalidMulticastGroup,
     UnknownError(i32)
 }
 
@@ -330,6 +331,7 @@ impl UdpClient {
 pub struct UdpServerBuilder {
     address: Ipv4Address,
     port: Port,
+    multicast_group: Option<Ipv4Address>,
 }
 
 impl Default for UdpServerBuilder {
@@ -337,6 +339,7 @@ impl Default for UdpServerBuilder {
         Self {
             address: ipv4_address::UNSPECIFIED,
             port: port::UNSPECIFIED,
+            multicast_group: None,
         }
     }
 }
@@ -361,8 +364,54 @@ impl UdpServerBuilder {
         self
     }
 
+    /// Can be set optionally. The [`UdpServer`] joins the provided multicast group on the
+    /// network interface with the [`UdpServerBuilder::address()`] and receives every message
+    /// that is sent to the group and [`UdpServerBuilder::port()`]. Multiple [`UdpServer`]s can
+    /// join the same group and port so that a single sent message reaches all of them.
+    pub fn multicast_group(mut self, group: Ipv4Address) -> Self {
+        self.multicast_group = Some(group);
+        self
+    }
+
+    fn set_socket_option<T>(
+        &self,
+        raw_fd: posix::int,
+        level: posix::int,
+        option: posix::int,
+        value: &T,
+        msg: &str,
+    ) -> Result<(), UdpServerCreateError> {
+        if unsafe {
+            posix::setsockopt(
+                raw_fd,
+                level,
+                option,
+                (value as *const T) as *const posix::void,
+                core::mem::size_of::<T>() as posix::socklen_t,
+            )
+        } == 0
+        {
+            return Ok(());
+        }
+
+        handle_errno!(UdpServerCreateError, from self,
+            Errno::EADDRNOTAVAIL => (AddressNotAvailable, "{} since the address is not available.", msg),
+            Errno::EINVAL => (InvalidMulticastGroup, "{} since the multicast group or interface address is invalid.", msg),
+            Errno::ENOBUFS => (InsufficientResources, "{} due to insufficient resources.", msg),
+            Errno::ENOMEM => (InsufficientMemory, "{} due to insufficient memory.", msg),
+            v => (UnknownError(v as i32), "{} since an unknown error occurred ({}).", msg, v)
+        );
+    }
+
     /// Creates a socket that listens on the specified address/port.
     pub fn listen(self) -> Result<UdpServer, UdpServerCreateError> {
+        if let Some(group) = self.multicast_group {
+            if !group.is_multicast() {
+                fail!(from self, with UdpServerCreateError::InvalidMulticastGroup,
+                    "Unable to create UdpServer socket since {} is not a multicast address.", group);
+            }
+        }
+
         let raw_fd = unsafe {
             posix::socket(
                 posix::PF_INET as posix::int,
@@ -385,7 +434,25 @@ impl UdpServerBuilder {
             );
         }
 
-        let server_address = create_sockaddr(self.address, self.port);
+        let socket_fd = unsafe { FileDescriptor::new_unchecked(raw_fd) };
+
+        // multicast members bind to all addresses, the interface address is only used to
+        // select the interface on which the group is joined
+        let bind_address = match self.multicast_group {
+            Some(_) => {
+                let reuse_address: posix::int = 1;
+                self.set_socket_option(
+                    raw_fd,
+                    posix::SOL_SOCKET,
+                    posix::SO_REUSEADDR,
+                    &reuse_address,
+                    "Unable to allow multiple multicast members on the UdpServer port",
+                )?;
+                ipv4_address::UNSPECIFIED
+            }
+            None => self.address,
+        };
+        let server_address = create_sockaddr(bind_address, self.port);
 
         let msg = "Unable to create and bind UdpServer socket";
         if unsafe {
@@ -405,6 +472,19 @@ impl UdpServerBuilder {
             );
         }
 
+        if let Some(group) = self.multicast_group {
+            let mut membership = posix::ip_mreq::new_zeroed();
+            membership.set_multicast_address(group.as_u32().to_be());
+            membership.set_interface_address(self.address.as_u32().to_be());
+            self.set_socket_option(
+                raw_fd,
+                posix::IPPROTO_IP,
+                posix::IP_ADD_MEMBERSHIP,
+                &membership,
+                "Unable to join the multicast group with the UdpServer socket",
+            )?;
+        }
+
         let mut client_address = posix::sockaddr_in::new_zeroed();
         let mut client_len = core::mem::size_of::<posix::sockaddr_in>() as posix::socklen_t;
 
@@ -422,10 +502,7 @@ impl UdpServerBuilder {
             );
         }
 
-        Ok(UdpServer::new(
-            unsafe { FileDescriptor::new_unchecked(raw_fd) },
-            client_address,
-        ))
+        Ok(UdpServer::new(socket_fd, client_address))
     }
 }
 
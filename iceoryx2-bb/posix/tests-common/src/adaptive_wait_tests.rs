@@ -146,3 +146,65 @@ pub fn long_wait_behavior_waits_at_least_timeout() {
     assert_that!(sut.yield_count(), eq 1);
     assert_that!(now.elapsed().unwrap(), time_at_least TIMEOUT);
 }
+
+#[test]
+pub fn backoff_wait_spins_and_yields_before_it_sleeps() {
+    const SLEEP: Duration = Duration::from_millis(20);
+    let mut sut = AdaptiveWaitBuilder::new()
+        .strategy(AdaptiveWaitStrategy::Backoff(Backoff {
+            spin_repetitions: 100,
+            yield_repetitions: 100,
+            initial_sleep: SLEEP,
+            max_sleep: SLEEP,
+        }))
+        .create()
+        .unwrap();
+
+    let now = Time::now().unwrap();
+    for _ in 0..200 {
+        assert_that!(sut.wait(), is_ok);
+    }
+    assert_that!(now.elapsed().unwrap(), lt SLEEP);
+
+    let now = Time::now().unwrap();
+    assert_that!(sut.wait(), is_ok);
+    assert_that!(sut.yield_count(), eq 201);
+    assert_that!(now.elapsed().unwrap(), time_at_least SLEEP);
+}
+
+#[test]
+pub fn backoff_wait_sleep_time_grows_exponentially_up_to_max_sleep() {
+    const INITIAL_SLEEP: Duration = Duration::from_millis(5);
+    const MAX_SLEEP: Duration = Duration::from_millis(15);
+    let mut sut = AdaptiveWaitBuilder::new()
+        .strategy(AdaptiveWaitStrategy::Backoff(Backoff {
+            spin_repetitions: 0,
+            yield_repetitions: 0,
+            initial_sleep: INITIAL_SLEEP,
+            max_sleep: MAX_SLEEP,
+        }))
+        .create()
+        .unwrap();
+
+    let now = Time::now().unwrap();
+    assert_that!(sut.wait(), is_ok);
+    assert_that!(now.elapsed().unwrap(), time_at_least INITIAL_SLEEP);
+
+    let now = Time::now().unwrap();
+    assert_that!(sut.wait(), is_ok);
+    assert_that!(now.elapsed().unwrap(), time_at_least INITIAL_SLEEP * 2);
+
+    let now = Time::now().unwrap();
+    assert_that!(sut.wait(), is_ok);
+    assert_that!(now.elapsed().unwrap(), time_at_least MAX_SLEEP);
+}
+
+#[test]
+pub fn default_backoff_corresponds_to_adaptive_strategy() {
+    let sut = Backoff::default();
+
+    assert_that!(sut.spin_repetitions, eq 0);
+    assert_that!(sut.yield_repetitions, eq ADAPTIVE_WAIT_YIELD_REPETITIONS);
+    assert_that!(sut.initial_sleep, eq ADAPTIVE_WAIT_INITIAL_WAITING_TIME);
+    assert_that!(sut.max_sleep, eq ADAPTIVE_WAIT_FINAL_WAITING_TIME);
+}
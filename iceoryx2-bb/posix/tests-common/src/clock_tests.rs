@@ -33,6 +33,23 @@ pub fn nanosleep_with_clock_sleeps_at_least_given_amount_of_time() {
     assert_that!(start.elapsed().expect("failed to get elapsed time"), time_at_least TIMEOUT);
 }
 
+#[test]
+pub fn nanosleep_until_sleeps_until_the_given_time() {
+    let start = Time::now_with_clock(ClockType::Realtime).expect("failed to get current time");
+    let wake_up_time = start.as_duration() + TIMEOUT;
+    let wake_up_time = TimeBuilder::new()
+        .clock_type(ClockType::Realtime)
+        .seconds(wake_up_time.as_secs())
+        .nanoseconds(wake_up_time.subsec_nanos())
+        .create();
+
+    assert_that!(nanosleep_until(wake_up_time), is_ok);
+    assert_that!(start.elapsed().expect("failed to get elapsed time"), time_at_least TIMEOUT);
+
+    // a time in the past returns right away
+    assert_that!(nanosleep_until(start), is_ok);
+}
+
 #[test]
 pub fn timebuilder_default_values_are_set_correctly() {
     let time = TimeBuilder::new().create();
@@ -128,3 +145,40 @@ pub fn converting_monotonic_time_to_realtime_time_results_in_nearly_the_same_tim
 
     assert_that!(time_diff_in_ms, le 1);
 }
+
+#[test]
+pub fn cycle_clock_time_is_based_on_the_monotonic_clock() {
+    test_requires!(Feature::MonotonicClock.is_available());
+
+    let before = Time::now_with_clock(ClockType::Monotonic).unwrap();
+    let sut = CycleClock::now().unwrap();
+    let after = Time::now_with_clock(ClockType::Monotonic).unwrap();
+
+    assert_that!(sut.clock_type(), eq ClockType::Monotonic);
+    // the calibration error of the cycle counter is in the range of microseconds
+    assert_that!(sut.as_duration() + Duration::from_millis(1), ge before.as_duration());
+    assert_that!(sut.as_duration(), le after.as_duration() + Duration::from_millis(1));
+}
+
+#[test]
+pub fn cycle_clock_elapsed_since_measures_the_passed_time() {
+    test_requires!(Feature::MonotonicClock.is_available());
+
+    let start = CycleClock::now().unwrap();
+    assert_that!(nanosleep(TIMEOUT), is_ok);
+    let elapsed = CycleClock::elapsed_since(&start).unwrap();
+
+    assert_that!(elapsed + Duration::from_millis(1), time_at_least TIMEOUT);
+}
+
+#[test]
+pub fn cycle_clock_is_monotonic_between_resyncs() {
+    test_requires!(Feature::MonotonicClock.is_available());
+
+    let mut previous = CycleClock::now().unwrap();
+    for _ in 0..10000 {
+        let current = CycleClock::now().unwrap();
+        assert_that!(current.as_duration() + Duration::from_millis(1), ge previous.as_duration());
+        previous = current;
+    }
+}
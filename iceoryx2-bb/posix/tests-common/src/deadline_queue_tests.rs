@@ -137,6 +137,40 @@ pub fn one_missed_deadlines_works() {
     assert_that!(missed_deadlines, contains _guard_1.index());
 }
 
+#[test]
+pub fn deadlines_with_the_same_phase_expire_together() {
+    const PERIOD: Duration = Duration::from_millis(100);
+    let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+    let guard_1 = sut
+        .add_deadline_interval_with_phase(PERIOD, Duration::from_millis(30))
+        .unwrap();
+    nanosleep(Duration::from_millis(20)).expect("failed to sleep");
+    // the phase is applied modulo the period
+    let guard_2 = sut
+        .add_deadline_interval_with_phase(PERIOD, PERIOD * 3 + Duration::from_millis(30))
+        .unwrap();
+
+    // the first deadline may have expired already while the second one was added
+    sut.missed_deadlines(|_| CallbackProgression::Continue)
+        .unwrap();
+
+    let timeout = sut.duration_until_next_deadline().unwrap();
+    assert_that!(timeout, le PERIOD);
+    nanosleep(timeout).expect("failed to sleep");
+
+    let mut missed_deadlines = vec![];
+    sut.missed_deadlines(|idx| {
+        missed_deadlines.push(idx);
+        CallbackProgression::Continue
+    })
+    .unwrap();
+
+    assert_that!(missed_deadlines, len 2);
+    assert_that!(missed_deadlines, contains guard_1.index());
+    assert_that!(missed_deadlines, contains guard_2.index());
+}
+
 #[test]
 pub fn many_missed_deadlines_works() {
     let sut = DeadlineQueueBuilder::new().create().unwrap();
@@ -227,3 +261,126 @@ pub fn duration_until_next_deadline_is_not_zero_if_missed_deadline_have_been_han
     let next_deadline = sut.duration_until_next_deadline().unwrap();
     assert_that!(next_deadline, ne Duration::ZERO);
 }
+
+#[test]
+pub fn reset_deadline_is_not_reported_as_missed() {
+    let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+    let guard_1 = sut
+        .add_deadline_interval(Duration::from_millis(100))
+        .unwrap();
+    let guard_2 = sut
+        .add_deadline_interval(Duration::from_millis(100))
+        .unwrap();
+
+    nanosleep(Duration::from_millis(60)).expect("failed to sleep");
+    guard_1.reset().unwrap();
+    nanosleep(Duration::from_millis(60)).expect("failed to sleep");
+
+    let mut missed_deadlines = vec![];
+    sut.missed_deadlines(|idx| {
+        missed_deadlines.push(idx);
+        CallbackProgression::Continue
+    })
+    .unwrap();
+
+    assert_that!(missed_deadlines, len 1);
+    assert_that!(missed_deadlines, contains guard_2.index());
+
+    let next_deadline = sut.duration_until_next_deadline().unwrap();
+    assert_that!(next_deadline, le Duration::from_millis(40));
+}
+
+#[test]
+pub fn removed_deadlines_are_no_longer_reported_among_many_deadlines() {
+    const NUMBER_OF_DEADLINES: usize = 2048;
+    let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+    let mut guards = vec![];
+    for _ in 0..NUMBER_OF_DEADLINES {
+        guards.push(sut.add_deadline_interval(Duration::from_nanos(1)).unwrap());
+    }
+    let _long_guard = sut.add_deadline_interval(Duration::from_secs(100)).unwrap();
+
+    let remaining_guards = guards.split_off(NUMBER_OF_DEADLINES / 2);
+    guards.clear();
+    assert_that!(sut.len(), eq NUMBER_OF_DEADLINES / 2 + 1);
+
+    nanosleep(Duration::from_millis(1)).expect("failed to sleep");
+
+    let mut missed_deadlines = vec![];
+    sut.missed_deadlines(|idx| {
+        missed_deadlines.push(idx);
+        CallbackProgression::Continue
+    })
+    .unwrap();
+
+    assert_that!(missed_deadlines, len NUMBER_OF_DEADLINES / 2);
+    for guard in &remaining_guards {
+        assert_that!(missed_deadlines, contains guard.index());
+    }
+}
+
+#[test]
+pub fn batch_reset_deadlines_are_not_reported_as_missed() {
+    const NUMBER_OF_DEADLINES: usize = 64;
+    let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+    let mut guards = vec![];
+    for _ in 0..NUMBER_OF_DEADLINES {
+        guards.push(
+            sut.add_deadline_interval(Duration::from_millis(20))
+                .unwrap(),
+        );
+    }
+
+    nanosleep(Duration::from_millis(15)).expect("failed to sleep");
+    sut.reset_deadlines(guards.iter().step_by(2).map(|guard| guard.index()))
+        .unwrap();
+    nanosleep(Duration::from_millis(10)).expect("failed to sleep");
+
+    let mut missed_deadlines = vec![];
+    sut.missed_deadlines(|idx| {
+        missed_deadlines.push(idx);
+        CallbackProgression::Continue
+    })
+    .unwrap();
+
+    assert_that!(missed_deadlines, len NUMBER_OF_DEADLINES / 2);
+    for guard in guards.iter().skip(1).step_by(2) {
+        assert_that!(missed_deadlines, contains guard.index());
+    }
+}
+
+#[test]
+pub fn batch_removed_deadlines_are_no_longer_reported() {
+    const NUMBER_OF_DEADLINES: usize = 2048;
+    let sut = DeadlineQueueBuilder::new().create().unwrap();
+
+    let mut guards = vec![];
+    for _ in 0..NUMBER_OF_DEADLINES {
+        guards.push(sut.add_deadline_interval(Duration::from_nanos(1)).unwrap());
+    }
+    let _long_guard = sut.add_deadline_interval(Duration::from_secs(100)).unwrap();
+
+    let remaining_guards = guards.split_off(NUMBER_OF_DEADLINES / 2);
+    sut.remove_deadlines(guards);
+    assert_that!(sut.len(), eq NUMBER_OF_DEADLINES / 2 + 1);
+
+    nanosleep(Duration::from_millis(1)).expect("failed to sleep");
+
+    let mut missed_deadlines = vec![];
+    sut.missed_deadlines(|idx| {
+        missed_deadlines.push(idx);
+        CallbackProgression::Continue
+    })
+    .unwrap();
+
+    assert_that!(missed_deadlines, len NUMBER_OF_DEADLINES / 2);
+    for guard in &remaining_guards {
+        assert_that!(missed_deadlines, contains guard.index());
+    }
+
+    sut.remove_deadlines(remaining_guards);
+    assert_that!(sut.len(), eq 1);
+}
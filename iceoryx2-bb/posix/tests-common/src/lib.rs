@@ -28,11 +28,13 @@ pub mod file_tests;
 pub mod file_type_tests;
 pub mod group_tests;
 pub mod ipc_capable_trait_tests;
+pub mod memory_fd_tests;
 pub mod memory_lock_tests;
 pub mod memory_mapping_tests;
 pub mod memory_tests;
 pub mod metadata_tests;
 pub mod mutex_tests;
+pub mod numa_tests;
 pub mod ownership_tests;
 pub mod permission_tests;
 pub mod process_state_tests;
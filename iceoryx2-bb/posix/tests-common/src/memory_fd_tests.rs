@@ -0,0 +1,117 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_posix::file_descriptor::*;
+use iceoryx2_bb_posix::memory_fd::*;
+use iceoryx2_bb_posix::memory_mapping::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing::test_requires;
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_MEMORY_FD;
+
+fn name() -> FileName {
+    FileName::new(b"memory_fd_tests").unwrap()
+}
+
+fn map(memory: &MemoryFd) -> MemoryMapping {
+    MemoryMappingBuilder::from_file_descriptor(memory.file_descriptor().clone())
+        .mapping_behavior(MappingBehavior::Shared)
+        .initial_mapping_permission(MappingPermission::ReadWrite)
+        .size(memory.size())
+        .create()
+        .unwrap()
+}
+
+#[test]
+pub fn memory_fd_with_size_zero_cannot_be_created() {
+    test_requires!(POSIX_SUPPORT_MEMORY_FD);
+
+    let sut = MemoryFdBuilder::new(&name()).create();
+
+    assert_that!(sut.err(), eq Some(MemoryFdCreationError::UnsupportedSizeOfZero));
+}
+
+#[test]
+pub fn memory_fd_has_the_configured_size() {
+    test_requires!(POSIX_SUPPORT_MEMORY_FD);
+
+    let memory_size = SystemInfo::PageSize.value() * 3;
+    let sut = MemoryFdBuilder::new(&name())
+        .size(memory_size)
+        .create()
+        .unwrap();
+
+    assert_that!(sut.size(), eq memory_size);
+    assert_that!(sut.metadata().unwrap().size(), eq memory_size as u64);
+}
+
+#[test]
+pub fn memory_fd_is_shared_with_a_received_file_descriptor() {
+    test_requires!(POSIX_SUPPORT_MEMORY_FD);
+
+    let memory_size = SystemInfo::PageSize.value();
+    let sut = MemoryFdBuilder::new(&name())
+        .size(memory_size)
+        .create()
+        .unwrap();
+
+    let received = MemoryFd::from_file_descriptor(sut.file_descriptor().clone()).unwrap();
+    assert_that!(received.size(), eq memory_size);
+
+    let mut sut_mapping = map(&sut);
+    let received_mapping = map(&received);
+
+    for i in 0..memory_size {
+        sut_mapping.as_mut_slice()[i] = (i % 251) as u8;
+    }
+
+    for i in 0..memory_size {
+        assert_that!(received_mapping.as_slice()[i], eq(i % 251) as u8);
+    }
+}
+
+#[test]
+pub fn sealed_memory_fd_cannot_be_resized() {
+    test_requires!(POSIX_SUPPORT_MEMORY_FD);
+
+    let memory_size = SystemInfo::PageSize.value();
+    let sut = MemoryFdBuilder::new(&name())
+        .size(memory_size)
+        .create()
+        .unwrap();
+    assert_that!(sut.is_size_sealed().unwrap(), eq false);
+
+    assert_that!(sut.seal_size(), is_ok);
+    assert_that!(sut.is_size_sealed().unwrap(), eq true);
+
+    let mut received = MemoryFd::from_file_descriptor(sut.file_descriptor().clone()).unwrap();
+    assert_that!(received.is_size_sealed().unwrap(), eq true);
+    assert_that!(received.truncate(memory_size / 2), is_err);
+    assert_that!(received.truncate(memory_size * 2), is_err);
+    assert_that!(received.metadata().unwrap().size(), eq memory_size as u64);
+}
+
+#[test]
+pub fn memory_fd_without_sealing_support_cannot_be_sealed() {
+    test_requires!(POSIX_SUPPORT_MEMORY_FD);
+
+    let sut = MemoryFdBuilder::new(&name())
+        .size(SystemInfo::PageSize.value())
+        .allow_sealing(false)
+        .create()
+        .unwrap();
+
+    assert_that!(sut.seal_size().err(), eq Some(MemoryFdSealError::SealingNotAllowed));
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_posix::memory_mapping::*;
+use iceoryx2_bb_posix::numa::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_testing::{assert_that, test_requires};
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_NUMA_MEMORY_POLICY;
+
+fn apply_and_touch(policy: NumaPolicy) -> Result<NumaPolicy, NumaPolicyError> {
+    let memory_size = SystemInfo::PageSize.value() * 4;
+    let mut mapping = MemoryMappingBuilder::from_anonymous()
+        .initial_mapping_permission(MappingPermission::ReadWrite)
+        .size(memory_size)
+        .create()
+        .unwrap();
+
+    let result = unsafe { policy.apply(mapping.base_address_mut(), memory_size) };
+
+    for e in mapping.as_mut_slice().iter_mut() {
+        *e = 123;
+    }
+
+    for e in mapping.as_slice().iter() {
+        assert_that!(*e, eq 123);
+    }
+
+    result
+}
+
+#[test]
+pub fn resolve_of_creating_thread_node_returns_preferred_node() {
+    test_requires!(POSIX_SUPPORT_NUMA_MEMORY_POLICY);
+
+    let sut = NumaPolicy::CreatingThreadNode.resolve();
+
+    match NumaPolicy::current_node() {
+        Some(node) => assert_that!(sut, eq NumaPolicy::PreferredNode(node)),
+        None => assert_that!(sut, eq NumaPolicy::Default),
+    }
+}
+
+#[test]
+pub fn resolve_keeps_explicit_policies() {
+    test_requires!(POSIX_SUPPORT_NUMA_MEMORY_POLICY);
+
+    assert_that!(NumaPolicy::Default.resolve(), eq NumaPolicy::Default);
+    assert_that!(NumaPolicy::Interleave.resolve(), eq NumaPolicy::Interleave);
+    assert_that!(NumaPolicy::PreferredNode(0).resolve(), eq NumaPolicy::PreferredNode(0));
+}
+
+#[test]
+pub fn apply_preferred_node_of_current_thread_works() {
+    test_requires!(POSIX_SUPPORT_NUMA_MEMORY_POLICY);
+
+    let result = apply_and_touch(NumaPolicy::CreatingThreadNode);
+
+    // kernels without NUMA support reject every policy
+    if result != Err(NumaPolicyError::NotSupported) {
+        assert_that!(result, eq Ok(NumaPolicy::CreatingThreadNode.resolve()));
+    }
+}
+
+#[test]
+pub fn apply_interleave_works() {
+    test_requires!(POSIX_SUPPORT_NUMA_MEMORY_POLICY);
+
+    let result = apply_and_touch(NumaPolicy::Interleave);
+
+    if result != Err(NumaPolicyError::NotSupported) {
+        assert_that!(result, eq Ok(NumaPolicy::Interleave));
+    }
+}
+
+#[test]
+pub fn apply_node_beyond_max_numa_node_fails() {
+    test_requires!(POSIX_SUPPORT_NUMA_MEMORY_POLICY);
+
+    let result = apply_and_touch(NumaPolicy::PreferredNode(MAX_NUMA_NODE + 1));
+
+    assert_that!(result, eq Err(NumaPolicyError::InvalidNode));
+}
@@ -12,12 +12,15 @@
 
 use alloc::vec;
 
+use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_posix::shared_memory::*;
 use iceoryx2_bb_posix::testing::generate_file_path;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_bb_testing::{assert_that, test_requires};
 use iceoryx2_bb_testing_macros::test;
 use iceoryx2_pal_posix::posix::POSIX_SUPPORT_PERSISTENT_SHARED_MEMORY;
+use iceoryx2_pal_posix::posix::POSIX_SUPPORT_TYPED_MEMORY;
 
 #[test]
 pub fn create_and_open_works() {
@@ -51,6 +54,54 @@ pub fn create_and_open_works() {
     }
 }
 
+#[test]
+pub fn create_with_huge_pages_works_or_falls_back_to_regular_pages() {
+    const SIZE: usize = 4 * 1024 * 1024;
+    let shm_name = generate_file_path().file_name();
+    let mut sut_create = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(SIZE)
+        .permission(Permission::OWNER_ALL)
+        .use_huge_pages(true)
+        .create()
+        .unwrap();
+
+    let sut_open = SharedMemoryBuilder::new(&shm_name)
+        .open_existing(AccessMode::Read)
+        .unwrap();
+
+    assert_that!(sut_create.size(), ge SIZE);
+    assert_that!(sut_create.size(), eq sut_open.size());
+
+    for e in sut_create.as_mut_slice().iter_mut() {
+        *e = 85;
+    }
+
+    for e in sut_open.as_slice().iter() {
+        assert_that!(*e, eq 85);
+    }
+}
+
+#[test]
+pub fn create_with_typed_memory_fails_when_typed_memory_is_unavailable() {
+    let shm_name = generate_file_path().file_name();
+    let typed_memory = if POSIX_SUPPORT_TYPED_MEMORY {
+        FilePath::new(b"/memory/iox2_non_existing_typed_memory_pool").unwrap()
+    } else {
+        FilePath::new(b"/memory/below4G").unwrap()
+    };
+
+    let sut = SharedMemoryBuilder::new(&shm_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(1024)
+        .permission(Permission::OWNER_ALL)
+        .typed_memory(&typed_memory)
+        .create();
+
+    assert_that!(sut, is_err);
+    assert_that!(sut.err().unwrap(), eq SharedMemoryCreationError::TypedMemoryUnavailable);
+}
+
 #[test]
 pub fn create_and_modify_open_works() {
     let shm_name = generate_file_path().file_name();
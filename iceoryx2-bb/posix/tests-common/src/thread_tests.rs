@@ -18,6 +18,7 @@ use iceoryx2_bb_posix::barrier::BarrierHandle;
 use iceoryx2_bb_posix::barrier::Handle;
 use iceoryx2_bb_posix::clock::Time;
 use iceoryx2_bb_posix::clock::nanosleep;
+use iceoryx2_bb_posix::scheduler::Scheduler;
 use iceoryx2_bb_posix::system_configuration::SystemInfo;
 use iceoryx2_bb_posix::thread::MAX_SCOPED_THREADS;
 use iceoryx2_bb_posix::thread::ThreadBuilder;
@@ -454,3 +455,17 @@ pub fn scoped_threads_work() {
         eq(number_of_threads * 1000) as u64
     );
 }
+
+#[test]
+pub fn set_scheduler_from_handle_works() {
+    let _watchdog = Watchdog::new();
+
+    let thread = ThreadBuilder::new()
+        .spawn(|| {
+            let mut handle = ThreadHandle::from_self();
+            assert_that!(handle.set_scheduler(Scheduler::Other, 0), is_ok);
+        })
+        .unwrap();
+
+    drop(thread);
+}
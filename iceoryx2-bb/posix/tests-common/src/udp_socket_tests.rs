@@ -78,6 +78,35 @@ pub fn server_with_same_address_and_port_fails() {
     assert_that!(sut_server_2.err().unwrap(), eq UdpServerCreateError::AddressAlreadyInUse);
 }
 
+#[test]
+pub fn server_with_non_multicast_group_fails() {
+    let sut = UdpServerBuilder::new()
+        .address(ipv4_address::LOCALHOST)
+        .multicast_group(Ipv4Address::new(10, 0, 0, 1))
+        .listen();
+
+    assert_that!(sut.err().unwrap(), eq UdpServerCreateError::InvalidMulticastGroup);
+}
+
+#[test]
+pub fn multiple_servers_can_join_the_same_multicast_group_and_port() {
+    let group = Ipv4Address::new(239, 255, 0, 1);
+    let sut_server_1 = UdpServerBuilder::new()
+        .address(ipv4_address::LOCALHOST)
+        .multicast_group(group)
+        .listen()
+        .unwrap();
+
+    let sut_server_2 = UdpServerBuilder::new()
+        .address(ipv4_address::LOCALHOST)
+        .port(sut_server_1.port())
+        .multicast_group(group)
+        .listen();
+
+    assert_that!(sut_server_2, is_ok);
+    assert_that!(sut_server_2.unwrap().port(), eq sut_server_1.port());
+}
+
 #[test]
 pub fn when_socket_goes_out_of_scope_address_is_free_again() {
     let port;
@@ -21,4 +21,10 @@ if(NOT ICEORYX2_C_OPTIONS_AND_PARAMS_LISTED)
         DEFAULT_VALUE ""
     )
 
+    add_option(
+        NAME IOX2_CROSS_LANGUAGE_LTO
+        DESCRIPTION "Enable link time optimization across the Rust FFI boundary for targets linking the static libraries (requires clang and lld matching the LLVM version of rustc, with 'RUST_BUILD_ARTIFACT_PATH' the Rust part must be built with 'RUSTFLAGS=-Clinker-plugin-lto')"
+        DEFAULT_VALUE OFF
+    )
+
 endif()
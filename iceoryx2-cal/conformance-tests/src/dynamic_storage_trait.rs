@@ -107,6 +107,49 @@ pub mod dynamic_storage_trait {
         assert_that!(sut2.get().value.load(Ordering::Relaxed), eq 456);
     }
 
+    #[conformance_test]
+    pub fn prefaulted_storage_with_supplementary_memory_works<
+        Sut: DynamicStorage<TestData>,
+        WrongTypeSut: DynamicStorage<u64>,
+    >() {
+        const SUPPLEMENTARY_SIZE: usize = 3 * 4096 + 123;
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut = Sut::Builder::new(&storage_name)
+            .config(&config)
+            .prefault(true)
+            .supplementary_size(SUPPLEMENTARY_SIZE)
+            .initializer(|value, allocator| {
+                value.write(TestData::new(2718));
+                let value = unsafe { value.assume_init_mut() };
+
+                let layout = Layout::from_size_align(SUPPLEMENTARY_SIZE, 1).unwrap();
+                let mem = allocator.allocate(layout).unwrap();
+
+                value.supplementary_ptr = mem.as_ptr() as *mut u8;
+                value.supplementary_len = mem.len();
+
+                for i in 0..SUPPLEMENTARY_SIZE {
+                    unsafe { value.supplementary_ptr.add(i).write(i as u8) };
+                }
+                true
+            })
+            .create()
+            .unwrap();
+
+        let sut2 = Sut::Builder::new(&storage_name)
+            .config(&config)
+            .open(AccessMode::ReadWrite)
+            .unwrap();
+
+        assert_that!(sut2.get().value.load(Ordering::Relaxed), eq 2718);
+        assert_that!(sut.get().supplementary_len, eq SUPPLEMENTARY_SIZE);
+        for i in 0..SUPPLEMENTARY_SIZE {
+            assert_that!(unsafe { *sut.get().supplementary_ptr.add(i) }, eq i as u8);
+        }
+    }
+
     #[conformance_test]
     pub fn open_non_existing_fails<
         Sut: DynamicStorage<TestData>,
@@ -907,6 +907,41 @@ pub mod event_trait {
         assert_that!(result, eq event_count);
     }
 
+    #[conformance_test]
+    pub fn notify_with_value_delivers_the_latest_value<E: EventState, Sut: Event<E>>() {
+        let _watchdog = Watchdog::new();
+        const EVENT_ID_MAX: usize = 4;
+        let name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut_listener = Sut::ListenerBuilder::new(&name)
+            .config(&config)
+            .event_id_max(EventId::new(EVENT_ID_MAX))
+            .create()
+            .unwrap();
+        let sut_notifier = Sut::NotifierBuilder::new(&name)
+            .config(&config)
+            .open()
+            .unwrap();
+
+        sut_notifier.notify_with_value(EventId::new(1), 99).unwrap();
+        sut_notifier
+            .notify_with_value(EventId::new(1), 123)
+            .unwrap();
+        sut_notifier.notify(EventId::new(2)).unwrap();
+        assert_that!(
+            sut_notifier.notify_with_value(EventId::new(EVENT_ID_MAX + 1), 5),
+            eq Err(NotifierNotifyError::EventIdOutOfBounds)
+        );
+
+        let mut values = [None; EVENT_ID_MAX + 1];
+        sut_listener
+            .try_wait(|event| values[event.id.as_value()] = Some(event.value))
+            .unwrap();
+        assert_that!(values[1], eq Some(123));
+        assert_that!(values[2], eq Some(0));
+    }
+
     #[conformance_test]
     pub fn many_events_notified_multiple_times_are_counted<E: EventState, Sut: Event<E>>() {
         let _watchdog = Watchdog::new();
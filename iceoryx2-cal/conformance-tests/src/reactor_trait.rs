@@ -175,6 +175,32 @@ pub mod reactor_trait {
         });
     }
 
+    #[conformance_test]
+    pub fn reactor_with_io_uring_backend_is_triggered<Sut: Reactor>() {
+        // reactors fall back to their recommended backend when io_uring is not available
+        let sut = <<Sut as Reactor>::Builder>::new()
+            .backend(ReactorBackend::IoUring)
+            .create()
+            .unwrap();
+
+        let attachment = NotifierListenerPair::new();
+        let _guard = sut.attach(&attachment.listener).unwrap();
+        assert_that!(sut.try_wait(|_| {}).unwrap(), eq 0);
+
+        attachment.notifier.notify(EventId::new(3)).unwrap();
+
+        let mut triggered_fds = vec![];
+        let number_of_triggers = sut
+            .timed_wait(
+                |fd| triggered_fds.push(unsafe { fd.native_handle() }),
+                INFINITE_TIMEOUT,
+            )
+            .unwrap();
+        assert_that!(number_of_triggers, eq 1);
+        assert_that!(triggered_fds, len 1);
+        assert_that!(triggered_fds[0], eq unsafe { attachment.listener.file_descriptor().native_handle() });
+    }
+
     fn wait_activates_as_long_as_there_is_data_to_read<
         Sut: Reactor,
         F: FnMut(&Sut, &mut Vec<i32>) -> usize,
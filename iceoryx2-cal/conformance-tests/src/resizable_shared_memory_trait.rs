@@ -20,6 +20,7 @@ pub type DefaultAllocator = PoolAllocator;
 pub mod resizable_shared_memory_trait {
     use alloc::vec;
     use core::alloc::Layout;
+    use core::time::Duration;
     use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
     use iceoryx2_bb_posix::file::AccessMode;
     use iceoryx2_pal_posix::posix::POSIX_SUPPORT_PERSISTENT_SHARED_MEMORY;
@@ -939,6 +940,209 @@ pub mod resizable_shared_memory_trait {
         assert_that!(sut_viewer.number_of_active_segments(), eq 1);
     }
 
+    #[conformance_test]
+    pub fn size_class_strategy_reuses_segments_of_the_same_size_class<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(4)
+            .allocation_strategy(AllocationStrategy::SizeClasses)
+            .create()
+            .unwrap();
+
+        let small_chunk = sut.allocate(Layout::new::<u8>()).unwrap();
+        assert_that!(sut.number_of_active_segments(), eq 1);
+        let large_chunk = sut.allocate(Layout::new::<u64>()).unwrap();
+        assert_that!(sut.number_of_active_segments(), eq 2);
+        let medium_chunk = sut.allocate(Layout::new::<u32>()).unwrap();
+        assert_that!(sut.number_of_active_segments(), eq 3);
+
+        unsafe { sut.deallocate(small_chunk.offset, Layout::new::<u8>()) };
+        unsafe { sut.deallocate(large_chunk.offset, Layout::new::<u64>()) };
+        unsafe { sut.deallocate(medium_chunk.offset, Layout::new::<u32>()) };
+        assert_that!(sut.number_of_active_segments(), eq 3);
+
+        let chunk = sut.allocate(Layout::new::<u64>()).unwrap();
+        assert_that!(chunk.offset.segment_id(), eq large_chunk.offset.segment_id());
+        let chunk = sut.allocate(Layout::new::<u32>()).unwrap();
+        assert_that!(chunk.offset.segment_id(), eq medium_chunk.offset.segment_id());
+        assert_that!(sut.number_of_active_segments(), eq 3);
+    }
+
+    #[conformance_test]
+    pub fn size_class_strategy_adds_segment_when_size_class_is_exhausted<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        let layout = Layout::new::<u64>();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(layout)
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::SizeClasses)
+            .create()
+            .unwrap();
+
+        let chunk_1 = sut.allocate(layout).unwrap();
+        let chunk_2 = sut.allocate(layout).unwrap();
+        let chunk_3 = sut.allocate(layout).unwrap();
+        // the second segment of the size class has space for two chunks
+        assert_that!(sut.number_of_active_segments(), eq 2);
+        assert_that!(chunk_2.offset.segment_id(), eq chunk_3.offset.segment_id());
+        assert_that!(chunk_1.offset.segment_id(), ne chunk_2.offset.segment_id());
+    }
+
+    #[conformance_test]
+    pub fn view_with_retained_empty_segments_keeps_segments_mapped<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let config = generate_isolated_config::<Sut>();
+        let storage_name = generate_file_path().file_name();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::SizeClasses)
+            .create()
+            .unwrap();
+
+        let chunk_1 = sut.allocate(Layout::new::<u8>()).unwrap().offset;
+        let chunk_2 = sut.allocate(Layout::new::<u16>()).unwrap().offset;
+        let chunk_3 = sut.allocate(Layout::new::<u32>()).unwrap().offset;
+
+        let sut_viewer = Sut::ViewBuilder::new(&storage_name)
+            .config(&config)
+            .retain_empty_segments(true)
+            .open(AccessMode::ReadWrite)
+            .unwrap();
+
+        unsafe { sut_viewer.register_and_translate_offset(chunk_1).unwrap() };
+        unsafe { sut_viewer.register_and_translate_offset(chunk_2).unwrap() };
+        unsafe { sut_viewer.register_and_translate_offset(chunk_3).unwrap() };
+        assert_that!(sut_viewer.number_of_active_segments(), eq 3);
+
+        unsafe { sut_viewer.unregister_offset(chunk_1) };
+        unsafe { sut_viewer.unregister_offset(chunk_2) };
+        unsafe { sut_viewer.unregister_offset(chunk_3) };
+        assert_that!(sut_viewer.number_of_active_segments(), eq 3);
+    }
+
+    #[conformance_test]
+    pub fn idle_oversized_segment_is_released_with_shrink_policy<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        let large_layout = Layout::from_size_align(1024, 1).unwrap();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .shrink_policy(ShrinkPolicy::AfterIdleTime(Duration::ZERO))
+            .create()
+            .unwrap();
+        let sut_viewer = Sut::ViewBuilder::new(&storage_name)
+            .config(&config)
+            .open(AccessMode::ReadWrite)
+            .unwrap();
+        let initial_statistics = sut.segment_statistics();
+
+        let large_chunk = sut.allocate(large_layout).unwrap();
+        unsafe {
+            sut_viewer
+                .register_and_translate_offset(large_chunk.offset)
+                .unwrap()
+        };
+        let statistics = sut.segment_statistics();
+        assert_that!(statistics.current_segment_size, gt initial_statistics.current_segment_size);
+
+        unsafe { sut_viewer.unregister_offset(large_chunk.offset) };
+        unsafe { sut.deallocate(large_chunk.offset, large_layout) };
+
+        let small_chunk = sut.allocate(Layout::new::<u8>()).unwrap();
+        let statistics = sut.segment_statistics();
+        assert_that!(statistics.number_of_released_segments, eq 1);
+        assert_that!(statistics.number_of_active_segments, eq 1);
+        assert_that!(statistics.current_segment_size, eq initial_statistics.current_segment_size);
+        assert_that!(statistics.total_size, eq initial_statistics.total_size);
+
+        unsafe {
+            sut_viewer
+                .register_and_translate_offset(small_chunk.offset)
+                .unwrap()
+        };
+        assert_that!(sut_viewer.number_of_active_segments(), eq 1);
+    }
+
+    #[conformance_test]
+    pub fn oversized_segment_is_kept_without_shrink_policy<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        let large_layout = Layout::from_size_align(1024, 1).unwrap();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .create()
+            .unwrap();
+        let initial_statistics = sut.segment_statistics();
+
+        let large_chunk = sut.allocate(large_layout).unwrap();
+        unsafe { sut.deallocate(large_chunk.offset, large_layout) };
+        sut.allocate(Layout::new::<u8>()).unwrap();
+
+        let statistics = sut.segment_statistics();
+        assert_that!(statistics.number_of_released_segments, eq 0);
+        assert_that!(statistics.current_segment_size, gt initial_statistics.current_segment_size);
+    }
+
+    #[conformance_test]
+    pub fn oversized_segment_is_kept_when_it_was_not_idle_long_enough<
+        Shm: SharedMemory<DefaultAllocator>,
+        Sut: ResizableSharedMemory<DefaultAllocator, Shm>,
+    >() {
+        let storage_name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        let large_layout = Layout::from_size_align(1024, 1).unwrap();
+
+        let sut = Sut::MemoryBuilder::new(&storage_name)
+            .config(&config)
+            .max_chunk_layout_hint(Layout::new::<u8>())
+            .max_number_of_chunks_hint(1)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .shrink_policy(ShrinkPolicy::AfterIdleTime(Duration::from_secs(3600)))
+            .create()
+            .unwrap();
+        let initial_statistics = sut.segment_statistics();
+
+        let large_chunk = sut.allocate(large_layout).unwrap();
+        unsafe { sut.deallocate(large_chunk.offset, large_layout) };
+        sut.allocate(Layout::new::<u8>()).unwrap();
+
+        let statistics = sut.segment_statistics();
+        assert_that!(statistics.number_of_released_segments, eq 0);
+        assert_that!(statistics.current_segment_size, gt initial_statistics.current_segment_size);
+    }
+
     #[conformance_test]
     pub fn abandoning_creator_keeps_resources_alive<
         Shm: SharedMemory<DefaultAllocator>,
@@ -426,6 +426,147 @@ pub mod zero_copy_connection_trait {
         assert_that!(retrieval, is_none);
     }
 
+    #[conformance_test]
+    pub fn receive_latest_returns_newest_offset_and_releases_older_ones<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        const NUMBER_OF_SENT_SAMPLES: usize = 5;
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(NUMBER_OF_SENT_SAMPLES)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(NUMBER_OF_SENT_SAMPLES)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_receiver.receive_latest(id).unwrap(), is_none);
+
+        for i in 0..NUMBER_OF_SENT_SAMPLES {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * i), SAMPLE_SIZE, id),
+                is_ok
+            );
+        }
+
+        let sample = sut_receiver.receive_latest(id).unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(sample.as_ref().unwrap().offset(), eq SAMPLE_SIZE * (NUMBER_OF_SENT_SAMPLES - 1));
+        assert_that!(sut_receiver.borrow_count(id), eq 1);
+        assert_that!(sut_receiver.has_data(id), eq false);
+
+        for i in 0..NUMBER_OF_SENT_SAMPLES - 1 {
+            let retrieval = sut_sender.reclaim(id).unwrap();
+            assert_that!(retrieval, is_some);
+            assert_that!(retrieval.unwrap().offset(), eq SAMPLE_SIZE * i);
+        }
+        assert_that!(sut_sender.reclaim(id).unwrap(), is_none);
+
+        assert_that!(sut_receiver.release(sample.unwrap(), id), is_ok);
+        assert_that!(sut_receiver.borrow_count(id), eq 0);
+        let retrieval = sut_sender.reclaim(id).unwrap();
+        assert_that!(retrieval.unwrap().offset(), eq SAMPLE_SIZE * (NUMBER_OF_SENT_SAMPLES - 1));
+    }
+
+    #[conformance_test]
+    pub fn reduced_active_buffer_size_limits_the_number_of_sent_offsets<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        const BUFFER_SIZE: usize = 12;
+        const ACTIVE_BUFFER_SIZE: usize = 5;
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_receiver.active_buffer_size(), eq BUFFER_SIZE);
+        assert_that!(sut_receiver.set_active_buffer_size(ACTIVE_BUFFER_SIZE), eq ACTIVE_BUFFER_SIZE);
+        assert_that!(sut_sender.active_buffer_size(), eq ACTIVE_BUFFER_SIZE);
+        assert_that!(sut_sender.buffer_size(), eq BUFFER_SIZE);
+
+        for i in 0..ACTIVE_BUFFER_SIZE {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * i), SAMPLE_SIZE, id),
+                is_ok
+            );
+        }
+
+        let result = sut_sender.try_send(PointerOffset::new(0), SAMPLE_SIZE, id);
+        assert_that!(result.err(), eq Some(ZeroCopySendError::ReceiveBufferFull));
+
+        assert_that!(sut_receiver.set_active_buffer_size(BUFFER_SIZE + 1), eq BUFFER_SIZE);
+        assert_that!(
+            sut_sender.try_send(PointerOffset::new(0), SAMPLE_SIZE, id),
+            is_ok
+        );
+    }
+
+    #[conformance_test]
+    pub fn shrinking_active_buffer_size_returns_surplus_offsets_to_sender<
+        Sut: ZeroCopyConnection,
+    >() {
+        let id = ChannelId::new(0);
+        let name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        const BUFFER_SIZE: usize = 8;
+        const ACTIVE_BUFFER_SIZE: usize = 3;
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * i), SAMPLE_SIZE, id),
+                is_ok
+            );
+        }
+
+        sut_receiver.set_active_buffer_size(ACTIVE_BUFFER_SIZE);
+        assert_that!(sut_sender.number_of_buffered_samples(id), eq ACTIVE_BUFFER_SIZE);
+        assert_that!(sut_receiver.borrow_count(id), eq 0);
+
+        for i in 0..BUFFER_SIZE - ACTIVE_BUFFER_SIZE {
+            let retrieval = sut_sender.reclaim(id).unwrap();
+            assert_that!(retrieval, is_some);
+            assert_that!(retrieval.unwrap().offset(), eq SAMPLE_SIZE * i);
+        }
+        assert_that!(sut_sender.reclaim(id).unwrap(), is_none);
+
+        for i in BUFFER_SIZE - ACTIVE_BUFFER_SIZE..BUFFER_SIZE {
+            let sample = sut_receiver.receive(id).unwrap();
+            assert_that!(sample, is_some);
+            assert_that!(sample.as_ref().unwrap().offset(), eq SAMPLE_SIZE * i);
+            assert_that!(sut_receiver.release(sample.unwrap(), id), is_ok);
+        }
+        assert_that!(sut_receiver.receive(id).unwrap(), is_none);
+    }
+
     #[conformance_test]
     pub fn send_receive_and_retrieval_works_for_multiple_channels<Sut: ZeroCopyConnection>() {
         const NUMBER_OF_CHANNELS: usize = 7;
@@ -652,6 +793,41 @@ pub mod zero_copy_connection_trait {
         assert_that!(result.err().unwrap(), eq ZeroCopySendError::ReceiveBufferFull);
     }
 
+    #[conformance_test]
+    pub fn number_of_buffered_samples_counts_not_yet_received_offsets<Sut: ZeroCopyConnection>() {
+        let id = ChannelId::new(0);
+        let name = generate_file_path().file_name();
+        let config = generate_isolated_config::<Sut>();
+        const BUFFER_SIZE: usize = 12;
+
+        let sut_sender = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_sender()
+            .unwrap();
+        let sut_receiver = Sut::Builder::new(&name)
+            .buffer_size(BUFFER_SIZE)
+            .number_of_samples_per_segment(NUMBER_OF_SAMPLES)
+            .config(&config)
+            .create_receiver()
+            .unwrap();
+
+        assert_that!(sut_sender.number_of_buffered_samples(id), eq 0);
+
+        for i in 0..BUFFER_SIZE {
+            assert_that!(
+                sut_sender.try_send(PointerOffset::new(SAMPLE_SIZE * i), SAMPLE_SIZE, id),
+                is_ok
+            );
+            assert_that!(sut_sender.number_of_buffered_samples(id), eq i + 1);
+        }
+
+        let sample = sut_receiver.receive(id).unwrap();
+        assert_that!(sample, is_some);
+        assert_that!(sut_sender.number_of_buffered_samples(id), eq BUFFER_SIZE - 1);
+    }
+
     #[conformance_test]
     pub fn send_until_overflow_works<Sut: ZeroCopyConnection>() {
         let id = ChannelId::new(0);
@@ -29,6 +29,14 @@ instantiate_conformance_tests_with_module!(
     iceoryx2_cal::event::UnixDatagramShmBitSet
 );
 
+#[cfg(target_os = "linux")]
+instantiate_conformance_tests_with_module!(
+    futex_shared_memory_bitset,
+    iceoryx2_cal_conformance_tests::event_trait,
+    iceoryx2_cal::event::event_state::bit_set::RelocatableBitSet,
+    iceoryx2_cal::event::FutexShmBitSet
+);
+
 instantiate_conformance_tests_with_module!(
     socket_pair_process_local_bitset,
     iceoryx2_cal_conformance_tests::event_trait,
@@ -53,6 +61,14 @@ instantiate_conformance_tests_with_module!(
     iceoryx2_cal::event::UnixDatagramShmCountingBitSet
 );
 
+#[cfg(target_os = "linux")]
+instantiate_conformance_tests_with_module!(
+    futex_shared_memory_counting_bitset,
+    iceoryx2_cal_conformance_tests::event_trait,
+    iceoryx2_cal::event::event_state::counting_bit_set::RelocatableCountingBitSet,
+    iceoryx2_cal::event::FutexShmCountingBitSet
+);
+
 instantiate_conformance_tests_with_module!(
     socket_pair_process_local_counting_bitset,
     iceoryx2_cal_conformance_tests::event_trait,
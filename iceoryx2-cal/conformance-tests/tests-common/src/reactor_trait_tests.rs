@@ -24,3 +24,10 @@ instantiate_conformance_tests_with_module!(
     iceoryx2_cal_conformance_tests::reactor_trait,
     iceoryx2_cal::reactor::epoll::Epoll
 );
+
+#[cfg(target_os = "linux")]
+instantiate_conformance_tests_with_module!(
+    linux,
+    iceoryx2_cal_conformance_tests::reactor_trait,
+    iceoryx2_cal::reactor::linux::Reactor
+);
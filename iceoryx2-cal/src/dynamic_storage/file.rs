@@ -41,13 +41,16 @@ use iceoryx2_bb_posix::file::FileRemoveError;
 use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
 use iceoryx2_bb_posix::file_descriptor::FileDescriptorManagement;
+use iceoryx2_bb_posix::memory_lock::MemoryLock;
 use iceoryx2_bb_posix::memory_mapping::MappingBehavior;
 use iceoryx2_bb_posix::memory_mapping::MappingPermission;
 use iceoryx2_bb_posix::memory_mapping::MemoryMapping;
 use iceoryx2_bb_posix::memory_mapping::MemoryMappingBuilder;
 use iceoryx2_bb_posix::shared_memory::*;
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_bb_system_types::path::Path;
-use iceoryx2_log::{fail, trace};
+use iceoryx2_log::{fail, trace, warn};
 
 use crate::static_storage::file::NamedConceptConfiguration;
 use crate::static_storage::file::NamedConceptRemoveError;
@@ -74,6 +77,9 @@ pub struct Builder<'builder, T: Send + Sync + Debug + ZeroCopySend> {
     storage_name: FileName,
     supplementary_size: usize,
     has_ownership: bool,
+    numa_policy: NumaPolicy,
+    prefault: bool,
+    lock_in_memory: bool,
     config: Configuration<T>,
     timeout: Duration,
     initializer: Initializer<'builder, T>,
@@ -153,7 +159,7 @@ impl<T: Send + Sync + Debug + ZeroCopySend> NamedConceptConfiguration for Config
         &self.path
     }
 
-    fn path_for(&self, value: &FileName) -> iceoryx2_bb_system_types::file_path::FilePath {
+    fn path_for(&self, value: &FileName) -> FilePath {
         self.path_for_with_type(value)
     }
 
@@ -168,6 +174,9 @@ impl<T: Send + Sync + Debug + ZeroCopySend> NamedConceptBuilder<Storage<T>> for
             has_ownership: true,
             storage_name: *storage_name,
             supplementary_size: 0,
+            numa_policy: NumaPolicy::Default,
+            prefault: false,
+            lock_in_memory: false,
             config: Configuration::default(),
             timeout: Duration::ZERO,
             initializer: Initializer::new(|_, _| false),
@@ -296,6 +305,7 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         }
 
         Ok(Storage {
+            memory_lock: None,
             file,
             memory_mapping,
             name: self.storage_name,
@@ -303,6 +313,37 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         })
     }
 
+    /// Writes zeros into the whole file so that the file system allocates all of its blocks
+    /// when the storage is created. Otherwise, a sparse file allocates them on the first write
+    /// into the mapping, which is expensive on DAX or persistent memory mounts and raises
+    /// `SIGBUS` instead of an error when the device is full.
+    fn allocate_file_blocks(
+        &self,
+        file: &mut File,
+        file_size: usize,
+    ) -> Result<(), DynamicStorageCreateError> {
+        let msg = "Unable to prefault dynamic_storage::file::DynamicStorage";
+        let zeros = vec![0u8; SystemInfo::PageSize.value().min(file_size)];
+
+        let mut position = 0;
+        while position < file_size {
+            let len = zeros.len().min(file_size - position);
+            match file.write_at(position as u64, &zeros[..len]) {
+                Ok(0) => {
+                    fail!(from self, with DynamicStorageCreateError::InternalError,
+                        "{msg} since no bytes could be written at position {position}.");
+                }
+                Ok(n) => position += n as usize,
+                Err(e) => {
+                    fail!(from self, with DynamicStorageCreateError::InternalError,
+                        "{msg} since the blocks of the file could not be allocated ({e:?}).");
+                }
+            }
+        }
+
+        Ok(())
+    }
+
     fn create_impl(&mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
         let msg = "Failed to create dynamic_storage::file::DynamicStorage";
 
@@ -354,10 +395,14 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
                 "{msg} since the file could not be resized to {file_size} ({e:?}).");
         }
 
+        if self.prefault {
+            self.allocate_file_blocks(&mut file, file_size)?;
+        }
+
         let raw_fd = unsafe { file.file_descriptor().native_handle() };
         let fd = unsafe { FileDescriptor::non_owning_new_unchecked(raw_fd) };
 
-        let memory_mapping = match MemoryMappingBuilder::from_file_descriptor(fd)
+        let mut memory_mapping = match MemoryMappingBuilder::from_file_descriptor(fd)
             .mapping_behavior(MappingBehavior::Shared)
             .initial_mapping_permission(MappingPermission::ReadWrite)
             .size(file_size)
@@ -370,7 +415,40 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
             }
         };
 
+        if self.numa_policy != NumaPolicy::Default {
+            if let Err(e) = unsafe {
+                self.numa_policy
+                    .apply(memory_mapping.base_address_mut(), file_size)
+            } {
+                warn!(from self,
+                    "Unable to apply the NUMA policy {:?} ({:?}). Falling back to first-touch placement.",
+                    self.numa_policy, e);
+            }
+        }
+
+        if self.prefault {
+            // the blocks are already allocated, touching every page only populates the page
+            // tables of this process
+            let base_address = memory_mapping.base_address_mut();
+            for offset in (0..file_size).step_by(SystemInfo::PageSize.value()) {
+                unsafe { base_address.add(offset).write_volatile(0) };
+            }
+        }
+
+        let memory_lock = if self.lock_in_memory {
+            match unsafe { MemoryLock::new(memory_mapping.base_address().cast(), file_size) } {
+                Ok(v) => Some(v),
+                Err(e) => {
+                    fail!(from self, with DynamicStorageCreateError::InternalError,
+                        "{msg} since the memory could not be locked ({e:?}).");
+                }
+            }
+        } else {
+            None
+        };
+
         Ok(Storage {
+            memory_lock,
             file,
             memory_mapping,
             name: self.storage_name,
@@ -454,6 +532,29 @@ impl<'builder, T: Send + Sync + Debug + ZeroCopySend> DynamicStorageBuilder<'bui
         self
     }
 
+    fn use_huge_pages(self, _value: bool) -> Self {
+        self
+    }
+
+    fn numa_policy(mut self, value: NumaPolicy) -> Self {
+        self.numa_policy = value;
+        self
+    }
+
+    fn typed_memory(self, _value: Option<FilePath>) -> Self {
+        self
+    }
+
+    fn prefault(mut self, value: bool) -> Self {
+        self.prefault = value;
+        self
+    }
+
+    fn lock_in_memory(mut self, value: bool) -> Self {
+        self.lock_in_memory = value;
+        self
+    }
+
     fn create(mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
         let shm = self.create_impl()?;
         self.init_impl(shm)
@@ -484,6 +585,8 @@ impl<'builder, T: Send + Sync + Debug + ZeroCopySend> DynamicStorageBuilder<'bui
 /// [`Builder`].
 #[derive(Debug)]
 pub struct Storage<T: Debug + Send + Sync + ZeroCopySend> {
+    // must be dropped before the memory mapping is removed
+    memory_lock: Option<MemoryLock>,
     file: File,
     memory_mapping: MemoryMapping,
     name: FileName,
@@ -498,6 +601,7 @@ impl<T: Debug + Send + Sync + ZeroCopySend> Abandonable for Storage<T> {
         let this = unsafe { this.as_mut() };
         unsafe { File::abandon_in_place(NonNull::iox2_from_mut(&mut this.file)) };
         unsafe {
+            core::ptr::drop_in_place(&mut this.memory_lock);
             core::ptr::drop_in_place(&mut this.memory_mapping);
         }
     }
@@ -68,7 +68,9 @@ use iceoryx2_bb_elementary_traits::{
 };
 use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
 use iceoryx2_bb_posix::file::AccessMode;
+pub use iceoryx2_bb_posix::numa::NumaPolicy;
 use iceoryx2_bb_system_types::file_name::*;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use tiny_fn::tiny_fn;
 
 use crate::static_storage::file::{NamedConcept, NamedConceptBuilder, NamedConceptMgmt};
@@ -145,6 +147,31 @@ pub trait DynamicStorageBuilder<'builder, T: Send + Sync + ZeroCopySend, D: Dyna
     /// the already initialized [`DynamicStorage`] with the full size is used.
     fn supplementary_size(self, value: usize) -> Self;
 
+    /// Requests that the [`DynamicStorage`] is backed by huge pages when it is newly created.
+    /// Implementations that do not support huge pages ignore the setting. The default is
+    /// [`false`].
+    fn use_huge_pages(self, value: bool) -> Self;
+
+    /// Defines the [`NumaPolicy`] of the [`DynamicStorage`] when it is newly created.
+    /// Implementations that do not support NUMA placement ignore the setting. The default is
+    /// [`NumaPolicy::Default`].
+    fn numa_policy(self, value: NumaPolicy) -> Self;
+
+    /// Allocates the [`DynamicStorage`] from the provided typed memory pool when it is newly
+    /// created. Implementations that are not backed by shared memory ignore the setting. The
+    /// default is [`None`], the general purpose memory.
+    fn typed_memory(self, value: Option<FilePath>) -> Self;
+
+    /// Touches every page of the [`DynamicStorage`] when it is newly created so that no page
+    /// fault occurs on the first access. Implementations that are not backed by shared memory
+    /// ignore the setting. The default is [`false`].
+    fn prefault(self, value: bool) -> Self;
+
+    /// Locks the pages of the [`DynamicStorage`] into memory when it is newly created so that
+    /// they cannot be swapped out. Implementations that are not backed by shared memory ignore
+    /// the setting. The default is [`false`].
+    fn lock_in_memory(self, value: bool) -> Self;
+
     /// The timeout defines how long the [`DynamicStorageBuilder`] should wait for
     /// [`DynamicStorageBuilder::create()`]
     /// to finialize the initialization. This is required when the [`DynamicStorage`] is
@@ -62,14 +62,19 @@ use alloc::string::ToString;
 use alloc::vec;
 use alloc::vec::Vec;
 
-use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_concurrency::atomic::{AtomicU32, AtomicU64};
 use iceoryx2_bb_elementary::package_version::PackageVersion;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
+#[cfg(target_os = "linux")]
+use iceoryx2_bb_linux::futex::{FutexWaitError, futex_wait, futex_wake};
+#[cfg(target_os = "linux")]
+use iceoryx2_bb_posix::adaptive_wait::AdaptiveWait;
 use iceoryx2_bb_posix::adaptive_wait::{AdaptiveWaitBuilder, AdaptiveWaitStrategy};
 use iceoryx2_bb_posix::directory::*;
 use iceoryx2_bb_posix::file_descriptor::FileDescriptorManagement;
 use iceoryx2_bb_posix::memory_mapping::MemoryMappingCreationError;
 use iceoryx2_bb_posix::shared_memory::*;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_log::fail;
 
@@ -78,8 +83,19 @@ use crate::static_storage::file::NamedConceptRemoveError;
 
 use self::dynamic_storage_configuration::DynamicStorageConfiguration;
 
+// On linux the storage is readable during the initialization so that openers can map it
+// right away and block on the futex in `Data::initialization_state` until the creator wakes
+// them up. Everywhere else the read permission signals that the initialization is finished.
+#[cfg(target_os = "linux")]
+const INIT_PERMISSIONS: Permission = Permission::OWNER_READ.const_bitor(Permission::OWNER_WRITE);
+
+#[cfg(not(target_os = "linux"))]
 const INIT_PERMISSIONS: Permission = Permission::OWNER_WRITE;
 
+const INITIALIZATION_IN_PROGRESS: u32 = 0;
+const INITIALIZATION_DONE: u32 = 1;
+const INITIALIZATION_FAILED: u32 = 2;
+
 #[cfg(not(feature = "dev_permissions"))]
 const FINAL_PERMISSIONS: Permission = Permission::OWNER_ALL;
 
@@ -92,6 +108,11 @@ pub struct Builder<'builder, T: Send + Sync + Debug + ZeroCopySend> {
     storage_name: FileName,
     supplementary_size: usize,
     has_ownership: bool,
+    use_huge_pages: bool,
+    numa_policy: NumaPolicy,
+    typed_memory: Option<FilePath>,
+    prefault: bool,
+    lock_in_memory: bool,
     config: Configuration<T>,
     timeout: Duration,
     initializer: Initializer<'builder, T>,
@@ -122,6 +143,7 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Clone for Configuration<T> {
 #[repr(C)]
 struct Data<T: Send + Sync + Debug + ZeroCopySend> {
     version: AtomicU64,
+    initialization_state: AtomicU32,
     data: MaybeUninit<T>,
 }
 
@@ -171,7 +193,7 @@ impl<T: Send + Sync + Debug + ZeroCopySend> NamedConceptConfiguration for Config
         &self.path
     }
 
-    fn path_for(&self, value: &FileName) -> iceoryx2_bb_system_types::file_path::FilePath {
+    fn path_for(&self, value: &FileName) -> FilePath {
         self.path_for_with_type(value)
     }
 
@@ -186,6 +208,11 @@ impl<T: Send + Sync + Debug + ZeroCopySend> NamedConceptBuilder<Storage<T>> for
             has_ownership: true,
             storage_name: *storage_name,
             supplementary_size: 0,
+            use_huge_pages: false,
+            numa_policy: NumaPolicy::Default,
+            typed_memory: None,
+            prefault: false,
+            lock_in_memory: false,
             config: Configuration::default(),
             timeout: Duration::ZERO,
             initializer: Initializer::new(|_, _| false),
@@ -277,6 +304,22 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
                         "{} since the version number was not set - (it is not initialized after {:?}).",
                         msg, self.timeout);
                 }
+
+                #[cfg(target_os = "linux")]
+                {
+                    elapsed_time = self.wait_for_initialization(
+                        unsafe { &(*init_state).initialization_state },
+                        &mut wait_for_read_write_access,
+                        elapsed_time,
+                    )?;
+                }
+
+                #[cfg(not(target_os = "linux"))]
+                {
+                    elapsed_time = fail!(from self, when wait_for_read_write_access.wait(),
+                                    with DynamicStorageOpenError::InternalError,
+                                    "{} since the adaptive wait call failed.", msg);
+                }
             } else if package_version != PackageVersion::get() {
                 fail!(from self, with DynamicStorageOpenError::VersionMismatch,
                        "{} since the dynamic storage was created with version {} but this process requires version {}.",
@@ -284,10 +327,6 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
             } else {
                 break;
             }
-
-            elapsed_time = fail!(from self, when wait_for_read_write_access.wait(),
-                                    with DynamicStorageOpenError::InternalError,
-                                    "{} since the adaptive wait call failed.", msg);
         }
 
         Ok(Storage {
@@ -297,20 +336,64 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         })
     }
 
+    #[cfg(target_os = "linux")]
+    fn wait_for_initialization(
+        &self,
+        initialization_state: &AtomicU32,
+        adaptive_wait: &mut AdaptiveWait,
+        elapsed_time: Duration,
+    ) -> Result<Duration, DynamicStorageOpenError> {
+        let msg = "Failed to open posix_shared_memory::DynamicStorage";
+
+        match initialization_state.load(Ordering::Acquire) {
+            INITIALIZATION_IN_PROGRESS => {
+                match futex_wait(
+                    initialization_state,
+                    INITIALIZATION_IN_PROGRESS,
+                    Some(self.timeout - elapsed_time),
+                ) {
+                    Ok(_) | Err(FutexWaitError::Interrupt) => (),
+                    Err(e) => {
+                        fail!(from self, with DynamicStorageOpenError::InternalError,
+                            "{} since waiting for the initialization failed ({:?}).", msg, e);
+                    }
+                }
+            }
+            INITIALIZATION_FAILED => {
+                fail!(from self, with DynamicStorageOpenError::DoesNotExist,
+                    "{} since the creator failed to initialize it and removed it again.", msg);
+            }
+            // the version number is written before the state, it is loaded again
+            _ => (),
+        }
+
+        Ok(fail!(from self, when adaptive_wait.elapsed(),
+            with DynamicStorageOpenError::InternalError,
+            "{} since the elapsed time could not be acquired.", msg))
+    }
+
     fn create_impl(&mut self) -> Result<SharedMemory, DynamicStorageCreateError> {
         let msg = "Failed to create dynamic_storage::PosixSharedMemory";
 
         let full_name = self.config.path_for(&self.storage_name).file_name();
-        let shm = match SharedMemoryBuilder::new(&full_name)
+        let shm = SharedMemoryBuilder::new(&full_name)
+            .is_memory_locked(self.lock_in_memory)
             .creation_mode(CreationMode::CreateExclusive)
             // posix shared memory is always aligned to the greatest possible value (PAGE_SIZE)
             // therefore we do not have to add additional alignment space for T
             .size(core::mem::size_of::<Data<T>>() + self.supplementary_size)
             .permission(INIT_PERMISSIONS)
-            .zero_memory(false)
-            .has_ownership(self.has_ownership)
-            .create()
-        {
+            // zeroing the freshly created shared memory touches every page
+            .zero_memory(self.prefault)
+            .use_huge_pages(self.use_huge_pages)
+            .numa_policy(self.numa_policy);
+
+        let shm = match self.typed_memory {
+            Some(typed_memory) => shm.typed_memory(&typed_memory),
+            None => shm,
+        };
+
+        let shm = match shm.has_ownership(self.has_ownership).create() {
             Ok(v) => v,
             Err(SharedMemoryCreationError::AlreadyExist) => {
                 fail!(from self, with DynamicStorageCreateError::AlreadyExists,
@@ -329,6 +412,15 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         Ok(shm)
     }
 
+    fn publish_initialization_state(initialization_state: &AtomicU32, state: u32) {
+        initialization_state.store(state, Ordering::Release);
+
+        // a failed wake up is not critical, the openers wake up at the latest after their
+        // timeout and recognize the new state
+        #[cfg(target_os = "linux")]
+        let _ = futex_wake(initialization_state, u32::MAX);
+    }
+
     fn init_impl(
         &mut self,
         mut shm: SharedMemory,
@@ -337,6 +429,9 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         let value = shm.base_address().as_ptr() as *mut Data<T>;
         let version_ptr = unsafe { core::ptr::addr_of_mut!((*value).version) };
         unsafe { version_ptr.write(AtomicU64::new(0)) };
+        let initialization_state =
+            unsafe { core::ptr::addr_of_mut!((*value).initialization_state) };
+        unsafe { initialization_state.write(AtomicU32::new(INITIALIZATION_IN_PROGRESS)) };
 
         unsafe { core::ptr::addr_of_mut!((*value).data).write(MaybeUninit::uninit()) };
 
@@ -354,6 +449,10 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
             .initializer
             .call(unsafe { &mut (*value).data }, &mut allocator)
         {
+            Self::publish_initialization_state(
+                unsafe { &*initialization_state },
+                INITIALIZATION_FAILED,
+            );
             unsafe { core::ptr::drop_in_place(value) };
             shm.acquire_ownership();
             fail!(from origin, with DynamicStorageCreateError::InitializationFailed,
@@ -368,6 +467,7 @@ impl<T: Send + Sync + Debug + ZeroCopySend> Builder<'_, T> {
         // SYNC POINT: write Data<T>::data
         //////////////////////////////////////////
         unsafe { (*version_ptr).store(PackageVersion::get().to_u64(), Ordering::SeqCst) };
+        Self::publish_initialization_state(unsafe { &*initialization_state }, INITIALIZATION_DONE);
 
         if let Err(e) = shm.set_permission(FINAL_PERMISSIONS) {
             unsafe { core::ptr::drop_in_place(value) };
@@ -411,6 +511,31 @@ impl<'builder, T: Send + Sync + Debug + ZeroCopySend> DynamicStorageBuilder<'bui
         self
     }
 
+    fn use_huge_pages(mut self, value: bool) -> Self {
+        self.use_huge_pages = value;
+        self
+    }
+
+    fn numa_policy(mut self, value: NumaPolicy) -> Self {
+        self.numa_policy = value;
+        self
+    }
+
+    fn typed_memory(mut self, value: Option<FilePath>) -> Self {
+        self.typed_memory = value;
+        self
+    }
+
+    fn prefault(mut self, value: bool) -> Self {
+        self.prefault = value;
+        self
+    }
+
+    fn lock_in_memory(mut self, value: bool) -> Self {
+        self.lock_in_memory = value;
+        self
+    }
+
     fn create(mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
         let shm = self.create_impl()?;
         self.init_impl(shm)
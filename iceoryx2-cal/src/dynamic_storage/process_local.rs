@@ -63,6 +63,7 @@ use iceoryx2_bb_concurrency::atomic::AtomicBool;
 use iceoryx2_bb_concurrency::lazy_lock::LazyLock;
 use iceoryx2_bb_elementary_traits::allocator::BaseAllocator;
 use iceoryx2_bb_memory::heap_allocator::HeapAllocator;
+use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
 use iceoryx2_bb_posix::mutex::*;
 use iceoryx2_bb_system_types::file_name::FileName;
 use iceoryx2_bb_system_types::file_path::FilePath;
@@ -87,6 +88,7 @@ struct StorageEntry {
 struct StorageDetails<T> {
     data_ptr: *mut MaybeUninit<T>,
     layout: Layout,
+    is_initialized: AtomicBool,
 }
 
 #[derive(PartialEq, Eq, Debug)]
@@ -175,6 +177,7 @@ impl<T> StorageDetails<T> {
                 .allocate(layout), "Failed to allocate {} bytes for dynamic global storage.", size)
             .as_ptr() as *mut MaybeUninit<T>,
             layout,
+            is_initialized: AtomicBool::new(false),
         };
         unsafe { new_self.data_ptr.write(MaybeUninit::uninit()) };
         new_self
@@ -348,6 +351,7 @@ pub struct Builder<'builder, T: Send + Sync + Debug + ZeroCopySend> {
     name: FileName,
     supplementary_size: usize,
     has_ownership: bool,
+    timeout: Duration,
     config: Configuration<T>,
     initializer: Initializer<'builder, T>,
     _phantom_data: PhantomData<T>,
@@ -360,6 +364,7 @@ impl<T: Send + Sync + Debug + 'static + ZeroCopySend> NamedConceptBuilder<Storag
         Self {
             name: *storage_name,
             has_ownership: true,
+            timeout: Duration::ZERO,
             supplementary_size: 0,
             config: Configuration::default(),
             initializer: Initializer::new(|_, _| false),
@@ -374,48 +379,92 @@ impl<T: Send + Sync + Debug + 'static + ZeroCopySend> NamedConceptBuilder<Storag
 }
 
 impl<T: Send + Sync + Debug + 'static + ZeroCopySend> Builder<'_, T> {
-    fn open_impl(
+    fn lookup(
         &self,
-        guard: &mut MutexGuard<'static, BTreeMap<FilePath, StorageEntry>>,
-    ) -> Result<Storage<T>, DynamicStorageOpenError> {
+        full_path: &FilePath,
+    ) -> Result<Arc<StorageDetails<T>>, DynamicStorageOpenError> {
         let msg = "Failed to open dynamic storage";
+        let guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
+            with DynamicStorageOpenError::InternalError,
+            "{} due to a failure while acquiring the lock.", msg
+        );
 
-        let full_path = self.config.path_for(&self.name);
-        let mut entry = guard.get_mut(&full_path);
-        if entry.is_none() {
-            fail!(from self, with DynamicStorageOpenError::DoesNotExist,
-                "{} since the storage does not exist.", msg);
+        match guard.get(full_path) {
+            Some(entry) => Ok(entry
+                .content
+                .clone()
+                .downcast::<StorageDetails<T>>()
+                .unwrap()),
+            None => {
+                fail!(from self, with DynamicStorageOpenError::DoesNotExist,
+                    "{} since the storage does not exist.", msg);
+            }
         }
+    }
+
+    fn open_impl(&self) -> Result<Storage<T>, DynamicStorageOpenError> {
+        let msg = "Failed to open dynamic storage";
+
+        let full_path = self.config.path_for(&self.name);
+        let mut adaptive_wait = None;
+        let data = loop {
+            let data = self.lookup(&full_path)?;
+            if data.is_initialized.load(Ordering::Acquire) {
+                break data;
+            }
+
+            if adaptive_wait.is_none() {
+                adaptive_wait = Some(fail!(from self, when AdaptiveWaitBuilder::new().create(),
+                    with DynamicStorageOpenError::InternalError,
+                    "{} since the AdaptiveWait could not be initialized.", msg));
+            }
+
+            let elapsed_time = fail!(from self,
+                when adaptive_wait.as_mut().unwrap().wait(),
+                with DynamicStorageOpenError::InternalError,
+                "{} since a failure occurred while waiting for the initialization.", msg);
+
+            if elapsed_time >= self.timeout {
+                fail!(from self, with DynamicStorageOpenError::InitializationNotYetFinalized,
+                    "{} since it is not initialized after {:?}.", msg, self.timeout);
+            }
+        };
 
         Ok(Storage::<T> {
             name: self.name,
-            data: entry
-                .as_mut()
-                .unwrap()
-                .content
-                .clone()
-                .downcast::<StorageDetails<T>>()
-                .unwrap(),
+            data,
             has_ownership: AtomicBool::new(false),
             config: self.config.clone(),
         })
     }
 
-    fn create_impl(
-        &mut self,
-        guard: &mut MutexGuard<'static, BTreeMap<FilePath, StorageEntry>>,
-    ) -> Result<Storage<T>, DynamicStorageCreateError> {
+    fn create_impl(&mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
         let msg = "Failed to create dynamic storage";
 
         let full_path = self.config.path_for(&self.name);
-        let entry = guard.get_mut(&full_path);
-        if entry.is_some() {
-            fail!(from self, with DynamicStorageCreateError::AlreadyExists,
-                "{} since the storage does already exist.", msg);
-        }
-
         let storage_details = Arc::new(StorageDetails::new(self.supplementary_size as u64));
 
+        {
+            let mut guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
+                with DynamicStorageCreateError::InternalError,
+                "{} due to a failure while acquiring the lock.", msg
+            );
+
+            if guard.contains_key(&full_path) {
+                fail!(from self, with DynamicStorageCreateError::AlreadyExists,
+                    "{} since the storage does already exist.", msg);
+            }
+
+            guard.insert(
+                full_path,
+                StorageEntry {
+                    content: storage_details.clone(),
+                },
+            );
+        }
+
+        // the name is reserved, openers wait until the storage is initialized so that the
+        // registry is not locked while the initializer runs
         let value: *mut MaybeUninit<T> = storage_details.data_ptr;
         let supplementary_start = (value as usize + core::mem::size_of::<T>()) as *mut u8;
 
@@ -429,27 +478,27 @@ impl<T: Send + Sync + Debug + 'static + ZeroCopySend> Builder<'_, T> {
             .initializer
             .call(unsafe { &mut *value }, &mut allocator)
         {
+            match PROCESS_LOCAL_STORAGE.lock() {
+                Ok(mut guard) => {
+                    guard.remove(&full_path);
+                }
+                Err(e) => {
+                    warn!(from origin,
+                        "Unable to remove the uninitialized dynamic storage since the lock could not be acquired ({:?}).", e);
+                }
+            }
+
             fail!(from origin, with DynamicStorageCreateError::InitializationFailed,
                 "{} since the initialization of the underlying construct failed.", msg);
         }
 
-        guard.insert(
-            full_path,
-            StorageEntry {
-                content: storage_details,
-            },
-        );
+        storage_details
+            .is_initialized
+            .store(true, Ordering::Release);
 
-        let mut entry = guard.get_mut(&full_path);
         Ok(Storage::<T> {
             name: self.name,
-            data: entry
-                .as_mut()
-                .unwrap()
-                .content
-                .clone()
-                .downcast::<StorageDetails<T>>()
-                .unwrap(),
+            data: storage_details,
             has_ownership: AtomicBool::new(self.has_ownership),
             config: self.config.clone(),
         })
@@ -472,7 +521,8 @@ impl<'builder, T: Send + Sync + Debug + 'static + ZeroCopySend>
         self
     }
 
-    fn timeout(self, _value: Duration) -> Self {
+    fn timeout(mut self, value: Duration) -> Self {
+        self.timeout = value;
         self
     }
 
@@ -481,40 +531,48 @@ impl<'builder, T: Send + Sync + Debug + 'static + ZeroCopySend>
         self
     }
 
-    fn open(self, _access_mode: AccessMode) -> Result<Storage<T>, DynamicStorageOpenError> {
-        let msg = "Failed to open dynamic storage";
-        let mut guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
-            with DynamicStorageOpenError::InternalError,
-            "{} due to a failure while acquiring the lock.", msg
-        );
+    fn use_huge_pages(self, _value: bool) -> Self {
+        self
+    }
 
-        self.open_impl(&mut guard)
+    fn numa_policy(self, _value: NumaPolicy) -> Self {
+        self
     }
 
-    fn create(mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
-        let msg = "Failed to create dynamic storage";
-        let mut guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
-            with DynamicStorageCreateError::InternalError,
-            "{} due to a failure while acquiring the lock.", msg
-        );
+    fn typed_memory(self, _value: Option<FilePath>) -> Self {
+        self
+    }
 
-        self.create_impl(&mut guard)
+    fn prefault(self, _value: bool) -> Self {
+        self
+    }
+
+    fn lock_in_memory(self, _value: bool) -> Self {
+        self
+    }
+
+    fn open(self, _access_mode: AccessMode) -> Result<Storage<T>, DynamicStorageOpenError> {
+        self.open_impl()
+    }
+
+    fn create(mut self) -> Result<Storage<T>, DynamicStorageCreateError> {
+        self.create_impl()
     }
 
     fn open_or_create(mut self) -> Result<Storage<T>, DynamicStorageOpenOrCreateError> {
-        let msg = "Failed to open or create dynamic storage";
-        let mut guard = fail!(from self, when PROCESS_LOCAL_STORAGE.lock(),
-            with DynamicStorageOpenOrCreateError::DynamicStorageOpenError(DynamicStorageOpenError::InternalError),
-            "{} due to a failure while acquiring the lock.", msg
-        );
+        loop {
+            match self.open_impl() {
+                Ok(storage) => return Ok(storage),
+                Err(DynamicStorageOpenError::DoesNotExist) => (),
+                Err(e) => return Err(e.into()),
+            }
 
-        match self.open_impl(&mut guard) {
-            Ok(storage) => Ok(storage),
-            Err(DynamicStorageOpenError::DoesNotExist) => match self.create_impl(&mut guard) {
-                Ok(storage) => Ok(storage),
-                Err(e) => Err(e.into()),
-            },
-            Err(e) => Err(e.into()),
+            match self.create_impl() {
+                Ok(storage) => return Ok(storage),
+                // another thread created the storage in between, open it
+                Err(DynamicStorageCreateError::AlreadyExists) => (),
+                Err(e) => return Err(e.into()),
+            }
         }
     }
 }
@@ -26,10 +26,12 @@ use crate::{
 use alloc::vec::Vec;
 use core::fmt::Debug;
 use core::{marker::PhantomData, mem::MaybeUninit, ptr::NonNull, time::Duration};
-use iceoryx2_bb_concurrency::atomic::{AtomicU8, Ordering};
+use iceoryx2_bb_concurrency::atomic::{AtomicU8, AtomicU64, Ordering};
 use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_container::vector::{RelocatableVec, Vector};
 use iceoryx2_bb_elementary_traits::{
-    non_null::NonNullCompat, testing::abandonable::Abandonable, zero_copy_send::ZeroCopySend,
+    non_null::NonNullCompat, relocatable_container::RelocatableContainer,
+    testing::abandonable::Abandonable, zero_copy_send::ZeroCopySend,
 };
 use iceoryx2_bb_posix::{
     file::AccessMode, file_descriptor::FileDescriptorBased,
@@ -308,12 +310,42 @@ impl<
     }
 
     fn notify(&self, event_id: EventId) -> Result<(), super::NotifierNotifyError> {
+        self.notify_multiple(core::slice::from_ref(&event_id))
+    }
+
+    fn notify_with_value(
+        &self,
+        event_id: EventId,
+        value: u64,
+    ) -> Result<(), super::NotifierNotifyError> {
+        let mgmt = self.storage.get();
+        match mgmt.values.get(event_id.as_value()) {
+            // release in combination with the acquire in drain_events() ensures that the
+            // value is visible when the activation is consumed
+            Some(latest_value) => latest_value.store(value, Ordering::Release),
+            None => {
+                fail!(from self, with NotifierNotifyError::EventIdOutOfBounds,
+                    "Unable to notify with {event_id:?} and the value {value} since the event id is out of bounds (max = {:?}).",
+                    mgmt.event_id_max);
+            }
+        }
+
+        self.notify(event_id)
+    }
+
+    fn notify_multiple(&self, event_ids: &[EventId]) -> Result<(), super::NotifierNotifyError> {
         let msg = "Unable to notify";
         let mgmt = self.storage.get();
 
-        fail!(from self,
-              when mgmt.event.activate(event_id),
-              "{msg} with {event_id:?} since the activation failed.");
+        if event_ids.is_empty() {
+            return Ok(());
+        }
+
+        for event_id in event_ids {
+            fail!(from self,
+                  when mgmt.event.activate(*event_id),
+                  "{msg} with {event_id:?} since the activation failed.");
+        }
 
         let set_state_to_notified = || {
             let _ = mgmt.notification_state.compare_exchange(
@@ -332,7 +364,7 @@ impl<
                 Err(NotifierNotifyError::BufferIsFull) => {
                     if self.fail_when_buffer_is_full {
                         fail!(from self, with NotifierNotifyError::BufferIsFull,
-                        "{msg} with {event_id:?} since the buffer is full.");
+                        "{msg} with {event_ids:?} since the buffer is full.");
                     } else {
                         set_state_to_notified();
                         Ok(())
@@ -340,7 +372,7 @@ impl<
                 }
                 Err(e) => {
                     fail!(from self, with e,
-                            "{msg} with {event_id:?} due to {e:?}.");
+                            "{msg} with {event_ids:?} due to {e:?}.");
                 }
             }
         };
@@ -435,7 +467,12 @@ impl<
         let mut drain = || -> Result<u64, ListenerWaitError> {
             fail!(from self, when self.waiter.empty_buffer(),
                 "{msg} since the wait buffer could not be emptied.");
-            Ok(self.storage.get().event.drain(&mut callback))
+            Ok(mgmt.event.drain(&mut |mut activation: EventActivation| {
+                if let Some(latest_value) = mgmt.values.get(activation.id.as_value()) {
+                    activation.value = latest_value.load(Ordering::Acquire);
+                }
+                callback(activation)
+            }))
         };
 
         if mgmt
@@ -660,7 +697,9 @@ impl<
     ) -> Result<<EventImpl<E, Mgmt, Storage, H, W> as Event<E>>::Listener, ListenerCreateError>
     {
         let msg = "Failed to create listener";
-        let state_size = E::memory_size(self.event_id_max.as_value() + 1);
+        let number_of_event_ids = self.event_id_max.as_value() + 1;
+        let state_size = E::memory_size(number_of_event_ids)
+            + RelocatableVec::<AtomicU64>::const_memory_size(number_of_event_ids);
         let mut waiter = None;
         let storage = match Storage::Builder::new(&self.name)
             .config(&self.config.to_storage_config())
@@ -668,13 +707,19 @@ impl<
             .supplementary_size(state_size)
             .initializer(|value, allocator| {
                 value.write(State {
-                    event: unsafe { E::new_uninit(self.event_id_max.as_value() + 1) },
+                    event: unsafe { E::new_uninit(number_of_event_ids) },
+                    values: unsafe { RelocatableVec::new_uninit(number_of_event_ids) },
                     handle: MaybeUninit::uninit(),
                     event_id_max: self.event_id_max,
                     notification_state: AtomicU8::new(NOTIFICATION_STATE_IDLE)
                 });
 
-                unsafe { value.assume_init_mut().event.init(allocator).unwrap() };
+                let state = unsafe { value.assume_init_mut() };
+                unsafe { state.event.init(allocator).unwrap() };
+                unsafe { state.values.init(allocator).unwrap() };
+                for _ in 0..number_of_event_ids {
+                    unsafe { state.values.push_unchecked(AtomicU64::new(0)) };
+                }
                 match W::create(
                     &self.name,
                     &self.config.to_trigger_config(),
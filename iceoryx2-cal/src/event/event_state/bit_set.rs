@@ -41,6 +41,7 @@ impl EventState for RelocatableBitSet {
             callback(EventActivation {
                 id: EventId::new(bit_index),
                 count: 1,
+                value: 0,
             });
         });
         counter
@@ -45,6 +45,7 @@ impl EventState for RelocatableCountingBitSet {
             callback(EventActivation {
                 id: EventId::new(bit_state.bit()),
                 count: bit_state.count(),
+                value: 0,
             });
         });
         counter
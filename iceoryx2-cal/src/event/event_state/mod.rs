@@ -21,13 +21,19 @@ use crate::event::EventId;
 
 /// Represents an activation record for a specific event.
 ///
-/// Contains the [`EventId`] and the count of times it was activated.
+/// Contains the [`EventId`], the count of times it was activated and the latest value that
+/// was attached to it.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub struct EventActivation {
     /// The identifier of the activated event.
     pub id: EventId,
     /// The number of times the event was activated.
     pub count: u64,
+    /// The latest value that was attached to the event with
+    /// [`Notifier::notify_with_value()`](crate::event::Notifier::notify_with_value()). It is
+    /// overwritten by every new value, when multiple activations are combined only the value of
+    /// the most recent one is preserved. When no value was ever attached it is `0`.
+    pub value: u64,
 }
 
 /// Errors that can occur when attempting to activate an event with [`EventState::activate()`].
@@ -10,6 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+#[cfg(target_os = "linux")]
+use crate::event::trigger::futex::{FutexMgmt, GenericFutexTrigger};
 use crate::{
     dynamic_storage,
     event::trigger::{
@@ -45,3 +47,15 @@ pub type SemaphoreShmCountingBitSet = GenericSemaphoreTrigger<
     RelocatableCountingBitSet,
     dynamic_storage::posix_shared_memory::Storage<State<RelocatableCountingBitSet, SemaphoreMgmt>>,
 >;
+
+#[cfg(target_os = "linux")]
+pub type FutexShmBitSet = GenericFutexTrigger<
+    RelocatableBitSet,
+    dynamic_storage::posix_shared_memory::Storage<State<RelocatableBitSet, FutexMgmt>>,
+>;
+
+#[cfg(target_os = "linux")]
+pub type FutexShmCountingBitSet = GenericFutexTrigger<
+    RelocatableCountingBitSet,
+    dynamic_storage::posix_shared_memory::Storage<State<RelocatableCountingBitSet, FutexMgmt>>,
+>;
@@ -140,6 +140,11 @@ pub trait Notifier<E: EventState>: NamedConcept + Debug + Abandonable + Send {
     fn max_event_count(&self) -> u64;
     fn event_id_max(&self) -> EventId;
     fn notify(&self, event_id: EventId) -> Result<(), NotifierNotifyError>;
+    /// Activates all `event_ids` and wakes up the listener only once.
+    fn notify_multiple(&self, event_ids: &[EventId]) -> Result<(), NotifierNotifyError>;
+    /// Stores `value` as the latest value of `event_id` and activates it. The listener
+    /// receives the value in [`EventActivation::value`].
+    fn notify_with_value(&self, event_id: EventId, value: u64) -> Result<(), NotifierNotifyError>;
 }
 
 pub trait NotifierBuilder<E: EventState, T: Event<E>>: NamedConceptBuilder<T> + Debug {
@@ -0,0 +1,251 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Trigger that is based on a futex word in the shared management segment of the event.
+//! The notifier increments the word and calls `FUTEX_WAKE` only when a listener is
+//! registered as sleeper, therefore notifying a listener that is currently not waiting
+//! does not require a syscall.
+//!
+//! The trigger does not use priority inheritance futexes (`FUTEX_LOCK_PI`). Priority
+//! inheritance requires a lock with an owner whose priority can be boosted, but the notifier
+//! never holds a lock that the listener waits on: a notification is a single atomic increment
+//! followed by an optional `FUTEX_WAKE`, and the listener waits for the increment of any
+//! notifier. The wake-up latency of a listener is therefore only bounded by the scheduling
+//! priority of the notifying thread itself.
+
+use super::Configuration;
+use crate::{
+    dynamic_storage::DynamicStorage,
+    event::{
+        ListenerCreateError, ListenerWaitError, NotifierNotifyError, NotifierOpenError,
+        common::EventImpl,
+        event_state::EventState,
+        trigger::{HandlerInterface, State, WaiterInterface},
+    },
+    named_concept::NamedConceptRemoveError,
+};
+use core::{marker::PhantomData, mem::MaybeUninit, ptr::NonNull, time::Duration};
+use iceoryx2_bb_concurrency::atomic::{AtomicU32, Ordering};
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary_traits::{
+    testing::abandonable::Abandonable, zero_copy_send::ZeroCopySend,
+};
+use iceoryx2_bb_linux::futex::{FutexWaitError, FutexWaitResult, futex_wait, futex_wake};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_system_types::path::Path;
+use iceoryx2_log::fail;
+
+#[derive(Debug, ZeroCopySend)]
+#[repr(C)]
+pub struct FutexMgmt {
+    /// futex word, incremented with every notification
+    counter: AtomicU32,
+    number_of_sleeping_listeners: AtomicU32,
+}
+
+#[derive(Debug)]
+pub struct FutexHandle<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> {
+    mgmt: *const FutexMgmt,
+    _data_1: PhantomData<E>,
+    _data_2: PhantomData<Storage>,
+}
+
+unsafe impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Send
+    for FutexHandle<E, Storage>
+{
+}
+unsafe impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Sync
+    for FutexHandle<E, Storage>
+{
+}
+
+impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Abandonable
+    for FutexHandle<E, Storage>
+{
+    unsafe fn abandon_in_place(_this: NonNull<Self>) {}
+}
+
+impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>>
+    HandlerInterface<E, FutexMgmt, Storage> for FutexHandle<E, Storage>
+{
+    fn open(
+        _name: &FileName,
+        _config: &Configuration,
+        mgmt: &FutexMgmt,
+    ) -> Result<Self, NotifierOpenError> {
+        // the mgmt resides in the storage that is owned by the surrounding notifier and
+        // lives therefore at least as long as the handle
+        Ok(Self {
+            mgmt: mgmt as *const FutexMgmt,
+            _data_1: PhantomData,
+            _data_2: PhantomData,
+        })
+    }
+
+    fn notify(&self) -> Result<(), NotifierNotifyError> {
+        let mgmt = unsafe { &*self.mgmt };
+        mgmt.counter.fetch_add(1, Ordering::SeqCst);
+
+        if mgmt.number_of_sleeping_listeners.load(Ordering::SeqCst) == 0 {
+            return Ok(());
+        }
+
+        match futex_wake(&mgmt.counter, u32::MAX) {
+            Ok(_) => Ok(()),
+            Err(e) => {
+                fail!(from self, with NotifierNotifyError::InternalFailure,
+                    "Failed to deliver notification due to an internal failure. [{e:?}]");
+            }
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct FutexWaiter<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> {
+    mgmt: *const FutexMgmt,
+    last_seen_counter: AtomicU32,
+    _data_1: PhantomData<E>,
+    _data_2: PhantomData<Storage>,
+}
+
+unsafe impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Send
+    for FutexWaiter<E, Storage>
+{
+}
+unsafe impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Sync
+    for FutexWaiter<E, Storage>
+{
+}
+
+impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> Abandonable
+    for FutexWaiter<E, Storage>
+{
+    unsafe fn abandon_in_place(_this: NonNull<Self>) {}
+}
+
+impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> FutexWaiter<E, Storage> {
+    fn mgmt(&self) -> &FutexMgmt {
+        unsafe { &*self.mgmt }
+    }
+
+    fn wait(&self, msg: &str, timeout: Option<Duration>) -> Result<(), ListenerWaitError> {
+        let mgmt = self.mgmt();
+        let last_seen_counter = self.last_seen_counter.load(Ordering::Relaxed);
+        let start = match timeout {
+            Some(_) => Time::now_with_clock(ClockType::Monotonic).ok(),
+            None => None,
+        };
+
+        // announce the sleeper before checking the counter, a notifier that incremented the
+        // counter after the check is guaranteed to see the sleeper and wakes it up
+        mgmt.number_of_sleeping_listeners
+            .fetch_add(1, Ordering::SeqCst);
+        let result = loop {
+            if mgmt.counter.load(Ordering::SeqCst) != last_seen_counter {
+                break Ok(());
+            }
+
+            let remaining = match (timeout, start) {
+                (Some(timeout), Some(start)) => {
+                    let remaining = timeout.saturating_sub(start.elapsed().unwrap_or(timeout));
+                    if remaining.is_zero() {
+                        break Ok(());
+                    }
+                    Some(remaining)
+                }
+                (Some(timeout), None) => Some(timeout),
+                (None, _) => None,
+            };
+
+            match futex_wait(&mgmt.counter, last_seen_counter, remaining) {
+                Ok(FutexWaitResult::Timeout) => break Ok(()),
+                Ok(_) => continue,
+                Err(e) => break Err(e),
+            }
+        };
+        mgmt.number_of_sleeping_listeners
+            .fetch_sub(1, Ordering::SeqCst);
+
+        match result {
+            Ok(()) => Ok(()),
+            Err(FutexWaitError::Interrupt) => {
+                fail!(from self, with ListenerWaitError::InterruptSignal,
+                    "{msg} since an interrupt signal was raised.");
+            }
+            Err(e) => {
+                fail!(from self, with ListenerWaitError::InternalFailure,
+                    "{msg} due to an internal failure. [{e:?}]");
+            }
+        }
+    }
+}
+
+impl<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>>
+    WaiterInterface<E, FutexMgmt, Storage> for FutexWaiter<E, Storage>
+{
+    const IS_FILE_DESCRIPTOR_BASED: bool = false;
+
+    unsafe fn remove(
+        _name: &FileName,
+        _config: &Configuration,
+    ) -> Result<bool, NamedConceptRemoveError> {
+        Ok(true)
+    }
+
+    fn remove_path_hint(
+        _value: &Path,
+    ) -> Result<(), crate::named_concept::NamedConceptPathHintRemoveError> {
+        Ok(())
+    }
+
+    fn empty_buffer(&self) -> Result<(), ListenerWaitError> {
+        let counter = self.mgmt().counter.load(Ordering::SeqCst);
+        self.last_seen_counter.store(counter, Ordering::Relaxed);
+        Ok(())
+    }
+
+    fn create(
+        _name: &FileName,
+        _config: &Configuration,
+        mgmt: &mut MaybeUninit<FutexMgmt>,
+    ) -> Result<Self, ListenerCreateError> {
+        mgmt.write(FutexMgmt {
+            counter: AtomicU32::new(0),
+            number_of_sleeping_listeners: AtomicU32::new(0),
+        });
+
+        Ok(Self {
+            mgmt: mgmt.as_ptr(),
+            last_seen_counter: AtomicU32::new(0),
+            _data_1: PhantomData,
+            _data_2: PhantomData,
+        })
+    }
+
+    fn try_wait(&self) -> Result<(), ListenerWaitError> {
+        // the notifications are acquired when the buffer is emptied
+        Ok(())
+    }
+
+    fn timed_wait(&self, timeout: Duration) -> Result<(), ListenerWaitError> {
+        self.wait("Failed to wait with timeout on the futex", Some(timeout))
+    }
+
+    fn blocking_wait(&self) -> Result<(), ListenerWaitError> {
+        self.wait("Failed to blocking wait on the futex", None)
+    }
+}
+
+#[allow(type_alias_bounds)] // they are not enforced, but we keep them to communicate the contract
+pub type GenericFutexTrigger<E: EventState, Storage: DynamicStorage<State<E, FutexMgmt>>> =
+    EventImpl<E, FutexMgmt, Storage, FutexHandle<E, Storage>, FutexWaiter<E, Storage>>;
@@ -18,8 +18,9 @@ use crate::{dynamic_storage::DynamicStorage, event::event_state::EventState};
 use core::fmt::Debug;
 use core::mem::MaybeUninit;
 use core::time::Duration;
-use iceoryx2_bb_concurrency::atomic::AtomicU8;
+use iceoryx2_bb_concurrency::atomic::{AtomicU8, AtomicU64};
 use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_container::vector::RelocatableVec;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
@@ -28,6 +29,8 @@ use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_log::fatal_panic;
 
+#[cfg(target_os = "linux")]
+pub mod futex;
 pub mod semaphore;
 pub mod socket_pair;
 pub mod stub;
@@ -61,6 +64,9 @@ impl Configuration {
 #[repr(C)]
 pub struct State<E: EventState, Mgmt: ZeroCopySend + Send + Sync + Debug> {
     pub event: E,
+    /// The latest value that was attached to an [`EventId`] with
+    /// [`Notifier::notify_with_value()`](crate::event::Notifier::notify_with_value()).
+    pub values: RelocatableVec<AtomicU64>,
     pub handle: MaybeUninit<Mgmt>,
     pub event_id_max: EventId,
     pub notification_state: AtomicU8,
@@ -32,6 +32,7 @@ use iceoryx2_bb_system_types::base64url::Base64Url;
 
 pub mod recommended;
 pub mod sha1;
+pub mod wyhash;
 
 /// Represents the value of the hash.
 #[derive(Debug, Clone, PartialEq, Eq, Hash)]
@@ -64,8 +65,38 @@ impl From<&HashValue> for String {
     }
 }
 
+/// Identifies the algorithm, and its version, that created a [`HashValue`]. Processes that
+/// were built with different [`Hash`] implementations can use it to detect the mismatch.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum HashKind {
+    /// Created by [`Sha1`](crate::hash::sha1::Sha1)
+    Sha1,
+    /// Created by the first version of [`WyHash128`](crate::hash::wyhash::WyHash128)
+    WyHash128V1,
+}
+
+impl HashKind {
+    /// Returns the [`HashKind`] that created the provided [`HashValue`] in its base64url
+    /// representation. If the value was not created by any known [`HashKind`] it returns
+    /// [`None`].
+    pub fn from_value(value: &[u8]) -> Option<HashKind> {
+        const SHA1_VALUE_LENGTH: usize = 40;
+
+        if value.len() == wyhash::VALUE_LENGTH && value.starts_with(wyhash::VERSION_TAG) {
+            Some(HashKind::WyHash128V1)
+        } else if value.len() == SHA1_VALUE_LENGTH && value.iter().all(|c| c.is_ascii_hexdigit()) {
+            Some(HashKind::Sha1)
+        } else {
+            None
+        }
+    }
+}
+
 /// Interface to generate hashes.
 pub trait Hash {
+    /// The [`HashKind`] of all [`HashValue`]s the implementation creates.
+    const KIND: HashKind;
+
     /// Creates a new hash from `bytes`.
     fn new(bytes: &[u8]) -> Self;
 
@@ -13,4 +13,12 @@
 /// Provides the recommended
 /// [`Hash`](crate::hash::Hash) concept implementation
 /// for the target.
+#[cfg(not(feature = "fast_service_hash"))]
 pub type Recommended = crate::hash::sha1::Sha1;
+
+/// Provides the recommended
+/// [`Hash`](crate::hash::Hash) concept implementation
+/// for the target. With the `fast_service_hash` feature the non-cryptographic
+/// [`WyHash128`](crate::hash::wyhash::WyHash128) is used.
+#[cfg(feature = "fast_service_hash")]
+pub type Recommended = crate::hash::wyhash::WyHash128;
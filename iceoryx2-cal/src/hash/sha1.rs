@@ -23,6 +23,8 @@ pub struct Sha1 {
 }
 
 impl Hash for Sha1 {
+    const KIND: HashKind = HashKind::Sha1;
+
     fn new(bytes: &[u8]) -> Self {
         Self {
             hash: {
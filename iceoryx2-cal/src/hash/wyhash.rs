@@ -0,0 +1,149 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Creates a 128 bit [`Hash`] with the wyhash mixing function. It is considerably faster than
+//! [`Sha1`](crate::hash::sha1::Sha1) for short inputs like service names but it is a
+//! non-cryptographic hash. **Shall not be used for security critical use cases.**
+//!
+//! The [`HashValue`] is prefixed with a version tag so that it can be distinguished from hashes
+//! created by other [`HashKind`]s, see [`HashKind::from_value()`].
+
+use crate::hash::*;
+
+const SECRET: [u64; 4] = [
+    0x2d35_8dcc_aa6c_78a5,
+    0x8bb8_4b93_962e_acc9,
+    0x4b33_a62e_d433_d4a3,
+    0x4d5a_2da5_1de1_aa47,
+];
+
+/// The two seeds of the independent 64 bit halves of the 128 bit hash.
+const SEEDS: [u64; 2] = [0x9e37_79b9_7f4a_7c15, 0xc2b2_ae3d_27d4_eb4f];
+
+/// The version tag every [`HashValue`] of the [`WyHash128`] starts with.
+pub(crate) const VERSION_TAG: &[u8; 2] = b"w1";
+
+/// The length of a [`HashValue`] of the [`WyHash128`], the version tag followed by the
+/// 128 bit hash in hex representation.
+pub(crate) const VALUE_LENGTH: usize = VERSION_TAG.len() + 32;
+
+pub struct WyHash128 {
+    hash: [u64; 2],
+}
+
+fn multiply(lhs: u64, rhs: u64) -> (u64, u64) {
+    let result = (lhs as u128) * (rhs as u128);
+    (result as u64, (result >> 64) as u64)
+}
+
+fn mix(lhs: u64, rhs: u64) -> u64 {
+    let (low, high) = multiply(lhs, rhs);
+    low ^ high
+}
+
+fn read_u64(bytes: &[u8], position: usize) -> u64 {
+    let mut value = [0u8; 8];
+    value.copy_from_slice(&bytes[position..position + 8]);
+    u64::from_le_bytes(value)
+}
+
+fn read_u32(bytes: &[u8], position: usize) -> u64 {
+    let mut value = [0u8; 4];
+    value.copy_from_slice(&bytes[position..position + 4]);
+    u32::from_le_bytes(value) as u64
+}
+
+fn wyhash(bytes: &[u8], seed: u64) -> u64 {
+    let len = bytes.len();
+    let mut seed = seed ^ mix(seed ^ SECRET[0], SECRET[1]);
+
+    let (a, b) = if len <= 16 {
+        if len >= 4 {
+            let offset = (len >> 3) << 2;
+            (
+                (read_u32(bytes, 0) << 32) | read_u32(bytes, offset),
+                (read_u32(bytes, len - 4) << 32) | read_u32(bytes, len - 4 - offset),
+            )
+        } else if len > 0 {
+            (
+                ((bytes[0] as u64) << 16) | ((bytes[len >> 1] as u64) << 8) | bytes[len - 1] as u64,
+                0,
+            )
+        } else {
+            (0, 0)
+        }
+    } else {
+        let mut position = 0;
+        let mut remaining = len;
+        if remaining > 48 {
+            let mut seed_1 = seed;
+            let mut seed_2 = seed;
+            while remaining > 48 {
+                seed = mix(
+                    read_u64(bytes, position) ^ SECRET[1],
+                    read_u64(bytes, position + 8) ^ seed,
+                );
+                seed_1 = mix(
+                    read_u64(bytes, position + 16) ^ SECRET[2],
+                    read_u64(bytes, position + 24) ^ seed_1,
+                );
+                seed_2 = mix(
+                    read_u64(bytes, position + 32) ^ SECRET[3],
+                    read_u64(bytes, position + 40) ^ seed_2,
+                );
+                position += 48;
+                remaining -= 48;
+            }
+            seed ^= seed_1 ^ seed_2;
+        }
+
+        while remaining > 16 {
+            seed = mix(
+                read_u64(bytes, position) ^ SECRET[1],
+                read_u64(bytes, position + 8) ^ seed,
+            );
+            position += 16;
+            remaining -= 16;
+        }
+
+        (read_u64(bytes, len - 16), read_u64(bytes, len - 8))
+    };
+
+    let (a, b) = multiply(a ^ SECRET[1], b ^ seed);
+    mix(a ^ SECRET[0] ^ len as u64, b ^ SECRET[1])
+}
+
+impl Hash for WyHash128 {
+    const KIND: HashKind = HashKind::WyHash128V1;
+
+    fn new(bytes: &[u8]) -> Self {
+        Self {
+            hash: [wyhash(bytes, SEEDS[0]), wyhash(bytes, SEEDS[1])],
+        }
+    }
+
+    fn value(&self) -> HashValue {
+        const HEX_DIGITS: &[u8; 16] = b"0123456789abcdef";
+
+        let mut value = [0u8; VALUE_LENGTH];
+        value[..VERSION_TAG.len()].copy_from_slice(VERSION_TAG);
+        for (n, byte) in self.hash.iter().flat_map(|v| v.to_be_bytes()).enumerate() {
+            let position = VERSION_TAG.len() + 2 * n;
+            value[position] = HEX_DIGITS[(byte >> 4) as usize];
+            value[position + 1] = HEX_DIGITS[(byte & 0x0f) as usize];
+        }
+
+        // the version tag and the hex representation are always a valid Base64Url
+        // representation
+        HashValue::new(&value).unwrap()
+    }
+}
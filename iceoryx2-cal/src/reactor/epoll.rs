@@ -21,7 +21,8 @@ use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
 use iceoryx2_log::{fail, warn};
 
 use crate::reactor::{
-    Reactor, ReactorAttachError, ReactorBuilder, ReactorCreateError, ReactorGuard, ReactorWaitError,
+    Reactor, ReactorAttachError, ReactorBackend, ReactorBuilder, ReactorCreateError, ReactorGuard,
+    ReactorWaitError,
 };
 
 impl<'reactor, 'attachment> ReactorGuard<'reactor, 'attachment>
@@ -169,6 +170,10 @@ impl ReactorBuilder<Epoll> for EpollBuilder {
         EpollBuilder::new().set_close_on_exec(true)
     }
 
+    fn backend(self, _value: ReactorBackend) -> Self {
+        self
+    }
+
     fn create(self) -> Result<Epoll, ReactorCreateError> {
         let msg = "Unable to create epoll::Reactor";
         let origin = format!("{self:?}");
@@ -0,0 +1,153 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+pub use iceoryx2_bb_linux::io_uring::{IoUring, IoUringBuilder, IoUringCreateError, IoUringGuard};
+
+use alloc::format;
+
+use iceoryx2_bb_linux::io_uring::{IoUringAttachmentError, IoUringWaitError};
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_log::fail;
+
+use crate::reactor::{
+    Reactor, ReactorAttachError, ReactorBackend, ReactorBuilder, ReactorCreateError, ReactorGuard,
+    ReactorWaitError,
+};
+
+impl<'reactor, 'attachment> ReactorGuard<'reactor, 'attachment>
+    for IoUringGuard<'reactor, 'attachment>
+{
+    fn file_descriptor(&self) -> &FileDescriptor {
+        self.file_descriptor()
+    }
+}
+
+fn handle_wait_error(
+    this: &IoUring,
+    msg: &str,
+    io_uring_wait_state: Result<usize, IoUringWaitError>,
+) -> Result<usize, ReactorWaitError> {
+    match io_uring_wait_state {
+        Ok(value) => Ok(value),
+        Err(IoUringWaitError::Interrupt) => {
+            fail!(from this, with ReactorWaitError::Interrupt,
+                "{msg} since an interrupt signal was raised.");
+        }
+        Err(IoUringWaitError::UnknownError(value)) => {
+            fail!(from this, with ReactorWaitError::InternalError,
+                "{msg} due to an internal error ({value}).");
+        }
+    }
+}
+
+impl Reactor for IoUring {
+    type Guard<'reactor, 'attachment> = IoUringGuard<'reactor, 'attachment>;
+    type Builder = IoUringBuilder;
+
+    fn capacity(&self) -> usize {
+        self.capacity()
+    }
+
+    fn len(&self) -> usize {
+        self.len()
+    }
+
+    fn is_empty(&self) -> bool {
+        self.is_empty()
+    }
+
+    fn attach<
+        'reactor,
+        'attachment,
+        F: iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing + core::fmt::Debug + ?Sized,
+    >(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        let msg = "Unable to attach file descriptor to reactor::IoUring";
+
+        match self.attach(value.file_descriptor()) {
+            Ok(guard) => Ok(guard),
+            Err(IoUringAttachmentError::ExceedsMaxSupportedAttachments) => {
+                fail!(from self, with ReactorAttachError::CapacityExceeded,
+                    "{msg} since it would exceed the maximum capacity of {}.", self.capacity());
+            }
+            Err(IoUringAttachmentError::AlreadyAttached) => {
+                fail!(from self, with ReactorAttachError::AlreadyAttached,
+                    "{msg} since the file descriptor {:?} is already attached.", value);
+            }
+            Err(e) => {
+                fail!(from self, with ReactorAttachError::InternalError,
+                    "{msg} due to an internal error ({e:?}).");
+            }
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        handle_wait_error(
+            self,
+            "Unable to try wait on reactor::IoUring",
+            self.try_wait(fn_call),
+        )
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: core::time::Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        handle_wait_error(
+            self,
+            "Unable to wait with timeout on reactor::IoUring",
+            self.timed_wait(fn_call, timeout),
+        )
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        handle_wait_error(
+            self,
+            "Unable to blocking wait on reactor::IoUring",
+            self.blocking_wait(fn_call),
+        )
+    }
+}
+
+impl ReactorBuilder<IoUring> for IoUringBuilder {
+    fn new() -> Self {
+        IoUringBuilder::new()
+    }
+
+    fn backend(self, _value: ReactorBackend) -> Self {
+        self
+    }
+
+    fn create(self) -> Result<IoUring, ReactorCreateError> {
+        let msg = "Unable to create reactor::IoUring";
+        let origin = format!("{self:?}");
+        match self.create() {
+            Ok(v) => Ok(v),
+            Err(IoUringCreateError::InsufficientMemory)
+            | Err(IoUringCreateError::PerProcessFileHandleLimitReached)
+            | Err(IoUringCreateError::SystemWideFileHandleLimitReached) => {
+                fail!(from origin, with ReactorCreateError::InsufficientResources,
+                   "{msg} due to insufficient system resources.");
+            }
+            Err(e) => {
+                fail!(from origin, with ReactorCreateError::InternalError,
+                    "{msg} due to an internal error ({e:?}).");
+            }
+        }
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Linux [`Reactor`](crate::reactor::Reactor) that uses either [`Epoll`] or [`IoUring`],
+//! selected at runtime with [`ReactorBuilder::backend()`](crate::reactor::ReactorBuilder::backend()).
+
+use core::{fmt::Debug, time::Duration};
+
+use iceoryx2_bb_posix::{
+    file_descriptor::FileDescriptor, file_descriptor_set::SynchronousMultiplexing,
+};
+use iceoryx2_log::warn;
+
+use crate::reactor::epoll::{Epoll, EpollBuilder, EpollGuard};
+use crate::reactor::io_uring::{IoUring, IoUringBuilder, IoUringGuard};
+use crate::reactor::{ReactorAttachError, ReactorBackend, ReactorCreateError, ReactorWaitError};
+
+pub enum Guard<'reactor, 'attachment> {
+    Epoll(EpollGuard<'reactor, 'attachment>),
+    IoUring(IoUringGuard<'reactor, 'attachment>),
+}
+
+impl<'reactor, 'attachment> crate::reactor::ReactorGuard<'reactor, 'attachment>
+    for Guard<'reactor, 'attachment>
+{
+    fn file_descriptor(&self) -> &FileDescriptor {
+        match self {
+            Guard::Epoll(guard) => guard.file_descriptor(),
+            Guard::IoUring(guard) => guard.file_descriptor(),
+        }
+    }
+}
+
+#[derive(Debug)]
+pub enum Reactor {
+    Epoll(Epoll),
+    IoUring(IoUring),
+}
+
+impl crate::reactor::Reactor for Reactor {
+    type Guard<'reactor, 'attachment> = Guard<'reactor, 'attachment>;
+    type Builder = ReactorBuilder;
+
+    fn capacity(&self) -> usize {
+        match self {
+            Reactor::Epoll(reactor) => crate::reactor::Reactor::capacity(reactor),
+            Reactor::IoUring(reactor) => crate::reactor::Reactor::capacity(reactor),
+        }
+    }
+
+    fn len(&self) -> usize {
+        match self {
+            Reactor::Epoll(reactor) => crate::reactor::Reactor::len(reactor),
+            Reactor::IoUring(reactor) => crate::reactor::Reactor::len(reactor),
+        }
+    }
+
+    fn is_empty(&self) -> bool {
+        match self {
+            Reactor::Epoll(reactor) => crate::reactor::Reactor::is_empty(reactor),
+            Reactor::IoUring(reactor) => crate::reactor::Reactor::is_empty(reactor),
+        }
+    }
+
+    fn attach<'reactor, 'attachment, F: SynchronousMultiplexing + Debug + ?Sized>(
+        &'reactor self,
+        value: &'attachment F,
+    ) -> Result<Self::Guard<'reactor, 'attachment>, ReactorAttachError> {
+        match self {
+            Reactor::Epoll(reactor) => Ok(Guard::Epoll(crate::reactor::Reactor::attach(
+                reactor, value,
+            )?)),
+            Reactor::IoUring(reactor) => Ok(Guard::IoUring(crate::reactor::Reactor::attach(
+                reactor, value,
+            )?)),
+        }
+    }
+
+    fn try_wait<F: FnMut(&FileDescriptor)>(&self, fn_call: F) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Epoll(reactor) => crate::reactor::Reactor::try_wait(reactor, fn_call),
+            Reactor::IoUring(reactor) => crate::reactor::Reactor::try_wait(reactor, fn_call),
+        }
+    }
+
+    fn timed_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Epoll(reactor) => {
+                crate::reactor::Reactor::timed_wait(reactor, fn_call, timeout)
+            }
+            Reactor::IoUring(reactor) => {
+                crate::reactor::Reactor::timed_wait(reactor, fn_call, timeout)
+            }
+        }
+    }
+
+    fn blocking_wait<F: FnMut(&FileDescriptor)>(
+        &self,
+        fn_call: F,
+    ) -> Result<usize, ReactorWaitError> {
+        match self {
+            Reactor::Epoll(reactor) => crate::reactor::Reactor::blocking_wait(reactor, fn_call),
+            Reactor::IoUring(reactor) => crate::reactor::Reactor::blocking_wait(reactor, fn_call),
+        }
+    }
+}
+
+#[derive(Debug)]
+pub struct ReactorBuilder {
+    backend: ReactorBackend,
+}
+
+impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
+    fn new() -> Self {
+        Self {
+            backend: ReactorBackend::default(),
+        }
+    }
+
+    fn backend(mut self, value: ReactorBackend) -> Self {
+        self.backend = value;
+        self
+    }
+
+    fn create(self) -> Result<Reactor, ReactorCreateError> {
+        if self.backend == ReactorBackend::IoUring {
+            let builder = <IoUringBuilder as crate::reactor::ReactorBuilder<IoUring>>::new();
+            match crate::reactor::ReactorBuilder::create(builder) {
+                Ok(reactor) => return Ok(Reactor::IoUring(reactor)),
+                Err(e) => {
+                    warn!(from self,
+                        "Unable to create the io_uring reactor ({e:?}). Falling back to the epoll reactor.");
+                }
+            }
+        }
+
+        let builder = <EpollBuilder as crate::reactor::ReactorBuilder<Epoll>>::new();
+        Ok(Reactor::Epoll(crate::reactor::ReactorBuilder::create(
+            builder,
+        )?))
+    }
+}
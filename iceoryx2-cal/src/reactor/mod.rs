@@ -12,6 +12,10 @@
 
 #[cfg(target_os = "linux")]
 pub mod epoll;
+#[cfg(target_os = "linux")]
+pub mod io_uring;
+#[cfg(target_os = "linux")]
+pub mod linux;
 pub mod posix_select;
 pub mod recommended;
 
@@ -20,6 +24,19 @@ use core::{fmt::Debug, time::Duration};
 use iceoryx2_bb_posix::{
     file_descriptor::FileDescriptor, file_descriptor_set::SynchronousMultiplexing,
 };
+use serde::{Deserialize, Serialize};
+
+/// Selects the event multiplexing mechanism of a [`Reactor`] that supports more than one.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default, Serialize, Deserialize)]
+pub enum ReactorBackend {
+    /// The recommended mechanism of the platform, `epoll` on linux.
+    #[default]
+    Recommended,
+    /// The linux `io_uring`. It submits the poll requests of all attachments together with the
+    /// wait in one syscall. Requires linux 5.11 or newer, when it is not available the
+    /// [`Reactor`] falls back to [`ReactorBackend::Recommended`].
+    IoUring,
+}
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ReactorCreateError {
@@ -99,5 +116,8 @@ pub trait Reactor: Sized + Debug + Send {
 
 pub trait ReactorBuilder<T: Reactor> {
     fn new() -> Self;
+    /// Defines the [`ReactorBackend`]. [`Reactor`]s that are bound to one specific mechanism
+    /// ignore it.
+    fn backend(self, value: ReactorBackend) -> Self;
     fn create(self) -> Result<T, ReactorCreateError>;
 }
@@ -22,7 +22,7 @@ use iceoryx2_bb_posix::{
         FileDescriptorSetWaitError, FileEvent,
     },
 };
-use iceoryx2_log::fail;
+use iceoryx2_log::{fail, warn};
 
 use crate::reactor::{ReactorAttachError, ReactorWaitError};
 
@@ -171,6 +171,14 @@ impl crate::reactor::ReactorBuilder<Reactor> for ReactorBuilder {
         Self {}
     }
 
+    fn backend(self, value: super::ReactorBackend) -> Self {
+        if value != super::ReactorBackend::Recommended {
+            warn!(from "posix_select::ReactorBuilder::backend()",
+                "The reactor backend {value:?} is not available. Falling back to select.");
+        }
+        self
+    }
+
     fn create(self) -> Result<Reactor, super::ReactorCreateError> {
         Ok(Reactor::new())
     }
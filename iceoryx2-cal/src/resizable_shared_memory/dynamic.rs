@@ -29,14 +29,16 @@ use iceoryx2_bb_container::string::String;
 use iceoryx2_bb_elementary_traits::allocator::AllocationError;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
 use iceoryx2_bb_posix::file::AccessMode;
 use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_log::fatal_panic;
 use iceoryx2_log::{fail, warn};
 
 use crate::shared_memory::{
-    AllocationStrategy, SegmentId, SharedMemoryForPoolAllocator, ShmPointer,
+    AllocationStrategy, NumaPolicy, PageSize, SegmentId, SharedMemoryForPoolAllocator, ShmPointer,
 };
 use crate::shared_memory::{
     PointerOffset, SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError,
@@ -49,7 +51,7 @@ use super::{
     NamedConcept, NamedConceptBuilder, NamedConceptDoesExistError, NamedConceptListError,
     NamedConceptMgmt, NamedConceptRemoveError, ResizableSharedMemory, ResizableSharedMemoryBuilder,
     ResizableSharedMemoryForPoolAllocator, ResizableSharedMemoryView,
-    ResizableSharedMemoryViewBuilder, ResizableShmAllocationError,
+    ResizableSharedMemoryViewBuilder, ResizableShmAllocationError, SegmentStatistics, ShrinkPolicy,
 };
 
 const MAX_NUMBER_OF_REALLOCATIONS: usize = SegmentId::max_segment_id() as usize + 1;
@@ -66,11 +68,31 @@ struct SharedState {
     max_chunk_alignment_hint: AtomicU64,
 }
 
+impl SharedState {
+    fn hinted_size_class(&self) -> SizeClass {
+        SizeClass {
+            chunk_layout: unsafe {
+                Layout::from_size_align_unchecked(
+                    self.max_chunk_size_hint.load(Ordering::Relaxed) as usize,
+                    self.max_chunk_alignment_hint.load(Ordering::Relaxed) as usize,
+                )
+            },
+            number_of_chunks: self.max_number_of_chunks_hint.load(Ordering::Relaxed) as usize,
+        }
+    }
+}
+
 #[derive(Debug)]
 struct MemoryConfig<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     base_name: FileName,
     shm: Shm::Configuration,
     allocator_config_hint: Allocator::Configuration,
+    page_size: PageSize,
+    numa_policy: NumaPolicy,
+    typed_memory: Option<FilePath>,
+    prefault: bool,
+    lock_in_memory: bool,
+    shrink_policy: ShrinkPolicy,
 }
 
 #[derive(Debug)]
@@ -78,6 +100,7 @@ struct ViewConfig<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     base_name: FileName,
     shm: Shm::Configuration,
     shm_builder_timeout: Duration,
+    retain_empty_segments: bool,
     _data: PhantomData<Allocator>,
 }
 
@@ -87,6 +110,9 @@ struct InternalState<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     shared_state: SharedState,
     shared_memory_map: SlotMap<ShmEntry<Allocator, Shm>>,
     current_idx: SlotMapKey,
+    initial_segment_size: usize,
+    current_idle_since: Option<Time>,
+    number_of_released_segments: u64,
 }
 
 impl<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> Abandonable
@@ -98,10 +124,33 @@ impl<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> Abandonable
     }
 }
 
+/// The chunk layout and the number of chunks of a segment that was created for a size class,
+/// see [`AllocationStrategy::SizeClasses`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct SizeClass {
+    chunk_layout: Layout,
+    number_of_chunks: usize,
+}
+
+impl SizeClass {
+    fn chunk_size_for(layout: Layout) -> usize {
+        layout.size().max(layout.align()).next_power_of_two()
+    }
+
+    /// A size class fits when the chunk can hold the layout and wastes less than one power of
+    /// two step of memory.
+    fn fits(&self, layout: Layout) -> bool {
+        self.chunk_layout.size() >= layout.size()
+            && self.chunk_layout.align() >= layout.align()
+            && self.chunk_layout.size() < Self::chunk_size_for(layout).saturating_mul(2)
+    }
+}
+
 #[derive(Debug)]
 struct ShmEntry<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> {
     shm: Shm,
     chunk_count: AtomicU64,
+    size_class: Option<SizeClass>,
     _data: PhantomData<Allocator>,
 }
 
@@ -125,6 +174,7 @@ impl<Allocator: ShmAllocator, Shm: SharedMemory<Allocator>> ShmEntry<Allocator,
         Self {
             shm,
             chunk_count: AtomicU64::new(0),
+            size_class: None,
             _data: PhantomData,
         }
     }
@@ -157,6 +207,7 @@ where
                 base_name: *name,
                 shm: Shm::Configuration::default(),
                 shm_builder_timeout: Duration::ZERO,
+                retain_empty_segments: false,
                 _data: PhantomData,
             },
         }
@@ -183,6 +234,11 @@ where
         self
     }
 
+    fn retain_empty_segments(mut self, value: bool) -> Self {
+        self.config.retain_empty_segments = value;
+        self
+    }
+
     fn open(
         self,
         access_mode: AccessMode,
@@ -231,6 +287,12 @@ where
                 base_name: *name,
                 allocator_config_hint: Allocator::Configuration::default(),
                 shm: Shm::Configuration::default(),
+                page_size: PageSize::Regular,
+                numa_policy: NumaPolicy::Default,
+                typed_memory: None,
+                prefault: false,
+                lock_in_memory: false,
+                shrink_policy: ShrinkPolicy::Never,
             },
             shared_state: SharedState {
                 allocation_strategy: AllocationStrategy::default(),
@@ -276,6 +338,36 @@ where
         self
     }
 
+    fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
+    fn numa_policy(mut self, value: NumaPolicy) -> Self {
+        self.config.numa_policy = value;
+        self
+    }
+
+    fn typed_memory(mut self, value: Option<FilePath>) -> Self {
+        self.config.typed_memory = value;
+        self
+    }
+
+    fn prefault(mut self, value: bool) -> Self {
+        self.config.prefault = value;
+        self
+    }
+
+    fn lock_in_memory(mut self, value: bool) -> Self {
+        self.config.lock_in_memory = value;
+        self
+    }
+
+    fn shrink_policy(mut self, value: ShrinkPolicy) -> Self {
+        self.config.shrink_policy = value;
+        self
+    }
+
     fn create(mut self) -> Result<DynamicMemory<Allocator, Shm>, SharedMemoryCreateError> {
         let msg = "Unable to create ResizableSharedMemory";
         let origin = format!("{self:?}");
@@ -290,27 +382,22 @@ where
                                                     .create(&hint.config),
                             "{msg} since the management segment could not be created.");
 
+        let initial_size_class = self.shared_state.hinted_size_class();
         let hint = Allocator::initial_setup_hint(
-            unsafe {
-                Layout::from_size_align_unchecked(
-                    self.shared_state
-                        .max_chunk_size_hint
-                        .load(Ordering::Relaxed) as usize,
-                    self.shared_state
-                        .max_chunk_alignment_hint
-                        .load(Ordering::Relaxed) as usize,
-                )
-            },
-            self.shared_state
-                .max_number_of_chunks_hint
-                .load(Ordering::Relaxed) as usize,
+            initial_size_class.chunk_layout,
+            initial_size_class.number_of_chunks,
         );
         self.config.allocator_config_hint = hint.config;
 
         let shm = fail!(from origin, when DynamicMemory::create_segment(&self.config, SegmentId::new(0), hint.payload_size),
             "Unable to create ResizableSharedMemory since the underlying shared memory could not be created.");
+        let initial_segment_size = shm.size();
+        let mut entry = ShmEntry::new(shm);
+        if self.shared_state.allocation_strategy == AllocationStrategy::SizeClasses {
+            entry.size_class = Some(initial_size_class);
+        }
         let mut shared_memory_map = SlotMap::new(MAX_NUMBER_OF_REALLOCATIONS);
-        let current_idx = fatal_panic!(from origin, when shared_memory_map.insert(ShmEntry::new(shm)).ok_or(""),
+        let current_idx = fatal_panic!(from origin, when shared_memory_map.insert(entry).ok_or(""),
                 "This should never happen! {msg} since the newly constructed SlotMap does not have space for one insert.");
 
         Ok(DynamicMemory {
@@ -319,6 +406,9 @@ where
                 shared_memory_map,
                 current_idx,
                 shared_state: self.shared_state,
+                initial_segment_size,
+                current_idle_since: None,
+                number_of_released_segments: 0,
             }),
             mgmt_segment,
             _data: PhantomData,
@@ -352,10 +442,11 @@ where
     Shm::Builder: Debug,
 {
     fn release_old_unused_segments(
+        &self,
         shared_memory_map: &mut SlotMap<ShmEntry<Allocator, Shm>>,
         old_idx: usize,
     ) {
-        if old_idx == INVALID_KEY {
+        if old_idx == INVALID_KEY || self.view_config.retain_empty_segments {
             return;
         }
 
@@ -392,7 +483,7 @@ where
                 let entry = ShmEntry::new(shm);
                 entry.register_offset();
                 shared_memory_map.insert_at(key, entry);
-                Self::release_old_unused_segments(
+                self.release_old_unused_segments(
                     shared_memory_map,
                     self.current_idx.swap(key.value(), Ordering::Relaxed),
                 );
@@ -417,6 +508,7 @@ where
             Some(entry) => {
                 let state = entry.unregister_offset();
                 if state == ShmEntryState::Empty
+                    && !self.view_config.retain_empty_segments
                     && self.current_idx.load(Ordering::Relaxed) != key.value()
                 {
                     shared_memory_map.remove(key);
@@ -624,6 +716,11 @@ where
         Self::segment_builder(&config.base_name, &config.shm, segment_id)
             .has_ownership(true)
             .size(payload_size)
+            .page_size(config.page_size)
+            .numa_policy(config.numa_policy)
+            .typed_memory(config.typed_memory)
+            .prefault(config.prefault)
+            .lock_in_memory(config.lock_in_memory)
             .create(&config.allocator_config_hint)
     }
 
@@ -697,6 +794,182 @@ where
         Ok(())
     }
 
+    fn create_size_class_segment(
+        &self,
+        layout: Layout,
+        exhausted_size_class: Option<SizeClass>,
+    ) -> Result<(), ResizableShmAllocationError> {
+        let msg = "Unable to create size class segment for";
+        let state = self.state_mut();
+        let size_class = match exhausted_size_class {
+            // all segments of the size class are in use, add a segment with twice the capacity
+            Some(size_class) => SizeClass {
+                chunk_layout: size_class.chunk_layout,
+                number_of_chunks: size_class.number_of_chunks.saturating_mul(2),
+            },
+            None => SizeClass {
+                chunk_layout: unsafe {
+                    Layout::from_size_align_unchecked(
+                        SizeClass::chunk_size_for(layout),
+                        layout.align(),
+                    )
+                },
+                number_of_chunks: state
+                    .shared_state
+                    .max_number_of_chunks_hint
+                    .load(Ordering::Relaxed) as usize,
+            },
+        };
+
+        let new_number_of_reallocations = state.current_idx.value() + 1;
+        let segment_id = if new_number_of_reallocations < MAX_NUMBER_OF_REALLOCATIONS {
+            SlotMapKey::new(new_number_of_reallocations)
+        } else {
+            fail!(from self, with ResizableShmAllocationError::MaxReallocationsReached,
+                "{msg} {:?} since it would exceed the maximum amount of segments of {}. With a better configuration hint, this issue can be avoided.",
+                layout, Self::max_number_of_reallocations());
+        };
+
+        let segment_setup =
+            Allocator::initial_setup_hint(size_class.chunk_layout, size_class.number_of_chunks);
+        state.builder_config.allocator_config_hint = segment_setup.config;
+        let shm = Self::create_segment(
+            &state.builder_config,
+            SegmentId::new(segment_id.value() as u8),
+            segment_setup.payload_size,
+        )?;
+
+        let mut entry = ShmEntry::new(shm);
+        entry.size_class = Some(size_class);
+        state.shared_memory_map.insert_at(segment_id, entry);
+        state.current_idx = segment_id;
+
+        Ok(())
+    }
+
+    fn allocate_from_size_class(
+        &self,
+        layout: Layout,
+    ) -> Result<ShmPointer, ResizableShmAllocationError> {
+        let msg = "Unable to allocate memory from size class";
+        let state = self.state_mut();
+
+        loop {
+            let smallest_fitting_chunk_layout = state
+                .shared_memory_map
+                .iter()
+                .filter_map(|(_, entry)| entry.size_class)
+                .filter(|size_class| size_class.fits(layout))
+                .map(|size_class| size_class.chunk_layout)
+                .min_by_key(|chunk_layout| chunk_layout.size());
+
+            let mut exhausted_size_class: Option<SizeClass> = None;
+            if let Some(chunk_layout) = smallest_fitting_chunk_layout {
+                for (segment_id, entry) in state.shared_memory_map.iter() {
+                    let size_class = match entry.size_class {
+                        Some(size_class) if size_class.chunk_layout == chunk_layout => size_class,
+                        _ => continue,
+                    };
+
+                    match entry.shm.allocate(layout) {
+                        Ok(mut ptr) => {
+                            entry.register_offset();
+                            ptr.offset
+                                .set_segment_id(SegmentId::new(segment_id.value() as u8));
+                            return Ok(ptr);
+                        }
+                        Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)) => {
+                            if exhausted_size_class
+                                .is_none_or(|v| v.number_of_chunks < size_class.number_of_chunks)
+                            {
+                                exhausted_size_class = Some(size_class);
+                            }
+                        }
+                        Err(e) => {
+                            fail!(from self, with e.into(), "{msg} {:?} due to {:?}.", layout, e);
+                        }
+                    }
+                }
+            }
+
+            self.create_size_class_segment(layout, exhausted_size_class)?;
+        }
+    }
+
+    /// Replaces the current segment with a segment that is sized according to the initial hints
+    /// when it is oversized and was idle for longer than the [`ShrinkPolicy`] allows.
+    fn release_idle_segment(&self) {
+        let msg = "Unable to release idle segment";
+        let state = self.state_mut();
+        let idle_time = match state.builder_config.shrink_policy {
+            ShrinkPolicy::Never => return,
+            ShrinkPolicy::AfterIdleTime(idle_time) => idle_time,
+        };
+
+        let is_idle = match &state.current_idle_since {
+            Some(idle_since) => idle_since
+                .elapsed()
+                .map(|elapsed| elapsed >= idle_time)
+                .unwrap_or(false),
+            None => false,
+        };
+
+        if !is_idle {
+            return;
+        }
+
+        match state.shared_memory_map.get(state.current_idx) {
+            Some(entry) => {
+                if entry.chunk_count.load(Ordering::Relaxed) != 0
+                    || entry.shm.size() <= state.initial_segment_size
+                {
+                    state.current_idle_since = None;
+                    return;
+                }
+            }
+            None => {
+                fatal_panic!(from self,
+                        "This should never happen! {msg} since the current segment id is unavailable.")
+            }
+        }
+
+        state.current_idle_since = None;
+        let new_number_of_reallocations = state.current_idx.value() + 1;
+        if new_number_of_reallocations >= MAX_NUMBER_OF_REALLOCATIONS {
+            warn!(from self,
+                "{msg} since it would exceed the maximum amount of reallocations of {}.",
+                Self::max_number_of_reallocations());
+            return;
+        }
+        let segment_id = SlotMapKey::new(new_number_of_reallocations);
+
+        let hinted_size_class = state.shared_state.hinted_size_class();
+        let segment_setup = Allocator::initial_setup_hint(
+            hinted_size_class.chunk_layout,
+            hinted_size_class.number_of_chunks,
+        );
+        state.builder_config.allocator_config_hint = segment_setup.config;
+        let shm = match Self::create_segment(
+            &state.builder_config,
+            SegmentId::new(segment_id.value() as u8),
+            segment_setup.payload_size,
+        ) {
+            Ok(shm) => shm,
+            Err(e) => {
+                warn!(from self,
+                    "{msg} since the replacement segment could not be created ({:?}).", e);
+                return;
+            }
+        };
+
+        state.shared_memory_map.remove(state.current_idx);
+        state
+            .shared_memory_map
+            .insert_at(segment_id, ShmEntry::new(shm));
+        state.current_idx = segment_id;
+        state.number_of_released_segments += 1;
+    }
+
     fn handle_reallocation(
         &self,
         e: ShmAllocationError,
@@ -732,10 +1005,16 @@ where
         match state.shared_memory_map.get(segment_id) {
             Some(entry) => {
                 deallocation_call(entry);
-                if entry.unregister_offset() == ShmEntryState::Empty
-                    && segment_id != state.current_idx
-                {
-                    state.shared_memory_map.remove(segment_id);
+                if entry.unregister_offset() == ShmEntryState::Empty {
+                    if segment_id != state.current_idx {
+                        // size class segments are kept to be reused by the next allocation of
+                        // that size
+                        if entry.size_class.is_none() {
+                            state.shared_memory_map.remove(segment_id);
+                        }
+                    } else if state.builder_config.shrink_policy != ShrinkPolicy::Never {
+                        state.current_idle_since = Time::now_with_clock(ClockType::Monotonic).ok();
+                    }
                 }
             }
             None => fatal_panic!(from self,
@@ -783,15 +1062,42 @@ where
         self.state().shared_memory_map.len()
     }
 
+    fn segment_statistics(&self) -> SegmentStatistics {
+        let state = self.state();
+        SegmentStatistics {
+            number_of_active_segments: state.shared_memory_map.len(),
+            total_size: state
+                .shared_memory_map
+                .iter()
+                .map(|(_, entry)| entry.shm.size())
+                .sum(),
+            current_segment_size: state
+                .shared_memory_map
+                .get(state.current_idx)
+                .map(|entry| entry.shm.size())
+                .unwrap_or(0),
+            number_of_released_segments: state.number_of_released_segments,
+        }
+    }
+
     fn allocate(&self, layout: Layout) -> Result<ShmPointer, ResizableShmAllocationError> {
         let msg = "Unable to allocate memory";
         let state = self.state_mut();
 
+        if state.shared_state.allocation_strategy == AllocationStrategy::SizeClasses {
+            return self.allocate_from_size_class(layout);
+        }
+
+        if state.current_idle_since.is_some() {
+            self.release_idle_segment();
+        }
+
         loop {
             match state.shared_memory_map.get(state.current_idx) {
                 Some(entry) => match entry.shm.allocate(layout) {
                     Ok(mut ptr) => {
                         entry.register_offset();
+                        state.current_idle_since = None;
                         ptr.offset
                             .set_segment_id(SegmentId::new(state.current_idx.value() as u8));
                         return Ok(ptr);
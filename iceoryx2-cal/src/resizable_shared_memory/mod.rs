@@ -99,13 +99,44 @@ use core::time::Duration;
 use iceoryx2_bb_elementary::enum_gen;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_posix::file::AccessMode;
+use iceoryx2_bb_system_types::file_path::FilePath;
 
 use crate::named_concept::*;
 use crate::shared_memory::{
-    SegmentId, SharedMemory, SharedMemoryCreateError, SharedMemoryOpenError, ShmPointer,
+    NumaPolicy, PageSize, SegmentId, SharedMemory, SharedMemoryCreateError, SharedMemoryOpenError,
+    ShmPointer,
 };
 use crate::shm_allocator::{PointerOffset, ShmAllocationError, ShmAllocator};
 
+/// Defines when the [`ResizableSharedMemory`] releases a [`SharedMemory`] segment that was
+/// acquired to serve a larger allocation or more chunks than hinted.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum ShrinkPolicy {
+    /// Segments are only released when they are replaced by a larger segment.
+    #[default]
+    Never,
+    /// The current segment is released when it exceeds the initially hinted size and none of its
+    /// chunks were in use for at least the provided duration. It is replaced by a segment that
+    /// is sized according to the initial hints with the next
+    /// [`ResizableSharedMemory::allocate()`]. Segments of
+    /// [`AllocationStrategy::SizeClasses`] are reused and never released.
+    AfterIdleTime(Duration),
+}
+
+/// Describes the [`SharedMemory`] segments of a [`ResizableSharedMemory`], see
+/// [`ResizableSharedMemory::segment_statistics()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct SegmentStatistics {
+    /// The number of segments that are currently mapped.
+    pub number_of_active_segments: usize,
+    /// The sum of the sizes of all segments that are currently mapped.
+    pub total_size: usize,
+    /// The size of the segment from which new chunks are allocated.
+    pub current_segment_size: usize,
+    /// The number of oversized segments that were released due to the [`ShrinkPolicy`].
+    pub number_of_released_segments: u64,
+}
+
 enum_gen! {
 /// Defines all erros that can occur when calling [`ResizableSharedMemory::allocate()`]
 ///
@@ -138,6 +169,13 @@ pub trait ResizableSharedMemoryViewBuilder<
     /// timeout.
     fn timeout(self, value: Duration) -> Self;
 
+    /// Defines if segments whose chunks were all unregistered stay mapped. This avoids the
+    /// repeated mapping and unmapping of segments that are reused by the
+    /// [`ResizableSharedMemory`], like with
+    /// [`AllocationStrategy::SizeClasses`](crate::shm_allocator::AllocationStrategy::SizeClasses).
+    /// By default it is set to `false`.
+    fn retain_empty_segments(self, value: bool) -> Self;
+
     /// Opens already existing [`SharedMemory`]. If it does not exist or the initialization is not
     /// yet finished the method will fail.
     fn open(self, access_mode: AccessMode) -> Result<ResizableShmView, SharedMemoryOpenError>;
@@ -166,6 +204,27 @@ pub trait ResizableSharedMemoryBuilder<
     /// acquired.
     fn allocation_strategy(self, value: AllocationStrategy) -> Self;
 
+    /// Defines the [`PageSize`] of every [`SharedMemory`] segment that holds the chunks.
+    fn page_size(self, value: PageSize) -> Self;
+
+    /// Defines the [`NumaPolicy`] of every [`SharedMemory`] segment that holds the chunks.
+    fn numa_policy(self, value: NumaPolicy) -> Self;
+
+    /// Defines the typed memory pool from which every [`SharedMemory`] segment that holds the
+    /// chunks is allocated.
+    fn typed_memory(self, value: Option<FilePath>) -> Self;
+
+    /// Defines if every page of a newly acquired [`SharedMemory`] segment is touched during its
+    /// creation so that the first access does not cause a page fault.
+    fn prefault(self, value: bool) -> Self;
+
+    /// Defines if every newly acquired [`SharedMemory`] segment is locked into memory.
+    fn lock_in_memory(self, value: bool) -> Self;
+
+    /// Defines the [`ShrinkPolicy`] that decides when an oversized [`SharedMemory`] segment is
+    /// released. By default it is set to [`ShrinkPolicy::Never`].
+    fn shrink_policy(self, value: ShrinkPolicy) -> Self;
+
     /// Creates new [`SharedMemory`]. If it already exists the method will fail.
     fn create(self) -> Result<ResizableShm, SharedMemoryCreateError>;
 }
@@ -226,6 +285,9 @@ pub trait ResizableSharedMemory<Allocator: ShmAllocator, Shm: SharedMemory<Alloc
     /// Returns the number of active [`SharedMemory`] segments.
     fn number_of_active_segments(&self) -> usize;
 
+    /// Returns the [`SegmentStatistics`] of the [`ResizableSharedMemory`].
+    fn segment_statistics(&self) -> SegmentStatistics;
+
     /// Allocates a new piece of [`SharedMemory`] if the provided [`Layout`] exceeds the current
     /// supported [`Layout`], the memory would be out-of-memory or the number of chunks exceeds the
     /// current supported amount of chunks, a new [`SharedMemory`] segment will be created. If this
@@ -12,32 +12,820 @@
 
 //! Implements [`Serialize`] for the Common Data Representation (cdr),
 //! see: <https://en.wikipedia.org/wiki/Common_Data_Representation>.
+//!
+//! The data is encoded in little endian and prefixed with the `CDR_LE` encapsulation header,
+//! which is the wire format of serialized ROS 2 messages. Deserialization accepts the big and
+//! the little endian encapsulation.
+//!
+//! Besides the allocating [`Serialize::serialize()`], [`Cdr::serialize_into()`] writes
+//! directly into a caller provided buffer, e.g. the payload of a loaned sample.
+//! [`Cdr::serialized_size()`] computes the exact number of bytes up front, so that the buffer
+//! can be loaned with the correct size and every value is serialized exactly once.
+//!
+//! # Example
+//!
+//! ```
+//! use core::mem::MaybeUninit;
+//! use iceoryx2_cal::serialize::Serialize;
+//! use iceoryx2_cal::serialize::cdr::Cdr;
+//!
+//! #[derive(serde::Serialize, serde::Deserialize, Debug, PartialEq)]
+//! struct PointField {
+//!     name: String,
+//!     offset: u32,
+//!     datatype: u8,
+//!     count: u32,
+//! }
+//!
+//! let value = PointField { name: "x".into(), offset: 0, datatype: 7, count: 1 };
+//!
+//! let size = Cdr::serialized_size(&value).expect("failed to compute size");
+//! // in practice the memory of a loaned sample
+//! let mut buffer = vec![MaybeUninit::<u8>::uninit(); size];
+//! let written = Cdr::serialize_into(&value, &mut buffer).expect("failed to serialize");
+//! assert_eq!(written, size);
+//!
+//! let bytes: Vec<u8> = buffer.iter().map(|b| unsafe { b.assume_init() }).collect();
+//! let deserialized: PointField = Cdr::deserialize(&bytes).expect("failed to deserialize");
+//! assert_eq!(deserialized, value);
+//! ```
+
+use core::mem::MaybeUninit;
 
 use alloc::vec::Vec;
 
 use iceoryx2_log::fail;
+use serde::de::IntoDeserializer;
 
 use crate::serialize::Serialize;
-use cdr::{CdrBe, Infinite};
 
 use super::{DeserializeError, SerializeError};
 
+const ENCAPSULATION_HEADER_SIZE: usize = 4;
+const CDR_BE: [u8; ENCAPSULATION_HEADER_SIZE] = [0x00, 0x00, 0x00, 0x00];
+const CDR_LE: [u8; ENCAPSULATION_HEADER_SIZE] = [0x00, 0x01, 0x00, 0x00];
+
+#[derive(Debug, PartialEq, Eq, Clone, Copy)]
+enum CdrError {
+    InsufficientBufferSize,
+    UnsupportedType,
+    UnknownSequenceLength,
+    LengthExceedsLimit,
+    UnexpectedEndOfInput,
+    InvalidEncapsulation,
+    InvalidValue,
+    Custom,
+}
+
+impl core::fmt::Display for CdrError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "CdrError::{self:?}")
+    }
+}
+
+impl serde::ser::StdError for CdrError {}
+
+impl serde::ser::Error for CdrError {
+    fn custom<T: core::fmt::Display>(_msg: T) -> Self {
+        CdrError::Custom
+    }
+}
+
+impl serde::de::Error for CdrError {
+    fn custom<T: core::fmt::Display>(_msg: T) -> Self {
+        CdrError::Custom
+    }
+}
+
+/// The destination of the [`Serializer`]. The position is relative to the end of the
+/// encapsulation header, since the alignment of the data is relative to it.
+trait Output {
+    fn position(&self) -> usize;
+    fn write(&mut self, bytes: &[u8]) -> Result<(), CdrError>;
+    fn pad(&mut self, count: usize) -> Result<(), CdrError>;
+}
+
+/// Only counts the bytes, used for the size-precomputation pass.
+struct SizeCounter {
+    position: usize,
+}
+
+impl Output for SizeCounter {
+    fn position(&self) -> usize {
+        self.position
+    }
+
+    fn write(&mut self, bytes: &[u8]) -> Result<(), CdrError> {
+        self.position += bytes.len();
+        Ok(())
+    }
+
+    fn pad(&mut self, count: usize) -> Result<(), CdrError> {
+        self.position += count;
+        Ok(())
+    }
+}
+
+struct SliceWriter<'a> {
+    buffer: &'a mut [MaybeUninit<u8>],
+    position: usize,
+}
+
+impl SliceWriter<'_> {
+    fn acquire(&mut self, count: usize) -> Result<&mut [MaybeUninit<u8>], CdrError> {
+        if self.buffer.len() - self.position < count {
+            return Err(CdrError::InsufficientBufferSize);
+        }
+
+        let start = self.position;
+        self.position += count;
+        Ok(&mut self.buffer[start..self.position])
+    }
+}
+
+impl Output for SliceWriter<'_> {
+    fn position(&self) -> usize {
+        self.position
+    }
+
+    fn write(&mut self, bytes: &[u8]) -> Result<(), CdrError> {
+        for (destination, byte) in self.acquire(bytes.len())?.iter_mut().zip(bytes) {
+            destination.write(*byte);
+        }
+        Ok(())
+    }
+
+    fn pad(&mut self, count: usize) -> Result<(), CdrError> {
+        self.acquire(count)?.fill(MaybeUninit::new(0));
+        Ok(())
+    }
+}
+
+struct Serializer<O: Output> {
+    output: O,
+}
+
+impl<O: Output> Serializer<O> {
+    fn align(&mut self, alignment: usize) -> Result<(), CdrError> {
+        let misalignment = self.output.position() % alignment;
+        if misalignment != 0 {
+            self.output.pad(alignment - misalignment)?;
+        }
+        Ok(())
+    }
+
+    fn write_length(&mut self, len: usize) -> Result<(), CdrError> {
+        let len = u32::try_from(len).map_err(|_| CdrError::LengthExceedsLimit)?;
+        serde::Serializer::serialize_u32(self, len)
+    }
+}
+
+macro_rules! serialize_primitive {
+    ($method:ident, $type:ty) => {
+        fn $method(self, v: $type) -> Result<(), CdrError> {
+            self.align(core::mem::size_of::<$type>())?;
+            self.output.write(&v.to_le_bytes())
+        }
+    };
+}
+
+impl<O: Output> serde::Serializer for &mut Serializer<O> {
+    type Ok = ();
+    type Error = CdrError;
+    type SerializeSeq = Self;
+    type SerializeTuple = Self;
+    type SerializeTupleStruct = Self;
+    type SerializeTupleVariant = Self;
+    type SerializeMap = Self;
+    type SerializeStruct = Self;
+    type SerializeStructVariant = Self;
+
+    serialize_primitive!(serialize_i8, i8);
+    serialize_primitive!(serialize_i16, i16);
+    serialize_primitive!(serialize_i32, i32);
+    serialize_primitive!(serialize_i64, i64);
+    serialize_primitive!(serialize_u8, u8);
+    serialize_primitive!(serialize_u16, u16);
+    serialize_primitive!(serialize_u32, u32);
+    serialize_primitive!(serialize_u64, u64);
+    serialize_primitive!(serialize_f32, f32);
+    serialize_primitive!(serialize_f64, f64);
+
+    fn serialize_bool(self, v: bool) -> Result<(), CdrError> {
+        self.serialize_u8(v as u8)
+    }
+
+    fn serialize_char(self, v: char) -> Result<(), CdrError> {
+        // a CDR char is a single byte
+        if !v.is_ascii() {
+            return Err(CdrError::UnsupportedType);
+        }
+        self.serialize_u8(v as u8)
+    }
+
+    fn serialize_str(self, v: &str) -> Result<(), CdrError> {
+        // the length includes the null terminator
+        self.write_length(v.len() + 1)?;
+        self.output.write(v.as_bytes())?;
+        self.output.write(&[0])
+    }
+
+    fn serialize_bytes(self, v: &[u8]) -> Result<(), CdrError> {
+        self.write_length(v.len())?;
+        self.output.write(v)
+    }
+
+    fn serialize_none(self) -> Result<(), CdrError> {
+        Err(CdrError::UnsupportedType)
+    }
+
+    fn serialize_some<T: ?Sized + serde::Serialize>(self, _value: &T) -> Result<(), CdrError> {
+        Err(CdrError::UnsupportedType)
+    }
+
+    fn serialize_unit(self) -> Result<(), CdrError> {
+        Ok(())
+    }
+
+    fn serialize_unit_struct(self, _name: &'static str) -> Result<(), CdrError> {
+        Ok(())
+    }
+
+    fn serialize_unit_variant(
+        self,
+        _name: &'static str,
+        variant_index: u32,
+        _variant: &'static str,
+    ) -> Result<(), CdrError> {
+        self.serialize_u32(variant_index)
+    }
+
+    fn serialize_newtype_struct<T: ?Sized + serde::Serialize>(
+        self,
+        _name: &'static str,
+        value: &T,
+    ) -> Result<(), CdrError> {
+        value.serialize(self)
+    }
+
+    fn serialize_newtype_variant<T: ?Sized + serde::Serialize>(
+        self,
+        _name: &'static str,
+        variant_index: u32,
+        _variant: &'static str,
+        value: &T,
+    ) -> Result<(), CdrError> {
+        self.serialize_u32(variant_index)?;
+        value.serialize(self)
+    }
+
+    fn serialize_seq(self, len: Option<usize>) -> Result<Self, CdrError> {
+        self.write_length(len.ok_or(CdrError::UnknownSequenceLength)?)?;
+        Ok(self)
+    }
+
+    fn serialize_tuple(self, _len: usize) -> Result<Self, CdrError> {
+        Ok(self)
+    }
+
+    fn serialize_tuple_struct(self, _name: &'static str, _len: usize) -> Result<Self, CdrError> {
+        Ok(self)
+    }
+
+    fn serialize_tuple_variant(
+        self,
+        _name: &'static str,
+        variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self, CdrError> {
+        self.serialize_u32(variant_index)?;
+        Ok(self)
+    }
+
+    fn serialize_map(self, len: Option<usize>) -> Result<Self, CdrError> {
+        self.write_length(len.ok_or(CdrError::UnknownSequenceLength)?)?;
+        Ok(self)
+    }
+
+    fn serialize_struct(self, _name: &'static str, _len: usize) -> Result<Self, CdrError> {
+        Ok(self)
+    }
+
+    fn serialize_struct_variant(
+        self,
+        _name: &'static str,
+        variant_index: u32,
+        _variant: &'static str,
+        _len: usize,
+    ) -> Result<Self, CdrError> {
+        self.serialize_u32(variant_index)?;
+        Ok(self)
+    }
+
+    fn is_human_readable(&self) -> bool {
+        false
+    }
+}
+
+macro_rules! serialize_compound {
+    ($trait:ident, $method:ident) => {
+        impl<O: Output> serde::ser::$trait for &mut Serializer<O> {
+            type Ok = ();
+            type Error = CdrError;
+
+            fn $method<T: ?Sized + serde::Serialize>(&mut self, value: &T) -> Result<(), CdrError> {
+                value.serialize(&mut **self)
+            }
+
+            fn end(self) -> Result<(), CdrError> {
+                Ok(())
+            }
+        }
+    };
+}
+
+serialize_compound!(SerializeSeq, serialize_element);
+serialize_compound!(SerializeTuple, serialize_element);
+serialize_compound!(SerializeTupleStruct, serialize_field);
+serialize_compound!(SerializeTupleVariant, serialize_field);
+
+impl<O: Output> serde::ser::SerializeMap for &mut Serializer<O> {
+    type Ok = ();
+    type Error = CdrError;
+
+    fn serialize_key<T: ?Sized + serde::Serialize>(&mut self, key: &T) -> Result<(), CdrError> {
+        key.serialize(&mut **self)
+    }
+
+    fn serialize_value<T: ?Sized + serde::Serialize>(&mut self, value: &T) -> Result<(), CdrError> {
+        value.serialize(&mut **self)
+    }
+
+    fn end(self) -> Result<(), CdrError> {
+        Ok(())
+    }
+}
+
+impl<O: Output> serde::ser::SerializeStruct for &mut Serializer<O> {
+    type Ok = ();
+    type Error = CdrError;
+
+    fn serialize_field<T: ?Sized + serde::Serialize>(
+        &mut self,
+        _key: &'static str,
+        value: &T,
+    ) -> Result<(), CdrError> {
+        value.serialize(&mut **self)
+    }
+
+    fn end(self) -> Result<(), CdrError> {
+        Ok(())
+    }
+}
+
+impl<O: Output> serde::ser::SerializeStructVariant for &mut Serializer<O> {
+    type Ok = ();
+    type Error = CdrError;
+
+    fn serialize_field<T: ?Sized + serde::Serialize>(
+        &mut self,
+        _key: &'static str,
+        value: &T,
+    ) -> Result<(), CdrError> {
+        value.serialize(&mut **self)
+    }
+
+    fn end(self) -> Result<(), CdrError> {
+        Ok(())
+    }
+}
+
+struct Deserializer<'de> {
+    input: &'de [u8],
+    position: usize,
+    is_big_endian: bool,
+}
+
+impl<'de> Deserializer<'de> {
+    fn read(&mut self, count: usize) -> Result<&'de [u8], CdrError> {
+        if self.input.len() - self.position < count {
+            return Err(CdrError::UnexpectedEndOfInput);
+        }
+
+        let start = self.position;
+        self.position += count;
+        Ok(&self.input[start..self.position])
+    }
+
+    fn align(&mut self, alignment: usize) -> Result<(), CdrError> {
+        let misalignment = self.position % alignment;
+        if misalignment != 0 {
+            self.read(alignment - misalignment)?;
+        }
+        Ok(())
+    }
+
+    fn read_length(&mut self) -> Result<usize, CdrError> {
+        Ok(self.read_u32()? as usize)
+    }
+}
+
+macro_rules! read_primitive {
+    ($method:ident, $type:ty) => {
+        fn $method(&mut self) -> Result<$type, CdrError> {
+            const SIZE: usize = core::mem::size_of::<$type>();
+            self.align(SIZE)?;
+            let mut bytes = [0u8; SIZE];
+            bytes.copy_from_slice(self.read(SIZE)?);
+            if self.is_big_endian {
+                Ok(<$type>::from_be_bytes(bytes))
+            } else {
+                Ok(<$type>::from_le_bytes(bytes))
+            }
+        }
+    };
+}
+
+impl Deserializer<'_> {
+    read_primitive!(read_i8, i8);
+    read_primitive!(read_i16, i16);
+    read_primitive!(read_i32, i32);
+    read_primitive!(read_i64, i64);
+    read_primitive!(read_u8, u8);
+    read_primitive!(read_u16, u16);
+    read_primitive!(read_u32, u32);
+    read_primitive!(read_u64, u64);
+    read_primitive!(read_f32, f32);
+    read_primitive!(read_f64, f64);
+}
+
+macro_rules! deserialize_primitive {
+    ($method:ident, $read:ident, $visit:ident) => {
+        fn $method<V: serde::de::Visitor<'de>>(self, visitor: V) -> Result<V::Value, CdrError> {
+            visitor.$visit(self.$read()?)
+        }
+    };
+}
+
+impl<'de> serde::Deserializer<'de> for &mut Deserializer<'de> {
+    type Error = CdrError;
+
+    deserialize_primitive!(deserialize_i8, read_i8, visit_i8);
+    deserialize_primitive!(deserialize_i16, read_i16, visit_i16);
+    deserialize_primitive!(deserialize_i32, read_i32, visit_i32);
+    deserialize_primitive!(deserialize_i64, read_i64, visit_i64);
+    deserialize_primitive!(deserialize_u8, read_u8, visit_u8);
+    deserialize_primitive!(deserialize_u16, read_u16, visit_u16);
+    deserialize_primitive!(deserialize_u32, read_u32, visit_u32);
+    deserialize_primitive!(deserialize_u64, read_u64, visit_u64);
+    deserialize_primitive!(deserialize_f32, read_f32, visit_f32);
+    deserialize_primitive!(deserialize_f64, read_f64, visit_f64);
+    deserialize_primitive!(deserialize_identifier, read_u32, visit_u32);
+
+    fn deserialize_any<V: serde::de::Visitor<'de>>(
+        self,
+        _visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        // CDR is not self-describing
+        Err(CdrError::UnsupportedType)
+    }
+
+    fn deserialize_ignored_any<V: serde::de::Visitor<'de>>(
+        self,
+        _visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        Err(CdrError::UnsupportedType)
+    }
+
+    fn deserialize_bool<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        match self.read_u8()? {
+            0 => visitor.visit_bool(false),
+            1 => visitor.visit_bool(true),
+            _ => Err(CdrError::InvalidValue),
+        }
+    }
+
+    fn deserialize_char<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        let value = self.read_u8()?;
+        if !value.is_ascii() {
+            return Err(CdrError::InvalidValue);
+        }
+        visitor.visit_char(value as char)
+    }
+
+    fn deserialize_str<V: serde::de::Visitor<'de>>(self, visitor: V) -> Result<V::Value, CdrError> {
+        let len = self.read_length()?;
+        let bytes = match self.read(len)?.split_last() {
+            Some((0, bytes)) => bytes,
+            _ => return Err(CdrError::InvalidValue),
+        };
+        visitor.visit_borrowed_str(core::str::from_utf8(bytes).map_err(|_| CdrError::InvalidValue)?)
+    }
+
+    fn deserialize_string<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        self.deserialize_str(visitor)
+    }
+
+    fn deserialize_bytes<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        let len = self.read_length()?;
+        visitor.visit_borrowed_bytes(self.read(len)?)
+    }
+
+    fn deserialize_byte_buf<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        self.deserialize_bytes(visitor)
+    }
+
+    fn deserialize_option<V: serde::de::Visitor<'de>>(
+        self,
+        _visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        Err(CdrError::UnsupportedType)
+    }
+
+    fn deserialize_unit<V: serde::de::Visitor<'de>>(
+        self,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        visitor.visit_unit()
+    }
+
+    fn deserialize_unit_struct<V: serde::de::Visitor<'de>>(
+        self,
+        _name: &'static str,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        visitor.visit_unit()
+    }
+
+    fn deserialize_newtype_struct<V: serde::de::Visitor<'de>>(
+        self,
+        _name: &'static str,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        visitor.visit_newtype_struct(self)
+    }
+
+    fn deserialize_seq<V: serde::de::Visitor<'de>>(self, visitor: V) -> Result<V::Value, CdrError> {
+        let len = self.read_length()?;
+        visitor.visit_seq(Elements {
+            deserializer: self,
+            remaining: len,
+        })
+    }
+
+    fn deserialize_tuple<V: serde::de::Visitor<'de>>(
+        self,
+        len: usize,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        visitor.visit_seq(Elements {
+            deserializer: self,
+            remaining: len,
+        })
+    }
+
+    fn deserialize_tuple_struct<V: serde::de::Visitor<'de>>(
+        self,
+        _name: &'static str,
+        len: usize,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        self.deserialize_tuple(len, visitor)
+    }
+
+    fn deserialize_map<V: serde::de::Visitor<'de>>(self, visitor: V) -> Result<V::Value, CdrError> {
+        let len = self.read_length()?;
+        visitor.visit_map(Elements {
+            deserializer: self,
+            remaining: len,
+        })
+    }
+
+    fn deserialize_struct<V: serde::de::Visitor<'de>>(
+        self,
+        _name: &'static str,
+        fields: &'static [&'static str],
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        self.deserialize_tuple(fields.len(), visitor)
+    }
+
+    fn deserialize_enum<V: serde::de::Visitor<'de>>(
+        self,
+        _name: &'static str,
+        _variants: &'static [&'static str],
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        visitor.visit_enum(self)
+    }
+
+    fn is_human_readable(&self) -> bool {
+        false
+    }
+}
+
+/// Provides the elements of sequences, tuples, structs and maps.
+struct Elements<'a, 'de> {
+    deserializer: &'a mut Deserializer<'de>,
+    remaining: usize,
+}
+
+impl<'de> serde::de::SeqAccess<'de> for Elements<'_, 'de> {
+    type Error = CdrError;
+
+    fn next_element_seed<T: serde::de::DeserializeSeed<'de>>(
+        &mut self,
+        seed: T,
+    ) -> Result<Option<T::Value>, CdrError> {
+        if self.remaining == 0 {
+            return Ok(None);
+        }
+
+        self.remaining -= 1;
+        seed.deserialize(&mut *self.deserializer).map(Some)
+    }
+
+    fn size_hint(&self) -> Option<usize> {
+        Some(self.remaining)
+    }
+}
+
+impl<'de> serde::de::MapAccess<'de> for Elements<'_, 'de> {
+    type Error = CdrError;
+
+    fn next_key_seed<K: serde::de::DeserializeSeed<'de>>(
+        &mut self,
+        seed: K,
+    ) -> Result<Option<K::Value>, CdrError> {
+        if self.remaining == 0 {
+            return Ok(None);
+        }
+
+        self.remaining -= 1;
+        seed.deserialize(&mut *self.deserializer).map(Some)
+    }
+
+    fn next_value_seed<V: serde::de::DeserializeSeed<'de>>(
+        &mut self,
+        seed: V,
+    ) -> Result<V::Value, CdrError> {
+        seed.deserialize(&mut *self.deserializer)
+    }
+
+    fn size_hint(&self) -> Option<usize> {
+        Some(self.remaining)
+    }
+}
+
+impl<'de> serde::de::EnumAccess<'de> for &mut Deserializer<'de> {
+    type Error = CdrError;
+    type Variant = Self;
+
+    fn variant_seed<V: serde::de::DeserializeSeed<'de>>(
+        self,
+        seed: V,
+    ) -> Result<(V::Value, Self), CdrError> {
+        let variant_index = self.read_u32()?;
+        let value = seed.deserialize(variant_index.into_deserializer())?;
+        Ok((value, self))
+    }
+}
+
+impl<'de> serde::de::VariantAccess<'de> for &mut Deserializer<'de> {
+    type Error = CdrError;
+
+    fn unit_variant(self) -> Result<(), CdrError> {
+        Ok(())
+    }
+
+    fn newtype_variant_seed<T: serde::de::DeserializeSeed<'de>>(
+        self,
+        seed: T,
+    ) -> Result<T::Value, CdrError> {
+        seed.deserialize(self)
+    }
+
+    fn tuple_variant<V: serde::de::Visitor<'de>>(
+        self,
+        len: usize,
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        serde::Deserializer::deserialize_tuple(self, len, visitor)
+    }
+
+    fn struct_variant<V: serde::de::Visitor<'de>>(
+        self,
+        fields: &'static [&'static str],
+        visitor: V,
+    ) -> Result<V::Value, CdrError> {
+        serde::Deserializer::deserialize_tuple(self, fields.len(), visitor)
+    }
+}
+
 #[derive(Debug)]
 /// cdr [`Serialize`]
 pub struct Cdr {}
 
+impl Cdr {
+    /// Returns the exact number of bytes, including the encapsulation header, that
+    /// [`Cdr::serialize_into()`] writes for the given value.
+    pub fn serialized_size<T: serde::Serialize>(value: &T) -> Result<usize, SerializeError> {
+        let mut serializer = Serializer {
+            output: SizeCounter { position: 0 },
+        };
+
+        fail!(from "Cdr::serialized_size", when value.serialize(&mut serializer),
+            with SerializeError::InternalError,
+            "Failed to compute the serialized size of the object.");
+
+        Ok(ENCAPSULATION_HEADER_SIZE + serializer.output.position)
+    }
+
+    /// Serializes the value directly into the provided buffer, without any intermediate
+    /// allocation, and returns the number of bytes written. The buffer must provide at least
+    /// [`Cdr::serialized_size()`] bytes; on success, the first returned number of bytes are
+    /// initialized.
+    pub fn serialize_into<T: serde::Serialize>(
+        value: &T,
+        buffer: &mut [MaybeUninit<u8>],
+    ) -> Result<usize, SerializeError> {
+        let msg = "Failed to serialize object";
+        if buffer.len() < ENCAPSULATION_HEADER_SIZE {
+            fail!(from "Cdr::serialize_into", with SerializeError::InternalError,
+                "{msg} since the buffer cannot hold the encapsulation header.");
+        }
+
+        let (header, data) = buffer.split_at_mut(ENCAPSULATION_HEADER_SIZE);
+        for (destination, byte) in header.iter_mut().zip(CDR_LE) {
+            destination.write(byte);
+        }
+
+        let mut serializer = Serializer {
+            output: SliceWriter {
+                buffer: data,
+                position: 0,
+            },
+        };
+
+        if let Err(e) = value.serialize(&mut serializer) {
+            fail!(from "Cdr::serialize_into", with SerializeError::InternalError,
+                "{msg} ({e}).");
+        }
+
+        Ok(ENCAPSULATION_HEADER_SIZE + serializer.output.position)
+    }
+}
+
 impl Serialize for Cdr {
     fn serialize<T: serde::Serialize>(value: &T) -> Result<Vec<u8>, SerializeError> {
-        Ok(
-            fail!(from "Cdr::serialize", when cdr::serialize::<_, _, CdrBe>(&value, Infinite),
-                with SerializeError::InternalError, "Failed to serialize object" ),
-        )
+        let size = Self::serialized_size(value)?;
+        let mut bytes = Vec::with_capacity(size);
+        let written = Self::serialize_into(value, bytes.spare_capacity_mut())?;
+
+        // SAFETY: serialize_into() initialized the first `written` bytes
+        unsafe { bytes.set_len(written) };
+        Ok(bytes)
     }
 
     fn deserialize<T: serde::de::DeserializeOwned>(bytes: &[u8]) -> Result<T, DeserializeError> {
-        Ok(
-            fail!(from "Cdr::deserialize", when cdr::deserialize::<T>(bytes),
-                    with DeserializeError::InternalError, "Failed to deserialize object."),
-        )
+        let msg = "Failed to deserialize object";
+        let is_big_endian = match bytes.get(..ENCAPSULATION_HEADER_SIZE) {
+            Some(header) if header == CDR_BE => true,
+            Some(header) if header == CDR_LE => false,
+            _ => {
+                fail!(from "Cdr::deserialize", with DeserializeError::InternalError,
+                    "{msg} ({}).", CdrError::InvalidEncapsulation);
+            }
+        };
+
+        let mut deserializer = Deserializer {
+            input: &bytes[ENCAPSULATION_HEADER_SIZE..],
+            position: 0,
+            is_big_endian,
+        };
+
+        match T::deserialize(&mut deserializer) {
+            Ok(value) => Ok(value),
+            Err(e) => {
+                fail!(from "Cdr::deserialize", with DeserializeError::InternalError,
+                    "{msg} ({e}).");
+            }
+        }
     }
 }
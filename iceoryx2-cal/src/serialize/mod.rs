@@ -37,6 +37,7 @@
 //! }
 //! ```
 
+pub mod cdr;
 pub mod postcard;
 pub mod recommended;
 
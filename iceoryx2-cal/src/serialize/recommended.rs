@@ -12,9 +12,7 @@
 
 /// Provides the recommended
 /// [`Serialize`](crate::serialize::Serialize) concept implementation
-/// for the target.
-#[cfg(feature = "std")]
-pub type Recommended = crate::serialize::toml::Toml;
-
-#[cfg(not(feature = "std"))]
+/// for the target. The compact binary postcard format is used on all targets
+/// since it is decoded without a parse step, [`Toml`](crate::serialize::toml::Toml)
+/// remains available for human readable configurations.
 pub type Recommended = crate::serialize::postcard::Postcard;
@@ -144,6 +144,11 @@ pub mod details {
     > {
         name: FileName,
         size: usize,
+        page_size: PageSize,
+        numa_policy: NumaPolicy,
+        typed_memory: Option<FilePath>,
+        prefault: bool,
+        lock_in_memory: bool,
         config: Configuration<Allocator, Storage>,
         timeout: Duration,
         has_ownership: bool,
@@ -157,6 +162,11 @@ pub mod details {
                 name: *name,
                 config: Configuration::default(),
                 size: 0,
+                page_size: PageSize::Regular,
+                numa_policy: NumaPolicy::Default,
+                typed_memory: None,
+                prefault: false,
+                lock_in_memory: false,
                 timeout: Duration::ZERO,
                 has_ownership: true,
             }
@@ -228,6 +238,31 @@ pub mod details {
             self
         }
 
+        fn page_size(mut self, value: PageSize) -> Self {
+            self.page_size = value;
+            self
+        }
+
+        fn numa_policy(mut self, value: NumaPolicy) -> Self {
+            self.numa_policy = value;
+            self
+        }
+
+        fn typed_memory(mut self, value: Option<FilePath>) -> Self {
+            self.typed_memory = value;
+            self
+        }
+
+        fn prefault(mut self, value: bool) -> Self {
+            self.prefault = value;
+            self
+        }
+
+        fn lock_in_memory(mut self, value: bool) -> Self {
+            self.lock_in_memory = value;
+            self
+        }
+
         fn timeout(mut self, value: Duration) -> Self {
             self.timeout = value;
             self
@@ -249,6 +284,11 @@ pub mod details {
             let storage = match Storage::Builder::new(&self.name)
                 .config(&self.config.dynamic_storage_config)
                 .supplementary_size(self.size + allocator_mgmt_size)
+                .use_huge_pages(self.page_size == PageSize::Huge)
+                .numa_policy(self.numa_policy)
+                .typed_memory(self.typed_memory)
+                .prefault(self.prefault)
+                .lock_in_memory(self.lock_in_memory)
                 .has_ownership(self.has_ownership)
                 .initializer(|details, init_allocator| -> bool {
                     self.initialize(
@@ -12,6 +12,9 @@
 
 use super::common::details::AllocatorDetails;
 
+/// [`SharedMemory`](crate::shared_memory::SharedMemory) that is backed by a file. When its
+/// path hint points to a DAX or persistent memory mount, the payload is mapped directly from
+/// that device.
 pub type Memory<Allocator> = crate::shared_memory::common::details::Memory<
     Allocator,
     crate::dynamic_storage::file::Storage<AllocatorDetails<Allocator>>,
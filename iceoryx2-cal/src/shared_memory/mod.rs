@@ -68,8 +68,23 @@ pub use crate::shm_allocator::*;
 use crate::static_storage::file::{NamedConcept, NamedConceptBuilder, NamedConceptMgmt};
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_posix::file::AccessMode;
+pub use iceoryx2_bb_posix::numa::NumaPolicy;
 use iceoryx2_bb_system_types::file_name::*;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use pool_allocator::PoolAllocator;
+use serde::{Deserialize, Serialize};
+
+/// Defines the size of the pages that back a [`SharedMemory`]. Larger pages reduce the number of
+/// TLB misses when large segments are accessed.
+#[derive(Clone, Copy, Eq, PartialEq, Debug, Default, Serialize, Deserialize)]
+pub enum PageSize {
+    /// The regular page size of the system.
+    #[default]
+    Regular,
+    /// Requests huge pages from the operating system. When huge pages are not available the
+    /// [`SharedMemory`] falls back to [`PageSize::Regular`].
+    Huge,
+}
 
 /// Failure returned by [`SharedMemoryBuilder::create()`]
 #[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
@@ -139,6 +154,27 @@ pub trait SharedMemoryBuilder<Allocator: ShmAllocator, Shm: SharedMemory<Allocat
     /// space.
     fn size(self, value: usize) -> Self;
 
+    /// Sets the [`PageSize`] of the [`SharedMemory`]. Only relevant when the [`SharedMemory`] is
+    /// created. The default is [`PageSize::Regular`].
+    fn page_size(self, value: PageSize) -> Self;
+
+    /// Sets the [`NumaPolicy`] of the [`SharedMemory`]. Only relevant when the [`SharedMemory`]
+    /// is created. The default is [`NumaPolicy::Default`].
+    fn numa_policy(self, value: NumaPolicy) -> Self;
+
+    /// Allocates the [`SharedMemory`] from the provided typed memory pool. Only relevant when
+    /// the [`SharedMemory`] is created. The default is [`None`], the general purpose memory.
+    fn typed_memory(self, value: Option<FilePath>) -> Self;
+
+    /// Touches every page of the [`SharedMemory`] during creation so that no page fault occurs
+    /// on the first access. Only relevant when the [`SharedMemory`] is created. The default is
+    /// [`false`].
+    fn prefault(self, value: bool) -> Self;
+
+    /// Locks the pages of the [`SharedMemory`] into memory so that they cannot be swapped out.
+    /// Only relevant when the [`SharedMemory`] is created. The default is [`false`].
+    fn lock_in_memory(self, value: bool) -> Self;
+
     /// The timeout defines how long the [`SharedMemoryBuilder`] should wait for
     /// [`SharedMemoryBuilder::create()`] to finialize
     /// the initialization. This is required when the [`SharedMemory`] is created and initialized
@@ -0,0 +1,247 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A **lock-free** frame arena. Every allocation, independent of its size, is a single atomic
+//! pointer bump and no memory is lost to fixed-size buckets. The arena is reset as soon as the
+//! last live chunk is deallocated, so a producer that allocates many variable-sized chunks per
+//! frame and gets all of them back at the end of the frame starts every frame with the full
+//! memory.
+//!
+//! In contrast to the [`crate::shm_allocator::shm_bump_allocator::BumpAllocator`], a
+//! deallocation does not release all chunks at once; the memory is only reused when no chunk is
+//! in use anymore.
+
+use core::sync::atomic::Ordering;
+
+use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_elementary::math::align;
+
+use crate::shm_allocator::*;
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_log::fail;
+
+// The state consists of the used memory in the lower bits and the number of live chunks in the
+// upper bits so that both can be changed together with a single compare exchange.
+const USED_SPACE_BITS: u32 = 48;
+const USED_SPACE_MASK: u64 = (1 << USED_SPACE_BITS) - 1;
+const MAX_NUMBER_OF_LIVE_CHUNKS: u64 = (1 << (u64::BITS - USED_SPACE_BITS)) - 1;
+
+const fn used_space(state: u64) -> usize {
+    (state & USED_SPACE_MASK) as usize
+}
+
+const fn number_of_live_chunks(state: u64) -> u64 {
+    state >> USED_SPACE_BITS
+}
+
+const fn to_state(used_space: usize, number_of_live_chunks: u64) -> u64 {
+    (number_of_live_chunks << USED_SPACE_BITS) | used_space as u64
+}
+
+#[derive(Default, Clone, Copy, Debug)]
+pub struct Config {}
+
+impl ShmAllocatorConfig for Config {}
+
+#[derive(Debug, ZeroCopySend)]
+#[repr(C)]
+pub struct ArenaAllocator {
+    state: AtomicU64,
+    base_address: usize,
+    total_space: usize,
+    max_supported_alignment_by_memory: usize,
+}
+
+impl ArenaAllocator {
+    /// Returns the size of the managed memory.
+    pub fn total_space(&self) -> usize {
+        self.total_space
+    }
+
+    /// Returns the memory that is used by the current frame, including the alignment padding.
+    pub fn used_space(&self) -> usize {
+        used_space(self.state.load(Ordering::Relaxed))
+    }
+
+    /// Returns the memory that is still available in the current frame.
+    pub fn free_space(&self) -> usize {
+        self.total_space - self.used_space()
+    }
+
+    /// Returns the number of chunks that were allocated and not yet deallocated. When it drops
+    /// to zero the arena is reset.
+    pub fn number_of_live_chunks(&self) -> usize {
+        number_of_live_chunks(self.state.load(Ordering::Relaxed)) as usize
+    }
+}
+
+impl ShmAllocator for ArenaAllocator {
+    type Configuration = Config;
+
+    fn resize_hint(
+        &self,
+        layout: Layout,
+        strategy: AllocationStrategy,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        if layout.size() < self.free_space() {
+            return SharedMemorySetupHint {
+                payload_size: self.total_space,
+                config: Self::Configuration::default(),
+            };
+        }
+
+        let payload_size = match strategy {
+            AllocationStrategy::BestFit => self.total_space + layout.size(),
+            AllocationStrategy::PowerOfTwo | AllocationStrategy::SizeClasses => {
+                (self.total_space + layout.size()).next_power_of_two()
+            }
+            AllocationStrategy::Static => self.total_space,
+        };
+
+        SharedMemorySetupHint {
+            payload_size,
+            config: Self::Configuration::default(),
+        }
+    }
+
+    fn initial_setup_hint(
+        max_chunk_layout: Layout,
+        max_number_of_chunks: usize,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        SharedMemorySetupHint {
+            config: Self::Configuration::default(),
+            payload_size: align(max_chunk_layout.size(), max_chunk_layout.align())
+                * max_number_of_chunks,
+        }
+    }
+
+    fn management_size(_memory_size: usize, _config: &Self::Configuration) -> usize {
+        0
+    }
+
+    fn relative_start_address(&self) -> usize {
+        0
+    }
+
+    unsafe fn new_uninit(
+        max_supported_alignment_by_memory: usize,
+        managed_memory: NonNull<[u8]>,
+        _config: &Self::Configuration,
+    ) -> Self {
+        Self {
+            state: AtomicU64::new(0),
+            base_address: (managed_memory.as_ptr() as *mut u8) as usize,
+            total_space: managed_memory.len(),
+            max_supported_alignment_by_memory,
+        }
+    }
+
+    fn max_alignment(&self) -> usize {
+        8
+    }
+
+    unsafe fn init<Allocator: BaseAllocator>(
+        &mut self,
+        _mgmt_allocator: &Allocator,
+    ) -> Result<(), ShmAllocatorInitError> {
+        let msg = "Unable to initialize allocator";
+        if self.max_supported_alignment_by_memory < self.max_alignment() {
+            fail!(from self, with ShmAllocatorInitError::MaxSupportedMemoryAlignmentInsufficient,
+                "{} since the required alignment {} exceeds the maximum supported alignment {} of the memory.",
+                msg, self.max_alignment(), self.max_supported_alignment_by_memory);
+        }
+
+        if self.total_space as u64 > USED_SPACE_MASK {
+            fail!(from self, with ShmAllocatorInitError::AllocationFailed,
+                "{} since the memory size {} exceeds the maximum supported size of {}.",
+                msg, self.total_space, USED_SPACE_MASK);
+        }
+
+        Ok(())
+    }
+
+    fn unique_id() -> u8 {
+        2
+    }
+
+    unsafe fn allocate(&self, layout: Layout) -> Result<PointerOffset, ShmAllocationError> {
+        let msg = "Unable to allocate memory";
+        if layout.align() > self.max_alignment() {
+            fail!(from self, with ShmAllocationError::ExceedsMaxSupportedAlignment,
+                "{} since an alignment of {} exceeds the maximum supported alignment of {}.",
+                msg, layout.align(), self.max_alignment());
+        }
+
+        if layout.size() == 0 {
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::SizeIsZero),
+                "{} {:?} since the requested size was zero.", msg, layout);
+        }
+
+        let mut current_state = self.state.load(Ordering::Relaxed);
+        loop {
+            let live_chunks = number_of_live_chunks(current_state);
+            if live_chunks == MAX_NUMBER_OF_LIVE_CHUNKS {
+                fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                    "{} {:?} since the maximum number of {} live chunks is reached.",
+                    msg, layout, MAX_NUMBER_OF_LIVE_CHUNKS);
+            }
+
+            let chunk_start = align(
+                self.base_address + used_space(current_state),
+                layout.align(),
+            ) - self.base_address;
+            if chunk_start + layout.size() > self.total_space {
+                fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                    "{} {:?} since there is not enough memory left in the current frame.", msg, layout);
+            }
+
+            match self.state.compare_exchange_weak(
+                current_state,
+                to_state(chunk_start + layout.size(), live_chunks + 1),
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => return Ok(PointerOffset::new(chunk_start)),
+                Err(v) => current_state = v,
+            }
+        }
+    }
+
+    unsafe fn deallocate(&self, _offset: PointerOffset, _layout: Layout) {
+        let mut current_state = self.state.load(Ordering::Relaxed);
+        loop {
+            let live_chunks = number_of_live_chunks(current_state);
+            debug_assert!(
+                live_chunks > 0,
+                "This should never happen! A chunk was deallocated that was never allocated."
+            );
+
+            // the last live chunk ends the frame, the whole memory can be reused
+            let new_state = if live_chunks <= 1 {
+                0
+            } else {
+                to_state(used_space(current_state), live_chunks - 1)
+            };
+
+            match self.state.compare_exchange_weak(
+                current_state,
+                new_state,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            ) {
+                Ok(_) => return,
+                Err(v) => current_state = v,
+            }
+        }
+    }
+}
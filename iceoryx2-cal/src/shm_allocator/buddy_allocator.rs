@@ -0,0 +1,378 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A **lock-free** buddy allocator for chunks of highly variable size. The memory is divided
+//! into blocks of [`Config::block_size`]. An allocation acquires the next power of two number
+//! of blocks, aligned to its own size, so that it always occupies exactly one buddy. Every
+//! block is represented by a single bit in a bitmap, therefore splitting and merging of buddies
+//! happens implicitly when the bits are set or cleared with an atomic operation.
+//!
+//! In contrast to the [`crate::shm_allocator::pool_allocator::PoolAllocator`], small chunks do
+//! not occupy a bucket of the size of the largest chunk.
+
+use core::{alloc::Layout, ptr::NonNull};
+
+use iceoryx2_bb_concurrency::atomic::Ordering;
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, AtomicUsize};
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary::math::{align, unaligned_mem_size};
+use iceoryx2_bb_elementary::relocatable_ptr::RelocatablePointer;
+use iceoryx2_bb_elementary_traits::allocator::{AllocationError, BaseAllocator};
+use iceoryx2_bb_elementary_traits::pointer_trait::PointerTrait;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_log::fail;
+
+use super::{
+    AllocationStrategy, PointerOffset, SharedMemorySetupHint, ShmAllocationError, ShmAllocator,
+    ShmAllocatorConfig, ShmAllocatorInitError,
+};
+
+const BITS_PER_WORD: usize = u64::BITS as usize;
+const MIN_BLOCK_SIZE: usize = 8;
+
+#[derive(Clone, Copy, Debug)]
+pub struct Config {
+    /// The size of the smallest allocatable unit. It is rounded up to the next power of two
+    /// and defines the max supported alignment.
+    pub block_size: usize,
+}
+
+impl Default for Config {
+    fn default() -> Self {
+        Self { block_size: 64 }
+    }
+}
+
+impl ShmAllocatorConfig for Config {}
+
+#[derive(Debug, ZeroCopySend)]
+#[repr(C)]
+pub struct BuddyAllocator {
+    blocks: RelocatablePointer<AtomicU64>,
+    number_of_blocks: usize,
+    block_size: usize,
+    // is even with absolut base address relocatable since every process acquire and return
+    // the same relative offset which map then to the same absolut base address
+    base_address: usize,
+    start_address: usize,
+    max_supported_alignment_by_memory: usize,
+    number_of_used_blocks: AtomicUsize,
+}
+
+impl BuddyAllocator {
+    fn adjusted_block_size(config: &Config) -> usize {
+        config.block_size.max(MIN_BLOCK_SIZE).next_power_of_two()
+    }
+
+    fn number_of_words(number_of_blocks: usize) -> usize {
+        number_of_blocks.div_ceil(BITS_PER_WORD)
+    }
+
+    fn word(&self, index: usize) -> &AtomicU64 {
+        unsafe { &*self.blocks.as_ptr().add(index) }
+    }
+
+    fn blocks_for_layout(&self, layout: Layout) -> usize {
+        layout.size().div_ceil(self.block_size).next_power_of_two()
+    }
+
+    /// Returns the size of the smallest allocatable unit.
+    pub fn block_size(&self) -> usize {
+        self.block_size
+    }
+
+    /// Returns the number of blocks the managed memory is divided into.
+    pub fn number_of_blocks(&self) -> usize {
+        self.number_of_blocks
+    }
+
+    /// Returns the number of blocks that are currently allocated.
+    pub fn number_of_used_blocks(&self) -> usize {
+        self.number_of_used_blocks.load(Ordering::Relaxed)
+    }
+
+    // acquires `number_of_blocks` <= 64 blocks which reside always in the same word since
+    // every buddy is aligned to its size
+    fn acquire_blocks_in_word(&self, number_of_blocks: usize) -> Option<usize> {
+        let mask = if number_of_blocks == BITS_PER_WORD {
+            u64::MAX
+        } else {
+            (1u64 << number_of_blocks) - 1
+        };
+
+        for word_index in 0..Self::number_of_words(self.number_of_blocks) {
+            let word = self.word(word_index);
+            let mut current = word.load(Ordering::Relaxed);
+            let mut bit = 0;
+            while bit < BITS_PER_WORD {
+                if current == u64::MAX {
+                    break;
+                }
+
+                let buddy = mask << bit;
+                if current & buddy != 0 {
+                    bit += number_of_blocks;
+                    continue;
+                }
+
+                match word.compare_exchange_weak(
+                    current,
+                    current | buddy,
+                    Ordering::Acquire,
+                    Ordering::Relaxed,
+                ) {
+                    Ok(_) => return Some(word_index * BITS_PER_WORD + bit),
+                    // retry the same buddy with the updated word
+                    Err(v) => current = v,
+                }
+            }
+        }
+
+        None
+    }
+
+    // acquires `number_of_blocks` > 64 blocks, a multiple of whole words, by acquiring every
+    // word of the buddy and releasing them again when one of them is already in use
+    fn acquire_blocks_in_words(&self, number_of_blocks: usize) -> Option<usize> {
+        let words_per_buddy = number_of_blocks / BITS_PER_WORD;
+        let number_of_words = Self::number_of_words(self.number_of_blocks);
+
+        let mut first_word = 0;
+        while first_word + words_per_buddy <= number_of_words {
+            let mut acquired_words = 0;
+            while acquired_words < words_per_buddy
+                && self
+                    .word(first_word + acquired_words)
+                    .compare_exchange(0, u64::MAX, Ordering::Acquire, Ordering::Relaxed)
+                    .is_ok()
+            {
+                acquired_words += 1;
+            }
+
+            if acquired_words == words_per_buddy {
+                return Some(first_word * BITS_PER_WORD);
+            }
+
+            for n in 0..acquired_words {
+                self.word(first_word + n).store(0, Ordering::Relaxed);
+            }
+            first_word += words_per_buddy;
+        }
+
+        None
+    }
+
+    fn release_blocks(&self, first_block: usize, number_of_blocks: usize) {
+        let word_index = first_block / BITS_PER_WORD;
+        if number_of_blocks < BITS_PER_WORD {
+            let buddy = ((1u64 << number_of_blocks) - 1) << (first_block % BITS_PER_WORD);
+            self.word(word_index).fetch_and(!buddy, Ordering::Release);
+        } else {
+            for n in 0..number_of_blocks / BITS_PER_WORD {
+                self.word(word_index + n).store(0, Ordering::Release);
+            }
+        }
+    }
+}
+
+impl ShmAllocator for BuddyAllocator {
+    type Configuration = Config;
+
+    fn resize_hint(
+        &self,
+        layout: Layout,
+        strategy: AllocationStrategy,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        let config = Config {
+            block_size: self.block_size.max(layout.align().next_power_of_two()),
+        };
+        let current_payload_size = self.number_of_blocks * self.block_size;
+        let required_blocks = self.blocks_for_layout(layout);
+
+        if layout.align() <= self.block_size
+            && required_blocks <= self.number_of_blocks - self.number_of_used_blocks()
+        {
+            return SharedMemorySetupHint {
+                payload_size: current_payload_size,
+                config,
+            };
+        }
+
+        let payload_size = match strategy {
+            AllocationStrategy::BestFit => current_payload_size + required_blocks * self.block_size,
+            AllocationStrategy::PowerOfTwo | AllocationStrategy::SizeClasses => {
+                (current_payload_size + required_blocks * self.block_size).next_power_of_two()
+            }
+            AllocationStrategy::Static => current_payload_size,
+        };
+
+        SharedMemorySetupHint {
+            payload_size,
+            config,
+        }
+    }
+
+    fn initial_setup_hint(
+        max_chunk_layout: Layout,
+        max_number_of_chunks: usize,
+    ) -> SharedMemorySetupHint<Self::Configuration> {
+        let config = Config {
+            block_size: Self::adjusted_block_size(&Config::default())
+                .max(max_chunk_layout.align().next_power_of_two()),
+        };
+        let chunk_size = max_chunk_layout
+            .size()
+            .div_ceil(config.block_size)
+            .next_power_of_two()
+            * config.block_size;
+
+        SharedMemorySetupHint {
+            payload_size: chunk_size * max_number_of_chunks,
+            config,
+        }
+    }
+
+    fn management_size(memory_size: usize, config: &Self::Configuration) -> usize {
+        let number_of_blocks = memory_size / Self::adjusted_block_size(config);
+        unaligned_mem_size::<AtomicU64>(Self::number_of_words(number_of_blocks))
+    }
+
+    fn relative_start_address(&self) -> usize {
+        self.start_address - self.base_address
+    }
+
+    unsafe fn new_uninit(
+        max_supported_alignment_by_memory: usize,
+        managed_memory: NonNull<[u8]>,
+        config: &Self::Configuration,
+    ) -> Self {
+        let block_size = Self::adjusted_block_size(config);
+        let base_address = (managed_memory.as_ptr() as *mut u8) as usize;
+        let start_address = align(base_address, block_size);
+        let number_of_blocks =
+            (base_address + managed_memory.len()).saturating_sub(start_address) / block_size;
+
+        Self {
+            blocks: unsafe { RelocatablePointer::new_uninit() },
+            number_of_blocks,
+            block_size,
+            base_address,
+            start_address,
+            max_supported_alignment_by_memory,
+            number_of_used_blocks: AtomicUsize::new(0),
+        }
+    }
+
+    fn max_alignment(&self) -> usize {
+        self.block_size
+    }
+
+    unsafe fn init<Allocator: BaseAllocator>(
+        &mut self,
+        mgmt_allocator: &Allocator,
+    ) -> Result<(), ShmAllocatorInitError> {
+        let msg = "Unable to initialize allocator";
+        if self.max_supported_alignment_by_memory < self.max_alignment() {
+            fail!(from self, with ShmAllocatorInitError::MaxSupportedMemoryAlignmentInsufficient,
+                "{} since the required alignment {} exceeds the maximum supported alignment {} of the memory.",
+                msg, self.max_alignment(), self.max_supported_alignment_by_memory);
+        }
+
+        let number_of_words = Self::number_of_words(self.number_of_blocks);
+        let layout = match Layout::array::<AtomicU64>(number_of_words) {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with ShmAllocatorInitError::AllocationFailed,
+                    "{} since the number of blocks {} would exceed the maximum supported size. [{:?}]",
+                    msg, self.number_of_blocks, e);
+            }
+        };
+
+        let memory = fail!(from self, when mgmt_allocator.allocate(layout),
+            with ShmAllocatorInitError::AllocationFailed,
+            "{} since the allocation of the allocator managment memory failed.", msg);
+
+        unsafe {
+            self.blocks.init(memory);
+            for n in 0..number_of_words {
+                // the bits beyond the last block are marked as used so that they are never
+                // acquired
+                let valid_bits = (self.number_of_blocks - n * BITS_PER_WORD).min(BITS_PER_WORD);
+                let initial_value = if valid_bits == BITS_PER_WORD {
+                    0
+                } else {
+                    u64::MAX << valid_bits
+                };
+                (self.blocks.as_ptr() as *mut AtomicU64)
+                    .add(n)
+                    .write(AtomicU64::new(initial_value));
+            }
+        }
+
+        Ok(())
+    }
+
+    fn unique_id() -> u8 {
+        3
+    }
+
+    unsafe fn allocate(&self, layout: Layout) -> Result<PointerOffset, ShmAllocationError> {
+        let msg = "Unable to allocate memory";
+        if layout.align() > self.max_alignment() {
+            fail!(from self, with ShmAllocationError::ExceedsMaxSupportedAlignment,
+                "{} since an alignment of {} exceeds the maximum supported alignment of {}.",
+                msg, layout.align(), self.max_alignment());
+        }
+
+        if layout.size() == 0 {
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::SizeIsZero),
+                "{} {:?} since the requested size was zero.", msg, layout);
+        }
+
+        let number_of_blocks = self.blocks_for_layout(layout);
+        if number_of_blocks > self.number_of_blocks {
+            fail!(from self, with ShmAllocationError::AllocationError(AllocationError::SizeTooLarge),
+                "{} {:?} since it exceeds the size of the managed memory.", msg, layout);
+        }
+
+        let first_block = if number_of_blocks <= BITS_PER_WORD {
+            self.acquire_blocks_in_word(number_of_blocks)
+        } else {
+            self.acquire_blocks_in_words(number_of_blocks)
+        };
+
+        match first_block {
+            Some(first_block) => {
+                self.number_of_used_blocks
+                    .fetch_add(number_of_blocks, Ordering::Relaxed);
+                Ok(PointerOffset::new(first_block * self.block_size))
+            }
+            None => {
+                fail!(from self, with ShmAllocationError::AllocationError(AllocationError::OutOfMemory),
+                    "{} {:?} since no free buddy of {} blocks is available.", msg, layout, number_of_blocks);
+            }
+        }
+    }
+
+    unsafe fn deallocate(&self, offset: PointerOffset, layout: Layout) {
+        debug_assert!(
+            offset.offset() % self.block_size == 0
+                && offset.offset() / self.block_size < self.number_of_blocks,
+            "The offset {offset:?} is not managed by this allocator."
+        );
+
+        let number_of_blocks = self.blocks_for_layout(layout);
+        self.release_blocks(offset.offset() / self.block_size, number_of_blocks);
+        self.number_of_used_blocks
+            .fetch_sub(number_of_blocks, Ordering::Relaxed);
+    }
+}
@@ -10,6 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub mod arena_allocator;
+pub mod buddy_allocator;
 pub mod pointer_offset;
 pub mod pool_allocator;
 pub mod shm_bump_allocator;
@@ -44,6 +46,12 @@ pub enum AllocationStrategy {
     /// Increases the memory by rounding the increased memory size up to the next power of two.
     /// Reduces reallocations a lot at the cost of increased memory usage.
     PowerOfTwo,
+    /// Keeps multiple memory segments, one for every size class. A size class is a power of two
+    /// chunk size. Every allocation is served from the smallest fitting size class. When the
+    /// memory for a size class is exhausted, an additional segment with twice the capacity is
+    /// added to this class. Avoids that a single large allocation resizes the memory of all
+    /// small allocations.
+    SizeClasses,
     /// The memory is not increased. This may lead to an out-of-memory error when allocating.
     #[default]
     Static,
@@ -95,7 +95,7 @@ impl ShmAllocator for PoolAllocator {
         {
             match strategy {
                 AllocationStrategy::BestFit => self.allocator.number_of_buckets() + 1,
-                AllocationStrategy::PowerOfTwo => {
+                AllocationStrategy::PowerOfTwo | AllocationStrategy::SizeClasses => {
                     (self.allocator.number_of_buckets() + 1).next_power_of_two()
                 }
                 AllocationStrategy::Static => self.allocator.number_of_buckets(),
@@ -116,7 +116,7 @@ impl ShmAllocator for PoolAllocator {
                             .next_multiple_of(align);
                         Layout::from_size_align_unchecked(size, align)
                     },
-                    AllocationStrategy::PowerOfTwo => unsafe {
+                    AllocationStrategy::PowerOfTwo | AllocationStrategy::SizeClasses => unsafe {
                         let align = layout
                             .align()
                             .max(current_layout.align())
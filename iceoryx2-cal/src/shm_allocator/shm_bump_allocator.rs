@@ -52,7 +52,7 @@ impl ShmAllocator for BumpAllocator {
 
         let payload_size = match strategy {
             AllocationStrategy::BestFit => current_payload_size + layout.size(),
-            AllocationStrategy::PowerOfTwo => {
+            AllocationStrategy::PowerOfTwo | AllocationStrategy::SizeClasses => {
                 (current_payload_size + layout.size()).next_power_of_two()
             }
             AllocationStrategy::Static => current_payload_size,
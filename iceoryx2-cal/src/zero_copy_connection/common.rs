@@ -20,21 +20,25 @@ pub mod details {
     use alloc::vec;
     use alloc::vec::Vec;
 
-    use iceoryx2_bb_concurrency::atomic::{AtomicU8, AtomicU64, AtomicUsize};
+    use iceoryx2_bb_concurrency::atomic::{
+        AtomicBool, AtomicU8, AtomicU32, AtomicU64, AtomicUsize, fence,
+    };
     use iceoryx2_bb_concurrency::cell::UnsafeCell;
     use iceoryx2_bb_container::vector::relocatable_vec::*;
     use iceoryx2_bb_elementary_traits::allocator::{AllocationError, BaseAllocator};
     use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
     use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
+    #[cfg(target_os = "linux")]
+    use iceoryx2_bb_linux::futex::{FutexWaitError, futex_wait, futex_wake};
     use iceoryx2_bb_lock_free::spsc::{
         index_queue::RelocatableIndexQueue,
         safely_overflowing_index_queue::RelocatableSafelyOverflowingIndexQueue,
     };
     use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
-    use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitBuilder;
+    use iceoryx2_bb_posix::adaptive_wait::{AdaptiveWaitBuilder, AdaptiveWaitStrategy};
     use iceoryx2_bb_posix::clock::Time;
     use iceoryx2_bb_posix::file::AccessMode;
-    use iceoryx2_log::{fail, fatal_panic};
+    use iceoryx2_log::{error, fail, fatal_panic};
 
     pub use crate::zero_copy_connection::*;
 
@@ -166,6 +170,9 @@ pub mod details {
     #[repr(C)]
     struct Channel {
         state: AtomicU64,
+        /// futex word, incremented whenever the receiver frees space while senders are blocked
+        free_space_counter: AtomicU32,
+        number_of_blocked_senders: AtomicU32,
         completion_queue: RelocatableIndexQueue,
         submission_queue: RelocatableSafelyOverflowingIndexQueue,
     }
@@ -180,9 +187,53 @@ pub mod details {
                     RelocatableIndexQueue::new_uninit(completion_queue_capacity)
                 },
                 state: AtomicU64::new(CHANNEL_STATE_OPEN.0),
+                free_space_counter: AtomicU32::new(0),
+                number_of_blocked_senders: AtomicU32::new(0),
             }
         }
 
+        /// Sleeps as long as `keep_waiting` returns true, every single sleep lasts at most
+        /// `timeout`.
+        #[cfg(target_os = "linux")]
+        fn wait_for_free_space<F: FnMut() -> bool>(
+            &self,
+            timeout: Duration,
+            mut keep_waiting: F,
+        ) -> Result<(), FutexWaitError> {
+            self.number_of_blocked_senders
+                .fetch_add(1, Ordering::SeqCst);
+
+            let result = loop {
+                let observed_counter = self.free_space_counter.load(Ordering::SeqCst);
+                // pairs with the fence in wake_up_blocked_senders(), either the receiver sees
+                // the blocked sender or the sender sees the freed space
+                fence(Ordering::SeqCst);
+                if !keep_waiting() {
+                    break Ok(());
+                }
+
+                match futex_wait(&self.free_space_counter, observed_counter, Some(timeout)) {
+                    Ok(_) | Err(FutexWaitError::Interrupt) => (),
+                    Err(e) => break Err(e),
+                }
+            };
+
+            self.number_of_blocked_senders
+                .fetch_sub(1, Ordering::SeqCst);
+            result
+        }
+
+        fn wake_up_blocked_senders(&self) {
+            fence(Ordering::SeqCst);
+            if self.number_of_blocked_senders.load(Ordering::SeqCst) == 0 {
+                return;
+            }
+
+            self.free_space_counter.fetch_add(1, Ordering::SeqCst);
+            #[cfg(target_os = "linux")]
+            let _ = futex_wake(&self.free_space_counter, u32::MAX);
+        }
+
         const fn const_memory_size(
             submission_queue_capacity: usize,
             completion_queue_capacity: usize,
@@ -208,6 +259,9 @@ pub mod details {
         channels: RelocatableVec<Channel>,
         segment_details: RelocatableVec<SegmentDetails>,
         state: AtomicU8,
+        // set when the sender sleeps on the futex of a channel until space is freed, only then
+        // the receiver has to wake it up
+        wake_up_sender_on_free_space: AtomicBool,
         max_borrowed_samples: usize,
         number_of_samples_per_segment: usize,
         number_of_segments: u8,
@@ -232,6 +286,7 @@ pub mod details {
                 number_of_samples_per_segment,
                 number_of_segments,
                 state: AtomicU8::new(State::None.value()),
+                wake_up_sender_on_free_space: AtomicBool::new(false),
             }
         }
 
@@ -304,6 +359,27 @@ pub mod details {
             Ok(())
         }
 
+        /// Returns the number of bytes the management data of a connection with the provided
+        /// settings of the [`Builder`] occupies in its [`DynamicStorage`], without the
+        /// overhead of the [`DynamicStorage`] itself. It can be used to estimate the shared
+        /// memory footprint of a connection without creating it.
+        pub const fn required_memory_size(
+            buffer_size: usize,
+            max_borrowed_samples_per_channel: usize,
+            number_of_samples_per_segment: usize,
+            number_of_segments: u8,
+            number_of_channels: usize,
+        ) -> usize {
+            core::mem::size_of::<Self>()
+                + Self::const_memory_size(
+                    submission_queue_capacity(buffer_size),
+                    completion_queue_capacity(buffer_size, max_borrowed_samples_per_channel),
+                    number_of_samples_per_segment,
+                    number_of_segments,
+                    number_of_channels,
+                )
+        }
+
         const fn const_memory_size(
             submission_queue_capacity: usize,
             completion_queue_capacity: usize,
@@ -366,6 +442,22 @@ pub mod details {
         }
     }
 
+    const fn submission_queue_capacity(buffer_size: usize) -> usize {
+        buffer_size
+    }
+
+    // Every offset that is in flight on a channel is either in the submission queue, borrowed
+    // by the receiver or returned in the completion queue until the sender reclaims it. The
+    // completion queue must therefore hold the sum of both bounds. A completion queue that is
+    // shared by all channels of a sender would have to hold the sum over all receivers, so it
+    // would not reduce the memory, it only moves it from the connections to the sender.
+    const fn completion_queue_capacity(
+        buffer_size: usize,
+        max_borrowed_samples_per_channel: usize,
+    ) -> usize {
+        buffer_size + max_borrowed_samples_per_channel + 1
+    }
+
     #[derive(Debug)]
     pub struct Builder<Storage: DynamicStorage<SharedManagementData>> {
         name: FileName,
@@ -376,17 +468,21 @@ pub mod details {
         number_of_segments: u8,
         number_of_channels: usize,
         initial_channel_state: ChannelState,
+        prefault: bool,
+        lock_in_memory: bool,
         timeout: Duration,
+        wait_strategy: AdaptiveWaitStrategy,
+        wake_up_on_free_space: Option<Duration>,
         config: Configuration<Storage>,
     }
 
     impl<Storage: DynamicStorage<SharedManagementData>> Builder<Storage> {
         fn submission_queue_size(&self) -> usize {
-            self.buffer_size
+            submission_queue_capacity(self.buffer_size)
         }
 
         fn completion_queue_size(&self) -> usize {
-            self.buffer_size + self.max_borrowed_samples_per_channel + 1
+            completion_queue_capacity(self.buffer_size, self.max_borrowed_samples_per_channel)
         }
 
         fn create_or_open_shm(
@@ -408,6 +504,8 @@ pub mod details {
         .config(&self.config.dynamic_storage_config)
         .timeout(self.timeout)
         .supplementary_size(supplementary_size)
+        .prefault(self.prefault)
+        .lock_in_memory(self.lock_in_memory)
         .initializer(|data, allocator| {
             data.write(
                 SharedManagementData::new(
@@ -527,7 +625,11 @@ pub mod details {
                 number_of_channels: DEFAULT_NUMBER_OF_CHANNELS,
                 config: Configuration::default(),
                 initial_channel_state: CHANNEL_STATE_OPEN,
+                prefault: false,
+                lock_in_memory: false,
                 timeout: Duration::ZERO,
+                wait_strategy: AdaptiveWaitStrategy::default(),
+                wake_up_on_free_space: None,
             }
         }
 
@@ -550,6 +652,16 @@ pub mod details {
             self
         }
 
+        fn prefault(mut self, value: bool) -> Self {
+            self.prefault = value;
+            self
+        }
+
+        fn lock_in_memory(mut self, value: bool) -> Self {
+            self.lock_in_memory = value;
+            self
+        }
+
         fn buffer_size(mut self, value: usize) -> Self {
             self.buffer_size = value.clamp(1, usize::MAX);
             self
@@ -560,6 +672,16 @@ pub mod details {
             self
         }
 
+        fn wait_strategy(mut self, value: AdaptiveWaitStrategy) -> Self {
+            self.wait_strategy = value;
+            self
+        }
+
+        fn wake_up_on_free_space(mut self, timeout: Option<Duration>) -> Self {
+            self.wake_up_on_free_space = timeout;
+            self
+        }
+
         fn enable_safe_overflow(mut self, value: bool) -> Self {
             self.enable_safe_overflow = value;
             self
@@ -587,10 +709,16 @@ pub mod details {
             let msg = "Unable to create sender";
             let storage = fail!(from self, when self.create_or_open_shm(State::Sender),
             "{} since the corresponding connection could not be created or opened", msg);
+            storage
+                .get()
+                .wake_up_sender_on_free_space
+                .store(self.wake_up_on_free_space.is_some(), Ordering::Relaxed);
 
             Ok(Sender {
                 storage,
                 name: self.name,
+                wait_strategy: self.wait_strategy,
+                wake_up_on_free_space: self.wake_up_on_free_space,
             })
         }
 
@@ -620,6 +748,8 @@ pub mod details {
     pub struct Sender<Storage: DynamicStorage<SharedManagementData>> {
         storage: Storage,
         name: FileName,
+        wait_strategy: AdaptiveWaitStrategy,
+        wake_up_on_free_space: Option<Duration>,
     }
 
     impl<Storage: DynamicStorage<SharedManagementData>> Abandonable for Sender<Storage> {
@@ -646,6 +776,12 @@ pub mod details {
             self.storage.get().channels[0].submission_queue.capacity()
         }
 
+        fn active_buffer_size(&self) -> usize {
+            self.storage.get().channels[0]
+                .submission_queue
+                .active_capacity()
+        }
+
         fn max_supported_shared_memory_segments(&self) -> u8 {
             self.storage.get().number_of_segments
         }
@@ -761,7 +897,7 @@ pub mod details {
                 const WAIT_CONTINUE: bool = true;
                 const WAIT_ABORT: bool = false;
 
-                if let Err(e) = AdaptiveWaitBuilder::new().create().unwrap().wait_while(|| {
+                let keep_waiting = || {
                     is_connected = mgmt.is_connected();
                     has_valid_channel_state = mgmt.channels[channel_id.value()]
                         .state
@@ -800,9 +936,32 @@ pub mod details {
                     } else {
                         WAIT_ABORT
                     }
-                }) {
-                    fail!(from self, with ZeroCopySendError::InternalError,
-                        "{msg} {ptr:?} via channel {channel_id:?} since the adaptive wait failed. [{e:?}]");
+                };
+
+                match self
+                    .wake_up_on_free_space
+                    .filter(|_| cfg!(target_os = "linux"))
+                {
+                    #[cfg(target_os = "linux")]
+                    Some(timeout) => {
+                        if let Err(e) = mgmt.channels[channel_id.value()]
+                            .wait_for_free_space(timeout, keep_waiting)
+                        {
+                            fail!(from self, with ZeroCopySendError::InternalError,
+                                "{msg} {ptr:?} via channel {channel_id:?} since the wait for free space failed. [{e:?}]");
+                        }
+                    }
+                    _ => {
+                        if let Err(e) = AdaptiveWaitBuilder::new()
+                            .strategy(self.wait_strategy)
+                            .create()
+                            .unwrap()
+                            .wait_while(keep_waiting)
+                        {
+                            fail!(from self, with ZeroCopySendError::InternalError,
+                                "{msg} {ptr:?} via channel {channel_id:?} since the adaptive wait failed. [{e:?}]");
+                        }
+                    }
                 }
 
                 if !is_connected {
@@ -823,6 +982,13 @@ pub mod details {
             self.try_send(ptr, sample_size, channel_id)
         }
 
+        fn number_of_buffered_samples(&self, channel_id: ChannelId) -> usize {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+            self.storage.get().channels[channel_id.value()]
+                .submission_queue
+                .len()
+        }
+
         fn reclaim(
             &self,
             channel_id: ChannelId,
@@ -928,10 +1094,26 @@ pub mod details {
     impl<Storage: DynamicStorage<SharedManagementData>> Drop for Receiver<Storage> {
         fn drop(&mut self) {
             cleanup_shared_memory(&self.storage, State::Receiver);
+            // blocked senders have to detect that the receiver is gone
+            for channel in self.storage.get().channels.iter() {
+                channel.wake_up_blocked_senders();
+            }
         }
     }
 
     impl<Storage: DynamicStorage<SharedManagementData>> Receiver<Storage> {
+        fn wake_up_blocked_senders(&self, channel: &Channel) {
+            // avoids the fence in the receive path when the sender does not sleep
+            if self
+                .storage
+                .get()
+                .wake_up_sender_on_free_space
+                .load(Ordering::Relaxed)
+            {
+                channel.wake_up_blocked_senders();
+            }
+        }
+
         #[allow(clippy::mut_from_ref)]
         // convenience to access internal mutable object
         fn borrow_counter(&self, channel_id: ChannelId) -> &mut usize {
@@ -953,6 +1135,12 @@ pub mod details {
             self.storage.get().channels[0].submission_queue.capacity()
         }
 
+        fn active_buffer_size(&self) -> usize {
+            self.storage.get().channels[0]
+                .submission_queue
+                .active_capacity()
+        }
+
         fn max_supported_shared_memory_segments(&self) -> u8 {
             self.storage.get().number_of_segments
         }
@@ -987,6 +1175,17 @@ pub mod details {
                 .is_empty()
         }
 
+        fn peek(&self, channel_id: ChannelId) -> Option<PointerOffset> {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+
+            unsafe {
+                self.storage.get().channels[channel_id.value()]
+                    .submission_queue
+                    .peek()
+            }
+            .map(PointerOffset::from_value)
+        }
+
         fn receive(
             &self,
             channel_id: ChannelId,
@@ -999,23 +1198,85 @@ pub mod details {
                     self.borrow_counter(channel_id), self.max_borrowed_samples());
             }
 
-            match unsafe {
-                self.storage.get().channels[channel_id.value()]
-                    .submission_queue
-                    .pop()
-            } {
+            let channel = &self.storage.get().channels[channel_id.value()];
+            match unsafe { channel.submission_queue.pop() } {
                 None => Ok(None),
                 Some(v) => {
                     *self.borrow_counter(channel_id) += 1;
+                    self.wake_up_blocked_senders(channel);
                     Ok(Some(PointerOffset::from_value(v)))
                 }
             }
         }
 
+        fn receive_latest(
+            &self,
+            channel_id: ChannelId,
+        ) -> Result<Option<PointerOffset>, ZeroCopyReceiveError> {
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+
+            if *self.borrow_counter(channel_id) >= self.storage.get().max_borrowed_samples {
+                fail!(from self, with ZeroCopyReceiveError::ReceiveWouldExceedMaxBorrowValue,
+                "Unable to receive the latest sample since already {} samples were borrowed and this would exceed the max borrow value of {}.",
+                    self.borrow_counter(channel_id), self.max_borrowed_samples());
+            }
+
+            let channel = &self.storage.get().channels[channel_id.value()];
+            let mut latest = match unsafe { channel.submission_queue.pop() } {
+                None => return Ok(None),
+                Some(v) => v,
+            };
+
+            // the skipped offsets were never borrowed, therefore they are handed back to the
+            // sender without touching the borrow counter
+            while let Some(v) = unsafe { channel.submission_queue.pop() } {
+                if !unsafe { channel.completion_queue.push(latest) } {
+                    error!(from self,
+                        "This should never happen! Unable to return the skipped offset {:?} since the retrieve buffer is full.",
+                        PointerOffset::from_value(latest));
+                }
+                latest = v;
+            }
+
+            *self.borrow_counter(channel_id) += 1;
+            self.wake_up_blocked_senders(channel);
+            Ok(Some(PointerOffset::from_value(latest)))
+        }
+
         fn borrow_count(&self, channel_id: ChannelId) -> usize {
             *self.borrow_counter(channel_id)
         }
 
+        fn set_active_buffer_size(&self, value: usize) -> usize {
+            let mut active_buffer_size = value;
+            for channel in self.storage.get().channels.iter() {
+                active_buffer_size = channel.submission_queue.set_active_capacity(value);
+
+                // the surplus offsets were never borrowed, therefore they are handed back to the
+                // sender without touching the borrow counter
+                let mut has_returned_offsets = false;
+                while channel.submission_queue.len() > active_buffer_size {
+                    match unsafe { channel.submission_queue.pop() } {
+                        Some(v) => {
+                            if !unsafe { channel.completion_queue.push(v) } {
+                                error!(from self,
+                                    "This should never happen! Unable to return the surplus offset {:?} since the retrieve buffer is full.",
+                                    PointerOffset::from_value(v));
+                            }
+                            has_returned_offsets = true;
+                        }
+                        None => break,
+                    }
+                }
+
+                if has_returned_offsets {
+                    self.wake_up_blocked_senders(channel);
+                }
+            }
+
+            active_buffer_size
+        }
+
         fn release(
             &self,
             ptr: PointerOffset,
@@ -1038,6 +1299,36 @@ pub mod details {
                 }
             }
         }
+
+        fn release_many(
+            &self,
+            ptrs: &[PointerOffset],
+            channel_id: ChannelId,
+        ) -> Result<(), ZeroCopyReleaseError> {
+            const CHUNK_SIZE: usize = 32;
+            debug_assert!(channel_id.value() < self.storage.get().channels.capacity());
+
+            let completion_queue =
+                &self.storage.get().channels[channel_id.value()].completion_queue;
+            let mut values = [0u64; CHUNK_SIZE];
+            for chunk in ptrs.chunks(CHUNK_SIZE) {
+                for (value, ptr) in values.iter_mut().zip(chunk) {
+                    *value = ptr.as_value();
+                }
+
+                let number_of_released =
+                    unsafe { completion_queue.push_many(&values[..chunk.len()]) };
+                *self.borrow_counter(channel_id) -= number_of_released;
+
+                if number_of_released != chunk.len() {
+                    fail!(from self, with ZeroCopyReleaseError::RetrieveBufferFull,
+                    "Unable to release {} pointers since the retrieve buffer is full.",
+                        chunk.len() - number_of_released);
+                }
+            }
+
+            Ok(())
+        }
     }
 
     #[derive(Debug)]
@@ -1093,6 +1384,7 @@ pub mod details {
                            Ok(storage) => {
                                for channel in storage.get().channels.iter() {
                                    channel.state.store(CHANNEL_STATE_CLOSED.0, Ordering::Relaxed);
+                                   channel.wake_up_blocked_senders();
                                }
                                cleanup_shared_memory(&storage, port); Ok(())},
                            Err(DynamicStorageOpenError::InitializationNotYetFinalized) => {
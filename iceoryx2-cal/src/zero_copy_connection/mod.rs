@@ -22,6 +22,7 @@ use core::time::Duration;
 
 pub use crate::shared_memory::PointerOffset;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
+use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitStrategy;
 pub use iceoryx2_bb_system_types::file_name::*;
 pub use iceoryx2_bb_system_types::path::Path;
 use iceoryx2_log::fail;
@@ -184,14 +185,15 @@ impl ChannelState {
     pub fn new(value: u64) -> Result<Self, ChannelStateNewError> {
         if value > Self::max_value() {
             fail!(from "ChannelState::new()", with ChannelStateNewError::ValueOutOfBounds,
-                "Unable to create new ChannelState since the value must be less or equal than 2^62 and this value is {value},");
+                "Unable to create new ChannelState since the value must be less than 2^62 and this value is {value},");
         }
 
         Ok(Self(value))
     }
 
     pub const fn max_value() -> u64 {
-        2u64.pow(62)
+        // the two most significant bits are reserved for the rejected and disconnect hint bit
+        2u64.pow(62) - 1
     }
 
     pub fn value(&self) -> u64 {
@@ -211,6 +213,8 @@ pub const CHANNEL_STATE_OPEN: ChannelState = ChannelState(0);
 pub const CHANNEL_STATE_CLOSED: ChannelState = ChannelState(u64::MAX);
 /// Hints the channel that the other side intends to disconnect.
 const CHANNEL_STATE_DISCONNECT_HINT_BIT: u64 = 1u64 << 63;
+/// Signals the receiver that the sender rejected the channel without sending any data.
+const CHANNEL_STATE_REJECTED_BIT: u64 = 1u64 << 62;
 
 pub trait ZeroCopyConnectionBuilder<C: ZeroCopyConnection>: NamedConceptBuilder<C> {
     fn buffer_size(self, value: usize) -> Self;
@@ -220,12 +224,28 @@ pub trait ZeroCopyConnectionBuilder<C: ZeroCopyConnection>: NamedConceptBuilder<
     fn number_of_samples_per_segment(self, value: usize) -> Self;
     fn number_of_channels(self, value: usize) -> Self;
     fn initial_channel_state(self, value: ChannelState) -> Self;
+    /// Touches every page of the connection when it is newly created so that the first
+    /// send or receive does not cause a page fault. By default it is disabled.
+    fn prefault(self, value: bool) -> Self;
+    /// Locks the pages of the connection into memory when it is newly created so that they
+    /// cannot be swapped out. By default it is disabled.
+    fn lock_in_memory(self, value: bool) -> Self;
     /// The timeout defines how long the [`ZeroCopyConnectionBuilder`] should wait for
     /// concurrent
     /// [`ZeroCopyConnectionBuilder::create_sender()`] or
     /// [`ZeroCopyConnectionBuilder::create_receiver()`] call to finalize its initialization.
     /// By default it is set to [`Duration::ZERO`] for no timeout.
     fn timeout(self, value: Duration) -> Self;
+    /// Defines how the [`ZeroCopySender::blocking_send()`] waits until the receiver has
+    /// free space in its buffer. By default it is set to [`AdaptiveWaitStrategy::Adaptive`].
+    fn wait_strategy(self, value: AdaptiveWaitStrategy) -> Self;
+    /// When a timeout is provided, [`ZeroCopySender::blocking_send()`] sleeps on a futex of
+    /// the channel instead of waiting with the [`ZeroCopyConnectionBuilder::wait_strategy()`].
+    /// The receiver wakes it up as soon as it receives from the full buffer. A single sleep
+    /// lasts at most the timeout, afterwards the buffer and the backpressure handler are
+    /// checked again. Only supported on linux, other platforms fall back to the
+    /// [`ZeroCopyConnectionBuilder::wait_strategy()`]. By default it is set to [`None`].
+    fn wake_up_on_free_space(self, timeout: Option<Duration>) -> Self;
 
     fn create_sender(self) -> Result<C::Sender, ZeroCopyCreationError>;
     fn create_receiver(self) -> Result<C::Receiver, ZeroCopyCreationError>;
@@ -234,6 +254,10 @@ pub trait ZeroCopyConnectionBuilder<C: ZeroCopyConnection>: NamedConceptBuilder<
 pub trait ZeroCopyPortDetails {
     fn number_of_channels(&self) -> usize;
     fn buffer_size(&self) -> usize;
+    /// Returns the number of [`PointerOffset`]s a channel holds before it overflows or the
+    /// sender blocks. It never exceeds [`ZeroCopyPortDetails::buffer_size()`] and can be
+    /// adjusted at runtime with [`ZeroCopyReceiver::set_active_buffer_size()`].
+    fn active_buffer_size(&self) -> usize;
     fn has_enabled_safe_overflow(&self) -> bool;
     fn max_borrowed_samples(&self) -> usize;
     fn max_supported_shared_memory_segments(&self) -> u8;
@@ -281,6 +305,39 @@ pub trait ZeroCopyPortDetails {
         expected_state.0 == state_without_disconnect_hint_bit
     }
 
+    /// Marks the channel as rejected when it has the expected state. A rejected channel no
+    /// longer has the expected state and is closed with [`ZeroCopyPortDetails::close_channel()`]
+    /// like any other channel.
+    fn reject_channel(&self, channel_id: ChannelId, expected_state: ChannelState) {
+        let state = self.__internal_get_channel_state(channel_id);
+        let rejected_state = expected_state.0 | CHANNEL_STATE_REJECTED_BIT;
+        if state
+            .compare_exchange(
+                expected_state.0,
+                rejected_state,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            )
+            .is_err()
+        {
+            let _ = state.compare_exchange(
+                expected_state.0 | CHANNEL_STATE_DISCONNECT_HINT_BIT,
+                rejected_state | CHANNEL_STATE_DISCONNECT_HINT_BIT,
+                Ordering::Relaxed,
+                Ordering::Relaxed,
+            );
+        }
+    }
+
+    fn is_channel_rejected(&self, channel_id: ChannelId, expected_state: ChannelState) -> bool {
+        let state = self
+            .__internal_get_channel_state(channel_id)
+            .load(Ordering::Relaxed);
+        state != CHANNEL_STATE_CLOSED.0
+            && state & !(CHANNEL_STATE_DISCONNECT_HINT_BIT)
+                == expected_state.0 | CHANNEL_STATE_REJECTED_BIT
+    }
+
     fn is_channel_closed(&self, channel_id: ChannelId) -> bool {
         let state = self
             .__internal_get_channel_state(channel_id)
@@ -299,13 +356,14 @@ pub trait ZeroCopyPortDetails {
             ) {
             Ok(_) => (),
             Err(v) => {
-                let graceful_disconnect_state =
-                    expected_state.0 | CHANNEL_STATE_DISCONNECT_HINT_BIT;
-                if v == graceful_disconnect_state {
+                let is_hinted_or_rejected = v != CHANNEL_STATE_CLOSED.0
+                    && v & !(CHANNEL_STATE_DISCONNECT_HINT_BIT | CHANNEL_STATE_REJECTED_BIT)
+                        == expected_state.0;
+                if is_hinted_or_rejected {
                     let _ = self
                         .__internal_get_channel_state(channel_id)
                         .compare_exchange(
-                            graceful_disconnect_state,
+                            v,
                             CHANNEL_STATE_CLOSED.0,
                             Ordering::Relaxed,
                             Ordering::Relaxed,
@@ -351,6 +409,10 @@ pub trait ZeroCopySender: Debug + ZeroCopyPortDetails + NamedConcept + Send + Ab
     fn reclaim(&self, channel_id: ChannelId)
     -> Result<Option<PointerOffset>, ZeroCopyReclaimError>;
 
+    /// Returns the number of [`PointerOffset`]s in the channel that were sent but not yet
+    /// received by the [`ZeroCopyReceiver`].
+    fn number_of_buffered_samples(&self, channel_id: ChannelId) -> usize;
+
     /// # Safety
     ///
     /// * must ensure that no receiver is still holding data, otherwise data races may occur on
@@ -364,14 +426,43 @@ pub trait ZeroCopyReceiver:
     Debug + ZeroCopyPortDetails + NamedConcept + Send + Abandonable
 {
     fn has_data(&self, channel_id: ChannelId) -> bool;
+    /// Returns the [`PointerOffset`] that the next [`ZeroCopyReceiver::receive()`] would
+    /// acquire without acquiring it. It can already be outdated when it is returned and shall
+    /// only be used as a hint, e.g. to prefetch the next sample.
+    fn peek(&self, channel_id: ChannelId) -> Option<PointerOffset>;
     fn receive(&self, channel_id: ChannelId)
     -> Result<Option<PointerOffset>, ZeroCopyReceiveError>;
+    /// Acquires the most recent offset of the submission queue and returns all older offsets
+    /// directly to the sender without borrowing them. Returns [`None`] when the submission
+    /// queue is empty.
+    fn receive_latest(
+        &self,
+        channel_id: ChannelId,
+    ) -> Result<Option<PointerOffset>, ZeroCopyReceiveError>;
     fn release(
         &self,
         ptr: PointerOffset,
         channel_id: ChannelId,
     ) -> Result<(), ZeroCopyReleaseError>;
+    /// Releases multiple [`PointerOffset`]s at once. If not all offsets could be released
+    /// [`ZeroCopyReleaseError::RetrieveBufferFull`] is returned and the offsets that were
+    /// not released remain borrowed.
+    fn release_many(
+        &self,
+        ptrs: &[PointerOffset],
+        channel_id: ChannelId,
+    ) -> Result<(), ZeroCopyReleaseError> {
+        for ptr in ptrs {
+            self.release(*ptr, channel_id)?;
+        }
+        Ok(())
+    }
     fn borrow_count(&self, channel_id: ChannelId) -> usize;
+    /// Sets the number of [`PointerOffset`]s every channel holds before it overflows or the
+    /// sender blocks. The value is clamped to `1..=`[`ZeroCopyPortDetails::buffer_size()`]
+    /// and the adjusted value is returned. When a channel contains more offsets than the new
+    /// size allows, the oldest ones are handed back to the sender without borrowing them.
+    fn set_active_buffer_size(&self, value: usize) -> usize;
 }
 
 pub trait ZeroCopyConnection: Debug + Sized + NamedConceptMgmt {
@@ -13,6 +13,7 @@
 use core::alloc::Layout;
 
 use iceoryx2_bb_concurrency::atomic::AtomicBool;
+use iceoryx2_bb_concurrency::atomic::AtomicU64;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 use iceoryx2_bb_elementary::{
     bump_allocator::BumpAllocator,
@@ -23,8 +24,15 @@ use iceoryx2_bb_elementary_traits::{
 };
 use iceoryx2_log::{fail, fatal_panic};
 
-pub type UsedChunkList = details::UsedChunkList<OwningPointer<AtomicBool>>;
-pub type RelocatableUsedChunkList = details::UsedChunkList<RelocatablePointer<AtomicBool>>;
+pub type UsedChunkList = details::UsedChunkList<OwningPointer<AtomicU64>>;
+pub type RelocatableUsedChunkList = details::UsedChunkList<RelocatablePointer<AtomicU64>>;
+
+const BITS_PER_WORD: usize = u64::BITS as usize;
+
+/// Returns the number of bitmap words that are required to track `capacity` chunks
+pub const fn number_of_words(capacity: usize) -> usize {
+    capacity.div_ceil(BITS_PER_WORD)
+}
 
 pub mod details {
     use core::fmt::Debug;
@@ -36,27 +44,32 @@ pub mod details {
 
     use super::*;
 
+    /// Tracks the chunks that are currently in use with one bit per chunk, the chunk index is
+    /// the bit position. Therefore, [`UsedChunkList::insert()`] and [`UsedChunkList::remove()`]
+    /// are constant time operations and [`UsedChunkList::remove_all()`] skips 64 unused chunks
+    /// with a single load.
     #[derive(Debug)]
     #[repr(C)]
-    pub struct UsedChunkList<PointerType: PointerTrait<AtomicBool>> {
+    pub struct UsedChunkList<PointerType: PointerTrait<AtomicU64>> {
         data_ptr: PointerType,
         capacity: usize,
         is_memory_initialized: AtomicBool,
     }
 
-    unsafe impl<PointerType: PointerTrait<AtomicBool> + ZeroCopySend> ZeroCopySend
+    unsafe impl<PointerType: PointerTrait<AtomicU64> + ZeroCopySend> ZeroCopySend
         for UsedChunkList<PointerType>
     {
     }
-    unsafe impl<PointerType: PointerTrait<AtomicBool>> Send for UsedChunkList<PointerType> {}
-    unsafe impl<PointerType: PointerTrait<AtomicBool>> Sync for UsedChunkList<PointerType> {}
+    unsafe impl<PointerType: PointerTrait<AtomicU64>> Send for UsedChunkList<PointerType> {}
+    unsafe impl<PointerType: PointerTrait<AtomicU64>> Sync for UsedChunkList<PointerType> {}
 
-    impl UsedChunkList<OwningPointer<AtomicBool>> {
+    impl UsedChunkList<OwningPointer<AtomicU64>> {
         pub fn new(capacity: usize) -> Self {
-            let mut data_ptr = OwningPointer::<AtomicBool>::new_with_alloc(capacity);
+            let number_of_words = number_of_words(capacity);
+            let mut data_ptr = OwningPointer::<AtomicU64>::new_with_alloc(number_of_words);
 
-            for i in 0..capacity {
-                unsafe { data_ptr.as_mut_ptr().add(i).write(AtomicBool::new(false)) };
+            for i in 0..number_of_words {
+                unsafe { data_ptr.as_mut_ptr().add(i).write(AtomicU64::new(0)) };
             }
 
             Self {
@@ -67,7 +80,7 @@ pub mod details {
         }
     }
 
-    impl RelocatableContainer for UsedChunkList<RelocatablePointer<AtomicBool>> {
+    impl RelocatableContainer for UsedChunkList<RelocatablePointer<AtomicU64>> {
         unsafe fn new_uninit(capacity: usize) -> Self {
             Self {
                 data_ptr: unsafe { RelocatablePointer::new_uninit() },
@@ -85,20 +98,21 @@ pub mod details {
                 "Memory already initialized. Initializing it twice may lead to undefined behavior.");
             }
 
+            let number_of_words = number_of_words(self.capacity);
             let memory = fail!(from self, when allocator
                 .allocate(unsafe {
                     Layout::from_size_align_unchecked(
-                        core::mem::size_of::<AtomicBool>() * self.capacity,
-                        core::mem::align_of::<AtomicBool>())
+                        core::mem::size_of::<AtomicU64>() * number_of_words,
+                        core::mem::align_of::<AtomicU64>())
                 }),
                 "Failed to initialize since the allocation of the data memory failed.");
 
             unsafe { self.data_ptr.init(memory) };
-            for i in 0..self.capacity {
+            for i in 0..number_of_words {
                 unsafe {
-                    (self.data_ptr.as_ptr() as *mut AtomicBool)
+                    (self.data_ptr.as_ptr() as *mut AtomicU64)
                         .add(i)
-                        .write(AtomicBool::new(false))
+                        .write(AtomicU64::new(0))
                 }
             }
 
@@ -115,9 +129,9 @@ pub mod details {
         }
     }
 
-    impl<PointerType: PointerTrait<AtomicBool> + Debug> UsedChunkList<PointerType> {
+    impl<PointerType: PointerTrait<AtomicU64> + Debug> UsedChunkList<PointerType> {
         pub const fn const_memory_size(capacity: usize) -> usize {
-            unaligned_mem_size::<AtomicBool>(capacity)
+            unaligned_mem_size::<AtomicU64>(number_of_words(capacity))
         }
 
         pub fn capacity(&self) -> usize {
@@ -132,6 +146,12 @@ pub mod details {
             );
         }
 
+        #[inline(always)]
+        fn word(&self, word_idx: usize) -> &AtomicU64 {
+            unsafe { &*self.data_ptr.as_ptr().add(word_idx) }
+        }
+
+        /// Sets the bit of `idx` to `value` and returns the previous value of the bit.
         fn set(&self, idx: usize, value: bool) -> bool {
             self.verify_init("set");
             debug_assert!(
@@ -139,7 +159,15 @@ pub mod details {
                 "This should never happen. Out of bounds access with index {idx}."
             );
 
-            unsafe { (*self.data_ptr.as_ptr().add(idx)).swap(value, Ordering::Relaxed) }
+            let word = self.word(idx / BITS_PER_WORD);
+            let mask = 1u64 << (idx % BITS_PER_WORD);
+            let previous = if value {
+                word.fetch_or(mask, Ordering::Relaxed)
+            } else {
+                word.fetch_and(!mask, Ordering::Relaxed)
+            };
+
+            previous & mask != 0
         }
 
         pub fn insert(&self, value: usize) -> bool {
@@ -151,11 +179,19 @@ pub mod details {
         }
 
         pub fn remove_all<F: FnMut(usize)>(&self, mut callback: F) {
-            self.verify_init("pop");
+            self.verify_init("remove_all");
+
+            for word_idx in 0..number_of_words(self.capacity) {
+                let word = self.word(word_idx);
+                if word.load(Ordering::Relaxed) == 0 {
+                    continue;
+                }
 
-            for i in 0..self.capacity {
-                if unsafe { (*self.data_ptr.as_ptr().add(i)).swap(false, Ordering::Relaxed) } {
-                    callback(i);
+                let mut used_chunks = word.swap(0, Ordering::Relaxed);
+                while used_chunks != 0 {
+                    let bit = used_chunks.trailing_zeros() as usize;
+                    used_chunks &= used_chunks - 1;
+                    callback(word_idx * BITS_PER_WORD + bit);
                 }
             }
         }
@@ -166,14 +202,16 @@ pub mod details {
 #[repr(C)]
 pub struct FixedSizeUsedChunkList<const CAPACITY: usize> {
     list: RelocatableUsedChunkList,
-    data: [AtomicBool; CAPACITY],
+    // one word per chunk is more than required but the number of words cannot be derived
+    // from CAPACITY in a const generic context
+    data: [AtomicU64; CAPACITY],
 }
 
 impl<const CAPACITY: usize> Default for FixedSizeUsedChunkList<CAPACITY> {
     fn default() -> Self {
         let mut new_self = Self {
             list: unsafe { RelocatableUsedChunkList::new_uninit(CAPACITY) },
-            data: [const { AtomicBool::new(false) }; CAPACITY],
+            data: [const { AtomicU64::new(0) }; CAPACITY],
         };
 
         // SAFETY: Creating a pointer to an existing member is always not null
@@ -108,3 +108,32 @@ fn waiting_for_initialization_works() {
     assert_that!(sut.err().unwrap(), eq DynamicStorageOpenError::InitializationNotYetFinalized);
     assert_that!(start.elapsed().expect("failed to get elapsed time"), ge TIMEOUT);
 }
+
+#[cfg(target_os = "linux")]
+#[test]
+fn waiting_for_initialization_of_readable_segment_blocks_until_timeout() {
+    type Sut = iceoryx2_cal::dynamic_storage::posix_shared_memory::Storage<TestData>;
+    let storage_name = generate_file_path().file_name();
+    let config = generate_isolated_config::<Sut>();
+    let file_name = config.path_for(&storage_name).file_name();
+
+    // a zeroed segment looks like a storage whose creator is still initializing it
+    let _raw_shm = SharedMemoryBuilder::new(&file_name)
+        .creation_mode(CreationMode::PurgeAndCreate)
+        .size(1234)
+        .has_ownership(true)
+        .permission(Permission::OWNER_READ | Permission::OWNER_WRITE)
+        .zero_memory(true)
+        .create()
+        .unwrap();
+
+    let start = Time::now().expect("failed to get current time");
+    let sut = <Sut as DynamicStorage<TestData>>::Builder::new(&storage_name)
+        .timeout(TIMEOUT)
+        .config(&config)
+        .open(AccessMode::ReadWrite);
+
+    assert_that!(sut, is_err);
+    assert_that!(sut.err().unwrap(), eq DynamicStorageOpenError::InitializationNotYetFinalized);
+    assert_that!(start.elapsed().expect("failed to get elapsed time"), ge TIMEOUT);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::collections::BTreeSet;
+use alloc::format;
+use alloc::string::String;
+
+use iceoryx2_bb_container::semantic_string::SemanticString;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_cal::hash::sha1::Sha1;
+use iceoryx2_cal::hash::wyhash::WyHash128;
+use iceoryx2_cal::hash::{Hash, HashKind};
+
+fn value_of<H: Hash>(bytes: &[u8]) -> String {
+    H::new(bytes).value().into()
+}
+
+#[test]
+fn wyhash_is_deterministic() {
+    let input = b"1some/service/name";
+
+    assert_that!(value_of::<WyHash128>(input), eq value_of::<WyHash128>(input));
+}
+
+#[test]
+fn wyhash_of_different_inputs_differ_for_all_input_lengths() {
+    const MAX_LENGTH: usize = 160;
+    let input: alloc::vec::Vec<u8> = (0..MAX_LENGTH).map(|v| (v * 7 + 3) as u8).collect();
+
+    let mut values = BTreeSet::new();
+    for len in 0..=MAX_LENGTH {
+        assert_that!(values.insert(value_of::<WyHash128>(&input[..len])), eq true);
+    }
+
+    for n in 0..1000 {
+        let name = format!("1my/service/name/{n}");
+        assert_that!(values.insert(value_of::<WyHash128>(name.as_bytes())), eq true);
+    }
+}
+
+#[test]
+fn hash_kind_is_detected_from_value() {
+    let input = b"2another/service/name";
+
+    let wyhash_value = WyHash128::new(input).value();
+    let sha1_value = Sha1::new(input).value();
+
+    assert_that!(HashKind::from_value(wyhash_value.as_base64url().as_bytes()), eq Some(WyHash128::KIND));
+    assert_that!(HashKind::from_value(sha1_value.as_base64url().as_bytes()), eq Some(Sha1::KIND));
+    assert_that!(HashKind::from_value(b"not-a-hash"), eq None);
+    assert_that!(WyHash128::KIND, ne Sha1::KIND);
+}
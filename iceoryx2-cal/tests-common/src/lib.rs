@@ -16,8 +16,12 @@ extern crate alloc;
 extern crate iceoryx2_bb_loggers;
 
 pub mod dynamic_storage_posix_shared_memory_tests;
+pub mod hash_tests;
 pub mod pointer_offset_tests;
+pub mod serialize_cdr_tests;
 pub mod shared_memory_posix_shared_memory_tests;
+pub mod shm_allocator_arena_allocator_tests;
+pub mod shm_allocator_buddy_allocator_tests;
 pub mod shm_allocator_bump_allocator_tests;
 pub mod shm_allocator_pool_allocator_tests;
 pub mod static_storage_file_tests;
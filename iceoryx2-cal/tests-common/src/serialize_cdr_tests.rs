@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::mem::MaybeUninit;
+
+use alloc::collections::BTreeMap;
+use alloc::string::String;
+use alloc::vec;
+use alloc::vec::Vec;
+
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_cal::serialize::Serialize;
+use iceoryx2_cal::serialize::cdr::Cdr;
+use serde::{Deserialize, Serialize as SerdeSerialize};
+
+#[derive(Debug, PartialEq, SerdeSerialize, Deserialize)]
+struct Mixed {
+    a: u8,
+    b: u32,
+    c: u16,
+    d: u64,
+}
+
+#[derive(Debug, PartialEq, SerdeSerialize, Deserialize)]
+enum Shape {
+    Empty,
+    Circle(f64),
+    Rectangle { width: u16, height: u16 },
+}
+
+#[derive(Debug, PartialEq, SerdeSerialize, Deserialize)]
+struct PointField {
+    name: String,
+    offset: u32,
+    datatype: u8,
+    count: u32,
+}
+
+#[derive(Debug, PartialEq, SerdeSerialize, Deserialize)]
+struct PointCloud {
+    frame_id: String,
+    height: u32,
+    width: u32,
+    fields: Vec<PointField>,
+    is_bigendian: bool,
+    point_step: u32,
+    data: Vec<u8>,
+    origin: [f32; 3],
+    shape: Shape,
+    tags: BTreeMap<u16, String>,
+}
+
+fn point_cloud() -> PointCloud {
+    let mut tags = BTreeMap::new();
+    tags.insert(3, String::from("lidar"));
+    tags.insert(7, String::from("front"));
+
+    PointCloud {
+        frame_id: String::from("base_link"),
+        height: 1,
+        width: 3,
+        fields: vec![
+            PointField {
+                name: String::from("x"),
+                offset: 0,
+                datatype: 7,
+                count: 1,
+            },
+            PointField {
+                name: String::from("intensity"),
+                offset: 4,
+                datatype: 2,
+                count: 1,
+            },
+        ],
+        is_bigendian: false,
+        point_step: 5,
+        data: (0..15).collect(),
+        origin: [1.5, -2.25, 3.0],
+        shape: Shape::Rectangle {
+            width: 640,
+            height: 480,
+        },
+        tags,
+    }
+}
+
+fn serialize_into_vec<T: serde::Serialize>(value: &T) -> Vec<u8> {
+    let mut buffer = vec![MaybeUninit::<u8>::uninit(); Cdr::serialized_size(value).unwrap()];
+    let written = Cdr::serialize_into(value, &mut buffer).unwrap();
+    assert_that!(written, eq buffer.len());
+
+    buffer.iter().map(|b| unsafe { b.assume_init() }).collect()
+}
+
+#[test]
+fn cdr_aligns_primitives_relative_to_the_encapsulation_header() {
+    let bytes = Cdr::serialize(&Mixed {
+        a: 0x11,
+        b: 0x22334455,
+        c: 0x6677,
+        d: 0x8899aabbccddeeff,
+    })
+    .unwrap();
+
+    assert_that!(bytes, eq vec![
+        0x00, 0x01, 0x00, 0x00, // encapsulation header
+        0x11, 0x00, 0x00, 0x00, // a + padding
+        0x55, 0x44, 0x33, 0x22, // b
+        0x77, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // c + padding
+        0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88, // d
+    ]);
+}
+
+#[test]
+fn cdr_encodes_strings_with_null_terminator() {
+    let bytes = Cdr::serialize(&String::from("Hi")).unwrap();
+
+    assert_that!(bytes, eq vec![0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, b'H', b'i', 0x00]);
+}
+
+#[test]
+fn cdr_serialized_size_matches_the_serialized_data() {
+    let value = point_cloud();
+
+    let bytes = Cdr::serialize(&value).unwrap();
+    assert_that!(Cdr::serialized_size(&value), eq Ok(bytes.len()));
+    assert_that!(serialize_into_vec(&value), eq bytes);
+}
+
+#[test]
+fn cdr_serialize_into_and_deserialize_works() {
+    let value = point_cloud();
+
+    let bytes = serialize_into_vec(&value);
+    let deserialized: PointCloud = Cdr::deserialize(&bytes).unwrap();
+
+    assert_that!(deserialized, eq value);
+}
+
+#[test]
+fn cdr_serialize_into_fails_when_the_buffer_is_too_small() {
+    let value = point_cloud();
+    let size = Cdr::serialized_size(&value).unwrap();
+
+    for len in [0, 3, 4, size / 2, size - 1] {
+        let mut buffer = vec![MaybeUninit::<u8>::uninit(); len];
+        assert_that!(Cdr::serialize_into(&value, &mut buffer), is_err);
+    }
+}
+
+#[test]
+fn cdr_deserializes_big_endian_data() {
+    let bytes = [
+        0x00, 0x00, 0x00, 0x00, // encapsulation header
+        0x11, 0x00, 0x00, 0x00, // a + padding
+        0x22, 0x33, 0x44, 0x55, // b
+        0x66, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // c + padding
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, // d
+    ];
+
+    let deserialized: Mixed = Cdr::deserialize(&bytes).unwrap();
+
+    assert_that!(deserialized, eq Mixed {
+        a: 0x11,
+        b: 0x22334455,
+        c: 0x6677,
+        d: 0x8899aabbccddeeff,
+    });
+}
+
+#[test]
+fn cdr_deserialize_fails_for_invalid_input() {
+    let bytes = Cdr::serialize(&point_cloud()).unwrap();
+
+    assert_that!(
+        Cdr::deserialize::<PointCloud>(&bytes[..bytes.len() - 1]),
+        is_err
+    );
+    assert_that!(Cdr::deserialize::<PointCloud>(&bytes[..2]), is_err);
+
+    let mut invalid_encapsulation = bytes.clone();
+    invalid_encapsulation[1] = 0x07;
+    assert_that!(
+        Cdr::deserialize::<PointCloud>(&invalid_encapsulation),
+        is_err
+    );
+
+    let missing_null_terminator = [0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, b'H', b'i'];
+    assert_that!(Cdr::deserialize::<String>(&missing_null_terminator), is_err);
+}
+
+#[test]
+fn cdr_does_not_support_optional_values() {
+    assert_that!(Cdr::serialized_size(&Some(5u32)), is_err);
+    assert_that!(Cdr::serialize(&Option::<u32>::None), is_err);
+}
@@ -0,0 +1,179 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::boxed::Box;
+use alloc::vec::Vec;
+use core::{alloc::Layout, ptr::NonNull};
+
+use iceoryx2_bb_elementary_traits::allocator::AllocationError;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_cal::shm_allocator::{
+    AllocationStrategy, ShmAllocationError, ShmAllocator, arena_allocator::*,
+};
+
+const MAX_SUPPORTED_ALIGNMENT: usize = 4096;
+const MEM_SIZE: usize = 16384 * 10;
+const PAYLOAD_SIZE: usize = 8192;
+
+struct TestContext {
+    _payload_memory: Box<[u8; MEM_SIZE]>,
+    _base_address: NonNull<[u8]>,
+    sut: Box<ArenaAllocator>,
+}
+
+impl TestContext {
+    fn new() -> Self {
+        let mut payload_memory = Box::new([0u8; MEM_SIZE]);
+        let base_address =
+            unsafe { NonNull::<[u8]>::new_unchecked(&mut payload_memory[0..PAYLOAD_SIZE]) };
+        let allocator = iceoryx2_bb_memory::bump_allocator::BumpAllocator::new(
+            unsafe { NonNull::new_unchecked(payload_memory[PAYLOAD_SIZE..].as_mut_ptr()) },
+            MEM_SIZE,
+        );
+        let config = Config::default();
+        let mut sut = Box::new(unsafe {
+            ArenaAllocator::new_uninit(MAX_SUPPORTED_ALIGNMENT, base_address, &config)
+        });
+
+        unsafe { sut.init(&allocator).unwrap() };
+
+        Self {
+            _payload_memory: payload_memory,
+            _base_address: base_address,
+            sut,
+        }
+    }
+}
+
+#[test]
+fn initial_setup_hint_is_layout_times_number_of_chunks() {
+    let layout = Layout::from_size_align(64, 2).unwrap();
+    let max_number_of_chunks = 54;
+    let hint = ArenaAllocator::initial_setup_hint(layout, max_number_of_chunks);
+
+    assert_that!(hint.payload_size, eq layout.size() * max_number_of_chunks);
+}
+
+#[test]
+fn no_new_resize_hint_when_there_is_memory_available() {
+    let test_context = TestContext::new();
+    for strategy in [AllocationStrategy::PowerOfTwo, AllocationStrategy::BestFit] {
+        let hint = test_context
+            .sut
+            .resize_hint(Layout::from_size_align(8, 2).unwrap(), strategy);
+
+        assert_that!(hint.payload_size, eq test_context.sut.total_space());
+    }
+}
+
+#[test]
+fn new_resize_hint_with_best_fit_when_there_is_not_enough_memory_available() {
+    let test_context = TestContext::new();
+    let layout = Layout::from_size_align(test_context.sut.total_space() + 1, 1).unwrap();
+    let hint = test_context
+        .sut
+        .resize_hint(layout, AllocationStrategy::BestFit);
+    assert_that!(
+        hint.payload_size,
+        eq(test_context.sut.total_space() + layout.size())
+    );
+}
+
+#[test]
+fn allocations_of_different_sizes_are_packed_without_overlap() {
+    let test_context = TestContext::new();
+    let mut chunks = Vec::new();
+
+    for size in [1, 7, 8, 13, 64, 3] {
+        let layout = Layout::from_size_align(size, 8).unwrap();
+        let offset = unsafe { test_context.sut.allocate(layout).unwrap() };
+        assert_that!(offset.offset() % layout.align(), eq 0);
+        chunks.push((offset.offset(), size));
+    }
+
+    for window in chunks.windows(2) {
+        assert_that!(window[0].0 + window[0].1 <= window[1].0, eq true);
+        // an alignment of 8 wastes at most 7 bytes
+        assert_that!(window[1].0 - (window[0].0 + window[0].1) < 8, eq true);
+    }
+    assert_that!(test_context.sut.number_of_live_chunks(), eq chunks.len());
+}
+
+#[test]
+fn allocate_fails_when_frame_is_exhausted() {
+    let test_context = TestContext::new();
+    let layout = Layout::from_size_align(PAYLOAD_SIZE / 4, 8).unwrap();
+
+    for _ in 0..4 {
+        assert_that!(unsafe { test_context.sut.allocate(layout) }, is_ok);
+    }
+
+    assert_that!(unsafe { test_context.sut.allocate(layout) }, eq Err(ShmAllocationError::AllocationError(AllocationError::OutOfMemory)));
+    assert_that!(test_context.sut.free_space(), eq 0);
+}
+
+#[test]
+fn allocate_with_size_zero_fails() {
+    let test_context = TestContext::new();
+
+    assert_that!(unsafe { test_context.sut.allocate(Layout::from_size_align(0, 1).unwrap()) },
+        eq Err(ShmAllocationError::AllocationError(AllocationError::SizeIsZero)));
+}
+
+#[test]
+fn allocate_with_unsupported_alignment_fails() {
+    let test_context = TestContext::new();
+
+    assert_that!(unsafe { test_context.sut.allocate(Layout::from_size_align(8, 16).unwrap()) },
+        eq Err(ShmAllocationError::ExceedsMaxSupportedAlignment));
+}
+
+#[test]
+fn memory_is_not_reused_while_a_chunk_is_alive() {
+    let test_context = TestContext::new();
+    let layout = Layout::from_size_align(128, 8).unwrap();
+
+    let chunk_1 = unsafe { test_context.sut.allocate(layout).unwrap() };
+    let chunk_2 = unsafe { test_context.sut.allocate(layout).unwrap() };
+    unsafe { test_context.sut.deallocate(chunk_1, layout) };
+
+    assert_that!(test_context.sut.number_of_live_chunks(), eq 1);
+    assert_that!(test_context.sut.used_space(), eq 2 * layout.size());
+
+    let chunk_3 = unsafe { test_context.sut.allocate(layout).unwrap() };
+    assert_that!(chunk_3.offset(), ne chunk_1.offset());
+    assert_that!(chunk_3.offset(), ne chunk_2.offset());
+}
+
+#[test]
+fn frame_is_reset_when_last_chunk_is_deallocated() {
+    const REPETITIONS: usize = 10;
+    let test_context = TestContext::new();
+    let layout = Layout::from_size_align(PAYLOAD_SIZE / 8, 8).unwrap();
+
+    for _ in 0..REPETITIONS {
+        let mut chunks = Vec::new();
+        while let Ok(chunk) = unsafe { test_context.sut.allocate(layout) } {
+            chunks.push(chunk);
+        }
+        assert_that!(chunks, len 8);
+
+        for chunk in chunks {
+            unsafe { test_context.sut.deallocate(chunk, layout) };
+        }
+
+        assert_that!(test_context.sut.number_of_live_chunks(), eq 0);
+        assert_that!(test_context.sut.used_space(), eq 0);
+        assert_that!(test_context.sut.free_space(), eq test_context.sut.total_space());
+    }
+}
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::boxed::Box;
+use alloc::collections::btree_set::BTreeSet;
+use alloc::vec::Vec;
+use core::{alloc::Layout, ptr::NonNull};
+
+use iceoryx2_bb_elementary_traits::allocator::AllocationError;
+use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_testing::assert_that;
+use iceoryx2_bb_testing_macros::test;
+use iceoryx2_cal::shm_allocator::{
+    AllocationStrategy, PointerOffset, ShmAllocationError, ShmAllocator, buddy_allocator::*,
+};
+
+const MAX_SUPPORTED_ALIGNMENT: usize = 4096;
+const BLOCK_SIZE: usize = 64;
+const MEM_SIZE: usize = 16384 * 10;
+const PAYLOAD_SIZE: usize = 16384;
+
+// the start of the payload must be aligned to the block size, otherwise the allocator skips
+// the first partial block
+#[repr(C, align(4096))]
+struct Memory([u8; MEM_SIZE]);
+
+struct TestContext {
+    _payload_memory: Box<Memory>,
+    _base_address: NonNull<[u8]>,
+    sut: Box<BuddyAllocator>,
+}
+
+impl TestContext {
+    fn new(payload_size: usize) -> Self {
+        let mut payload_memory = Box::new(Memory([0u8; MEM_SIZE]));
+        let base_address =
+            unsafe { NonNull::<[u8]>::new_unchecked(&mut payload_memory.0[0..payload_size]) };
+        let allocator = BumpAllocator::new(
+            unsafe { NonNull::new_unchecked(payload_memory.0[payload_size..].as_mut_ptr()) },
+            MEM_SIZE - payload_size,
+        );
+        let config = Config {
+            block_size: BLOCK_SIZE,
+        };
+        let mut sut = Box::new(unsafe {
+            BuddyAllocator::new_uninit(MAX_SUPPORTED_ALIGNMENT, base_address, &config)
+        });
+
+        unsafe { sut.init(&allocator).unwrap() };
+
+        Self {
+            _payload_memory: payload_memory,
+            _base_address: base_address,
+            sut,
+        }
+    }
+
+    fn allocate_all(&self, layout: Layout) -> Vec<PointerOffset> {
+        let mut chunks = Vec::new();
+        while let Ok(chunk) = unsafe { self.sut.allocate(layout) } {
+            chunks.push(chunk);
+        }
+        chunks
+    }
+
+    fn deallocate_all(&self, chunks: Vec<PointerOffset>, layout: Layout) {
+        for chunk in chunks {
+            unsafe { self.sut.deallocate(chunk, layout) };
+        }
+    }
+}
+
+#[test]
+fn initial_setup_hint_rounds_chunks_up_to_power_of_two_blocks() {
+    let layout = Layout::from_size_align(3 * BLOCK_SIZE, 8).unwrap();
+    let max_number_of_chunks = 12;
+    let hint = BuddyAllocator::initial_setup_hint(layout, max_number_of_chunks);
+
+    assert_that!(hint.payload_size, eq 4 * hint.config.block_size * max_number_of_chunks);
+}
+
+#[test]
+fn no_new_resize_hint_when_there_is_memory_available() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+    let hint = test_context.sut.resize_hint(
+        Layout::from_size_align(8, 2).unwrap(),
+        AllocationStrategy::PowerOfTwo,
+    );
+
+    assert_that!(hint.payload_size, eq PAYLOAD_SIZE);
+}
+
+#[test]
+fn new_resize_hint_with_power_of_two_when_there_is_not_enough_memory_available() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+    let layout = Layout::from_size_align(PAYLOAD_SIZE + 1, 1).unwrap();
+    let hint = test_context
+        .sut
+        .resize_hint(layout, AllocationStrategy::PowerOfTwo);
+
+    assert_that!(hint.payload_size, ge PAYLOAD_SIZE + layout.size());
+    assert_that!(hint.payload_size.is_power_of_two(), eq true);
+}
+
+#[test]
+fn allocate_with_size_zero_fails() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+
+    assert_that!(unsafe { test_context.sut.allocate(Layout::from_size_align(0, 1).unwrap()) },
+        eq Err(ShmAllocationError::AllocationError(AllocationError::SizeIsZero)));
+}
+
+#[test]
+fn allocate_with_alignment_larger_than_block_size_fails() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+
+    assert_that!(unsafe { test_context.sut.allocate(Layout::from_size_align(8, 2 * BLOCK_SIZE).unwrap()) },
+        eq Err(ShmAllocationError::ExceedsMaxSupportedAlignment));
+}
+
+#[test]
+fn allocate_more_than_available_fails() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+
+    assert_that!(unsafe { test_context.sut.allocate(Layout::from_size_align(PAYLOAD_SIZE + 1, 8).unwrap()) },
+        eq Err(ShmAllocationError::AllocationError(AllocationError::SizeTooLarge)));
+}
+
+#[test]
+fn chunks_are_aligned_to_their_buddy_size() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+
+    for blocks in [1, 2, 4, 8, 64, 128] {
+        let layout = Layout::from_size_align(blocks * BLOCK_SIZE, 8).unwrap();
+        let chunk = unsafe { test_context.sut.allocate(layout).unwrap() };
+        assert_that!(chunk.offset() % layout.size(), eq 0);
+    }
+}
+
+#[test]
+fn allocate_and_release_all_chunks_of_different_sizes_works() {
+    const REPETITIONS: usize = 4;
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+    let number_of_blocks = test_context.sut.number_of_blocks();
+
+    for _ in 0..REPETITIONS {
+        for blocks in [1, 3, 32, 64, 128] {
+            let layout = Layout::from_size_align(blocks * BLOCK_SIZE, 8).unwrap();
+            let buddy_size = blocks.next_power_of_two();
+            let chunks = test_context.allocate_all(layout);
+
+            assert_that!(chunks, len number_of_blocks / buddy_size);
+            let offsets: BTreeSet<usize> = chunks.iter().map(|c| c.offset()).collect();
+            assert_that!(offsets, len chunks.len());
+            assert_that!(test_context.sut.number_of_used_blocks(), eq number_of_blocks);
+
+            test_context.deallocate_all(chunks, layout);
+            assert_that!(test_context.sut.number_of_used_blocks(), eq 0);
+        }
+    }
+}
+
+#[test]
+fn released_small_chunks_merge_into_a_large_chunk() {
+    let test_context = TestContext::new(PAYLOAD_SIZE);
+    let small = Layout::from_size_align(BLOCK_SIZE, 8).unwrap();
+    let large = Layout::from_size_align(PAYLOAD_SIZE, 8).unwrap();
+
+    let chunks = test_context.allocate_all(small);
+    assert_that!(unsafe { test_context.sut.allocate(large) }, is_err);
+
+    test_context.deallocate_all(chunks, small);
+    let chunk = unsafe { test_context.sut.allocate(large) };
+    assert_that!(chunk, is_ok);
+    assert_that!(chunk.unwrap().offset(), eq 0);
+}
+
+#[test]
+fn memory_that_is_not_a_multiple_of_the_word_size_is_fully_usable() {
+    let payload_size = BLOCK_SIZE * 70;
+    let test_context = TestContext::new(payload_size);
+    let layout = Layout::from_size_align(BLOCK_SIZE, 8).unwrap();
+
+    let chunks = test_context.allocate_all(layout);
+    assert_that!(chunks, len test_context.sut.number_of_blocks());
+    for chunk in &chunks {
+        assert_that!(chunk.offset() + BLOCK_SIZE, le payload_size);
+    }
+}
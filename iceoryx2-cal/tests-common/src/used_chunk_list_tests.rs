@@ -12,7 +12,7 @@
 
 use iceoryx2_bb_testing_macros::tests;
 
-#[tests(1, 2, 3, 128)]
+#[tests(1, 2, 3, 64, 65, 128, 200)]
 pub mod generic {
     use alloc::vec;
 
@@ -55,4 +55,26 @@ pub mod generic {
             assert_that!(sut.remove(i), eq false);
         }
     }
+
+    #[test]
+    fn remove_all_returns_only_inserted_indices<const CAPACITY: usize>() {
+        let mut sut = FixedSizeUsedChunkList::<CAPACITY>::new();
+
+        for i in (0..sut.capacity()).step_by(3) {
+            assert_that!(sut.insert(i), eq true);
+        }
+        assert_that!(sut.remove(0), eq true);
+
+        let mut removed_indices = vec![];
+        sut.remove_all(|index| {
+            removed_indices.push(index);
+        });
+
+        let expected_indices: vec::Vec<usize> = (3..sut.capacity()).step_by(3).collect();
+        assert_that!(removed_indices, eq expected_indices);
+
+        let mut number_of_removed_indices = 0;
+        sut.remove_all(|_| number_of_removed_indices += 1);
+        assert_that!(number_of_removed_indices, eq 0);
+    }
 }
@@ -90,6 +90,39 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                     description: "Additional nanoseconds for global entity creation timeout.\n   \
                     Attention: Both 'secs' and 'nanos' must be set together; leaving one unset will cause the configuration to be invalid.",
                 },
+                Field {
+                    key: "global.backpressure-wait-strategy",
+                    value_type: "`Adaptive`|`FixedTicks`|`Backoff`",
+                    default_value: format!("{:?}", config.global.backpressure_wait_strategy),
+                    description: "Defines how ports wait on a full receiver buffer with the `RetryUntilDelivered` backpressure strategy.\n   \
+                    `Backoff` is configured with 'spin-repetitions', 'yield-repetitions', 'initial-sleep' and 'max-sleep'.",
+                },
+                Field {
+                    key: "global.shared-memory-quota",
+                    value_type: "Option<int>",
+                    default_value: config
+                        .global
+                        .shared_memory_quota
+                        .map_or("None".to_string(), |e| e.to_string()),
+                    description: "Maximum number of bytes the data segments of all processes with the same `global.prefix` can occupy in sum.",
+                },
+                Field {
+                    key: "global.lazy-data-segment-mapping",
+                    value_type: "bool",
+                    default_value: config.global.lazy_data_segment_mapping.to_string(),
+                    description: "Receiving ports map the data segment of a sender only when its first sample arrives.",
+                },
+                Field {
+                    key: "global.data-segment-idle-timeout",
+                    value_type: "Option<Duration>",
+                    default_value: config
+                        .global
+                        .data_segment_idle_timeout
+                        .map_or("None".to_string(), |e| format!("{e:?}")),
+                    description: "\
+                    Receiving ports unmap the data segment of a sender that sent no sample for this duration.\n   \
+                    The keys are `global.data-segment-idle-timeout.secs` and `global.data-segment-idle-timeout.nanos`.",
+                },
             ],
         },
         Section {
@@ -317,7 +350,7 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                 },
                 Field {
                     key: "defaults.publish-subscribe.publisher-allocation-strategy",
-                    value_type: "`Static`|`BestFit`|`PowerOfTwo`",
+                    value_type: "`Static`|`BestFit`|`PowerOfTwo`|`SizeClasses`",
                     default_value: format!(
                         "{:?}",
                         config
@@ -327,6 +360,15 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                     ),
                     description: "Default allocation strategy used by the publisher when the initially preallocated memory is insufficient.",
                 },
+                Field {
+                    key: "defaults.publish-subscribe.publisher-page-size",
+                    value_type: "`Regular`|`Huge`",
+                    default_value: format!(
+                        "{:?}",
+                        config.defaults.publish_subscribe.publisher_page_size
+                    ),
+                    description: "Default page size of the publisher data segment. Falls back to regular pages when huge pages are not available.",
+                },
             ],
         },
         Section {
@@ -551,7 +593,7 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                 },
                 Field {
                     key: "defaults.request-response.client-allocation-strategy",
-                    value_type: "`Static`|`BestFit`|`PowerOfTwo`",
+                    value_type: "`Static`|`BestFit`|`PowerOfTwo`|`SizeClasses`",
                     default_value: format!(
                         "{:?}",
                         config.defaults.request_response.client_allocation_strategy
@@ -560,7 +602,7 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                 },
                 Field {
                     key: "defaults.request-response.server-allocation-strategy",
-                    value_type: "`Static`|`BestFit`|`PowerOfTwo`",
+                    value_type: "`Static`|`BestFit`|`PowerOfTwo`|`SizeClasses`",
                     default_value: format!(
                         "{:?}",
                         config.defaults.request_response.server_allocation_strategy
@@ -586,6 +628,15 @@ pub(crate) fn describe_schema(config: &Config) -> Vec<Section> {
                 },
             ],
         },
+        Section {
+            name: "Defaults: WaitSet",
+            fields: vec![Field {
+                key: "defaults.waitset.reactor-backend",
+                value_type: "`Recommended`|`IoUring`",
+                default_value: format!("{:?}", config.defaults.waitset.reactor_backend),
+                description: "Default event multiplexing mechanism of the WaitSet. `IoUring` requires linux 5.11 or newer and falls back to `Recommended` when it is not available.",
+            }],
+        },
     ]
 }
 
@@ -59,10 +59,29 @@ pub struct DetailsOptions {
     pub filter: OutputFilter,
 }
 
+#[derive(Args)]
+pub struct CleanupOptions {
+    #[clap(
+        short,
+        long,
+        help = "Repeat the cleanup every <INTERVAL> milliseconds until a termination signal is received [default: cleanup once]"
+    )]
+    pub interval: Option<u64>,
+
+    #[clap(
+        short,
+        long,
+        help = "Maximum number of dead nodes that are cleaned up per cycle [default: unlimited]"
+    )]
+    pub max_cleanups_per_cycle: Option<usize>,
+}
+
 #[derive(Subcommand)]
 pub enum Action {
     #[clap(about = "List all nodes", help_template = help_template().build())]
     List(ListOptions),
     #[clap(about = "Show node details", help_template = help_template().with_positionals().build())]
     Details(DetailsOptions),
+    #[clap(about = "Remove the stale resources of dead nodes", help_template = help_template().build())]
+    Cleanup(CleanupOptions),
 }
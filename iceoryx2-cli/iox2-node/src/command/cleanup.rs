@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+
+use anyhow::{Context, Result};
+use iceoryx2::node::DeadNodeView;
+use iceoryx2::prelude::*;
+use iceoryx2_cli::Format;
+use iceoryx2_cli::output::NodeCleanupReport;
+
+fn cleanup_cycle(max_cleanups_per_cycle: Option<usize>) -> Result<NodeCleanupReport> {
+    let mut dead_nodes = Vec::<DeadNodeView<ipc::Service>>::new();
+    Node::<ipc::Service>::list(Config::global_config(), |node| {
+        if let NodeState::Dead(view) = node {
+            dead_nodes.push(view);
+        }
+        CallbackProgression::Continue
+    })
+    .context("failed to retrieve nodes")?;
+
+    let max_cleanups = max_cleanups_per_cycle.unwrap_or(usize::MAX);
+    let mut report = NodeCleanupReport {
+        remaining_dead_nodes: dead_nodes.len().saturating_sub(max_cleanups),
+        ..Default::default()
+    };
+
+    for dead_node in dead_nodes.into_iter().take(max_cleanups) {
+        // another process is already cleaning up the node, it is not waited for, so that the
+        // cycle time of the cleanup is not blocked
+        match dead_node.try_remove_stale_resources() {
+            Ok(()) => report.cleanups += 1,
+            Err(_) => report.failed_cleanups += 1,
+        }
+    }
+
+    Ok(report)
+}
+
+pub(crate) fn cleanup(
+    interval: Option<u64>,
+    max_cleanups_per_cycle: Option<usize>,
+    format: Format,
+) -> Result<()> {
+    let interval = match interval {
+        Some(interval) => Duration::from_millis(interval),
+        None => {
+            let report = cleanup_cycle(max_cleanups_per_cycle)?;
+            println!("{}", format.as_string(&report)?);
+            return Ok(());
+        }
+    };
+
+    // the node is only used to wait for the next cycle and to handle termination requests
+    let node = NodeBuilder::new()
+        .name(&NodeName::new("iox2-cli-node-cleanup")?)
+        .create::<ipc::Service>()?;
+
+    while node.wait(interval).is_ok() {
+        let report = cleanup_cycle(max_cleanups_per_cycle)?;
+        if report.cleanups != 0 || report.failed_cleanups != 0 {
+            println!("{}", format.as_string(&report)?);
+        }
+    }
+
+    Ok(())
+}
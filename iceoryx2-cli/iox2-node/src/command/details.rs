@@ -18,6 +18,7 @@ use iceoryx2_cli::filter::NodeIdentifier;
 use iceoryx2_cli::output::NodeDescription;
 
 use crate::cli::OutputFilter;
+use crate::command::list::node_list_filter;
 
 pub(crate) fn details(
     identifier: NodeIdentifier,
@@ -26,7 +27,12 @@ pub(crate) fn details(
 ) -> Result<()> {
     let mut error: Option<Error> = None;
 
-    Node::<ipc::Service>::list(Config::global_config(), |node| {
+    let mut list_filter = node_list_filter(&filter);
+    if let NodeIdentifier::Name(name) = &identifier {
+        list_filter = list_filter.name_prefix(name);
+    }
+
+    Node::<ipc::Service>::list_filtered(Config::global_config(), &list_filter, |node| {
         if identifier.matches(&node) && filter.matches(&node) {
             match format.as_string(&NodeDescription::from(&node)) {
                 Ok(output) => {
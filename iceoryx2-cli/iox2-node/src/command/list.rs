@@ -11,6 +11,7 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use anyhow::{Context, Result};
+use iceoryx2::node::list_filter::NodeListFilter;
 use iceoryx2::prelude::*;
 use iceoryx2_cli::Format;
 use iceoryx2_cli::filter::Filter;
@@ -21,12 +22,16 @@ use crate::cli::OutputFilter;
 
 pub(crate) fn list(filter: OutputFilter, format: Format) -> Result<()> {
     let mut nodes = Vec::<NodeDescriptor>::new();
-    Node::<ipc::Service>::list(Config::global_config(), |node| {
-        if filter.matches(&node) {
-            nodes.push(NodeDescriptor::from(&node));
-        }
-        CallbackProgression::Continue
-    })
+    Node::<ipc::Service>::list_filtered(
+        Config::global_config(),
+        &node_list_filter(&filter),
+        |node| {
+            if filter.matches(&node) {
+                nodes.push(NodeDescriptor::from(&node));
+            }
+            CallbackProgression::Continue
+        },
+    )
     .context("failed to retrieve nodes")?;
 
     println!(
@@ -39,3 +44,12 @@ pub(crate) fn list(filter: OutputFilter, format: Format) -> Result<()> {
 
     Ok(())
 }
+
+/// A [`NodeListFilter`] that lets [`Node::list_filtered()`] skip the details of all nodes
+/// that are not selected by the state of the [`OutputFilter`].
+pub(crate) fn node_list_filter(filter: &OutputFilter) -> NodeListFilter {
+    match filter.state.as_node_state_filter() {
+        Some(state) => NodeListFilter::new().state(state),
+        None => NodeListFilter::new(),
+    }
+}
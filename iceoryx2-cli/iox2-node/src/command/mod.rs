@@ -10,8 +10,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+mod cleanup;
 mod details;
 mod list;
 
+pub(crate) use cleanup::*;
 pub(crate) use details::*;
 pub(crate) use list::*;
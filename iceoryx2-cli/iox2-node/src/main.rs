@@ -40,6 +40,13 @@ fn main() -> Result<()> {
                     eprintln!("Failed to retrieve node details: {e}");
                 }
             }
+            Action::Cleanup(options) => {
+                if let Err(e) =
+                    command::cleanup(options.interval, options.max_cleanups_per_cycle, cli.format)
+                {
+                    eprintln!("Failed to cleanup dead nodes: {e}");
+                }
+            }
         }
     } else {
         Cli::command().print_help().expect("Failed to print help");
@@ -59,6 +59,17 @@ pub struct DetailsOptions {
     pub filter: OutputFilter,
 }
 
+#[derive(Parser)]
+pub struct MemoryOptions {
+    #[clap(
+        help = "[Optional] Name of the service e.g. \"My Service\". If not specified all services are reported."
+    )]
+    pub service: Option<String>,
+
+    #[command(flatten)]
+    pub filter: OutputFilter,
+}
+
 #[derive(Parser)]
 pub struct DiscoveryOptions {
     #[clap(
@@ -85,6 +96,26 @@ pub struct DiscoveryOptions {
     pub max_listeners: usize,
 }
 
+#[derive(Parser)]
+pub struct IntrospectionOptions {
+    #[clap(
+        short,
+        long,
+        default_value = "1000",
+        help = "Update rate in milliseconds"
+    )]
+    pub rate: u64,
+
+    #[clap(long, default_value = "10", help = "The maximum number of subscribers")]
+    pub max_subscribers: usize,
+
+    #[clap(long, help = "Do not notify when new metrics are published")]
+    pub disable_notify: bool,
+
+    #[clap(long, default_value = "10", help = "The maximum number of listeners")]
+    pub max_listeners: usize,
+}
+
 #[derive(Parser)]
 pub struct NotifyOptions {
     #[clap(help = "Name of the service which shall be notified.")]
@@ -442,11 +473,24 @@ pub struct ReplayOptions {
         short,
         long,
         default_value = "1.0",
-        help = "The timings in the file will be multiplied by the given factor to increase or slow down the playback."
+        help = "The timings in the file will be multiplied by the given factor to increase or slow down the playback. A factor of 0 replays as fast as possible."
     )]
     pub time_factor: f32,
 }
 
+#[derive(Parser)]
+pub struct PrepareOptions {
+    #[clap(help = "The TOML manifest that contains all services that shall be created.")]
+    pub manifest: String,
+    #[clap(
+        short,
+        long,
+        default_value = "iox2-cli-service-prepare",
+        help = "Defines the node name that owns the prepared services."
+    )]
+    pub node_name: String,
+}
+
 #[derive(Subcommand)]
 pub enum Action {
     #[clap(
@@ -459,11 +503,21 @@ pub enum Action {
         help_template = help_template().with_positionals().build()
     )]
     Details(DetailsOptions),
+    #[clap(
+        about = "Report the shared memory footprint of services and suggest tighter limits",
+        help_template = help_template().with_positionals().build()
+    )]
+    Memory(MemoryOptions),
     #[clap(
         about = "Runs the service discovery service within a process",
         help_template = help_template().build()
     )]
     Discovery(DiscoveryOptions),
+    #[clap(
+        about = "Runs the service introspection service within a process",
+        help_template = help_template().build()
+    )]
+    Introspection(IntrospectionOptions),
     #[clap(
         about = "Send a notification",
         help_template = help_template().with_positionals().build()
@@ -499,4 +553,9 @@ pub enum Action {
         help_template = help_template().with_positionals().build()
     )]
     Hz(HzOptions),
+    #[clap(
+        about = "Create all services of a manifest and keep them alive until the process is interrupted.",
+        help_template = help_template().with_positionals().build()
+    )]
+    Prepare(PrepareOptions),
 }
@@ -10,36 +10,26 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
-use anyhow::{Error, Result};
+use anyhow::{Context, Result};
 use iceoryx2::prelude::*;
 use iceoryx2_cli::Format;
-use iceoryx2_cli::filter::Filter;
 use iceoryx2_cli::output::ServiceDescription;
 
 use crate::cli::OutputFilter;
 
 pub(crate) fn details(service_name: String, filter: OutputFilter, format: Format) -> Result<()> {
-    let mut error: Option<Error> = None;
+    let config = Config::global_config();
+    let service_name = ServiceName::new(&service_name).context("invalid service name")?;
 
-    ipc::Service::list(Config::global_config(), |service| {
-        if service_name == service.static_details.name().to_string() && filter.matches(&service) {
-            match format.as_string(&ServiceDescription::from(&service)) {
-                Ok(output) => {
-                    println!("{output}");
-                    CallbackProgression::Continue
-                }
-                Err(e) => {
-                    error = Some(e);
-                    CallbackProgression::Stop
-                }
-            }
-        } else {
-            CallbackProgression::Continue
+    // the service hash is derived from the name and the messaging pattern, therefore only the
+    // candidates have to be looked up instead of listing all services
+    for messaging_pattern in filter.pattern.messaging_patterns() {
+        if let Some(service) = ipc::Service::details(&service_name, config, *messaging_pattern)
+            .context("failed to retrieve service details")?
+        {
+            println!("{}", format.as_string(&ServiceDescription::from(&service))?);
         }
-    })?;
-
-    if let Some(err) = error {
-        return Err(err);
     }
+
     Ok(())
 }
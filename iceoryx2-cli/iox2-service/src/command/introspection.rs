@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use anyhow::Result;
+use anyhow::anyhow;
+use iceoryx2::prelude::*;
+use iceoryx2_services_introspection::service_introspection::Config as IntrospectionConfig;
+use iceoryx2_services_introspection::service_introspection::Service as IntrospectionService;
+
+pub(crate) fn introspection(
+    rate: u64,
+    max_subscribers: usize,
+    send_notifications: bool,
+    max_listeners: usize,
+) -> Result<()> {
+    let introspection_config = IntrospectionConfig {
+        max_subscribers,
+        send_notifications,
+        max_listeners,
+        include_internal: false,
+        ..Default::default()
+    };
+
+    let mut service = IntrospectionService::<ipc::Service>::create(
+        &introspection_config,
+        Config::global_config(),
+    )
+    .map_err(|e| anyhow::anyhow!("failed to create service: {:?}", e))?;
+
+    println!("Publishing Service Metrics (rate: {rate}ms)");
+
+    let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+    let guard = waitset
+        .attach_interval(core::time::Duration::from_millis(rate))
+        .map_err(|e| anyhow!("failed to attach interval to waitset: {:?}", e))?;
+    let tick = WaitSetAttachmentId::from_guard(&guard);
+
+    let on_event = |id: WaitSetAttachmentId<ipc::Service>| {
+        if id == tick {
+            if let Err(e) = service.spin() {
+                eprintln!("error while spinning service: {e:?}");
+            }
+        }
+
+        CallbackProgression::Continue
+    };
+
+    waitset
+        .wait_and_process(on_event)
+        .map_err(|e| anyhow!("error waiting on waitset: {:?}", e))?;
+
+    Ok(())
+}
@@ -15,20 +15,33 @@ use iceoryx2::prelude::*;
 use iceoryx2_cli::Format;
 use iceoryx2_cli::filter::Filter;
 use iceoryx2_cli::output::ServiceDescriptor;
+use iceoryx2_cli::probe::parallel_probe;
 
 use crate::cli::OutputFilter;
 
 pub(crate) fn list(filter: OutputFilter, format: Format) -> Result<()> {
-    let mut services = Vec::<ServiceDescriptor>::new();
+    let config = Config::global_config();
+    let mut service_hashes = Vec::new();
 
-    ipc::Service::list(Config::global_config(), |service| {
-        if filter.matches(&service) {
-            services.push(ServiceDescriptor::from(&service));
-        }
+    ipc::Service::list_service_hashes(config, |service_hash| {
+        service_hashes.push(service_hash);
         CallbackProgression::Continue
     })
     .context("failed to retrieve services")?;
 
+    // the descriptor requires only the static config, therefore the services are inspected
+    // read-only instead of acquiring the state of all of their nodes
+    let mut services =
+        parallel_probe(
+            &service_hashes,
+            |service_hash| match ipc::Service::inspect_from_service_hash(config, service_hash) {
+                Ok(Some(inspector)) if filter.matches(inspector.static_config()) => {
+                    Some(ServiceDescriptor::from(inspector.static_config()))
+                }
+                _ => None,
+            },
+        );
+
     services.sort_by_key(|pattern| match pattern {
         ServiceDescriptor::PublishSubscribe(name) => (name.clone(), 0),
         ServiceDescriptor::Event(name) => (name.clone(), 1),
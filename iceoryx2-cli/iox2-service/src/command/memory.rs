@@ -0,0 +1,219 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use anyhow::{Context, Result};
+use iceoryx2::identifiers::UniquePortId;
+use iceoryx2::prelude::*;
+use iceoryx2::service::inspector::{ServiceInspector, ServiceMemoryFootprint};
+use iceoryx2::service::static_config::messaging_pattern::MessagingPattern as StaticMessagingPattern;
+use iceoryx2::service::static_config::publish_subscribe::StaticConfig as PublishSubscribeStaticConfig;
+use iceoryx2_cli::Format;
+use iceoryx2_cli::filter::Filter;
+use iceoryx2_cli::probe::parallel_probe;
+
+use crate::cli::OutputFilter;
+
+#[derive(serde::Serialize)]
+struct PortMemory {
+    id: String,
+    data_segment: usize,
+    connections: usize,
+}
+
+#[derive(serde::Serialize)]
+struct Limit {
+    name: &'static str,
+    current: usize,
+    suggested: usize,
+}
+
+#[derive(serde::Serialize)]
+struct Advice {
+    limits: Vec<Limit>,
+    data_segment_savings: usize,
+}
+
+#[derive(serde::Serialize)]
+struct ServiceMemory {
+    service: String,
+    total: usize,
+    dynamic_config: usize,
+    data_segments: usize,
+    connections: usize,
+    ports: Vec<PortMemory>,
+    #[serde(skip_serializing_if = "Option::is_none")]
+    advice: Option<Advice>,
+}
+
+pub(crate) fn memory(
+    service_name: Option<String>,
+    filter: OutputFilter,
+    format: Format,
+) -> Result<()> {
+    let config = Config::global_config();
+
+    let mut services = match service_name {
+        Some(service_name) => {
+            let service_name = ServiceName::new(&service_name).context("invalid service name")?;
+            let mut services = Vec::new();
+            for messaging_pattern in filter.pattern.messaging_patterns() {
+                if let Some(inspector) =
+                    ipc::Service::inspect(&service_name, config, *messaging_pattern)
+                        .context("failed to inspect service")?
+                {
+                    services.push(service_memory(&inspector));
+                }
+            }
+            services
+        }
+        None => {
+            let mut service_hashes = Vec::new();
+            ipc::Service::list_service_hashes(config, |service_hash| {
+                service_hashes.push(service_hash);
+                CallbackProgression::Continue
+            })
+            .context("failed to retrieve services")?;
+
+            parallel_probe(&service_hashes, |service_hash| {
+                match ipc::Service::inspect_from_service_hash(config, service_hash) {
+                    Ok(Some(inspector)) if filter.matches(inspector.static_config()) => {
+                        Some(service_memory(&inspector))
+                    }
+                    _ => None,
+                }
+            })
+        }
+    };
+
+    services.sort_by(|lhs, rhs| rhs.total.cmp(&lhs.total));
+
+    println!("{}", format.as_string(&services)?);
+
+    Ok(())
+}
+
+fn service_memory(inspector: &ServiceInspector<ipc::Service>) -> ServiceMemory {
+    let footprint = inspector.memory_footprint();
+
+    ServiceMemory {
+        service: inspector.static_config().name().to_string(),
+        total: footprint.total(),
+        dynamic_config: footprint.dynamic_config,
+        data_segments: footprint.data_segments(),
+        connections: footprint.connections(),
+        ports: footprint
+            .ports
+            .iter()
+            .map(|port| PortMemory {
+                id: match port.port_id {
+                    UniquePortId::Publisher(id) => id.to_string(),
+                    id => format!("{id:?}"),
+                },
+                data_segment: port.data_segment,
+                connections: port.connections,
+            })
+            .collect(),
+        advice: match inspector.static_config().messaging_pattern() {
+            StaticMessagingPattern::PublishSubscribe(static_config) => {
+                publish_subscribe_advice(inspector, static_config, &footprint)
+            }
+            _ => None,
+        },
+    }
+}
+
+/// Suggests the tightest publish-subscribe limits that still fit the currently connected
+/// ports and estimates how many bytes the data segments of the publishers would shrink.
+fn publish_subscribe_advice(
+    inspector: &ServiceInspector<ipc::Service>,
+    static_config: &PublishSubscribeStaticConfig,
+    footprint: &ServiceMemoryFootprint,
+) -> Option<Advice> {
+    let dynamic_config = inspector.publish_subscribe()?;
+
+    let mut max_buffer_size = 0;
+    let mut max_history_request = 0;
+    dynamic_config.list_subscribers(|details| {
+        max_buffer_size = max_buffer_size.max(details.buffer_size);
+        max_history_request = max_history_request.max(details.history_request);
+        CallbackProgression::Continue
+    });
+
+    let subscribers = dynamic_config.number_of_subscribers().max(1);
+    let buffer_size = max_buffer_size.max(1);
+    let history_size = max_history_request.min(static_config.history_size());
+    let borrowed_samples = static_config.subscriber_max_borrowed_samples();
+    let priority_lanes = static_config.number_of_priority_lanes();
+
+    let required_samples = |subscribers: usize, buffer_size: usize, history_size: usize| {
+        subscribers * priority_lanes * (buffer_size + borrowed_samples) + history_size
+    };
+    let current_samples = required_samples(
+        static_config.max_subscribers(),
+        static_config.subscriber_max_buffer_size(),
+        static_config.history_size(),
+    );
+    let suggested_samples = required_samples(subscribers, buffer_size, history_size);
+
+    let mut data_segment_savings = 0;
+    dynamic_config.list_publishers(|details| {
+        if details.number_of_samples > 0 && current_samples > suggested_samples {
+            let sample_size = footprint
+                .ports
+                .iter()
+                .find(|port| port.port_id == UniquePortId::Publisher(details.publisher_id))
+                .map_or(0, |port| port.data_segment / details.number_of_samples);
+            // every sample beyond the subscriber and history demand is a loan of the publisher
+            // which stays the same with the suggested limits
+            let removable_samples =
+                (current_samples - suggested_samples).min(details.number_of_samples);
+            data_segment_savings += removable_samples * sample_size;
+        }
+        CallbackProgression::Continue
+    });
+
+    let limits = [
+        (
+            "max_publishers",
+            static_config.max_publishers(),
+            dynamic_config.number_of_publishers().max(1),
+        ),
+        (
+            "max_subscribers",
+            static_config.max_subscribers(),
+            subscribers,
+        ),
+        (
+            "subscriber_max_buffer_size",
+            static_config.subscriber_max_buffer_size(),
+            buffer_size,
+        ),
+        ("history_size", static_config.history_size(), history_size),
+    ]
+    .into_iter()
+    .filter(|(_, current, suggested)| suggested < current)
+    .map(|(name, current, suggested)| Limit {
+        name,
+        current,
+        suggested,
+    })
+    .collect::<Vec<_>>();
+
+    if limits.is_empty() {
+        return None;
+    }
+
+    Some(Advice {
+        limits,
+        data_segment_savings,
+    })
+}
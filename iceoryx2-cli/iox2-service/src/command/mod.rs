@@ -13,9 +13,12 @@
 mod details;
 mod discovery;
 mod hz;
+mod introspection;
 mod list;
 mod listen;
+mod memory;
 mod notify;
+mod prepare;
 mod publish;
 mod record;
 mod replay;
@@ -24,9 +27,12 @@ mod subscribe;
 pub(crate) use details::*;
 pub(crate) use discovery::*;
 pub(crate) use hz::*;
+pub(crate) use introspection::*;
 pub(crate) use list::*;
 pub(crate) use listen::*;
+pub(crate) use memory::*;
 pub(crate) use notify::*;
+pub(crate) use prepare::*;
 pub(crate) use publish::*;
 pub(crate) use record::*;
 pub(crate) use replay::*;
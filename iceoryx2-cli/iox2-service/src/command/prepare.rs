@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+use std::io::Write;
+use std::path::Path;
+
+use anyhow::Result;
+use iceoryx2::prelude::*;
+use iceoryx2_cli::Format;
+use iceoryx2_cli::manifest::Manifest;
+use serde::Serialize;
+
+use crate::cli::PrepareOptions;
+
+#[derive(Serialize)]
+struct PrepareFeedback {
+    publish_subscribe: Vec<String>,
+    event: Vec<String>,
+}
+
+pub(crate) fn prepare(options: PrepareOptions, format: Format) -> Result<()> {
+    let manifest = Manifest::from_file(Path::new(&options.manifest))?;
+
+    let node = NodeBuilder::new()
+        .name(&NodeName::new(&options.node_name)?)
+        .create::<ipc::Service>()?;
+
+    // the services exist as long as their port factories are alive
+    let services = manifest.create_services(&node)?;
+
+    let feedback = PrepareFeedback {
+        publish_subscribe: manifest
+            .publish_subscribe
+            .iter()
+            .map(|entry| entry.name.clone())
+            .collect(),
+        event: manifest
+            .event
+            .iter()
+            .map(|entry| entry.name.clone())
+            .collect(),
+    };
+    println!("{}", format.as_string(&feedback)?);
+    std::io::stdout().flush()?;
+
+    let cycle_time = Duration::from_millis(100);
+    while node.wait(cycle_time).is_ok() {}
+
+    drop(services);
+
+    Ok(())
+}
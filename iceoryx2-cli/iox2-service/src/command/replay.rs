@@ -13,11 +13,11 @@
 use core::ptr::copy_nonoverlapping;
 use core::time::Duration;
 use std::io::Write;
-use std::time::Instant;
 
 use crate::cli::ReplayOptions;
 use crate::command::get_pubsub_service_types;
 use anyhow::Result;
+use iceoryx2::port::publisher::Publisher;
 use iceoryx2::prelude::*;
 use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
 use iceoryx2::service::static_config::message_type_details::TypeVariant;
@@ -27,12 +27,56 @@ use iceoryx2_userland_record_and_replay::record_header::{
     FILE_FORMAT_HUMAN_READABLE_VERSION, FILE_FORMAT_IOX2_DUMP_VERSION, RecordHeaderDetails,
 };
 
+enum Records {
+    Buffered(Vec<Record>),
+    Mapped(MappedReplayer),
+}
+
+/// Loans a sample, fills it with the recorded data and sends it when the recorded timestamp
+/// is due. The sample is prepared before waiting so that only the send is on the time line.
+fn replay_record(
+    publisher: &Publisher<ipc::Service, [CustomPayloadMarker], CustomHeaderMarker>,
+    payload_variant: TypeVariant,
+    timer: &ReplayTimer,
+    timestamp: Duration,
+    user_header: &[u8],
+    payload: &[u8],
+) -> Result<()> {
+    let payload_len = match payload_variant {
+        TypeVariant::FixedSize => 1,
+        TypeVariant::Dynamic => payload.len(),
+    };
+
+    let sample = unsafe {
+        let mut sample = publisher.loan_custom_payload(payload_len)?;
+        copy_nonoverlapping(
+            payload.as_ptr(),
+            sample.payload_mut().as_ptr() as *mut u8,
+            payload.len(),
+        );
+        if !user_header.is_empty() {
+            copy_nonoverlapping(
+                user_header.as_ptr(),
+                (sample.user_header_mut() as *mut CustomHeaderMarker) as *mut u8,
+                user_header.len(),
+            );
+        }
+        sample.assume_init()
+    };
+
+    timer.wait_until(timestamp)?;
+    sample.send()?;
+
+    Ok(())
+}
+
 pub(crate) fn replay(options: ReplayOptions, _format: Format) -> Result<()> {
     let node = NodeBuilder::new()
         .name(&NodeName::new(&options.node_name)?)
         .create::<ipc::Service>()?;
 
-    let replay = ReplayerOpener::new(&FilePath::new(options.input.as_bytes())?)
+    let input = FilePath::new(options.input.as_bytes())?;
+    let replay = ReplayerOpener::new(&input)
         .data_representation(options.data_representation.into())
         .open()?;
 
@@ -41,11 +85,18 @@ pub(crate) fn replay(options: ReplayOptions, _format: Format) -> Result<()> {
         None => replay.header().service_name,
     };
 
+    let supported_file_format_version = match options.data_representation {
+        crate::cli::DataRepresentation::HumanReadable => FILE_FORMAT_HUMAN_READABLE_VERSION,
+        crate::cli::DataRepresentation::Iox2Dump => FILE_FORMAT_IOX2_DUMP_VERSION,
+    };
+
+    // older file formats can still be read
     let required_header = RecordHeaderDetails {
-        file_format_version: match options.data_representation {
-            crate::cli::DataRepresentation::HumanReadable => FILE_FORMAT_HUMAN_READABLE_VERSION,
-            crate::cli::DataRepresentation::Iox2Dump => FILE_FORMAT_IOX2_DUMP_VERSION,
-        },
+        file_format_version: replay
+            .header()
+            .details
+            .file_format_version
+            .min(supported_file_format_version),
         types: get_pubsub_service_types(&service_name, &node)?,
         messaging_pattern: options.messaging_pattern.into(),
     };
@@ -57,7 +108,17 @@ pub(crate) fn replay(options: ReplayOptions, _format: Format) -> Result<()> {
         ));
     }
 
-    let buffer = replay.read_into_buffer()?;
+    // binary recordings are mapped instead of decoded into buffers so that the samples are
+    // filled directly from the file
+    let records = match options.data_representation {
+        crate::cli::DataRepresentation::HumanReadable => {
+            Records::Buffered(replay.read_into_buffer()?)
+        }
+        crate::cli::DataRepresentation::Iox2Dump => {
+            drop(replay);
+            Records::Mapped(MappedReplayerOpener::new(&input).open()?)
+        }
+    };
 
     let service = unsafe {
         node.service_builder(&service_name)
@@ -77,41 +138,43 @@ pub(crate) fn replay(options: ReplayOptions, _format: Format) -> Result<()> {
             .create()?,
     };
 
+    let mut timer = ReplayTimerBuilder::new()
+        .time_factor(options.time_factor as f64)
+        .create()?;
+
     println!("Start replaying data on \"{service_name}\".");
     for n in 0..u64::MAX {
-        let start = Instant::now();
-        for data in &buffer {
-            let payload_len = match required_header.types.payload.variant() {
-                TypeVariant::FixedSize => 1,
-                TypeVariant::Dynamic => data.payload.len(),
-            };
-
-            let sample = unsafe {
-                let mut sample = publisher.loan_custom_payload(payload_len)?;
-                copy_nonoverlapping(
-                    data.payload.as_ptr(),
-                    sample.payload_mut().as_ptr() as *mut u8,
-                    data.payload.len(),
-                );
-                if !data.user_header.is_empty() {
-                    copy_nonoverlapping(
-                        data.user_header.as_ptr(),
-                        (sample.user_header_mut() as *mut CustomHeaderMarker) as *mut u8,
-                        data.user_header.len(),
-                    );
+        timer.restart()?;
+        let payload_variant = required_header.types.payload.variant();
+        match &records {
+            Records::Buffered(buffer) => {
+                for data in buffer {
+                    replay_record(
+                        &publisher,
+                        payload_variant,
+                        &timer,
+                        data.timestamp,
+                        &data.user_header,
+                        &data.payload,
+                    )?;
+                    print!(".");
+                    std::io::stdout().flush()?;
+                }
+            }
+            Records::Mapped(replayer) => {
+                for data in replayer.records_from(0) {
+                    replay_record(
+                        &publisher,
+                        payload_variant,
+                        &timer,
+                        data.timestamp,
+                        data.user_header,
+                        data.payload,
+                    )?;
+                    print!(".");
+                    std::io::stdout().flush()?;
                 }
-                sample.assume_init()
-            };
-
-            let elapsed = start.elapsed().as_millis() as f64 * options.time_factor as f64;
-            let timestamp = data.timestamp.as_millis() as f64 * options.time_factor as f64;
-            if elapsed < timestamp {
-                std::thread::sleep(Duration::from_millis((timestamp - elapsed) as u64));
             }
-
-            sample.send()?;
-            print!(".");
-            std::io::stdout().flush()?;
         }
 
         if options.repetitions <= n {
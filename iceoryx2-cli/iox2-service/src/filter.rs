@@ -13,6 +13,7 @@
 use crate::cli::OutputFilter;
 use iceoryx2::service::ServiceDetails;
 use iceoryx2::service::ipc::Service;
+use iceoryx2::service::static_config::StaticConfig;
 use iceoryx2_cli::filter::Filter;
 
 impl Filter<ServiceDetails<Service>> for OutputFilter {
@@ -20,3 +21,9 @@ impl Filter<ServiceDetails<Service>> for OutputFilter {
         self.pattern.matches(service)
     }
 }
+
+impl Filter<StaticConfig> for OutputFilter {
+    fn matches(&self, static_config: &StaticConfig) -> bool {
+        self.pattern.matches(static_config)
+    }
+}
@@ -51,6 +51,11 @@ fn main() -> Result<()> {
                     error!("failed to retrieve service details: {}", e);
                 }
             }
+            Action::Memory(options) => {
+                if let Err(e) = command::memory(options.service, options.filter, cli.format) {
+                    error!("failed to retrieve service memory footprint: {}", e);
+                }
+            }
             Action::Publish(options) => {
                 if let Err(e) = command::publish(options, cli.format) {
                     error!("failed to publish messages: {}", e);
@@ -76,6 +81,11 @@ fn main() -> Result<()> {
                     error!("failed to measure service frequency: {}", e);
                 }
             }
+            Action::Prepare(options) => {
+                if let Err(e) = command::prepare(options, cli.format) {
+                    error!("failed to prepare services: {}", e);
+                }
+            }
             Action::Discovery(options) => {
                 let should_publish = !options.disable_publish;
                 let should_notify = !options.disable_notify;
@@ -91,6 +101,17 @@ fn main() -> Result<()> {
                     error!("failed to run service discovery: {:#}", e)
                 }
             }
+            Action::Introspection(options) => {
+                let should_notify = !options.disable_notify;
+                if let Err(e) = command::introspection(
+                    options.rate,
+                    options.max_subscribers,
+                    should_notify,
+                    options.max_listeners,
+                ) {
+                    error!("failed to run service introspection: {:#}", e)
+                }
+            }
         }
     } else {
         Cli::command().print_help().expect("Failed to print help");
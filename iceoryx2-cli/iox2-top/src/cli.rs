@@ -0,0 +1,67 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use clap::Parser;
+use clap::ValueEnum;
+
+use iceoryx2_cli::help_template;
+
+#[derive(Debug, Clone, Copy, ValueEnum)]
+#[clap(rename_all = "PascalCase")]
+pub enum SortKey {
+    Messages,
+    Bytes,
+    Overflows,
+    FailedLoans,
+    Name,
+}
+
+#[derive(Parser)]
+#[command(
+    name = "iox2 top",
+    bin_name = "iox2 top",
+    about = "Show the throughput and queue pressure of all services live",
+    long_about = None,
+    version = env!("CARGO_PKG_VERSION"),
+    disable_help_subcommand = true,
+    arg_required_else_help = false,
+    help_template = help_template().build(),
+)]
+pub struct Cli {
+    #[clap(
+        short,
+        long,
+        default_value = "1000",
+        help = "Refresh interval in milliseconds"
+    )]
+    pub interval: u64,
+
+    #[clap(short, long, value_enum, default_value_t = SortKey::Messages, help = "Column the services are sorted by")]
+    pub sort: SortKey,
+
+    #[clap(short, long, help = "Show the statistics of every port of a service")]
+    pub ports: bool,
+
+    #[clap(
+        short = 'n',
+        long,
+        help = "Maximum number of services that are shown [default: all]"
+    )]
+    pub max_services: Option<usize>,
+
+    #[clap(
+        short = 'c',
+        long,
+        help = "Number of refreshes until the command exits [default: until a termination signal is received]"
+    )]
+    pub count: Option<u64>,
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+mod cli;
+mod top;
+
+use anyhow::Result;
+use clap::Parser;
+use cli::Cli;
+use iceoryx2_cli::install_panic_handlers;
+use iceoryx2_log::error;
+use iceoryx2_log::{LogLevel, set_log_level_from_env_or};
+
+fn main() -> Result<()> {
+    install_panic_handlers!();
+
+    set_log_level_from_env_or(LogLevel::Warn);
+
+    let cli = Cli::parse();
+    if let Err(e) = top::top(cli) {
+        error!("failed to show service statistics: {}", e);
+    }
+
+    Ok(())
+}
@@ -0,0 +1,442 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::time::Duration;
+use std::collections::BTreeMap;
+use std::io::{IsTerminal, Write};
+use std::time::Instant;
+
+use anyhow::{Context, Error, Result, anyhow};
+use iceoryx2::port::statistics::PortStatistics;
+use iceoryx2::prelude::*;
+use iceoryx2::service::service_hash::ServiceHash;
+use iceoryx2::service::static_config::message_type_details::TypeVariant;
+use iceoryx2::service::static_config::messaging_pattern::MessagingPattern as StaticMessagingPattern;
+use iceoryx2_cli::probe::parallel_probe;
+use iceoryx2_pal_posix::posix::pid_t;
+
+use crate::cli::{Cli, SortKey};
+
+const CLEAR_SCREEN: &str = "\x1b[2J\x1b[H";
+
+/// The counters of a single port of a service at one point in time.
+#[derive(Debug, Clone)]
+struct PortSample {
+    kind: &'static str,
+    id: String,
+    pid: pid_t,
+    name: String,
+    statistics: PortStatistics,
+}
+
+/// The counters of a service at one point in time.
+#[derive(Debug, Clone)]
+struct ServiceSample {
+    name: String,
+    pattern: &'static str,
+    /// The size of a message, it is only known for fixed-size payloads.
+    message_size: Option<usize>,
+    /// The accumulated counters of the sending ports, e.g. publishers.
+    senders: PortStatistics,
+    /// The accumulated counters of the receiving ports, e.g. subscribers.
+    receivers: PortStatistics,
+    number_of_ports: usize,
+    /// The counters of the individual ports, only available for publish-subscribe.
+    ports: Vec<PortSample>,
+}
+
+/// The counters of all services, indexed by their service hash.
+type Snapshot = BTreeMap<String, ServiceSample>;
+
+/// The change of the counters of a port during one refresh interval.
+struct PortRow {
+    kind: &'static str,
+    id: String,
+    pid: pid_t,
+    name: String,
+    sent_per_second: f64,
+    received_per_second: f64,
+    overflows_per_second: f64,
+    failed_loans: u64,
+}
+
+/// The change of the counters of a service during one refresh interval.
+struct ServiceRow {
+    name: String,
+    pattern: &'static str,
+    number_of_ports: usize,
+    sent_per_second: f64,
+    received_per_second: f64,
+    bytes_per_second: Option<f64>,
+    overflows_per_second: f64,
+    failed_loans: u64,
+    ports: Vec<PortRow>,
+}
+
+impl ServiceRow {
+    fn messages_per_second(&self) -> f64 {
+        self.sent_per_second + self.received_per_second
+    }
+}
+
+pub(crate) fn top(cli: Cli) -> Result<()> {
+    let config = Config::global_config();
+    let interval = Duration::from_millis(cli.interval.max(1));
+
+    let mut previous = snapshot(config)?;
+    let mut previous_time = Instant::now();
+    let mut number_of_refreshes = 0;
+    let mut error: Option<Error> = None;
+
+    let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+    let guard = waitset
+        .attach_interval(interval)
+        .map_err(|e| anyhow!("failed to attach interval to waitset: {:?}", e))?;
+    let tick = WaitSetAttachmentId::from_guard(&guard);
+
+    let on_event = |id: WaitSetAttachmentId<ipc::Service>| {
+        if id != tick {
+            return CallbackProgression::Continue;
+        }
+
+        let current = match snapshot(config) {
+            Ok(current) => current,
+            Err(e) => {
+                error = Some(e);
+                return CallbackProgression::Stop;
+            }
+        };
+        let current_time = Instant::now();
+        let elapsed = current_time.duration_since(previous_time).as_secs_f64();
+
+        let rows = service_rows(&previous, &current, elapsed, cli.sort);
+        if let Err(e) = print_rows(&rows, &cli) {
+            error = Some(e);
+            return CallbackProgression::Stop;
+        }
+
+        previous = current;
+        previous_time = current_time;
+        number_of_refreshes += 1;
+
+        match cli.count {
+            Some(count) if number_of_refreshes >= count => CallbackProgression::Stop,
+            _ => CallbackProgression::Continue,
+        }
+    };
+
+    waitset
+        .wait_and_process(on_event)
+        .map_err(|e| anyhow!("error waiting on waitset: {:?}", e))?;
+
+    match error {
+        Some(e) => Err(e),
+        None => Ok(()),
+    }
+}
+
+/// Acquires the counters of all services. The services are inspected read-only in parallel,
+/// services that are removed in the meantime are skipped.
+fn snapshot(config: &Config) -> Result<Snapshot> {
+    let mut service_hashes = Vec::new();
+    ipc::Service::list_service_hashes(config, |service_hash| {
+        service_hashes.push(service_hash);
+        CallbackProgression::Continue
+    })
+    .context("failed to retrieve services")?;
+
+    Ok(parallel_probe(&service_hashes, |service_hash| {
+        sample(config, service_hash).map(|sample| (service_hash.as_str().to_string(), sample))
+    })
+    .into_iter()
+    .collect())
+}
+
+fn sample(config: &Config, service_hash: &ServiceHash) -> Option<ServiceSample> {
+    let inspector = ipc::Service::inspect_from_service_hash(config, service_hash).ok()??;
+    let static_config = inspector.static_config();
+
+    let mut sample = ServiceSample {
+        name: static_config.name().to_string(),
+        pattern: "Undefined",
+        message_size: None,
+        senders: PortStatistics::default(),
+        receivers: PortStatistics::default(),
+        number_of_ports: 0,
+        ports: Vec::new(),
+    };
+
+    match static_config.messaging_pattern() {
+        StaticMessagingPattern::PublishSubscribe(pubsub) => {
+            sample.pattern = "PublishSubscribe";
+            let payload = &pubsub.message_type_details().payload;
+            if payload.variant() == TypeVariant::FixedSize {
+                sample.message_size = Some(payload.size());
+            }
+
+            if let Some(dynamic_config) = inspector.publish_subscribe() {
+                dynamic_config.list_publisher_statistics(|details, statistics| {
+                    sample.senders += statistics;
+                    sample.ports.push(PortSample {
+                        kind: "Publisher",
+                        id: details.publisher_id.to_string(),
+                        pid: details.publisher_id.pid().value(),
+                        name: details.publisher_name.to_string(),
+                        statistics,
+                    });
+                    CallbackProgression::Continue
+                });
+                dynamic_config.list_subscriber_statistics(|details, statistics| {
+                    sample.receivers += statistics;
+                    sample.ports.push(PortSample {
+                        kind: "Subscriber",
+                        id: details.subscriber_id.to_string(),
+                        pid: details.subscriber_id.pid().value(),
+                        name: details.subscriber_name.to_string(),
+                        statistics,
+                    });
+                    CallbackProgression::Continue
+                });
+                sample.number_of_ports = sample.ports.len();
+            }
+        }
+        StaticMessagingPattern::Event(_) => {
+            sample.pattern = "Event";
+            if let Some(dynamic_config) = inspector.event() {
+                sample.receivers = dynamic_config.listener_statistics();
+                sample.number_of_ports =
+                    dynamic_config.number_of_notifiers() + dynamic_config.number_of_listeners();
+            }
+        }
+        StaticMessagingPattern::RequestResponse(_) => {
+            sample.pattern = "RequestResponse";
+            if let Some(dynamic_config) = inspector.request_response() {
+                // a server receives requests and sends responses
+                let statistics = dynamic_config.server_statistics();
+                sample.senders = PortStatistics {
+                    received: 0,
+                    ..statistics
+                };
+                sample.receivers = PortStatistics {
+                    received: statistics.received,
+                    ..PortStatistics::default()
+                };
+                sample.number_of_ports =
+                    dynamic_config.number_of_clients() + dynamic_config.number_of_servers();
+            }
+        }
+        StaticMessagingPattern::Blackboard(_) => {
+            sample.pattern = "Blackboard";
+            if let Some(dynamic_config) = inspector.blackboard() {
+                sample.number_of_ports =
+                    dynamic_config.number_of_readers() + dynamic_config.number_of_writers();
+            }
+        }
+        _ => (),
+    }
+
+    Some(sample)
+}
+
+/// The counters are reset when the slot of a port is reused, therefore a decreasing counter
+/// is treated as restarted.
+fn per_second(current: u64, previous: u64, elapsed: f64) -> f64 {
+    if current < previous || elapsed <= 0.0 {
+        return 0.0;
+    }
+
+    (current - previous) as f64 / elapsed
+}
+
+fn service_rows(
+    previous: &Snapshot,
+    current: &Snapshot,
+    elapsed: f64,
+    sort: SortKey,
+) -> Vec<ServiceRow> {
+    let mut rows: Vec<ServiceRow> = current
+        .iter()
+        .map(|(service_hash, service)| {
+            let (previous_senders, previous_receivers) = previous
+                .get(service_hash)
+                .map(|p| (p.senders, p.receivers))
+                .unwrap_or_default();
+
+            let sent_per_second = per_second(service.senders.sent, previous_senders.sent, elapsed);
+            let previous_ports: BTreeMap<&str, &PortStatistics> = previous
+                .get(service_hash)
+                .map(|p| {
+                    p.ports
+                        .iter()
+                        .map(|port| (port.id.as_str(), &port.statistics))
+                        .collect()
+                })
+                .unwrap_or_default();
+
+            ServiceRow {
+                name: service.name.clone(),
+                pattern: service.pattern,
+                number_of_ports: service.number_of_ports,
+                sent_per_second,
+                received_per_second: per_second(
+                    service.receivers.received,
+                    previous_receivers.received,
+                    elapsed,
+                ),
+                bytes_per_second: service
+                    .message_size
+                    .map(|size| sent_per_second * size as f64),
+                overflows_per_second: per_second(
+                    service.senders.overflows + service.receivers.overflows,
+                    previous_senders.overflows + previous_receivers.overflows,
+                    elapsed,
+                ),
+                failed_loans: service.senders.failed_loans + service.receivers.failed_loans,
+                ports: service
+                    .ports
+                    .iter()
+                    .map(|port| {
+                        let previous = previous_ports
+                            .get(port.id.as_str())
+                            .copied()
+                            .copied()
+                            .unwrap_or_default();
+                        PortRow {
+                            kind: port.kind,
+                            id: port.id.clone(),
+                            pid: port.pid,
+                            name: port.name.clone(),
+                            sent_per_second: per_second(
+                                port.statistics.sent,
+                                previous.sent,
+                                elapsed,
+                            ),
+                            received_per_second: per_second(
+                                port.statistics.received,
+                                previous.received,
+                                elapsed,
+                            ),
+                            overflows_per_second: per_second(
+                                port.statistics.overflows,
+                                previous.overflows,
+                                elapsed,
+                            ),
+                            failed_loans: port.statistics.failed_loans,
+                        }
+                    })
+                    .collect(),
+            }
+        })
+        .collect();
+
+    match sort {
+        SortKey::Messages => rows.sort_by(|lhs, rhs| {
+            rhs.messages_per_second()
+                .total_cmp(&lhs.messages_per_second())
+        }),
+        SortKey::Bytes => rows.sort_by(|lhs, rhs| {
+            rhs.bytes_per_second
+                .unwrap_or(0.0)
+                .total_cmp(&lhs.bytes_per_second.unwrap_or(0.0))
+        }),
+        SortKey::Overflows => rows.sort_by(|lhs, rhs| {
+            rhs.overflows_per_second
+                .total_cmp(&lhs.overflows_per_second)
+        }),
+        SortKey::FailedLoans => rows.sort_by_key(|row| core::cmp::Reverse(row.failed_loans)),
+        SortKey::Name => rows.sort_by(|lhs, rhs| lhs.name.cmp(&rhs.name)),
+    }
+
+    rows
+}
+
+/// Formats a rate with a metric suffix, e.g. `12.3k`.
+fn human_readable(value: f64) -> String {
+    const SUFFIXES: [&str; 5] = ["", "k", "M", "G", "T"];
+
+    let mut value = value;
+    let mut suffix = 0;
+    while value >= 1000.0 && suffix < SUFFIXES.len() - 1 {
+        value /= 1000.0;
+        suffix += 1;
+    }
+
+    format!("{value:.1}{}", SUFFIXES[suffix])
+}
+
+fn print_rows(rows: &[ServiceRow], cli: &Cli) -> Result<()> {
+    let mut stdout = std::io::stdout().lock();
+    let number_of_services = rows.len();
+    let rows = &rows[..cli.max_services.unwrap_or(rows.len()).min(rows.len())];
+    let name_width = rows
+        .iter()
+        .map(|row| row.name.len())
+        .max()
+        .unwrap_or(0)
+        .max("SERVICE".len());
+
+    if stdout.is_terminal() {
+        write!(stdout, "{CLEAR_SCREEN}")?;
+    }
+
+    writeln!(
+        stdout,
+        "{number_of_services} services, refreshed every {}ms, sorted by {:?}",
+        cli.interval, cli.sort
+    )?;
+    writeln!(
+        stdout,
+        "{:<name_width$} {:<16} {:>5} {:>9} {:>9} {:>9} {:>11} {:>12}",
+        "SERVICE", "PATTERN", "PORTS", "SENT/s", "RECV/s", "BYTES/s", "OVERFLOW/s", "FAILED LOANS"
+    )?;
+
+    for row in rows {
+        writeln!(
+            stdout,
+            "{:<name_width$} {:<16} {:>5} {:>9} {:>9} {:>9} {:>11} {:>12}",
+            row.name,
+            row.pattern,
+            row.number_of_ports,
+            human_readable(row.sent_per_second),
+            human_readable(row.received_per_second),
+            row.bytes_per_second
+                .map(human_readable)
+                .unwrap_or_else(|| "-".to_string()),
+            human_readable(row.overflows_per_second),
+            row.failed_loans
+        )?;
+
+        if cli.ports {
+            for port in &row.ports {
+                writeln!(
+                    stdout,
+                    "  {:<10} {} (pid {}) {} | sent/s {} | recv/s {} | overflow/s {} | failed loans {}",
+                    port.kind,
+                    port.id,
+                    port.pid,
+                    port.name,
+                    human_readable(port.sent_per_second),
+                    human_readable(port.received_per_second),
+                    human_readable(port.overflows_per_second),
+                    port.failed_loans
+                )?;
+            }
+        }
+    }
+
+    if !stdout.is_terminal() {
+        writeln!(stdout)?;
+    }
+    stdout.flush()?;
+
+    Ok(())
+}
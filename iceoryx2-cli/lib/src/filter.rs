@@ -16,8 +16,11 @@ use core::fmt::Debug;
 use core::str::FromStr;
 use iceoryx2::node::NodeState;
 use iceoryx2::node::NodeView;
+use iceoryx2::node::list_filter::NodeStateFilter;
 use iceoryx2::service::ServiceDetails;
 use iceoryx2::service::ipc::Service;
+use iceoryx2::service::messaging_pattern::MessagingPattern as ServiceMessagingPattern;
+use iceoryx2::service::static_config::StaticConfig;
 use iceoryx2::service::static_config::messaging_pattern::MessagingPattern;
 use iceoryx2_pal_posix::posix::pid_t;
 
@@ -96,6 +99,21 @@ impl Filter<NodeState<Service>> for NodeIdentifier {
     }
 }
 
+impl StateFilter {
+    /// The [`NodeStateFilter`] that lets
+    /// [`Node::list_filtered()`](iceoryx2::node::Node::list_filtered()) skip the details of
+    /// all other nodes, or [`None`] when nodes of every state are listed.
+    pub fn as_node_state_filter(&self) -> Option<NodeStateFilter> {
+        match self {
+            StateFilter::Alive => Some(NodeStateFilter::Alive),
+            StateFilter::Dead => Some(NodeStateFilter::Dead),
+            StateFilter::Inaccessible => Some(NodeStateFilter::Inaccessible),
+            StateFilter::Undefined => Some(NodeStateFilter::Undefined),
+            StateFilter::All => None,
+        }
+    }
+}
+
 impl Filter<NodeState<Service>> for StateFilter {
     fn matches(&self, node: &NodeState<Service>) -> bool {
         matches!(
@@ -120,25 +138,50 @@ pub enum MessagingPatternFilter {
     All,
 }
 
+impl MessagingPatternFilter {
+    /// The messaging patterns of the services that can match the filter.
+    pub fn messaging_patterns(&self) -> &'static [ServiceMessagingPattern] {
+        match self {
+            MessagingPatternFilter::All => &[
+                ServiceMessagingPattern::PublishSubscribe,
+                ServiceMessagingPattern::Event,
+                ServiceMessagingPattern::RequestResponse,
+                ServiceMessagingPattern::Blackboard,
+            ],
+            MessagingPatternFilter::PublishSubscribe => {
+                &[ServiceMessagingPattern::PublishSubscribe]
+            }
+            MessagingPatternFilter::Event => &[ServiceMessagingPattern::Event],
+            MessagingPatternFilter::RequestResponse => &[ServiceMessagingPattern::RequestResponse],
+        }
+    }
+}
+
 impl Filter<ServiceDetails<Service>> for MessagingPatternFilter {
     fn matches(&self, service: &ServiceDetails<Service>) -> bool {
+        self.matches(&service.static_details)
+    }
+}
+
+impl Filter<StaticConfig> for MessagingPatternFilter {
+    fn matches(&self, static_config: &StaticConfig) -> bool {
         match self {
             MessagingPatternFilter::All => true,
             MessagingPatternFilter::PublishSubscribe => {
                 matches!(
-                    service.static_details.messaging_pattern(),
+                    static_config.messaging_pattern(),
                     MessagingPattern::PublishSubscribe(_)
                 )
             }
             MessagingPatternFilter::Event => {
                 matches!(
-                    service.static_details.messaging_pattern(),
+                    static_config.messaging_pattern(),
                     MessagingPattern::Event(_)
                 )
             }
             MessagingPatternFilter::RequestResponse => {
                 matches!(
-                    service.static_details.messaging_pattern(),
+                    static_config.messaging_pattern(),
                     MessagingPattern::RequestResponse(_)
                 )
             }
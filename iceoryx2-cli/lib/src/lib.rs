@@ -16,7 +16,9 @@ mod format;
 mod panic;
 
 pub mod filter;
+pub mod manifest;
 pub mod output;
+pub mod probe;
 
 pub use cli::*;
 pub use format::Format;
@@ -0,0 +1,318 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A service manifest describes a fixed service topology in TOML. All services of a manifest
+//! can be created in one pass at boot so that the processes of the system only have to open
+//! them.
+//!
+//! ```toml
+//! [[publish-subscribe]]
+//! name = "My/Camera/Service"
+//! type-name = "u64"
+//! type-size = 8
+//! type-alignment = 8
+//! max-publishers = 1
+//! max-subscribers = 4
+//!
+//! [[event]]
+//! name = "My/Camera/Event"
+//! max-listeners = 2
+//! ```
+//!
+//! Settings that are not provided are taken from the defaults of the
+//! [`Config`](iceoryx2::config::Config).
+
+use std::path::Path;
+
+use anyhow::{Context, Result};
+use iceoryx2::prelude::*;
+use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
+use iceoryx2::service::port_factory::event::PortFactory as EventPortFactory;
+use iceoryx2::service::port_factory::publish_subscribe::PortFactory as PublishSubscribePortFactory;
+use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeName, TypeVariant};
+use serde::Deserialize;
+
+/// The [`TypeVariant`] of a payload in the manifest.
+#[derive(Deserialize, Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub enum ManifestTypeVariant {
+    /// The payload has always the same size.
+    #[default]
+    FixedSize,
+    /// The payload is a slice whose length is defined when it is loaned.
+    Dynamic,
+}
+
+impl From<ManifestTypeVariant> for TypeVariant {
+    fn from(value: ManifestTypeVariant) -> Self {
+        match value {
+            ManifestTypeVariant::FixedSize => TypeVariant::FixedSize,
+            ManifestTypeVariant::Dynamic => TypeVariant::Dynamic,
+        }
+    }
+}
+
+/// A publish-subscribe service of the manifest. The type details must match the types the
+/// processes use when they open the service.
+#[derive(Deserialize, Debug, Clone, PartialEq, Eq)]
+#[serde(rename_all = "kebab-case")]
+#[serde(deny_unknown_fields)]
+pub struct PublishSubscribeEntry {
+    pub name: String,
+    pub type_name: String,
+    pub type_size: usize,
+    pub type_alignment: usize,
+    #[serde(default)]
+    pub type_variant: ManifestTypeVariant,
+    #[serde(default = "default_header_type_name")]
+    pub header_type_name: String,
+    #[serde(default)]
+    pub header_type_size: usize,
+    #[serde(default = "default_alignment")]
+    pub header_type_alignment: usize,
+    pub max_publishers: Option<usize>,
+    pub max_subscribers: Option<usize>,
+    pub max_nodes: Option<usize>,
+    pub history_size: Option<usize>,
+    pub subscriber_max_buffer_size: Option<usize>,
+    pub subscriber_max_borrowed_samples: Option<usize>,
+    pub enable_safe_overflow: Option<bool>,
+}
+
+/// An event service of the manifest.
+#[derive(Deserialize, Debug, Clone, PartialEq, Eq)]
+#[serde(rename_all = "kebab-case")]
+#[serde(deny_unknown_fields)]
+pub struct EventEntry {
+    pub name: String,
+    pub max_listeners: Option<usize>,
+    pub max_notifiers: Option<usize>,
+    pub max_nodes: Option<usize>,
+    pub event_id_max_value: Option<usize>,
+}
+
+/// All services of a system that shall be created at boot.
+#[derive(Deserialize, Debug, Clone, Default, PartialEq, Eq)]
+#[serde(rename_all = "kebab-case")]
+#[serde(deny_unknown_fields)]
+pub struct Manifest {
+    #[serde(default)]
+    pub publish_subscribe: Vec<PublishSubscribeEntry>,
+    #[serde(default)]
+    pub event: Vec<EventEntry>,
+}
+
+/// The services created from a [`Manifest`]. They exist as long as this object and the
+/// [`Node`] that created them are alive.
+pub struct PreparedServices {
+    pub publish_subscribe:
+        Vec<PublishSubscribePortFactory<ipc::Service, [CustomPayloadMarker], CustomHeaderMarker>>,
+    pub event: Vec<EventPortFactory<ipc::Service>>,
+}
+
+impl PreparedServices {
+    /// Returns the number of created services.
+    pub fn len(&self) -> usize {
+        self.publish_subscribe.len() + self.event.len()
+    }
+
+    /// Returns true when no service was created.
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+fn default_header_type_name() -> String {
+    "()".to_string()
+}
+
+fn default_alignment() -> usize {
+    1
+}
+
+fn type_detail(
+    name: &str,
+    size: usize,
+    alignment: usize,
+    variant: TypeVariant,
+) -> Result<TypeDetail> {
+    let mut type_detail = TypeDetail::new::<()>(variant);
+    iceoryx2::testing::type_detail_set_size(&mut type_detail, size);
+    iceoryx2::testing::type_detail_set_alignment(&mut type_detail, alignment);
+    iceoryx2::testing::type_detail_set_name(&mut type_detail, TypeName::from_str_truncated(name)?);
+    Ok(type_detail)
+}
+
+impl Manifest {
+    /// Parses a manifest from a TOML string.
+    pub fn from_toml(content: &str) -> Result<Self> {
+        toml::from_str(content).context("invalid service manifest")
+    }
+
+    /// Reads and parses the manifest file at `path`.
+    pub fn from_file(path: &Path) -> Result<Self> {
+        let content = std::fs::read_to_string(path)
+            .with_context(|| format!("unable to read the service manifest {}", path.display()))?;
+        Self::from_toml(&content)
+    }
+
+    /// Opens or creates every service of the manifest with the provided [`Node`]. Services
+    /// that already exist are opened, and the call fails when their settings are
+    /// incompatible with the manifest.
+    pub fn create_services(&self, node: &Node<ipc::Service>) -> Result<PreparedServices> {
+        let mut services = PreparedServices {
+            publish_subscribe: Vec::with_capacity(self.publish_subscribe.len()),
+            event: Vec::with_capacity(self.event.len()),
+        };
+
+        for entry in &self.publish_subscribe {
+            services.publish_subscribe.push(
+                Self::create_publish_subscribe(node, entry).with_context(|| {
+                    format!("unable to create publish-subscribe service {}", entry.name)
+                })?,
+            );
+        }
+
+        for entry in &self.event {
+            services.event.push(
+                Self::create_event(node, entry)
+                    .with_context(|| format!("unable to create event service {}", entry.name))?,
+            );
+        }
+
+        Ok(services)
+    }
+
+    fn create_publish_subscribe(
+        node: &Node<ipc::Service>,
+        entry: &PublishSubscribeEntry,
+    ) -> Result<PublishSubscribePortFactory<ipc::Service, [CustomPayloadMarker], CustomHeaderMarker>>
+    {
+        let payload_type = type_detail(
+            &entry.type_name,
+            entry.type_size,
+            entry.type_alignment,
+            entry.type_variant.into(),
+        )?;
+        let header_type = type_detail(
+            &entry.header_type_name,
+            entry.header_type_size,
+            entry.header_type_alignment,
+            TypeVariant::FixedSize,
+        )?;
+
+        let mut builder = unsafe {
+            node.service_builder(&ServiceName::new(&entry.name)?)
+                .publish_subscribe::<[CustomPayloadMarker]>()
+                .user_header::<CustomHeaderMarker>()
+                .__internal_set_payload_type_details(&payload_type)
+                .__internal_set_user_header_type_details(&header_type)
+        };
+
+        if let Some(value) = entry.max_publishers {
+            builder = builder.max_publishers(value);
+        }
+        if let Some(value) = entry.max_subscribers {
+            builder = builder.max_subscribers(value);
+        }
+        if let Some(value) = entry.max_nodes {
+            builder = builder.max_nodes(value);
+        }
+        if let Some(value) = entry.history_size {
+            builder = builder.history_size(value);
+        }
+        if let Some(value) = entry.subscriber_max_buffer_size {
+            builder = builder.subscriber_max_buffer_size(value);
+        }
+        if let Some(value) = entry.subscriber_max_borrowed_samples {
+            builder = builder.subscriber_max_borrowed_samples(value);
+        }
+        if let Some(value) = entry.enable_safe_overflow {
+            builder = builder.enable_safe_overflow(value);
+        }
+
+        Ok(builder.open_or_create()?)
+    }
+
+    fn create_event(
+        node: &Node<ipc::Service>,
+        entry: &EventEntry,
+    ) -> Result<EventPortFactory<ipc::Service>> {
+        let mut builder = node
+            .service_builder(&ServiceName::new(&entry.name)?)
+            .event();
+
+        if let Some(value) = entry.max_listeners {
+            builder = builder.max_listeners(value);
+        }
+        if let Some(value) = entry.max_notifiers {
+            builder = builder.max_notifiers(value);
+        }
+        if let Some(value) = entry.max_nodes {
+            builder = builder.max_nodes(value);
+        }
+        if let Some(value) = entry.event_id_max_value {
+            builder = builder.event_id_max_value(value);
+        }
+
+        Ok(builder.open_or_create()?)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use iceoryx2_bb_testing::assert_that;
+
+    #[test]
+    fn manifest_is_parsed_with_defaults() {
+        let manifest = Manifest::from_toml(
+            r#"
+            [[publish-subscribe]]
+            name = "camera"
+            type-name = "u64"
+            type-size = 8
+            type-alignment = 8
+            max-subscribers = 4
+
+            [[event]]
+            name = "camera-event"
+            "#,
+        )
+        .unwrap();
+
+        assert_that!(manifest.publish_subscribe, len 1);
+        assert_that!(manifest.event, len 1);
+
+        let entry = &manifest.publish_subscribe[0];
+        assert_that!(entry.type_variant, eq ManifestTypeVariant::FixedSize);
+        assert_that!(entry.header_type_name.as_str(), eq "()");
+        assert_that!(entry.header_type_size, eq 0);
+        assert_that!(entry.header_type_alignment, eq 1);
+        assert_that!(entry.max_subscribers, eq Some(4));
+        assert_that!(entry.max_publishers, eq None);
+        assert_that!(manifest.event[0].max_listeners, eq None);
+    }
+
+    #[test]
+    fn manifest_with_unknown_setting_fails() {
+        assert_that!(
+            Manifest::from_toml(
+                r#"
+                [[event]]
+                name = "camera-event"
+                max-listenerz = 4
+                "#,
+            ),
+            is_err
+        );
+    }
+}
@@ -20,6 +20,7 @@ use iceoryx2::service::Service as IceoryxService;
 use iceoryx2::service::ServiceDetails as IceoryxServiceDetails;
 use iceoryx2::service::ServiceDynamicDetails as IceoryxServiceDynamicDetails;
 use iceoryx2::service::attribute::AttributeSet as IceoryxAttributeSet;
+use iceoryx2::service::static_config::StaticConfig as IceoryxStaticConfig;
 use iceoryx2::service::static_config::messaging_pattern::MessagingPattern as IceoryxMessagingPattern;
 use iceoryx2_pal_posix::posix::pid_t;
 
@@ -36,15 +37,21 @@ where
     T: IceoryxService,
 {
     fn from(service: &IceoryxServiceDetails<T>) -> Self {
-        match service.static_details.messaging_pattern() {
+        ServiceDescriptor::from(&service.static_details)
+    }
+}
+
+impl From<&IceoryxStaticConfig> for ServiceDescriptor {
+    fn from(static_config: &IceoryxStaticConfig) -> Self {
+        match static_config.messaging_pattern() {
             IceoryxMessagingPattern::PublishSubscribe(_) => {
-                ServiceDescriptor::PublishSubscribe(service.static_details.name().to_string())
+                ServiceDescriptor::PublishSubscribe(static_config.name().to_string())
             }
             IceoryxMessagingPattern::Event(_) => {
-                ServiceDescriptor::Event(service.static_details.name().to_string())
+                ServiceDescriptor::Event(static_config.name().to_string())
             }
             IceoryxMessagingPattern::RequestResponse(_) => {
-                ServiceDescriptor::RequestResponse(service.static_details.name().to_string())
+                ServiceDescriptor::RequestResponse(static_config.name().to_string())
             }
             _ => ServiceDescriptor::Undefined("Undefined".to_string()),
         }
@@ -245,3 +252,10 @@ where
         }
     }
 }
+
+#[derive(serde::Serialize, Default)]
+pub struct NodeCleanupReport {
+    pub cleanups: u64,
+    pub failed_cleanups: u64,
+    pub remaining_dead_nodes: usize,
+}
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use std::thread;
+
+/// Calls `probe` for every item and returns the provided results in the order of the items.
+/// The items are distributed over up to [`thread::available_parallelism()`] threads, so that
+/// a large number of independent read-only lookups, like opening the static config of every
+/// service, is not processed serially.
+pub fn parallel_probe<T, R, F>(items: &[T], probe: F) -> Vec<R>
+where
+    T: Sync,
+    R: Send,
+    F: Fn(&T) -> Option<R> + Sync,
+{
+    let number_of_threads = thread::available_parallelism()
+        .map(|n| n.get())
+        .unwrap_or(1)
+        .min(items.len());
+
+    if number_of_threads <= 1 {
+        return items.iter().filter_map(&probe).collect();
+    }
+
+    let chunk_size = items.len().div_ceil(number_of_threads);
+    let probe = &probe;
+    thread::scope(|s| {
+        let workers: Vec<_> = items
+            .chunks(chunk_size)
+            .map(|chunk| s.spawn(move || chunk.iter().filter_map(probe).collect::<Vec<R>>()))
+            .collect();
+
+        workers
+            .into_iter()
+            .flat_map(|worker| worker.join().expect("probe thread panicked"))
+            .collect()
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use iceoryx2_bb_testing::assert_that;
+
+    #[test]
+    fn parallel_probe_preserves_the_order_of_the_items() {
+        let items: Vec<u64> = (0..1000).collect();
+
+        let results = parallel_probe(&items, |item| (item % 3 != 0).then_some(*item * 2));
+
+        let expected: Vec<u64> = items
+            .iter()
+            .filter(|item| *item % 3 != 0)
+            .map(|item| item * 2)
+            .collect();
+        assert_that!(results, eq expected);
+    }
+
+    #[test]
+    fn parallel_probe_with_no_items_returns_nothing() {
+        let results = parallel_probe(&Vec::<u64>::new(), |item| Some(*item));
+
+        assert_that!(results, is_empty);
+    }
+}
@@ -15,8 +15,10 @@
 
 #include "internal/helper.hpp"
 #include "iox2/bb/expected.hpp"
+#include "iox2/bb/static_vector.hpp"
 #include "iox2/custom_payload_marker.hpp"
 #include "iox2/internal/helper.hpp"
+#include "iox2/internal/payload_cache.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/response_mut_uninit.hpp"
 #include "iox2/service_type.hpp"
@@ -63,6 +65,16 @@ class ActiveRequest {
     template <typename T = RequestPayload, typename = std::enable_if_t<bb::IsSlice<T>::VALUE, void>>
     auto send_slice_copy(const bb::ImmutableSlice<ValueType>& payload) const -> bb::Expected<void, SendError>;
 
+    /// Takes the ownership of all provided [`ResponseMut`]s and delivers them in order with
+    /// a single connection update. Every [`ResponseMut`] is delivered even when the delivery
+    /// of a previous one failed. All [`ResponseMut`]s must have been loaned from this
+    /// [`ActiveRequest`].
+    ///
+    /// On failure it returns the first [`SendError`] that occurred.
+    template <uint64_t Capacity>
+    auto send_batch(bb::StaticVector<ResponseMut<Service, ResponsePayload, ResponseUserHeader>, Capacity>&& responses)
+        const -> bb::Expected<void, SendError>;
+
     /// Returns a reference to the payload of the received [`RequestMut`]
     template <typename T = RequestPayload, typename = std::enable_if_t<!bb::IsSlice<T>::VALUE, void>>
     auto payload() const -> const T&;
@@ -110,8 +122,10 @@ class ActiveRequest {
     explicit ActiveRequest(iox2_active_request_h handle) noexcept;
 
     void drop();
+    void cache_payload() const;
 
     iox2_active_request_h m_handle = nullptr;
+    mutable internal::PayloadCache<const void*> m_cache;
 };
 
 template <ServiceType Service,
@@ -135,6 +149,8 @@ inline auto ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePa
         drop();
         m_handle = rhs.m_handle;
         rhs.m_handle = nullptr;
+        m_cache = rhs.m_cache;
+        rhs.m_cache = {};
     }
 
     return *this;
@@ -230,6 +246,32 @@ ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, Respo
     return bb::err(bb::into<SendError>(result));
 }
 
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+template <uint64_t Capacity>
+inline auto ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::send_batch(
+    bb::StaticVector<ResponseMut<Service, ResponsePayload, ResponseUserHeader>, Capacity>&& responses) const
+    -> bb::Expected<void, SendError> {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays), stores only the handles of the responses
+    iox2_response_mut_h response_handles[Capacity];
+    const auto number_of_responses = responses.size();
+    for (uint64_t idx = 0; idx < number_of_responses; ++idx) {
+        auto& response = responses.unchecked_access()[idx];
+        response_handles[idx] = response.m_handle;
+        response.m_handle = nullptr;
+    }
+    responses.clear();
+
+    auto result = iox2_active_request_send_batch(&m_handle, response_handles, number_of_responses);
+    if (result == IOX2_OK) {
+        return {};
+    }
+    return bb::err(bb::into<SendError>(result));
+}
+
 template <ServiceType Service,
           typename RequestPayload,
           typename RequestUserHeader,
@@ -239,9 +281,8 @@ template <typename T, typename>
 inline auto
 ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::payload() const
     -> const T& {
-    const void* ptr = nullptr;
-    iox2_active_request_payload(&m_handle, &ptr, nullptr);
-    return *static_cast<const T*>(ptr);
+    cache_payload();
+    return *static_cast<const T*>(m_cache.payload);
 }
 
 template <ServiceType Service,
@@ -253,19 +294,9 @@ template <typename T, typename>
 inline auto
 ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::payload() const
     -> bb::ImmutableSlice<ValueType> {
-    const void* ptr = nullptr;
-    size_t number_of_elements = 0;
+    cache_payload();
 
-    iox2_active_request_payload(&m_handle, &ptr, &number_of_elements);
-
-    // for the custom payload marker, the slice length is the
-    // runtime payload byte size
-    auto length = number_of_elements;
-    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
-        length = iox2_active_request_payload_number_of_bytes(&m_handle);
-    }
-
-    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(ptr), length);
+    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(m_cache.payload), m_cache.payload_length);
 }
 
 template <ServiceType Service,
@@ -277,9 +308,10 @@ template <typename T, typename>
 inline auto
 ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::user_header() const
     -> const T& {
-    const void* ptr = nullptr;
-    iox2_active_request_user_header(&m_handle, &ptr);
-    return *static_cast<const T*>(ptr);
+    if (m_cache.user_header == nullptr) {
+        iox2_active_request_user_header(&m_handle, &m_cache.user_header);
+    }
+    return *static_cast<const T*>(m_cache.user_header);
 }
 
 template <ServiceType Service,
@@ -290,9 +322,9 @@ template <ServiceType Service,
 inline auto
 ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::header() const
     -> RequestHeader {
-    iox2_request_header_h header_handle = nullptr;
-    iox2_active_request_header(&m_handle, nullptr, &header_handle);
-    return RequestHeader { header_handle };
+    RequestHeader header;
+    iox2_active_request_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType Service,
@@ -387,6 +419,26 @@ inline void ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePa
         m_handle = nullptr;
     }
 }
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+inline void
+ActiveRequest<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::cache_payload() const {
+    if (m_cache.payload != nullptr) {
+        return;
+    }
+
+    iox2_active_request_payload(&m_handle, &m_cache.payload, &m_cache.payload_length);
+
+    // for the custom payload marker, the slice length is the
+    // runtime payload byte size
+    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
+        m_cache.payload_length = iox2_active_request_payload_number_of_bytes(&m_handle);
+    }
+}
 } // namespace iox2
 
 #endif
@@ -26,7 +26,11 @@ enum class AllocationStrategy : uint8_t {
     /// Reduces reallocations a lot at the cost of increased memory usage.
     PowerOfTwo,
     /// The memory is not increased. This may lead to an out-of-memory error when allocating.
-    Static
+    Static,
+    /// Keeps one memory segment for every power of two chunk size and serves every allocation
+    /// from the smallest fitting size class. Avoids that a single large allocation resizes the
+    /// memory of all small allocations.
+    SizeClasses
 };
 } // namespace iox2
 
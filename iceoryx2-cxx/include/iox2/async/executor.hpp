@@ -0,0 +1,532 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_ASYNC_EXECUTOR_HPP
+#define IOX2_ASYNC_EXECUTOR_HPP
+
+#if !defined(__cpp_impl_coroutine)
+#error "The iox2/async layer requires a compiler with C++20 coroutine support."
+#endif
+
+#include "iox2/async/executor_error.hpp"
+#include "iox2/async/task.hpp"
+#include "iox2/bb/detail/builder.hpp"
+#include "iox2/bb/duration.hpp"
+#include "iox2/bb/expected.hpp"
+#include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_function.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/event_activation.hpp"
+#include "iox2/listener.hpp"
+#include "iox2/log.hpp"
+#include "iox2/pending_response.hpp"
+#include "iox2/port_error.hpp"
+#include "iox2/sample.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/subscriber.hpp"
+#include "iox2/waitset.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace iox2 {
+namespace async {
+namespace internal {
+/// A non-blocking operation that an [`Executor`] retries on every wakeup while the
+/// coroutine that awaits it is suspended.
+class Pollable {
+  public:
+    Pollable() = default;
+    Pollable(const Pollable&) = delete;
+    Pollable(Pollable&&) = delete;
+    auto operator=(const Pollable&) -> Pollable& = delete;
+    auto operator=(Pollable&&) -> Pollable& = delete;
+    virtual ~Pollable() = default;
+
+    /// Performs the operation and returns true when it has completed.
+    virtual auto poll() -> bool = 0;
+};
+
+/// The state of an [`Executor`]. The awaitables refer to it, therefore it must not move
+/// when the [`Executor`] is moved.
+template <ServiceType S>
+struct ExecutorState {
+    struct Suspended {
+        Pollable* pollable;
+        std::coroutine_handle<> handle;
+    };
+
+    struct ListenerAttachment {
+        const Listener<S>* listener;
+        WaitSetGuard<S> guard;
+        uint64_t number_of_waiters;
+    };
+
+    explicit ExecutorState(WaitSet<S>&& waitset)
+        : waitset { std::move(waitset) } {
+    }
+
+    ExecutorState(const ExecutorState&) = delete;
+    ExecutorState(ExecutorState&&) = delete;
+    auto operator=(const ExecutorState&) -> ExecutorState& = delete;
+    auto operator=(ExecutorState&&) -> ExecutorState& = delete;
+
+    ~ExecutorState() {
+        suspended.clear();
+        ready.clear();
+        listener_attachments.clear();
+        for (auto handle : tasks) {
+            handle.destroy();
+        }
+    }
+
+    void suspend(Pollable& pollable, std::coroutine_handle<> handle) {
+        suspended.push_back(Suspended { &pollable, handle });
+    }
+
+    /// Attaches the [`Listener`] to the [`WaitSet`] so that its notifications wake up the
+    /// [`Executor`]. Returns false when it could not be attached, the awaitable is then
+    /// retried only in the poll interval.
+    auto attach(const Listener<S>& listener) -> bool {
+        for (auto& attachment : listener_attachments) {
+            if (attachment.listener == &listener) {
+                ++attachment.number_of_waiters;
+                return true;
+            }
+        }
+
+        auto guard = waitset.attach_notification(listener);
+        if (!guard.has_value()) {
+            log(LogLevel::Warn,
+                "Executor",
+                "Unable to attach the listener to the WaitSet, notifications are handled in the poll interval.");
+            return false;
+        }
+
+        listener_attachments.push_back(ListenerAttachment { &listener, std::move(guard.value()), 1 });
+        return true;
+    }
+
+    void detach(const Listener<S>& listener) {
+        for (auto iter = listener_attachments.begin(); iter != listener_attachments.end(); ++iter) {
+            if (iter->listener == &listener) {
+                --iter->number_of_waiters;
+                if (iter->number_of_waiters == 0) {
+                    listener_attachments.erase(iter);
+                }
+                return;
+            }
+        }
+    }
+
+    void resume_ready() {
+        while (!ready.empty()) {
+            auto handle = ready.front();
+            ready.pop_front();
+            handle.resume();
+        }
+    }
+
+    void poll() {
+        uint64_t idx = 0;
+        while (idx < suspended.size()) {
+            if (suspended[idx].pollable->poll()) {
+                ready.push_back(suspended[idx].handle);
+                suspended[idx] = suspended.back();
+                suspended.pop_back();
+            } else {
+                ++idx;
+            }
+        }
+    }
+
+    void remove_completed_tasks() {
+        if (number_of_completed_tasks == 0) {
+            return;
+        }
+
+        uint64_t idx = 0;
+        while (idx < tasks.size()) {
+            if (tasks[idx].done()) {
+                tasks[idx].destroy();
+                tasks[idx] = tasks.back();
+                tasks.pop_back();
+            } else {
+                ++idx;
+            }
+        }
+        number_of_completed_tasks = 0;
+    }
+
+    WaitSet<S> waitset;
+    bb::Optional<WaitSetGuard<S>> poll_guard;
+    std::vector<ListenerAttachment> listener_attachments;
+    std::vector<Suspended> suspended;
+    std::deque<std::coroutine_handle<>> ready;
+    std::vector<std::coroutine_handle<TaskPromise<void>>> tasks;
+    uint64_t number_of_completed_tasks { 0 };
+};
+
+/// Awaits the next [`Response`] of a [`PendingResponse`]. Completes with [`bb::NULLOPT`]
+/// when the [`PendingResponse`] is no longer connected and all [`Response`]s were received.
+template <ServiceType S,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+class PendingResponseAwaitable : public Pollable {
+  public:
+    using PendingResponseType =
+        PendingResponse<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>;
+    using ResultType = bb::Expected<bb::Optional<Response<S, ResponsePayload, ResponseUserHeader>>, ReceiveError>;
+
+    PendingResponseAwaitable(ExecutorState<S>& state, PendingResponseType& pending_response)
+        : m_state { &state }
+        , m_pending_response { &pending_response } {
+    }
+
+    PendingResponseAwaitable(const PendingResponseAwaitable&) = delete;
+    PendingResponseAwaitable(PendingResponseAwaitable&&) = delete;
+    auto operator=(const PendingResponseAwaitable&) -> PendingResponseAwaitable& = delete;
+    auto operator=(PendingResponseAwaitable&&) -> PendingResponseAwaitable& = delete;
+    ~PendingResponseAwaitable() override = default;
+
+    auto await_ready() -> bool {
+        return poll();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        m_state->suspend(*this, handle);
+    }
+
+    auto await_resume() -> ResultType {
+        return std::move(m_result.value());
+    }
+
+    auto poll() -> bool override {
+        // must be acquired before receiving, otherwise the last response of a server that
+        // disconnects in between could be missed
+        const auto is_connected = m_pending_response->is_connected();
+        auto result = m_pending_response->receive();
+        if (!result.has_value() || result->has_value() || !is_connected) {
+            m_result.emplace(std::move(result));
+            return true;
+        }
+
+        return false;
+    }
+
+  private:
+    ExecutorState<S>* m_state;
+    PendingResponseType* m_pending_response;
+    bb::Optional<ResultType> m_result;
+};
+
+/// Awaits the next [`Sample`] of a [`Subscriber`].
+template <ServiceType S, typename Payload, typename UserHeader>
+class SubscriberAwaitable : public Pollable {
+  public:
+    using SubscriberType = Subscriber<S, Payload, UserHeader>;
+    using ResultType = bb::Expected<Sample<S, Payload, UserHeader>, ReceiveError>;
+
+    SubscriberAwaitable(ExecutorState<S>& state, const SubscriberType& subscriber)
+        : m_state { &state }
+        , m_subscriber { &subscriber } {
+    }
+
+    SubscriberAwaitable(const SubscriberAwaitable&) = delete;
+    SubscriberAwaitable(SubscriberAwaitable&&) = delete;
+    auto operator=(const SubscriberAwaitable&) -> SubscriberAwaitable& = delete;
+    auto operator=(SubscriberAwaitable&&) -> SubscriberAwaitable& = delete;
+    ~SubscriberAwaitable() override = default;
+
+    auto await_ready() -> bool {
+        return poll();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        m_state->suspend(*this, handle);
+    }
+
+    auto await_resume() -> ResultType {
+        return std::move(m_result.value());
+    }
+
+    auto poll() -> bool override {
+        auto result = m_subscriber->receive();
+        if (!result.has_value()) {
+            m_result.emplace(bb::err(result.error()));
+            return true;
+        }
+
+        if (result->has_value()) {
+            m_result.emplace(std::move(result->value()));
+            return true;
+        }
+
+        return false;
+    }
+
+  private:
+    ExecutorState<S>* m_state;
+    const SubscriberType* m_subscriber;
+    bb::Optional<ResultType> m_result;
+};
+
+/// Awaits the next notifications of a [`Listener`]. Completes with the number of received
+/// [`EventActivation`]s after the callback was called for each of them.
+template <ServiceType S>
+class ListenerAwaitable : public Pollable {
+  public:
+    using Callback = bb::StaticFunction<void(EventActivation)>;
+    using ResultType = bb::Expected<uint64_t, ListenerWaitError>;
+
+    ListenerAwaitable(ExecutorState<S>& state, Listener<S>& listener, const Callback& callback)
+        : m_state { &state }
+        , m_listener { &listener }
+        , m_callback { callback } {
+    }
+
+    ListenerAwaitable(const ListenerAwaitable&) = delete;
+    ListenerAwaitable(ListenerAwaitable&&) = delete;
+    auto operator=(const ListenerAwaitable&) -> ListenerAwaitable& = delete;
+    auto operator=(ListenerAwaitable&&) -> ListenerAwaitable& = delete;
+    ~ListenerAwaitable() override = default;
+
+    auto await_ready() -> bool {
+        return poll();
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        m_is_attached = m_state->attach(*m_listener);
+        m_state->suspend(*this, handle);
+    }
+
+    auto await_resume() -> ResultType {
+        return std::move(m_result.value());
+    }
+
+    auto poll() -> bool override {
+        auto result = m_listener->try_wait(m_callback);
+        if (!result.has_value() || result.value() > 0) {
+            m_result.emplace(std::move(result));
+            // detach before the coroutine is resumed since it may destroy the listener
+            if (m_is_attached) {
+                m_state->detach(*m_listener);
+                m_is_attached = false;
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+  private:
+    ExecutorState<S>* m_state;
+    Listener<S>* m_listener;
+    Callback m_callback;
+    bool m_is_attached { false };
+    bb::Optional<ResultType> m_result;
+};
+} // namespace internal
+
+/// Runs [`Task`]s on the calling thread and resumes them when the iceoryx2 operations they
+/// await have completed. All suspended operations are retried whenever the underlying
+/// [`WaitSet`] wakes up, either in the configured poll interval or when a [`Listener`] that
+/// is awaited via [`Executor::wait()`] was notified. Therefore, any number of concurrent
+/// [`PendingResponse`]s, [`Subscriber`]s and [`Listener`]s can be awaited without
+/// additional threads.
+///
+/// An [`Executor`] is not thread-safe, all [`Task`]s must be spawned and awaited on the
+/// thread that calls [`Executor::run()`]. Every port that is awaited must outlive the
+/// awaiting [`Task`], and so must the [`Executor`] when the [`Task`]s refer to it. When the
+/// [`Executor`] goes out of scope, all [`Task`]s that have not finished are destroyed.
+///
+/// Can be created via the [`ExecutorBuilder`].
+template <ServiceType S>
+class Executor {
+  public:
+    Executor(Executor&&) noexcept = default;
+    auto operator=(Executor&&) noexcept -> Executor& = default;
+    ~Executor() = default;
+
+    Executor(const Executor&) = delete;
+    auto operator=(const Executor&) -> Executor& = delete;
+
+    /// Takes the ownership of the [`Task`] and starts it with the next call of
+    /// [`Executor::run()`].
+    void spawn(Task<void>&& task);
+
+    /// Returns the number of spawned [`Task`]s that have not yet finished.
+    auto number_of_tasks() const -> uint64_t;
+
+    /// Runs all spawned [`Task`]s until they have finished and returns
+    /// [`WaitSetRunResult::AllEventsHandled`]. It returns earlier when an interrupt- (`SIGINT`)
+    /// or termination-signal (`SIGTERM`) was received or the [`WaitSet`] failed. The
+    /// remaining [`Task`]s are continued by the next call of [`Executor::run()`].
+    auto run() -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Returns an awaitable that completes with the next [`Response`] of the
+    /// [`PendingResponse`], or with [`bb::NULLOPT`] when it is no longer connected and all
+    /// [`Response`]s were received.
+    template <typename RequestPayload, typename RequestUserHeader, typename ResponsePayload, typename ResponseUserHeader>
+    auto receive(PendingResponse<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>&
+                     pending_response)
+        -> internal::
+            PendingResponseAwaitable<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>;
+
+    /// Returns an awaitable that completes with the next [`Sample`] of the [`Subscriber`].
+    template <typename Payload, typename UserHeader>
+    auto receive(const Subscriber<S, Payload, UserHeader>& subscriber)
+        -> internal::SubscriberAwaitable<S, Payload, UserHeader>;
+
+    /// Returns an awaitable that completes when the [`Listener`] was notified. The provided
+    /// callback is called for every received [`EventActivation`] and the awaitable completes
+    /// with the number of received [`EventActivation`]s.
+    auto wait(Listener<S>& listener, const bb::StaticFunction<void(EventActivation)>& callback)
+        -> internal::ListenerAwaitable<S>;
+
+  private:
+    friend class ExecutorBuilder;
+
+    explicit Executor(std::unique_ptr<internal::ExecutorState<S>>&& state) noexcept;
+
+    std::unique_ptr<internal::ExecutorState<S>> m_state;
+};
+
+/// Creates an [`Executor`].
+class ExecutorBuilder {
+    /// Defines the interval in which the [`Executor`] retries all suspended operations. It
+    /// bounds the latency of awaited [`PendingResponse`]s and [`Subscriber`]s, which come
+    /// without a notification of their own. If not set, it is one millisecond.
+#ifdef DOXYGEN_MACRO_FIX
+    auto poll_interval(const bb::Duration value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bb::Duration, poll_interval);
+#endif
+
+  public:
+    ExecutorBuilder() = default;
+    ExecutorBuilder(const ExecutorBuilder&) = delete;
+    ExecutorBuilder(ExecutorBuilder&&) = default;
+    auto operator=(const ExecutorBuilder&) -> ExecutorBuilder& = delete;
+    auto operator=(ExecutorBuilder&&) -> ExecutorBuilder& = default;
+    ~ExecutorBuilder() = default;
+
+    /// Creates the [`Executor`].
+    template <ServiceType S>
+    auto create() && -> bb::Expected<Executor<S>, ExecutorCreateError>;
+
+  private:
+    static constexpr uint64_t DEFAULT_POLL_INTERVAL_IN_MILLISECONDS = 1;
+};
+
+template <ServiceType S>
+inline Executor<S>::Executor(std::unique_ptr<internal::ExecutorState<S>>&& state) noexcept
+    : m_state { std::move(state) } {
+}
+
+template <ServiceType S>
+inline void Executor<S>::spawn(Task<void>&& task) {
+    auto handle = task.release();
+    if (!handle) {
+        return;
+    }
+
+    handle.promise().m_number_of_completed_tasks = &m_state->number_of_completed_tasks;
+    m_state->tasks.push_back(handle);
+    m_state->ready.push_back(handle);
+}
+
+template <ServiceType S>
+inline auto Executor<S>::number_of_tasks() const -> uint64_t {
+    uint64_t number_of_tasks = 0;
+    for (const auto& handle : m_state->tasks) {
+        if (!handle.done()) {
+            ++number_of_tasks;
+        }
+    }
+
+    return number_of_tasks;
+}
+
+template <ServiceType S>
+inline auto Executor<S>::run() -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
+    auto& state = *m_state;
+    while (true) {
+        state.resume_ready();
+        state.remove_completed_tasks();
+        if (state.tasks.empty()) {
+            return WaitSetRunResult::AllEventsHandled;
+        }
+
+        // every wakeup retries all suspended operations since a notification usually
+        // announces new data on another port
+        auto result = state.waitset.wait_and_process_once([](auto) -> CallbackProgression {
+            return CallbackProgression::Continue;
+        });
+        if (!result.has_value() || result.value() != WaitSetRunResult::AllEventsHandled) {
+            return result;
+        }
+
+        state.poll();
+    }
+}
+
+template <ServiceType S>
+template <typename RequestPayload, typename RequestUserHeader, typename ResponsePayload, typename ResponseUserHeader>
+inline auto Executor<S>::receive(
+    PendingResponse<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>& pending_response)
+    -> internal::PendingResponseAwaitable<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader> {
+    return internal::PendingResponseAwaitable<S, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>(
+        *m_state, pending_response);
+}
+
+template <ServiceType S>
+template <typename Payload, typename UserHeader>
+inline auto Executor<S>::receive(const Subscriber<S, Payload, UserHeader>& subscriber)
+    -> internal::SubscriberAwaitable<S, Payload, UserHeader> {
+    return internal::SubscriberAwaitable<S, Payload, UserHeader>(*m_state, subscriber);
+}
+
+template <ServiceType S>
+inline auto Executor<S>::wait(Listener<S>& listener, const bb::StaticFunction<void(EventActivation)>& callback)
+    -> internal::ListenerAwaitable<S> {
+    return internal::ListenerAwaitable<S>(*m_state, listener, callback);
+}
+
+template <ServiceType S>
+inline auto ExecutorBuilder::create() && -> bb::Expected<Executor<S>, ExecutorCreateError> {
+    auto waitset = WaitSetBuilder().create<S>();
+    if (!waitset.has_value()) {
+        return bb::err(ExecutorCreateError::UnableToCreateWaitSet);
+    }
+
+    auto state = std::make_unique<internal::ExecutorState<S>>(std::move(waitset.value()));
+
+    auto guard = state->waitset.attach_interval(
+        m_poll_interval.value_or(bb::Duration::from_millis(DEFAULT_POLL_INTERVAL_IN_MILLISECONDS)));
+    if (!guard.has_value()) {
+        return bb::err(ExecutorCreateError::UnableToAttachPollInterval);
+    }
+    state->poll_guard.emplace(std::move(guard.value()));
+
+    return Executor<S>(std::move(state));
+}
+} // namespace async
+} // namespace iox2
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_ASYNC_EXECUTOR_ERROR_HPP
+#define IOX2_ASYNC_EXECUTOR_ERROR_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+namespace async {
+/// Defines a failure that can occur when an [`Executor`] is created with
+/// [`ExecutorBuilder`].
+enum class ExecutorCreateError : uint8_t {
+    /// The [`WaitSet`] that drives the [`Executor`] could not be created.
+    UnableToCreateWaitSet,
+    /// The poll interval could not be attached to the [`WaitSet`].
+    UnableToAttachPollInterval,
+};
+} // namespace async
+} // namespace iox2
+#endif
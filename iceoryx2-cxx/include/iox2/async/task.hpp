@@ -0,0 +1,235 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_ASYNC_TASK_HPP
+#define IOX2_ASYNC_TASK_HPP
+
+#if !defined(__cpp_impl_coroutine)
+#error "The iox2/async layer requires a compiler with C++20 coroutine support."
+#endif
+
+#include "iox2/bb/optional.hpp"
+#include "iox2/service_type.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+namespace iox2 {
+namespace async {
+template <typename T>
+class Task;
+
+template <ServiceType>
+class Executor;
+
+namespace internal {
+class TaskPromiseBase {
+  public:
+    struct FinalAwaiter {
+        auto await_ready() const noexcept -> bool {
+            return false;
+        }
+
+        template <typename Promise>
+        auto await_suspend(std::coroutine_handle<Promise> handle) noexcept -> std::coroutine_handle<> {
+            auto& promise = handle.promise();
+            if (promise.m_continuation) {
+                return promise.m_continuation;
+            }
+
+            // a task without continuation was spawned on an executor which destroys it
+            if (promise.m_number_of_completed_tasks != nullptr) {
+                ++(*promise.m_number_of_completed_tasks);
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    TaskPromiseBase() = default;
+    TaskPromiseBase(const TaskPromiseBase&) = delete;
+    TaskPromiseBase(TaskPromiseBase&&) = delete;
+    auto operator=(const TaskPromiseBase&) -> TaskPromiseBase& = delete;
+    auto operator=(TaskPromiseBase&&) -> TaskPromiseBase& = delete;
+    ~TaskPromiseBase() = default;
+
+    auto initial_suspend() const noexcept -> std::suspend_always {
+        return {};
+    }
+
+    auto final_suspend() const noexcept -> FinalAwaiter {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept {
+        std::terminate();
+    }
+
+  private:
+    template <typename>
+    friend class iox2::async::Task;
+    template <ServiceType>
+    friend class iox2::async::Executor;
+
+    std::coroutine_handle<> m_continuation;
+    uint64_t* m_number_of_completed_tasks = nullptr;
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase {
+  public:
+    auto get_return_object() noexcept -> Task<T>;
+
+    template <typename U>
+    void return_value(U&& value) {
+        m_value.emplace(std::forward<U>(value));
+    }
+
+    auto take_value() -> T {
+        return std::move(m_value.value());
+    }
+
+  private:
+    bb::Optional<T> m_value;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase {
+  public:
+    auto get_return_object() noexcept -> Task<void>;
+
+    void return_void() const noexcept {
+    }
+
+    void take_value() const noexcept {
+    }
+};
+} // namespace internal
+
+/// A lazily started coroutine that produces a value of type `T`. It starts when it is
+/// awaited by another [`Task`] or when it is spawned on an [`Executor`] with
+/// [`Executor::spawn()`]. An awaiting [`Task`] is resumed as soon as the awaited [`Task`] has
+/// finished, without involving the [`Executor`].
+template <typename T = void>
+class [[nodiscard]] Task {
+  public:
+    using promise_type = internal::TaskPromise<T>;
+
+    Task(Task&& rhs) noexcept;
+    auto operator=(Task&& rhs) noexcept -> Task&;
+    ~Task();
+
+    Task(const Task&) = delete;
+    auto operator=(const Task&) -> Task& = delete;
+
+    /// Returns true when the [`Task`] has finished.
+    auto is_done() const -> bool;
+
+    /// Starts the [`Task`] and suspends the awaiting coroutine until the [`Task`] has
+    /// finished. Returns the value the [`Task`] produced.
+    auto operator co_await() && noexcept;
+
+  private:
+    friend class internal::TaskPromise<T>;
+    template <ServiceType>
+    friend class Executor;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+    auto release() noexcept -> std::coroutine_handle<promise_type>;
+    void drop();
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+namespace internal {
+template <typename T>
+inline auto TaskPromise<T>::get_return_object() noexcept -> Task<T> {
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline auto TaskPromise<void>::get_return_object() noexcept -> Task<void> {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+} // namespace internal
+
+template <typename T>
+inline Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle { handle } {
+}
+
+template <typename T>
+inline Task<T>::Task(Task&& rhs) noexcept
+    : m_handle { std::exchange(rhs.m_handle, nullptr) } {
+}
+
+template <typename T>
+inline auto Task<T>::operator=(Task&& rhs) noexcept -> Task& {
+    if (this != &rhs) {
+        drop();
+        m_handle = std::exchange(rhs.m_handle, nullptr);
+    }
+
+    return *this;
+}
+
+template <typename T>
+inline Task<T>::~Task() {
+    drop();
+}
+
+template <typename T>
+inline void Task<T>::drop() {
+    if (m_handle) {
+        m_handle.destroy();
+        m_handle = nullptr;
+    }
+}
+
+template <typename T>
+inline auto Task<T>::release() noexcept -> std::coroutine_handle<promise_type> {
+    return std::exchange(m_handle, nullptr);
+}
+
+template <typename T>
+inline auto Task<T>::is_done() const -> bool {
+    return !m_handle || m_handle.done();
+}
+
+template <typename T>
+inline auto Task<T>::operator co_await() && noexcept {
+    struct Awaiter {
+        std::coroutine_handle<promise_type> handle;
+
+        auto await_ready() const noexcept -> bool {
+            return !handle || handle.done();
+        }
+
+        auto await_suspend(std::coroutine_handle<> continuation) noexcept -> std::coroutine_handle<> {
+            handle.promise().m_continuation = continuation;
+            return handle;
+        }
+
+        auto await_resume() -> T {
+            return handle.promise().take_value();
+        }
+    };
+
+    return Awaiter { m_handle };
+}
+} // namespace async
+} // namespace iox2
+
+#endif
@@ -72,6 +72,15 @@ class BackpressureInfo {
         iox2_backpressure_info_elapsed_time(m_info, &seconds, &nanoseconds);
         return bb::Duration::create_duration(seconds, nanoseconds);
     }
+    /// Returns the capacity of the buffer of the receiver port
+    auto buffer_size() const -> uint64_t {
+        return iox2_backpressure_info_buffer_size(m_info);
+    }
+    /// Returns the number of samples that are currently stored in the buffer of the receiver port and were not
+    /// yet received
+    auto number_of_buffered_samples() const -> uint64_t {
+        return iox2_backpressure_info_number_of_buffered_samples(m_info);
+    }
 };
 
 /// The backpressure handler invoked when a sample could not be delivered
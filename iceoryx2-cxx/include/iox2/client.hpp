@@ -150,9 +150,10 @@ template <ServiceType Service,
           typename ResponseUserHeader>
 inline auto Client<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::id() const
     -> UniqueClientId {
+    iox2_unique_client_id_t id_storage {};
     iox2_unique_client_id_h id_handle = nullptr;
-    iox2_client_id(&m_handle, nullptr, &id_handle);
-    return UniqueClientId { id_handle };
+    iox2_client_id(&m_handle, &id_storage, &id_handle);
+    return UniqueClientId(id_handle);
 }
 
 template <ServiceType Service,
@@ -20,6 +20,7 @@
 #include "iox2/bb/optional.hpp"
 #include "iox2/bb/path.hpp"
 #include "iox2/config_creation_error.hpp"
+#include "iox2/config_snapshot.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 
 namespace iox2 {
@@ -133,6 +134,11 @@ class Global {
     auto creation_timeout() && -> iox2::bb::Duration;
     /// Set the creation timeout
     void set_creation_timeout(const iox2::bb::Duration& value) &&;
+    /// The maximum number of bytes the data segments of all processes of the domain can
+    /// occupy in sum. [`bb::NULLOPT`] means unlimited.
+    auto shared_memory_quota() && -> bb::Optional<size_t>;
+    /// Sets the maximum number of bytes the data segments of the domain can occupy in sum.
+    void set_shared_memory_quota(bb::Optional<size_t> value) &&;
 
     /// Returns the service part of the global configuration
     auto service() -> Service;
@@ -425,6 +431,9 @@ class ConfigView {
     /// Creates a copy of the corresponding [`Config`] and returns it.
     auto to_owned() const -> Config;
 
+    /// Returns a [`ConfigSnapshot`] with all settings of the corresponding [`Config`].
+    auto snapshot() const -> ConfigSnapshot;
+
   private:
     friend class Config;
     template <ServiceType>
@@ -455,6 +464,11 @@ class Config {
     /// [`ConfigCreationError`] describing the failure.
     static auto from_file(const iox2::bb::FilePath& file) -> iox2::bb::Expected<Config, ConfigCreationError>;
 
+    /// Loads a configuration from a file like [`Config::from_file()`] but parses every file only
+    /// once per process and returns a copy of the cached [`Config`] afterwards. Changes of the
+    /// file after it was loaded are not reflected. Failures are not cached.
+    static auto from_file_cached(const iox2::bb::FilePath& file) -> iox2::bb::Expected<Config, ConfigCreationError>;
+
     /// Sets the global configuration from a file. On success it returns the global config as [`ConfigView`]
     /// object otherwise a [`ConfigCreationError`] describing the failure.
     static auto setup_global_config_from_file(const iox2::bb::FilePath& file)
@@ -468,9 +482,16 @@ class Config {
     /// Returns a [`ConfigView`] to the current global config.
     static auto global_config() -> ConfigView;
 
+    /// Returns the [`ConfigSnapshot`] of the current global config. It is acquired on the first
+    /// call, every further call returns the same snapshot without calling into the iceoryx2 library.
+    static auto global_config_snapshot() -> const ConfigSnapshot&;
+
     /// Returns the [`ConfigView`] to this [`Config`]
     auto view() -> ConfigView;
 
+    /// Returns a [`ConfigSnapshot`] with all current settings of this [`Config`].
+    auto snapshot() -> ConfigSnapshot;
+
   private:
     friend class ConfigView;
     friend class config::Global;
@@ -0,0 +1,242 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CONFIG_SNAPSHOT_HPP
+#define IOX2_CONFIG_SNAPSHOT_HPP
+
+#include "iox2/backpressure_strategy.hpp"
+#include "iox2/bb/duration.hpp"
+#include "iox2/bb/file_name.hpp"
+#include "iox2/bb/file_path.hpp"
+#include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_string.hpp"
+
+#include <cstddef>
+
+namespace iox2 {
+/// A copy of all settings of a [`Config`] that is acquired once with [`Config::snapshot()`].
+/// In contrast to the accessors of [`Config`], reading a value is a plain member access and
+/// does not call into the iceoryx2 library. Changes of the [`Config`] after the snapshot was
+/// taken are not reflected.
+struct ConfigSnapshot {
+    /// The string type of all file name settings, like the suffixes
+    using FileNameString = bb::StaticString<bb::platform::IOX2_MAX_FILENAME_LENGTH>;
+    /// The string type of all path settings, like the directories
+    using PathString = bb::StaticString<bb::platform::IOX2_MAX_PATH_LENGTH>;
+
+    /// All settings of [`config::Node`].
+    struct Node {
+        /// The directory in which all node files are stored
+        PathString directory;
+        /// The suffix of the monitor token
+        FileNameString monitor_suffix;
+        /// The suffix of the files where the node configuration is stored.
+        FileNameString global_mgmt_suffix;
+        /// The suffix of the files where the node configuration is stored.
+        FileNameString static_config_suffix;
+        /// The suffix of the service tags.
+        FileNameString port_tag_suffix;
+        /// The suffix of the service tags.
+        FileNameString service_tag_suffix;
+        /// When true, the [`NodeBuilder`](NodeBuilder) checks for dead nodes and
+        /// cleans up all their stale resources whenever a new [`Node`](Node) is
+        /// created.
+        bool cleanup_dead_nodes_on_creation { false };
+        /// When true, the [`NodeBuilder`](NodeBuilder) checks for dead nodes and
+        /// cleans up all their stale resources whenever an existing [`Node`](Node) is
+        /// going out of scope.
+        bool cleanup_dead_nodes_on_destruction { false };
+    };
+
+    /// All settings of [`config::Service`].
+    struct Service {
+        /// The directory in which all service files are stored
+        PathString directory;
+        /// The suffix of the ports data segment
+        FileNameString data_segment_suffix;
+        /// The suffix of the static config file
+        FileNameString static_config_storage_suffix;
+        /// The suffix of the dynamic config file
+        FileNameString dynamic_config_storage_suffix;
+        /// The suffix of a one-to-one connection
+        FileNameString connection_suffix;
+        /// The suffix of a one-to-one connection
+        FileNameString event_connection_suffix;
+        /// When true, the `ServiceBuilder` will clean up dead nodes when opening an
+        /// existing service.
+        bool cleanup_dead_nodes_on_open { false };
+    };
+
+    /// All settings of [`config::Global`].
+    struct Global {
+        /// Prefix used for all files created during runtime
+        FileNameString prefix;
+        /// The path under which all other directories or files will be created
+        PathString root_path;
+        /// Defines the time of how long another process will wait until an entity creation
+        /// is finished. An entity could be a Node or a Service
+        bb::Duration creation_timeout = bb::Duration::zero();
+        /// The maximum number of bytes the data segments of the domain can occupy in sum
+        bb::Optional<size_t> shared_memory_quota;
+        /// The node part of the global configuration
+        Node node;
+        /// The service part of the global configuration
+        Service service;
+    };
+
+    /// All settings of [`config::PublishSubscribe`].
+    struct PublishSubscribe {
+        /// The maximum amount of supported [`Subscriber`]s
+        size_t max_subscribers { 0 };
+        /// The maximum amount of supported [`Publisher`]s
+        size_t max_publishers { 0 };
+        /// The maximum amount of supported [`Node`]s. Defines indirectly how many
+        /// processes can open the service at the same time.
+        size_t max_nodes { 0 };
+        /// The maximum buffer size a [`Subscriber`] can have
+        size_t subscriber_max_buffer_size { 0 };
+        /// The maximum amount of [`Sample`]s a [`Subscriber`] can hold at the same time.
+        size_t subscriber_max_borrowed_samples { 0 };
+        /// The maximum amount of [`SampleMut`]s a [`Publisher`] can loan at the same time.
+        size_t publisher_max_loaned_samples { 0 };
+        /// The maximum history size a [`Subscriber`] can request from a [`Publisher`].
+        size_t publisher_history_size { 0 };
+        /// Defines how the [`Subscriber`] buffer behaves when it is
+        /// full. When safe overflow is activated, the [`Publisher`] will
+        /// replace the oldest [`Sample`] with the newest one.
+        bool enable_safe_overflow { false };
+        /// If safe overflow is deactivated it defines the deliver strategy of the
+        /// [`Publisher`] when the [`Subscriber`]s buffer is full.
+        BackpressureStrategy backpressure_strategy {};
+        /// Defines the size of the internal [`Subscriber`]
+        /// buffer that contains expired connections. An
+        /// connection is expired when the [`Publisher`]
+        /// disconnected from a service and the connection
+        /// still contains unconsumed [`Sample`]s.
+        size_t subscriber_expired_connection_buffer { 0 };
+    };
+
+    /// All settings of [`config::Event`].
+    struct Event {
+        /// The maximum amount of supported [`Listener`]
+        size_t max_listeners { 0 };
+        /// The maximum amount of supported [`Notifier`]
+        size_t max_notifiers { 0 };
+        /// The maximum amount of supported [`Node`]s. Defines indirectly how many
+        /// processes can open the service at the same time.
+        size_t max_nodes { 0 };
+        /// The largest event id supported by the event service
+        size_t event_id_max_value { 0 };
+        /// Defines the event id value that is emitted after a new notifier was created.
+        bb::Optional<size_t> notifier_created_event;
+        /// Defines the event id value that is emitted before a new notifier is dropped.
+        bb::Optional<size_t> notifier_dropped_event;
+        /// Defines the event id value that is emitted if a notifier was identified as dead.
+        bb::Optional<size_t> notifier_dead_event;
+        /// Defines the maximum allowed time between two consecutive notifications. If a notifiation
+        /// is not sent after the defined time, every [`Listener`]
+        /// that is attached to a [`WaitSet`] will be notified.
+        bb::Optional<bb::Duration> deadline;
+    };
+
+    /// All settings of [`config::RequestResponse`].
+    struct RequestResponse {
+        /// Defines if the request buffer of the [`Service`] safely overflows.
+        bool enable_safe_overflow_for_requests { false };
+        /// Defines if the response buffer of the [`Service`] safely overflows.
+        bool enable_safe_overflow_for_responses { false };
+        /// The maximum of [`crate::active_request::ActiveRequest`]s a [`crate::port::server::Server`] can hold in
+        /// parallel per [`crate::port::client::Client`].
+        size_t max_active_requests_per_client { 0 };
+        /// The maximum buffer size for [`crate::response::Response`]s for a
+        /// [`crate::pending_response::PendingResponse`].
+        size_t max_response_buffer_size { 0 };
+        /// The maximum amount of supported [`crate::port::server::Server`]
+        size_t max_servers { 0 };
+        /// The maximum amount of supported [`crate::port::client::Client`]
+        size_t max_clients { 0 };
+        /// The maximum amount of supported [`crate::node::Node`]s. Defines
+        /// indirectly how many processes can open the service at the same time.
+        size_t max_nodes { 0 };
+        /// The maximum amount of borrowed [`crate::response::Response`] per
+        /// [`crate::pending_response::PendingResponse`] on the [`crate::port::client::Client`] side.
+        size_t max_borrowed_responses_per_pending_response { 0 };
+        /// Defines how many [`crate::request_mut::RequestMut`] a
+        /// [`crate::port::client::Client`] can loan in parallel.
+        size_t max_loaned_requests { 0 };
+        /// Defines how many [`crate::response_mut::ResponseMut`] a [`crate::port::server::Server`] can loan in
+        /// parallel per [`crate::active_request::ActiveRequest`].
+        size_t server_max_loaned_responses_per_request { 0 };
+        /// Defines the [`BackpressureStrategy`] when a [`Client`](crate::port::client::Client)
+        /// could not deliver the request to the [`Server`](crate::port::server::Server).
+        BackpressureStrategy client_backpressure_strategy {};
+        /// Defines the [`BackpressureStrategy`] when a [`Server`](crate::port::server::Server)
+        /// could not deliver the response to the [`Client`](crate::port::client::Client).
+        BackpressureStrategy server_backpressure_strategy {};
+        /// Defines the size of the internal [`Client`](crate::port::client::Client)
+        /// buffer that contains expired connections. An
+        /// connection is expired when the [`Server`](crate::port::server::Server)
+        /// disconnected from a service and the connection
+        /// still contains unconsumed [`Response`](crate::response::Response)s.
+        size_t client_expired_connection_buffer { 0 };
+        /// Defines the size of the internal [`Server`]
+        /// buffer that contains expired connections. An
+        /// connection is expired when the [`Client`]
+        /// disconnected from a service and the connection
+        /// still contains unconsumed [`ActiveRequest`]s.
+        size_t server_expired_connection_buffer { 0 };
+        /// Allows the [`Server`](crate::port::server::Server) to receive
+        /// [`RequestMut`](crate::response_mut::ResponseMut)s of
+        /// [`Client`](crate::port::client::Client)s that are not interested in a
+        /// [`Response`](crate::response::Response), meaning that the
+        /// [`Server`](crate::port::server::Server) will receive the
+        /// [`RequestMut`](crate::response_mut::ResponseMut) despite the corresponding
+        /// [`PendingResponse`](crate::pending_response::PendingResponse) already went out-of-scope.
+        /// So any [`Response`](crate::response::Response) sent by the
+        /// [`Server`](crate::port::server::Server) would not be received by the corresponding
+        /// [`Client`](crate::port::client::Client)s
+        /// [`PendingResponse`](crate::pending_response::PendingResponse).
+        ///
+        /// Consider enabling this feature if you do not want to loose any
+        /// [`RequestMut`](crate::response_mut::ResponseMut).
+        bool enable_fire_and_forget_requests { false };
+    };
+
+    /// All settings of [`config::Blackboard`].
+    struct Blackboard {
+        /// The maximum amount of supported [`Reader`]s
+        size_t max_readers { 0 };
+        /// The maximum amount of supported [`Node`]s. Defines indirectly how many
+        /// processes can open the service at the same time.
+        size_t max_nodes { 0 };
+    };
+
+    /// All settings of [`config::Defaults`].
+    struct Defaults {
+        /// The publish_subscribe part of the default settings
+        PublishSubscribe publish_subscribe;
+        /// The event part of the default settings
+        Event event;
+        /// The request_response part of the default settings
+        RequestResponse request_response;
+        /// The blackboard part of the default settings
+        Blackboard blackboard;
+    };
+
+    /// The global settings
+    Global global;
+    /// The default settings
+    Defaults defaults;
+};
+} // namespace iox2
+
+#endif
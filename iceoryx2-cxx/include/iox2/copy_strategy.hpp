@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_COPY_STRATEGY_HPP
+#define IOX2_COPY_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines how a sender copies the user provided payload into the data segment when
+/// a copy is requested, e.g. with [`Publisher::send_copy()`].
+enum class CopyStrategy : uint8_t {
+    /// Uses a regular memcpy. The copied payload remains in the cache of the sender.
+    Regular,
+    /// Uses streaming stores that bypass the cache of the sender. Pays off for large
+    /// payloads that are not read again by the sender.
+    NonTemporal,
+};
+} // namespace iox2
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CYCLE_CLOCK_HPP
+#define IOX2_CYCLE_CLOCK_HPP
+
+#include "iox2/bb/duration.hpp"
+
+namespace iox2 {
+/// A low overhead monotonic clock that reads the invariant time stamp counter on x86_64 and the
+/// virtual counter `CNTVCT_EL0` on aarch64 instead of calling `clock_gettime`. The counter is
+/// calibrated once per process and reanchored to the monotonic clock every second, therefore the
+/// time can be compared with the send timestamps of the samples, also across processes.
+///
+/// When the hardware does not provide an invariant counter it falls back to `clock_gettime`.
+///
+/// # Example
+///
+/// @code
+/// auto sample = subscriber.receive().value();
+/// if (sample.has_value()) {
+///     auto send_timestamp = sample->header().send_timestamp();
+///     if (send_timestamp.has_value()) {
+///         std::cout << "latency [ns]: " << CycleClock::elapsed_since(*send_timestamp).as_nanos() << std::endl;
+///     }
+/// }
+/// @endcode
+class CycleClock {
+  public:
+    /// Returns true when the [`CycleClock`] reads the cycle counter of the CPU and false when it
+    /// falls back to `clock_gettime`. The first call calibrates the counter.
+    static auto is_hardware_accelerated() -> bool;
+
+    /// Returns the current time of the monotonic clock as [`bb::Duration`] since its epoch.
+    static auto now() -> bb::Duration;
+
+    /// Returns the [`bb::Duration`] that passed since `timestamp` was acquired with
+    /// [`CycleClock::now()`] or with the monotonic clock, like the send timestamp of a sample.
+    /// Returns [`bb::Duration::zero()`] when `timestamp` lies in the future.
+    static auto elapsed_since(const bb::Duration& timestamp) -> bb::Duration;
+};
+} // namespace iox2
+
+#endif
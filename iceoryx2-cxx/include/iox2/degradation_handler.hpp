@@ -63,6 +63,10 @@ class DegradationInfo {
         iox2_degradation_info_sender_port_id(m_info, &buf);
         return RawIdType::from_range_unchecked(buf.data).value();
     }
+    /// Returns the buffer size of the connection between the involved ports
+    auto buffer_size() const -> uint64_t {
+        return iox2_degradation_info_buffer_size(m_info);
+    }
 };
 
 /// The degradation handler invoked when a degradation is detected
@@ -15,6 +15,7 @@
 
 #include "iox2/bb/static_function.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/publisher_details.hpp"
 #include "iox2/subscriber_details.hpp"
 
@@ -40,6 +41,12 @@ class DynamicConfigPublishSubscribe {
     /// Returns how many [`Subscriber`] ports are currently connected.
     auto number_of_subscribers() const -> uint64_t;
 
+    /// Returns the accumulated [`PortStatistics`] of all connected [`Publisher`]s.
+    auto publisher_statistics() const -> PortStatistics;
+
+    /// Returns the accumulated [`PortStatistics`] of all connected [`Subscriber`]s.
+    auto subscriber_statistics() const -> PortStatistics;
+
     /// Iterates over all [`Publishers`]s and calls the
     /// callback with the corresponding [`PublisherDetailsView`].
     /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
@@ -16,6 +16,7 @@
 #include "iox2/event_id.hpp"
 #include "iox2/service_type.hpp"
 #include <cstdint>
+#include <utility>
 
 namespace iox2 {
 /// A wrapper for the value returned by [`EntryHandle::get()`].
@@ -45,6 +46,58 @@ inline auto BlackboardValue<ValueType>::operator*() -> ValueType& {
     return m_value;
 }
 
+/// A read guard returned by [`EntryHandle::read()`] that provides access to the value directly
+/// in shared memory without copying it. The writer may update the value concurrently, therefore
+/// everything that was read through the guard must be discarded when
+/// [`BlackboardValueRef::is_consistent()`] returns false afterwards.
+template <typename ValueType>
+class BlackboardValueRef {
+  public:
+    auto operator*() const -> const ValueType&;
+    auto operator->() const -> const ValueType*;
+
+    /// Returns true when the value was not updated by the writer since the guard was acquired,
+    /// otherwise the data read through the guard may be torn.
+    auto is_consistent() const -> bool;
+
+  private:
+    template <ServiceType, typename, typename>
+    friend class EntryHandle;
+
+    BlackboardValueRef(iox2_entry_handle_h handle, const ValueType* value, uint64_t generation_counter);
+
+    iox2_entry_handle_h m_handle;
+    const ValueType* m_value;
+    uint64_t m_generation_counter;
+};
+
+template <typename ValueType>
+inline BlackboardValueRef<ValueType>::BlackboardValueRef(iox2_entry_handle_h handle,
+                                                         const ValueType* value,
+                                                         uint64_t generation_counter)
+    : m_handle { handle }
+    , m_value { value }
+    , m_generation_counter { generation_counter } {
+}
+
+template <typename ValueType>
+inline auto BlackboardValueRef<ValueType>::operator*() const -> const ValueType& {
+    return *m_value;
+}
+
+template <typename ValueType>
+inline auto BlackboardValueRef<ValueType>::operator->() const -> const ValueType* {
+    return m_value;
+}
+
+template <typename ValueType>
+inline auto BlackboardValueRef<ValueType>::is_consistent() const -> bool {
+    return iox2_entry_handle_end_read(&m_handle, m_generation_counter);
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+class EntryHandleGroup;
+
 /// A handle for direct read access to a specific blackboard value.
 template <ServiceType S, typename KeyType, typename ValueType>
 class EntryHandle {
@@ -62,6 +115,16 @@ class EntryHandle {
     /// Checks if the passed `value` is up-to-date.
     auto is_up_to_date(BlackboardValue<ValueType>& value) const -> bool;
 
+    /// Returns a [`BlackboardValueRef`] that references the value in shared memory without
+    /// copying it. The guard must not outlive the [`EntryHandle`].
+    auto read() const -> BlackboardValueRef<ValueType>;
+
+    /// Calls `callback` with a reference to the value in shared memory and returns its result.
+    /// When the value was updated while `callback` was running, the result is discarded and
+    /// `callback` is called again, so it must not have side effects and must return a value.
+    template <typename F>
+    auto read_with(const F& callback) const -> decltype(callback(std::declval<const ValueType&>()));
+
     /// Returns an ID corresponding to the entry which can be used in an event based communication
     /// setup.
     auto entry_id() const -> EventId;
@@ -69,6 +132,8 @@ class EntryHandle {
   private:
     template <ServiceType, typename>
     friend class Reader;
+    template <ServiceType, typename, typename, uint64_t>
+    friend class EntryHandleGroup;
 
     explicit EntryHandle(iox2_entry_handle_h handle);
     void drop();
@@ -133,6 +198,29 @@ template <ServiceType S, typename KeyType, typename ValueType>
 inline auto EntryHandle<S, KeyType, ValueType>::is_up_to_date(BlackboardValue<ValueType>& value) const -> bool {
     return iox2_entry_handle_is_up_to_date(&m_handle, value.m_generation_counter);
 }
+
+template <ServiceType S, typename KeyType, typename ValueType>
+inline auto EntryHandle<S, KeyType, ValueType>::read() const -> BlackboardValueRef<ValueType> {
+    const void* value_ptr = nullptr;
+    uint64_t counter { 0 };
+
+    iox2_entry_handle_begin_read(&m_handle, &value_ptr, sizeof(ValueType), alignof(ValueType), &counter);
+
+    return BlackboardValueRef<ValueType>(m_handle, static_cast<const ValueType*>(value_ptr), counter);
+}
+
+template <ServiceType S, typename KeyType, typename ValueType>
+template <typename F>
+inline auto EntryHandle<S, KeyType, ValueType>::read_with(const F& callback) const
+    -> decltype(callback(std::declval<const ValueType&>())) {
+    while (true) {
+        auto value = read();
+        auto result = callback(*value);
+        if (value.is_consistent()) {
+            return result;
+        }
+    }
+}
 } // namespace iox2
 
 #endif
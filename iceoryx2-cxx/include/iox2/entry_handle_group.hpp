@@ -0,0 +1,152 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_ENTRY_HANDLE_GROUP_HPP
+#define IOX2_ENTRY_HANDLE_GROUP_HPP
+
+#include "iox2/bb/detail/assertions.hpp"
+#include "iox2/bb/slice.hpp"
+#include "iox2/entry_handle.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/service_type.hpp"
+
+#include <cstdint>
+
+namespace iox2 {
+/// Reads the values of up to `Capacity` blackboard entries with the same value type in one call.
+/// The generation counters of all entries are stored contiguously in the group and only the
+/// values that changed since the last [`EntryHandleGroup::update()`] are copied.
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+class EntryHandleGroup {
+  public:
+    EntryHandleGroup() = default;
+    EntryHandleGroup(EntryHandleGroup&& rhs) noexcept;
+    auto operator=(EntryHandleGroup&& rhs) noexcept -> EntryHandleGroup&;
+    ~EntryHandleGroup();
+
+    EntryHandleGroup(const EntryHandleGroup&) = delete;
+    auto operator=(const EntryHandleGroup&) -> EntryHandleGroup& = delete;
+
+    /// Takes ownership of the [`EntryHandle`] and appends it to the group. Returns false when the
+    /// group is full, the [`EntryHandle`] is left untouched in that case.
+    auto add(EntryHandle<S, KeyType, ValueType>&& entry_handle) -> bool;
+
+    /// Returns the number of entries in the group.
+    auto size() const -> uint64_t;
+
+    /// Copies every value that changed since the last call into the corresponding element of
+    /// `values`, in the order in which the entries were added. Unchanged elements are not touched.
+    /// Returns the number of changed entries, which entries changed can be queried with
+    /// [`EntryHandleGroup::has_changed()`].
+    auto update(bb::MutableSlice<ValueType> values) -> uint64_t;
+
+    /// Returns true when the entry at `index` changed in the last [`EntryHandleGroup::update()`].
+    auto has_changed(uint64_t index) const -> bool;
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD = 64;
+    static constexpr uint64_t NUMBER_OF_WORDS = (Capacity + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    void drop();
+
+    iox2_entry_handle_h m_handles[Capacity] {};
+    // the generation counter of a blackboard entry starts at 1, therefore the first update
+    // copies all values
+    uint64_t m_generation_counters[Capacity] {};
+    uint64_t m_changed_entries[NUMBER_OF_WORDS] {};
+    uint64_t m_size { 0 };
+};
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline void EntryHandleGroup<S, KeyType, ValueType, Capacity>::drop() {
+    for (uint64_t i = 0; i < m_size; ++i) {
+        iox2_entry_handle_drop(m_handles[i]);
+        m_handles[i] = nullptr;
+    }
+    m_size = 0;
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline EntryHandleGroup<S, KeyType, ValueType, Capacity>::EntryHandleGroup(EntryHandleGroup&& rhs) noexcept {
+    *this = std::move(rhs);
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline auto EntryHandleGroup<S, KeyType, ValueType, Capacity>::operator=(EntryHandleGroup&& rhs) noexcept
+    -> EntryHandleGroup& {
+    if (this != &rhs) {
+        drop();
+        for (uint64_t i = 0; i < rhs.m_size; ++i) {
+            m_handles[i] = rhs.m_handles[i];
+            m_generation_counters[i] = rhs.m_generation_counters[i];
+            rhs.m_handles[i] = nullptr;
+        }
+        for (uint64_t i = 0; i < NUMBER_OF_WORDS; ++i) {
+            m_changed_entries[i] = rhs.m_changed_entries[i];
+        }
+        m_size = rhs.m_size;
+        rhs.m_size = 0;
+    }
+
+    return *this;
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline EntryHandleGroup<S, KeyType, ValueType, Capacity>::~EntryHandleGroup() {
+    drop();
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline auto EntryHandleGroup<S, KeyType, ValueType, Capacity>::add(EntryHandle<S, KeyType, ValueType>&& entry_handle)
+    -> bool {
+    if (m_size == Capacity) {
+        return false;
+    }
+
+    m_handles[m_size] = entry_handle.m_handle;
+    m_generation_counters[m_size] = 0;
+    entry_handle.m_handle = nullptr;
+    ++m_size;
+
+    return true;
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline auto EntryHandleGroup<S, KeyType, ValueType, Capacity>::size() const -> uint64_t {
+    return m_size;
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline auto EntryHandleGroup<S, KeyType, ValueType, Capacity>::update(bb::MutableSlice<ValueType> values)
+    -> uint64_t {
+    IOX2_ENFORCE(values.number_of_elements() >= m_size, "The slice must hold a value for every entry in the group.");
+
+    return iox2_entry_handle_update_batch(&m_handles[0],
+                                          m_size,
+                                          values.data(),
+                                          sizeof(ValueType),
+                                          alignof(ValueType),
+                                          &m_generation_counters[0],
+                                          &m_changed_entries[0]);
+}
+
+template <ServiceType S, typename KeyType, typename ValueType, uint64_t Capacity>
+inline auto EntryHandleGroup<S, KeyType, ValueType, Capacity>::has_changed(const uint64_t index) const -> bool {
+    if (index >= m_size) {
+        return false;
+    }
+
+    return (m_changed_entries[index / BITS_PER_WORD] & (uint64_t { 1 } << (index % BITS_PER_WORD))) != 0;
+}
+} // namespace iox2
+
+#endif
@@ -17,6 +17,8 @@
 #include "iox2/event_id.hpp"
 #include "iox2/service_type.hpp"
 
+#include <memory>
+
 namespace iox2 {
 /// A handle for direct write access to a specific blackboard value.
 template <ServiceType S, typename KeyType, typename ValueType>
@@ -29,8 +31,9 @@ class EntryHandleMut {
     EntryHandleMut(const EntryHandleMut&) = delete;
     auto operator=(const EntryHandleMut&) -> EntryHandleMut& = delete;
 
-    /// Updates the value by copying the passed value into it.
-    void update_with_copy(ValueType value);
+    /// Updates the value by copying the passed value into it. The value is copied directly
+    /// into the entry without an intermediate copy or heap allocation.
+    void update_with_copy(const ValueType& value);
 
     /// Consumes the [`EntryHandleMut`] and loans an uninitialized entry value that can be used to update without copy.
     template <ServiceType ST, typename KeyT, typename ValueT>
@@ -86,12 +89,8 @@ inline EntryHandleMut<S, KeyType, ValueType>::~EntryHandleMut() noexcept {
 }
 
 template <ServiceType S, typename KeyType, typename ValueType>
-inline void EntryHandleMut<S, KeyType, ValueType>::update_with_copy(ValueType value) {
-    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): required by C API
-    auto value_ptr = new ValueType(value);
-    iox2_entry_handle_mut_update_with_copy(&m_handle, value_ptr, sizeof(ValueType), alignof(ValueType));
-    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): required by C API
-    delete value_ptr;
+inline void EntryHandleMut<S, KeyType, ValueType>::update_with_copy(const ValueType& value) {
+    iox2_entry_handle_mut_update_with_copy(&m_handle, std::addressof(value), sizeof(ValueType), alignof(ValueType));
 }
 
 template <ServiceType S, typename KeyType, typename ValueType>
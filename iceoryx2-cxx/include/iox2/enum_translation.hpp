@@ -24,6 +24,7 @@
 #include "iox2/client_error.hpp"
 #include "iox2/config_creation_error.hpp"
 #include "iox2/connection_failure.hpp"
+#include "iox2/copy_strategy.hpp"
 #include "iox2/degradation_action.hpp"
 #include "iox2/degradation_cause.hpp"
 #include "iox2/entry_handle_error.hpp"
@@ -38,6 +39,7 @@
 #include "iox2/port_error.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/reader_error.hpp"
+#include "iox2/receive_policy.hpp"
 #include "iox2/server_error.hpp"
 #include "iox2/service_builder_blackboard_error.hpp"
 #include "iox2/service_builder_event_error.hpp"
@@ -1843,6 +1845,8 @@ constexpr auto from<int, iox2::ServerCreateError>(const int value) noexcept -> i
         return iox2::ServerCreateError::FailedToDeployThreadsafetyPolicy;
     case iox2_server_create_error_e_UNABLE_TO_CREATE_PORT_TAG:
         return iox2::ServerCreateError::UnableToCreatePortTag;
+    case iox2_server_create_error_e_UNABLE_TO_CREATE_WAKE_UP_CHANNEL:
+        return iox2::ServerCreateError::UnableToCreateWakeUpChannel;
     }
 
     IOX2_UNREACHABLE();
@@ -1860,6 +1864,8 @@ constexpr auto from<iox2::ServerCreateError, iox2_server_create_error_e>(const i
         return iox2_server_create_error_e_FAILED_TO_DEPLOY_THREAD_SAFETY_POLICY;
     case iox2::ServerCreateError::UnableToCreatePortTag:
         return iox2_server_create_error_e_UNABLE_TO_CREATE_PORT_TAG;
+    case iox2::ServerCreateError::UnableToCreateWakeUpChannel:
+        return iox2_server_create_error_e_UNABLE_TO_CREATE_WAKE_UP_CHANNEL;
     }
 
     IOX2_UNREACHABLE();
@@ -2077,6 +2083,10 @@ constexpr auto from<int, iox2::SubscriberCreateError>(const int value) noexcept
         return iox2::SubscriberCreateError::HistoryRequestExceedsHistorySizeOfService;
     case iox2_subscriber_create_error_e_HISTORY_REQUEST_EXCEEDS_BUFFER_SIZE_OF_SUBSCRIBER:
         return iox2::SubscriberCreateError::HistoryRequestExceedsBufferSizeOfSubscriber;
+    case iox2_subscriber_create_error_e_CONTENT_FILTER_EXCEEDS_USER_HEADER:
+        return iox2::SubscriberCreateError::ContentFilterExceedsUserHeader;
+    case iox2_subscriber_create_error_e_UNABLE_TO_CREATE_WAKE_UP_CHANNEL:
+        return iox2::SubscriberCreateError::UnableToCreateWakeUpChannel;
     }
 
     IOX2_UNREACHABLE();
@@ -2099,6 +2109,10 @@ from<iox2::SubscriberCreateError, iox2_subscriber_create_error_e>(const iox2::Su
         return iox2_subscriber_create_error_e_HISTORY_REQUEST_EXCEEDS_HISTORY_SIZE_OF_SERVICE;
     case iox2::SubscriberCreateError::HistoryRequestExceedsBufferSizeOfSubscriber:
         return iox2_subscriber_create_error_e_HISTORY_REQUEST_EXCEEDS_BUFFER_SIZE_OF_SUBSCRIBER;
+    case iox2::SubscriberCreateError::ContentFilterExceedsUserHeader:
+        return iox2_subscriber_create_error_e_CONTENT_FILTER_EXCEEDS_USER_HEADER;
+    case iox2::SubscriberCreateError::UnableToCreateWakeUpChannel:
+        return iox2_subscriber_create_error_e_UNABLE_TO_CREATE_WAKE_UP_CHANNEL;
     }
 
     IOX2_UNREACHABLE();
@@ -2265,6 +2279,8 @@ constexpr auto from<int, iox2::RequestSendError>(const int value) noexcept -> io
         return iox2::RequestSendError::UnableToDeliver;
     case iox2_request_send_error_e_INTERNAL_ERROR:
         return iox2::RequestSendError::InternalError;
+    case iox2_request_send_error_e_FIRE_AND_FORGET_NOT_SUPPORTED:
+        return iox2::RequestSendError::FireAndForgetNotSupported;
     }
 
     IOX2_UNREACHABLE();
@@ -2294,6 +2310,8 @@ constexpr auto from<iox2::RequestSendError, iox2_request_send_error_e>(const iox
         return iox2_request_send_error_e_UNABLE_TO_DELIVER;
     case iox2::RequestSendError::InternalError:
         return iox2_request_send_error_e_INTERNAL_ERROR;
+    case iox2::RequestSendError::FireAndForgetNotSupported:
+        return iox2_request_send_error_e_FIRE_AND_FORGET_NOT_SUPPORTED;
     }
 
     IOX2_UNREACHABLE();
@@ -2587,6 +2605,8 @@ constexpr auto from<int, iox2::WaitSetAttachmentError>(const int value) noexcept
         return iox2::WaitSetAttachmentError::InternalError;
     case iox2_waitset_attachment_error_e_INSUFFICIENT_RESOURCES:
         return iox2::WaitSetAttachmentError::InsufficientResources;
+    case iox2_waitset_attachment_error_e_NO_WAKE_UP_CHANNEL:
+        return iox2::WaitSetAttachmentError::NoWakeUpChannel;
     }
 
     IOX2_UNREACHABLE();
@@ -2605,6 +2625,8 @@ from<iox2::WaitSetAttachmentError, iox2_waitset_attachment_error_e>(const iox2::
         return iox2_waitset_attachment_error_e_INTERNAL_ERROR;
     case iox2::WaitSetAttachmentError::InsufficientResources:
         return iox2_waitset_attachment_error_e_INSUFFICIENT_RESOURCES;
+    case iox2::WaitSetAttachmentError::NoWakeUpChannel:
+        return iox2_waitset_attachment_error_e_NO_WAKE_UP_CHANNEL;
     }
 
     IOX2_UNREACHABLE();
@@ -2697,6 +2719,21 @@ constexpr auto from<iox2::AllocationStrategy, iox2_allocation_strategy_e>(const
         return iox2_allocation_strategy_e_POWER_OF_TWO;
     case iox2::AllocationStrategy::Static:
         return iox2_allocation_strategy_e_STATIC;
+    case iox2::AllocationStrategy::SizeClasses:
+        return iox2_allocation_strategy_e_SIZE_CLASSES;
+    }
+
+    IOX2_UNREACHABLE();
+}
+
+template <>
+constexpr auto from<iox2::CopyStrategy, iox2_copy_strategy_e>(const iox2::CopyStrategy value) noexcept
+    -> iox2_copy_strategy_e {
+    switch (value) {
+    case iox2::CopyStrategy::Regular:
+        return iox2_copy_strategy_e_REGULAR;
+    case iox2::CopyStrategy::NonTemporal:
+        return iox2_copy_strategy_e_NON_TEMPORAL;
     }
 
     IOX2_UNREACHABLE();
@@ -2794,6 +2831,23 @@ constexpr auto from<iox2::BackpressureAction, iox2_backpressure_action_e>(const
     IOX2_UNREACHABLE();
 }
 
+template <>
+constexpr auto from<iox2::ReceivePolicy, iox2_receive_policy_e>(const iox2::ReceivePolicy value) noexcept
+    -> iox2_receive_policy_e {
+    switch (value) {
+    case iox2::ReceivePolicy::FixedOrder:
+        return iox2_receive_policy_e_FIXED_ORDER;
+    case iox2::ReceivePolicy::RoundRobin:
+        return iox2_receive_policy_e_ROUND_ROBIN;
+    case iox2::ReceivePolicy::WeightedFair:
+        return iox2_receive_policy_e_WEIGHTED_FAIR;
+    case iox2::ReceivePolicy::Priority:
+        return iox2_receive_policy_e_PRIORITY;
+    }
+
+    IOX2_UNREACHABLE();
+}
+
 template <>
 constexpr auto
 from<iox2_service_remove_error_e, iox2::ServiceRemoveError>(const iox2_service_remove_error_e value) noexcept
@@ -13,11 +13,14 @@
 #ifndef IOX2_HEADER_PUBLISH_SUBSCRIBE_HPP
 #define IOX2_HEADER_PUBLISH_SUBSCRIBE_HPP
 
+#include "iox2/bb/duration.hpp"
+#include "iox2/bb/optional.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "unique_port_id.hpp"
 
 namespace iox2 {
 /// Sample header used by [`MessagingPattern::PublishSubscribe`]
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init) 'm_value' is not used directly but only via the initialized 'm_handle'; furthermore, it will be initialized on the call site
 class HeaderPublishSubscribe {
   public:
     HeaderPublishSubscribe(const HeaderPublishSubscribe&) = delete;
@@ -32,17 +35,55 @@ class HeaderPublishSubscribe {
     /// Returns the number of [`Payload`] elements in the received [`Sample`].
     auto number_of_elements() const -> uint64_t;
 
+    /// Returns the sequence number of the [`Sample`]. Every [`Publisher`] numbers its sent
+    /// [`Sample`]s consecutively, starting from 0.
+    auto sequence_number() const -> uint64_t;
+
+    /// Returns the monotonic clock time at which the [`Sample`] was sent. If the [`Service`]
+    /// does not enable send timestamps it returns [`bb::NULLOPT`].
+    auto send_timestamp() const -> bb::Optional<bb::Duration>;
+
+    /// Returns the priority of the [`Sample`].
+    auto priority() const -> uint8_t;
+
   private:
     template <ServiceType, typename, typename>
     friend class Sample;
     template <ServiceType, typename, typename>
     friend class SampleMut;
 
-    explicit HeaderPublishSubscribe(iox2_publish_subscribe_header_h handle);
+    // The header is defaulted since both members are initialized on the call site
+    explicit HeaderPublishSubscribe() = default;
     void drop();
 
+    iox2_publish_subscribe_header_t m_value;
     iox2_publish_subscribe_header_h m_handle = nullptr;
 };
+
+/// Copy of the [`Sample`] header used by [`MessagingPattern::PublishSubscribe`]. In contrast
+/// to [`HeaderPublishSubscribe`] it does not own any handle and is acquired without allocation.
+class HeaderPublishSubscribeView {
+  public:
+    /// Returns the raw bytes of the [`UniquePublisherId`] of the source [`Publisher`].
+    auto publisher_id() const -> const RawIdType&;
+
+    /// Returns the number of [`Payload`] elements in the received [`Sample`].
+    auto number_of_elements() const -> uint64_t;
+
+    /// Returns the monotonic clock time at which the [`Sample`] was sent. If the [`Service`]
+    /// does not enable send timestamps it returns [`bb::NULLOPT`].
+    auto send_timestamp() const -> bb::Optional<bb::Duration>;
+
+  private:
+    template <ServiceType, typename, typename>
+    friend class Sample;
+
+    HeaderPublishSubscribeView(RawIdType publisher_id, uint64_t number_of_elements, uint64_t send_timestamp);
+
+    RawIdType m_publisher_id;
+    uint64_t m_number_of_elements;
+    uint64_t m_send_timestamp;
+};
 } // namespace iox2
 
 #endif
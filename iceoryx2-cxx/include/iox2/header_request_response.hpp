@@ -17,6 +17,7 @@
 
 namespace iox2 {
 /// Request header used by [`MessagingPattern::RequestResponse`]
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init) 'm_value' is not used directly but only via the initialized 'm_handle'; furthermore, it will be initialized on the call site
 class RequestHeader {
   public:
     RequestHeader(const RequestHeader&) = delete;
@@ -36,13 +37,16 @@ class RequestHeader {
     template <ServiceType, typename, typename, typename, typename>
     friend class RequestMut;
 
-    explicit RequestHeader(iox2_request_header_h handle);
+    // The header is defaulted since both members are initialized on the call site
+    explicit RequestHeader() = default;
     void drop();
 
+    iox2_request_header_t m_value;
     iox2_request_header_h m_handle = nullptr;
 };
 
 /// Response header used by [`MessagingPattern::RequestResponse`]
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init) 'm_value' is not used directly but only via the initialized 'm_handle'; furthermore, it will be initialized on the call site
 class ResponseHeader {
   public:
     ResponseHeader(const ResponseHeader&) = delete;
@@ -60,9 +64,11 @@ class ResponseHeader {
     template <ServiceType, typename, typename>
     friend class ResponseMut;
 
-    explicit ResponseHeader(iox2_response_header_h handle);
+    // The header is defaulted since both members are initialized on the call site
+    explicit ResponseHeader() = default;
     void drop();
 
+    iox2_response_header_t m_value;
     iox2_response_header_h m_handle = nullptr;
 };
 } // namespace iox2
@@ -30,12 +30,14 @@
 #include "iox2/config.hpp"
 #include "iox2/config_creation_error.hpp"
 #include "iox2/connection_failure.hpp"
+#include "iox2/cycle_clock.hpp"
 #include "iox2/dynamic_config_blackboard.hpp"
 #include "iox2/dynamic_config_event.hpp"
 #include "iox2/dynamic_config_publish_subscribe.hpp"
 #include "iox2/dynamic_config_request_response.hpp"
 #include "iox2/entry_handle.hpp"
 #include "iox2/entry_handle_error.hpp"
+#include "iox2/entry_handle_group.hpp"
 #include "iox2/entry_handle_mut.hpp"
 #include "iox2/entry_handle_mut_error.hpp"
 #include "iox2/entry_value_uninit.hpp"
@@ -75,6 +77,7 @@
 #include "iox2/port_factory_server.hpp"
 #include "iox2/port_factory_subscriber.hpp"
 #include "iox2/port_factory_writer.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/publisher.hpp"
 #include "iox2/publisher_details.hpp"
 #include "iox2/publisher_error.hpp"
@@ -91,6 +94,8 @@
 #include "iox2/sample_mut_uninit.hpp"
 #include "iox2/server.hpp"
 #include "iox2/server_details.hpp"
+#include "iox2/server_dispatcher.hpp"
+#include "iox2/server_dispatcher_error.hpp"
 #include "iox2/server_error.hpp"
 #include "iox2/service.hpp"
 #include "iox2/service_builder.hpp"
@@ -116,6 +121,7 @@
 #include "iox2/subscriber.hpp"
 #include "iox2/subscriber_details.hpp"
 #include "iox2/subscriber_error.hpp"
+#include "iox2/subscriber_set.hpp"
 #include "iox2/type_name.hpp"
 #include "iox2/type_variant.hpp"
 #include "iox2/unique_node_id.hpp"
@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_INTERNAL_PAYLOAD_CACHE_HPP
+#define IOX2_INTERNAL_PAYLOAD_CACHE_HPP
+
+#include <cstddef>
+
+namespace iox2 {
+namespace internal {
+
+/// Stores the payload and user header location of a sample-like type once they were
+/// acquired via the C API so that subsequent accesses do not cross the FFI boundary.
+/// Both reside in the data segment and therefore stay valid when the owner is moved.
+template <typename PointerType>
+struct PayloadCache {
+    PointerType payload = nullptr;
+    /// The slice length, for the custom payload marker it is the payload byte size
+    size_t payload_length = 0;
+    PointerType user_header = nullptr;
+    /// The byte size of a single payload element for the custom payload marker. It is provided
+    /// by the port so that the payload byte size can be derived without an additional call into
+    /// the C API. Zero when it is unknown.
+    size_t payload_element_size = 0;
+};
+
+} // namespace internal
+} // namespace iox2
+
+#endif
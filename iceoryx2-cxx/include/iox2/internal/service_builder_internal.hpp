@@ -26,7 +26,7 @@ namespace iox2 {
 namespace internal {
 
 template <typename>
-auto get_type_name() -> TypeName;
+auto get_type_name() -> const TypeName&;
 
 template <typename Payload, typename = void>
 struct HasPayloadTypeNameMember : std::false_type { };
@@ -183,9 +183,13 @@ auto get_type_name_impl() -> internal::FromSliceWithoutInnerPayloadTypeNameMembe
     return get_type_name_impl<typename PayloadType::ValueType>();
 }
 
+/// Returns the type name that is used to identify `PayloadType` when creating or opening
+/// services and blackboard entries. The name is constructed only on the first call, all
+/// further calls return the cached name.
 template <typename PayloadType>
-auto get_type_name() -> TypeName {
-    return get_type_name_impl<PayloadType>();
+auto get_type_name() -> const TypeName& {
+    static const TypeName TYPE_NAME = get_type_name_impl<PayloadType>();
+    return TYPE_NAME;
 }
 
 } // namespace internal
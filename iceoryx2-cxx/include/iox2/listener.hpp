@@ -15,7 +15,10 @@
 
 #include "iox2/bb/duration.hpp"
 #include "iox2/bb/expected.hpp"
+#include "iox2/bb/detail/assertions.hpp"
+#include "iox2/bb/function_ref.hpp"
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/slice.hpp"
 #include "iox2/bb/static_function.hpp"
 #include "iox2/event_activation.hpp"
 #include "iox2/event_id.hpp"
@@ -23,6 +26,7 @@
 #include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/listener_error.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/unique_port_id.hpp"
 
@@ -44,13 +48,17 @@ class Listener {
     /// Returns the [`UniqueListenerId`] of the [`Listener`]
     auto id() const -> UniqueListenerId;
 
+    /// Returns the [`PortStatistics`] of the [`Listener`]. `received` counts the
+    /// notifications the [`Listener`] woke up for.
+    auto statistics() const -> PortStatistics;
+
     /// Non-blocking wait for new [`EventId`]s. Collects either all [`EventId`]s that were received
     /// until the call of [`Listener::try_wait()`] or a reasonable batch that represent the
     /// currently available [`EventId`]s in buffer.
     /// For every received [`EventId`] the provided callback is called with the [`EventId`] as
     /// input argument.
     /// Returns the total number of events handled by the call.
-    auto try_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback)
+    auto try_wait(iox2::bb::FunctionRef<void(EventActivation)> callback)
         -> bb::Expected<uint64_t, ListenerWaitError>;
 
     /// Blocking wait for new [`EventId`]s until the provided timeout has passed. Collects either
@@ -60,7 +68,7 @@ class Listener {
     /// For every received [`EventId`] the provided callback is called with the [`EventId`] as
     /// input argument.
     /// Returns the total number of events handled by the call.
-    auto timed_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback, const iox2::bb::Duration& timeout)
+    auto timed_wait(iox2::bb::FunctionRef<void(EventActivation)> callback, const iox2::bb::Duration& timeout)
         -> bb::Expected<uint64_t, ListenerWaitError>;
 
     /// Blocking wait for new [`EventId`]s. Collects either
@@ -70,9 +78,29 @@ class Listener {
     /// For every received [`EventId`] the provided callback is called with the [`EventId`] as
     /// input argument.
     /// Returns the total number of events handled by the call.
-    auto blocking_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback)
+    auto blocking_wait(iox2::bb::FunctionRef<void(EventActivation)> callback)
+        -> bb::Expected<uint64_t, ListenerWaitError>;
+
+    /// Non-blocking wait for new [`EventId`]s. Instead of calling a callback for every
+    /// received [`EventId`], the bit [`EventId::as_value()`] is set in `activated_ids`, a bitset
+    /// where bit `n` is bit `n % 64` of the word `n / 64`. Bits that are already set are not
+    /// cleared. The bitset must hold at least `event_id_max_value + 1` bits of the
+    /// [`Service`], otherwise the contract is violated and the call panics.
+    /// Returns the total number of events handled by the call.
+    auto try_wait(bb::MutableSlice<uint64_t> activated_ids) -> bb::Expected<uint64_t, ListenerWaitError>;
+
+    /// Blocking wait for new [`EventId`]s until the provided timeout has passed. Every received
+    /// [`EventId`] is set in the bitset `activated_ids`, see
+    /// [`Listener::try_wait(bb::MutableSlice<uint64_t>)`].
+    /// Returns the total number of events handled by the call.
+    auto timed_wait(bb::MutableSlice<uint64_t> activated_ids, const iox2::bb::Duration& timeout)
         -> bb::Expected<uint64_t, ListenerWaitError>;
 
+    /// Blocking wait for new [`EventId`]s. Every received [`EventId`] is set in the bitset
+    /// `activated_ids`, see [`Listener::try_wait(bb::MutableSlice<uint64_t>)`].
+    /// Returns the total number of events handled by the call.
+    auto blocking_wait(bb::MutableSlice<uint64_t> activated_ids) -> bb::Expected<uint64_t, ListenerWaitError>;
+
     /// Returns the deadline of the corresponding [`Service`].
     auto deadline() const -> bb::Optional<iox2::bb::Duration>;
 
@@ -145,10 +173,17 @@ inline auto Listener<S>::file_descriptor() const -> FileDescriptorView {
 
 template <ServiceType S>
 inline auto Listener<S>::id() const -> UniqueListenerId {
+    iox2_unique_listener_id_t id_storage {};
     iox2_unique_listener_id_h id_handle = nullptr;
+    iox2_listener_id(&m_handle, &id_storage, &id_handle);
+    return UniqueListenerId(id_handle);
+}
 
-    iox2_listener_id(&m_handle, nullptr, &id_handle);
-    return UniqueListenerId { id_handle };
+template <ServiceType S>
+inline auto Listener<S>::statistics() const -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_listener_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
 }
 
 template <ServiceType S>
@@ -164,12 +199,12 @@ inline auto Listener<S>::deadline() const -> bb::Optional<iox2::bb::Duration> {
 }
 
 inline void wait_callback(const iox2_event_id_t* event_id, const uint64_t event_count, iox2_callback_context context) {
-    auto* callback = internal::ctx_cast<iox2::bb::StaticFunction<void(EventActivation)>>(context);
+    auto* callback = internal::ctx_cast<iox2::bb::FunctionRef<void(EventActivation)>>(context);
     callback->value()(EventActivation(*event_id, event_count));
 }
 
 template <ServiceType S>
-inline auto Listener<S>::try_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback)
+inline auto Listener<S>::try_wait(iox2::bb::FunctionRef<void(EventActivation)> callback)
     -> bb::Expected<uint64_t, ListenerWaitError> {
     auto ctx = internal::ctx(callback);
 
@@ -183,7 +218,7 @@ inline auto Listener<S>::try_wait(const iox2::bb::StaticFunction<void(EventActiv
 }
 
 template <ServiceType S>
-inline auto Listener<S>::timed_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback,
+inline auto Listener<S>::timed_wait(iox2::bb::FunctionRef<void(EventActivation)> callback,
                                     const iox2::bb::Duration& timeout) -> bb::Expected<uint64_t, ListenerWaitError> {
     auto ctx = internal::ctx(callback);
 
@@ -202,7 +237,7 @@ inline auto Listener<S>::timed_wait(const iox2::bb::StaticFunction<void(EventAct
 }
 
 template <ServiceType S>
-inline auto Listener<S>::blocking_wait(const iox2::bb::StaticFunction<void(EventActivation)>& callback)
+inline auto Listener<S>::blocking_wait(iox2::bb::FunctionRef<void(EventActivation)> callback)
     -> bb::Expected<uint64_t, ListenerWaitError> {
     auto ctx = internal::ctx(callback);
 
@@ -215,6 +250,63 @@ inline auto Listener<S>::blocking_wait(const iox2::bb::StaticFunction<void(Event
 
     return bb::err(bb::into<ListenerWaitError>(result));
 }
+
+namespace internal {
+constexpr uint64_t BITS_PER_EVENT_ID_WORD = 64;
+
+inline void
+bitset_wait_callback(const iox2_event_id_t* event_id, const uint64_t event_count, iox2_callback_context context) {
+    static_cast<void>(event_count);
+    auto* activated_ids = static_cast<bb::MutableSlice<uint64_t>*>(context);
+    const auto word = event_id->value / BITS_PER_EVENT_ID_WORD;
+    IOX2_ENFORCE(word < activated_ids->number_of_elements(),
+                 "The bitset is too small for the received EventId. It must hold event_id_max_value + 1 bits.");
+    (*activated_ids)[word] |= uint64_t { 1 } << (event_id->value % BITS_PER_EVENT_ID_WORD);
+}
+} // namespace internal
+
+template <ServiceType S>
+inline auto Listener<S>::try_wait(bb::MutableSlice<uint64_t> activated_ids)
+    -> bb::Expected<uint64_t, ListenerWaitError> {
+    uint64_t number_of_activations = 0;
+    auto result = iox2_listener_try_wait(
+        &m_handle, &number_of_activations, internal::bitset_wait_callback, static_cast<void*>(&activated_ids));
+    if (result == IOX2_OK) {
+        return number_of_activations;
+    }
+
+    return bb::err(bb::into<ListenerWaitError>(result));
+}
+
+template <ServiceType S>
+inline auto Listener<S>::timed_wait(bb::MutableSlice<uint64_t> activated_ids, const iox2::bb::Duration& timeout)
+    -> bb::Expected<uint64_t, ListenerWaitError> {
+    uint64_t number_of_activations = 0;
+    auto result = iox2_listener_timed_wait(&m_handle,
+                                           &number_of_activations,
+                                           internal::bitset_wait_callback,
+                                           static_cast<void*>(&activated_ids),
+                                           timeout.as_secs(),
+                                           timeout.subsec_nanos());
+    if (result == IOX2_OK) {
+        return number_of_activations;
+    }
+
+    return bb::err(bb::into<ListenerWaitError>(result));
+}
+
+template <ServiceType S>
+inline auto Listener<S>::blocking_wait(bb::MutableSlice<uint64_t> activated_ids)
+    -> bb::Expected<uint64_t, ListenerWaitError> {
+    uint64_t number_of_activations = 0;
+    auto result = iox2_listener_blocking_wait(
+        &m_handle, &number_of_activations, internal::bitset_wait_callback, static_cast<void*>(&activated_ids));
+    if (result == IOX2_OK) {
+        return number_of_activations;
+    }
+
+    return bb::err(bb::into<ListenerWaitError>(result));
+}
 } // namespace iox2
 
 #endif
@@ -61,6 +61,17 @@ auto use_file_logger(const char* log_file) -> bool;
 /// It returns true if the logger was set, otherwise false.
 auto set_logger(Log& logger) -> bool;
 
+/// Sets a logger that is called from a background thread. The thread that creates a log message
+/// only copies it into a lock-free buffer and is therefore never blocked by the logger. When the
+/// buffer is full, log messages are discarded. This function can only be called once and must be
+/// called before any log message was created.
+/// It returns true if the logger was set, otherwise false.
+auto set_async_logger(Log& logger) -> bool;
+
+/// Blocks until all log messages were forwarded to the logger that was set with
+/// [`set_async_logger()`]. Does nothing when no asynchronous logger was set.
+void flush_async_logger();
+
 /// Sets the global log level for the application using `IOX2_LOG_LEVEL` environment variable
 /// or defaults it to LogLevel::INFO if variable does not exist.
 ///
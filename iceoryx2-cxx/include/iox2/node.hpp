@@ -62,6 +62,10 @@ class Node {
     /// Waits for a given `cycle_time`.
     auto wait(iox2::bb::Duration cycle_time) const -> bb::Expected<void, NodeWaitFailure>;
 
+    /// Increments the heartbeat counter of the [`Node`] without waiting. [`Node::wait()`]
+    /// increments it implicitly.
+    void heartbeat() const;
+
     /// Lists all [`Node`]s under a provided config. The provided callback is
     /// called for every [`Node`] and gets the [`NodeState`] as input argument.
     /// The callback can return [`CallbackProgression::Stop`] if the iteration
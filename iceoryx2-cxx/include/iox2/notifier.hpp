@@ -16,6 +16,7 @@
 #include "iox2/bb/duration.hpp"
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/slice.hpp"
 #include "iox2/event_id.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/notifier_error.hpp"
@@ -48,6 +49,14 @@ class Notifier {
     /// [`NotifierNotifyError`].
     auto notify_with_custom_event_id(EventId event_id) const -> bb::Expected<size_t, NotifierNotifyError>;
 
+    /// Notifies all [`Listener`] connected to the service with all provided [`EventId`]s
+    /// at once. Every [`Listener`] is woken up only once, no matter how many [`EventId`]s
+    /// are provided.
+    /// Returns on success the number of [`Listener`]s that were notified otherwise it returns
+    /// [`NotifierNotifyError`].
+    auto notify_multiple(const bb::ImmutableSlice<EventId>& event_ids) const
+        -> bb::Expected<size_t, NotifierNotifyError>;
+
     /// Returns the deadline of the corresponding [`Service`].
     auto deadline() const -> bb::Optional<iox2::bb::Duration>;
 
@@ -16,6 +16,7 @@
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/optional.hpp"
 #include "iox2/bb/slice.hpp"
+#include "iox2/bb/static_function.hpp"
 #include "iox2/header_request_response.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/response.hpp"
@@ -51,6 +52,23 @@ class PendingResponse {
     /// received the [`RequestMut`].
     auto receive() -> bb::Expected<bb::Optional<Response<Service, ResponsePayload, ResponseUserHeader>>, ReceiveError>;
 
+    /// Receives all [`Response`]s that are currently available and hands them out in order
+    /// to the provided callback. In contrast to [`PendingResponse::receive()`], the
+    /// [`Response`]s are acquired in batches of `BatchSize` with a single call into the
+    /// underlying implementation per batch. A [`Response`] that is not moved out of the
+    /// callback is released after its batch was processed.
+    ///
+    /// Returns the number of received [`Response`]s. If a failure occurs before any
+    /// [`Response`] was received, [`ReceiveError`] is returned.
+    template <uint64_t BatchSize = DEFAULT_RECEIVE_BATCH_SIZE>
+    auto receive_all(
+        const iox2::bb::StaticFunction<void(Response<Service, ResponsePayload, ResponseUserHeader>&&)>& callback)
+        -> bb::Expected<uint64_t, ReceiveError>;
+
+    /// The default number of [`Response`]s that are acquired at once by
+    /// [`PendingResponse::receive_all()`].
+    static constexpr uint64_t DEFAULT_RECEIVE_BATCH_SIZE = 16;
+
     /// Returns a reference to the iceoryx2 internal [`RequestHeader`] of
     /// the corresponding [`RequestMut`]
     auto header() -> RequestHeader;
@@ -84,6 +102,10 @@ class PendingResponse {
     /// It also returns [`false`] when there are no [`Server`]s.
     auto is_connected() const -> bool;
 
+    /// Returns [`true`] when at least one [`Server`] rejected the request since its deadline
+    /// had passed before it was handed out, see [`RequestMutUninit::set_deadline()`].
+    auto has_missed_deadline() const -> bool;
+
     /// Marks the connection state that the [`Client`] wants to gracefully
     /// disconnect. When the [`Server`] reads this, it can send the last [`Response`] and drop the
     /// corresponding [`ActiveRequest`] to terminate the
@@ -167,6 +189,44 @@ inline auto PendingResponse<Service, RequestPayload, RequestUserHeader, Response
     return bb::err(bb::into<ReceiveError>(result));
 }
 
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+template <uint64_t BatchSize>
+inline auto PendingResponse<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::receive_all(
+    const iox2::bb::StaticFunction<void(Response<Service, ResponsePayload, ResponseUserHeader>&&)>& callback)
+    -> bb::Expected<uint64_t, ReceiveError> {
+    static_assert(BatchSize > 0, "The batch size must be at least 1.");
+
+    uint64_t number_of_responses = 0;
+    while (true) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays), stores only the handles of the responses
+        iox2_response_h response_handles[BatchSize];
+
+        size_t number_of_received_responses = 0;
+        auto result = iox2_pending_response_receive_batch(
+            &m_handle, nullptr, response_handles, BatchSize, &number_of_received_responses);
+
+        if (result != IOX2_OK) {
+            if (number_of_responses == 0) {
+                return bb::err(bb::into<ReceiveError>(result));
+            }
+            return number_of_responses;
+        }
+
+        for (size_t idx = 0; idx < number_of_received_responses; ++idx) {
+            callback(Response<Service, ResponsePayload, ResponseUserHeader>(response_handles[idx]));
+        }
+        number_of_responses += number_of_received_responses;
+
+        if (number_of_received_responses < BatchSize) {
+            return number_of_responses;
+        }
+    }
+}
+
 template <ServiceType Service,
           typename RequestPayload,
           typename RequestUserHeader,
@@ -174,9 +234,9 @@ template <ServiceType Service,
           typename ResponseUserHeader>
 inline auto PendingResponse<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::header()
     -> RequestHeader {
-    iox2_request_header_h header_handle = nullptr;
-    iox2_pending_response_header(&m_handle, nullptr, &header_handle);
-    return RequestHeader { header_handle };
+    RequestHeader header;
+    iox2_pending_response_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType Service,
@@ -256,6 +316,17 @@ PendingResponse<Service, RequestPayload, RequestUserHeader, ResponsePayload, Res
     return iox2_pending_response_is_connected(&m_handle);
 }
 
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+inline auto
+PendingResponse<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::has_missed_deadline()
+    const -> bool {
+    return iox2_pending_response_has_missed_deadline(&m_handle);
+}
+
 template <ServiceType Service,
           typename RequestPayload,
           typename RequestUserHeader,
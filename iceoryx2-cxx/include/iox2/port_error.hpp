@@ -104,6 +104,9 @@ enum class RequestSendError : uint8_t {
     UnableToDeliver,
     /// An internal mechanisms failed and the data could not be delivered to all receivers.
     InternalError,
+    /// [`send_and_forget()`] was called but the [`Service`] does not support fire and forget
+    /// requests.
+    FireAndForgetNotSupported,
 };
 } // namespace iox2
 
@@ -18,11 +18,13 @@
 #include "iox2/bb/static_function.hpp"
 #include "iox2/callback_progression.hpp"
 #include "iox2/cleanup_state.hpp"
+#include "iox2/custom_payload_marker.hpp"
 #include "iox2/dynamic_config_publish_subscribe.hpp"
 #include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/node_failure_enums.hpp"
 #include "iox2/node_state.hpp"
+#include "iox2/payload_info.hpp"
 #include "iox2/port_factory_publisher.hpp"
 #include "iox2/port_factory_subscriber.hpp"
 #include "iox2/service_hash.hpp"
@@ -30,6 +32,9 @@
 #include "iox2/service_type.hpp"
 #include "iox2/static_config_publish_subscribe.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace iox2 {
 /// The factory for [`MessagingPattern::PublishSubscribe`].
 /// It can acquire dynamic and static service informations and create
@@ -95,6 +100,7 @@ class PortFactoryPublishSubscribe {
 
     explicit PortFactoryPublishSubscribe(iox2_port_factory_pub_sub_h handle);
     void drop();
+    auto payload_element_size() const -> size_t;
 
     iox2_port_factory_pub_sub_h m_handle = nullptr;
 };
@@ -220,14 +226,25 @@ template <ServiceType S, typename Payload, typename UserHeader>
 inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::subscriber_builder() const
     -> PortFactorySubscriber<S, Payload, UserHeader> {
     return PortFactorySubscriber<S, Payload, UserHeader>(
-        iox2_port_factory_pub_sub_subscriber_builder(&m_handle, nullptr));
+        iox2_port_factory_pub_sub_subscriber_builder(&m_handle, nullptr), payload_element_size());
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::publisher_builder() const
     -> PortFactoryPublisher<S, Payload, UserHeader> {
     return PortFactoryPublisher<S, Payload, UserHeader>(
-        iox2_port_factory_pub_sub_publisher_builder(&m_handle, nullptr));
+        iox2_port_factory_pub_sub_publisher_builder(&m_handle, nullptr), payload_element_size());
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto PortFactoryPublishSubscribe<S, Payload, UserHeader>::payload_element_size() const -> size_t {
+    // the payload type of the custom payload marker is only known at runtime, it is acquired once
+    // here so that the samples of the ports can determine their payload byte size without FFI calls
+    if (std::is_same<typename PayloadInfo<Payload>::ValueType, CustomPayloadMarker>::value) {
+        return static_config().message_type_details().payload().size();
+    }
+
+    return 0;
 }
 
 
@@ -19,6 +19,7 @@
 #include "iox2/bb/detail/builder.hpp"
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/optional.hpp"
+#include "iox2/copy_strategy.hpp"
 #include "iox2/degradation_handler.hpp"
 #include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
@@ -48,6 +49,32 @@ class PortFactoryPublisher {
     IOX2_BUILDER_OPTIONAL(uint64_t, max_loaned_samples);
 #endif
 
+    /// Sets the [`CopyStrategy`] that is used when the [`Publisher`] copies the payload into
+    /// the data segment, e.g. in [`Publisher::send_copy()`].
+#ifdef DOXYGEN_MACRO_FIX
+    auto copy_strategy(const CopyStrategy value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(CopyStrategy, copy_strategy);
+#endif
+
+    /// Touches every page of the data segment and of the connections to the [`Subscriber`]s
+    /// when they are created, so that the first [`Publisher::loan()`] or
+    /// [`Publisher::send_copy()`] does not cause page faults.
+#ifdef DOXYGEN_MACRO_FIX
+    auto prefault(const bool value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bool, prefault);
+#endif
+
+    /// Locks the data segment and the connections to the [`Subscriber`]s into memory so that
+    /// they cannot be swapped out. When the memory cannot be locked the creation of the
+    /// [`Publisher`] fails.
+#ifdef DOXYGEN_MACRO_FIX
+    auto lock_in_memory(const bool value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bool, lock_in_memory);
+#endif
+
   public:
     PortFactoryPublisher(const PortFactoryPublisher&) = delete;
     PortFactoryPublisher(PortFactoryPublisher&&) = default;
@@ -105,9 +132,10 @@ class PortFactoryPublisher {
     template <ServiceType, typename, typename>
     friend class PortFactoryPublishSubscribe;
 
-    explicit PortFactoryPublisher(iox2_port_factory_publisher_builder_h handle);
+    explicit PortFactoryPublisher(iox2_port_factory_publisher_builder_h handle, size_t payload_element_size);
 
     iox2_port_factory_publisher_builder_h m_handle = nullptr;
+    size_t m_payload_element_size = 0;
     bb::Optional<uint64_t> m_max_slice_len;
     bb::Optional<AllocationStrategy> m_allocation_strategy;
     bb::Optional<OverridePreallocationCallback> m_override_preallocation_callback;
@@ -116,8 +144,10 @@ class PortFactoryPublisher {
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
-inline PortFactoryPublisher<S, Payload, UserHeader>::PortFactoryPublisher(iox2_port_factory_publisher_builder_h handle)
-    : m_handle { handle } {
+inline PortFactoryPublisher<S, Payload, UserHeader>::PortFactoryPublisher(
+    iox2_port_factory_publisher_builder_h handle, size_t payload_element_size)
+    : m_handle { handle }
+    , m_payload_element_size { payload_element_size } {
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -176,6 +206,16 @@ inline auto PortFactoryPublisher<S, Payload, UserHeader>::create() && -> bb::Exp
         iox2_port_factory_publisher_builder_set_allocation_strategy(
             &m_handle, bb::into<iox2_allocation_strategy_e>(m_allocation_strategy.value()));
     }
+    if (m_copy_strategy.has_value()) {
+        iox2_port_factory_publisher_builder_set_copy_strategy(
+            &m_handle, bb::into<iox2_copy_strategy_e>(m_copy_strategy.value()));
+    }
+    if (m_prefault.has_value()) {
+        iox2_port_factory_publisher_builder_set_prefault(&m_handle, m_prefault.value());
+    }
+    if (m_lock_in_memory.has_value()) {
+        iox2_port_factory_publisher_builder_set_lock_in_memory(&m_handle, m_lock_in_memory.value());
+    }
 
     if (m_degradation_handler.has_value()) {
         iox2_port_factory_publisher_builder_set_degradation_handler(
@@ -202,7 +242,7 @@ inline auto PortFactoryPublisher<S, Payload, UserHeader>::create() && -> bb::Exp
     auto result = iox2_port_factory_publisher_builder_create(m_handle, nullptr, &pub_handle);
 
     if (result == IOX2_OK) {
-        return Publisher<S, Payload, UserHeader>(pub_handle);
+        return Publisher<S, Payload, UserHeader>(pub_handle, m_payload_element_size);
     }
 
     return bb::err(bb::into<PublisherCreateError>(result));
@@ -20,6 +20,7 @@
 #include "iox2/bb/optional.hpp"
 #include "iox2/degradation_handler.hpp"
 #include "iox2/internal/callback_context.hpp"
+#include "iox2/receive_policy.hpp"
 #include "iox2/server.hpp"
 #include "iox2/server_error.hpp"
 #include "iox2/service_type.hpp"
@@ -52,6 +53,36 @@ class PortFactoryServer {
     IOX2_BUILDER_OPTIONAL(uint64_t, max_loaned_responses_per_request);
 #endif
 
+    /// Enables or disables request coalescing. When enabled, a received request whose user
+    /// header and payload are byte-wise identical to a request with an [`ActiveRequest`] that
+    /// is still alive is not returned by [`Server::receive()`] but attached to it. Every
+    /// [`ResponseMut`] sent via the [`ActiveRequest`] is delivered to the [`PendingResponse`]s
+    /// of all attached requests as well.
+#ifdef DOXYGEN_MACRO_FIX
+    auto enable_request_coalescing(const bool value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bool, enable_request_coalescing);
+#endif
+
+    /// Enables or disables deadline scheduling. When enabled, [`Server::receive()`] returns
+    /// the received requests in earliest-deadline-first order, requests without a deadline
+    /// come last. Requests whose deadline has passed are rejected, see
+    /// [`PendingResponse::has_missed_deadline()`].
+#ifdef DOXYGEN_MACRO_FIX
+    auto enable_deadline_scheduling(const bool value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bool, enable_deadline_scheduling);
+#endif
+
+    /// Defines the [`ReceivePolicy`], the order in which [`Server::receive()`] returns the
+    /// requests of the connected [`Client`]s. By default, the [`Client`]s are served in the
+    /// order of their connection.
+#ifdef DOXYGEN_MACRO_FIX
+    auto receive_policy(const ReceivePolicy value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(ReceivePolicy, receive_policy);
+#endif
+
   public:
     PortFactoryServer(const PortFactoryServer&) = delete;
     PortFactoryServer(PortFactoryServer&&) = default;
@@ -220,6 +251,16 @@ inline auto PortFactoryServer<Service, RequestPayload, RequestUserHeader, Respon
         iox2_port_factory_server_builder_set_max_loaned_responses_per_request(
             &m_handle, m_max_loaned_responses_per_request.value());
     }
+    if (m_enable_request_coalescing.has_value()) {
+        iox2_port_factory_server_builder_enable_request_coalescing(&m_handle, m_enable_request_coalescing.value());
+    }
+    if (m_enable_deadline_scheduling.has_value()) {
+        iox2_port_factory_server_builder_enable_deadline_scheduling(&m_handle, m_enable_deadline_scheduling.value());
+    }
+    if (m_receive_policy.has_value()) {
+        iox2_port_factory_server_builder_set_receive_policy(&m_handle,
+                                                            bb::into<iox2_receive_policy_e>(m_receive_policy.value()));
+    }
     if (m_allocation_strategy.has_value()) {
         iox2_port_factory_server_builder_set_allocation_strategy(
             &m_handle, bb::into<iox2_allocation_strategy_e>(m_allocation_strategy.value()));
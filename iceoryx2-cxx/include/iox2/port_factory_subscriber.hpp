@@ -66,16 +66,18 @@ class PortFactorySubscriber {
     template <ServiceType, typename, typename>
     friend class PortFactoryPublishSubscribe;
 
-    explicit PortFactorySubscriber(iox2_port_factory_subscriber_builder_h handle);
+    explicit PortFactorySubscriber(iox2_port_factory_subscriber_builder_h handle, size_t payload_element_size);
 
     iox2_port_factory_subscriber_builder_h m_handle = nullptr;
+    size_t m_payload_element_size = 0;
     bb::Optional<DegradationHandler* const> m_degradation_handler;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline PortFactorySubscriber<S, Payload, UserHeader>::PortFactorySubscriber(
-    iox2_port_factory_subscriber_builder_h handle)
-    : m_handle { handle } {
+    iox2_port_factory_subscriber_builder_h handle, size_t payload_element_size)
+    : m_handle { handle }
+    , m_payload_element_size { payload_element_size } {
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -106,7 +108,7 @@ PortFactorySubscriber<S, Payload, UserHeader>::create() && -> bb::Expected<Subsc
     auto result = iox2_port_factory_subscriber_builder_create(m_handle, nullptr, &sub_handle);
 
     if (result == IOX2_OK) {
-        return Subscriber<S, Payload, UserHeader>(sub_handle);
+        return Subscriber<S, Payload, UserHeader>(sub_handle, m_payload_element_size);
     }
 
     return bb::err(bb::into<SubscriberCreateError>(result));
@@ -0,0 +1,49 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_PORT_STATISTICS_HPP
+#define IOX2_PORT_STATISTICS_HPP
+
+#include "iox2/internal/iceoryx2.hpp"
+
+#include <cstdint>
+
+namespace iox2 {
+/// Snapshot of the counters of a port. The counters are stored in the dynamic config of the
+/// service, therefore they can be read by every participant of the service at any time.
+struct PortStatistics {
+    /// The number of successful send operations, e.g. samples of a [`Publisher`] or responses
+    /// of a [`Server`].
+    uint64_t sent { 0 };
+    /// The number of received samples, requests or events.
+    uint64_t received { 0 };
+    /// The number of deliveries that were dropped since the buffer of a receiver was full.
+    /// A [`Subscriber`] counts the samples it lost.
+    uint64_t overflows { 0 };
+    /// The number of loans that failed, for instance since the data segment was out of memory
+    /// or the maximum number of loans was exceeded.
+    uint64_t failed_loans { 0 };
+};
+
+namespace internal {
+inline auto into_port_statistics(const iox2_port_statistics_t& value) -> PortStatistics {
+    PortStatistics ret_val {};
+    ret_val.sent = value.sent;
+    ret_val.received = value.received;
+    ret_val.overflows = value.overflows;
+    ret_val.failed_loans = value.failed_loans;
+    return ret_val;
+}
+} // namespace internal
+} // namespace iox2
+
+#endif
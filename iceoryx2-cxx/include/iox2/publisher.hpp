@@ -15,10 +15,12 @@
 
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/slice.hpp"
+#include "iox2/bb/static_vector.hpp"
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/helper.hpp"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/sample_mut.hpp"
 #include "iox2/sample_mut_uninit.hpp"
@@ -45,6 +47,11 @@ class Publisher {
     /// Returns the [`UniquePublisherId`] of the [`Publisher`]
     auto id() const -> UniquePublisherId;
 
+    /// Returns the [`PortStatistics`] of the [`Publisher`]. `sent` counts the successful send
+    /// operations, `overflows` the deliveries that were dropped since the buffer of a
+    /// [`Subscriber`] was full and `failed_loans` the loans that failed.
+    auto statistics() const -> PortStatistics;
+
     /// Returns the strategy the [`Publisher`] follows when a [`SampleMut`] cannot be delivered
     /// since the [`Subscriber`]s buffer is full.
     auto backpressure_strategy() const -> BackpressureStrategy;
@@ -62,6 +69,16 @@ class Publisher {
     template <typename T = Payload, typename = std::enable_if_t<bb::IsSlice<T>::VALUE, void>>
     auto send_slice_copy(bb::ImmutableSlice<ValueType>& payload) const -> bb::Expected<size_t, SendError>;
 
+    /// Takes the ownership of all provided [`SampleMut`]s and delivers them in order with
+    /// a single connection update. Every [`SampleMut`] is delivered even when the delivery
+    /// of a previous one failed. All [`SampleMut`]s must have been loaned from this [`Publisher`].
+    ///
+    /// On success it returns the accumulated number of [`Subscriber`]s that received
+    /// the [`SampleMut`]s, otherwise the first [`SendError`] that occurred.
+    template <uint64_t Capacity>
+    auto send_batch(bb::StaticVector<SampleMut<S, Payload, UserHeader>, Capacity>&& samples) const
+        -> bb::Expected<size_t, SendError>;
+
     /// Loans/allocates a [`SampleMutUninit`] from the underlying data segment of the [`Publisher`].
     /// The user has to initialize the payload before it can be sent.
     ///
@@ -105,15 +122,17 @@ class Publisher {
     template <ServiceType, typename, typename>
     friend class PortFactoryPublisher;
 
-    explicit Publisher(iox2_publisher_h handle);
+    explicit Publisher(iox2_publisher_h handle, size_t payload_element_size);
     void drop();
 
     iox2_publisher_h m_handle = nullptr;
+    size_t m_payload_element_size = 0;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
-inline Publisher<S, Payload, UserHeader>::Publisher(iox2_publisher_h handle)
-    : m_handle { handle } {
+inline Publisher<S, Payload, UserHeader>::Publisher(iox2_publisher_h handle, size_t payload_element_size)
+    : m_handle { handle }
+    , m_payload_element_size { payload_element_size } {
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -134,6 +153,7 @@ inline auto Publisher<S, Payload, UserHeader>::operator=(Publisher&& rhs) noexce
     if (this != &rhs) {
         drop();
         m_handle = rhs.m_handle;
+        m_payload_element_size = rhs.m_payload_element_size;
         rhs.m_handle = nullptr;
     }
 
@@ -159,10 +179,17 @@ inline auto Publisher<S, Payload, UserHeader>::initial_max_slice_len() const ->
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Publisher<S, Payload, UserHeader>::id() const -> UniquePublisherId {
+    iox2_unique_publisher_id_t id_storage {};
     iox2_unique_publisher_id_h id_handle = nullptr;
+    iox2_publisher_id(&m_handle, &id_storage, &id_handle);
+    return UniquePublisherId(id_handle);
+}
 
-    iox2_publisher_id(&m_handle, nullptr, &id_handle);
-    return UniquePublisherId { id_handle };
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Publisher<S, Payload, UserHeader>::statistics() const -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_publisher_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -201,13 +228,37 @@ inline auto Publisher<S, Payload, UserHeader>::send_slice_copy(bb::ImmutableSlic
     return bb::err(iox2::bb::into<SendError>(result));
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+template <uint64_t Capacity>
+inline auto Publisher<S, Payload, UserHeader>::send_batch(
+    bb::StaticVector<SampleMut<S, Payload, UserHeader>, Capacity>&& samples) const -> bb::Expected<size_t, SendError> {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays), stores only the handles of the samples
+    iox2_sample_mut_h sample_handles[Capacity];
+    const auto number_of_samples = samples.size();
+    for (uint64_t idx = 0; idx < number_of_samples; ++idx) {
+        auto& sample = samples.unchecked_access()[idx];
+        sample_handles[idx] = sample.m_handle;
+        sample.m_handle = nullptr;
+    }
+    samples.clear();
+
+    size_t number_of_recipients = 0;
+    auto result = iox2_publisher_send_batch(&m_handle, sample_handles, number_of_samples, &number_of_recipients);
+
+    if (result == IOX2_OK) {
+        return number_of_recipients;
+    }
+
+    return bb::err(iox2::bb::into<SendError>(result));
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto Publisher<S, Payload, UserHeader>::loan_uninit()
     -> bb::Expected<SampleMutUninit<S, Payload, UserHeader>, LoanError> {
     SampleMutUninit<S, Payload, UserHeader> sample;
 
-    auto result = iox2_publisher_loan_slice_uninit(&m_handle, &sample.m_sample.m_sample, &sample.m_sample.m_handle, 1);
+    auto result = iox2_publisher_loan_uninit(&m_handle, &sample.m_sample.m_sample, &sample.m_sample.m_handle);
     internal::PlacementDefault<UserHeader>::placement_default(sample);
 
     if (result == IOX2_OK) {
@@ -254,6 +305,7 @@ template <typename T, typename>
 inline auto Publisher<S, Payload, UserHeader>::loan_slice_uninit(const uint64_t number_of_elements)
     -> bb::Expected<SampleMutUninit<S, T, UserHeader>, LoanError> {
     SampleMutUninit<S, Payload, UserHeader> sample;
+    sample.m_sample.m_cache.payload_element_size = m_payload_element_size;
 
     auto result = iox2_publisher_loan_slice_uninit(
         &m_handle, &sample.m_sample.m_sample, &sample.m_sample.m_handle, number_of_elements);
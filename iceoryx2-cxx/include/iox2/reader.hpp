@@ -94,10 +94,10 @@ inline Reader<S, KeyType>::~Reader() {
 
 template <ServiceType S, typename KeyType>
 inline auto Reader<S, KeyType>::id() const -> UniqueReaderId {
+    iox2_unique_reader_id_t id_storage {};
     iox2_unique_reader_id_h id_handle = nullptr;
-
-    iox2_reader_id(&m_handle, nullptr, &id_handle);
-    return UniqueReaderId { id_handle };
+    iox2_reader_id(&m_handle, &id_storage, &id_handle);
+    return UniqueReaderId(id_handle);
 }
 
 template <ServiceType S, typename KeyType>
@@ -105,7 +105,7 @@ template <typename ValueType>
 inline auto Reader<S, KeyType>::entry(const KeyType& key)
     -> bb::Expected<EntryHandle<S, KeyType, ValueType>, EntryHandleError> {
     iox2_entry_handle_h entry_handle {};
-    const auto type_name = internal::get_type_name<ValueType>();
+    const auto& type_name = internal::get_type_name<ValueType>();
 
     auto result = iox2_reader_entry(&m_handle,
                                     nullptr,
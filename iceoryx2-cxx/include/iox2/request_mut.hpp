@@ -94,6 +94,20 @@ class RequestMut {
         -> bb::Expected<PendingResponse<S, RequestPayloadT, RequestUserHeaderT, ResponsePayloadT, ResponseUserHeaderT>,
                         RequestSendError>;
 
+    /// Sends the [`RequestMut`] to all connected [`Server`]s of the [`Service`] without
+    /// expecting a [`Response`]. No [`PendingResponse`] is created and the request does not
+    /// count towards the active requests of the [`Client`]. Returns the number of [`Server`]s
+    /// that received the request. The [`Service`] must support fire and forget requests,
+    /// otherwise [`RequestSendError::FireAndForgetNotSupported`] is returned.
+    template <ServiceType S,
+              typename RequestPayloadT,
+              typename RequestUserHeaderT,
+              typename ResponsePayloadT,
+              typename ResponseUserHeaderT>
+    friend auto
+    send_and_forget(RequestMut<S, RequestPayloadT, RequestUserHeaderT, ResponsePayloadT, ResponseUserHeaderT>&& request)
+        -> bb::Expected<size_t, RequestSendError>;
+
     explicit RequestMut() = default;
     void drop();
 
@@ -151,9 +165,9 @@ template <ServiceType Service,
           typename ResponseUserHeader>
 inline auto RequestMut<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::header() const
     -> RequestHeader {
-    iox2_request_header_h header_handle = nullptr;
-    iox2_request_mut_header(&m_handle, nullptr, &header_handle);
-    return RequestHeader { header_handle };
+    RequestHeader header;
+    iox2_request_mut_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType Service,
@@ -272,6 +286,24 @@ inline auto send(RequestMut<Service, RequestPayload, RequestUserHeader, Response
     return bb::err(bb::into<RequestSendError>(result));
 }
 
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+inline auto
+send_and_forget(RequestMut<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>&& request)
+    -> bb::Expected<size_t, RequestSendError> {
+    size_t number_of_recipients = 0;
+    auto result = iox2_request_mut_send_and_forget(request.m_handle, &number_of_recipients);
+    request.m_handle = nullptr;
+
+    if (result == IOX2_OK) {
+        return number_of_recipients;
+    }
+    return bb::err(bb::into<RequestSendError>(result));
+}
+
 template <ServiceType Service,
           typename RequestPayload,
           typename RequestUserHeader,
@@ -13,6 +13,7 @@
 #ifndef IOX2_REQUEST_MUT_UNINIT_HPP
 #define IOX2_REQUEST_MUT_UNINIT_HPP
 
+#include "iox2/bb/duration.hpp"
 #include "iox2/bb/static_function.hpp"
 #include "iox2/header_request_response.hpp"
 #include "iox2/request_mut.hpp"
@@ -52,6 +53,11 @@ class RequestMutUninit {
               typename = std::enable_if_t<!std::is_same<void, RequestUserHeader>::value, T>>
     auto user_header_mut() -> T&;
 
+    /// Sets the deadline of the request to `timeout` from now. A [`Server`] with deadline
+    /// scheduling enabled hands out requests in earliest-deadline-first order and rejects
+    /// the request when its deadline has passed.
+    void set_deadline(const iox2::bb::Duration& timeout);
+
     /// Returns a reference to the user defined request payload.
     template <typename T = RequestPayload, typename = std::enable_if_t<!bb::IsSlice<T>::VALUE, void>>
     auto payload() const -> const RequestPayload&;
@@ -139,6 +145,16 @@ RequestMutUninit<Service, RequestPayload, RequestUserHeader, ResponsePayload, Re
     return m_request.template user_header_mut<T>();
 }
 
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestUserHeader,
+          typename ResponsePayload,
+          typename ResponseUserHeader>
+inline void RequestMutUninit<Service, RequestPayload, RequestUserHeader, ResponsePayload, ResponseUserHeader>::
+    set_deadline(const iox2::bb::Duration& timeout) {
+    iox2_request_mut_set_deadline(&m_request.m_handle, timeout.as_secs(), timeout.subsec_nanos());
+}
+
 template <ServiceType Service,
           typename RequestPayload,
           typename RequestUserHeader,
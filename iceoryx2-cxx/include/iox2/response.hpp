@@ -16,6 +16,7 @@
 #include "header_request_response.hpp"
 #include "iox2/bb/slice.hpp"
 #include "iox2/custom_payload_marker.hpp"
+#include "iox2/internal/payload_cache.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/service_type.hpp"
 
@@ -63,8 +64,10 @@ class Response {
     explicit Response(iox2_response_h handle) noexcept;
 
     void drop();
+    void cache_payload() const;
 
     iox2_response_h m_handle = nullptr;
+    mutable internal::PayloadCache<const void*> m_cache;
 };
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
@@ -78,6 +81,8 @@ inline auto Response<Service, ResponsePayload, ResponseUserHeader>::operator=(Re
         drop();
         m_handle = rhs.m_handle;
         rhs.m_handle = nullptr;
+        m_cache = rhs.m_cache;
+        rhs.m_cache = {};
     }
 
     return *this;
@@ -90,42 +95,32 @@ inline Response<Service, ResponsePayload, ResponseUserHeader>::~Response() noexc
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
 inline auto Response<Service, ResponsePayload, ResponseUserHeader>::header() const -> ResponseHeader {
-    iox2_response_header_h header_handle = nullptr;
-    iox2_response_header(&m_handle, nullptr, &header_handle);
-    return ResponseHeader { header_handle };
+    ResponseHeader header;
+    iox2_response_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
 template <typename T, typename>
 inline auto Response<Service, ResponsePayload, ResponseUserHeader>::user_header() const -> const T& {
-    const void* ptr = nullptr;
-    iox2_response_user_header(&m_handle, &ptr);
-    return *static_cast<const T*>(ptr);
+    if (m_cache.user_header == nullptr) {
+        iox2_response_user_header(&m_handle, &m_cache.user_header);
+    }
+    return *static_cast<const T*>(m_cache.user_header);
 }
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
 template <typename T, typename>
 inline auto Response<Service, ResponsePayload, ResponseUserHeader>::payload() const -> const T& {
-    const void* ptr = nullptr;
-    iox2_response_payload(&m_handle, &ptr, nullptr);
-    return *static_cast<const T*>(ptr);
+    cache_payload();
+    return *static_cast<const T*>(m_cache.payload);
 }
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
 template <typename T, typename>
 inline auto Response<Service, ResponsePayload, ResponseUserHeader>::payload() const -> bb::ImmutableSlice<ValueType> {
-    const void* ptr = nullptr;
-    size_t number_of_elements = 0;
-    iox2_response_payload(&m_handle, &ptr, &number_of_elements);
-
-    // for the custom payload marker, the slice length is the
-    // runtime payload byte size
-    auto length = number_of_elements;
-    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
-        length = iox2_response_payload_number_of_bytes(&m_handle);
-    }
-
-    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(ptr), length);
+    cache_payload();
+    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(m_cache.payload), m_cache.payload_length);
 }
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
@@ -145,6 +140,21 @@ inline void Response<Service, ResponsePayload, ResponseUserHeader>::drop() {
         m_handle = nullptr;
     }
 }
+
+template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
+inline void Response<Service, ResponsePayload, ResponseUserHeader>::cache_payload() const {
+    if (m_cache.payload != nullptr) {
+        return;
+    }
+
+    iox2_response_payload(&m_handle, &m_cache.payload, &m_cache.payload_length);
+
+    // for the custom payload marker, the slice length is the
+    // runtime payload byte size
+    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
+        m_cache.payload_length = iox2_response_payload_number_of_bytes(&m_handle);
+    }
+}
 } // namespace iox2
 
 #endif
@@ -125,9 +125,9 @@ inline ResponseMut<Service, ResponsePayload, ResponseUserHeader>::~ResponseMut()
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
 inline auto ResponseMut<Service, ResponsePayload, ResponseUserHeader>::header() const -> ResponseHeader {
-    iox2_response_header_h header_handle = nullptr;
-    iox2_response_mut_header(&m_handle, nullptr, &header_handle);
-    return ResponseHeader { header_handle };
+    ResponseHeader header;
+    iox2_response_mut_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType Service, typename ResponsePayload, typename ResponseUserHeader>
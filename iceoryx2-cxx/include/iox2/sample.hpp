@@ -16,6 +16,7 @@
 #include "iox2/bb/slice.hpp"
 #include "iox2/custom_payload_marker.hpp"
 #include "iox2/header_publish_subscribe.hpp"
+#include "iox2/internal/payload_cache.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/service_type.hpp"
@@ -67,6 +68,14 @@ class Sample {
     /// Returns the [`UniquePublisherId`] of the [`Publisher`](crate::port::publisher::Publisher)
     auto origin() const -> UniquePublisherId;
 
+    /// Returns a copy of the [`Header`] of the [`Sample`] that is read directly from the
+    /// header without acquiring any handle.
+    auto header_view() const -> HeaderPublishSubscribeView;
+
+    /// Returns the raw bytes of the [`UniquePublisherId`] of the
+    /// [`Publisher`](crate::port::publisher::Publisher) without acquiring any handle.
+    auto origin_bytes() const -> RawIdType;
+
   private:
     template <ServiceType, typename, typename>
     friend class Subscriber;
@@ -74,9 +83,11 @@ class Sample {
     // The sample is defaulted since both members are initialized in Subscriber::receive
     explicit Sample() = default;
     void drop();
+    void cache_payload() const;
 
     iox2_sample_t m_sample;
     iox2_sample_h m_handle = nullptr;
+    mutable internal::PayloadCache<const void*> m_cache;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -106,6 +117,8 @@ inline auto Sample<S, Payload, UserHeader>::operator=(Sample&& rhs) noexcept ->
 
         internal::iox2_sample_move(&rhs.m_sample, &m_sample, &m_handle);
         rhs.m_handle = nullptr;
+        m_cache = rhs.m_cache;
+        rhs.m_cache = {};
     }
 
     return *this;
@@ -119,47 +132,53 @@ inline Sample<S, Payload, UserHeader>::~Sample() {
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto Sample<S, Payload, UserHeader>::payload() const -> const ValueType& {
-    const void* ptr = nullptr;
-
-    iox2_sample_payload(&m_handle, &ptr, nullptr);
+    cache_payload();
 
-    return *static_cast<const ValueType*>(ptr);
+    return *static_cast<const ValueType*>(m_cache.payload);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto Sample<S, Payload, UserHeader>::payload() const -> bb::ImmutableSlice<ValueType> {
-    const void* ptr = nullptr;
-    size_t number_of_elements = 0;
+    cache_payload();
 
-    iox2_sample_payload(&m_handle, &ptr, &number_of_elements);
+    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(m_cache.payload), m_cache.payload_length);
+}
 
-    // for the custom payload marker, the slice length is the
-    // runtime payload byte size
-    auto length = number_of_elements;
-    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
-        length = iox2_sample_payload_number_of_bytes(&m_handle);
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename T, typename>
+inline auto Sample<S, Payload, UserHeader>::user_header() const -> const T& {
+    if (m_cache.user_header == nullptr) {
+        iox2_sample_user_header(&m_handle, &m_cache.user_header);
     }
 
-    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(ptr), length);
+    return *static_cast<const T*>(m_cache.user_header);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
-template <typename T, typename>
-inline auto Sample<S, Payload, UserHeader>::user_header() const -> const T& {
-    const void* header_ptr = nullptr;
+inline void Sample<S, Payload, UserHeader>::cache_payload() const {
+    if (m_cache.payload != nullptr) {
+        return;
+    }
 
-    iox2_sample_user_header(&m_handle, &header_ptr);
+    iox2_sample_payload(&m_handle, &m_cache.payload, &m_cache.payload_length);
 
-    return *static_cast<const T*>(header_ptr);
+    // for the custom payload marker, the slice length is the
+    // runtime payload byte size
+    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
+        if (m_cache.payload_element_size != 0) {
+            m_cache.payload_length *= m_cache.payload_element_size;
+        } else {
+            m_cache.payload_length = iox2_sample_payload_number_of_bytes(&m_handle);
+        }
+    }
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Sample<S, Payload, UserHeader>::header() const -> HeaderPublishSubscribe {
-    iox2_publish_subscribe_header_h header_handle = nullptr;
-    iox2_sample_header(&m_handle, nullptr, &header_handle);
-
-    return HeaderPublishSubscribe { header_handle };
+    HeaderPublishSubscribe header;
+    iox2_sample_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -167,6 +186,25 @@ inline auto Sample<S, Payload, UserHeader>::origin() const -> UniquePublisherId
     return header().publisher_id();
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Sample<S, Payload, UserHeader>::header_view() const -> HeaderPublishSubscribeView {
+    auto publisher_id = RawIdType::from_value<RawIdType::capacity()>(0U);
+    uint64_t number_of_elements = 0;
+    uint64_t send_timestamp = 0;
+    iox2_sample_header_view(&m_handle,
+                            publisher_id.unchecked_access().data(),
+                            publisher_id.size(),
+                            &number_of_elements,
+                            &send_timestamp);
+
+    return HeaderPublishSubscribeView { std::move(publisher_id), number_of_elements, send_timestamp };
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Sample<S, Payload, UserHeader>::origin_bytes() const -> RawIdType {
+    return header_view().publisher_id();
+}
+
 } // namespace iox2
 
 #endif
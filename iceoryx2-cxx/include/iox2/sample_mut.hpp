@@ -19,6 +19,7 @@
 #include "iox2/header_publish_subscribe.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/internal/payload_cache.hpp"
 #include "iox2/payload_info.hpp"
 #include "iox2/publisher_error.hpp"
 #include "iox2/service_type.hpp"
@@ -61,6 +62,10 @@ class SampleMut {
     /// Returns a reference to the [`Header`] of the [`Sample`].
     auto header() const -> HeaderPublishSubscribe;
 
+    /// Sets the priority of the [`Sample`]. When the [`Service`] has multiple priority lanes,
+    /// the [`Sample`] is received before all [`Sample`]s with a lower priority.
+    void set_priority(uint8_t value);
+
     /// Returns a reference to the user_header of the [`Sample`]
     template <typename T = UserHeader, typename = std::enable_if_t<!std::is_same<void, UserHeader>::value, T>>
     auto user_header() const -> const T&;
@@ -96,10 +101,12 @@ class SampleMut {
     // Publisher::loan_slice()
     explicit SampleMut() = default;
     void drop();
+    void cache_payload() const;
 
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init) will not be accessed directly but only via m_handle and will be set together with m_handle
     iox2_sample_mut_t m_sample;
     iox2_sample_mut_h m_handle = nullptr;
+    mutable internal::PayloadCache<void*> m_cache;
 };
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -129,6 +136,8 @@ inline auto SampleMut<S, Payload, UserHeader>::operator=(SampleMut&& rhs) noexce
 
         internal::iox2_sample_mut_move(&rhs.m_sample, &m_sample, &m_handle);
         rhs.m_handle = nullptr;
+        m_cache = rhs.m_cache;
+        rhs.m_cache = {};
     }
 
     return *this;
@@ -141,84 +150,85 @@ inline SampleMut<S, Payload, UserHeader>::~SampleMut() noexcept {
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto SampleMut<S, Payload, UserHeader>::header() const -> HeaderPublishSubscribe {
-    iox2_publish_subscribe_header_h header_handle = nullptr;
-    iox2_sample_mut_header(&m_handle, nullptr, &header_handle);
+    HeaderPublishSubscribe header;
+    iox2_sample_mut_header(&m_handle, &header.m_value, &header.m_handle);
+    return header;
+}
 
-    return HeaderPublishSubscribe { header_handle };
+template <ServiceType S, typename Payload, typename UserHeader>
+inline void SampleMut<S, Payload, UserHeader>::set_priority(const uint8_t value) {
+    iox2_sample_mut_set_priority(&m_handle, value);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::user_header() const -> const T& {
-    const void* ptr = nullptr;
-
-    iox2_sample_mut_user_header(&m_handle, &ptr);
+    if (m_cache.user_header == nullptr) {
+        iox2_sample_mut_user_header_mut(&m_handle, &m_cache.user_header);
+    }
 
-    return *static_cast<const T*>(ptr);
+    return *static_cast<const T*>(m_cache.user_header);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::user_header_mut() -> T& {
-    void* ptr = nullptr;
-
-    iox2_sample_mut_user_header_mut(&m_handle, &ptr);
+    if (m_cache.user_header == nullptr) {
+        iox2_sample_mut_user_header_mut(&m_handle, &m_cache.user_header);
+    }
 
-    return *static_cast<T*>(ptr);
+    return *static_cast<T*>(m_cache.user_header);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::payload() const -> const ValueType& {
-    const void* ptr = nullptr;
-
-    iox2_sample_mut_payload(&m_handle, &ptr, nullptr);
+    cache_payload();
 
-    return *static_cast<const ValueType*>(ptr);
+    return *static_cast<const ValueType*>(m_cache.payload);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::payload_mut() -> ValueType& {
-    void* ptr = nullptr;
-
-    iox2_sample_mut_payload_mut(&m_handle, &ptr, nullptr);
+    cache_payload();
 
-    return *static_cast<ValueType*>(ptr);
+    return *static_cast<ValueType*>(m_cache.payload);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::payload() const -> bb::ImmutableSlice<ValueType> {
-    const void* ptr = nullptr;
-    size_t number_of_elements = 0;
+    cache_payload();
 
-    iox2_sample_mut_payload(&m_handle, &ptr, &number_of_elements);
-
-    // for the custom payload marker, the slice length is the
-    // runtime payload byte size
-    auto length = number_of_elements;
-    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
-        length = iox2_sample_mut_payload_number_of_bytes(&m_handle);
-    }
-
-    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(ptr), length);
+    return bb::ImmutableSlice<ValueType>(static_cast<const ValueType*>(m_cache.payload), m_cache.payload_length);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMut<S, Payload, UserHeader>::payload_mut() -> bb::MutableSlice<ValueType> {
-    void* ptr = nullptr;
-    size_t number_of_elements = 0;
+    cache_payload();
 
-    iox2_sample_mut_payload_mut(&m_handle, &ptr, &number_of_elements);
+    return bb::MutableSlice<ValueType>(static_cast<ValueType*>(m_cache.payload), m_cache.payload_length);
+}
 
-    auto length = number_of_elements;
-    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
-        length = iox2_sample_mut_payload_number_of_bytes(&m_handle);
+template <ServiceType S, typename Payload, typename UserHeader>
+inline void SampleMut<S, Payload, UserHeader>::cache_payload() const {
+    if (m_cache.payload != nullptr) {
+        return;
     }
 
-    return bb::MutableSlice<ValueType>(static_cast<ValueType*>(ptr), length);
+    iox2_sample_mut_payload_mut(&m_handle, &m_cache.payload, &m_cache.payload_length);
+
+    // for the custom payload marker, the slice length is the
+    // runtime payload byte size
+    if (std::is_same<ValueType, CustomPayloadMarker>::value) {
+        if (m_cache.payload_element_size != 0) {
+            m_cache.payload_length *= m_cache.payload_element_size;
+        } else {
+            m_cache.payload_length = iox2_sample_mut_payload_number_of_bytes(&m_handle);
+        }
+    }
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
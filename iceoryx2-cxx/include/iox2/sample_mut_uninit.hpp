@@ -19,6 +19,9 @@
 #include "iox2/sample_mut.hpp"
 #include "iox2/service_type.hpp"
 
+#include <algorithm>
+#include <type_traits>
+
 namespace iox2 {
 template <ServiceType S, typename Payload, typename UserHeader>
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,hicpp-member-init) 'm_sample' is not used directly but only via the initialized 'm_handle'; furthermore, it will be initialized on the call site
@@ -36,6 +39,10 @@ class SampleMutUninit {
     /// Returns a reference to the [`Header`] of the [`Sample`].
     auto header() const -> HeaderPublishSubscribe;
 
+    /// Sets the priority of the [`Sample`]. When the [`Service`] has multiple priority lanes,
+    /// the [`Sample`] is received before all [`Sample`]s with a lower priority.
+    void set_priority(uint8_t value);
+
     /// Returns a reference to the user_header of the [`Sample`]
     template <typename T = UserHeader, typename = std::enable_if_t<!std::is_same<void, UserHeader>::value, T>>
     auto user_header() const -> const T&;
@@ -67,6 +74,28 @@ class SampleMutUninit {
     auto write_from_fn(const iox2::bb::StaticFunction<typename T::ValueType(uint64_t)>& initializer)
         -> SampleMut<S, Payload, UserHeader>;
 
+    /// Writes the payload to the sample by calling the `initializer` with the index of every
+    /// element. In contrast to the [`bb::StaticFunction`] overload the callable is not
+    /// type-erased, so that the loop can be inlined and vectorized by the compiler.
+    template <typename F,
+              typename T = Payload,
+              typename = std::enable_if_t<
+                  bb::IsSlice<T>::VALUE && std::is_invocable_r_v<typename T::ValueType, F&, uint64_t>
+                      && !std::is_same_v<std::decay_t<F>, bb::StaticFunction<typename T::ValueType(uint64_t)>>,
+                  T>>
+    auto write_from_fn(F&& initializer) -> SampleMut<S, Payload, UserHeader>;
+
+    /// Writes the payload to the sample in blocks of at most `block_size` elements. The
+    /// `initializer` is called with a [`bb::MutableSlice`] of the uninitialized elements of the
+    /// block and the index of its first element and must initialize all of them, e.g. with
+    /// placement new or with a bulk copy.
+    template <typename F,
+              typename T = Payload,
+              typename = std::enable_if_t<
+                  bb::IsSlice<T>::VALUE && std::is_invocable_v<F&, bb::MutableSlice<typename T::ValueType>, uint64_t>,
+                  T>>
+    auto write_from_block_fn(uint64_t block_size, F&& initializer) -> SampleMut<S, Payload, UserHeader>;
+
     /// mem copies the value to the sample
     template <typename T = Payload, typename = std::enable_if_t<bb::IsSlice<T>::VALUE, T>>
     auto write_from_slice(bb::ImmutableSlice<ValueType>& value) -> SampleMut<S, Payload, UserHeader>;
@@ -97,6 +126,11 @@ inline auto SampleMutUninit<S, Payload, UserHeader>::header() const -> HeaderPub
     return m_sample.header();
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline void SampleMutUninit<S, Payload, UserHeader>::set_priority(const uint8_t value) {
+    m_sample.set_priority(value);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMutUninit<S, Payload, UserHeader>::user_header() const -> const T& {
@@ -151,6 +185,36 @@ inline auto SampleMutUninit<S, Payload, UserHeader>::write_from_fn(
     return std::move(m_sample);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename F, typename T, typename>
+inline auto SampleMutUninit<S, Payload, UserHeader>::write_from_fn(F&& initializer)
+    -> SampleMut<S, Payload, UserHeader> {
+    auto slice = payload_mut();
+    auto* elements = slice.data();
+    const auto number_of_elements = slice.number_of_elements();
+    for (uint64_t i = 0; i < number_of_elements; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are ensured by the loop
+        new (elements + i) typename T::ValueType(initializer(i));
+    }
+    return std::move(m_sample);
+}
+
+template <ServiceType S, typename Payload, typename UserHeader>
+template <typename F, typename T, typename>
+inline auto SampleMutUninit<S, Payload, UserHeader>::write_from_block_fn(const uint64_t block_size, F&& initializer)
+    -> SampleMut<S, Payload, UserHeader> {
+    IOX2_ASSERT(block_size > 0, "The block size must be greater than zero");
+    auto slice = payload_mut();
+    auto* elements = slice.data();
+    const auto number_of_elements = slice.number_of_elements();
+    for (uint64_t offset = 0; offset < number_of_elements; offset += block_size) {
+        const auto len = std::min(block_size, number_of_elements - offset);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are ensured by the loop
+        initializer(bb::MutableSlice<typename T::ValueType>(elements + offset, len), offset);
+    }
+    return std::move(m_sample);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 template <typename T, typename>
 inline auto SampleMutUninit<S, Payload, UserHeader>::write_from_slice(bb::ImmutableSlice<ValueType>& value)
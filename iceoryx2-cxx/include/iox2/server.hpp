@@ -17,6 +17,7 @@
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/optional.hpp"
 #include "iox2/bb/slice.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/unique_port_id.hpp"
 
@@ -51,6 +52,11 @@ class Server {
     /// Returns the [`UniqueServerId`] of the [`Server`]
     auto id() const -> UniqueServerId;
 
+    /// Returns the [`PortStatistics`] of the [`Server`]. `received` counts the received
+    /// requests, `sent` the sent responses, `overflows` the responses that were dropped since
+    /// the buffer of a [`Client`] was full and `failed_loans` the response loans that failed.
+    auto statistics() const -> PortStatistics;
+
     /// Returns true if the [`Server`] has [`RequestMut`]s in its buffer.
     auto has_requests() const -> bb::Expected<bool, ConnectionFailure>;
 
@@ -143,9 +149,22 @@ template <ServiceType Service,
           typename ResponseHeader>
 inline auto Server<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::id() const
     -> UniqueServerId {
+    iox2_unique_server_id_t id_storage {};
     iox2_unique_server_id_h id_handle = nullptr;
-    iox2_server_id(&m_handle, nullptr, &id_handle);
-    return UniqueServerId { id_handle };
+    iox2_server_id(&m_handle, &id_storage, &id_handle);
+    return UniqueServerId(id_handle);
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto Server<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::statistics() const
+    -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_server_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
 }
 
 template <ServiceType Service,
@@ -0,0 +1,427 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_SERVER_DISPATCHER_HPP
+#define IOX2_SERVER_DISPATCHER_HPP
+
+#include "iox2/active_request.hpp"
+#include "iox2/bb/detail/builder.hpp"
+#include "iox2/bb/duration.hpp"
+#include "iox2/bb/expected.hpp"
+#include "iox2/bb/mpmc_queue.hpp"
+#include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_function.hpp"
+#include "iox2/callback_progression.hpp"
+#include "iox2/log.hpp"
+#include "iox2/server.hpp"
+#include "iox2/server_dispatcher_error.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/waitset.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace iox2 {
+/// Distributes the [`ActiveRequest`]s of a [`Server`] to a pool of worker threads. A dedicated
+/// dispatcher thread, woken up by a [`WaitSet`] in the configured dispatch interval, receives
+/// all pending requests and hands them round-robin to the workers. Every worker owns a
+/// lock-free queue and steals from the queues of the other workers when its own queue is
+/// empty so that CPU-heavy requests are spread across all workers without any mutex.
+///
+/// The handler is called concurrently from all workers and must therefore be thread-safe.
+/// When a [`ServerDispatcher`] goes out of scope it stops the dispatching, lets the workers
+/// finish all requests that were already dispatched and joins all threads.
+///
+/// Can be created via the [`ServerDispatcherBuilder`].
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+class ServerDispatcher {
+  public:
+    /// The maximum number of worker threads a [`ServerDispatcher`] can use.
+    static constexpr uint64_t MAX_NUMBER_OF_WORKERS = 64;
+
+    /// The number of [`ActiveRequest`]s that can be queued per worker. When all queues are
+    /// full, the remaining requests stay in the buffer of the [`Server`] until a worker has
+    /// taken a request.
+    static constexpr uint64_t WORKER_QUEUE_CAPACITY = 32;
+
+    using ActiveRequestType = ActiveRequest<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>;
+    using Handler = bb::StaticFunction<void(ActiveRequestType&&)>;
+
+    ServerDispatcher(ServerDispatcher&&) noexcept = default;
+    auto operator=(ServerDispatcher&& rhs) noexcept -> ServerDispatcher&;
+    ~ServerDispatcher() noexcept;
+
+    ServerDispatcher(const ServerDispatcher&) = delete;
+    auto operator=(const ServerDispatcher&) -> ServerDispatcher& = delete;
+
+    /// Returns the number of worker threads.
+    auto number_of_workers() const -> uint64_t;
+
+    /// Returns the number of [`ActiveRequest`]s that were handed to the workers.
+    auto number_of_dispatched_requests() const -> uint64_t;
+
+    /// Returns true as long as the dispatcher thread is receiving requests. It stops when
+    /// the [`WaitSet`] received an interrupt or termination signal or failed.
+    auto is_dispatching() const -> bool;
+
+  private:
+    friend class ServerDispatcherBuilder;
+
+    using Queue = bb::MpmcQueue<ActiveRequestType, WORKER_QUEUE_CAPACITY>;
+    using ServerType = Server<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>;
+
+    // the threads refer to the state, therefore it must not move when the
+    // ServerDispatcher is moved
+    struct State {
+        State(ServerType&& server, WaitSet<Service>&& waitset, const Handler& handler, uint64_t number_of_workers)
+            : server { std::move(server) }
+            , waitset { std::move(waitset) }
+            , handler { handler }
+            , number_of_workers { number_of_workers } {
+        }
+
+        ServerType server;
+        WaitSet<Service> waitset;
+        bb::Optional<WaitSetGuard<Service>> dispatch_guard;
+        Handler handler;
+        uint64_t number_of_workers;
+        bb::Duration idle_time { bb::Duration::from_millis(1) };
+        std::array<Queue, MAX_NUMBER_OF_WORKERS> queues;
+        std::array<std::thread, MAX_NUMBER_OF_WORKERS> workers;
+        std::thread dispatcher;
+        uint64_t next_worker { 0 };
+        std::atomic<uint64_t> number_of_dispatched_requests { 0 };
+        std::atomic<bool> keep_dispatching { true };
+        std::atomic<bool> is_dispatching { true };
+        std::atomic<bool> keep_working { true };
+    };
+
+    explicit ServerDispatcher(std::unique_ptr<State>&& state) noexcept;
+
+    static void dispatch(State& state);
+    static void work(State& state, uint64_t worker_id);
+    static auto take(State& state, uint64_t worker_id) -> bb::Optional<ActiveRequestType>;
+    static auto queue_with_space(State& state) -> bb::Optional<uint64_t>;
+    void drop();
+
+    std::unique_ptr<State> m_state;
+};
+
+/// Creates a [`ServerDispatcher`] that takes the ownership of a [`Server`].
+class ServerDispatcherBuilder {
+    /// Defines the number of worker threads that process the [`ActiveRequest`]s.
+    /// If not set, it uses the number of hardware threads.
+#ifdef DOXYGEN_MACRO_FIX
+    auto number_of_workers(const uint64_t value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(uint64_t, number_of_workers);
+#endif
+
+    /// Defines the interval in which the dispatcher thread receives new requests from the
+    /// [`Server`]. It is also the longest time an idle worker sleeps before it looks for
+    /// new requests. If not set, it is one millisecond.
+#ifdef DOXYGEN_MACRO_FIX
+    auto dispatch_interval(const bb::Duration value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bb::Duration, dispatch_interval);
+#endif
+
+  public:
+    ServerDispatcherBuilder() = default;
+    ServerDispatcherBuilder(const ServerDispatcherBuilder&) = delete;
+    ServerDispatcherBuilder(ServerDispatcherBuilder&&) = default;
+    auto operator=(const ServerDispatcherBuilder&) -> ServerDispatcherBuilder& = delete;
+    auto operator=(ServerDispatcherBuilder&&) -> ServerDispatcherBuilder& = default;
+    ~ServerDispatcherBuilder() = default;
+
+    /// Creates the [`ServerDispatcher`], starts the dispatcher and all worker threads. The
+    /// `handler` is called for every [`ActiveRequest`] from one of the worker threads.
+    template <ServiceType Service,
+              typename RequestPayload,
+              typename RequestHeader,
+              typename ResponsePayload,
+              typename ResponseHeader>
+    auto create(Server<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>&& server,
+                const typename ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::
+                    Handler& handler) && -> bb::Expected<ServerDispatcher<Service,
+                                                                           RequestPayload,
+                                                                           RequestHeader,
+                                                                           ResponsePayload,
+                                                                           ResponseHeader>,
+                                                          ServerDispatcherCreateError>;
+
+  private:
+    static constexpr uint64_t DEFAULT_DISPATCH_INTERVAL_IN_MILLISECONDS = 1;
+};
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::ServerDispatcher(
+    std::unique_ptr<State>&& state) noexcept
+    : m_state { std::move(state) } {
+    auto* state_ptr = m_state.get();
+    for (uint64_t worker_id = 0; worker_id < m_state->number_of_workers; ++worker_id) {
+        m_state->workers[worker_id] = std::thread([state_ptr, worker_id] { work(*state_ptr, worker_id); });
+    }
+    m_state->dispatcher = std::thread([state_ptr] { dispatch(*state_ptr); });
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::operator=(
+    ServerDispatcher&& rhs) noexcept -> ServerDispatcher& {
+    if (this != &rhs) {
+        drop();
+        m_state = std::move(rhs.m_state);
+    }
+
+    return *this;
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::
+    ~ServerDispatcher() noexcept {
+    drop();
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline void ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::drop() {
+    if (m_state == nullptr) {
+        return;
+    }
+
+    // the dispatcher must be stopped before the workers so that every request that
+    // was taken from the server is processed
+    m_state->keep_dispatching.store(false);
+    m_state->dispatcher.join();
+    m_state->keep_working.store(false, std::memory_order_release);
+    for (uint64_t worker_id = 0; worker_id < m_state->number_of_workers; ++worker_id) {
+        m_state->workers[worker_id].join();
+    }
+
+    m_state->dispatch_guard.reset();
+    m_state.reset();
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto
+ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::number_of_workers() const
+    -> uint64_t {
+    return m_state->number_of_workers;
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::
+    number_of_dispatched_requests() const -> uint64_t {
+    return m_state->number_of_dispatched_requests.load(std::memory_order_relaxed);
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto
+ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::is_dispatching() const
+    -> bool {
+    return m_state->is_dispatching.load();
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto
+ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::queue_with_space(
+    State& state) -> bb::Optional<uint64_t> {
+    for (uint64_t i = 0; i < state.number_of_workers; ++i) {
+        const auto worker_id = (state.next_worker + i) % state.number_of_workers;
+        if (state.queues[worker_id].has_space()) {
+            state.next_worker = worker_id + 1;
+            return worker_id;
+        }
+    }
+
+    return bb::NULLOPT;
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline void
+ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::dispatch(State& state) {
+    auto result = state.waitset.wait_and_process([&](auto) -> CallbackProgression {
+        if (!state.keep_dispatching.load()) {
+            return CallbackProgression::Stop;
+        }
+
+        // the dispatcher is the only producer, when a queue has space before the request
+        // is received, the push cannot fail and no request has to be held back
+        while (true) {
+            auto worker_id = queue_with_space(state);
+            if (!worker_id.has_value()) {
+                break;
+            }
+
+            auto active_request = state.server.receive();
+            if (!active_request.has_value()) {
+                log(LogLevel::Error, "ServerDispatcher", "Unable to receive requests from the server.");
+                break;
+            }
+
+            if (!active_request->has_value()) {
+                break;
+            }
+
+            static_cast<void>(state.queues[worker_id.value()].try_push(std::move(active_request->value())));
+            state.number_of_dispatched_requests.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return CallbackProgression::Continue;
+    });
+
+    if (!result.has_value()) {
+        log(LogLevel::Error, "ServerDispatcher", "The dispatcher stopped due to a failure in the WaitSet.");
+    }
+    state.is_dispatching.store(false);
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::take(
+    State& state, uint64_t worker_id) -> bb::Optional<ActiveRequestType> {
+    for (uint64_t i = 0; i < state.number_of_workers; ++i) {
+        auto active_request = state.queues[(worker_id + i) % state.number_of_workers].pop();
+        if (active_request.has_value()) {
+            return active_request;
+        }
+    }
+
+    return bb::NULLOPT;
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline void ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::work(
+    State& state, uint64_t worker_id) {
+    constexpr uint64_t NUMBER_OF_SPINS_BEFORE_SLEEP = 64;
+    uint64_t number_of_spins = 0;
+
+    while (true) {
+        // must be loaded before the queues are inspected, otherwise a request that was
+        // dispatched right before the shutdown could be missed
+        const auto keep_working = state.keep_working.load(std::memory_order_acquire);
+        auto active_request = take(state, worker_id);
+        if (active_request.has_value()) {
+            state.handler(std::move(active_request.value()));
+            number_of_spins = 0;
+            continue;
+        }
+
+        if (!keep_working) {
+            return;
+        }
+
+        if (number_of_spins < NUMBER_OF_SPINS_BEFORE_SLEEP) {
+            ++number_of_spins;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(state.idle_time.as_nanos()));
+        }
+    }
+}
+
+template <ServiceType Service,
+          typename RequestPayload,
+          typename RequestHeader,
+          typename ResponsePayload,
+          typename ResponseHeader>
+inline auto ServerDispatcherBuilder::create(
+    Server<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>&& server,
+    const typename ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>::Handler&
+        handler) && -> bb::Expected<ServerDispatcher<Service,
+                                                      RequestPayload,
+                                                      RequestHeader,
+                                                      ResponsePayload,
+                                                      ResponseHeader>,
+                                     ServerDispatcherCreateError> {
+    using DispatcherType = ServerDispatcher<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>;
+
+    const uint64_t number_of_workers = m_number_of_workers.value_or(std::max<uint64_t>(
+        1, std::min<uint64_t>(std::thread::hardware_concurrency(), DispatcherType::MAX_NUMBER_OF_WORKERS)));
+    if (number_of_workers == 0 || number_of_workers > DispatcherType::MAX_NUMBER_OF_WORKERS) {
+        return bb::err(ServerDispatcherCreateError::InvalidNumberOfWorkers);
+    }
+
+    auto waitset = WaitSetBuilder().create<Service>();
+    if (!waitset.has_value()) {
+        return bb::err(ServerDispatcherCreateError::UnableToCreateWaitSet);
+    }
+
+    const auto dispatch_interval =
+        m_dispatch_interval.value_or(bb::Duration::from_millis(DEFAULT_DISPATCH_INTERVAL_IN_MILLISECONDS));
+
+    auto state = std::make_unique<typename DispatcherType::State>(
+        std::move(server), std::move(waitset.value()), handler, number_of_workers);
+    state->idle_time = dispatch_interval;
+
+    auto guard = state->waitset.attach_interval(dispatch_interval);
+    if (!guard.has_value()) {
+        return bb::err(ServerDispatcherCreateError::UnableToAttachDispatchInterval);
+    }
+    state->dispatch_guard.emplace(std::move(guard.value()));
+
+    return DispatcherType(std::move(state));
+}
+} // namespace iox2
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_SERVER_DISPATCHER_ERROR_HPP
+#define IOX2_SERVER_DISPATCHER_ERROR_HPP
+
+#include <cstdint>
+
+namespace iox2 {
+/// Defines a failure that can occur when a [`ServerDispatcher`] is created with
+/// [`ServerDispatcherBuilder`].
+enum class ServerDispatcherCreateError : uint8_t {
+    /// The number of workers is zero or exceeds [`ServerDispatcher::MAX_NUMBER_OF_WORKERS`].
+    InvalidNumberOfWorkers,
+    /// The [`WaitSet`] that drives the dispatching could not be created.
+    UnableToCreateWaitSet,
+    /// The dispatch interval could not be attached to the [`WaitSet`].
+    UnableToAttachDispatchInterval,
+};
+} // namespace iox2
+#endif
@@ -14,6 +14,7 @@
 #define IOX2_SERVICE_HPP
 
 #include "iox2/bb/expected.hpp"
+#include "iox2/bb/function_ref.hpp"
 #include "iox2/bb/optional.hpp"
 #include "iox2/bb/static_function.hpp"
 #include "iox2/callback_progression.hpp"
@@ -41,8 +42,7 @@ class Service {
         -> bb::Expected<bb::Optional<ServiceDetails<S>>, ServiceDetailsError>;
 
     /// Returns a list of all services created under a given [`config::Config`].
-    static auto list(ConfigView config,
-                     const iox2::bb::StaticFunction<CallbackProgression(ServiceDetails<S>)>& callback)
+    static auto list(ConfigView config, iox2::bb::FunctionRef<CallbackProgression(ServiceDetails<S>)> callback)
         -> bb::Expected<void, ServiceListError>;
 };
 } // namespace iox2
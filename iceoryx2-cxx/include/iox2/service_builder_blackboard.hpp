@@ -130,7 +130,7 @@ template <typename KeyType, ServiceType S>
 inline ServiceBuilderBlackboardCreator<KeyType, S>::ServiceBuilderBlackboardCreator(iox2_service_builder_h handle)
     : m_handle { iox2_service_builder_blackboard_creator(handle) } {
     // set key type details so that these are available in add()
-    const auto type_name = internal::get_type_name<KeyType>();
+    const auto& type_name = internal::get_type_name<KeyType>();
     const auto key_type_result = iox2_service_builder_blackboard_creator_set_key_type_details(
         &m_handle, type_name.unchecked_access().c_str(), type_name.size(), sizeof(KeyType), alignof(KeyType));
     if (key_type_result != IOX2_OK) {
@@ -161,7 +161,7 @@ inline auto ServiceBuilderBlackboardCreator<KeyType, S>::add(KeyType key, ValueT
 
     // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): required by C API
     auto value_ptr = new ValueType(value);
-    const auto type_name = internal::get_type_name<ValueType>();
+    const auto& type_name = internal::get_type_name<ValueType>();
 
     iox2_service_builder_blackboard_creator_add(
         &m_handle,
@@ -236,7 +236,7 @@ inline void ServiceBuilderBlackboardOpener<KeyType, S>::set_parameters() {
     }
 
     // key type details
-    const auto type_name = internal::get_type_name<KeyType>();
+    const auto& type_name = internal::get_type_name<KeyType>();
     const auto key_type_result = iox2_service_builder_blackboard_opener_set_key_type_details(
         &m_handle, type_name.unchecked_access().c_str(), type_name.size(), sizeof(KeyType), alignof(KeyType));
     if (key_type_result != IOX2_OK) {
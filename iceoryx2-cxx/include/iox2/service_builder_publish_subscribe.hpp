@@ -87,6 +87,25 @@ class ServiceBuilderPublishSubscribe {
     IOX2_BUILDER_OPTIONAL(bool, enable_safe_overflow);
 #endif
 
+    /// If the [`Service`] is created, defines if every [`Sample`] carries the monotonic clock
+    /// time at which it was sent. If an existing [`Service`] is opened the setting of the
+    /// existing [`Service`] is used.
+#ifdef DOXYGEN_MACRO_FIX
+    auto enable_send_timestamps(const bool value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(bool, enable_send_timestamps);
+#endif
+
+    /// If the [`Service`] is created, defines the number of priority lanes of every
+    /// [`Subscriber`]. [`Sample`]s in a higher lane are received before all [`Sample`]s in a
+    /// lower lane. If an existing [`Service`] is opened the setting of the existing
+    /// [`Service`] is used.
+#ifdef DOXYGEN_MACRO_FIX
+    auto priority_lanes(const uint64_t value) -> decltype(auto);
+#else
+    IOX2_BUILDER_OPTIONAL(uint64_t, priority_lanes);
+#endif
+
     /// If the [`Service`] is created it defines how many [`Sample`]s a
     /// [`Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -213,6 +232,12 @@ inline void ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::set_paramete
     if (m_enable_safe_overflow.has_value()) {
         iox2_service_builder_pub_sub_set_enable_safe_overflow(&m_handle, m_enable_safe_overflow.value());
     }
+    if (m_enable_send_timestamps.has_value()) {
+        iox2_service_builder_pub_sub_set_enable_send_timestamps(&m_handle, m_enable_send_timestamps.value());
+    }
+    if (m_priority_lanes.has_value()) {
+        iox2_service_builder_pub_sub_set_priority_lanes(&m_handle, m_priority_lanes.value());
+    }
     if (m_subscriber_max_borrowed_samples.has_value()) {
         iox2_service_builder_pub_sub_set_subscriber_max_borrowed_samples(&m_handle,
                                                                          m_subscriber_max_borrowed_samples.value());
@@ -253,7 +278,7 @@ template <typename Payload, typename UserHeader, ServiceType S>
 inline void ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::derive_user_header_type_details() {
     // user header type details derived from the compile-time UserHeader
     const auto header_layout = bb::Layout::from<UserHeader>();
-    const auto user_header_type_name = internal::get_type_name<UserHeader>();
+    const auto& user_header_type_name = internal::get_type_name<UserHeader>();
 
     const auto result =
         iox2_service_builder_pub_sub_set_user_header_type_details(&m_handle,
@@ -288,7 +313,7 @@ inline void ServiceBuilderPublishSubscribe<Payload, UserHeader, S>::derive_paylo
     using ValueType = typename PayloadInfo<Payload>::ValueType;
 
     // payload type details derived from the compile-time Payload
-    const auto payload_type_name = internal::get_type_name<Payload>();
+    const auto& payload_type_name = internal::get_type_name<Payload>();
     const auto type_variant =
         bb::IsSlice<Payload>::VALUE ? iox2_type_variant_e_DYNAMIC : iox2_type_variant_e_FIXED_SIZE;
 
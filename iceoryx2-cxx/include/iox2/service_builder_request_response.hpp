@@ -619,7 +619,7 @@ inline void ServiceBuilderRequestResponse<RequestPayload, RequestUserHeader, Res
     derive_request_header_type_details() {
     // request header type details derived from the compile-time RequestUserHeader
     const auto header_layout = bb::Layout::from<RequestUserHeader>();
-    const auto header_type_name = internal::get_type_name<RequestUserHeader>();
+    const auto& header_type_name = internal::get_type_name<RequestUserHeader>();
 
     const auto result = iox2_service_builder_request_response_set_request_header_type_details(
         &m_handle,
@@ -662,7 +662,7 @@ inline void ServiceBuilderRequestResponse<RequestPayload, RequestUserHeader, Res
     derive_response_header_type_details() {
     // response header type details derived from the compile-time ResponseUserHeader
     const auto header_layout = bb::Layout::from<ResponseUserHeader>();
-    const auto header_type_name = internal::get_type_name<ResponseUserHeader>();
+    const auto& header_type_name = internal::get_type_name<ResponseUserHeader>();
 
     const auto result = iox2_service_builder_request_response_set_response_header_type_details(
         &m_handle,
@@ -706,7 +706,7 @@ inline void ServiceBuilderRequestResponse<RequestPayload, RequestUserHeader, Res
     using ValueType = typename PayloadInfo<RequestPayload>::ValueType;
 
     // request payload type details derived from the compile-time RequestPayload
-    const auto payload_type_name = internal::get_type_name<RequestPayload>();
+    const auto& payload_type_name = internal::get_type_name<RequestPayload>();
     const auto type_variant =
         bb::IsSlice<RequestPayload>::VALUE ? iox2_type_variant_e_DYNAMIC : iox2_type_variant_e_FIXED_SIZE;
 
@@ -752,7 +752,7 @@ inline void ServiceBuilderRequestResponse<RequestPayload, RequestUserHeader, Res
     using ValueType = typename PayloadInfo<ResponsePayload>::ValueType;
 
     // response payload type details derived from the compile-time ResponsePayload
-    const auto payload_type_name = internal::get_type_name<ResponsePayload>();
+    const auto& payload_type_name = internal::get_type_name<ResponsePayload>();
     const auto type_variant =
         bb::IsSlice<ResponsePayload>::VALUE ? iox2_type_variant_e_DYNAMIC : iox2_type_variant_e_FIXED_SIZE;
 
@@ -49,6 +49,12 @@ class StaticConfigPublishSubscribe {
     /// [`Sample`] from the [`Subscriber`] when its buffer is full.
     auto has_safe_overflow() const -> bool;
 
+    /// Returns true if every [`Sample`] carries the monotonic clock time at which it was sent.
+    auto has_send_timestamps() const -> bool;
+
+    /// Returns the number of priority lanes of every [`Subscriber`].
+    auto number_of_priority_lanes() const -> uint64_t;
+
     /// Returns the type details of the [`Service`].
     auto message_type_details() const -> MessageTypeDetails;
 
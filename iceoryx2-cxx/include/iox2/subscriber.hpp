@@ -15,9 +15,11 @@
 
 #include "iox2/bb/expected.hpp"
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_function.hpp"
 #include "iox2/connection_failure.hpp"
 #include "iox2/iceoryx2.h"
 #include "iox2/internal/iceoryx2.hpp"
+#include "iox2/port_statistics.hpp"
 #include "iox2/sample.hpp"
 #include "iox2/service_type.hpp"
 #include "iox2/subscriber_error.hpp"
@@ -38,29 +40,56 @@ class Subscriber {
     /// Returns the [`UniqueSubscriberId`] of the [`Subscriber`]
     auto id() const -> UniqueSubscriberId;
 
+    /// Returns the [`PortStatistics`] of the [`Subscriber`]. `received` counts the received
+    /// samples and `overflows` the samples that were lost, see [`Subscriber::lost_samples()`].
+    auto statistics() const -> PortStatistics;
+
     /// Returns the internal buffer size of the [`Subscriber`].
     auto buffer_size() const -> uint64_t;
 
+    /// Returns the number of [`Sample`]s that were lost since the [`Subscriber`] was created.
+    /// The loss is detected with the sequence numbers of the received [`Sample`]s.
+    auto lost_samples() const -> uint64_t;
+
     /// Receives a [`Sample`] from [`Publisher`]. If no sample could be
     /// received [`None`] is returned. If a failure occurs [`ReceiveError`] is returned.
     auto receive() const -> bb::Expected<bb::Optional<Sample<S, Payload, UserHeader>>, ReceiveError>;
 
+    /// Receives all [`Sample`]s that are currently available and hands them out in order
+    /// to the provided callback. In contrast to [`Subscriber::receive()`], the [`Sample`]s are
+    /// acquired in batches of `BatchSize` with a single call into the underlying implementation
+    /// per batch. A [`Sample`] that is not moved out of the callback is released after its batch
+    /// was processed.
+    ///
+    /// Returns the number of received [`Sample`]s. If a failure occurs before any [`Sample`] was
+    /// received, [`ReceiveError`] is returned.
+    template <uint64_t BatchSize = DEFAULT_RECEIVE_BATCH_SIZE>
+    auto receive_all(const iox2::bb::StaticFunction<void(Sample<S, Payload, UserHeader>&&)>& callback) const
+        -> bb::Expected<uint64_t, ReceiveError>;
+
     /// Returns true when the [`Subscriber`] has [`Sample`]s that can be
     /// acquired via [`Subscriber::receive()`], otherwise false.
     auto has_samples() const -> bb::Expected<bool, ConnectionFailure>;
 
+    /// The default number of [`Sample`]s that are acquired at once by [`Subscriber::receive_all()`].
+    static constexpr uint64_t DEFAULT_RECEIVE_BATCH_SIZE = 16;
+
   private:
     template <ServiceType, typename, typename>
     friend class PortFactorySubscriber;
+    template <ServiceType, uint64_t>
+    friend class SubscriberSet;
 
-    explicit Subscriber(iox2_subscriber_h handle);
+    explicit Subscriber(iox2_subscriber_h handle, size_t payload_element_size);
     void drop();
 
     iox2_subscriber_h m_handle = nullptr;
+    size_t m_payload_element_size = 0;
 };
 template <ServiceType S, typename Payload, typename UserHeader>
-inline Subscriber<S, Payload, UserHeader>::Subscriber(iox2_subscriber_h handle)
-    : m_handle { handle } {
+inline Subscriber<S, Payload, UserHeader>::Subscriber(iox2_subscriber_h handle, size_t payload_element_size)
+    : m_handle { handle }
+    , m_payload_element_size { payload_element_size } {
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -73,6 +102,7 @@ inline auto Subscriber<S, Payload, UserHeader>::operator=(Subscriber&& rhs) noex
     if (this != &rhs) {
         drop();
         m_handle = rhs.m_handle;
+        m_payload_element_size = rhs.m_payload_element_size;
         rhs.m_handle = nullptr;
     }
 
@@ -106,10 +136,17 @@ inline auto Subscriber<S, Payload, UserHeader>::has_samples() const -> bb::Expec
 
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::id() const -> UniqueSubscriberId {
+    iox2_unique_subscriber_id_t id_storage {};
     iox2_unique_subscriber_id_h id_handle = nullptr;
+    iox2_subscriber_id(&m_handle, &id_storage, &id_handle);
+    return UniqueSubscriberId(id_handle);
+}
 
-    iox2_subscriber_id(&m_handle, nullptr, &id_handle);
-    return UniqueSubscriberId { id_handle };
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::statistics() const -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_subscriber_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
 }
 
 template <ServiceType S, typename Payload, typename UserHeader>
@@ -117,10 +154,16 @@ inline auto Subscriber<S, Payload, UserHeader>::buffer_size() const -> uint64_t
     return iox2_subscriber_buffer_size(&m_handle);
 }
 
+template <ServiceType S, typename Payload, typename UserHeader>
+inline auto Subscriber<S, Payload, UserHeader>::lost_samples() const -> uint64_t {
+    return iox2_subscriber_lost_samples(&m_handle);
+}
+
 template <ServiceType S, typename Payload, typename UserHeader>
 inline auto Subscriber<S, Payload, UserHeader>::receive() const
     -> bb::Expected<bb::Optional<Sample<S, Payload, UserHeader>>, ReceiveError> {
     Sample<S, Payload, UserHeader> sample;
+    sample.m_cache.payload_element_size = m_payload_element_size;
     auto result = iox2_subscriber_receive(&m_handle, &sample.m_sample, &sample.m_handle);
 
     if (result == IOX2_OK) {
@@ -132,6 +175,48 @@ inline auto Subscriber<S, Payload, UserHeader>::receive() const
 
     return bb::err(bb::into<ReceiveError>(result));
 }
+
+template <ServiceType S, typename Payload, typename UserHeader>
+template <uint64_t BatchSize>
+inline auto Subscriber<S, Payload, UserHeader>::receive_all(
+    const iox2::bb::StaticFunction<void(Sample<S, Payload, UserHeader>&&)>& callback) const
+    -> bb::Expected<uint64_t, ReceiveError> {
+    static_assert(BatchSize > 0, "The batch size must be at least 1.");
+
+    uint64_t number_of_samples = 0;
+    while (true) {
+        // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays), the default constructor of Sample is only accessible from the Subscriber
+        Sample<S, Payload, UserHeader> samples[BatchSize];
+        iox2_sample_t* sample_struct_ptrs[BatchSize];
+        iox2_sample_h* sample_handle_ptrs[BatchSize];
+        // NOLINTEND(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+        for (uint64_t idx = 0; idx < BatchSize; ++idx) {
+            sample_struct_ptrs[idx] = &samples[idx].m_sample;
+            sample_handle_ptrs[idx] = &samples[idx].m_handle;
+            samples[idx].m_cache.payload_element_size = m_payload_element_size;
+        }
+
+        size_t number_of_received_samples = 0;
+        auto result = iox2_subscriber_receive_batch(
+            &m_handle, sample_struct_ptrs, sample_handle_ptrs, BatchSize, &number_of_received_samples);
+
+        if (result != IOX2_OK) {
+            if (number_of_samples == 0) {
+                return bb::err(bb::into<ReceiveError>(result));
+            }
+            return number_of_samples;
+        }
+
+        for (size_t idx = 0; idx < number_of_received_samples; ++idx) {
+            callback(std::move(samples[idx]));
+        }
+        number_of_samples += number_of_received_samples;
+
+        if (number_of_received_samples < BatchSize) {
+            return number_of_samples;
+        }
+    }
+}
 } // namespace iox2
 
 #endif
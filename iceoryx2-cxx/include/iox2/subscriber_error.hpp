@@ -37,6 +37,11 @@ enum class SubscriberCreateError : uint8_t {
     HistoryRequestExceedsHistorySizeOfService,
     /// When the [`Subscriber`] requests a larger history than its buffer can hold.
     HistoryRequestExceedsBufferSizeOfSubscriber,
+    /// When the key of the content filter is not located inside the user header of the
+    /// [`Service`].
+    ContentFilterExceedsUserHeader,
+    /// The wake up channel of the [`Subscriber`] could not be created.
+    UnableToCreateWakeUpChannel,
 };
 
 } // namespace iox2
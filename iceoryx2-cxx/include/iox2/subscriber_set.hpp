@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_SUBSCRIBER_SET_HPP
+#define IOX2_SUBSCRIBER_SET_HPP
+
+#include "iox2/bb/expected.hpp"
+#include "iox2/connection_failure.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+#include "iox2/service_type.hpp"
+#include "iox2/subscriber.hpp"
+
+#include <cstdint>
+
+namespace iox2 {
+/// Checks up to `Capacity` [`Subscriber`]s for [`Sample`]s in one call. The handles of all
+/// [`Subscriber`]s are stored contiguously in the set, so that a polling loop does not have to
+/// call [`Subscriber::has_samples()`] on every [`Subscriber`].
+///
+/// The set does not own the [`Subscriber`]s, they must outlive it.
+template <ServiceType S, uint64_t Capacity>
+class SubscriberSet {
+  public:
+    /// Appends the [`Subscriber`] to the set. Returns false when the set is full.
+    template <typename Payload, typename UserHeader>
+    auto add(const Subscriber<S, Payload, UserHeader>& subscriber) -> bool;
+
+    /// Returns the number of [`Subscriber`]s in the set.
+    auto size() const -> uint64_t;
+
+    /// Checks all [`Subscriber`]s for [`Sample`]s and returns the number of [`Subscriber`]s that
+    /// have [`Sample`]s. Which [`Subscriber`]s have [`Sample`]s can be queried with
+    /// [`SubscriberSet::is_ready()`]. If a failure occurs [`ConnectionFailure`] is returned.
+    auto ready() -> bb::Expected<uint64_t, ConnectionFailure>;
+
+    /// Returns true when the [`Subscriber`] at `index`, in the order in which the [`Subscriber`]s
+    /// were added, had [`Sample`]s in the last [`SubscriberSet::ready()`].
+    auto is_ready(uint64_t index) const -> bool;
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD = 64;
+    static constexpr uint64_t NUMBER_OF_WORDS = (Capacity + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    iox2_subscriber_h m_handles[Capacity] {};
+    uint64_t m_ready_subscribers[NUMBER_OF_WORDS] {};
+    uint64_t m_size { 0 };
+};
+
+template <ServiceType S, uint64_t Capacity>
+template <typename Payload, typename UserHeader>
+inline auto SubscriberSet<S, Capacity>::add(const Subscriber<S, Payload, UserHeader>& subscriber) -> bool {
+    if (m_size == Capacity) {
+        return false;
+    }
+
+    m_handles[m_size] = subscriber.m_handle;
+    ++m_size;
+
+    return true;
+}
+
+template <ServiceType S, uint64_t Capacity>
+inline auto SubscriberSet<S, Capacity>::size() const -> uint64_t {
+    return m_size;
+}
+
+template <ServiceType S, uint64_t Capacity>
+inline auto SubscriberSet<S, Capacity>::ready() -> bb::Expected<uint64_t, ConnectionFailure> {
+    size_t number_of_ready_subscribers = 0;
+    auto result = iox2_subscriber_has_samples_batch(&m_handles[0],
+                                                    m_size,
+                                                    &m_ready_subscribers[0],
+                                                    &number_of_ready_subscribers);
+
+    if (result == IOX2_OK) {
+        return number_of_ready_subscribers;
+    }
+
+    return bb::err(bb::into<ConnectionFailure>(result));
+}
+
+template <ServiceType S, uint64_t Capacity>
+inline auto SubscriberSet<S, Capacity>::is_ready(const uint64_t index) const -> bool {
+    if (index >= m_size) {
+        return false;
+    }
+
+    return (m_ready_subscribers[index / BITS_PER_WORD] & (uint64_t { 1 } << (index % BITS_PER_WORD))) != 0;
+}
+} // namespace iox2
+
+#endif
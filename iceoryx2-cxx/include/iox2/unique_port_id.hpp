@@ -17,231 +17,316 @@
 #include "iox2/bb/static_vector.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 
+#include <functional>
+
 namespace iox2 {
 
 constexpr uint64_t UNIQUE_PORT_ID_LENGTH = 16;
 using RawIdType = iox2::bb::StaticVector<uint8_t, UNIQUE_PORT_ID_LENGTH>;
 
-/// The system-wide unique id of a [`Publisher`].
+namespace internal {
+/// The value of a system-wide unique port id. It mirrors the Rust `UniqueSystemId` which
+/// consists of the process id, the creation time and a counter and is ordered in that sequence.
+struct UniquePortIdValue {
+    uint32_t pid { 0 };
+    uint32_t seconds { 0 };
+    uint32_t nanoseconds { 0 };
+    uint32_t counter { 0 };
+};
+
+static_assert(sizeof(UniquePortIdValue) == UNIQUE_PORT_ID_LENGTH, "must match the size of the raw id");
+
+constexpr auto operator==(const UniquePortIdValue& lhs, const UniquePortIdValue& rhs) -> bool {
+    return lhs.pid == rhs.pid && lhs.seconds == rhs.seconds && lhs.nanoseconds == rhs.nanoseconds
+           && lhs.counter == rhs.counter;
+}
+
+constexpr auto operator<(const UniquePortIdValue& lhs, const UniquePortIdValue& rhs) -> bool {
+    if (lhs.pid != rhs.pid) {
+        return lhs.pid < rhs.pid;
+    }
+    if (lhs.seconds != rhs.seconds) {
+        return lhs.seconds < rhs.seconds;
+    }
+    if (lhs.nanoseconds != rhs.nanoseconds) {
+        return lhs.nanoseconds < rhs.nanoseconds;
+    }
+    return lhs.counter < rhs.counter;
+}
+
+constexpr auto unique_port_id_hash_combine(uint64_t hash, uint32_t word) -> uint64_t {
+    constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+    return (hash ^ word) * FNV_PRIME;
+}
+
+/// Hashes a unique port id by combining its four 32-bit words with the FNV-1a scheme.
+template <typename T>
+struct UniquePortIdHash {
+    constexpr auto operator()(const T& id) const noexcept -> size_t {
+        constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+        uint64_t hash = unique_port_id_hash_combine(FNV_OFFSET_BASIS, id.m_value.pid);
+        hash = unique_port_id_hash_combine(hash, id.m_value.seconds);
+        hash = unique_port_id_hash_combine(hash, id.m_value.nanoseconds);
+        hash = unique_port_id_hash_combine(hash, id.m_value.counter);
+        return static_cast<size_t>(hash);
+    }
+};
+} // namespace internal
+
+/// The system-wide unique id of a [`Publisher`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniquePublisherId {
   public:
-    UniquePublisherId(const UniquePublisherId&) = delete;
-    UniquePublisherId(UniquePublisherId&& rhs) noexcept;
-    auto operator=(const UniquePublisherId& rhs) -> UniquePublisherId& = delete;
-    auto operator=(UniquePublisherId&& rhs) noexcept -> UniquePublisherId&;
-    ~UniquePublisherId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename, typename>
     friend class Publisher;
     friend class HeaderPublishSubscribe;
     friend class PublisherDetailsView;
-    friend auto operator==(const UniquePublisherId&, const UniquePublisherId&) -> bool;
-    friend auto operator<(const UniquePublisherId&, const UniquePublisherId&) -> bool;
+    friend constexpr auto operator==(const UniquePublisherId&, const UniquePublisherId&) -> bool;
+    friend constexpr auto operator<(const UniquePublisherId&, const UniquePublisherId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniquePublisherId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniquePublisherId(iox2_unique_publisher_id_h handle);
-    void drop();
 
-    iox2_unique_publisher_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Subscriber`].
+/// The system-wide unique id of a [`Subscriber`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueSubscriberId {
   public:
-    UniqueSubscriberId(const UniqueSubscriberId&) = delete;
-    UniqueSubscriberId(UniqueSubscriberId&& rhs) noexcept;
-    auto operator=(const UniqueSubscriberId& rhs) -> UniqueSubscriberId& = delete;
-    auto operator=(UniqueSubscriberId&& rhs) noexcept -> UniqueSubscriberId&;
-    ~UniqueSubscriberId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename, typename>
     friend class Subscriber;
-    friend auto operator==(const UniqueSubscriberId&, const UniqueSubscriberId&) -> bool;
-    friend auto operator<(const UniqueSubscriberId&, const UniqueSubscriberId&) -> bool;
     friend class SubscriberDetailsView;
+    friend constexpr auto operator==(const UniqueSubscriberId&, const UniqueSubscriberId&) -> bool;
+    friend constexpr auto operator<(const UniqueSubscriberId&, const UniqueSubscriberId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueSubscriberId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueSubscriberId(iox2_unique_subscriber_id_h handle);
-    void drop();
 
-    iox2_unique_subscriber_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Notifier`].
+/// The system-wide unique id of a [`Notifier`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueNotifierId {
   public:
-    UniqueNotifierId(const UniqueNotifierId&) = delete;
-    UniqueNotifierId(UniqueNotifierId&& rhs) noexcept;
-    auto operator=(const UniqueNotifierId& rhs) -> UniqueNotifierId& = delete;
-    auto operator=(UniqueNotifierId&& rhs) noexcept -> UniqueNotifierId&;
-    ~UniqueNotifierId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType>
     friend class Notifier;
-    friend auto operator==(const UniqueNotifierId&, const UniqueNotifierId&) -> bool;
-    friend auto operator<(const UniqueNotifierId&, const UniqueNotifierId&) -> bool;
     friend class NotifierDetailsView;
+    friend constexpr auto operator==(const UniqueNotifierId&, const UniqueNotifierId&) -> bool;
+    friend constexpr auto operator<(const UniqueNotifierId&, const UniqueNotifierId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueNotifierId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueNotifierId(iox2_unique_notifier_id_h handle);
-    void drop();
 
-    iox2_unique_notifier_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Listener`].
+/// The system-wide unique id of a [`Listener`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueListenerId {
   public:
-    UniqueListenerId(const UniqueListenerId&) = delete;
-    UniqueListenerId(UniqueListenerId&& rhs) noexcept;
-    auto operator=(const UniqueListenerId& rhs) -> UniqueListenerId& = delete;
-    auto operator=(UniqueListenerId&& rhs) noexcept -> UniqueListenerId&;
-    ~UniqueListenerId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType>
     friend class Listener;
-    friend auto operator==(const UniqueListenerId&, const UniqueListenerId&) -> bool;
-    friend auto operator<(const UniqueListenerId&, const UniqueListenerId&) -> bool;
     friend class ListenerDetailsView;
+    friend constexpr auto operator==(const UniqueListenerId&, const UniqueListenerId&) -> bool;
+    friend constexpr auto operator<(const UniqueListenerId&, const UniqueListenerId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueListenerId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueListenerId(iox2_unique_listener_id_h handle);
-    void drop();
 
-    iox2_unique_listener_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Client`].
+/// The system-wide unique id of a [`Client`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueClientId {
   public:
-    UniqueClientId(const UniqueClientId&) = delete;
-    UniqueClientId(UniqueClientId&& rhs) noexcept;
-    auto operator=(const UniqueClientId& rhs) -> UniqueClientId& = delete;
-    auto operator=(UniqueClientId&& rhs) noexcept -> UniqueClientId&;
-    ~UniqueClientId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename, typename, typename, typename>
     friend class Client;
     friend class RequestHeader;
-    friend auto operator==(const UniqueClientId&, const UniqueClientId&) -> bool;
-    friend auto operator<(const UniqueClientId&, const UniqueClientId&) -> bool;
     friend class ClientDetailsView;
+    friend constexpr auto operator==(const UniqueClientId&, const UniqueClientId&) -> bool;
+    friend constexpr auto operator<(const UniqueClientId&, const UniqueClientId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueClientId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueClientId(iox2_unique_client_id_h handle);
-    void drop();
 
-    iox2_unique_client_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Server`].
+/// The system-wide unique id of a [`Server`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueServerId {
   public:
-    UniqueServerId(const UniqueServerId&) = delete;
-    UniqueServerId(UniqueServerId&& rhs) noexcept;
-    auto operator=(const UniqueServerId& rhs) -> UniqueServerId& = delete;
-    auto operator=(UniqueServerId&& rhs) noexcept -> UniqueServerId&;
-    ~UniqueServerId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename, typename, typename, typename>
     friend class Server;
     friend class ResponseHeader;
-    friend auto operator==(const UniqueServerId&, const UniqueServerId&) -> bool;
-    friend auto operator<(const UniqueServerId&, const UniqueServerId&) -> bool;
     friend class ServerDetailsView;
+    friend constexpr auto operator==(const UniqueServerId&, const UniqueServerId&) -> bool;
+    friend constexpr auto operator<(const UniqueServerId&, const UniqueServerId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueServerId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueServerId(iox2_unique_server_id_h handle);
-    void drop();
 
-    iox2_unique_server_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Reader`].
+/// The system-wide unique id of a [`Reader`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueReaderId {
   public:
-    UniqueReaderId(const UniqueReaderId&) = delete;
-    UniqueReaderId(UniqueReaderId&& rhs) noexcept;
-    auto operator=(const UniqueReaderId& rhs) -> UniqueReaderId& = delete;
-    auto operator=(UniqueReaderId&& rhs) noexcept -> UniqueReaderId&;
-    ~UniqueReaderId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename>
     friend class Reader;
-    friend auto operator==(const UniqueReaderId&, const UniqueReaderId&) -> bool;
-    friend auto operator<(const UniqueReaderId&, const UniqueReaderId&) -> bool;
     friend class ReaderDetailsView;
+    friend constexpr auto operator==(const UniqueReaderId&, const UniqueReaderId&) -> bool;
+    friend constexpr auto operator<(const UniqueReaderId&, const UniqueReaderId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueReaderId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueReaderId(iox2_unique_reader_id_h handle);
-    void drop();
 
-    iox2_unique_reader_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-/// The system-wide unique id of a [`Writer`].
+/// The system-wide unique id of a [`Writer`]. It is a trivially copyable value that
+/// is compared and hashed without a call into the iceoryx2 library.
 class UniqueWriterId {
   public:
-    UniqueWriterId(const UniqueWriterId&) = delete;
-    UniqueWriterId(UniqueWriterId&& rhs) noexcept;
-    auto operator=(const UniqueWriterId& rhs) -> UniqueWriterId& = delete;
-    auto operator=(UniqueWriterId&& rhs) noexcept -> UniqueWriterId&;
-    ~UniqueWriterId();
-
-    auto bytes() const -> const bb::Optional<RawIdType>&;
+    auto bytes() const -> bb::Optional<RawIdType>;
 
   private:
     template <ServiceType, typename>
     friend class Writer;
-    friend auto operator==(const UniqueWriterId&, const UniqueWriterId&) -> bool;
-    friend auto operator<(const UniqueWriterId&, const UniqueWriterId&) -> bool;
     friend class WriterDetailsView;
+    friend constexpr auto operator==(const UniqueWriterId&, const UniqueWriterId&) -> bool;
+    friend constexpr auto operator<(const UniqueWriterId&, const UniqueWriterId&) -> bool;
+    friend struct internal::UniquePortIdHash<UniqueWriterId>;
 
+    // Takes the value of the handle and drops it afterwards
     explicit UniqueWriterId(iox2_unique_writer_id_h handle);
-    void drop();
 
-    iox2_unique_writer_id_h m_handle = nullptr;
-    mutable bb::Optional<RawIdType> m_raw_id;
+    internal::UniquePortIdValue m_value;
 };
 
-auto operator==(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool;
-auto operator<(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool;
-auto operator==(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool;
-auto operator<(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool;
-auto operator==(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool;
-auto operator<(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool;
-auto operator==(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool;
-auto operator<(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool;
-auto operator==(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool;
-auto operator<(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool;
-auto operator==(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool;
-auto operator<(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool;
-auto operator==(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool;
-auto operator<(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool;
-auto operator==(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool;
-auto operator<(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool;
+constexpr auto operator==(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
+
+constexpr auto operator==(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool {
+    return lhs.m_value == rhs.m_value;
+}
+
+constexpr auto operator<(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool {
+    return lhs.m_value < rhs.m_value;
+}
 
 } // namespace iox2
 
+namespace std {
+template <>
+struct hash<iox2::UniquePublisherId> : iox2::internal::UniquePortIdHash<iox2::UniquePublisherId> { };
+
+template <>
+struct hash<iox2::UniqueSubscriberId> : iox2::internal::UniquePortIdHash<iox2::UniqueSubscriberId> { };
+
+template <>
+struct hash<iox2::UniqueNotifierId> : iox2::internal::UniquePortIdHash<iox2::UniqueNotifierId> { };
+
+template <>
+struct hash<iox2::UniqueListenerId> : iox2::internal::UniquePortIdHash<iox2::UniqueListenerId> { };
+
+template <>
+struct hash<iox2::UniqueClientId> : iox2::internal::UniquePortIdHash<iox2::UniqueClientId> { };
+
+template <>
+struct hash<iox2::UniqueServerId> : iox2::internal::UniquePortIdHash<iox2::UniqueServerId> { };
+
+template <>
+struct hash<iox2::UniqueReaderId> : iox2::internal::UniquePortIdHash<iox2::UniqueReaderId> { };
+
+template <>
+struct hash<iox2::UniqueWriterId> : iox2::internal::UniquePortIdHash<iox2::UniqueWriterId> { };
+} // namespace std
+
 #endif
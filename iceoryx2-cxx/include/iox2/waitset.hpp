@@ -16,6 +16,7 @@
 #include "iox2/bb/detail/builder.hpp"
 #include "iox2/bb/duration.hpp"
 #include "iox2/bb/expected.hpp"
+#include "iox2/bb/function_ref.hpp"
 #include "iox2/callback_progression.hpp"
 #include "iox2/file_descriptor.hpp"
 #include "iox2/internal/iceoryx2.hpp"
@@ -46,6 +47,8 @@ class WaitSetGuard {
 
     template <ServiceType>
     friend class WaitSetAttachmentId;
+    template <ServiceType>
+    friend class WaitSetAttachmentIdBatch;
     explicit WaitSetGuard(iox2_waitset_guard_h handle);
     void drop();
 
@@ -103,6 +106,48 @@ auto operator<(const WaitSetAttachmentId<S>& lhs, const WaitSetAttachmentId<S>&
 template <ServiceType S>
 auto operator<<(std::ostream& stream, const WaitSetAttachmentId<S>& self) -> std::ostream&;
 
+/// A non-owning view of all [`WaitSetAttachmentId`]s that were collected in one wake up of the
+/// [`WaitSet`]. It is provided by [`WaitSet::wait_and_process_batch()`] and is only valid inside
+/// the callback.
+template <ServiceType S>
+class WaitSetAttachmentIdBatch {
+  public:
+    WaitSetAttachmentIdBatch(const WaitSetAttachmentIdBatch&) = delete;
+    WaitSetAttachmentIdBatch(WaitSetAttachmentIdBatch&&) = delete;
+    auto operator=(const WaitSetAttachmentIdBatch&) -> WaitSetAttachmentIdBatch& = delete;
+    auto operator=(WaitSetAttachmentIdBatch&&) -> WaitSetAttachmentIdBatch& = delete;
+    ~WaitSetAttachmentIdBatch() = default;
+
+    /// Returns the number of [`WaitSetAttachmentId`]s in the batch.
+    auto size() const -> uint64_t;
+
+    /// Returns true if the batch contains no [`WaitSetAttachmentId`].
+    auto empty() const -> bool;
+
+    /// Returns true if the [`WaitSetAttachmentId`] at position `index` has an event that was
+    /// emitted from the attachment corresponding to [`WaitSetGuard`].
+    auto has_event_from(uint64_t index, const WaitSetGuard<S>& guard) const -> bool;
+
+    /// Returns true if the [`WaitSetAttachmentId`] at position `index` reports a missed deadline
+    /// of the attachment corresponding to [`WaitSetGuard`].
+    auto has_missed_deadline(uint64_t index, const WaitSetGuard<S>& guard) const -> bool;
+
+    /// Returns true if any [`WaitSetAttachmentId`] of the batch has an event that was emitted
+    /// from the attachment corresponding to [`WaitSetGuard`].
+    auto contains_event_from(const WaitSetGuard<S>& guard) const -> bool;
+
+    /// Returns true if any [`WaitSetAttachmentId`] of the batch reports a missed deadline of the
+    /// attachment corresponding to [`WaitSetGuard`].
+    auto contains_missed_deadline(const WaitSetGuard<S>& guard) const -> bool;
+
+  private:
+    explicit WaitSetAttachmentIdBatch(iox2_waitset_attachment_id_batch_ptr handle);
+    template <ServiceType>
+    friend auto run_batch_callback(iox2_waitset_attachment_id_batch_ptr, void*) -> iox2_callback_progression_e;
+
+    iox2_waitset_attachment_id_batch_ptr m_handle = nullptr;
+};
+
 /// The [`WaitSet`] implements a reactor pattern and allows to wait on multiple events in one
 /// single call [`WaitSet::try_wait_and_process()`] until it wakes up or to run repeatedly with
 /// [`WaitSet::wait_and_process()`] until the a interrupt or termination signal was received or the user
@@ -135,7 +180,7 @@ class WaitSet {
     /// If an interrupt- (`SIGINT`) or a termination-signal (`SIGTERM`) was received, it will exit
     /// the loop and inform the user with [`WaitSetRunResult::Interrupt`] or
     /// [`WaitSetRunResult::TerminationRequest`].
-    auto wait_and_process(const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+    auto wait_and_process(iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call)
         -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
 
     /// Waits until an event arrives on the [`WaitSet`], then
@@ -154,7 +199,7 @@ class WaitSet {
     ///
     /// When no signal was received and all events were handled, it will return
     /// [`WaitSetRunResult::AllEventsHandled`].
-    auto wait_and_process_once(const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+    auto wait_and_process_once(iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call)
         -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
 
     /// Waits until an event arrives on the [`WaitSet`] or the provided timeout has passed, then
@@ -174,7 +219,27 @@ class WaitSet {
     /// When no signal was received and all events were handled, it will return
     /// [`WaitSetRunResult::AllEventsHandled`].
     auto wait_and_process_once_with_timeout(
-        const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call,
+        iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call,
+        iox2::bb::Duration timeout) -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Behaves like [`WaitSet::wait_and_process()`] but provides all [`WaitSetAttachmentId`]s of
+    /// one wake up together in one [`WaitSetAttachmentIdBatch`] to the provided `fn_call` callback.
+    /// Returning [`CallbackProgression::Stop`] exits the loop with [`WaitSetRunResult::StopRequest`].
+    auto wait_and_process_batch(iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call)
+        -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Behaves like [`WaitSet::wait_and_process_once()`] but provides all [`WaitSetAttachmentId`]s
+    /// together in one [`WaitSetAttachmentIdBatch`] to the provided `fn_call` callback. The callback
+    /// is not called when the [`WaitSet`] woke up without any event.
+    auto wait_and_process_batch_once(
+        iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call)
+        -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
+
+    /// Behaves like [`WaitSet::wait_and_process_once_with_timeout()`] but provides all
+    /// [`WaitSetAttachmentId`]s together in one [`WaitSetAttachmentIdBatch`] to the provided
+    /// `fn_call` callback. The callback is not called when the timeout has passed without any event.
+    auto wait_and_process_batch_once_with_timeout(
+        iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call,
         iox2::bb::Duration timeout) -> bb::Expected<WaitSetRunResult, WaitSetRunError>;
 
     /// Returns the capacity of the [`WaitSet`]
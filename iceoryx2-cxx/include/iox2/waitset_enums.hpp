@@ -47,6 +47,8 @@ enum class WaitSetAttachmentError : uint8_t {
     InternalError,
     /// Insufficient resources to add another attachment to the [`WaitSet`].
     InsufficientResources,
+    /// The port was created without a wake up channel and cannot be attached.
+    NoWakeUpChannel,
 };
 
 /// Defines the failures that can occur when calling [`WaitSet::run()`].
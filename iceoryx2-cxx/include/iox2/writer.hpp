@@ -86,10 +86,10 @@ inline Writer<S, KeyType>::~Writer() {
 
 template <ServiceType S, typename KeyType>
 inline auto Writer<S, KeyType>::id() const -> UniqueWriterId {
+    iox2_unique_writer_id_t id_storage {};
     iox2_unique_writer_id_h id_handle = nullptr;
-
-    iox2_writer_id(&m_handle, nullptr, &id_handle);
-    return UniqueWriterId { id_handle };
+    iox2_writer_id(&m_handle, &id_storage, &id_handle);
+    return UniqueWriterId(id_handle);
 }
 
 template <ServiceType S, typename KeyType>
@@ -97,7 +97,7 @@ template <typename ValueType>
 inline auto Writer<S, KeyType>::entry(const KeyType& key)
     -> bb::Expected<EntryHandleMut<S, KeyType, ValueType>, EntryHandleMutError> {
     iox2_entry_handle_mut_h entry_handle {};
-    const auto type_name = internal::get_type_name<ValueType>();
+    const auto& type_name = internal::get_type_name<ValueType>();
 
     auto result = iox2_writer_entry(&m_handle,
                                     nullptr,
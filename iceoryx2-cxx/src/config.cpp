@@ -13,7 +13,60 @@
 #include "iox2/config.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 
+#include <array>
+#include <mutex>
+
 namespace iox2 {
+namespace {
+auto to_file_name_string(const char* value) -> ConfigSnapshot::FileNameString {
+    return ConfigSnapshot::FileNameString::from_utf8_null_terminated_unchecked_truncated(
+        value, ConfigSnapshot::FileNameString::capacity());
+}
+
+auto to_path_string(const char* value) -> ConfigSnapshot::PathString {
+    return ConfigSnapshot::PathString::from_utf8_null_terminated_unchecked_truncated(
+        value, ConfigSnapshot::PathString::capacity());
+}
+
+/// Caches the configs that were loaded with `Config::from_file_cached()`. When the cache is
+/// full, the oldest entry is replaced.
+class ConfigFileCache {
+  public:
+    static auto instance() -> ConfigFileCache& {
+        static ConfigFileCache cache;
+        return cache;
+    }
+
+    auto get(const bb::FilePath& file) -> bb::Optional<Config> {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_entries) {
+            if (entry.has_value() && entry->file == file) {
+                return entry->config;
+            }
+        }
+        return bb::NULLOPT;
+    }
+
+    void insert(const bb::FilePath& file, const Config& config) {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[m_next_entry].emplace(Entry { file, config });
+        m_next_entry = (m_next_entry + 1) % CAPACITY;
+    }
+
+  private:
+    static constexpr uint64_t CAPACITY = 8;
+
+    struct Entry {
+        bb::FilePath file;
+        Config config;
+    };
+
+    std::mutex m_mutex;
+    std::array<bb::Optional<Entry>, CAPACITY> m_entries;
+    uint64_t m_next_entry { 0 };
+};
+} // namespace
+
 /////////////////////////
 // BEGIN: ConfigView
 /////////////////////////
@@ -28,6 +81,10 @@ auto ConfigView::to_owned() const -> Config {
     return Config(handle);
 }
 
+auto ConfigView::snapshot() const -> ConfigSnapshot {
+    return to_owned().snapshot();
+}
+
 /////////////////////////
 // END: ConfigView
 /////////////////////////
@@ -92,6 +149,21 @@ auto Config::from_file(const iox2::bb::FilePath& file) -> iox2::bb::Expected<Con
     return iox2::bb::err(iox2::bb::into<ConfigCreationError>(result));
 }
 
+auto Config::from_file_cached(const iox2::bb::FilePath& file) -> iox2::bb::Expected<Config, ConfigCreationError> {
+    auto& cache = ConfigFileCache::instance();
+    auto cached_config = cache.get(file);
+    if (cached_config.has_value()) {
+        return std::move(cached_config.value());
+    }
+
+    auto config = from_file(file);
+    if (config.has_value()) {
+        cache.insert(file, config.value());
+    }
+
+    return config;
+}
+
 auto Config::setup_global_config_from_file(const iox2::bb::FilePath& file)
     -> iox2::bb::Expected<ConfigView, ConfigCreationError> {
     iox2_config_ptr handle = nullptr;
@@ -115,9 +187,98 @@ auto Config::global_config() -> ConfigView {
     return ConfigView { iox2_config_global_config() };
 }
 
+auto Config::global_config_snapshot() -> const ConfigSnapshot& {
+    // the global config cannot be changed after it was initialized, therefore it is
+    // sufficient to acquire the snapshot once
+    static const ConfigSnapshot SNAPSHOT = global_config().snapshot();
+    return SNAPSHOT;
+}
+
 auto Config::view() -> ConfigView {
     return ConfigView { iox2_cast_config_ptr(m_handle) };
 }
+
+auto Config::snapshot() -> ConfigSnapshot {
+    ConfigSnapshot snapshot;
+    auto& global_settings = snapshot.global;
+    auto& node = snapshot.global.node;
+    auto& service = snapshot.global.service;
+    auto& publish_subscribe = snapshot.defaults.publish_subscribe;
+    auto& event = snapshot.defaults.event;
+    auto& request_response = snapshot.defaults.request_response;
+    auto& blackboard = snapshot.defaults.blackboard;
+
+    global_settings.prefix = to_file_name_string(global().prefix());
+    global_settings.root_path = to_path_string(global().root_path());
+    global_settings.creation_timeout = global().creation_timeout();
+    global_settings.shared_memory_quota = global().shared_memory_quota();
+
+    node.directory = to_path_string(global().node().directory());
+    node.monitor_suffix = to_file_name_string(global().node().monitor_suffix());
+    node.global_mgmt_suffix = to_file_name_string(global().node().global_mgmt_suffix());
+    node.static_config_suffix = to_file_name_string(global().node().static_config_suffix());
+    node.port_tag_suffix = to_file_name_string(global().node().port_tag_suffix());
+    node.service_tag_suffix = to_file_name_string(global().node().service_tag_suffix());
+    node.cleanup_dead_nodes_on_creation = global().node().cleanup_dead_nodes_on_creation();
+    node.cleanup_dead_nodes_on_destruction = global().node().cleanup_dead_nodes_on_destruction();
+
+    service.directory = to_path_string(global().service().directory());
+    service.data_segment_suffix = to_file_name_string(global().service().data_segment_suffix());
+    service.static_config_storage_suffix = to_file_name_string(global().service().static_config_storage_suffix());
+    service.dynamic_config_storage_suffix = to_file_name_string(global().service().dynamic_config_storage_suffix());
+    service.connection_suffix = to_file_name_string(global().service().connection_suffix());
+    service.event_connection_suffix = to_file_name_string(global().service().event_connection_suffix());
+    service.cleanup_dead_nodes_on_open = global().service().cleanup_dead_nodes_on_open();
+
+    publish_subscribe.max_subscribers = defaults().publish_subscribe().max_subscribers();
+    publish_subscribe.max_publishers = defaults().publish_subscribe().max_publishers();
+    publish_subscribe.max_nodes = defaults().publish_subscribe().max_nodes();
+    publish_subscribe.subscriber_max_buffer_size = defaults().publish_subscribe().subscriber_max_buffer_size();
+    publish_subscribe.subscriber_max_borrowed_samples =
+        defaults().publish_subscribe().subscriber_max_borrowed_samples();
+    publish_subscribe.publisher_max_loaned_samples = defaults().publish_subscribe().publisher_max_loaned_samples();
+    publish_subscribe.publisher_history_size = defaults().publish_subscribe().publisher_history_size();
+    publish_subscribe.enable_safe_overflow = defaults().publish_subscribe().enable_safe_overflow();
+    publish_subscribe.backpressure_strategy = defaults().publish_subscribe().backpressure_strategy();
+    publish_subscribe.subscriber_expired_connection_buffer =
+        defaults().publish_subscribe().subscriber_expired_connection_buffer();
+
+    event.max_listeners = defaults().event().max_listeners();
+    event.max_notifiers = defaults().event().max_notifiers();
+    event.max_nodes = defaults().event().max_nodes();
+    event.event_id_max_value = defaults().event().event_id_max_value();
+    event.notifier_created_event = defaults().event().notifier_created_event();
+    event.notifier_dropped_event = defaults().event().notifier_dropped_event();
+    event.notifier_dead_event = defaults().event().notifier_dead_event();
+    event.deadline = defaults().event().deadline();
+
+    request_response.enable_safe_overflow_for_requests =
+        defaults().request_response().enable_safe_overflow_for_requests();
+    request_response.enable_safe_overflow_for_responses =
+        defaults().request_response().enable_safe_overflow_for_responses();
+    request_response.max_active_requests_per_client = defaults().request_response().max_active_requests_per_client();
+    request_response.max_response_buffer_size = defaults().request_response().max_response_buffer_size();
+    request_response.max_servers = defaults().request_response().max_servers();
+    request_response.max_clients = defaults().request_response().max_clients();
+    request_response.max_nodes = defaults().request_response().max_nodes();
+    request_response.max_borrowed_responses_per_pending_response =
+        defaults().request_response().max_borrowed_responses_per_pending_response();
+    request_response.max_loaned_requests = defaults().request_response().max_loaned_requests();
+    request_response.server_max_loaned_responses_per_request =
+        defaults().request_response().server_max_loaned_responses_per_request();
+    request_response.client_backpressure_strategy = defaults().request_response().client_backpressure_strategy();
+    request_response.server_backpressure_strategy = defaults().request_response().server_backpressure_strategy();
+    request_response.client_expired_connection_buffer =
+        defaults().request_response().client_expired_connection_buffer();
+    request_response.server_expired_connection_buffer =
+        defaults().request_response().server_expired_connection_buffer();
+    request_response.enable_fire_and_forget_requests = defaults().request_response().enable_fire_and_forget_requests();
+
+    blackboard.max_readers = defaults().blackboard().max_readers();
+    blackboard.max_nodes = defaults().blackboard().max_nodes();
+
+    return snapshot;
+}
 /////////////////////////
 // END: Config
 /////////////////////////
@@ -158,6 +319,23 @@ void Global::set_creation_timeout(const iox2::bb::Duration& value) && {
     iox2_config_global_set_creation_timeout(m_config, value.as_secs(), value.subsec_nanos());
 }
 
+auto Global::shared_memory_quota() && -> bb::Optional<size_t> {
+    size_t value = 0;
+    if (iox2_config_global_shared_memory_quota(m_config, &value)) {
+        return { value };
+    }
+
+    return bb::NULLOPT;
+}
+
+void Global::set_shared_memory_quota(bb::Optional<size_t> value) && {
+    if (value.has_value()) {
+        iox2_config_global_set_shared_memory_quota(m_config, &*value);
+    } else {
+        iox2_config_global_set_shared_memory_quota(m_config, nullptr);
+    }
+}
+
 auto Global::service() -> Service {
     return Service(m_config);
 }
@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/cycle_clock.hpp"
+#include "iox2/internal/iceoryx2.hpp"
+
+namespace iox2 {
+auto CycleClock::is_hardware_accelerated() -> bool {
+    return iox2_cycle_clock_is_hardware_accelerated();
+}
+
+auto CycleClock::now() -> bb::Duration {
+    uint64_t seconds = 0;
+    uint32_t nanoseconds = 0;
+    iox2_cycle_clock_now(&seconds, &nanoseconds);
+
+    return bb::Duration::from_secs(seconds) + bb::Duration::from_nanos(nanoseconds);
+}
+
+auto CycleClock::elapsed_since(const bb::Duration& timestamp) -> bb::Duration {
+    const auto now = CycleClock::now();
+    if (now <= timestamp) {
+        return bb::Duration::zero();
+    }
+
+    return now - timestamp;
+}
+} // namespace iox2
@@ -22,6 +22,18 @@ auto DynamicConfigPublishSubscribe::number_of_subscribers() const -> uint64_t {
     return iox2_port_factory_pub_sub_dynamic_config_number_of_subscribers(&m_handle);
 }
 
+auto DynamicConfigPublishSubscribe::publisher_statistics() const -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_port_factory_pub_sub_dynamic_config_publisher_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
+}
+
+auto DynamicConfigPublishSubscribe::subscriber_statistics() const -> PortStatistics {
+    iox2_port_statistics_t statistics {};
+    iox2_port_factory_pub_sub_dynamic_config_subscriber_statistics(&m_handle, &statistics);
+    return internal::into_port_statistics(statistics);
+}
+
 DynamicConfigPublishSubscribe::DynamicConfigPublishSubscribe(iox2_port_factory_pub_sub_h handle)
     : m_handle { handle } {
 }
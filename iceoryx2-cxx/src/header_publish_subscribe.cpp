@@ -13,9 +13,13 @@
 #include "iox2/header_publish_subscribe.hpp"
 
 namespace iox2 {
-HeaderPublishSubscribe::HeaderPublishSubscribe(iox2_publish_subscribe_header_h handle)
-    : m_handle { handle } {
+namespace internal {
+extern "C" {
+void iox2_publish_subscribe_header_move(iox2_publish_subscribe_header_t*,
+                                        iox2_publish_subscribe_header_t*,
+                                        iox2_publish_subscribe_header_h*);
 }
+} // namespace internal
 
 void HeaderPublishSubscribe::drop() {
     if (m_handle != nullptr) {
@@ -32,8 +36,10 @@ auto HeaderPublishSubscribe::operator=(HeaderPublishSubscribe&& rhs) noexcept ->
     if (this != &rhs) {
         drop();
 
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
+        if (rhs.m_handle != nullptr) {
+            internal::iox2_publish_subscribe_header_move(&rhs.m_value, &m_value, &m_handle);
+            rhs.m_handle = nullptr;
+        }
     }
 
     return *this;
@@ -44,13 +50,54 @@ HeaderPublishSubscribe::~HeaderPublishSubscribe() {
 }
 
 auto HeaderPublishSubscribe::publisher_id() const -> UniquePublisherId {
+    iox2_unique_publisher_id_t id_storage {};
     iox2_unique_publisher_id_h id_handle = nullptr;
-
-    iox2_publish_subscribe_header_publisher_id(&m_handle, nullptr, &id_handle);
-    return UniquePublisherId { id_handle };
+    iox2_publish_subscribe_header_publisher_id(&m_handle, &id_storage, &id_handle);
+    return UniquePublisherId(id_handle);
 }
 
 auto HeaderPublishSubscribe::number_of_elements() const -> uint64_t {
     return iox2_publish_subscribe_header_number_of_elements(&m_handle);
 }
+
+auto HeaderPublishSubscribe::sequence_number() const -> uint64_t {
+    return iox2_publish_subscribe_header_sequence_number(&m_handle);
+}
+
+auto HeaderPublishSubscribe::send_timestamp() const -> bb::Optional<bb::Duration> {
+    const auto timestamp = iox2_publish_subscribe_header_send_timestamp(&m_handle);
+    if (timestamp == 0) {
+        return bb::NULLOPT;
+    }
+
+    return bb::Duration::from_nanos(timestamp);
+}
+
+auto HeaderPublishSubscribe::priority() const -> uint8_t {
+    return iox2_publish_subscribe_header_priority(&m_handle);
+}
+
+HeaderPublishSubscribeView::HeaderPublishSubscribeView(RawIdType publisher_id,
+                                                       uint64_t number_of_elements,
+                                                       uint64_t send_timestamp)
+    : m_publisher_id { std::move(publisher_id) }
+    , m_number_of_elements { number_of_elements }
+    , m_send_timestamp { send_timestamp } {
+}
+
+auto HeaderPublishSubscribeView::publisher_id() const -> const RawIdType& {
+    return m_publisher_id;
+}
+
+auto HeaderPublishSubscribeView::number_of_elements() const -> uint64_t {
+    return m_number_of_elements;
+}
+
+auto HeaderPublishSubscribeView::send_timestamp() const -> bb::Optional<bb::Duration> {
+    if (m_send_timestamp == 0) {
+        return bb::NULLOPT;
+    }
+
+    return bb::Duration::from_nanos(m_send_timestamp);
+}
 } // namespace iox2
@@ -13,6 +13,13 @@
 #include "iox2/header_request_response.hpp"
 
 namespace iox2 {
+namespace internal {
+extern "C" {
+void iox2_request_header_move(iox2_request_header_t*, iox2_request_header_t*, iox2_request_header_h*);
+void iox2_response_header_move(iox2_response_header_t*, iox2_response_header_t*, iox2_response_header_h*);
+}
+} // namespace internal
+
 RequestHeader::RequestHeader(RequestHeader&& rhs) noexcept {
     *this = std::move(rhs);
 }
@@ -21,8 +28,10 @@ auto RequestHeader::operator=(RequestHeader&& rhs) noexcept -> RequestHeader& {
     if (this != &rhs) {
         drop();
 
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
+        if (rhs.m_handle != nullptr) {
+            internal::iox2_request_header_move(&rhs.m_value, &m_value, &m_handle);
+            rhs.m_handle = nullptr;
+        }
     }
 
     return *this;
@@ -33,13 +42,10 @@ RequestHeader::~RequestHeader() {
 }
 
 auto RequestHeader::client_port_id() -> UniqueClientId {
+    iox2_unique_client_id_t id_storage {};
     iox2_unique_client_id_h id_handle = nullptr;
-    iox2_request_header_client_id(&m_handle, nullptr, &id_handle);
-    return UniqueClientId { id_handle };
-}
-
-RequestHeader::RequestHeader(iox2_request_header_h handle)
-    : m_handle(handle) {
+    iox2_request_header_client_id(&m_handle, &id_storage, &id_handle);
+    return UniqueClientId(id_handle);
 }
 
 void RequestHeader::drop() {
@@ -57,8 +63,10 @@ auto ResponseHeader::operator=(ResponseHeader&& rhs) noexcept -> ResponseHeader&
     if (this != &rhs) {
         drop();
 
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
+        if (rhs.m_handle != nullptr) {
+            internal::iox2_response_header_move(&rhs.m_value, &m_value, &m_handle);
+            rhs.m_handle = nullptr;
+        }
     }
 
     return *this;
@@ -69,13 +77,10 @@ ResponseHeader::~ResponseHeader() {
 }
 
 auto ResponseHeader::server_port_id() -> UniqueServerId {
+    iox2_unique_server_id_t id_storage {};
     iox2_unique_server_id_h id_handle = nullptr;
-    iox2_response_header_server_id(&m_handle, nullptr, &id_handle);
-    return UniqueServerId { id_handle };
-}
-
-ResponseHeader::ResponseHeader(iox2_response_header_h handle)
-    : m_handle(handle) {
+    iox2_response_header_server_id(&m_handle, &id_storage, &id_handle);
+    return UniqueServerId(id_handle);
 }
 
 void ResponseHeader::drop() {
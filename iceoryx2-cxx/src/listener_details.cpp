@@ -32,9 +32,10 @@ auto ListenerDetailsView::operator=(ListenerDetailsView&& rhs) noexcept -> Liste
 }
 
 auto ListenerDetailsView::listener_id() const -> UniqueListenerId {
+    iox2_unique_listener_id_t id_storage {};
     iox2_unique_listener_id_h id_handle = nullptr;
-    iox2_listener_details_listener_id(m_handle, nullptr, &id_handle);
-    return UniqueListenerId { id_handle };
+    iox2_listener_details_listener_id(m_handle, &id_storage, &id_handle);
+    return UniqueListenerId(id_handle);
 }
 
 auto ListenerDetailsView::node_id() const -> UniqueNodeId {
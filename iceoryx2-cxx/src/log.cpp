@@ -34,6 +34,18 @@ auto set_logger(Log& logger) -> bool {
     return success;
 }
 
+auto set_async_logger(Log& logger) -> bool {
+    auto success = iox2_set_async_logger(internal_log_callback);
+    if (success) {
+        global_logger.emplace(&logger);
+    }
+    return success;
+}
+
+void flush_async_logger() {
+    iox2_flush_async_logger();
+}
+
 void log(LogLevel log_level, const char* origin, const char* message) {
     iox2_log(iox2::bb::into<iox2_log_level_e>(log_level), origin, message);
 }
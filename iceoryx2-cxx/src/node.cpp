@@ -80,6 +80,11 @@ auto Node<T>::wait(iox2::bb::Duration cycle_time) const -> iox2::bb::Expected<vo
     return iox2::bb::err(iox2::bb::into<NodeWaitFailure>(result));
 }
 
+template <ServiceType T>
+void Node<T>::heartbeat() const {
+    iox2_node_heartbeat(&m_handle);
+}
+
 template <ServiceType T>
 auto Node<T>::service_builder(const ServiceName& name) const -> ServiceBuilder<T> {
     return ServiceBuilder<T> { &m_handle, name.as_view().m_ptr };
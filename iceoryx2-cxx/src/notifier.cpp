@@ -41,10 +41,10 @@ Notifier<S>::~Notifier() {
 
 template <ServiceType S>
 auto Notifier<S>::id() const -> UniqueNotifierId {
+    iox2_unique_notifier_id_t id_storage {};
     iox2_unique_notifier_id_h id_handle = nullptr;
-
-    iox2_notifier_id(&m_handle, nullptr, &id_handle);
-    return UniqueNotifierId { id_handle };
+    iox2_notifier_id(&m_handle, &id_storage, &id_handle);
+    return UniqueNotifierId(id_handle);
 }
 
 template <ServiceType S>
@@ -72,6 +72,27 @@ auto Notifier<S>::notify_with_custom_event_id(EventId event_id) const -> bb::Exp
     return bb::err(bb::into<NotifierNotifyError>(result));
 }
 
+template <ServiceType S>
+auto Notifier<S>::notify_multiple(const bb::ImmutableSlice<EventId>& event_ids) const
+    -> bb::Expected<size_t, NotifierNotifyError> {
+    static_assert(sizeof(EventId) == sizeof(iox2_event_id_t) && alignof(EventId) == alignof(iox2_event_id_t),
+                  "EventId must have the same layout as iox2_event_id_t");
+
+    size_t number_of_notified_listeners = 0;
+    auto result = iox2_notifier_notify_multiple(
+        &m_handle,
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) EventId only wraps an iox2_event_id_t
+        reinterpret_cast<const iox2_event_id_t*>(event_ids.data()),
+        event_ids.number_of_elements(),
+        &number_of_notified_listeners);
+
+    if (result == IOX2_OK) {
+        return number_of_notified_listeners;
+    }
+
+    return bb::err(bb::into<NotifierNotifyError>(result));
+}
+
 template <ServiceType S>
 auto Notifier<S>::deadline() const -> bb::Optional<iox2::bb::Duration> {
     uint64_t seconds = 0;
@@ -32,9 +32,10 @@ auto NotifierDetailsView::operator=(NotifierDetailsView&& rhs) noexcept -> Notif
 }
 
 auto NotifierDetailsView::notifier_id() const -> UniqueNotifierId {
+    iox2_unique_notifier_id_t id_storage {};
     iox2_unique_notifier_id_h id_handle = nullptr;
-    iox2_notifier_details_notifier_id(m_handle, nullptr, &id_handle);
-    return UniqueNotifierId { id_handle };
+    iox2_notifier_details_notifier_id(m_handle, &id_storage, &id_handle);
+    return UniqueNotifierId(id_handle);
 }
 
 auto NotifierDetailsView::node_id() const -> UniqueNodeId {
@@ -32,9 +32,10 @@ auto PublisherDetailsView::operator=(PublisherDetailsView&& rhs) noexcept -> Pub
 }
 
 auto PublisherDetailsView::publisher_id() const -> UniquePublisherId {
+    iox2_unique_publisher_id_t id_storage {};
     iox2_unique_publisher_id_h id_handle = nullptr;
-    iox2_publisher_details_publisher_id(m_handle, nullptr, &id_handle);
-    return UniquePublisherId { id_handle };
+    iox2_publisher_details_publisher_id(m_handle, &id_storage, &id_handle);
+    return UniquePublisherId(id_handle);
 }
 
 auto PublisherDetailsView::node_id() const -> UniqueNodeId {
@@ -32,9 +32,10 @@ auto ReaderDetailsView::operator=(ReaderDetailsView&& rhs) noexcept -> ReaderDet
 }
 
 auto ReaderDetailsView::reader_id() const -> UniqueReaderId {
+    iox2_unique_reader_id_t id_storage {};
     iox2_unique_reader_id_h id_handle = nullptr;
-    iox2_reader_details_reader_id(m_handle, nullptr, &id_handle);
-    return UniqueReaderId { id_handle };
+    iox2_reader_details_reader_id(m_handle, &id_storage, &id_handle);
+    return UniqueReaderId(id_handle);
 }
 
 auto ReaderDetailsView::node_id() const -> UniqueNodeId {
@@ -13,6 +13,7 @@
 #include "iox2/service.hpp"
 #include "iox2/bb/expected.hpp"
 #include "iox2/iceoryx2.h"
+#include "iox2/internal/callback_context.hpp"
 #include "iox2/internal/iceoryx2.hpp"
 #include "iox2/service_details.hpp"
 #include "iox2/service_type.hpp"
@@ -65,18 +66,18 @@ auto Service<S>::details(const ServiceName& service_name,
 
 template <ServiceType S>
 auto list_callback(const iox2_static_config_t* const static_config, void* ctx) -> iox2_callback_progression_e {
-    auto callback = static_cast<iox2::bb::StaticFunction<CallbackProgression(ServiceDetails<S>)>*>(ctx);
-    auto result = (*callback)(ServiceDetails<S> { StaticConfig(*static_config) });
+    auto* callback = internal::ctx_cast<iox2::bb::FunctionRef<CallbackProgression(ServiceDetails<S>)>>(ctx);
+    auto result = callback->value()(ServiceDetails<S> { StaticConfig(*static_config) });
     return iox2::bb::into<iox2_callback_progression_e>(result);
 }
 
 template <ServiceType S>
 auto Service<S>::list(const ConfigView config,
-                      const iox2::bb::StaticFunction<CallbackProgression(ServiceDetails<S>)>& callback)
+                      iox2::bb::FunctionRef<CallbackProgression(ServiceDetails<S>)> callback)
     -> bb::Expected<void, ServiceListError> {
-    auto mutable_callback = callback;
-    auto result =
-        iox2_service_list(iox2::bb::into<iox2_service_type_e>(S), config.m_ptr, list_callback<S>, &mutable_callback);
+    auto ctx = internal::ctx(callback);
+    auto result = iox2_service_list(
+        iox2::bb::into<iox2_service_type_e>(S), config.m_ptr, list_callback<S>, static_cast<void*>(&ctx));
 
     if (result == IOX2_OK) {
         return {};
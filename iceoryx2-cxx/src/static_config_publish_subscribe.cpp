@@ -45,6 +45,14 @@ auto StaticConfigPublishSubscribe::has_safe_overflow() const -> bool {
     return m_value.enable_safe_overflow;
 }
 
+auto StaticConfigPublishSubscribe::has_send_timestamps() const -> bool {
+    return m_value.enable_send_timestamps;
+}
+
+auto StaticConfigPublishSubscribe::number_of_priority_lanes() const -> uint64_t {
+    return m_value.number_of_priority_lanes;
+}
+
 auto StaticConfigPublishSubscribe::message_type_details() const -> MessageTypeDetails {
     return MessageTypeDetails(m_value.message_type_details);
 }
@@ -57,6 +65,8 @@ auto operator<<(std::ostream& stream, const iox2::StaticConfigPublishSubscribe&
            << ", subscriber_max_buffer_size: " << value.subscriber_max_buffer_size()
            << ", subscriber_max_borrowed_samples: " << value.subscriber_max_borrowed_samples()
            << ", has_safe_overflow: " << value.has_safe_overflow()
+           << ", has_send_timestamps: " << value.has_send_timestamps()
+           << ", number_of_priority_lanes: " << value.number_of_priority_lanes()
            << ", message_type_details: " << value.message_type_details() << " }";
     return stream;
 }
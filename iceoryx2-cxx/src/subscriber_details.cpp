@@ -32,9 +32,10 @@ auto SubscriberDetailsView::operator=(SubscriberDetailsView&& rhs) noexcept -> S
 }
 
 auto SubscriberDetailsView::subscriber_id() const -> UniqueSubscriberId {
+    iox2_unique_subscriber_id_t id_storage {};
     iox2_unique_subscriber_id_h id_handle = nullptr;
-    iox2_subscriber_details_subscriber_id(m_handle, nullptr, &id_handle);
-    return UniqueSubscriberId { id_handle };
+    iox2_subscriber_details_subscriber_id(m_handle, &id_storage, &id_handle);
+    return UniqueSubscriberId(id_handle);
 }
 
 auto SubscriberDetailsView::node_id() const -> UniqueNodeId {
@@ -12,372 +12,125 @@
 
 #include "iox2/unique_port_id.hpp"
 
-namespace iox2 {
-UniquePublisherId::UniquePublisherId(UniquePublisherId&& rhs) noexcept {
-    *this = std::move(rhs);
-}
-
-auto UniquePublisherId::operator=(UniquePublisherId&& rhs) noexcept -> UniquePublisherId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
-
-    return *this;
-}
-
-UniquePublisherId::~UniquePublisherId() {
-    drop();
-}
-
-auto operator==(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool {
-    return iox2_unique_publisher_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniquePublisherId& lhs, const UniquePublisherId& rhs) -> bool {
-    return iox2_unique_publisher_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniquePublisherId::UniquePublisherId(iox2_unique_publisher_id_h handle)
-    : m_handle { handle } {
-}
-
-auto UniquePublisherId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_publisher_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
-
-void UniquePublisherId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_publisher_id_drop(m_handle);
-        m_handle = nullptr;
-    }
-}
-
-UniqueSubscriberId::UniqueSubscriberId(UniqueSubscriberId&& rhs) noexcept {
-    *this = std::move(rhs);
-}
-
-auto UniqueSubscriberId::operator=(UniqueSubscriberId&& rhs) noexcept -> UniqueSubscriberId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
-
-    return *this;
-}
-
-UniqueSubscriberId::~UniqueSubscriberId() {
-    drop();
-}
-
-auto operator==(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool {
-    return iox2_unique_subscriber_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniqueSubscriberId& lhs, const UniqueSubscriberId& rhs) -> bool {
-    return iox2_unique_subscriber_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniqueSubscriberId::UniqueSubscriberId(iox2_unique_subscriber_id_h handle)
-    : m_handle { handle } {
-}
-
-auto UniqueSubscriberId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_subscriber_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
-
-void UniqueSubscriberId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_subscriber_id_drop(m_handle);
-        m_handle = nullptr;
-    }
-}
-
-UniqueNotifierId::UniqueNotifierId(UniqueNotifierId&& rhs) noexcept {
-    *this = std::move(rhs);
-}
-
-auto UniqueNotifierId::operator=(UniqueNotifierId&& rhs) noexcept -> UniqueNotifierId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
-
-    return *this;
-}
-
-UniqueNotifierId::~UniqueNotifierId() {
-    drop();
-}
-
-auto operator==(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool {
-    return iox2_unique_notifier_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniqueNotifierId& lhs, const UniqueNotifierId& rhs) -> bool {
-    return iox2_unique_notifier_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniqueNotifierId::UniqueNotifierId(iox2_unique_notifier_id_h handle)
-    : m_handle { handle } {
-}
+#include <cstring>
+#include <type_traits>
 
-auto UniqueNotifierId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_notifier_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
-
-void UniqueNotifierId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_notifier_id_drop(m_handle);
-        m_handle = nullptr;
-    }
-}
-
-UniqueListenerId::UniqueListenerId(UniqueListenerId&& rhs) noexcept {
-    *this = std::move(rhs);
-}
-
-auto UniqueListenerId::operator=(UniqueListenerId&& rhs) noexcept -> UniqueListenerId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
-
-    return *this;
-}
-
-UniqueListenerId::~UniqueListenerId() {
-    drop();
-}
-
-auto operator==(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool {
-    return iox2_unique_listener_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniqueListenerId& lhs, const UniqueListenerId& rhs) -> bool {
-    return iox2_unique_listener_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniqueListenerId::UniqueListenerId(iox2_unique_listener_id_h handle)
-    : m_handle { handle } {
-}
-
-auto UniqueListenerId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_listener_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
-
-void UniqueListenerId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_listener_id_drop(m_handle);
-        m_handle = nullptr;
-    }
-}
-
-UniqueClientId::UniqueClientId(UniqueClientId&& rhs) noexcept {
-    *this = std::move(rhs);
-}
-
-auto UniqueClientId::operator=(UniqueClientId&& rhs) noexcept -> UniqueClientId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
-
-    return *this;
-}
-
-UniqueClientId::~UniqueClientId() {
-    drop();
-}
-
-auto operator==(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool {
-    return iox2_unique_client_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniqueClientId& lhs, const UniqueClientId& rhs) -> bool {
-    return iox2_unique_client_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniqueClientId::UniqueClientId(iox2_unique_client_id_h handle)
-    : m_handle { handle } {
-}
-
-auto UniqueClientId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_client_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
-
-void UniqueClientId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_client_id_drop(m_handle);
-        m_handle = nullptr;
-    }
+namespace iox2 {
+namespace {
+auto unique_port_id_bytes(const internal::UniquePortIdValue& value) -> RawIdType {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    std::memcpy(bytes.unchecked_access().data(), &value, sizeof(value));
+    return bytes;
 }
 
-UniqueServerId::UniqueServerId(UniqueServerId&& rhs) noexcept {
-    *this = std::move(rhs);
+auto unique_port_id_value(const RawIdType& bytes) -> internal::UniquePortIdValue {
+    internal::UniquePortIdValue value;
+    std::memcpy(&value, bytes.unchecked_access().data(), sizeof(value));
+    return value;
 }
+} // namespace
 
-auto UniqueServerId::operator=(UniqueServerId&& rhs) noexcept -> UniqueServerId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
+static_assert(std::is_trivially_copyable<UniquePublisherId>::value, "UniquePublisherId must be a plain value");
 
-    return *this;
+UniquePublisherId::UniquePublisherId(iox2_unique_publisher_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_publisher_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_publisher_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueServerId::~UniqueServerId() {
-    drop();
+auto UniquePublisherId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto operator==(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool {
-    return iox2_unique_server_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
+static_assert(std::is_trivially_copyable<UniqueSubscriberId>::value, "UniqueSubscriberId must be a plain value");
 
-auto operator<(const UniqueServerId& lhs, const UniqueServerId& rhs) -> bool {
-    return iox2_unique_server_id_less(&lhs.m_handle, &rhs.m_handle);
+UniqueSubscriberId::UniqueSubscriberId(iox2_unique_subscriber_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_subscriber_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_subscriber_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueServerId::UniqueServerId(iox2_unique_server_id_h handle)
-    : m_handle { handle } {
+auto UniqueSubscriberId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto UniqueServerId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_server_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
+static_assert(std::is_trivially_copyable<UniqueNotifierId>::value, "UniqueNotifierId must be a plain value");
 
-void UniqueServerId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_server_id_drop(m_handle);
-        m_handle = nullptr;
-    }
+UniqueNotifierId::UniqueNotifierId(iox2_unique_notifier_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_notifier_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_notifier_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueReaderId::UniqueReaderId(UniqueReaderId&& rhs) noexcept {
-    *this = std::move(rhs);
+auto UniqueNotifierId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto UniqueReaderId::operator=(UniqueReaderId&& rhs) noexcept -> UniqueReaderId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
+static_assert(std::is_trivially_copyable<UniqueListenerId>::value, "UniqueListenerId must be a plain value");
 
-    return *this;
+UniqueListenerId::UniqueListenerId(iox2_unique_listener_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_listener_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_listener_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueReaderId::~UniqueReaderId() {
-    drop();
+auto UniqueListenerId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto operator==(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool {
-    return iox2_unique_reader_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
+static_assert(std::is_trivially_copyable<UniqueClientId>::value, "UniqueClientId must be a plain value");
 
-auto operator<(const UniqueReaderId& lhs, const UniqueReaderId& rhs) -> bool {
-    return iox2_unique_reader_id_less(&lhs.m_handle, &rhs.m_handle);
+UniqueClientId::UniqueClientId(iox2_unique_client_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_client_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_client_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueReaderId::UniqueReaderId(iox2_unique_reader_id_h handle)
-    : m_handle { handle } {
+auto UniqueClientId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto UniqueReaderId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_reader_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
-}
+static_assert(std::is_trivially_copyable<UniqueServerId>::value, "UniqueServerId must be a plain value");
 
-void UniqueReaderId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_reader_id_drop(m_handle);
-        m_handle = nullptr;
-    }
+UniqueServerId::UniqueServerId(iox2_unique_server_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_server_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_server_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueWriterId::UniqueWriterId(UniqueWriterId&& rhs) noexcept {
-    *this = std::move(rhs);
+auto UniqueServerId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto UniqueWriterId::operator=(UniqueWriterId&& rhs) noexcept -> UniqueWriterId& {
-    if (this != &rhs) {
-        drop();
-        m_handle = rhs.m_handle;
-        rhs.m_handle = nullptr;
-    }
+static_assert(std::is_trivially_copyable<UniqueReaderId>::value, "UniqueReaderId must be a plain value");
 
-    return *this;
+UniqueReaderId::UniqueReaderId(iox2_unique_reader_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_reader_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_reader_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-UniqueWriterId::~UniqueWriterId() {
-    drop();
+auto UniqueReaderId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 
-auto operator==(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool {
-    return iox2_unique_writer_id_eq(&lhs.m_handle, &rhs.m_handle);
-}
-
-auto operator<(const UniqueWriterId& lhs, const UniqueWriterId& rhs) -> bool {
-    return iox2_unique_writer_id_less(&lhs.m_handle, &rhs.m_handle);
-}
-
-UniqueWriterId::UniqueWriterId(iox2_unique_writer_id_h handle)
-    : m_handle { handle } {
-}
+static_assert(std::is_trivially_copyable<UniqueWriterId>::value, "UniqueWriterId must be a plain value");
 
-auto UniqueWriterId::bytes() const -> const bb::Optional<RawIdType>& {
-    if (!m_raw_id.has_value() && m_handle != nullptr) {
-        auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
-        iox2_unique_writer_id_value(m_handle, bytes.unchecked_access().data(), bytes.size());
-        m_raw_id.emplace(std::move(bytes));
-    }
-    return m_raw_id;
+UniqueWriterId::UniqueWriterId(iox2_unique_writer_id_h handle) {
+    auto bytes = RawIdType::from_value<RawIdType::capacity()>(0U);
+    iox2_unique_writer_id_value(handle, bytes.unchecked_access().data(), bytes.size());
+    iox2_unique_writer_id_drop(handle);
+    m_value = unique_port_id_value(bytes);
 }
 
-void UniqueWriterId::drop() {
-    if (m_handle != nullptr) {
-        iox2_unique_writer_id_drop(m_handle);
-        m_handle = nullptr;
-    }
+auto UniqueWriterId::bytes() const -> bb::Optional<RawIdType> {
+    return unique_port_id_bytes(m_value);
 }
 } // namespace iox2
@@ -110,6 +110,48 @@ auto operator<<(std::ostream& stream, const WaitSetAttachmentId<S>& self) -> std
 // END: WaitSetAttachmentId
 ////////////////////////////
 
+////////////////////////////
+// BEGIN: WaitSetAttachmentIdBatch
+////////////////////////////
+template <ServiceType S>
+WaitSetAttachmentIdBatch<S>::WaitSetAttachmentIdBatch(iox2_waitset_attachment_id_batch_ptr handle)
+    : m_handle { handle } {
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::size() const -> uint64_t {
+    return iox2_waitset_attachment_id_batch_len(m_handle);
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::empty() const -> bool {
+    return size() == 0;
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::has_event_from(const uint64_t index, const WaitSetGuard<S>& guard) const -> bool {
+    return iox2_waitset_attachment_id_batch_has_event_from(m_handle, index, &guard.m_handle);
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::has_missed_deadline(const uint64_t index, const WaitSetGuard<S>& guard) const
+    -> bool {
+    return iox2_waitset_attachment_id_batch_has_missed_deadline(m_handle, index, &guard.m_handle);
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::contains_event_from(const WaitSetGuard<S>& guard) const -> bool {
+    return iox2_waitset_attachment_id_batch_contains_event_from(m_handle, &guard.m_handle);
+}
+
+template <ServiceType S>
+auto WaitSetAttachmentIdBatch<S>::contains_missed_deadline(const WaitSetGuard<S>& guard) const -> bool {
+    return iox2_waitset_attachment_id_batch_contains_missed_deadline(m_handle, &guard.m_handle);
+}
+////////////////////////////
+// END: WaitSetAttachmentIdBatch
+////////////////////////////
+
 ////////////////////////////
 // BEGIN: WaitSetGuard
 ////////////////////////////
@@ -300,12 +342,12 @@ auto WaitSet<S>::attach_notification(const Listener<S>& listener)
 
 template <ServiceType S>
 auto run_callback(iox2_waitset_attachment_id_h attachment_id, void* context) -> iox2_callback_progression_e {
-    auto* fn_call = internal::ctx_cast<iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>>(context);
+    auto* fn_call = internal::ctx_cast<iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)>>(context);
     return iox2::bb::into<iox2_callback_progression_e>(fn_call->value()(WaitSetAttachmentId<S>(attachment_id)));
 }
 
 template <ServiceType S>
-auto WaitSet<S>::wait_and_process(const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+auto WaitSet<S>::wait_and_process(iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call)
     -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
     iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
     auto ctx = internal::ctx(fn_call);
@@ -319,8 +361,7 @@ auto WaitSet<S>::wait_and_process(const iox2::bb::StaticFunction<CallbackProgres
 }
 
 template <ServiceType S>
-auto WaitSet<S>::wait_and_process_once(
-    const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call)
+auto WaitSet<S>::wait_and_process_once(iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call)
     -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
     iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
     auto ctx = internal::ctx(fn_call);
@@ -335,7 +376,7 @@ auto WaitSet<S>::wait_and_process_once(
 
 template <ServiceType S>
 auto WaitSet<S>::wait_and_process_once_with_timeout(
-    const iox2::bb::StaticFunction<CallbackProgression(WaitSetAttachmentId<S>)>& fn_call,
+    iox2::bb::FunctionRef<CallbackProgression(WaitSetAttachmentId<S>)> fn_call,
     const iox2::bb::Duration timeout) -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
     iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
     auto ctx = internal::ctx(fn_call);
@@ -349,12 +390,74 @@ auto WaitSet<S>::wait_and_process_once_with_timeout(
     return bb::err(bb::into<WaitSetRunError>(result));
 }
 
+template <ServiceType S>
+auto run_batch_callback(iox2_waitset_attachment_id_batch_ptr batch, void* context) -> iox2_callback_progression_e {
+    auto* fn_call =
+        internal::ctx_cast<iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)>>(context);
+    const WaitSetAttachmentIdBatch<S> view(batch);
+    return iox2::bb::into<iox2_callback_progression_e>(fn_call->value()(view));
+}
+
+template <ServiceType S>
+auto WaitSet<S>::wait_and_process_batch(
+    iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call)
+    -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
+    iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
+    auto ctx = internal::ctx(fn_call);
+    auto result =
+        iox2_waitset_wait_and_process_batch(&m_handle, run_batch_callback<S>, static_cast<void*>(&ctx), &run_result);
+
+    if (result == IOX2_OK) {
+        return bb::into<WaitSetRunResult>(static_cast<int>(run_result));
+    }
+
+    return bb::err(bb::into<WaitSetRunError>(result));
+}
+
+template <ServiceType S>
+auto WaitSet<S>::wait_and_process_batch_once(
+    iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call)
+    -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
+    iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
+    auto ctx = internal::ctx(fn_call);
+    auto result = iox2_waitset_wait_and_process_batch_once(
+        &m_handle, run_batch_callback<S>, static_cast<void*>(&ctx), &run_result);
+
+    if (result == IOX2_OK) {
+        return bb::into<WaitSetRunResult>(static_cast<int>(run_result));
+    }
+
+    return bb::err(bb::into<WaitSetRunError>(result));
+}
+
+template <ServiceType S>
+auto WaitSet<S>::wait_and_process_batch_once_with_timeout(
+    iox2::bb::FunctionRef<CallbackProgression(const WaitSetAttachmentIdBatch<S>&)> fn_call,
+    const iox2::bb::Duration timeout) -> bb::Expected<WaitSetRunResult, WaitSetRunError> {
+    iox2_waitset_run_result_e run_result = iox2_waitset_run_result_e_STOP_REQUEST;
+    auto ctx = internal::ctx(fn_call);
+    auto result = iox2_waitset_wait_and_process_batch_once_with_timeout(&m_handle,
+                                                                        run_batch_callback<S>,
+                                                                        static_cast<void*>(&ctx),
+                                                                        timeout.as_secs(),
+                                                                        timeout.subsec_nanos(),
+                                                                        &run_result);
+
+    if (result == IOX2_OK) {
+        return bb::into<WaitSetRunResult>(static_cast<int>(run_result));
+    }
+
+    return bb::err(bb::into<WaitSetRunError>(result));
+}
+
 ////////////////////////////
 // END: WaitSet
 ////////////////////////////
 
 template class WaitSetAttachmentId<ServiceType::Ipc>;
 template class WaitSetAttachmentId<ServiceType::Local>;
+template class WaitSetAttachmentIdBatch<ServiceType::Ipc>;
+template class WaitSetAttachmentIdBatch<ServiceType::Local>;
 template class WaitSetGuard<ServiceType::Ipc>;
 template class WaitSetGuard<ServiceType::Local>;
 template class WaitSet<ServiceType::Ipc>;
@@ -32,9 +32,10 @@ auto WriterDetailsView::operator=(WriterDetailsView&& rhs) noexcept -> WriterDet
 }
 
 auto WriterDetailsView::writer_id() const -> UniqueWriterId {
+    iox2_unique_writer_id_t id_storage {};
     iox2_unique_writer_id_h id_handle = nullptr;
-    iox2_writer_details_writer_id(m_handle, nullptr, &id_handle);
-    return UniqueWriterId { id_handle };
+    iox2_writer_details_writer_id(m_handle, &id_storage, &id_handle);
+    return UniqueWriterId(id_handle);
 }
 
 auto WriterDetailsView::node_id() const -> UniqueNodeId {
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "allocation_tracker.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define IOX2_TESTING_HAS_SANITIZER
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define IOX2_TESTING_HAS_SANITIZER
+#endif
+
+#if defined(__linux__) && defined(__GLIBC__) && !defined(IOX2_TESTING_HAS_SANITIZER)
+#define IOX2_TESTING_INTERPOSE_MALLOC
+#include <malloc.h>
+#endif
+
+namespace {
+// plain thread locals without constructor, so that accessing them in the allocator cannot allocate
+thread_local bool IS_TRACKING = false;
+thread_local uint64_t ALLOCATIONS = 0;
+thread_local uint64_t DEALLOCATIONS = 0;
+
+#ifdef IOX2_TESTING_INTERPOSE_MALLOC
+void record_allocation() {
+    if (IS_TRACKING) {
+        ++ALLOCATIONS;
+    }
+}
+
+void record_deallocation(const void* ptr) {
+    if (IS_TRACKING && ptr != nullptr) {
+        ++DEALLOCATIONS;
+    }
+}
+#endif
+} // namespace
+
+namespace iox2_testing {
+auto AllocationTracker::is_supported() -> bool {
+#ifdef IOX2_TESTING_INTERPOSE_MALLOC
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::start() {
+    ALLOCATIONS = 0;
+    DEALLOCATIONS = 0;
+    IS_TRACKING = true;
+}
+
+void AllocationTracker::stop() {
+    IS_TRACKING = false;
+}
+
+auto AllocationTracker::allocations() -> uint64_t {
+    return ALLOCATIONS;
+}
+
+auto AllocationTracker::deallocations() -> uint64_t {
+    return DEALLOCATIONS;
+}
+} // namespace iox2_testing
+
+#ifdef IOX2_TESTING_INTERPOSE_MALLOC
+// The definitions below take precedence over the ones of the libc for the whole test executable.
+// The statically linked Rust part of the FFI uses the libc allocator as global allocator and
+// libstdc++ implements 'operator new' with 'malloc', therefore all heap allocations pass through
+// them.
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,hicpp-no-malloc,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp,readability-inconsistent-declaration-parameter-name)
+extern "C" {
+auto __libc_malloc(size_t size) -> void*;
+auto __libc_calloc(size_t count, size_t size) -> void*;
+auto __libc_realloc(void* ptr, size_t size) -> void*;
+auto __libc_memalign(size_t alignment, size_t size) -> void*;
+void __libc_free(void* ptr);
+
+auto malloc(size_t size) noexcept -> void* {
+    record_allocation();
+    return __libc_malloc(size);
+}
+
+auto calloc(size_t count, size_t size) noexcept -> void* {
+    record_allocation();
+    return __libc_calloc(count, size);
+}
+
+auto realloc(void* ptr, size_t size) noexcept -> void* {
+    record_allocation();
+    return __libc_realloc(ptr, size);
+}
+
+auto memalign(size_t alignment, size_t size) noexcept -> void* {
+    record_allocation();
+    return __libc_memalign(alignment, size);
+}
+
+auto aligned_alloc(size_t alignment, size_t size) noexcept -> void* {
+    record_allocation();
+    return __libc_memalign(alignment, size);
+}
+
+auto posix_memalign(void** ptr, size_t alignment, size_t size) noexcept -> int {
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+
+    record_allocation();
+    void* memory = __libc_memalign(alignment, size);
+    if (memory == nullptr) {
+        return ENOMEM;
+    }
+
+    *ptr = memory;
+    return 0;
+}
+
+void free(void* ptr) noexcept {
+    record_deallocation(ptr);
+    __libc_free(ptr);
+}
+}
+// NOLINTEND(cppcoreguidelines-no-malloc,hicpp-no-malloc,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp,readability-inconsistent-declaration-parameter-name)
+#endif
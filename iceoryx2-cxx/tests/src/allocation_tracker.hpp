@@ -0,0 +1,83 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#ifndef IOX2_CXX_TESTS_ALLOCATION_TRACKER_HPP
+#define IOX2_CXX_TESTS_ALLOCATION_TRACKER_HPP
+
+#include <cstdint>
+
+namespace iox2_testing {
+/// Counts the heap allocations and deallocations of the calling thread. The test executable
+/// interposes `malloc`, `calloc`, `realloc`, `free` and the aligned variants, so that the
+/// allocations of the C++ binding as well as the ones of the Rust global allocator of the FFI,
+/// which forwards to the libc, are recorded.
+class AllocationTracker {
+  public:
+    /// Returns true when the platform supports the interposition of the libc allocator. It is not
+    /// supported outside of glibc and when the tests are built with a sanitizer, which replaces
+    /// the allocator on its own.
+    static auto is_supported() -> bool;
+
+    /// Starts to record the allocations and deallocations of the calling thread.
+    static void start();
+
+    /// Stops the recording of the calling thread.
+    static void stop();
+
+    /// Number of allocations of the calling thread since the last [`AllocationTracker::start()`].
+    static auto allocations() -> uint64_t;
+
+    /// Number of deallocations of the calling thread since the last [`AllocationTracker::start()`].
+    static auto deallocations() -> uint64_t;
+};
+
+/// Records the allocations and deallocations of the calling thread during its lifetime.
+class AllocationScope {
+  public:
+    AllocationScope() noexcept {
+        AllocationTracker::start();
+    }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope(AllocationScope&&) = delete;
+    auto operator=(const AllocationScope&) -> AllocationScope& = delete;
+    auto operator=(AllocationScope&&) -> AllocationScope& = delete;
+
+    ~AllocationScope() {
+        AllocationTracker::stop();
+    }
+};
+} // namespace iox2_testing
+
+/// Executes the statements and expects that neither the C++ binding nor the FFI allocate or
+/// release heap memory on the calling thread. The test is skipped when the platform does not
+/// support the allocation tracking.
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) a macro is required to embed arbitrary statements
+#define EXPECT_NO_ALLOCATIONS(...)                                                                                     \
+    do {                                                                                                               \
+        if (!::iox2_testing::AllocationTracker::is_supported()) {                                                      \
+            GTEST_SKIP() << "allocation tracking is not supported on this platform";                                  \
+        }                                                                                                              \
+        uint64_t iox2_allocations = 0;                                                                                 \
+        uint64_t iox2_deallocations = 0;                                                                               \
+        {                                                                                                              \
+            const ::iox2_testing::AllocationScope iox2_allocation_scope;                                               \
+            __VA_ARGS__;                                                                                               \
+            iox2_allocations = ::iox2_testing::AllocationTracker::allocations();                                       \
+            iox2_deallocations = ::iox2_testing::AllocationTracker::deallocations();                                   \
+        }                                                                                                              \
+        EXPECT_THAT(iox2_allocations, ::testing::Eq(0U)) << "unexpected heap allocations";                             \
+        EXPECT_THAT(iox2_deallocations, ::testing::Eq(0U)) << "unexpected heap deallocations";                         \
+    } while (false)
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#endif // IOX2_CXX_TESTS_ALLOCATION_TRACKER_HPP
@@ -0,0 +1,219 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+// the iox2/async layer is only available when the tests are built with C++20 or newer
+#if defined(__cpp_impl_coroutine)
+
+#include "iox2/async/executor.hpp"
+#include "iox2/async/task.hpp"
+#include "iox2/node.hpp"
+#include "iox2/service.hpp"
+
+#include "test.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace {
+using namespace iox2;
+using namespace iox2::async;
+
+constexpr uint64_t DELAY_IN_MILLISECONDS = 10;
+
+template <typename T>
+class AsyncExecutorTest : public ::testing::Test {
+  public:
+    static constexpr ServiceType TYPE = T::TYPE;
+};
+
+TYPED_TEST_SUITE(AsyncExecutorTest, iox2_testing::ServiceTypes, );
+
+template <ServiceType S>
+auto sum_of_responses(Executor<S>& executor, Client<S, uint64_t, void, uint64_t, void>& client, uint64_t value)
+    -> Task<uint64_t> {
+    auto pending_response = client.send_copy(value).value();
+    uint64_t sum = 0;
+    while (true) {
+        auto response = co_await executor.receive(pending_response);
+        if (!response.has_value() || !response->has_value()) {
+            break;
+        }
+        sum += response->value().payload();
+    }
+
+    co_return sum;
+}
+
+template <ServiceType S>
+auto store_sum_of_responses(Executor<S>& executor,
+                            Client<S, uint64_t, void, uint64_t, void>& client,
+                            uint64_t value,
+                            uint64_t& result) -> Task<> {
+    result = co_await sum_of_responses(executor, client, value);
+}
+
+TYPED_TEST(AsyncExecutorTest, run_without_tasks_returns_immediately) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    auto sut = ExecutorBuilder().template create<SERVICE_TYPE>().value();
+
+    auto result = sut.run();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_THAT(result.value(), Eq(WaitSetRunResult::AllEventsHandled));
+    ASSERT_THAT(sut.number_of_tasks(), Eq(0));
+}
+
+TYPED_TEST(AsyncExecutorTest, concurrent_requests_complete_on_one_thread) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_REQUESTS = 8;
+    constexpr uint64_t NUMBER_OF_RESPONSES = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .max_active_requests_per_client(NUMBER_OF_REQUESTS)
+                       .create()
+                       .value();
+    auto server = service.server_builder().create().value();
+    auto client = service.client_builder().create().value();
+
+    auto sut = ExecutorBuilder().template create<SERVICE_TYPE>().value();
+    std::array<uint64_t, NUMBER_OF_REQUESTS> results {};
+    for (uint64_t idx = 0; idx < NUMBER_OF_REQUESTS; ++idx) {
+        sut.spawn(store_sum_of_responses(sut, client, idx, results[idx]));
+    }
+    ASSERT_THAT(sut.number_of_tasks(), Eq(NUMBER_OF_REQUESTS));
+
+    std::thread server_thread([&] {
+        uint64_t number_of_handled_requests = 0;
+        while (number_of_handled_requests < NUMBER_OF_REQUESTS) {
+            auto active_request = server.receive().value();
+            if (!active_request.has_value()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(DELAY_IN_MILLISECONDS));
+                continue;
+            }
+
+            for (uint64_t n = 0; n < NUMBER_OF_RESPONSES; ++n) {
+                ASSERT_TRUE(active_request->send_copy(active_request->payload()).has_value());
+            }
+            ++number_of_handled_requests;
+        }
+    });
+
+    auto result = sut.run();
+    server_thread.join();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_THAT(result.value(), Eq(WaitSetRunResult::AllEventsHandled));
+    ASSERT_THAT(sut.number_of_tasks(), Eq(0));
+    for (uint64_t idx = 0; idx < NUMBER_OF_REQUESTS; ++idx) {
+        ASSERT_THAT(results[idx], Eq(idx * NUMBER_OF_RESPONSES));
+    }
+}
+
+template <ServiceType S>
+auto store_received_sample(Executor<S>& executor, const Subscriber<S, uint64_t, void>& subscriber, uint64_t& result)
+    -> Task<> {
+    auto sample = co_await executor.receive(subscriber);
+    if (sample.has_value()) {
+        result = sample->payload();
+    }
+}
+
+TYPED_TEST(AsyncExecutorTest, awaited_sample_is_received) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 8912;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    auto sut = ExecutorBuilder().template create<SERVICE_TYPE>().value();
+    uint64_t received_payload = 0;
+    sut.spawn(store_received_sample(sut, subscriber, received_payload));
+
+    std::thread publisher_thread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(DELAY_IN_MILLISECONDS));
+        ASSERT_TRUE(publisher.send_copy(PAYLOAD).has_value());
+    });
+
+    auto result = sut.run();
+    publisher_thread.join();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_THAT(received_payload, Eq(PAYLOAD));
+}
+
+template <ServiceType S>
+auto store_number_of_activations(Executor<S>& executor, Listener<S>& listener, uint64_t& result) -> Task<> {
+    auto number_of_activations = co_await executor.wait(listener, [](auto) {});
+    if (number_of_activations.has_value()) {
+        result = number_of_activations.value();
+    }
+}
+
+TYPED_TEST(AsyncExecutorTest, awaited_listener_wakes_up_on_notification) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    // a large poll interval ensures that the listener attachment wakes up the executor
+    constexpr uint64_t POLL_INTERVAL_IN_SECONDS = 3600;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).event().create().value();
+    auto notifier = service.notifier_builder().create().value();
+    auto listener = service.listener_builder().create().value();
+
+    auto sut = ExecutorBuilder()
+                   .poll_interval(bb::Duration::from_secs(POLL_INTERVAL_IN_SECONDS))
+                   .template create<SERVICE_TYPE>()
+                   .value();
+    uint64_t number_of_activations = 0;
+    sut.spawn(store_number_of_activations(sut, listener, number_of_activations));
+
+    std::thread notifier_thread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(DELAY_IN_MILLISECONDS));
+        ASSERT_TRUE(notifier.notify().has_value());
+    });
+
+    auto result = sut.run();
+    notifier_thread.join();
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_THAT(number_of_activations, Eq(1));
+}
+
+TYPED_TEST(AsyncExecutorTest, unfinished_tasks_are_destroyed_with_the_executor) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    uint64_t received_payload = 0;
+    {
+        auto sut = ExecutorBuilder().template create<SERVICE_TYPE>().value();
+        sut.spawn(store_received_sample(sut, subscriber, received_payload));
+        ASSERT_THAT(sut.number_of_tasks(), Eq(1));
+    }
+
+    ASSERT_THAT(received_payload, Eq(0));
+}
+} // namespace
+
+#endif
@@ -225,6 +225,18 @@ TEST(Config, global_creation_timeout) {
     ASSERT_THAT(config.global().creation_timeout(), Eq(test_value));
 }
 
+TEST(Config, global_shared_memory_quota) {
+    const auto test_value = bb::Optional<size_t>(64U * 1024U * 1024U);
+    auto config = Config();
+    ASSERT_THAT(config.global().shared_memory_quota(), Eq(bb::NULLOPT));
+
+    config.global().set_shared_memory_quota(test_value);
+    ASSERT_THAT(config.global().shared_memory_quota(), Eq(test_value));
+
+    config.global().set_shared_memory_quota(bb::NULLOPT);
+    ASSERT_THAT(config.global().shared_memory_quota(), Eq(bb::NULLOPT));
+}
+
 TEST(Config, global_service_connection_suffix) {
     const auto test_value = iox2::bb::FileName::create("what_dinosaur_ancester_has_the_pidgin").value();
     auto config = Config();
@@ -446,4 +458,60 @@ TEST(Config, defaults_blackboard_max_subscribers) {
     config.defaults().blackboard().set_max_readers(test_value);
     ASSERT_THAT(config.defaults().blackboard().max_readers(), Eq(test_value));
 }
+TEST(Config, snapshot_contains_all_settings) {
+    const auto test_prefix = iox2::bb::FileName::create("snappy_").value();
+    const auto test_directory = iox2::bb::Path::create("snappy_nodes").value();
+    const auto test_max_readers = 17;
+    auto config = Config();
+
+    config.global().set_prefix(test_prefix);
+    config.global().node().set_directory(test_directory);
+    config.global().service().set_cleanup_dead_nodes_on_open(false);
+    config.defaults().blackboard().set_max_readers(test_max_readers);
+    config.defaults().event().set_notifier_dead_event(bb::Optional<size_t>(9U));
+    config.global().set_shared_memory_quota(bb::Optional<size_t>(4096U));
+
+    const auto sut = config.snapshot();
+
+    ASSERT_THAT(sut.global.prefix.unchecked_access().c_str(), StrEq(config.global().prefix()));
+    ASSERT_THAT(sut.global.root_path.unchecked_access().c_str(), StrEq(config.global().root_path()));
+    ASSERT_THAT(sut.global.node.directory.unchecked_access().c_str(), StrEq(config.global().node().directory()));
+    ASSERT_THAT(sut.global.service.cleanup_dead_nodes_on_open, Eq(false));
+    ASSERT_THAT(sut.defaults.blackboard.max_readers, Eq(test_max_readers));
+    ASSERT_THAT(sut.defaults.event.notifier_dead_event, Eq(bb::Optional<size_t>(9U)));
+    ASSERT_THAT(sut.global.shared_memory_quota, Eq(bb::Optional<size_t>(4096U)));
+    ASSERT_THAT(sut.defaults.publish_subscribe.max_publishers,
+                Eq(config.defaults().publish_subscribe().max_publishers()));
+}
+
+TEST(Config, snapshot_does_not_reflect_later_changes) {
+    auto config = Config();
+    const auto max_nodes = config.defaults().request_response().max_nodes();
+
+    const auto sut = config.snapshot();
+    config.defaults().request_response().set_max_nodes(max_nodes + 1);
+
+    ASSERT_THAT(sut.defaults.request_response.max_nodes, Eq(max_nodes));
+}
+
+TEST(Config, global_config_snapshot_is_equal_to_global_config) {
+    const auto& sut = Config::global_config_snapshot();
+    auto global_config = Config::global_config().to_owned();
+
+    ASSERT_THAT(&sut, Eq(&Config::global_config_snapshot()));
+    ASSERT_THAT(sut.global.prefix.unchecked_access().c_str(), StrEq(global_config.global().prefix()));
+    ASSERT_THAT(sut.defaults.event.max_listeners, Eq(global_config.defaults().event().max_listeners()));
+}
+
+TEST(Config, from_file_cached_does_not_cache_failures) {
+    const auto file = iox2::bb::FilePath::create("/some/file/that/does/not/exist.toml").value();
+
+    auto first_result = Config::from_file_cached(file);
+    ASSERT_THAT(first_result.has_value(), Eq(false));
+    ASSERT_THAT(first_result.error(), Eq(ConfigCreationError::ConfigFileDoesNotExist));
+
+    auto second_result = Config::from_file_cached(file);
+    ASSERT_THAT(second_result.has_value(), Eq(false));
+    ASSERT_THAT(second_result.error(), Eq(ConfigCreationError::ConfigFileDoesNotExist));
+}
 } // namespace
@@ -0,0 +1,66 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/cycle_clock.hpp"
+#include "iox2/node.hpp"
+#include "iox2/sample.hpp"
+#include "iox2/service.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace {
+using namespace iox2;
+
+constexpr bb::Duration TIMEOUT = bb::Duration::from_millis(50);
+// the calibration error of the cycle counter is in the range of microseconds
+constexpr bb::Duration TOLERANCE = bb::Duration::from_millis(1);
+
+TEST(CycleClock, now_progresses_with_the_wall_time) {
+    const auto start = CycleClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.as_millis()));
+    const auto end = CycleClock::now();
+
+    ASSERT_THAT(end + TOLERANCE, Ge(start + TIMEOUT));
+}
+
+TEST(CycleClock, elapsed_since_a_future_timestamp_is_zero) {
+    const auto future = CycleClock::now() + bb::Duration::from_secs(3600);
+
+    ASSERT_THAT(CycleClock::elapsed_since(future), Eq(bb::Duration::zero()));
+}
+
+TEST(CycleClock, elapsed_since_send_timestamp_measures_the_latency) {
+    constexpr ServiceType SERVICE_TYPE = ServiceType::Local;
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(iox2_testing::generate_service_name())
+                       .publish_subscribe<uint64_t>()
+                       .enable_send_timestamps(true)
+                       .create()
+                       .value();
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    publisher.send_copy(0).value();
+    std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT.as_millis()));
+    auto sample = subscriber.receive().value();
+    ASSERT_TRUE(sample.has_value());
+
+    auto send_timestamp = sample->header().send_timestamp();
+    ASSERT_TRUE(send_timestamp.has_value());
+
+    const auto latency = CycleClock::elapsed_since(*send_timestamp);
+    ASSERT_THAT(latency + TOLERANCE, Ge(TIMEOUT));
+    ASSERT_THAT(latency, Le(bb::Duration::from_secs(60)));
+}
+} // namespace
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/duration.hpp"
+#include "iox2/node.hpp"
+#include "iox2/sample_mut.hpp"
+#include "iox2/service.hpp"
+#include "iox2/waitset.hpp"
+
+#include "allocation_tracker.hpp"
+#include "test.hpp"
+
+#include <array>
+
+namespace {
+using namespace iox2;
+
+constexpr uint64_t NUMBER_OF_CYCLES = 16;
+
+// every test performs one warm up cycle before the allocations are tracked, so that the lazily
+// created state of the ports, like the connections to their counterparts, is already in place and
+// only the steady state is measured
+template <typename T>
+struct HotPathAllocationTest : public ::testing::Test {
+    static constexpr ServiceType TYPE = T::TYPE;
+
+    HotPathAllocationTest()
+        : node { NodeBuilder().create<TYPE>().value() } {
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes), come on, its a test
+    Node<TYPE> node;
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(HotPathAllocationTest, iox2_testing::ServiceTypes, );
+
+TYPED_TEST(HotPathAllocationTest, allocation_tracker_detects_allocations) {
+    if (!iox2_testing::AllocationTracker::is_supported()) {
+        GTEST_SKIP() << "allocation tracking is not supported on this platform";
+    }
+
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    {
+        const iox2_testing::AllocationScope scope;
+        // the volatile pointer prevents the compiler from eliding the allocation
+        // NOLINTBEGIN(cppcoreguidelines-owning-memory) the allocation is the purpose of the test
+        auto* volatile value = new uint64_t(0);
+        delete value;
+        // NOLINTEND(cppcoreguidelines-owning-memory)
+        allocations = iox2_testing::AllocationTracker::allocations();
+        deallocations = iox2_testing::AllocationTracker::deallocations();
+    }
+
+    ASSERT_THAT(allocations, Eq(1));
+    ASSERT_THAT(deallocations, Eq(1));
+}
+
+TYPED_TEST(HotPathAllocationTest, loan_send_receive_and_release_do_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name())
+                       .template publish_subscribe<uint64_t>()
+                       .create()
+                       .value();
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    auto cycle = [&](uint64_t value) {
+        auto sample = publisher.loan_uninit().value();
+        send(sample.write_payload(value)).value();
+        auto received = subscriber.receive().value();
+        return received.has_value() && received->payload() == value;
+    };
+    ASSERT_TRUE(cycle(0));
+
+    bool all_received = true;
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { all_received &= cycle(i); });
+    ASSERT_TRUE(all_received);
+}
+
+TYPED_TEST(HotPathAllocationTest, loan_slice_send_receive_and_release_do_not_allocate) {
+    constexpr uint64_t NUMBER_OF_ELEMENTS = 8;
+    auto service = this->node.service_builder(iox2_testing::generate_service_name())
+                       .template publish_subscribe<bb::Slice<uint64_t>>()
+                       .create()
+                       .value();
+    auto publisher = service.publisher_builder().initial_max_slice_len(NUMBER_OF_ELEMENTS).create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    auto cycle = [&](uint64_t value) {
+        auto sample = publisher.loan_slice_uninit(NUMBER_OF_ELEMENTS).value();
+        send(sample.write_from_fn([&](uint64_t) { return value; })).value();
+        auto received = subscriber.receive().value();
+        return received.has_value() && received->payload().number_of_elements() == NUMBER_OF_ELEMENTS;
+    };
+    ASSERT_TRUE(cycle(0));
+
+    bool all_received = true;
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { all_received &= cycle(i); });
+    ASSERT_TRUE(all_received);
+}
+
+TYPED_TEST(HotPathAllocationTest, send_copy_does_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name())
+                       .template publish_subscribe<uint64_t>()
+                       .create()
+                       .value();
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    auto cycle = [&](uint64_t value) {
+        publisher.send_copy(value).value();
+        return subscriber.receive().value().has_value();
+    };
+    ASSERT_TRUE(cycle(0));
+
+    bool all_received = true;
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { all_received &= cycle(i); });
+    ASSERT_TRUE(all_received);
+}
+
+TYPED_TEST(HotPathAllocationTest, sample_header_accessors_do_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name())
+                       .template publish_subscribe<uint64_t>()
+                       .template user_header<uint64_t>()
+                       .create()
+                       .value();
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    publisher.send_copy(0).value();
+    auto sample = subscriber.receive().value();
+    ASSERT_TRUE(sample.has_value());
+
+    uint64_t number_of_elements = 0;
+    EXPECT_NO_ALLOCATIONS({
+        number_of_elements += sample->header().number_of_elements();
+        number_of_elements += sample->header_view().number_of_elements();
+        number_of_elements += sample->user_header();
+        number_of_elements += sample->payload();
+    });
+    ASSERT_THAT(number_of_elements, Eq(2));
+}
+
+TYPED_TEST(HotPathAllocationTest, notify_and_listener_try_wait_do_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name()).event().create().value();
+    auto notifier = service.notifier_builder().create().value();
+    auto listener = service.listener_builder().create().value();
+
+    uint64_t number_of_activations = 0;
+    auto cycle = [&] {
+        notifier.notify_with_custom_event_id(EventId(1)).value();
+        listener.try_wait([&](auto) { ++number_of_activations; }).value();
+    };
+    cycle();
+
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { cycle(); });
+    ASSERT_THAT(number_of_activations, Eq(NUMBER_OF_CYCLES));
+}
+
+TYPED_TEST(HotPathAllocationTest, listener_try_wait_into_slice_does_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name()).event().create().value();
+    auto notifier = service.notifier_builder().create().value();
+    auto listener = service.listener_builder().create().value();
+
+    std::array<uint64_t, 4> activated_ids {};
+    uint64_t number_of_activations = 0;
+    auto cycle = [&] {
+        notifier.notify_with_custom_event_id(EventId(2)).value();
+        number_of_activations +=
+            listener.try_wait(bb::MutableSlice<uint64_t>(activated_ids.data(), activated_ids.size())).value();
+    };
+    cycle();
+
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { cycle(); });
+    ASSERT_THAT(number_of_activations, Eq(NUMBER_OF_CYCLES));
+}
+
+TYPED_TEST(HotPathAllocationTest, waitset_batch_dispatch_does_not_allocate) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    auto service = this->node.service_builder(iox2_testing::generate_service_name()).event().create().value();
+    auto notifier = service.notifier_builder().create().value();
+    auto listener = service.listener_builder().create().value();
+    auto waitset = WaitSetBuilder().create<SERVICE_TYPE>().value();
+    auto guard = waitset.attach_notification(listener).value();
+
+    uint64_t number_of_events = 0;
+    auto cycle = [&] {
+        notifier.notify().value();
+        waitset
+            .wait_and_process_batch_once([&](const WaitSetAttachmentIdBatch<SERVICE_TYPE>& batch) {
+                if (batch.contains_event_from(guard)) {
+                    listener.try_wait([](auto) { }).value();
+                    ++number_of_events;
+                }
+                return CallbackProgression::Continue;
+            })
+            .value();
+    };
+    cycle();
+
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { cycle(); });
+    ASSERT_THAT(number_of_events, Eq(NUMBER_OF_CYCLES));
+}
+
+TYPED_TEST(HotPathAllocationTest, blackboard_update_with_copy_and_get_do_not_allocate) {
+    auto service = this->node.service_builder(iox2_testing::generate_service_name())
+                       .template blackboard_creator<uint64_t>()
+                       .template add_with_default<uint64_t>(0)
+                       .create()
+                       .value();
+    auto writer = service.writer_builder().create().value();
+    auto reader = service.reader_builder().create().value();
+    auto entry_handle_mut = writer.template entry<uint64_t>(0).value();
+    auto entry_handle = reader.template entry<uint64_t>(0).value();
+
+    uint64_t last_value = 0;
+    auto cycle = [&](uint64_t value) {
+        entry_handle_mut.update_with_copy(value);
+        last_value = *entry_handle.get();
+    };
+    cycle(0);
+
+    EXPECT_NO_ALLOCATIONS(for (uint64_t i = 1; i < NUMBER_OF_CYCLES; ++i) { cycle(i); });
+    ASSERT_THAT(last_value, Eq(NUMBER_OF_CYCLES - 1));
+}
+} // namespace
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#include "iox2/bb/static_vector.hpp"
+#include "iox2/node.hpp"
+#include "iox2/pending_response.hpp"
+#include "iox2/server_dispatcher.hpp"
+#include "iox2/service.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace {
+using namespace iox2;
+
+constexpr uint64_t TIMEOUT_IN_MILLISECONDS = 5000;
+
+template <typename T>
+class ServerDispatcherTest : public ::testing::Test {
+  public:
+    static constexpr ServiceType TYPE = T::TYPE;
+};
+
+TYPED_TEST_SUITE(ServerDispatcherTest, iox2_testing::ServiceTypes, );
+
+TYPED_TEST(ServerDispatcherTest, creating_with_invalid_number_of_workers_fails) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service =
+        node.service_builder(service_name).template request_response<uint64_t, uint64_t>().create().value();
+
+    auto sut = ServerDispatcherBuilder().number_of_workers(0).create(
+        service.server_builder().create().value(), [](auto&&) {});
+    ASSERT_FALSE(sut.has_value());
+    ASSERT_THAT(sut.error(), Eq(ServerDispatcherCreateError::InvalidNumberOfWorkers));
+}
+
+TYPED_TEST(ServerDispatcherTest, all_requests_are_processed_by_the_workers) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_REQUESTS = 16;
+    constexpr uint64_t NUMBER_OF_WORKERS = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .max_active_requests_per_client(NUMBER_OF_REQUESTS)
+                       .create()
+                       .value();
+
+    auto client = service.client_builder().create().value();
+    std::atomic<uint64_t> number_of_handled_requests { 0 };
+    auto sut = ServerDispatcherBuilder()
+                   .number_of_workers(NUMBER_OF_WORKERS)
+                   .create(service.server_builder().create().value(),
+                           [&](ActiveRequest<SERVICE_TYPE, uint64_t, void, uint64_t, void>&& active_request) {
+                               ASSERT_TRUE(active_request.send_copy(active_request.payload() * 2).has_value());
+                               number_of_handled_requests.fetch_add(1);
+                           })
+                   .value();
+    ASSERT_THAT(sut.number_of_workers(), Eq(NUMBER_OF_WORKERS));
+
+    bb::StaticVector<PendingResponse<SERVICE_TYPE, uint64_t, void, uint64_t, void>, NUMBER_OF_REQUESTS>
+        pending_responses;
+    for (uint64_t idx = 0; idx < NUMBER_OF_REQUESTS; ++idx) {
+        ASSERT_TRUE(pending_responses.try_push_back(client.send_copy(idx).value()));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(TIMEOUT_IN_MILLISECONDS);
+    while (number_of_handled_requests.load() < NUMBER_OF_REQUESTS && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    ASSERT_THAT(number_of_handled_requests.load(), Eq(NUMBER_OF_REQUESTS));
+    ASSERT_THAT(sut.number_of_dispatched_requests(), Eq(NUMBER_OF_REQUESTS));
+    ASSERT_TRUE(sut.is_dispatching());
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_REQUESTS; ++idx) {
+        auto response = pending_responses.unchecked_access()[idx].receive().value();
+        ASSERT_TRUE(response.has_value());
+        ASSERT_THAT(response->payload(), Eq(idx * 2));
+    }
+}
+} // namespace
@@ -11,7 +11,9 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/slice.hpp"
 #include "iox2/bb/static_string.hpp"
+#include "iox2/entry_handle_group.hpp"
 #include "iox2/entry_handle_mut.hpp"
 #include "iox2/entry_value_uninit.hpp"
 #include "iox2/node.hpp"
@@ -23,6 +25,7 @@
 #include "iox2/type_variant.hpp"
 #include "iox2/writer_error.hpp"
 #include "test.hpp"
+#include <array>
 #include <cstdint>
 
 namespace {
@@ -1615,6 +1618,121 @@ TYPED_TEST(ServiceBlackboardTest, entry_handle_is_up_to_date_works_correctly) {
     ASSERT_TRUE(entry_handle.is_up_to_date(value));
 }
 
+TYPED_TEST(ServiceBlackboardTest, entry_handle_read_references_latest_value) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template blackboard_creator<uint64_t>()
+                       .template add<uint16_t>(0, 0)
+                       .create()
+                       .value();
+
+    auto reader = service.reader_builder().create().value();
+    auto entry_handle = reader.template entry<uint16_t>(0).value();
+    auto writer = service.writer_builder().create().value();
+    auto entry_handle_mut = writer.template entry<uint16_t>(0).value();
+
+    auto value = entry_handle.read();
+    ASSERT_EQ(*value, 0);
+    ASSERT_TRUE(value.is_consistent());
+
+    entry_handle_mut.update_with_copy(1);
+    ASSERT_FALSE(value.is_consistent());
+
+    value = entry_handle.read();
+    ASSERT_EQ(*value, 1);
+    ASSERT_TRUE(value.is_consistent());
+}
+
+TYPED_TEST(ServiceBlackboardTest, entry_handle_read_with_returns_result_of_callback) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    struct Calibration {
+        uint64_t offset;
+        uint64_t gain;
+    };
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template blackboard_creator<uint64_t>()
+                       .template add<Calibration>(0, Calibration { 1, 2 })
+                       .create()
+                       .value();
+
+    auto reader = service.reader_builder().create().value();
+    auto entry_handle = reader.template entry<Calibration>(0).value();
+    auto writer = service.writer_builder().create().value();
+    auto entry_handle_mut = writer.template entry<Calibration>(0).value();
+
+    auto gain = [](const Calibration& calibration) -> auto { return calibration.gain; };
+    ASSERT_EQ(entry_handle.read_with(gain), 2);
+
+    entry_handle_mut.update_with_copy(Calibration { 3, 4 });
+    ASSERT_EQ(entry_handle.read_with(gain), 4);
+}
+
+TYPED_TEST(ServiceBlackboardTest, entry_handle_group_copies_only_changed_values) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t CAPACITY = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template blackboard_creator<uint64_t>()
+                       .template add<uint32_t>(0, 10)
+                       .template add<uint32_t>(1, 11)
+                       .create()
+                       .value();
+
+    auto reader = service.reader_builder().create().value();
+    auto writer = service.writer_builder().create().value();
+    auto entry_handle_mut = writer.template entry<uint32_t>(1).value();
+
+    EntryHandleGroup<SERVICE_TYPE, uint64_t, uint32_t, CAPACITY> sut;
+    ASSERT_TRUE(sut.add(reader.template entry<uint32_t>(0).value()));
+    ASSERT_TRUE(sut.add(reader.template entry<uint32_t>(1).value()));
+    ASSERT_EQ(sut.size(), 2);
+
+    std::array<uint32_t, CAPACITY> values {};
+    ASSERT_EQ(sut.update(bb::MutableSlice<uint32_t>(values.data(), values.size())), 2);
+    ASSERT_EQ(values[0], 10);
+    ASSERT_EQ(values[1], 11);
+    ASSERT_TRUE(sut.has_changed(0));
+    ASSERT_TRUE(sut.has_changed(1));
+
+    ASSERT_EQ(sut.update(bb::MutableSlice<uint32_t>(values.data(), values.size())), 0);
+    ASSERT_FALSE(sut.has_changed(0));
+    ASSERT_FALSE(sut.has_changed(1));
+
+    entry_handle_mut.update_with_copy(21);
+    ASSERT_EQ(sut.update(bb::MutableSlice<uint32_t>(values.data(), values.size())), 1);
+    ASSERT_EQ(values[1], 21);
+    ASSERT_FALSE(sut.has_changed(0));
+    ASSERT_TRUE(sut.has_changed(1));
+}
+
+TYPED_TEST(ServiceBlackboardTest, entry_handle_group_add_fails_when_full) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template blackboard_creator<uint64_t>()
+                       .template add<uint32_t>(0, 0)
+                       .create()
+                       .value();
+
+    auto reader = service.reader_builder().create().value();
+
+    EntryHandleGroup<SERVICE_TYPE, uint64_t, uint32_t, 1> sut;
+    ASSERT_TRUE(sut.add(reader.template entry<uint32_t>(0).value()));
+    ASSERT_FALSE(sut.add(reader.template entry<uint32_t>(0).value()));
+    ASSERT_EQ(sut.size(), 1);
+}
+
 TYPED_TEST(ServiceBlackboardTest, list_keys_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
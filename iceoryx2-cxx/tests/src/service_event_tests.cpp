@@ -17,9 +17,12 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <gtest/gtest.h>
+#include <vector>
 
 namespace {
 using namespace iox2;
@@ -288,6 +291,49 @@ TYPED_TEST(ServiceEventTest, notification_with_custom_event_id_is_received_with_
     ASSERT_THAT(number_of_notifications, Eq(1));
 }
 
+TYPED_TEST(ServiceEventTest, notification_with_multiple_event_ids_is_received) {
+    const std::array<EventId, 2> event_ids { this->event_id_1, this->event_id_2 };
+    auto number_of_notified_listeners =
+        this->notifier.notify_multiple(bb::ImmutableSlice<EventId>(event_ids.data(), event_ids.size())).value();
+    ASSERT_THAT(number_of_notified_listeners, Eq(1));
+
+    std::vector<EventId> received_ids;
+    this->listener.try_wait([&](auto event) -> void { received_ids.push_back(event.id()); }).value();
+    ASSERT_THAT(received_ids.size(), Eq(2));
+    ASSERT_TRUE(std::find(received_ids.begin(), received_ids.end(), this->event_id_1) != received_ids.end());
+    ASSERT_TRUE(std::find(received_ids.begin(), received_ids.end(), this->event_id_2) != received_ids.end());
+}
+
+TYPED_TEST(ServiceEventTest, notifications_are_collected_in_bitset_with_try_wait) {
+    constexpr uint64_t NUMBER_OF_WORDS = 2;
+    const EventId low_event_id { 3 };
+    const EventId high_event_id { 70 };
+    this->notifier.notify_with_custom_event_id(low_event_id).value();
+    this->notifier.notify_with_custom_event_id(high_event_id).value();
+
+    std::array<uint64_t, NUMBER_OF_WORDS> activated_ids {};
+    auto number_of_notifications =
+        this->listener.try_wait(bb::MutableSlice<uint64_t>(activated_ids.data(), activated_ids.size())).value();
+
+    ASSERT_THAT(number_of_notifications, Eq(2));
+    ASSERT_THAT(activated_ids[0], Eq(uint64_t { 1 } << 3U));
+    ASSERT_THAT(activated_ids[1], Eq(uint64_t { 1 } << 6U));
+}
+
+TYPED_TEST(ServiceEventTest, notification_is_collected_in_bitset_with_timed_wait) {
+    constexpr uint64_t NUMBER_OF_WORDS = 1;
+    const EventId event_id { 5 };
+    this->notifier.notify_with_custom_event_id(event_id).value();
+
+    std::array<uint64_t, NUMBER_OF_WORDS> activated_ids {};
+    auto number_of_notifications =
+        this->listener.timed_wait(bb::MutableSlice<uint64_t>(activated_ids.data(), activated_ids.size()), TIMEOUT)
+            .value();
+
+    ASSERT_THAT(number_of_notifications, Eq(1));
+    ASSERT_THAT(activated_ids[0], Eq(uint64_t { 1 } << 5U));
+}
+
 TYPED_TEST(ServiceEventTest, notification_is_received_with_timed_wait) {
     this->notifier.notify_with_custom_event_id(this->event_id_1).value();
 
@@ -11,12 +11,14 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_vector.hpp"
 #include "iox2/custom_header_marker.hpp"
 #include "iox2/custom_payload_marker.hpp"
 #include "iox2/legacy/uninitialized_array.hpp"
 #include "iox2/message_type_details.hpp"
 #include "iox2/node.hpp"
 #include "iox2/service.hpp"
+#include "iox2/subscriber_set.hpp"
 #include "iox2/type_variant.hpp"
 
 #include "test.hpp"
@@ -534,6 +536,41 @@ TYPED_TEST(ServicePublishSubscribeTest, write_from_fn_send_receive_works) {
     ASSERT_THAT(iterations, Eq(SLICE_MAX_LENGTH));
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, write_from_block_fn_send_receive_works) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t SLICE_MAX_LENGTH = 10;
+    constexpr uint64_t BLOCK_SIZE = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<bb::Slice<uint64_t>>().create().value();
+
+    auto sut_publisher = service.publisher_builder().initial_max_slice_len(SLICE_MAX_LENGTH).create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    auto number_of_blocks = 0U;
+    auto sample_uninit = sut_publisher.loan_slice_uninit(SLICE_MAX_LENGTH).value();
+    auto send_sample = sample_uninit.write_from_block_fn(BLOCK_SIZE, [&](auto block, auto offset) {
+        ASSERT_THAT(block.number_of_elements(), Le(BLOCK_SIZE));
+        for (uint64_t i = 0; i < block.number_of_elements(); ++i) {
+            new (&block[i]) uint64_t(offset + i);
+        }
+        ++number_of_blocks;
+    });
+    send(std::move(send_sample)).value();
+    ASSERT_THAT(number_of_blocks, Eq(3U));
+
+    auto recv_result = sut_subscriber.receive().value();
+    ASSERT_TRUE(recv_result.has_value());
+    auto recv_sample = std::move(recv_result.value());
+
+    ASSERT_THAT(recv_sample.payload().number_of_elements(), Eq(SLICE_MAX_LENGTH));
+    for (uint64_t i = 0; i < SLICE_MAX_LENGTH; ++i) {
+        ASSERT_THAT(recv_sample.payload()[i], Eq(i));
+    }
+}
+
 // NOLINTBEGIN(readability-function-cognitive-complexity)
 TYPED_TEST(ServicePublishSubscribeTest, write_from_slice_send_receive_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
@@ -925,6 +962,371 @@ TYPED_TEST(ServicePublishSubscribeTest, has_sample_works) {
     ASSERT_FALSE(*sut_subscriber.has_samples());
 }
 
+TYPED_TEST(ServicePublishSubscribeTest, subscriber_set_reports_subscribers_with_samples) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t CAPACITY = 70;
+
+    const auto service_name_1 = iox2_testing::generate_service_name();
+    const auto service_name_2 = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service_1 = node.service_builder(service_name_1).template publish_subscribe<uint64_t>().create().value();
+    auto service_2 = node.service_builder(service_name_2).template publish_subscribe<uint32_t>().create().value();
+
+    auto publisher_1 = service_1.publisher_builder().create().value();
+    auto publisher_2 = service_2.publisher_builder().create().value();
+    auto subscriber_1 = service_1.subscriber_builder().create().value();
+    auto subscriber_2 = service_2.subscriber_builder().create().value();
+
+    SubscriberSet<SERVICE_TYPE, CAPACITY> sut;
+    ASSERT_TRUE(sut.add(subscriber_1));
+    ASSERT_TRUE(sut.add(subscriber_2));
+    ASSERT_EQ(sut.size(), 2);
+
+    ASSERT_EQ(*sut.ready(), 0);
+    ASSERT_FALSE(sut.is_ready(0));
+    ASSERT_FALSE(sut.is_ready(1));
+
+    publisher_2.send_copy(12).value();
+    ASSERT_EQ(*sut.ready(), 1);
+    ASSERT_FALSE(sut.is_ready(0));
+    ASSERT_TRUE(sut.is_ready(1));
+
+    publisher_1.send_copy(34).value();
+    ASSERT_EQ(*sut.ready(), 2);
+    ASSERT_TRUE(sut.is_ready(0));
+    ASSERT_TRUE(sut.is_ready(1));
+
+    auto sample = subscriber_2.receive().value();
+    ASSERT_EQ(*sut.ready(), 1);
+    ASSERT_TRUE(sut.is_ready(0));
+    ASSERT_FALSE(sut.is_ready(1));
+    ASSERT_FALSE(sut.is_ready(2));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, subscriber_set_add_fails_when_full) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    SubscriberSet<SERVICE_TYPE, 1> sut;
+    ASSERT_TRUE(sut.add(subscriber));
+    ASSERT_FALSE(sut.add(subscriber));
+    ASSERT_EQ(sut.size(), 1);
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_batch_delivers_all_samples_in_order) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 5;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .create()
+                       .value();
+
+    auto sut_publisher = service.publisher_builder().max_loaned_samples(NUMBER_OF_SAMPLES).create().value();
+    auto sut_subscriber = service.subscriber_builder().buffer_size(NUMBER_OF_SAMPLES).create().value();
+
+    bb::StaticVector<SampleMut<SERVICE_TYPE, uint64_t, void>, NUMBER_OF_SAMPLES> samples;
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        auto sample = sut_publisher.loan().value();
+        sample.payload_mut() = idx;
+        ASSERT_TRUE(samples.try_push_back(std::move(sample)));
+    }
+
+    auto number_of_recipients = sut_publisher.send_batch(std::move(samples));
+    ASSERT_THAT(number_of_recipients.has_value(), Eq(true));
+    ASSERT_THAT(number_of_recipients.value(), Eq(NUMBER_OF_SAMPLES));
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        auto sample = sut_subscriber.receive().value();
+        ASSERT_TRUE(sample.has_value());
+        ASSERT_THAT(sample->payload(), Eq(idx));
+    }
+    ASSERT_FALSE(*sut_subscriber.has_samples());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_batch_returns_loans_to_publisher) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t MAX_LOANED_SAMPLES = 2;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().max_loaned_samples(MAX_LOANED_SAMPLES).create().value();
+
+    bb::StaticVector<SampleMut<SERVICE_TYPE, uint64_t, void>, MAX_LOANED_SAMPLES> samples;
+    for (uint64_t idx = 0; idx < MAX_LOANED_SAMPLES; ++idx) {
+        ASSERT_TRUE(samples.try_push_back(sut_publisher.loan().value()));
+    }
+    ASSERT_FALSE(sut_publisher.loan().has_value());
+
+    ASSERT_TRUE(sut_publisher.send_batch(std::move(samples)).has_value());
+
+    auto sample = sut_publisher.loan();
+    ASSERT_TRUE(sample.has_value());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_copy_with_non_temporal_copy_strategy_works) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_ELEMENTS = 67;
+    using Frame = std::array<uint64_t, NUMBER_OF_ELEMENTS>;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<Frame>().create().value();
+
+    auto sut_publisher = service.publisher_builder().copy_strategy(CopyStrategy::NonTemporal).create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    Frame frame {};
+    for (uint64_t idx = 0; idx < NUMBER_OF_ELEMENTS; ++idx) {
+        frame.at(idx) = (3 * idx) + 11;
+    }
+
+    ASSERT_TRUE(sut_publisher.send_copy(frame).has_value());
+
+    auto sample = sut_subscriber.receive().value();
+    ASSERT_TRUE(sample.has_value());
+    ASSERT_THAT(sample->payload(), Eq(frame));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_copy_with_prefaulted_publisher_works) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 8912;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().prefault(true).create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    ASSERT_TRUE(sut_publisher.send_copy(PAYLOAD).has_value());
+
+    auto sample = sut_subscriber.receive().value();
+    ASSERT_TRUE(sample.has_value());
+    ASSERT_THAT(sample->payload(), Eq(PAYLOAD));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, receive_all_delivers_all_samples_in_order) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 7;
+    constexpr uint64_t BATCH_SIZE = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template publish_subscribe<uint64_t>()
+                       .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+                       .subscriber_max_borrowed_samples(NUMBER_OF_SAMPLES)
+                       .create()
+                       .value();
+
+    auto sut_publisher = service.publisher_builder().create().value();
+    auto sut_subscriber = service.subscriber_builder().buffer_size(NUMBER_OF_SAMPLES).create().value();
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        sut_publisher.send_copy(idx).value();
+    }
+
+    uint64_t expected_payload = 0;
+    auto number_of_samples = sut_subscriber.template receive_all<BATCH_SIZE>([&](auto&& sample) -> auto {
+        EXPECT_THAT(sample.payload(), Eq(expected_payload));
+        expected_payload++;
+    });
+
+    ASSERT_THAT(number_of_samples.has_value(), Eq(true));
+    ASSERT_THAT(number_of_samples.value(), Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(expected_payload, Eq(NUMBER_OF_SAMPLES));
+    ASSERT_FALSE(*sut_subscriber.has_samples());
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, receive_all_with_no_samples_returns_zero) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    auto callback_was_called = false;
+    auto number_of_samples = sut_subscriber.receive_all([&](auto&&) -> auto { callback_was_called = true; });
+
+    ASSERT_THAT(number_of_samples.has_value(), Eq(true));
+    ASSERT_THAT(number_of_samples.value(), Eq(0));
+    ASSERT_FALSE(callback_was_called);
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, payload_of_moved_sample_refers_to_same_memory) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 7781;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    auto sample_uninit = sut_publisher.loan_uninit().value();
+    auto sample = sample_uninit.write_payload(PAYLOAD);
+    const auto* loaned_payload = &sample.payload();
+
+    auto moved_sample = std::move(sample);
+    ASSERT_THAT(&moved_sample.payload(), Eq(loaned_payload));
+    ASSERT_TRUE(send(std::move(moved_sample)).has_value());
+
+    auto recv_sample = sut_subscriber.receive().value();
+    ASSERT_TRUE(recv_sample.has_value());
+    const auto* received_payload = &recv_sample->payload();
+    ASSERT_THAT(*received_payload, Eq(PAYLOAD));
+
+    auto moved_recv_sample = std::move(recv_sample.value());
+    ASSERT_THAT(&moved_recv_sample.payload(), Eq(received_payload));
+    ASSERT_THAT(moved_recv_sample.payload(), Eq(PAYLOAD));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, header_view_matches_header) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 1829;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    ASSERT_TRUE(sut_publisher.send_copy(PAYLOAD).has_value());
+
+    auto sample = sut_subscriber.receive().value();
+    ASSERT_TRUE(sample.has_value());
+
+    auto view = sample->header_view();
+    ASSERT_THAT(view.publisher_id(), Eq(sut_publisher.id().bytes().value()));
+    ASSERT_THAT(view.number_of_elements(), Eq(sample->header().number_of_elements()));
+    ASSERT_THAT(sample->origin_bytes(), Eq(sample->origin().bytes().value()));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, send_timestamps_are_only_set_when_enabled) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t PAYLOAD = 7712;
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service_without = node.service_builder(iox2_testing::generate_service_name())
+                               .template publish_subscribe<uint64_t>()
+                               .create()
+                               .value();
+    auto service_with = node.service_builder(iox2_testing::generate_service_name())
+                            .template publish_subscribe<uint64_t>()
+                            .enable_send_timestamps(true)
+                            .create()
+                            .value();
+
+    ASSERT_FALSE(service_without.static_config().has_send_timestamps());
+    ASSERT_TRUE(service_with.static_config().has_send_timestamps());
+
+    auto publisher_without = service_without.publisher_builder().create().value();
+    auto subscriber_without = service_without.subscriber_builder().create().value();
+    auto publisher_with = service_with.publisher_builder().create().value();
+    auto subscriber_with = service_with.subscriber_builder().create().value();
+
+    ASSERT_TRUE(publisher_without.send_copy(PAYLOAD).has_value());
+    ASSERT_TRUE(publisher_with.send_copy(PAYLOAD).has_value());
+
+    auto sample_without = subscriber_without.receive().value();
+    ASSERT_TRUE(sample_without.has_value());
+    ASSERT_FALSE(sample_without->header().send_timestamp().has_value());
+    ASSERT_FALSE(sample_without->header_view().send_timestamp().has_value());
+
+    auto sample_with = subscriber_with.receive().value();
+    ASSERT_TRUE(sample_with.has_value());
+    auto timestamp = sample_with->header().send_timestamp();
+    ASSERT_TRUE(timestamp.has_value());
+    ASSERT_THAT(sample_with->header_view().send_timestamp().value(), Eq(timestamp.value()));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, samples_with_higher_priority_are_received_first) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_PRIORITY_LANES = 2;
+    constexpr uint64_t ROUTINE_PAYLOAD = 12;
+    constexpr uint64_t URGENT_PAYLOAD = 911;
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(iox2_testing::generate_service_name())
+                       .template publish_subscribe<uint64_t>()
+                       .priority_lanes(NUMBER_OF_PRIORITY_LANES)
+                       .create()
+                       .value();
+    ASSERT_THAT(service.static_config().number_of_priority_lanes(), Eq(NUMBER_OF_PRIORITY_LANES));
+
+    auto publisher = service.publisher_builder().create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+
+    ASSERT_TRUE(publisher.send_copy(ROUTINE_PAYLOAD).has_value());
+    auto sample_uninit = publisher.loan_uninit().value();
+    sample_uninit.set_priority(1);
+    auto sample = sample_uninit.write_payload(URGENT_PAYLOAD);
+    send(std::move(sample)).value();
+
+    auto urgent = subscriber.receive().value();
+    ASSERT_TRUE(urgent.has_value());
+    ASSERT_THAT(urgent->payload(), Eq(URGENT_PAYLOAD));
+    ASSERT_THAT(urgent->header().priority(), Eq(1));
+
+    auto routine = subscriber.receive().value();
+    ASSERT_TRUE(routine.has_value());
+    ASSERT_THAT(routine->payload(), Eq(ROUTINE_PAYLOAD));
+    ASSERT_THAT(routine->header().priority(), Eq(0));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, samples_moved_out_of_receive_all_stay_valid) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 2;
+    constexpr uint64_t PAYLOAD_OFFSET = 8912;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    for (uint64_t idx = 0; idx < NUMBER_OF_SAMPLES; ++idx) {
+        sut_publisher.send_copy(PAYLOAD_OFFSET + idx).value();
+    }
+
+    bb::Optional<Sample<SERVICE_TYPE, uint64_t, void>> kept_sample;
+    auto number_of_samples = sut_subscriber.receive_all([&](auto&& sample) -> auto {
+        if (!kept_sample.has_value()) {
+            kept_sample.emplace(std::move(sample));
+        }
+    });
+
+    ASSERT_THAT(number_of_samples.value(), Eq(NUMBER_OF_SAMPLES));
+    ASSERT_TRUE(kept_sample.has_value());
+    ASSERT_THAT(kept_sample->payload(), Eq(PAYLOAD_OFFSET));
+}
+
 TYPED_TEST(ServicePublishSubscribeTest, service_can_be_opened_when_there_is_a_publisher) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
     const uint64_t payload = 9871273;
@@ -1858,6 +2260,77 @@ TYPED_TEST(ServicePublishSubscribeTest, custom_header_payload_marker_send_receiv
         ASSERT_THAT(recv_header.at(i), Eq(static_cast<uint8_t>(HEADER_BASE_VALUE + i)));
     }
 }
+
+TYPED_TEST(ServicePublishSubscribeTest, custom_payload_marker_slice_covers_the_bytes_of_all_elements) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr const char* PAYLOAD_TYPE_NAME = "MyType";
+    constexpr uint64_t PAYLOAD_SIZE = 12;
+    constexpr uint64_t PAYLOAD_ALIGNMENT = 4;
+    constexpr uint64_t NUMBER_OF_ELEMENTS = 5;
+    constexpr uint64_t NUMBER_OF_BYTES = PAYLOAD_SIZE * NUMBER_OF_ELEMENTS;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service_builder =
+        node.service_builder(service_name).template publish_subscribe<bb::Slice<CustomPayloadMarker>>();
+    set_payload_type_details(service_builder,
+                             TypeDetail(TypeVariant::FixedSize, PAYLOAD_TYPE_NAME, PAYLOAD_SIZE, PAYLOAD_ALIGNMENT));
+    auto service = service_builder.resume_build().create().value();
+
+    auto publisher = service.publisher_builder().initial_max_slice_len(NUMBER_OF_ELEMENTS).create().value();
+    auto subscriber = service.subscriber_builder().create().value();
+    auto sut_publisher = std::move(publisher);
+    auto sut_subscriber = std::move(subscriber);
+
+    for (uint64_t n = 0; n < 2; ++n) {
+        auto send_sample = sut_publisher.loan_slice_uninit(NUMBER_OF_ELEMENTS).value();
+        auto send_payload = send_sample.payload_mut();
+        ASSERT_THAT(send_payload.number_of_bytes(), Eq(NUMBER_OF_BYTES));
+        for (uint64_t i = 0; i < NUMBER_OF_BYTES; ++i) {
+            send_payload[i].value = static_cast<uint8_t>(i + n);
+        }
+        send(assume_init(std::move(send_sample))).value();
+    }
+
+    auto recv_sample = sut_subscriber.receive().value();
+    ASSERT_TRUE(recv_sample.has_value());
+    auto recv_payload = recv_sample->payload();
+    ASSERT_THAT(recv_payload.number_of_bytes(), Eq(NUMBER_OF_BYTES));
+    for (uint64_t i = 0; i < NUMBER_OF_BYTES; ++i) {
+        ASSERT_THAT(recv_payload[i].value, Eq(static_cast<uint8_t>(i)));
+    }
+
+    uint64_t number_of_bytes = 0;
+    auto number_of_samples = sut_subscriber.receive_all(
+        [&](auto&& sample) -> auto { number_of_bytes = sample.payload().number_of_bytes(); });
+    ASSERT_THAT(number_of_samples.value(), Eq(1));
+    ASSERT_THAT(number_of_bytes, Eq(NUMBER_OF_BYTES));
+}
+
+TYPED_TEST(ServicePublishSubscribeTest, port_statistics_count_sent_and_received_samples) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_SAMPLES = 2;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name).template publish_subscribe<uint64_t>().create().value();
+
+    auto sut_publisher = service.publisher_builder().create().value();
+    auto sut_subscriber = service.subscriber_builder().create().value();
+
+    for (uint64_t n = 0; n < NUMBER_OF_SAMPLES; ++n) {
+        sut_publisher.send_copy(n).value();
+    }
+    while (sut_subscriber.receive().value().has_value()) { }
+
+    ASSERT_THAT(sut_publisher.statistics().sent, Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(sut_publisher.statistics().failed_loans, Eq(0));
+    ASSERT_THAT(sut_subscriber.statistics().received, Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(service.dynamic_config().publisher_statistics().sent, Eq(NUMBER_OF_SAMPLES));
+    ASSERT_THAT(service.dynamic_config().subscriber_statistics().received, Eq(NUMBER_OF_SAMPLES));
+}
 // NOLINTEND(readability-function-cognitive-complexity)
 
 } // namespace
@@ -11,6 +11,7 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 #include "iox2/bb/optional.hpp"
+#include "iox2/bb/static_vector.hpp"
 #include "iox2/client_error.hpp"
 #include "iox2/custom_header_marker.hpp"
 #include "iox2/custom_payload_marker.hpp"
@@ -349,6 +350,46 @@ TYPED_TEST(ServiceRequestResponseTest, loan_uninit_write_payload_send_receive_wo
     EXPECT_THAT(received_response->payload(), Eq(response_payload));
 }
 
+TYPED_TEST(ServiceRequestResponseTest, send_batch_and_receive_all_responses_works) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_RESPONSES = 5;
+    constexpr uint64_t BATCH_SIZE = 2;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .max_response_buffer_size(NUMBER_OF_RESPONSES)
+                       .create()
+                       .value();
+
+    auto sut_client = service.client_builder().create().value();
+    auto sut_server = service.server_builder().max_loaned_responses_per_request(NUMBER_OF_RESPONSES).create().value();
+
+    auto pending_response = sut_client.send_copy(0).value();
+    auto active_request = sut_server.receive().value();
+    ASSERT_TRUE(active_request.has_value());
+
+    bb::StaticVector<ResponseMut<SERVICE_TYPE, uint64_t, void>, NUMBER_OF_RESPONSES> responses;
+    for (uint64_t idx = 0; idx < NUMBER_OF_RESPONSES; ++idx) {
+        auto response = active_request->loan().value();
+        response.payload_mut() = idx;
+        ASSERT_TRUE(responses.try_push_back(std::move(response)));
+    }
+    ASSERT_TRUE(active_request->send_batch(std::move(responses)).has_value());
+
+    uint64_t expected_payload = 0;
+    auto number_of_responses =
+        pending_response.template receive_all<BATCH_SIZE>([&](Response<SERVICE_TYPE, uint64_t, void>&& response) {
+            EXPECT_THAT(response.payload(), Eq(expected_payload));
+            ++expected_payload;
+        });
+    ASSERT_TRUE(number_of_responses.has_value());
+    ASSERT_THAT(number_of_responses.value(), Eq(NUMBER_OF_RESPONSES));
+    ASSERT_FALSE(pending_response.has_response());
+}
+
 TYPED_TEST(ServiceRequestResponseTest, loan_send_receive_works) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
@@ -1265,6 +1306,95 @@ TYPED_TEST(ServiceRequestResponseTest, is_connected_works_for_active_request) {
     EXPECT_FALSE(active_request->is_connected());
 }
 
+TYPED_TEST(ServiceRequestResponseTest, send_and_forget_delivers_request_without_pending_response) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t MAX_ACTIVE_REQUESTS = 1;
+    constexpr uint64_t NUMBER_OF_REQUESTS = 3;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .enable_fire_and_forget_requests(true)
+                       .max_active_requests_per_client(MAX_ACTIVE_REQUESTS)
+                       .create()
+                       .value();
+
+    auto sut_client = service.client_builder().create().value();
+    auto sut_server = service.server_builder().create().value();
+
+    auto pending_response = sut_client.send_copy(0).value();
+
+    for (uint64_t value = 1; value <= NUMBER_OF_REQUESTS; ++value) {
+        auto request = sut_client.loan_uninit().value().write_payload(uint64_t { value });
+        auto number_of_recipients = send_and_forget(std::move(request));
+        ASSERT_TRUE(number_of_recipients.has_value());
+        EXPECT_THAT(number_of_recipients.value(), Eq(1));
+
+        auto active_request = sut_server.receive().value();
+        ASSERT_TRUE(active_request.has_value());
+        EXPECT_THAT(active_request->payload(), Eq(value));
+        EXPECT_FALSE(active_request->is_connected());
+    }
+}
+
+TYPED_TEST(ServiceRequestResponseTest, send_and_forget_fails_when_fire_and_forget_is_not_supported) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .enable_fire_and_forget_requests(false)
+                       .create()
+                       .value();
+
+    auto sut_client = service.client_builder().create().value();
+
+    auto request = sut_client.loan_uninit().value().write_payload(uint64_t { 3 });
+    auto result = send_and_forget(std::move(request));
+    ASSERT_FALSE(result.has_value());
+    EXPECT_THAT(result.error(), Eq(RequestSendError::FireAndForgetNotSupported));
+}
+
+TYPED_TEST(ServiceRequestResponseTest, round_robin_receive_policy_alternates_between_clients) {
+    constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
+    constexpr uint64_t NUMBER_OF_REQUESTS = 4;
+
+    const auto service_name = iox2_testing::generate_service_name();
+
+    auto node = NodeBuilder().create<SERVICE_TYPE>().value();
+    auto service = node.service_builder(service_name)
+                       .template request_response<uint64_t, uint64_t>()
+                       .max_active_requests_per_client(NUMBER_OF_REQUESTS)
+                       .max_clients(2)
+                       .create()
+                       .value();
+
+    auto sut_server = service.server_builder().receive_policy(ReceivePolicy::RoundRobin).create().value();
+    auto client_a = service.client_builder().create().value();
+    auto client_b = service.client_builder().create().value();
+
+    std::vector<PendingResponse<SERVICE_TYPE, uint64_t, void, uint64_t, void>> pending_responses;
+    for (uint64_t n = 0; n < NUMBER_OF_REQUESTS; ++n) {
+        pending_responses.emplace_back(client_a.send_copy(n).value());
+        pending_responses.emplace_back(client_b.send_copy(n).value());
+    }
+
+    std::vector<UniqueClientId> origins;
+    for (uint64_t n = 0; n < 2 * NUMBER_OF_REQUESTS; ++n) {
+        auto active_request = sut_server.receive().value();
+        ASSERT_TRUE(active_request.has_value());
+        origins.push_back(active_request->origin());
+    }
+
+    for (uint64_t n = 1; n < origins.size(); ++n) {
+        EXPECT_FALSE(origins[n - 1] == origins[n]);
+    }
+}
+
 TYPED_TEST(ServiceRequestResponseTest, is_connected_works_for_pending_response) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
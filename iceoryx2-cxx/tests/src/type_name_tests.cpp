@@ -112,6 +112,13 @@ TEST(GetTypeNameTest, get_type_name_for_slice_uses_custom_name_from_inner_type)
                  CUSTOM_TYPE_NAME);
 }
 
+TEST(GetTypeNameTest, get_type_name_constructs_type_name_only_once) {
+    const auto& first = iox2::internal::get_type_name<bb::StaticVector<uint64_t, 3>>();
+    const auto& second = iox2::internal::get_type_name<bb::StaticVector<uint64_t, 3>>();
+    ASSERT_EQ(&first, &second);
+    ASSERT_STREQ(first.unchecked_access().c_str(), "iceoryx2_bb_container::vector::static_vec::StaticVec<u64, 3>");
+}
+
 // BEGIN publish-subscribe service
 
 template <typename T>
@@ -26,6 +26,9 @@
 
 #include <gtest/gtest.h>
 
+#include <type_traits>
+#include <unordered_map>
+
 namespace {
 using namespace iox2;
 
@@ -157,4 +160,53 @@ TYPED_TEST(UniquePortIdTest, unique_port_id_identifies_origin) {
     ASSERT_TRUE(this->publisher_2.id() == recv_sample_2.header().publisher_id());
     ASSERT_TRUE(this->publisher_2.id() == recv_sample_2.origin());
 }
+
+TYPED_TEST(UniquePortIdTest, moved_unique_port_id_is_equal_to_its_origin) {
+    auto publisher_id = this->publisher_1.id();
+    auto moved_publisher_id = std::move(publisher_id);
+    ASSERT_TRUE(moved_publisher_id == this->publisher_1.id());
+
+    auto subscriber_id = this->subscriber_1.id();
+    auto other_subscriber_id = this->subscriber_2.id();
+    other_subscriber_id = std::move(subscriber_id);
+    ASSERT_TRUE(other_subscriber_id == this->subscriber_1.id());
+
+    auto sample = this->publisher_1.loan().value();
+    auto header = sample.header();
+    auto moved_header = std::move(header);
+    ASSERT_TRUE(moved_header.publisher_id() == this->publisher_1.id());
+}
+
+TYPED_TEST(UniquePortIdTest, unique_port_id_is_a_trivially_copyable_value) {
+    static_assert(std::is_trivially_copyable<UniquePublisherId>::value, "");
+    static_assert(std::is_trivially_copyable<UniqueSubscriberId>::value, "");
+    static_assert(sizeof(UniquePublisherId) == UNIQUE_PORT_ID_LENGTH, "");
+
+    auto publisher_id = this->publisher_1.id();
+    auto copied_publisher_id = publisher_id;
+    ASSERT_TRUE(copied_publisher_id == publisher_id);
+    ASSERT_TRUE(copied_publisher_id.bytes().value() == publisher_id.bytes().value());
+}
+
+TYPED_TEST(UniquePortIdTest, equal_unique_port_ids_have_the_same_hash) {
+    ASSERT_EQ(std::hash<UniquePublisherId>()(this->publisher_1.id()),
+              std::hash<UniquePublisherId>()(this->publisher_1.id()));
+    ASSERT_EQ(std::hash<UniqueListenerId>()(this->listener_1.id()),
+              std::hash<UniqueListenerId>()(this->listener_1.id()));
+    ASSERT_EQ(std::hash<UniqueReaderId>()(this->reader_1.id()), std::hash<UniqueReaderId>()(this->reader_1.id()));
+}
+
+TYPED_TEST(UniquePortIdTest, unique_port_id_can_be_used_as_hash_map_key) {
+    std::unordered_map<UniquePublisherId, int> sut;
+    sut.emplace(this->publisher_1.id(), 1);
+    sut.emplace(this->publisher_2.id(), 2);
+
+    auto sample = this->publisher_2.loan().value();
+    send(std::move(sample)).value();
+    auto recv_sample = this->subscriber_1.receive().value().value();
+
+    ASSERT_EQ(sut.size(), 2U);
+    ASSERT_EQ(sut.at(this->publisher_1.id()), 1);
+    ASSERT_EQ(sut.at(recv_sample.origin()), 2);
+}
 } // namespace
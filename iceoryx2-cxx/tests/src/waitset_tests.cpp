@@ -326,6 +326,53 @@ TYPED_TEST(WaitSetTest, triggering_everything_works) {
     }
 }
 
+TYPED_TEST(WaitSetTest, batch_processing_provides_all_events_in_one_call) {
+    auto sut = this->create_sut();
+    auto listener_1 = this->create_listener();
+    auto listener_2 = this->create_listener();
+    auto listener_3 = this->create_listener();
+
+    auto guard_1 = sut.attach_notification(listener_1).value();
+    auto guard_2 = sut.attach_notification(listener_2).value();
+    auto guard_3 = sut.attach_deadline(listener_3, Duration::from_hours(1)).value();
+
+    auto notifier = this->create_notifier();
+    notifier.notify().value();
+
+    uint64_t number_of_calls = 0;
+    auto result = sut.wait_and_process_batch_once([&](const auto& batch) -> CallbackProgression {
+        ++number_of_calls;
+        EXPECT_THAT(batch.size(), Eq(3));
+        EXPECT_THAT(batch.empty(), Eq(false));
+        EXPECT_THAT(batch.contains_event_from(guard_1), Eq(true));
+        EXPECT_THAT(batch.contains_event_from(guard_2), Eq(true));
+        EXPECT_THAT(batch.contains_event_from(guard_3), Eq(true));
+        EXPECT_THAT(batch.contains_missed_deadline(guard_3), Eq(false));
+        return CallbackProgression::Continue;
+    });
+
+    ASSERT_THAT(result.has_value(), Eq(true));
+    ASSERT_THAT(result.value(), Eq(WaitSetRunResult::AllEventsHandled));
+    ASSERT_THAT(number_of_calls, Eq(1));
+}
+
+TYPED_TEST(WaitSetTest, batch_processing_does_not_call_callback_on_timeout) {
+    auto sut = this->create_sut();
+    auto listener = this->create_listener();
+    auto guard = sut.attach_notification(listener).value();
+
+    auto callback_called = false;
+    auto result = sut.wait_and_process_batch_once_with_timeout(
+        [&](const auto&) -> CallbackProgression {
+            callback_called = true;
+            return CallbackProgression::Continue;
+        },
+        TIMEOUT);
+
+    ASSERT_THAT(result.has_value(), Eq(true));
+    ASSERT_THAT(callback_called, Eq(false));
+}
+
 TYPED_TEST(WaitSetTest, signal_handling_mode_can_be_set) {
     constexpr ServiceType SERVICE_TYPE = TestFixture::TYPE;
 
@@ -482,6 +482,68 @@ pub unsafe extern "C" fn iox2_active_request_send_copy(
     }
 }
 
+/// Takes the ownership of all provided responses and sends them in order with a single
+/// connection update.
+///
+/// # Arguments
+///
+/// * `active_request_handle` - Must be a valid [`iox2_active_request_h_ref`]
+///   obtained by [`iox2_server_receive`](crate::iox2_server_receive).
+/// * `response_handles` - Pointer to an array of `number_of_responses` [`iox2_response_mut_h`]
+///   handles which were loaned from this active request via
+///   [`iox2_active_request_loan_slice_uninit()`].
+/// * `number_of_responses` - The number of responses in `response_handles`
+///
+/// Return [`IOX2_OK`] on success, otherwise the first [`iox2_send_error_e`] that occurred.
+///
+/// # Safety
+///
+/// * `active_request_handle` is valid and non-null
+/// * `response_handles` points to an array of at least `number_of_responses` valid, non-null handles
+/// * all `response_handles` are invalid after the return of this function, independent of the result
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_active_request_send_batch(
+    active_request_handle: iox2_active_request_h_ref,
+    response_handles: *const iox2_response_mut_h,
+    number_of_responses: c_size_t,
+) -> c_int {
+    active_request_handle.assert_non_null();
+    debug_assert!(!response_handles.is_null() || number_of_responses == 0);
+    unsafe {
+        let active_request = &mut *active_request_handle.as_type();
+
+        let result = match active_request.service_type {
+            iox2_service_type_e::IPC => {
+                active_request
+                    .value
+                    .as_ref()
+                    .ipc
+                    .send_batch((0..number_of_responses).map(|n| {
+                        let response_handle = *response_handles.add(n);
+                        response_handle.assert_non_null();
+                        (*response_handle.as_type()).take_ipc()
+                    }))
+            }
+            iox2_service_type_e::LOCAL => {
+                active_request
+                    .value
+                    .as_ref()
+                    .local
+                    .send_batch((0..number_of_responses).map(|n| {
+                        let response_handle = *response_handles.add(n);
+                        response_handle.assert_non_null();
+                        (*response_handle.as_type()).take_local()
+                    }))
+            }
+        };
+
+        match result {
+            Ok(()) => IOX2_OK,
+            Err(e) => e.into_c_int(),
+        }
+    }
+}
+
 /// This function needs to be called to destroy the active_request!
 ///
 /// # Arguments
@@ -11,6 +11,7 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use crate::api::{iox2_buffer_16_align_4_t, iox2_callback_context};
+use crate::c_size_t;
 
 use iceoryx2::port::{BackpressureAction, BackpressureInfo};
 use iceoryx2_bb_elementary_traits::AsCStr;
@@ -186,6 +187,39 @@ pub unsafe extern "C" fn iox2_backpressure_info_elapsed_time(
     }
 }
 
+/// Obtains the capacity of the buffer of the receiver port
+///
+/// # Arguments
+///
+/// * `info_handle` - Must be a valid [`iox2_backpressure_info_h_ref`] provided as parameter by [`iox2_backpressure_handler`]
+///
+/// # Safety
+///
+/// * `info_handle` must be a valid handle
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_backpressure_info_buffer_size(
+    info_handle: iox2_backpressure_info_h_ref,
+) -> c_size_t {
+    backpressure_info_as_type(info_handle).buffer_size
+}
+
+/// Obtains the number of samples that are currently stored in the buffer of the receiver port
+/// and were not yet received
+///
+/// # Arguments
+///
+/// * `info_handle` - Must be a valid [`iox2_backpressure_info_h_ref`] provided as parameter by [`iox2_backpressure_handler`]
+///
+/// # Safety
+///
+/// * `info_handle` must be a valid handle
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_backpressure_info_number_of_buffered_samples(
+    info_handle: iox2_backpressure_info_h_ref,
+) -> c_size_t {
+    backpressure_info_as_type(info_handle).number_of_buffered_samples
+}
+
 /// The backpressure handler signature
 ///
 /// # Arguments
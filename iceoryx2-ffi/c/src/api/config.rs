@@ -86,7 +86,7 @@ pub(super) struct ConfigOwner {
 #[repr(C)]
 #[repr(align(8))] // align_of<ConfigOwner>()
 pub struct iox2_config_storage_t {
-    internal: [u8; 4528], // size_of<ConfigOwner>()
+    internal: [u8; 4640], // size_of<ConfigOwner>()
 }
 
 /// Contains the iceoryx2 config
@@ -1191,6 +1191,51 @@ pub unsafe extern "C" fn iox2_config_global_set_creation_timeout(
     }
 }
 
+/// Returns the maximum number of bytes the data segments of the domain can occupy in sum. It
+/// returns `true` if a quota is defined and sets the provided `value`, otherwise it returns
+/// `false`.
+///
+/// # Safety
+///
+/// * `handle` - A valid non-owning [`iox2_config_h_ref`].
+/// * `value` - points to a valid memory location
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_config_global_shared_memory_quota(
+    handle: iox2_config_h_ref,
+    value: *mut c_size_t,
+) -> bool {
+    handle.assert_non_null();
+    debug_assert!(!value.is_null());
+    unsafe {
+        let config = &*handle.as_type();
+        if let Some(v) = config.value.as_ref().value.global.shared_memory_quota {
+            *value = v;
+            true
+        } else {
+            false
+        }
+    }
+}
+
+/// Sets the maximum number of bytes the data segments of the domain can occupy in sum. If
+/// `value` is `NULL` the shared memory is unlimited, otherwise the provided value will be used.
+///
+/// # Safety
+///
+/// * `handle` - A valid non-owning [`iox2_config_h_ref`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_config_global_set_shared_memory_quota(
+    handle: iox2_config_h_ref,
+    value: *const c_size_t,
+) {
+    handle.assert_non_null();
+    unsafe {
+        let config = &mut *handle.as_type();
+        config.value.as_mut().value.global.shared_memory_quota =
+            if value.is_null() { None } else { Some(*value) };
+    }
+}
+
 /// The suffix of a one-to-one connection
 ///
 /// # Safety
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use iceoryx2_bb_posix::clock::CycleClock;
+
+// BEGIN C API
+/// Returns true when [`iox2_cycle_clock_now()`] reads the cycle counter of the CPU and false
+/// when it falls back to `clock_gettime`. The first call calibrates the cycle counter.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_cycle_clock_is_hardware_accelerated() -> bool {
+    CycleClock::is_hardware_accelerated()
+}
+
+/// Acquires the current time of the monotonic clock with the low overhead cycle counter of the
+/// CPU. The time can be compared with the send timestamps of the samples and with the time of the
+/// monotonic clock acquired in other processes. When the time cannot be acquired, both values
+/// are set to 0.
+///
+/// # Safety
+///
+/// * `seconds` must be a valid pointer to an `uint64_t`
+/// * `nanoseconds` must be a valid pointer to an `uint32_t`
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_cycle_clock_now(seconds: *mut u64, nanoseconds: *mut u32) {
+    debug_assert!(!seconds.is_null());
+    debug_assert!(!nanoseconds.is_null());
+
+    let (secs, nsecs) = match CycleClock::now() {
+        Ok(now) => (now.seconds(), now.nanoseconds()),
+        Err(_) => (0, 0),
+    };
+
+    unsafe {
+        *seconds = secs;
+        *nanoseconds = nsecs;
+    }
+}
+// END C API
@@ -13,6 +13,7 @@
 use crate::api::iox2_callback_context;
 
 use crate::api::iox2_buffer_16_align_4_t;
+use crate::c_size_t;
 use iceoryx2::port::{DegradationAction, DegradationCause, DegradationInfo};
 use iceoryx2_bb_elementary_traits::AsCStr;
 use iceoryx2_ffi_macros::CStrRepr;
@@ -166,6 +167,22 @@ pub unsafe extern "C" fn iox2_degradation_info_sender_port_id(
     }
 }
 
+/// Obtains the buffer size of the connection between the sender and the receiver port
+///
+/// # Arguments
+///
+/// * `info_handle` - Must be a valid [`iox2_degradation_info_h_ref`] provided as parameter by [`iox2_degradation_handler`]
+///
+/// # Safety
+///
+/// * `info_handle` must be a valid handle
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_degradation_info_buffer_size(
+    info_handle: iox2_degradation_info_h_ref,
+) -> c_size_t {
+    degradation_info_as_type(info_handle).buffer_size
+}
+
 /// The degradation handler signature
 ///
 /// # Arguments
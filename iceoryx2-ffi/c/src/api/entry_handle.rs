@@ -148,6 +148,157 @@ pub unsafe extern "C" fn iox2_entry_handle_get(
     }
 }
 
+/// Updates the values of `number_of_entry_handles` entries with the same value type in one call.
+/// The value of the i-th entry handle is only copied to the i-th element of `values_ptr` when its
+/// generation counter differs from the i-th element of `generation_counters_ptr`, which is then
+/// updated. Bit `i % 64` of the word `i / 64` in `changed_entries_ptr` is set when the i-th value
+/// changed and cleared otherwise. Returns the number of changed entries.
+///
+/// Initializing the generation counters with 0 copies all values on the first call.
+///
+/// # Safety
+///
+/// * `entry_handles_ptr` a valid, non-null pointer to `number_of_entry_handles` handles obtained
+///   by [`iox2_reader_entry()`](crate::iox2_reader_entry())
+/// * `values_ptr` a valid, non-null pointer to an array of `number_of_entry_handles` values
+/// * `value_size` the size of the value type of all entries
+/// * `value_alignment` the alignment of the value type of all entries
+/// * `generation_counters_ptr` a valid, non-null pointer to `number_of_entry_handles` [`u64`]
+/// * `changed_entries_ptr` a valid, non-null pointer to `number_of_entry_handles.div_ceil(64)`
+///   [`u64`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_entry_handle_update_batch(
+    entry_handles_ptr: *const iox2_entry_handle_h,
+    number_of_entry_handles: c_size_t,
+    values_ptr: *mut c_void,
+    value_size: c_size_t,
+    value_alignment: c_size_t,
+    generation_counters_ptr: *mut u64,
+    changed_entries_ptr: *mut u64,
+) -> c_size_t {
+    const BITS_PER_WORD: usize = u64::BITS as usize;
+
+    if number_of_entry_handles == 0 {
+        return 0;
+    }
+
+    debug_assert!(!entry_handles_ptr.is_null());
+    debug_assert!(!values_ptr.is_null());
+    debug_assert!(!generation_counters_ptr.is_null());
+    debug_assert!(!changed_entries_ptr.is_null());
+    unsafe {
+        let entry_handles = core::slice::from_raw_parts(entry_handles_ptr, number_of_entry_handles);
+        let generation_counters =
+            core::slice::from_raw_parts_mut(generation_counters_ptr, number_of_entry_handles);
+        let changed_entries = core::slice::from_raw_parts_mut(
+            changed_entries_ptr,
+            number_of_entry_handles.div_ceil(BITS_PER_WORD),
+        );
+        let values_ptr = values_ptr as *mut u8;
+
+        changed_entries.fill(0);
+        let mut number_of_changed_entries = 0;
+        for (i, entry_handle_handle) in entry_handles.iter().enumerate() {
+            let entry_handle = &*(*entry_handle_handle).as_type();
+            let value_ptr = values_ptr.add(i * value_size);
+
+            let has_changed = match entry_handle.service_type {
+                iox2_service_type_e::IPC => entry_handle.value.as_ref().ipc.update_if_changed(
+                    value_ptr,
+                    value_size,
+                    value_alignment,
+                    &mut generation_counters[i],
+                ),
+                iox2_service_type_e::LOCAL => entry_handle.value.as_ref().local.update_if_changed(
+                    value_ptr,
+                    value_size,
+                    value_alignment,
+                    &mut generation_counters[i],
+                ),
+            };
+
+            if has_changed {
+                changed_entries[i / BITS_PER_WORD] |= 1 << (i % BITS_PER_WORD);
+                number_of_changed_entries += 1;
+            }
+        }
+
+        number_of_changed_entries
+    }
+}
+
+/// Stores a pointer to the latest value in shared memory in `value_ptr` and its generation
+/// counter in `generation_counter_ptr` without copying the value. The value must be discarded
+/// when [`iox2_entry_handle_end_read()`] returns false for the generation counter after the
+/// value was read.
+///
+/// # Safety
+///
+/// * `entry_handle_handle` obtained by [`iox2_reader_entry()`](crate::iox2_reader_entry())
+/// * `value_ptr` a valid, non-null pointer pointing to a [`*const c_void`] pointer
+/// * `value_size` the size of the value type
+/// * `value_alignment` the alignment of the value type
+/// * `generation_counter_ptr` a valid, non-null pointer pointing to a [`u64`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_entry_handle_begin_read(
+    entry_handle_handle: iox2_entry_handle_h_ref,
+    value_ptr: *mut *const c_void,
+    value_size: c_size_t,
+    value_alignment: c_size_t,
+    generation_counter_ptr: *mut u64,
+) {
+    entry_handle_handle.assert_non_null();
+    debug_assert!(!value_ptr.is_null());
+    debug_assert!(!generation_counter_ptr.is_null());
+    unsafe {
+        let entry_handle = &*entry_handle_handle.as_type();
+
+        let (data_ptr, generation_counter) = match entry_handle.service_type {
+            iox2_service_type_e::IPC => entry_handle
+                .value
+                .as_ref()
+                .ipc
+                .begin_read(value_size, value_alignment),
+            iox2_service_type_e::LOCAL => entry_handle
+                .value
+                .as_ref()
+                .local
+                .begin_read(value_size, value_alignment),
+        };
+
+        *value_ptr = data_ptr as *const c_void;
+        *generation_counter_ptr = generation_counter;
+    }
+}
+
+/// Returns true when the value acquired with [`iox2_entry_handle_begin_read()`] was not
+/// updated while it was read, otherwise the read value is torn and must be discarded.
+///
+/// # Safety
+///
+/// * `entry_handle_handle` obtained by [`iox2_reader_entry()`](crate::iox2_reader_entry())
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_entry_handle_end_read(
+    entry_handle_handle: iox2_entry_handle_h_ref,
+    generation_counter: u64,
+) -> bool {
+    entry_handle_handle.assert_non_null();
+    unsafe {
+        let entry_handle = &*entry_handle_handle.as_type();
+
+        match entry_handle.service_type {
+            iox2_service_type_e::IPC => {
+                entry_handle.value.as_ref().ipc.end_read(generation_counter)
+            }
+            iox2_service_type_e::LOCAL => entry_handle
+                .value
+                .as_ref()
+                .local
+                .end_read(generation_counter),
+        }
+    }
+}
+
 /// Checks if the blackboard value that corresponds to the `generation_counter` is
 /// up-to-date.
 ///
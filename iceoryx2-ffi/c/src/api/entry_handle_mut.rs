@@ -188,13 +188,13 @@ pub unsafe extern "C" fn iox2_entry_handle_mut_loan_uninit(
 /// # Safety
 ///
 /// * `entry_handle_mut_handle` obtained by [`iox2_writer_entry()`](crate::iox2_writer_entry())
-/// * `value_ptr` a valid, non-null [`*mut c_void`] pointer which points to the value to be stored
+/// * `value_ptr` a valid, non-null [`*const c_void`] pointer which points to the value to be stored
 /// * `value_size` the size of the value type that shall be stored in the entry value
 /// * `value_alignment` the alignment of the value type that shall be stored in the entry value
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn iox2_entry_handle_mut_update_with_copy(
     entry_handle_mut_handle: iox2_entry_handle_mut_h_ref,
-    value_ptr: *mut c_void,
+    value_ptr: *const c_void,
     value_size: usize,
     value_alignment: usize,
 ) {
@@ -13,6 +13,7 @@
 #![allow(non_camel_case_types)]
 #![allow(dead_code)]
 
+use crate::api::port_statistics::iox2_port_statistics_t;
 use crate::api::{
     AssertNonNullHandle, HandleToType, IOX2_OK, IntoCInt, iox2_callback_context, iox2_event_id_t,
     iox2_service_type_e, iox2_unique_listener_id_h, iox2_unique_listener_id_t,
@@ -100,7 +101,7 @@ impl ListenerUnion {
 #[repr(C)]
 #[repr(align(8))] // alignment of Option<ListenerUnion>
 pub struct iox2_listener_storage_t {
-    internal: [u8; 1416], // magic number obtained with size_of::<Option<ListenerUnion>>()
+    internal: [u8; 1432], // magic number obtained with size_of::<Option<ListenerUnion>>()
 }
 
 #[repr(C)]
@@ -401,6 +402,36 @@ pub unsafe extern "C" fn iox2_listener_id(
     }
 }
 
+/// Stores the counters of the listener in the provided `statistics`, see
+/// [`PortStatistics`](iceoryx2::port::statistics::PortStatistics).
+///
+/// # Arguments
+///
+/// * `listener_handle` obtained by [`iox2_port_factory_listener_builder_create`](crate::iox2_port_factory_listener_builder_create)
+/// * `statistics` - A valid pointer to a [`iox2_port_statistics_t`]
+///
+/// # Safety
+///
+/// * `listener_handle` is valid, non-null and was obtained via [`iox2_port_factory_listener_builder_create`](crate::iox2_port_factory_listener_builder_create)
+/// * `statistics` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_listener_statistics(
+    listener_handle: iox2_listener_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    listener_handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+
+    unsafe {
+        let listener = &mut *listener_handle.as_type();
+
+        *statistics = match listener.service_type {
+            iox2_service_type_e::IPC => listener.value.as_ref().ipc.statistics().into(),
+            iox2_service_type_e::LOCAL => listener.value.as_ref().local.statistics().into(),
+        };
+    }
+}
+
 /// Returns the deadline of the listener's service. If there is a deadline set, the provided
 /// arguments `seconds` and `nanoseconds` will be set `true` is returned. Otherwise, false is
 /// returned and nothing is set.
@@ -24,6 +24,8 @@ use iceoryx2_log::{
 };
 
 use iceoryx2_bb_concurrency::once::Once;
+#[cfg(feature = "std")]
+use iceoryx2_bb_loggers::asynchronous;
 
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -79,6 +81,13 @@ impl From<LogLevel> for iox2_log_level_e {
 static mut LOGGER: Option<CLogger> = None;
 static INIT: Once = Once::new();
 
+#[cfg(feature = "std")]
+static mut ASYNC_SINK: Option<CLogger> = None;
+#[cfg(feature = "std")]
+static mut ASYNC_LOGGER: Option<asynchronous::Logger> = None;
+#[cfg(feature = "std")]
+static ASYNC_INIT: Once = Once::new();
+
 struct CLogger {
     callback: iox2_log_callback,
 }
@@ -215,4 +224,36 @@ pub unsafe extern "C" fn iox2_set_logger(logger: iox2_log_callback) -> bool {
     }
 }
 
+/// Sets a logger that forwards all log messages from a background thread to the provided
+/// callback. The calling thread only copies the message into a lock-free buffer, therefore it
+/// is never blocked by the callback. When the buffer is full, messages are discarded.
+/// This function can only be called once and must be called before any log message was created.
+/// It returns true if the logger was set, otherwise false.
+#[cfg(feature = "std")]
+#[unsafe(no_mangle)]
+#[allow(static_mut_refs)] // internally used and the logger is never changed once it was set
+pub unsafe extern "C" fn iox2_set_async_logger(logger: iox2_log_callback) -> bool {
+    unsafe {
+        ASYNC_INIT.call_once(|| {
+            ASYNC_SINK = Some(CLogger::new(logger));
+            ASYNC_LOGGER = Some(asynchronous::Logger::new(ASYNC_SINK.as_ref().unwrap()));
+        });
+
+        set_logger(ASYNC_LOGGER.as_ref().unwrap())
+    }
+}
+
+/// Blocks until all log messages were forwarded to the callback of the logger that was set with
+/// [`iox2_set_async_logger()`]. Does nothing when no asynchronous logger was set.
+#[cfg(feature = "std")]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_flush_async_logger() {
+    unsafe {
+        #[allow(static_mut_refs)] // internally used and the logger is never changed once it was set
+        if let Some(logger) = ASYNC_LOGGER.as_ref() {
+            logger.flush();
+        }
+    }
+}
+
 // END C API
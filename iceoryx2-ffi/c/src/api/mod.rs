@@ -30,6 +30,7 @@ mod client;
 mod client_details;
 mod config;
 mod constants;
+mod cycle_clock;
 mod degradation_handler;
 mod entry_handle;
 mod entry_handle_mut;
@@ -59,6 +60,7 @@ mod port_factory_request_response;
 mod port_factory_server_builder;
 mod port_factory_subscriber_builder;
 mod port_factory_writer_builder;
+mod port_statistics;
 mod publish_subscribe_header;
 mod publisher;
 mod publisher_details;
@@ -116,6 +118,7 @@ pub use client::*;
 pub use client_details::*;
 pub use config::*;
 pub use constants::*;
+pub use cycle_clock::*;
 pub use degradation_handler::*;
 pub use entry_handle::*;
 pub use entry_handle_mut::*;
@@ -144,6 +147,7 @@ pub use port_factory_request_response::*;
 pub use port_factory_server_builder::*;
 pub use port_factory_subscriber_builder::*;
 pub use port_factory_writer_builder::*;
+pub use port_statistics::*;
 pub use publish_subscribe_header::*;
 pub use publisher::*;
 pub use publisher_details::*;
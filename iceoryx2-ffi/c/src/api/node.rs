@@ -349,6 +349,25 @@ pub unsafe extern "C" fn iox2_node_wait(
     }
 }
 
+/// Increments the heartbeat counter of the node without waiting. The heartbeat is also
+/// incremented implicitly by [`iox2_node_wait()`].
+///
+/// # Safety
+///
+/// * The `node_handle` must be valid and obtained by [`iox2_node_builder_create`](crate::iox2_node_builder_create)!
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_node_heartbeat(node_handle: iox2_node_h_ref) {
+    node_handle.assert_non_null();
+    unsafe {
+        let node = &mut *node_handle.as_type();
+
+        match node.service_type {
+            iox2_service_type_e::IPC => node.value.as_ref().ipc.heartbeat(),
+            iox2_service_type_e::LOCAL => node.value.as_ref().local.heartbeat(),
+        }
+    }
+}
+
 /// Returns the [`iox2_config_ptr`](crate::iox2_config_ptr), an immutable pointer to the config.
 ///
 /// # Safety
@@ -18,6 +18,7 @@ use crate::api::{
 };
 
 use iceoryx2::port::notifier::{Notifier, NotifierNotifyError};
+use iceoryx2::prelude::EventId;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_bb_elementary_traits::AsCStr;
 use iceoryx2_ffi_macros::CStrRepr;
@@ -327,6 +328,71 @@ pub unsafe extern "C" fn iox2_notifier_notify_with_custom_event_id(
     IOX2_OK
 }
 
+/// Notifies all [`iox2_listener_h`](crate::iox2_listener_h) connected to the service
+/// with all provided event ids at once. Every listener is woken up only once.
+///
+/// # Arguments
+///
+/// * notifier_handle -  Must be a valid [`iox2_notifier_h_ref`]
+///   obtained by [`iox2_port_factory_notifier_builder_create`](crate::iox2_port_factory_notifier_builder_create)
+/// * event_ids_ptr - Must be a pointer to an array of `number_of_event_ids` initialized
+///   [`iox2_event_id_t`](crate::iox2_event_id_t)
+/// * number_of_event_ids - The number of elements in the `event_ids_ptr` array
+/// * number_of_notified_listener_ptr - Must be either a NULL pointer or a pointer to a `size_t` to store the number of notified listener
+///
+/// Returns IOX2_OK on success, an [`iox2_notifier_notify_error_e`] otherwise.
+///
+/// # Safety
+///
+/// `notifier_handle` must be a valid handle and is still valid after the return of this function and can be use in another function call.
+/// `event_ids_ptr` must not be a NULL pointer when `number_of_event_ids` is not zero.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_notifier_notify_multiple(
+    notifier_handle: iox2_notifier_h_ref,
+    event_ids_ptr: *const iox2_event_id_t,
+    number_of_event_ids: c_size_t,
+    number_of_notified_listener_ptr: *mut c_size_t,
+) -> c_int {
+    notifier_handle.assert_non_null();
+    debug_assert!(!event_ids_ptr.is_null() || number_of_event_ids == 0);
+
+    // the event ids are reinterpreted instead of copied to avoid an allocation per notification
+    static_assert_eq::<
+        { core::mem::size_of::<iox2_event_id_t>() },
+        { core::mem::size_of::<EventId>() },
+    >();
+    static_assert_eq::<
+        { core::mem::align_of::<iox2_event_id_t>() },
+        { core::mem::align_of::<EventId>() },
+    >();
+
+    unsafe {
+        let event_ids: &[EventId] = if number_of_event_ids == 0 {
+            &[]
+        } else {
+            core::slice::from_raw_parts(event_ids_ptr.cast(), number_of_event_ids)
+        };
+
+        let notifier = &mut *notifier_handle.as_type();
+        let notify_result = match notifier.service_type {
+            iox2_service_type_e::IPC => notifier.value.as_mut().ipc.notify_multiple(event_ids),
+            iox2_service_type_e::LOCAL => notifier.value.as_mut().local.notify_multiple(event_ids),
+        };
+
+        match notify_result {
+            Ok(count) => {
+                if !number_of_notified_listener_ptr.is_null() {
+                    *number_of_notified_listener_ptr = count;
+                }
+            }
+            Err(error) => {
+                return error.into_c_int();
+            }
+        }
+    }
+    IOX2_OK
+}
+
 /// This function needs to be called to destroy the notifier!
 ///
 /// # Arguments
@@ -162,6 +162,34 @@ pub unsafe extern "C" fn iox2_pending_response_is_connected(
     }
 }
 
+/// Returns true when at least one server rejected the request since its deadline had passed
+/// before it was handed out, otherwise false.
+///
+/// # Arguments
+///
+/// * `handle` - Must be a valid [`iox2_pending_response_h_ref`]
+///   obtained by [`iox2_request_mut_send`](crate::iox2_request_mut_send).
+///
+/// # Safety
+///
+/// * `handle` must be valid a handle
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_pending_response_has_missed_deadline(
+    handle: iox2_pending_response_h_ref,
+) -> bool {
+    handle.assert_non_null();
+    unsafe {
+        let pending_response = &mut *handle.as_type();
+
+        match pending_response.service_type {
+            iox2_service_type_e::IPC => pending_response.value.as_ref().ipc.has_missed_deadline(),
+            iox2_service_type_e::LOCAL => {
+                pending_response.value.as_ref().local.has_missed_deadline()
+            }
+        }
+    }
+}
+
 /// Marks the connection state that the Client wants to gracefully disconnect. When the
 /// server reads it, it can send the last response and drop the
 /// corresponding active request to terminate the connection ensuring that no response
@@ -459,6 +487,101 @@ pub unsafe extern "C" fn iox2_pending_response_receive(
     IOX2_OK
 }
 
+/// Takes up to `number_of_slots` responses out of the buffer with a single call.
+///
+/// # Arguments
+///
+/// * `handle` - Must be a valid [`iox2_pending_response_h_ref`]
+///   obtained by [`iox2_request_mut_send`](crate::iox2_request_mut_send).
+/// * `response_struct_ptrs` - Must be either a NULL pointer or point to an array of
+///   `number_of_slots` pointers to valid [`iox2_response_t`]. If it is a NULL pointer, the
+///   storage of every response will be allocated on the heap.
+/// * `response_handle_ptrs` - Must point to an array of `number_of_slots` [`iox2_response_h`].
+///   The first `*number_of_received_responses` handles will be initialized, the remaining ones
+///   are set to NULL.
+/// * `number_of_slots` - The maximum number of responses that shall be received.
+/// * `number_of_received_responses` - A non-null pointer that will contain the number of
+///   received responses.
+///
+/// Returns IOX2_OK on success, an [`iox2_receive_error_e`](crate::iox2_receive_error_e)
+/// otherwise. When an error occurs after at least one response was received, the batch ends
+/// early and IOX2_OK is returned together with the already received responses. The error
+/// itself is not stored, it is caused by the state of the pending response and occurs again
+/// on the next receive call when the cause persists, e.g. when the already received responses
+/// are still borrowed.
+///
+/// # Safety
+///
+/// * The `handle` is still valid after the return of this function and can be use in another function call.
+/// * `response_handle_ptrs` points to an array with at least `number_of_slots` entries.
+/// * `response_struct_ptrs` is either NULL or points to an array with at least `number_of_slots` valid, non-null entries.
+/// * `number_of_received_responses` is pointing to a valid [`c_size_t`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_pending_response_receive_batch(
+    handle: iox2_pending_response_h_ref,
+    response_struct_ptrs: *const *mut iox2_response_t,
+    response_handle_ptrs: *mut iox2_response_h,
+    number_of_slots: c_size_t,
+    number_of_received_responses: *mut c_size_t,
+) -> c_int {
+    handle.assert_non_null();
+    debug_assert!(!response_handle_ptrs.is_null() || number_of_slots == 0);
+    debug_assert!(!number_of_received_responses.is_null());
+
+    fn no_op(_: *mut iox2_response_t) {}
+
+    unsafe {
+        *number_of_received_responses = 0;
+        for n in 0..number_of_slots {
+            *response_handle_ptrs.add(n) = core::ptr::null_mut();
+        }
+
+        let pending_response = &mut *handle.as_type();
+
+        for n in 0..number_of_slots {
+            let response = match pending_response.service_type {
+                iox2_service_type_e::IPC => pending_response
+                    .value
+                    .as_ref()
+                    .ipc
+                    .receive_custom_payload()
+                    .map(|r| r.map(ResponseUnion::new_ipc)),
+                iox2_service_type_e::LOCAL => pending_response
+                    .value
+                    .as_ref()
+                    .local
+                    .receive_custom_payload()
+                    .map(|r| r.map(ResponseUnion::new_local)),
+            };
+
+            match response {
+                Ok(Some(response)) => {
+                    let (response_struct_ptr, deleter): (_, fn(*mut iox2_response_t)) =
+                        if response_struct_ptrs.is_null() {
+                            (iox2_response_t::alloc(), iox2_response_t::dealloc)
+                        } else {
+                            (*response_struct_ptrs.add(n), no_op)
+                        };
+                    debug_assert!(!response_struct_ptr.is_null());
+
+                    (*response_struct_ptr).init(pending_response.service_type, response, deleter);
+                    *response_handle_ptrs.add(n) = (*response_struct_ptr).as_handle();
+                    *number_of_received_responses = n + 1;
+                }
+                Ok(None) => break,
+                Err(error) => {
+                    if n == 0 {
+                        return error.into_c_int();
+                    }
+                    break;
+                }
+            }
+        }
+
+        IOX2_OK
+    }
+}
+
 /// This function needs to be called to destroy the pending response!
 ///
 /// # Arguments
@@ -20,6 +20,7 @@ use crate::{
         iox2_port_factory_publisher_builder_h, iox2_port_factory_publisher_builder_t,
         iox2_port_factory_subscriber_builder_h, iox2_port_factory_subscriber_builder_t,
         iox2_service_type_e, iox2_static_config_publish_subscribe_t,
+        port_statistics::iox2_port_statistics_t,
     },
     iox2_node_list_impl,
 };
@@ -580,6 +581,78 @@ pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_number_of_subs
     }
 }
 
+/// Stores the accumulated counters of all connected publisher ports in the provided `statistics`.
+///
+/// # Safety
+///
+/// * The `handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+/// * `statistics` must be a valid pointer to a [`iox2_port_statistics_t`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_publisher_statistics(
+    handle: iox2_port_factory_pub_sub_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+    unsafe {
+        let port_factory = &mut *handle.as_type();
+
+        use iceoryx2::prelude::PortFactory;
+        *statistics = match port_factory.service_type {
+            iox2_service_type_e::IPC => port_factory
+                .value
+                .as_ref()
+                .ipc
+                .dynamic_config()
+                .publisher_statistics(),
+            iox2_service_type_e::LOCAL => port_factory
+                .value
+                .as_ref()
+                .local
+                .dynamic_config()
+                .publisher_statistics(),
+        }
+        .into();
+    }
+}
+
+/// Stores the accumulated counters of all connected subscriber ports in the provided `statistics`.
+///
+/// # Safety
+///
+/// * The `handle` must be valid and obtained by [`iox2_service_builder_pub_sub_open`](crate::iox2_service_builder_pub_sub_open) or
+///   [`iox2_service_builder_pub_sub_open_or_create`](crate::iox2_service_builder_pub_sub_open_or_create)!
+/// * `statistics` must be a valid pointer to a [`iox2_port_statistics_t`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_pub_sub_dynamic_config_subscriber_statistics(
+    handle: iox2_port_factory_pub_sub_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+    unsafe {
+        let port_factory = &mut *handle.as_type();
+
+        use iceoryx2::prelude::PortFactory;
+        *statistics = match port_factory.service_type {
+            iox2_service_type_e::IPC => port_factory
+                .value
+                .as_ref()
+                .ipc
+                .dynamic_config()
+                .subscriber_statistics(),
+            iox2_service_type_e::LOCAL => port_factory
+                .value
+                .as_ref()
+                .local
+                .dynamic_config()
+                .subscriber_statistics(),
+        }
+        .into();
+    }
+}
+
 /// Calls the callback repeatedly for every connected [`iox2_subscriber_h`](crate::iox2_subscriber_h)
 /// and provides all communcation details with a [`iox2_subscriber_details_ptr`].
 ///
@@ -19,6 +19,7 @@ use crate::api::{
     iox2_degradation_handler, iox2_publisher_h, iox2_publisher_t, iox2_service_type_e,
 };
 
+use iceoryx2::port::copy_strategy::CopyStrategy;
 use iceoryx2::port::publisher::PublisherCreateError;
 use iceoryx2::prelude::*;
 use iceoryx2::service::port_factory::publisher::PortFactoryPublisher;
@@ -45,6 +46,9 @@ pub enum iox2_allocation_strategy_e {
     POWER_OF_TWO,
     /// The memory is not increased. This may lead to an out-of-memory error when allocating.
     STATIC,
+    /// Keeps one memory segment for every power of two chunk size and serves every allocation
+    /// from the smallest fitting size class.
+    SIZE_CLASSES,
 }
 
 impl From<iox2_allocation_strategy_e> for AllocationStrategy {
@@ -53,6 +57,28 @@ impl From<iox2_allocation_strategy_e> for AllocationStrategy {
             iox2_allocation_strategy_e::STATIC => AllocationStrategy::Static,
             iox2_allocation_strategy_e::BEST_FIT => AllocationStrategy::BestFit,
             iox2_allocation_strategy_e::POWER_OF_TWO => AllocationStrategy::PowerOfTwo,
+            iox2_allocation_strategy_e::SIZE_CLASSES => AllocationStrategy::SizeClasses,
+        }
+    }
+}
+
+/// Defines how a sender copies the user provided payload into the data segment when
+/// a copy is requested.
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub enum iox2_copy_strategy_e {
+    /// Uses a regular memcpy. The copied payload remains in the cache of the sender.
+    REGULAR,
+    /// Uses streaming stores that bypass the cache of the sender. Pays off for large
+    /// payloads that are not read again by the sender.
+    NON_TEMPORAL,
+}
+
+impl From<iox2_copy_strategy_e> for CopyStrategy {
+    fn from(value: iox2_copy_strategy_e) -> Self {
+        match value {
+            iox2_copy_strategy_e::REGULAR => CopyStrategy::Regular,
+            iox2_copy_strategy_e::NON_TEMPORAL => CopyStrategy::NonTemporal,
         }
     }
 }
@@ -146,7 +172,7 @@ impl PortFactoryPublisherBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactoryPublisherBuilderUnion>
 pub struct iox2_port_factory_publisher_builder_storage_t {
-    internal: [u8; 288], // magic number obtained with size_of::<Option<PortFactoryPublisherBuilderUnion>>()
+    internal: [u8; 704], // magic number obtained with size_of::<Option<PortFactoryPublisherBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -558,6 +584,120 @@ pub unsafe extern "C" fn iox2_port_factory_publisher_builder_backpressure_strate
     }
 }
 
+/// Sets the copy strategy for the publisher
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - The value to set the strategy to
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_copy_strategy(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: iox2_copy_strategy_e,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let handle = &mut *port_factory_handle.as_type();
+        match handle.service_type {
+            iox2_service_type_e::IPC => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().ipc);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                    builder.copy_strategy(value.into()),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().local);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_local(
+                    builder.copy_strategy(value.into()),
+                ));
+            }
+        }
+    }
+}
+
+/// Defines if the data segment and the connections of the publisher are prefaulted on creation
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - `true` to touch every page on creation
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_prefault(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: bool,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let handle = &mut *port_factory_handle.as_type();
+        match handle.service_type {
+            iox2_service_type_e::IPC => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().ipc);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                    builder.prefault(value),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().local);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_local(
+                    builder.prefault(value),
+                ));
+            }
+        }
+    }
+}
+
+/// Defines if the data segment and the connections of the publisher are locked into memory
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_publisher_builder_h_ref`]
+///   obtained by [`iox2_port_factory_pub_sub_publisher_builder`](crate::iox2_port_factory_pub_sub_publisher_builder).
+/// * `value` - `true` to lock the memory, the publisher creation fails when it cannot be locked
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_publisher_builder_set_lock_in_memory(
+    port_factory_handle: iox2_port_factory_publisher_builder_h_ref,
+    value: bool,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let handle = &mut *port_factory_handle.as_type();
+        match handle.service_type {
+            iox2_service_type_e::IPC => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().ipc);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_ipc(
+                    builder.lock_in_memory(value),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let builder = ManuallyDrop::take(&mut handle.value.as_mut().local);
+
+                handle.set(PortFactoryPublisherBuilderUnion::new_local(
+                    builder.lock_in_memory(value),
+                ));
+            }
+        }
+    }
+}
+
 /// Creates a publisher and consumes the builder
 ///
 /// # Arguments
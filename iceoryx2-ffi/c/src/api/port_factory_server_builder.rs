@@ -25,6 +25,7 @@ use super::{
     iox2_degradation_handler, iox2_server_h, iox2_server_t, iox2_service_type_e,
 };
 use core::ffi::{c_char, c_int};
+use iceoryx2::port::receive_policy::ReceivePolicy;
 use iceoryx2::service::port_factory::server::{PortFactoryServer, ServerCreateError};
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_bb_elementary_traits::AsCStr;
@@ -38,6 +39,7 @@ pub enum iox2_server_create_error_e {
     UNABLE_TO_CREATE_DATA_SEGMENT,
     FAILED_TO_DEPLOY_THREAD_SAFETY_POLICY,
     UNABLE_TO_CREATE_PORT_TAG,
+    UNABLE_TO_CREATE_WAKE_UP_CHANNEL,
 }
 
 impl IntoCInt for ServerCreateError {
@@ -55,10 +57,40 @@ impl IntoCInt for ServerCreateError {
             ServerCreateError::UnableToCreatePortTag => {
                 iox2_server_create_error_e::UNABLE_TO_CREATE_PORT_TAG
             }
+            ServerCreateError::UnableToCreateWakeUpChannel => {
+                iox2_server_create_error_e::UNABLE_TO_CREATE_WAKE_UP_CHANNEL
+            }
         }) as c_int
     }
 }
 
+/// Defines the order in which a server receives the requests of its connected clients.
+#[repr(C)]
+#[derive(Copy, Clone, CStrRepr)]
+pub enum iox2_receive_policy_e {
+    /// The clients are always served in the order of their connection. A client that
+    /// continuously sends requests can starve all clients that connected after it.
+    FIXED_ORDER,
+    /// Every receive call starts with the client that follows the last served client.
+    ROUND_ROBIN,
+    /// Like [`iox2_receive_policy_e::ROUND_ROBIN`] but a client is served as many requests
+    /// in a row as its weight states.
+    WEIGHTED_FAIR,
+    /// The client with the highest weight that has pending requests is always served first.
+    PRIORITY,
+}
+
+impl From<iox2_receive_policy_e> for ReceivePolicy {
+    fn from(value: iox2_receive_policy_e) -> Self {
+        match value {
+            iox2_receive_policy_e::FIXED_ORDER => ReceivePolicy::FixedOrder,
+            iox2_receive_policy_e::ROUND_ROBIN => ReceivePolicy::RoundRobin,
+            iox2_receive_policy_e::WEIGHTED_FAIR => ReceivePolicy::WeightedFair,
+            iox2_receive_policy_e::PRIORITY => ReceivePolicy::Priority,
+        }
+    }
+}
+
 pub(super) union PortFactoryServerBuilderUnion {
     ipc: ManuallyDrop<
         PortFactoryServer<
@@ -116,7 +148,7 @@ impl PortFactoryServerBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactoryServerBuilderUnion>
 pub struct iox2_port_factory_server_builder_storage_t {
-    internal: [u8; 336], // magic number obtained with size_of::<Option<PortFactoryServerBuilderUnion>>()
+    internal: [u8; 416], // magic number obtained with size_of::<Option<PortFactoryServerBuilderUnion>>()
 }
 
 #[repr(C)]
@@ -543,6 +575,125 @@ pub unsafe extern "C" fn iox2_port_factory_server_builder_set_max_loaned_respons
     }
 }
 
+/// Enables or disables the coalescing of identical in-flight requests
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_server_builder_h_ref`]
+///   obtained by [`iox2_port_factory_request_response_server_builder`](crate::iox2_port_factory_request_response_server_builder).
+/// * `value` - Defines if request coalescing shall be enabled
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_server_builder_enable_request_coalescing(
+    port_factory_handle: iox2_port_factory_server_builder_h_ref,
+    value: bool,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let port_factory_struct = &mut *port_factory_handle.as_type();
+        match port_factory_struct.service_type {
+            iox2_service_type_e::IPC => {
+                let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_ipc(
+                    port_factory.enable_request_coalescing(value),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let port_factory =
+                    ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_local(
+                    port_factory.enable_request_coalescing(value),
+                ));
+            }
+        }
+    }
+}
+
+/// Enables or disables the earliest-deadline-first scheduling of received requests and the
+/// rejection of requests whose deadline has passed
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_server_builder_h_ref`]
+///   obtained by [`iox2_port_factory_request_response_server_builder`](crate::iox2_port_factory_request_response_server_builder).
+/// * `value` - Defines if deadline scheduling shall be enabled
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_server_builder_enable_deadline_scheduling(
+    port_factory_handle: iox2_port_factory_server_builder_h_ref,
+    value: bool,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let port_factory_struct = &mut *port_factory_handle.as_type();
+        match port_factory_struct.service_type {
+            iox2_service_type_e::IPC => {
+                let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_ipc(
+                    port_factory.enable_deadline_scheduling(value),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let port_factory =
+                    ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_local(
+                    port_factory.enable_deadline_scheduling(value),
+                ));
+            }
+        }
+    }
+}
+
+/// Sets the order in which the server receives the requests of its connected clients
+///
+/// # Arguments
+///
+/// * `port_factory_handle` - Must be a valid [`iox2_port_factory_server_builder_h_ref`]
+///   obtained by [`iox2_port_factory_request_response_server_builder`](crate::iox2_port_factory_request_response_server_builder).
+/// * `value` - The [`iox2_receive_policy_e`]. Since the client weights cannot be
+///   defined via the C API, all clients have the weight 1.
+///
+/// # Safety
+///
+/// * `port_factory_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_port_factory_server_builder_set_receive_policy(
+    port_factory_handle: iox2_port_factory_server_builder_h_ref,
+    value: iox2_receive_policy_e,
+) {
+    port_factory_handle.assert_non_null();
+    unsafe {
+        let port_factory_struct = &mut *port_factory_handle.as_type();
+        match port_factory_struct.service_type {
+            iox2_service_type_e::IPC => {
+                let port_factory = ManuallyDrop::take(&mut port_factory_struct.value.as_mut().ipc);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_ipc(
+                    port_factory.receive_policy(value.into()),
+                ));
+            }
+            iox2_service_type_e::LOCAL => {
+                let port_factory =
+                    ManuallyDrop::take(&mut port_factory_struct.value.as_mut().local);
+
+                port_factory_struct.set(PortFactoryServerBuilderUnion::new_local(
+                    port_factory.receive_policy(value.into()),
+                ));
+            }
+        }
+    }
+}
+
 /// Sets the backpressure strategy for the server
 ///
 /// # Arguments
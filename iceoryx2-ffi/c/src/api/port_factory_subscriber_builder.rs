@@ -40,6 +40,8 @@ pub enum iox2_subscriber_create_error_e {
     UNABLE_TO_CREATE_PORT_TAG,
     HISTORY_REQUEST_EXCEEDS_HISTORY_SIZE_OF_SERVICE,
     HISTORY_REQUEST_EXCEEDS_BUFFER_SIZE_OF_SUBSCRIBER,
+    CONTENT_FILTER_EXCEEDS_USER_HEADER,
+    UNABLE_TO_CREATE_WAKE_UP_CHANNEL,
 }
 
 impl IntoCInt for SubscriberCreateError {
@@ -63,6 +65,12 @@ impl IntoCInt for SubscriberCreateError {
             SubscriberCreateError::HistoryRequestExceedsBufferSizeOfSubscriber => {
                 iox2_subscriber_create_error_e::HISTORY_REQUEST_EXCEEDS_BUFFER_SIZE_OF_SUBSCRIBER
             }
+            SubscriberCreateError::ContentFilterExceedsUserHeader => {
+                iox2_subscriber_create_error_e::CONTENT_FILTER_EXCEEDS_USER_HEADER
+            }
+            SubscriberCreateError::UnableToCreateWakeUpChannel => {
+                iox2_subscriber_create_error_e::UNABLE_TO_CREATE_WAKE_UP_CHANNEL
+            }
         }) as c_int
     }
 }
@@ -99,7 +107,7 @@ impl PortFactorySubscriberBuilderUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<PortFactorySubscriberBuilderUnion>
 pub struct iox2_port_factory_subscriber_builder_storage_t {
-    internal: [u8; 192], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
+    internal: [u8; 320], // magic number obtained with size_of::<Option<PortFactorySubscriberBuilderUnion>>()
 }
 
 #[repr(C)]
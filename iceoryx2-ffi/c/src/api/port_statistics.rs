@@ -0,0 +1,41 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+
+use iceoryx2::port::statistics::PortStatistics;
+
+/// Returned by `iox2_publisher_statistics()` and the corresponding functions of the other
+/// ports. Contains how many samples the port sent, received or dropped.
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct iox2_port_statistics_t {
+    /// The number of successful send operations
+    pub sent: u64,
+    /// The number of received samples, requests or events
+    pub received: u64,
+    /// The number of deliveries that were dropped since the buffer of a receiver was full
+    pub overflows: u64,
+    /// The number of loans that failed
+    pub failed_loans: u64,
+}
+
+impl From<PortStatistics> for iox2_port_statistics_t {
+    fn from(value: PortStatistics) -> Self {
+        Self {
+            sent: value.sent,
+            received: value.received,
+            overflows: value.overflows,
+            failed_loans: value.failed_loans,
+        }
+    }
+}
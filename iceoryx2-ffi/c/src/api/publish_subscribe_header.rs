@@ -27,7 +27,7 @@ use crate::{
 #[repr(C)]
 #[repr(align(8))] // core::mem::align_of::<Option<Header>>()
 pub struct iox2_publish_subscribe_header_storage_t {
-    internal: [u8; 48], // core::mem::size_of::<Option<Header>>()
+    internal: [u8; 72], // core::mem::size_of::<Option<Header>>()
 }
 
 #[repr(C)]
@@ -95,6 +95,40 @@ impl HandleToType for iox2_publish_subscribe_header_h_ref {
 
 // BEGIN C API
 
+/// cbindgen:ignore
+/// Internal API - do not use
+/// # Safety
+///
+/// * `source_struct_ptr` must not be `null` and the struct it is pointing to must be initialized and valid, i.e. not moved or dropped.
+/// * `dest_struct_ptr` must not be `null` and the struct it is pointing to must not contain valid data, i.e. initialized. It can be moved or dropped, though.
+/// * `dest_handle_ptr` must not be `null`
+#[doc(hidden)]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_move(
+    source_struct_ptr: *mut iox2_publish_subscribe_header_t,
+    dest_struct_ptr: *mut iox2_publish_subscribe_header_t,
+    dest_handle_ptr: *mut iox2_publish_subscribe_header_h,
+) {
+    debug_assert!(!source_struct_ptr.is_null());
+    debug_assert!(!dest_struct_ptr.is_null());
+    debug_assert!(!dest_handle_ptr.is_null());
+    unsafe {
+        let source = &mut *source_struct_ptr;
+        let dest = &mut *dest_struct_ptr;
+
+        dest.value.init(
+            source
+                .value
+                .as_option_mut()
+                .take()
+                .expect("Source must have a valid header"),
+        );
+        dest.deleter = source.deleter;
+
+        *dest_handle_ptr = (*dest_struct_ptr).as_handle();
+    }
+}
+
 /// This function needs to be called to destroy the publish_subscribe_header!
 ///
 /// # Safety
@@ -182,4 +216,76 @@ pub unsafe extern "C" fn iox2_publish_subscribe_header_number_of_elements(
         header.value.as_ref().number_of_elements()
     }
 }
+
+/// Returns the sequence number of the sample. Every publisher numbers its sent samples
+/// consecutively, starting from 0.
+///
+/// # Arguments
+///
+/// * `handle` is valid, non-null and was initialized with
+///   [`iox2_sample_header()`](crate::iox2_sample_header)
+///
+/// # Safety
+///
+/// * `header_handle` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_sequence_number(
+    header_handle: iox2_publish_subscribe_header_h_ref,
+) -> u64 {
+    header_handle.assert_non_null();
+    unsafe {
+        let header = &mut *header_handle.as_type();
+        header.value.as_ref().sequence_number()
+    }
+}
+
+/// Returns the point in time, in nanoseconds of the monotonic clock, when the sample was sent.
+/// Returns 0 when the service does not enable send timestamps, see
+/// [`iox2_service_builder_pub_sub_set_enable_send_timestamps()`](crate::iox2_service_builder_pub_sub_set_enable_send_timestamps).
+///
+/// # Arguments
+///
+/// * `handle` is valid, non-null and was initialized with
+///   [`iox2_sample_header()`](crate::iox2_sample_header)
+///
+/// # Safety
+///
+/// * `header_handle` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_send_timestamp(
+    header_handle: iox2_publish_subscribe_header_h_ref,
+) -> u64 {
+    header_handle.assert_non_null();
+    unsafe {
+        let header = &mut *header_handle.as_type();
+
+        header
+            .value
+            .as_ref()
+            .send_timestamp()
+            .map_or(0, |t| t.as_duration().as_nanos() as u64)
+    }
+}
+
+/// Returns the priority of the sample.
+///
+/// # Arguments
+///
+/// * `handle` is valid, non-null and was initialized with
+///   [`iox2_sample_header()`](crate::iox2_sample_header)
+///
+/// # Safety
+///
+/// * `header_handle` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publish_subscribe_header_priority(
+    header_handle: iox2_publish_subscribe_header_h_ref,
+) -> u8 {
+    header_handle.assert_non_null();
+    unsafe {
+        let header = &mut *header_handle.as_type();
+
+        header.value.as_ref().priority()
+    }
+}
 // END C API
@@ -12,6 +12,7 @@
 
 #![allow(non_camel_case_types)]
 
+use crate::api::port_statistics::iox2_port_statistics_t;
 use crate::api::{
     AssertNonNullHandle, HandleToType, IOX2_OK, PayloadFfi, SampleMutUninitUnion, UserHeaderFfi,
     iox2_backpressure_strategy_e, iox2_service_type_e, iox2_unique_publisher_id_h,
@@ -204,7 +205,11 @@ unsafe fn send_copy<S: Service>(
         }
 
         let sample_ptr = sample.payload_mut().as_mut_ptr();
-        core::ptr::copy_nonoverlapping(data_ptr, sample_ptr.cast(), size_of_element);
+        publisher.copy_strategy().copy_nonoverlapping(
+            data_ptr.cast(),
+            sample_ptr.cast(),
+            size_of_element,
+        );
         match sample.assume_init().send() {
             Ok(v) => {
                 if !number_of_recipients.is_null() {
@@ -236,7 +241,9 @@ unsafe fn send_slice_copy<S: Service>(
         }
 
         let sample_ptr = sample.payload_mut().as_mut_ptr();
-        core::ptr::copy_nonoverlapping(data_ptr, sample_ptr.cast(), data_len);
+        publisher
+            .copy_strategy()
+            .copy_nonoverlapping(data_ptr.cast(), sample_ptr.cast(), data_len);
         match sample.assume_init().send() {
             Ok(v) => {
                 if !number_of_recipients.is_null() {
@@ -394,6 +401,36 @@ pub unsafe extern "C" fn iox2_publisher_id(
     }
 }
 
+/// Stores the counters of the publisher in the provided `statistics`, see
+/// [`PortStatistics`](iceoryx2::port::statistics::PortStatistics).
+///
+/// # Arguments
+///
+/// * `publisher_handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+/// * `statistics` - A valid pointer to a [`iox2_port_statistics_t`]
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid, non-null and was obtained via [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+/// * `statistics` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publisher_statistics(
+    publisher_handle: iox2_publisher_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    publisher_handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+
+    unsafe {
+        let publisher = &mut *publisher_handle.as_type();
+
+        *statistics = match publisher.service_type {
+            iox2_service_type_e::IPC => publisher.value.as_ref().ipc.statistics().into(),
+            iox2_service_type_e::LOCAL => publisher.value.as_ref().local.statistics().into(),
+        };
+    }
+}
+
 /// Sends a copy of the provided slice data via the publisher.
 ///
 /// # Arguments
@@ -578,6 +615,141 @@ pub unsafe extern "C" fn iox2_publisher_loan_slice_uninit(
     }
 }
 
+/// Loans memory for a single fixed-size payload from the publishers data segment. In contrast to
+/// [`iox2_publisher_loan_slice_uninit()`] with one element it does not compute or verify a slice
+/// length.
+///
+/// # Arguments
+///
+/// * `handle` obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create)
+/// * `sample_struct_ptr` - Must be either a NULL pointer or a pointer to a valid [`iox2_sample_mut_t`].
+///   If it is a NULL pointer, the storage will be allocated on the heap.
+/// * `sample_handle_ptr` - An uninitialized or dangling [`iox2_sample_mut_h`] handle which will be initialized by this function call if a sample is obtained, otherwise it will be set to NULL.
+///
+/// Return [`IOX2_OK`] on success, otherwise [`iox2_loan_error_e`].
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+/// * The `sample_handle_ptr` is pointing to a valid [`iox2_sample_mut_h`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publisher_loan_uninit(
+    publisher_handle: iox2_publisher_h_ref,
+    sample_struct_ptr: *mut iox2_sample_mut_t,
+    sample_handle_ptr: *mut iox2_sample_mut_h,
+) -> c_int {
+    publisher_handle.assert_non_null();
+    debug_assert!(!sample_handle_ptr.is_null());
+
+    unsafe {
+        *sample_handle_ptr = core::ptr::null_mut();
+        let publisher = &mut *publisher_handle.as_type();
+
+        let sample = match publisher.service_type {
+            iox2_service_type_e::IPC => publisher
+                .value
+                .as_ref()
+                .ipc
+                .loan_custom_payload_fixed_size()
+                .map(SampleMutUninitUnion::new_ipc),
+            iox2_service_type_e::LOCAL => publisher
+                .value
+                .as_ref()
+                .local
+                .loan_custom_payload_fixed_size()
+                .map(SampleMutUninitUnion::new_local),
+        };
+
+        match sample {
+            Ok(sample) => {
+                let mut sample_struct_ptr = sample_struct_ptr;
+                fn no_op(_: *mut iox2_sample_mut_t) {}
+                let mut deleter: fn(*mut iox2_sample_mut_t) = no_op;
+                if sample_struct_ptr.is_null() {
+                    sample_struct_ptr = iox2_sample_mut_t::alloc();
+                    deleter = iox2_sample_mut_t::dealloc;
+                }
+                debug_assert!(!sample_struct_ptr.is_null());
+
+                (*sample_struct_ptr).init(publisher.service_type, sample, deleter);
+                *sample_handle_ptr = (*sample_struct_ptr).as_handle();
+                IOX2_OK
+            }
+            Err(error) => error.into_c_int(),
+        }
+    }
+}
+
+/// Takes the ownership of all provided samples and sends them in order with a single connection
+/// update.
+///
+/// # Arguments
+///
+/// * `publisher_handle` - Must be a valid [`iox2_publisher_h_ref`]
+///   obtained by [`iox2_port_factory_publisher_builder_create`](crate::iox2_port_factory_publisher_builder_create).
+/// * `sample_handles` - Pointer to an array of `number_of_samples` [`iox2_sample_mut_h`] handles which
+///   were loaned from this publisher via [`iox2_publisher_loan_slice_uninit()`].
+/// * `number_of_samples` - The number of samples in `sample_handles`
+/// * `number_of_recipients` (optional) used to store the accumulated number of subscribers that
+///   received the samples
+///
+/// Return [`IOX2_OK`] on success, otherwise the first [`iox2_send_error_e`] that occurred.
+///
+/// # Safety
+///
+/// * `publisher_handle` is valid and non-null
+/// * `sample_handles` points to an array of at least `number_of_samples` valid, non-null handles
+/// * all `sample_handles` are invalid after the return of this function, independent of the result
+/// * `number_of_recipients` can be null, otherwise a valid pointer to a [`c_size_t`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_publisher_send_batch(
+    publisher_handle: iox2_publisher_h_ref,
+    sample_handles: *const iox2_sample_mut_h,
+    number_of_samples: c_size_t,
+    number_of_recipients: *mut c_size_t,
+) -> c_int {
+    publisher_handle.assert_non_null();
+    debug_assert!(!sample_handles.is_null() || number_of_samples == 0);
+    unsafe {
+        let publisher = &mut *publisher_handle.as_type();
+
+        let result = match publisher.service_type {
+            iox2_service_type_e::IPC => {
+                publisher
+                    .value
+                    .as_ref()
+                    .ipc
+                    .send_batch((0..number_of_samples).map(|n| {
+                        let sample_handle = *sample_handles.add(n);
+                        sample_handle.assert_non_null();
+                        (*sample_handle.as_type()).take_ipc()
+                    }))
+            }
+            iox2_service_type_e::LOCAL => {
+                publisher
+                    .value
+                    .as_ref()
+                    .local
+                    .send_batch((0..number_of_samples).map(|n| {
+                        let sample_handle = *sample_handles.add(n);
+                        sample_handle.assert_non_null();
+                        (*sample_handle.as_type()).take_local()
+                    }))
+            }
+        };
+
+        match result {
+            Ok(v) => {
+                if !number_of_recipients.is_null() {
+                    *number_of_recipients = v;
+                }
+                IOX2_OK
+            }
+            Err(e) => e.into_c_int(),
+        }
+    }
+}
+
 /// Updates all connections to new and obsolete subscriber ports and automatically delivery the history if
 /// requested.
 ///
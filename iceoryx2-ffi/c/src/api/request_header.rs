@@ -26,7 +26,7 @@ use crate::{
 #[repr(C)]
 #[repr(align(8))] // core::mem::align_of::<Option<RequestHeader>>()
 pub struct iox2_request_header_storage_t {
-    internal: [u8; 64], // core::mem::size_of::<Option<RequestHeader>>()
+    internal: [u8; 80], // core::mem::size_of::<Option<RequestHeader>>()
 }
 
 #[repr(C)]
@@ -90,6 +90,40 @@ impl HandleToType for iox2_request_header_h_ref {
 
 // BEGIN C API
 
+/// cbindgen:ignore
+/// Internal API - do not use
+/// # Safety
+///
+/// * `source_struct_ptr` must not be `null` and the struct it is pointing to must be initialized and valid, i.e. not moved or dropped.
+/// * `dest_struct_ptr` must not be `null` and the struct it is pointing to must not contain valid data, i.e. initialized. It can be moved or dropped, though.
+/// * `dest_handle_ptr` must not be `null`
+#[doc(hidden)]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_request_header_move(
+    source_struct_ptr: *mut iox2_request_header_t,
+    dest_struct_ptr: *mut iox2_request_header_t,
+    dest_handle_ptr: *mut iox2_request_header_h,
+) {
+    debug_assert!(!source_struct_ptr.is_null());
+    debug_assert!(!dest_struct_ptr.is_null());
+    debug_assert!(!dest_handle_ptr.is_null());
+    unsafe {
+        let source = &mut *source_struct_ptr;
+        let dest = &mut *dest_struct_ptr;
+
+        dest.value.init(
+            source
+                .value
+                .as_option_mut()
+                .take()
+                .expect("Source must have a valid request header"),
+        );
+        dest.deleter = source.deleter;
+
+        *dest_handle_ptr = (*dest_struct_ptr).as_handle();
+    }
+}
+
 /// This function needs to be called to destroy the request_header!
 ///
 /// # Safety
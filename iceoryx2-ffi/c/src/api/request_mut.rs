@@ -28,6 +28,7 @@ use iceoryx2_ffi_macros::{CStrRepr, iceoryx2_ffi};
 
 use core::ffi::{c_char, c_int, c_void};
 use core::mem::ManuallyDrop;
+use core::time::Duration;
 
 use super::iox2_pending_response_h;
 use super::iox2_pending_response_t;
@@ -47,6 +48,7 @@ pub enum iox2_request_send_error_e {
     EXCEEDS_MAX_ACTIVE_REQUESTS,
     UNABLE_TO_DELIVER,
     INTERNAL_ERROR,
+    FIRE_AND_FORGET_NOT_SUPPORTED,
 }
 
 impl IntoCInt for RequestSendError {
@@ -82,6 +84,9 @@ impl IntoCInt for RequestSendError {
             RequestSendError::SendError(SendError::InternalError) => {
                 iox2_request_send_error_e::INTERNAL_ERROR
             }
+            RequestSendError::FireAndForgetNotSupported => {
+                iox2_request_send_error_e::FIRE_AND_FORGET_NOT_SUPPORTED
+            }
         }) as c_int
     }
 }
@@ -348,6 +353,29 @@ pub unsafe extern "C" fn iox2_request_mut_user_header_mut(
     }
 }
 
+/// Sets the deadline of the request to the provided timeout from now.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_client_loan_slice_uninit()`](crate::iox2_client_loan_slice_uninit())
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_request_mut_set_deadline(
+    handle: iox2_request_mut_h_ref,
+    seconds: u64,
+    nanoseconds: u32,
+) {
+    handle.assert_non_null();
+    unsafe {
+        let request = &mut *handle.as_type();
+        let timeout = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+
+        match request.service_type {
+            iox2_service_type_e::IPC => request.value.as_mut().ipc.set_deadline(timeout),
+            iox2_service_type_e::LOCAL => request.value.as_mut().local.set_deadline(timeout),
+        }
+    }
+}
+
 /// Acquires the requests mutable payload.
 ///
 /// # Safety
@@ -517,6 +545,59 @@ pub unsafe extern "C" fn iox2_request_mut_send(
     }
 }
 
+/// Takes the ownership of the request and sends it without creating a pending response. The
+/// request does not count towards the active requests of the client.
+///
+/// # Arguments
+///
+/// * `handle` - A valid [`iox2_request_mut_h`]
+/// * `number_of_recipients` - Can be `NULL` or must point to a valid [`c_size_t`] to store the number
+///   of servers that received the request
+///
+/// Returns IOX2_OK on success, an [`iox2_request_send_error_e`] otherwise.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_client_loan_slice_uninit()`](crate::iox2_client_loan_slice_uninit())
+/// * The `handle` is invalid after the return of this function and leads to undefined behavior if used in another function call!
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_request_mut_send_and_forget(
+    handle: iox2_request_mut_h,
+    number_of_recipients: *mut c_size_t,
+) -> c_int {
+    debug_assert!(!handle.is_null());
+
+    unsafe {
+        let request_struct = &mut *handle.as_type();
+        let service_type = request_struct.service_type;
+        let request = request_struct
+            .value
+            .as_option_mut()
+            .take()
+            .unwrap_or_else(|| panic!("Trying to send an already sent request!"));
+        (request_struct.deleter)(request_struct);
+
+        let result = match service_type {
+            iox2_service_type_e::IPC => ManuallyDrop::into_inner(request.ipc)
+                .assume_init()
+                .send_and_forget(),
+            iox2_service_type_e::LOCAL => ManuallyDrop::into_inner(request.local)
+                .assume_init()
+                .send_and_forget(),
+        };
+
+        match result {
+            Ok(n) => {
+                if !number_of_recipients.is_null() {
+                    *number_of_recipients = n as c_size_t;
+                }
+                IOX2_OK
+            }
+            Err(e) => e.into_c_int(),
+        }
+    }
+}
+
 /// This function needs to be called to destroy the request!
 ///
 /// # Arguments
@@ -14,6 +14,7 @@
 
 use core::{ffi::c_int, ffi::c_void, mem::ManuallyDrop};
 
+use iceoryx2::response_mut::ResponseMut;
 use iceoryx2::response_mut_uninit::ResponseMutUninit;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
@@ -21,7 +22,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 use crate::{IOX2_OK, api::IntoCInt};
 
 use super::{
-    AssertNonNullHandle, HandleToType, UninitPayloadFfi, UserHeaderFfi, c_size_t,
+    AssertNonNullHandle, HandleToType, PayloadFfi, UninitPayloadFfi, UserHeaderFfi, c_size_t,
     iox2_response_header_h, iox2_response_header_t, iox2_service_type_e,
 };
 
@@ -73,6 +74,46 @@ impl iox2_response_mut_t {
         self.value.init(value);
         self.deleter = deleter;
     }
+
+    /// Takes the ownership of the contained ipc response and releases the struct with its deleter.
+    ///
+    /// # Safety
+    ///
+    /// * the struct must contain an initialized response of [`iox2_service_type_e::IPC`]
+    /// * the struct must not be accessed after this call
+    pub(super) unsafe fn take_ipc(
+        &mut self,
+    ) -> ResponseMut<crate::IpcService, PayloadFfi, UserHeaderFfi> {
+        debug_assert!(matches!(self.service_type, iox2_service_type_e::IPC));
+        let response = self
+            .value
+            .as_option_mut()
+            .take()
+            .unwrap_or_else(|| panic!("Trying to send an already sent response!"));
+        (self.deleter)(self);
+
+        unsafe { ManuallyDrop::into_inner(response.ipc).assume_init() }
+    }
+
+    /// Takes the ownership of the contained local response and releases the struct with its deleter.
+    ///
+    /// # Safety
+    ///
+    /// * the struct must contain an initialized response of [`iox2_service_type_e::LOCAL`]
+    /// * the struct must not be accessed after this call
+    pub(super) unsafe fn take_local(
+        &mut self,
+    ) -> ResponseMut<crate::LocalService, PayloadFfi, UserHeaderFfi> {
+        debug_assert!(matches!(self.service_type, iox2_service_type_e::LOCAL));
+        let response = self
+            .value
+            .as_option_mut()
+            .take()
+            .unwrap_or_else(|| panic!("Trying to send an already sent response!"));
+        (self.deleter)(self);
+
+        unsafe { ManuallyDrop::into_inner(response.local).assume_init() }
+    }
 }
 
 pub struct iox2_response_mut_h_t;
@@ -187,6 +187,63 @@ pub unsafe extern "C" fn iox2_sample_header(
     }
 }
 
+/// Copies the publisher id, the number of elements and the send timestamp out of the samples
+/// header without acquiring a [`iox2_publish_subscribe_header_h`].
+///
+/// # Arguments
+///
+/// * `handle` - obtained by [`iox2_subscriber_receive()`](crate::iox2_subscriber_receive())
+/// * `publisher_id_ptr` - Pointer to a buffer where the publisher id value will be written
+/// * `publisher_id_length` - The length of the buffer pointed to by `publisher_id_ptr`
+/// * `number_of_elements_ptr` - Pointer where the number of payload elements will be written
+/// * `send_timestamp_ptr` - Either a null pointer or a pointer where the send timestamp, in
+///   nanoseconds of the monotonic clock, will be written. It is 0 when the service does not
+///   enable send timestamps.
+///
+/// # Safety
+///
+/// * `handle` must be a valid, non-null pointer
+/// * `publisher_id_ptr` must be a valid, non-null pointer to a buffer of at least `publisher_id_length` bytes
+/// * `number_of_elements_ptr` must be a valid, non-null pointer to a [`u64`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_sample_header_view(
+    handle: iox2_sample_h_ref,
+    publisher_id_ptr: *mut u8,
+    publisher_id_length: c_size_t,
+    number_of_elements_ptr: *mut u64,
+    send_timestamp_ptr: *mut u64,
+) {
+    handle.assert_non_null();
+    debug_assert!(!publisher_id_ptr.is_null());
+    debug_assert!(!number_of_elements_ptr.is_null());
+    unsafe {
+        let sample = &mut *handle.as_type();
+
+        let header = match sample.service_type {
+            iox2_service_type_e::IPC => sample.value.as_mut().ipc.header(),
+            iox2_service_type_e::LOCAL => sample.value.as_mut().local.header(),
+        };
+
+        let bytes = header.publisher_id().value().to_ne_bytes();
+        debug_assert!(
+            bytes.len() <= publisher_id_length,
+            "publisher_id_length is too small"
+        );
+
+        core::ptr::copy_nonoverlapping(
+            bytes.as_ptr(),
+            publisher_id_ptr,
+            core::cmp::min(bytes.len(), publisher_id_length),
+        );
+        *number_of_elements_ptr = header.number_of_elements();
+        if !send_timestamp_ptr.is_null() {
+            *send_timestamp_ptr = header
+                .send_timestamp()
+                .map_or(0, |t| t.as_duration().as_nanos() as u64);
+        }
+    }
+}
+
 /// Acquires the samples user header.
 ///
 /// # Safety
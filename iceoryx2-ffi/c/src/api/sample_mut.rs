@@ -17,6 +17,7 @@ use crate::api::{
     iox2_publish_subscribe_header_h, iox2_publish_subscribe_header_t, iox2_service_type_e,
 };
 
+use iceoryx2::sample_mut::SampleMut;
 use iceoryx2::sample_mut_uninit::SampleMutUninit;
 use iceoryx2_bb_elementary::static_assert::*;
 use iceoryx2_ffi_macros::iceoryx2_ffi;
@@ -24,7 +25,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 use core::ffi::{c_int, c_void};
 use core::mem::ManuallyDrop;
 
-use super::UninitPayloadFfi;
+use super::{PayloadFfi, UninitPayloadFfi};
 
 // BEGIN types definition
 
@@ -75,6 +76,46 @@ impl iox2_sample_mut_t {
         self.value.init(value);
         self.deleter = deleter;
     }
+
+    /// Takes the ownership of the contained IPC sample and releases the struct with its deleter.
+    ///
+    /// # Safety
+    ///
+    /// * the struct must contain an initialized sample of [`iox2_service_type_e::IPC`]
+    /// * the struct must not be accessed after this call
+    pub(super) unsafe fn take_ipc(
+        &mut self,
+    ) -> SampleMut<crate::IpcService, PayloadFfi, UserHeaderFfi> {
+        debug_assert!(matches!(self.service_type, iox2_service_type_e::IPC));
+        let sample = self
+            .value
+            .as_option_mut()
+            .take()
+            .unwrap_or_else(|| panic!("Trying to send an already sent sample!"));
+        (self.deleter)(self);
+
+        unsafe { ManuallyDrop::into_inner(sample.ipc).assume_init() }
+    }
+
+    /// Takes the ownership of the contained local sample and releases the struct with its deleter.
+    ///
+    /// # Safety
+    ///
+    /// * the struct must contain an initialized sample of [`iox2_service_type_e::LOCAL`]
+    /// * the struct must not be accessed after this call
+    pub(super) unsafe fn take_local(
+        &mut self,
+    ) -> SampleMut<crate::LocalService, PayloadFfi, UserHeaderFfi> {
+        debug_assert!(matches!(self.service_type, iox2_service_type_e::LOCAL));
+        let sample = self
+            .value
+            .as_option_mut()
+            .take()
+            .unwrap_or_else(|| panic!("Trying to send an already sent sample!"));
+        (self.deleter)(self);
+
+        unsafe { ManuallyDrop::into_inner(sample.local).assume_init() }
+    }
 }
 
 pub struct iox2_sample_mut_h_t;
@@ -216,6 +257,26 @@ pub unsafe extern "C" fn iox2_sample_mut_header(
     }
 }
 
+/// Sets the priority of the sample. When the service has multiple priority lanes, see
+/// [`iox2_service_builder_pub_sub_set_priority_lanes()`](crate::iox2_service_builder_pub_sub_set_priority_lanes),
+/// the sample is received before all samples with a lower priority.
+///
+/// # Safety
+///
+/// * `handle` obtained by [`iox2_publisher_loan_slice_uninit()`](crate::iox2_publisher_loan_slice_uninit())
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_sample_mut_set_priority(handle: iox2_sample_mut_h_ref, value: u8) {
+    handle.assert_non_null();
+    unsafe {
+        let sample = &mut *handle.as_type();
+
+        match sample.service_type {
+            iox2_service_type_e::IPC => sample.value.as_mut().ipc.set_priority(value),
+            iox2_service_type_e::LOCAL => sample.value.as_mut().local.set_priority(value),
+        };
+    }
+}
+
 /// Acquires the samples mutable user header.
 ///
 /// # Safety
@@ -13,6 +13,7 @@
 #![allow(non_camel_case_types)]
 
 use crate::IOX2_OK;
+use crate::api::port_statistics::iox2_port_statistics_t;
 use crate::api::{ActiveRequestUnion, IntoCInt};
 
 use super::{
@@ -164,6 +165,36 @@ pub unsafe extern "C" fn iox2_server_id(
     }
 }
 
+/// Stores the counters of the server in the provided `statistics`, see
+/// [`PortStatistics`](iceoryx2::port::statistics::PortStatistics).
+///
+/// # Arguments
+///
+/// * `handle` obtained by [`iox2_port_factory_server_builder_create`](crate::iox2_port_factory_server_builder_create)
+/// * `statistics` - A valid pointer to a [`iox2_port_statistics_t`]
+///
+/// # Safety
+///
+/// * `handle` is valid, non-null and was obtained via [`iox2_port_factory_server_builder_create`](crate::iox2_port_factory_server_builder_create)
+/// * `statistics` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_server_statistics(
+    handle: iox2_server_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+
+    unsafe {
+        let server = &mut *handle.as_type();
+
+        *statistics = match server.service_type {
+            iox2_service_type_e::IPC => server.value.as_ref().ipc.statistics().into(),
+            iox2_service_type_e::LOCAL => server.value.as_ref().local.statistics().into(),
+        };
+    }
+}
+
 /// Returns true when the server has requests that can be acquired with [`iox2_server_receive`], otherwise false.
 ///
 /// # Arguments
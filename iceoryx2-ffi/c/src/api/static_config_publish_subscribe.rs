@@ -26,6 +26,8 @@ pub struct iox2_static_config_publish_subscribe_t {
     pub subscriber_max_buffer_size: usize,
     pub subscriber_max_borrowed_samples: usize,
     pub enable_safe_overflow: bool,
+    pub enable_send_timestamps: bool,
+    pub number_of_priority_lanes: usize,
     pub message_type_details: iox2_message_type_details_t,
 }
 
@@ -39,6 +41,8 @@ impl From<&StaticConfig> for iox2_static_config_publish_subscribe_t {
             subscriber_max_buffer_size: c.subscriber_max_buffer_size(),
             subscriber_max_borrowed_samples: c.subscriber_max_borrowed_samples(),
             enable_safe_overflow: c.has_safe_overflow(),
+            enable_send_timestamps: c.has_send_timestamps(),
+            number_of_priority_lanes: c.number_of_priority_lanes(),
             message_type_details: c.message_type_details().into(),
         }
     }
@@ -12,6 +12,7 @@
 
 #![allow(non_camel_case_types)]
 
+use crate::api::port_statistics::iox2_port_statistics_t;
 use crate::api::{
     AssertNonNullHandle, HandleToType, IOX2_OK, IntoCInt, PayloadFfi, SampleUnion, UserHeaderFfi,
     c_size_t, iox2_sample_h, iox2_sample_t, iox2_service_type_e, iox2_unique_subscriber_id_h,
@@ -228,6 +229,32 @@ pub unsafe extern "C" fn iox2_subscriber_buffer_size(
     }
 }
 
+/// Returns the number of samples the subscriber lost since it was created. The loss is detected
+/// with the sequence numbers of the received samples.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+///
+/// # Safety
+///
+/// * `subscriber_handle` must be valid handles
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_subscriber_lost_samples(
+    subscriber_handle: iox2_subscriber_h_ref,
+) -> u64 {
+    subscriber_handle.assert_non_null();
+    unsafe {
+        let subscriber = &mut *subscriber_handle.as_type();
+
+        match subscriber.service_type {
+            iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.lost_samples(),
+            iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.lost_samples(),
+        }
+    }
+}
+
 /// Returns the unique port id of the subscriber.
 ///
 /// # Arguments
@@ -271,6 +298,36 @@ pub unsafe extern "C" fn iox2_subscriber_id(
     }
 }
 
+/// Stores the counters of the subscriber in the provided `statistics`, see
+/// [`PortStatistics`](iceoryx2::port::statistics::PortStatistics).
+///
+/// # Arguments
+///
+/// * `subscriber_handle` obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `statistics` - A valid pointer to a [`iox2_port_statistics_t`]
+///
+/// # Safety
+///
+/// * `subscriber_handle` is valid, non-null and was obtained via [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `statistics` is valid and non-null
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_subscriber_statistics(
+    subscriber_handle: iox2_subscriber_h_ref,
+    statistics: *mut iox2_port_statistics_t,
+) {
+    subscriber_handle.assert_non_null();
+    debug_assert!(!statistics.is_null());
+
+    unsafe {
+        let subscriber = &mut *subscriber_handle.as_type();
+
+        *statistics = match subscriber.service_type {
+            iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.statistics().into(),
+            iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.statistics().into(),
+        };
+    }
+}
+
 // TODO [#210] add all the other setter methods
 
 /// Takes a sample ouf of the subscriber queue.
@@ -354,6 +411,98 @@ pub unsafe extern "C" fn iox2_subscriber_receive(
     }
 }
 
+/// Takes up to `number_of_slots` samples out of the subscriber queue with a single call.
+///
+/// # Arguments
+///
+/// * `subscriber_handle` - Must be a valid [`iox2_subscriber_h_ref`]
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create).
+/// * `sample_struct_ptrs` - Must point to an array of `number_of_slots` pointers to valid [`iox2_sample_t`].
+///   In contrast to [`iox2_subscriber_receive`], NULL pointers are not allowed since the
+///   batch shall be received without any heap allocation.
+/// * `sample_handle_ptrs` - Must point to an array of `number_of_slots` pointers to [`iox2_sample_h`].
+///   The first `*number_of_received_samples` handles will be initialized, the remaining ones
+///   are set to NULL.
+/// * `number_of_slots` - The maximum number of samples that shall be received.
+/// * `number_of_received_samples` - A non-null pointer that will contain the number of
+///   received samples.
+///
+/// Returns IOX2_OK on success, an [`iox2_receive_error_e`] otherwise. When an error occurs after
+/// at least one sample was received, the batch ends early and IOX2_OK is returned together with
+/// the already received samples. The error itself is not stored, it is caused by the state of
+/// the subscriber and occurs again on the next receive call when the cause persists, e.g. when
+/// the already received samples are still borrowed.
+///
+/// # Safety
+///
+/// * The `subscriber_handle` is still valid after the return of this function and can be use in another function call.
+/// * `sample_struct_ptrs` and `sample_handle_ptrs` point to arrays with at least `number_of_slots` valid, non-null entries.
+/// * `number_of_received_samples` is pointing to a valid [`c_size_t`].
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_subscriber_receive_batch(
+    subscriber_handle: iox2_subscriber_h_ref,
+    sample_struct_ptrs: *const *mut iox2_sample_t,
+    sample_handle_ptrs: *const *mut iox2_sample_h,
+    number_of_slots: c_size_t,
+    number_of_received_samples: *mut c_size_t,
+) -> c_int {
+    subscriber_handle.assert_non_null();
+    debug_assert!(!sample_struct_ptrs.is_null() || number_of_slots == 0);
+    debug_assert!(!sample_handle_ptrs.is_null() || number_of_slots == 0);
+    debug_assert!(!number_of_received_samples.is_null());
+
+    fn no_op(_: *mut iox2_sample_t) {}
+
+    unsafe {
+        *number_of_received_samples = 0;
+        for n in 0..number_of_slots {
+            let sample_handle_ptr = *sample_handle_ptrs.add(n);
+            debug_assert!(!sample_handle_ptr.is_null());
+            *sample_handle_ptr = core::ptr::null_mut();
+        }
+
+        let subscriber = &mut *subscriber_handle.as_type();
+
+        for n in 0..number_of_slots {
+            let sample_struct_ptr = *sample_struct_ptrs.add(n);
+            let sample_handle_ptr = *sample_handle_ptrs.add(n);
+            debug_assert!(!sample_struct_ptr.is_null());
+
+            let sample = match subscriber.service_type {
+                iox2_service_type_e::IPC => subscriber
+                    .value
+                    .as_ref()
+                    .ipc
+                    .receive_custom_payload()
+                    .map(|s| s.map(SampleUnion::new_ipc)),
+                iox2_service_type_e::LOCAL => subscriber
+                    .value
+                    .as_ref()
+                    .local
+                    .receive_custom_payload()
+                    .map(|s| s.map(SampleUnion::new_local)),
+            };
+
+            match sample {
+                Ok(Some(sample)) => {
+                    (*sample_struct_ptr).init(subscriber.service_type, sample, no_op);
+                    *sample_handle_ptr = (*sample_struct_ptr).as_handle();
+                    *number_of_received_samples = n + 1;
+                }
+                Ok(None) => break,
+                Err(error) => {
+                    if n == 0 {
+                        return error.into_c_int();
+                    }
+                    break;
+                }
+            }
+        }
+
+        IOX2_OK
+    }
+}
+
 /// Returns true when the subscriber has samples that can be acquired with [`iox2_subscriber_receive`], otherwise false.
 ///
 /// # Arguments
@@ -398,6 +547,71 @@ pub unsafe extern "C" fn iox2_subscriber_has_samples(
     }
 }
 
+/// Checks the `number_of_subscribers` subscribers for samples that can be acquired with
+/// [`iox2_subscriber_receive`] in one call. Bit `i % 64` of the word `i / 64` in
+/// `ready_subscribers_ptr` is set when the i-th subscriber has samples and cleared otherwise.
+/// The number of subscribers with samples is stored in `number_of_ready_subscribers_ptr`.
+///
+/// Returns IOX2_OK on success, an [`iox2_connection_failure_e`] of the first subscriber that
+/// failed otherwise.
+///
+/// # Safety
+///
+/// * `subscriber_handles_ptr` a valid, non-null pointer to `number_of_subscribers` handles
+///   obtained by [`iox2_port_factory_subscriber_builder_create`](crate::iox2_port_factory_subscriber_builder_create)
+/// * `ready_subscribers_ptr` a valid, non-null pointer to `number_of_subscribers.div_ceil(64)`
+///   [`u64`]
+/// * `number_of_ready_subscribers_ptr` a valid, non-null pointer to a [`c_size_t`]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_subscriber_has_samples_batch(
+    subscriber_handles_ptr: *const iox2_subscriber_h,
+    number_of_subscribers: c_size_t,
+    ready_subscribers_ptr: *mut u64,
+    number_of_ready_subscribers_ptr: *mut c_size_t,
+) -> c_int {
+    const BITS_PER_WORD: usize = u64::BITS as usize;
+
+    debug_assert!(!number_of_ready_subscribers_ptr.is_null());
+    unsafe { *number_of_ready_subscribers_ptr = 0 };
+    if number_of_subscribers == 0 {
+        return IOX2_OK;
+    }
+
+    debug_assert!(!subscriber_handles_ptr.is_null());
+    debug_assert!(!ready_subscribers_ptr.is_null());
+    unsafe {
+        let subscriber_handles =
+            core::slice::from_raw_parts(subscriber_handles_ptr, number_of_subscribers);
+        let ready_subscribers = core::slice::from_raw_parts_mut(
+            ready_subscribers_ptr,
+            number_of_subscribers.div_ceil(BITS_PER_WORD),
+        );
+
+        ready_subscribers.fill(0);
+        let mut number_of_ready_subscribers = 0;
+        for (i, subscriber_handle) in subscriber_handles.iter().enumerate() {
+            let subscriber = &*(*subscriber_handle).as_type();
+
+            let has_samples = match subscriber.service_type {
+                iox2_service_type_e::IPC => subscriber.value.as_ref().ipc.has_samples(),
+                iox2_service_type_e::LOCAL => subscriber.value.as_ref().local.has_samples(),
+            };
+
+            match has_samples {
+                Ok(true) => {
+                    ready_subscribers[i / BITS_PER_WORD] |= 1 << (i % BITS_PER_WORD);
+                    number_of_ready_subscribers += 1;
+                }
+                Ok(false) => (),
+                Err(error) => return error.into_c_int(),
+            }
+        }
+
+        *number_of_ready_subscribers_ptr = number_of_ready_subscribers;
+        IOX2_OK
+    }
+}
+
 /// This function needs to be called to destroy the subscriber!
 ///
 /// # Arguments
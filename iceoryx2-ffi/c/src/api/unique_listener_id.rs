@@ -86,6 +86,40 @@ impl HandleToType for iox2_unique_listener_id_h_ref {
 
 // BEGIN C API
 
+/// cbindgen:ignore
+/// Internal API - do not use
+/// # Safety
+///
+/// * `source_struct_ptr` must not be `null` and the struct it is pointing to must be initialized and valid, i.e. not moved or dropped.
+/// * `dest_struct_ptr` must not be `null` and the struct it is pointing to must not contain valid data, i.e. initialized. It can be moved or dropped, though.
+/// * `dest_handle_ptr` must not be `null`
+#[doc(hidden)]
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_unique_listener_id_move(
+    source_struct_ptr: *mut iox2_unique_listener_id_t,
+    dest_struct_ptr: *mut iox2_unique_listener_id_t,
+    dest_handle_ptr: *mut iox2_unique_listener_id_h,
+) {
+    debug_assert!(!source_struct_ptr.is_null());
+    debug_assert!(!dest_struct_ptr.is_null());
+    debug_assert!(!dest_handle_ptr.is_null());
+    unsafe {
+        let source = &mut *source_struct_ptr;
+        let dest = &mut *dest_struct_ptr;
+
+        dest.value.init(
+            source
+                .value
+                .as_option_mut()
+                .take()
+                .expect("Source must have a valid unique listener id"),
+        );
+        dest.deleter = source.deleter;
+
+        *dest_handle_ptr = (*dest_struct_ptr).as_handle();
+    }
+}
+
 /// Retrieves the value of a unique listener ID.
 ///
 /// # Arguments
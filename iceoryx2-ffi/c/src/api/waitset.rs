@@ -17,6 +17,7 @@ use core::{ffi::c_char, ffi::c_int, mem::ManuallyDrop, time::Duration};
 use crate::{
     AttachmentIdUnion, GuardUnion, IOX2_OK, c_size_t, iox2_callback_context,
     iox2_callback_progression_e, iox2_file_descriptor_ptr, iox2_service_type_e,
+    iox2_waitset_attachment_id_batch_ptr, iox2_waitset_attachment_id_batch_t,
     iox2_waitset_attachment_id_h, iox2_waitset_attachment_id_t, iox2_waitset_guard_h,
     iox2_waitset_guard_t,
 };
@@ -87,6 +88,7 @@ pub enum iox2_waitset_attachment_error_e {
     ALREADY_ATTACHED,
     INTERNAL_ERROR,
     INSUFFICIENT_RESOURCES,
+    NO_WAKE_UP_CHANNEL,
 }
 
 impl IntoCInt for WaitSetAttachmentError {
@@ -104,6 +106,9 @@ impl IntoCInt for WaitSetAttachmentError {
             WaitSetAttachmentError::InsufficientResources => {
                 iox2_waitset_attachment_error_e::INSUFFICIENT_RESOURCES
             }
+            WaitSetAttachmentError::NoWakeUpChannel => {
+                iox2_waitset_attachment_error_e::NO_WAKE_UP_CHANNEL
+            }
         }) as c_int
     }
 }
@@ -148,7 +153,7 @@ impl WaitSetUnion {
 #[repr(C)]
 #[repr(align(16))] // alignment of Option<WaitSetUnion>
 pub struct iox2_waitset_storage_t {
-    internal: [u8; 784], // magic number obtained with size_of::<Option<WaitSetUnion>>()
+    internal: [u8; 960], // magic number obtained with size_of::<Option<WaitSetUnion>>()
 }
 
 #[repr(C)]
@@ -213,6 +218,11 @@ pub type iox2_waitset_run_callback = extern "C" fn(
     iox2_waitset_attachment_id_h,
     iox2_callback_context,
 ) -> iox2_callback_progression_e;
+
+pub type iox2_waitset_run_batch_callback = extern "C" fn(
+    iox2_waitset_attachment_id_batch_ptr,
+    iox2_callback_context,
+) -> iox2_callback_progression_e;
 // END type definition
 
 // BEGIN C API
@@ -893,4 +903,165 @@ pub unsafe extern "C" fn iox2_waitset_wait_and_process(
     }
 }
 
+unsafe fn wait_and_process_batch_once(
+    handle: iox2_waitset_h_ref,
+    callback: iox2_waitset_run_batch_callback,
+    callback_ctx: iox2_callback_context,
+    timeout: Duration,
+    result: *mut iox2_waitset_run_result_e,
+) -> c_int {
+    handle.assert_non_null();
+    debug_assert!(!result.is_null());
+    unsafe {
+        let waitset = &mut *handle.as_type();
+
+        let run_once_result = match waitset.service_type {
+            iox2_service_type_e::IPC => waitset
+                .value
+                .as_ref()
+                .ipc
+                .wait_and_process_batch_once_with_timeout(
+                    |attachment_ids| {
+                        let batch = iox2_waitset_attachment_id_batch_t::new_ipc(attachment_ids);
+                        callback(&batch, callback_ctx).into()
+                    },
+                    timeout,
+                ),
+            iox2_service_type_e::LOCAL => waitset
+                .value
+                .as_ref()
+                .local
+                .wait_and_process_batch_once_with_timeout(
+                    |attachment_ids| {
+                        let batch = iox2_waitset_attachment_id_batch_t::new_local(attachment_ids);
+                        callback(&batch, callback_ctx).into()
+                    },
+                    timeout,
+                ),
+        };
+
+        match run_once_result {
+            Ok(v) => {
+                *result = v.into();
+                IOX2_OK
+            }
+            Err(e) => e.into_c_int(),
+        }
+    }
+}
+
+/// Like [`iox2_waitset_wait_and_process_once()`] but all attachment ids of the wake up are
+/// provided together to one `callback` call via a [`iox2_waitset_attachment_id_batch_ptr`].
+/// The batch is backed by a buffer of the [`iox2_waitset_h`] and no attachment id handle is
+/// allocated. When no event arrived, the `callback` is not called.
+///
+/// # Return
+///
+/// `IOX2_OK` on success, otherwise [`iox2_waitset_run_error_e`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * the provided [`iox2_waitset_attachment_id_batch_ptr`] must not be used after the
+///    `callback` returned
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_wait_and_process_batch_once(
+    handle: iox2_waitset_h_ref,
+    callback: iox2_waitset_run_batch_callback,
+    callback_ctx: iox2_callback_context,
+    result: *mut iox2_waitset_run_result_e,
+) -> c_int {
+    unsafe { wait_and_process_batch_once(handle, callback, callback_ctx, Duration::MAX, result) }
+}
+
+/// Like [`iox2_waitset_wait_and_process_once_with_timeout()`] but all attachment ids of the
+/// wake up are provided together to one `callback` call via a
+/// [`iox2_waitset_attachment_id_batch_ptr`]. The batch is backed by a buffer of the
+/// [`iox2_waitset_h`] and no attachment id handle is allocated. When no event arrived, the
+/// `callback` is not called.
+///
+/// # Return
+///
+/// `IOX2_OK` on success, otherwise [`iox2_waitset_run_error_e`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * the provided [`iox2_waitset_attachment_id_batch_ptr`] must not be used after the
+///    `callback` returned
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_wait_and_process_batch_once_with_timeout(
+    handle: iox2_waitset_h_ref,
+    callback: iox2_waitset_run_batch_callback,
+    callback_ctx: iox2_callback_context,
+    seconds: u64,
+    nanoseconds: u32,
+    result: *mut iox2_waitset_run_result_e,
+) -> c_int {
+    let timeout = Duration::from_secs(seconds) + Duration::from_nanos(nanoseconds as u64);
+    unsafe { wait_and_process_batch_once(handle, callback, callback_ctx, timeout, result) }
+}
+
+/// Like [`iox2_waitset_wait_and_process()`] but all attachment ids of a wake up are
+/// provided together to one `callback` call via a [`iox2_waitset_attachment_id_batch_ptr`].
+/// The infinite loop is interrupted either by a `SIGINT` or `SIGTERM` signal or
+/// when the user callback returned [`iox2_callback_progression_e::STOP`].
+///
+/// # Return
+///
+/// `IOX2_OK` on success, otherwise [`iox2_waitset_run_error_e`].
+///
+/// # Safety
+///
+///  * `handle` must be valid and acquired with
+///    [`iox2_waitset_builder_create()`](crate::iox2_waitset_builder_create())
+///  * the provided [`iox2_waitset_attachment_id_batch_ptr`] must not be used after the
+///    `callback` returned
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_wait_and_process_batch(
+    handle: iox2_waitset_h_ref,
+    callback: iox2_waitset_run_batch_callback,
+    callback_ctx: iox2_callback_context,
+    result: *mut iox2_waitset_run_result_e,
+) -> c_int {
+    handle.assert_non_null();
+    debug_assert!(!result.is_null());
+    unsafe {
+        let waitset = &mut *handle.as_type();
+
+        let run_result = match waitset.service_type {
+            iox2_service_type_e::IPC => {
+                waitset
+                    .value
+                    .as_ref()
+                    .ipc
+                    .wait_and_process_batch(|attachment_ids| {
+                        let batch = iox2_waitset_attachment_id_batch_t::new_ipc(attachment_ids);
+                        callback(&batch, callback_ctx).into()
+                    })
+            }
+            iox2_service_type_e::LOCAL => {
+                waitset
+                    .value
+                    .as_ref()
+                    .local
+                    .wait_and_process_batch(|attachment_ids| {
+                        let batch = iox2_waitset_attachment_id_batch_t::new_local(attachment_ids);
+                        callback(&batch, callback_ctx).into()
+                    })
+            }
+        };
+
+        match run_result {
+            Ok(v) => {
+                (*result) = v.into();
+                IOX2_OK
+            }
+            Err(e) => e.into_c_int(),
+        }
+    }
+}
+
 // END C API
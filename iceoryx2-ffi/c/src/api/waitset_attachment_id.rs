@@ -107,6 +107,45 @@ impl HandleToType for iox2_waitset_attachment_id_h_ref {
         unsafe { *self as *mut _ as _ }
     }
 }
+/// A borrowed view of all [`WaitSetAttachmentId`]s of one wake up of the WaitSet. It is only
+/// valid inside the batch callback it was provided to.
+pub struct iox2_waitset_attachment_id_batch_t {
+    service_type: iox2_service_type_e,
+    ipc: *const WaitSetAttachmentId<crate::IpcService>,
+    local: *const WaitSetAttachmentId<crate::LocalService>,
+    len: usize,
+}
+
+impl iox2_waitset_attachment_id_batch_t {
+    pub(crate) fn new_ipc(ids: &[WaitSetAttachmentId<crate::IpcService>]) -> Self {
+        Self {
+            service_type: iox2_service_type_e::IPC,
+            ipc: ids.as_ptr(),
+            local: core::ptr::null(),
+            len: ids.len(),
+        }
+    }
+
+    pub(crate) fn new_local(ids: &[WaitSetAttachmentId<crate::LocalService>]) -> Self {
+        Self {
+            service_type: iox2_service_type_e::LOCAL,
+            ipc: core::ptr::null(),
+            local: ids.as_ptr(),
+            len: ids.len(),
+        }
+    }
+
+    unsafe fn ipc(&self) -> &[WaitSetAttachmentId<crate::IpcService>] {
+        unsafe { core::slice::from_raw_parts(self.ipc, self.len) }
+    }
+
+    unsafe fn local(&self) -> &[WaitSetAttachmentId<crate::LocalService>] {
+        unsafe { core::slice::from_raw_parts(self.local, self.len) }
+    }
+}
+
+/// The immutable pointer to a [`iox2_waitset_attachment_id_batch_t`].
+pub type iox2_waitset_attachment_id_batch_ptr = *const iox2_waitset_attachment_id_batch_t;
 // END type definition
 
 // BEGIN C API
@@ -311,6 +350,140 @@ pub unsafe extern "C" fn iox2_waitset_attachment_id_from_guard(
     }
 }
 
+/// Returns the number of [`WaitSetAttachmentId`]s that are contained in the batch.
+///
+/// # Safety
+///  * `batch` must be valid and non-null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_attachment_id_batch_len(
+    batch: iox2_waitset_attachment_id_batch_ptr,
+) -> c_size_t {
+    debug_assert!(!batch.is_null());
+    unsafe { (*batch).len }
+}
+
+/// Checks if the event corresponding to [`iox2_waitset_guard_h_ref`] was originating from the
+/// attachment id at position `index` of the batch.
+///
+/// # Safety
+///  * `batch` must be valid and non-null.
+///  * `index` must be less than [`iox2_waitset_attachment_id_batch_len()`].
+///  * `guard` must be valid and non-null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_attachment_id_batch_has_event_from(
+    batch: iox2_waitset_attachment_id_batch_ptr,
+    index: c_size_t,
+    guard: iox2_waitset_guard_h_ref,
+) -> bool {
+    debug_assert!(!batch.is_null());
+    guard.assert_non_null();
+    unsafe {
+        let batch = &*batch;
+        let guard = &*guard.as_type();
+        debug_assert!(index < batch.len);
+
+        match batch.service_type {
+            iox2_service_type_e::IPC => {
+                batch.ipc()[index].has_event_from(&*guard.value.as_ref().ipc)
+            }
+            iox2_service_type_e::LOCAL => {
+                batch.local()[index].has_event_from(&*guard.value.as_ref().local)
+            }
+        }
+    }
+}
+
+/// Checks if the deadline corresponding to [`iox2_waitset_guard_h_ref`] was missed according
+/// to the attachment id at position `index` of the batch.
+///
+/// # Safety
+///  * `batch` must be valid and non-null.
+///  * `index` must be less than [`iox2_waitset_attachment_id_batch_len()`].
+///  * `guard` must be valid and non-null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_attachment_id_batch_has_missed_deadline(
+    batch: iox2_waitset_attachment_id_batch_ptr,
+    index: c_size_t,
+    guard: iox2_waitset_guard_h_ref,
+) -> bool {
+    debug_assert!(!batch.is_null());
+    guard.assert_non_null();
+    unsafe {
+        let batch = &*batch;
+        let guard = &*guard.as_type();
+        debug_assert!(index < batch.len);
+
+        match batch.service_type {
+            iox2_service_type_e::IPC => {
+                batch.ipc()[index].has_missed_deadline(&*guard.value.as_ref().ipc)
+            }
+            iox2_service_type_e::LOCAL => {
+                batch.local()[index].has_missed_deadline(&*guard.value.as_ref().local)
+            }
+        }
+    }
+}
+
+/// Checks if any attachment id of the batch has an event that was originating from the
+/// attachment corresponding to [`iox2_waitset_guard_h_ref`].
+///
+/// # Safety
+///  * `batch` must be valid and non-null.
+///  * `guard` must be valid and non-null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_attachment_id_batch_contains_event_from(
+    batch: iox2_waitset_attachment_id_batch_ptr,
+    guard: iox2_waitset_guard_h_ref,
+) -> bool {
+    debug_assert!(!batch.is_null());
+    guard.assert_non_null();
+    unsafe {
+        let batch = &*batch;
+        let guard = &*guard.as_type();
+
+        match batch.service_type {
+            iox2_service_type_e::IPC => {
+                let guard = &*guard.value.as_ref().ipc;
+                batch.ipc().iter().any(|id| id.has_event_from(guard))
+            }
+            iox2_service_type_e::LOCAL => {
+                let guard = &*guard.value.as_ref().local;
+                batch.local().iter().any(|id| id.has_event_from(guard))
+            }
+        }
+    }
+}
+
+/// Checks if any attachment id of the batch reports a missed deadline of the attachment
+/// corresponding to [`iox2_waitset_guard_h_ref`].
+///
+/// # Safety
+///  * `batch` must be valid and non-null.
+///  * `guard` must be valid and non-null.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn iox2_waitset_attachment_id_batch_contains_missed_deadline(
+    batch: iox2_waitset_attachment_id_batch_ptr,
+    guard: iox2_waitset_guard_h_ref,
+) -> bool {
+    debug_assert!(!batch.is_null());
+    guard.assert_non_null();
+    unsafe {
+        let batch = &*batch;
+        let guard = &*guard.as_type();
+
+        match batch.service_type {
+            iox2_service_type_e::IPC => {
+                let guard = &*guard.value.as_ref().ipc;
+                batch.ipc().iter().any(|id| id.has_missed_deadline(guard))
+            }
+            iox2_service_type_e::LOCAL => {
+                let guard = &*guard.value.as_ref().local;
+                batch.local().iter().any(|id| id.has_missed_deadline(guard))
+            }
+        }
+    }
+}
+
 /// Stores the debug output in the provided `debug_output` variable that must provide enough
 /// memory to store the content. The content length can be acquired with
 /// [`iox2_waitset_attachment_id_debug_len()`]
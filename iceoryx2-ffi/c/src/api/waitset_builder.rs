@@ -26,7 +26,7 @@ use iceoryx2_ffi_macros::iceoryx2_ffi;
 #[repr(C)]
 #[repr(align(1))] // alignment of Option<WaitSetBuilder>
 pub struct iox2_waitset_builder_storage_t {
-    internal: [u8; 1], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
+    internal: [u8; 2], // magic number obtained with size_of::<Option<WaitSetBuilder>>()
 }
 
 #[repr(C)]
@@ -25,6 +25,9 @@ pub enum AllocationStrategy {
     PowerOfTwo,
     /// The memory is not increased. This may lead to an out-of-memory error when allocating.
     Static,
+    /// Keeps one memory segment for every power of two chunk size and serves every allocation
+    /// from the smallest fitting size class.
+    SizeClasses,
 }
 
 #[pymethods]
@@ -40,6 +43,7 @@ impl From<iceoryx2::prelude::AllocationStrategy> for AllocationStrategy {
             iceoryx2::prelude::AllocationStrategy::Static => AllocationStrategy::Static,
             iceoryx2::prelude::AllocationStrategy::BestFit => AllocationStrategy::BestFit,
             iceoryx2::prelude::AllocationStrategy::PowerOfTwo => AllocationStrategy::PowerOfTwo,
+            iceoryx2::prelude::AllocationStrategy::SizeClasses => AllocationStrategy::SizeClasses,
         }
     }
 }
@@ -50,6 +54,7 @@ impl From<AllocationStrategy> for iceoryx2::prelude::AllocationStrategy {
             AllocationStrategy::Static => iceoryx2::prelude::AllocationStrategy::Static,
             AllocationStrategy::BestFit => iceoryx2::prelude::AllocationStrategy::BestFit,
             AllocationStrategy::PowerOfTwo => iceoryx2::prelude::AllocationStrategy::PowerOfTwo,
+            AllocationStrategy::SizeClasses => iceoryx2::prelude::AllocationStrategy::SizeClasses,
         }
     }
 }
@@ -31,4 +31,11 @@ impl EventActivation {
     pub fn count(&self) -> u64 {
         self.0.count
     }
+
+    #[getter]
+    /// Returns the latest value that was attached to the `EventId` with
+    /// `Notifier.notify_with_value()`
+    pub fn value(&self) -> u64 {
+        self.0.value
+    }
 }
@@ -12,7 +12,9 @@
 
 use pyo3::prelude::*;
 
-use crate::{unique_node_id::UniqueNodeId, unique_publisher_id::UniquePublisherId};
+use crate::{
+    duration::Duration, unique_node_id::UniqueNodeId, unique_publisher_id::UniquePublisherId,
+};
 
 #[pyclass(eq)]
 #[derive(PartialEq, Eq)]
@@ -38,4 +40,24 @@ impl HeaderPublishSubscribe {
     pub fn number_of_elements(&self) -> u64 {
         self.0.number_of_elements()
     }
+
+    #[getter]
+    /// Returns the sequence number of the `Sample`. Every `Publisher` numbers its sent samples
+    /// consecutively, starting from 0.
+    pub fn sequence_number(&self) -> u64 {
+        self.0.sequence_number()
+    }
+
+    #[getter]
+    /// Returns the monotonic clock time at which the `Sample` was sent. If the `Service`
+    /// does not enable send timestamps it returns `None`.
+    pub fn send_timestamp(&self) -> Option<Duration> {
+        self.0.send_timestamp().map(|t| Duration(t.as_duration()))
+    }
+
+    #[getter]
+    /// Returns the priority of the `Sample`.
+    pub fn priority(&self) -> u8 {
+        self.0.priority()
+    }
 }
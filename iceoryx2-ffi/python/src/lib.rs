@@ -61,6 +61,7 @@ pub mod port_factory_subscriber;
 pub mod port_factory_writer;
 pub mod publisher;
 pub mod reader;
+pub mod receive_policy;
 pub mod request_header;
 pub mod request_mut;
 pub mod request_mut_uninit;
@@ -177,6 +178,7 @@ fn _iceoryx2(py: Python<'_>, m: &Bound<'_, PyModule>) -> PyResult<()> {
     m.add_class::<crate::port_factory_writer::PortFactoryWriter>()?;
     m.add_class::<crate::publisher::Publisher>()?;
     m.add_class::<crate::reader::Reader>()?;
+    m.add_class::<crate::receive_policy::ReceivePolicy>()?;
     m.add_class::<crate::request_header::RequestHeader>()?;
     m.add_class::<crate::request_mut::RequestMut>()?;
     m.add_class::<crate::request_mut_uninit::RequestMutUninit>()?;
@@ -85,6 +85,42 @@ impl Notifier {
         }
     }
 
+    /// Notifies all `Listener` connected to the service with all provided `EventId`s at once.
+    /// Every `Listener` is woken up only once, no matter how many `EventId`s are provided.
+    /// Returns on success the number of `Listener`s that were notified otherwise it returns
+    /// `NotifierNotifyError`.
+    pub fn notify_multiple(&self, event_ids: Vec<PyRef<'_, EventId>>) -> PyResult<usize> {
+        let event_ids: Vec<_> = event_ids.iter().map(|event_id| event_id.0).collect();
+        match &self.0 {
+            NotifierType::Ipc(Some(v)) => Ok(v
+                .notify_multiple(&event_ids)
+                .map_err(|e| NotifierNotifyError::new_err(format!("{e:?}")))?),
+            NotifierType::Local(Some(v)) => Ok(v
+                .notify_multiple(&event_ids)
+                .map_err(|e| NotifierNotifyError::new_err(format!("{e:?}")))?),
+            _ => fatal_panic!(from "Notifier::notify_multiple()",
+                "Accessing a released notifier."),
+        }
+    }
+
+    /// Notifies all `Listener` connected to the service with a custom `EventId` and attaches
+    /// `value` to it. The `Listener` receives the value in `EventActivation.value`. Only the
+    /// latest value of every `EventId` is stored.
+    /// Returns on success the number of `Listener`s that were notified otherwise it returns
+    /// `NotifierNotifyError`.
+    pub fn notify_with_value(&self, event_id: &EventId, value: u64) -> PyResult<usize> {
+        match &self.0 {
+            NotifierType::Ipc(Some(v)) => Ok(v
+                .notify_with_value(event_id.0, value)
+                .map_err(|e| NotifierNotifyError::new_err(format!("{e:?}")))?),
+            NotifierType::Local(Some(v)) => Ok(v
+                .notify_with_value(event_id.0, value)
+                .map_err(|e| NotifierNotifyError::new_err(format!("{e:?}")))?),
+            _ => fatal_panic!(from "Notifier::notify_with_value()",
+                "Accessing a released notifier."),
+        }
+    }
+
     /// Releases the `Notifier`.
     ///
     /// After this call the `Notifier` is no longer usable!
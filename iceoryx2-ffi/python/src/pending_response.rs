@@ -90,6 +90,18 @@ impl PendingResponse {
         }
     }
 
+    /// Returns `True` when at least one `Server` rejected the request since its deadline
+    /// had passed before it was handed out.
+    #[getter]
+    pub fn has_missed_deadline(&self) -> bool {
+        match &*self.value.lock() {
+            PendingResponseType::Ipc(Some(v)) => v.has_missed_deadline(),
+            PendingResponseType::Local(Some(v)) => v.has_missed_deadline(),
+            _ => fatal_panic!(from "PendingResponse::has_missed_deadline()",
+                    "Accessing a released pending response."),
+        }
+    }
+
     /// Returns a reference to the iceoryx2 internal `RequestHeader` of the corresponding
     /// `RequestMut`
     #[getter]
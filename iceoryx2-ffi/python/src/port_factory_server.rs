@@ -19,6 +19,7 @@ use crate::{
     error::ServerCreateError,
     parc::Parc,
     port_factory_request_response::PortFactoryRequestResponseType,
+    receive_policy::ReceivePolicy,
     server::{Server, ServerType},
     type_storage::TypeStorage,
 };
@@ -201,6 +202,61 @@ impl PortFactoryServer {
         }
     }
 
+    /// Enables or disables the coalescing of identical in-flight requests. Requests whose
+    /// user header and payload are identical to a request whose `ActiveRequest` is still alive,
+    /// are served by the responses of that `ActiveRequest`.
+    pub fn enable_request_coalescing(&self, value: bool) -> Self {
+        let _guard = self.factory.lock();
+        match &self.value {
+            PortFactoryServerType::Ipc(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.enable_request_coalescing(value);
+                self.clone_ipc(this)
+            }
+            PortFactoryServerType::Local(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.enable_request_coalescing(value);
+                self.clone_local(this)
+            }
+        }
+    }
+
+    /// Enables or disables deadline scheduling. When enabled, the `Server` hands out requests
+    /// in earliest-deadline-first order and rejects requests whose deadline has passed.
+    pub fn enable_deadline_scheduling(&self, value: bool) -> Self {
+        let _guard = self.factory.lock();
+        match &self.value {
+            PortFactoryServerType::Ipc(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.enable_deadline_scheduling(value);
+                self.clone_ipc(this)
+            }
+            PortFactoryServerType::Local(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.enable_deadline_scheduling(value);
+                self.clone_local(this)
+            }
+        }
+    }
+
+    /// Defines the `ReceivePolicy`, the order in which `Server.receive()` returns the
+    /// requests of the connected `Client`s.
+    pub fn receive_policy(&self, value: &ReceivePolicy) -> Self {
+        let _guard = self.factory.lock();
+        match &self.value {
+            PortFactoryServerType::Ipc(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.receive_policy(value.clone().into());
+                self.clone_ipc(this)
+            }
+            PortFactoryServerType::Local(v) => {
+                let this = unsafe { (*v.lock()).__internal_partial_clone() };
+                let this = this.receive_policy(value.clone().into());
+                self.clone_local(this)
+            }
+        }
+    }
+
     /// Sets the maximum slice length that a user can allocate with
     /// `ActiveRequest::loan_slice()` or `ActiveRequest::loan_slice_uninit()`.
     pub fn __initial_max_slice_len(&self, value: usize) -> Self {
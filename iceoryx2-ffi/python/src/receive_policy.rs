@@ -0,0 +1,50 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use pyo3::prelude::*;
+
+#[pyclass(eq, eq_int, skip_from_py_object)]
+#[derive(PartialEq, Clone, Debug)]
+/// Defines the order in which a `Server` receives the requests of its connected `Client`s.
+/// All `Client`s have the weight 1.
+pub enum ReceivePolicy {
+    /// The `Client`s are always served in the order of their connection. A `Client` that
+    /// continuously sends requests can starve all `Client`s that connected after it.
+    FixedOrder,
+    /// Every receive call starts with the `Client` that follows the last served `Client`.
+    RoundRobin,
+    /// Like `ReceivePolicy.RoundRobin` but a `Client` is served as many requests in a row
+    /// as its weight states.
+    WeightedFair,
+    /// The `Client` with the highest weight that has pending requests is always served first.
+    Priority,
+}
+
+#[pymethods]
+impl ReceivePolicy {
+    pub fn __str__(&self) -> String {
+        format!("{self:?}")
+    }
+}
+
+impl From<ReceivePolicy> for iceoryx2::port::receive_policy::ReceivePolicy {
+    fn from(value: ReceivePolicy) -> Self {
+        match value {
+            ReceivePolicy::FixedOrder => iceoryx2::port::receive_policy::ReceivePolicy::FixedOrder,
+            ReceivePolicy::RoundRobin => iceoryx2::port::receive_policy::ReceivePolicy::RoundRobin,
+            ReceivePolicy::WeightedFair => {
+                iceoryx2::port::receive_policy::ReceivePolicy::WeightedFair
+            }
+            ReceivePolicy::Priority => iceoryx2::port::receive_policy::ReceivePolicy::Priority,
+        }
+    }
+}
@@ -168,4 +168,23 @@ impl RequestMut {
             }
         }
     }
+
+    /// Sends the `RequestMut` to all connected `Server`s of the `Service` without expecting a
+    /// `Response`. No `PendingResponse` is created and the request does not count towards the
+    /// active requests of the `Client`. Returns the number of `Server`s that received the
+    /// request.
+    pub fn send_and_forget(&self) -> PyResult<usize> {
+        match &mut *self.value.lock() {
+            RequestMutType::Ipc(v) => v
+                .take()
+                .unwrap()
+                .send_and_forget()
+                .map_err(|e| RequestSendError::new_err(format!("{e:?}"))),
+            RequestMutType::Local(v) => v
+                .take()
+                .unwrap()
+                .send_and_forget()
+                .map_err(|e| RequestSendError::new_err(format!("{e:?}"))),
+        }
+    }
 }
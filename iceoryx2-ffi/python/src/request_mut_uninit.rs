@@ -17,6 +17,7 @@ use iceoryx2_log::fatal_panic;
 use pyo3::prelude::*;
 
 use crate::{
+    duration::Duration,
     parc::Parc,
     request_header::RequestHeader,
     request_mut::{RequestMut, RequestMutType},
@@ -124,6 +125,18 @@ impl RequestMutUninit {
         }
     }
 
+    /// Sets the deadline of the request to `timeout` from now. A `Server` with deadline
+    /// scheduling enabled hands out requests in earliest-deadline-first order and rejects the
+    /// request when its deadline has passed.
+    pub fn set_deadline(&self, timeout: &Duration) {
+        match &mut *self.value.lock() {
+            RequestMutUninitType::Ipc(Some(v)) => v.set_deadline(timeout.0),
+            RequestMutUninitType::Local(Some(v)) => v.set_deadline(timeout.0),
+            _ => fatal_panic!(from "RequestMutUninit::set_deadline()",
+                "Accessing a released request."),
+        }
+    }
+
     /// Releases the `RequestMutUninit`.
     ///
     /// After this call the `RequestMutUninit` is no longer usable!
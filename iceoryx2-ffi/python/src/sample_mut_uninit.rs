@@ -90,6 +90,17 @@ impl SampleMutUninit {
         }
     }
 
+    /// Sets the priority of the `Sample`. When the `Service` has multiple priority lanes, the
+    /// `Sample` is received before all `Sample`s with a lower priority.
+    pub fn set_priority(&self, value: u8) {
+        match &mut *self.value.lock() {
+            SampleMutUninitType::Ipc(Some(v)) => v.set_priority(value),
+            SampleMutUninitType::Local(Some(v)) => v.set_priority(value),
+            _ => fatal_panic!(from "SampleMutUninit::set_priority()",
+                "Accessing a released sample."),
+        }
+    }
+
     #[getter]
     /// Returns a pointer to the user header.
     pub fn user_header_ptr(&self) -> usize {
@@ -155,6 +155,42 @@ impl ServiceBuilderPublishSubscribe {
         }
     }
 
+    /// If the `Service` is created, defines if every `Sample` carries the monotonic clock time
+    /// at which it was sent. If an existing `Service` is opened the setting of the existing
+    /// `Service` is used.
+    pub fn enable_send_timestamps(&self, value: bool) -> Self {
+        match &self.value {
+            ServiceBuilderPublishSubscribeType::Ipc(v) => {
+                let this = v.clone();
+                let this = this.enable_send_timestamps(value);
+                self.clone_ipc(this)
+            }
+            ServiceBuilderPublishSubscribeType::Local(v) => {
+                let this = v.clone();
+                let this = this.enable_send_timestamps(value);
+                self.clone_local(this)
+            }
+        }
+    }
+
+    /// If the `Service` is created, defines the number of priority lanes of every
+    /// `Subscriber`. `Sample`s in a higher lane are received before all `Sample`s in a lower
+    /// lane. If an existing `Service` is opened the setting of the existing `Service` is used.
+    pub fn priority_lanes(&self, value: usize) -> Self {
+        match &self.value {
+            ServiceBuilderPublishSubscribeType::Ipc(v) => {
+                let this = v.clone();
+                let this = this.priority_lanes(value);
+                self.clone_ipc(this)
+            }
+            ServiceBuilderPublishSubscribeType::Local(v) => {
+                let this = v.clone();
+                let this = this.priority_lanes(value);
+                self.clone_local(this)
+            }
+        }
+    }
+
     /// If the `Service` is created it defines how many `Sample`s a
     /// `Subscriber` can borrow at most in parallel. If an existing
     /// `Service` is opened it defines the minimum required.
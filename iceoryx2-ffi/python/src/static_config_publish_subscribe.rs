@@ -68,6 +68,18 @@ impl StaticConfigPublishSubscribe {
         self.0.has_safe_overflow()
     }
 
+    #[getter]
+    /// Returns true if every `Sample` carries the monotonic clock time at which it was sent.
+    pub fn has_send_timestamps(&self) -> bool {
+        self.0.has_send_timestamps()
+    }
+
+    #[getter]
+    /// Returns the number of priority lanes of every `Subscriber`.
+    pub fn number_of_priority_lanes(&self) -> usize {
+        self.0.number_of_priority_lanes()
+    }
+
     #[getter]
     /// Returns the type details of the `Service`.
     pub fn message_type_details(&self) -> MessageTypeDetails {
@@ -75,6 +75,18 @@ impl Subscriber {
         }
     }
 
+    #[getter]
+    /// Returns the number of samples that were lost since the `Subscriber` was created. The loss
+    /// is detected with the sequence numbers of the received samples.
+    pub fn lost_samples(&self) -> u64 {
+        match &*self.value.lock() {
+            SubscriberType::Ipc(Some(v)) => v.lost_samples(),
+            SubscriberType::Local(Some(v)) => v.lost_samples(),
+            _ => fatal_panic!(from "Subscriber::lost_samples()",
+                    "Accessing a released Subscriber."),
+        }
+    }
+
     /// Returns true if the `Subscriber` has samples in the buffer that can be received with
     /// `Subscriber::receive`. Emits `ConnectionFailure` on error.
     pub fn has_samples(&self) -> PyResult<bool> {
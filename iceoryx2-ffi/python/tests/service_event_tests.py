@@ -38,6 +38,49 @@ def test_notifier_use_default_event_id(
     assert events[0].count == 1
 
 
+@pytest.mark.parametrize("service_type", service_types)
+def test_notification_with_multiple_event_ids_works(
+    service_type: iox2.ServiceType,
+) -> None:
+    config = iox2.testing.generate_isolated_config()
+    node = iox2.NodeBuilder.new().config(config).create(service_type)
+    event_ids = [iox2.EventId.new(3), iox2.EventId.new(7)]
+
+    service_name = iox2.testing.generate_service_name()
+    service = node.service_builder(service_name).event().create()
+
+    notifier = service.notifier_builder().create()
+    listener = service.listener_builder().create()
+
+    assert notifier.notify_multiple(event_ids) == 1
+    events = listener.try_wait()
+
+    assert len(events) == 2
+    assert sorted(e.id.as_value for e in events) == [3, 7]
+
+
+@pytest.mark.parametrize("service_type", service_types)
+def test_notification_with_value_delivers_the_value(
+    service_type: iox2.ServiceType,
+) -> None:
+    config = iox2.testing.generate_isolated_config()
+    node = iox2.NodeBuilder.new().config(config).create(service_type)
+    event_id = iox2.EventId.new(12)
+
+    service_name = iox2.testing.generate_service_name()
+    service = node.service_builder(service_name).event().create()
+
+    notifier = service.notifier_builder().create()
+    listener = service.listener_builder().create()
+
+    assert notifier.notify_with_value(event_id, 8192) == 1
+    events = listener.try_wait()
+
+    assert len(events) == 1
+    assert events[0].id == event_id
+    assert events[0].value == 8192
+
+
 @pytest.mark.parametrize("service_type", service_types)
 def test_notification_with_custom_event_id_works(
     service_type: iox2.ServiceType,
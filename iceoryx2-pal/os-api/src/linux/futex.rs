@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use iceoryx2_pal_posix::posix;
+
+pub const FUTEX_EAGAIN: posix::int = libc::EAGAIN;
+pub const FUTEX_EINTR: posix::int = libc::EINTR;
+pub const FUTEX_ETIMEDOUT: posix::int = libc::ETIMEDOUT;
+
+/// Blocks as long as `*uaddr == expected` until it is woken up by [`futex_wake()`], the
+/// relative `timeout` expired or a signal was raised. When `timeout` is null it waits
+/// indefinitely. The futex is not private, therefore `uaddr` can reside in shared memory.
+///
+/// Returns `0` on success and `-errno` on failure. `errno` itself shall not be used.
+pub unsafe fn futex_wait(
+    uaddr: *const u32,
+    expected: u32,
+    timeout: *const posix::timespec,
+) -> posix::int {
+    let ret = unsafe {
+        libc::syscall(
+            libc::SYS_futex,
+            uaddr,
+            libc::FUTEX_WAIT,
+            expected,
+            timeout,
+            core::ptr::null::<u32>(),
+            0u32,
+        )
+    };
+
+    if ret < 0 {
+        -unsafe { *libc::__errno_location() }
+    } else {
+        ret as _
+    }
+}
+
+/// Wakes up at most `number_of_waiters` waiters that are blocked in [`futex_wait()`] on
+/// `uaddr`.
+///
+/// Returns the number of woken up waiters on success and `-errno` on failure. `errno`
+/// itself shall not be used.
+pub unsafe fn futex_wake(uaddr: *const u32, number_of_waiters: u32) -> posix::int {
+    let ret = unsafe {
+        libc::syscall(
+            libc::SYS_futex,
+            uaddr,
+            libc::FUTEX_WAKE,
+            number_of_waiters,
+            core::ptr::null::<posix::timespec>(),
+            core::ptr::null::<u32>(),
+            0u32,
+        )
+    };
+
+    if ret < 0 {
+        -unsafe { *libc::__errno_location() }
+    } else {
+        ret as _
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+use iceoryx2_pal_posix::posix;
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_sqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub flags: u32,
+    pub dropped: u32,
+    pub array: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_cqring_offsets {
+    pub head: u32,
+    pub tail: u32,
+    pub ring_mask: u32,
+    pub ring_entries: u32,
+    pub overflow: u32,
+    pub cqes: u32,
+    pub flags: u32,
+    pub resv1: u32,
+    pub user_addr: u64,
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_uring_params {
+    pub sq_entries: u32,
+    pub cq_entries: u32,
+    pub flags: u32,
+    pub sq_thread_cpu: u32,
+    pub sq_thread_idle: u32,
+    pub features: u32,
+    pub wq_fd: u32,
+    pub resv: [u32; 3],
+    pub sq_off: io_sqring_offsets,
+    pub cq_off: io_cqring_offsets,
+}
+
+/// Submission queue entry. The unions of the kernel definition are flattened to the members
+/// that are required for poll requests: `op_flags` is `poll32_events` and `addr` is the
+/// `user_data` of the request that shall be removed with [`IORING_OP_POLL_REMOVE`].
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_uring_sqe {
+    pub opcode: u8,
+    pub flags: u8,
+    pub ioprio: u16,
+    pub fd: i32,
+    pub off: u64,
+    pub addr: u64,
+    pub len: u32,
+    pub op_flags: u32,
+    pub user_data: u64,
+    pub buf_index: u16,
+    pub personality: u16,
+    pub splice_fd_in: i32,
+    pub addr3: u64,
+    pub pad: [u64; 1],
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_uring_cqe {
+    pub user_data: u64,
+    pub res: i32,
+    pub flags: u32,
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_uring_kernel_timespec {
+    pub tv_sec: i64,
+    pub tv_nsec: i64,
+}
+
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct io_uring_getevents_arg {
+    pub sigmask: u64,
+    pub sigmask_sz: u32,
+    pub min_wait_usec: u32,
+    pub ts: u64,
+}
+
+pub const IORING_OFF_SQ_RING: posix::off_t = 0;
+pub const IORING_OFF_CQ_RING: posix::off_t = 0x8000000;
+pub const IORING_OFF_SQES: posix::off_t = 0x10000000;
+
+pub const IORING_SETUP_CLAMP: u32 = 1 << 4;
+
+pub const IORING_FEAT_SINGLE_MMAP: u32 = 1 << 0;
+pub const IORING_FEAT_NODROP: u32 = 1 << 1;
+pub const IORING_FEAT_EXT_ARG: u32 = 1 << 8;
+
+pub const IORING_ENTER_GETEVENTS: u32 = 1 << 0;
+pub const IORING_ENTER_EXT_ARG: u32 = 1 << 3;
+
+pub const IORING_OP_POLL_ADD: u8 = 6;
+pub const IORING_OP_POLL_REMOVE: u8 = 7;
+
+pub const IO_URING_POLLIN: u32 = libc::POLLIN as _;
+
+pub const IO_URING_EINTR: posix::int = libc::EINTR;
+pub const IO_URING_ETIME: posix::int = libc::ETIME;
+pub const IO_URING_EBUSY: posix::int = libc::EBUSY;
+pub const IO_URING_EAGAIN: posix::int = libc::EAGAIN;
+
+/// Converts a poll event mask into the representation the kernel expects in
+/// [`io_uring_sqe::op_flags`]. On big endian targets the kernel swaps the 16-bit halves.
+pub const fn io_uring_poll_mask(events: u32) -> u32 {
+    #[cfg(target_endian = "big")]
+    {
+        events.rotate_left(16)
+    }
+    #[cfg(not(target_endian = "big"))]
+    {
+        events
+    }
+}
+
+/// Reads a head or tail index of a ring that is shared with the kernel.
+#[allow(clippy::disallowed_types)]
+pub unsafe fn io_uring_load_acquire(index: *const u32) -> u32 {
+    unsafe { core::sync::atomic::AtomicU32::from_ptr(index.cast_mut()) }
+        .load(core::sync::atomic::Ordering::Acquire)
+}
+
+/// Publishes a head or tail index of a ring that is shared with the kernel.
+#[allow(clippy::disallowed_types)]
+pub unsafe fn io_uring_store_release(index: *mut u32, value: u32) {
+    unsafe { core::sync::atomic::AtomicU32::from_ptr(index) }
+        .store(value, core::sync::atomic::Ordering::Release)
+}
+
+pub unsafe fn io_uring_setup(entries: u32, params: *mut io_uring_params) -> posix::int {
+    unsafe { libc::syscall(libc::SYS_io_uring_setup, entries, params) as _ }
+}
+
+/// Like liburing, it returns the number of consumed submission queue entries on success and
+/// `-errno` on failure. `errno` itself shall not be used.
+pub unsafe fn io_uring_enter(
+    fd: posix::int,
+    to_submit: u32,
+    min_complete: u32,
+    flags: u32,
+    arg: *const posix::void,
+    argsz: usize,
+) -> posix::int {
+    let ret = unsafe {
+        libc::syscall(
+            libc::SYS_io_uring_enter,
+            fd,
+            to_submit,
+            min_complete,
+            flags,
+            arg,
+            argsz,
+        )
+    };
+
+    if ret < 0 {
+        -unsafe { *libc::__errno_location() }
+    } else {
+        ret as _
+    }
+}
@@ -11,7 +11,11 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 pub mod epoll;
+pub mod futex;
+pub mod io_uring;
 pub mod signalfd;
 
 pub use epoll::*;
+pub use futex::*;
+pub use io_uring::*;
 pub use signalfd::*;
@@ -59,6 +59,17 @@ pub const MAP_SHARED: int = libc::MAP_SHARED as _;
 pub const MAP_PRIVATE: int = libc::MAP_PRIVATE as _;
 pub const MAP_ANONYMOUS: int = libc::MAP_ANONYMOUS as _;
 pub const MAP_FAILED: *mut void = u64::MAX as *mut void;
+pub const MADV_HUGEPAGE: int = libc::MADV_HUGEPAGE as _;
+pub const MPOL_DEFAULT: int = 0;
+pub const MPOL_PREFERRED: int = 1;
+pub const MPOL_INTERLEAVE: int = 3;
+pub const MFD_CLOEXEC: uint = 1;
+pub const MFD_ALLOW_SEALING: uint = 2;
+pub const F_ADD_SEALS: int = 1033;
+pub const F_GET_SEALS: int = 1034;
+pub const F_SEAL_SEAL: int = 1;
+pub const F_SEAL_SHRINK: int = 2;
+pub const F_SEAL_GROW: int = 4;
 
 pub const PTHREAD_BARRIER_SERIAL_THREAD: int = libc::PTHREAD_BARRIER_SERIAL_THREAD as _;
 pub const PTHREAD_EXPLICIT_SCHED: int = libc::PTHREAD_EXPLICIT_SCHED as _;
@@ -179,11 +190,14 @@ pub const PF_UNIX: sa_family_t = libc::AF_UNIX as _;
 pub const INADDR_ANY: in_addr_t = 0;
 pub const SO_SNDBUF: int = libc::SO_SNDBUF as _;
 pub const SO_RCVBUF: int = libc::SO_RCVBUF as _;
+pub const SO_REUSEADDR: int = libc::SO_REUSEADDR as _;
 pub const SO_RCVTIMEO: int = libc::SO_RCVTIMEO as _;
 pub const SO_SNDTIMEO: int = libc::SO_SNDTIMEO as _;
 pub const SOCK_STREAM: int = libc::SOCK_STREAM as _;
 pub const SOCK_DGRAM: int = libc::SOCK_DGRAM as _;
 pub const IPPROTO_UDP: int = libc::IPPROTO_UDP as _;
+pub const IPPROTO_IP: int = libc::IPPROTO_IP as _;
+pub const IP_ADD_MEMBERSHIP: int = libc::IP_ADD_MEMBERSHIP as _;
 pub const SOCK_NONBLOCK: int = O_NONBLOCK;
 pub const MSG_PEEK: int = libc::MSG_PEEK as _;
 pub const MSG_NOSIGNAL: int = libc::MSG_NOSIGNAL as _;
@@ -102,3 +102,33 @@ pub unsafe fn munmap(addr: *mut void, len: size_t) -> int {
 pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     unsafe { libc::mprotect(addr, len, prot) }
 }
+
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    unsafe { libc::madvise(addr, len, advice) }
+}
+
+pub unsafe fn shm_allocate_typed_memory(
+    _fd: int,
+    _typed_memory_name: *const c_char,
+    _size: size_t,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn mbind(
+    _addr: *mut void,
+    _len: size_t,
+    _mode: int,
+    _nodemask: *const ulong,
+    _maxnode: ulong,
+    _flags: uint,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn memfd_create(_name: *const c_char, _flags: uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
@@ -144,6 +144,14 @@ pub unsafe fn pthread_setaffinity_np(
     -1
 }
 
+pub unsafe fn pthread_setschedparam(
+    thread: pthread_t,
+    policy: int,
+    param: *const sched_param,
+) -> int {
+    unsafe { libc::pthread_setschedparam(thread, policy, param) }
+}
+
 pub unsafe fn pthread_getaffinity_np(
     _thread: pthread_t,
     _cpusetsize: size_t,
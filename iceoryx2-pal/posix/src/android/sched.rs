@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types, dead_code)]
 #![allow(clippy::missing_safety_doc)]
 
-use crate::posix::types::*;
+use crate::posix::{Errno, types::*};
 
 pub unsafe fn sched_get_priority_max(policy: int) -> int {
     unsafe { libc::sched_get_priority_max(policy) }
@@ -42,3 +42,8 @@ pub unsafe fn sched_setparam(pid: pid_t, param: *const sched_param) -> int {
 pub unsafe fn sched_setscheduler(pid: pid_t, policy: int, param: *const sched_param) -> int {
     unsafe { libc::sched_setscheduler(pid, policy, param) }
 }
+
+pub unsafe fn getcpu(_cpu: *mut uint, _node: *mut uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
@@ -14,7 +14,7 @@
 #![allow(clippy::missing_safety_doc)]
 
 use crate::common::mem_zeroed_struct::MemZeroedStruct;
-use crate::posix::SockAddrIn;
+use crate::posix::{IpMreq, SockAddrIn};
 pub type ulong = libc::c_ulong;
 
 #[repr(C)]
@@ -194,6 +194,19 @@ impl SockAddrIn for sockaddr_in {
     }
 }
 
+pub type ip_mreq = libc::ip_mreq;
+impl MemZeroedStruct for ip_mreq {}
+
+impl IpMreq for ip_mreq {
+    fn set_multicast_address(&mut self, value: u32) {
+        self.imr_multiaddr.s_addr = value;
+    }
+
+    fn set_interface_address(&mut self, value: u32) {
+        self.imr_interface.s_addr = value;
+    }
+}
+
 pub type passwd = libc::passwd;
 impl MemZeroedStruct for passwd {}
 
@@ -12,6 +12,7 @@
 
 pub mod cpu_set_t;
 pub(crate) mod error_enum_generator;
+pub mod ip_mreq;
 pub mod mem_zeroed_struct;
 pub mod sockaddr_in;
 pub(crate) mod string_operations;
@@ -57,6 +57,17 @@ pub const MAP_SHARED: int = crate::internal::MAP_SHARED as _;
 pub const MAP_PRIVATE: int = crate::internal::MAP_PRIVATE as _;
 pub const MAP_ANONYMOUS: int = crate::internal::MAP_ANONYMOUS as _;
 pub const MAP_FAILED: *mut void = u64::MAX as *mut void;
+pub const MADV_HUGEPAGE: int = 14;
+pub const MPOL_DEFAULT: int = 0;
+pub const MPOL_PREFERRED: int = 1;
+pub const MPOL_INTERLEAVE: int = 3;
+pub const MFD_CLOEXEC: uint = 1;
+pub const MFD_ALLOW_SEALING: uint = 2;
+pub const F_ADD_SEALS: int = 1033;
+pub const F_GET_SEALS: int = 1034;
+pub const F_SEAL_SEAL: int = 1;
+pub const F_SEAL_SHRINK: int = 2;
+pub const F_SEAL_GROW: int = 4;
 
 pub const PTHREAD_BARRIER_SERIAL_THREAD: int = crate::internal::PTHREAD_BARRIER_SERIAL_THREAD as _;
 pub const PTHREAD_EXPLICIT_SCHED: int = crate::internal::PTHREAD_EXPLICIT_SCHED as _;
@@ -181,11 +192,14 @@ pub const PF_UNIX: sa_family_t = crate::internal::AF_UNIX as _;
 pub const INADDR_ANY: in_addr_t = 0;
 pub const SO_SNDBUF: int = crate::internal::SO_SNDBUF as _;
 pub const SO_RCVBUF: int = crate::internal::SO_RCVBUF as _;
+pub const SO_REUSEADDR: int = crate::internal::SO_REUSEADDR as _;
 pub const SO_RCVTIMEO: int = crate::internal::SO_RCVTIMEO as _;
 pub const SO_SNDTIMEO: int = crate::internal::SO_SNDTIMEO as _;
 pub const SOCK_STREAM: int = crate::internal::SOCK_STREAM as _;
 pub const SOCK_DGRAM: int = crate::internal::SOCK_DGRAM as _;
 pub const IPPROTO_UDP: int = crate::internal::IPPROTO_UDP as _;
+pub const IPPROTO_IP: int = crate::internal::IPPROTO_IP as _;
+pub const IP_ADD_MEMBERSHIP: int = crate::internal::IP_ADD_MEMBERSHIP as _;
 pub const SOCK_NONBLOCK: int = O_NONBLOCK;
 pub const MSG_PEEK: int = crate::internal::MSG_PEEK as _;
 pub const MSG_NOSIGNAL: int = crate::internal::MSG_NOSIGNAL as _;
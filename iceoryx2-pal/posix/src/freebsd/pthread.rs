@@ -134,6 +134,14 @@ pub unsafe fn pthread_setaffinity_np(
     }
 }
 
+pub unsafe fn pthread_setschedparam(
+    thread: pthread_t,
+    policy: int,
+    param: *const sched_param,
+) -> int {
+    unsafe { crate::internal::pthread_setschedparam(thread, policy, param) }
+}
+
 pub unsafe fn pthread_getaffinity_np(
     thread: pthread_t,
     cpusetsize: size_t,
@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types)]
 #![allow(clippy::missing_safety_doc)]
 
-use crate::posix::{MemZeroedStruct, SockAddrIn};
+use crate::posix::{IpMreq, MemZeroedStruct, SockAddrIn};
 
 pub type ulong = crate::internal::u_long;
 pub type kinfo_file = crate::internal::kinfo_file;
@@ -202,6 +202,19 @@ impl SockAddrIn for sockaddr_in {
     }
 }
 
+pub type ip_mreq = crate::internal::ip_mreq;
+impl MemZeroedStruct for ip_mreq {}
+
+impl IpMreq for ip_mreq {
+    fn set_multicast_address(&mut self, value: u32) {
+        self.imr_multiaddr.s_addr = value;
+    }
+
+    fn set_interface_address(&mut self, value: u32) {
+        self.imr_interface.s_addr = value;
+    }
+}
+
 pub type passwd = crate::internal::passwd;
 impl MemZeroedStruct for passwd {}
 
@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types)]
 #![allow(clippy::missing_safety_doc)]
 
-use crate::posix::{closedir, opendir, readdir, types::*};
+use crate::posix::{Errno, closedir, opendir, readdir, types::*};
 
 use alloc::vec;
 use alloc::vec::Vec;
@@ -101,3 +101,31 @@ pub unsafe fn munmap(addr: *mut void, len: size_t) -> int {
 pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     unsafe { libc::mprotect(addr, len, prot) }
 }
+
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    unsafe { libc::madvise(addr, len, advice) }
+}
+
+pub unsafe fn shm_allocate_typed_memory(
+    _fd: int,
+    _typed_memory_name: *const c_char,
+    _size: size_t,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn mbind(
+    addr: *mut void,
+    len: size_t,
+    mode: int,
+    nodemask: *const ulong,
+    maxnode: ulong,
+    flags: uint,
+) -> int {
+    unsafe { libc::syscall(libc::SYS_mbind, addr, len, mode, nodemask, maxnode, flags) as _ }
+}
+
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    unsafe { libc::memfd_create(name, flags) }
+}
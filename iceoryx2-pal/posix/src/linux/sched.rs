@@ -42,3 +42,7 @@ pub unsafe fn sched_setparam(pid: pid_t, param: *const sched_param) -> int {
 pub unsafe fn sched_setscheduler(pid: pid_t, policy: int, param: *const sched_param) -> int {
     unsafe { libc::sched_setscheduler(pid, policy, param) }
 }
+
+pub unsafe fn getcpu(cpu: *mut uint, node: *mut uint) -> int {
+    unsafe { libc::syscall(libc::SYS_getcpu, cpu, node, core::ptr::null_mut::<void>()) as _ }
+}
@@ -150,27 +150,37 @@ impl ThreadStates {
     }
 }
 
-pub fn wait(atomic: &AtomicU64, expected: &u64) {
-    let sleep_time = timespec {
-        tv_sec: 0,
-        tv_nsec: 2000000,
-    };
+// Darwin's ulock interface (`<sys/ulock.h>`) is not part of the public SDK
+// headers but it is a stable system call which is also used by libc++ to
+// implement `std::atomic::wait`. The `*_SHARED` operations key the wait
+// queue by the physical page, so they work for atomics in shared memory.
+const UL_COMPARE_AND_WAIT64_SHARED: u32 = 6;
+const ULF_WAKE_ALL: u32 = 0x0000_0100;
+const ULF_NO_ERRNO: u32 = 0x0100_0000;
+
+unsafe extern "C" {
+    fn __ulock_wait(operation: u32, addr: *mut void, value: u64, timeout_us: u32) -> int;
+    fn __ulock_wake(operation: u32, addr: *mut void, wake_value: u64) -> int;
+}
+
+fn ulock_address(atomic: &AtomicU64) -> *mut void {
+    (atomic as *const AtomicU64).cast_mut().cast()
+}
 
+pub fn wait(atomic: &AtomicU64, expected: &u64) {
+    // a timeout of 0 blocks until a wake up arrives or the value differs,
+    // spurious wake ups are handled by the caller
     unsafe {
-        clock_nanosleep(
-            CLOCK_REALTIME,
+        __ulock_wait(
+            UL_COMPARE_AND_WAIT64_SHARED | ULF_NO_ERRNO,
+            ulock_address(atomic),
+            *expected,
             0,
-            &sleep_time,
-            core::ptr::null_mut::<timespec>().cast(),
         )
     };
 }
 
 pub fn timed_wait(atomic: &AtomicU64, expected: &u64, timeout: timespec) {
-    let sleep_time = timespec {
-        tv_sec: 0,
-        tv_nsec: 1000000,
-    };
     let mut now = timespec::new_zeroed();
     loop {
         if atomic.load(Ordering::Relaxed) != *expected {
@@ -178,26 +188,42 @@ pub fn timed_wait(atomic: &AtomicU64, expected: &u64, timeout: timespec) {
         }
 
         unsafe { clock_gettime(CLOCK_REALTIME, &mut now) };
-        if now.tv_sec > timeout.tv_sec
-            || (now.tv_sec == timeout.tv_sec && now.tv_nsec > timeout.tv_nsec)
-        {
+        let remaining_us = (timeout.tv_sec as i128 - now.tv_sec as i128) * 1_000_000
+            + (timeout.tv_nsec as i128 - now.tv_nsec as i128) / 1_000;
+        if remaining_us <= 0 {
             return;
         }
 
         unsafe {
-            clock_nanosleep(
-                CLOCK_REALTIME,
-                0,
-                &sleep_time,
-                core::ptr::null_mut::<timespec>().cast(),
+            __ulock_wait(
+                UL_COMPARE_AND_WAIT64_SHARED | ULF_NO_ERRNO,
+                ulock_address(atomic),
+                *expected,
+                remaining_us.min(u32::MAX as i128) as u32,
             )
         };
     }
 }
 
-pub fn wake_one(_atomic: &AtomicU64) {}
+pub fn wake_one(atomic: &AtomicU64) {
+    unsafe {
+        __ulock_wake(
+            UL_COMPARE_AND_WAIT64_SHARED | ULF_NO_ERRNO,
+            ulock_address(atomic),
+            0,
+        )
+    };
+}
 
-pub fn wake_all(_atomic: &AtomicU64) {}
+pub fn wake_all(atomic: &AtomicU64) {
+    unsafe {
+        __ulock_wake(
+            UL_COMPARE_AND_WAIT64_SHARED | ULF_WAKE_ALL | ULF_NO_ERRNO,
+            ulock_address(atomic),
+            0,
+        )
+    };
+}
 
 pub unsafe fn pthread_barrier_wait(barrier: *mut pthread_barrier_t) -> int {
     unsafe {
@@ -398,6 +424,14 @@ pub unsafe fn pthread_setaffinity_np(
     Errno::ESUCCES as int
 }
 
+pub unsafe fn pthread_setschedparam(
+    thread: pthread_t,
+    policy: int,
+    param: *const sched_param,
+) -> int {
+    unsafe { crate::internal::pthread_setschedparam(thread, policy, param) }
+}
+
 pub unsafe fn pthread_getaffinity_np(
     thread: pthread_t,
     cpusetsize: size_t,
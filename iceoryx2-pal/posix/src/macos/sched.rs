@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types, dead_code)]
 #![allow(clippy::missing_safety_doc)]
 
-use crate::posix::types::*;
+use crate::posix::{Errno, types::*};
 
 pub unsafe fn sched_get_priority_max(policy: int) -> int {
     unsafe { crate::internal::sched_get_priority_max(policy) }
@@ -46,3 +46,8 @@ pub unsafe fn sched_setscheduler(_pid: pid_t, _policy: int, _param: *const sched
     //crate::internal::sched_setscheduler(pid, policy, param)
     -1
 }
+
+pub unsafe fn getcpu(_cpu: *mut uint, _node: *mut uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
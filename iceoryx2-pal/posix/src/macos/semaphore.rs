@@ -61,29 +61,33 @@ pub unsafe fn sem_trywait(sem: *mut sem_t) -> int {
 }
 
 pub unsafe fn sem_timedwait(sem: *mut sem_t, abs_timeout: *const timespec) -> int {
-    unsafe {
-        let mut current_time = timespec::new_zeroed();
-        let mut wait_time = timespec::new_zeroed();
-
-        loop {
-            if sem_trywait(sem) == 0 {
-                return 0;
-            }
-
-            clock_gettime(CLOCK_REALTIME, &mut current_time);
-
-            if (current_time.tv_sec > (*abs_timeout).tv_sec)
-                || (current_time.tv_sec == (*abs_timeout).tv_sec
-                    && current_time.tv_nsec > (*abs_timeout).tv_nsec)
-            {
-                Errno::set(Errno::ETIMEDOUT);
-                return -1;
+    let timeout = unsafe { *abs_timeout };
+    let has_timed_out = || {
+        let mut now = timespec::new_zeroed();
+        unsafe { clock_gettime(CLOCK_REALTIME, &mut now) };
+        now.tv_sec > timeout.tv_sec
+            || (now.tv_sec == timeout.tv_sec && now.tv_nsec > timeout.tv_nsec)
+    };
+
+    let wait_result = unsafe {
+        (*sem).semaphore.wait(|atomic, value| -> WaitAction {
+            timed_wait(atomic, value, timeout);
+            if has_timed_out() {
+                WaitAction::Abort
+            } else {
+                WaitAction::Continue
             }
+        })
+    };
 
-            current_time.tv_sec = 0;
-            current_time.tv_nsec = 1000000;
-
-            crate::internal::nanosleep(&current_time, &mut wait_time);
+    match wait_result {
+        WaitResult::Success => {
+            Errno::set(Errno::ESUCCES);
+            0
+        }
+        WaitResult::Interrupted => {
+            Errno::set(Errno::ETIMEDOUT);
+            -1
         }
     }
 }
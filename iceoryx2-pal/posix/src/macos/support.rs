@@ -24,3 +24,7 @@ pub const POSIX_SUPPORT_MESSAGE_QUEUE: bool = false;
 pub const POSIX_SUPPORT_ADVANCED_SIGNAL_HANDLING: bool = false;
 pub const POSIX_SUPPORT_CONSOLE_SIGNAL_HANDLING: bool = false;
 pub const POSIX_SUPPORT_SCHEDULER: bool = false;
+pub const POSIX_SUPPORT_HUGE_PAGE_ADVICE: bool = false;
+pub const POSIX_SUPPORT_TYPED_MEMORY: bool = false;
+pub const POSIX_SUPPORT_NUMA_MEMORY_POLICY: bool = false;
+pub const POSIX_SUPPORT_MEMORY_FD: bool = false;
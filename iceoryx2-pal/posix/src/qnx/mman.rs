@@ -13,7 +13,7 @@
 #![allow(non_camel_case_types)]
 #![allow(clippy::missing_safety_doc)]
 
-use crate::posix::{closedir, opendir, readdir, types::*};
+use crate::posix::{Errno, closedir, opendir, readdir, types::*};
 extern crate alloc;
 use alloc::vec;
 use alloc::vec::Vec;
@@ -118,6 +118,58 @@ pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     unsafe { crate::internal::mprotect(addr, len, prot) }
 }
 
+pub unsafe fn madvise(_addr: *mut void, _len: size_t, _advice: int) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn shm_allocate_typed_memory(
+    fd: int,
+    typed_memory_name: *const c_char,
+    size: size_t,
+) -> int {
+    unsafe {
+        let typed_memory_fd = crate::internal::posix_typed_mem_open(
+            typed_memory_name,
+            crate::posix::O_RDWR as _,
+            crate::internal::POSIX_TYPED_MEM_ALLOCATE_CONTIG as _,
+        );
+        if typed_memory_fd == -1 {
+            return -1;
+        }
+
+        let result = crate::internal::shm_ctl(
+            fd,
+            (crate::internal::SHMCTL_ANON | crate::internal::SHMCTL_TYMEM) as _,
+            typed_memory_fd as _,
+            size as _,
+        );
+
+        let errno = Errno::get();
+        crate::posix::close(typed_memory_fd);
+        Errno::set(errno);
+
+        result
+    }
+}
+
+pub unsafe fn mbind(
+    _addr: *mut void,
+    _len: size_t,
+    _mode: int,
+    _nodemask: *const ulong,
+    _maxnode: ulong,
+    _flags: uint,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn memfd_create(_name: *const c_char, _flags: uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
 #[cfg(target_pointer_width = "32")]
 mod internal {
     use super::*;
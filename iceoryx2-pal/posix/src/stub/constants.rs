@@ -60,6 +60,17 @@ pub const MCL_FUTURE: int = 32;
 pub const MAP_FAILED: *mut void = 0 as *mut void;
 pub const MAP_PRIVATE: int = 2;
 pub const MAP_ANONYMOUS: int = 32;
+pub const MADV_HUGEPAGE: int = 14;
+pub const MPOL_DEFAULT: int = 0;
+pub const MPOL_PREFERRED: int = 1;
+pub const MPOL_INTERLEAVE: int = 3;
+pub const MFD_CLOEXEC: uint = 1;
+pub const MFD_ALLOW_SEALING: uint = 2;
+pub const F_ADD_SEALS: int = 1033;
+pub const F_GET_SEALS: int = 1034;
+pub const F_SEAL_SEAL: int = 1;
+pub const F_SEAL_SHRINK: int = 2;
+pub const F_SEAL_GROW: int = 4;
 pub const MAP_SHARED: int = 64;
 
 pub const PTHREAD_MUTEX_NORMAL: int = 1;
@@ -154,12 +165,15 @@ pub const SO_PASSCRED: int = 1;
 pub const SO_PEERCRED: int = 2;
 pub const SO_SNDBUF: int = 7;
 pub const SO_RCVBUF: int = 8;
+pub const SO_REUSEADDR: int = 2;
 pub const SO_RCVTIMEO: int = 20;
 pub const SO_SNDTIMEO: int = 21;
 pub const SOCK_STREAM: int = 1;
 pub const SOCK_DGRAM: int = 2;
 pub const SOCK_NONBLOCK: int = O_NONBLOCK;
 pub const IPPROTO_UDP: int = 17;
+pub const IPPROTO_IP: int = 0;
+pub const IP_ADD_MEMBERSHIP: int = 35;
 pub const MSG_PEEK: int = 2;
 pub const MSG_NOSIGNAL: int = 0x4000;
 pub const SCM_MAX_FD: u32 = 253;
@@ -62,6 +62,33 @@ pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
     unimplemented!("mprotect")
 }
 
+pub unsafe fn madvise(addr: *mut void, len: size_t, advice: int) -> int {
+    unimplemented!("madvise")
+}
+
+pub unsafe fn shm_allocate_typed_memory(
+    fd: int,
+    typed_memory_name: *const c_char,
+    size: size_t,
+) -> int {
+    unimplemented!("shm_allocate_typed_memory")
+}
+
+pub unsafe fn mbind(
+    addr: *mut void,
+    len: size_t,
+    mode: int,
+    nodemask: *const ulong,
+    maxnode: ulong,
+    flags: uint,
+) -> int {
+    unimplemented!("mbind")
+}
+
+pub unsafe fn memfd_create(name: *const c_char, flags: uint) -> int {
+    unimplemented!("memfd_create")
+}
+
 pub unsafe fn shm_list() -> Vec<[i8; 256]> {
     unimplemented!("shm_list")
 }
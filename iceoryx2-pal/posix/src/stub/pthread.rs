@@ -270,6 +270,14 @@ pub unsafe fn pthread_setaffinity_np(
     unimplemented!("pthread_setaffinity_np")
 }
 
+pub unsafe fn pthread_setschedparam(
+    thread: pthread_t,
+    policy: int,
+    param: *const sched_param,
+) -> int {
+    unimplemented!("pthread_setschedparam")
+}
+
 pub unsafe fn pthread_getaffinity_np(
     thread: pthread_t,
     cpusetsize: size_t,
@@ -45,3 +45,7 @@ pub unsafe fn sched_setparam(pid: pid_t, param: *const sched_param) -> int {
 pub unsafe fn sched_setscheduler(pid: pid_t, policy: int, param: *const sched_param) -> int {
     unimplemented!("sched_setscheduler")
 }
+
+pub unsafe fn getcpu(cpu: *mut uint, node: *mut uint) -> int {
+    unimplemented!("getcpu")
+}
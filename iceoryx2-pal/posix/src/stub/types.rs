@@ -300,6 +300,23 @@ impl SockAddrIn for sockaddr_in {
     }
 }
 
+#[repr(C)]
+pub struct ip_mreq {
+    pub imr_multiaddr: in_addr,
+    pub imr_interface: in_addr,
+}
+impl MemZeroedStruct for ip_mreq {}
+
+impl IpMreq for ip_mreq {
+    fn set_multicast_address(&mut self, value: u32) {
+        unimplemented!("set_multicast_address")
+    }
+
+    fn set_interface_address(&mut self, value: u32) {
+        unimplemented!("set_interface_address")
+    }
+}
+
 #[repr(C)]
 pub struct itimerspec {
     pub it_interval: timespec,
@@ -57,6 +57,17 @@ pub const MAP_SHARED: int = 64;
 pub const MAP_ANONYMOUS: int = 128;
 pub const MAP_PRIVATE: int = 256;
 pub const MAP_FAILED: *mut void = core::ptr::null_mut::<void>();
+pub const MADV_HUGEPAGE: int = 14;
+pub const MPOL_DEFAULT: int = 0;
+pub const MPOL_PREFERRED: int = 1;
+pub const MPOL_INTERLEAVE: int = 3;
+pub const MFD_CLOEXEC: uint = 1;
+pub const MFD_ALLOW_SEALING: uint = 2;
+pub const F_ADD_SEALS: int = 1033;
+pub const F_GET_SEALS: int = 1034;
+pub const F_SEAL_SEAL: int = 1;
+pub const F_SEAL_SHRINK: int = 2;
+pub const F_SEAL_GROW: int = 4;
 
 pub const PTHREAD_MUTEX_NORMAL: int = 1;
 pub const PTHREAD_MUTEX_RECURSIVE: int = 2;
@@ -148,12 +159,15 @@ pub const SO_PASSCRED: int = 1;
 pub const SO_PEERCRED: int = 2;
 pub const SO_SNDBUF: int = windows_sys::Win32::Networking::WinSock::SO_SNDBUF as _;
 pub const SO_RCVBUF: int = windows_sys::Win32::Networking::WinSock::SO_RCVBUF as _;
+pub const SO_REUSEADDR: int = windows_sys::Win32::Networking::WinSock::SO_REUSEADDR as _;
 pub const SO_RCVTIMEO: int = windows_sys::Win32::Networking::WinSock::SO_RCVTIMEO as _;
 pub const SO_SNDTIMEO: int = windows_sys::Win32::Networking::WinSock::SO_SNDTIMEO as _;
 pub const SOCK_STREAM: int = windows_sys::Win32::Networking::WinSock::SOCK_STREAM as _;
 pub const SOCK_DGRAM: int = windows_sys::Win32::Networking::WinSock::SOCK_DGRAM as _;
 pub const SOCK_NONBLOCK: int = O_NONBLOCK;
 pub const IPPROTO_UDP: int = windows_sys::Win32::Networking::WinSock::IPPROTO_UDP as _;
+pub const IPPROTO_IP: int = windows_sys::Win32::Networking::WinSock::IPPROTO_IP as _;
+pub const IP_ADD_MEMBERSHIP: int = windows_sys::Win32::Networking::WinSock::IP_ADD_MEMBERSHIP as _;
 pub const MSG_PEEK: int = windows_sys::Win32::Networking::WinSock::MSG_PEEK as _;
 pub const MSG_NOSIGNAL: int = 0; // this flag is not necessary on Windows since 'send' works as if it is already set
 pub const SCM_MAX_FD: u32 = 253;
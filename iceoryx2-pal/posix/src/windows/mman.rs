@@ -557,3 +557,34 @@ pub unsafe fn mprotect(addr: *mut void, len: size_t, prot: int) -> int {
         -1
     }
 }
+
+pub unsafe fn madvise(_addr: *mut void, _len: size_t, _advice: int) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn shm_allocate_typed_memory(
+    _fd: int,
+    _typed_memory_name: *const c_char,
+    _size: size_t,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn mbind(
+    _addr: *mut void,
+    _len: size_t,
+    _mode: int,
+    _nodemask: *const ulong,
+    _maxnode: ulong,
+    _flags: uint,
+) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
+
+pub unsafe fn memfd_create(_name: *const c_char, _flags: uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
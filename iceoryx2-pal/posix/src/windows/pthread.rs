@@ -460,6 +460,24 @@ pub unsafe fn pthread_setaffinity_np(
     Errno::ESUCCES as int
 }
 
+pub unsafe fn pthread_setschedparam(
+    thread: pthread_t,
+    _policy: int,
+    param: *const sched_param,
+) -> int {
+    unsafe {
+        let priority = (*param)
+            .sched_priority
+            .clamp(sched_get_priority_min(0), sched_get_priority_max(0));
+        let (has_set_priority, _) =
+            win32call! { SetThreadPriority(thread.handle, to_win_priority(priority)) };
+        if has_set_priority == 0 {
+            return Errno::EINVAL as int;
+        }
+    }
+    Errno::ESUCCES as int
+}
+
 pub unsafe fn pthread_getaffinity_np(
     thread: pthread_t,
     cpusetsize: size_t,
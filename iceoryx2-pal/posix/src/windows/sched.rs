@@ -16,7 +16,7 @@
 
 use windows_sys::Win32::System::Threading::SwitchToThread;
 
-use crate::posix::types::*;
+use crate::posix::{Errno, types::*};
 
 pub unsafe fn sched_get_priority_max(policy: int) -> int {
     3
@@ -48,3 +48,8 @@ pub unsafe fn sched_setparam(pid: pid_t, param: *const sched_param) -> int {
 pub unsafe fn sched_setscheduler(pid: pid_t, policy: int, param: *const sched_param) -> int {
     -1
 }
+
+pub unsafe fn getcpu(_cpu: *mut uint, _node: *mut uint) -> int {
+    Errno::set(Errno::ENOSYS);
+    -1
+}
@@ -14,19 +14,107 @@
 #![allow(clippy::missing_safety_doc)]
 #![allow(unused_variables)]
 
+//! Unnamed semaphores that are shared between processes cannot use `WaitOnAddress` since it
+//! only wakes up threads of the same process. Every process-shared semaphore acquires a
+//! unique wake-up id in [`sem_init()`] that names a Win32 semaphore object. A waiting thread
+//! sleeps on that kernel object and [`sem_post()`] releases it when a waiter is registered,
+//! so that a post without waiters does not require a syscall.
+
 use std::time::SystemTime;
 use std::time::UNIX_EPOCH;
 
 use iceoryx2_pal_concurrency_sync::atomic::AtomicU64;
+use iceoryx2_pal_concurrency_sync::atomic::{AtomicU32, Ordering, fence};
 use iceoryx2_pal_concurrency_sync::strategy::semaphore::Semaphore;
 use iceoryx2_pal_concurrency_sync::{WaitAction, WaitResult};
+use windows_sys::Win32::Foundation::{
+    CloseHandle, ERROR_ALREADY_EXISTS, ERROR_FILE_NOT_FOUND, ERROR_TOO_MANY_POSTS, FALSE, HANDLE,
+};
 use windows_sys::Win32::System::Threading::INFINITE;
 use windows_sys::Win32::System::Threading::WaitOnAddress;
 use windows_sys::Win32::System::Threading::WakeByAddressSingle;
+use windows_sys::Win32::System::Threading::{
+    CreateSemaphoreA, GetCurrentProcessId, OpenSemaphoreA, ReleaseSemaphore,
+    SEMAPHORE_MODIFY_STATE, WaitForSingleObject,
+};
 
 use crate::posix::Errno;
 use crate::posix::constants::*;
 use crate::posix::types::*;
+use crate::win32call;
+
+const WAKE_UP_OBJECT_PREFIX: &[u8] = b"iox2_sem_";
+const WAKE_UP_OBJECT_NAME_LENGTH: usize = WAKE_UP_OBJECT_PREFIX.len() + 16 + 1;
+
+fn wake_up_object_name(wake_up_id: u64) -> [u8; WAKE_UP_OBJECT_NAME_LENGTH] {
+    const HEX_DIGITS: &[u8] = b"0123456789abcdef";
+    let mut name = [0u8; WAKE_UP_OBJECT_NAME_LENGTH];
+    name[..WAKE_UP_OBJECT_PREFIX.len()].copy_from_slice(WAKE_UP_OBJECT_PREFIX);
+    for i in 0..16 {
+        name[WAKE_UP_OBJECT_PREFIX.len() + i] =
+            HEX_DIGITS[((wake_up_id >> (60 - 4 * i)) & 0xf) as usize];
+    }
+
+    name
+}
+
+/// Returns an id that is unique among all process-shared semaphores of all running
+/// processes.
+fn new_wake_up_id() -> u64 {
+    static SEMAPHORE_COUNTER: AtomicU32 = AtomicU32::new(0);
+
+    let process_id = unsafe { GetCurrentProcessId() } as u64;
+    let counter = SEMAPHORE_COUNTER.fetch_add(1, Ordering::Relaxed) as u64;
+    // zero is reserved for process local semaphores
+    (process_id << 32) | (counter + 1)
+}
+
+/// Waits on the kernel object of a process-shared semaphore until it is released or the
+/// timeout in milliseconds has passed.
+unsafe fn wait_on_wake_up_object(sem: *mut sem_t, atomic: &AtomicU64, value: &u64, timeout: u32) {
+    unsafe {
+        (*sem).number_of_waiters.fetch_add(1, Ordering::SeqCst);
+
+        let name = wake_up_object_name((*sem).wake_up_id);
+        let (handle, _) = win32call! { CreateSemaphoreA(core::ptr::null(), 0, i32::MAX, name.as_ptr()), ignore ERROR_ALREADY_EXISTS };
+
+        // the value must be checked after the kernel object was acquired, otherwise a
+        // post that happens in between would not find the kernel object and the wake up
+        // would be lost
+        if handle != 0 {
+            if atomic.load(Ordering::SeqCst) == *value {
+                win32call! { WaitForSingleObject(handle, timeout) };
+            }
+            win32call! { CloseHandle(handle) };
+        }
+
+        (*sem).number_of_waiters.fetch_sub(1, Ordering::SeqCst);
+    }
+}
+
+unsafe fn wake_up_one(sem: *mut sem_t, atomic: &AtomicU64) {
+    unsafe {
+        if (*sem).wake_up_id == 0 {
+            WakeByAddressSingle((atomic as *const AtomicU64).cast());
+            return;
+        }
+
+        fence(Ordering::SeqCst);
+        if (*sem).number_of_waiters.load(Ordering::SeqCst) == 0 {
+            return;
+        }
+
+        let name = wake_up_object_name((*sem).wake_up_id);
+        let (handle, _): (HANDLE, _) = win32call! { OpenSemaphoreA(SEMAPHORE_MODIFY_STATE, FALSE, name.as_ptr()), ignore ERROR_FILE_NOT_FOUND };
+
+        // when the kernel object does not exist the waiter has not yet acquired it and
+        // will observe the new value before it starts to wait
+        if handle != 0 {
+            win32call! { ReleaseSemaphore(handle, 1, core::ptr::null_mut()), ignore ERROR_TOO_MANY_POSTS };
+            win32call! { CloseHandle(handle) };
+        }
+    }
+}
 
 pub unsafe fn sem_create(name: *const c_char, oflag: int, mode: mode_t, value: uint) -> *mut sem_t {
     SEM_FAILED
@@ -39,12 +127,7 @@ pub unsafe fn sem_post(sem: *mut sem_t) -> int {
             return -1;
         }
 
-        (*sem).semaphore.post(
-            |atomic| {
-                WakeByAddressSingle((atomic as *const AtomicU64).cast());
-            },
-            1,
-        );
+        (*sem).semaphore.post(|atomic| wake_up_one(sem, atomic), 1);
     }
     Errno::set(Errno::ESUCCES);
     0
@@ -53,12 +136,16 @@ pub unsafe fn sem_post(sem: *mut sem_t) -> int {
 pub unsafe fn sem_wait(sem: *mut sem_t) -> int {
     unsafe {
         (*sem).semaphore.wait(|atomic, value| -> WaitAction {
-            WaitOnAddress(
-                (atomic as *const AtomicU64).cast(),
-                (value as *const u64).cast(),
-                4,
-                INFINITE,
-            );
+            if (*sem).wake_up_id == 0 {
+                WaitOnAddress(
+                    (atomic as *const AtomicU64).cast(),
+                    (value as *const u64).cast(),
+                    4,
+                    INFINITE,
+                );
+            } else {
+                wait_on_wake_up_object(sem, atomic, value, INFINITE);
+            }
 
             WaitAction::Continue
         });
@@ -87,14 +174,20 @@ pub unsafe fn sem_timedwait(sem: *mut sem_t, abs_timeout: *const timespec) -> in
         let milli_seconds = (*abs_timeout).tv_sec * 1000 + (*abs_timeout).tv_nsec as i64 / 1000000
             - now.as_millis() as i64;
 
+        let milli_seconds = milli_seconds.clamp(0, (INFINITE - 1) as i64) as u32;
+
         #[allow(clippy::blocks_in_conditions)]
         match (*sem).semaphore.wait(|atomic, value| -> WaitAction {
-            WaitOnAddress(
-                (atomic as *const AtomicU64).cast(),
-                (value as *const u64).cast(),
-                4,
-                milli_seconds as _,
-            );
+            if (*sem).wake_up_id == 0 {
+                WaitOnAddress(
+                    (atomic as *const AtomicU64).cast(),
+                    (value as *const u64).cast(),
+                    4,
+                    milli_seconds,
+                );
+            } else {
+                wait_on_wake_up_object(sem, atomic, value, milli_seconds);
+            }
 
             WaitAction::Abort
         }) {
@@ -129,6 +222,8 @@ pub unsafe fn sem_destroy(sem: *mut sem_t) -> int {
 pub unsafe fn sem_init(sem: *mut sem_t, pshared: int, value: uint) -> int {
     unsafe {
         (*sem).semaphore = Semaphore::new(value as _);
+        (*sem).number_of_waiters = AtomicU32::new(0);
+        (*sem).wake_up_id = if pshared == 0 { 0 } else { new_wake_up_id() };
     }
     Errno::set(Errno::ESUCCES);
     0
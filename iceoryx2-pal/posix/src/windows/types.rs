@@ -16,13 +16,14 @@
 
 use core::fmt::Debug;
 
+use iceoryx2_pal_concurrency_sync::atomic::AtomicU32;
 use iceoryx2_pal_concurrency_sync::atomic::AtomicU64;
 use iceoryx2_pal_concurrency_sync::strategy::barrier::Barrier;
 use iceoryx2_pal_concurrency_sync::strategy::mutex::Mutex;
 use iceoryx2_pal_concurrency_sync::strategy::rwlock::*;
 use iceoryx2_pal_concurrency_sync::strategy::semaphore::Semaphore;
 use windows_sys::Win32::Foundation::{HANDLE, INVALID_HANDLE_VALUE};
-use windows_sys::Win32::Networking::WinSock::{SOCKADDR_IN, TIMEVAL};
+use windows_sys::Win32::Networking::WinSock::{IP_MREQ, SOCKADDR_IN, TIMEVAL};
 
 use crate::posix::MemZeroedStruct;
 use crate::posix::*;
@@ -168,11 +169,15 @@ impl MemZeroedStruct for pthread_mutexattr_t {}
 
 pub struct sem_t {
     pub(crate) semaphore: Semaphore,
+    pub(crate) number_of_waiters: AtomicU32,
+    pub(crate) wake_up_id: u64,
 }
 impl MemZeroedStruct for sem_t {
     fn new_zeroed() -> Self {
         Self {
             semaphore: Semaphore::new(0),
+            number_of_waiters: AtomicU32::new(0),
+            wake_up_id: 0,
         }
     }
 }
@@ -321,3 +326,16 @@ impl SockAddrIn for sockaddr_in {
         unsafe { self.sin_addr.S_un.S_addr }
     }
 }
+
+pub type ip_mreq = IP_MREQ;
+impl MemZeroedStruct for ip_mreq {}
+
+impl IpMreq for ip_mreq {
+    fn set_multicast_address(&mut self, value: u32) {
+        self.imr_multiaddr.S_un.S_addr = value;
+    }
+
+    fn set_interface_address(&mut self, value: u32) {
+        self.imr_interface.S_un.S_addr = value;
+    }
+}
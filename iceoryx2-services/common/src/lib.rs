@@ -17,8 +17,11 @@
 #![no_std]
 
 use iceoryx2::{
+    port::statistics::PortStatistics,
     prelude::ZeroCopySend,
-    service::{service_hash::ServiceHash, static_config::StaticConfig},
+    service::{
+        messaging_pattern::MessagingPattern, service_hash::ServiceHash, static_config::StaticConfig,
+    },
 };
 
 extern crate alloc;
@@ -63,3 +66,42 @@ impl<'a> From<&'a DiscoveryEvent> for DiscoveryEventRef<'a> {
         }
     }
 }
+
+/// Snapshot of the live metrics of a single service in the system.
+///
+/// The ports of a service are grouped into senders and receivers:
+///
+/// | Messaging Pattern | Senders   | Receivers   |
+/// | ----------------- | --------- | ----------- |
+/// | PublishSubscribe  | Publisher | Subscriber  |
+/// | Event             | Notifier  | Listener    |
+/// | RequestResponse   | Client    | Server      |
+/// | Blackboard        | Writer    | Reader      |
+///
+/// Can be used as shared memory payload.
+#[derive(Clone, Copy, Debug, ZeroCopySend)]
+#[repr(C)]
+pub struct ServiceMetrics {
+    /// The hash identifying the service.
+    pub service_hash: ServiceHash,
+
+    /// The messaging pattern of the service.
+    pub messaging_pattern: MessagingPattern,
+
+    /// The number of nodes that have opened the service.
+    pub number_of_nodes: u64,
+
+    /// The number of connected sending ports.
+    pub number_of_senders: u64,
+
+    /// The number of connected receiving ports.
+    pub number_of_receivers: u64,
+
+    /// The accumulated counters of all connected sending ports. Only publishers provide
+    /// counters, for all other sending ports they are zero.
+    pub sender_statistics: PortStatistics,
+
+    /// The accumulated counters of all connected receiving ports. Readers do not provide
+    /// counters, for them they are zero.
+    pub receiver_statistics: PortStatistics,
+}
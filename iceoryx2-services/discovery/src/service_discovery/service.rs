@@ -429,7 +429,7 @@ impl<S: ServiceType> Service<S> {
             Ok(())
         };
 
-        self.tracker.sync(|event| {
+        self.tracker.sync_changes(|event| {
             if error.is_some() {
                 return;
             }
@@ -133,6 +133,56 @@ impl<S: Service> Tracker<S> {
         Ok(())
     }
 
+    /// Synchronises the tracker with the services that were added or removed
+    /// since the last synchronisation.
+    ///
+    /// In contrast to [`Tracker::sync`] only the service hashes of all
+    /// services are listed, the service details are acquired solely for
+    /// newly added services. Therefore, the cost depends on the number of
+    /// changes instead of the number of services in the system. The details
+    /// of already tracked services are not refreshed.
+    pub fn sync_changes<F>(&mut self, mut on_event: F) -> Result<(), SyncError>
+    where
+        F: for<'a> FnMut(TrackerEvent<'a, S>),
+    {
+        self.epoch = self.epoch.wrapping_add(1);
+        let epoch = self.epoch;
+        let config = &self.config;
+        let services = &mut self.services;
+
+        S::list_service_hashes(config, |id| {
+            match services.entry(id) {
+                Entry::Vacant(slot) => {
+                    // the service may be removed in the meantime or not yet be
+                    // fully created, it is then added with a later sync
+                    if let Ok(Some(details)) = S::details_from_service_hash(config, &id) {
+                        let entry = slot.insert(TrackedEntry {
+                            details,
+                            seen: epoch,
+                        });
+                        on_event(TrackerEvent::Added(&entry.details));
+                    }
+                }
+                Entry::Occupied(mut slot) => {
+                    slot.get_mut().seen = epoch;
+                }
+            }
+
+            CallbackProgression::Continue
+        })?;
+
+        self.services.retain(|_, entry| {
+            if entry.seen == epoch {
+                true
+            } else {
+                on_event(TrackerEvent::Removed(&entry.details));
+                false
+            }
+        });
+
+        Ok(())
+    }
+
     /// Retrieves service details for a specific tracked service.
     pub fn get(&self, id: &ServiceHash) -> Option<&ServiceDetails<S>> {
         self.services.get(id).map(|e| &e.details)
@@ -31,6 +31,20 @@ mod service_discovery_tracker {
         (added, removed)
     }
 
+    fn collect_sync_changes<S: Service>(
+        tracker: &mut Tracker<S>,
+    ) -> (Vec<ServiceHash>, Vec<ServiceHash>) {
+        let mut added: Vec<ServiceHash> = vec![];
+        let mut removed: Vec<ServiceHash> = vec![];
+        tracker
+            .sync_changes(|event| match event {
+                TrackerEvent::Added(d) => added.push(*d.static_details.service_hash()),
+                TrackerEvent::Removed(d) => removed.push(*d.static_details.service_hash()),
+            })
+            .expect("failed to sync tracker changes");
+        (added, removed)
+    }
+
     #[test]
     fn syncs_added_and_removed_publish_subscribe_services<S: Service>() {
         const NUMBER_OF_SERVICES_ADDED: usize = 8;
@@ -81,6 +95,54 @@ mod service_discovery_tracker {
         }
     }
 
+    #[test]
+    fn sync_changes_reports_only_added_and_removed_services<S: Service>() {
+        const NUMBER_OF_SERVICES: usize = 4;
+
+        let config = generate_isolated_config();
+        let node = NodeBuilder::new().config(&config).create::<S>().unwrap();
+
+        let mut sut = Tracker::<S>::new(&config);
+
+        let mut services = vec![];
+        for _ in 0..NUMBER_OF_SERVICES {
+            let service_name = generate_service_name();
+            let service = node
+                .service_builder(&service_name)
+                .publish_subscribe::<u64>()
+                .create()
+                .unwrap();
+            services.push(service);
+        }
+
+        let (added, removed) = collect_sync_changes(&mut sut);
+        assert_that!(added.len(), eq NUMBER_OF_SERVICES);
+        assert_that!(removed.len(), eq 0);
+        for service in &services {
+            assert_that!(sut.get(service.service_hash()), is_some);
+        }
+
+        let (added, removed) = collect_sync_changes(&mut sut);
+        assert_that!(added.len(), eq 0);
+        assert_that!(removed.len(), eq 0);
+
+        let new_service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .create()
+            .unwrap();
+        let dropped_service = services.pop().unwrap();
+        let dropped_hash = *dropped_service.service_hash();
+        drop(dropped_service);
+
+        let (added, removed) = collect_sync_changes(&mut sut);
+        assert_that!(added, len 1);
+        assert_that!(added[0], eq * new_service.service_hash());
+        assert_that!(removed, len 1);
+        assert_that!(removed[0], eq dropped_hash);
+        assert_that!(sut.get(&dropped_hash), is_none);
+    }
+
     #[instantiate_tests(<iceoryx2::service::ipc::Service>)]
     mod ipc {}
 
@@ -0,0 +1,27 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Introspection Services
+//!
+//! The `iceoryx2-services-introspection` crate provides introspection services for the
+//! services of an iceoryx2 system. These services sample the live metrics of all services
+//! and publish them, so that monitoring applications can subscribe to them instead of
+//! inspecting every service on their own.
+//!
+
+#![no_std]
+#![warn(missing_docs)]
+
+extern crate alloc;
+
+/// Periodic sampling and publishing of the metrics of all services in an iceoryx2 system
+pub mod service_introspection;
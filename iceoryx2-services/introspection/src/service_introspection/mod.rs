@@ -0,0 +1,48 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Service Introspection
+//!
+//! This module provides a service that samples the metrics of all services in an iceoryx2
+//! system and publishes them as one [`ServiceMetrics`](iceoryx2_services_common::ServiceMetrics)
+//! slice per call of `spin`, for instance the number of connected ports and their
+//! accumulated [`PortStatistics`](iceoryx2::port::statistics::PortStatistics).
+//!
+//! ## Usage
+//!
+//! Create a `Service` instance with appropriate configuration and periodically call its
+//! `spin` method.
+//!
+//! ```no_run
+//! use iceoryx2_services_introspection::service_introspection::Service;
+//! use iceoryx2_services_introspection::service_introspection::Config as IntrospectionConfig;
+//! use iceoryx2::prelude::*;
+//!
+//! fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//!     // Create a service introspection service
+//!     let config = IntrospectionConfig::default();
+//!     let mut service = Service::<ipc::Service>::create(&config, &Config::global_config()).expect("Failed to create service");
+//!
+//!     // Periodically sample and publish the metrics
+//!     loop {
+//!         let number_of_services = service.spin()?;
+//!         // Sleep or do other work...
+//!     }
+//!
+//!     Ok(())
+//! }
+
+/// A service introspection service that samples and publishes the metrics of all services.
+mod service;
+
+pub use service::*;
@@ -0,0 +1,375 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::vec::Vec;
+
+use iceoryx2::prelude::{AllocationStrategy, CallbackProgression, MessagingPattern};
+use iceoryx2::{
+    config::Config as IceoryxConfig,
+    node::{Node, NodeBuilder, NodeCreationFailure},
+    port::{
+        LoanError, SendError,
+        notifier::{Notifier, NotifierCreateError, NotifierNotifyError},
+        publisher::{Publisher, PublisherCreateError},
+        statistics::PortStatistics,
+    },
+    prelude::ServiceName,
+    service::{
+        Service as ServiceType, ServiceListError,
+        builder::{
+            event::EventOpenOrCreateError, publish_subscribe::PublishSubscribeOpenOrCreateError,
+        },
+        inspector::ServiceInspector,
+    },
+};
+use iceoryx2_bb_concurrency::lazy_lock::LazyLock;
+use iceoryx2_services_common::ServiceMetrics;
+
+const SERVICE_NAME: &str = "introspection/services/";
+
+/// The payload type used for publishing the metrics of all services
+pub type Payload = [ServiceMetrics];
+
+/// Errors that can occur when creating the service introspection service.
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum CreationError {
+    /// Failed to create the underlying node.
+    NodeCreationFailure,
+
+    /// Failed to create the service.
+    ServiceCreationFailure,
+
+    /// Failed to create the publisher for reasons other than it already existing.
+    PublisherCreationError,
+
+    /// A publisher to the service already exists.
+    PublisherAlreadyExists,
+
+    /// A notifier to the service already exists.
+    NotifierAlreadyExists,
+}
+
+impl core::fmt::Display for CreationError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "CreationError::{self:?}")
+    }
+}
+
+impl core::error::Error for CreationError {}
+
+impl From<NodeCreationFailure> for CreationError {
+    fn from(_: NodeCreationFailure) -> Self {
+        CreationError::NodeCreationFailure
+    }
+}
+
+impl From<PublishSubscribeOpenOrCreateError> for CreationError {
+    fn from(_: PublishSubscribeOpenOrCreateError) -> Self {
+        CreationError::ServiceCreationFailure
+    }
+}
+
+impl From<PublisherCreateError> for CreationError {
+    fn from(error: PublisherCreateError) -> Self {
+        match error {
+            PublisherCreateError::ExceedsMaxSupportedPublishers => {
+                CreationError::PublisherAlreadyExists
+            }
+            PublisherCreateError::UnableToCreateDataSegment
+            | PublisherCreateError::FailedToDeployThreadsafetyPolicy
+            | PublisherCreateError::UnableToCreatePortTag => CreationError::PublisherCreationError,
+        }
+    }
+}
+
+impl From<EventOpenOrCreateError> for CreationError {
+    fn from(_: EventOpenOrCreateError) -> Self {
+        CreationError::ServiceCreationFailure
+    }
+}
+
+impl From<NotifierCreateError> for CreationError {
+    fn from(_: NotifierCreateError) -> Self {
+        CreationError::NotifierAlreadyExists
+    }
+}
+
+/// Errors that can occur during the spin operation of the service introspection service.
+#[derive(Debug, Eq, PartialEq, Clone, Copy)]
+pub enum SpinError {
+    /// The caller does not have sufficient permissions to list the services.
+    InsufficientPermissions,
+
+    /// Failed to list the services of the iceoryx2 system.
+    ServiceListFailure,
+
+    /// Failed to publish the metrics.
+    PublishFailure,
+
+    /// Failed to send a notification about published metrics.
+    NotifyFailure,
+}
+
+impl core::fmt::Display for SpinError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "SpinError::{self:?}")
+    }
+}
+
+impl core::error::Error for SpinError {}
+
+impl From<ServiceListError> for SpinError {
+    fn from(error: ServiceListError) -> Self {
+        match error {
+            ServiceListError::InsufficientPermissions => SpinError::InsufficientPermissions,
+            ServiceListError::InternalError => SpinError::ServiceListFailure,
+        }
+    }
+}
+
+impl From<LoanError> for SpinError {
+    fn from(_: LoanError) -> Self {
+        SpinError::PublishFailure
+    }
+}
+
+impl From<SendError> for SpinError {
+    fn from(_: SendError) -> Self {
+        SpinError::PublishFailure
+    }
+}
+
+impl From<NotifierNotifyError> for SpinError {
+    fn from(_: NotifierNotifyError) -> Self {
+        SpinError::NotifyFailure
+    }
+}
+
+/// Configuration for the service introspection service.
+#[derive(Debug, Clone)]
+pub struct Config {
+    /// Whether to include iceoryx-internal services in the published metrics.
+    pub include_internal: bool,
+
+    /// The maximum number of subscribers to the service permitted.
+    pub max_subscribers: usize,
+
+    /// The maximum number of samples the subscriber retains in its buffer.
+    pub max_buffer_size: usize,
+
+    /// The maximum number of samples subscribers are permitted to hold loans for.
+    pub max_borrowed_samples: usize,
+
+    /// The number of older samples the subscriber can request from the service when starting.
+    pub history_size: usize,
+
+    /// The initial number of services that fit into a published sample. The samples grow
+    /// when more services exist.
+    pub initial_max_slice_len: usize,
+
+    /// Whether to send a notification whenever metrics are published.
+    pub send_notifications: bool,
+
+    /// The maximum number of listeners to the service permitted.
+    pub max_listeners: usize,
+}
+
+impl Default for Config {
+    fn default() -> Self {
+        let defaults = iceoryx2::config::Config::default().defaults;
+        Self {
+            include_internal: true,
+            max_subscribers: defaults.publish_subscribe.max_subscribers,
+            max_buffer_size: defaults.publish_subscribe.subscriber_max_buffer_size,
+            max_borrowed_samples: defaults.publish_subscribe.subscriber_max_borrowed_samples,
+            history_size: 1,
+            initial_max_slice_len: 32,
+            send_notifications: true,
+            max_listeners: defaults.event.max_listeners,
+        }
+    }
+}
+
+/// The service introspection service.
+///
+/// This service samples the metrics of all services in the system, like the number of
+/// connected ports and their accumulated [`PortStatistics`], and publishes them as one
+/// sample with a [`ServiceMetrics`] entry for every service. The metrics are read from the
+/// dynamic configuration of the services without registering a [`Node`] at them.
+///
+/// # Type Parameters
+///
+/// * `S` - The service type that this introspection service operates on.
+#[derive(Debug)]
+pub struct Service<S: ServiceType> {
+    introspection_config: Config,
+    iceoryx_config: IceoryxConfig,
+    _node: Node<S>,
+    publisher: Publisher<S, Payload, ()>,
+    notifier: Option<Notifier<S>>,
+    metrics: Vec<ServiceMetrics>,
+}
+
+impl<S: ServiceType> Service<S> {
+    /// Creates the service introspection service.
+    ///
+    /// # Parameters
+    ///
+    /// * `introspection_config` - Configuration for the introspection service.
+    /// * `iceoryx_config` - Configuration for the underlying iceoryx system.
+    ///
+    /// # Returns
+    ///
+    /// A result containing either the created service or an error if creation failed.
+    pub fn create(
+        introspection_config: &Config,
+        iceoryx_config: &IceoryxConfig,
+    ) -> Result<Self, CreationError> {
+        let node = NodeBuilder::new().config(iceoryx_config).create::<S>()?;
+
+        let publish_subscribe = node
+            .service_builder(service_name())
+            .publish_subscribe::<Payload>()
+            .subscriber_max_buffer_size(introspection_config.max_buffer_size)
+            .subscriber_max_borrowed_samples(introspection_config.max_borrowed_samples)
+            .history_size(introspection_config.history_size)
+            .max_subscribers(introspection_config.max_subscribers)
+            .max_publishers(1)
+            .open_or_create()?;
+
+        let publisher = publish_subscribe
+            .publisher_builder()
+            .initial_max_slice_len(introspection_config.initial_max_slice_len)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .create()?;
+
+        let mut notifier = None;
+        if introspection_config.send_notifications {
+            let event = node
+                .service_builder(service_name())
+                .event()
+                .max_listeners(introspection_config.max_listeners)
+                .max_notifiers(1)
+                .open_or_create()?;
+
+            notifier = Some(event.notifier_builder().create()?);
+        }
+
+        Ok(Service::<S> {
+            introspection_config: introspection_config.clone(),
+            iceoryx_config: iceoryx_config.clone(),
+            _node: node,
+            publisher,
+            notifier,
+            metrics: Vec::new(),
+        })
+    }
+
+    /// Samples the metrics of all services and publishes them.
+    ///
+    /// This function should be called periodically, e.g. from a
+    /// [`WaitSet`](iceoryx2::waitset::WaitSet) interval. Services that are removed while
+    /// they are sampled are skipped.
+    ///
+    /// # Returns
+    ///
+    /// A result containing the number of services whose metrics were published.
+    ///
+    /// # Errors
+    ///
+    /// Returns a `SpinError` if the services could not be listed or there was an error
+    /// publishing the metrics or sending the notification.
+    pub fn spin(&mut self) -> Result<usize, SpinError> {
+        let include_internal = self.introspection_config.include_internal;
+        let iceoryx_config = &self.iceoryx_config;
+        let metrics = &mut self.metrics;
+        metrics.clear();
+
+        S::list_service_hashes(iceoryx_config, |service_hash| {
+            if let Ok(Some(inspector)) = S::inspect_from_service_hash(iceoryx_config, &service_hash)
+            {
+                if include_internal
+                    || !ServiceName::has_iox2_prefix(inspector.static_config().name())
+                {
+                    metrics.push(service_metrics(&inspector));
+                }
+            }
+            CallbackProgression::Continue
+        })?;
+
+        let sample = self.publisher.loan_slice_uninit(self.metrics.len())?;
+        let sample = sample.write_from_fn(|index| self.metrics[index]);
+        sample.send()?;
+
+        if let Some(notifier) = &self.notifier {
+            notifier.notify()?;
+        }
+
+        Ok(self.metrics.len())
+    }
+}
+
+fn service_metrics<S: ServiceType>(inspector: &ServiceInspector<S>) -> ServiceMetrics {
+    let mut number_of_nodes = 0;
+    inspector.list_node_ids(|_| {
+        number_of_nodes += 1;
+        CallbackProgression::Continue
+    });
+
+    let mut metrics = ServiceMetrics {
+        service_hash: *inspector.static_config().service_hash(),
+        messaging_pattern: MessagingPattern::PublishSubscribe,
+        number_of_nodes,
+        number_of_senders: 0,
+        number_of_receivers: 0,
+        sender_statistics: PortStatistics::default(),
+        receiver_statistics: PortStatistics::default(),
+    };
+
+    if let Some(dynamic_config) = inspector.publish_subscribe() {
+        metrics.number_of_senders = dynamic_config.number_of_publishers() as u64;
+        metrics.number_of_receivers = dynamic_config.number_of_subscribers() as u64;
+        metrics.sender_statistics = dynamic_config.publisher_statistics();
+        metrics.receiver_statistics = dynamic_config.subscriber_statistics();
+    } else if let Some(dynamic_config) = inspector.event() {
+        metrics.messaging_pattern = MessagingPattern::Event;
+        metrics.number_of_senders = dynamic_config.number_of_notifiers() as u64;
+        metrics.number_of_receivers = dynamic_config.number_of_listeners() as u64;
+        metrics.receiver_statistics = dynamic_config.listener_statistics();
+    } else if let Some(dynamic_config) = inspector.request_response() {
+        metrics.messaging_pattern = MessagingPattern::RequestResponse;
+        metrics.number_of_senders = dynamic_config.number_of_clients() as u64;
+        metrics.number_of_receivers = dynamic_config.number_of_servers() as u64;
+        metrics.receiver_statistics = dynamic_config.server_statistics();
+    } else if let Some(dynamic_config) = inspector.blackboard() {
+        metrics.messaging_pattern = MessagingPattern::Blackboard;
+        metrics.number_of_senders = dynamic_config.number_of_writers() as u64;
+        metrics.number_of_receivers = dynamic_config.number_of_readers() as u64;
+    }
+
+    metrics
+}
+
+/// Returns the service name used by the service introspection service.
+///
+/// # Panics
+///
+/// This function will panic during the first call if the service name is invalid,
+/// which should never happen with the predefined constants.
+pub fn service_name() -> &'static ServiceName {
+    static SERVICE_NAME_INSTANCE: LazyLock<ServiceName> = LazyLock::new(|| {
+        ServiceName::__internal_new_prefixed(SERVICE_NAME)
+            .expect("shouldn't occur: invalid service name for service introspection service")
+    });
+
+    &SERVICE_NAME_INSTANCE
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+extern crate alloc;
+
+mod service_introspection_service {
+
+    use iceoryx2::prelude::*;
+    use iceoryx2::testing::*;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_services_introspection::service_introspection::{
+        Config, Payload, Service, service_name,
+    };
+
+    fn create_subscriber(
+        node: &Node<ipc::Service>,
+    ) -> iceoryx2::port::subscriber::Subscriber<ipc::Service, Payload, ()> {
+        node.service_builder(service_name())
+            .publish_subscribe::<Payload>()
+            .open_or_create()
+            .unwrap()
+            .subscriber_builder()
+            .create()
+            .unwrap()
+    }
+
+    #[test]
+    fn publishes_metrics_of_all_services() {
+        const NUMBER_OF_SERVICES: usize = 5;
+
+        let iceoryx_config = generate_isolated_config();
+        let introspection_config = Config {
+            include_internal: false,
+            send_notifications: false,
+            ..Default::default()
+        };
+        let mut sut =
+            Service::<ipc::Service>::create(&introspection_config, &iceoryx_config).unwrap();
+
+        let node = NodeBuilder::new()
+            .config(&iceoryx_config)
+            .create::<ipc::Service>()
+            .unwrap();
+        let subscriber = create_subscriber(&node);
+
+        let mut services = vec![];
+        for _ in 0..NUMBER_OF_SERVICES {
+            let service = node
+                .service_builder(&generate_service_name())
+                .publish_subscribe::<u64>()
+                .create()
+                .unwrap();
+            services.push(service);
+        }
+
+        assert_that!(sut.spin(), eq Ok(NUMBER_OF_SERVICES));
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(sample.payload(), len NUMBER_OF_SERVICES);
+        for service in &services {
+            let metrics = sample
+                .payload()
+                .iter()
+                .find(|m| m.service_hash == *service.service_hash());
+            assert_that!(metrics, is_some);
+            assert_that!(metrics.unwrap().messaging_pattern, eq MessagingPattern::PublishSubscribe);
+        }
+    }
+
+    #[test]
+    fn metrics_contain_port_statistics() {
+        const NUMBER_OF_SAMPLES: u64 = 3;
+
+        let iceoryx_config = generate_isolated_config();
+        let introspection_config = Config {
+            include_internal: false,
+            send_notifications: false,
+            ..Default::default()
+        };
+        let mut sut =
+            Service::<ipc::Service>::create(&introspection_config, &iceoryx_config).unwrap();
+
+        let node = NodeBuilder::new()
+            .config(&iceoryx_config)
+            .create::<ipc::Service>()
+            .unwrap();
+        let subscriber = create_subscriber(&node);
+
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        let service_subscriber = service.subscriber_builder().create().unwrap();
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(n).unwrap();
+        }
+        while service_subscriber.receive().unwrap().is_some() {}
+
+        assert_that!(sut.spin(), eq Ok(1));
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(sample.payload(), len 1);
+        let metrics = &sample.payload()[0];
+        assert_that!(metrics.number_of_nodes, eq 1);
+        assert_that!(metrics.number_of_senders, eq 1);
+        assert_that!(metrics.number_of_receivers, eq 1);
+        assert_that!(metrics.sender_statistics.sent, eq NUMBER_OF_SAMPLES);
+        assert_that!(metrics.receiver_statistics.received, eq NUMBER_OF_SAMPLES);
+    }
+
+    #[test]
+    fn internal_services_are_excluded_when_configured() {
+        let iceoryx_config = generate_isolated_config();
+        let introspection_config = Config {
+            include_internal: false,
+            ..Default::default()
+        };
+        let mut sut =
+            Service::<ipc::Service>::create(&introspection_config, &iceoryx_config).unwrap();
+
+        assert_that!(sut.spin(), eq Ok(0));
+    }
+}
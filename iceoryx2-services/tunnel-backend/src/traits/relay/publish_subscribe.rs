@@ -139,6 +139,19 @@ pub trait PublishSubscribeRelay<S: Service> {
     /// [`Sample`] is consumed by this operation.
     fn send(&self, sample: Sample<S>) -> Result<(), Self::SendError>;
 
+    /// Transmits all [`Sample`]s that were sent but are still buffered by the
+    /// relay.
+    ///
+    /// Relays that aggregate multiple [`Sample`]s into one backend message
+    /// can defer the transmission in [`PublishSubscribeRelay::send()`]. The
+    /// caller invokes [`PublishSubscribeRelay::flush()`] after all currently
+    /// available [`Sample`]s were sent, which bounds the added latency.
+    /// Relays that transmit every [`Sample`] immediately do not need to
+    /// override it.
+    fn flush(&self) -> Result<(), Self::SendError> {
+        Ok(())
+    }
+
     /// Attempts to receive a [`Sample`] via the backend communication mechanism.
     ///
     /// Checks for incoming [`Sample`]s without blocking. If a [`Sample`] is available,
@@ -147,7 +160,10 @@ pub trait PublishSubscribeRelay<S: Service> {
     ///
     /// The loan function must allocate enough memory to hold the incoming
     /// [`Sample`]'s payload. The relay should initialize this memory with the
-    /// received data.
+    /// received data. To avoid copying the data twice, the relay should loan
+    /// the [`Sample`] as soon as the size is known and receive or deserialize
+    /// the data directly into the loaned memory instead of staging it in an
+    /// intermediate buffer.
     ///
     /// # Parameters
     ///
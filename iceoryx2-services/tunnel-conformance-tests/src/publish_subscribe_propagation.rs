@@ -15,7 +15,10 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 #[allow(clippy::module_inception)]
 #[conformance_tests]
 pub mod publish_subscribe_propagation {
+    use alloc::collections::BTreeMap;
     use alloc::string::{String, ToString};
+    use alloc::vec;
+    use alloc::vec::Vec;
     use core::fmt::Debug;
     use core::time::Duration;
 
@@ -27,7 +30,7 @@ pub mod publish_subscribe_propagation {
     use iceoryx2_bb_testing::assert_that;
     use iceoryx2_bb_testing::test_fail;
     use iceoryx2_bb_testing_macros::conformance_test;
-    use iceoryx2_services_tunnel::Tunnel;
+    use iceoryx2_services_tunnel::{Config as TunnelConfig, ForwardingRule, Tunnel};
     use iceoryx2_services_tunnel_backend::traits::{Backend, testing::Testing};
 
     #[derive(Default, Debug, Clone, PartialEq, ZeroCopySend)]
@@ -534,4 +537,115 @@ pub mod publish_subscribe_propagation {
             test_fail!("sample looped back")
         }
     }
+
+    #[conformance_test]
+    pub fn downsampling_forwards_only_every_nth_sample<
+        S: Service,
+        B: Backend<S> + Debug,
+        T: Testing,
+    >() {
+        const MAX_ATTEMPTS: usize = 25;
+        const TIMEOUT: Duration = Duration::from_millis(250);
+        const DOWNSAMPLING: u64 = 3;
+        const NUMBER_OF_SAMPLES: u64 = 9;
+
+        // === SETUP ===
+        let service_name = generate_service_name();
+
+        // --- Host A ---
+        let iceoryx_config_a = generate_isolated_config();
+        let mut forwarding_rules = BTreeMap::new();
+        forwarding_rules.insert(
+            service_name.as_str().to_string(),
+            ForwardingRule {
+                downsampling: DOWNSAMPLING,
+                ..Default::default()
+            },
+        );
+        let mut tunnel_a = Tunnel::<S, B>::new()
+            .tunnel_config(TunnelConfig {
+                forwarding_rules,
+                ..Default::default()
+            })
+            .iceoryx_config(iceoryx_config_a.clone())
+            .polled()
+            .create()
+            .unwrap();
+
+        let node_a = NodeBuilder::new()
+            .config(&iceoryx_config_a)
+            .create::<S>()
+            .unwrap();
+        let service_a = node_a
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .open_or_create()
+            .unwrap();
+        let publisher_a = service_a.publisher_builder().create().unwrap();
+
+        tunnel_a.discover_over_iceoryx().unwrap();
+        assert_that!(tunnel_a.tunneled_services().len(), eq 1);
+
+        // --- Host B ---
+        let iceoryx_config_b = generate_isolated_config();
+        let mut tunnel_b = Tunnel::<S, B>::new()
+            .iceoryx_config(iceoryx_config_b.clone())
+            .polled()
+            .create()
+            .unwrap();
+
+        T::retry(
+            || {
+                tunnel_b.discover_over_backend().unwrap();
+                if tunnel_b.tunneled_services().len() == 1 {
+                    return Ok(());
+                }
+                Err("No services discovered")
+            },
+            TIMEOUT,
+            Some(MAX_ATTEMPTS),
+        )
+        .unwrap_or_else(|e| panic!("Failed to discover remote services:\n{}", e));
+
+        T::sync(service_a.service_hash().as_str().to_string(), TIMEOUT);
+
+        let node_b = NodeBuilder::new()
+            .config(&iceoryx_config_b)
+            .create::<S>()
+            .unwrap();
+        let service_b = node_b
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .open_or_create()
+            .unwrap();
+        let subscriber_b = service_b.subscriber_builder().create().unwrap();
+
+        // === TEST ===
+        for i in 0..NUMBER_OF_SAMPLES {
+            publisher_a.send_copy(i).unwrap();
+        }
+
+        let mut received = Vec::new();
+        T::retry(
+            || {
+                tunnel_a.propagate().unwrap();
+                tunnel_b.propagate().unwrap();
+                while let Some(sample) = subscriber_b.receive().unwrap() {
+                    received.push(*sample);
+                }
+
+                if received.len() < (NUMBER_OF_SAMPLES / DOWNSAMPLING) as usize {
+                    return Err("Failed to receive all forwarded samples");
+                }
+                Ok(())
+            },
+            TIMEOUT,
+            Some(MAX_ATTEMPTS),
+        )
+        .unwrap_or_else(|e| panic!("Failed to propagate over tunnel:\n{}", e));
+
+        assert_that!(received, eq vec![0, 3, 6]);
+    }
 }
@@ -25,7 +25,7 @@ use iceoryx2_services_tunnel_backend::types::publish_subscribe::LoanFn;
 
 use crate::ports::event::EventPorts;
 use crate::ports::publish_subscribe::PublishSubscribePorts;
-use crate::tunnel::{DiscoveryError, PropagateError};
+use crate::tunnel::{DiscoveryError, ForwardingRule, PropagateError};
 
 /// A bidirectional bridge for a single service: the local iceoryx2 ports on one
 /// side and the backend relay on the other.
@@ -44,11 +44,13 @@ pub(crate) enum Bridge<S: Service, B: Backend<S>> {
 
 impl<S: Service, B: Backend<S>> Bridge<S, B> {
     /// Creates the ports and relay matching the messaging pattern of
-    /// `static_config`.
+    /// `static_config`. The `forwarding_rule` applies only to
+    /// publish-subscribe services.
     pub(crate) fn open(
         node: &Node<S>,
         backend: &B,
         static_config: &StaticConfig,
+        forwarding_rule: ForwardingRule,
     ) -> Result<Self, DiscoveryError> {
         let origin = "Bridge::open";
 
@@ -56,7 +58,7 @@ impl<S: Service, B: Backend<S>> Bridge<S, B> {
             MessagingPattern::PublishSubscribe(_) => {
                 let ports = fail!(
                     from origin,
-                    when PublishSubscribePorts::new(static_config, node),
+                    when PublishSubscribePorts::new(static_config, node, forwarding_rule),
                     with DiscoveryError::PublishSubscribePortCreation,
                     "Failed to create publish-subscribe ports"
                 );
@@ -93,6 +95,14 @@ impl<S: Service, B: Backend<S>> Bridge<S, B> {
         }
     }
 
+    /// Returns the priority with which the bridge is propagated.
+    pub(crate) fn priority(&self) -> u8 {
+        match self {
+            Bridge::PublishSubscribe { ports, .. } => ports.forwarding_rule.priority,
+            Bridge::Event { .. } => 0,
+        }
+    }
+
     /// Propagates payloads/events in both directions for this bridge.
     pub(crate) fn propagate(&self, node_id: &UniqueNodeId) -> Result<(), PropagateError> {
         match self {
@@ -120,6 +130,13 @@ fn propagate_publish_subscribe_payloads<S: Service, B: Backend<S>>(
         "Failed to receive publish-subscribe payload for propagation"
     );
     if propagated {
+        fail!(
+            from origin,
+            when relay.flush(),
+            with PropagateError::PayloadPropagation,
+            "Failed to flush publish-subscribe payloads buffered for propagation"
+        );
+
         info!(
             from origin,
             "Propagated {}({})",
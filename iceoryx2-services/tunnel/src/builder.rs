@@ -341,5 +341,6 @@ where
         backend,
         local_discovery,
         services_filter,
+        tunnel_config.forwarding_rules,
     ))
 }
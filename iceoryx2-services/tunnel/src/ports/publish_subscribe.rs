@@ -10,6 +10,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use core::cell::Cell;
+
 use alloc::format;
 
 use iceoryx2::identifiers::UniqueNodeId;
@@ -22,6 +24,8 @@ use iceoryx2_services_tunnel_backend::types::publish_subscribe::{
     Header, LoanFn, Payload, Publisher, Sample, SampleMut, Subscriber,
 };
 
+use crate::tunnel::ForwardingRule;
+
 #[derive(Debug, Eq, PartialEq, Clone, Copy)]
 pub enum CreationError {
     Service,
@@ -70,10 +74,16 @@ pub(crate) struct PublishSubscribePorts<S: Service> {
     pub(crate) static_config: StaticConfig,
     pub(crate) publisher: Publisher<S>,
     pub(crate) subscriber: Subscriber<S>,
+    pub(crate) forwarding_rule: ForwardingRule,
+    received_samples: Cell<u64>,
 }
 
 impl<S: Service> PublishSubscribePorts<S> {
-    pub(crate) fn new(static_config: &StaticConfig, node: &Node<S>) -> Result<Self, CreationError> {
+    pub(crate) fn new(
+        static_config: &StaticConfig,
+        node: &Node<S>,
+        forwarding_rule: ForwardingRule,
+    ) -> Result<Self, CreationError> {
         let origin = format!(
             "PublishSubscribePorts<{}>::new",
             core::any::type_name::<S>()
@@ -128,6 +138,8 @@ impl<S: Service> PublishSubscribePorts<S> {
             static_config: static_config.clone(),
             publisher,
             subscriber,
+            forwarding_rule,
+            received_samples: Cell::new(0),
         })
     }
 
@@ -202,8 +214,18 @@ impl<S: Service> PublishSubscribePorts<S> {
         PropagateFn: FnMut(Sample<S>) -> Result<(), E>,
     {
         let mut propagated = false;
+        let mut number_of_propagated_samples = 0;
+        let downsampling = self.forwarding_rule.downsampling.max(1);
 
         loop {
+            if self
+                .forwarding_rule
+                .max_samples_per_propagation
+                .is_some_and(|max| number_of_propagated_samples >= max)
+            {
+                break;
+            }
+
             let sample = unsafe { self.subscriber.receive_custom_payload() };
             let sample = fail!(
                 from self,
@@ -226,6 +248,12 @@ impl<S: Service> PublishSubscribePorts<S> {
                         continue;
                     }
 
+                    let received_samples = self.received_samples.get();
+                    self.received_samples.set(received_samples.wrapping_add(1));
+                    if received_samples % downsampling != 0 {
+                        continue;
+                    }
+
                     fail!(
                         from self,
                         when propagate(sample),
@@ -234,6 +262,7 @@ impl<S: Service> PublishSubscribePorts<S> {
                     );
 
                     propagated = true;
+                    number_of_propagated_samples += 1;
                 }
                 None => break,
             }
@@ -89,10 +89,42 @@ impl core::fmt::Display for PropagateError {
 
 impl core::error::Error for PropagateError {}
 
+/// Defines how the samples of a publish-subscribe service are forwarded to
+/// the [`Backend`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ForwardingRule {
+    /// Only every n-th sample is forwarded, the others are discarded. A
+    /// value of 0 or 1 forwards every sample.
+    pub downsampling: u64,
+    /// The maximum number of samples that are forwarded in one
+    /// [`Tunnel::propagate()`] call. Remaining samples stay in the buffer of
+    /// the tunnel's subscriber until the next call. [`None`] forwards all
+    /// available samples.
+    pub max_samples_per_propagation: Option<usize>,
+    /// Services with a higher priority are propagated before services with
+    /// a lower priority, so that the samples of small control services are
+    /// not queued behind the samples of bulk services.
+    pub priority: u8,
+}
+
+impl Default for ForwardingRule {
+    fn default() -> Self {
+        Self {
+            downsampling: 1,
+            max_samples_per_propagation: None,
+            priority: 0,
+        }
+    }
+}
+
 #[derive(Debug, Default, Clone)]
 pub struct Config {
     pub discovery_service: Option<String>,
     pub services: Option<Vec<String>>,
+    /// [`ForwardingRule`]s of publish-subscribe services identified by their
+    /// service name. Services without a rule use
+    /// [`ForwardingRule::default()`].
+    pub forwarding_rules: BTreeMap<String, ForwardingRule>,
 }
 
 #[derive(Debug)]
@@ -103,6 +135,9 @@ pub struct Tunnel<S: Service, B: for<'a> Backend<S> + Debug> {
     bridges: BTreeMap<ServiceHash, Bridge<S, B>>,
     discovery_strategy: LocalDiscoveryStrategy<S>,
     services_filter: Option<BTreeSet<String>>,
+    forwarding_rules: BTreeMap<String, ForwardingRule>,
+    /// Publish-subscribe bridges ordered by descending priority.
+    propagation_order: Vec<ServiceHash>,
 }
 
 impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
@@ -124,6 +159,7 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
         backend: B,
         discovery_strategy: LocalDiscoveryStrategy<S>,
         services_filter: Option<BTreeSet<String>>,
+        forwarding_rules: BTreeMap<String, ForwardingRule>,
     ) -> Self {
         Self {
             node,
@@ -132,6 +168,8 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
             bridges: BTreeMap::new(),
             discovery_strategy,
             services_filter,
+            forwarding_rules,
+            propagation_order: Vec::new(),
         }
     }
 
@@ -156,8 +194,8 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
 
         // Propagate publish-subscribe payloads before events
         // TODO(#1103): Retain ordering across the wire
-        for bridge in self.bridges.values() {
-            if matches!(bridge, Bridge::PublishSubscribe { .. }) {
+        for hash in &self.propagation_order {
+            if let Some(bridge) = self.bridges.get(hash) {
                 bridge.propagate(self.node.id())?;
             }
         }
@@ -272,6 +310,8 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
 
         let snapshot = self.discovery_state.snapshot();
 
+        let number_of_bridges = self.bridges.len();
+
         // Close bridges no longer offered by any side.
         self.bridges.retain(|hash, _| {
             let keep = snapshot.contains(hash);
@@ -280,6 +320,7 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
             }
             keep
         });
+        let mut bridges_changed = number_of_bridges != self.bridges.len();
 
         // Open bridges for newly-offered services.
         for (hash, static_config) in snapshot.iter() {
@@ -292,13 +333,40 @@ impl<S: Service, B: for<'a> Backend<S> + Debug> Tunnel<S, B> {
                 static_config.messaging_pattern(),
                 static_config.name()
             );
-            let bridge = Bridge::open(&self.node, &self.backend, static_config)?;
+            let forwarding_rule = self
+                .forwarding_rules
+                .get(static_config.name().as_str())
+                .copied()
+                .unwrap_or_default();
+            let bridge = Bridge::open(&self.node, &self.backend, static_config, forwarding_rule)?;
             self.bridges.insert(*hash, bridge);
+            bridges_changed = true;
+        }
+
+        if bridges_changed {
+            self.update_propagation_order();
         }
 
         Ok(())
     }
 
+    /// Orders the publish-subscribe bridges by descending priority. Bridges
+    /// with the same priority retain their order.
+    fn update_propagation_order(&mut self) {
+        self.propagation_order.clear();
+        self.propagation_order.extend(
+            self.bridges
+                .iter()
+                .filter(|(_, bridge)| matches!(bridge, Bridge::PublishSubscribe { .. }))
+                .map(|(hash, _)| *hash),
+        );
+
+        let bridges = &self.bridges;
+        self.propagation_order.sort_by_key(|hash| {
+            core::cmp::Reverse(bridges.get(hash).map_or(0, |bridge| bridge.priority()))
+        });
+    }
+
     /// Sanity check that the open bridges match the discovery
     /// state exactly. No-op in release builds.
     fn debug_assert_synchronized(&self) {
@@ -126,6 +126,18 @@ extern crate alloc;
 /// Free functions to convert bytes to a hex string and back.
 pub mod hex_conversion;
 
+/// Contains the [`MappedReplayer`](crate::mapped_replayer::MappedReplayer) to seek in and read
+/// captured payload from a memory mapped file without copying.
+pub mod mapped_replayer;
+
+/// Contains the [`MultiRecorder`](crate::multi_recorder::MultiRecorder) to write the captured
+/// payload of multiple services into one time-ordered file.
+pub mod multi_recorder;
+
+/// Contains the [`MultiReplayer`](crate::multi_replayer::MultiReplayer) to read a file that
+/// was written by the [`MultiRecorder`](crate::multi_recorder::MultiRecorder).
+pub mod multi_replayer;
+
 /// Loads a meaninful subset.
 pub mod prelude;
 
@@ -139,6 +151,10 @@ pub mod record_header;
 /// Contains the [`Recorder`](crate::recorder::Recorder) to write captured payload into a file.
 pub mod recorder;
 
+/// Contains the [`ReplayTimer`](crate::replay_timer::ReplayTimer) to reproduce the recorded
+/// inter-arrival times of the records.
+pub mod replay_timer;
+
 /// Contains the [`Replayer`](crate::replayer::Replayer) to read captured payload from a file.
 pub mod replayer;
 
@@ -0,0 +1,293 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! ## Example
+//!
+//! ### Seek And Read Records Without Copying (Large Files)
+//!
+//! A file recorded with [`DataRepresentation::Iox2Dump`](crate::record::DataRepresentation)
+//! is mapped into the process space. When it is opened, an index over the timestamps of all
+//! records is created so that the replay can start at any point in time. The records are
+//! slices into the mapped file and are never copied.
+//!
+//! ```no_run
+//! use core::time::Duration;
+//! use iceoryx2_userland_record_and_replay::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let replayer = MappedReplayerOpener::new(&FilePath::new(b"recorded_data.iox2")?).open()?;
+//!
+//! println!("record header of service types {:?}", replayer.header());
+//!
+//! for record in replayer.records_since(Duration::from_secs(60)) {
+//!     println!("payload: {:?}", record.payload);
+//!     println!("user_header: {:?}", record.user_header);
+//!     println!("system_header: {:?}", record.system_header);
+//!     println!("timestamp: {:?}", record.timestamp);
+//! }
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::mem::MaybeUninit;
+use core::time::Duration;
+
+use alloc::vec::Vec;
+
+use iceoryx2_bb_posix::file::AccessMode;
+use iceoryx2_bb_posix::file::File;
+use iceoryx2_bb_posix::file::FileBuilder;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptor;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptorBased;
+use iceoryx2_bb_posix::file_descriptor::FileDescriptorManagement;
+use iceoryx2_bb_posix::memory_mapping::MappingBehavior;
+use iceoryx2_bb_posix::memory_mapping::MappingPermission;
+use iceoryx2_bb_posix::memory_mapping::MemoryMapping;
+use iceoryx2_bb_posix::memory_mapping::MemoryMappingBuilder;
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_log::fail;
+
+use crate::record::RawRecord;
+use crate::record::RecordReader;
+use crate::record_header::{RecordHeader, RecordHeaderDetails};
+use crate::replayer::ReplayerOpenError;
+
+const LEN_FIELD_SIZE: usize = core::mem::size_of::<u64>();
+
+#[derive(Debug, Clone, Copy)]
+struct IndexEntry {
+    timestamp: Duration,
+    offset: usize,
+}
+
+#[derive(Debug)]
+/// Builder to open a file recorded with
+/// [`DataRepresentation::Iox2Dump`](crate::record::DataRepresentation) as [`MappedReplayer`].
+pub struct MappedReplayerOpener {
+    file_path: FilePath,
+}
+
+impl MappedReplayerOpener {
+    /// Creates a new [`MappedReplayerOpener`]
+    pub fn new(file_path: &FilePath) -> Self {
+        Self {
+            file_path: *file_path,
+        }
+    }
+
+    /// Maps the recorded file into the process space, verifies all records and creates the
+    /// timestamp index.
+    pub fn open(self) -> Result<MappedReplayer, ReplayerOpenError> {
+        let msg = "Unable to map recorded data";
+        let file = match FileBuilder::new(&self.file_path)
+            .has_ownership(false)
+            .open_existing(AccessMode::Read)
+        {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with ReplayerOpenError::FailedToOpenFile,
+                    "{msg} since the file could not be opened ({e:?}).");
+            }
+        };
+
+        let file_size = match file.metadata() {
+            Ok(v) => v.size() as usize,
+            Err(e) => {
+                fail!(from self, with ReplayerOpenError::FailedToReadFile,
+                    "{msg} since the file size could not be acquired ({e:?}).");
+            }
+        };
+
+        if file_size < core::mem::size_of::<RecordHeader>() {
+            fail!(from self, with ReplayerOpenError::UnableToDeserializeRecordHeader,
+                "{msg} since the file is too short to contain a record header.");
+        }
+
+        let raw_fd = unsafe { file.file_descriptor().native_handle() };
+        let fd = unsafe { FileDescriptor::non_owning_new_unchecked(raw_fd) };
+        let memory_mapping = match MemoryMappingBuilder::from_file_descriptor(fd)
+            .mapping_behavior(MappingBehavior::Private)
+            .initial_mapping_permission(MappingPermission::Read)
+            .size(file_size)
+            .create()
+        {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with ReplayerOpenError::FailedToReadFile,
+                    "{msg} since the file could not be mapped into the process space ({e:?}).");
+            }
+        };
+
+        let mut header = MaybeUninit::<RecordHeader>::uninit();
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                memory_mapping.base_address(),
+                header.as_mut_ptr() as *mut u8,
+                core::mem::size_of::<RecordHeader>(),
+            )
+        };
+        let header = unsafe { header.assume_init() };
+
+        let index = Self::create_index(memory_mapping.as_slice(), &header)?;
+
+        Ok(MappedReplayer {
+            _file: file,
+            memory_mapping,
+            header,
+            index,
+        })
+    }
+
+    fn create_index(
+        data: &[u8],
+        header: &RecordHeader,
+    ) -> Result<Vec<IndexEntry>, ReplayerOpenError> {
+        let msg = "Unable to create record index";
+        let origin = "MappedReplayerOpener::create_index()";
+        let reader = RecordReader::new(&header.details);
+
+        let mut index = Vec::new();
+        let mut offset = core::mem::size_of::<RecordHeader>();
+        let mut last_timestamp = Duration::ZERO;
+        while offset < data.len() {
+            let (record, next_offset) = parse_record(data, offset, &header.details)?;
+            reader.verify_raw_record(&record, msg)?;
+
+            let timestamp = record.timestamp;
+            if last_timestamp > timestamp {
+                fail!(from origin, with ReplayerOpenError::CorruptedTimeline,
+                    "{msg} since the record at offset {offset} is older than the previous record. The entries are not allowed to jump back and forth in time.");
+            }
+            last_timestamp = timestamp;
+
+            index.push(IndexEntry { timestamp, offset });
+            offset = next_offset;
+        }
+
+        Ok(index)
+    }
+}
+
+fn read_len(data: &[u8], offset: usize) -> Result<u64, ReplayerOpenError> {
+    match data.get(offset..offset + LEN_FIELD_SIZE) {
+        Some(v) => {
+            let mut buffer = [0u8; LEN_FIELD_SIZE];
+            buffer.copy_from_slice(v);
+            Ok(u64::from_le_bytes(buffer))
+        }
+        None => {
+            fail!(from "MappedReplayer::read_len()", with ReplayerOpenError::FailedToReadFile,
+                "Unable to read record since the file ends prematurely at offset {offset}.");
+        }
+    }
+}
+
+fn read_slice(data: &[u8], offset: usize) -> Result<(&[u8], usize), ReplayerOpenError> {
+    let len = read_len(data, offset)? as usize;
+    let start = offset + LEN_FIELD_SIZE;
+    match start.checked_add(len).and_then(|end| data.get(start..end)) {
+        Some(v) => Ok((v, start + len)),
+        None => {
+            fail!(from "MappedReplayer::read_slice()", with ReplayerOpenError::FailedToReadFile,
+                "Unable to read record since the entry at offset {offset} with a size of {len} exceeds the file.");
+        }
+    }
+}
+
+fn parse_record<'a>(
+    data: &'a [u8],
+    offset: usize,
+    details: &RecordHeaderDetails,
+) -> Result<(RawRecord<'a>, usize), ReplayerOpenError> {
+    let timestamp = read_len(data, offset)?;
+    let (system_header, offset) = read_slice(data, offset + LEN_FIELD_SIZE)?;
+    let (user_header, offset) = read_slice(data, offset)?;
+    let (payload, offset) = read_slice(data, offset)?;
+
+    Ok((
+        RawRecord {
+            timestamp: details.decode_timestamp(timestamp),
+            system_header,
+            user_header,
+            payload,
+        },
+        offset,
+    ))
+}
+
+#[derive(Debug)]
+/// Maps a recorded file into the process space and provides random access to all contained
+/// records. The records are slices into the mapped file, therefore large recordings can be
+/// replayed without reading them into memory.
+pub struct MappedReplayer {
+    _file: File,
+    memory_mapping: MemoryMapping,
+    header: RecordHeader,
+    index: Vec<IndexEntry>,
+}
+
+impl MappedReplayer {
+    /// Returns the header of the recorded file.
+    pub fn header(&self) -> &RecordHeader {
+        &self.header
+    }
+
+    /// Returns the number of records contained in the file.
+    pub fn len(&self) -> usize {
+        self.index.len()
+    }
+
+    /// Returns true when the file does not contain any record.
+    pub fn is_empty(&self) -> bool {
+        self.index.is_empty()
+    }
+
+    /// Returns the timestamp of the first and the last record. If the file does not contain
+    /// any record it returns [`None`].
+    pub fn time_range(&self) -> Option<(Duration, Duration)> {
+        let first = self.index.first()?;
+        let last = self.index.last()?;
+        Some((first.timestamp, last.timestamp))
+    }
+
+    /// Returns the record at position `n`. If `n` is out of bounds it returns [`None`].
+    pub fn record(&self, n: usize) -> Option<RawRecord<'_>> {
+        let entry = self.index.get(n)?;
+        // the records were verified when the index was created
+        parse_record(
+            self.memory_mapping.as_slice(),
+            entry.offset,
+            &self.header.details,
+        )
+        .ok()
+        .map(|(record, _)| record)
+    }
+
+    /// Returns the position of the first record with a timestamp that is not older than
+    /// `timestamp`. If all records are older, it returns [`MappedReplayer::len()`].
+    pub fn position_of(&self, timestamp: Duration) -> usize {
+        self.index
+            .partition_point(|entry| entry.timestamp < timestamp)
+    }
+
+    /// Returns an iterator over all records starting at position `n`.
+    pub fn records_from(&self, n: usize) -> impl Iterator<Item = RawRecord<'_>> {
+        (n..self.len()).filter_map(|n| self.record(n))
+    }
+
+    /// Returns an iterator over all records that are not older than `timestamp`.
+    pub fn records_since(&self, timestamp: Duration) -> impl Iterator<Item = RawRecord<'_>> {
+        self.records_from(self.position_of(timestamp))
+    }
+}
@@ -0,0 +1,285 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! ## Example
+//!
+//! Records multiple services into one file. Every service is a stream with its own
+//! [`ServiceTypes`]. The records of all streams are stored in one time-ordered sequence and
+//! are collected in a write buffer so that the file is written in large sequential blocks.
+//!
+//! Usually, the subscribers of all services are attached to one
+//! [`WaitSet`](iceoryx2::waitset::WaitSet) and every received sample is written with the
+//! [`StreamId`] of its service.
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2_userland_record_and_replay::prelude::*;
+//! use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
+//! use core::time::Duration;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let service_types = ServiceTypes {
+//!     payload: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+//!     user_header: TypeDetail::new::<()>(TypeVariant::FixedSize),
+//!     system_header: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+//! };
+//!
+//! let mut builder = MultiRecorderBuilder::new();
+//! let imu = builder.add_stream(&ServiceName::new("imu")?, &service_types,
+//!                              MessagingPattern::PublishSubscribe);
+//! let odometry = builder.add_stream(&ServiceName::new("odometry")?, &service_types,
+//!                                   MessagingPattern::PublishSubscribe);
+//! let mut recorder = builder.create(&FilePath::new(b"multi_recorded_data.iox2")?)?;
+//!
+//! # iceoryx2_bb_posix::file::File::remove(&FilePath::new(b"multi_recorded_data.iox2")?)?;
+//!
+//! recorder.write(imu, RawRecord {
+//!     timestamp: Duration::ZERO,
+//!     system_header: &[0u8; 8],
+//!     user_header: &[0u8; 0],
+//!     payload: &[0u8; 8]
+//! })?;
+//! recorder.write(odometry, RawRecord {
+//!     timestamp: Duration::from_micros(100),
+//!     system_header: &[0u8; 8],
+//!     user_header: &[0u8; 0],
+//!     payload: &[0u8; 8]
+//! })?;
+//! recorder.flush()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::format;
+use alloc::vec::Vec;
+
+use iceoryx2::prelude::{MessagingPattern, ServiceName};
+use iceoryx2_bb_elementary::package_version::PackageVersion;
+use iceoryx2_bb_posix::file::{CreationMode, File, FileBuilder, FileCreationError};
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_log::{fail, warn};
+
+use crate::record::{DataRepresentation, RawRecord, RecordWriter};
+use crate::record_header::{FILE_FORMAT_IOX2_DUMP_VERSION, RecordHeader, RecordHeaderDetails};
+use crate::recorder::{RecorderCreateError, RecorderWriteError, ServiceTypes};
+
+/// Defines the current file format version of the multi stream format
+pub const FILE_FORMAT_MULTI_STREAM_VERSION: u64 = 1;
+
+/// The default size of the write buffer of the [`MultiRecorder`].
+pub const DEFAULT_WRITE_BUFFER_SIZE: usize = 4 * 1024 * 1024;
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+/// Identifies a stream, the records of one service, in a multi stream recording.
+pub struct StreamId(pub(crate) u64);
+
+impl StreamId {
+    /// Returns the underlying value of the [`StreamId`]. Streams are numbered in the order
+    /// they were added, starting with 0.
+    pub fn value(&self) -> u64 {
+        self.0
+    }
+}
+
+#[derive(Debug)]
+/// Builder to create a new [`MultiRecorder`].
+pub struct MultiRecorderBuilder {
+    streams: Vec<RecordHeader>,
+    write_buffer_size: usize,
+}
+
+impl Default for MultiRecorderBuilder {
+    fn default() -> Self {
+        Self {
+            streams: Vec::new(),
+            write_buffer_size: DEFAULT_WRITE_BUFFER_SIZE,
+        }
+    }
+}
+
+impl MultiRecorderBuilder {
+    /// Creates a new [`MultiRecorderBuilder`] without any stream.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Defines the size of the buffer in which the records are collected before they are
+    /// written into the file. Records that are larger than the buffer are written directly.
+    pub fn write_buffer_size(mut self, value: usize) -> Self {
+        self.write_buffer_size = value;
+        self
+    }
+
+    /// Adds a new stream for the given service and returns its [`StreamId`] that has to be
+    /// provided when a record of this service is written.
+    pub fn add_stream(
+        &mut self,
+        service_name: &ServiceName,
+        types: &ServiceTypes,
+        messaging_pattern: MessagingPattern,
+    ) -> StreamId {
+        self.streams.push(RecordHeader {
+            service_name: *service_name,
+            iceoryx2_version: PackageVersion::get().into(),
+            details: RecordHeaderDetails {
+                file_format_version: FILE_FORMAT_IOX2_DUMP_VERSION,
+                types: types.clone(),
+                messaging_pattern,
+            },
+        });
+
+        StreamId(self.streams.len() as u64 - 1)
+    }
+
+    /// Creates a new file and writes the headers of all streams into it. On failure
+    /// [`RecorderCreateError`] is returned describing the error.
+    pub fn create(self, file_name: &FilePath) -> Result<MultiRecorder, RecorderCreateError> {
+        let msg = format!("Unable to create multi stream recorder for \"{file_name}\"");
+        let mut file = match FileBuilder::new(file_name)
+            .has_ownership(false)
+            .creation_mode(CreationMode::CreateExclusive)
+            .create()
+        {
+            Ok(v) => v,
+            Err(FileCreationError::FileAlreadyExists) => {
+                fail!(from self, with RecorderCreateError::FileAlreadyExists,
+                    "{msg} since the file already exists.");
+            }
+            Err(e) => {
+                fail!(from self, with RecorderCreateError::FailedToCreateRecordFile,
+                    "{msg} since the underlying file could not be created ({e:?}).");
+            }
+        };
+
+        let mut write_to_file = |data: &[u8]| -> Result<(), RecorderCreateError> {
+            fail!(from self,
+                when RecordWriter::write_all(&mut file, data),
+                with RecorderCreateError::UnableToWriteFile,
+                "{msg} since the stream headers could not be written.");
+            Ok(())
+        };
+
+        write_to_file(&FILE_FORMAT_MULTI_STREAM_VERSION.to_le_bytes())?;
+        write_to_file(&(self.streams.len() as u64).to_le_bytes())?;
+        for header in &self.streams {
+            write_to_file(unsafe {
+                core::slice::from_raw_parts(
+                    (header as *const RecordHeader) as *const u8,
+                    core::mem::size_of::<RecordHeader>(),
+                )
+            })?;
+        }
+
+        Ok(MultiRecorder {
+            file,
+            streams: self.streams,
+            write_buffer: Vec::with_capacity(self.write_buffer_size),
+            write_buffer_size: self.write_buffer_size,
+            staging_buffer: Vec::new(),
+            last_timestamp: 0,
+        })
+    }
+}
+
+#[derive(Debug)]
+/// Is created by [`MultiRecorderBuilder`] and stores the captured records of multiple services
+/// in one time-ordered file.
+pub struct MultiRecorder {
+    file: File,
+    streams: Vec<RecordHeader>,
+    write_buffer: Vec<u8>,
+    write_buffer_size: usize,
+    staging_buffer: Vec<u8>,
+    last_timestamp: u64,
+}
+
+impl Drop for MultiRecorder {
+    fn drop(&mut self) {
+        warn!(from self, when self.flush(),
+            "Unable to write the buffered records into the file. They are lost.");
+    }
+}
+
+impl MultiRecorder {
+    /// Adds a captured record of the given stream. The timestamps of the records must not
+    /// decrease, independent of the stream they belong to. The record is buffered and written
+    /// with the next [`MultiRecorder::flush()`] or when the write buffer is full.
+    pub fn write(&mut self, stream: StreamId, record: RawRecord) -> Result<(), RecorderWriteError> {
+        let msg = "Unable to write new record";
+        let header = match self.streams.get(stream.0 as usize) {
+            Some(v) => v,
+            None => {
+                fail!(from self, with RecorderWriteError::UnknownStream,
+                    "{msg} since the stream {stream:?} does not exist.");
+            }
+        };
+
+        header.details.types.verify(&record)?;
+
+        let new_timestamp = record.timestamp.as_nanos() as u64;
+        if self.last_timestamp > new_timestamp {
+            fail!(from self, with RecorderWriteError::TimestampOlderThanPreviousRecord,
+                "{msg} since record timestamp is older than the previous record entry. Records are not allowed to jump back in time.");
+        }
+
+        let record_size = core::mem::size_of::<u64>() * 5
+            + record.system_header.len()
+            + record.user_header.len()
+            + record.payload.len();
+        if self.write_buffer.len() + record_size > self.write_buffer_size {
+            self.flush()?;
+        }
+
+        if record_size > self.write_buffer_size {
+            self.write_into_file(stream, record)?;
+        } else {
+            self.write_buffer.extend_from_slice(&stream.0.to_le_bytes());
+            RecordWriter::serialize_iox2dump(&mut self.write_buffer, &record);
+        }
+        self.last_timestamp = new_timestamp;
+
+        Ok(())
+    }
+
+    /// Writes all buffered records into the file.
+    pub fn flush(&mut self) -> Result<(), RecorderWriteError> {
+        if let Err(e) = RecordWriter::write_all(&mut self.file, &self.write_buffer) {
+            fail!(from self, with RecorderWriteError::FileWriteError(e),
+                    "Failed to write the buffered records into file ({e:?}).");
+        }
+        self.write_buffer.clear();
+
+        Ok(())
+    }
+
+    /// Returns the [`RecordHeader`] of every stream. The position in the slice corresponds
+    /// to the [`StreamId::value()`].
+    pub fn streams(&self) -> &[RecordHeader] {
+        &self.streams
+    }
+
+    fn write_into_file(
+        &mut self,
+        stream: StreamId,
+        record: RawRecord,
+    ) -> Result<(), RecorderWriteError> {
+        if let Err(e) = RecordWriter::write_all(&mut self.file, &stream.0.to_le_bytes()) {
+            fail!(from self, with RecorderWriteError::FileWriteError(e),
+                    "Failed to write the stream id of a record into file ({e:?}).");
+        }
+
+        RecordWriter::new(&mut self.file, &mut self.staging_buffer)
+            .data_representation(DataRepresentation::Iox2Dump)
+            .write(record)
+    }
+}
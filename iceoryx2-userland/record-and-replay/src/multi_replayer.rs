@@ -0,0 +1,202 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! ## Example
+//!
+//! Reads the records of a file that was created with the
+//! [`MultiRecorder`](crate::multi_recorder::MultiRecorder) in the order they were recorded.
+//!
+//! ```no_run
+//! use iceoryx2_userland_record_and_replay::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let mut replayer = MultiReplayerOpener::new(&FilePath::new(b"multi_recorded_data.iox2")?)
+//!     .open()?;
+//!
+//! for (n, stream) in replayer.streams().iter().enumerate() {
+//!     println!("stream {n} records service {}", stream.service_name);
+//! }
+//!
+//! while let Some((stream, record)) = replayer.next_record()? {
+//!     println!("stream: {}", stream.value());
+//!     println!("payload: {:?}", record.payload);
+//!     println!("timestamp: {:?}", record.timestamp);
+//! }
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::mem::MaybeUninit;
+
+use alloc::vec::Vec;
+
+use iceoryx2_bb_posix::file::{AccessMode, File, FileBuilder};
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_log::fail;
+
+use crate::multi_recorder::{FILE_FORMAT_MULTI_STREAM_VERSION, StreamId};
+use crate::record::{DataRepresentation, Record, RecordReader};
+use crate::record_header::RecordHeader;
+use crate::replayer::ReplayerOpenError;
+
+#[derive(Debug)]
+/// Builder to open a file that was recorded with the
+/// [`MultiRecorder`](crate::multi_recorder::MultiRecorder).
+pub struct MultiReplayerOpener {
+    file_path: FilePath,
+}
+
+impl MultiReplayerOpener {
+    /// Creates a new [`MultiReplayerOpener`]
+    pub fn new(file_path: &FilePath) -> Self {
+        Self {
+            file_path: *file_path,
+        }
+    }
+
+    /// Opens the recorded file, reads the headers of all streams and returns the
+    /// [`MultiReplayer`] which allows the user to read one entry at a time.
+    pub fn open(self) -> Result<MultiReplayer, ReplayerOpenError> {
+        let msg = "Unable to read multi stream recorded data";
+        let file = match FileBuilder::new(&self.file_path)
+            .has_ownership(false)
+            .open_existing(AccessMode::Read)
+        {
+            Ok(v) => v,
+            Err(e) => {
+                fail!(from self, with ReplayerOpenError::FailedToOpenFile,
+                    "{msg} since the file could not be opened ({e:?}).");
+            }
+        };
+
+        let file_format_version = read_u64(&file)?;
+        if file_format_version.is_none_or(|v| v > FILE_FORMAT_MULTI_STREAM_VERSION) {
+            fail!(from self, with ReplayerOpenError::UnableToDeserializeRecordHeader,
+                "{msg} since the file format version {file_format_version:?} is not supported.");
+        }
+
+        let Some(number_of_streams) = read_u64(&file)? else {
+            fail!(from self, with ReplayerOpenError::UnableToDeserializeRecordHeader,
+                "{msg} since the number of streams is missing.");
+        };
+
+        let mut streams = Vec::new();
+        for _ in 0..number_of_streams {
+            let mut header = MaybeUninit::<RecordHeader>::uninit();
+            let buffer = unsafe {
+                core::slice::from_raw_parts_mut(
+                    header.as_mut_ptr() as *mut u8,
+                    core::mem::size_of::<RecordHeader>(),
+                )
+            };
+
+            if !read_exact(&file, buffer)? {
+                fail!(from self, with ReplayerOpenError::UnableToDeserializeRecordHeader,
+                    "{msg} since the file ends before all {number_of_streams} stream headers are read.");
+            }
+            streams.push(unsafe { header.assume_init() });
+        }
+
+        Ok(MultiReplayer {
+            file,
+            streams,
+            last_timestamp: 0,
+        })
+    }
+}
+
+fn read_exact(file: &File, buffer: &mut [u8]) -> Result<bool, ReplayerOpenError> {
+    let len = fail!(from "MultiReplayer::read_exact()", when file.read(buffer),
+        with ReplayerOpenError::FailedToReadFile,
+        "Unable to read multi stream record since the underlying file could not be read.");
+
+    if len == 0 {
+        return Ok(false);
+    }
+
+    if len != buffer.len() as u64 {
+        fail!(from "MultiReplayer::read_exact()", with ReplayerOpenError::FailedToReadFile,
+            "Unable to read multi stream record since it has a size of {len} and {} bytes are expected.",
+            buffer.len());
+    }
+
+    Ok(true)
+}
+
+fn read_u64(file: &File) -> Result<Option<u64>, ReplayerOpenError> {
+    let mut buffer = [0u8; 8];
+    if !read_exact(file, &mut buffer)? {
+        return Ok(None);
+    }
+
+    Ok(Some(u64::from_le_bytes(buffer)))
+}
+
+#[derive(Debug)]
+/// Has read access to a multi stream recording and extracts one [`Record`] at a time together
+/// with the [`StreamId`] it belongs to.
+pub struct MultiReplayer {
+    file: File,
+    streams: Vec<RecordHeader>,
+    last_timestamp: u64,
+}
+
+impl MultiReplayer {
+    /// Returns the header of every stream. The position in the slice corresponds to the
+    /// [`StreamId::value()`].
+    pub fn streams(&self) -> &[RecordHeader] {
+        &self.streams
+    }
+
+    /// Returns the next contained [`Record`] and the [`StreamId`] of its stream. If it reached
+    /// the end of the file it returns [`None`].
+    pub fn next_record(&mut self) -> Result<Option<(StreamId, Record)>, ReplayerOpenError> {
+        let msg = "Unable to read next record";
+        let Some(stream) = read_u64(&self.file)? else {
+            return Ok(None);
+        };
+
+        let Some(header) = self.streams.get(stream as usize) else {
+            fail!(from self, with ReplayerOpenError::CorruptedContent,
+                "{msg} since it belongs to the stream {stream} which does not exist.");
+        };
+
+        let Some(record) = RecordReader::new(&header.details)
+            .data_representation(DataRepresentation::Iox2Dump)
+            .read(&self.file)?
+        else {
+            fail!(from self, with ReplayerOpenError::FailedToReadFile,
+                "{msg} since the file ends after the stream id.");
+        };
+
+        let new_timestamp = record.timestamp.as_nanos() as u64;
+        if self.last_timestamp > new_timestamp {
+            fail!(from self, with ReplayerOpenError::CorruptedTimeline,
+                "{msg} since the next entries time stamp is older than the previous entries timestamp. The entries are not allowed to jump back and forth in time.");
+        }
+        self.last_timestamp = new_timestamp;
+
+        Ok(Some((StreamId(stream), record)))
+    }
+
+    /// Reads all remaining records into a buffer.
+    pub fn read_into_buffer(mut self) -> Result<Vec<(StreamId, Record)>, ReplayerOpenError> {
+        let mut buffer = Vec::new();
+        while let Some(entry) = self.next_record()? {
+            buffer.push(entry);
+        }
+
+        Ok(buffer)
+    }
+}
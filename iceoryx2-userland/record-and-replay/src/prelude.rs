@@ -10,7 +10,11 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub use crate::mapped_replayer::{MappedReplayer, MappedReplayerOpener};
+pub use crate::multi_recorder::{MultiRecorder, MultiRecorderBuilder, StreamId};
+pub use crate::multi_replayer::{MultiReplayer, MultiReplayerOpener};
 pub use crate::record::{DataRepresentation, RawRecord, Record};
 pub use crate::recorder::{RecorderBuilder, RecorderCreateError, RecorderWriteError, ServiceTypes};
+pub use crate::replay_timer::{ReplayTimer, ReplayTimerBuilder, ReplayTimerError};
 pub use crate::replayer::{Replayer, ReplayerOpenError, ReplayerOpener};
 pub use iceoryx2_bb_system_types::{file_name::FileName, file_path::FilePath};
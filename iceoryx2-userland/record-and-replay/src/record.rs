@@ -18,7 +18,7 @@ use alloc::vec;
 use alloc::vec::Vec;
 
 use iceoryx2::service::static_config::message_type_details::TypeVariant;
-use iceoryx2_bb_posix::file::{File, FileReadLineState};
+use iceoryx2_bb_posix::file::{File, FileReadLineState, FileWriteError};
 use iceoryx2_log::fail;
 
 use anyhow::Result;
@@ -131,6 +131,17 @@ impl RecordReader {
         Ok(())
     }
 
+    pub(crate) fn verify_raw_record(
+        &self,
+        record: &RawRecord,
+        error_msg: &str,
+    ) -> Result<(), ReplayerOpenError> {
+        self.verify_payload(record.payload, error_msg)?;
+        self.verify_user_header(record.user_header, error_msg)?;
+        self.verify_system_header(record.system_header, error_msg)?;
+        Ok(())
+    }
+
     fn read_human_readable_from_file(
         &self,
         file: &File,
@@ -158,7 +169,7 @@ impl RecordReader {
 
             const READABLE_PREFIX_LEN: usize = 10;
             if timestamp.is_none() {
-                timestamp = Some(Duration::from_millis(fail!(from self,
+                timestamp = Some(self.header.decode_timestamp(fail!(from self,
                         when line.as_str()[READABLE_PREFIX_LEN..].parse::<u64>(),
                         with ReplayerOpenError::CorruptedTimeStamp,
                         "{msg} since the timestamp entry is corrupted.")));
@@ -223,7 +234,7 @@ impl RecordReader {
         read(&mut payload)?;
 
         let record = Record {
-            timestamp: Duration::from_millis(timestamp),
+            timestamp: self.header.decode_timestamp(timestamp),
             system_header,
             user_header,
             payload,
@@ -244,13 +255,17 @@ impl RecordReader {
 #[derive(Debug)]
 pub(crate) struct RecordWriter<'a> {
     file: &'a mut File,
+    staging_buffer: &'a mut Vec<u8>,
     data_representation: DataRepresentation,
 }
 
 impl<'a> RecordWriter<'a> {
-    pub(crate) fn new(file: &'a mut File) -> Self {
+    /// The `staging_buffer` collects the small entries of a record so that they are written
+    /// with a single call. It is reused for every record to avoid allocations.
+    pub(crate) fn new(file: &'a mut File, staging_buffer: &'a mut Vec<u8>) -> Self {
         Self {
             file,
+            staging_buffer,
             data_representation: DataRepresentation::default(),
         }
     }
@@ -260,11 +275,41 @@ impl<'a> RecordWriter<'a> {
         self
     }
 
+    pub(crate) fn write_all(file: &mut File, mut data: &[u8]) -> Result<(), FileWriteError> {
+        while !data.is_empty() {
+            match file.write(data) {
+                Ok(0) => return Err(FileWriteError::IOerror),
+                Ok(n) => data = &data[n as usize..],
+                Err(FileWriteError::Interrupt) => continue,
+                Err(e) => return Err(e),
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Appends everything of the record except the payload in the iox2dump representation.
+    fn serialize_iox2dump_without_payload(buffer: &mut Vec<u8>, record: &RawRecord) {
+        buffer.extend_from_slice(&(record.timestamp.as_nanos() as u64).to_le_bytes());
+        buffer.extend_from_slice(&(record.system_header.len() as u64).to_le_bytes());
+        buffer.extend_from_slice(record.system_header);
+        buffer.extend_from_slice(&(record.user_header.len() as u64).to_le_bytes());
+        buffer.extend_from_slice(record.user_header);
+        buffer.extend_from_slice(&(record.payload.len() as u64).to_le_bytes());
+    }
+
+    /// Appends the whole record in the iox2dump representation.
+    pub(crate) fn serialize_iox2dump(buffer: &mut Vec<u8>, record: &RawRecord) {
+        Self::serialize_iox2dump_without_payload(buffer, record);
+        buffer.extend_from_slice(record.payload);
+    }
+
     pub(crate) fn write(self, record: RawRecord) -> Result<(), RecorderWriteError> {
         let origin = format!("{self:?}");
+        let file = self.file;
         let mut write_to_file = |data| -> Result<(), RecorderWriteError> {
-            match self.file.write(data) {
-                Ok(_) => Ok(()),
+            match Self::write_all(file, data) {
+                Ok(()) => Ok(()),
                 Err(e) => {
                     fail!(from origin,
                             with RecorderWriteError::FileWriteError(e),
@@ -275,7 +320,7 @@ impl<'a> RecordWriter<'a> {
 
         match self.data_representation {
             DataRepresentation::HumanReadable => {
-                let time_stamp = format!("time:     {}\n", record.timestamp.as_millis() as u64);
+                let time_stamp = format!("time:     {}\n", record.timestamp.as_nanos() as u64);
                 write_to_file(time_stamp.as_bytes())?;
                 write_to_file(b"sys head: ")?;
                 let hex_system_header = bytes_to_hex_string(record.system_header);
@@ -291,16 +336,13 @@ impl<'a> RecordWriter<'a> {
                 write_to_file(b"\n\n")?;
             }
             DataRepresentation::Iox2Dump => {
-                let time_stamp = (record.timestamp.as_millis() as u64).to_le_bytes();
-                write_to_file(&time_stamp)?;
-                let system_header_len = (record.system_header.len() as u64).to_le_bytes();
-                write_to_file(&system_header_len)?;
-                write_to_file(record.system_header)?;
-                let user_header_len = (record.user_header.len() as u64).to_le_bytes();
-                write_to_file(&user_header_len)?;
-                write_to_file(record.user_header)?;
-                let payload_len = (record.payload.len() as u64).to_le_bytes();
-                write_to_file(&payload_len)?;
+                // everything except the payload is small, it is staged and written at once.
+                // The payload is written directly from the provided memory, e.g. the
+                // shared memory of a received sample, without an intermediate copy.
+                let staging_buffer = self.staging_buffer;
+                staging_buffer.clear();
+                Self::serialize_iox2dump_without_payload(staging_buffer, &record);
+                write_to_file(staging_buffer.as_slice())?;
                 write_to_file(record.payload)?;
             }
         }
@@ -10,16 +10,22 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use core::time::Duration;
+
 use iceoryx2::prelude::{MessagingPattern, ServiceName};
 use iceoryx2_bb_elementary::package_version::PackageVersion;
 
 use crate::recorder::ServiceTypes;
 
 /// Defines the current file format version of the human readable format
-pub const FILE_FORMAT_HUMAN_READABLE_VERSION: u64 = 1;
+pub const FILE_FORMAT_HUMAN_READABLE_VERSION: u64 = 2;
 
 /// Defines the current file format version of the iox2dump version
-pub const FILE_FORMAT_IOX2_DUMP_VERSION: u64 = 1;
+pub const FILE_FORMAT_IOX2_DUMP_VERSION: u64 = 2;
+
+/// The first file format version that stores the record timestamps in nanoseconds. Older
+/// versions store them in milliseconds.
+pub const FILE_FORMAT_NANOSECOND_TIMESTAMPS_VERSION: u64 = 2;
 
 #[repr(C)]
 #[derive(serde::Serialize, serde::Deserialize, Debug, PartialEq, Clone)]
@@ -55,6 +61,16 @@ pub struct RecordHeaderDetails {
     pub messaging_pattern: MessagingPattern,
 }
 
+impl RecordHeaderDetails {
+    pub(crate) fn decode_timestamp(&self, value: u64) -> Duration {
+        if self.file_format_version < FILE_FORMAT_NANOSECOND_TIMESTAMPS_VERSION {
+            Duration::from_millis(value)
+        } else {
+            Duration::from_nanos(value)
+        }
+    }
+}
+
 #[repr(C)]
 #[derive(serde::Serialize, serde::Deserialize, Debug, PartialEq, Clone)]
 /// Represents the header of a recorded file which identifies the type details and iceoryx2
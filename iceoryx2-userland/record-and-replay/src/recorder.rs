@@ -52,6 +52,7 @@
 //! ```
 
 use alloc::format;
+use alloc::vec::Vec;
 
 use iceoryx2::prelude::{MessagingPattern, ServiceName};
 use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
@@ -107,6 +108,9 @@ pub enum RecorderWriteError {
     /// The record was older than the previously stored record. All records must have a
     /// monotonic timestamp - no time backward jumps.
     TimestampOlderThanPreviousRecord,
+    /// The record was written for a stream that does not exist in the
+    /// [`MultiRecorder`](crate::multi_recorder::MultiRecorder).
+    UnknownStream,
 }
 
 impl core::fmt::Display for RecorderWriteError {
@@ -128,6 +132,42 @@ pub struct ServiceTypes {
     pub system_header: TypeDetail,
 }
 
+impl ServiceTypes {
+    pub(crate) fn verify(&self, record: &RawRecord) -> Result<(), RecorderWriteError> {
+        let msg = "Unable to write new record";
+
+        if record.system_header.len() != self.system_header.size() {
+            fail!(from self, with RecorderWriteError::CorruptedSystemHeaderRecord,
+                "{msg} since the system header entry is corrupted. Expected a size of {} but provided a size of {}.",
+                self.system_header.size(), record.system_header.len());
+        }
+
+        if record.user_header.len() != self.user_header.size() {
+            fail!(from self, with RecorderWriteError::CorruptedUserHeaderRecord,
+                "{msg} since the user header entry is corrupted. Expected a size of {} but provided a size of {}.",
+                self.user_header.size(), record.user_header.len());
+        }
+
+        if self.payload.variant() == TypeVariant::FixedSize
+            && record.payload.len() != self.payload.size()
+        {
+            fail!(from self, with RecorderWriteError::CorruptedPayloadRecord,
+                "{msg} since the payload entry is corrupted. Expected a size of {} but provided a size of {}.",
+                self.payload.size(), record.payload.len());
+        }
+
+        if self.payload.variant() == TypeVariant::Dynamic
+            && record.payload.len() % self.payload.size() != 0
+        {
+            fail!(from self, with RecorderWriteError::CorruptedPayloadRecord,
+                "{msg} since the payload entry is corrupted. Expected a size which is a multiple of {} but provided a size of {}.",
+                self.payload.size(), record.payload.len());
+        }
+
+        Ok(())
+    }
+}
+
 #[derive(Debug)]
 /// Builder to create a new [`Recorder`].
 pub struct RecorderBuilder {
@@ -201,6 +241,7 @@ impl RecorderBuilder {
             header,
             data_representation: self.data_representation,
             last_timestamp: 0,
+            staging_buffer: Vec::new(),
         })
     }
 
@@ -279,6 +320,7 @@ pub struct Recorder {
     data_representation: DataRepresentation,
     header: RecordHeader,
     last_timestamp: u64,
+    staging_buffer: Vec<u8>,
 }
 
 impl Recorder {
@@ -286,35 +328,9 @@ impl Recorder {
     pub fn write(&mut self, record: RawRecord) -> Result<(), RecorderWriteError> {
         let msg = "Unable to write new record";
 
-        if record.system_header.len() != self.header.details.types.system_header.size() {
-            fail!(from self, with RecorderWriteError::CorruptedSystemHeaderRecord,
-                "{msg} since the system header entry is corrupted. Expected a size of {} but provided a size of {}.",
-                self.header.details.types.system_header.size(), record.system_header.len());
-        }
-
-        if record.user_header.len() != self.header.details.types.user_header.size() {
-            fail!(from self, with RecorderWriteError::CorruptedUserHeaderRecord,
-                "{msg} since the user header entry is corrupted. Expected a size of {} but provided a size of {}.",
-                self.header.details.types.user_header.size(), record.user_header.len());
-        }
-
-        if self.header.details.types.payload.variant() == TypeVariant::FixedSize
-            && record.payload.len() != self.header.details.types.payload.size()
-        {
-            fail!(from self, with RecorderWriteError::CorruptedPayloadRecord,
-                "{msg} since the payload entry is corrupted. Expected a size of {} but provided a size of {}.",
-                self.header.details.types.payload.size(), record.payload.len());
-        }
-
-        if self.header.details.types.payload.variant() == TypeVariant::Dynamic
-            && record.payload.len() % self.header.details.types.payload.size() != 0
-        {
-            fail!(from self, with RecorderWriteError::CorruptedPayloadRecord,
-                "{msg} since the payload entry is corrupted. Expected a size which is a multiple of {} but provided a size of {}.",
-                self.header.details.types.payload.size(), record.payload.len());
-        }
+        self.header.details.types.verify(&record)?;
 
-        let new_timestamp = record.timestamp.as_millis() as u64;
+        let new_timestamp = record.timestamp.as_nanos() as u64;
         if self.last_timestamp > new_timestamp {
             fail!(from self, with RecorderWriteError::TimestampOlderThanPreviousRecord,
                 "{msg} since record timestamp is older than the previous record entry. Records are not allowed to jump back in time.");
@@ -325,7 +341,7 @@ impl Recorder {
     }
 
     pub(crate) fn write_unchecked(&mut self, record: RawRecord) -> Result<(), RecorderWriteError> {
-        RecordWriter::new(&mut self.file)
+        RecordWriter::new(&mut self.file, &mut self.staging_buffer)
             .data_representation(self.data_representation)
             .write(record)
     }
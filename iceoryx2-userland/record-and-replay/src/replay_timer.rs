@@ -0,0 +1,168 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! ## Example
+//!
+//! Replays the records with the same inter-arrival times they were recorded with.
+//!
+//! ```no_run
+//! use iceoryx2_userland_record_and_replay::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//!
+//! let replayer = MappedReplayerOpener::new(&FilePath::new(b"recorded_data.iox2")?).open()?;
+//! let timer = ReplayTimerBuilder::new().time_factor(1.0).create()?;
+//!
+//! for record in replayer.records_from(0) {
+//!     timer.wait_until(record.timestamp)?;
+//!     println!("payload: {:?}", record.payload);
+//! }
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::time::Duration;
+
+use iceoryx2_bb_posix::clock::{Time, nanosleep};
+use iceoryx2_log::fail;
+
+/// The default remaining time until a deadline at which the [`ReplayTimer`] stops sleeping
+/// and busy waits instead.
+pub const DEFAULT_SPIN_THRESHOLD: Duration = Duration::from_micros(200);
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+/// Errors that can occur when a [`ReplayTimer`] is created or waits.
+pub enum ReplayTimerError {
+    /// The time factor is negative or not a finite number.
+    InvalidTimeFactor,
+    /// The current time could not be acquired.
+    ClockFailure,
+    /// The underlying sleep failed.
+    SleepFailure,
+}
+
+impl core::fmt::Display for ReplayTimerError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "ReplayTimerError::{self:?}")
+    }
+}
+
+impl core::error::Error for ReplayTimerError {}
+
+#[derive(Debug)]
+/// Builder to create a new [`ReplayTimer`].
+pub struct ReplayTimerBuilder {
+    time_factor: f64,
+    spin_threshold: Duration,
+}
+
+impl Default for ReplayTimerBuilder {
+    fn default() -> Self {
+        Self {
+            time_factor: 1.0,
+            spin_threshold: DEFAULT_SPIN_THRESHOLD,
+        }
+    }
+}
+
+impl ReplayTimerBuilder {
+    /// Creates a new [`ReplayTimerBuilder`]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// The record timestamps are multiplied with the factor. A factor smaller than 1.0
+    /// replays faster, a factor greater than 1.0 replays slower than recorded.
+    pub fn time_factor(mut self, value: f64) -> Self {
+        self.time_factor = value;
+        self
+    }
+
+    /// Defines the remaining time until a deadline at which the [`ReplayTimer`] stops sleeping
+    /// and busy waits instead. The sleep of the operating system is only precise up to its
+    /// scheduling granularity, the busy wait covers the rest at the cost of CPU time.
+    pub fn spin_threshold(mut self, value: Duration) -> Self {
+        self.spin_threshold = value;
+        self
+    }
+
+    /// Creates a new [`ReplayTimer`] and starts it.
+    pub fn create(self) -> Result<ReplayTimer, ReplayTimerError> {
+        let msg = "Unable to create replay timer";
+        if !self.time_factor.is_finite() || self.time_factor < 0.0 {
+            fail!(from self, with ReplayTimerError::InvalidTimeFactor,
+                "{msg} since the time factor {} must be a non-negative finite number.",
+                self.time_factor);
+        }
+
+        let start = fail!(from self, when Time::now(),
+                            with ReplayTimerError::ClockFailure,
+                            "{msg} since the current time could not be acquired.");
+
+        Ok(ReplayTimer {
+            start,
+            time_factor: self.time_factor,
+            spin_threshold: self.spin_threshold,
+        })
+    }
+}
+
+#[derive(Debug)]
+/// Reproduces the time line of a recording. The timestamps of the records are relative to
+/// the start of the recording and the [`ReplayTimer`] waits until the same time has passed
+/// since it was started. It sleeps until shortly before the deadline and busy waits for the
+/// remaining time, so that the inter-arrival times are reproduced with microsecond accuracy.
+pub struct ReplayTimer {
+    start: Time,
+    time_factor: f64,
+    spin_threshold: Duration,
+}
+
+impl ReplayTimer {
+    /// Restarts the time line, the next timestamps are relative to now.
+    pub fn restart(&mut self) -> Result<(), ReplayTimerError> {
+        self.start = fail!(from self, when Time::now(),
+                            with ReplayTimerError::ClockFailure,
+                            "Unable to restart replay timer since the current time could not be acquired.");
+        Ok(())
+    }
+
+    /// Returns the time that has passed since the [`ReplayTimer`] was started.
+    pub fn elapsed(&self) -> Result<Duration, ReplayTimerError> {
+        Ok(fail!(from self, when self.start.elapsed(),
+                with ReplayTimerError::ClockFailure,
+                "Unable to acquire the elapsed time of the replay timer."))
+    }
+
+    /// Blocks until the `timestamp`, scaled by the time factor, has passed since the
+    /// [`ReplayTimer`] was started. Returns immediately when it has already passed.
+    pub fn wait_until(&self, timestamp: Duration) -> Result<(), ReplayTimerError> {
+        let deadline = timestamp.mul_f64(self.time_factor);
+
+        loop {
+            let elapsed = self.elapsed()?;
+            if elapsed >= deadline {
+                return Ok(());
+            }
+
+            let remaining = deadline - elapsed;
+            if remaining > self.spin_threshold {
+                fail!(from self, when nanosleep(remaining - self.spin_threshold),
+                    with ReplayTimerError::SleepFailure,
+                    "Unable to wait until {timestamp:?} since the underlying sleep failed.");
+            } else {
+                core::hint::spin_loop();
+            }
+        }
+    }
+}
@@ -272,7 +272,7 @@ impl Replayer {
             .data_representation(self.data_representation)
             .read(&self.file)?
         {
-            let new_timestamp = record.timestamp.as_millis() as u64;
+            let new_timestamp = record.timestamp.as_nanos() as u64;
             if self.last_timestamp > new_timestamp {
                 fail!(from self, with ReplayerOpenError::CorruptedTimeline,
                     "Unable to read next record since the next entries time stamp is older than the previous entries timestamp. The entries are not allowed to jump back and forth in time.");
@@ -0,0 +1,171 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(test)]
+mod mapped_replayer_tests {
+    use core::time::Duration;
+
+    use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
+    use iceoryx2_bb_posix::file::{AccessMode, File, FileBuilder};
+    use iceoryx2_bb_posix::file_descriptor::FileDescriptorManagement;
+    use iceoryx2_bb_posix::testing::generate_file_path;
+    use iceoryx2_bb_system_types::file_path::FilePath;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_userland_record_and_replay::{
+        mapped_replayer::MappedReplayerOpener,
+        record::{DataRepresentation, RawRecord},
+        recorder::{Recorder, RecorderBuilder, ServiceTypes},
+        replayer::ReplayerOpenError,
+    };
+
+    const TIMESTAMP_STEP: u64 = 10;
+
+    fn types() -> ServiceTypes {
+        ServiceTypes {
+            payload: TypeDetail::new::<u64>(TypeVariant::Dynamic),
+            user_header: TypeDetail::new::<u32>(TypeVariant::FixedSize),
+            system_header: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+        }
+    }
+
+    fn create_recorder(file_name: &FilePath) -> Recorder {
+        let service_name = iceoryx2::testing::generate_service_name();
+        RecorderBuilder::new(&types())
+            .data_representation(DataRepresentation::Iox2Dump)
+            .create(file_name, &service_name)
+            .unwrap()
+    }
+
+    fn record(recorder: &mut Recorder, number_of_records: u64) {
+        for n in 0..number_of_records {
+            let payload: Vec<u8> = (0..(n + 1) * 8).map(|v| (v + n) as u8).collect();
+            recorder
+                .write(RawRecord {
+                    timestamp: Duration::from_millis(n * TIMESTAMP_STEP),
+                    system_header: &n.to_le_bytes(),
+                    user_header: &(n as u32).to_le_bytes(),
+                    payload: &payload,
+                })
+                .unwrap();
+        }
+    }
+
+    #[test]
+    fn open_non_existing_file_fails() {
+        let file_name = generate_file_path();
+
+        let result = MappedReplayerOpener::new(&file_name).open();
+        assert_that!(result.err(), eq Some(ReplayerOpenError::FailedToOpenFile));
+    }
+
+    #[test]
+    fn open_file_without_records_works() {
+        let file_name = generate_file_path();
+        let recorder = create_recorder(&file_name);
+
+        let sut = MappedReplayerOpener::new(&file_name).open().unwrap();
+
+        assert_that!(*sut.header(), eq * recorder.header());
+        assert_that!(sut.is_empty(), eq true);
+        assert_that!(sut.time_range(), eq None);
+        assert_that!(sut.record(0).is_none(), eq true);
+        assert_that!(sut.position_of(Duration::ZERO), eq 0);
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn records_are_read_from_mapped_file() {
+        const NUMBER_OF_RECORDS: u64 = 37;
+        let file_name = generate_file_path();
+        let mut recorder = create_recorder(&file_name);
+        record(&mut recorder, NUMBER_OF_RECORDS);
+
+        let sut = MappedReplayerOpener::new(&file_name).open().unwrap();
+
+        assert_that!(*sut.header(), eq * recorder.header());
+        assert_that!(sut.len(), eq NUMBER_OF_RECORDS as usize);
+        assert_that!(sut.time_range(), eq Some((Duration::ZERO,
+            Duration::from_millis((NUMBER_OF_RECORDS - 1) * TIMESTAMP_STEP))));
+
+        for n in 0..NUMBER_OF_RECORDS {
+            let record = sut.record(n as usize).unwrap();
+            let payload: Vec<u8> = (0..(n + 1) * 8).map(|v| (v + n) as u8).collect();
+
+            assert_that!(record.timestamp, eq Duration::from_millis(n * TIMESTAMP_STEP));
+            assert_that!(record.system_header, eq n.to_le_bytes());
+            assert_that!(record.user_header, eq(n as u32).to_le_bytes());
+            assert_that!(record.payload, eq payload.as_slice());
+        }
+        assert_that!(sut.record(NUMBER_OF_RECORDS as usize).is_none(), eq true);
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn seeking_to_timestamp_starts_at_first_record_that_is_not_older() {
+        const NUMBER_OF_RECORDS: u64 = 20;
+        let file_name = generate_file_path();
+        let mut recorder = create_recorder(&file_name);
+        record(&mut recorder, NUMBER_OF_RECORDS);
+
+        let sut = MappedReplayerOpener::new(&file_name).open().unwrap();
+
+        assert_that!(sut.position_of(Duration::ZERO), eq 0);
+        assert_that!(sut.position_of(Duration::from_millis(5 * TIMESTAMP_STEP)), eq 5);
+        assert_that!(sut.position_of(Duration::from_millis(5 * TIMESTAMP_STEP + 1)), eq 6);
+        assert_that!(sut.position_of(Duration::from_secs(3600)), eq NUMBER_OF_RECORDS as usize);
+
+        let timestamps: Vec<Duration> = sut
+            .records_since(Duration::from_millis(17 * TIMESTAMP_STEP - 1))
+            .map(|record| record.timestamp)
+            .collect();
+        assert_that!(timestamps, eq vec![
+            Duration::from_millis(17 * TIMESTAMP_STEP),
+            Duration::from_millis(18 * TIMESTAMP_STEP),
+            Duration::from_millis(19 * TIMESTAMP_STEP)]);
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn open_file_with_truncated_record_fails() {
+        let file_name = generate_file_path();
+        let mut recorder = create_recorder(&file_name);
+        record(&mut recorder, 3);
+
+        let mut file = FileBuilder::new(&file_name)
+            .has_ownership(true)
+            .open_existing(AccessMode::ReadWrite)
+            .unwrap();
+        let size = file.metadata().unwrap().size() as usize;
+        file.truncate(size - 3).unwrap();
+
+        let result = MappedReplayerOpener::new(&file_name).open();
+        assert_that!(result.err(), eq Some(ReplayerOpenError::FailedToReadFile));
+    }
+
+    #[test]
+    fn open_file_with_invalid_header_fails() {
+        let file_name = generate_file_path();
+
+        let mut file = FileBuilder::new(&file_name)
+            .has_ownership(true)
+            .creation_mode(iceoryx2_bb_posix::file::CreationMode::PurgeAndCreate)
+            .create()
+            .unwrap();
+        file.write(b"schalalala").unwrap();
+
+        let result = MappedReplayerOpener::new(&file_name).open();
+        assert_that!(result.err(), eq Some(ReplayerOpenError::UnableToDeserializeRecordHeader));
+    }
+}
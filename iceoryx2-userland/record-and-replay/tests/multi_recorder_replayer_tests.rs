@@ -0,0 +1,221 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(test)]
+mod multi_recorder_replayer {
+    use core::time::Duration;
+
+    use iceoryx2::prelude::MessagingPattern;
+    use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
+    use iceoryx2_bb_posix::file::File;
+    use iceoryx2_bb_posix::testing::generate_file_path;
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_userland_record_and_replay::{
+        multi_recorder::MultiRecorderBuilder,
+        multi_replayer::MultiReplayerOpener,
+        record::RawRecord,
+        recorder::{RecorderCreateError, RecorderWriteError, ServiceTypes},
+        replayer::ReplayerOpenError,
+    };
+
+    fn types_a() -> ServiceTypes {
+        ServiceTypes {
+            payload: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+            user_header: TypeDetail::new::<()>(TypeVariant::FixedSize),
+            system_header: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+        }
+    }
+
+    fn types_b() -> ServiceTypes {
+        ServiceTypes {
+            payload: TypeDetail::new::<u8>(TypeVariant::Dynamic),
+            user_header: TypeDetail::new::<u32>(TypeVariant::FixedSize),
+            system_header: TypeDetail::new::<u64>(TypeVariant::FixedSize),
+        }
+    }
+
+    fn records_of_multiple_streams_are_replayed_in_order(write_buffer_size: usize) {
+        const NUMBER_OF_RECORDS: u64 = 64;
+        let file_name = generate_file_path();
+
+        let mut builder = MultiRecorderBuilder::new().write_buffer_size(write_buffer_size);
+        let stream_a = builder.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let stream_b = builder.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_b(),
+            MessagingPattern::RequestResponse,
+        );
+        let mut recorder = builder.create(&file_name).unwrap();
+
+        for n in 0..NUMBER_OF_RECORDS {
+            let timestamp = Duration::from_micros(n * 100);
+            let result = if n % 3 == 0 {
+                let payload = vec![n as u8; n as usize];
+                recorder.write(
+                    stream_b,
+                    RawRecord {
+                        timestamp,
+                        system_header: &n.to_le_bytes(),
+                        user_header: &(n as u32).to_le_bytes(),
+                        payload: &payload,
+                    },
+                )
+            } else {
+                recorder.write(
+                    stream_a,
+                    RawRecord {
+                        timestamp,
+                        system_header: &n.to_le_bytes(),
+                        user_header: &[],
+                        payload: &n.to_le_bytes(),
+                    },
+                )
+            };
+            assert_that!(result, is_ok);
+        }
+        let streams = recorder.streams().to_vec();
+        drop(recorder);
+
+        let replayer = MultiReplayerOpener::new(&file_name).open().unwrap();
+        assert_that!(replayer.streams(), eq streams.as_slice());
+
+        let buffer = replayer.read_into_buffer().unwrap();
+        assert_that!(buffer, len NUMBER_OF_RECORDS as usize);
+        for (n, (stream, record)) in buffer.iter().enumerate() {
+            let n = n as u64;
+            assert_that!(record.timestamp, eq Duration::from_micros(n * 100));
+            assert_that!(record.system_header, eq n.to_le_bytes());
+            if n % 3 == 0 {
+                assert_that!(*stream, eq stream_b);
+                assert_that!(record.user_header, eq(n as u32).to_le_bytes());
+                assert_that!(record.payload, eq vec![n as u8; n as usize]);
+            } else {
+                assert_that!(*stream, eq stream_a);
+                assert_that!(record.user_header, len 0);
+                assert_that!(record.payload, eq n.to_le_bytes());
+            }
+        }
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn records_of_multiple_streams_are_replayed_in_order_with_default_buffer() {
+        records_of_multiple_streams_are_replayed_in_order(4 * 1024 * 1024);
+    }
+
+    #[test]
+    fn records_of_multiple_streams_are_replayed_in_order_with_small_buffer() {
+        records_of_multiple_streams_are_replayed_in_order(128);
+    }
+
+    #[test]
+    fn records_of_multiple_streams_are_replayed_in_order_without_buffer() {
+        records_of_multiple_streams_are_replayed_in_order(0);
+    }
+
+    #[test]
+    fn create_fails_when_file_already_exists() {
+        let file_name = generate_file_path();
+        let _recorder = MultiRecorderBuilder::new().create(&file_name).unwrap();
+
+        let result = MultiRecorderBuilder::new().create(&file_name);
+        assert_that!(result.err(), eq Some(RecorderCreateError::FileAlreadyExists));
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn write_fails_for_unknown_stream_or_wrong_types() {
+        let file_name = generate_file_path();
+        let mut builder = MultiRecorderBuilder::new();
+        let stream_a = builder.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let mut other = MultiRecorderBuilder::new();
+        other.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let unknown_stream = other.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let mut recorder = builder.create(&file_name).unwrap();
+
+        let record = RawRecord {
+            timestamp: Duration::ZERO,
+            system_header: &[0u8; 8],
+            user_header: &[],
+            payload: &[0u8; 8],
+        };
+        assert_that!(recorder.write(unknown_stream, record).err(), eq Some(RecorderWriteError::UnknownStream));
+
+        let record = RawRecord {
+            timestamp: Duration::ZERO,
+            system_header: &[0u8; 8],
+            user_header: &[],
+            payload: &[0u8; 7],
+        };
+        assert_that!(recorder.write(stream_a, record).err(), eq Some(RecorderWriteError::CorruptedPayloadRecord));
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn write_fails_when_timestamp_of_another_stream_is_newer() {
+        let file_name = generate_file_path();
+        let mut builder = MultiRecorderBuilder::new();
+        let stream_a = builder.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let stream_b = builder.add_stream(
+            &iceoryx2::testing::generate_service_name(),
+            &types_a(),
+            MessagingPattern::PublishSubscribe,
+        );
+        let mut recorder = builder.create(&file_name).unwrap();
+
+        let record = |timestamp| RawRecord {
+            timestamp,
+            system_header: &[0u8; 8],
+            user_header: &[],
+            payload: &[0u8; 8],
+        };
+        assert_that!(
+            recorder.write(stream_a, record(Duration::from_millis(5))),
+            is_ok
+        );
+        assert_that!(recorder.write(stream_b, record(Duration::from_millis(2))).err(),
+            eq Some(RecorderWriteError::TimestampOlderThanPreviousRecord));
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn open_non_existing_file_fails() {
+        let file_name = generate_file_path();
+
+        let result = MultiReplayerOpener::new(&file_name).open();
+        assert_that!(result.err(), eq Some(ReplayerOpenError::FailedToOpenFile));
+    }
+}
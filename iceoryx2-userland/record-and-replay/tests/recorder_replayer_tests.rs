@@ -889,4 +889,105 @@ mod recorder_replayer {
     fn reading_decreasing_timestamps_fails_for_human_readable() {
         reading_decreasing_timestamps_fails(DataRepresentation::HumanReadable);
     }
+
+    fn sub_millisecond_timestamps_are_preserved(data_representation: DataRepresentation) {
+        const NUMBER_OF_DATA: u64 = 25;
+        let service_name = iceoryx2::testing::generate_service_name();
+        let file_name = generate_file_path();
+        let types = ServiceTypes {
+            payload: generate_type_detail(TypeVariant::FixedSize, 8, 4),
+            user_header: TypeDetail::new::<()>(TypeVariant::FixedSize),
+            system_header: generate_type_detail(TypeVariant::FixedSize, 16, 8),
+        };
+
+        let mut recorder = RecorderBuilder::new(&types)
+            .data_representation(data_representation)
+            .create(&file_name, &service_name)
+            .unwrap();
+
+        // 10 kHz with an additional nanosecond offset
+        let timestamp = |n: u64| Duration::from_nanos(n * 100_000 + n);
+        for n in 0..NUMBER_OF_DATA {
+            let data = generate_service_data(&types, timestamp(n));
+            assert_that!(
+                recorder.write(RawRecord {
+                    timestamp: data.timestamp,
+                    system_header: &data.system_header,
+                    user_header: &data.user_header,
+                    payload: &data.payload
+                }),
+                is_ok
+            );
+        }
+
+        let buffer = ReplayerOpener::new(&file_name)
+            .data_representation(data_representation)
+            .open()
+            .unwrap()
+            .read_into_buffer()
+            .unwrap();
+
+        assert_that!(buffer, len NUMBER_OF_DATA as usize);
+        for (n, record) in buffer.iter().enumerate() {
+            assert_that!(record.timestamp, eq timestamp(n as u64));
+        }
+
+        File::remove(&file_name).unwrap();
+    }
+
+    #[test]
+    fn sub_millisecond_timestamps_are_preserved_for_iox2dump() {
+        sub_millisecond_timestamps_are_preserved(DataRepresentation::Iox2Dump);
+    }
+
+    #[test]
+    fn sub_millisecond_timestamps_are_preserved_for_human_readable() {
+        sub_millisecond_timestamps_are_preserved(DataRepresentation::HumanReadable);
+    }
+
+    #[test]
+    fn record_and_replay_of_large_payload_works_for_iox2dump() {
+        const PAYLOAD_SIZE: usize = 8 * 1024 * 1024;
+        let service_name = iceoryx2::testing::generate_service_name();
+        let file_name = generate_file_path();
+        let types = ServiceTypes {
+            payload: generate_type_detail(TypeVariant::Dynamic, 1, 1),
+            user_header: TypeDetail::new::<()>(TypeVariant::FixedSize),
+            system_header: generate_type_detail(TypeVariant::FixedSize, 16, 8),
+        };
+
+        let mut recorder = RecorderBuilder::new(&types)
+            .data_representation(DataRepresentation::Iox2Dump)
+            .create(&file_name, &service_name)
+            .unwrap();
+
+        let payload: Vec<u8> = (0..PAYLOAD_SIZE).map(|n| (n % 251) as u8).collect();
+        let system_header = generate_data(types.system_header.size());
+        for n in 0..2 {
+            assert_that!(
+                recorder.write(RawRecord {
+                    timestamp: Duration::from_millis(n),
+                    system_header: &system_header,
+                    user_header: &[],
+                    payload: &payload
+                }),
+                is_ok
+            );
+        }
+
+        let buffer = ReplayerOpener::new(&file_name)
+            .data_representation(DataRepresentation::Iox2Dump)
+            .open()
+            .unwrap()
+            .read_into_buffer()
+            .unwrap();
+
+        assert_that!(buffer, len 2);
+        for record in buffer {
+            assert_that!(record.payload, eq payload);
+            assert_that!(record.system_header, eq system_header);
+        }
+
+        File::remove(&file_name).unwrap();
+    }
 }
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+#[cfg(test)]
+mod replay_timer_tests {
+    use core::time::Duration;
+
+    use iceoryx2_bb_testing::assert_that;
+    use iceoryx2_userland_record_and_replay::replay_timer::{ReplayTimerBuilder, ReplayTimerError};
+
+    const TIMEOUT: Duration = Duration::from_millis(25);
+
+    #[test]
+    fn create_with_invalid_time_factor_fails() {
+        for time_factor in [-1.0, f64::NAN, f64::INFINITY] {
+            let sut = ReplayTimerBuilder::new().time_factor(time_factor).create();
+            assert_that!(sut.err(), eq Some(ReplayTimerError::InvalidTimeFactor));
+        }
+    }
+
+    #[test]
+    fn wait_until_blocks_until_timestamp_has_passed() {
+        let sut = ReplayTimerBuilder::new().create().unwrap();
+
+        assert_that!(sut.wait_until(TIMEOUT), is_ok);
+        assert_that!(sut.elapsed().unwrap(), ge TIMEOUT);
+    }
+
+    #[test]
+    fn wait_until_applies_time_factor() {
+        let sut = ReplayTimerBuilder::new().time_factor(2.0).create().unwrap();
+
+        assert_that!(sut.wait_until(TIMEOUT), is_ok);
+        assert_that!(sut.elapsed().unwrap(), ge 2 * TIMEOUT);
+    }
+
+    #[test]
+    fn wait_until_returns_immediately_for_passed_timestamp() {
+        let sut = ReplayTimerBuilder::new().create().unwrap();
+        sut.wait_until(TIMEOUT).unwrap();
+
+        let elapsed = sut.elapsed().unwrap();
+        assert_that!(sut.wait_until(Duration::ZERO), is_ok);
+        assert_that!(sut.elapsed().unwrap() - elapsed, lt TIMEOUT);
+    }
+
+    #[test]
+    fn restart_resets_the_time_line() {
+        let mut sut = ReplayTimerBuilder::new().create().unwrap();
+        sut.wait_until(TIMEOUT).unwrap();
+
+        assert_that!(sut.restart(), is_ok);
+        assert_that!(sut.elapsed().unwrap(), lt TIMEOUT);
+    }
+}
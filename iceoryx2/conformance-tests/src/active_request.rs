@@ -15,6 +15,7 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 #[allow(clippy::module_inception)]
 #[conformance_tests]
 pub mod active_request {
+    use alloc::vec::Vec;
     use iceoryx2::port::client::Client;
     use iceoryx2::port::server::Server;
     use iceoryx2::service::port_factory::request_response::PortFactory;
@@ -57,6 +58,34 @@ pub mod active_request {
         }
     }
 
+    #[conformance_test]
+    pub fn forward_delivers_response_of_other_service<Sut: Service>() {
+        let test = TestFixture::<Sut>::new();
+        let backend = test
+            ._node
+            .service_builder(&generate_service_name())
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+        let backend_server = backend.server_builder().create().unwrap();
+        let backend_client = backend.client_builder().create().unwrap();
+
+        let pending_response = test.client.send_copy(123).unwrap();
+        let sut = test.server.receive().unwrap().unwrap();
+
+        let backend_pending_response = backend_client.send_copy(*sut).unwrap();
+        backend_server
+            .receive()
+            .unwrap()
+            .unwrap()
+            .send_copy(*sut * 2)
+            .unwrap();
+        let backend_response = backend_pending_response.receive().unwrap().unwrap();
+
+        assert_that!(sut.forward(&backend_response), is_ok);
+        assert_that!(*pending_response.receive().unwrap().unwrap(), eq 246);
+    }
+
     #[conformance_test]
     pub fn is_connected_until_pending_response_is_dropped<Sut: Service>() {
         let test = TestFixture::<Sut>::new();
@@ -131,6 +160,91 @@ pub mod active_request {
         assert_that!(pending_response.is_connected(), eq false);
     }
 
+    #[conformance_test]
+    pub fn send_batch_delivers_all_responses_in_order<Sut: Service>() {
+        let test = TestFixture::<Sut>::new();
+        let pending_response = test.client.send_copy(123).unwrap();
+
+        let sut = test.server.receive().unwrap().unwrap();
+        let response_1 = sut.loan_uninit().unwrap().write_payload(1);
+        let response_2 = sut.loan_uninit().unwrap().write_payload(2);
+        assert_that!(sut.send_batch([response_1, response_2]), is_ok);
+
+        assert_that!(*pending_response.receive().unwrap().unwrap(), eq 1);
+        assert_that!(*pending_response.receive().unwrap().unwrap(), eq 2);
+        assert_that!(pending_response.receive().unwrap(), is_none);
+
+        // the loans are released, otherwise the next loan would exceed the max loans
+        assert_that!(sut.loan_uninit(), is_ok);
+    }
+
+    #[conformance_test]
+    pub fn send_batch_releases_responses_when_pending_response_is_gone<Sut: Service>() {
+        let test = TestFixture::<Sut>::new();
+        let pending_response = test.client.send_copy(123).unwrap();
+
+        let sut = test.server.receive().unwrap().unwrap();
+        let response_1 = sut.loan_uninit().unwrap().write_payload(1);
+        let response_2 = sut.loan_uninit().unwrap().write_payload(2);
+        drop(pending_response);
+
+        let _ = sut.send_batch([response_1, response_2]);
+        assert_that!(sut.loan_uninit(), is_ok);
+    }
+
+    #[conformance_test]
+    pub fn send_chunked_delivers_payload_in_chunks<Sut: Service>() {
+        const CHUNK_LEN: usize = 4;
+        let test = TestFixture::<Sut>::new();
+        let service = test
+            ._node
+            .service_builder(&generate_service_name())
+            .request_response::<u64, [u64]>()
+            .max_response_buffer_size(4)
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+        let server = service
+            .server_builder()
+            .initial_max_slice_len(CHUNK_LEN)
+            .create()
+            .unwrap();
+
+        let pending_response = client.send_copy(123).unwrap();
+        let sut = server.receive().unwrap().unwrap();
+        let payload: Vec<u64> = (0..10).collect();
+        assert_that!(sut.send_chunked(&payload, CHUNK_LEN), eq Ok(3));
+
+        let mut chunk_lengths = Vec::new();
+        let mut received_payload = Vec::new();
+        for chunk in pending_response.chunks() {
+            let chunk = chunk.unwrap();
+            chunk_lengths.push(chunk.payload().len());
+            received_payload.extend_from_slice(chunk.payload());
+        }
+
+        assert_that!(chunk_lengths, eq [4, 4, 2]);
+        assert_that!(received_payload, eq payload);
+    }
+
+    #[conformance_test]
+    pub fn send_chunked_with_empty_payload_sends_no_chunks<Sut: Service>() {
+        let test = TestFixture::<Sut>::new();
+        let service = test
+            ._node
+            .service_builder(&generate_service_name())
+            .request_response::<u64, [u64]>()
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+        let server = service.server_builder().create().unwrap();
+
+        let pending_response = client.send_copy(123).unwrap();
+        let sut = server.receive().unwrap().unwrap();
+        assert_that!(sut.send_chunked(&[], 4), eq Ok(0));
+        assert_that!(pending_response.chunks().count(), eq 0);
+    }
+
     #[conformance_test]
     pub fn loan_uninit_and_send_works<Sut: Service>() {
         let test = TestFixture::<Sut>::new();
@@ -23,6 +23,8 @@ pub mod client {
     use iceoryx2::port::client::RequestSendError;
     use iceoryx2::port::{BackpressureAction, LoanError, SendError};
     use iceoryx2::prelude::*;
+    use iceoryx2::response_cache::{CachedResponse, ResponseCache};
+    use iceoryx2::response_gather::GatherCondition;
     use iceoryx2::service::port_factory::client::PortFactoryClient;
     use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64, Ordering};
     use iceoryx2_bb_posix::barrier::BarrierBuilder;
@@ -1387,4 +1389,308 @@ pub mod client {
 
         Ok(())
     }
+
+    #[conformance_test]
+    pub fn response_cache_returns_cached_response_for_identical_request<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+        let mut cache = ResponseCache::new(2, Duration::from_secs(3600));
+
+        let pending_response = match cache.send_copy(&sut, 5).unwrap() {
+            CachedResponse::Pending(pending_response) => pending_response,
+            CachedResponse::Hit(_) => panic!("The cache must be empty."),
+        };
+        server.receive().unwrap().unwrap().send_copy(25).unwrap();
+        let response = cache.insert(5, pending_response.receive().unwrap().unwrap());
+        assert_that!(**response, eq 25);
+
+        match cache.send_copy(&sut, 5).unwrap() {
+            CachedResponse::Hit(response) => assert_that!(**response, eq 25),
+            CachedResponse::Pending(_) => panic!("The response must be cached."),
+        }
+        assert_that!(server.has_requests().unwrap(), eq false);
+
+        assert_that!(
+            matches!(cache.send_copy(&sut, 6).unwrap(), CachedResponse::Pending(_)),
+            eq true
+        );
+    }
+
+    #[conformance_test]
+    pub fn response_cache_evicts_expired_responses<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+        let mut cache = ResponseCache::new(2, Duration::from_millis(10));
+
+        let pending_response = sut.send_copy(5).unwrap();
+        server.receive().unwrap().unwrap().send_copy(25).unwrap();
+        cache.insert(5, pending_response.receive().unwrap().unwrap());
+        assert_that!(cache.get(&5), is_some);
+
+        nanosleep(Duration::from_millis(20)).unwrap();
+        assert_that!(cache.get(&5), is_none);
+        assert_that!(cache, is_empty);
+    }
+
+    #[conformance_test]
+    pub fn response_cache_invalidates_responses_of_disconnected_servers<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+        let mut cache = ResponseCache::new(2, Duration::from_secs(3600));
+
+        let pending_response = sut.send_copy(5).unwrap();
+        server.receive().unwrap().unwrap().send_copy(25).unwrap();
+        cache.insert(5, pending_response.receive().unwrap().unwrap());
+        drop(pending_response);
+
+        drop(server);
+        let _server = service.server_builder().create().unwrap();
+
+        assert_that!(
+            matches!(cache.send_copy(&sut, 5).unwrap(), CachedResponse::Pending(_)),
+            eq true
+        );
+    }
+
+    #[conformance_test]
+    pub fn response_cache_evicts_oldest_response_when_full<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .max_borrowed_responses_per_pending_response(2)
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+        let mut cache = ResponseCache::new(2, Duration::from_secs(3600));
+
+        for value in 0..3 {
+            let pending_response = sut.send_copy(value).unwrap();
+            server.receive().unwrap().unwrap().send_copy(value).unwrap();
+            cache.insert(value, pending_response.receive().unwrap().unwrap());
+        }
+
+        assert_that!(cache.len(), eq 2);
+        assert_that!(cache.get(&0), is_none);
+        assert_that!(cache.get(&1), is_some);
+        assert_that!(cache.get(&2), is_some);
+    }
+
+    #[conformance_test]
+    pub fn send_to_all_is_complete_when_all_servers_responded<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .max_servers(3)
+            .create()
+            .unwrap();
+
+        let servers = [
+            service.server_builder().create().unwrap(),
+            service.server_builder().create().unwrap(),
+            service.server_builder().create().unwrap(),
+        ];
+        let sut = service.client_builder().create().unwrap();
+
+        let mut gather = sut.send_to_all(7, GatherCondition::AllServers).unwrap();
+        assert_that!(gather.pending_response().number_of_server_connections(), eq 3);
+
+        let active_requests: vec::Vec<_> = servers
+            .iter()
+            .map(|server| server.receive().unwrap().unwrap())
+            .collect();
+        for active_request in &active_requests {
+            assert_that!(*active_request.payload(), eq 7);
+        }
+
+        active_requests[0].send_copy(1).unwrap();
+        active_requests[1].send_copy(2).unwrap();
+        while gather.receive().unwrap().is_some() {}
+        assert_that!(gather.number_of_responding_servers(), eq 2);
+        assert_that!(gather.is_complete(), eq false);
+
+        active_requests[2].send_copy(3).unwrap();
+        let response = gather.receive().unwrap().unwrap();
+        assert_that!(*response, eq 3);
+        assert_that!(response.origin(), eq servers[2].id());
+        assert_that!(gather.is_complete(), eq true);
+    }
+
+    #[conformance_test]
+    pub fn send_to_all_aggregates_responses_per_server<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .max_servers(3)
+            .create()
+            .unwrap();
+
+        let servers = [
+            service.server_builder().create().unwrap(),
+            service.server_builder().create().unwrap(),
+            service.server_builder().create().unwrap(),
+        ];
+        let sut = service.client_builder().create().unwrap();
+
+        let mut gather = sut
+            .send_to_all(7, GatherCondition::FirstServers(2))
+            .unwrap();
+        let active_requests: vec::Vec<_> = servers
+            .iter()
+            .map(|server| server.receive().unwrap().unwrap())
+            .collect();
+
+        active_requests[0].send_copy(1).unwrap();
+        active_requests[0].send_copy(2).unwrap();
+        while gather.receive().unwrap().is_some() {}
+        assert_that!(gather.number_of_responses_from(&servers[0].id()), eq 2);
+        assert_that!(gather.number_of_responding_servers(), eq 1);
+        assert_that!(gather.is_complete(), eq false);
+
+        active_requests[2].send_copy(3).unwrap();
+        while gather.receive().unwrap().is_some() {}
+        assert_that!(gather.number_of_responses_from(&servers[1].id()), eq 0);
+        assert_that!(gather.number_of_responses_from(&servers[2].id()), eq 1);
+        assert_that!(gather.is_complete(), eq true);
+
+        let mut responding_servers = vec![];
+        gather.responding_servers(|id, n| responding_servers.push((*id, n)));
+        assert_that!(responding_servers, eq vec![(servers[0].id(), 2), (servers[2].id(), 1)]);
+    }
+
+    #[conformance_test]
+    pub fn send_to_all_is_complete_after_timeout<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+
+        let gather = sut
+            .send_to_all(7, GatherCondition::Timeout(TIMEOUT))
+            .unwrap();
+        let _active_request = server.receive().unwrap().unwrap();
+        assert_that!(gather.is_complete(), eq false);
+
+        nanosleep(TIMEOUT * 2).unwrap();
+        assert_that!(gather.is_complete(), eq true);
+        assert_that!(gather.number_of_responding_servers(), eq 0);
+    }
+
+    #[conformance_test]
+    pub fn send_to_all_is_complete_when_all_servers_disconnected<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+
+        let gather = sut.send_to_all(7, GatherCondition::AllServers).unwrap();
+        let active_request = server.receive().unwrap().unwrap();
+        assert_that!(gather.is_complete(), eq false);
+
+        drop(active_request);
+        assert_that!(gather.is_complete(), eq true);
+    }
+
+    #[conformance_test]
+    pub fn send_and_forget_does_not_count_as_active_request<Sut: Service>() {
+        const MAX_ACTIVE_REQUESTS: usize = 2;
+        const NUMBER_OF_REQUESTS: usize = 4;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .enable_fire_and_forget_requests(true)
+            .max_active_requests_per_client(MAX_ACTIVE_REQUESTS)
+            .create()
+            .unwrap();
+
+        let server = service.server_builder().create().unwrap();
+        let sut = service.client_builder().create().unwrap();
+
+        let mut pending_responses = vec![];
+        for _ in 0..MAX_ACTIVE_REQUESTS {
+            pending_responses.push(sut.send_copy(0).unwrap());
+        }
+
+        for value in 1..=NUMBER_OF_REQUESTS as u64 {
+            let request = sut.loan_uninit().unwrap().write_payload(value);
+            assert_that!(request.send_and_forget(), eq Ok(1));
+
+            let active_request = server.receive().unwrap().unwrap();
+            assert_that!(*active_request, eq value);
+            assert_that!(active_request.is_connected(), eq false);
+        }
+    }
+
+    #[conformance_test]
+    pub fn send_and_forget_fails_when_fire_and_forget_is_not_supported<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .request_response::<u64, u64>()
+            .enable_fire_and_forget_requests(false)
+            .create()
+            .unwrap();
+
+        let sut = service.client_builder().create().unwrap();
+
+        let request = sut.loan_uninit().unwrap().write_payload(123);
+        assert_that!(request.send_and_forget().err(), eq Some(RequestSendError::FireAndForgetNotSupported));
+        assert_that!(sut.loan_uninit(), is_ok);
+    }
 }
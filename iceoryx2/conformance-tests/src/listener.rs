@@ -87,4 +87,79 @@ pub mod listener {
 
         Ok(())
     }
+
+    #[conformance_test]
+    pub fn statistics_count_received_notifications<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node.service_builder(&service_name).event().create()?;
+
+        let sut = service.listener_builder().create()?;
+        let notifier = service.notifier_builder().create()?;
+        assert_that!(sut.statistics().received, eq 0);
+
+        notifier.notify()?;
+        let number_of_notifications = sut.try_wait(|_| {})?;
+
+        assert_that!(number_of_notifications, gt 0);
+        assert_that!(sut.statistics().received, eq number_of_notifications);
+        assert_that!(service.dynamic_config().listener_statistics(), eq sut.statistics());
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn wake_up_latency_is_not_tracked_by_default<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node.service_builder(&service_name).event().create()?;
+
+        let sut = service.listener_builder().create()?;
+        let notifier = service.notifier_builder().create()?;
+
+        notifier.notify()?;
+        sut.try_wait(|_| {})?;
+
+        assert_that!(sut.wake_up_latency(), is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn wake_up_latency_is_recorded_for_every_wake_up_with_notifications<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_WAKE_UPS: u64 = 5;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node.service_builder(&service_name).event().create()?;
+
+        let sut = service
+            .listener_builder()
+            .track_wake_up_latency(true)
+            .create()?;
+        let notifier = service.notifier_builder().create()?;
+        assert_that!(sut.wake_up_latency().unwrap().number_of_samples(), eq 0);
+
+        for _ in 0..NUMBER_OF_WAKE_UPS {
+            notifier.notify()?;
+            sut.try_wait(|_| {})?;
+            // no notification, no wake up
+            sut.try_wait(|_| {})?;
+        }
+
+        let latency = sut.wake_up_latency().unwrap();
+        assert_that!(latency.number_of_samples(), eq NUMBER_OF_WAKE_UPS);
+        assert_that!(latency.buckets().iter().sum::<u64>(), eq NUMBER_OF_WAKE_UPS);
+        assert_that!(latency.min(), le latency.mean());
+        assert_that!(latency.mean(), le latency.max());
+        assert_that!(latency.percentile(100.0), eq latency.max());
+        assert_that!(latency.percentile(50.0), le latency.max());
+
+        Ok(())
+    }
 }
@@ -17,11 +17,14 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 pub mod node {
     use alloc::collections::{BTreeSet, VecDeque};
     use alloc::string::ToString;
+    use alloc::vec::Vec;
     use alloc::{format, vec};
     use core::time::Duration;
     use iceoryx2::identifiers::UniqueNodeId;
 
     use iceoryx2::config::Config;
+    use iceoryx2::node::heartbeat::HeartbeatMonitor;
+    use iceoryx2::node::list_filter::{NodeListFilter, NodeStateFilter};
     use iceoryx2::node::{
         NodeCleanupFailure, NodeCreationFailure, NodeListFailure, NodeState, NodeView,
     };
@@ -365,6 +368,116 @@ pub mod node {
         assert_that!(node_counter, eq 1);
     }
 
+    #[conformance_test]
+    pub fn filtered_node_list_contains_only_matching_nodes<S: Service>() {
+        const NUMBER_OF_NODES: usize = 6;
+        let test = Test::<S>::new();
+
+        let mut nodes = vec![];
+        for i in 0..NUMBER_OF_NODES {
+            let prefix = if i % 2 == 0 { "even" } else { "odd" };
+            let node = NodeBuilder::new()
+                .config(test.config())
+                .name(&NodeName::new(&format!("{prefix}_{i}")).unwrap())
+                .create::<S>()
+                .unwrap();
+            nodes.push(node);
+        }
+
+        let mut listed_nodes = vec![];
+        let filter = NodeListFilter::new()
+            .state(NodeStateFilter::Alive)
+            .name_prefix("even");
+        let result = Node::<S>::list_filtered(test.config(), &filter, |node_state| {
+            listed_nodes.push(*node_state.node_id());
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, is_ok);
+        assert_that!(listed_nodes, len NUMBER_OF_NODES / 2);
+        for node in nodes.iter().step_by(2) {
+            assert_that!(listed_nodes, contains * node.id());
+        }
+
+        let mut listed_nodes = vec![];
+        let filter = NodeListFilter::new().node_id(*nodes[1].id());
+        let result = Node::<S>::list_filtered(test.config(), &filter, |node_state| {
+            listed_nodes.push(*node_state.node_id());
+            CallbackProgression::Continue
+        });
+
+        assert_that!(result, is_ok);
+        assert_that!(listed_nodes, eq vec![*nodes[1].id()]);
+
+        let filter = NodeListFilter::new().state(NodeStateFilter::Dead);
+        let result = Node::<S>::list_filtered(test.config(), &filter, |_| {
+            test_fail!("there are no dead nodes");
+        });
+        assert_that!(result, is_ok);
+    }
+
+    #[conformance_test]
+    pub fn filtered_node_list_can_be_paginated<S: Service>() {
+        const NUMBER_OF_NODES: usize = 7;
+        const PAGE_SIZE: usize = 3;
+        let test = Test::<S>::new();
+
+        let mut nodes = vec![];
+        for _ in 0..NUMBER_OF_NODES {
+            nodes.push(
+                NodeBuilder::new()
+                    .config(test.config())
+                    .create::<S>()
+                    .unwrap(),
+            );
+        }
+
+        let mut listed_nodes = vec![];
+        let mut offset = 0;
+        loop {
+            let mut page = vec![];
+            let filter = NodeListFilter::new().offset(offset).limit(PAGE_SIZE);
+            let result = Node::<S>::list_filtered(test.config(), &filter, |node_state| {
+                page.push(*node_state.node_id());
+                CallbackProgression::Continue
+            });
+            assert_that!(result, is_ok);
+            assert_that!(page.len(), le PAGE_SIZE);
+
+            if page.is_empty() {
+                break;
+            }
+            offset += page.len();
+            listed_nodes.append(&mut page);
+        }
+
+        let mut expected_nodes: Vec<UniqueNodeId> = nodes.iter().map(|n| *n.id()).collect();
+        expected_nodes.sort();
+        assert_that!(listed_nodes, eq expected_nodes);
+    }
+
+    #[conformance_test]
+    pub fn count_returns_the_number_of_nodes<S: Service>() {
+        const NUMBER_OF_NODES: usize = 5;
+        let test = Test::<S>::new();
+
+        assert_that!(Node::<S>::count(test.config()), eq Ok(0));
+
+        let mut nodes = vec![];
+        for i in 0..NUMBER_OF_NODES {
+            nodes.push(
+                NodeBuilder::new()
+                    .config(test.config())
+                    .create::<S>()
+                    .unwrap(),
+            );
+            assert_that!(Node::<S>::count(test.config()), eq Ok(i + 1));
+        }
+
+        nodes.clear();
+        assert_that!(Node::<S>::count(test.config()), eq Ok(0));
+    }
+
     #[conformance_test]
     pub fn i_am_not_dead<S: Service>() {
         let test = Test::<S>::new();
@@ -418,4 +531,67 @@ pub mod node {
 
         assert_that!(node.signal_handling_mode(), eq SignalHandlingMode::HandleTerminationRequests);
     }
+
+    #[conformance_test]
+    pub fn heartbeat_counter_is_incremented_by_heartbeat_and_wait<S: Service>() {
+        let test = Test::<S>::new();
+        let node = NodeBuilder::new()
+            .config(test.config())
+            .create::<S>()
+            .unwrap();
+
+        assert_that!(node.heartbeat_counter(), eq Some(0));
+        node.heartbeat();
+        node.heartbeat();
+        assert_that!(node.heartbeat_counter(), eq Some(2));
+
+        assert_that!(node.wait(Duration::ZERO), is_ok);
+        assert_that!(node.heartbeat_counter(), eq Some(3));
+    }
+
+    #[conformance_test]
+    pub fn heartbeat_monitor_reads_heartbeat_of_all_nodes<S: Service>() {
+        let test = Test::<S>::new();
+        let node_1 = NodeBuilder::new()
+            .config(test.config())
+            .create::<S>()
+            .unwrap();
+        let node_2 = NodeBuilder::new()
+            .config(test.config())
+            .create::<S>()
+            .unwrap();
+        let sut = HeartbeatMonitor::<S>::new(test.config()).unwrap();
+
+        node_1.heartbeat();
+        node_2.heartbeat();
+        node_2.heartbeat();
+
+        assert_that!(sut.counter(node_1.id()), eq Some(1));
+        assert_that!(sut.counter(node_2.id()), eq Some(2));
+
+        let mut heartbeats = Vec::new();
+        sut.list(|node_id, counter| {
+            heartbeats.push((*node_id, counter));
+            CallbackProgression::Continue
+        });
+        assert_that!(heartbeats, len 2);
+        assert_that!(heartbeats, contains(*node_1.id(), 1));
+        assert_that!(heartbeats, contains(*node_2.id(), 2));
+    }
+
+    #[conformance_test]
+    pub fn heartbeat_of_dropped_node_is_removed<S: Service>() {
+        let test = Test::<S>::new();
+        let node = NodeBuilder::new()
+            .config(test.config())
+            .create::<S>()
+            .unwrap();
+        let node_id = *node.id();
+        let sut = HeartbeatMonitor::<S>::new(test.config()).unwrap();
+        assert_that!(sut.counter(&node_id), is_some);
+
+        drop(node);
+
+        assert_that!(sut.counter(&node_id), is_none);
+    }
 }
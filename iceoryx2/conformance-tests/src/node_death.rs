@@ -20,6 +20,7 @@ use core::fmt::Debug;
 
 use core::time::Duration;
 use iceoryx2::node::{CleanupState, NodeState};
+use iceoryx2::port::update_connections::UpdateConnections;
 use iceoryx2::prelude::*;
 use iceoryx2::testing::*;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
@@ -259,6 +260,43 @@ pub mod node_death {
         assert_that!(received_events, eq 1);
     }
 
+    #[conformance_test]
+    pub fn publisher_disconnects_subscriber_of_dead_node_without_node_cleanup<
+        S: iceoryx2::service::Service,
+    >() {
+        test_requires!(does_support_persistency::<S>());
+
+        let test = Test::<S>::new();
+        let service_name = generate_service_name();
+
+        let dead_node = test.create_node();
+        let node = test.create_node();
+
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let dead_service = dead_node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        let dead_subscriber = dead_service.subscriber_builder().create().unwrap();
+        let _subscriber = service.subscriber_builder().create().unwrap();
+        let sut = service.publisher_builder().create().unwrap();
+
+        assert_that!(sut.send_copy(1).unwrap(), eq 2);
+
+        dead_node.abandon();
+        dead_subscriber.abandon();
+        dead_service.abandon();
+
+        assert_that!(sut.update_connections(), is_ok);
+        assert_that!(sut.send_copy(2).unwrap(), eq 1);
+        assert_that!(service.dynamic_config().number_of_subscribers(), eq 2);
+    }
+
     #[conformance_test]
     pub fn dead_node_is_removed_from_request_response_service<S: iceoryx2::service::Service>() {
         test_requires!(does_support_persistency::<S>());
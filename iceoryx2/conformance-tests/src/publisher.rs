@@ -16,8 +16,10 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 #[conformance_tests]
 pub mod publisher {
     use alloc::collections::BTreeSet;
+    use alloc::vec::Vec;
     use alloc::{format, vec};
     use core::time::Duration;
+    use iceoryx2::port::statistics::PortStatistics;
     use iceoryx2::port::update_connections::UpdateConnections;
     use iceoryx2::port::{LoanError, publisher::PublisherCreateError};
     use iceoryx2::prelude::*;
@@ -25,6 +27,7 @@ pub mod publisher {
     use iceoryx2::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
     use iceoryx2::service::static_config::message_type_details::{TypeDetail, TypeVariant};
     use iceoryx2_bb_concurrency::atomic::{AtomicBool, Ordering};
+    use iceoryx2_bb_posix::adaptive_wait::{AdaptiveWaitStrategy, Backoff};
     use iceoryx2_bb_posix::barrier::*;
     use iceoryx2_bb_posix::clock::{Time, nanosleep};
     use iceoryx2_bb_posix::mutex::{MutexBuilder, MutexHandle};
@@ -36,6 +39,79 @@ pub mod publisher {
 
     const TIMEOUT: Duration = Duration::from_millis(25);
 
+    #[conformance_test]
+    pub fn publisher_forwards_received_sample<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let origin = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .user_header::<u32>()
+            .create()?;
+        let target = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .user_header::<u32>()
+            .create()?;
+
+        let origin_publisher = origin.publisher_builder().create()?;
+        let origin_subscriber = origin.subscriber_builder().create()?;
+        let sut = target.publisher_builder().create()?;
+        let target_subscriber = target.subscriber_builder().create()?;
+
+        let mut sample = origin_publisher.loan()?;
+        *sample.user_header_mut() = 17;
+        *sample.payload_mut() = 4711;
+        sample.send()?;
+
+        let received_sample = origin_subscriber.receive()?.unwrap();
+        assert_that!(sut.forward(&received_sample)?, eq 1);
+
+        let forwarded_sample = target_subscriber.receive()?.unwrap();
+        assert_that!(*forwarded_sample.user_header(), eq 17);
+        assert_that!(*forwarded_sample.payload(), eq 4711);
+        assert_that!(forwarded_sample.origin(), eq sut.id());
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_forwards_received_slice_sample<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let origin = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<[u64]>()
+            .create()?;
+        let target = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let origin_publisher = origin
+            .publisher_builder()
+            .initial_max_slice_len(8)
+            .create()?;
+        let origin_subscriber = origin.subscriber_builder().create()?;
+        let sut = target
+            .publisher_builder()
+            .initial_max_slice_len(8)
+            .create()?;
+        let target_subscriber = target.subscriber_builder().create()?;
+
+        origin_publisher.send_slice_copy(&[1, 2, 3, 4, 5])?;
+
+        let received_sample = origin_subscriber.receive()?.unwrap();
+        assert_that!(sut.forward(&received_sample)?, eq 1);
+
+        let forwarded_sample = target_subscriber.receive()?.unwrap();
+        assert_that!(forwarded_sample.payload(), eq [1, 2, 3, 4, 5]);
+
+        Ok(())
+    }
+
     #[conformance_test]
     pub fn publisher_loan_and_send_sample_works<Sut: Service>()
     -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
@@ -460,6 +536,332 @@ pub mod publisher {
         Ok(())
     }
 
+    #[conformance_test]
+    pub fn publisher_send_copy_with_non_temporal_copy_strategy_works<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        #[derive(Debug, Clone, Copy, PartialEq, ZeroCopySend)]
+        #[repr(C)]
+        struct Frame {
+            data: [u64; 67],
+        }
+
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<Frame>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .copy_strategy(CopyStrategy::NonTemporal)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+        assert_that!(sut.copy_strategy(), eq CopyStrategy::NonTemporal);
+
+        let mut frame = Frame { data: [0; 67] };
+        for (n, value) in frame.data.iter_mut().enumerate() {
+            *value = 3 * n as u64 + 11;
+        }
+
+        assert_that!(sut.send_copy(frame), eq Ok(1));
+
+        let sample = subscriber.receive()?.unwrap();
+        assert_that!(*sample, eq frame);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_send_slice_copy_with_non_temporal_copy_strategy_works<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const SLICE_LEN: usize = 4099;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(SLICE_LEN)
+            .copy_strategy(CopyStrategy::NonTemporal)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        let payload: Vec<u8> = (0..SLICE_LEN).map(|n| (n % 251) as u8).collect();
+        assert_that!(sut.send_slice_copy(&payload), eq Ok(1));
+
+        let sample = subscriber.receive()?.unwrap();
+        assert_that!(sample.payload(), eq payload.as_slice());
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_with_huge_page_size_delivers_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const SLICE_LEN: usize = 4 * 1024 * 1024;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(SLICE_LEN)
+            .page_size(PageSize::Huge)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        let payload: Vec<u8> = (0..SLICE_LEN).map(|n| (n % 241) as u8).collect();
+        assert_that!(sut.send_slice_copy(&payload), eq Ok(1));
+
+        let sample = subscriber.receive()?.unwrap();
+        assert_that!(sample.payload(), eq payload.as_slice());
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_details_contain_effective_numa_policy<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .numa_policy(NumaPolicy::CreatingThreadNode)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        let mut numa_policies = vec![];
+        service.dynamic_config().list_publishers(|details| {
+            numa_policies.push(details.numa_policy);
+            CallbackProgression::Continue
+        });
+
+        assert_that!(numa_policies, len 1);
+        assert_that!(numa_policies[0], ne NumaPolicy::CreatingThreadNode);
+
+        assert_that!(sut.send_copy(8127), eq Ok(1));
+        let sample = subscriber.receive()?.unwrap();
+        assert_that!(*sample, eq 8127);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn prefaulted_publisher_delivers_samples_to_existing_and_new_subscribers<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let existing_subscriber = service.subscriber_builder().create()?;
+        let sut = service.publisher_builder().prefault(true).create()?;
+        let new_subscriber = service.subscriber_builder().create()?;
+
+        assert_that!(sut.send_copy(1923), eq Ok(2));
+
+        let sample = existing_subscriber.receive()?.unwrap();
+        assert_that!(*sample, eq 1923);
+        let sample = new_subscriber.receive()?.unwrap();
+        assert_that!(*sample, eq 1923);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_with_chunk_cache_delivers_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_ITERATIONS: u64 = 32;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().chunk_cache_size(4).create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        for n in 0..NUMBER_OF_ITERATIONS {
+            let sample = sut.loan_uninit()?;
+            drop(sample);
+
+            assert_that!(sut.send_copy(n), eq Ok(1));
+            let sample = subscriber.receive()?.unwrap();
+            assert_that!(*sample, eq n);
+        }
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_with_chunk_cache_does_not_exceed_available_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .override_sample_preallocation(|_| 1)
+            .max_loaned_samples(2)
+            .chunk_cache_size(4)
+            .create()?;
+
+        let sample = sut.loan()?;
+        drop(sample);
+
+        let _sample = sut.loan()?;
+        assert_that!(sut.loan().err(), eq Some(LoanError::OutOfMemory));
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_with_shrink_policy_releases_idle_oversized_segment<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(8)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .shrink_policy(ShrinkPolicy::AfterIdleTime(Duration::ZERO))
+            .create()?;
+        let initial_statistics = sut.data_segment_statistics();
+
+        let sample = sut.loan_slice(4096)?;
+        assert_that!(sut.data_segment_statistics().current_segment_size, gt initial_statistics.current_segment_size);
+        drop(sample);
+
+        let _sample = sut.loan_slice(8)?;
+        let statistics = sut.data_segment_statistics();
+        assert_that!(statistics.number_of_released_segments, eq 1);
+        assert_that!(statistics.number_of_active_segments, eq 1);
+        assert_that!(statistics.current_segment_size, eq initial_statistics.current_segment_size);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_without_shrink_policy_keeps_oversized_segment<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u8]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(8)
+            .allocation_strategy(AllocationStrategy::PowerOfTwo)
+            .create()?;
+        let initial_statistics = sut.data_segment_statistics();
+
+        drop(sut.loan_slice(4096)?);
+        let _sample = sut.loan_slice(8)?;
+        let statistics = sut.data_segment_statistics();
+        assert_that!(statistics.number_of_released_segments, eq 0);
+        assert_that!(statistics.current_segment_size, gt initial_statistics.current_segment_size);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_send_batch_delivers_all_samples_in_order<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: usize = 4;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .max_loaned_samples(NUMBER_OF_SAMPLES)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        let mut samples = vec![];
+        for n in 0..NUMBER_OF_SAMPLES {
+            samples.push(sut.loan_uninit()?.write_payload(n as u64));
+        }
+
+        assert_that!(sut.send_batch(samples), eq Ok(NUMBER_OF_SAMPLES));
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            let sample = subscriber.receive()?.unwrap();
+            assert_that!(*sample, eq n as u64);
+        }
+        assert_that!(subscriber.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_send_batch_reduces_loan_counter<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().max_loaned_samples(2).create()?;
+
+        let sample1 = sut.loan_uninit()?.write_payload(1);
+        let sample2 = sut.loan_uninit()?.write_payload(2);
+
+        assert_that!(sut.send_batch([sample1, sample2]), is_ok);
+
+        let _sample3 = sut.loan_uninit()?;
+        let _sample4 = sut.loan_uninit()?;
+        let sample5 = sut.loan_uninit();
+        assert_that!(sample5, is_err);
+        assert_that!(sample5.err().unwrap(), eq LoanError::ExceedsMaxLoans);
+
+        Ok(())
+    }
+
     #[derive(Debug, ZeroCopySend, Eq, PartialEq)]
     #[repr(C)]
     struct CustomUserHeader<const A: u32, const B: u64> {
@@ -629,7 +1031,7 @@ pub mod publisher {
     }
 
     #[conformance_test]
-    pub fn backpressure_strategy_block_unblock_when_subscriber_disconnects<Sut: Service>()
+    pub fn backpressure_wait_strategy_backoff_delivers_when_subscriber_has_space<Sut: Service>()
     -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
         let test = Test::<Sut>::new();
         let service_name = generate_service_name();
@@ -645,7 +1047,80 @@ pub mod publisher {
             .subscriber_max_buffer_size(1)
             .enable_safe_overflow(false)
             .create()?;
-        let subscriber = service.subscriber_builder().create().unwrap();
+
+        let backoff = AdaptiveWaitStrategy::Backoff(Backoff {
+            spin_repetitions: 10,
+            yield_repetitions: 10,
+            initial_sleep: Duration::from_micros(10),
+            max_sleep: Duration::from_millis(1),
+        });
+        let sut = service
+            .publisher_builder()
+            .backpressure_strategy(BackpressureStrategy::RetryUntilDelivered)
+            .backpressure_wait_strategy(backoff)
+            .create()?;
+
+        let handle = BarrierHandle::new();
+        let barrier = BarrierBuilder::new(2).create(&handle).unwrap();
+
+        thread_scope(|s| {
+            s.thread_builder().spawn(|| {
+                let service = node
+                    .lock()
+                    .unwrap()
+                    .service_builder(&service_name)
+                    .publish_subscribe::<u64>()
+                    .subscriber_max_buffer_size(1)
+                    .open()
+                    .unwrap();
+
+                let subscriber = service.subscriber_builder().create().unwrap();
+                let receive_sample = || loop {
+                    if let Some(sample) = subscriber.receive().unwrap() {
+                        return sample;
+                    }
+                };
+
+                barrier.wait();
+                nanosleep(TIMEOUT).unwrap();
+                let sample_1 = receive_sample();
+                let sample_2 = receive_sample();
+
+                assert_that!(*sample_1, eq 1);
+                assert_that!(*sample_2, eq 2);
+            })?;
+
+            barrier.wait();
+            let now = Time::now().unwrap();
+            sut.send_copy(1).unwrap();
+            sut.send_copy(2).unwrap();
+            assert_that!(now.elapsed().unwrap(), time_at_least TIMEOUT);
+
+            Ok(())
+        })
+        .unwrap();
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn backpressure_strategy_block_unblock_when_subscriber_disconnects<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let handle = MutexHandle::new();
+        let node = MutexBuilder::new()
+            .create(test.create_node(), &handle)
+            .unwrap();
+        let service = node
+            .lock()
+            .unwrap()
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(1)
+            .enable_safe_overflow(false)
+            .create()?;
+        let subscriber = service.subscriber_builder().create().unwrap();
 
         let init_handle = BarrierHandle::new();
         let init_barrier = BarrierBuilder::new(2).create(&init_handle).unwrap();
@@ -884,4 +1359,412 @@ pub mod publisher {
 
         Ok(())
     }
+
+    #[conformance_test]
+    pub fn publisher_creation_fails_when_shared_memory_quota_is_exceeded<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let mut test = Test::<Sut>::new();
+        assert_that!(Sut::reserved_shared_memory(test.config()), is_none);
+
+        test.config_mut().global.shared_memory_quota = Some(usize::MAX);
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .max_publishers(2)
+            .create()?;
+        assert_that!(Sut::reserved_shared_memory(test.config()), eq Some(0));
+
+        let publisher = service.publisher_builder().create()?;
+        let reserved = Sut::reserved_shared_memory(test.config()).unwrap();
+        assert_that!(reserved, gt 0);
+
+        let mut config = test.config().clone();
+        config.global.shared_memory_quota = Some(reserved + reserved / 2);
+        let node_with_quota = NodeBuilder::new().config(&config).create::<Sut>()?;
+        let service_with_quota = node_with_quota
+            .service_builder(service.name())
+            .publish_subscribe::<u64>()
+            .open()?;
+
+        let result = service_with_quota.publisher_builder().create();
+        assert_that!(result.err(), eq Some(PublisherCreateError::UnableToCreateDataSegment));
+        assert_that!(Sut::reserved_shared_memory(&config), eq Some(reserved));
+
+        drop(publisher);
+        assert_that!(Sut::reserved_shared_memory(&config), eq Some(0));
+
+        let _publisher = service_with_quota.publisher_builder().create()?;
+        assert_that!(Sut::reserved_shared_memory(&config), eq Some(reserved));
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_delivers_history_in_batches<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const HISTORY_SIZE: usize = 10;
+        const BATCH_SIZE: usize = 3;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .history_size(HISTORY_SIZE)
+            .subscriber_max_buffer_size(HISTORY_SIZE)
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .history_delivery_batch_size(BATCH_SIZE)
+            .create()?;
+
+        for i in 0..HISTORY_SIZE as u64 {
+            sut.send_copy(i)?;
+        }
+
+        let subscriber = service.subscriber_builder().create()?;
+
+        let mut next_value = 0;
+        while next_value < HISTORY_SIZE as u64 {
+            sut.update_connections()?;
+
+            let expected_batch = BATCH_SIZE.min(HISTORY_SIZE - next_value as usize);
+            for _ in 0..expected_batch {
+                let sample = subscriber.receive()?;
+                assert_that!(sample, is_some);
+                assert_that!(*sample.unwrap(), eq next_value);
+                next_value += 1;
+            }
+            assert_that!(subscriber.receive()?, is_none);
+        }
+
+        sut.update_connections()?;
+        assert_that!(subscriber.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_delivers_only_history_since_requested_time<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const HISTORY_SIZE: usize = 6;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .history_size(HISTORY_SIZE)
+            .subscriber_max_buffer_size(HISTORY_SIZE)
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+
+        sut.send_copy(0)?;
+        sut.send_copy(1)?;
+        nanosleep(Duration::from_millis(1))?;
+        let since = Time::now()?;
+        nanosleep(Duration::from_millis(1))?;
+        sut.send_copy(2)?;
+        sut.send_copy(3)?;
+
+        let subscriber = service.subscriber_builder().history_since(since).create()?;
+        sut.update_connections()?;
+
+        for i in 2..4 {
+            let sample = subscriber.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+        assert_that!(subscriber.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_reuses_pooled_data_segment_of_dropped_publisher<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = NodeBuilder::new()
+            .config(test.config())
+            .data_segment_pool_capacity(1)
+            .create::<Sut>()?;
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        let subscriber = service.subscriber_builder().create()?;
+        sut.send_copy(1)?;
+        drop(subscriber.receive()?);
+        let pooled_publisher_id = sut.id();
+        drop(subscriber);
+        drop(sut);
+
+        let sut = service.publisher_builder().create()?;
+        assert_that!(sut.id(), eq pooled_publisher_id);
+
+        let subscriber = service.subscriber_builder().create()?;
+        sut.send_copy(2)?;
+        let sample = subscriber.receive()?;
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 2);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_does_not_reuse_data_segment_by_default<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        let first_publisher_id = sut.id();
+        drop(sut);
+
+        let sut = service.publisher_builder().create()?;
+        assert_that!(sut.id(), ne first_publisher_id);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn data_segment_with_samples_in_use_is_not_pooled<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = NodeBuilder::new()
+            .config(test.config())
+            .data_segment_pool_capacity(1)
+            .create::<Sut>()?;
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        let subscriber = service.subscriber_builder().create()?;
+        sut.send_copy(1)?;
+        let sample = subscriber.receive()?;
+        assert_that!(sample, is_some);
+        let first_publisher_id = sut.id();
+        drop(sut);
+
+        let sut = service.publisher_builder().create()?;
+        assert_that!(sut.id(), ne first_publisher_id);
+        drop(sample);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_does_not_reuse_data_segment_with_different_layout<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = NodeBuilder::new()
+            .config(test.config())
+            .data_segment_pool_capacity(1)
+            .create::<Sut>()?;
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<[u64]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(8)
+            .create()?;
+        let first_publisher_id = sut.id();
+        drop(sut);
+
+        let sut = service
+            .publisher_builder()
+            .initial_max_slice_len(16)
+            .create()?;
+        assert_that!(sut.id(), ne first_publisher_id);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn statistics_count_sent_samples_and_failed_loans<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.publisher_builder().max_loaned_samples(1).create()?;
+        let subscriber = service.subscriber_builder().create()?;
+        assert_that!(sut.statistics(), eq PortStatistics::default());
+
+        sut.send_copy(1)?;
+        sut.send_copy(2)?;
+        let _sample = sut.loan()?;
+        assert_that!(sut.loan().err(), eq Some(LoanError::ExceedsMaxLoans));
+
+        let statistics = sut.statistics();
+        assert_that!(statistics.sent, eq 2);
+        assert_that!(statistics.failed_loans, eq 1);
+        assert_that!(statistics.overflows, eq 0);
+
+        while subscriber.receive()?.is_some() {}
+        assert_that!(subscriber.statistics().received, eq 2);
+        assert_that!(service.dynamic_config().publisher_statistics(), eq statistics);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn statistics_count_overflows_of_subscriber_buffer<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const BUFFER_SIZE: usize = 2;
+        const NUMBER_OF_SAMPLES: usize = 5;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .enable_safe_overflow(true)
+            .create()?;
+
+        let sut = service.publisher_builder().create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            sut.send_copy(n as u64)?;
+        }
+
+        let statistics = sut.statistics();
+        assert_that!(statistics.sent, eq NUMBER_OF_SAMPLES as u64);
+        assert_that!(
+            statistics.overflows,
+            eq(NUMBER_OF_SAMPLES - BUFFER_SIZE) as u64
+        );
+
+        drop(subscriber);
+        drop(sut);
+        assert_that!(service.dynamic_config().publisher_statistics(), eq PortStatistics::default());
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn statistics_of_every_port_can_be_listed_via_the_dynamic_config<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .max_publishers(2)
+            .create()?;
+
+        let sut_1 = service.publisher_builder().create()?;
+        let sut_2 = service.publisher_builder().create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        sut_1.send_copy(1)?;
+        sut_2.send_copy(2)?;
+        sut_2.send_copy(3)?;
+        while subscriber.receive()?.is_some() {}
+
+        let mut publisher_statistics = Vec::new();
+        service
+            .dynamic_config()
+            .list_publisher_statistics(|details, statistics| {
+                publisher_statistics.push((details.publisher_id, statistics));
+                CallbackProgression::Continue
+            });
+        assert_that!(publisher_statistics, len 2);
+        let statistics_1 = (sut_1.id(), sut_1.statistics());
+        let statistics_2 = (sut_2.id(), sut_2.statistics());
+        assert_that!(publisher_statistics, contains statistics_1);
+        assert_that!(publisher_statistics, contains statistics_2);
+        assert_that!(sut_2.statistics().sent, eq 2);
+
+        let mut subscriber_statistics = Vec::new();
+        service
+            .dynamic_config()
+            .list_subscriber_statistics(|details, statistics| {
+                subscriber_statistics.push((details.subscriber_id, statistics));
+                CallbackProgression::Continue
+            });
+        assert_that!(subscriber_statistics, eq vec![(subscriber.id(), subscriber.statistics())]);
+        assert_that!(subscriber.statistics().received, eq 3);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_loan_from_last_sent_copies_last_sent_payload<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<[u64; 4]>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .max_loaned_samples(1)
+            .enable_loan_from_last_sent(true)
+            .create()?;
+        let subscriber = service.subscriber_builder().create()?;
+
+        sut.send_copy([1, 2, 3, 4])?;
+        let mut sample = sut.loan_from_last_sent()?;
+        assert_that!(*sample.payload(), eq [1, 2, 3, 4]);
+        sample.payload_mut()[2] = 5;
+        sample.send()?;
+
+        let sample = sut.loan_from_last_sent()?;
+        assert_that!(*sample.payload(), eq [1, 2, 5, 4]);
+        drop(sample);
+
+        let mut received = Vec::new();
+        while let Some(sample) = subscriber.receive()? {
+            received.push(*sample.payload());
+        }
+        assert_that!(received, eq vec![[1, 2, 3, 4], [1, 2, 5, 4]]);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn publisher_loan_from_last_sent_uses_default_without_last_sent_sample<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service
+            .publisher_builder()
+            .enable_loan_from_last_sent(true)
+            .create()?;
+        let sample = sut.loan_from_last_sent()?;
+        assert_that!(*sample.payload(), eq 0);
+        drop(sample);
+
+        let sut_without_retained_sample = service.publisher_builder().create()?;
+        sut_without_retained_sample.send_copy(123)?;
+        let sample = sut_without_retained_sample.loan_from_last_sent()?;
+        assert_that!(*sample.payload(), eq 0);
+
+        Ok(())
+    }
 }
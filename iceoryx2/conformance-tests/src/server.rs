@@ -15,23 +15,29 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 #[allow(clippy::module_inception)]
 #[conformance_tests]
 pub mod server {
-    use alloc::{sync::Arc, vec};
+    use alloc::{sync::Arc, vec, vec::Vec};
     use core::time::Duration;
     use iceoryx2::port::update_connections::UpdateConnections;
 
+    use iceoryx2::identifiers::UniqueClientId;
+    use iceoryx2::port::receive_policy::ReceivePolicy;
     use iceoryx2::port::{BackpressureAction, ReceiveError, SendError};
     use iceoryx2::prelude::*;
     use iceoryx2::service::port_factory::request_response::PortFactory;
     use iceoryx2::service::port_factory::server::PortFactoryServer;
+    use iceoryx2::waitset::WaitSetAttachmentError;
     use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64, Ordering};
     use iceoryx2_bb_posix::barrier::BarrierBuilder;
     use iceoryx2_bb_posix::barrier::BarrierHandle;
     use iceoryx2_bb_posix::clock::{Time, nanosleep};
+    use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
     use iceoryx2_bb_posix::ipc_capable::Handle;
     use iceoryx2_bb_posix::thread::thread_scope;
     use iceoryx2_bb_testing::assert_that;
     use iceoryx2_bb_testing::watchdog::Watchdog;
     use iceoryx2_bb_testing_macros::conformance_test;
+    use iceoryx2_cal::event::Event;
+    use iceoryx2_cal::event::event_state::counting_bit_set::RelocatableCountingBitSet;
     use iceoryx2_testing::*;
 
     const TIMEOUT: Duration = Duration::from_millis(50);
@@ -106,6 +112,101 @@ pub mod server {
         assert_that!(*active_request, eq 5678);
     }
 
+    #[conformance_test]
+    pub fn server_with_wake_up_is_woken_up_by_client<Sut: Service>()
+    where
+        <Sut::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+        let sut = service
+            .server_builder()
+            .enable_wake_up(true)
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+
+        let waitset = WaitSetBuilder::new().create::<Sut>().unwrap();
+        let guard = waitset.attach_server(&sut).unwrap();
+
+        let wait_for_wake_up = || {
+            let mut is_woken_up = false;
+            waitset
+                .wait_and_process_once_with_timeout(
+                    |attachment_id| {
+                        if attachment_id.has_event_from(&guard) {
+                            is_woken_up = true;
+                        }
+                        CallbackProgression::Continue
+                    },
+                    TIMEOUT,
+                )
+                .unwrap();
+            is_woken_up
+        };
+
+        assert_that!(wait_for_wake_up(), eq false);
+
+        let _pending_response = client.send_copy(1234).unwrap();
+        assert_that!(wait_for_wake_up(), eq true);
+
+        let active_request = sut.receive().unwrap().unwrap();
+        assert_that!(*active_request, eq 1234);
+        assert_that!(sut.receive().unwrap(), is_none);
+
+        assert_that!(wait_for_wake_up(), eq false);
+    }
+
+    #[conformance_test]
+    pub fn server_with_ready_client_tracking_receives_requests_of_all_clients<Sut: Service>() {
+        const NUMBER_OF_CLIENTS: usize = 4;
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+        let sut = service
+            .server_builder()
+            .enable_ready_client_tracking(true)
+            .create()
+            .unwrap();
+
+        let mut clients = vec![];
+        for _ in 0..NUMBER_OF_CLIENTS - 1 {
+            clients.push(service.client_builder().create().unwrap());
+        }
+
+        assert_that!(sut.receive().unwrap(), is_none);
+
+        for round in 0..3u64 {
+            let mut pending_responses = vec![];
+            for (n, client) in clients.iter().enumerate().rev() {
+                pending_responses.push(client.send_copy(round * 100 + n as u64).unwrap());
+            }
+
+            let mut received = vec![];
+            while let Some(active_request) = sut.receive().unwrap() {
+                received.push(*active_request);
+            }
+            received.sort();
+
+            let expected: Vec<u64> = (0..clients.len() as u64).map(|n| round * 100 + n).collect();
+            assert_that!(received, eq expected);
+        }
+    }
+
+    #[conformance_test]
+    pub fn server_without_wake_up_cannot_be_attached_to_waitset<Sut: Service>()
+    where
+        <Sut::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+        let sut = service.server_builder().create().unwrap();
+
+        let waitset = WaitSetBuilder::new().create::<Sut>().unwrap();
+        let result = waitset.attach_server(&sut);
+
+        assert_that!(result.err(), eq Some(WaitSetAttachmentError::NoWakeUpChannel));
+    }
+
     #[conformance_test]
     pub fn requests_of_a_disconnected_client_are_not_received<Sut: Service>() {
         let test = Test::<Sut>::new();
@@ -267,6 +368,49 @@ pub mod server {
         Ok(())
     }
 
+    #[conformance_test]
+    pub fn server_with_preloaned_responses_delivers_responses<Sut: Service>() {
+        const NUMBER_OF_ITERATIONS: u64 = 32;
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+        let sut = service
+            .server_builder()
+            .preloaned_responses(4)
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+
+        for n in 0..NUMBER_OF_ITERATIONS {
+            let pending_response = client.send_copy(n).unwrap();
+            let active_request = sut.receive().unwrap().unwrap();
+            let response = active_request.loan_uninit().unwrap();
+            assert_that!(response.write_payload(*active_request + 1).send(), is_ok);
+
+            let response = pending_response.receive().unwrap().unwrap();
+            assert_that!(*response, eq n + 1);
+        }
+    }
+
+    #[conformance_test]
+    pub fn preloaned_responses_do_not_exceed_available_responses<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+        let sut = service
+            .server_builder()
+            .override_response_preallocation(|_| 1)
+            .max_loaned_responses_per_request(2)
+            .preloaned_responses(4)
+            .create()
+            .unwrap();
+
+        let client = service.client_builder().create().unwrap();
+        let _pending_response = client.send_copy(0).unwrap();
+        let active_request = sut.receive().unwrap().unwrap();
+
+        let _response = active_request.loan().unwrap();
+        assert_that!(active_request.loan().err(), eq Some(iceoryx2::port::LoanError::OutOfMemory));
+    }
+
     #[conformance_test]
     pub fn override_preallocated_responses_to_one_works<Sut: Service>() {
         let service_name = generate_service_name();
@@ -1308,4 +1452,276 @@ pub mod server {
 
         Ok(())
     }
+
+    #[conformance_test]
+    pub fn identical_requests_are_not_coalesced_by_default<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+
+        let sut = service.server_builder().create().unwrap();
+        let client_1 = service.client_builder().create().unwrap();
+        let client_2 = service.client_builder().create().unwrap();
+
+        let _pending_response_1 = client_1.send_copy(42).unwrap();
+        let _pending_response_2 = client_2.send_copy(42).unwrap();
+
+        assert_that!(sut.receive().unwrap(), is_some);
+        assert_that!(sut.receive().unwrap(), is_some);
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn identical_in_flight_requests_are_served_by_one_response<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+
+        let sut = service
+            .server_builder()
+            .enable_request_coalescing(true)
+            .create()
+            .unwrap();
+        let client_1 = service.client_builder().create().unwrap();
+        let client_2 = service.client_builder().create().unwrap();
+        let client_3 = service.client_builder().create().unwrap();
+
+        let pending_response_1 = client_1.send_copy(42).unwrap();
+        let pending_response_2 = client_2.send_copy(42).unwrap();
+        let pending_response_3 = client_3.send_copy(7).unwrap();
+
+        let active_request_1 = sut.receive().unwrap().unwrap();
+        assert_that!(*active_request_1, eq 42);
+        let active_request_2 = sut.receive().unwrap().unwrap();
+        assert_that!(*active_request_2, eq 7);
+        assert_that!(sut.receive().unwrap(), is_none);
+
+        active_request_1.send_copy(84).unwrap();
+        active_request_2.send_copy(14).unwrap();
+
+        let response = pending_response_1.receive().unwrap().unwrap();
+        assert_that!(*response, eq 84);
+        assert_that!(response.header().number_of_coalesced_requests(), eq 2);
+        let response = pending_response_2.receive().unwrap().unwrap();
+        assert_that!(*response, eq 84);
+        let response = pending_response_3.receive().unwrap().unwrap();
+        assert_that!(*response, eq 14);
+        assert_that!(response.header().number_of_coalesced_requests(), eq 0);
+
+        assert_that!(pending_response_2.is_connected(), eq true);
+        drop(active_request_1);
+        assert_that!(pending_response_1.is_connected(), eq false);
+        assert_that!(pending_response_2.is_connected(), eq false);
+    }
+
+    #[conformance_test]
+    pub fn identical_request_is_received_after_in_flight_request_is_done<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+
+        let sut = service
+            .server_builder()
+            .enable_request_coalescing(true)
+            .create()
+            .unwrap();
+        let client_1 = service.client_builder().create().unwrap();
+        let client_2 = service.client_builder().create().unwrap();
+
+        let _pending_response_1 = client_1.send_copy(42).unwrap();
+        let active_request = sut.receive().unwrap().unwrap();
+        drop(active_request);
+
+        let _pending_response_2 = client_2.send_copy(42).unwrap();
+        assert_that!(sut.receive().unwrap(), is_some);
+    }
+
+    #[conformance_test]
+    pub fn deadline_scheduling_receives_requests_with_earliest_deadline_first<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&generate_service_name())
+            .request_response::<u64, u64>()
+            .max_active_requests_per_client(4)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .server_builder()
+            .enable_deadline_scheduling(true)
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+
+        let mut pending_responses = vec![];
+        for (value, deadline) in [(1, Some(30)), (2, None), (3, Some(10)), (4, Some(20))] {
+            let mut request = client.loan_uninit().unwrap();
+            if let Some(deadline) = deadline {
+                request.set_deadline(Duration::from_secs(deadline));
+            }
+            pending_responses.push(request.write_payload(value).send().unwrap());
+        }
+
+        for expected_value in [3, 4, 1, 2] {
+            let active_request = sut.receive().unwrap().unwrap();
+            assert_that!(*active_request, eq expected_value);
+        }
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn deadline_scheduling_rejects_requests_whose_deadline_has_passed<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+
+        let sut = service
+            .server_builder()
+            .enable_deadline_scheduling(true)
+            .create()
+            .unwrap();
+        let client = service.client_builder().create().unwrap();
+
+        let mut request = client.loan_uninit().unwrap();
+        request.set_deadline(Duration::ZERO);
+        let late_pending_response = request.write_payload(1).send().unwrap();
+        let pending_response = client.send_copy(2).unwrap();
+        nanosleep(Duration::from_millis(1)).unwrap();
+
+        let active_request = sut.receive().unwrap().unwrap();
+        assert_that!(*active_request, eq 2);
+        assert_that!(sut.receive().unwrap(), is_none);
+
+        assert_that!(late_pending_response.is_connected(), eq false);
+        assert_that!(late_pending_response.has_missed_deadline(), eq true);
+        assert_that!(pending_response.is_connected(), eq true);
+        assert_that!(pending_response.has_missed_deadline(), eq false);
+    }
+
+    #[conformance_test]
+    pub fn requests_whose_deadline_has_passed_are_received_by_default<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let (_node, service) = test.create_node_and_service();
+
+        let sut = service.server_builder().create().unwrap();
+        let client = service.client_builder().create().unwrap();
+
+        let mut request = client.loan_uninit().unwrap();
+        request.set_deadline(Duration::ZERO);
+        let pending_response = request.write_payload(1).send().unwrap();
+        nanosleep(Duration::from_millis(1)).unwrap();
+
+        assert_that!(sut.receive().unwrap(), is_some);
+        assert_that!(pending_response.has_missed_deadline(), eq false);
+    }
+
+    fn fair_queuing_service<Sut: Service>(
+        node: &Node<Sut>,
+        number_of_requests: usize,
+    ) -> PortFactory<Sut, u64, (), u64, ()> {
+        node.service_builder(&generate_service_name())
+            .request_response::<u64, u64>()
+            .max_active_requests_per_client(number_of_requests)
+            .max_clients(2)
+            .create()
+            .unwrap()
+    }
+
+    fn received_origins<Sut: Service>(
+        sut: &Server<Sut, u64, (), u64, ()>,
+        number_of_requests: usize,
+    ) -> Vec<UniqueClientId> {
+        let mut origins = vec![];
+        for _ in 0..number_of_requests {
+            let active_request = sut.receive().unwrap().unwrap();
+            origins.push(active_request.origin());
+        }
+        origins
+    }
+
+    #[conformance_test]
+    pub fn round_robin_receive_policy_alternates_between_clients<Sut: Service>() {
+        const NUMBER_OF_REQUESTS: usize = 4;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = fair_queuing_service(&node, NUMBER_OF_REQUESTS);
+
+        let sut = service
+            .server_builder()
+            .receive_policy(ReceivePolicy::RoundRobin)
+            .create()
+            .unwrap();
+        let client_a = service.client_builder().create().unwrap();
+        let client_b = service.client_builder().create().unwrap();
+
+        let mut pending_responses = vec![];
+        for n in 0..NUMBER_OF_REQUESTS as u64 {
+            pending_responses.push(client_a.send_copy(n).unwrap());
+            pending_responses.push(client_b.send_copy(n).unwrap());
+        }
+
+        let origins = received_origins(&sut, 2 * NUMBER_OF_REQUESTS);
+        for pair in origins.windows(2) {
+            assert_that!(pair[0], ne pair[1]);
+        }
+    }
+
+    #[conformance_test]
+    pub fn weighted_fair_receive_policy_serves_clients_according_to_weight<Sut: Service>() {
+        const NUMBER_OF_REQUESTS: usize = 4;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = fair_queuing_service(&node, NUMBER_OF_REQUESTS);
+
+        let client_a = service.client_builder().create().unwrap();
+        let client_b = service.client_builder().create().unwrap();
+        let heavy_client = client_a.id();
+        let sut = service
+            .server_builder()
+            .receive_policy(ReceivePolicy::WeightedFair)
+            .set_client_weight_handler(move |id| if *id == heavy_client { 2 } else { 1 })
+            .create()
+            .unwrap();
+
+        let mut pending_responses = vec![];
+        for n in 0..NUMBER_OF_REQUESTS as u64 {
+            pending_responses.push(client_a.send_copy(n).unwrap());
+            pending_responses.push(client_b.send_copy(n).unwrap());
+        }
+
+        let origins = received_origins(&sut, 6);
+        let served_heavy = origins.iter().filter(|id| **id == heavy_client).count();
+        assert_that!(served_heavy, eq 4);
+        assert_that!(origins.iter().filter(|id| **id == client_b.id()).count(), eq 2);
+    }
+
+    #[conformance_test]
+    pub fn priority_receive_policy_serves_highest_weight_first<Sut: Service>() {
+        const NUMBER_OF_REQUESTS: usize = 3;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service = fair_queuing_service(&node, NUMBER_OF_REQUESTS);
+
+        let client_low = service.client_builder().create().unwrap();
+        let client_high = service.client_builder().create().unwrap();
+        let high_priority_client = client_high.id();
+        let sut = service
+            .server_builder()
+            .receive_policy(ReceivePolicy::Priority)
+            .set_client_weight_handler(move |id| if *id == high_priority_client { 5 } else { 1 })
+            .create()
+            .unwrap();
+
+        let mut pending_responses = vec![];
+        for n in 0..NUMBER_OF_REQUESTS as u64 {
+            pending_responses.push(client_low.send_copy(n).unwrap());
+            pending_responses.push(client_high.send_copy(n).unwrap());
+        }
+
+        let origins = received_origins(&sut, 2 * NUMBER_OF_REQUESTS);
+        for (n, origin) in origins.iter().enumerate() {
+            if n < NUMBER_OF_REQUESTS {
+                assert_that!(*origin, eq high_priority_client);
+            } else {
+                assert_that!(*origin, eq client_low.id());
+            }
+        }
+    }
 }
@@ -1042,6 +1042,48 @@ pub mod service {
         assert_that!(service_counter, eq 1);
     }
 
+    #[conformance_test]
+    pub fn list_services_contains_node_that_is_attached_to_multiple_services<
+        Sut: Service,
+        Factory: SutFactory<Sut>,
+    >() {
+        const NUMBER_OF_SERVICES: usize = 8;
+        let test = Factory::new();
+        let node = test.context().create_node();
+
+        let mut services = vec![];
+        let mut service_hashs = vec![];
+        for _ in 0..NUMBER_OF_SERVICES {
+            let service_name = generate_service_name();
+            let sut = test
+                .create(&node, &service_name, &AttributeSpecifier::new())
+                .unwrap();
+
+            service_hashs.push(*sut.service_hash());
+            services.push(sut);
+        }
+
+        let mut number_of_services_with_node = 0;
+        let result = Sut::list(test.context().config(), |service| {
+            if !service_hashs.contains(service.static_details.service_hash()) {
+                return CallbackProgression::Continue;
+            }
+
+            assert_that!(service.dynamic_details, is_some);
+            let dynamic_details = service.dynamic_details.unwrap();
+            if dynamic_details
+                .nodes
+                .iter()
+                .any(|node_state| node_state.node_id() == node.id())
+            {
+                number_of_services_with_node += 1;
+            }
+            CallbackProgression::Continue
+        });
+        assert_that!(result, is_ok);
+        assert_that!(number_of_services_with_node, eq NUMBER_OF_SERVICES);
+    }
+
     #[cfg(not(target_os = "windows"))]
     // disabled since the windows defender interfers and causes ERROR_ACCESS_DENIED failures on the platform when it locks file for scanning
     #[conformance_test]
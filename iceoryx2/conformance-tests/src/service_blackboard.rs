@@ -20,11 +20,12 @@ pub mod service_blackboard {
     use alloc::{format, vec, vec::Vec};
     use core::alloc::Layout;
     use core::ptr::copy_nonoverlapping;
-    use iceoryx2::constants::MAX_BLACKBOARD_KEY_SIZE;
+    use iceoryx2::constants::{BLACKBOARD_CACHE_LINE_SIZE, MAX_BLACKBOARD_KEY_SIZE};
     use iceoryx2::port::reader::*;
     use iceoryx2::port::writer::*;
     use iceoryx2::prelude::*;
     use iceoryx2::service::Service;
+    use iceoryx2::service::blackboard_snapshot::BlackboardSnapshot;
     use iceoryx2::service::builder::CustomKeyMarker;
     use iceoryx2::service::builder::blackboard::{
         BlackboardCreateError, BlackboardOpenError, KeyMemory, KeyMemoryError,
@@ -1635,6 +1636,206 @@ pub mod service_blackboard {
         }
     }
 
+    #[conformance_test]
+    pub fn snapshot_observes_committed_transaction<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u32>(0, 1)
+            .add::<i64>(1, -1)
+            .create()
+            .unwrap();
+
+        let mut writer = sut.writer_builder().create().unwrap();
+        let reader = sut.reader_builder().create().unwrap();
+        let entry_handle_mut_0 = writer.entry::<u32>(&0).unwrap();
+        let entry_handle_mut_1 = writer.entry::<i64>(&1).unwrap();
+        let entry_handle_0 = reader.entry::<u32>(&0).unwrap();
+        let entry_handle_1 = reader.entry::<i64>(&1).unwrap();
+
+        let transaction = writer.transaction();
+        transaction.update_with_copy(&entry_handle_mut_0, 2);
+        transaction.update_with_copy(&entry_handle_mut_1, -2);
+        transaction.commit();
+
+        let values = reader.snapshot(|| (*entry_handle_0.get(), *entry_handle_1.get()));
+        assert_that!(values, eq(2, -2));
+
+        // dropping a transaction commits it as well
+        {
+            let transaction = writer.transaction();
+            transaction.update_with_copy(&entry_handle_mut_0, 3);
+        }
+
+        let values = reader.snapshot(|| (*entry_handle_0.get(), *entry_handle_1.get()));
+        assert_that!(values, eq(3, -2));
+    }
+
+    #[conformance_test]
+    pub fn concurrent_snapshots_never_observe_partial_transactions<S: Service>() {
+        const NUMBER_OF_SNAPSHOTS: usize = 1000;
+        let test = Test::<S>::new();
+        let node = test.create_node();
+        let number_of_readers = (SystemInfo::NumberOfCpuCores.value()).clamp(2, 4);
+
+        let handle = BarrierHandle::new();
+        let barrier = BarrierBuilder::new((number_of_readers + 1) as _)
+            .create(&handle)
+            .unwrap();
+        let service_name = generate_service_name();
+        let _sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u64>(0, 0)
+            .add::<u64>(1, 0)
+            .create()
+            .unwrap();
+
+        let finished_readers = AtomicU64::new(0);
+
+        thread_scope(|s| {
+            s.thread_builder().spawn(|| {
+                let sut = node
+                    .service_builder(&service_name)
+                    .blackboard_opener::<u64>()
+                    .open()
+                    .unwrap();
+                let mut writer = sut.writer_builder().create().unwrap();
+                let entry_handle_mut_0 = writer.entry::<u64>(&0).unwrap();
+                let entry_handle_mut_1 = writer.entry::<u64>(&1).unwrap();
+
+                barrier.wait();
+
+                let mut counter = 0;
+                while finished_readers.load(Ordering::Relaxed) < number_of_readers as u64 {
+                    counter += 1;
+                    let transaction = writer.transaction();
+                    transaction.update_with_copy(&entry_handle_mut_0, counter);
+                    transaction.update_with_copy(&entry_handle_mut_1, counter);
+                    transaction.commit();
+                }
+            })?;
+
+            for _ in 0..number_of_readers {
+                s.thread_builder().spawn(|| {
+                    let sut = node
+                        .service_builder(&service_name)
+                        .blackboard_opener::<u64>()
+                        .open()
+                        .unwrap();
+                    let reader = sut.reader_builder().create().unwrap();
+                    let entry_handle_0 = reader.entry::<u64>(&0).unwrap();
+                    let entry_handle_1 = reader.entry::<u64>(&1).unwrap();
+                    barrier.wait();
+
+                    for _ in 0..NUMBER_OF_SNAPSHOTS {
+                        let (value_0, value_1) =
+                            reader.snapshot(|| (*entry_handle_0.get(), *entry_handle_1.get()));
+                        assert_that!(value_0, eq value_1);
+                    }
+                    finished_readers.fetch_add(1, Ordering::Relaxed);
+                })?;
+            }
+
+            Ok(())
+        })
+        .unwrap();
+    }
+
+    #[conformance_test]
+    pub fn history_contains_latest_values_starting_with_the_most_recent<Sut: Service>() {
+        const HISTORY_DEPTH: usize = 3;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add_with_history::<u64>(0, 0, HISTORY_DEPTH)
+            .create()
+            .unwrap();
+
+        let writer = sut.writer_builder().create().unwrap();
+        let reader = sut.reader_builder().create().unwrap();
+        let entry_handle_mut = writer.entry::<u64>(&0).unwrap();
+        let entry_handle = reader.entry::<u64>(&0).unwrap();
+
+        assert_that!(entry_handle.history_depth(), eq HISTORY_DEPTH);
+        let history: Vec<_> = entry_handle.history(HISTORY_DEPTH).collect();
+        assert_that!(history, len 1);
+        assert_that!(*history[0], eq 0);
+        assert_that!(history[0].generation_counter(), eq entry_handle.get().generation_counter());
+
+        for value in 1..=5 {
+            entry_handle_mut.update_with_copy(value);
+        }
+
+        let history: Vec<_> = entry_handle.history(2 * HISTORY_DEPTH).collect();
+        assert_that!(history, len HISTORY_DEPTH);
+        for (i, value) in history.iter().enumerate() {
+            assert_that!(**value, eq 5 - i as u64);
+        }
+        assert_that!(entry_handle.is_up_to_date(&history[0]), eq true);
+        assert_that!(entry_handle.is_up_to_date(&history[1]), eq false);
+
+        let history: Vec<_> = entry_handle.history(1).map(|v| *v).collect();
+        assert_that!(history, eq vec![5]);
+    }
+
+    #[conformance_test]
+    pub fn history_records_zero_copy_updates<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add_with_history::<i32>(0, -1, 4)
+            .create()
+            .unwrap();
+
+        let writer = sut.writer_builder().create().unwrap();
+        let reader = sut.reader_builder().create().unwrap();
+        let entry_handle_mut = writer.entry::<i32>(&0).unwrap();
+        let entry_handle = reader.entry::<i32>(&0).unwrap();
+
+        let entry_handle_mut = entry_handle_mut.loan_uninit().update_with_copy(7);
+        let mut entry_value_uninit = entry_handle_mut.loan_uninit();
+        entry_value_uninit.value_mut().write(8);
+        let _entry_handle_mut = unsafe { entry_value_uninit.assume_init_and_update() };
+
+        let history: Vec<_> = entry_handle.history(4).map(|v| *v).collect();
+        assert_that!(history, eq vec![8, 7, -1]);
+    }
+
+    #[conformance_test]
+    pub fn entry_without_history_has_empty_history<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u64>(0, 0)
+            .add_with_history::<u64>(1, 0, 0)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        for key in 0..2 {
+            let entry_handle = reader.entry::<u64>(&key).unwrap();
+            assert_that!(entry_handle.history_depth(), eq 0);
+            assert_that!(entry_handle.history(1).count(), eq 0);
+        }
+    }
+
     #[conformance_test]
     pub fn entry_handle_is_up_to_date_works_correctly<Sut: Service>() {
         let test = Test::<Sut>::new();
@@ -1668,6 +1869,259 @@ pub mod service_blackboard {
         assert_that!(entry_handle.is_up_to_date(&value), eq true);
     }
 
+    #[conformance_test]
+    pub fn cache_line_aligned_entries_do_not_share_a_cache_line<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .cache_line_aligned_entries(true)
+            .add::<u8>(0, 1)
+            .add::<u8>(1, 2)
+            .add::<u64>(2, 3)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let writer = sut.writer_builder().create().unwrap();
+
+        let entry_ids = [
+            reader.entry::<u8>(&0).unwrap().entry_id().as_value(),
+            reader.entry::<u8>(&1).unwrap().entry_id().as_value(),
+            reader.entry::<u64>(&2).unwrap().entry_id().as_value(),
+        ];
+        for pair in entry_ids.windows(2) {
+            assert_that!(pair[1] - pair[0], ge BLACKBOARD_CACHE_LINE_SIZE);
+            assert_that!((pair[1] - pair[0]) % BLACKBOARD_CACHE_LINE_SIZE, eq 0);
+        }
+
+        writer.entry::<u8>(&1).unwrap().update_with_copy(5);
+        assert_that!(*reader.entry::<u8>(&0).unwrap().get(), eq 1);
+        assert_that!(*reader.entry::<u8>(&1).unwrap().get(), eq 5);
+        assert_that!(*reader.entry::<u64>(&2).unwrap().get(), eq 3);
+    }
+
+    #[conformance_test]
+    pub fn blackboard_can_be_restored_from_snapshot<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u8>(0, 1)
+            .add::<u64>(1, 2)
+            .create()
+            .unwrap();
+        let writer = sut.writer_builder().create().unwrap();
+        writer.entry::<u8>(&0).unwrap().update_with_copy(5);
+        writer.entry::<u64>(&1).unwrap().update_with_copy(6);
+
+        let snapshot = sut.reader_builder().create().unwrap().create_snapshot();
+        assert_that!(snapshot, len 2);
+        let snapshot = BlackboardSnapshot::from_bytes(&snapshot.to_bytes().unwrap()).unwrap();
+        drop(writer);
+        drop(sut);
+
+        // the entries are added in a different order and entry 2 is not in the snapshot
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u64>(2, 3)
+            .add::<u64>(1, 0)
+            .add::<u8>(0, 0)
+            .restore_from_snapshot(snapshot)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        assert_that!(*reader.entry::<u8>(&0).unwrap().get(), eq 5);
+        assert_that!(*reader.entry::<u64>(&1).unwrap().get(), eq 6);
+        assert_that!(*reader.entry::<u64>(&2).unwrap().get(), eq 3);
+    }
+
+    #[conformance_test]
+    pub fn entries_with_string_keys_can_be_found<Sut: Service>() {
+        const NUMBER_OF_ENTRIES: usize = 64;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let key = |i: usize| StaticString::<16>::try_from(format!("param/{i}").as_str()).unwrap();
+
+        let mut sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<StaticString<16>>();
+        for i in 0..NUMBER_OF_ENTRIES {
+            sut = sut.add::<u64>(key(i), i as u64);
+        }
+        let sut = sut.create().unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let writer = sut.writer_builder().create().unwrap();
+        for i in 0..NUMBER_OF_ENTRIES {
+            assert_that!(*reader.entry::<u64>(&key(i)).unwrap().get(), eq i as u64);
+            assert_that!(writer.entry::<u64>(&key(i)), is_ok);
+        }
+
+        let missing_key = StaticString::<16>::try_from("param/missing").unwrap();
+        assert_that!(reader.entry::<u64>(&missing_key).err(), eq Some(EntryHandleError::EntryDoesNotExist));
+        assert_that!(writer.entry::<u64>(&missing_key).err(), eq Some(EntryHandleMutError::EntryDoesNotExist));
+    }
+
+    #[conformance_test]
+    pub fn writer_with_update_notifier_notifies_entry_id_on_update<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u32>(0, 0)
+            .add::<u32>(1, 0)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let entry_id_0 = reader.entry::<u32>(&0).unwrap().entry_id();
+        let entry_id_1 = reader.entry::<u32>(&1).unwrap().entry_id();
+
+        let event_service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .event_id_max_value(entry_id_0.as_value().max(entry_id_1.as_value()))
+            .create()
+            .unwrap();
+        let listener = event_service.listener_builder().create().unwrap();
+        let notifier = event_service.notifier_builder().create().unwrap();
+
+        let writer = sut
+            .writer_builder()
+            .notify_on_update(notifier)
+            .create()
+            .unwrap();
+        let entry_handle_mut = writer.entry::<u32>(&1).unwrap();
+
+        let mut received_events = 0;
+        let mut collect_events = || {
+            listener
+                .try_wait(|event| {
+                    received_events += event.count;
+                    assert_that!(event.id, eq entry_id_1);
+                })
+                .unwrap();
+        };
+
+        entry_handle_mut.update_with_copy(1);
+        collect_events();
+
+        let entry_handle_mut = entry_handle_mut.loan_uninit().update_with_copy(2);
+        collect_events();
+
+        // a discarded update is not notified
+        let _entry_handle_mut = entry_handle_mut.loan_uninit().discard();
+        collect_events();
+
+        assert_that!(received_events, eq 2);
+    }
+
+    #[conformance_test]
+    pub fn writer_without_update_notifier_does_not_notify<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u32>(0, 0)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let entry_id = reader.entry::<u32>(&0).unwrap().entry_id();
+
+        let event_service = node
+            .service_builder(&generate_service_name())
+            .event()
+            .event_id_max_value(entry_id.as_value())
+            .create()
+            .unwrap();
+        let listener = event_service.listener_builder().create().unwrap();
+        let _notifier = event_service.notifier_builder().create().unwrap();
+
+        let writer = sut.writer_builder().create().unwrap();
+        writer.entry::<u32>(&0).unwrap().update_with_copy(1);
+
+        let mut received_events = 0;
+        listener
+            .try_wait(|event| received_events += event.count)
+            .unwrap();
+        assert_that!(received_events, eq 0);
+    }
+
+    #[conformance_test]
+    pub fn entry_handle_group_copies_only_changed_values<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u32>(0, 10)
+            .add::<u32>(1, 11)
+            .add::<u32>(2, 12)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let mut group = reader.entry_handle_group::<u32>(&[2, 0]).unwrap();
+        let writer = sut.writer_builder().create().unwrap();
+        let entry_handle_mut = writer.entry::<u32>(&0).unwrap();
+        assert_that!(group.len(), eq 2);
+
+        let mut values = [0; 2];
+        assert_that!(group.update(&mut values), eq 2);
+        assert_that!(values, eq [12, 10]);
+        assert_that!(group.has_changed(0), eq true);
+        assert_that!(group.has_changed(1), eq true);
+
+        assert_that!(group.update(&mut values), eq 0);
+        assert_that!(group.changed_entries()[0], eq 0);
+
+        entry_handle_mut.update_with_copy(20);
+        values = [0; 2];
+        assert_that!(group.update(&mut values), eq 1);
+        assert_that!(values, eq [0, 20]);
+        assert_that!(group.has_changed(0), eq false);
+        assert_that!(group.has_changed(1), eq true);
+        assert_that!(group.changed_entries()[0], eq 0b10);
+    }
+
+    #[conformance_test]
+    pub fn entry_handle_group_creation_fails_when_one_key_does_not_exist<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .blackboard_creator::<u64>()
+            .add::<u32>(0, 0)
+            .create()
+            .unwrap();
+
+        let reader = sut.reader_builder().create().unwrap();
+        let group = reader.entry_handle_group::<u32>(&[0, 1]);
+        assert_that!(group.err(), eq Some(EntryHandleError::EntryDoesNotExist));
+    }
+
     #[conformance_test]
     pub fn list_keys_works<S: Service>() {
         let test = Test::<S>::new();
@@ -736,6 +736,237 @@ pub mod service_event {
         assert_that!(result.err().unwrap(), eq NotifierNotifyError::EventIdOutOfBounds);
     }
 
+    #[conformance_test]
+    pub fn notify_multiple_delivers_all_event_ids<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        let event_ids = [EventId::new(3), EventId::new(5), EventId::new(11)];
+        assert_that!(notifier.notify_multiple(&event_ids).unwrap(), eq 1);
+
+        let mut received_ids = [false; 12];
+        let number_of_notifications = listener
+            .try_wait(|event| {
+                received_ids[event.id.as_value()] = true;
+            })
+            .unwrap();
+        assert_that!(number_of_notifications, eq 3);
+        for event_id in event_ids {
+            assert_that!(received_ids[event_id.as_value()], eq true);
+        }
+    }
+
+    #[conformance_test]
+    pub fn notify_multiple_with_out_of_bounds_event_id_notifies_nobody<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        const EVENT_ID_MAX_VALUE: usize = 8;
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .event_id_max_value(EVENT_ID_MAX_VALUE)
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        let result =
+            notifier.notify_multiple(&[EventId::new(1), EventId::new(EVENT_ID_MAX_VALUE + 1)]);
+        assert_that!(result.err(), eq Some(NotifierNotifyError::EventIdOutOfBounds));
+        assert_that!(listener.try_wait(|_| {}).unwrap(), eq 0);
+    }
+
+    #[conformance_test]
+    pub fn notify_with_value_delivers_the_latest_value<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        assert_that!(notifier.notify_with_value(EventId::new(3), 1234).unwrap(), eq 1);
+        assert_that!(notifier.notify_with_value(EventId::new(5), 17).unwrap(), eq 1);
+        assert_that!(notifier.notify_with_value(EventId::new(5), 42).unwrap(), eq 1);
+
+        let mut received_values = [0; 6];
+        let mut received_counts = [0; 6];
+        listener
+            .try_wait(|event| {
+                received_values[event.id.as_value()] = event.value;
+                received_counts[event.id.as_value()] = event.count;
+            })
+            .unwrap();
+        assert_that!(received_values[3], eq 1234);
+        assert_that!(received_values[5], eq 42);
+        assert_that!(received_counts[5], eq 2);
+    }
+
+    #[conformance_test]
+    pub fn notify_with_out_of_bounds_event_id_and_value_fails<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        const EVENT_ID_MAX_VALUE: usize = 8;
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .event_id_max_value(EVENT_ID_MAX_VALUE)
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut.notifier_builder().create().unwrap();
+
+        let result = notifier.notify_with_value(EventId::new(EVENT_ID_MAX_VALUE + 1), 5);
+        assert_that!(result.err(), eq Some(NotifierNotifyError::EventIdOutOfBounds));
+        assert_that!(listener.try_wait(|_| {}).unwrap(), eq 0);
+    }
+
+    #[conformance_test]
+    pub fn notifications_within_coalescing_window_are_merged<Sut: Service>() {
+        const COALESCING_WINDOW: Duration = Duration::from_secs(3600);
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut
+            .notifier_builder()
+            .coalescing_window(COALESCING_WINDOW)
+            .create()
+            .unwrap();
+
+        assert_that!(notifier.coalescing_window(), eq Some(COALESCING_WINDOW));
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(1)).unwrap(), eq 1);
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(2)).unwrap(), eq 0);
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(3)).unwrap(), eq 0);
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(2)).unwrap(), eq 0);
+        assert_that!(notifier.has_pending_notifications(), eq true);
+
+        let mut received_ids = vec![];
+        listener
+            .try_wait(|event| received_ids.push(event.id))
+            .unwrap();
+        assert_that!(received_ids, eq vec![EventId::new(1)]);
+
+        assert_that!(notifier.deliver_pending_notifications().unwrap(), eq 1);
+        assert_that!(notifier.has_pending_notifications(), eq false);
+
+        let mut received_ids = vec![];
+        listener
+            .try_wait(|event| received_ids.push(event.id))
+            .unwrap();
+        received_ids.sort();
+        assert_that!(received_ids, eq vec![EventId::new(2), EventId::new(3)]);
+    }
+
+    #[conformance_test]
+    pub fn pending_notifications_are_delivered_after_coalescing_window<Sut: Service>() {
+        const COALESCING_WINDOW: Duration = Duration::from_millis(10);
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut
+            .notifier_builder()
+            .coalescing_window(COALESCING_WINDOW)
+            .create()
+            .unwrap();
+
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(1)).unwrap(), eq 1);
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(2)).unwrap(), eq 0);
+
+        nanosleep(COALESCING_WINDOW).unwrap();
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(3)).unwrap(), eq 1);
+
+        let mut received_ids = vec![];
+        listener
+            .try_wait(|event| received_ids.push(event.id))
+            .unwrap();
+        received_ids.sort();
+        assert_that!(received_ids, eq vec![EventId::new(1), EventId::new(2), EventId::new(3)]);
+    }
+
+    #[conformance_test]
+    pub fn pending_notifications_are_delivered_when_notifier_is_dropped<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .create()
+            .unwrap();
+        let listener = sut.listener_builder().create().unwrap();
+        let notifier = sut
+            .notifier_builder()
+            .coalescing_window(Duration::from_secs(3600))
+            .create()
+            .unwrap();
+
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(1)).unwrap(), eq 1);
+        assert_that!(notifier.notify_with_custom_event_id(EventId::new(2)).unwrap(), eq 0);
+        drop(notifier);
+
+        let mut received_ids = vec![];
+        listener
+            .try_wait(|event| received_ids.push(event.id))
+            .unwrap();
+        received_ids.sort();
+        assert_that!(received_ids, eq vec![EventId::new(1), EventId::new(2)]);
+    }
+
+    #[conformance_test]
+    pub fn coalescing_window_is_limited_by_deadline<Sut: Service>() {
+        const DEADLINE: Duration = Duration::from_millis(50);
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .event()
+            .deadline(DEADLINE)
+            .create()
+            .unwrap();
+        let notifier = sut
+            .notifier_builder()
+            .coalescing_window(Duration::from_secs(3600))
+            .create()
+            .unwrap();
+
+        assert_that!(notifier.coalescing_window(), eq Some(DEADLINE));
+    }
+
     #[conformance_test]
     pub fn concurrent_reconnecting_notifier_can_trigger_waiting_listener<Sut: Service>() {
         let test = Test::<Sut>::new_with_custom_watchdog(Watchdog::new_with_timeout(
@@ -19,6 +19,7 @@ pub mod service_publish_subscribe {
     use core::time::Duration;
 
     use iceoryx2::config::Config;
+    use iceoryx2::identifiers::UniquePortId;
     use iceoryx2::port::publisher::PublisherCreateError;
     use iceoryx2::port::subscriber::SubscriberCreateError;
     use iceoryx2::port::update_connections::UpdateConnections;
@@ -36,7 +37,7 @@ pub mod service_publish_subscribe {
     use iceoryx2_bb_elementary::CallbackProgression;
     use iceoryx2_bb_elementary::alignment::Alignment;
     use iceoryx2_bb_posix::barrier::{BarrierBuilder, BarrierHandle};
-    use iceoryx2_bb_posix::clock::{Time, nanosleep};
+    use iceoryx2_bb_posix::clock::{ClockType, Time, nanosleep};
     use iceoryx2_bb_posix::ipc_capable::Handle;
     use iceoryx2_bb_posix::mutex::{MutexBuilder, MutexHandle};
     use iceoryx2_bb_posix::thread::thread_scope;
@@ -1868,6 +1869,39 @@ pub mod service_publish_subscribe {
         assert_that!(elapsed_blocking_time, time_at_least(TIMEOUT));
     }
 
+    #[conformance_test]
+    pub fn publisher_with_backpressure_handler_reports_buffer_fill_level<Sut: Service>() {
+        const SAFE_OVERFLOW: bool = false;
+        const EXPECTED_SECOND_SEND_RESULT: Result<usize, SendError> = Ok(1);
+        const EXPECTED_RECEIVE_VALUE_SUBSCRIBER_1: Option<usize> = Some(VALUE_FIRST_SAMPLE);
+        const EXPECTED_RECEIVE_VALUE_SUBSCRIBER_2: Option<usize> = Some(VALUE_SECOND_SAMPLE);
+
+        let buffer_size = Arc::new(AtomicU64::new(0));
+        let number_of_buffered_samples = Arc::new(AtomicU64::new(0));
+
+        publisher_with_backpressure_handler::<Sut, _>(
+            SAFE_OVERFLOW,
+            |publisher_port_factory| {
+                publisher_port_factory.set_backpressure_handler({
+                    let buffer_size = buffer_size.clone();
+                    let number_of_buffered_samples = number_of_buffered_samples.clone();
+                    move |info| {
+                        buffer_size.store(info.buffer_size as u64, Ordering::Relaxed);
+                        number_of_buffered_samples
+                            .store(info.number_of_buffered_samples as u64, Ordering::Relaxed);
+                        BackpressureAction::DiscardData
+                    }
+                })
+            },
+            EXPECTED_SECOND_SEND_RESULT,
+            EXPECTED_RECEIVE_VALUE_SUBSCRIBER_1,
+            EXPECTED_RECEIVE_VALUE_SUBSCRIBER_2,
+        );
+
+        assert_that!(buffer_size.load(Ordering::Relaxed), eq(1));
+        assert_that!(number_of_buffered_samples.load(Ordering::Relaxed), eq(1));
+    }
+
     #[conformance_test]
     pub fn publisher_with_backpressure_handler_discards_ample_and_fails<Sut: Service>() {
         const SAFE_OVERFLOW: bool = false;
@@ -2488,6 +2522,99 @@ pub mod service_publish_subscribe {
         assert_that!(Sut::does_exist(&service_name, test.config(), MessagingPattern::PublishSubscribe).unwrap(), eq false);
     }
 
+    #[conformance_test]
+    pub fn inspect_provides_dynamic_config_without_registering_a_node<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        assert_that!(
+            Sut::inspect(
+                &service_name,
+                test.config(),
+                MessagingPattern::PublishSubscribe
+            )
+            .unwrap(),
+            is_none
+        );
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let _publisher = sut.publisher_builder().create().unwrap();
+        let _subscriber_1 = sut.subscriber_builder().create().unwrap();
+        let _subscriber_2 = sut.subscriber_builder().create().unwrap();
+
+        let inspector = Sut::inspect(
+            &service_name,
+            test.config(),
+            MessagingPattern::PublishSubscribe,
+        )
+        .unwrap()
+        .unwrap();
+        assert_that!(inspector.static_config().service_hash(), eq sut.service_hash());
+        assert_that!(inspector.event(), is_none);
+        let dynamic_config = inspector.publish_subscribe().unwrap();
+        assert_that!(dynamic_config.number_of_publishers(), eq 1);
+        assert_that!(dynamic_config.number_of_subscribers(), eq 2);
+
+        let mut number_of_nodes = 0;
+        inspector.list_node_ids(|_| {
+            number_of_nodes += 1;
+            CallbackProgression::Continue
+        });
+        assert_that!(number_of_nodes, eq 1);
+
+        // the inspector does not keep the service alive
+        drop(_subscriber_2);
+        drop(_subscriber_1);
+        drop(_publisher);
+        drop(sut);
+        assert_that!(Sut::does_exist(&service_name, test.config(), MessagingPattern::PublishSubscribe).unwrap(), eq false);
+    }
+
+    #[conformance_test]
+    pub fn inspect_estimates_the_memory_footprint_of_the_ports<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        let inspector = Sut::inspect(
+            &service_name,
+            test.config(),
+            MessagingPattern::PublishSubscribe,
+        )
+        .unwrap()
+        .unwrap();
+
+        let footprint = inspector.memory_footprint();
+        assert_that!(footprint.dynamic_config, gt 0);
+        assert_that!(footprint.ports, is_empty);
+        assert_that!(footprint.total(), eq footprint.dynamic_config);
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let footprint = inspector.memory_footprint();
+        assert_that!(footprint.ports, len 1);
+        assert_that!(footprint.ports[0].port_id, eq UniquePortId::Publisher(publisher.id()));
+        assert_that!(footprint.ports[0].data_segment, ge core::mem::size_of::<u64>());
+        assert_that!(footprint.connections(), eq 0);
+
+        let _subscriber_1 = sut.subscriber_builder().buffer_size(1).create().unwrap();
+        let connections_with_one_subscriber = inspector.memory_footprint().connections();
+        assert_that!(connections_with_one_subscriber, gt 0);
+
+        let _subscriber_2 = sut.subscriber_builder().buffer_size(1).create().unwrap();
+        let footprint = inspector.memory_footprint();
+        assert_that!(footprint.connections(), eq 2 * connections_with_one_subscriber);
+        assert_that!(footprint.total(), eq footprint.dynamic_config + footprint.data_segments() + footprint.connections());
+    }
+
     #[conformance_test]
     pub fn does_exist_works_many<Sut: Service>() {
         const NUMBER_OF_SERVICES: usize = 8;
@@ -3077,6 +3204,47 @@ pub mod service_publish_subscribe {
         }
     }
 
+    #[conformance_test]
+    pub fn cache_line_aligned_payload_does_not_share_cache_line_with_header<Sut: Service>() {
+        const CACHE_LINE_SIZE: usize = 64;
+        const NUMBER_OF_SAMPLES: usize = 4;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES)
+            .subscriber_max_borrowed_samples(NUMBER_OF_SAMPLES)
+            .payload_alignment(Alignment::new(CACHE_LINE_SIZE).unwrap())
+            .create()
+            .unwrap();
+
+        let publisher = sut.publisher_builder().create().unwrap();
+        let subscriber = sut.subscriber_builder().create().unwrap();
+
+        let mut samples = vec![];
+        for n in 0..NUMBER_OF_SAMPLES {
+            let mut sample = publisher.loan().unwrap();
+            *sample.user_header_mut() = n as u64;
+            sample.write_payload(n as u64 * 7).send().unwrap();
+
+            let recv_sample = subscriber.receive().unwrap().unwrap();
+            let header = recv_sample.header() as *const _ as usize;
+            let user_header = recv_sample.user_header() as *const _ as usize;
+            let payload = recv_sample.payload() as *const _ as usize;
+
+            assert_that!(payload % CACHE_LINE_SIZE, eq 0);
+            assert_that!(header / CACHE_LINE_SIZE, lt payload / CACHE_LINE_SIZE);
+            assert_that!(user_header / CACHE_LINE_SIZE, lt payload / CACHE_LINE_SIZE);
+            assert_that!(*recv_sample.user_header(), eq n as u64);
+            assert_that!(*recv_sample, eq n as u64 * 7);
+            samples.push(recv_sample);
+        }
+    }
+
     #[conformance_test]
     pub fn simple_communication_with_user_header_works<Sut: Service>() {
         let test = Test::<Sut>::new();
@@ -3118,6 +3286,160 @@ pub mod service_publish_subscribe {
         }
     }
 
+    #[conformance_test]
+    pub fn samples_carry_no_send_timestamp_by_default<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+        assert_that!(sut.static_config().has_send_timestamps(), eq false);
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+        publisher.send_copy(9123).unwrap();
+
+        let sample = subscriber.receive().unwrap().unwrap();
+        assert_that!(sample.header().send_timestamp(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn samples_carry_send_timestamp_when_enabled<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_send_timestamps(true)
+            .create()
+            .unwrap();
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        assert_that!(sut2.static_config().has_send_timestamps(), eq true);
+
+        let subscriber = sut2.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        let before_send = Time::now_with_clock(ClockType::Monotonic).unwrap();
+        publisher.send_copy(1).unwrap();
+        let mut sample = publisher.loan().unwrap();
+        *sample.payload_mut() = 2;
+        sample.send().unwrap();
+
+        let mut previous_timestamp = before_send.as_duration();
+        for _ in 0..2 {
+            let sample = subscriber.receive().unwrap().unwrap();
+            let timestamp = sample.header().send_timestamp();
+            assert_that!(timestamp, is_some);
+            let timestamp = timestamp.unwrap();
+            assert_that!(timestamp.clock_type(), eq ClockType::Monotonic);
+            assert_that!(timestamp.as_duration(), ge previous_timestamp);
+            assert_that!(timestamp.elapsed(), is_ok);
+            previous_timestamp = timestamp.as_duration();
+        }
+    }
+
+    #[conformance_test]
+    pub fn samples_with_higher_priority_are_received_first<Sut: Service>() {
+        const BUFFER_SIZE: usize = 4;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .priority_lanes(3)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let sut2 = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .open()
+            .unwrap();
+        assert_that!(sut2.static_config().number_of_priority_lanes(), eq 3);
+
+        let subscriber = sut2.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        let send_with_priority = |value: u64, priority: u8| {
+            let mut sample = publisher.loan().unwrap();
+            *sample.payload_mut() = value;
+            sample.set_priority(priority);
+            sample.send().unwrap();
+        };
+
+        send_with_priority(1, 0);
+        send_with_priority(2, 0);
+        send_with_priority(3, 1);
+        // priorities beyond the number of lanes end up in the highest lane
+        send_with_priority(4, 200);
+        send_with_priority(5, 2);
+        send_with_priority(6, 1);
+
+        let receive = || {
+            let sample = subscriber.receive().unwrap().unwrap();
+            (*sample, sample.header().priority())
+        };
+        assert_that!(receive(), eq(4, 200));
+        assert_that!(receive(), eq(5, 2));
+        assert_that!(receive(), eq(3, 1));
+        assert_that!(receive(), eq(6, 1));
+        assert_that!(receive(), eq(1, 0));
+        assert_that!(receive(), eq(2, 0));
+        assert_that!(subscriber.receive().unwrap(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn every_priority_lane_has_the_buffer_size_of_the_subscriber<Sut: Service>() {
+        const BUFFER_SIZE: usize = 2;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .priority_lanes(2)
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .enable_safe_overflow(true)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().create().unwrap();
+        let publisher = sut.publisher_builder().create().unwrap();
+
+        for n in 0..2 * BUFFER_SIZE as u64 {
+            publisher.send_copy(n).unwrap();
+        }
+        let mut sample = publisher.loan().unwrap();
+        *sample.payload_mut() = 100;
+        sample.set_priority(1);
+        sample.send().unwrap();
+
+        let mut release_batch = subscriber.sample_release_batch(BUFFER_SIZE);
+        let mut received = vec![];
+        while let Some(sample) = subscriber.receive().unwrap() {
+            received.push(*sample);
+            release_batch.push(sample);
+        }
+        release_batch.release();
+
+        assert_that!(received, eq vec![100, 2, 3]);
+    }
+
     #[conformance_test]
     pub fn same_payload_type_but_different_user_header_does_not_connect<Sut: Service>() {
         let test = Test::<Sut>::new();
@@ -3638,6 +3960,13 @@ pub mod service_publish_subscribe {
         send_and_receives_increasing_samples_works::<Sut>(AllocationStrategy::PowerOfTwo);
     }
 
+    #[conformance_test]
+    pub fn send_and_receives_increasing_samples_works_for_size_classes_allocation_strategy<
+        Sut: Service,
+    >() {
+        send_and_receives_increasing_samples_works::<Sut>(AllocationStrategy::SizeClasses);
+    }
+
     fn send_and_receives_increasing_samples_with_overflow_works<Sut: Service>(
         allocation_strategy: AllocationStrategy,
     ) {
@@ -3707,6 +4036,15 @@ pub mod service_publish_subscribe {
         );
     }
 
+    #[conformance_test]
+    pub fn send_and_receives_increasing_samples_with_overflow_for_size_classes_allocation_strategy<
+        Sut: Service,
+    >() {
+        send_and_receives_increasing_samples_with_overflow_works::<Sut>(
+            AllocationStrategy::SizeClasses,
+        );
+    }
+
     fn deliver_history_with_increasing_samples_works<Sut: Service>(
         allocation_strategy: AllocationStrategy,
     ) {
@@ -3773,6 +4111,13 @@ pub mod service_publish_subscribe {
         deliver_history_with_increasing_samples_works::<Sut>(AllocationStrategy::PowerOfTwo);
     }
 
+    #[conformance_test]
+    pub fn deliver_history_with_increasing_samples_works_for_size_classes_allocation_strategy<
+        Sut: Service,
+    >() {
+        deliver_history_with_increasing_samples_works::<Sut>(AllocationStrategy::SizeClasses);
+    }
+
     #[conformance_test]
     pub fn does_not_leak_when_subscriber_has_smaller_buffer_size_than_history_size<Sut: Service>() {
         let _watchdog = Watchdog::new();
@@ -4022,6 +4367,57 @@ pub mod service_publish_subscribe {
         assert_that!(recv_res, is_ok);
     }
 
+    #[conformance_test]
+    pub fn publisher_with_backpressure_wake_up_is_woken_up_by_receiving_subscriber<Sut: Service>() {
+        const TIMEOUT: Duration = Duration::from_millis(25);
+        const WAKE_UP_TIMEOUT: Duration = Duration::from_secs(60);
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+
+        let sut = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_safe_overflow(false)
+            .subscriber_max_buffer_size(1)
+            .history_size(0)
+            .create()
+            .unwrap();
+
+        let subscriber = sut.subscriber_builder().buffer_size(1).create().unwrap();
+
+        thread_scope(|s| {
+            let buffer_full_handle = BarrierHandle::new();
+            let buffer_full_barrier = BarrierBuilder::new(2).create(&buffer_full_handle).unwrap();
+
+            s.thread_builder().spawn(|| {
+                let publisher = sut
+                    .publisher_builder()
+                    .backpressure_strategy(BackpressureStrategy::RetryUntilDelivered)
+                    .backpressure_wake_up(WAKE_UP_TIMEOUT)
+                    .create()
+                    .unwrap();
+
+                assert_that!(publisher.send_copy(1), is_ok);
+                buffer_full_barrier.wait();
+
+                let start = Time::now().unwrap();
+                assert_that!(publisher.send_copy(2), is_ok);
+                assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+                assert_that!(start.elapsed().unwrap(), lt WAKE_UP_TIMEOUT);
+            })?;
+
+            buffer_full_barrier.wait();
+            nanosleep(TIMEOUT).unwrap();
+            assert_that!(*subscriber.receive().unwrap().unwrap(), eq 1);
+
+            Ok(())
+        })
+        .unwrap();
+
+        assert_that!(*subscriber.receive().unwrap().unwrap(), eq 2);
+    }
+
     #[conformance_test]
     pub fn subscriber_created_first_receives_first_sample_when_safe_overflow_is_disabled<
         Sut: Service,
@@ -16,15 +16,30 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 #[conformance_tests]
 pub mod subscriber {
     use alloc::collections::BTreeSet;
+    use alloc::sync::Arc;
     use alloc::{format, vec};
-    use iceoryx2::port::ReceiveError;
+    use core::time::Duration;
+    use iceoryx2::port::content_filter::ContentFilter;
+    use iceoryx2::port::delivery_mode::DeliveryMode;
+    use iceoryx2::port::subscriber::SpinPolicy;
+    use iceoryx2::port::subscriber::SubscriberResizeBufferError;
+    use iceoryx2::port::update_connections::UpdateConnections;
+    use iceoryx2::port::{ReceiveError, SampleLossInfo};
+    use iceoryx2::prelude::{CallbackProgression, WaitSetBuilder};
     use iceoryx2::{
         port::port_name::PortName, port::subscriber::SubscriberCreateError, service::Service,
     };
+    use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering};
+    use iceoryx2_bb_posix::clock::{Time, nanosleep};
+    use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
     use iceoryx2_bb_testing::assert_that;
     use iceoryx2_bb_testing_macros::conformance_test;
+    use iceoryx2_cal::event::Event;
+    use iceoryx2_cal::event::event_state::counting_bit_set::RelocatableCountingBitSet;
     use iceoryx2_testing::*;
 
+    const TIMEOUT: Duration = Duration::from_millis(25);
+
     #[conformance_test]
     pub fn receive_error_display_works<S: Service>() {
         assert_that!(
@@ -63,6 +78,463 @@ pub mod subscriber {
         }
     }
 
+    #[conformance_test]
+    pub fn receive_blocking_returns_sample_that_was_sent<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service.subscriber_builder().create()?;
+
+        publisher.send_copy(8127)?;
+
+        let sample = sut.receive_blocking(TIMEOUT, SpinPolicy::default())?;
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 8127);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn receive_blocking_without_samples_returns_none_after_timeout<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let _publisher = service.publisher_builder().create()?;
+        let sut = service.subscriber_builder().create()?;
+
+        let start = Time::now().unwrap();
+        let sample = sut.receive_blocking(TIMEOUT, SpinPolicy::no_spin())?;
+        assert_that!(sample, is_none);
+        assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn receive_blocking_with_wake_up_waits_on_wake_up_channel<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service.subscriber_builder().enable_wake_up(true).create()?;
+
+        let start = Time::now().unwrap();
+        let sample = sut.receive_blocking(TIMEOUT, SpinPolicy::no_spin())?;
+        assert_that!(sample, is_none);
+        assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+
+        publisher.send_copy(2981)?;
+
+        let sample = sut.receive_blocking(TIMEOUT, SpinPolicy::no_spin())?;
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 2981);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_fifo_delivery_mode_receives_all_samples_in_order<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: u64 = 4;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service
+            .subscriber_builder()
+            .delivery_mode(DeliveryMode::Fifo)
+            .create()?;
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(i)?;
+        }
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+        assert_that!(sut.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_lazily_mapped_data_segments_receives_samples_after_idle_time<
+        Sut: Service,
+    >() -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: u64 = 3;
+        let mut test = Test::<Sut>::new();
+        test.config_mut().global.lazy_data_segment_mapping = true;
+        test.config_mut().global.data_segment_idle_timeout = Some(TIMEOUT);
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()?;
+
+        let sut = service.subscriber_builder().create()?;
+        let publisher = service.publisher_builder().create()?;
+        assert_that!(sut.receive()?, is_none);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(i)?;
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+
+            nanosleep(TIMEOUT * 2).unwrap();
+            // unmaps the data segment of the idle publisher
+            assert_that!(sut.receive()?, is_none);
+        }
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn sample_release_batch_releases_samples_when_capacity_is_reached<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const MAX_BORROWED_SAMPLES: usize = 4;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .max_publishers(2)
+            .subscriber_max_buffer_size(2 * MAX_BORROWED_SAMPLES)
+            .subscriber_max_borrowed_samples(MAX_BORROWED_SAMPLES)
+            .create()?;
+
+        let publisher_1 = service.publisher_builder().create()?;
+        let publisher_2 = service.publisher_builder().create()?;
+        let sut = service.subscriber_builder().create()?;
+        let mut release_batch = sut.sample_release_batch(MAX_BORROWED_SAMPLES + 1);
+        assert_that!(release_batch.capacity(), eq MAX_BORROWED_SAMPLES + 1);
+
+        for i in 0..MAX_BORROWED_SAMPLES as u64 {
+            publisher_1.send_copy(i)?;
+            publisher_2.send_copy(i)?;
+        }
+
+        for _ in 0..MAX_BORROWED_SAMPLES {
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            release_batch.push(sample.unwrap());
+        }
+        assert_that!(release_batch, len MAX_BORROWED_SAMPLES);
+
+        let result = sut.receive();
+        assert_that!(result.err(), eq Some(ReceiveError::ExceedsMaxBorrows));
+
+        release_batch.release();
+        assert_that!(release_batch, is_empty);
+
+        for _ in 0..MAX_BORROWED_SAMPLES {
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            release_batch.push(sample.unwrap());
+        }
+        drop(release_batch);
+
+        for _ in 0..MAX_BORROWED_SAMPLES as u64 {
+            publisher_1.send_copy(0)?;
+            publisher_2.send_copy(0)?;
+        }
+        assert_that!(sut.receive()?, is_some);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_latest_only_delivery_mode_receives_only_newest_sample<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const BUFFER_SIZE: usize = 4;
+        const NUMBER_OF_ITERATIONS: u64 = 10;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .enable_safe_overflow(true)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service
+            .subscriber_builder()
+            .delivery_mode(DeliveryMode::LatestOnly)
+            .create()?;
+
+        assert_that!(sut.receive()?, is_none);
+
+        // the skipped samples must be returned to the publisher, otherwise it would run out
+        // of samples after a few iterations
+        for n in 0..NUMBER_OF_ITERATIONS {
+            for i in 0..BUFFER_SIZE as u64 {
+                publisher.send_copy(n * 100 + i)?;
+            }
+
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq n * 100 + BUFFER_SIZE as u64 - 1);
+            assert_that!(sut.receive()?, is_none);
+        }
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn received_samples_carry_consecutive_sequence_numbers<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: u64 = 8;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service.subscriber_builder().create()?;
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy(n)?;
+        }
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            let sample = sut.receive()?.unwrap();
+            assert_that!(sample.header().sequence_number(), eq n);
+        }
+        assert_that!(sut.lost_samples(), eq 0);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn overflowing_subscriber_detects_lost_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const BUFFER_SIZE: usize = 2;
+        const NUMBER_OF_SAMPLES: u64 = 7;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(BUFFER_SIZE)
+            .enable_safe_overflow(true)
+            .create()?;
+
+        let reported_losses = Arc::new(AtomicU64::new(0));
+        let reported_losses_in_handler = reported_losses.clone();
+        let publisher = service.publisher_builder().create()?;
+        let sut = service
+            .subscriber_builder()
+            .set_sample_loss_handler(move |info: &SampleLossInfo| {
+                reported_losses_in_handler
+                    .fetch_add(info.number_of_lost_samples(), Ordering::Relaxed);
+            })
+            .create()?;
+
+        publisher.send_copy(0)?;
+        assert_that!(*sut.receive()?.unwrap(), eq 0);
+
+        for n in 1..NUMBER_OF_SAMPLES {
+            publisher.send_copy(n)?;
+        }
+
+        // only the last BUFFER_SIZE samples survived the overflow
+        let sample = sut.receive()?.unwrap();
+        assert_that!(*sample, eq NUMBER_OF_SAMPLES - BUFFER_SIZE as u64);
+        let lost = NUMBER_OF_SAMPLES - BUFFER_SIZE as u64 - 1;
+        assert_that!(sut.lost_samples(), eq lost);
+        assert_that!(reported_losses.load(Ordering::Relaxed), eq lost);
+
+        assert_that!(*sut.receive()?.unwrap(), eq NUMBER_OF_SAMPLES - 1);
+        assert_that!(sut.lost_samples(), eq lost);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_key_range_content_filter_receives_only_matching_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: u64 = 6;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        let sut = service
+            .subscriber_builder()
+            .content_filter(ContentFilter::key_range(0, 2u64..=3u64))
+            .create()?;
+        let unfiltered_subscriber = service.subscriber_builder().create()?;
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            let mut sample = publisher.loan_uninit()?;
+            *sample.user_header_mut() = i;
+            let number_of_recipients = sample.write_payload(i).send()?;
+            let expected_recipients = if (2..=3).contains(&i) { 2 } else { 1 };
+            assert_that!(number_of_recipients, eq expected_recipients);
+        }
+
+        for i in 2..=3 {
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+        assert_that!(sut.receive()?, is_none);
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            let sample = unfiltered_subscriber.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_key_mask_content_filter_receives_only_matching_samples<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const NUMBER_OF_SAMPLES: u32 = 8;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u32>()
+            .user_header::<[u32; 2]>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        // key is the second element of the user header, accept all odd keys
+        let sut = service
+            .subscriber_builder()
+            .content_filter(ContentFilter::key_mask(
+                core::mem::size_of::<u32>(),
+                1u32,
+                1u32,
+            ))
+            .create()?;
+
+        for i in 0..NUMBER_OF_SAMPLES {
+            let mut sample = publisher.loan_uninit()?;
+            *sample.user_header_mut() = [0, i];
+            sample.write_payload(i).send()?;
+        }
+
+        for i in (1..NUMBER_OF_SAMPLES).step_by(2) {
+            let sample = sut.receive()?;
+            assert_that!(sample, is_some);
+            assert_that!(*sample.unwrap(), eq i);
+        }
+        assert_that!(sut.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn content_filter_is_applied_to_history<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        const HISTORY_SIZE: usize = 4;
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u64>()
+            .history_size(HISTORY_SIZE)
+            .subscriber_max_buffer_size(HISTORY_SIZE)
+            .create()?;
+
+        let publisher = service.publisher_builder().create()?;
+        for i in 0..HISTORY_SIZE as u64 {
+            let mut sample = publisher.loan_uninit()?;
+            *sample.user_header_mut() = i;
+            sample.write_payload(i).send()?;
+        }
+
+        let sut = service
+            .subscriber_builder()
+            .content_filter(ContentFilter::key_range(0, 1u64..=1u64))
+            .create()?;
+        publisher.update_connections()?;
+
+        let sample = sut.receive()?;
+        assert_that!(sample, is_some);
+        assert_that!(*sample.unwrap(), eq 1);
+        assert_that!(sut.receive()?, is_none);
+
+        Ok(())
+    }
+
+    #[conformance_test]
+    pub fn content_filter_with_key_outside_of_user_header_fails<Sut: Service>()
+    -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
+        let test = Test::<Sut>::new();
+        let service_name = generate_service_name();
+        let node = test.create_node();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .user_header::<u32>()
+            .create()?;
+
+        let sut = service
+            .subscriber_builder()
+            .content_filter(ContentFilter::key_range(0, 0u64..=1u64))
+            .create();
+        assert_that!(sut.err(), eq Some(SubscriberCreateError::ContentFilterExceedsUserHeader));
+
+        let sut = service
+            .subscriber_builder()
+            .content_filter(ContentFilter::key_range(2, 0u16..=1u16))
+            .create();
+        assert_that!(sut, is_ok);
+
+        Ok(())
+    }
+
     #[conformance_test]
     pub fn subscriber_name_is_empty_by_default<Sut: Service>()
     -> core::result::Result<(), alloc::boxed::Box<dyn core::error::Error>> {
@@ -103,6 +575,149 @@ pub mod subscriber {
         Ok(())
     }
 
+    #[conformance_test]
+    pub fn subscriber_without_wake_up_has_no_wake_up_channel<Sut: Service>()
+    where
+        <Sut::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let sut = service.subscriber_builder().create().unwrap();
+
+        assert_that!(sut.wake_up_channel().is_none(), eq true);
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_wake_up_is_woken_up_by_publisher<Sut: Service>()
+    where
+        <Sut::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .enable_wake_up(true)
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        assert_that!(sut.wake_up_channel().is_some(), eq true);
+
+        let waitset = WaitSetBuilder::new().create::<Sut>().unwrap();
+        let guard = waitset.attach_subscriber(&sut).unwrap();
+
+        let wait_for_wake_up = || {
+            let mut is_woken_up = false;
+            waitset
+                .wait_and_process_once_with_timeout(
+                    |attachment_id| {
+                        if attachment_id.has_event_from(&guard) {
+                            is_woken_up = true;
+                        }
+                        CallbackProgression::Continue
+                    },
+                    TIMEOUT,
+                )
+                .unwrap();
+            is_woken_up
+        };
+
+        assert_that!(wait_for_wake_up(), eq false);
+
+        publisher.send_copy(1234).unwrap();
+        publisher.send_copy(5678).unwrap();
+
+        assert_that!(wait_for_wake_up(), eq true);
+
+        assert_that!(*sut.receive().unwrap().unwrap(), eq 1234);
+        assert_that!(*sut.receive().unwrap().unwrap(), eq 5678);
+        assert_that!(sut.receive().unwrap(), is_none);
+
+        assert_that!(wait_for_wake_up(), eq false);
+    }
+
+    #[conformance_test]
+    pub fn subscriber_with_prefetch_receives_all_samples_in_order<Sut: Service>() {
+        const NUMBER_OF_SAMPLES: u64 = 8;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<[u64; 32]>()
+            .subscriber_max_buffer_size(NUMBER_OF_SAMPLES as usize)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .buffer_size(NUMBER_OF_SAMPLES as usize)
+            .prefetch_next_sample(4096)
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            publisher.send_copy([n; 32]).unwrap();
+        }
+
+        for n in 0..NUMBER_OF_SAMPLES {
+            let sample = sut.receive().unwrap().unwrap();
+            assert_that!(*sample, eq [n; 32]);
+        }
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn subscriber_in_send_order_merges_samples_of_all_publishers<Sut: Service>() {
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .enable_send_timestamps(true)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .receive_in_send_order(true)
+            .create()
+            .unwrap();
+        let publisher_1 = service.publisher_builder().create().unwrap();
+        let publisher_2 = service.publisher_builder().create().unwrap();
+
+        publisher_2.send_copy(1).unwrap();
+        publisher_1.send_copy(2).unwrap();
+        publisher_1.send_copy(3).unwrap();
+        publisher_2.send_copy(4).unwrap();
+        publisher_1.send_copy(5).unwrap();
+
+        let mut previous_timestamp = None;
+        for n in 1..=5 {
+            let sample = sut.receive().unwrap().unwrap();
+            assert_that!(*sample, eq n);
+            let timestamp = sample.header().send_timestamp().map(|t| t.as_duration());
+            assert_that!(timestamp, ge previous_timestamp);
+            previous_timestamp = timestamp;
+        }
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
+
     #[conformance_test]
     #[should_panic]
     #[cfg(debug_assertions)]
@@ -135,4 +750,119 @@ pub mod subscriber {
         // panics here
         let _sample = sut.receive();
     }
+    #[conformance_test]
+    pub fn subscriber_buffer_can_be_resized_up_to_creation_size_by_default<Sut: Service>() {
+        const MAX_BUFFER_SIZE: usize = 8;
+        const BUFFER_SIZE: usize = 4;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(MAX_BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .buffer_size(BUFFER_SIZE)
+            .create()
+            .unwrap();
+
+        assert_that!(sut.buffer_size(), eq BUFFER_SIZE);
+        assert_that!(sut.max_buffer_size(), eq BUFFER_SIZE);
+
+        let result = sut.resize_buffer(BUFFER_SIZE + 1);
+        assert_that!(result.err(), eq Some(SubscriberResizeBufferError::BufferSizeExceedsMaxBufferSize));
+        assert_that!(sut.buffer_size(), eq BUFFER_SIZE);
+
+        assert_that!(sut.resize_buffer(1), is_ok);
+        assert_that!(sut.buffer_size(), eq 1);
+        assert_that!(sut.resize_buffer(BUFFER_SIZE), is_ok);
+        assert_that!(sut.buffer_size(), eq BUFFER_SIZE);
+    }
+
+    #[conformance_test]
+    pub fn growing_subscriber_buffer_keeps_queued_samples<Sut: Service>() {
+        const MAX_BUFFER_SIZE: usize = 8;
+        const BUFFER_SIZE: usize = 2;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(MAX_BUFFER_SIZE)
+            .enable_safe_overflow(true)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .buffer_size(BUFFER_SIZE)
+            .enable_buffer_resizing(true)
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        assert_that!(sut.max_buffer_size(), eq MAX_BUFFER_SIZE);
+
+        for n in 0..BUFFER_SIZE as u64 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        assert_that!(sut.resize_buffer(MAX_BUFFER_SIZE), is_ok);
+        assert_that!(sut.buffer_size(), eq MAX_BUFFER_SIZE);
+        for n in BUFFER_SIZE as u64..MAX_BUFFER_SIZE as u64 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        for n in 0..MAX_BUFFER_SIZE as u64 {
+            assert_that!(*sut.receive().unwrap().unwrap(), eq n);
+        }
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
+
+    #[conformance_test]
+    pub fn shrinking_subscriber_buffer_returns_oldest_samples_to_publisher<Sut: Service>() {
+        const MAX_BUFFER_SIZE: usize = 8;
+        const BUFFER_SIZE: usize = 3;
+        let test = Test::<Sut>::new();
+        let node = test.create_node();
+        let service_name = generate_service_name();
+        let service = node
+            .service_builder(&service_name)
+            .publish_subscribe::<u64>()
+            .subscriber_max_buffer_size(MAX_BUFFER_SIZE)
+            .max_publishers(1)
+            .max_subscribers(1)
+            .enable_safe_overflow(true)
+            .create()
+            .unwrap();
+
+        let sut = service
+            .subscriber_builder()
+            .enable_buffer_resizing(true)
+            .create()
+            .unwrap();
+        let publisher = service.publisher_builder().create().unwrap();
+        assert_that!(sut.buffer_size(), eq MAX_BUFFER_SIZE);
+
+        for n in 0..MAX_BUFFER_SIZE as u64 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        assert_that!(sut.resize_buffer(BUFFER_SIZE), is_ok);
+        assert_that!(sut.buffer_size(), eq BUFFER_SIZE);
+
+        // the publisher reclaims the returned samples and sends new ones until the buffer overflows
+        for n in MAX_BUFFER_SIZE as u64..2 * MAX_BUFFER_SIZE as u64 {
+            publisher.send_copy(n).unwrap();
+        }
+
+        for n in 2 * MAX_BUFFER_SIZE - BUFFER_SIZE..2 * MAX_BUFFER_SIZE {
+            assert_that!(*sut.receive().unwrap().unwrap(), eq n as u64);
+        }
+        assert_that!(sut.receive().unwrap(), is_none);
+    }
 }
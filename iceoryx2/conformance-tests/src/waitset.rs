@@ -17,12 +17,14 @@ use iceoryx2_bb_testing_macros::conformance_tests;
 pub mod waitset {
     use alloc::vec;
     use core::time::Duration;
+    use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicUsize, Ordering};
     use iceoryx2_cal::event::event_state::counting_bit_set::RelocatableCountingBitSet;
 
     use iceoryx2::port::listener::Listener;
     use iceoryx2::port::notifier::Notifier;
     use iceoryx2::prelude::{WaitSetBuilder, *};
-    use iceoryx2::waitset::{WaitSetAttachmentError, WaitSetRunError};
+    use iceoryx2::thread_pool_waitset::ThreadPoolWaitSetBuilder;
+    use iceoryx2::waitset::{WaitSetAttachmentError, WaitSetRunError, WaitSetRunResult};
     use iceoryx2_bb_posix::clock::{Time, nanosleep};
     use iceoryx2_bb_posix::testing::generate_file_path;
     use iceoryx2_bb_posix::unix_datagram_socket::{
@@ -30,6 +32,8 @@ pub mod waitset {
     };
     use iceoryx2_bb_posix::{
         file_descriptor_set::SynchronousMultiplexing,
+        scheduler::Scheduler,
+        thread::{ThreadHandle, ThreadProperties},
         unix_datagram_socket::UnixDatagramReceiverBuilder,
     };
     use iceoryx2_bb_testing::watchdog::Watchdog;
@@ -204,6 +208,119 @@ pub mod waitset {
         assert_that!(receiver_1_triggered, eq true);
     }
 
+    #[conformance_test]
+    pub fn wait_and_process_batch_once_lists_all_notifications_in_one_call<S: Service>()
+    where
+        <S::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<S>::new();
+        let node = test.create_node();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let (listener_1, notifier_1) = create_event::<S>(&node);
+        let (listener_2, _notifier_2) = create_event::<S>(&node);
+        let (receiver_1, sender_1) = create_socket();
+        let (receiver_2, _sender_2) = create_socket();
+
+        let listener_1_guard = sut.attach_notification(&listener_1).unwrap();
+        let listener_2_guard = sut.attach_notification(&listener_2).unwrap();
+        let receiver_1_guard = sut.attach_notification(&receiver_1).unwrap();
+        let receiver_2_guard = sut.attach_notification(&receiver_2).unwrap();
+
+        notifier_1.notify().unwrap();
+        sender_1.try_send(b"bla").unwrap();
+
+        let mut number_of_calls = 0;
+        let result = sut
+            .wait_and_process_batch_once(|attachment_ids| {
+                number_of_calls += 1;
+                assert_that!(attachment_ids, len 2);
+                assert_that!(attachment_ids.iter().any(|id| id.has_event_from(&listener_1_guard)), eq true);
+                assert_that!(attachment_ids.iter().any(|id| id.has_event_from(&receiver_1_guard)), eq true);
+                assert_that!(attachment_ids.iter().any(|id| id.has_event_from(&listener_2_guard)), eq false);
+                assert_that!(attachment_ids.iter().any(|id| id.has_event_from(&receiver_2_guard)), eq false);
+
+                CallbackProgression::Continue
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::AllEventsHandled);
+        assert_that!(number_of_calls, eq 1);
+    }
+
+    #[conformance_test]
+    pub fn wait_and_process_batch_once_with_timeout_does_not_call_callback_without_events<
+        S: Service,
+    >()
+    where
+        <S::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<S>::new();
+        let node = test.create_node();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let (listener, _notifier) = create_event::<S>(&node);
+        let _guard = sut.attach_notification(&listener).unwrap();
+
+        let mut callback_called = false;
+        let result = sut
+            .wait_and_process_batch_once_with_timeout(
+                |_| {
+                    callback_called = true;
+                    CallbackProgression::Continue
+                },
+                TIMEOUT,
+            )
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::AllEventsHandled);
+        assert_that!(callback_called, eq false);
+    }
+
+    #[conformance_test]
+    pub fn waiting_thread_settings_are_applied_to_the_waiting_thread<S: Service>()
+    where
+        <S::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<S>::new();
+        let node = test.create_node();
+        let (listener, _notifier) = create_event::<S>(&node);
+
+        let sut = WaitSetBuilder::new()
+            .waiting_thread_affinity(&[0])
+            .waiting_thread_scheduler(Scheduler::Other, 0)
+            .create::<S>()
+            .unwrap();
+        let _guard = sut.attach_notification(&listener).unwrap();
+
+        let result = sut
+            .wait_and_process_once_with_timeout(|_| CallbackProgression::Continue, TIMEOUT)
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::AllEventsHandled);
+        assert_that!(ThreadHandle::from_self().get_affinity().unwrap(), eq vec![0]);
+    }
+
+    #[conformance_test]
+    pub fn wait_and_process_batch_returns_when_stop_is_requested<S: Service>()
+    where
+        <S::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        let test = Test::<S>::new();
+        let node = test.create_node();
+        let sut = WaitSetBuilder::new().create::<S>().unwrap();
+
+        let (listener, notifier) = create_event::<S>(&node);
+        let _guard = sut.attach_notification(&listener).unwrap();
+        notifier.notify().unwrap();
+
+        let result = sut
+            .wait_and_process_batch(|_| CallbackProgression::Stop)
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::StopRequest);
+    }
+
     #[conformance_test]
     pub fn wait_and_process_once_with_tick_interval_blocks_for_at_least_timeout<S: Service>()
     where
@@ -605,4 +722,139 @@ pub mod waitset {
 
         assert_that!(sut.signal_handling_mode(), eq SignalHandlingMode::HandleTerminationRequests);
     }
+
+    #[conformance_test]
+    pub fn thread_pool_waitset_processes_every_attachment_exactly_once<S: Service>()
+    where
+        WaitSetAttachmentId<S>: Send + Sync,
+    {
+        const NUMBER_OF_ATTACHMENTS: usize = 12;
+        let _watchdog = Watchdog::new();
+        let sut = ThreadPoolWaitSetBuilder::new()
+            .number_of_threads(4)
+            .create::<S>()
+            .unwrap();
+        assert_that!(sut.number_of_threads(), eq 4);
+
+        let mut sockets = vec![];
+        for _ in 0..NUMBER_OF_ATTACHMENTS {
+            sockets.push(create_socket());
+        }
+
+        let mut guards = vec![];
+        let mut attachment_ids = vec![];
+        let mut counters = vec![];
+        for (receiver, sender) in &sockets {
+            let guard = sut.attach_notification(receiver).unwrap();
+            attachment_ids.push(WaitSetAttachmentId::from_guard(&guard));
+            guards.push(guard);
+            counters.push(AtomicUsize::new(0));
+            sender.try_send(b"bla").unwrap();
+        }
+
+        let result = sut
+            .wait_and_process_once(|attachment_id| {
+                match attachment_ids.iter().position(|id| *id == attachment_id) {
+                    Some(idx) => {
+                        counters[idx].fetch_add(1, Ordering::Relaxed);
+                    }
+                    None => test_fail!("only attachments shall trigger"),
+                }
+                CallbackProgression::Continue
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::AllEventsHandled);
+        for counter in &counters {
+            assert_that!(counter.load(Ordering::Relaxed), eq 1);
+        }
+    }
+
+    #[conformance_test]
+    pub fn thread_pool_waitset_never_runs_callback_of_one_attachment_concurrently<S: Service>()
+    where
+        WaitSetAttachmentId<S>: Send + Sync,
+    {
+        const NUMBER_OF_ATTACHMENTS: usize = 4;
+        const NUMBER_OF_CALLBACKS: usize = 64;
+        let _watchdog = Watchdog::new();
+        let sut = ThreadPoolWaitSetBuilder::new()
+            .number_of_threads(NUMBER_OF_ATTACHMENTS * 2)
+            .create::<S>()
+            .unwrap();
+
+        let mut sockets = vec![];
+        for _ in 0..NUMBER_OF_ATTACHMENTS {
+            sockets.push(create_socket());
+        }
+
+        let mut guards = vec![];
+        let mut attachment_ids = vec![];
+        let mut in_progress = vec![];
+        for (receiver, sender) in &sockets {
+            let guard = sut.attach_notification(receiver).unwrap();
+            attachment_ids.push(WaitSetAttachmentId::from_guard(&guard));
+            guards.push(guard);
+            in_progress.push(AtomicBool::new(false));
+            // the data is never consumed, therefore the attachment triggers on every wake up
+            sender.try_send(b"bla").unwrap();
+        }
+
+        let callback_counter = AtomicUsize::new(0);
+        let concurrent_call_detected = AtomicBool::new(false);
+        let result = sut
+            .wait_and_process(|attachment_id| {
+                let idx = attachment_ids
+                    .iter()
+                    .position(|id| *id == attachment_id)
+                    .unwrap();
+                if in_progress[idx].swap(true, Ordering::Relaxed) {
+                    concurrent_call_detected.store(true, Ordering::Relaxed);
+                }
+                nanosleep(Duration::from_millis(1)).unwrap();
+                in_progress[idx].store(false, Ordering::Relaxed);
+
+                if callback_counter.fetch_add(1, Ordering::Relaxed) + 1 >= NUMBER_OF_CALLBACKS {
+                    CallbackProgression::Stop
+                } else {
+                    CallbackProgression::Continue
+                }
+            })
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::StopRequest);
+        assert_that!(concurrent_call_detected.load(Ordering::Relaxed), eq false);
+        assert_that!(callback_counter.load(Ordering::Relaxed), ge NUMBER_OF_CALLBACKS);
+    }
+
+    #[conformance_test]
+    pub fn thread_pool_waitset_returns_after_timeout_without_events<S: Service>()
+    where
+        WaitSetAttachmentId<S>: Send + Sync,
+    {
+        let _watchdog = Watchdog::new();
+        let sut = ThreadPoolWaitSetBuilder::new()
+            .number_of_threads(2)
+            .create::<S>()
+            .unwrap();
+
+        let (receiver, _sender) = create_socket();
+        let _guard = sut.attach_notification(&receiver).unwrap();
+
+        let callback_called = AtomicBool::new(false);
+        let start = Time::now().unwrap();
+        let result = sut
+            .wait_and_process_once_with_timeout(
+                |_| {
+                    callback_called.store(true, Ordering::Relaxed);
+                    CallbackProgression::Continue
+                },
+                TIMEOUT,
+            )
+            .unwrap();
+
+        assert_that!(result, eq WaitSetRunResult::AllEventsHandled);
+        assert_that!(callback_called.load(Ordering::Relaxed), eq false);
+        assert_that!(start.elapsed().unwrap(), time_at_least TIMEOUT);
+    }
 }
@@ -58,10 +58,11 @@ use crate::{
     identifiers::{UniqueClientId, UniqueServerId},
     port::{
         LoanError, SendError,
-        details::chunk_details::ChunkDetails,
+        details::{chunk_details::ChunkDetails, request_coalescing::RequestKey},
         server::{INVALID_CONNECTION_ID, SharedServerState},
     },
     raw_sample::{RawSample, RawSampleMut},
+    response::Response,
     response_mut::ResponseMut,
     response_mut_uninit::ResponseMutUninit,
     service::{
@@ -180,10 +181,17 @@ impl<
 > Drop for ActiveRequest<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
 {
     fn drop(&mut self) {
-        self.shared_state
-            .lock()
-            .request_receiver
-            .release_offset(&self.details, ChannelId::new(0));
+        {
+            let shared_state = self.shared_state.lock();
+            // the in-flight request must be removed before its request chunk is released since
+            // it refers to the content of the chunk
+            if shared_state.config.enable_request_coalescing {
+                shared_state.release_coalesced_requests(&self.request_key());
+            }
+            shared_state
+                .request_receiver
+                .release_offset(&self.details, ChannelId::new(0));
+        }
         self.finish();
     }
 }
@@ -196,6 +204,14 @@ impl<
     ResponseHeader: Debug + ZeroCopySend,
 > ActiveRequest<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
 {
+    fn request_key(&self) -> RequestKey {
+        RequestKey {
+            connection_id: self.connection_id,
+            channel_id: self.channel_id,
+            request_id: self.request_id,
+        }
+    }
+
     fn finish(&self) {
         if self.connection_id != INVALID_CONNECTION_ID {
             self.shared_state.lock().response_sender.close_channel(
@@ -260,6 +276,118 @@ impl<
         UniqueClientId(UniqueSystemId::from(self.details.origin))
     }
 
+    /// Sends multiple [`ResponseMut`]s, that were loaned from this [`ActiveRequest`], at once.
+    /// In contrast to calling [`ResponseMut::send()`] for every response, the connections are
+    /// updated and the returned samples are reclaimed only once for the whole batch. The
+    /// [`ResponseMut`]s are delivered in the order of the iterator. If the delivery of a
+    /// [`ResponseMut`] fails, the remaining ones are still delivered and the first error is
+    /// returned.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node
+    /// #     .service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .request_response::<u64, u64>()
+    /// #     .open_or_create()?;
+    /// # let client = service.client_builder().create()?;
+    /// # let server = service.server_builder()
+    /// #     .max_loaned_responses_per_request(2)
+    /// #     .create()?;
+    /// #
+    /// # let pending_response = client.send_copy(123)?;
+    ///
+    /// let active_request = server.receive()?.unwrap();
+    /// let response_1 = active_request.loan_uninit()?.write_payload(1);
+    /// let response_2 = active_request.loan_uninit()?.write_payload(2);
+    ///
+    /// active_request.send_batch([response_1, response_2])?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_batch<
+        I: IntoIterator<Item = ResponseMut<Service, ResponsePayload, ResponseHeader>>,
+    >(
+        &self,
+        responses: I,
+    ) -> Result<(), SendError> {
+        let msg = "Unable to send batch of responses";
+        let responses = responses.into_iter();
+        let prepare_result = {
+            let shared_state = self.shared_state.lock();
+            shared_state
+                .update_connections()
+                .map(|_| shared_state.response_sender.retrieve_returned_samples())
+        };
+
+        if let Err(e) = prepare_result {
+            // release all loaned responses, the lock is already released at this point
+            responses.for_each(drop);
+            fail!(from self, with SendError::ConnectionError(e),
+                "{} since the connections could not be updated.", msg);
+        }
+
+        let mut delivery_error = None;
+        for mut response in responses {
+            debug_assert!(
+                response.connection_id == self.connection_id
+                    && response.channel_id == self.channel_id,
+                "The response must have been loaned from this active request."
+            );
+
+            if response.connection_id == INVALID_CONNECTION_ID {
+                continue;
+            }
+
+            // the lock is released before the response is dropped since dropping a response
+            // acquires the lock of the shared state as well
+            let result = {
+                let shared_state = self.shared_state.lock();
+                let key = self.request_key();
+                if shared_state.config.enable_request_coalescing {
+                    shared_state.prepare_coalesced_response(response.ptr.as_header_mut(), &key);
+                }
+
+                let result = shared_state
+                    .response_sender
+                    .deliver_offset_to_connection_without_reclaim(
+                        response.offset_to_chunk,
+                        response.sample_size,
+                        response.channel_id,
+                        response.connection_id,
+                    )
+                    .map(|_| ());
+
+                if shared_state.config.enable_request_coalescing {
+                    let coalesced_result = shared_state.deliver_to_coalesced_requests(
+                        response.offset_to_chunk,
+                        response.sample_size,
+                        &key,
+                    );
+                    result.and(coalesced_result)
+                } else {
+                    result
+                }
+            };
+
+            if let Err(e) = result {
+                if delivery_error.is_none() {
+                    delivery_error = Some(e);
+                }
+            }
+        }
+
+        match delivery_error {
+            Some(e) => Err(e),
+            None => Ok(()),
+        }
+    }
+
     fn increment_loan_counter(&self) -> Result<(), LoanError> {
         let mut current_loan_count = self.shared_loan_counter.load(Ordering::Relaxed);
         loop {
@@ -334,14 +462,14 @@ impl<
             chunk.header.cast();
         let user_header_ptr: *mut ResponseHeader = chunk.user_header.cast();
         unsafe {
-            header_ptr.write(service::header::request_response::ResponseHeader {
-                node_id: *shared_state.response_sender.shared_node.id(),
-                server_id: UniqueServerId(UniqueSystemId::from(
+            header_ptr.write(service::header::request_response::ResponseHeader::new(
+                *shared_state.response_sender.shared_node.id(),
+                UniqueServerId(UniqueSystemId::from(
                     shared_state.response_sender.sender_port_id,
                 )),
-                request_id: self.request_id,
-                number_of_elements: 1,
-            })
+                self.request_id,
+                1,
+            ))
         };
         unsafe { user_header_ptr.write(ResponseHeader::default()) };
 
@@ -403,6 +531,73 @@ impl<
 
         response.write_payload(value).send()
     }
+
+    /// Forwards the user header and payload of a received [`Response`] of another service, for
+    /// instance from a [`PendingResponse`](crate::pending_response::PendingResponse) of a
+    /// [`Client`](crate::port::client::Client), with a new [`ResponseMut`]. The data is copied
+    /// directly from the data segment of the origin into the data segment of the
+    /// [`Server`](crate::port::server::Server), without an intermediate copy. The
+    /// [`Response`] cannot be delivered by reference since the
+    /// [`Client`](crate::port::client::Client) of this [`ActiveRequest`] has only access to
+    /// the data segment of the [`Server`](crate::port::server::Server).
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// let frontend = node
+    ///     .service_builder(&"My/Funk/Frontend".try_into()?)
+    ///     .request_response::<u64, u64>()
+    ///     .open_or_create()?;
+    /// let backend = node
+    ///     .service_builder(&"My/Funk/Backend".try_into()?)
+    ///     .request_response::<u64, u64>()
+    ///     .open_or_create()?;
+    /// # let client = frontend.client_builder().create()?;
+    /// # let backend_server = backend.server_builder().create()?;
+    ///
+    /// let server = frontend.server_builder().create()?;
+    /// let backend_client = backend.client_builder().create()?;
+    /// # let _pending_response = client.send_copy(123)?;
+    ///
+    /// let active_request = server.receive()?.unwrap();
+    /// let backend_pending_response = backend_client.send_copy(*active_request)?;
+    /// # backend_server.receive()?.unwrap().send_copy(456)?;
+    ///
+    /// if let Some(response) = backend_pending_response.receive()? {
+    ///     active_request.forward(&response)?;
+    /// }
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn forward<OriginService: crate::service::Service>(
+        &self,
+        response: &Response<OriginService, ResponsePayload, ResponseHeader>,
+    ) -> Result<(), SendError>
+    where
+        ResponsePayload: Copy,
+        ResponseHeader: Copy,
+    {
+        let msg = "Unable to forward response";
+        let mut forwarded_response = fail!(from self,
+                            when self.loan_uninit(),
+                            "{} since the loan of the response failed.", msg);
+
+        *forwarded_response.user_header_mut() = *response.user_header();
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                response.payload() as *const ResponsePayload,
+                forwarded_response.payload_mut().as_mut_ptr(),
+                1,
+            );
+            forwarded_response.assume_init()
+        }
+        .send()
+    }
 }
 
 impl<
@@ -511,6 +706,102 @@ impl<
     ResponseHeader: Default + Debug + ZeroCopySend,
 > ActiveRequest<Service, RequestPayload, RequestHeader, [ResponsePayload], ResponseHeader>
 {
+    /// Forwards the user header and payload of a received [`Response`] of another service with
+    /// a new [`ResponseMut`]. The data is copied directly from the data segment of the origin
+    /// into the data segment of the [`Server`](crate::port::server::Server), without an
+    /// intermediate copy.
+    pub fn forward<OriginService: crate::service::Service>(
+        &self,
+        response: &Response<OriginService, [ResponsePayload], ResponseHeader>,
+    ) -> Result<(), SendError>
+    where
+        ResponsePayload: Copy,
+        ResponseHeader: Copy,
+    {
+        let msg = "Unable to forward response";
+        let payload = response.payload();
+        let mut forwarded_response = fail!(from self,
+                            when self.loan_slice_uninit(payload.len()),
+                            "{} since the loan of the response failed.", msg);
+
+        *forwarded_response.user_header_mut() = *response.user_header();
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                payload.as_ptr(),
+                forwarded_response.payload_mut().as_mut_ptr().cast(),
+                payload.len(),
+            );
+            forwarded_response.assume_init()
+        }
+        .send()
+    }
+
+    /// Sends `payload` as a stream of [`ResponseMut`]s with at most `chunk_len` elements each,
+    /// so that a large response does not have to be loaned as one slice. The chunks are
+    /// loaned, filled and sent one after another, therefore only one chunk is loaned at a
+    /// time. How many chunks are in flight is bounded by the response buffer of the
+    /// [`Client`](crate::port::client::Client). With
+    /// [`BackpressureStrategy::RetryUntilDelivered`](crate::prelude::BackpressureStrategy)
+    /// the next chunk is delivered only when the client has consumed one.
+    ///
+    /// On success it returns the number of sent chunks, otherwise a [`SendError`] describing
+    /// the failure. The chunks sent before the failure are not revoked.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"Whatever7".try_into()?)
+    /// #     .request_response::<u64, [u8]>()
+    /// #     .max_response_buffer_size(4)
+    /// #     .open_or_create()?;
+    /// #
+    /// # let client = service.client_builder().create()?;
+    /// let server = service.server_builder()
+    ///                     .initial_max_slice_len(1024)
+    ///                     .create()?;
+    /// # let pending_response = client.send_copy(0)?;
+    /// let active_request = server.receive()?.unwrap();
+    ///
+    /// let point_cloud = [0u8; 4096];
+    /// let number_of_chunks = active_request.send_chunked(&point_cloud, 1024)?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_chunked(
+        &self,
+        payload: &[ResponsePayload],
+        chunk_len: usize,
+    ) -> Result<usize, SendError>
+    where
+        ResponsePayload: Copy,
+    {
+        let msg = "Unable to send chunked response";
+        let mut number_of_chunks = 0;
+        for chunk in payload.chunks(chunk_len.max(1)) {
+            let mut response = fail!(from self,
+                            when self.loan_slice_uninit(chunk.len()),
+                            "{} since the loan of chunk {} failed.", msg, number_of_chunks);
+
+            unsafe {
+                core::ptr::copy_nonoverlapping(
+                    chunk.as_ptr(),
+                    response.payload_mut().as_mut_ptr().cast(),
+                    chunk.len(),
+                );
+                response.assume_init()
+            }
+            .send()?;
+            number_of_chunks += 1;
+        }
+
+        Ok(number_of_chunks)
+    }
+
     /// Loans/allocates a [`ResponseMutUninit`] from the underlying data segment of the
     /// [`Server`](crate::port::server::Server).
     /// The user has to initialize the payload before it can be sent.
@@ -581,14 +872,14 @@ impl<
             chunk.header.cast();
         let user_header_ptr: *mut ResponseHeader = chunk.user_header.cast();
         unsafe {
-            header_ptr.write(service::header::request_response::ResponseHeader {
-                node_id: *shared_state.response_sender.shared_node.id(),
-                server_id: UniqueServerId(UniqueSystemId::from(
+            header_ptr.write(service::header::request_response::ResponseHeader::new(
+                *shared_state.response_sender.shared_node.id(),
+                UniqueServerId(UniqueSystemId::from(
                     shared_state.response_sender.sender_port_id,
                 )),
-                request_id: self.request_id,
-                number_of_elements: slice_len as _,
-            })
+                self.request_id,
+                slice_len as _,
+            ))
         };
         unsafe { user_header_ptr.write(ResponseHeader::default()) };
 
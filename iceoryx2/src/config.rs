@@ -76,6 +76,7 @@ use alloc::string::String;
 use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_elementary::{CallbackProgression, lazy_singleton::*};
 use iceoryx2_bb_posix::{
+    adaptive_wait::AdaptiveWaitStrategy,
     file::{FileBuilder, FileOpenError},
     shared_memory::AccessMode,
     system_configuration::GLOBAL_CONFIG_PATH,
@@ -88,6 +89,8 @@ use serde::{Deserialize, Serialize};
 use iceoryx2_log::{debug, fail, fatal_panic, info, trace, warn};
 
 use crate::port::backpressure_strategy::BackpressureStrategy;
+use iceoryx2_cal::reactor::ReactorBackend;
+use iceoryx2_cal::shared_memory::PageSize;
 use iceoryx2_cal::shm_allocator::AllocationStrategy;
 
 use iceoryx2_pal_configuration::ICEORYX2_ROOT_PATH;
@@ -231,6 +234,22 @@ pub struct Global {
     /// Defines the time how long the process will wait until an entity, that shares inter-process
     /// resources with others, is opened or created. This entity could be for instance a service
     pub creation_timeout: Duration,
+    /// Defines how a port waits when it blocks due to
+    /// [`BackpressureStrategy::RetryUntilDelivered`] until the receiver has space in its buffer.
+    pub backpressure_wait_strategy: AdaptiveWaitStrategy,
+    /// The maximum number of bytes the data segments of all processes of the domain, the
+    /// processes that share the same [`Global::prefix`], can occupy in sum. The creation of a
+    /// data segment that would exceed the quota fails. [`None`] means unlimited.
+    pub shared_memory_quota: Option<usize>,
+    /// When enabled, subscribers, clients and servers map the data segment of a sender only
+    /// when the first sample of the sender arrives instead of when they connect to it. Samples
+    /// of a sender that went out of scope before its data segment was mapped are lost.
+    pub lazy_data_segment_mapping: bool,
+    /// Subscribers, clients and servers unmap the data segment of a sender when they did not
+    /// receive a sample from it for this duration and hold no sample of it. It is mapped again
+    /// with the next sample, samples of a sender that went out of scope in the meantime are
+    /// lost. [`None`] keeps the data segments mapped.
+    pub data_segment_idle_timeout: Option<Duration>,
 }
 
 impl Default for Global {
@@ -244,6 +263,10 @@ impl Default for Global {
             service: Service::default(),
             node: Node::default(),
             creation_timeout: Duration::from_secs(1),
+            backpressure_wait_strategy: AdaptiveWaitStrategy::Adaptive,
+            shared_memory_quota: None,
+            lazy_data_segment_mapping: false,
+            data_segment_idle_timeout: None,
         }
     }
 }
@@ -288,6 +311,8 @@ pub struct Defaults {
     pub request_response: RequestResonse,
     /// Default settings for the messaging pattern blackboard
     pub blackboard: Blackboard,
+    /// Default settings for the [`WaitSet`](crate::waitset::WaitSet)
+    pub waitset: WaitSet,
 }
 
 /// Default settings for the publish-subscribe messaging pattern. These settings are used unless
@@ -333,6 +358,9 @@ pub struct PublishSubscribe {
     /// [`Publisher`](crate::port::publisher::Publisher) when the initially preallocated memory is
     /// insufficient.
     pub publisher_allocation_strategy: AllocationStrategy,
+    /// Defines the default [`PageSize`] of the pages that back the data segment of the
+    /// [`Publisher`](crate::port::publisher::Publisher).
+    pub publisher_page_size: PageSize,
 }
 
 impl Default for PublishSubscribe {
@@ -349,6 +377,7 @@ impl Default for PublishSubscribe {
             backpressure_strategy: BackpressureStrategy::RetryUntilDelivered,
             subscriber_expired_connection_buffer: 128,
             publisher_allocation_strategy: AllocationStrategy::Static,
+            publisher_page_size: PageSize::Regular,
         }
     }
 }
@@ -522,6 +551,18 @@ impl Default for Blackboard {
     }
 }
 
+/// Default settings for the [`WaitSet`](crate::waitset::WaitSet). These settings are used unless
+/// the user specifies custom settings in the [`WaitSetBuilder`](crate::waitset::WaitSetBuilder).
+#[non_exhaustive]
+#[derive(Serialize, Deserialize, Debug, Default, Clone, Eq, PartialEq)]
+#[serde(rename_all = "kebab-case")]
+#[serde(default)]
+pub struct WaitSet {
+    /// The [`ReactorBackend`] the [`WaitSet`](crate::waitset::WaitSet) uses to wait on its
+    /// attachments.
+    pub reactor_backend: ReactorBackend,
+}
+
 /// Represents the configuration that iceoryx2 will utilize. It is divided into two sections:
 /// the [`Global`] settings, which must align with the iceoryx2 instance the application intends to
 /// join, and the [`Defaults`] for communication within that iceoryx2 instance. The user has the
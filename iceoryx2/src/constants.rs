@@ -36,6 +36,12 @@ pub const MAX_TYPE_NAME_LENGTH: usize = 256;
 /// supports for the keytype.
 pub const MAX_BLACKBOARD_KEY_SIZE: usize = 64;
 
+/// The size to which entries of a
+/// [`MessagingPattern::Blackboard`](crate::service::static_config::messaging_pattern::MessagingPattern::Blackboard)
+/// are padded and aligned when cache line aligned entries are requested. Two cache lines of 64
+/// bytes are covered since the adjacent line prefetcher of common CPUs fetches them in pairs.
+pub const BLACKBOARD_CACHE_LINE_SIZE: usize = 128;
+
 /// The maximum alignment the [`MessagingPattern::Blackboard`](crate::service::static_config::messaging_pattern::MessagingPattern::Blackboard)
 /// supports for the keytype.
 pub const MAX_BLACKBOARD_KEY_ALIGNMENT: usize = 8;
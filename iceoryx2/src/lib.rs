@@ -497,6 +497,13 @@
 //!  * `dev_permissions` - The permissions of all resources will be set to read, write, execute
 //!    for everyone. This shall not be used in production and is meant to be enabled in a docker
 //!    environment with inconsistent user configuration.
+//!  * `fast_service_hash` - Service names are hashed with the non-cryptographic WyHash128
+//!    instead of Sha1. All processes of a deployment must use the same hash.
+//!  * `tracepoints` - Adds USDT probes of the provider `iceoryx2` to the loan, send, receive
+//!    and release paths of the ports, the notify and wake up of events and the dispatch of the
+//!    [`WaitSet`](crate::waitset::WaitSet), so that tools like `bpftrace` or `perf` can
+//!    correlate them with the kernel scheduler. Only available on Linux x86_64 and aarch64,
+//!    without the feature the probes are not compiled in at all.
 //!
 //! # Custom Configuration
 //!
@@ -546,6 +553,16 @@ pub mod request_mut_uninit;
 /// [`Server`](crate::port::server::Server) on a [`RequestMut`](crate::request_mut::RequestMut).
 pub mod response;
 
+/// A bounded cache of [`Response`](crate::response::Response)s for idempotent
+/// [`MessagingPattern::RequestResponse`](crate::service::messaging_pattern::MessagingPattern::RequestResponse)
+/// services.
+pub mod response_cache;
+
+/// Aggregates the [`Response`](crate::response::Response)s of all
+/// [`Server`](crate::port::server::Server)s to a request that was sent with
+/// [`Client::send_to_all()`](crate::port::client::Client::send_to_all()).
+pub mod response_gather;
+
 /// The answer a [`Server`](crate::port::server::Server) allocates to respond to
 /// a received [`RequestMut`](crate::request_mut::RequestMut) from a
 /// [`Client`](crate::port::client::Client)
@@ -565,6 +582,10 @@ pub mod sample_mut;
 /// The uninitialized payload that is sent by a [`Publisher`](crate::port::publisher::Publisher).
 pub mod sample_mut_uninit;
 
+/// Returns multiple received [`Sample`](crate::sample::Sample)s at once to their
+/// [`Publisher`](crate::port::publisher::Publisher)s.
+pub mod sample_release_batch;
+
 /// The foundation of communication the service with its
 /// [`MessagingPattern`](crate::service::messaging_pattern::MessagingPattern)
 pub mod service;
@@ -579,6 +600,12 @@ pub mod prelude;
 #[doc(hidden)]
 pub mod testing;
 
+pub(crate) mod tracepoint;
+
+/// A [`WaitSet`](crate::waitset::WaitSet) that processes the triggered attachments
+/// concurrently on a pool of threads.
+pub mod thread_pool_waitset;
+
 /// Event handling mechanism to wait on multiple [`Listener`](crate::port::listener::Listener)s
 /// in one call, realizing the reactor pattern. (Event multiplexer)
 pub mod waitset;
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::alloc::Layout;
+
+use alloc::vec::Vec;
+
+use iceoryx2_bb_posix::mutex::{Handle, Mutex, MutexBuilder, MutexHandle, MutexType};
+use iceoryx2_bb_posix::numa::NumaPolicy;
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_cal::shared_memory::PageSize;
+use iceoryx2_log::fatal_panic;
+
+use crate::identifiers::UniquePublisherId;
+use crate::service::service_hash::ServiceHash;
+
+/// Describes the properties a recycled data segment must match so that it can be reused by a
+/// new publisher.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct DataSegmentPoolKey {
+    pub(crate) service_hash: ServiceHash,
+    pub(crate) sample_layout: Layout,
+    pub(crate) number_of_samples: usize,
+    pub(crate) page_size: PageSize,
+    pub(crate) numa_policy: NumaPolicy,
+    pub(crate) typed_memory: Option<FilePath>,
+    pub(crate) lock_in_memory: bool,
+}
+
+#[derive(Debug)]
+struct Entry {
+    key: DataSegmentPoolKey,
+    publisher_id: UniquePublisherId,
+}
+
+/// Keeps the static data segments of dropped publishers alive so that the next publisher of
+/// the same service with an identical segment setup can reuse them instead of creating,
+/// truncating and faulting in a new segment.
+///
+/// A data segment is named after its publisher, therefore a recycled segment is identified by
+/// the [`UniquePublisherId`] of the publisher that created it. The port tag of that publisher
+/// remains under the [`Node`](crate::node::Node) so that the pooled resources are removed by
+/// the regular stale resource cleanup when the process crashes.
+#[derive(Debug)]
+pub(crate) struct DataSegmentPool {
+    capacity: usize,
+    handle: MutexHandle<Vec<Entry>>,
+}
+
+impl DataSegmentPool {
+    pub(crate) fn new(capacity: usize) -> Self {
+        let origin = "DataSegmentPool::new()";
+        let handle = MutexHandle::new();
+
+        fatal_panic!(
+            from origin,
+            when MutexBuilder::new()
+                .is_interprocess_capable(false)
+                .mutex_type(MutexType::Normal)
+                .create(Vec::with_capacity(capacity), &handle),
+            "Failed to create mutex"
+        );
+
+        Self { capacity, handle }
+    }
+
+    /// Returns true when data segments are recycled at all.
+    pub(crate) fn is_enabled(&self) -> bool {
+        self.capacity != 0
+    }
+
+    /// Adds the data segment of `publisher_id` to the pool when there is space left and
+    /// `release_resources` succeeds. The callback is called under the lock so that the segment
+    /// cannot be acquired before its owner has released it.
+    pub(crate) fn insert_with<F: FnOnce() -> bool>(
+        &self,
+        key: DataSegmentPoolKey,
+        publisher_id: UniquePublisherId,
+        release_resources: F,
+    ) -> bool {
+        if !self.is_enabled() {
+            return false;
+        }
+
+        let mut guard = fatal_panic!(
+            from self,
+            when self.mutex().lock(),
+            "Failed to lock mutex"
+        );
+
+        if guard.len() >= self.capacity || !release_resources() {
+            return false;
+        }
+
+        guard.push(Entry { key, publisher_id });
+        true
+    }
+
+    /// Removes and returns the id of a pooled data segment that matches `key`.
+    pub(crate) fn take(&self, key: &DataSegmentPoolKey) -> Option<UniquePublisherId> {
+        if !self.is_enabled() {
+            return None;
+        }
+
+        let mut guard = fatal_panic!(
+            from self,
+            when self.mutex().lock(),
+            "Failed to lock mutex"
+        );
+
+        let index = guard.iter().position(|entry| entry.key == *key)?;
+        Some(guard.swap_remove(index).publisher_id)
+    }
+
+    /// Removes all pooled entries and returns the ids of their data segments.
+    pub(crate) fn drain(&self) -> Vec<UniquePublisherId> {
+        let mut guard = fatal_panic!(
+            from self,
+            when self.mutex().lock(),
+            "Failed to lock mutex"
+        );
+
+        guard.drain(..).map(|entry| entry.publisher_id).collect()
+    }
+
+    fn mutex(&self) -> Mutex<'_, '_, Vec<Entry>> {
+        // Safe - the mutex is initialized when constructing the struct and
+        // not interacted with by anything else.
+        unsafe { Mutex::from_handle(&self.handle) }
+    }
+}
@@ -15,9 +15,13 @@ extern crate alloc;
 use crate::{config::Config, service::Service};
 use alloc::format;
 use iceoryx2_bb_concurrency::atomic::AtomicU32;
+use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_concurrency::atomic::AtomicUsize;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 use iceoryx2_bb_container::semantic_string::SemanticString;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_elementary::cache_aligned::CacheAligned;
 use iceoryx2_bb_elementary::package_version::PackageVersion;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_system_types::file_name::FileName;
@@ -28,10 +32,38 @@ use iceoryx2_log::fatal_panic;
 
 const GLOBAL_MGMT_NAME: FileName = unsafe { FileName::new_unchecked_const(b"node") };
 
-#[derive(Debug, Default, ZeroCopySend)]
+/// The maximum number of [`Node`](crate::node::Node)s of a domain that can publish a heartbeat
+/// at the same time.
+pub const MAX_NUMBER_OF_HEARTBEATS: usize = 1024;
+
+const HEARTBEAT_SLOT_FREE: u32 = 0;
+const HEARTBEAT_SLOT_CLAIMED: u32 = 1;
+const HEARTBEAT_SLOT_ACTIVE: u32 = 2;
+
+/// The heartbeat of a single node. Every slot occupies its own cache line so that the nodes
+/// do not contend when they bump their counters.
+#[derive(Debug, ZeroCopySend)]
+#[repr(C)]
+struct HeartbeatSlot {
+    state: AtomicU32,
+    node_id_low: AtomicU64,
+    node_id_high: AtomicU64,
+    counter: AtomicU64,
+}
+
+impl HeartbeatSlot {
+    fn node_id(&self) -> u128 {
+        ((self.node_id_high.load(Ordering::Relaxed) as u128) << 64)
+            | self.node_id_low.load(Ordering::Relaxed) as u128
+    }
+}
+
+#[derive(Debug, ZeroCopySend)]
 #[repr(C)]
 struct State {
     node_counter: AtomicU32,
+    reserved_shared_memory: AtomicUsize,
+    heartbeats: [CacheAligned<HeartbeatSlot>; MAX_NUMBER_OF_HEARTBEATS],
 }
 
 pub(crate) struct GlobalManagementSegment<S: Service> {
@@ -51,7 +83,11 @@ impl<S: Service> GlobalManagementSegment<S> {
         .has_ownership(false)
         .config(&config)
         .timeout(global_config.global.creation_timeout)
-        .initializer(|_, _| true)
+        .initializer(|state, _| {
+            // all counters start at zero and all heartbeat slots are free
+            unsafe { state.as_mut_ptr().write_bytes(0, 1) };
+            true
+        })
         .open_or_create()
         {
             Ok(storage) => storage,
@@ -93,6 +129,153 @@ impl<S: Service> GlobalManagementSegment<S> {
             .fetch_add(1, Ordering::Relaxed)
     }
 
+    /// Returns the number of bytes that are currently reserved by the data segments of the
+    /// domain.
+    pub fn reserved_shared_memory(&self) -> usize {
+        self.storage
+            .get()
+            .reserved_shared_memory
+            .load(Ordering::Relaxed)
+    }
+
+    /// Reserves `size` bytes for a data segment. Returns false when the reservation would
+    /// exceed the `quota`.
+    pub fn reserve_shared_memory(&self, size: usize, quota: usize) -> bool {
+        let reserved = &self.storage.get().reserved_shared_memory;
+        let mut current = reserved.load(Ordering::Relaxed);
+        loop {
+            match current.checked_add(size) {
+                Some(new) if new <= quota => {
+                    match reserved.compare_exchange_weak(
+                        current,
+                        new,
+                        Ordering::Relaxed,
+                        Ordering::Relaxed,
+                    ) {
+                        Ok(_) => return true,
+                        Err(v) => current = v,
+                    }
+                }
+                _ => return false,
+            }
+        }
+    }
+
+    /// Adds `size` bytes to the reservation without checking the quota. It is used when an
+    /// already existing data segment grows.
+    pub fn force_reserve_shared_memory(&self, size: usize) {
+        self.storage
+            .get()
+            .reserved_shared_memory
+            .fetch_add(size, Ordering::Relaxed);
+    }
+
+    /// Returns `size` previously reserved bytes.
+    pub fn release_shared_memory(&self, size: usize) {
+        let reserved = &self.storage.get().reserved_shared_memory;
+        let mut current = reserved.load(Ordering::Relaxed);
+        while let Err(v) = reserved.compare_exchange_weak(
+            current,
+            current.saturating_sub(size),
+            Ordering::Relaxed,
+            Ordering::Relaxed,
+        ) {
+            current = v;
+        }
+    }
+
+    /// Claims a free heartbeat slot for the node and returns its index. Returns [`None`] when
+    /// all [`MAX_NUMBER_OF_HEARTBEATS`] slots are in use.
+    pub fn claim_heartbeat(&self, node_id: u128) -> Option<usize> {
+        for (index, slot) in self.storage.get().heartbeats.iter().enumerate() {
+            if slot
+                .state
+                .compare_exchange(
+                    HEARTBEAT_SLOT_FREE,
+                    HEARTBEAT_SLOT_CLAIMED,
+                    Ordering::Relaxed,
+                    Ordering::Relaxed,
+                )
+                .is_ok()
+            {
+                slot.node_id_low.store(node_id as u64, Ordering::Relaxed);
+                slot.node_id_high
+                    .store((node_id >> 64) as u64, Ordering::Relaxed);
+                slot.counter.store(0, Ordering::Relaxed);
+                // publishes the node id to the monitors
+                slot.state.store(HEARTBEAT_SLOT_ACTIVE, Ordering::Release);
+                return Some(index);
+            }
+        }
+
+        None
+    }
+
+    /// Increments the heartbeat counter of the slot.
+    #[inline(always)]
+    pub fn beat(&self, index: usize) {
+        self.storage.get().heartbeats[index]
+            .counter
+            .fetch_add(1, Ordering::Relaxed);
+    }
+
+    /// Returns the heartbeat counter of the slot.
+    pub fn heartbeat_counter(&self, index: usize) -> u64 {
+        self.storage.get().heartbeats[index]
+            .counter
+            .load(Ordering::Relaxed)
+    }
+
+    /// Releases the heartbeat slot so that it can be claimed by another node.
+    pub fn release_heartbeat(&self, index: usize) {
+        self.storage.get().heartbeats[index]
+            .state
+            .store(HEARTBEAT_SLOT_FREE, Ordering::Release);
+    }
+
+    /// Releases the heartbeat slot of a node that died without releasing it.
+    pub fn release_heartbeat_of(&self, node_id: u128) {
+        let mut index = None;
+        self.for_each_heartbeat(|n, id, _| {
+            if id == node_id {
+                index = Some(n);
+                CallbackProgression::Stop
+            } else {
+                CallbackProgression::Continue
+            }
+        });
+
+        if let Some(index) = index {
+            self.release_heartbeat(index);
+        }
+    }
+
+    /// Calls the callback with the slot index, the node id and the heartbeat counter of every
+    /// node that publishes a heartbeat.
+    pub fn for_each_heartbeat<F: FnMut(usize, u128, u64) -> CallbackProgression>(
+        &self,
+        mut callback: F,
+    ) {
+        for (index, slot) in self.storage.get().heartbeats.iter().enumerate() {
+            if slot.state.load(Ordering::Acquire) != HEARTBEAT_SLOT_ACTIVE {
+                continue;
+            }
+
+            let node_id = slot.node_id();
+            let counter = slot.counter.load(Ordering::Relaxed);
+            // the slot could be released and claimed by another node while it was read
+            if slot.state.load(Ordering::Acquire) != HEARTBEAT_SLOT_ACTIVE
+                || slot.node_id() != node_id
+            {
+                continue;
+            }
+
+            if callback(index, node_id, counter) == CallbackProgression::Stop {
+                break;
+            }
+        }
+    }
+
     fn dynamic_storage_config(
         global_config: &Config,
     ) -> <S::PersistentDynamicStorage<State> as NamedConceptMgmt>::Configuration {
@@ -109,3 +292,93 @@ impl<S: Service> GlobalManagementSegment<S> {
             .path_hint(global_config.global.root_path())
     }
 }
+
+/// The bytes a [`DataSegment`](crate::port::details::data_segment::DataSegment) reserved from
+/// the [`Global::shared_memory_quota`](crate::config::Global::shared_memory_quota) of its domain. The
+/// reservation is returned when it goes out of scope.
+pub(crate) struct SharedMemoryReservation<S: Service> {
+    segment: GlobalManagementSegment<S>,
+    size: AtomicUsize,
+}
+
+impl<S: Service> core::fmt::Debug for SharedMemoryReservation<S> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "SharedMemoryReservation {{ size: {} }}",
+            self.size.load(Ordering::Relaxed)
+        )
+    }
+}
+
+impl<S: Service> SharedMemoryReservation<S> {
+    /// Reserves `size` bytes when a [`Global::shared_memory_quota`](crate::config::Global::shared_memory_quota)
+    /// is configured. Returns [`None`] when no quota is configured and [`Err`] when the
+    /// reservation would exceed it.
+    pub(crate) fn reserve(
+        global_config: &Config,
+        size: usize,
+    ) -> Result<Option<Self>, SharedMemoryReservationError> {
+        let origin = "SharedMemoryReservation::reserve()";
+        let quota = match global_config.global.shared_memory_quota {
+            Some(quota) => quota,
+            None => return Ok(None),
+        };
+
+        let segment = match GlobalManagementSegment::<S>::open_or_create(global_config) {
+            Ok(segment) => segment,
+            Err(e) => {
+                fail!(from origin, with SharedMemoryReservationError::UnableToOpenManagementSegment,
+                    "Unable to reserve {size} bytes since the global management segment could not be opened ({e:?}).");
+            }
+        };
+
+        if !segment.reserve_shared_memory(size, quota) {
+            fail!(from origin, with SharedMemoryReservationError::QuotaExceeded,
+                "Unable to reserve {size} bytes since the shared memory quota of {quota} bytes would be exceeded ({} bytes are already reserved).",
+                segment.reserved_shared_memory());
+        }
+
+        Ok(Some(Self {
+            segment,
+            size: AtomicUsize::new(size),
+        }))
+    }
+
+    /// Accounts `size` bytes of an already existing data segment without checking the quota.
+    /// Returns [`None`] when no quota is configured or the quota cannot be tracked.
+    pub(crate) fn track(global_config: &Config, size: usize) -> Option<Self> {
+        global_config.global.shared_memory_quota?;
+        let segment = GlobalManagementSegment::<S>::open_or_create(global_config).ok()?;
+        segment.force_reserve_shared_memory(size);
+
+        Some(Self {
+            segment,
+            size: AtomicUsize::new(size),
+        })
+    }
+
+    /// Adjusts the reservation to the current `size` of the data segment.
+    pub(crate) fn update(&self, size: usize) {
+        let previous = self.size.swap(size, Ordering::Relaxed);
+        if size > previous {
+            self.segment.force_reserve_shared_memory(size - previous);
+        } else if size < previous {
+            self.segment.release_shared_memory(previous - size);
+        }
+    }
+}
+
+impl<S: Service> Drop for SharedMemoryReservation<S> {
+    fn drop(&mut self) {
+        self.segment
+            .release_shared_memory(self.size.load(Ordering::Relaxed));
+    }
+}
+
+/// Failures that can occur in [`SharedMemoryReservation::reserve()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) enum SharedMemoryReservationError {
+    QuotaExceeded,
+    UnableToOpenManagementSegment,
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Every [`Node`](crate::node::Node) owns a heartbeat counter in the global management segment
+//! of its domain. The counter is incremented with every [`Node::wait()`](crate::node::Node::wait())
+//! call or explicitly with [`Node::heartbeat()`](crate::node::Node::heartbeat()). A
+//! [`HeartbeatMonitor`] reads the counters of all [`Node`](crate::node::Node)s at its own rate.
+//! A [`Node`](crate::node::Node) whose counter did not change between two scans missed its
+//! heartbeat. Neither the heartbeat nor the scan requires a system call or wakes up a process.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::node::heartbeat::HeartbeatMonitor;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let monitor = HeartbeatMonitor::<ipc::Service>::new(node.config())?;
+//!
+//! node.heartbeat();
+//!
+//! monitor.list(|node_id, counter| {
+//!     println!("node {node_id} has the heartbeat counter {counter}");
+//!     CallbackProgression::Continue
+//! });
+//! # Ok(())
+//! # }
+//! ```
+
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_log::{fail, warn};
+
+use crate::config::Config;
+use crate::identifiers::UniqueNodeId;
+use crate::node::global_management_segment::GlobalManagementSegment;
+use crate::service::Service;
+
+pub use crate::node::global_management_segment::MAX_NUMBER_OF_HEARTBEATS;
+
+/// Failures that can occur when a [`HeartbeatMonitor`] is created.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum HeartbeatMonitorCreateError {
+    /// The global management segment, which contains the heartbeats, could not be opened.
+    UnableToOpenManagementSegment,
+}
+
+impl core::fmt::Display for HeartbeatMonitorCreateError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "HeartbeatMonitorCreateError::{self:?}")
+    }
+}
+
+impl core::error::Error for HeartbeatMonitorCreateError {}
+
+/// Reads the heartbeat counters of all [`Node`](crate::node::Node)s of a domain.
+pub struct HeartbeatMonitor<S: Service> {
+    segment: GlobalManagementSegment<S>,
+}
+
+impl<S: Service> core::fmt::Debug for HeartbeatMonitor<S> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "HeartbeatMonitor<{}> {{ }}", core::any::type_name::<S>())
+    }
+}
+
+impl<S: Service> HeartbeatMonitor<S> {
+    /// Creates a new [`HeartbeatMonitor`] for the domain defined by the [`Config`].
+    pub fn new(config: &Config) -> Result<Self, HeartbeatMonitorCreateError> {
+        match GlobalManagementSegment::<S>::open_or_create(config) {
+            Ok(segment) => Ok(Self { segment }),
+            Err(e) => {
+                fail!(from "HeartbeatMonitor::new()", with HeartbeatMonitorCreateError::UnableToOpenManagementSegment,
+                    "Unable to create heartbeat monitor since the global management segment could not be opened. [{e:?}]");
+            }
+        }
+    }
+
+    /// Returns the heartbeat counter of the [`Node`](crate::node::Node) with the provided
+    /// [`UniqueNodeId`] or [`None`] when the [`Node`](crate::node::Node) does not publish a
+    /// heartbeat.
+    pub fn counter(&self, node_id: &UniqueNodeId) -> Option<u64> {
+        let mut ret_val = None;
+        self.segment.for_each_heartbeat(|_, id, counter| {
+            if id == node_id.value() {
+                ret_val = Some(counter);
+                CallbackProgression::Stop
+            } else {
+                CallbackProgression::Continue
+            }
+        });
+
+        ret_val
+    }
+
+    /// Calls the callback with the [`UniqueNodeId`] and the heartbeat counter of every
+    /// [`Node`](crate::node::Node) that publishes a heartbeat.
+    pub fn list<F: FnMut(&UniqueNodeId, u64) -> CallbackProgression>(&self, mut callback: F) {
+        self.segment
+            .for_each_heartbeat(|_, id, counter| callback(&UniqueNodeId(id.into()), counter));
+    }
+}
+
+/// The heartbeat slot that is owned by a [`Node`](crate::node::Node). It is released when it
+/// goes out of scope.
+pub(crate) struct NodeHeartbeat<S: Service> {
+    segment: GlobalManagementSegment<S>,
+    index: usize,
+}
+
+impl<S: Service> core::fmt::Debug for NodeHeartbeat<S> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "NodeHeartbeat {{ index: {} }}", self.index)
+    }
+}
+
+impl<S: Service> NodeHeartbeat<S> {
+    /// Claims a heartbeat slot for the node. Returns [`None`] when the global management
+    /// segment is not accessible or all slots are in use, the node works without a heartbeat
+    /// in this case.
+    pub(crate) fn new(config: &Config, node_id: &UniqueNodeId) -> Option<Self> {
+        let origin = "NodeHeartbeat::new()";
+        let segment = match GlobalManagementSegment::<S>::open_or_create(config) {
+            Ok(segment) => segment,
+            Err(e) => {
+                warn!(from origin,
+                    "The node {node_id} has no heartbeat since the global management segment could not be opened. [{e:?}]");
+                return None;
+            }
+        };
+
+        match segment.claim_heartbeat(node_id.value()) {
+            Some(index) => Some(Self { segment, index }),
+            None => {
+                warn!(from origin,
+                    "The node {node_id} has no heartbeat since all {MAX_NUMBER_OF_HEARTBEATS} heartbeat slots are in use.");
+                None
+            }
+        }
+    }
+
+    #[inline(always)]
+    pub(crate) fn beat(&self) {
+        self.segment.beat(self.index);
+    }
+
+    pub(crate) fn counter(&self) -> u64 {
+        self.segment.heartbeat_counter(self.index)
+    }
+}
+
+impl<S: Service> Drop for NodeHeartbeat<S> {
+    fn drop(&mut self) {
+        self.segment.release_heartbeat(self.index);
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Restricts the [`Node`](crate::node::Node)s that are provided by
+//! [`Node::list_filtered()`](crate::node::Node::list_filtered()).
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::node::list_filter::{NodeListFilter, NodeStateFilter};
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let filter = NodeListFilter::new()
+//!     .state(NodeStateFilter::Alive)
+//!     .name_prefix("camera_")
+//!     .offset(10)
+//!     .limit(10);
+//!
+//! Node::<ipc::Service>::list_filtered(Config::global_config(), &filter, |node_state| {
+//!     println!("found node {:?}", node_state);
+//!     CallbackProgression::Continue
+//! })?;
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::string::String;
+
+use crate::identifiers::UniqueNodeId;
+use crate::node::NodeDetails;
+
+/// Defines the [`NodeState`](crate::node::NodeState) a [`Node`](crate::node::Node) must have to
+/// be listed.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum NodeStateFilter {
+    /// Only [`NodeState::Alive`](crate::node::NodeState::Alive) [`Node`](crate::node::Node)s
+    Alive,
+    /// Only [`NodeState::Dead`](crate::node::NodeState::Dead) [`Node`](crate::node::Node)s
+    Dead,
+    /// Only [`NodeState::Inaccessible`](crate::node::NodeState::Inaccessible)
+    /// [`Node`](crate::node::Node)s
+    Inaccessible,
+    /// Only [`NodeState::Undefined`](crate::node::NodeState::Undefined)
+    /// [`Node`](crate::node::Node)s
+    Undefined,
+}
+
+/// Restricts the [`Node`](crate::node::Node)s that are provided by
+/// [`Node::list_filtered()`](crate::node::Node::list_filtered()). The filter criteria are
+/// checked from the cheapest to the most expensive one, so the details of a
+/// [`Node`](crate::node::Node) are only read when its id and state match.
+///
+/// The matching [`Node`](crate::node::Node)s are ordered by their [`UniqueNodeId`], so that the list can be
+/// paginated with [`NodeListFilter::offset()`] and [`NodeListFilter::limit()`].
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct NodeListFilter {
+    node_id: Option<UniqueNodeId>,
+    state: Option<NodeStateFilter>,
+    name_prefix: Option<String>,
+    offset: usize,
+    limit: Option<usize>,
+}
+
+impl NodeListFilter {
+    /// Creates a new [`NodeListFilter`] that matches all [`Node`](crate::node::Node)s.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Lists only the [`Node`](crate::node::Node) with the provided [`UniqueNodeId`].
+    pub fn node_id(mut self, value: UniqueNodeId) -> Self {
+        self.node_id = Some(value);
+        self
+    }
+
+    /// Lists only the [`Node`](crate::node::Node)s that are in the provided state.
+    pub fn state(mut self, value: NodeStateFilter) -> Self {
+        self.state = Some(value);
+        self
+    }
+
+    /// Lists only the [`Node`](crate::node::Node)s whose
+    /// [`NodeName`](crate::node::node_name::NodeName) starts with the provided prefix.
+    /// [`Node`](crate::node::Node)s without readable [`NodeDetails`] never match.
+    pub fn name_prefix(mut self, value: &str) -> Self {
+        self.name_prefix = Some(String::from(value));
+        self
+    }
+
+    /// Skips the first `value` matching [`Node`](crate::node::Node)s.
+    pub fn offset(mut self, value: usize) -> Self {
+        self.offset = value;
+        self
+    }
+
+    /// Lists at most `value` matching [`Node`](crate::node::Node)s.
+    pub fn limit(mut self, value: usize) -> Self {
+        self.limit = Some(value);
+        self
+    }
+
+    pub(crate) fn selected_node_id(&self) -> Option<&UniqueNodeId> {
+        self.node_id.as_ref()
+    }
+
+    pub(crate) fn selected_offset(&self) -> usize {
+        self.offset
+    }
+
+    pub(crate) fn selected_limit(&self) -> Option<usize> {
+        self.limit
+    }
+
+    pub(crate) fn requires_details(&self) -> bool {
+        self.name_prefix.is_some()
+    }
+
+    pub(crate) fn matches_state(&self, state: NodeStateFilter) -> bool {
+        self.state.is_none_or(|v| v == state)
+    }
+
+    pub(crate) fn matches_details(&self, details: &Option<NodeDetails>) -> bool {
+        match &self.name_prefix {
+            None => true,
+            Some(prefix) => details
+                .as_ref()
+                .is_some_and(|d| d.name().as_str().starts_with(prefix.as_str())),
+        }
+    }
+}
@@ -139,9 +139,14 @@
 //! # }
 //! ```
 
+pub(crate) mod data_segment_pool;
 pub(crate) mod global_management_segment;
+/// Heartbeat counters that monitor the liveness of [`Node`]s without system calls.
+pub mod heartbeat;
 /// The name for a node.
+pub mod list_filter;
 pub mod node_name;
+pub(crate) mod service_hash_cache;
 
 use core::fmt::Debug;
 use core::marker::PhantomData;
@@ -151,7 +156,6 @@ use iceoryx2_bb_concurrency::atomic::Ordering;
 
 use alloc::collections::BTreeMap;
 use alloc::format;
-use alloc::string::String;
 use alloc::string::ToString;
 use alloc::sync::Arc;
 use alloc::vec;
@@ -185,8 +189,12 @@ use iceoryx2_cal::{
 use iceoryx2_log::{debug, fail, fatal_panic, trace, warn};
 
 use crate::identifiers::UniqueNodeId;
+use crate::node::data_segment_pool::DataSegmentPool;
 use crate::node::global_management_segment::GlobalManagementSegment;
+use crate::node::heartbeat::NodeHeartbeat;
+use crate::node::list_filter::{NodeListFilter, NodeStateFilter};
 use crate::node::node_name::NodeName;
+use crate::node::service_hash_cache::ServiceHashCache;
 use crate::prelude::MessagingPattern;
 use crate::service::ServiceRemoveError;
 use crate::service::builder::{Builder, OpenDynamicStorageFailure};
@@ -397,26 +405,66 @@ impl<Service: service::Service> NodeState<Service> {
         node_id: &UniqueNodeId,
         config: &Config,
     ) -> Result<Option<Self>, NodeListFailure> {
-        let details = Node::<Service>::get_node_details(config, node_id).unwrap_or_default();
-
-        let node_view = AliveNodeView::<Service> {
-            id: *node_id,
-            details,
-            _service: PhantomData,
-        };
+        Self::new_if_matching(node_id, config, &NodeListFilter::default())
+    }
 
+    fn acquire_state(
+        node_id: &UniqueNodeId,
+        config: &Config,
+    ) -> Result<Option<NodeStateFilter>, NodeListFailure> {
         match Node::<Service>::get_node_state(config, node_id) {
             Ok(State::DoesNotExist) => Ok(None),
-            Ok(State::Alive) => Ok(Some(NodeState::Alive(node_view))),
-            Ok(State::Dead) => Ok(Some(NodeState::Dead(DeadNodeView(node_view)))),
+            Ok(State::Alive) => Ok(Some(NodeStateFilter::Alive)),
+            Ok(State::Dead) => Ok(Some(NodeStateFilter::Dead)),
             Err(NodeListFailure::InsufficientPermissions) => {
-                Ok(Some(NodeState::Inaccessible(*node_id)))
+                Ok(Some(NodeStateFilter::Inaccessible))
             }
-            Err(NodeListFailure::InternalError) => Ok(Some(NodeState::Undefined(*node_id))),
+            Err(NodeListFailure::InternalError) => Ok(Some(NodeStateFilter::Undefined)),
             Err(e) => Err(e),
         }
     }
 
+    /// Returns the [`NodeState`] when the [`Node`] matches the [`NodeListFilter`]. The
+    /// [`NodeDetails`] are read only when the state of the [`Node`] matches.
+    pub(crate) fn new_if_matching(
+        node_id: &UniqueNodeId,
+        config: &Config,
+        filter: &NodeListFilter,
+    ) -> Result<Option<Self>, NodeListFailure> {
+        let state = match Self::acquire_state(node_id, config)? {
+            Some(state) => state,
+            None => return Ok(None),
+        };
+
+        if !filter.matches_state(state) {
+            return Ok(None);
+        }
+
+        let details = match state {
+            NodeStateFilter::Alive | NodeStateFilter::Dead => {
+                Node::<Service>::get_node_details(config, node_id).unwrap_or_default()
+            }
+            NodeStateFilter::Inaccessible | NodeStateFilter::Undefined => None,
+        };
+
+        if !filter.matches_details(&details) {
+            return Ok(None);
+        }
+
+        let node_view = AliveNodeView::<Service> {
+            id: *node_id,
+            details,
+            _service: PhantomData,
+        };
+
+        Ok(Some(match state {
+            NodeStateFilter::Alive => NodeState::Alive(node_view),
+            NodeStateFilter::Dead => NodeState::Dead(DeadNodeView(node_view)),
+            NodeStateFilter::Inaccessible => NodeState::Inaccessible(*node_id),
+            NodeStateFilter::Undefined => NodeState::Undefined(*node_id),
+        }))
+    }
+
     /// Returns the [`UniqueNodeId`] of the corresponding [`Node`].
     pub fn node_id(&self) -> &UniqueNodeId {
         match self {
@@ -499,6 +547,28 @@ impl<Service: service::Service> NodeView for DeadNodeView<Service> {
 }
 
 impl<Service: service::Service> DeadNodeView<Service> {
+    /// Returns the [`DeadNodeView`] of the [`Node`] if it is dead. In contrast to
+    /// [`NodeState::new()`] the [`NodeDetails`] are only read when the [`Node`] is dead.
+    pub(crate) fn new_if_dead(node_id: &UniqueNodeId, config: &Config) -> Option<Self> {
+        match Node::<Service>::get_node_state(config, node_id) {
+            Ok(State::Dead) => Some(DeadNodeView(AliveNodeView {
+                id: *node_id,
+                details: Node::<Service>::get_node_details(config, node_id).unwrap_or_default(),
+                _service: PhantomData,
+            })),
+            _ => None,
+        }
+    }
+
+    /// Returns true if the [`Node`] is dead. In contrast to [`DeadNodeView::new_if_dead()`]
+    /// the [`NodeDetails`] are not read.
+    pub(crate) fn is_dead(node_id: &UniqueNodeId, config: &Config) -> bool {
+        matches!(
+            Node::<Service>::get_node_state(config, node_id),
+            Ok(State::Dead)
+        )
+    }
+
     #[doc(hidden)]
     pub fn __internal_try_remove_stale_resources(
         id: UniqueNodeId,
@@ -707,6 +777,10 @@ impl<Service: service::Service> DeadNodeView<Service> {
 
         cleanup_failure?;
 
+        if let Ok(segment) = GlobalManagementSegment::<Service>::open_or_create(config) {
+            segment.release_heartbeat_of(self.id().value());
+        }
+
         match remove_node::<Service>(*self.id(), config) {
             Ok(_) => {
                 drop(cleaner);
@@ -943,7 +1017,10 @@ struct SharedNodeState<Service: service::Service> {
     details: NodeDetails,
     monitoring_token: UnsafeCell<Option<<Service::Monitoring as Monitoring>::Token>>,
     registered_services: RegisteredServices,
+    service_hashes: ServiceHashCache,
+    data_segment_pool: DataSegmentPool,
     signal_handling_mode: SignalHandlingMode,
+    heartbeat: Option<NodeHeartbeat<Service>>,
     details_storage: Service::StaticStorage,
 }
 
@@ -979,38 +1056,49 @@ impl<Service: service::Service> SharedNodeState<Service> {
             core::any::type_name::<Service>()
         );
 
-        let cleanup_call = |node_state| {
-            if let NodeState::Dead(dead_node) = node_state {
-                let node_id = *dead_node.id();
-                debug!(from origin, "Dead node ({:?}) detected", node_id);
-                match dead_node.blocking_remove_stale_resources(timeout) {
-                    Ok(_) => {
-                        cleanup_state.cleanups += 1;
-                        trace!(from origin, "The dead node ({:?}) was successfully removed.", node_id)
-                    }
-                    Err(e) => {
-                        cleanup_state.failed_cleanups += 1;
-                        trace!(from origin, "Unable to remove dead node {:?} ({:?}).", node_id, e)
-                    }
-                }
+        // only the monitoring state is acquired for every node, the node details are read
+        // exclusively for the dead nodes that have to be cleaned up
+        let node_ids = match Node::<Service>::list_node_ids(&self.details.config) {
+            Ok(node_ids) => node_ids,
+            Err(e) => {
+                debug!(from origin, "Unable to perform a full scan for dead nodes since the all existing nodes could not be listed ({:?}).", e);
+                return cleanup_state;
             }
-
-            CallbackProgression::Continue
         };
 
-        match Node::<Service>::list(&self.details.config, cleanup_call) {
-            Ok(()) => cleanup_state,
-            Err(e) => {
-                debug!(from origin, "Unable to perform a full scan for dead nodes since the all existing nodes could not be listed ({:?}).", e);
-                cleanup_state
+        for node_id in node_ids.iter().filter(|node_id| **node_id != self.id) {
+            let dead_node =
+                match DeadNodeView::<Service>::new_if_dead(node_id, &self.details.config) {
+                    Some(dead_node) => dead_node,
+                    None => continue,
+                };
+
+            debug!(from origin, "Dead node ({:?}) detected", node_id);
+            match dead_node.blocking_remove_stale_resources(timeout) {
+                Ok(_) => {
+                    cleanup_state.cleanups += 1;
+                    trace!(from origin, "The dead node ({:?}) was successfully removed.", node_id)
+                }
+                Err(e) => {
+                    cleanup_state.failed_cleanups += 1;
+                    trace!(from origin, "Unable to remove dead node {:?} ({:?}).", node_id, e)
+                }
             }
         }
+
+        cleanup_state
     }
 }
 
 impl<Service: service::Service> Drop for SharedNodeState<Service> {
     fn drop(&mut self) {
         let config = self.details.config();
+        for publisher_id in self.data_segment_pool.drain() {
+            warn!(from self,
+                when unsafe { remove_stale_port_resources::<Service>(&self.id, publisher_id.value(), config) },
+                "Unable to remove the pooled data segment of the publisher {:?}.", publisher_id);
+        }
+
         if self.monitoring_token.get_mut().is_some() {
             if config.global.node.cleanup_dead_nodes_on_destruction {
                 self.blocking_cleanup_dead_nodes(Duration::ZERO);
@@ -1053,6 +1141,21 @@ impl<Service: service::Service> SharedNode<Service> {
         &self.state.registered_services
     }
 
+    /// Returns the [`ServiceHash`] of the service, it is computed only on the first access.
+    pub(crate) fn service_hash(
+        &self,
+        service_name: &ServiceName,
+        messaging_pattern: MessagingPattern,
+    ) -> ServiceHash {
+        self.state
+            .service_hashes
+            .get::<Service::ServiceNameHasher>(service_name, messaging_pattern)
+    }
+
+    pub(crate) fn data_segment_pool(&self) -> &DataSegmentPool {
+        &self.state.data_segment_pool
+    }
+
     pub(crate) fn name(&self) -> &NodeName {
         &self.state.details.name
     }
@@ -1081,6 +1184,34 @@ impl<Service: service::Service> SharedNode<Service> {
         }
     }
 
+    /// Opens the port tag of a port whose resources were kept for reuse and takes over its
+    /// ownership.
+    pub(crate) fn adopt_port_tag(
+        &self,
+        origin: &str,
+        msg: &str,
+        port_id: u128,
+    ) -> Result<Service::StaticStorage, StaticStorageOpenError> {
+        let name = FileName::new(port_id.to_string().as_bytes())
+            .expect("A number is always a valid file name.");
+
+        match <<Service::StaticStorage as StaticStorage>::Builder as NamedConceptBuilder<
+            Service::StaticStorage,
+        >>::new(&name)
+        .config(&port_tag_config::<Service>(self.config(), self.id()))
+        .open(Duration::ZERO)
+        {
+            Ok(static_storage) => {
+                static_storage.acquire_ownership();
+                Ok(static_storage)
+            }
+            Err(e) => {
+                fail!(from origin, with e,
+                    "{msg} since the port tag could not be opened. [{e:?}]");
+            }
+        }
+    }
+
     pub(crate) fn create_service_tag<T: Debug + ?Sized>(
         &self,
         origin: &T,
@@ -1163,41 +1294,121 @@ impl<Service: service::Service> Node<Service> {
     ) -> Result<(), NodeListFailure> {
         let msg = "Unable to iterate over Node list";
         let origin = "Node::list()";
-        let monitoring_config = node_monitoring_config::<Service>(config);
 
-        match Self::list_all_nodes(&monitoring_config) {
-            Ok(node_list) => {
-                for node_name in node_list {
-                    let node_id = core::str::from_utf8(node_name.as_bytes()).unwrap();
-                    let node_id = match node_id.parse::<u128>() {
-                        Ok(v) => UniqueNodeId(v.into()),
-                        // not bad, just found a file that is not a node
-                        Err(_) => continue,
-                    };
-
-                    match NodeState::new(&node_id, config) {
-                        Ok(Some(node_state)) => {
-                            if callback(node_state) == CallbackProgression::Stop {
-                                break;
-                            }
-                        }
-                        Ok(None) => (),
-                        Err(e) => {
-                            fail!(from origin, with e,
-                                "{msg} since the following error occurred ({:?}).", e);
-                        }
+        let node_ids = fail!(from origin, when Self::list_node_ids(config),
+            "{msg} since the node list could not be acquired.");
+
+        for node_id in node_ids {
+            match NodeState::new(&node_id, config) {
+                Ok(Some(node_state)) => {
+                    if callback(node_state) == CallbackProgression::Stop {
+                        break;
                     }
                 }
+                Ok(None) => (),
+                Err(e) => {
+                    fail!(from origin, with e,
+                        "{msg} since the following error occurred ({:?}).", e);
+                }
             }
-            Err(e) => {
-                fail!(from origin, with e,
-                    "{msg} since the node list could not be acquired ({:?}).", e);
+        }
+
+        Ok(())
+    }
+
+    /// Calls the provided callback for all [`Node`]s in the system under a given [`Config`]
+    /// that match the [`NodeListFilter`]. In contrast to [`Node::list()`], the [`NodeDetails`]
+    /// are only read for [`Node`]s whose id and state match. The matching [`Node`]s are
+    /// provided in the order of their [`UniqueNodeId`].
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// use iceoryx2::node::list_filter::{NodeListFilter, NodeStateFilter};
+    ///
+    /// let filter = NodeListFilter::new().state(NodeStateFilter::Dead);
+    /// Node::<ipc::Service>::list_filtered(Config::global_config(), &filter, |node_state| {
+    ///     println!("found dead node {:?}", node_state);
+    ///     CallbackProgression::Continue
+    /// });
+    /// ```
+    pub fn list_filtered<F: FnMut(NodeState<Service>) -> CallbackProgression>(
+        config: &Config,
+        filter: &NodeListFilter,
+        mut callback: F,
+    ) -> Result<(), NodeListFailure> {
+        let msg = "Unable to iterate over the filtered Node list";
+        let origin = "Node::list_filtered()";
+
+        let node_ids = match filter.selected_node_id() {
+            Some(node_id) => vec![*node_id],
+            None => {
+                let mut node_ids = fail!(from origin, when Self::list_node_ids(config),
+                    "{msg} since the node list could not be acquired.");
+                node_ids.sort_unstable();
+                node_ids
+            }
+        };
+
+        let mut number_of_skipped_nodes = 0;
+        let mut number_of_listed_nodes = 0;
+        for node_id in node_ids {
+            if filter
+                .selected_limit()
+                .is_some_and(|limit| number_of_listed_nodes >= limit)
+            {
+                break;
+            }
+
+            // the details are not required to check the offset, therefore they do not need to
+            // be read for the skipped nodes unless the filter demands it
+            if number_of_skipped_nodes < filter.selected_offset() && !filter.requires_details() {
+                match NodeState::<Service>::acquire_state(&node_id, config) {
+                    Ok(Some(state)) if filter.matches_state(state) => number_of_skipped_nodes += 1,
+                    Ok(_) => (),
+                    Err(e) => {
+                        fail!(from origin, with e,
+                            "{msg} since the following error occurred ({:?}).", e);
+                    }
+                }
+                continue;
+            }
+
+            let node_state = match NodeState::new_if_matching(&node_id, config, filter) {
+                Ok(Some(node_state)) => node_state,
+                Ok(None) => continue,
+                Err(e) => {
+                    fail!(from origin, with e,
+                        "{msg} since the following error occurred ({:?}).", e);
+                }
+            };
+
+            if number_of_skipped_nodes < filter.selected_offset() {
+                number_of_skipped_nodes += 1;
+                continue;
+            }
+
+            number_of_listed_nodes += 1;
+            if callback(node_state) == CallbackProgression::Stop {
+                break;
             }
         }
 
         Ok(())
     }
 
+    /// Returns the number of [`Node`]s in the system under a given [`Config`] without
+    /// acquiring their state or reading their [`NodeDetails`]. Therefore, dead [`Node`]s and
+    /// [`Node`]s that are currently created are counted as well.
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// let number_of_nodes = Node::<ipc::Service>::count(Config::global_config());
+    /// ```
+    pub fn count(config: &Config) -> Result<usize, NodeListFailure> {
+        let node_ids = fail!(from "Node::count()", when Self::list_node_ids(config),
+            "Unable to count all nodes since the node list could not be acquired.");
+
+        Ok(node_ids.len())
+    }
+
     fn handle_termination_request(&self, error_msg: &str) -> Result<(), NodeWaitFailure> {
         if self.signal_handling_mode() == SignalHandlingMode::HandleTerminationRequests
             && SignalHandler::termination_requested()
@@ -1214,6 +1425,7 @@ impl<Service: service::Service> Node<Service> {
     /// signal was received.
     pub fn wait(&self, cycle_time: Duration) -> Result<(), NodeWaitFailure> {
         let msg = "Unable to wait on node";
+        self.heartbeat();
         self.handle_termination_request(msg)?;
 
         match nanosleep(cycle_time) {
@@ -1233,6 +1445,26 @@ impl<Service: service::Service> Node<Service> {
         }
     }
 
+    /// Increments the heartbeat counter of the [`Node`], see [`heartbeat`]. It is called by
+    /// every [`Node::wait()`] and can be called explicitly by a [`Node`] that runs its own
+    /// event loop. It costs a single atomic increment.
+    pub fn heartbeat(&self) {
+        if let Some(heartbeat) = &self.shared.state.heartbeat {
+            heartbeat.beat();
+        }
+    }
+
+    /// Returns the current heartbeat counter of the [`Node`] or [`None`] when the [`Node`] has
+    /// no heartbeat since all [`heartbeat::MAX_NUMBER_OF_HEARTBEATS`] slots of the domain are
+    /// in use.
+    pub fn heartbeat_counter(&self) -> Option<u64> {
+        self.shared
+            .state
+            .heartbeat
+            .as_ref()
+            .map(|heartbeat| heartbeat.counter())
+    }
+
     /// Returns the [`SignalHandlingMode`] with which the [`Node`] was created.
     pub fn signal_handling_mode(&self) -> SignalHandlingMode {
         self.shared.state.signal_handling_mode
@@ -1277,6 +1509,22 @@ impl<Service: service::Service> Node<Service> {
         unsafe { Service::__internal_force_remove_service(name, self.config(), messaging_pattern) }
     }
 
+    fn list_node_ids(config: &Config) -> Result<Vec<UniqueNodeId>, NodeListFailure> {
+        let monitoring_config = node_monitoring_config::<Service>(config);
+
+        Ok(Self::list_all_nodes(&monitoring_config)?
+            .iter()
+            .filter_map(|node_name| {
+                core::str::from_utf8(node_name.as_bytes())
+                    .ok()?
+                    .parse::<u128>()
+                    // not bad, just found a file that is not a node
+                    .ok()
+                    .map(|v| UniqueNodeId(v.into()))
+            })
+            .collect())
+    }
+
     fn list_all_nodes(
         config: &<Service::Monitoring as NamedConceptMgmt>::Configuration,
     ) -> Result<Vec<FileName>, NodeListFailure> {
@@ -1407,22 +1655,18 @@ impl<Service: service::Service> Node<Service> {
             return Ok(None);
         };
 
-        let mut read_content =
-            String::from_utf8(vec![b' '; node_storage.len() as usize]).expect("");
+        let mut read_content = vec![0u8; node_storage.len() as usize];
 
         let origin = format!("get_node_details({config:?}, {node_id:?})");
         let msg = "Unable to read node details";
 
-        if node_storage
-            .read(unsafe { read_content.as_mut_vec() }.as_mut_slice())
-            .is_err()
-        {
+        if node_storage.read(read_content.as_mut_slice()).is_err() {
             fail!(from origin, with NodeReadStorageFailure::ReadError,
                 "{} since the content of the node config storage could not be read.", msg);
         }
 
         let node_details = fail!(from origin,
-                    when Service::ConfigSerializer::deserialize::<NodeDetails>(unsafe { read_content.as_mut_vec()}),
+                    when Service::ConfigSerializer::deserialize::<NodeDetails>(&read_content),
                     with NodeReadStorageFailure::Corrupted,
                 "{} since the contents of the node config storage is corrupted.", msg);
 
@@ -1515,6 +1759,7 @@ pub struct NodeBuilder {
     name: Option<NodeName>,
     signal_handling_mode: SignalHandlingMode,
     config: Option<Config>,
+    data_segment_pool_capacity: usize,
 }
 
 impl NodeBuilder {
@@ -1544,6 +1789,18 @@ impl NodeBuilder {
         self
     }
 
+    /// Defines how many data segments of dropped [`Publisher`](crate::port::publisher::Publisher)s
+    /// the [`Node`] keeps for reuse. A new [`Publisher`](crate::port::publisher::Publisher) of
+    /// the same service with the same sample layout, number of samples and memory setup takes
+    /// over a pooled segment instead of creating a new one. Only segments with the
+    /// [`AllocationStrategy::Static`](iceoryx2_cal::shm_allocator::AllocationStrategy::Static)
+    /// are recycled and only when no sample is in use anymore. The default is `0`, which
+    /// disables the pool.
+    pub fn data_segment_pool_capacity(mut self, value: usize) -> Self {
+        self.data_segment_pool_capacity = value;
+        self
+    }
+
     /// Creates a new [`Node`] for a specific [`service::Service`]. All entities owned by the
     /// [`Node`] will have the same [`service::Service`].
     pub fn create<Service: service::Service>(self) -> Result<Node<Service>, NodeCreationFailure> {
@@ -1583,6 +1840,9 @@ impl NodeBuilder {
             id: node_id,
             monitoring_token: UnsafeCell::new(Some(monitoring_token)),
             registered_services: RegisteredServices::new(),
+            service_hashes: ServiceHashCache::new(),
+            data_segment_pool: DataSegmentPool::new(self.data_segment_pool_capacity),
+            heartbeat: NodeHeartbeat::new(config, &node_id),
             details_storage,
             signal_handling_mode: self.signal_handling_mode,
             details,
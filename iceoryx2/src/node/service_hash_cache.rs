@@ -0,0 +1,84 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::collections::BTreeMap;
+
+use iceoryx2_bb_posix::mutex::{Handle, Mutex, MutexBuilder, MutexHandle, MutexType};
+use iceoryx2_cal::hash::Hash;
+use iceoryx2_log::fatal_panic;
+
+use crate::service::messaging_pattern::MessagingPattern;
+use crate::service::service_hash::ServiceHash;
+use crate::service::service_name::ServiceName;
+
+/// The maximum number of [`ServiceHash`]es a [`Node`](crate::node::Node) remembers. When it
+/// is reached, the hashes of further services are computed on every access.
+const SERVICE_HASH_CACHE_CAPACITY: usize = 256;
+
+type CacheKey = (ServiceName, MessagingPattern);
+
+/// Remembers the [`ServiceHash`] of every service the [`Node`](crate::node::Node) built so
+/// that reopening the same service in a loop does not hash its name again.
+#[derive(Debug)]
+pub(crate) struct ServiceHashCache {
+    handle: MutexHandle<BTreeMap<CacheKey, ServiceHash>>,
+}
+
+impl ServiceHashCache {
+    pub(crate) fn new() -> Self {
+        let origin = "ServiceHashCache::new()";
+        let handle = MutexHandle::new();
+
+        fatal_panic!(
+            from origin,
+            when MutexBuilder::new()
+                .is_interprocess_capable(false)
+                .mutex_type(MutexType::Normal)
+                .create(BTreeMap::new(), &handle),
+            "Failed to create mutex"
+        );
+
+        Self { handle }
+    }
+
+    /// Returns the [`ServiceHash`] of the service and computes it with `Hasher` when it is
+    /// not yet known.
+    pub(crate) fn get<Hasher: Hash>(
+        &self,
+        service_name: &ServiceName,
+        messaging_pattern: MessagingPattern,
+    ) -> ServiceHash {
+        let mut guard = fatal_panic!(
+            from self,
+            when self.mutex().lock(),
+            "Failed to lock mutex"
+        );
+
+        let key = (*service_name, messaging_pattern);
+        if let Some(service_hash) = guard.get(&key) {
+            return *service_hash;
+        }
+
+        let service_hash = ServiceHash::new::<Hasher>(service_name, messaging_pattern);
+        if guard.len() < SERVICE_HASH_CACHE_CAPACITY {
+            guard.insert(key, service_hash);
+        }
+
+        service_hash
+    }
+
+    fn mutex(&self) -> Mutex<'_, '_, BTreeMap<CacheKey, ServiceHash>> {
+        // Safe - the mutex is initialized when constructing the struct and
+        // not interacted with by anything else.
+        unsafe { Mutex::from_handle(&self.handle) }
+    }
+}
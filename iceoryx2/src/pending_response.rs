@@ -224,6 +224,20 @@ impl<
             )
     }
 
+    /// Returns [`true`] when at least one [`Server`](crate::port::server::Server) rejected the
+    /// request since its deadline had passed before it was handed out, see
+    /// [`RequestMutUninit::set_deadline()`](crate::request_mut_uninit::RequestMutUninit::set_deadline()).
+    pub fn has_missed_deadline(&self) -> bool {
+        self.request
+            .client_shared_state
+            .lock()
+            .response_receiver
+            .at_least_one_channel_is_rejected(
+                self.request.channel_id,
+                self.request.header().request_id,
+            )
+    }
+
     /// Returns a reference to the iceoryx2 internal
     /// [`service::header::request_response::RequestHeader`] of the corresponding
     /// [`RequestMut`]
@@ -329,7 +343,10 @@ impl<
                         },
                     };
 
-                    if response.header().request_id != self.request.header().request_id {
+                    if !response.header().is_addressed_to(
+                        self.request.header().client_id,
+                        self.request.header().request_id,
+                    ) {
                         continue;
                     }
 
@@ -405,7 +422,10 @@ impl<
                         },
                     };
 
-                    if response.header().request_id != self.request.header().request_id {
+                    if !response.header().is_addressed_to(
+                        self.request.header().client_id,
+                        self.request.header().request_id,
+                    ) {
                         continue;
                     }
 
@@ -414,6 +434,95 @@ impl<
             }
         }
     }
+
+    /// Returns an iterator over the [`Response`]s that were already received, for instance
+    /// the chunks a [`Server`](crate::port::server::Server) has sent with
+    /// [`ActiveRequest::send_chunked()`](crate::active_request::ActiveRequest::send_chunked()).
+    /// The [`Response`]s are received lazily, one per iteration, so the caller can process
+    /// and release every chunk before the next one is received. The iterator ends when no
+    /// further [`Response`] is available or after the first [`ReceiveError`]; a stream
+    /// is complete when the iterator ends and [`PendingResponse::is_connected()`] returns
+    /// false.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node
+    /// #    .service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #    .request_response::<u64, [u8]>()
+    /// #    .open_or_create()?;
+    /// #
+    /// # let client = service.client_builder().create()?;
+    /// let pending_response = client.send_copy(0)?;
+    ///
+    /// let mut point_cloud = vec![];
+    /// for chunk in pending_response.chunks() {
+    ///     point_cloud.extend_from_slice(chunk?.payload());
+    /// }
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn chunks(
+        &self,
+    ) -> ResponseChunks<'_, Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+    {
+        ResponseChunks {
+            pending_response: self,
+            has_failed: false,
+        }
+    }
+}
+
+/// Iterator over the [`Response`]s of a [`PendingResponse`] with a slice payload, created by
+/// [`PendingResponse::chunks()`].
+pub struct ResponseChunks<
+    'a,
+    Service: crate::service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend,
+    ResponseHeader: Debug + ZeroCopySend,
+> {
+    pending_response: &'a PendingResponse<
+        Service,
+        RequestPayload,
+        RequestHeader,
+        [ResponsePayload],
+        ResponseHeader,
+    >,
+    has_failed: bool,
+}
+
+impl<
+    Service: crate::service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend,
+    ResponseHeader: Debug + ZeroCopySend,
+> Iterator
+    for ResponseChunks<'_, Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+{
+    type Item = Result<Response<Service, [ResponsePayload], ResponseHeader>, ReceiveError>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.has_failed {
+            return None;
+        }
+
+        match self.pending_response.receive() {
+            Ok(response) => response.map(Ok),
+            Err(e) => {
+                self.has_failed = true;
+                Some(Err(e))
+            }
+        }
+    }
 }
 
 impl<
@@ -467,7 +576,10 @@ impl<
                         },
                     };
 
-                    if response.header().request_id != self.request.header().request_id {
+                    if !response.header().is_addressed_to(
+                        self.request.header().client_id,
+                        self.request.header().request_id,
+                    ) {
                         continue;
                     }
 
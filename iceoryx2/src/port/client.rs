@@ -99,13 +99,19 @@ use crate::{
     identifiers::UniqueClientId,
     pending_response::PendingResponse,
     port::{
-        details::data_segment::DataSegment, port_name::PortName,
+        content_filter::ContentFilter,
+        delivery_mode::DeliveryMode,
+        details::data_segment::{DataSegment, DataSegmentMemoryOptions},
+        port_name::PortName,
+        receive_policy::ReceivePolicy,
+        statistics::PortStatisticsRecorder,
         update_connections::UpdateConnections,
     },
     prelude::{BackpressureStrategy, PortFactory},
     raw_sample::RawSampleMut,
     request_mut::RequestMut,
     request_mut_uninit::RequestMutUninit,
+    response_gather::{GatherCondition, ResponseGather},
     service::{
         self,
         builder::{CustomHeaderMarker, CustomPayloadMarker},
@@ -121,7 +127,7 @@ use super::{
     LoanError, SendError,
     details::{
         data_segment::DataSegmentType,
-        receiver::{Receiver, SenderDetails},
+        receiver::{ReceiveCursor, Receiver, SenderDetails},
         segment_state::SegmentState,
         sender::{ReceiverDetails, Sender},
     },
@@ -136,6 +142,11 @@ pub enum RequestSendError {
     /// can be sent.
     ExceedsMaxActiveRequests,
 
+    /// [`RequestMut::send_and_forget()`](crate::request_mut::RequestMut::send_and_forget())
+    /// was called but the [`Service`](crate::service::Service) does not support fire and forget
+    /// requests.
+    FireAndForgetNotSupported,
+
     /// Underlying [`SendError`]s.
     SendError(SendError),
 }
@@ -252,9 +263,39 @@ impl<Service: service::Service> ClientSharedState<Service> {
             // All requests are delivered on the same channel, therefore we can use
             // ChannelId::new(0).
             ChannelId::new(0),
+            None,
         )?)
     }
 
+    /// Delivers a request without preparing a response channel and without counting it as an
+    /// active request. The [`Server`](crate::port::server::Server) receives it as an
+    /// [`ActiveRequest`](crate::active_request::ActiveRequest) that is not connected.
+    pub(crate) fn send_request_and_forget(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+    ) -> Result<usize, RequestSendError> {
+        let msg = "Unable to send request and forget";
+
+        if !self
+            .request_sender
+            .service_state
+            .static_config()
+            .request_response()
+            .enable_fire_and_forget_requests
+        {
+            fail!(from self, with RequestSendError::FireAndForgetNotSupported,
+                "{} since the service does not support fire and forget requests.", msg);
+        }
+
+        fail!(from self, when self.update_connections(),
+            "{} since the connections could not be updated.", msg);
+
+        Ok(self
+            .request_sender
+            .deliver_offset(offset, sample_size, ChannelId::new(0), None)?)
+    }
+
     pub(crate) fn update_connections(
         &self,
     ) -> Result<(), super::update_connections::ConnectionFailure> {
@@ -288,6 +329,7 @@ impl<Service: service::Service> ClientSharedState<Service> {
                         port_id: port.server_id.value(),
                         max_number_of_segments: port.max_number_of_segments,
                         data_segment_type: port.data_segment_type,
+                        weight: 1,
                         number_of_samples: port.number_of_responses,
                     },
                 );
@@ -299,6 +341,8 @@ impl<Service: service::Service> ClientSharedState<Service> {
                     ReceiverDetails {
                         port_id: port.server_id.value(),
                         buffer_size: port.request_buffer_size,
+                        content_filter: ContentFilter::accept_all(),
+                        has_wake_up_channel: port.has_wake_up_channel,
                     },
                     |_| {},
                 );
@@ -453,14 +497,18 @@ impl<
                 sample_layout,
                 global_config,
                 number_of_requests,
+                DataSegmentMemoryOptions::default(),
             ),
-            DataSegmentType::Dynamic => DataSegment::<Service>::create_dynamic_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_requests,
-                client_factory.config.allocation_strategy,
-            ),
+            DataSegmentType::Dynamic | DataSegmentType::SizeClasses => {
+                DataSegment::<Service>::create_dynamic_segment(
+                    &segment_name,
+                    sample_layout,
+                    global_config,
+                    number_of_requests,
+                    client_factory.config.allocation_strategy,
+                    DataSegmentMemoryOptions::default(),
+                )
+            }
         };
 
         let data_segment = fail!(from origin,
@@ -519,6 +567,8 @@ impl<
             loan_counter: AtomicUsize::new(0),
             sender_max_borrowed_samples: static_config.max_loaned_requests,
             backpressure_strategy: client_factory.config.backpressure_strategy,
+            backpressure_wait_strategy: global_config.global.backpressure_wait_strategy,
+            backpressure_wake_up_timeout: None,
             message_type_details: static_config.request_message_type_details,
             // all requests are sent via one channel, only the responses require different
             // channels to guarantee that one response does not fill the buffer of another
@@ -527,6 +577,10 @@ impl<
             // one channel suffices
             number_of_channels: 1,
             initial_channel_state: CHANNEL_STATE_OPEN,
+            prefault_connections: false,
+            lock_connections_in_memory: false,
+            wake_up_event_id: AtomicUsize::new(0),
+            statistics: PortStatisticsRecorder::default(),
         };
 
         let number_of_to_be_removed_connections = service
@@ -549,6 +603,7 @@ impl<
             receiver_port_id: client_id.value(),
             service_state: service.clone(),
             buffer_size: static_config.max_response_buffer_size,
+            active_buffer_size: UnsafeCell::new(static_config.max_response_buffer_size),
             tagger: CyclicTagger::new(),
             to_be_removed_connections: Some(UnsafeCell::new(
                 PolymorphicVec::new(HeapAllocator::global(), number_of_to_be_removed_connections)
@@ -562,6 +617,12 @@ impl<
             number_of_channels: number_of_requests_with_max_service_setting,
             connection_storage: UnsafeCell::new(SlotMap::new(number_of_connections)),
             initial_channel_state: CHANNEL_STATE_CLOSED,
+            delivery_mode: DeliveryMode::Fifo,
+            receive_policy: ReceivePolicy::FixedOrder,
+            receive_cursor: UnsafeCell::new(ReceiveCursor::default()),
+            track_ready_connections: false,
+            prefetch_size: 0,
+            statistics: PortStatisticsRecorder::default(),
         };
 
         let client_shared_state = Service::ArcThreadSafetyPolicy::new(ClientSharedState {
@@ -614,6 +675,12 @@ impl<
             }
         };
 
+        // identifies the connection of this client on the wake up channel of the servers
+        client_shared_state
+            .lock()
+            .request_sender
+            .wake_up_event_id
+            .store(handle.index(), Ordering::Relaxed);
         unsafe { *client_shared_state.lock().client_handle.get() = Some(handle) };
 
         Ok(Self {
@@ -781,6 +848,7 @@ impl<
                 channel_id,
                 request_id: self.next_request_id(),
                 number_of_elements: 1,
+                deadline: service::header::request_response::NO_DEADLINE,
             })
         };
         unsafe { user_header_ptr.write(RequestHeader::default()) };
@@ -825,6 +893,28 @@ impl<
 
         request.write_payload(value).send()
     }
+
+    /// Copies the input value into a [`RequestMut`] and sends it to all connected
+    /// [`Server`](crate::port::server::Server)s. All [`Server`](crate::port::server::Server)s
+    /// share the same request chunk. On success it returns a [`ResponseGather`] that
+    /// aggregates the [`Response`](crate::response::Response)s per
+    /// [`UniqueServerId`](crate::identifiers::UniqueServerId) until the [`GatherCondition`] is
+    /// satisfied.
+    pub fn send_to_all(
+        &self,
+        value: RequestPayload,
+        condition: GatherCondition,
+    ) -> Result<
+        ResponseGather<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+        RequestSendError,
+    > {
+        let msg = "Unable to send request to all servers";
+        let request = fail!(from self,
+                            when self.loan_uninit(),
+                            "{} since the loan of the request failed.", msg);
+
+        request.write_payload(value).send_to_all(condition)
+    }
 }
 
 impl<
@@ -1060,6 +1150,7 @@ impl<
                 channel_id,
                 request_id: self.next_request_id(),
                 number_of_elements: slice_len as _,
+                deadline: header::request_response::NO_DEADLINE,
             })
         };
         unsafe { user_header_ptr.write(RequestHeader::default()) };
@@ -0,0 +1,171 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::port::content_filter::ContentFilter;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! #[derive(Debug, Default, ZeroCopySend)]
+//! #[repr(C)]
+//! struct CameraHeader {
+//!     camera_id: u32,
+//! }
+//!
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .user_header::<CameraHeader>()
+//!     .open_or_create()?;
+//!
+//! // the publisher delivers only samples with a camera id between 4 and 7
+//! let subscriber = service.subscriber_builder()
+//!     .content_filter(ContentFilter::key_range(
+//!         core::mem::offset_of!(CameraHeader, camera_id),
+//!         4u32..=7u32,
+//!     ))
+//!     .create()?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::ops::RangeInclusive;
+
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+
+/// An unsigned integer that can be used as key of a [`ContentFilter`].
+pub trait ContentFilterKey: Copy + Into<u64> + internal::Sealed {}
+
+impl ContentFilterKey for u8 {}
+impl ContentFilterKey for u16 {}
+impl ContentFilterKey for u32 {}
+impl ContentFilterKey for u64 {}
+
+mod internal {
+    pub trait Sealed {}
+
+    impl Sealed for u8 {}
+    impl Sealed for u16 {}
+    impl Sealed for u32 {}
+    impl Sealed for u64 {}
+}
+
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, ZeroCopySend)]
+#[repr(C)]
+enum ContentFilterRule {
+    #[default]
+    AcceptAll,
+    KeyRange {
+        min: u64,
+        max: u64,
+    },
+    KeyMask {
+        mask: u64,
+        value: u64,
+    },
+}
+
+/// A filter a [`Subscriber`](crate::port::subscriber::Subscriber) registers to receive only a
+/// subset of the samples of a service. It is stored in the dynamic config of the service and
+/// evaluated by the [`Publisher`](crate::port::publisher::Publisher) when a sample is sent.
+/// Samples that are not accepted are never enqueued for the
+/// [`Subscriber`](crate::port::subscriber::Subscriber) and do not occupy its buffer.
+///
+/// The filter matches a key, an unsigned integer that is stored at a fixed byte offset inside
+/// the user header of the sample.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, ZeroCopySend)]
+#[repr(C)]
+pub struct ContentFilter {
+    key_offset: usize,
+    key_size: usize,
+    rule: ContentFilterRule,
+}
+
+impl ContentFilter {
+    /// Creates a [`ContentFilter`] that accepts every sample. This is the default.
+    pub const fn accept_all() -> Self {
+        Self {
+            key_offset: 0,
+            key_size: 0,
+            rule: ContentFilterRule::AcceptAll,
+        }
+    }
+
+    /// Creates a [`ContentFilter`] that accepts a sample when the key that is located at
+    /// `key_offset` bytes inside the user header is contained in `range`.
+    pub fn key_range<K: ContentFilterKey>(key_offset: usize, range: RangeInclusive<K>) -> Self {
+        Self {
+            key_offset,
+            key_size: core::mem::size_of::<K>(),
+            rule: ContentFilterRule::KeyRange {
+                min: (*range.start()).into(),
+                max: (*range.end()).into(),
+            },
+        }
+    }
+
+    /// Creates a [`ContentFilter`] that accepts a sample when the key that is located at
+    /// `key_offset` bytes inside the user header satisfies `key & mask == value`.
+    pub fn key_mask<K: ContentFilterKey>(key_offset: usize, mask: K, value: K) -> Self {
+        Self {
+            key_offset,
+            key_size: core::mem::size_of::<K>(),
+            rule: ContentFilterRule::KeyMask {
+                mask: mask.into(),
+                value: value.into(),
+            },
+        }
+    }
+
+    /// Returns true if the [`ContentFilter`] accepts every sample.
+    pub fn accepts_all(&self) -> bool {
+        self.rule == ContentFilterRule::AcceptAll
+    }
+
+    /// Returns true if the key of the [`ContentFilter`] is located inside a user header of
+    /// `user_header_size` bytes.
+    pub(crate) fn fits_into(&self, user_header_size: usize) -> bool {
+        self.accepts_all()
+            || self
+                .key_offset
+                .checked_add(self.key_size)
+                .is_some_and(|end| end <= user_header_size)
+    }
+
+    /// Returns true if the sample with the provided user header shall be delivered.
+    ///
+    /// # Safety
+    ///
+    ///  * `user_header` must point to a valid user header that the filter
+    ///    [`ContentFilter::fits_into()`]
+    pub(crate) unsafe fn accepts(&self, user_header: *const u8) -> bool {
+        let key = || unsafe {
+            let key_ptr = user_header.add(self.key_offset);
+            match self.key_size {
+                1 => key_ptr.read() as u64,
+                2 => key_ptr.cast::<u16>().read_unaligned() as u64,
+                4 => key_ptr.cast::<u32>().read_unaligned() as u64,
+                _ => key_ptr.cast::<u64>().read_unaligned(),
+            }
+        };
+
+        match self.rule {
+            ContentFilterRule::AcceptAll => true,
+            ContentFilterRule::KeyRange { min, max } => (min..=max).contains(&key()),
+            ContentFilterRule::KeyMask { mask, value } => key() & mask == value,
+        }
+    }
+}
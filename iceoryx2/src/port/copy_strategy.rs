@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+/// Defines how a sender copies the user provided payload into the data segment when
+/// a copy is requested, e.g. with [`Publisher::send_copy()`](crate::port::publisher::Publisher::send_copy()).
+#[derive(Debug, Default, Eq, PartialEq, Clone, Copy)]
+pub enum CopyStrategy {
+    /// Uses a regular memcpy. The copied payload remains in the cache of the sender.
+    #[default]
+    Regular,
+    /// Uses streaming stores that bypass the cache of the sender. Pays off for large
+    /// payloads that are not read again by the sender, since they neither evict the working
+    /// set of the sender nor have to be fetched from the cache of the sender by the receiver.
+    /// Falls back to [`CopyStrategy::Regular`] on architectures without streaming stores.
+    NonTemporal,
+}
+
+impl CopyStrategy {
+    /// Copies `len` bytes from `src` to `dst` with the [`CopyStrategy`].
+    ///
+    /// # Safety
+    ///
+    ///  * `src` must be valid for reads of `len` bytes
+    ///  * `dst` must be valid for writes of `len` bytes
+    ///  * the memory regions of `src` and `dst` must not overlap
+    pub unsafe fn copy_nonoverlapping(self, src: *const u8, dst: *mut u8, len: usize) {
+        match self {
+            CopyStrategy::Regular => unsafe { core::ptr::copy_nonoverlapping(src, dst, len) },
+            CopyStrategy::NonTemporal => unsafe { copy_non_temporal(src, dst, len) },
+        }
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+unsafe fn copy_non_temporal(src: *const u8, dst: *mut u8, len: usize) {
+    use core::arch::x86_64::{__m128i, _mm_loadu_si128, _mm_sfence, _mm_stream_si128};
+    const VECTOR_SIZE: usize = core::mem::size_of::<__m128i>();
+    const UNROLL: usize = 4;
+
+    unsafe {
+        // streaming stores require an aligned destination, the unaligned head is copied
+        // regularly
+        let head = dst.align_offset(VECTOR_SIZE).min(len);
+        core::ptr::copy_nonoverlapping(src, dst, head);
+
+        let mut offset = head;
+        while offset + VECTOR_SIZE * UNROLL <= len {
+            for i in 0..UNROLL {
+                let position = offset + i * VECTOR_SIZE;
+                let value = _mm_loadu_si128(src.add(position).cast());
+                _mm_stream_si128(dst.add(position).cast(), value);
+            }
+            offset += VECTOR_SIZE * UNROLL;
+        }
+
+        while offset + VECTOR_SIZE <= len {
+            let value = _mm_loadu_si128(src.add(offset).cast());
+            _mm_stream_si128(dst.add(offset).cast(), value);
+            offset += VECTOR_SIZE;
+        }
+
+        core::ptr::copy_nonoverlapping(src.add(offset), dst.add(offset), len - offset);
+
+        // streaming stores are weakly ordered, they must be visible before the offset
+        // is delivered to the receiver
+        _mm_sfence();
+    }
+}
+
+#[cfg(not(target_arch = "x86_64"))]
+unsafe fn copy_non_temporal(src: *const u8, dst: *mut u8, len: usize) {
+    unsafe { core::ptr::copy_nonoverlapping(src, dst, len) }
+}
@@ -0,0 +1,25 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+/// Defines which samples a [`Subscriber`](crate::port::subscriber::Subscriber) acquires
+/// from the buffer of a connected [`Publisher`](crate::port::publisher::Publisher).
+#[derive(Debug, Default, Eq, PartialEq, Clone, Copy)]
+pub enum DeliveryMode {
+    /// Every sample is delivered in the order it was sent.
+    #[default]
+    Fifo,
+    /// Only the most recent sample is delivered. All older samples that are still in the
+    /// buffer are returned to the publisher in one go without ever being mapped or borrowed
+    /// by the subscriber. Intended for state-like data where only the current value is of
+    /// interest, usually in combination with a service that enables safe overflow.
+    LatestOnly,
+}
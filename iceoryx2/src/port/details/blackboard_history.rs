@@ -0,0 +1,131 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Ring buffer in the blackboard payload segment that stores the latest updates of an entry.
+//! It is written by the single [`EntryHandleMut`](crate::port::writer::EntryHandleMut) of the
+//! entry and read lock-free by all [`EntryHandle`](crate::port::reader::EntryHandle)s.
+
+use core::alloc::Layout;
+use core::mem::MaybeUninit;
+
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering, fence};
+use iceoryx2_bb_concurrency::cell::UnsafeCell;
+
+/// Offset of an entry without history.
+pub(crate) const NO_HISTORY: u64 = u64::MAX;
+
+#[repr(C)]
+struct HistorySlot<ValueType: Copy> {
+    // sequence lock of the slot, it is 2 * n + 1 while the n-th update is written and
+    // 2 * n + 2 when it is complete
+    sequence: AtomicU64,
+    value: UnsafeCell<MaybeUninit<ValueType>>,
+}
+
+#[repr(C)]
+pub(crate) struct History<ValueType: Copy> {
+    number_of_updates: AtomicU64,
+    depth: u64,
+    slots: [HistorySlot<ValueType>; 0],
+}
+
+impl<ValueType: Copy> History<ValueType> {
+    pub(crate) fn layout(depth: usize) -> Layout {
+        unsafe {
+            Layout::from_size_align_unchecked(
+                core::mem::size_of::<Self>()
+                    + depth * core::mem::size_of::<HistorySlot<ValueType>>(),
+                core::mem::align_of::<Self>(),
+            )
+        }
+    }
+
+    /// Initializes the history at `ptr` with `initial_value` as first update.
+    ///
+    /// # Safety
+    ///
+    ///   * `ptr` must point to memory of at least [`History::layout()`] that is suitably aligned
+    ///   * `depth` must be greater than zero
+    pub(crate) unsafe fn init(ptr: *mut Self, depth: usize, initial_value: ValueType) {
+        unsafe {
+            ptr.write(Self {
+                number_of_updates: AtomicU64::new(0),
+                depth: depth as u64,
+                slots: [],
+            });
+
+            let slots = (*ptr).slots.as_ptr() as *mut HistorySlot<ValueType>;
+            for i in 0..depth {
+                slots.add(i).write(HistorySlot {
+                    sequence: AtomicU64::new(0),
+                    value: UnsafeCell::new(MaybeUninit::uninit()),
+                });
+            }
+
+            (*ptr).push(initial_value);
+        }
+    }
+
+    fn slot(&self, update_number: u64) -> &HistorySlot<ValueType> {
+        unsafe {
+            &*self
+                .slots
+                .as_ptr()
+                .add((update_number % self.depth) as usize)
+        }
+    }
+
+    pub(crate) fn depth(&self) -> u64 {
+        self.depth
+    }
+
+    pub(crate) fn number_of_updates(&self) -> u64 {
+        self.number_of_updates.load(Ordering::Acquire)
+    }
+
+    /// Stores `value` as the latest update. Must only be called by the single writer.
+    pub(crate) fn push(&self, value: ValueType) {
+        let update_number = self.number_of_updates.load(Ordering::Relaxed);
+        let slot = self.slot(update_number);
+
+        slot.sequence
+            .store(2 * update_number + 1, Ordering::Relaxed);
+        fence(Ordering::Release);
+        unsafe { (*slot.value.get()).as_mut_ptr().write_volatile(value) };
+        slot.sequence
+            .store(2 * update_number + 2, Ordering::Release);
+
+        self.number_of_updates
+            .store(update_number + 1, Ordering::Release);
+    }
+
+    /// Returns a copy of the `update_number`-th update or [`None`] when it was already
+    /// overwritten.
+    pub(crate) fn get(&self, update_number: u64) -> Option<ValueType> {
+        let slot = self.slot(update_number);
+        let expected_sequence = 2 * update_number + 2;
+        if slot.sequence.load(Ordering::Acquire) != expected_sequence {
+            return None;
+        }
+
+        // the value is not used when the slot was written concurrently, therefore, it is copied
+        // as MaybeUninit
+        let value = unsafe { slot.value.get().read_volatile() };
+
+        fence(Ordering::Acquire);
+        if slot.sequence.load(Ordering::Relaxed) != expected_sequence {
+            return None;
+        }
+
+        Some(unsafe { value.assume_init() })
+    }
+}
@@ -12,10 +12,12 @@
 
 use iceoryx2_bb_container::slotmap::SlotMapKey;
 use iceoryx2_cal::shm_allocator::PointerOffset;
+use iceoryx2_cal::zero_copy_connection::ChannelId;
 
 #[derive(Debug)]
 pub(crate) struct ChunkDetails {
     pub(crate) connection_key: SlotMapKey,
     pub(crate) offset: PointerOffset,
     pub(crate) origin: u128,
+    pub(crate) channel_id: ChannelId,
 }
@@ -13,18 +13,22 @@
 use core::alloc::Layout;
 use core::ptr::NonNull;
 
+use alloc::vec::Vec;
+
+use iceoryx2_bb_concurrency::cell::UnsafeCell;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_posix::file::AccessMode;
 use iceoryx2_bb_system_types::file_name::FileName;
+use iceoryx2_bb_system_types::file_path::FilePath;
 use iceoryx2_cal::{
     event::NamedConceptBuilder,
     resizable_shared_memory::*,
     shared_memory::{
-        SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError, SharedMemoryForPoolAllocator,
-        SharedMemoryOpenError, ShmPointer,
+        NumaPolicy, PageSize, SharedMemory, SharedMemoryBuilder, SharedMemoryCreateError,
+        SharedMemoryForPoolAllocator, SharedMemoryOpenError, ShmPointer,
     },
     shm_allocator::{
         self, AllocationError, AllocationStrategy, PointerOffset, SegmentId, ShmAllocationError,
@@ -35,6 +39,7 @@ use iceoryx2_log::fail;
 
 use crate::{
     config,
+    node::global_management_segment::SharedMemoryReservation,
     service::{
         self,
         config_scheme::{data_segment_config, resizable_data_segment_config},
@@ -49,26 +54,81 @@ pub enum DataSegmentType {
     Dynamic,
     /// The data segment is allocated once. If it is out-of-memory no reallocation will occur.
     Static,
+    /// The data segment consists of one or more segments per size class. Segments are reused
+    /// and therefore remain mapped in the receiver even when they are empty.
+    SizeClasses,
 }
 
 impl DataSegmentType {
     pub(crate) fn new_from_allocation_strategy(v: AllocationStrategy) -> Self {
         match v {
             AllocationStrategy::Static => DataSegmentType::Static,
+            AllocationStrategy::SizeClasses => DataSegmentType::SizeClasses,
             _ => DataSegmentType::Dynamic,
         }
     }
 }
 
+/// Defines how the memory of a [`DataSegment`] is acquired from and returned to the system.
+#[derive(Debug, Clone, Copy, Default)]
+pub(crate) struct DataSegmentMemoryOptions {
+    pub(crate) page_size: PageSize,
+    pub(crate) numa_policy: NumaPolicy,
+    pub(crate) typed_memory: Option<FilePath>,
+    pub(crate) prefault: bool,
+    pub(crate) lock_in_memory: bool,
+    pub(crate) shrink_policy: ShrinkPolicy,
+}
+
 #[derive(Debug)]
 enum MemoryType<Service: service::Service> {
     Static(Service::SharedMemory),
     Dynamic(Service::ResizableSharedMemory),
 }
 
+/// A port-local magazine of released chunks. Loans are served from it before the allocator in
+/// the shared memory is used, so that a loan/release pair does not touch a shared cache line.
+#[derive(Debug)]
+struct ChunkCache {
+    chunks: UnsafeCell<Vec<PointerOffset>>,
+    capacity: usize,
+}
+
+impl ChunkCache {
+    fn new(capacity: usize) -> Self {
+        Self {
+            chunks: UnsafeCell::new(Vec::with_capacity(capacity)),
+            capacity,
+        }
+    }
+
+    #[allow(clippy::mut_from_ref)]
+    fn chunks(&self) -> &mut Vec<PointerOffset> {
+        // the data segment is owned by exactly one port and all accesses are serialized by the
+        // ArcSyncPolicy of the port
+        unsafe { &mut *self.chunks.get() }
+    }
+
+    fn pop(&self) -> Option<PointerOffset> {
+        self.chunks().pop()
+    }
+
+    fn push(&self, offset: PointerOffset) -> bool {
+        let chunks = self.chunks();
+        if chunks.len() < self.capacity {
+            chunks.push(offset);
+            true
+        } else {
+            false
+        }
+    }
+}
+
 #[derive(Debug)]
 pub(crate) struct DataSegment<Service: service::Service> {
     memory: MemoryType<Service>,
+    chunk_cache: ChunkCache,
+    reservation: Option<SharedMemoryReservation<Service>>,
 }
 
 impl<Service: service::Service> Abandonable for DataSegment<Service> {
@@ -91,6 +151,7 @@ impl<Service: service::Service> DataSegment<Service> {
         chunk_layout: Layout,
         global_config: &config::Config,
         number_of_chunks: usize,
+        memory_options: DataSegmentMemoryOptions,
     ) -> Result<Self, SharedMemoryCreateError> {
         let allocator_config = shm_allocator::pool_allocator::Config {
             bucket_layout: chunk_layout,
@@ -98,18 +159,59 @@ impl<Service: service::Service> DataSegment<Service> {
         let msg = "Unable to create the static data segment since the underlying shared memory could not be created.";
         let origin = "DataSegment::create_static_segment()";
 
+        let size = chunk_layout.size() * number_of_chunks + chunk_layout.align() - 1;
+        let reservation = fail!(from origin,
+                                when SharedMemoryReservation::reserve(global_config, size),
+                                with SharedMemoryCreateError::InternalError,
+                                "{msg} The shared memory quota of the domain does not allow a segment of {size} bytes.");
+
         let segment_config = data_segment_config::<Service>(global_config);
         let memory = fail!(from origin,
                                 when <<Service::SharedMemory as SharedMemory<PoolAllocator>>::Builder as NamedConceptBuilder<
                                 Service::SharedMemory,
                                     >>::new(segment_name)
                                     .config(&segment_config)
-                                    .size(chunk_layout.size() * number_of_chunks + chunk_layout.align() - 1)
+                                    .size(size)
+                                    .page_size(memory_options.page_size)
+                                    .numa_policy(memory_options.numa_policy)
+                                    .typed_memory(memory_options.typed_memory)
+                                    .prefault(memory_options.prefault)
+                                    .lock_in_memory(memory_options.lock_in_memory)
                                     .create(&allocator_config),
                                 "{msg}");
 
         Ok(Self {
             memory: MemoryType::Static(memory),
+            chunk_cache: ChunkCache::new(0),
+            reservation,
+        })
+    }
+
+    /// Takes over an existing static data segment that was released with
+    /// [`DataSegment::release_for_reuse()`] by a previous owner.
+    pub(crate) fn open_static_segment_for_reuse(
+        segment_name: &FileName,
+        global_config: &config::Config,
+    ) -> Result<Self, SharedMemoryOpenError> {
+        let msg = "Unable to reuse the static data segment since the underlying shared memory could not be opened.";
+        let origin = "DataSegment::open_static_segment_for_reuse()";
+
+        let segment_config = data_segment_config::<Service>(global_config);
+        let memory = fail!(from origin,
+                            when <Service::SharedMemory as SharedMemory<PoolAllocator>>::
+                                Builder::new(segment_name)
+                                .config(&segment_config)
+                                .open(AccessMode::ReadWrite),
+                            "{msg}");
+        memory.acquire_ownership();
+
+        // the segment exists already, therefore it is accounted even when the quota is exceeded
+        let reservation = SharedMemoryReservation::track(global_config, memory.size());
+
+        Ok(Self {
+            memory: MemoryType::Static(memory),
+            chunk_cache: ChunkCache::new(0),
+            reservation,
         })
     }
 
@@ -119,10 +221,17 @@ impl<Service: service::Service> DataSegment<Service> {
         global_config: &config::Config,
         number_of_chunks: usize,
         allocation_strategy: AllocationStrategy,
+        memory_options: DataSegmentMemoryOptions,
     ) -> Result<Self, SharedMemoryCreateError> {
         let msg = "Unable to create the dynamic data segment since the underlying shared memory could not be created.";
         let origin = "DataSegment::create_dynamic_segment()";
 
+        let initial_size = chunk_layout.size() * number_of_chunks;
+        let reservation = fail!(from origin,
+                    when SharedMemoryReservation::reserve(global_config, initial_size),
+                    with SharedMemoryCreateError::InternalError,
+                    "{msg} The shared memory quota of the domain does not allow a segment of {initial_size} bytes.");
+
         let segment_config = resizable_data_segment_config::<Service>(global_config);
         let memory = fail!(from origin,
                     when <<Service::ResizableSharedMemory as ResizableSharedMemory<
@@ -135,21 +244,81 @@ impl<Service: service::Service> DataSegment<Service> {
                     .max_number_of_chunks_hint(number_of_chunks)
                     .max_chunk_layout_hint(chunk_layout)
                     .allocation_strategy(allocation_strategy)
+                    .page_size(memory_options.page_size)
+                    .numa_policy(memory_options.numa_policy)
+                    .typed_memory(memory_options.typed_memory)
+                    .prefault(memory_options.prefault)
+                    .lock_in_memory(memory_options.lock_in_memory)
+                    .shrink_policy(memory_options.shrink_policy)
                     .create(),
                     "{msg}");
 
+        if let Some(reservation) = &reservation {
+            reservation.update(memory.segment_statistics().total_size);
+        }
+
         Ok(Self {
             memory: MemoryType::Dynamic(memory),
+            chunk_cache: ChunkCache::new(0),
+            reservation,
         })
     }
 
+    /// Keeps up to `capacity` released chunks in a port-local cache and reuses them for the
+    /// next allocations. Only static data segments use the cache since a dynamic data segment
+    /// must be able to release the chunks of a segment it replaced.
+    pub(crate) fn with_chunk_cache(mut self, capacity: usize) -> Self {
+        if let MemoryType::Static(_) = self.memory {
+            self.chunk_cache = ChunkCache::new(capacity);
+        }
+        self
+    }
+
+    /// Fills the chunk cache with chunks of the given layout so that the first allocations are
+    /// already served from the cache. Stops early when the data segment is out of memory.
+    pub(crate) fn prefill_chunk_cache(&self, layout: Layout) {
+        if let MemoryType::Static(memory) = &self.memory {
+            while self.chunk_cache.chunks().len() < self.chunk_cache.capacity {
+                match memory.allocate(layout) {
+                    Ok(ptr) => {
+                        self.chunk_cache.push(ptr.offset);
+                    }
+                    Err(_) => break,
+                }
+            }
+        }
+    }
+
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ShmPointer, ShmAllocationError> {
         let msg = "Unable to allocate memory from the data segment";
         match &self.memory {
-            MemoryType::Static(memory) => Ok(fail!(from self, when memory.allocate(layout),
-                                            "{msg}.")),
+            MemoryType::Static(memory) => {
+                let cached_chunk = match layout.size() <= memory.bucket_size()
+                    && layout.align() <= memory.max_alignment()
+                {
+                    true => self.chunk_cache.pop(),
+                    false => None,
+                };
+
+                if let Some(offset) = cached_chunk {
+                    return Ok(ShmPointer {
+                        offset,
+                        data_ptr: (memory.payload_start_address() + offset.offset()) as *mut u8,
+                    });
+                }
+
+                Ok(fail!(from self, when memory.allocate(layout),
+                                            "{msg}."))
+            }
             MemoryType::Dynamic(memory) => match memory.allocate(layout) {
-                Ok(ptr) => Ok(ptr),
+                Ok(ptr) => {
+                    // a resize creates the new segment before the quota could be checked,
+                    // therefore the growth is only accounted and limits the next segments
+                    if let Some(reservation) = &self.reservation {
+                        reservation.update(memory.segment_statistics().total_size);
+                    }
+                    Ok(ptr)
+                }
                 Err(ResizableShmAllocationError::ShmAllocationError(e)) => {
                     fail!(from self, with e,
                         "{msg} caused by {:?}.", e);
@@ -171,12 +340,37 @@ impl<Service: service::Service> DataSegment<Service> {
     pub(crate) unsafe fn deallocate_bucket(&self, offset: PointerOffset) {
         unsafe {
             match &self.memory {
-                MemoryType::Static(memory) => memory.deallocate_bucket(offset),
+                MemoryType::Static(memory) => {
+                    if !self.chunk_cache.push(offset) {
+                        memory.deallocate_bucket(offset)
+                    }
+                }
                 MemoryType::Dynamic(memory) => memory.deallocate_bucket(offset),
             }
         }
     }
 
+    /// Returns all cached chunks to the allocator and releases the ownership of the underlying
+    /// shared memory so that it survives this [`DataSegment`] and can be taken over with
+    /// [`DataSegment::open_static_segment_for_reuse()`]. Returns false and keeps the ownership
+    /// when the segment cannot be reused.
+    pub(crate) fn release_for_reuse(&self) -> bool {
+        match &self.memory {
+            MemoryType::Static(memory) => {
+                if !Service::SharedMemory::does_support_persistency() {
+                    return false;
+                }
+
+                while let Some(offset) = self.chunk_cache.pop() {
+                    unsafe { memory.deallocate_bucket(offset) };
+                }
+                memory.release_ownership();
+                true
+            }
+            MemoryType::Dynamic(_) => false,
+        }
+    }
+
     pub(crate) fn bucket_size(&self, segment_id: SegmentId) -> usize {
         match &self.memory {
             MemoryType::Static(memory) => memory.bucket_size(),
@@ -184,10 +378,22 @@ impl<Service: service::Service> DataSegment<Service> {
         }
     }
 
+    pub(crate) fn segment_statistics(&self) -> SegmentStatistics {
+        match &self.memory {
+            MemoryType::Static(memory) => SegmentStatistics {
+                number_of_active_segments: 1,
+                total_size: memory.size(),
+                current_segment_size: memory.size(),
+                number_of_released_segments: 0,
+            },
+            MemoryType::Dynamic(memory) => memory.segment_statistics(),
+        }
+    }
+
     pub(crate) fn max_number_of_segments(data_segment_type: DataSegmentType) -> u8 {
         match data_segment_type {
             DataSegmentType::Static => 1,
-            DataSegmentType::Dynamic => {
+            DataSegmentType::Dynamic | DataSegmentType::SizeClasses => {
                 (Service::ResizableSharedMemory::max_number_of_reallocations() - 1) as u8
             }
         }
@@ -253,6 +459,7 @@ impl<Service: service::Service> DataSegmentView<Service> {
     pub(crate) fn open_dynamic_segment(
         segment_name: &FileName,
         global_config: &config::Config,
+        retain_empty_segments: bool,
     ) -> Result<Self, SharedMemoryOpenError> {
         let origin = "DataSegment::open()";
         let msg =
@@ -267,6 +474,7 @@ impl<Service: service::Service> DataSegmentView<Service> {
                         segment_name,
                     )
                     .config(&segment_config)
+                    .retain_empty_segments(retain_empty_segments)
                     .open(AccessMode::Read),
                     "{msg}");
 
@@ -294,6 +502,18 @@ impl<Service: service::Service> DataSegmentView<Service> {
         }
     }
 
+    /// Translates the offset into an address without registering it. Returns [`None`] when
+    /// the offset is outside of the segment or the segment is dynamic, since the corresponding
+    /// shared memory may not be mapped yet.
+    pub(crate) fn translate_offset_hint(&self, offset: PointerOffset) -> Option<usize> {
+        match &self.memory {
+            MemoryViewType::Static(memory) if offset.offset() < memory.size() => {
+                Some(offset.offset() + memory.payload_start_address())
+            }
+            _ => None,
+        }
+    }
+
     pub(crate) unsafe fn unregister_offset(&self, offset: PointerOffset) {
         unsafe {
             if let MemoryViewType::Dynamic(memory) = &self.memory {
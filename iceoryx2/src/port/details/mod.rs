@@ -10,9 +10,12 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+pub(crate) mod blackboard_history;
 pub(crate) mod chunk;
 pub(crate) mod chunk_details;
 pub(crate) mod data_segment;
 pub(crate) mod receiver;
+pub(crate) mod request_coalescing;
+pub(crate) mod request_scheduling;
 pub(crate) mod segment_state;
 pub(crate) mod sender;
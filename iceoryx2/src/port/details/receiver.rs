@@ -12,22 +12,31 @@
 
 use alloc::format;
 use core::ptr::NonNull;
+use core::time::Duration;
 
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
 use iceoryx2_bb_container::slotmap::SlotMap;
 use iceoryx2_bb_container::slotmap::SlotMapKey;
 use iceoryx2_bb_container::vector::polymorphic_vec::*;
 use iceoryx2_bb_elementary::cyclic_tagger::*;
+use iceoryx2_bb_elementary::prefetch::prefetch_read;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_memory::heap_allocator::HeapAllocator;
+use iceoryx2_bb_posix::clock::{CycleClock, Time};
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
+use iceoryx2_cal::shared_memory::SharedMemoryOpenError;
+use iceoryx2_cal::shm_allocator::PointerOffset;
 use iceoryx2_cal::zero_copy_connection::*;
 use iceoryx2_log::fatal_panic;
 use iceoryx2_log::{error, fail, warn};
 
+use crate::config;
 use crate::port::DegradationCause;
 use crate::port::DegradationInfo;
+use crate::port::delivery_mode::DeliveryMode;
+use crate::port::receive_policy::ReceivePolicy;
+use crate::port::statistics::PortStatisticsRecorder;
 use crate::port::update_connections::ConnectionFailure;
 use crate::port::{DegradationAction, DegradationHandler, ReceiveError};
 use crate::service::NoResource;
@@ -46,13 +55,29 @@ pub(crate) struct SenderDetails {
     pub(crate) number_of_samples: usize,
     pub(crate) max_number_of_segments: u8,
     pub(crate) data_segment_type: DataSegmentType,
+    /// The weight of the sender for the [`ReceivePolicy`] of the receiver.
+    pub(crate) weight: u32,
 }
 
 #[derive(Debug)]
 pub(crate) struct Connection<Service: service::Service> {
     pub(crate) receiver: <Service::Connection as ZeroCopyConnection>::Receiver,
-    pub(crate) data_segment: DataSegmentView<Service>,
+    /// The data segment of the sender is mapped when the first offset is received and can
+    /// be unmapped again when the sender was idle, see [`Connection::unmap_idle_data_segment()`].
+    data_segment: UnsafeCell<Option<DataSegmentView<Service>>>,
+    data_segment_type: DataSegmentType,
+    /// The time of the last received offset, it is only tracked when
+    /// [`Global::data_segment_idle_timeout`](crate::config::Global::data_segment_idle_timeout)
+    /// is defined.
+    last_receive_time: UnsafeCell<Option<Time>>,
     pub(crate) sender_port_id: u128,
+    /// The sequence number of the next sample that is expected from the sender. It is [`None`]
+    /// until the first sample was received.
+    pub(crate) expected_sequence_number: UnsafeCell<Option<u64>>,
+    pub(crate) weight: u32,
+    /// Set when the sender signaled new data, see [`Receiver::mark_connection_as_ready()`].
+    /// Only evaluated when [`Receiver::track_ready_connections`] is enabled.
+    is_ready: UnsafeCell<bool>,
     tag: Tag,
 }
 
@@ -65,9 +90,9 @@ impl<Service: service::Service> Abandonable for Connection<Service> {
                 NonNull::iox2_from_mut(&mut this.receiver),
             )
         };
-        unsafe {
-            DataSegmentView::abandon_in_place(NonNull::iox2_from_mut(&mut this.data_segment))
-        };
+        if let Some(data_segment) = this.data_segment.get_mut() {
+            unsafe { DataSegmentView::abandon_in_place(NonNull::iox2_from_mut(data_segment)) };
+        }
     }
 }
 
@@ -108,35 +133,138 @@ impl<Service: service::Service> Connection<Service> {
                                     .create_receiver(),
                         "{} since the zero copy connection could not be established.", msg);
 
-        let segment_name = data_segment_name(sender_port_id);
-        let data_segment = match data_segment_type {
+        let active_buffer_size = unsafe { *this.active_buffer_size.get() };
+        if active_buffer_size < this.buffer_size {
+            receiver.set_active_buffer_size(active_buffer_size);
+        }
+
+        let connection = Self {
+            receiver,
+            data_segment: UnsafeCell::new(None),
+            data_segment_type,
+            last_receive_time: UnsafeCell::new(None),
+            sender_port_id,
+            expected_sequence_number: UnsafeCell::new(None),
+            weight: 1,
+            // the sender may have delivered data before the connection was established
+            is_ready: UnsafeCell::new(true),
+            tag: cyclic_tagger.create_tag(),
+        };
+
+        if !global_config.global.lazy_data_segment_mapping {
+            fail!(from this,
+                when connection.map_data_segment(global_config),
+                "{} since the sender data segment could not be opened.", msg);
+        }
+
+        Ok(connection)
+    }
+
+    /// Returns the data segment of the sender when it is mapped.
+    fn data_segment(&self) -> Option<&DataSegmentView<Service>> {
+        unsafe { &*self.data_segment.get() }.as_ref()
+    }
+
+    /// Returns the data segment of the sender and maps it when it was not yet mapped.
+    fn map_data_segment(
+        &self,
+        global_config: &config::Config,
+    ) -> Result<&DataSegmentView<Service>, SharedMemoryOpenError> {
+        let data_segment = unsafe { &mut *self.data_segment.get() };
+        if let Some(data_segment) = data_segment {
+            return Ok(data_segment);
+        }
+
+        let segment_name = data_segment_name(self.sender_port_id);
+        let view = match self.data_segment_type {
             DataSegmentType::Static => {
                 DataSegmentView::open_static_segment(&segment_name, global_config)
             }
             DataSegmentType::Dynamic => {
-                DataSegmentView::open_dynamic_segment(&segment_name, global_config)
+                DataSegmentView::open_dynamic_segment(&segment_name, global_config, false)
+            }
+            DataSegmentType::SizeClasses => {
+                DataSegmentView::open_dynamic_segment(&segment_name, global_config, true)
             }
+        }?;
+
+        Ok(data_segment.insert(view))
+    }
+
+    /// Calls `f` with the address of the next chunk in the channel without receiving it.
+    /// Returns [`None`] when the channel is empty or the chunk could not be mapped.
+    fn peek_chunk<R, F: FnOnce(usize) -> R>(
+        &self,
+        channel_id: ChannelId,
+        global_config: &config::Config,
+        f: F,
+    ) -> Option<R> {
+        let offset = self.receiver.peek(channel_id)?;
+        let data_segment = self.map_data_segment(global_config).ok()?;
+        let address = data_segment.register_and_translate_offset(offset).ok()?;
+        let result = f(address);
+        unsafe { data_segment.unregister_offset(offset) };
+
+        Some(result)
+    }
+
+    unsafe fn unregister_offset(&self, offset: PointerOffset) {
+        if let Some(data_segment) = self.data_segment() {
+            unsafe { data_segment.unregister_offset(offset) };
+        }
+    }
+
+    /// Stores the time of the received offset when an idle timeout is defined.
+    fn update_last_receive_time(&self, idle_timeout: Option<Duration>) {
+        if idle_timeout.is_some() {
+            unsafe { *self.last_receive_time.get() = CycleClock::now().ok() };
+        }
+    }
+
+    /// Unmaps the data segment of the sender when no offset was received for `idle_timeout`
+    /// and no received offset is still borrowed.
+    fn unmap_idle_data_segment(&self, idle_timeout: Option<Duration>) {
+        let idle_timeout = match idle_timeout {
+            Some(idle_timeout) => idle_timeout,
+            None => return,
         };
 
-        let data_segment = fail!(from this,
-                                 when data_segment,
-                                "{} since the sender data segment could not be opened.", msg);
+        if self.data_segment().is_none() {
+            return;
+        }
 
-        Ok(Self {
-            receiver,
-            data_segment,
-            sender_port_id,
-            tag: cyclic_tagger.create_tag(),
-        })
+        let is_idle = match unsafe { &*self.last_receive_time.get() } {
+            Some(last_receive_time) => CycleClock::elapsed_since(last_receive_time)
+                .is_ok_and(|elapsed| elapsed >= idle_timeout),
+            None => true,
+        };
+
+        let has_borrows = (0..self.receiver.number_of_channels())
+            .any(|channel| self.receiver.borrow_count(ChannelId::new(channel)) > 0);
+
+        if is_idle && !has_borrows {
+            unsafe { *self.data_segment.get() = None };
+        }
     }
 }
 
+/// The position from which the next receive call starts to iterate over the connections.
+#[derive(Debug, Default)]
+pub(crate) struct ReceiveCursor {
+    next_key: usize,
+    number_of_served_samples: u32,
+}
+
 #[derive(Debug)]
 pub(crate) struct Receiver<Service: service::Service> {
     pub(crate) connections: PolymorphicVec<'static, UnsafeCell<Option<SlotMapKey>>, HeapAllocator>,
     pub(crate) receiver_port_id: u128,
     pub(crate) service_state: SharedServiceState<Service, NoResource>,
+    /// The capacity of the connections, it is the upper limit of the active buffer size.
     pub(crate) buffer_size: usize,
+    /// The number of samples every connection holds before it overflows, see
+    /// [`Receiver::set_active_buffer_size()`].
+    pub(crate) active_buffer_size: UnsafeCell<usize>,
     pub(crate) tagger: CyclicTagger,
     pub(crate) to_be_removed_connections:
         Option<UnsafeCell<PolymorphicVec<'static, SlotMapKey, HeapAllocator>>>,
@@ -147,6 +275,16 @@ pub(crate) struct Receiver<Service: service::Service> {
     pub(crate) number_of_channels: usize,
     pub(crate) connection_storage: UnsafeCell<SlotMap<Connection<Service>>>,
     pub(crate) initial_channel_state: ChannelState,
+    pub(crate) delivery_mode: DeliveryMode,
+    pub(crate) receive_policy: ReceivePolicy,
+    pub(crate) receive_cursor: UnsafeCell<ReceiveCursor>,
+    /// When enabled, only the connections that were marked with
+    /// [`Receiver::mark_connection_as_ready()`] are visited on receive.
+    pub(crate) track_ready_connections: bool,
+    /// The number of bytes of the next pending sample that are prefetched after a sample was
+    /// received, `0` disables the prefetching.
+    pub(crate) prefetch_size: usize,
+    pub(crate) statistics: PortStatisticsRecorder,
 }
 
 impl<Service: service::Service> Abandonable for Receiver<Service> {
@@ -167,7 +305,7 @@ impl<Service: service::Service> Receiver<Service> {
                 return;
             }
 
-            unsafe { connection.data_segment.unregister_offset(chunk.offset) };
+            unsafe { connection.unregister_offset(chunk.offset) };
             match connection.receiver.release(chunk.offset, channel_id) {
                 Ok(()) => (),
                 Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
@@ -177,6 +315,85 @@ impl<Service: service::Service> Receiver<Service> {
         }
     }
 
+    /// Releases multiple chunks at once. Consecutive chunks that were delivered by the same
+    /// connection via the same channel are returned to the sender with a single
+    /// [`ZeroCopyReceiver::release_many()`] call.
+    pub(crate) fn release_offsets(&self, chunks: &[ChunkDetails]) {
+        const MAX_RUN_LENGTH: usize = 32;
+
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        let mut offsets = [PointerOffset::new(0); MAX_RUN_LENGTH];
+        let mut remaining = chunks;
+        while let Some(first) = remaining.first() {
+            let run_length = remaining
+                .iter()
+                .take(MAX_RUN_LENGTH)
+                .take_while(|chunk| {
+                    chunk.connection_key == first.connection_key
+                        && chunk.origin == first.origin
+                        && chunk.channel_id == first.channel_id
+                })
+                .count();
+            let (run, rest) = remaining.split_at(run_length);
+            remaining = rest;
+
+            let connection = match connection_storage.get(first.connection_key) {
+                Some(connection) if connection.sender_port_id == first.origin => connection,
+                _ => continue,
+            };
+
+            for (offset, chunk) in offsets.iter_mut().zip(run) {
+                unsafe { connection.unregister_offset(chunk.offset) };
+                *offset = chunk.offset;
+            }
+
+            match connection
+                .receiver
+                .release_many(&offsets[..run_length], first.channel_id)
+            {
+                Ok(()) => (),
+                Err(ZeroCopyReleaseError::RetrieveBufferFull) => {
+                    error!(from self, "This should never happen! The publishers retrieve channel is full and the samples cannot be returned.");
+                }
+            }
+        }
+    }
+
+    /// Returns true when the sender that delivered the chunk is still connected. A connection
+    /// that is only kept alive since some of its chunks are still borrowed is not connected.
+    pub(crate) fn is_origin_connected(&self, chunk: &ChunkDetails) -> bool {
+        let is_active_connection = self
+            .connections
+            .iter()
+            .any(|connection_key| unsafe { *connection_key.get() } == Some(chunk.connection_key));
+        if !is_active_connection {
+            return false;
+        }
+
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        match connection_storage.get(chunk.connection_key) {
+            Some(connection) => connection.sender_port_id == chunk.origin,
+            None => false,
+        }
+    }
+
+    pub(crate) fn active_buffer_size(&self) -> usize {
+        unsafe { *self.active_buffer_size.get() }
+    }
+
+    /// Sets the number of samples every connection holds before it overflows and applies it to
+    /// all established connections. Samples that exceed the new buffer size are returned to
+    /// their senders, oldest first. The value must be in `1..=`[`Receiver::buffer_size`].
+    pub(crate) fn set_active_buffer_size(&self, value: usize) {
+        debug_assert!(0 < value && value <= self.buffer_size);
+        unsafe { *self.active_buffer_size.get() = value };
+
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        for (_, connection) in connection_storage.iter() {
+            connection.receiver.set_active_buffer_size(value);
+        }
+    }
+
     pub(crate) fn set_channel_state(&self, channel_id: ChannelId, state: ChannelState) -> bool {
         let mut ret_val = true;
         let connection_storage = unsafe { &mut *self.connection_storage.get() };
@@ -204,6 +421,17 @@ impl<Service: service::Service> Receiver<Service> {
         ret_val
     }
 
+    pub(crate) fn at_least_one_channel_is_rejected(
+        &self,
+        channel_id: ChannelId,
+        state: ChannelState,
+    ) -> bool {
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        connection_storage
+            .iter()
+            .any(|(_, connection)| connection.receiver.is_channel_rejected(channel_id, state))
+    }
+
     pub(crate) fn set_disconnect_hint(&self, channel_id: ChannelId, expected_state: ChannelState) {
         let connection_storage = unsafe { &mut *self.connection_storage.get() };
         for (_, connection) in connection_storage.iter() {
@@ -232,7 +460,7 @@ impl<Service: service::Service> Receiver<Service> {
         sender_details: &SenderDetails,
     ) -> Result<(), ConnectionFailure> {
         let connection_storage = unsafe { &mut *self.connection_storage.get() };
-        let key = connection_storage.insert(Connection::new(
+        let mut connection = Connection::new(
             self,
             sender_details.data_segment_type,
             sender_details.port_id,
@@ -240,7 +468,10 @@ impl<Service: service::Service> Receiver<Service> {
             sender_details.max_number_of_segments,
             &self.tagger,
             self.initial_channel_state,
-        )?);
+        )?;
+        connection.weight = sender_details.weight.max(1);
+
+        let key = connection_storage.insert(connection);
         let key = match key {
             Some(v) => v,
             None => {
@@ -394,6 +625,36 @@ impl<Service: service::Service> Receiver<Service> {
         unsafe { *self.connections[index].get() = None };
     }
 
+    /// Marks the connection to the sender with the provided index in the dynamic config as
+    /// one that has received data since it was last visited.
+    pub(crate) fn mark_connection_as_ready(&self, index: usize) {
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        if let Some(Some(connection_key)) = self.connections.get(index).map(|c| unsafe { *c.get() })
+        {
+            if let Some(connection) = connection_storage.get(connection_key) {
+                unsafe { *connection.is_ready.get() = true };
+            }
+        }
+    }
+
+    /// Returns true when the connection may contain data. A ready connection that turned out
+    /// to be empty is visited again only after it was marked as ready.
+    fn is_ready_with_data(&self, connection: &Connection<Service>, channel_id: ChannelId) -> bool {
+        if !self.track_ready_connections {
+            return connection.receiver.has_data(channel_id);
+        }
+
+        if !unsafe { *connection.is_ready.get() } {
+            return false;
+        }
+
+        let has_data = connection.receiver.has_data(channel_id);
+        if !has_data {
+            unsafe { *connection.is_ready.get() = false };
+        }
+        has_data
+    }
+
     pub(crate) fn has_samples(&self, channel_id: ChannelId) -> bool {
         let connection_storage = unsafe { &mut *self.connection_storage.get() };
         for (_, connection) in connection_storage.iter() {
@@ -419,6 +680,21 @@ impl<Service: service::Service> Receiver<Service> {
         false
     }
 
+    fn prefetch_next_offset(
+        &self,
+        connection: &Connection<Service>,
+        data_segment: &DataSegmentView<Service>,
+        channel_id: ChannelId,
+    ) {
+        if let Some(address) = connection
+            .receiver
+            .peek(channel_id)
+            .and_then(|offset| data_segment.translate_offset_hint(offset))
+        {
+            prefetch_read(address as *const u8, self.prefetch_size);
+        }
+    }
+
     fn receive_from_connection(
         &self,
         connection: &Connection<Service>,
@@ -427,23 +703,45 @@ impl<Service: service::Service> Receiver<Service> {
     ) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
         let msg = "Unable to receive another sample";
 
-        match connection.receiver.receive(channel_id) {
+        let data = match self.delivery_mode {
+            DeliveryMode::Fifo => connection.receiver.receive(channel_id),
+            DeliveryMode::LatestOnly => connection.receiver.receive_latest(channel_id),
+        };
+
+        let global_config = self.service_state.shared_node().config();
+        let idle_timeout = global_config.global.data_segment_idle_timeout;
+        match data {
             Ok(data) => match data {
-                None => Ok(None),
+                None => {
+                    connection.unmap_idle_data_segment(idle_timeout);
+                    Ok(None)
+                }
                 Some(offset) => {
                     let details = ChunkDetails {
                         connection_key,
                         offset,
                         origin: connection.sender_port_id,
+                        channel_id,
                     };
 
-                    let offset = match connection
-                        .data_segment
-                        .register_and_translate_offset(offset)
-                    {
+                    let data_segment = match connection.map_data_segment(global_config) {
+                        Ok(data_segment) => data_segment,
+                        Err(e) => {
+                            if let Err(e) = connection.receiver.release(offset, channel_id) {
+                                error!(from self,
+                                    "This should never happen! Failed to return the chunk that was received before. [{e:?}]");
+                            }
+                            fail!(from self, with ReceiveError::ConnectionFailure(ConnectionFailure::UnableToMapSendersDataSegment(e)),
+                                "{} since the data segment of the sender {:?} could not be mapped.",
+                                msg, connection.sender_port_id);
+                        }
+                    };
+                    connection.update_last_receive_time(idle_timeout);
+
+                    let offset = match data_segment.register_and_translate_offset(offset) {
                         Ok(offset) => offset,
                         Err(e) => {
-                            if connection.data_segment.is_dynamic() {
+                            if data_segment.is_dynamic() {
                                 warn!(from self, "Lost chunk. This only happens in the dynamic use case when a sender has reallocated its data segment and gone out of scope before the receiver has mapped the realloacted data segment. To circumvent this, you could either use static memory or increase the initial max slice len.");
                                 if let Err(e) = connection.receiver.release(offset, channel_id) {
                                     error!(from self,
@@ -457,6 +755,10 @@ impl<Service: service::Service> Receiver<Service> {
                         }
                     };
 
+                    if self.prefetch_size > 0 {
+                        self.prefetch_next_offset(connection, data_segment, channel_id);
+                    }
+
                     Ok(Some((
                         details,
                         Chunk::new(&self.message_type_details, offset),
@@ -541,6 +843,18 @@ impl<Service: service::Service> Receiver<Service> {
     pub(crate) fn receive(
         &self,
         channel_id: ChannelId,
+    ) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
+        let data = self.receive_impl(channel_id)?;
+        if data.is_some() {
+            self.statistics.add_received(1);
+        }
+
+        Ok(data)
+    }
+
+    fn receive_impl(
+        &self,
+        channel_id: ChannelId,
     ) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
         if let Some(data) = self.receive_from_to_be_removed_connections(channel_id)? {
             return Ok(Some(data));
@@ -550,8 +864,34 @@ impl<Service: service::Service> Receiver<Service> {
         let mut active_channel_count = 0;
         let mut all_channels_exceed_max_borrows = true;
         let connection_storage = unsafe { &*self.connection_storage.get() };
-        for (connection_key, connection) in connection_storage.iter() {
-            if !connection.receiver.has_data(channel_id) {
+        let start_key = match self.receive_policy {
+            ReceivePolicy::FixedOrder => 0,
+            _ => unsafe { &*self.receive_cursor.get() }.next_key,
+        };
+        let min_weight = match self.receive_policy {
+            ReceivePolicy::Priority => connection_storage
+                .iter()
+                .filter(|(_, c)| {
+                    self.is_ready_with_data(c, channel_id)
+                        && c.receiver.borrow_count(channel_id) < c.receiver.max_borrowed_samples()
+                })
+                .map(|(_, c)| c.weight)
+                .max()
+                .unwrap_or(0),
+            _ => 0,
+        };
+
+        // iterate from the start key to the end and wrap around to the beginning
+        let connections = connection_storage
+            .iter()
+            .skip_while(|(key, _)| key.value() < start_key)
+            .chain(
+                connection_storage
+                    .iter()
+                    .take_while(|(key, _)| key.value() < start_key),
+            );
+        for (connection_key, connection) in connections {
+            if !self.is_ready_with_data(connection, channel_id) {
                 continue;
             }
 
@@ -564,9 +904,14 @@ impl<Service: service::Service> Receiver<Service> {
                 all_channels_exceed_max_borrows = false;
             }
 
+            if connection.weight < min_weight {
+                continue;
+            }
+
             if let Some((details, absolute_address)) =
                 self.receive_from_connection(connection, connection_key, channel_id)?
             {
+                self.advance_receive_cursor(connection_key, connection.weight);
                 return Ok(Some((details, absolute_address)));
             }
         }
@@ -579,6 +924,101 @@ impl<Service: service::Service> Receiver<Service> {
         Ok(None)
     }
 
+    /// Receives the next chunk of the connection whose next chunk has the smallest key, so that
+    /// the chunks of all connections are merged in the order of their keys. The key is acquired
+    /// with `key_of` from the address of the next chunk of every connection without receiving
+    /// it. Connections with the same key are served in the order in which they are stored.
+    pub(crate) fn receive_ordered_by<K: Ord, F: Fn(usize) -> K>(
+        &self,
+        channel_id: ChannelId,
+        key_of: F,
+    ) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
+        let data = match self.receive_from_to_be_removed_connections(channel_id)? {
+            Some(data) => Some(data),
+            None => self.receive_smallest_key(channel_id, key_of)?,
+        };
+
+        if data.is_some() {
+            self.statistics.add_received(1);
+        }
+
+        Ok(data)
+    }
+
+    fn receive_smallest_key<K: Ord, F: Fn(usize) -> K>(
+        &self,
+        channel_id: ChannelId,
+        key_of: F,
+    ) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
+        let msg = "Unable to receive data in order";
+        let global_config = self.service_state.shared_node().config();
+        let connection_storage = unsafe { &*self.connection_storage.get() };
+        let mut active_channel_count = 0;
+        let mut next: Option<(K, SlotMapKey, &Connection<Service>)> = None;
+        for (connection_key, connection) in connection_storage.iter() {
+            if !self.is_ready_with_data(connection, channel_id) {
+                continue;
+            }
+
+            active_channel_count += 1;
+            if connection.receiver.borrow_count(channel_id)
+                >= connection.receiver.max_borrowed_samples()
+            {
+                continue;
+            }
+
+            // a chunk that cannot be peeked is received right away so that the failure is
+            // reported by the receive call
+            let key = match connection.peek_chunk(channel_id, global_config, &key_of) {
+                Some(key) => key,
+                None => {
+                    return self.receive_from_connection(connection, connection_key, channel_id);
+                }
+            };
+
+            if next.as_ref().is_none_or(|(next_key, _, _)| key < *next_key) {
+                next = Some((key, connection_key, connection));
+            }
+        }
+
+        match next {
+            Some((_, connection_key, connection)) => {
+                self.receive_from_connection(connection, connection_key, channel_id)
+            }
+            None => {
+                if active_channel_count != 0 {
+                    fail!(from self, with ReceiveError::ExceedsMaxBorrows,
+                        "{msg} since every channel exceeds the max number of borrows.");
+                }
+
+                Ok(None)
+            }
+        }
+    }
+
+    fn advance_receive_cursor(&self, connection_key: SlotMapKey, weight: u32) {
+        let cursor = unsafe { &mut *self.receive_cursor.get() };
+        match self.receive_policy {
+            ReceivePolicy::FixedOrder => (),
+            ReceivePolicy::RoundRobin | ReceivePolicy::Priority => {
+                cursor.next_key = connection_key.value() + 1;
+            }
+            ReceivePolicy::WeightedFair => {
+                if cursor.next_key != connection_key.value() {
+                    cursor.number_of_served_samples = 0;
+                }
+
+                cursor.number_of_served_samples += 1;
+                if cursor.number_of_served_samples < weight {
+                    cursor.next_key = connection_key.value();
+                } else {
+                    cursor.next_key = connection_key.value() + 1;
+                    cursor.number_of_served_samples = 0;
+                }
+            }
+        }
+    }
+
     pub(crate) fn start_update_connection_cycle(&self) {
         self.tagger.next_cycle();
     }
@@ -619,6 +1059,7 @@ impl<Service: service::Service> Receiver<Service> {
                             .value(),
                         sender_port_id: sender_details.port_id,
                         receiver_port_id: self.receiver_port_id(),
+                        buffer_size: self.buffer_size,
                     },
                 ) {
                     DegradationAction::Ignore => Ok(()),
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::vec::Vec;
+
+use iceoryx2_cal::zero_copy_connection::ChannelId;
+
+use super::chunk_details::ChunkDetails;
+use crate::active_request::RequestId;
+use crate::identifiers::UniqueClientId;
+use crate::service::header::request_response::MAX_NUMBER_OF_COALESCED_REQUESTS;
+
+const FNV_OFFSET_BASIS: u64 = 0xcbf29ce484222325;
+const FNV_PRIME: u64 = 0x100000001b3;
+
+/// Identifies the request of an [`ActiveRequest`](crate::active_request::ActiveRequest) on
+/// the server side. The combination is unique as long as the
+/// [`ActiveRequest`](crate::active_request::ActiveRequest) is alive.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct RequestKey {
+    pub(crate) connection_id: usize,
+    pub(crate) channel_id: ChannelId,
+    pub(crate) request_id: RequestId,
+}
+
+/// A received request that is identical to an in-flight request and is therefore
+/// served by the responses of the in-flight request.
+#[derive(Debug)]
+pub(crate) struct CoalescedRequest {
+    pub(crate) details: ChunkDetails,
+    pub(crate) client_id: UniqueClientId,
+    pub(crate) key: RequestKey,
+}
+
+/// The request content that is compared to identify identical requests. It points into the
+/// request chunk of the in-flight request which stays valid until the corresponding
+/// [`ActiveRequest`](crate::active_request::ActiveRequest) is dropped and the entry is
+/// removed.
+#[derive(Debug, Clone, Copy)]
+pub(crate) struct RequestContent {
+    pub(crate) user_header: *const u8,
+    pub(crate) user_header_size: usize,
+    pub(crate) payload: *const u8,
+    pub(crate) payload_size: usize,
+}
+
+impl RequestContent {
+    fn user_header(&self) -> &[u8] {
+        unsafe { core::slice::from_raw_parts(self.user_header, self.user_header_size) }
+    }
+
+    fn payload(&self) -> &[u8] {
+        unsafe { core::slice::from_raw_parts(self.payload, self.payload_size) }
+    }
+
+    fn hash(&self) -> u64 {
+        self.user_header()
+            .iter()
+            .chain(self.payload().iter())
+            .fold(FNV_OFFSET_BASIS, |hash, byte| {
+                (hash ^ *byte as u64).wrapping_mul(FNV_PRIME)
+            })
+    }
+
+    fn is_equal_to(&self, other: &RequestContent) -> bool {
+        self.user_header() == other.user_header() && self.payload() == other.payload()
+    }
+}
+
+#[derive(Debug)]
+struct InFlightRequest {
+    key: RequestKey,
+    hash: u64,
+    content: RequestContent,
+    coalesced_requests: Vec<CoalescedRequest>,
+}
+
+/// Tracks all in-flight requests of a [`Server`](crate::port::server::Server) that was
+/// created with request coalescing enabled.
+#[derive(Debug, Default)]
+pub(crate) struct InFlightRequests {
+    requests: Vec<InFlightRequest>,
+}
+
+// The raw pointers refer to request chunks in the shared memory data segments. They are only
+// accessed while the server's shared state is locked.
+unsafe impl Send for InFlightRequests {}
+
+impl InFlightRequests {
+    /// Attaches the request to an identical in-flight request. If there is none or the
+    /// in-flight request cannot serve more requests, the request is registered as in-flight
+    /// request itself and handed back to the caller.
+    pub(crate) fn coalesce_or_register(
+        &mut self,
+        request: CoalescedRequest,
+        content: RequestContent,
+    ) -> Option<CoalescedRequest> {
+        let hash = content.hash();
+
+        if let Some(in_flight) = self
+            .requests
+            .iter_mut()
+            .find(|r| r.hash == hash && r.content.is_equal_to(&content))
+        {
+            // the in-flight request itself occupies one recipient slot of the response header
+            if in_flight.coalesced_requests.len() + 1 < MAX_NUMBER_OF_COALESCED_REQUESTS {
+                in_flight.coalesced_requests.push(request);
+                return None;
+            }
+
+            return Some(request);
+        }
+
+        self.requests.push(InFlightRequest {
+            key: request.key,
+            hash,
+            content,
+            coalesced_requests: Vec::with_capacity(MAX_NUMBER_OF_COALESCED_REQUESTS - 1),
+        });
+
+        Some(request)
+    }
+
+    /// Returns all requests that were attached to the in-flight request.
+    pub(crate) fn coalesced_requests(&self, key: &RequestKey) -> &[CoalescedRequest] {
+        match self.requests.iter().find(|r| r.key == *key) {
+            Some(in_flight) => &in_flight.coalesced_requests,
+            None => &[],
+        }
+    }
+
+    /// Removes the in-flight request and returns all requests that were attached to it.
+    pub(crate) fn remove(&mut self, key: &RequestKey) -> Vec<CoalescedRequest> {
+        match self.requests.iter().position(|r| r.key == *key) {
+            Some(idx) => self.requests.swap_remove(idx).coalesced_requests,
+            None => Vec::new(),
+        }
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::vec::Vec;
+
+use super::chunk::Chunk;
+use super::chunk_details::ChunkDetails;
+use crate::service::header::request_response::RequestHeader;
+
+/// A request that was received by a [`Server`](crate::port::server::Server) with deadline
+/// scheduling enabled but not yet handed out.
+#[derive(Debug)]
+pub(crate) struct ScheduledRequest {
+    pub(crate) details: ChunkDetails,
+    pub(crate) chunk: Chunk,
+}
+
+impl ScheduledRequest {
+    pub(crate) fn header(&self) -> &RequestHeader {
+        unsafe { &*(self.chunk.header as *const RequestHeader) }
+    }
+}
+
+/// Holds the received requests of a [`Server`](crate::port::server::Server) with deadline
+/// scheduling enabled in the order of their arrival.
+#[derive(Debug, Default)]
+pub(crate) struct ScheduledRequests {
+    requests: Vec<ScheduledRequest>,
+}
+
+// The raw pointers refer to request chunks in the shared memory data segments. They are only
+// accessed while the server's shared state is locked.
+unsafe impl Send for ScheduledRequests {}
+
+impl ScheduledRequests {
+    pub(crate) fn is_empty(&self) -> bool {
+        self.requests.is_empty()
+    }
+
+    pub(crate) fn push(&mut self, request: ScheduledRequest) {
+        self.requests.push(request);
+    }
+
+    /// Removes and returns all requests whose deadline is before `now`, the nanoseconds of
+    /// the monotonic clock.
+    pub(crate) fn take_expired(&mut self, now: u64) -> Vec<ScheduledRequest> {
+        if !self.requests.iter().any(|r| r.header().deadline < now) {
+            return Vec::new();
+        }
+
+        let (expired, pending) = core::mem::take(&mut self.requests)
+            .into_iter()
+            .partition(|r| r.header().deadline < now);
+        self.requests = pending;
+
+        expired
+    }
+
+    /// Removes and returns the request with the earliest deadline. When multiple requests
+    /// have the same deadline, the one that arrived first is returned. Requests without a
+    /// deadline come last since their deadline is the maximum value.
+    pub(crate) fn pop_earliest(&mut self) -> Option<ScheduledRequest> {
+        let idx = self
+            .requests
+            .iter()
+            .enumerate()
+            .min_by_key(|(_, r)| r.header().deadline)
+            .map(|(idx, _)| idx)?;
+
+        Some(self.requests.remove(idx))
+    }
+
+    /// Removes and returns all requests.
+    pub(crate) fn take_all(&mut self) -> Vec<ScheduledRequest> {
+        core::mem::take(&mut self.requests)
+    }
+}
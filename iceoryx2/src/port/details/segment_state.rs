@@ -57,4 +57,10 @@ impl SegmentState {
         self.sample_reference_counter[self.sample_index(distance_to_chunk)]
             .fetch_sub(1, Ordering::Relaxed)
     }
+
+    pub(crate) fn is_unused(&self) -> bool {
+        self.sample_reference_counter
+            .iter()
+            .all(|counter| counter.load(Ordering::Relaxed) == 0)
+    }
 }
@@ -12,6 +12,7 @@
 
 use core::alloc::Layout;
 use core::ptr::NonNull;
+use core::time::Duration;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 
 use alloc::format;
@@ -22,6 +23,9 @@ use iceoryx2_bb_concurrency::cell::UnsafeCell;
 use iceoryx2_bb_elementary::cyclic_tagger::*;
 use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
+use iceoryx2_bb_lock_free::mpmc::counting_bit_set::RelocatableCountingBitSet;
+use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitStrategy;
+use iceoryx2_cal::event::{Event, EventId, Notifier, NotifierBuilder, NotifierNotifyError};
 use iceoryx2_cal::named_concept::NamedConceptBuilder;
 use iceoryx2_cal::shm_allocator::{AllocationError, PointerOffset, ShmAllocationError};
 use iceoryx2_cal::zero_copy_connection::{
@@ -32,15 +36,18 @@ use iceoryx2_cal::zero_copy_connection::{
 use iceoryx2_log::{error, fail, fatal_panic, warn};
 
 use crate::node::SharedNode;
+use crate::port::content_filter::ContentFilter;
+use crate::port::statistics::PortStatisticsRecorder;
 use crate::port::{
     BackpressureHandler, BackpressureInfo, DegradationAction, DegradationCause, DegradationHandler,
     DegradationInfo, LoanError, SendError,
 };
 use crate::prelude::BackpressureStrategy;
-use crate::service::config_scheme::connection_config;
+use crate::service;
+use crate::service::config_scheme::{connection_config, event_config};
+use crate::service::naming_scheme::{connection_name, receiver_wake_up_name};
 use crate::service::static_config::message_type_details::{MessageTypeDetails, TypeVariant};
 use crate::service::{NoResource, SharedServiceState};
-use crate::{service, service::naming_scheme::connection_name};
 
 use super::chunk::ChunkMut;
 use super::data_segment::DataSegment;
@@ -50,12 +57,16 @@ use super::segment_state::SegmentState;
 pub(crate) struct ReceiverDetails {
     pub(crate) port_id: u128,
     pub(crate) buffer_size: usize,
+    pub(crate) content_filter: ContentFilter,
+    pub(crate) has_wake_up_channel: bool,
 }
 
 #[derive(Debug)]
 pub(crate) struct Connection<Service: service::Service> {
     pub(crate) sender: <Service::Connection as ZeroCopyConnection>::Sender,
     pub(crate) receiver_port_id: u128,
+    pub(crate) content_filter: ContentFilter,
+    wake_up: Option<<Service::Event as Event<RelocatableCountingBitSet>>::Notifier>,
     tag: Tag,
 }
 
@@ -67,6 +78,13 @@ impl<Service: service::Service> Abandonable for Connection<Service> {
                 NonNull::iox2_from_mut(&mut this.sender),
             )
         };
+        if let Some(wake_up) = this.wake_up.as_mut() {
+            unsafe {
+                <Service::Event as Event<RelocatableCountingBitSet>>::Notifier::abandon_in_place(
+                    NonNull::iox2_from_mut(wake_up),
+                )
+            };
+        }
     }
 }
 
@@ -81,6 +99,8 @@ impl<Service: service::Service> Connection<Service> {
         this: &Sender<Service>,
         receiver_port_id: u128,
         buffer_size: usize,
+        content_filter: ContentFilter,
+        has_wake_up_channel: bool,
         number_of_samples: usize,
         tag: Tag,
         initial_channel_state: ChannelState,
@@ -105,13 +125,37 @@ impl<Service: service::Service> Connection<Service> {
                                 .max_supported_shared_memory_segments(this.max_number_of_segments)
                                 .initial_channel_state(initial_channel_state)
                                 .number_of_channels(this.number_of_channels)
+                                .prefault(this.prefault_connections)
+                                .lock_in_memory(this.lock_connections_in_memory)
                                 .timeout(this.shared_node.config().global.creation_timeout)
+                                .wait_strategy(this.backpressure_wait_strategy)
+                                .wake_up_on_free_space(this.backpressure_wake_up_timeout)
                                 .create_sender(),
                         "{}.", msg);
 
+        let wake_up = if has_wake_up_channel {
+            match <Service::Event as Event<RelocatableCountingBitSet>>::NotifierBuilder::new(
+                &receiver_wake_up_name(receiver_port_id),
+            )
+            .config(&event_config::<Service>(this.shared_node.config()))
+            .open()
+            {
+                Ok(notifier) => Some(notifier),
+                Err(e) => {
+                    warn!(from this,
+                        "{} since the wake up channel could not be opened ({:?}). The receiver will not be woken up.", msg, e);
+                    None
+                }
+            }
+        } else {
+            None
+        };
+
         Ok(Self {
             sender,
             receiver_port_id,
+            content_filter,
+            wake_up,
             tag,
         })
     }
@@ -136,9 +180,17 @@ pub(crate) struct Sender<Service: service::Service> {
     pub(crate) tagger: CyclicTagger,
     pub(crate) loan_counter: AtomicUsize,
     pub(crate) backpressure_strategy: BackpressureStrategy,
+    pub(crate) backpressure_wait_strategy: AdaptiveWaitStrategy,
+    pub(crate) backpressure_wake_up_timeout: Option<Duration>,
     pub(crate) message_type_details: MessageTypeDetails,
     pub(crate) number_of_channels: usize,
     pub(crate) initial_channel_state: ChannelState,
+    pub(crate) prefault_connections: bool,
+    pub(crate) lock_connections_in_memory: bool,
+    /// The event id that is signaled on the wake up channel of the receivers. Clients use
+    /// their index in the client list so that the server can identify the connection.
+    pub(crate) wake_up_event_id: AtomicUsize,
+    pub(crate) statistics: PortStatisticsRecorder,
 }
 
 impl<Service: service::Service> Abandonable for Sender<Service> {
@@ -163,7 +215,7 @@ impl<Service: service::Service> Abandonable for Sender<Service> {
 }
 
 impl<Service: service::Service> Sender<Service> {
-    fn get(&self, index: usize) -> &Option<Connection<Service>> {
+    pub(crate) fn get(&self, index: usize) -> &Option<Connection<Service>> {
         unsafe { &(*self.connections[index].get()) }
     }
 
@@ -226,6 +278,10 @@ impl<Service: service::Service> Sender<Service> {
                                 receiver_port_id: connection.receiver_port_id,
                                 retries,
                                 elapsed_time,
+                                buffer_size: connection.sender.buffer_size(),
+                                number_of_buffered_samples: connection
+                                    .sender
+                                    .number_of_buffered_samples(channel_id),
                             })
                             .into()
                     },
@@ -268,6 +324,7 @@ impl<Service: service::Service> Sender<Service> {
                      *   try_send => we tried and expect that the buffer is full
                      *
                      * */
+                    self.statistics.add_overflows(1);
                 }
                 Err(ZeroCopySendError::NoConnectedReceiverAndBufferIsFull)
                 | Err(ZeroCopySendError::ChannelIsClosed) => {
@@ -290,6 +347,7 @@ impl<Service: service::Service> Sender<Service> {
                                 .value(),
                             sender_port_id: self.sender_port_id,
                             receiver_port_id: connection.receiver_port_id,
+                            buffer_size: connection.sender.buffer_size(),
                         },
                     ) {
                         DegradationAction::Ignore => (),
@@ -310,8 +368,24 @@ impl<Service: service::Service> Sender<Service> {
                     number_of_recipients += 1;
 
                     if let Some(old) = overflow {
+                        self.statistics.add_overflows(1);
                         self.release_sample(old)
                     }
+
+                    // does not cause a system call when the receiver has not yet consumed the
+                    // previous wake up
+                    if let Some(wake_up) = &connection.wake_up {
+                        let event_id = self.wake_up_event_id.load(Ordering::Relaxed);
+                        match wake_up.notify(EventId::new(event_id)) {
+                            // the receiver disconnected and is cleaned up in the next round
+                            Ok(()) | Err(NotifierNotifyError::Disconnected) => (),
+                            Err(e) => {
+                                warn!(from self,
+                                    "{msg} {:?} the receiver {:?} could not be woken up ({:?}).",
+                                    offset, connection.receiver_port_id, e);
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -344,6 +418,17 @@ impl<Service: service::Service> Sender<Service> {
         }
     }
 
+    pub(crate) fn reject_channel(
+        &self,
+        channel_id: ChannelId,
+        connection_id: usize,
+        expected_state: ChannelState,
+    ) {
+        if let Some(connection) = self.get(connection_id) {
+            connection.sender.reject_channel(channel_id, expected_state);
+        }
+    }
+
     pub(crate) fn close_channel(
         &self,
         channel_id: ChannelId,
@@ -363,20 +448,63 @@ impl<Service: service::Service> Sender<Service> {
         connection_id: usize,
     ) -> Result<usize, SendError> {
         self.retrieve_returned_samples();
-        self.deliver_offset_to_connection_impl(offset, sample_size, channel_id, connection_id)
+        self.deliver_offset_to_connection_without_reclaim(
+            offset,
+            sample_size,
+            channel_id,
+            connection_id,
+        )
     }
 
+    /// Delivers the offset to the connection without reclaiming the returned samples first.
+    /// Used when multiple offsets are delivered in a row and the returned samples were
+    /// already retrieved once via [`Sender::retrieve_returned_samples()`].
+    pub(crate) fn deliver_offset_to_connection_without_reclaim(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        channel_id: ChannelId,
+        connection_id: usize,
+    ) -> Result<usize, SendError> {
+        let number_of_recipients =
+            self.deliver_offset_to_connection_impl(offset, sample_size, channel_id, connection_id)?;
+        self.statistics.add_sent();
+
+        Ok(number_of_recipients)
+    }
+
+    /// Delivers the offset to all connections whose [`ContentFilter`] accepts the
+    /// `user_header`. When no `user_header` is provided, the [`ContentFilter`]s are ignored.
     pub(crate) fn deliver_offset(
         &self,
         offset: PointerOffset,
         sample_size: usize,
         channel_id: ChannelId,
+        user_header: Option<*const u8>,
     ) -> Result<usize, SendError> {
         self.retrieve_returned_samples();
+        self.deliver_offset_without_reclaim(offset, sample_size, channel_id, user_header)
+    }
 
+    /// Delivers the offset to all connections without reclaiming the returned samples first.
+    /// Used when multiple offsets are delivered in a row and the returned samples were
+    /// already retrieved once via [`Sender::retrieve_returned_samples()`].
+    pub(crate) fn deliver_offset_without_reclaim(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        channel_id: ChannelId,
+        user_header: Option<*const u8>,
+    ) -> Result<usize, SendError> {
         let mut number_of_recipients = 0;
         let mut delivery_error = None;
         for i in 0..self.len() {
+            if let (Some(user_header), Some(connection)) = (user_header, self.get(i)) {
+                if !unsafe { connection.content_filter.accepts(user_header) } {
+                    continue;
+                }
+            }
+
             match self.deliver_offset_to_connection_impl(offset, sample_size, channel_id, i) {
                 Ok(n) => number_of_recipients += n,
                 Err(error) => match error {
@@ -407,6 +535,7 @@ impl<Service: service::Service> Sender<Service> {
         if let Some(e) = delivery_error {
             Err(e)
         } else {
+            self.statistics.add_sent();
             Ok(number_of_recipients)
         }
     }
@@ -425,6 +554,8 @@ impl<Service: service::Service> Sender<Service> {
             self,
             receiver_details.port_id,
             receiver_details.buffer_size,
+            receiver_details.content_filter,
+            receiver_details.has_wake_up_channel,
             self.number_of_samples,
             self.tagger.create_tag(),
             self.initial_channel_state,
@@ -438,6 +569,18 @@ impl<Service: service::Service> Sender<Service> {
     }
 
     pub(crate) fn allocate(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
+        let chunk = self.allocate_impl(layout);
+        if chunk.is_err() {
+            self.statistics.add_failed_loan();
+        }
+
+        chunk
+    }
+
+    /// Allocates a chunk like [`Sender::allocate()`] but does not count a failure in the
+    /// [`PortStatistics`](crate::port::statistics::PortStatistics). Used when the allocation
+    /// is retried after a failure.
+    pub(crate) fn allocate_impl(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
         self.retrieve_returned_samples();
         let msg = "Unable to allocate data";
 
@@ -519,7 +662,23 @@ impl<Service: service::Service> Sender<Service> {
         }
     }
 
-    fn remove_connection(&self, i: usize) {
+    /// Detaches the data segment for the reuse by another sender port with the same id. It
+    /// succeeds only when no sample is loaned, delivered or held by a receiver anymore. The
+    /// connections are closed so that the new owner can establish them again.
+    pub(crate) fn release_data_segment_for_reuse(&self) -> bool {
+        self.retrieve_returned_samples();
+        if !self.segment_states.iter().all(|state| state.is_unused()) {
+            return false;
+        }
+
+        for i in 0..self.len() {
+            *self.get_mut(i) = None;
+        }
+
+        self.data_segment.release_for_reuse()
+    }
+
+    pub(crate) fn remove_connection(&self, i: usize) {
         if let Some(connection) = self.get(i) {
             // # SAFETY: the receiver no longer exist, therefore we can
             //           reacquire all delivered samples
@@ -574,6 +733,7 @@ impl<Service: service::Service> Sender<Service> {
                             .value(),
                         sender_port_id: self.sender_port_id,
                         receiver_port_id: receiver_details.port_id,
+                        buffer_size: receiver_details.buffer_size,
                     },
                 ) {
                     DegradationAction::Ignore => (),
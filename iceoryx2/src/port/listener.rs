@@ -60,12 +60,16 @@
 
 use crate::config::Config;
 use crate::port::port_name::PortName;
+use crate::port::statistics::{PortStatistics, PortStatisticsCounters};
+use crate::port::wake_up_latency::{WakeUpLatency, WakeUpLatencyRecorder};
 use crate::service::config_scheme::event_config;
 use crate::service::dynamic_config::event::ListenerDetails;
 use crate::service::naming_scheme::event_concept_name;
 use crate::service::port_factory::listener::ListenerConfig;
 use crate::service::{NoResource, SharedServiceState};
+use crate::tracepoint::tracepoint;
 use crate::{identifiers::UniqueListenerId, service};
+use alloc::boxed::Box;
 use alloc::format;
 use core::ptr::NonNull;
 use core::time::Duration;
@@ -118,6 +122,8 @@ pub struct Listener<Service: service::Service> {
     >,
     service_state: SharedServiceState<Service, NoResource>,
     listener_details: &'static ListenerDetails,
+    statistics: &'static PortStatisticsCounters,
+    wake_up_latency: Option<Box<WakeUpLatencyRecorder>>,
     // IMPORTANT!
     // Fields of a rust struct are dropped in declaration order. Since this tag is our marker that the
     // port exists and might require cleanup after a crash, the tag must be defined as last member of
@@ -179,11 +185,14 @@ impl<Service: service::Service> Abandonable for Listener<Service> {
 
 impl<Service: service::Service> Drop for Listener<Service> {
     fn drop(&mut self) {
-        self.service_state
-            .dynamic_storage()
-            .get()
-            .event()
-            .release_listener_handle(self.dynamic_listener_handle)
+        let dynamic_config = self.service_state.dynamic_storage().get().event();
+        if self.wake_up_latency.is_some() {
+            dynamic_config
+                .number_of_wake_up_latency_trackers
+                .fetch_sub(1, Ordering::Relaxed);
+        }
+
+        dynamic_config.release_listener_handle(self.dynamic_listener_handle)
     }
 }
 
@@ -247,15 +256,56 @@ impl<Service: service::Service> Listener<Service> {
             }
         };
 
+        let statistics: *const PortStatisticsCounters = service
+            .dynamic_storage()
+            .get()
+            .event()
+            .listener_statistics_of(handle);
+
+        let wake_up_latency = if config.track_wake_up_latency {
+            service
+                .dynamic_storage()
+                .get()
+                .event()
+                .number_of_wake_up_latency_trackers
+                .fetch_add(1, Ordering::Relaxed);
+            Some(Box::new(WakeUpLatencyRecorder::default()))
+        } else {
+            None
+        };
+
         Ok(Self {
             port_tag,
             service_state: service.clone(),
             dynamic_listener_handle: handle,
             listener_details: unsafe { &*details },
+            // the statistics are stored in the dynamic config which outlives the listener
+            statistics: unsafe { &*statistics },
+            wake_up_latency,
             listener,
         })
     }
 
+    fn record_wake_up(&self, number_of_notifications: u64) {
+        self.statistics.add_received(number_of_notifications);
+        tracepoint!(listener_wake, number_of_notifications);
+
+        if number_of_notifications == 0 {
+            return;
+        }
+
+        if let Some(wake_up_latency) = &self.wake_up_latency {
+            wake_up_latency.record_since(
+                self.service_state
+                    .dynamic_storage()
+                    .get()
+                    .event()
+                    .last_notification_timestamp
+                    .load(Ordering::Relaxed),
+            );
+        }
+    }
+
     /// Returns the [`PortName`] of the [`Listener`]
     pub fn name(&self) -> &PortName {
         &self.listener_details.listener_name
@@ -280,6 +330,7 @@ impl<Service: service::Service> Listener<Service> {
         use iceoryx2_cal::event::Listener;
         let number_of_notifications = fail!(from self, when self.listener.lock().try_wait(callback),
                                             "Failed try_wait on underlying event::Listener");
+        self.record_wake_up(number_of_notifications);
         Ok(number_of_notifications)
     }
 
@@ -294,6 +345,7 @@ impl<Service: service::Service> Listener<Service> {
         use iceoryx2_cal::event::Listener;
         let number_of_notifications = fail!(from self, when self.listener.lock().timed_wait(callback, timeout),
                                             "Failed timed_wait({:?}) on underlying event::Listener", timeout);
+        self.record_wake_up(number_of_notifications);
         Ok(number_of_notifications)
     }
 
@@ -307,6 +359,7 @@ impl<Service: service::Service> Listener<Service> {
         use iceoryx2_cal::event::Listener;
         let number_of_notifications = fail!(from self, when self.listener.lock().blocking_wait(callback),
                                             "Failed blocking_wait on underlying event::Listener");
+        self.record_wake_up(number_of_notifications);
         Ok(number_of_notifications)
     }
 
@@ -314,6 +367,19 @@ impl<Service: service::Service> Listener<Service> {
     pub fn id(&self) -> UniqueListenerId {
         self.listener_details.listener_id
     }
+
+    /// Returns the [`PortStatistics`] of the [`Listener`]. `received` counts the
+    /// notifications the [`Listener`] woke up for.
+    pub fn statistics(&self) -> PortStatistics {
+        self.statistics.load()
+    }
+
+    /// Returns the [`WakeUpLatency`] histogram of the [`Listener`] or [`None`] when it was
+    /// created without
+    /// [`PortFactoryListener::track_wake_up_latency()`](crate::service::port_factory::listener::PortFactoryListener::track_wake_up_latency()).
+    pub fn wake_up_latency(&self) -> Option<WakeUpLatency> {
+        self.wake_up_latency.as_ref().map(|v| v.load())
+    }
 }
 
 pub(crate) unsafe fn remove_connection_of_listener<Service: service::Service>(
@@ -40,6 +40,9 @@ pub mod reader;
 pub mod server;
 /// Receiving endpoint (port) for publish-subscribe based communication
 pub mod subscriber;
+/// The wake up channel of a receiving port that can be attached to a
+/// [`WaitSet`](crate::waitset::WaitSet).
+pub mod wake_up_channel;
 /// Interface to perform cyclic updates to the ports. Required to deliver history to new
 /// participants or to perform other management tasks.
 pub mod update_connections;
@@ -50,6 +53,30 @@ pub mod writer;
 /// receiver is full and the service does not overflow.
 pub mod backpressure_strategy;
 
+/// Defines which samples a [`Subscriber`](crate::port::subscriber::Subscriber) is interested in.
+pub mod content_filter;
+
+/// Defines how a sender copies payload into the data segment when a copy is requested.
+pub mod copy_strategy;
+
+/// Defines which samples a receiver acquires from the buffer of a sender.
+pub mod delivery_mode;
+
+/// The counters of a port that show how many samples it sent, received or dropped.
+pub mod statistics;
+
+/// The histogram of the delays between a notification and the wake up of a
+/// [`Listener`](crate::port::listener::Listener).
+pub mod wake_up_latency;
+
+/// Sends the samples of a [`Publisher`](crate::port::publisher::Publisher) at fixed,
+/// absolute time slots.
+pub mod scheduled_publisher;
+
+/// Defines in which order a [`Server`](crate::port::server::Server) receives the requests of
+/// its [`Client`](crate::port::client::Client)s.
+pub mod receive_policy;
+
 pub use iceoryx2_cal::zero_copy_connection::BackpressureToReceiverAction;
 
 /// Defines the action that shall be take when data cannot be delivered. Is used as
@@ -98,6 +125,11 @@ pub struct BackpressureInfo {
     pub retries: u64,
     /// The elapsed time since the initial retry
     pub elapsed_time: Duration,
+    /// The capacity of the buffer of the receiver port
+    pub buffer_size: usize,
+    /// The number of samples that are currently stored in the buffer of the receiver port
+    /// and were not yet received
+    pub number_of_buffered_samples: usize,
 }
 
 /// The backpressurey handler invoked by a send function when data cannot be delivered
@@ -165,6 +197,8 @@ pub struct DegradationInfo {
     pub sender_port_id: u128,
     /// The receiver port id, which is involved in the degradation
     pub receiver_port_id: u128,
+    /// The buffer size of the connection between the sender and the receiver port
+    pub buffer_size: usize,
 }
 
 /// The degradation handler which is invoked when a degradation is detected
@@ -205,6 +239,50 @@ impl DegradationHandler<'_> {
     }
 }
 
+/// The sample loss context passed to the [`SampleLossHandler`]
+pub struct SampleLossInfo {
+    /// The sender port id, whose samples were lost
+    pub sender_port_id: u128,
+    /// The receiver port id, which detected the sample loss
+    pub receiver_port_id: u128,
+    /// The sequence number the receiver expected next
+    pub expected_sequence_number: u64,
+    /// The sequence number the receiver received instead
+    pub received_sequence_number: u64,
+}
+
+impl SampleLossInfo {
+    /// Returns the number of samples that were lost between the last received sample and the
+    /// current one.
+    pub fn number_of_lost_samples(&self) -> u64 {
+        self.received_sequence_number - self.expected_sequence_number
+    }
+}
+
+/// The sample loss handler which is invoked when a receiver detects a gap in the sequence
+/// numbers of the received samples of a sender
+///
+/// # Arguments
+///
+/// * SampleLossInfo: is a reference to [`SampleLossInfo`] with additional information
+///   for the user to handle the incident
+pub trait SampleLossFn: Fn(&SampleLossInfo) + Send {}
+
+impl<F: Fn(&SampleLossInfo) + Send> SampleLossFn for F {}
+
+tiny_fn! {
+    /// Defines a custom behavior whenever a port detects lost samples.
+    pub struct SampleLossHandler = Fn(info: &SampleLossInfo);
+}
+
+unsafe impl Send for SampleLossHandler<'_> {}
+
+impl Debug for SampleLossHandler<'_> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "")
+    }
+}
+
 /// Defines a failure that can occur in
 /// [`Publisher::loan()`](crate::port::publisher::Publisher::loan()) and
 /// [`Publisher::loan_uninit()`](crate::port::publisher::Publisher::loan_uninit())
@@ -48,6 +48,7 @@ use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_lock_free::mpmc::counting_bit_set::RelocatableCountingBitSet;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
 use iceoryx2_cal::{
     arc_sync_policy::ArcSyncPolicy, dynamic_storage::DynamicStorage, event::NotifierBuilder,
 };
@@ -55,6 +56,7 @@ use iceoryx2_cal::{event::Event, named_concept::NamedConceptBuilder};
 use iceoryx2_log::{debug, fail, warn};
 
 use crate::service::SharedServiceState;
+use crate::tracepoint::tracepoint;
 use crate::{
     identifiers::{UniqueListenerId, UniqueNodeId, UniqueNotifierId},
     port::port_name::PortName,
@@ -69,6 +71,7 @@ use crate::{
 };
 
 use super::event_id::EventId;
+use super::wake_up_latency::WakeUpLatencyRecorder;
 
 /// Failures that can occur when a new [`Notifier`] is created with the
 /// [`crate::service::port_factory::notifier::PortFactoryNotifier`].
@@ -125,12 +128,40 @@ struct Connection<Service: service::Service> {
     node_id: UniqueNodeId,
 }
 
+/// The notifications that were held back by the coalescing window of the [`Notifier`].
+#[derive(Debug, Default)]
+struct PendingNotifications {
+    last_delivery: Option<Time>,
+    event_ids: Vec<EventId>,
+}
+
+impl PendingNotifications {
+    fn is_within_window(&self, window: Duration) -> bool {
+        match &self.last_delivery {
+            Some(last_delivery) => match last_delivery.elapsed() {
+                Ok(elapsed) => elapsed < window,
+                Err(_) => false,
+            },
+            None => false,
+        }
+    }
+
+    fn add(&mut self, event_ids: &[EventId]) {
+        for event_id in event_ids {
+            if !self.event_ids.contains(event_id) {
+                self.event_ids.push(*event_id);
+            }
+        }
+    }
+}
+
 #[derive(Debug)]
 struct ListenerConnections<Service: service::Service> {
     #[allow(clippy::type_complexity)]
     connections: Vec<UnsafeCell<Option<Connection<Service>>>>,
     service_state: SharedServiceState<Service, NoResource>,
     list_state: UnsafeCell<ContainerState<ListenerDetails>>,
+    pending_notifications: UnsafeCell<PendingNotifications>,
 }
 
 impl<Service: service::Service> Abandonable for ListenerConnections<Service> {
@@ -152,6 +183,7 @@ impl<Service: service::Service> ListenerConnections<Service> {
             connections: vec![],
             service_state,
             list_state,
+            pending_notifications: UnsafeCell::new(PendingNotifications::default()),
         };
 
         new_self.connections.reserve(size);
@@ -209,6 +241,11 @@ impl<Service: service::Service> ListenerConnections<Service> {
         unsafe { &mut (*self.connections[index].get()) }
     }
 
+    #[allow(clippy::mut_from_ref)]
+    fn pending_notifications(&self) -> &mut PendingNotifications {
+        unsafe { &mut (*self.pending_notifications.get()) }
+    }
+
     fn len(&self) -> usize {
         self.connections.len()
     }
@@ -274,6 +311,7 @@ pub struct Notifier<Service: service::Service> {
     dynamic_notifier_handle: ContainerHandle,
     notifier_details: &'static NotifierDetails,
     on_drop_notification: Option<EventId>,
+    coalescing_window: Option<Duration>,
     // IMPORTANT!
     // Fields of a rust struct are dropped in declaration order. Since this tag is our marker that the
     // port exists and might require cleanup after a crash, the tag must be defined as last member of
@@ -310,10 +348,14 @@ impl<Service: service::Service> Abandonable for Notifier<Service> {
 impl<Service: service::Service> Drop for Notifier<Service> {
     fn drop(&mut self) {
         if let Some(event_id) = self.on_drop_notification {
-            if let Err(e) = self.notify_with_custom_event_id(event_id) {
+            if let Err(e) = self.notify_impl(&[event_id], None, false, Delivery::Immediate) {
                 warn!(from self, "Unable to send notifier_dropped_event {:?} due to ({:?}).",
                     event_id, e);
             }
+        } else if self.has_pending_notifications() {
+            if let Err(e) = self.deliver_pending_notifications() {
+                warn!(from self, "Unable to deliver the pending notifications due to ({:?}).", e);
+            }
         }
 
         self.listener_connections
@@ -333,6 +375,14 @@ impl<Service: service::Service> UpdateConnections for Notifier<Service> {
     }
 }
 
+#[derive(Debug, PartialEq, Eq, Clone, Copy)]
+enum Delivery {
+    /// The notification is held back when it is within the coalescing window.
+    Coalesced,
+    /// The notification and all pending notifications are delivered right away.
+    Immediate,
+}
+
 impl<Service: service::Service> Notifier<Service> {
     pub(crate) fn new(
         service: SharedServiceState<Service, NoResource>,
@@ -390,6 +440,13 @@ impl<Service: service::Service> Notifier<Service> {
 
         let node_id = *service.shared_node().id();
         let static_config = service.static_config().event();
+        // holding notifications back longer than the deadline would violate the contract
+        let deadline = static_config.deadline();
+        let coalescing_window = match (config.coalescing_window, deadline) {
+            (Some(window), Some(deadline)) => Some(window.min(deadline)),
+            (window, _) => window,
+        }
+        .filter(|window| !window.is_zero());
         let listener_connections = Service::ArcThreadSafetyPolicy::new(ListenerConnections::new(
             listener_list.capacity(),
             service.clone(),
@@ -437,6 +494,7 @@ impl<Service: service::Service> Notifier<Service> {
             dynamic_notifier_handle: handle,
             notifier_details: unsafe { &*details },
             on_drop_notification: None,
+            coalescing_window,
         })
     }
 
@@ -471,6 +529,32 @@ impl<Service: service::Service> Notifier<Service> {
             .into()
     }
 
+    /// Returns the coalescing window of the [`Notifier`]. It is the configured
+    /// [`PortFactoryNotifier::coalescing_window()`](crate::service::port_factory::notifier::PortFactoryNotifier::coalescing_window())
+    /// limited by the [`Notifier::deadline()`] of the service.
+    pub fn coalescing_window(&self) -> Option<Duration> {
+        self.coalescing_window
+    }
+
+    /// Returns true when notifications were held back by the
+    /// [`Notifier::coalescing_window()`] and were not yet delivered.
+    pub fn has_pending_notifications(&self) -> bool {
+        !self
+            .listener_connections
+            .lock()
+            .pending_notifications()
+            .event_ids
+            .is_empty()
+    }
+
+    /// Delivers all notifications that were held back by the [`Notifier::coalescing_window()`]
+    /// immediately, without waiting for the window to end. On success the number of
+    /// [`crate::port::listener::Listener`]s that were notified otherwise it returns
+    /// [`NotifierNotifyError`].
+    pub fn deliver_pending_notifications(&self) -> Result<usize, NotifierNotifyError> {
+        self.notify_impl(&[], None, false, Delivery::Immediate)
+    }
+
     /// Notifies all [`crate::port::listener::Listener`] connected to the service with a custom
     /// [`EventId`].
     /// On success the number of
@@ -497,6 +581,57 @@ impl<Service: service::Service> Notifier<Service> {
         &self,
         value: EventId,
         skip_self_deliver: bool,
+    ) -> Result<usize, NotifierNotifyError> {
+        self.notify_impl(
+            core::slice::from_ref(&value),
+            None,
+            skip_self_deliver,
+            Delivery::Coalesced,
+        )
+    }
+
+    /// Notifies all [`crate::port::listener::Listener`] connected to the service with a custom
+    /// [`EventId`] and attaches `value` to it. The [`crate::port::listener::Listener`] receives
+    /// the value in [`EventActivation::value`](crate::port::EventActivation::value).
+    /// Only the latest value of every [`EventId`] is stored, when the
+    /// [`crate::port::listener::Listener`] collects multiple notifications of the same
+    /// [`EventId`] at once, it receives the value of the most recent one.
+    ///
+    /// The notification is delivered right away and is not held back by the
+    /// [`Notifier::coalescing_window()`].
+    /// On success the number of
+    /// [`crate::port::listener::Listener`]s that were notified otherwise it returns
+    /// [`NotifierNotifyError`].
+    pub fn notify_with_value(
+        &self,
+        event_id: EventId,
+        value: u64,
+    ) -> Result<usize, NotifierNotifyError> {
+        self.notify_impl(
+            core::slice::from_ref(&event_id),
+            Some(value),
+            false,
+            Delivery::Immediate,
+        )
+    }
+
+    /// Notifies all [`crate::port::listener::Listener`] connected to the service with all
+    /// provided [`EventId`]s at once. Every [`crate::port::listener::Listener`] is woken up
+    /// only once, no matter how many [`EventId`]s are provided.
+    /// On success the number of
+    /// [`crate::port::listener::Listener`]s that were notified otherwise it returns
+    /// [`NotifierNotifyError`]. When one of the [`EventId`]s exceeds the maximum supported
+    /// value, no [`crate::port::listener::Listener`] is notified.
+    pub fn notify_multiple(&self, values: &[EventId]) -> Result<usize, NotifierNotifyError> {
+        self.notify_impl(values, None, false, Delivery::Coalesced)
+    }
+
+    fn notify_impl(
+        &self,
+        values: &[EventId],
+        attached_value: Option<u64>,
+        skip_self_deliver: bool,
+        delivery: Delivery,
     ) -> Result<usize, NotifierNotifyError> {
         let msg = "Unable to notify event";
         let listener_connections = self.listener_connections.lock();
@@ -505,16 +640,71 @@ impl<Service: service::Service> Notifier<Service> {
         use iceoryx2_cal::event::Notifier;
         let mut number_of_triggered_listeners = 0;
 
-        if self.event_id_max_value < value.as_value() {
+        if let Some(value) = values
+            .iter()
+            .find(|v| self.event_id_max_value < v.as_value())
+        {
             fail!(from self, with NotifierNotifyError::EventIdOutOfBounds,
                             "{} since the EventId {:?} exceeds the maximum supported EventId value of {}.",
                             msg, value, self.event_id_max_value);
         }
 
+        // notifications that skip the own node are not coalesced since the pending
+        // notifications are delivered to all listeners, notifications with an attached value
+        // are not coalesced since the value belongs to this single notification
+        let coalescing_window = self
+            .coalescing_window
+            .filter(|_| !skip_self_deliver && attached_value.is_none());
+        let mut coalesced_values = vec![];
+        let values = match coalescing_window {
+            Some(window) => {
+                let pending = listener_connections.pending_notifications();
+                pending.add(values);
+
+                if delivery == Delivery::Coalesced && pending.is_within_window(window) {
+                    return Ok(0);
+                }
+
+                if pending.event_ids.is_empty() {
+                    return Ok(0);
+                }
+
+                pending.last_delivery = Time::now_with_clock(ClockType::Monotonic).ok();
+                // the pending buffer is handed back after the delivery so that its memory
+                // is reused
+                core::mem::swap(&mut coalesced_values, &mut pending.event_ids);
+                coalesced_values.as_slice()
+            }
+            None => values,
+        };
+
+        let dynamic_config = listener_connections
+            .service_state
+            .dynamic_storage()
+            .get()
+            .event();
+        if dynamic_config
+            .number_of_wake_up_latency_trackers
+            .load(Ordering::Relaxed)
+            > 0
+        {
+            dynamic_config
+                .last_notification_timestamp
+                .store(WakeUpLatencyRecorder::timestamp(), Ordering::Relaxed);
+        }
+
         for i in 0..listener_connections.len() {
             if let Some(connection) = listener_connections.get(i) {
                 if !(skip_self_deliver && connection.node_id == self.notifier_details.node_id) {
-                    match connection.notifier.notify(value) {
+                    let result = match attached_value {
+                        Some(attached_value) => values.iter().try_for_each(|event_id| {
+                            connection
+                                .notifier
+                                .notify_with_value(*event_id, attached_value)
+                        }),
+                        None => connection.notifier.notify_multiple(values),
+                    };
+                    match result {
                         Err(iceoryx2_cal::event::NotifierNotifyError::Disconnected) => {
                             listener_connections.remove(i);
                         }
@@ -530,6 +720,13 @@ impl<Service: service::Service> Notifier<Service> {
             }
         }
 
+        tracepoint!(notifier_notify, values.len(), number_of_triggered_listeners);
+
+        if coalescing_window.is_some() {
+            coalesced_values.clear();
+            listener_connections.pending_notifications().event_ids = coalesced_values;
+        }
+
         if let Some(deadline) = listener_connections
             .service_state
             .static_config()
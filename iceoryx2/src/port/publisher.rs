@@ -101,15 +101,17 @@
 //! # }
 //! ```
 
+use core::alloc::Layout;
 use core::any::TypeId;
 use core::fmt::Debug;
 use core::ptr::NonNull;
+use core::time::Duration;
 use core::{marker::PhantomData, mem::MaybeUninit};
 
 use alloc::vec::Vec;
 
 use iceoryx2_bb_concurrency::atomic::Ordering;
-use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicUsize};
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, AtomicU64, AtomicUsize};
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
 use iceoryx2_bb_container::queue::Queue;
 use iceoryx2_bb_elementary::CallbackProgression;
@@ -118,19 +120,28 @@ use iceoryx2_bb_elementary_traits::non_null::NonNullCompat;
 use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
+use iceoryx2_bb_posix::clock::{CycleClock, Time};
 use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::resizable_shared_memory::SegmentStatistics;
 use iceoryx2_cal::shm_allocator::{AllocationStrategy, PointerOffset};
+use iceoryx2_cal::static_storage::StaticStorage;
 use iceoryx2_cal::zero_copy_connection::{
     CHANNEL_STATE_OPEN, ChannelId, ZeroCopyCreationError, ZeroCopyPortDetails, ZeroCopySender,
 };
 use iceoryx2_log::{fail, warn};
 
+use crate::node::data_segment_pool::DataSegmentPoolKey;
+use crate::node::{DeadNodeView, SharedNode};
+use crate::port::content_filter::ContentFilter;
+use crate::port::copy_strategy::CopyStrategy;
 use crate::port::details::sender::*;
 use crate::port::port_name::PortName;
+use crate::port::statistics::{PortStatistics, PortStatisticsCounters, PortStatisticsRecorder};
 use crate::port::update_connections::{ConnectionFailure, UpdateConnections};
 use crate::prelude::BackpressureStrategy;
 use crate::raw_sample::RawSampleMut;
+use crate::sample::Sample;
 use crate::sample_mut::SampleMut;
 use crate::sample_mut_uninit::SampleMutUninit;
 use crate::service::builder::{CustomHeaderMarker, CustomPayloadMarker};
@@ -138,13 +149,16 @@ use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, Subscr
 use crate::service::header::publish_subscribe::Header;
 use crate::service::naming_scheme::data_segment_name;
 use crate::service::port_factory::publisher::{LocalPublisherConfig, PortFactoryPublisher};
+use crate::service::stale_resource_cleanup::remove_stale_port_resources;
 use crate::service::static_config::message_type_details::TypeVariant;
 use crate::service::{self};
+use crate::tracepoint::tracepoint;
 
-use super::details::data_segment::{DataSegment, DataSegmentType};
+use super::details::chunk::ChunkMut;
+use super::details::data_segment::{DataSegment, DataSegmentMemoryOptions, DataSegmentType};
 use super::details::segment_state::SegmentState;
 use super::{LoanError, SendError};
-use crate::identifiers::UniquePublisherId;
+use crate::identifiers::{UniqueNodeId, UniquePublisherId};
 
 /// Defines a failure that can occur when a [`Publisher`] is created with
 /// [`crate::service::port_factory::publisher::PortFactoryPublisher`].
@@ -173,9 +187,116 @@ impl core::fmt::Display for PublisherCreateError {
 impl core::error::Error for PublisherCreateError {}
 
 #[derive(Debug, Clone, Copy)]
-struct OffsetAndSize {
+struct HistorySample {
     offset: u64,
     size: usize,
+    user_header: usize,
+    timestamp: Duration,
+    lane: ChannelId,
+}
+
+/// The part of the history that still has to be delivered to a newly connected
+/// [`Subscriber`](crate::port::subscriber::Subscriber). The samples are identified by their
+/// sequence number, the number of samples that were added to the history before them.
+#[derive(Debug, Clone, Copy)]
+struct PendingHistoryDelivery {
+    receiver_port_id: u128,
+    next_sample: u64,
+    end_sample: u64,
+}
+
+#[derive(Debug)]
+struct History {
+    samples: Queue<HistorySample>,
+    number_of_added_samples: u64,
+    pending_deliveries: Vec<PendingHistoryDelivery>,
+}
+
+impl History {
+    fn new(history_size: usize, max_number_of_subscribers: usize) -> Self {
+        Self {
+            samples: Queue::new(history_size),
+            number_of_added_samples: 0,
+            pending_deliveries: Vec::with_capacity(max_number_of_subscribers),
+        }
+    }
+
+    fn oldest_sample(&self) -> u64 {
+        self.number_of_added_samples - self.samples.len() as u64
+    }
+
+    fn get(&self, sample: u64) -> HistorySample {
+        debug_assert!(self.oldest_sample() <= sample && sample < self.number_of_added_samples);
+        unsafe {
+            self.samples
+                .get_unchecked((sample - self.oldest_sample()) as usize)
+        }
+    }
+
+    /// Returns the first sample that was sent at or after `since`. Since the timestamps are
+    /// ordered, a binary search is sufficient.
+    fn first_sample_since(&self, since: Duration) -> u64 {
+        let mut low = 0;
+        let mut high = self.samples.len();
+        while low < high {
+            let mid = low + (high - low) / 2;
+            if unsafe { self.samples.get_unchecked(mid) }.timestamp < since {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+
+        self.oldest_sample() + low as u64
+    }
+}
+
+/// Takes a matching data segment out of the [`DataSegmentPool`](crate::node::data_segment_pool::DataSegmentPool)
+/// of the node together with the port tag and id of the publisher that created it.
+fn take_recycled_data_segment<Service: service::Service>(
+    shared_node: &SharedNode<Service>,
+    key: &DataSegmentPoolKey,
+) -> Option<(
+    UniquePublisherId,
+    Service::StaticStorage,
+    DataSegment<Service>,
+)> {
+    let origin = "Publisher::new()";
+    let msg = "Unable to reuse the pooled data segment";
+    let port_id = shared_node.data_segment_pool().take(key)?;
+
+    let port_tag = shared_node
+        .adopt_port_tag(origin, msg, port_id.value())
+        .ok();
+    let data_segment = port_tag.as_ref().and_then(|_| {
+        DataSegment::open_static_segment_for_reuse(
+            &data_segment_name(port_id.value()),
+            shared_node.config(),
+        )
+        .ok()
+    });
+
+    match (port_tag, data_segment) {
+        (Some(port_tag), Some(data_segment)) => Some((port_id, port_tag, data_segment)),
+        (port_tag, _) => {
+            if let Some(port_tag) = &port_tag {
+                port_tag.release_ownership();
+            }
+
+            warn!(from origin,
+                when unsafe { remove_stale_port_resources::<Service>(shared_node.id(), port_id.value(), shared_node.config()) },
+                "{msg} and its resources could not be removed.");
+            None
+        }
+    }
+}
+
+/// The last sample that was sent by the [`Publisher`]. It is borrowed until the next sample
+/// is sent so that [`Publisher::loan_from_last_sent()`] can copy its payload.
+#[derive(Debug, Clone, Copy)]
+struct LastSentSample {
+    offset: PointerOffset,
+    payload: usize,
 }
 
 #[derive(Debug)]
@@ -183,8 +304,16 @@ pub(crate) struct PublisherSharedState<Service: service::Service> {
     config: LocalPublisherConfig,
     pub(crate) sender: Sender<Service>,
     subscriber_list_state: UnsafeCell<ContainerState<SubscriberDetails>>,
-    history: Option<UnsafeCell<Queue<OffsetAndSize>>>,
+    /// Is set when not every connection could be established. The next change of the
+    /// subscriber list updates all connections instead of only the changed ones.
+    has_incomplete_connections: UnsafeCell<bool>,
+    history: Option<UnsafeCell<History>>,
+    last_sent_sample: Option<UnsafeCell<Option<LastSentSample>>>,
     is_active: AtomicBool,
+    enable_send_timestamps: bool,
+    sequence_number: AtomicU64,
+    port_id: UniquePublisherId,
+    data_segment_pool_key: Option<DataSegmentPoolKey>,
     // IMPORTANT!
     // Fields of a rust struct are dropped in declaration order. Since this tag is our marker that the
     // port exists and might require cleanup after a crash, the tag must be defined as last member of
@@ -204,16 +333,65 @@ impl<Service: service::Service> Abandonable for PublisherSharedState<Service> {
     }
 }
 
+impl<Service: service::Service> Drop for PublisherSharedState<Service> {
+    fn drop(&mut self) {
+        let key = match self.data_segment_pool_key {
+            Some(key) => key,
+            None => return,
+        };
+
+        let data_segment_pool = self.sender.shared_node.data_segment_pool();
+        if !data_segment_pool.is_enabled() {
+            return;
+        }
+
+        if let Some(history) = &self.history {
+            let history = unsafe { &mut *history.get() };
+            while let Some(sample) = history.samples.pop() {
+                self.sender
+                    .release_sample(PointerOffset::from_value(sample.offset));
+            }
+        }
+
+        if let Some(last_sent_sample) = &self.last_sent_sample {
+            if let Some(sample) = unsafe { (*last_sent_sample.get()).take() } {
+                self.sender.release_sample(sample.offset);
+            }
+        }
+
+        // the data segment and the port tag survive this port, the node removes them when the
+        // pooled segment is not reused
+        data_segment_pool.insert_with(key, self.port_id, || {
+            if !self.sender.release_data_segment_for_reuse() {
+                return false;
+            }
+            self.port_tag.release_ownership();
+            true
+        });
+    }
+}
+
 impl<Service: service::Service> PublisherSharedState<Service> {
-    fn add_sample_to_history(&self, offset: PointerOffset, sample_size: usize) {
+    fn add_sample_to_history(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        user_header: *const u8,
+        lane: ChannelId,
+    ) {
         match &self.history {
             None => (),
             Some(history) => {
                 let history = unsafe { &mut *history.get() };
                 self.sender.borrow_sample(offset);
-                match history.push_with_overflow(OffsetAndSize {
+                let timestamp = Time::now().map(|t| t.as_duration()).unwrap_or_default();
+                history.number_of_added_samples += 1;
+                match history.samples.push_with_overflow(HistorySample {
                     offset: offset.as_value(),
                     size: sample_size,
+                    user_header: user_header as usize,
+                    timestamp,
+                    lane,
                 }) {
                     None => (),
                     Some(old) => self
@@ -224,19 +402,65 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         }
     }
 
+    fn retain_last_sent_sample(&self, offset: PointerOffset, user_header: *const u8) {
+        if let Some(last_sent_sample) = &self.last_sent_sample {
+            let last_sent_sample = unsafe { &mut *last_sent_sample.get() };
+            self.sender.borrow_sample(offset);
+            let payload = self
+                .sender
+                .message_type_details
+                .payload_ptr_from_user_header(user_header) as usize;
+            if let Some(old) = last_sent_sample.replace(LastSentSample { offset, payload }) {
+                self.sender.release_sample(old.offset);
+            }
+        }
+    }
+
+    /// Borrows the last sent sample so that it stays valid while its payload is copied. The
+    /// borrow must be returned with [`Sender::release_sample()`].
+    fn borrow_last_sent_sample(&self) -> Option<LastSentSample> {
+        let last_sent_sample = unsafe { *self.last_sent_sample.as_ref()?.get() }?;
+        self.sender.borrow_sample(last_sent_sample.offset);
+        Some(last_sent_sample)
+    }
+
+    fn update_connection(
+        &self,
+        index: usize,
+        port: &SubscriberDetails,
+    ) -> Result<(), ZeroCopyCreationError> {
+        // the subscriber details are located in shared memory, the filter is evaluated on
+        // the user header of every sample and must therefore be validated by the publisher
+        let user_header_size = self.sender.message_type_details.user_header.size;
+        let content_filter = if port.content_filter.fits_into(user_header_size) {
+            port.content_filter
+        } else {
+            warn!(from self,
+                "The content filter {:?} of the subscriber {:?} is ignored since its key is not located inside the user header with a size of {} bytes.",
+                port.content_filter, port.subscriber_id, user_header_size);
+            ContentFilter::accept_all()
+        };
+
+        self.sender.update_connection(
+            index,
+            ReceiverDetails {
+                port_id: port.subscriber_id.value(),
+                buffer_size: port.buffer_size,
+                content_filter,
+                has_wake_up_channel: port.has_wake_up_channel,
+            },
+            |connection| {
+                self.request_sample_history(connection, port.history_request, port.history_since)
+            },
+        )
+    }
+
     fn force_update_connections(&self) -> Result<(), ZeroCopyCreationError> {
         let mut result = Ok(());
         self.sender.start_update_connection_cycle();
         unsafe {
             (*self.subscriber_list_state.get()).for_each(|index, port| {
-                let inner_result = self.sender.update_connection(
-                    index,
-                    ReceiverDetails {
-                        port_id: port.subscriber_id.value(),
-                        buffer_size: port.buffer_size,
-                    },
-                    |connection| self.deliver_sample_history(connection, port.history_request),
-                );
+                let inner_result = self.update_connection(index, port);
 
                 if result.is_ok() {
                     result = inner_result;
@@ -247,6 +471,37 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         };
 
         self.sender.finish_update_connection_cycle();
+        unsafe { *self.has_incomplete_connections.get() = result.is_err() };
+
+        result
+    }
+
+    /// Updates only the connections to the subscribers that were added, replaced or removed
+    /// with the last update of the subscriber list state. When a previous update failed, all
+    /// connections are updated.
+    fn update_changed_connections(&self) -> Result<(), ZeroCopyCreationError> {
+        if unsafe { *self.has_incomplete_connections.get() } {
+            return self.force_update_connections();
+        }
+
+        let mut result = Ok(());
+        unsafe {
+            (*self.subscriber_list_state.get()).for_each_changed(|index, port| {
+                match port {
+                    Some(port) => {
+                        let inner_result = self.update_connection(index, port);
+                        if result.is_ok() {
+                            result = inner_result;
+                        }
+                    }
+                    None => self.sender.remove_connection(index),
+                }
+
+                CallbackProgression::Continue
+            })
+        };
+
+        unsafe { *self.has_incomplete_connections.get() = result.is_err() };
 
         result
     }
@@ -261,53 +516,174 @@ impl<Service: service::Service> PublisherSharedState<Service> {
                 .subscribers
                 .update_state(&mut *self.subscriber_list_state.get())
         } {
-            fail!(from self, when self.force_update_connections(),
+            fail!(from self, when self.update_changed_connections(),
                 "Connections were updated only partially since at least one connection to a Subscriber port failed.");
         }
 
+        self.deliver_pending_history();
+
         Ok(())
     }
 
-    fn deliver_sample_history(&self, connection: &Connection<Service>, history_request: usize) {
+    /// Schedules the delivery of the last `history_request` samples, that were sent at or after
+    /// `history_since`, to the new connection. The samples are delivered in batches of
+    /// [`crate::service::port_factory::publisher::PortFactoryPublisher::history_delivery_batch_size()`]
+    /// with every call to [`PublisherSharedState::update_connections()`], see
+    /// [`PublisherSharedState::deliver_pending_history()`].
+    fn request_sample_history(
+        &self,
+        connection: &Connection<Service>,
+        history_request: usize,
+        history_since: Time,
+    ) {
         match &self.history {
             None => (),
             Some(history) => {
                 let history = unsafe { &mut *history.get() };
-                let buffer_size = connection.sender.buffer_size();
-                let history_deliver_count = history_request.min(buffer_size);
-                let history_start = history.len().saturating_sub(history_deliver_count);
+                let buffer_size = connection.sender.active_buffer_size();
+                let history_deliver_count = history_request.min(buffer_size) as u64;
+                let end_sample = history.number_of_added_samples;
+                let next_sample = end_sample
+                    .saturating_sub(history_deliver_count)
+                    .max(history.oldest_sample())
+                    .max(history.first_sample_since(history_since.as_duration()));
+
+                if next_sample == end_sample {
+                    return;
+                }
 
-                for i in history_start..history.len() {
-                    let old_sample = unsafe { history.get_unchecked(i) };
-                    self.sender.retrieve_returned_samples();
+                history
+                    .pending_deliveries
+                    .retain(|p| p.receiver_port_id != connection.receiver_port_id);
+                history.pending_deliveries.push(PendingHistoryDelivery {
+                    receiver_port_id: connection.receiver_port_id,
+                    next_sample,
+                    end_sample,
+                });
+            }
+        }
+    }
 
-                    let offset = PointerOffset::from_value(old_sample.offset);
-                    match connection
-                        .sender
-                        .try_send(offset, old_sample.size, ChannelId::new(0))
-                    {
-                        Ok(overflow) => {
-                            self.sender.borrow_sample(offset);
-
-                            if let Some(old) = overflow {
-                                self.sender.release_sample(old);
-                            }
-                        }
-                        Err(e) => {
-                            warn!(from self, "Failed to deliver history to new subscriber via {:?} due to {:?}", connection, e);
-                        }
-                    }
+    fn deliver_pending_history(&self) {
+        let history = match &self.history {
+            None => return,
+            Some(history) => unsafe { &mut *history.get() },
+        };
+
+        let mut n = 0;
+        while n < history.pending_deliveries.len() {
+            let pending = history.pending_deliveries[n];
+            let connection = self
+                .sender
+                .get_connection_id_of(pending.receiver_port_id)
+                .and_then(|id| self.sender.get(id).as_ref());
+
+            if let Some(connection) = connection {
+                self.deliver_history_batch(history, n, connection);
+                if history.pending_deliveries[n].next_sample != pending.end_sample {
+                    n += 1;
+                    continue;
                 }
             }
+
+            history.pending_deliveries.swap_remove(n);
         }
     }
 
-    pub(crate) fn send_sample(
+    /// Delivers the next batch of the pending history delivery at index `pending`. Samples
+    /// that were evicted from the history in the meantime are skipped without being accessed.
+    fn deliver_history_batch(
         &self,
-        offset: PointerOffset,
-        sample_size: usize,
-    ) -> Result<usize, SendError> {
-        let msg = "Unable to send sample";
+        history: &mut History,
+        pending: usize,
+        connection: &Connection<Service>,
+    ) {
+        let delivery = &mut history.pending_deliveries[pending];
+        let start = delivery
+            .next_sample
+            .max(history.number_of_added_samples - history.samples.len() as u64);
+        let end = delivery
+            .end_sample
+            .min(start.saturating_add(self.config.history_delivery_batch_size as u64));
+        delivery.next_sample = end;
+
+        for sample in start..end {
+            let old_sample = history.get(sample);
+            // the history sample is borrowed by the history, therefore its user header
+            // is still valid
+            if !unsafe {
+                connection
+                    .content_filter
+                    .accepts(old_sample.user_header as *const u8)
+            } {
+                continue;
+            }
+
+            self.sender.retrieve_returned_samples();
+
+            let offset = PointerOffset::from_value(old_sample.offset);
+            match connection
+                .sender
+                .try_send(offset, old_sample.size, old_sample.lane)
+            {
+                Ok(overflow) => {
+                    self.sender.borrow_sample(offset);
+
+                    if let Some(old) = overflow {
+                        self.sender.release_sample(old);
+                    }
+                }
+                Err(e) => {
+                    warn!(from self, "Failed to deliver history to new subscriber via {:?} due to {:?}", connection, e);
+                }
+            }
+        }
+    }
+
+    /// Removes the connections to [`Subscriber`](crate::port::subscriber::Subscriber)s of dead
+    /// nodes and releases all samples they held, without waiting until the dead node is cleaned
+    /// up. Returns true when at least one connection was removed.
+    fn reclaim_samples_of_dead_subscribers(&self) -> bool {
+        let own_node_id = *self.sender.shared_node.id();
+        let config = self.sender.shared_node.config();
+        let mut has_reclaimed_samples = false;
+
+        unsafe {
+            (*self.subscriber_list_state.get()).for_each(|index, port| {
+                if self.sender.get(index).is_some()
+                    && port.node_id != own_node_id
+                    && DeadNodeView::<Service>::is_dead(&port.node_id, config)
+                {
+                    self.sender.remove_connection(index);
+                    has_reclaimed_samples = true;
+                }
+
+                CallbackProgression::Continue
+            })
+        };
+
+        has_reclaimed_samples
+    }
+
+    /// Allocates a chunk from the data segment. When the data segment is out of memory the
+    /// samples held by subscribers of dead nodes are reclaimed and the allocation is retried.
+    fn allocate(&self, layout: Layout) -> Result<ChunkMut, LoanError> {
+        match self.sender.allocate_impl(layout) {
+            Err(LoanError::OutOfMemory) if self.reclaim_samples_of_dead_subscribers() => {
+                self.sender.allocate(layout)
+            }
+            Err(e) => {
+                self.sender.statistics.add_failed_loan();
+                Err(e)
+            }
+            Ok(chunk) => {
+                tracepoint!(publisher_loan, chunk.offset.as_value(), chunk.size);
+                Ok(chunk)
+            }
+        }
+    }
+
+    fn prepare_send(&self, msg: &str) -> Result<(), SendError> {
         if !self.is_active.load(Ordering::Relaxed) {
             fail!(from self, with SendError::ConnectionBrokenSinceSenderNoLongerExists,
                 "{} since the corresponding publisher is already disconnected.", msg);
@@ -316,9 +692,71 @@ impl<Service: service::Service> PublisherSharedState<Service> {
         fail!(from self, when self.update_connections(),
             "{} since the connections could not be updated.", msg);
 
-        self.add_sample_to_history(offset, sample_size);
+        Ok(())
+    }
+
+    /// Assigns the next sequence number to the [`Header`] and stores the current time in it when
+    /// the service enables send timestamps. The time is acquired with the [`CycleClock`] to keep
+    /// the send path free of `clock_gettime` calls when the hardware allows it.
+    pub(crate) fn stamp_header(&self, header: &mut Header) {
+        header.set_sequence_number(self.sequence_number.fetch_add(1, Ordering::Relaxed));
+
+        if !self.enable_send_timestamps {
+            return;
+        }
+
+        match CycleClock::now() {
+            Ok(now) => header.set_send_timestamp(now),
+            Err(e) => {
+                warn!(from self, "Unable to acquire the send timestamp of the sample ({:?}).", e)
+            }
+        }
+    }
+
+    /// Returns the priority lane of the subscribers into which the sample with the [`Header`]
+    /// is delivered. Priorities beyond the number of lanes are delivered into the highest lane.
+    pub(crate) fn priority_lane(&self, header: &Header) -> ChannelId {
+        ChannelId::new((header.priority() as usize).min(self.sender.number_of_channels - 1))
+    }
+
+    pub(crate) fn send_sample(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        user_header: *const u8,
+        lane: ChannelId,
+    ) -> Result<usize, SendError> {
+        self.prepare_send("Unable to send sample")?;
+
+        tracepoint!(publisher_send, offset.as_value(), sample_size);
+        self.add_sample_to_history(offset, sample_size, user_header, lane);
+        self.retain_last_sent_sample(offset, user_header);
         self.sender
-            .deliver_offset(offset, sample_size, ChannelId::new(0))
+            .deliver_offset(offset, sample_size, lane, Some(user_header))
+    }
+
+    /// Prepares the delivery of multiple samples with [`PublisherSharedState::send_batch_sample()`]
+    /// by updating the connections and reclaiming the returned samples only once for the whole
+    /// batch.
+    pub(crate) fn prepare_batch_send(&self) -> Result<(), SendError> {
+        self.prepare_send("Unable to send batch of samples")?;
+        self.sender.retrieve_returned_samples();
+
+        Ok(())
+    }
+
+    pub(crate) fn send_batch_sample(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        user_header: *const u8,
+        lane: ChannelId,
+    ) -> Result<usize, SendError> {
+        tracepoint!(publisher_send, offset.as_value(), sample_size);
+        self.add_sample_to_history(offset, sample_size, user_header, lane);
+        self.retain_last_sent_sample(offset, user_header);
+        self.sender
+            .deliver_offset_without_reclaim(offset, sample_size, lane, Some(user_header))
     }
 }
 
@@ -333,6 +771,9 @@ pub struct Publisher<
         Service::ArcThreadSafetyPolicy<PublisherSharedState<Service>>,
     dynamic_publisher_handle: ContainerHandle,
     publisher_details: &'static PublisherDetails,
+    // the copy strategy is fixed at creation, it is stored outside of the shared state so
+    // that the copy in the send path does not acquire the lock
+    copy_strategy: CopyStrategy,
     _payload: PhantomData<Payload>,
     _user_header: PhantomData<UserHeader>,
 }
@@ -403,21 +844,8 @@ impl<
     ) -> Result<Self, PublisherCreateError> {
         let msg = "Unable to create Publisher port";
         let origin = "Publisher::new()";
-        let port_id = UniquePublisherId::new();
         let config = &publisher_factory.config;
         let service = &publisher_factory.factory.service;
-        // !MUST! be the first thing that is created when a new port is instantiated otherwise the
-        // port resources might leak if this process is killed in between.
-        let port_tag = match service
-            .shared_node()
-            .create_port_tag(origin, msg, port_id.0.value())
-        {
-            Ok(port_tag) => port_tag,
-            Err(e) => {
-                fail!(from origin, with PublisherCreateError::UnableToCreatePortTag,
-                        "{msg} since the port tag, that is required for cleanup, could not be created. [{e:?}]");
-            }
-        };
 
         let static_config = publisher_factory
             .factory
@@ -436,7 +864,8 @@ impl<
                 .messaging_pattern
                 .publish_subscribe()
         }
-        .required_amount_of_samples_per_data_segment(config.max_loaned_samples);
+        .required_amount_of_samples_per_data_segment(config.max_loaned_samples)
+            + config.enable_loan_from_last_sent as usize;
 
         let number_of_samples = publisher_factory
             .preallocate_number_of_samples_override
@@ -452,6 +881,44 @@ impl<
         let max_slice_len = config.initial_max_slice_len;
         let max_number_of_segments =
             DataSegment::<Service>::max_number_of_segments(data_segment_type);
+        let numa_policy = config.numa_policy.resolve();
+
+        let data_segment_pool_key = match data_segment_type {
+            DataSegmentType::Static => Some(DataSegmentPoolKey {
+                service_hash: *service.static_config().service_hash(),
+                sample_layout,
+                number_of_samples,
+                page_size: config.page_size,
+                numa_policy,
+                typed_memory: config.typed_memory,
+                lock_in_memory: config.lock_in_memory,
+            }),
+            DataSegmentType::Dynamic | DataSegmentType::SizeClasses => None,
+        };
+
+        let recycled_data_segment = data_segment_pool_key
+            .and_then(|key| take_recycled_data_segment(service.shared_node(), &key));
+        let (port_id, port_tag, recycled_data_segment) = match recycled_data_segment {
+            Some((port_id, port_tag, data_segment)) => (port_id, port_tag, Some(data_segment)),
+            None => {
+                let port_id = UniquePublisherId::new();
+                // !MUST! be the first thing that is created when a new port is instantiated
+                // otherwise the port resources might leak if this process is killed in between.
+                let port_tag = match service.shared_node().create_port_tag(
+                    origin,
+                    msg,
+                    port_id.0.value(),
+                ) {
+                    Ok(port_tag) => port_tag,
+                    Err(e) => {
+                        fail!(from origin, with PublisherCreateError::UnableToCreatePortTag,
+                            "{msg} since the port tag, that is required for cleanup, could not be created. [{e:?}]");
+                    }
+                };
+                (port_id, port_tag, None)
+            }
+        };
+
         let publisher_details = PublisherDetails {
             data_segment_type,
             publisher_id: port_id,
@@ -460,35 +927,55 @@ impl<
             max_slice_len,
             node_id: *service.shared_node().id(),
             max_number_of_segments,
+            numa_policy,
         };
         let global_config = service.shared_node().config();
+        let memory_options = DataSegmentMemoryOptions {
+            page_size: config.page_size,
+            numa_policy,
+            typed_memory: config.typed_memory,
+            prefault: config.prefault,
+            lock_in_memory: config.lock_in_memory,
+            shrink_policy: config.shrink_policy,
+        };
 
         let segment_name = data_segment_name(publisher_details.publisher_id.value());
-        let data_segment = match data_segment_type {
-            DataSegmentType::Static => DataSegment::create_static_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_samples,
-            ),
-            DataSegmentType::Dynamic => DataSegment::create_dynamic_segment(
+        let data_segment = match (data_segment_type, recycled_data_segment) {
+            (_, Some(data_segment)) => Ok(data_segment),
+            (DataSegmentType::Static, None) => DataSegment::create_static_segment(
                 &segment_name,
                 sample_layout,
                 global_config,
                 number_of_samples,
-                config.allocation_strategy,
+                memory_options,
             ),
+            (DataSegmentType::Dynamic | DataSegmentType::SizeClasses, None) => {
+                DataSegment::create_dynamic_segment(
+                    &segment_name,
+                    sample_layout,
+                    global_config,
+                    number_of_samples,
+                    config.allocation_strategy,
+                    memory_options,
+                )
+            }
         };
 
         let data_segment = fail!(from origin,
                 when data_segment,
                 with PublisherCreateError::UnableToCreateDataSegment,
                 "{} since the data segment could not be acquired.", msg);
+        let data_segment =
+            data_segment.with_chunk_cache(config.chunk_cache_size.min(number_of_samples));
 
         let publisher_shared_state =
             <Service as service::Service>::ArcThreadSafetyPolicy::new(PublisherSharedState {
                 port_tag,
+                port_id,
+                data_segment_pool_key,
                 is_active: AtomicBool::new(true),
+                enable_send_timestamps: static_config.enable_send_timestamps,
+                sequence_number: AtomicU64::new(0),
                 sender: Sender {
                     data_segment,
                     segment_states: {
@@ -516,15 +1003,29 @@ impl<
                     loan_counter: AtomicUsize::new(0),
                     sender_max_borrowed_samples: config.max_loaned_samples,
                     backpressure_strategy: config.backpressure_strategy,
+                    backpressure_wait_strategy: config.backpressure_wait_strategy,
+                    backpressure_wake_up_timeout: config.backpressure_wake_up_timeout,
                     message_type_details: static_config.message_type_details,
-                    number_of_channels: 1,
+                    number_of_channels: static_config.number_of_priority_lanes,
                     initial_channel_state: CHANNEL_STATE_OPEN,
+                    prefault_connections: config.prefault,
+                    lock_connections_in_memory: config.lock_in_memory,
+                    wake_up_event_id: AtomicUsize::new(0),
+                    statistics: PortStatisticsRecorder::default(),
                 },
                 config: *config,
                 subscriber_list_state: UnsafeCell::new(unsafe { subscriber_list.get_state() }),
+                has_incomplete_connections: UnsafeCell::new(false),
                 history: match static_config.history_size == 0 {
                     true => None,
-                    false => Some(UnsafeCell::new(Queue::new(static_config.history_size))),
+                    false => Some(UnsafeCell::new(History::new(
+                        static_config.history_size,
+                        subscriber_list.capacity(),
+                    ))),
+                },
+                last_sent_sample: match config.enable_loan_from_last_sent {
+                    true => Some(UnsafeCell::new(None)),
+                    false => None,
                 },
             });
 
@@ -560,10 +1061,26 @@ impl<
             }
         };
 
+        let statistics: *const PortStatisticsCounters = service
+            .dynamic_storage()
+            .get()
+            .publish_subscribe()
+            .publisher_statistics_of(handle);
+        // the statistics are stored in the dynamic config which outlives the publisher and the
+        // shared state was not yet shared with another thread
+        unsafe {
+            publisher_shared_state
+                .lock()
+                .sender
+                .statistics
+                .attach(&*statistics)
+        };
+
         Ok(Self {
             publisher_shared_state,
             dynamic_publisher_handle: handle,
             publisher_details: unsafe { &*details },
+            copy_strategy: config.copy_strategy,
             _payload: PhantomData,
             _user_header: PhantomData,
         })
@@ -587,6 +1104,115 @@ impl<
             .sender
             .backpressure_strategy
     }
+
+    /// Returns the [`CopyStrategy`] the [`Publisher`] uses when it copies the payload into the
+    /// data segment.
+    pub fn copy_strategy(&self) -> CopyStrategy {
+        self.copy_strategy
+    }
+
+    /// Returns the [`SegmentStatistics`] of the data segment of the [`Publisher`]. They show
+    /// how many shared memory segments are currently used, how large they are and how many
+    /// oversized segments were released due to the
+    /// [`ShrinkPolicy`](iceoryx2_cal::resizable_shared_memory::ShrinkPolicy).
+    pub fn data_segment_statistics(&self) -> SegmentStatistics {
+        self.publisher_shared_state
+            .lock()
+            .sender
+            .data_segment
+            .segment_statistics()
+    }
+
+    /// Returns the [`PortStatistics`] of the [`Publisher`]. `sent` counts the successful send
+    /// operations, `overflows` the deliveries that were dropped since the buffer of a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) was full and `failed_loans` the
+    /// loans that failed.
+    pub fn statistics(&self) -> PortStatistics {
+        self.publisher_shared_state.lock().sender.statistics.load()
+    }
+
+    /// Sends all provided [`SampleMut`]s in order with a single connection update. This reduces
+    /// the per-sample overhead of [`SampleMut::send()`] for bursty producers. Every sample is
+    /// delivered even when the delivery of a previous sample failed.
+    ///
+    /// On success it returns the accumulated number of
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s that received the samples,
+    /// otherwise the first [`SendError`] that occurred.
+    ///
+    /// All [`SampleMut`]s must have been loaned from this [`Publisher`].
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .max_publishers(1)
+    /// #     .open_or_create()?;
+    /// #
+    /// # let publisher = service.publisher_builder()
+    /// #                        .max_loaned_samples(2)
+    /// #                        .create()?;
+    ///
+    /// let sample_1 = publisher.loan_uninit()?.write_payload(1);
+    /// let sample_2 = publisher.loan_uninit()?.write_payload(2);
+    ///
+    /// publisher.send_batch([sample_1, sample_2])?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn send_batch<I: IntoIterator<Item = SampleMut<Service, Payload, UserHeader>>>(
+        &self,
+        samples: I,
+    ) -> Result<usize, SendError> {
+        let samples = samples.into_iter();
+        let prepare_result = self.publisher_shared_state.lock().prepare_batch_send();
+        if let Err(e) = prepare_result {
+            // release all loaned samples, the lock is already released at this point
+            samples.for_each(drop);
+            return Err(e);
+        }
+
+        let mut number_of_recipients = 0;
+        let mut delivery_error = None;
+        for mut sample in samples {
+            debug_assert!(
+                sample.header().publisher_id() == self.id(),
+                "The sample must have been loaned from this publisher."
+            );
+
+            // the lock is released before the sample is dropped since dropping a sample
+            // acquires the lock of the shared state as well
+            let result = {
+                let shared_state = self.publisher_shared_state.lock();
+                shared_state.stamp_header(sample.ptr.as_header_mut());
+                shared_state.send_batch_sample(
+                    sample.offset_to_chunk,
+                    sample.sample_size,
+                    sample.user_header_ptr(),
+                    shared_state.priority_lane(sample.header()),
+                )
+            };
+
+            match result {
+                Ok(n) => number_of_recipients += n,
+                Err(e) => {
+                    if delivery_error.is_none() {
+                        delivery_error = Some(e);
+                    }
+                }
+            }
+        }
+
+        match delivery_error {
+            Some(e) => Err(e),
+            None => Ok(number_of_recipients),
+        }
+    }
 }
 
 ////////////////////////
@@ -622,10 +1248,79 @@ impl<
     /// ```
     pub fn send_copy(&self, value: Payload) -> Result<usize, SendError> {
         let msg = "Unable to send copy of payload";
-        let sample = fail!(from self, when self.loan_uninit(),
+        let mut sample = fail!(from self, when self.loan_uninit(),
+                                    "{} since the loan of a sample failed.", msg);
+
+        match self.copy_strategy() {
+            CopyStrategy::Regular => sample.write_payload(value).send(),
+            copy_strategy => {
+                let value = core::mem::ManuallyDrop::new(value);
+                unsafe {
+                    copy_strategy.copy_nonoverlapping(
+                        (&*value as *const Payload).cast(),
+                        sample.payload_mut().as_mut_ptr().cast(),
+                        core::mem::size_of::<Payload>(),
+                    );
+                    sample.assume_init().send()
+                }
+            }
+        }
+    }
+
+    /// Forwards the user header and payload of a received [`Sample`], for instance from a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) of another service, with a new
+    /// [`crate::sample_mut::SampleMut`]. The data is copied with the [`CopyStrategy`] of the
+    /// [`Publisher`] directly from the data segment of the origin into the data segment of the
+    /// [`Publisher`], without an intermediate copy. The [`Sample`] cannot be delivered by
+    /// reference since the [`crate::port::subscriber::Subscriber`]s of the [`Publisher`] have
+    /// only access to the data segment of the [`Publisher`].
+    /// On success it returns the number of [`crate::port::subscriber::Subscriber`]s that received
+    /// the data, otherwise a [`SendError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// let origin = node.service_builder(&"My/Funk/Origin".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .open_or_create()?;
+    /// let target = node.service_builder(&"My/Funk/Target".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .open_or_create()?;
+    ///
+    /// let subscriber = origin.subscriber_builder().create()?;
+    /// let publisher = target.publisher_builder().create()?;
+    ///
+    /// while let Some(sample) = subscriber.receive()? {
+    ///     publisher.forward(&sample)?;
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn forward<OriginService: service::Service>(
+        &self,
+        sample: &Sample<OriginService, Payload, UserHeader>,
+    ) -> Result<usize, SendError>
+    where
+        Payload: Copy,
+        UserHeader: Copy,
+    {
+        let msg = "Unable to forward sample";
+        let mut forwarded_sample = fail!(from self, when self.loan_uninit(),
                                     "{} since the loan of a sample failed.", msg);
 
-        sample.write_payload(value).send()
+        *forwarded_sample.user_header_mut() = *sample.user_header();
+        unsafe {
+            self.copy_strategy().copy_nonoverlapping(
+                (sample.payload() as *const Payload).cast(),
+                forwarded_sample.payload_mut().as_mut_ptr().cast(),
+                core::mem::size_of::<Payload>(),
+            );
+            forwarded_sample.assume_init().send()
+        }
     }
 
     /// Loans/allocates a [`SampleMutUninit`] from the underlying data segment of the [`Publisher`].
@@ -658,14 +1353,17 @@ impl<
     pub fn loan_uninit(
         &self,
     ) -> Result<SampleMutUninit<Service, MaybeUninit<Payload>, UserHeader>, LoanError> {
-        let shared_state = self.publisher_shared_state.lock();
-        let chunk = shared_state
-            .sender
-            .allocate(shared_state.sender.sample_layout(1))?;
-        let node_id = shared_state.sender.service_state.shared_node().id();
+        // the chunk is exclusively owned after the allocation, therefore the lock is released
+        // before the headers are initialized to keep the critical section short when the
+        // publisher is shared between threads
+        let (chunk, node_id) = {
+            let shared_state = self.publisher_shared_state.lock();
+            let chunk = shared_state.allocate(shared_state.sender.sample_layout(1))?;
+            (chunk, *shared_state.sender.service_state.shared_node().id())
+        };
         let header_ptr = chunk.header as *mut Header;
         let user_header_ptr: *mut UserHeader = chunk.user_header.cast();
-        unsafe { header_ptr.write(Header::new(*node_id, self.id(), 1)) };
+        unsafe { header_ptr.write(Header::new(node_id, self.id(), 1)) };
         unsafe { user_header_ptr.write(UserHeader::default()) };
 
         let sample = unsafe {
@@ -718,6 +1416,69 @@ impl<
     pub fn loan(&self) -> Result<SampleMut<Service, Payload, UserHeader>, LoanError> {
         Ok(self.loan_uninit()?.write_payload(Payload::default()))
     }
+
+    /// Loans/allocates a [`crate::sample_mut::SampleMut`] from the underlying data segment of the
+    /// [`Publisher`] and initializes it with a bitwise copy of the payload of the last sent
+    /// sample. When only a small part of a large payload changes between two samples, only this
+    /// part has to be written. It requires
+    /// [`PortFactoryPublisher::enable_loan_from_last_sent()`](crate::service::port_factory::publisher::PortFactoryPublisher::enable_loan_from_last_sent()),
+    /// otherwise, or when no sample was sent so far, the payload is initialized with the default
+    /// value like in [`Publisher::loan()`].
+    ///
+    /// On failure it returns [`LoanError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<[u64; 16]>()
+    /// #     .open_or_create()?;
+    /// #
+    /// let publisher = service.publisher_builder()
+    ///                        .enable_loan_from_last_sent(true)
+    ///                        .create()?;
+    ///
+    /// publisher.send_copy([42; 16])?;
+    ///
+    /// let mut sample = publisher.loan_from_last_sent()?;
+    /// sample.payload_mut()[3] = 1;
+    ///
+    /// sample.send()?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn loan_from_last_sent(
+        &self,
+    ) -> Result<SampleMut<Service, Payload, UserHeader>, LoanError> {
+        let mut sample = self.loan_uninit()?;
+        let last_sent_sample = self.publisher_shared_state.lock().borrow_last_sent_sample();
+
+        match last_sent_sample {
+            None => Ok(sample.write_payload(Payload::default())),
+            Some(last_sent_sample) => {
+                // the last sent sample is borrowed, therefore it cannot be reused while the
+                // payload is copied outside of the lock
+                unsafe {
+                    core::ptr::copy_nonoverlapping(
+                        last_sent_sample.payload as *const Payload,
+                        sample.payload_mut().as_mut_ptr(),
+                        1,
+                    )
+                };
+                self.publisher_shared_state
+                    .lock()
+                    .sender
+                    .release_sample(last_sent_sample.offset);
+
+                Ok(unsafe { sample.assume_init() })
+            }
+        }
+    }
 }
 ////////////////////////
 // END: typed API
@@ -827,27 +1588,151 @@ impl<
         self.loan_slice_uninit_impl(slice_len, slice_len)
     }
 
+    /// Copies the input `values` with the [`CopyStrategy`] of the [`Publisher`] into a
+    /// [`crate::sample_mut::SampleMut`] and delivers it.
+    /// On success it returns the number of [`crate::port::subscriber::Subscriber`]s that received
+    /// the data, otherwise a [`SendError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<[u8]>()
+    /// #     .open_or_create()?;
+    /// #
+    /// let publisher = service.publisher_builder()
+    ///                        .initial_max_slice_len(4096)
+    ///                        .copy_strategy(CopyStrategy::NonTemporal)
+    ///                        .create()?;
+    ///
+    /// let frame = vec![0u8; 4096];
+    /// publisher.send_slice_copy(&frame)?;
+    /// # Ok::<_, Box<dyn core::error::Error>>(())
+    /// ```
+    pub fn send_slice_copy(&self, values: &[Payload]) -> Result<usize, SendError>
+    where
+        Payload: Copy,
+    {
+        let msg = "Unable to send copy of slice";
+        let mut sample = fail!(from self, when self.loan_slice_uninit(values.len()),
+                                    "{} since the loan of a sample failed.", msg);
+
+        unsafe {
+            self.copy_strategy().copy_nonoverlapping(
+                values.as_ptr().cast(),
+                sample.payload_mut().as_mut_ptr().cast(),
+                core::mem::size_of_val(values),
+            );
+            sample.assume_init().send()
+        }
+    }
+
+    /// Forwards the user header and payload of a received [`Sample`], for instance from a
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) of another service, with a new
+    /// [`crate::sample_mut::SampleMut`]. The data is copied with the [`CopyStrategy`] of the
+    /// [`Publisher`] directly from the data segment of the origin into the data segment of the
+    /// [`Publisher`], without an intermediate copy.
+    /// On success it returns the number of [`crate::port::subscriber::Subscriber`]s that received
+    /// the data, otherwise a [`SendError`] describing the failure.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// let origin = node.service_builder(&"My/Funk/Origin".try_into()?)
+    ///     .publish_subscribe::<[u8]>()
+    ///     .open_or_create()?;
+    /// let target = node.service_builder(&"My/Funk/Target".try_into()?)
+    ///     .publish_subscribe::<[u8]>()
+    ///     .open_or_create()?;
+    ///
+    /// let subscriber = origin.subscriber_builder().create()?;
+    /// let publisher = target.publisher_builder()
+    ///                       .initial_max_slice_len(4096)
+    ///                       .create()?;
+    ///
+    /// while let Some(sample) = subscriber.receive()? {
+    ///     publisher.forward(&sample)?;
+    /// }
+    /// # Ok::<_, Box<dyn core::error::Error>>(())
+    /// ```
+    pub fn forward<OriginService: service::Service>(
+        &self,
+        sample: &Sample<OriginService, [Payload], UserHeader>,
+    ) -> Result<usize, SendError>
+    where
+        Payload: Copy,
+        UserHeader: Copy,
+    {
+        let msg = "Unable to forward sample";
+        let payload = sample.payload();
+        let mut forwarded_sample = fail!(from self, when self.loan_slice_uninit(payload.len()),
+                                    "{} since the loan of a sample failed.", msg);
+
+        *forwarded_sample.user_header_mut() = *sample.user_header();
+        unsafe {
+            self.copy_strategy().copy_nonoverlapping(
+                payload.as_ptr().cast(),
+                forwarded_sample.payload_mut().as_mut_ptr().cast(),
+                core::mem::size_of_val(payload),
+            );
+            forwarded_sample.assume_init().send()
+        }
+    }
+
     fn loan_slice_uninit_impl(
         &self,
         slice_len: usize,
         underlying_number_of_slice_elements: usize,
     ) -> Result<SampleMutUninit<Service, [MaybeUninit<Payload>], UserHeader>, LoanError> {
-        let shared_state = self.publisher_shared_state.lock();
-        let max_slice_len = shared_state.config.initial_max_slice_len;
-        if shared_state.config.allocation_strategy == AllocationStrategy::Static
-            && max_slice_len < slice_len
-        {
-            fail!(from self, with LoanError::ExceedsMaxLoanSize,
-                "Unable to loan slice with {} elements since it would exceed the max supported slice length of {}.",
-                slice_len, max_slice_len);
-        }
+        // the lock is released before the headers are initialized, see loan_uninit()
+        let (chunk, node_id) = {
+            let shared_state = self.publisher_shared_state.lock();
+            let max_slice_len = shared_state.config.initial_max_slice_len;
+            if shared_state.config.allocation_strategy == AllocationStrategy::Static
+                && max_slice_len < slice_len
+            {
+                fail!(from self, with LoanError::ExceedsMaxLoanSize,
+                    "Unable to loan slice with {} elements since it would exceed the max supported slice length of {}.",
+                    slice_len, max_slice_len);
+            }
+
+            let sample_layout = shared_state.sender.sample_layout(slice_len);
+            let chunk = shared_state.allocate(sample_layout)?;
+            (chunk, *shared_state.sender.service_state.shared_node().id())
+        };
 
-        let sample_layout = shared_state.sender.sample_layout(slice_len);
-        let chunk = shared_state.sender.allocate(sample_layout)?;
+        Ok(unsafe {
+            self.init_slice_sample(
+                chunk,
+                node_id,
+                slice_len,
+                underlying_number_of_slice_elements,
+            )
+        })
+    }
+
+    /// # Safety
+    ///
+    ///  * `chunk` must be freshly allocated from the sender of this publisher
+    ///  * the payload of `chunk` must provide `underlying_number_of_slice_elements` elements
+    unsafe fn init_slice_sample(
+        &self,
+        chunk: ChunkMut,
+        node_id: UniqueNodeId,
+        slice_len: usize,
+        underlying_number_of_slice_elements: usize,
+    ) -> SampleMutUninit<Service, [MaybeUninit<Payload>], UserHeader> {
         let user_header_ptr: *mut UserHeader = chunk.user_header.cast();
         let header_ptr = chunk.header as *mut Header;
-        let node_id = shared_state.sender.service_state.shared_node().id();
-        unsafe { header_ptr.write(Header::new(*node_id, self.id(), slice_len as _)) };
+        unsafe { header_ptr.write(Header::new(node_id, self.id(), slice_len as _)) };
         unsafe { user_header_ptr.write(UserHeader::default()) };
 
         let sample = unsafe {
@@ -861,13 +1746,11 @@ impl<
             )
         };
 
-        Ok(
-            SampleMutUninit::<Service, [MaybeUninit<Payload>], UserHeader>::new(
-                &self.publisher_shared_state,
-                sample,
-                chunk.offset,
-                chunk.size,
-            ),
+        SampleMutUninit::<Service, [MaybeUninit<Payload>], UserHeader>::new(
+            &self.publisher_shared_state,
+            sample,
+            chunk.offset,
+            chunk.size,
         )
     }
 }
@@ -888,14 +1771,48 @@ impl<Service: service::Service> Publisher<Service, [CustomPayloadMarker], Custom
         SampleMutUninit<Service, [MaybeUninit<CustomPayloadMarker>], CustomHeaderMarker>,
         LoanError,
     > {
-        let shared_state = self.publisher_shared_state.lock();
+        let payload_size = {
+            let shared_state = self.publisher_shared_state.lock();
+
+            // TypeVariant::Dynamic == slice and only here it makes sense to loan more than one element
+            debug_assert!(
+                slice_len == 1
+                    || shared_state.sender.payload_type_variant() == TypeVariant::Dynamic
+            );
 
-        // TypeVariant::Dynamic == slice and only here it makes sense to loan more than one element
-        debug_assert!(
-            slice_len == 1 || shared_state.sender.payload_type_variant() == TypeVariant::Dynamic
-        );
+            shared_state.sender.payload_size()
+        };
+
+        self.loan_slice_uninit_impl(slice_len, payload_size * slice_len)
+    }
+
+    /// Behaves like [`Publisher::loan_custom_payload()`] with a `slice_len` of 1 but acquires the
+    /// publisher state only once and skips the slice length checks.
+    ///
+    /// # Safety
+    ///
+    ///  * The number_of_elements in the [`Header`](crate::service::header::publish_subscribe::Header)
+    ///     is set to 1
+    ///  * The [`SampleMutUninit`] will contain `MessageTypeDetails::payload.size`
+    ///     elements of type [`CustomPayloadMarker`].
+    #[doc(hidden)]
+    pub unsafe fn loan_custom_payload_fixed_size(
+        &self,
+    ) -> Result<
+        SampleMutUninit<Service, [MaybeUninit<CustomPayloadMarker>], CustomHeaderMarker>,
+        LoanError,
+    > {
+        let (chunk, node_id, payload_size) = {
+            let shared_state = self.publisher_shared_state.lock();
+            let chunk = shared_state.allocate(shared_state.sender.sample_layout(1))?;
+            (
+                chunk,
+                *shared_state.sender.service_state.shared_node().id(),
+                shared_state.sender.payload_size(),
+            )
+        };
 
-        self.loan_slice_uninit_impl(slice_len, shared_state.sender.payload_size() * slice_len)
+        Ok(unsafe { self.init_slice_sample(chunk, node_id, 1, payload_size) })
     }
 }
 ////////////////////////
@@ -909,6 +1826,9 @@ impl<
 > UpdateConnections for Publisher<Service, Payload, UserHeader>
 {
     fn update_connections(&self) -> Result<(), ConnectionFailure> {
-        self.publisher_shared_state.lock().update_connections()
+        let shared_state = self.publisher_shared_state.lock();
+        shared_state.update_connections()?;
+        shared_state.reclaim_samples_of_dead_subscribers();
+        Ok(())
     }
 }
@@ -37,14 +37,20 @@
 
 use crate::constants::MAX_BLACKBOARD_KEY_SIZE;
 use crate::identifiers::UniqueReaderId;
+use crate::port::details::blackboard_history::{History, NO_HISTORY};
 use crate::port::port_name::PortName;
 use crate::prelude::EventId;
+use crate::service::blackboard_snapshot::{BlackboardSnapshot, SnapshotEntry};
 use crate::service::builder::CustomKeyMarker;
-use crate::service::builder::blackboard::{BlackboardResources, KeyMemory};
+use crate::service::builder::blackboard::{
+    BlackboardResources, KeyMemory, Mgmt, UNHASHED_KEY, key_hash,
+};
 use crate::service::dynamic_config::blackboard::ReaderDetails;
 use crate::service::port_factory::reader::ReaderConfig;
 use crate::service::static_config::message_type_details::{TypeDetail, TypeVariant};
 use crate::service::{self, SharedServiceState};
+use alloc::vec;
+use alloc::vec::Vec;
 use core::alloc::Layout;
 use core::fmt::Debug;
 use core::hash::Hash;
@@ -78,6 +84,14 @@ impl<ValueType: Copy> Deref for BlackboardValue<ValueType> {
     }
 }
 
+impl<ValueType: Copy> BlackboardValue<ValueType> {
+    /// Returns the generation counter of the value. It increases by one with every update of
+    /// the entry.
+    pub fn generation_counter(&self) -> u64 {
+        self.generation_counter
+    }
+}
+
 impl<ValueType: Copy + core::fmt::Display> core::fmt::Display for BlackboardValue<ValueType> {
     fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
         write!(f, "{}", self.value)
@@ -309,49 +323,220 @@ impl<
             }
         };
 
-        let offset = self.get_entry_offset(
+        let (offset, history_offset) = self.get_entry_offset(
             &key_mem,
+            key_hash(key),
             &TypeDetail::new::<ValueType>(TypeVariant::FixedSize),
             msg,
         )?;
 
-        let atomic = (self
+        let payload_start_address = self
             .shared_state
             .lock()
             .service_state
             .additional_resource()
             .data
-            .payload_start_address() as u64
-            + offset) as *const UnrestrictedAtomic<ValueType>;
+            .payload_start_address() as u64;
+        let atomic = (payload_start_address + offset) as *const UnrestrictedAtomic<ValueType>;
+        let history = match history_offset {
+            NO_HISTORY => core::ptr::null(),
+            _ => (payload_start_address + history_offset) as *const History<ValueType>,
+        };
 
-        Ok(EntryHandle::new(self.shared_state.clone(), atomic, offset))
+        Ok(EntryHandle::new(
+            self.shared_state.clone(),
+            atomic,
+            history,
+            offset,
+        ))
+    }
+
+    /// Creates an [`EntryHandleGroup`] that reads the values of all passed keys in one pass.
+    /// All entries must have the same value type.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .blackboard_creator::<u64>()
+    /// #     .add::<i32>(1, -1)
+    /// #     .add::<i32>(2, -2)
+    /// #     .create()?;
+    /// #
+    /// # let reader = service.reader_builder().create()?;
+    /// let mut group = reader.entry_handle_group::<i32>(&[1, 2])?;
+    /// let mut values = [0; 2];
+    /// let number_of_changed_entries = group.update(&mut values);
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn entry_handle_group<ValueType: Copy + ZeroCopySend>(
+        &self,
+        keys: &[KeyType],
+    ) -> Result<EntryHandleGroup<Service, KeyType, ValueType>, EntryHandleError> {
+        let msg = "Unable to create entry handle group";
+        let payload_start_address = self
+            .shared_state
+            .lock()
+            .service_state
+            .additional_resource()
+            .data
+            .payload_start_address() as u64;
+
+        let mut atomics = Vec::with_capacity(keys.len());
+        for key in keys {
+            let key_mem = match KeyMemory::try_from(key) {
+                Ok(mem) => mem,
+                Err(_) => {
+                    fatal_panic!(from self, "This should never happen! Key with invalid layout passed.");
+                }
+            };
+
+            let (offset, _) = self.get_entry_offset(
+                &key_mem,
+                key_hash(key),
+                &TypeDetail::new::<ValueType>(TypeVariant::FixedSize),
+                msg,
+            )?;
+
+            atomics.push((payload_start_address + offset) as *const UnrestrictedAtomic<ValueType>);
+        }
+
+        Ok(EntryHandleGroup::new(self.shared_state.clone(), atomics))
+    }
+
+    /// Calls `read` until it observed a consistent state of the blackboard, meaning that no
+    /// [`Transaction`](crate::port::writer::Transaction) of the
+    /// [`Writer`](crate::port::writer::Writer) was in progress or committed in between.
+    /// Therefore, all values that are read inside of `read` are either from before or after a
+    /// transaction but never a mix of both. `read` may be called multiple times and shall only
+    /// read the entries.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .blackboard_creator::<u64>()
+    /// #     .add::<f32>(1, 0.0)
+    /// #     .add::<f32>(2, 0.0)
+    /// #     .create()?;
+    /// #
+    /// # let reader = service.reader_builder().create()?;
+    /// let x = reader.entry::<f32>(&1)?;
+    /// let y = reader.entry::<f32>(&2)?;
+    /// let (x, y) = reader.snapshot(|| (*x.get(), *y.get()));
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn snapshot<R, F: FnMut() -> R>(&self, mut read: F) -> R {
+        // the mgmt segment is owned by the shared state which outlives the reader, the lock is
+        // not held while `read` is called since it may use the reader itself
+        let mgmt = self
+            .shared_state
+            .lock()
+            .service_state
+            .additional_resource()
+            .mgmt
+            .get() as *const Mgmt;
+        let mgmt = unsafe { &*mgmt };
+
+        loop {
+            let transaction_counter = mgmt.begin_snapshot();
+            let result = read();
+            if mgmt.is_snapshot_consistent(transaction_counter) {
+                return result;
+            }
+        }
+    }
+
+    /// Creates a [`BlackboardSnapshot`] that contains a copy of all values of the blackboard.
+    /// The values are consistent in the same way as in [`Reader::snapshot()`]. The snapshot
+    /// can be stored with [`BlackboardSnapshot::write_to_file()`] and used to initialize the
+    /// blackboard again with
+    /// [`Creator::restore_from_snapshot()`](crate::service::builder::blackboard::Creator::restore_from_snapshot()).
+    pub fn create_snapshot(&self) -> BlackboardSnapshot {
+        let (mgmt, payload_start_address, key_type) = {
+            let shared_state = self.shared_state.lock();
+            let resources = shared_state.service_state.additional_resource();
+            (
+                resources.mgmt.get() as *const Mgmt,
+                resources.data.payload_start_address(),
+                *shared_state
+                    .service_state
+                    .static_config()
+                    .blackboard()
+                    .type_details(),
+            )
+        };
+        // the mgmt segment is owned by the shared state which outlives the reader
+        let mgmt = unsafe { &*mgmt };
+
+        let entries = self.snapshot(|| {
+            mgmt.entries
+                .iter()
+                .map(|entry| {
+                    let value_type = entry.type_details;
+                    let atomic_mgmt_ptr = (payload_start_address as u64
+                        + entry.offset.load(core::sync::atomic::Ordering::Relaxed))
+                        as *const UnrestrictedAtomicMgmt;
+                    let data_ptr = align(
+                        atomic_mgmt_ptr as usize + core::mem::size_of::<UnrestrictedAtomicMgmt>(),
+                        value_type.alignment,
+                    );
+
+                    let mut value = vec![0u8; value_type.size];
+                    unsafe {
+                        (*atomic_mgmt_ptr).load(
+                            value.as_mut_ptr(),
+                            value_type.size,
+                            value_type.alignment,
+                            data_ptr as *const u8,
+                        )
+                    };
+
+                    SnapshotEntry {
+                        key: entry.key.data.to_vec(),
+                        value_type,
+                        value,
+                    }
+                })
+                .collect::<Vec<_>>()
+        });
+
+        BlackboardSnapshot::new(key_type, entries)
     }
 
     fn get_entry_offset(
         &self,
         key_mem: &KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+        key_hash: u64,
         value_type_details: &TypeDetail,
         msg: &str,
-    ) -> Result<u64, EntryHandleError> {
+    ) -> Result<(u64, u64), EntryHandleError> {
         // check if key exists
-        let index = match unsafe {
-            self.shared_state
-                .lock()
-                .service_state
-                .additional_resource()
-                .mgmt
-                .get()
-                .map
-                .__internal_get(
-                    key_mem,
-                    self.shared_state
-                        .lock()
-                        .service_state
-                        .additional_resource()
-                        .key_eq_func
-                        .as_ref(),
-                )
-        } {
+        let index = match self
+            .shared_state
+            .lock()
+            .service_state
+            .additional_resource()
+            .mgmt
+            .get()
+            .find_entry(
+                key_mem,
+                key_hash,
+                self.shared_state
+                    .lock()
+                    .service_state
+                    .additional_resource()
+                    .key_eq_func
+                    .as_ref(),
+            ) {
             Some(i) => i,
             None => {
                 fail!(from self, with EntryHandleError::EntryDoesNotExist,
@@ -375,7 +560,7 @@ impl<
 
         let offset = entry.offset.load(core::sync::atomic::Ordering::Relaxed);
 
-        Ok(offset)
+        Ok((offset, entry.history_offset))
     }
 }
 
@@ -401,13 +586,14 @@ pub struct EntryHandle<
     ValueType: Copy,
 > {
     atomic: *const UnrestrictedAtomic<ValueType>,
+    history: *const History<ValueType>,
     entry_id: EventId,
     _shared_state: Service::ArcThreadSafetyPolicy<ReaderSharedState<Service, KeyType>>,
 }
 
-// Safe since the pointer to the UnrestrictedAtomic doesn't change and the UnrestrictedAtomic
-// implements Send + Sync, and shared_state ensures the lifetime of the UnrestrictedAtomic (struct
-// fields are dropped in the same order as declared)
+// Safe since the pointers to the UnrestrictedAtomic and the history don't change, both are
+// accessed lock-free, and shared_state ensures their lifetime (struct fields are dropped in the
+// same order as declared)
 unsafe impl<
     Service: service::Service,
     KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
@@ -432,10 +618,12 @@ impl<
     fn new(
         reader_state: Service::ArcThreadSafetyPolicy<ReaderSharedState<Service, KeyType>>,
         atomic: *const UnrestrictedAtomic<ValueType>,
+        history: *const History<ValueType>,
         offset: u64,
     ) -> Self {
         Self {
             atomic,
+            history,
             entry_id: EventId::new(offset as _),
             _shared_state: reader_state.clone(),
         }
@@ -498,6 +686,61 @@ impl<
         unsafe { (*self.atomic).__internal_get_write_cell() == value.generation_counter }
     }
 
+    /// Returns how many values the history of the entry keeps. It is zero when the entry was
+    /// not added with
+    /// [`Creator::add_with_history()`](crate::service::builder::blackboard::Creator::add_with_history()).
+    pub fn history_depth(&self) -> usize {
+        match self.history.is_null() {
+            true => 0,
+            false => unsafe { (*self.history).depth() as usize },
+        }
+    }
+
+    /// Returns an iterator over the latest `number_of_values` values of the entry, starting
+    /// with the most recent one, without copying the history first. It yields at most
+    /// [`EntryHandle::history_depth()`] values and stops early when older values are
+    /// overwritten by the writer while iterating.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .blackboard_creator::<u64>()
+    /// #     .add_with_history::<i32>(1, -1, 16)
+    /// #     .create()?;
+    /// #
+    /// # let reader = service.reader_builder().create()?;
+    /// # let entry_handle = reader.entry::<i32>(&1)?;
+    /// for value in entry_handle.history(4) {
+    ///     println!("generation {}: {}", value.generation_counter(), *value);
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn history(&self, number_of_values: usize) -> EntryHistory<'_, ValueType> {
+        match self.history.is_null() {
+            true => EntryHistory {
+                history: None,
+                next_update: 0,
+                remaining: 0,
+            },
+            false => {
+                let history = unsafe { &*self.history };
+                let next_update = history.number_of_updates();
+                EntryHistory {
+                    history: Some(history),
+                    next_update,
+                    remaining: next_update
+                        .min(history.depth())
+                        .min(number_of_values as u64),
+                }
+            }
+        }
+    }
+
     /// Returns an ID corresponding to the entry which can be used in an event based communication
     /// setup.
     pub fn entry_id(&self) -> EventId {
@@ -505,6 +748,174 @@ impl<
     }
 }
 
+/// Iterator over the latest values of a blackboard entry, created with
+/// [`EntryHandle::history()`].
+pub struct EntryHistory<'handle, ValueType: Copy> {
+    history: Option<&'handle History<ValueType>>,
+    next_update: u64,
+    remaining: u64,
+}
+
+impl<ValueType: Copy> Debug for EntryHistory<'_, ValueType> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "EntryHistory<{}> {{ next_update: {}, remaining: {} }}",
+            core::any::type_name::<ValueType>(),
+            self.next_update,
+            self.remaining
+        )
+    }
+}
+
+impl<ValueType: Copy> Iterator for EntryHistory<'_, ValueType> {
+    type Item = BlackboardValue<ValueType>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        let history = self.history?;
+        if self.remaining == 0 {
+            return None;
+        }
+
+        self.remaining -= 1;
+        self.next_update -= 1;
+        match history.get(self.next_update) {
+            // the initial value is the first update and has the generation counter 1, every
+            // update increments it by one
+            Some(value) => Some(BlackboardValue {
+                value,
+                generation_counter: self.next_update + 1,
+            }),
+            None => {
+                self.remaining = 0;
+                None
+            }
+        }
+    }
+}
+
+/// Reads the values of many blackboard entries with the same value type in one pass. The
+/// generation counters of all entries are stored contiguously in the group and only the values
+/// that changed since the last [`EntryHandleGroup::update()`] are copied.
+pub struct EntryHandleGroup<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
+    ValueType: Copy,
+> {
+    atomics: Vec<*const UnrestrictedAtomic<ValueType>>,
+    generation_counters: Vec<u64>,
+    changed_entries: Vec<u64>,
+    _shared_state: Service::ArcThreadSafetyPolicy<ReaderSharedState<Service, KeyType>>,
+}
+
+// Safe for the same reasons as the EntryHandle, the group only stores pointers to
+// UnrestrictedAtomics whose lifetime is ensured by the shared_state
+unsafe impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
+    ValueType: Copy + 'static,
+> Send for EntryHandleGroup<Service, KeyType, ValueType>
+{
+}
+
+impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
+    ValueType: Copy,
+> EntryHandleGroup<Service, KeyType, ValueType>
+{
+    const BITS_PER_WORD: usize = u64::BITS as usize;
+
+    fn new(
+        reader_state: Service::ArcThreadSafetyPolicy<ReaderSharedState<Service, KeyType>>,
+        atomics: Vec<*const UnrestrictedAtomic<ValueType>>,
+    ) -> Self {
+        let len = atomics.len();
+        Self {
+            atomics,
+            // the write cell of an UnrestrictedAtomic starts at 1, therefore the first update
+            // copies all values
+            generation_counters: vec![0; len],
+            changed_entries: vec![0; len.div_ceil(Self::BITS_PER_WORD)],
+            _shared_state: reader_state,
+        }
+    }
+
+    /// Returns the number of entries in the group.
+    pub fn len(&self) -> usize {
+        self.atomics.len()
+    }
+
+    /// Returns true when the group contains no entries.
+    pub fn is_empty(&self) -> bool {
+        self.atomics.is_empty()
+    }
+
+    /// Copies every value that changed since the last call into the corresponding element of
+    /// `values`, in the order of the keys passed to [`Reader::entry_handle_group()`]. Unchanged
+    /// elements are not touched. Returns the number of changed entries, which entries changed
+    /// can be queried with [`EntryHandleGroup::has_changed()`] or
+    /// [`EntryHandleGroup::changed_entries()`].
+    pub fn update(&mut self, values: &mut [ValueType]) -> usize {
+        if values.len() != self.atomics.len() {
+            fatal_panic!(from self,
+                "The number of values ({}) must be equal to the number of entries ({}).",
+                values.len(), self.atomics.len());
+        }
+
+        self.changed_entries.fill(0);
+        let mut number_of_changed_entries = 0;
+        for (i, atomic) in self.atomics.iter().enumerate() {
+            let atomic = unsafe { &**atomic };
+            let generation_counter = atomic.__internal_get_write_cell();
+            if generation_counter == self.generation_counters[i] {
+                continue;
+            }
+
+            // The generation_counter may be outdated when the value is updated in between. This
+            // leads only to a false positive in the next update, no update is lost.
+            values[i] = atomic.load();
+            self.generation_counters[i] = generation_counter;
+            self.changed_entries[i / Self::BITS_PER_WORD] |= 1 << (i % Self::BITS_PER_WORD);
+            number_of_changed_entries += 1;
+        }
+
+        number_of_changed_entries
+    }
+
+    /// Returns true when the entry at `index` changed in the last [`EntryHandleGroup::update()`].
+    pub fn has_changed(&self, index: usize) -> bool {
+        index < self.atomics.len()
+            && self.changed_entries[index / Self::BITS_PER_WORD]
+                & (1 << (index % Self::BITS_PER_WORD))
+                != 0
+    }
+
+    /// Returns the bitset of the entries that changed in the last [`EntryHandleGroup::update()`].
+    /// Bit `i % 64` of word `i / 64` corresponds to the entry at index `i`.
+    pub fn changed_entries(&self) -> &[u64] {
+        &self.changed_entries
+    }
+}
+
+impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
+    ValueType: Copy,
+> Debug for EntryHandleGroup<Service, KeyType, ValueType>
+{
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "EntryHandleGroup<{}, {}, {}> {{ len: {} }}",
+            core::any::type_name::<Service>(),
+            core::any::type_name::<KeyType>(),
+            core::any::type_name::<ValueType>(),
+            self.atomics.len()
+        )
+    }
+}
+
 impl<Service: service::Service> Reader<Service, CustomKeyMarker> {
     #[doc(hidden)]
     /// # Safety
@@ -537,7 +948,7 @@ impl<Service: service::Service> Reader<Service, CustomKeyMarker> {
             }
         };
 
-        let offset = self.get_entry_offset(&key_mem, value_type_details, msg)?;
+        let (offset, _) = self.get_entry_offset(&key_mem, UNHASHED_KEY, value_type_details, msg)?;
 
         let atomic_mgmt_ptr = (shared_state
             .service_state
@@ -602,6 +1013,57 @@ impl<Service: service::Service> __InternalEntryHandle<Service> {
         }
     }
 
+    /// Copies the value to `value_ptr` only when `generation_counter` is outdated and stores the
+    /// new generation counter in it. Returns true when the value was copied.
+    ///
+    /// # Safety
+    ///
+    ///   * see Safety section of core::ptr::copy_nonoverlapping
+    pub unsafe fn update_if_changed(
+        &self,
+        value_ptr: *mut u8,
+        value_size: usize,
+        value_alignment: usize,
+        generation_counter: &mut u64,
+    ) -> bool {
+        unsafe {
+            let current_generation_counter = (*self.atomic_mgmt_ptr).__internal_get_write_cell();
+            if current_generation_counter == *generation_counter {
+                return false;
+            }
+
+            (*self.atomic_mgmt_ptr).load(value_ptr, value_size, value_alignment, self.data_ptr);
+            *generation_counter = current_generation_counter;
+            true
+        }
+    }
+
+    /// Returns a pointer to the latest value in shared memory together with its generation
+    /// counter, the value is not copied. The read is only valid when
+    /// [`__InternalEntryHandle::end_read()`] returns [`true`] for the returned generation counter
+    /// after the value was read.
+    ///
+    /// # Safety
+    ///
+    ///   * `value_size` and `value_alignment` must be the ones of the value type of the entry
+    ///   * the value behind the pointer can be modified concurrently by the writer, it must be
+    ///     discarded when [`__InternalEntryHandle::end_read()`] returns [`false`]
+    pub unsafe fn begin_read(&self, value_size: usize, value_alignment: usize) -> (*const u8, u64) {
+        unsafe {
+            (*self.atomic_mgmt_ptr).__internal_begin_read(
+                value_size,
+                value_alignment,
+                self.data_ptr,
+            )
+        }
+    }
+
+    /// Returns [`true`] when the value acquired with [`__InternalEntryHandle::begin_read()`]
+    /// was not updated by the writer while it was read.
+    pub fn end_read(&self, generation_counter: u64) -> bool {
+        unsafe { (*self.atomic_mgmt_ptr).__internal_is_read_consistent(generation_counter) }
+    }
+
     /// Returns an ID corresponding to the entry which can be used in an event based communication
     /// setup.
     pub fn entry_id(&self) -> EventId {
@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use core::fmt::Debug;
+
+use tiny_fn::tiny_fn;
+
+use crate::identifiers::UniqueClientId;
+
+/// Defines in which order a [`Server`](crate::port::server::Server) takes the requests from
+/// the buffers of its connected [`Client`](crate::port::client::Client)s. The weight of a
+/// [`Client`](crate::port::client::Client) is provided by the [`ClientWeightHandler`] when the
+/// connection is established and is `1` when no handler is set.
+#[derive(Debug, Default, Eq, PartialEq, Clone, Copy)]
+pub enum ReceivePolicy {
+    /// The connections are always drained in the same fixed order. A
+    /// [`Client`](crate::port::client::Client) that continuously sends requests can starve
+    /// the [`Client`](crate::port::client::Client)s that come later in the order.
+    #[default]
+    FixedOrder,
+    /// The connections take turns, every connection delivers one request before the next
+    /// connection with requests is served.
+    RoundRobin,
+    /// The connections take turns, every connection delivers up to its weight in consecutive
+    /// requests before the next connection with requests is served.
+    WeightedFair,
+    /// The request is taken from the connection with the highest weight that has requests.
+    /// Connections with the same weight take turns. Requests of lower weighted connections
+    /// are only received when no higher weighted connection has requests.
+    Priority,
+}
+
+/// Returns the weight of a [`Client`](crate::port::client::Client) that is used by the
+/// [`ReceivePolicy::WeightedFair`] and [`ReceivePolicy::Priority`]. A weight of `0` is
+/// adjusted to `1`.
+pub trait ClientWeightFn: Fn(&UniqueClientId) -> u32 + Send {}
+
+impl<F: Fn(&UniqueClientId) -> u32 + Send> ClientWeightFn for F {}
+
+tiny_fn! {
+    /// Defines the weight of a [`Client`](crate::port::client::Client) for the
+    /// [`ReceivePolicy`] of a [`Server`](crate::port::server::Server).
+    pub struct ClientWeightHandler = Fn(client_id: &UniqueClientId) -> u32;
+}
+
+unsafe impl Send for ClientWeightHandler<'_> {}
+
+impl Debug for ClientWeightHandler<'_> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "ClientWeightHandler")
+    }
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A [`ScheduledPublisher`] sends already loaned [`SampleMut`]s of a
+//! [`Publisher`](crate::port::publisher::Publisher) at fixed time slots `phase + n * period`
+//! of [`ClockType::default()`], the same clock the [`WaitSet`](crate::waitset::WaitSet) uses
+//! for [`WaitSet::attach_interval_with_phase()`](crate::waitset::WaitSet::attach_interval_with_phase()).
+//! The slots are absolute time points, so the send instant does not
+//! drift when the loop that prepares the samples has jitter, and all [`ScheduledPublisher`]s
+//! with the same period and phase send at the same time, even in different processes.
+//!
+//! The [`SampleMut`] should be loaned and written before [`ScheduledPublisher::send()`] is
+//! called so that only the delivery happens in the slot.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::port::scheduled_publisher::ScheduledPublisher;
+//! # use core::time::Duration;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//! #     .publish_subscribe::<u64>()
+//! #     .open_or_create()?;
+//! let publisher = service.publisher_builder().create()?;
+//!
+//! // send every millisecond, 250 microseconds after the full millisecond
+//! let mut schedule =
+//!     ScheduledPublisher::new(Duration::from_millis(1), Duration::from_micros(250))?;
+//!
+//! loop {
+//!     let sample = publisher.loan_uninit()?.write_payload(1234);
+//!     schedule.send(sample)?;
+//! }
+//! # }
+//! ```
+
+use core::fmt::Debug;
+use core::time::Duration;
+
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::{
+    ClockType, NanosleepError, Time, TimeBuilder, TimeError, nanosleep_until,
+};
+use iceoryx2_log::fail;
+
+use crate::port::SendError;
+use crate::sample_mut::SampleMut;
+
+/// Defines a failure that can occur when a [`ScheduledPublisher`] is created with
+/// [`ScheduledPublisher::new()`].
+#[derive(Debug, PartialEq, Eq, Copy, Clone)]
+pub enum ScheduledPublisherCreateError {
+    /// The period of the slots must be greater than zero.
+    PeriodIsZero,
+    /// The current time could not be acquired.
+    InternalError,
+}
+
+impl core::fmt::Display for ScheduledPublisherCreateError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "ScheduledPublisherCreateError::{self:?}")
+    }
+}
+
+impl core::error::Error for ScheduledPublisherCreateError {}
+
+/// Sends [`SampleMut`]s at the absolute time slots `phase + n * period` of
+/// [`ClockType::default()`], see the [module documentation](self) for details.
+#[derive(Debug)]
+pub struct ScheduledPublisher {
+    clock_type: ClockType,
+    period: u128,
+    next_slot: u128,
+    missed_slots: u64,
+}
+
+impl ScheduledPublisher {
+    /// Creates a new [`ScheduledPublisher`] whose first slot is the next time point
+    /// `phase + n * period` after now.
+    pub fn new(period: Duration, phase: Duration) -> Result<Self, ScheduledPublisherCreateError> {
+        let origin = "ScheduledPublisher::new()";
+        let period = period.as_nanos();
+        if period == 0 {
+            fail!(from origin, with ScheduledPublisherCreateError::PeriodIsZero,
+                "Unable to create the ScheduledPublisher since the period is zero.");
+        }
+
+        let clock_type = ClockType::default();
+        let now = fail!(from origin, when now(clock_type),
+                with ScheduledPublisherCreateError::InternalError,
+                "Unable to create the ScheduledPublisher since the current time could not be acquired.");
+
+        let offset = (now + period - phase.as_nanos() % period) % period;
+        Ok(Self {
+            clock_type,
+            period,
+            next_slot: now + period - offset,
+            missed_slots: 0,
+        })
+    }
+
+    /// Returns the period between two slots.
+    pub fn period(&self) -> Duration {
+        duration_from_nanos(self.period)
+    }
+
+    /// Returns the time of the next slot on [`ClockType::default()`].
+    pub fn next_slot(&self) -> Duration {
+        duration_from_nanos(self.next_slot)
+    }
+
+    /// Returns the number of slots that were skipped since [`ScheduledPublisher::send()`] was
+    /// called too late for them.
+    pub fn missed_slots(&self) -> u64 {
+        self.missed_slots
+    }
+
+    /// Waits until the next slot is reached and sends the [`SampleMut`] in it. When the next
+    /// slot has already passed, the [`SampleMut`] is sent in the first slot that is still
+    /// ahead and the skipped slots are counted in [`ScheduledPublisher::missed_slots()`].
+    /// On success it returns the number of
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s that received the
+    /// [`SampleMut`].
+    pub fn send<
+        Service: crate::service::Service,
+        Payload: Debug + ZeroCopySend + ?Sized,
+        UserHeader: ZeroCopySend,
+    >(
+        &mut self,
+        sample: SampleMut<Service, Payload, UserHeader>,
+    ) -> Result<usize, SendError> {
+        let msg = "Unable to send the sample in the next slot";
+        let now = fail!(from self, when now(self.clock_type), with SendError::InternalError,
+                "{msg} since the current time could not be acquired.");
+
+        if self.next_slot <= now {
+            let skipped_slots = (now - self.next_slot) / self.period + 1;
+            self.next_slot += skipped_slots * self.period;
+            self.missed_slots += skipped_slots as u64;
+        }
+
+        let slot = duration_from_nanos(self.next_slot);
+        let slot = TimeBuilder::new()
+            .clock_type(self.clock_type)
+            .seconds(slot.as_secs())
+            .nanoseconds(slot.subsec_nanos())
+            .create();
+
+        loop {
+            match nanosleep_until(slot) {
+                Ok(()) => break,
+                // the slot is an absolute time point, the sleep can be repeated without drift
+                Err(NanosleepError::InterruptedBySignal(_)) => continue,
+                Err(e) => {
+                    fail!(from self, with SendError::InternalError,
+                        "{msg} since the sleep until the slot failed ({:?}).", e);
+                }
+            }
+        }
+
+        self.next_slot += self.period;
+        sample.send()
+    }
+}
+
+fn now(clock_type: ClockType) -> Result<u128, TimeError> {
+    Ok(Time::now_with_clock(clock_type)?.as_duration().as_nanos())
+}
+
+fn duration_from_nanos(value: u128) -> Duration {
+    Duration::new(
+        (value / 1_000_000_000) as u64,
+        (value % 1_000_000_000) as u32,
+    )
+}
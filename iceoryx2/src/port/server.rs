@@ -73,10 +73,18 @@
 //! # }
 //! ```
 
+use crate::port::content_filter::ContentFilter;
+use crate::port::delivery_mode::DeliveryMode;
 use crate::port::port_name::PortName;
+use crate::port::receive_policy::{ClientWeightHandler, ReceivePolicy};
+use crate::port::statistics::{PortStatistics, PortStatisticsCounters, PortStatisticsRecorder};
 use crate::port::update_connections::UpdateConnections;
+use crate::port::wake_up_channel::{
+    WakeUpChannel, WakeUpListener, create_wake_up_listener, drain_wake_up, reset_wake_up,
+};
 use crate::prelude::BackpressureStrategy;
 use crate::service::builder::CustomPayloadMarker;
+use crate::service::header::request_response::CoalescedRequestId;
 use crate::service::naming_scheme::data_segment_name;
 use crate::service::port_factory::server::LocalServerConfig;
 use crate::service::{NoResource, SharedServiceState};
@@ -104,12 +112,22 @@ use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_memory::heap_allocator::HeapAllocator;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
 use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::event::EventId;
+use iceoryx2_cal::shm_allocator::PointerOffset;
 use iceoryx2_cal::zero_copy_connection::{CHANNEL_STATE_CLOSED, CHANNEL_STATE_OPEN, ChannelId};
 use iceoryx2_log::{fail, warn};
 
-use super::details::data_segment::DataSegment;
+use super::SendError;
+use super::details::data_segment::{DataSegment, DataSegmentMemoryOptions};
+use super::details::request_coalescing::{
+    CoalescedRequest, InFlightRequests, RequestContent, RequestKey,
+};
+use super::details::request_scheduling::{ScheduledRequest, ScheduledRequests};
 use super::details::segment_state::SegmentState;
 use super::details::sender::{ReceiverDetails, Sender};
 use super::{
@@ -118,14 +136,14 @@ use super::{
         chunk::Chunk,
         chunk_details::ChunkDetails,
         data_segment::DataSegmentType,
-        receiver::{Receiver, SenderDetails},
+        receiver::{ReceiveCursor, Receiver, SenderDetails},
     },
     update_connections::ConnectionFailure,
 };
-use crate::identifiers::UniqueServerId;
+use crate::identifiers::{UniqueClientId, UniqueServerId};
 
 // All requests are received via one channel with id 0
-const REQUEST_CHANNEL_ID: ChannelId = ChannelId::new(0);
+pub(crate) const REQUEST_CHANNEL_ID: ChannelId = ChannelId::new(0);
 pub(crate) const INVALID_CONNECTION_ID: usize = usize::MAX;
 
 #[derive(Debug)]
@@ -135,7 +153,11 @@ pub(crate) struct SharedServerState<Service: service::Service> {
     server_handle: UnsafeCell<Option<ContainerHandle>>,
     pub(crate) request_receiver: Receiver<Service>,
     client_list_state: UnsafeCell<ContainerState<ClientDetails>>,
+    pub(crate) in_flight_requests: UnsafeCell<InFlightRequests>,
+    scheduled_requests: UnsafeCell<ScheduledRequests>,
+    client_weight_handler: Option<ClientWeightHandler<'static>>,
     service_state: SharedServiceState<Service, NoResource>,
+    wake_up: Option<WakeUpListener<Service>>,
     // IMPORTANT!
     // Fields of a rust struct are dropped in declaration order. Since this tag is our marker that the
     // port exists and might require cleanup after a crash, the tag must be defined as last member of
@@ -151,6 +173,9 @@ impl<Service: service::Service> Abandonable for SharedServerState<Service> {
 
         unsafe { Sender::abandon_in_place(NonNull::iox2_from_mut(&mut this.response_sender)) };
         unsafe { Receiver::abandon_in_place(NonNull::iox2_from_mut(&mut this.request_receiver)) };
+        if let Some(wake_up) = this.wake_up.as_mut() {
+            unsafe { WakeUpListener::<Service>::abandon_in_place(NonNull::iox2_from_mut(wake_up)) };
+        }
         unsafe {
             SharedServiceState::abandon_in_place(NonNull::iox2_from_mut(&mut this.service_state))
         };
@@ -162,6 +187,11 @@ impl<Service: service::Service> Abandonable for SharedServerState<Service> {
 
 impl<Service: service::Service> Drop for SharedServerState<Service> {
     fn drop(&mut self) {
+        for request in unsafe { &mut *self.scheduled_requests.get() }.take_all() {
+            self.request_receiver
+                .release_offset(&request.details, REQUEST_CHANNEL_ID);
+        }
+
         if let Some(handle) = unsafe { *self.server_handle.get() } {
             self.service_state
                 .dynamic_storage()
@@ -191,6 +221,13 @@ impl<Service: service::Service> SharedServerState<Service> {
         Ok(())
     }
 
+    fn client_weight(&self, client_id: &UniqueClientId) -> u32 {
+        match &self.client_weight_handler {
+            Some(handler) => handler.call(client_id),
+            None => 1,
+        }
+    }
+
     fn force_update_connections(&self) -> Result<(), ConnectionFailure> {
         self.request_receiver.start_update_connection_cycle();
         self.response_sender.start_update_connection_cycle();
@@ -206,6 +243,7 @@ impl<Service: service::Service> SharedServerState<Service> {
                         number_of_samples: details.number_of_requests,
                         max_number_of_segments: details.max_number_of_segments,
                         data_segment_type: details.data_segment_type,
+                        weight: self.client_weight(&details.client_id),
                     },
                 );
                 result = result.and(inner_result);
@@ -216,6 +254,8 @@ impl<Service: service::Service> SharedServerState<Service> {
                     ReceiverDetails {
                         port_id: details.client_id.value(),
                         buffer_size: details.response_buffer_size,
+                        content_filter: ContentFilter::accept_all(),
+                        has_wake_up_channel: false,
                     },
                     |_| {},
                 );
@@ -232,6 +272,167 @@ impl<Service: service::Service> SharedServerState<Service> {
 
         result
     }
+
+    /// Moves all available requests into the scheduled requests, rejects the ones whose
+    /// deadline has passed and returns the one with the earliest deadline.
+    fn receive_scheduled(&self) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
+        let scheduled_requests = unsafe { &mut *self.scheduled_requests.get() };
+        loop {
+            match self.request_receiver.receive(REQUEST_CHANNEL_ID) {
+                Ok(Some((details, chunk))) => {
+                    scheduled_requests.push(ScheduledRequest { details, chunk })
+                }
+                Ok(None) => break,
+                // the scheduled requests occupy all borrows, they are handed out first
+                Err(ReceiveError::ExceedsMaxBorrows) if !scheduled_requests.is_empty() => break,
+                Err(e) => return Err(e),
+            }
+        }
+
+        match Time::now_with_clock(ClockType::Monotonic) {
+            Ok(now) => {
+                let now = now.as_duration().as_nanos() as u64;
+                for request in scheduled_requests.take_expired(now) {
+                    self.reject_request(request);
+                }
+            }
+            Err(e) => {
+                warn!(from self,
+                    "Requests whose deadline has passed are not rejected since the current time could not be acquired ({:?}).", e);
+            }
+        }
+
+        Ok(scheduled_requests
+            .pop_earliest()
+            .map(|request| (request.details, request.chunk)))
+    }
+
+    /// Resets the wake up channel. When ready client tracking is enabled, the connections of
+    /// all clients that signaled it are marked as ready.
+    fn collect_ready_clients(&self) {
+        let wake_up = match &self.wake_up {
+            Some(wake_up) => wake_up,
+            None => return,
+        };
+
+        if self.config.enable_ready_client_tracking {
+            drain_wake_up::<Service, _>(wake_up, |index| {
+                self.request_receiver.mark_connection_as_ready(index)
+            });
+        } else {
+            reset_wake_up::<Service>(wake_up);
+        }
+    }
+
+    /// Releases the request without handing it out and signals the client that it was
+    /// rejected.
+    fn reject_request(&self, request: ScheduledRequest) {
+        let header = request.header();
+        if let Some(connection_id) = self
+            .response_sender
+            .get_connection_id_of(header.client_id.value())
+        {
+            self.response_sender.reject_channel(
+                header.channel_id,
+                connection_id,
+                header.request_id,
+            );
+        }
+
+        self.request_receiver
+            .release_offset(&request.details, REQUEST_CHANNEL_ID);
+    }
+
+    /// Writes the in-flight request and all attached requests whose clients still wait for
+    /// responses as recipients into the header of a response of the in-flight request. If
+    /// no request was attached, the header remains untouched.
+    pub(crate) fn prepare_coalesced_response(
+        &self,
+        header: &mut service::header::request_response::ResponseHeader,
+        key: &RequestKey,
+    ) {
+        let coalesced_requests = unsafe { &*self.in_flight_requests.get() }.coalesced_requests(key);
+        if coalesced_requests.is_empty() {
+            return;
+        }
+
+        let client_id = match self.response_sender.get(key.connection_id) {
+            Some(connection) => UniqueClientId(UniqueSystemId::from(connection.receiver_port_id)),
+            None => return,
+        };
+
+        let mut number_of_recipients = 0;
+        let mut add_recipient = |client_id, request_id| {
+            header.coalesced_requests[number_of_recipients] = CoalescedRequestId {
+                client_id,
+                request_id,
+            };
+            number_of_recipients += 1;
+        };
+
+        add_recipient(client_id, key.request_id);
+        for request in coalesced_requests {
+            if self.response_sender.has_channel_state(
+                request.key.channel_id,
+                request.key.connection_id,
+                request.key.request_id,
+            ) {
+                add_recipient(request.client_id, request.key.request_id);
+            }
+        }
+
+        header.number_of_coalesced_requests = number_of_recipients as u64;
+    }
+
+    /// Delivers a response of the in-flight request additionally to all attached requests.
+    /// The response is delivered to every request even if the delivery to one of them fails,
+    /// the first failure is returned.
+    pub(crate) fn deliver_to_coalesced_requests(
+        &self,
+        offset: PointerOffset,
+        sample_size: usize,
+        key: &RequestKey,
+    ) -> Result<(), SendError> {
+        let mut result = Ok(());
+        for request in unsafe { &*self.in_flight_requests.get() }.coalesced_requests(key) {
+            if !self.response_sender.has_channel_state(
+                request.key.channel_id,
+                request.key.connection_id,
+                request.key.request_id,
+            ) {
+                continue;
+            }
+
+            if let Err(e) = self
+                .response_sender
+                .deliver_offset_to_connection_without_reclaim(
+                    offset,
+                    sample_size,
+                    request.key.channel_id,
+                    request.key.connection_id,
+                )
+            {
+                if result.is_ok() {
+                    result = Err(e);
+                }
+            }
+        }
+
+        result
+    }
+
+    /// Removes the in-flight request and completes all requests that were attached to it.
+    pub(crate) fn release_coalesced_requests(&self, key: &RequestKey) {
+        for request in unsafe { &mut *self.in_flight_requests.get() }.remove(key) {
+            self.request_receiver
+                .release_offset(&request.details, REQUEST_CHANNEL_ID);
+            self.response_sender.close_channel(
+                request.key.channel_id,
+                request.key.connection_id,
+                request.key.request_id,
+            );
+        }
+    }
 }
 
 /// Receives [`RequestMut`](crate::request_mut::RequestMut) from a
@@ -249,6 +450,7 @@ pub struct Server<
     shared_state: Service::ArcThreadSafetyPolicy<SharedServerState<Service>>,
     max_loaned_responses_per_request: usize,
     enable_fire_and_forget: bool,
+    enable_request_coalescing: bool,
     server_details: &'static ServerDetails,
     _request_payload: PhantomData<RequestPayload>,
     _request_header: PhantomData<RequestHeader>,
@@ -388,6 +590,7 @@ impl<
             receiver_max_borrowed_samples: static_config.max_active_requests_per_client,
             enable_safe_overflow: static_config.enable_safe_overflow_for_requests,
             buffer_size: static_config.max_active_requests_per_client,
+            active_buffer_size: UnsafeCell::new(static_config.max_active_requests_per_client),
             tagger: CyclicTagger::new(),
             to_be_removed_connections: if static_config.enable_fire_and_forget_requests {
                 Some(UnsafeCell::new(
@@ -404,6 +607,12 @@ impl<
             number_of_channels: 1,
             connection_storage: UnsafeCell::new(SlotMap::new(number_of_connections)),
             initial_channel_state: CHANNEL_STATE_OPEN,
+            delivery_mode: DeliveryMode::Fifo,
+            receive_policy: server_factory.config.receive_policy,
+            receive_cursor: UnsafeCell::new(ReceiveCursor::default()),
+            track_ready_connections: server_factory.config.enable_ready_client_tracking,
+            prefetch_size: 0,
+            statistics: PortStatisticsRecorder::default(),
         };
 
         let global_config = service.shared_node().config();
@@ -422,20 +631,31 @@ impl<
                 sample_layout,
                 global_config,
                 number_of_responses,
+                DataSegmentMemoryOptions::default(),
             ),
-            DataSegmentType::Dynamic => DataSegment::<Service>::create_dynamic_segment(
-                &segment_name,
-                sample_layout,
-                global_config,
-                number_of_responses,
-                server_factory.config.allocation_strategy,
-            ),
+            DataSegmentType::Dynamic | DataSegmentType::SizeClasses => {
+                DataSegment::<Service>::create_dynamic_segment(
+                    &segment_name,
+                    sample_layout,
+                    global_config,
+                    number_of_responses,
+                    server_factory.config.allocation_strategy,
+                    DataSegmentMemoryOptions::default(),
+                )
+            }
         };
 
         let data_segment = fail!(from origin,
             when data_segment,
             with ServerCreateError::UnableToCreateDataSegment,
             "{} since the server data segment could not be created.", msg);
+        let data_segment = data_segment.with_chunk_cache(
+            server_factory
+                .config
+                .preloaned_responses
+                .min(number_of_responses),
+        );
+        data_segment.prefill_chunk_cache(sample_layout);
 
         let response_sender = Sender {
             segment_states: {
@@ -467,18 +687,43 @@ impl<
             tagger: CyclicTagger::new(),
             loan_counter: AtomicUsize::new(0),
             backpressure_strategy: server_factory.config.backpressure_strategy,
+            backpressure_wait_strategy: global_config.global.backpressure_wait_strategy,
+            backpressure_wake_up_timeout: None,
             message_type_details: static_config.response_message_type_details,
             number_of_channels: number_of_requests_per_client,
             initial_channel_state: CHANNEL_STATE_CLOSED,
+            prefault_connections: false,
+            lock_connections_in_memory: false,
+            wake_up_event_id: AtomicUsize::new(0),
+            statistics: PortStatisticsRecorder::default(),
+        };
+
+        let wake_up = if server_factory.config.enable_wake_up
+            || server_factory.config.enable_ready_client_tracking
+        {
+            // every client signals the event id of its index in the client list, see
+            // PortFactoryServer::enable_ready_client_tracking()
+            let event_id_max = EventId::new(static_config.max_clients.saturating_sub(1));
+            Some(fail!(from origin,
+                        when create_wake_up_listener::<Service>(server_id.value(), event_id_max, global_config),
+                        with ServerCreateError::UnableToCreateWakeUpChannel,
+                        "{} since the underlying event concept of the wake up channel could not be created.", msg))
+        } else {
+            None
         };
 
+        let has_wake_up_channel = wake_up.is_some();
         let shared_state = Service::ArcThreadSafetyPolicy::new(SharedServerState {
             port_tag,
             config: server_factory.config,
             request_receiver,
             client_list_state: UnsafeCell::new(unsafe { client_list.get_state() }),
+            in_flight_requests: UnsafeCell::new(InFlightRequests::default()),
+            scheduled_requests: UnsafeCell::new(ScheduledRequests::default()),
+            client_weight_handler: server_factory.client_weight_handler,
             server_handle: UnsafeCell::new(None),
             service_state: service.clone(),
+            wake_up,
             response_sender,
         });
 
@@ -511,6 +756,7 @@ impl<
                 data_segment_type,
                 max_number_of_segments,
                 server_name: server_factory.config.port_name,
+                has_wake_up_channel,
             }) {
             Some(v) => v,
             None => {
@@ -523,6 +769,22 @@ impl<
 
         unsafe { *shared_state.lock().server_handle.get() = Some(handle) };
 
+        let statistics: *const PortStatisticsCounters = service
+            .dynamic_storage()
+            .get()
+            .request_response()
+            .server_statistics_of(handle);
+        // the statistics are stored in the dynamic config which outlives the server and the
+        // shared state was not yet shared with another thread
+        unsafe {
+            let shared_state = shared_state.lock();
+            shared_state.response_sender.statistics.attach(&*statistics);
+            shared_state
+                .request_receiver
+                .statistics
+                .attach(&*statistics);
+        };
+
         Ok(Self {
             max_loaned_responses_per_request: server_factory
                 .config
@@ -531,6 +793,7 @@ impl<
                 .static_config()
                 .request_response()
                 .enable_fire_and_forget_requests,
+            enable_request_coalescing: server_factory.config.enable_request_coalescing,
             shared_state,
             server_details: unsafe { &*details },
             _request_payload: PhantomData,
@@ -550,11 +813,31 @@ impl<
         &self.server_details.server_name
     }
 
+    /// Returns the wake up channel of the [`Server`] when it was enabled with
+    /// [`PortFactoryServer::enable_wake_up()`]. It becomes readable as soon as a
+    /// [`Client`](crate::port::client::Client) delivered a request and is reset by
+    /// [`Server::receive()`] when no more requests are available.
+    pub fn wake_up_channel(&self) -> Option<&WakeUpChannel>
+    where
+        WakeUpListener<Service>: SynchronousMultiplexing,
+    {
+        let shared_state = self.shared_state.lock();
+        let wake_up = shared_state.wake_up.as_ref()? as *const WakeUpListener<Service>;
+        // the wake up listener is never replaced during the lifetime of the server port
+        Some(WakeUpChannel::from_listener::<Service>(unsafe {
+            &*wake_up
+        }))
+    }
+
     /// Returns true if the [`Server`] has [`RequestMut`](crate::request_mut::RequestMut)s in its buffer.
     pub fn has_requests(&self) -> Result<bool, ConnectionFailure> {
         let shared_state = self.shared_state.lock();
         fail!(from self, when shared_state.update_connections(),
                 "Some requests are not being received since not all connections to clients could be established.");
+        if !unsafe { &*shared_state.scheduled_requests.get() }.is_empty() {
+            return Ok(true);
+        }
+
         if self.enable_fire_and_forget {
             Ok(shared_state
                 .request_receiver
@@ -576,6 +859,14 @@ impl<
             .backpressure_strategy
     }
 
+    /// Returns the [`PortStatistics`] of the [`Server`]. `received` counts the received
+    /// requests, `sent` the sent responses, `overflows` the responses that were dropped since
+    /// the buffer of a [`Client`](crate::port::client::Client) was full and `failed_loans`
+    /// the response loans that failed.
+    pub fn statistics(&self) -> PortStatistics {
+        self.shared_state.lock().response_sender.statistics.load()
+    }
+
     fn receive_impl(&self) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
         let shared_state = self.shared_state.lock();
         if let Err(e) = shared_state.update_connections() {
@@ -584,7 +875,76 @@ impl<
                   "Some requests are not being received since not all connections to the clients could be established.");
         }
 
-        shared_state.request_receiver.receive(REQUEST_CHANNEL_ID)
+        let receive = || {
+            if shared_state.config.enable_deadline_scheduling {
+                shared_state.receive_scheduled()
+            } else {
+                shared_state.request_receiver.receive(REQUEST_CHANNEL_ID)
+            }
+        };
+
+        if shared_state.config.enable_ready_client_tracking {
+            shared_state.collect_ready_clients();
+        }
+
+        let data = receive()?;
+        match &shared_state.wake_up {
+            Some(_) if data.is_none() => {
+                shared_state.collect_ready_clients();
+                receive()
+            }
+            _ => Ok(data),
+        }
+    }
+
+    /// Attaches the received request to an identical in-flight request when request
+    /// coalescing is enabled, otherwise it becomes an in-flight request itself. Returns the
+    /// [`ChunkDetails`] when the request must be handed out as [`ActiveRequest`].
+    fn coalesce_request(
+        &self,
+        details: ChunkDetails,
+        chunk: &Chunk,
+        connection_id: usize,
+    ) -> Option<ChunkDetails> {
+        if !self.enable_request_coalescing {
+            return Some(details);
+        }
+
+        let header =
+            unsafe { &*(chunk.header as *const service::header::request_response::RequestHeader) };
+        let key = RequestKey {
+            connection_id,
+            channel_id: header.channel_id,
+            request_id: header.request_id,
+        };
+
+        let shared_state = self.shared_state.lock();
+        // requests whose client no longer waits for a response are discarded by the caller
+        if !shared_state.response_sender.has_channel_state(
+            key.channel_id,
+            key.connection_id,
+            key.request_id,
+        ) {
+            return Some(details);
+        }
+
+        let message_type_details = &shared_state.request_receiver.message_type_details;
+        let content = RequestContent {
+            user_header: chunk.user_header,
+            user_header_size: message_type_details.user_header.size,
+            payload: chunk.payload,
+            payload_size: header.number_of_elements as usize * message_type_details.payload.size,
+        };
+
+        let request = CoalescedRequest {
+            details,
+            client_id: header.client_id,
+            key,
+        };
+
+        unsafe { &mut *shared_state.in_flight_requests.get() }
+            .coalesce_or_register(request, content)
+            .map(|request| request.details)
     }
 }
 
@@ -676,6 +1036,10 @@ impl<
                         .response_sender
                         .get_connection_id_of(header.client_id.value())
                     {
+                        let details = match self.coalesce_request(details, &chunk, connection_id) {
+                            Some(details) => details,
+                            None => continue,
+                        };
                         let active_request =
                             self.create_active_request(details, chunk, connection_id);
 
@@ -793,6 +1157,10 @@ impl<
                         .response_sender
                         .get_connection_id_of(header.client_id.value())
                     {
+                        let details = match self.coalesce_request(details, &chunk, connection_id) {
+                            Some(details) => details,
+                            None => continue,
+                        };
                         let active_request = self.create_active_request(
                             details,
                             chunk,
@@ -865,6 +1233,10 @@ impl<
                         .response_sender
                         .get_connection_id_of(header.client_id.value())
                     {
+                        let details = match self.coalesce_request(details, &chunk, connection_id) {
+                            Some(details) => details,
+                            None => continue,
+                        };
                         let active_request = self.create_active_request(
                             details,
                             chunk,
@@ -0,0 +1,190 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .open_or_create()?;
+//!
+//! let publisher = service.publisher_builder().create()?;
+//! let subscriber = service.subscriber_builder().create()?;
+//!
+//! publisher.send_copy(1234)?;
+//! let _sample = subscriber.receive()?;
+//!
+//! println!("publisher:        {:?}", publisher.statistics());
+//! println!("subscriber:       {:?}", subscriber.statistics());
+//! println!("all publishers:   {:?}", service.dynamic_config().publisher_statistics());
+//! # Ok(())
+//! # }
+//! ```
+
+use core::ops::{Add, AddAssign};
+
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering};
+use iceoryx2_bb_concurrency::cell::UnsafeCell;
+use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+
+/// Snapshot of the counters of a port. The counters are stored in the dynamic config of the
+/// service and are updated by the port with relaxed atomic operations, therefore they can be
+/// read by every participant of the service at any time.
+#[repr(C)]
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq, ZeroCopySend)]
+pub struct PortStatistics {
+    /// The number of successful send operations, e.g. samples of a
+    /// [`Publisher`](crate::port::publisher::Publisher) or responses of a
+    /// [`Server`](crate::port::server::Server).
+    pub sent: u64,
+    /// The number of received samples, requests or events.
+    pub received: u64,
+    /// The number of deliveries that were dropped since the buffer of a receiver was full.
+    /// A sending port counts them when the oldest sample was replaced on safe overflow or
+    /// when the data was discarded with
+    /// [`BackpressureStrategy::DiscardData`](crate::port::backpressure_strategy::BackpressureStrategy::DiscardData).
+    /// A [`Subscriber`](crate::port::subscriber::Subscriber) counts the samples it lost, see
+    /// [`Subscriber::lost_samples()`](crate::port::subscriber::Subscriber::lost_samples()).
+    pub overflows: u64,
+    /// The number of loans that failed, for instance since the data segment was out of memory
+    /// or the maximum number of loans was exceeded.
+    pub failed_loans: u64,
+}
+
+impl Add for PortStatistics {
+    type Output = Self;
+
+    fn add(self, rhs: Self) -> Self::Output {
+        Self {
+            sent: self.sent + rhs.sent,
+            received: self.received + rhs.received,
+            overflows: self.overflows + rhs.overflows,
+            failed_loans: self.failed_loans + rhs.failed_loans,
+        }
+    }
+}
+
+impl AddAssign for PortStatistics {
+    fn add_assign(&mut self, rhs: Self) {
+        *self = *self + rhs;
+    }
+}
+
+/// The counters of a single port that are stored in the dynamic config.
+#[repr(C)]
+#[derive(Debug, Default, ZeroCopySend)]
+pub(crate) struct PortStatisticsCounters {
+    sent: AtomicU64,
+    received: AtomicU64,
+    overflows: AtomicU64,
+    failed_loans: AtomicU64,
+}
+
+impl PortStatisticsCounters {
+    pub(crate) fn load(&self) -> PortStatistics {
+        PortStatistics {
+            sent: self.sent.load(Ordering::Relaxed),
+            received: self.received.load(Ordering::Relaxed),
+            overflows: self.overflows.load(Ordering::Relaxed),
+            failed_loans: self.failed_loans.load(Ordering::Relaxed),
+        }
+    }
+
+    pub(crate) fn reset(&self) {
+        self.sent.store(0, Ordering::Relaxed);
+        self.received.store(0, Ordering::Relaxed);
+        self.overflows.store(0, Ordering::Relaxed);
+        self.failed_loans.store(0, Ordering::Relaxed);
+    }
+
+    pub(crate) fn add_sent(&self) {
+        self.sent.fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn add_received(&self, number_of_received: u64) {
+        self.received
+            .fetch_add(number_of_received, Ordering::Relaxed);
+    }
+
+    pub(crate) fn add_overflows(&self, number_of_overflows: u64) {
+        self.overflows
+            .fetch_add(number_of_overflows, Ordering::Relaxed);
+    }
+
+    pub(crate) fn add_failed_loan(&self) {
+        self.failed_loans.fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+/// Updates the [`PortStatisticsCounters`] of a port that consists of a shared state. Since the
+/// port is registered in the dynamic config as last step of its creation, the counters are
+/// attached afterwards. Until then, all updates are discarded.
+#[derive(Debug)]
+pub(crate) struct PortStatisticsRecorder {
+    counters: UnsafeCell<Option<&'static PortStatisticsCounters>>,
+}
+
+impl Default for PortStatisticsRecorder {
+    fn default() -> Self {
+        Self {
+            counters: UnsafeCell::new(None),
+        }
+    }
+}
+
+impl PortStatisticsRecorder {
+    /// # Safety
+    ///
+    ///  * must be called before the port is shared with other threads
+    ///  * `counters` must stay valid as long as the port exists, which is guaranteed
+    ///    when they are stored in the dynamic config of the service of the port
+    pub(crate) unsafe fn attach(&self, counters: &'static PortStatisticsCounters) {
+        unsafe { *self.counters.get() = Some(counters) };
+    }
+
+    fn counters(&self) -> Option<&'static PortStatisticsCounters> {
+        unsafe { *self.counters.get() }
+    }
+
+    pub(crate) fn load(&self) -> PortStatistics {
+        self.counters().map(|c| c.load()).unwrap_or_default()
+    }
+
+    pub(crate) fn add_sent(&self) {
+        if let Some(counters) = self.counters() {
+            counters.add_sent();
+        }
+    }
+
+    pub(crate) fn add_received(&self, number_of_received: u64) {
+        if let Some(counters) = self.counters() {
+            counters.add_received(number_of_received);
+        }
+    }
+
+    pub(crate) fn add_overflows(&self, number_of_overflows: u64) {
+        if let Some(counters) = self.counters() {
+            counters.add_overflows(number_of_overflows);
+        }
+    }
+
+    pub(crate) fn add_failed_loan(&self) {
+        if let Some(counters) = self.counters() {
+            counters.add_failed_loan();
+        }
+    }
+}
@@ -35,8 +35,9 @@ use core::any::TypeId;
 use core::fmt::Debug;
 use core::marker::PhantomData;
 use core::ptr::NonNull;
+use core::time::Duration;
 
-use iceoryx2_bb_concurrency::atomic::Ordering;
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering};
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
 use iceoryx2_bb_container::slotmap::SlotMap;
 use iceoryx2_bb_container::vector::polymorphic_vec::*;
@@ -47,19 +48,32 @@ use iceoryx2_bb_elementary_traits::testing::abandonable::Abandonable;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_lock_free::mpmc::container::{ContainerHandle, ContainerState};
 use iceoryx2_bb_memory::heap_allocator::HeapAllocator;
+use iceoryx2_bb_posix::adaptive_wait::{AdaptiveTimedWaitWhileError, AdaptiveWaitBuilder};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
 use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::event::{EventId, Listener};
 use iceoryx2_cal::zero_copy_connection::{CHANNEL_STATE_OPEN, ChannelId};
 use iceoryx2_log::{fail, warn};
 
+use crate::port::delivery_mode::DeliveryMode;
 use crate::port::port_name::PortName;
+use crate::port::receive_policy::ReceivePolicy;
+use crate::port::statistics::{PortStatistics, PortStatisticsCounters, PortStatisticsRecorder};
 use crate::port::update_connections::UpdateConnections;
+use crate::port::wake_up_channel::{
+    WakeUpChannel, WakeUpListener, create_wake_up_listener, reset_wake_up,
+};
+use crate::port::{SampleLossHandler, SampleLossInfo};
+use crate::sample_release_batch::SampleReleaseBatch;
 use crate::service::builder::CustomPayloadMarker;
 use crate::service::dynamic_config::publish_subscribe::{PublisherDetails, SubscriberDetails};
 use crate::service::header::publish_subscribe::Header;
 use crate::service::port_factory::subscriber::SubscriberConfig;
 use crate::service::static_config::publish_subscribe::StaticConfig;
 use crate::service::{NoResource, SharedServiceState};
+use crate::tracepoint::tracepoint;
 use crate::{raw_sample::RawSample, sample::Sample, service};
 
 use super::ReceiveError;
@@ -91,6 +105,12 @@ pub enum SubscriberCreateError {
     HistoryRequestExceedsHistorySizeOfService,
     /// When the [`Subscriber`] requests a larger history than its buffer can hold.
     HistoryRequestExceedsBufferSizeOfSubscriber,
+    /// When the key of the [`ContentFilter`](crate::port::content_filter::ContentFilter) is
+    /// not located inside the user header of the [`Service`](crate::service::Service).
+    ContentFilterExceedsUserHeader,
+    /// The wake up channel, see [`PortFactorySubscriber::enable_wake_up()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_wake_up()),
+    /// could not be created.
+    UnableToCreateWakeUpChannel,
 }
 
 impl core::fmt::Display for SubscriberCreateError {
@@ -101,10 +121,78 @@ impl core::fmt::Display for SubscriberCreateError {
 
 impl core::error::Error for SubscriberCreateError {}
 
+/// Failures that can occur when the buffer of a [`Subscriber`] is resized with
+/// [`Subscriber::resize_buffer()`].
+#[derive(Debug, Clone, Copy, Eq, Hash, PartialEq)]
+pub enum SubscriberResizeBufferError {
+    /// The requested buffer size exceeds [`Subscriber::max_buffer_size()`]. Enable
+    /// [`PortFactorySubscriber::enable_buffer_resizing()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_buffer_resizing())
+    /// to grow the buffer up to the maximum buffer size of the service.
+    BufferSizeExceedsMaxBufferSize,
+}
+
+impl core::fmt::Display for SubscriberResizeBufferError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "SubscriberResizeBufferError::{self:?}")
+    }
+}
+
+impl core::error::Error for SubscriberResizeBufferError {}
+
+/// Defines how [`Subscriber::receive_blocking()`] waits until a new
+/// [`Sample`] arrives. The [`Subscriber`] polls the connections for
+/// [`SpinPolicy::spin_cycles()`] cycles and then blocks on its wake up channel until a
+/// [`Publisher`](crate::port::publisher::Publisher) delivers a sample, see
+/// [`PortFactorySubscriber::enable_wake_up()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_wake_up()).
+/// Without a wake up channel it falls back to an adaptive wait that yields and finally
+/// sleeps between two polls. The timeout is only checked after the spin phase.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct SpinPolicy {
+    spin_cycles: u64,
+}
+
+impl Default for SpinPolicy {
+    fn default() -> Self {
+        Self {
+            spin_cycles: Self::DEFAULT_SPIN_CYCLES,
+        }
+    }
+}
+
+impl SpinPolicy {
+    /// The number of busy polls [`SpinPolicy::default()`] performs
+    pub const DEFAULT_SPIN_CYCLES: u64 = 10000;
+
+    /// Creates a new [`SpinPolicy`] that busy polls the connections `spin_cycles` times
+    /// before it blocks.
+    pub const fn new(spin_cycles: u64) -> Self {
+        Self { spin_cycles }
+    }
+
+    /// Creates a new [`SpinPolicy`] that does not busy poll at all and blocks
+    /// right away.
+    pub const fn no_spin() -> Self {
+        Self::new(0)
+    }
+
+    /// Returns the number of busy polls before the [`Subscriber`] blocks.
+    pub fn spin_cycles(&self) -> u64 {
+        self.spin_cycles
+    }
+}
+
 #[derive(Debug)]
 pub(crate) struct SubscriberSharedState<Service: service::Service> {
     pub(crate) receiver: Receiver<Service>,
     pub(crate) publisher_list_state: UnsafeCell<ContainerState<PublisherDetails>>,
+    /// Is set when not every connection could be established. The next change of the
+    /// publisher list updates all connections instead of only the changed ones.
+    has_incomplete_connections: UnsafeCell<bool>,
+    detect_sample_loss: bool,
+    receive_in_send_order: bool,
+    number_of_lost_samples: AtomicU64,
+    sample_loss_handler: Option<SampleLossHandler<'static>>,
+    wake_up: Option<WakeUpListener<Service>>,
     // IMPORTANT!
     // Fields of a rust struct are dropped in declaration order. Since this tag is our marker that the
     // port exists and might require cleanup after a crash, the tag must be defined as last member of
@@ -114,10 +202,95 @@ pub(crate) struct SubscriberSharedState<Service: service::Service> {
     port_tag: Service::StaticStorage,
 }
 
+impl<Service: service::Service> SubscriberSharedState<Service> {
+    /// Returns true when any priority lane contains samples.
+    fn has_samples(&self) -> bool {
+        (0..self.receiver.number_of_channels)
+            .any(|lane| self.receiver.has_samples(ChannelId::new(lane)))
+    }
+
+    /// Receives from the priority lanes in descending order, so that a sample with a higher
+    /// priority is received before all samples with a lower priority. A lane that exceeds the
+    /// maximum number of borrowed samples fails only when no other lane provides a sample.
+    fn receive(&self) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
+        let mut result = Ok(None);
+        for lane in (0..self.receiver.number_of_channels).rev() {
+            let data = if self.receive_in_send_order {
+                // the header is written by the publisher before the sample is delivered
+                self.receiver
+                    .receive_ordered_by(ChannelId::new(lane), |header| unsafe {
+                        (*(header as *const Header))
+                            .send_timestamp()
+                            .map(|t| t.as_duration())
+                    })
+            } else {
+                self.receiver.receive(ChannelId::new(lane))
+            };
+
+            match data {
+                Ok(None) => (),
+                Ok(data) => return Ok(data),
+                Err(e) => {
+                    if result.is_ok() {
+                        result = Err(e);
+                    }
+                }
+            }
+        }
+
+        result
+    }
+
+    /// Compares the sequence number of the received sample with the one expected from its
+    /// [`Publisher`](crate::port::publisher::Publisher) and accounts every gap as lost samples.
+    /// Samples that arrive with a smaller sequence number, like the history that is delivered
+    /// after the first live sample, are not accounted.
+    fn detect_sample_loss(&self, details: &ChunkDetails, header: *const Header) {
+        if !self.detect_sample_loss {
+            return;
+        }
+
+        let connection_storage = unsafe { &*self.receiver.connection_storage.get() };
+        let connection = match connection_storage.get(details.connection_key) {
+            Some(connection) => connection,
+            None => return,
+        };
+
+        let received_sequence_number = unsafe { (*header).sequence_number() };
+        let expected_sequence_number = unsafe { &mut *connection.expected_sequence_number.get() };
+        match *expected_sequence_number {
+            Some(expected) if received_sequence_number < expected => return,
+            Some(expected) if received_sequence_number > expected => {
+                let info = SampleLossInfo {
+                    sender_port_id: connection.sender_port_id,
+                    receiver_port_id: self.receiver.receiver_port_id,
+                    expected_sequence_number: expected,
+                    received_sequence_number,
+                };
+
+                self.number_of_lost_samples
+                    .fetch_add(info.number_of_lost_samples(), Ordering::Relaxed);
+                self.receiver
+                    .statistics
+                    .add_overflows(info.number_of_lost_samples());
+                if let Some(handler) = &self.sample_loss_handler {
+                    handler.call(&info);
+                }
+            }
+            _ => (),
+        }
+
+        *expected_sequence_number = Some(received_sequence_number + 1);
+    }
+}
+
 impl<Service: service::Service> Abandonable for SubscriberSharedState<Service> {
     unsafe fn abandon_in_place(mut this: NonNull<Self>) {
         let this = unsafe { this.as_mut() };
         unsafe { Receiver::abandon_in_place(NonNull::iox2_from_mut(&mut this.receiver)) };
+        if let Some(wake_up) = this.wake_up.as_mut() {
+            unsafe { WakeUpListener::<Service>::abandon_in_place(NonNull::iox2_from_mut(wake_up)) };
+        }
         unsafe {
             Service::StaticStorage::abandon_in_place(NonNull::iox2_from_mut(&mut this.port_tag))
         };
@@ -258,6 +431,21 @@ impl<
             None => static_config.history_size.min(buffer_size),
         };
 
+        // the connections are created with the maximum buffer size when the subscriber can be
+        // resized, the active buffer size limits them to the requested size
+        let connection_buffer_size = if config.enable_buffer_resizing {
+            static_config.subscriber_max_buffer_size
+        } else {
+            buffer_size
+        };
+
+        let user_header_size = static_config.message_type_details.user_header.size;
+        if !config.content_filter.fits_into(user_header_size) {
+            fail!(from origin, with SubscriberCreateError::ContentFilterExceedsUserHeader,
+                "{} since the key of the content filter {:?} is not located inside the user header with a size of {} bytes.",
+                msg, config.content_filter, user_header_size);
+        }
+
         let subscriber_max_borrowed_samples = static_config.subscriber_max_borrowed_samples;
         let subscriber_expired_connection_buffer = service
             .shared_node()
@@ -277,6 +465,15 @@ impl<
             subscriber_max_borrowed_samples
         };
 
+        let wake_up = if config.enable_wake_up {
+            Some(fail!(from origin,
+                        when create_wake_up_listener::<Service>(subscriber_id.value(), EventId::new(0), service.shared_node().config()),
+                        with SubscriberCreateError::UnableToCreateWakeUpChannel,
+                        "{} since the underlying event concept of the wake up channel could not be created.", msg))
+        } else {
+            None
+        };
+
         let number_of_active_connections = publisher_list.capacity();
         let number_of_connections =
             number_of_to_be_removed_connections + number_of_active_connections;
@@ -284,6 +481,17 @@ impl<
         let subscriber_shared_state = Service::ArcThreadSafetyPolicy::new(SubscriberSharedState {
             port_tag,
             publisher_list_state: UnsafeCell::new(unsafe { publisher_list.get_state() }),
+            has_incomplete_connections: UnsafeCell::new(false),
+            // gaps are expected when samples are skipped on purpose or are received out of
+            // order from different priority lanes
+            detect_sample_loss: config.delivery_mode == DeliveryMode::Fifo
+                && config.content_filter.accepts_all()
+                && static_config.number_of_priority_lanes == 1,
+            receive_in_send_order: config.receive_in_send_order
+                && static_config.enable_send_timestamps,
+            number_of_lost_samples: AtomicU64::new(0),
+            sample_loss_handler: config.sample_loss_handler,
+            wake_up,
             receiver: Receiver {
                 connections: PolymorphicVec::from_fn(
                     HeapAllocator::global(),
@@ -296,7 +504,8 @@ impl<
                 message_type_details: static_config.message_type_details,
                 receiver_max_borrowed_samples: subscriber_max_borrowed_samples,
                 enable_safe_overflow: static_config.enable_safe_overflow,
-                buffer_size,
+                buffer_size: connection_buffer_size,
+                active_buffer_size: UnsafeCell::new(buffer_size),
                 tagger: CyclicTagger::new(),
                 to_be_removed_connections: Some(UnsafeCell::new(
                     PolymorphicVec::new(
@@ -306,9 +515,15 @@ impl<
                     .expect("Heap allocator provides memory."),
                 )),
                 degradation_handler: config.degradation_handler,
-                number_of_channels: 1,
+                number_of_channels: static_config.number_of_priority_lanes,
                 connection_storage: UnsafeCell::new(SlotMap::new(number_of_connections)),
                 initial_channel_state: CHANNEL_STATE_OPEN,
+                delivery_mode: config.delivery_mode,
+                receive_policy: ReceivePolicy::FixedOrder,
+                receive_cursor: UnsafeCell::new(ReceiveCursor::default()),
+                track_ready_connections: false,
+                prefetch_size: config.prefetch_size,
+                statistics: PortStatisticsRecorder::default(),
             },
         });
 
@@ -335,10 +550,13 @@ impl<
             .publish_subscribe()
             .add_subscriber_id(SubscriberDetails {
                 subscriber_id,
-                buffer_size,
+                buffer_size: connection_buffer_size,
                 history_request,
+                history_since: config.history_since.unwrap_or_default(),
                 node_id: *service.shared_node().id(),
                 subscriber_name: config.port_name,
+                content_filter: config.content_filter,
+                has_wake_up_channel: config.enable_wake_up,
             }) {
             Some(v) => v,
             None => {
@@ -348,6 +566,21 @@ impl<
             }
         };
 
+        let statistics: *const PortStatisticsCounters = service
+            .dynamic_storage()
+            .get()
+            .publish_subscribe()
+            .subscriber_statistics_of(handle);
+        // the statistics are stored in the dynamic config which outlives the subscriber and the
+        // shared state was not yet shared with another thread
+        unsafe {
+            subscriber_shared_state
+                .lock()
+                .receiver
+                .statistics
+                .attach(&*statistics)
+        };
+
         Ok(Self {
             subscriber_shared_state,
             dynamic_subscriber_handle: handle,
@@ -357,6 +590,23 @@ impl<
         })
     }
 
+    fn update_connection(
+        subscriber_shared_state: &SubscriberSharedState<Service>,
+        index: usize,
+        details: &PublisherDetails,
+    ) -> Result<(), ConnectionFailure> {
+        subscriber_shared_state.receiver.update_connection(
+            index,
+            SenderDetails {
+                port_id: details.publisher_id.value(),
+                number_of_samples: details.number_of_samples,
+                max_number_of_segments: details.max_number_of_segments,
+                data_segment_type: details.data_segment_type,
+                weight: 1,
+            },
+        )
+    }
+
     fn force_update_connections(
         subscriber_shared_state: &SubscriberSharedState<Service>,
     ) -> Result<(), ConnectionFailure> {
@@ -367,15 +617,7 @@ impl<
         let mut result = Ok(());
         unsafe {
             (*subscriber_shared_state.publisher_list_state.get()).for_each(|index, details| {
-                let inner_result = subscriber_shared_state.receiver.update_connection(
-                    index,
-                    SenderDetails {
-                        port_id: details.publisher_id.value(),
-                        number_of_samples: details.number_of_samples,
-                        max_number_of_segments: details.max_number_of_segments,
-                        data_segment_type: details.data_segment_type,
-                    },
-                );
+                let inner_result = Self::update_connection(subscriber_shared_state, index, details);
 
                 if result.is_ok() {
                     result = inner_result;
@@ -387,6 +629,41 @@ impl<
         subscriber_shared_state
             .receiver
             .finish_update_connection_cycle();
+        unsafe { *subscriber_shared_state.has_incomplete_connections.get() = result.is_err() };
+
+        result
+    }
+
+    /// Updates only the connections to the publishers that were added, replaced or removed
+    /// with the last update of the publisher list state. When a previous update failed, all
+    /// connections are updated.
+    fn update_changed_connections(
+        subscriber_shared_state: &SubscriberSharedState<Service>,
+    ) -> Result<(), ConnectionFailure> {
+        if unsafe { *subscriber_shared_state.has_incomplete_connections.get() } {
+            return Self::force_update_connections(subscriber_shared_state);
+        }
+
+        let mut result = Ok(());
+        unsafe {
+            (*subscriber_shared_state.publisher_list_state.get()).for_each_changed(
+                |index, details| {
+                    match details {
+                        Some(details) => {
+                            let inner_result =
+                                Self::update_connection(subscriber_shared_state, index, details);
+                            if result.is_ok() {
+                                result = inner_result;
+                            }
+                        }
+                        None => subscriber_shared_state.receiver.remove_connection(index),
+                    }
+                    CallbackProgression::Continue
+                },
+            )
+        };
+
+        unsafe { *subscriber_shared_state.has_incomplete_connections.get() = result.is_err() };
 
         result
     }
@@ -403,28 +680,206 @@ impl<
 
     /// Returns the internal buffer size of the [`Subscriber`].
     pub fn buffer_size(&self) -> usize {
+        self.subscriber_shared_state
+            .lock()
+            .receiver
+            .active_buffer_size()
+    }
+
+    /// Returns the largest buffer size that can be set with [`Subscriber::resize_buffer()`].
+    /// It is the `subscriber_max_buffer_size` of the service when
+    /// [`PortFactorySubscriber::enable_buffer_resizing()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_buffer_resizing())
+    /// was enabled, otherwise the buffer size the [`Subscriber`] was created with.
+    pub fn max_buffer_size(&self) -> usize {
         self.subscriber_shared_state.lock().receiver.buffer_size
     }
 
+    /// Resizes the buffer of the [`Subscriber`] without recreating it. The already received
+    /// samples stay in the buffer when it grows. When it shrinks, the oldest samples that
+    /// exceed the new buffer size are returned to their
+    /// [`Publisher`](crate::port::publisher::Publisher)s. The smallest possible value is `1`.
+    pub fn resize_buffer(&self, value: usize) -> Result<(), SubscriberResizeBufferError> {
+        let subscriber_shared_state = self.subscriber_shared_state.lock();
+        let max_buffer_size = subscriber_shared_state.receiver.buffer_size;
+        if max_buffer_size < value {
+            fail!(from self, with SubscriberResizeBufferError::BufferSizeExceedsMaxBufferSize,
+                "Unable to resize the buffer to {} since it exceeds the max buffer size of {}.",
+                value, max_buffer_size);
+        }
+
+        subscriber_shared_state
+            .receiver
+            .set_active_buffer_size(value.max(1));
+        Ok(())
+    }
+
+    /// Returns the wake up channel of the [`Subscriber`] when it was enabled with
+    /// [`PortFactorySubscriber::enable_wake_up()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_wake_up()).
+    /// It becomes readable as soon as a [`Publisher`](crate::port::publisher::Publisher)
+    /// delivered a sample and can be attached to a [`WaitSet`](crate::waitset::WaitSet). It is
+    /// reset by [`Subscriber::receive()`] when no more samples are available.
+    pub fn wake_up_channel(&self) -> Option<&WakeUpChannel>
+    where
+        WakeUpListener<Service>: SynchronousMultiplexing,
+    {
+        let subscriber_shared_state = self.subscriber_shared_state.lock();
+        let wake_up = subscriber_shared_state.wake_up.as_ref()? as *const WakeUpListener<Service>;
+        // the wake up listener is never replaced during the lifetime of the subscriber port
+        Some(WakeUpChannel::from_listener::<Service>(unsafe {
+            &*wake_up
+        }))
+    }
+
+    /// Returns the number of samples that were lost since the [`Subscriber`] was created. The
+    /// loss is detected with the [`Header::sequence_number()`] of the received samples, a
+    /// [`Publisher`](crate::port::publisher::Publisher) that overflows the buffer of the
+    /// [`Subscriber`] causes a gap. Samples are not accounted when the [`Subscriber`] uses
+    /// [`DeliveryMode::LatestOnly`] or a
+    /// [`ContentFilter`](crate::port::content_filter::ContentFilter) since both skip samples on purpose.
+    pub fn lost_samples(&self) -> u64 {
+        self.subscriber_shared_state
+            .lock()
+            .number_of_lost_samples
+            .load(Ordering::Relaxed)
+    }
+
+    /// Returns the [`PortStatistics`] of the [`Subscriber`]. `received` counts the received
+    /// samples and `overflows` the samples that were lost, see [`Subscriber::lost_samples()`].
+    pub fn statistics(&self) -> PortStatistics {
+        self.subscriber_shared_state
+            .lock()
+            .receiver
+            .statistics
+            .load()
+    }
+
+    /// Creates a [`SampleReleaseBatch`] that collects the received [`Sample`]s and returns
+    /// them to their [`Publisher`](crate::port::publisher::Publisher)s in one pass as soon as
+    /// `capacity` [`Sample`]s were collected.
+    pub fn sample_release_batch(&self, capacity: usize) -> SampleReleaseBatch<Service> {
+        SampleReleaseBatch::new(self.subscriber_shared_state.clone(), capacity)
+    }
+
     /// Returns true if the [`Subscriber`] has samples in the buffer that can be received with [`Subscriber::receive`].
     pub fn has_samples(&self) -> Result<bool, ConnectionFailure> {
         fail!(from self, when self.update_connections(),
                 "Some samples are not being received since not all connections to publishers could be established.");
-        Ok(self
-            .subscriber_shared_state
-            .lock()
-            .receiver
-            .has_samples(ChannelId::new(0)))
+        Ok(self.subscriber_shared_state.lock().has_samples())
+    }
+
+    fn wait_for_samples(
+        &self,
+        timeout: Duration,
+        spin_policy: SpinPolicy,
+    ) -> Result<bool, ConnectionFailure> {
+        let msg = "Unable to wait for samples";
+        fail!(from self, when self.update_connections(),
+                "{msg} since not all connections to publishers could be established.");
+
+        let has_wake_up = {
+            let subscriber_shared_state = self.subscriber_shared_state.lock();
+            for _ in 0..spin_policy.spin_cycles {
+                if subscriber_shared_state.has_samples() {
+                    return Ok(true);
+                }
+                core::hint::spin_loop();
+            }
+            subscriber_shared_state.wake_up.is_some()
+        };
+
+        if has_wake_up {
+            self.wait_for_wake_up(timeout)
+        } else {
+            self.wait_adaptively(timeout)
+        }
+    }
+
+    fn wait_for_wake_up(&self, timeout: Duration) -> Result<bool, ConnectionFailure> {
+        let msg = "Unable to wait for samples on the wake up channel";
+        let start = match Time::now_with_clock(ClockType::Monotonic) {
+            Ok(start) => start,
+            Err(e) => {
+                warn!(from self, "{msg} since the current time could not be acquired ({e:?}).");
+                return self.has_samples();
+            }
+        };
+
+        loop {
+            fail!(from self, when self.update_connections(),
+                "{msg} since not all connections to publishers could be established.");
+
+            let subscriber_shared_state = self.subscriber_shared_state.lock();
+            let wake_up = match subscriber_shared_state.wake_up.as_ref() {
+                Some(wake_up) => wake_up,
+                None => return Ok(subscriber_shared_state.has_samples()),
+            };
+
+            reset_wake_up::<Service>(wake_up);
+            if subscriber_shared_state.has_samples() {
+                return Ok(true);
+            }
+
+            let elapsed = match start.elapsed() {
+                Ok(elapsed) => elapsed,
+                Err(e) => {
+                    warn!(from self, "{msg} since the elapsed time could not be acquired ({e:?}).");
+                    return Ok(false);
+                }
+            };
+            if timeout <= elapsed {
+                return Ok(false);
+            }
+
+            // every publisher signals the wake up channel after it delivered a sample, a
+            // wake up of a new publisher is handled by updating the connections in the next
+            // iteration
+            if let Err(e) = wake_up.timed_wait(|_| {}, timeout - elapsed) {
+                warn!(from self, "{msg} since the wait was interrupted ({e:?}).");
+                return Ok(subscriber_shared_state.has_samples());
+            }
+        }
+    }
+
+    fn wait_adaptively(&self, timeout: Duration) -> Result<bool, ConnectionFailure> {
+        let msg = "Unable to wait for samples";
+        let mut adaptive_wait = match AdaptiveWaitBuilder::new().create() {
+            Ok(adaptive_wait) => adaptive_wait,
+            Err(e) => {
+                warn!(from self, "{msg} since the adaptive wait could not be created ({e:?}).");
+                return self.has_samples();
+            }
+        };
+
+        match adaptive_wait.timed_wait_while(|| self.has_samples().map(|v| !v), timeout) {
+            Ok(has_samples) => Ok(has_samples),
+            Err(AdaptiveTimedWaitWhileError::PredicateFailure(e)) => Err(e),
+            Err(AdaptiveTimedWaitWhileError::AdaptiveWaitError(e)) => {
+                warn!(from self, "{msg} since the adaptive wait was interrupted ({e:?}).");
+                Ok(false)
+            }
+        }
     }
 
     fn receive_impl(&self) -> Result<Option<(ChunkDetails, Chunk)>, ReceiveError> {
         fail!(from self, when self.update_connections(),
                 "Some samples are not being received since not all connections to publishers could be established.");
 
-        self.subscriber_shared_state
-            .lock()
-            .receiver
-            .receive(ChannelId::new(0))
+        let subscriber_shared_state = self.subscriber_shared_state.lock();
+        let mut data = subscriber_shared_state.receive()?;
+
+        if data.is_none() {
+            if let Some(wake_up) = &subscriber_shared_state.wake_up {
+                reset_wake_up::<Service>(wake_up);
+                data = subscriber_shared_state.receive()?;
+            }
+        }
+
+        if let Some((details, chunk)) = &data {
+            tracepoint!(subscriber_receive, details.offset.as_value());
+            subscriber_shared_state.detect_sample_loss(details, chunk.header.cast());
+        }
+
+        Ok(data)
     }
 }
 
@@ -446,7 +901,7 @@ impl<
                 .publishers
                 .update_state(&mut *subscriber_shared_state.publisher_list_state.get())
         } {
-            fail!(from self, when Self::force_update_connections(&subscriber_shared_state),
+            fail!(from self, when Self::update_changed_connections(&subscriber_shared_state),
                 "Connections were updated only partially since at least one connection to a publisher failed.");
         }
 
@@ -472,6 +927,52 @@ impl<Service: service::Service, Payload: Debug + ZeroCopySend, UserHeader: Debug
             },
         }))
     }
+
+    /// Blocks until a [`crate::sample::Sample`] from a [`crate::port::publisher::Publisher`]
+    /// was received or the `timeout` has passed. The [`Subscriber`] busy polls its
+    /// connections as defined by the [`SpinPolicy`] and blocks on its wake up channel
+    /// afterwards, or waits adaptively when the wake up channel is not enabled.
+    /// If no sample could be received [`None`] is returned. If a failure occurs
+    /// [`ReceiveError`] is returned.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::port::subscriber::SpinPolicy;
+    /// use core::time::Duration;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    ///     .publish_subscribe::<u64>()
+    ///     .open_or_create()?;
+    ///
+    /// let publisher = service.publisher_builder().create()?;
+    /// let subscriber = service.subscriber_builder().create()?;
+    ///
+    /// publisher.send_copy(1234)?;
+    ///
+    /// if let Some(sample) =
+    ///     subscriber.receive_blocking(Duration::from_millis(10), SpinPolicy::default())?
+    /// {
+    ///     println!("received: {:?}", *sample);
+    /// }
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn receive_blocking(
+        &self,
+        timeout: Duration,
+        spin_policy: SpinPolicy,
+    ) -> Result<Option<Sample<Service, Payload, UserHeader>>, ReceiveError> {
+        if self.wait_for_samples(timeout, spin_policy)? {
+            self.receive()
+        } else {
+            Ok(None)
+        }
+    }
 }
 
 impl<Service: service::Service, Payload: Debug + ZeroCopySend, UserHeader: Debug + ZeroCopySend>
@@ -502,6 +1003,24 @@ impl<Service: service::Service, Payload: Debug + ZeroCopySend, UserHeader: Debug
             }
         }))
     }
+
+    /// Blocks until a [`crate::sample::Sample`] from a [`crate::port::publisher::Publisher`]
+    /// was received or the `timeout` has passed. The [`Subscriber`] busy polls its
+    /// connections as defined by the [`SpinPolicy`] and blocks on its wake up channel
+    /// afterwards, or waits adaptively when the wake up channel is not enabled.
+    /// If no sample could be received [`None`] is returned. If a failure occurs
+    /// [`ReceiveError`] is returned.
+    pub fn receive_blocking(
+        &self,
+        timeout: Duration,
+        spin_policy: SpinPolicy,
+    ) -> Result<Option<Sample<Service, [Payload], UserHeader>>, ReceiveError> {
+        if self.wait_for_samples(timeout, spin_policy)? {
+            self.receive()
+        } else {
+            Ok(None)
+        }
+    }
 }
 
 impl<Service: service::Service, UserHeader: Debug + ZeroCopySend>
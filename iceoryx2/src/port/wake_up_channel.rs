@@ -0,0 +1,116 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! The wake up channel of a receiving port like the
+//! [`Subscriber`](crate::port::subscriber::Subscriber) or the
+//! [`Server`](crate::port::server::Server). Every sending port signals it after it delivered
+//! data so that the receiving port can be attached to a [`WaitSet`](crate::waitset::WaitSet)
+//! without an additional event service.
+
+use alloc::format;
+
+use iceoryx2_bb_lock_free::mpmc::counting_bit_set::RelocatableCountingBitSet;
+use iceoryx2_bb_posix::file_descriptor::{FileDescriptor, FileDescriptorBased};
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_cal::event::{
+    Event, EventId, Listener, ListenerBuilder, ListenerCreateError, NamedConceptMgmt,
+};
+use iceoryx2_cal::named_concept::{NamedConceptBuilder, NamedConceptRemoveError};
+use iceoryx2_log::{fail, warn};
+
+use crate::config::Config;
+use crate::service;
+use crate::service::config_scheme::event_config;
+use crate::service::naming_scheme::receiver_wake_up_name;
+
+pub(crate) type WakeUpListener<Service> =
+    <<Service as service::Service>::Event as Event<RelocatableCountingBitSet>>::Listener;
+
+/// The wake up channel of a receiving port. It becomes readable as soon as a sending port
+/// delivered data and can be attached to a [`WaitSet`](crate::waitset::WaitSet).
+#[derive(Debug)]
+#[repr(transparent)]
+pub struct WakeUpChannel {
+    file_descriptor: FileDescriptor,
+}
+
+impl WakeUpChannel {
+    pub(crate) fn from_listener<Service: service::Service>(
+        listener: &WakeUpListener<Service>,
+    ) -> &Self
+    where
+        WakeUpListener<Service>: SynchronousMultiplexing,
+    {
+        // SAFETY: WakeUpChannel is a transparent wrapper around the file descriptor and is
+        // only handed out by reference, the file descriptor remains owned by the listener
+        unsafe { &*(listener.file_descriptor() as *const FileDescriptor as *const WakeUpChannel) }
+    }
+}
+
+impl FileDescriptorBased for WakeUpChannel {
+    fn file_descriptor(&self) -> &FileDescriptor {
+        &self.file_descriptor
+    }
+}
+
+impl SynchronousMultiplexing for WakeUpChannel {}
+
+pub(crate) fn create_wake_up_listener<Service: service::Service>(
+    port_id: u128,
+    event_id_max: EventId,
+    config: &Config,
+) -> Result<WakeUpListener<Service>, ListenerCreateError> {
+    <Service::Event as Event<RelocatableCountingBitSet>>::ListenerBuilder::new(
+        &receiver_wake_up_name(port_id),
+    )
+    .config(&event_config::<Service>(config))
+    .event_id_max(event_id_max)
+    .create()
+}
+
+/// Consumes all pending wake ups. Must be called before the receive buffer is checked a last
+/// time, otherwise data that arrives in between would not wake up the next wait.
+pub(crate) fn reset_wake_up<Service: service::Service>(listener: &WakeUpListener<Service>) {
+    drain_wake_up::<Service, _>(listener, |_| {});
+}
+
+/// Resets the wake up channel and calls the callback with every event id that was signaled
+/// since the last reset.
+pub(crate) fn drain_wake_up<Service: service::Service, F: FnMut(usize)>(
+    listener: &WakeUpListener<Service>,
+    mut callback: F,
+) {
+    if let Err(e) = listener.try_wait(|activation| callback(activation.id.as_value())) {
+        warn!(from listener, "Unable to reset the wake up channel ({e:?}).");
+    }
+}
+
+pub(crate) unsafe fn remove_wake_up_channel_of_receiver<Service: service::Service>(
+    port_id: u128,
+    config: &Config,
+) -> Result<(), NamedConceptRemoveError> {
+    unsafe {
+        let origin = format!(
+            "remove_wake_up_channel_of_receiver::<{}>({:?})",
+            core::any::type_name::<Service>(),
+            port_id
+        );
+        let msg = "Unable to remove the wake up channel of the receiver";
+        let wake_up_name = receiver_wake_up_name(port_id);
+        let wake_up_config = event_config::<Service>(config);
+
+        fail!(from origin,
+            when <Service::Event as NamedConceptMgmt>::remove_cfg(&wake_up_name, &wake_up_config),
+            "{} since the underlying concept could not be removed.", msg);
+        Ok(())
+    }
+}
@@ -0,0 +1,201 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! When a [`Listener`](crate::port::listener::Listener) is created with
+//! [`PortFactoryListener::track_wake_up_latency()`](crate::service::port_factory::listener::PortFactoryListener::track_wake_up_latency()),
+//! every [`Notifier`](crate::port::notifier::Notifier) of the service stores the time of the
+//! notification in the dynamic config of the service. Whenever the
+//! [`Listener`](crate::port::listener::Listener) collects notifications, the time that passed
+//! since the latest notification is recorded into a [`WakeUpLatency`] histogram. It contains
+//! the time the operating system required to schedule the waiting thread plus the time
+//! iceoryx2 took to deliver the notification.
+//!
+//! When the [`Listener`](crate::port::listener::Listener) is attached to a
+//! [`WaitSet`](crate::waitset::WaitSet), the latency is recorded when the
+//! [`Listener`](crate::port::listener::Listener) is drained in the callback and therefore
+//! measures the duration from the notification until the callback was called.
+//!
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let event = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//!     .event()
+//!     .open_or_create()?;
+//!
+//! let listener = event.listener_builder().track_wake_up_latency(true).create()?;
+//! let notifier = event.notifier_builder().create()?;
+//!
+//! notifier.notify()?;
+//! listener.try_wait(|_| {})?;
+//!
+//! if let Some(latency) = listener.wake_up_latency() {
+//!     println!("p99 wake up latency: {:?}", latency.percentile(99.0));
+//! }
+//! # Ok(())
+//! # }
+//! ```
+
+use core::time::Duration;
+
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering};
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+
+/// The number of buckets of the [`WakeUpLatency`] histogram. The bucket `n` contains all
+/// latencies in the range `[2^n, 2^(n + 1))` nanoseconds, the first bucket additionally
+/// contains latencies of zero nanoseconds.
+pub const NUMBER_OF_BUCKETS: usize = u64::BITS as usize;
+
+/// Snapshot of the wake up latencies a [`Listener`](crate::port::listener::Listener)
+/// recorded, see the [module documentation](self) for details.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct WakeUpLatency {
+    buckets: [u64; NUMBER_OF_BUCKETS],
+    number_of_samples: u64,
+    min: u64,
+    max: u64,
+    sum: u64,
+}
+
+impl Default for WakeUpLatency {
+    fn default() -> Self {
+        Self {
+            buckets: [0; NUMBER_OF_BUCKETS],
+            number_of_samples: 0,
+            min: 0,
+            max: 0,
+            sum: 0,
+        }
+    }
+}
+
+impl WakeUpLatency {
+    /// Returns the number of recorded wake ups.
+    pub fn number_of_samples(&self) -> u64 {
+        self.number_of_samples
+    }
+
+    /// Returns the smallest recorded latency.
+    pub fn min(&self) -> Duration {
+        Duration::from_nanos(self.min)
+    }
+
+    /// Returns the largest recorded latency.
+    pub fn max(&self) -> Duration {
+        Duration::from_nanos(self.max)
+    }
+
+    /// Returns the arithmetic mean of all recorded latencies.
+    pub fn mean(&self) -> Duration {
+        Duration::from_nanos(self.sum / self.number_of_samples.max(1))
+    }
+
+    /// Returns the upper bound of the bucket in which the given percentile, in the range
+    /// `[0.0, 100.0]`, of all recorded latencies is located. The result never exceeds
+    /// [`WakeUpLatency::max()`].
+    pub fn percentile(&self, percentile: f64) -> Duration {
+        let exact_rank = percentile.clamp(0.0, 100.0) / 100.0 * self.number_of_samples as f64;
+        let mut rank = exact_rank as u64;
+        if (rank as f64) < exact_rank {
+            rank += 1;
+        }
+        let rank = rank.max(1);
+
+        let mut count = 0;
+        for (n, bucket) in self.buckets.iter().enumerate() {
+            count += *bucket;
+            if count >= rank {
+                let upper_bound = 1u64.checked_shl(n as u32 + 1).unwrap_or(u64::MAX) - 1;
+                return Duration::from_nanos(upper_bound.min(self.max));
+            }
+        }
+
+        self.max()
+    }
+
+    /// Returns the number of recorded latencies per bucket, see [`NUMBER_OF_BUCKETS`].
+    pub fn buckets(&self) -> &[u64; NUMBER_OF_BUCKETS] {
+        &self.buckets
+    }
+}
+
+/// Records the wake up latencies of a single port. It is updated with relaxed atomic
+/// operations so that it can be shared between the threads that use the port.
+#[derive(Debug)]
+pub(crate) struct WakeUpLatencyRecorder {
+    buckets: [AtomicU64; NUMBER_OF_BUCKETS],
+    number_of_samples: AtomicU64,
+    min: AtomicU64,
+    max: AtomicU64,
+    sum: AtomicU64,
+}
+
+impl Default for WakeUpLatencyRecorder {
+    fn default() -> Self {
+        Self {
+            buckets: core::array::from_fn(|_| AtomicU64::new(0)),
+            number_of_samples: AtomicU64::new(0),
+            min: AtomicU64::new(u64::MAX),
+            max: AtomicU64::new(0),
+            sum: AtomicU64::new(0),
+        }
+    }
+}
+
+impl WakeUpLatencyRecorder {
+    /// Returns the current time in nanoseconds of the monotonic clock, which is shared by all
+    /// processes of the system, or zero when it could not be acquired.
+    pub(crate) fn timestamp() -> u64 {
+        Time::now_with_clock(ClockType::Monotonic)
+            .map(|t| t.as_duration().as_nanos() as u64)
+            .unwrap_or(0)
+    }
+
+    /// Records the time that passed since `notification_timestamp`, which was acquired with
+    /// [`WakeUpLatencyRecorder::timestamp()`]. Nothing is recorded when no notification was
+    /// stamped yet.
+    pub(crate) fn record_since(&self, notification_timestamp: u64) {
+        if notification_timestamp == 0 {
+            return;
+        }
+
+        self.record(Self::timestamp().saturating_sub(notification_timestamp));
+    }
+
+    fn record(&self, latency: u64) {
+        let bucket = (u64::BITS - 1).saturating_sub(latency.leading_zeros()) as usize;
+
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+        self.number_of_samples.fetch_add(1, Ordering::Relaxed);
+        self.min.fetch_min(latency, Ordering::Relaxed);
+        self.max.fetch_max(latency, Ordering::Relaxed);
+        self.sum.fetch_add(latency, Ordering::Relaxed);
+    }
+
+    pub(crate) fn load(&self) -> WakeUpLatency {
+        let number_of_samples = self.number_of_samples.load(Ordering::Relaxed);
+        WakeUpLatency {
+            buckets: core::array::from_fn(|n| self.buckets[n].load(Ordering::Relaxed)),
+            number_of_samples,
+            min: if number_of_samples == 0 {
+                0
+            } else {
+                self.min.load(Ordering::Relaxed)
+            },
+            max: self.max.load(Ordering::Relaxed),
+            sum: self.sum.load(Ordering::Relaxed),
+        }
+    }
+}
@@ -42,10 +42,12 @@
 
 use crate::constants::MAX_BLACKBOARD_KEY_SIZE;
 use crate::identifiers::UniqueWriterId;
+use crate::port::details::blackboard_history::{History, NO_HISTORY};
+use crate::port::notifier::Notifier;
 use crate::port::port_name::PortName;
 use crate::prelude::EventId;
 use crate::service::builder::CustomKeyMarker;
-use crate::service::builder::blackboard::{BlackboardResources, KeyMemory};
+use crate::service::builder::blackboard::{BlackboardResources, KeyMemory, UNHASHED_KEY, key_hash};
 use crate::service::dynamic_config::blackboard::WriterDetails;
 use crate::service::port_factory::writer::WriterConfig;
 use crate::service::static_config::message_type_details::{TypeDetail, TypeVariant};
@@ -69,7 +71,7 @@ use iceoryx2_bb_lock_free::spmc::unrestricted_atomic::{
 use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
 use iceoryx2_cal::dynamic_storage::DynamicStorage;
 use iceoryx2_cal::shared_memory::SharedMemory;
-use iceoryx2_log::{fail, fatal_panic};
+use iceoryx2_log::{fail, fatal_panic, warn};
 
 #[derive(Debug)]
 struct WriterSharedState<
@@ -78,9 +80,25 @@ struct WriterSharedState<
 > {
     service_state: SharedServiceState<Service, BlackboardResources<Service>>,
     dynamic_writer_handle: UnsafeCell<Option<ContainerHandle>>,
+    update_notifier: Option<Notifier<Service>>,
     _key: PhantomData<KeyType>,
 }
 
+impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
+> WriterSharedState<Service, KeyType>
+{
+    fn notify_update(&self, entry_id: EventId) {
+        if let Some(notifier) = &self.update_notifier {
+            if let Err(e) = notifier.notify_with_custom_event_id(entry_id) {
+                warn!(from self,
+                    "Unable to notify the update of the entry with the id {entry_id:?} ({e:?}).");
+            }
+        }
+    }
+}
+
 impl<
     Service: service::Service,
     KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
@@ -186,6 +204,7 @@ impl<
     pub(crate) fn new(
         service: SharedServiceState<Service, BlackboardResources<Service>>,
         config: WriterConfig,
+        update_notifier: Option<Notifier<Service>>,
     ) -> Result<Self, WriterCreateError> {
         let origin = "Writer::new()";
         let msg = "Unable to create Writer port";
@@ -206,6 +225,7 @@ impl<
         let shared_state = Service::ArcThreadSafetyPolicy::new(WriterSharedState {
             service_state: service.clone(),
             dynamic_writer_handle: UnsafeCell::new(None),
+            update_notifier,
             _key: PhantomData,
         });
 
@@ -288,13 +308,14 @@ impl<
             }
         };
 
-        let offset = self.get_entry_offset(
+        let (offset, history_offset) = self.get_entry_offset(
             &key_mem,
+            key_hash(key),
             &TypeDetail::new::<ValueType>(TypeVariant::FixedSize),
             msg,
         )?;
 
-        match EntryHandleMut::new(self.shared_state.clone(), offset) {
+        match EntryHandleMut::new(self.shared_state.clone(), offset, history_offset) {
             Ok(handle) => Ok(handle),
             Err(e) => {
                 fail!(from self, with e,
@@ -303,30 +324,61 @@ impl<
         }
     }
 
+    /// Starts a [`Transaction`] that groups the updates of multiple [`EntryHandleMut`]s. A
+    /// [`Reader`](crate::port::reader::Reader) that reads the entries within
+    /// [`Reader::snapshot()`](crate::port::reader::Reader::snapshot()) observes either all or
+    /// none of the updates.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// # use iceoryx2::prelude::*;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .blackboard_creator::<u64>()
+    /// #     .add::<f32>(1, 0.0)
+    /// #     .add::<f32>(2, 0.0)
+    /// #     .create()?;
+    /// #
+    /// # let mut writer = service.writer_builder().create()?;
+    /// let x = writer.entry::<f32>(&1)?;
+    /// let y = writer.entry::<f32>(&2)?;
+    ///
+    /// let transaction = writer.transaction();
+    /// transaction.update_with_copy(&x, 1.5);
+    /// transaction.update_with_copy(&y, -2.5);
+    /// transaction.commit();
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn transaction(&mut self) -> Transaction<'_, Service, KeyType> {
+        Transaction::new(self)
+    }
+
     fn get_entry_offset(
         &self,
         key_mem: &KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+        key_hash: u64,
         value_type_details: &TypeDetail,
         msg: &str,
-    ) -> Result<u64, EntryHandleMutError> {
+    ) -> Result<(u64, u64), EntryHandleMutError> {
         // check if key exists
         let shared_state = self.shared_state.lock();
-        let index = match unsafe {
-            shared_state
-                .service_state
-                .additional_resource()
-                .mgmt
-                .get()
-                .map
-                .__internal_get(
-                    key_mem,
-                    shared_state
-                        .service_state
-                        .additional_resource()
-                        .key_eq_func
-                        .as_ref(),
-                )
-        } {
+        let index = match shared_state
+            .service_state
+            .additional_resource()
+            .mgmt
+            .get()
+            .find_entry(
+                key_mem,
+                key_hash,
+                shared_state
+                    .service_state
+                    .additional_resource()
+                    .key_eq_func
+                    .as_ref(),
+            ) {
             Some(i) => i,
             None => {
                 fail!(from self, with EntryHandleMutError::EntryDoesNotExist,
@@ -349,10 +401,93 @@ impl<
 
         let offset = entry.offset.load(core::sync::atomic::Ordering::Relaxed);
 
-        Ok(offset)
+        Ok((offset, entry.history_offset))
+    }
+}
+
+/// Groups the updates of multiple [`EntryHandleMut`]s, created with [`Writer::transaction()`].
+/// The updates become visible as one to
+/// [`Reader::snapshot()`](crate::port::reader::Reader::snapshot()) when the [`Transaction`] is
+/// committed or dropped. Readers that access an entry outside of a snapshot observe every update
+/// immediately.
+///
+/// A snapshot waits until the transaction is finished, therefore, it shall contain only the
+/// updates and no other work.
+pub struct Transaction<
+    'writer,
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Copy + Debug + 'static + Hash + ZeroCopySend,
+> {
+    writer: &'writer mut Writer<Service, KeyType>,
+}
+
+impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Copy + Debug + 'static + Hash + ZeroCopySend,
+> Debug for Transaction<'_, Service, KeyType>
+{
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "Transaction<{}, {}> {{ writer: {:?} }}",
+            core::any::type_name::<Service>(),
+            core::any::type_name::<KeyType>(),
+            self.writer.id()
+        )
+    }
+}
+
+impl<
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Copy + Debug + 'static + Hash + ZeroCopySend,
+> Drop for Transaction<'_, Service, KeyType>
+{
+    fn drop(&mut self) {
+        self.writer
+            .shared_state
+            .lock()
+            .service_state
+            .additional_resource()
+            .mgmt
+            .get()
+            .end_transaction();
     }
 }
 
+impl<
+    'writer,
+    Service: service::Service,
+    KeyType: Send + Sync + Eq + Clone + Copy + Debug + 'static + Hash + ZeroCopySend,
+> Transaction<'writer, Service, KeyType>
+{
+    fn new(writer: &'writer mut Writer<Service, KeyType>) -> Self {
+        writer
+            .shared_state
+            .lock()
+            .service_state
+            .additional_resource()
+            .mgmt
+            .get()
+            .begin_transaction();
+
+        Self { writer }
+    }
+
+    /// Updates the entry of the passed [`EntryHandleMut`] as part of the [`Transaction`]. The
+    /// [`EntryHandleMut`] must be created by the same [`Writer`].
+    pub fn update_with_copy<ValueType: Copy + 'static>(
+        &self,
+        entry_handle_mut: &EntryHandleMut<Service, KeyType, ValueType>,
+        value: ValueType,
+    ) {
+        entry_handle_mut.update_with_copy(value);
+    }
+
+    /// Finishes the [`Transaction`] and makes all updates visible to
+    /// [`Reader::snapshot()`](crate::port::reader::Reader::snapshot()).
+    pub fn commit(self) {}
+}
+
 /// Defines a failure that can occur when a [`EntryHandleMut`] is created with [`Writer::entry()`].
 #[derive(Debug, PartialEq, Eq, Clone, Copy)]
 pub enum EntryHandleMutError {
@@ -377,12 +512,15 @@ pub struct EntryHandleMut<
     ValueType: Copy + 'static,
 > {
     producer: Producer<'static, ValueType>,
+    history: *const History<ValueType>,
     entry_id: EventId,
-    _shared_state: Service::ArcThreadSafetyPolicy<WriterSharedState<Service, KeyType>>,
+    notify_on_update: bool,
+    shared_state: Service::ArcThreadSafetyPolicy<WriterSharedState<Service, KeyType>>,
 }
 
-// Safe since the producer implements Send + Sync and shared_state ensures the lifetime of the
-// producer (struct fields are dropped in the same order as declared)
+// Safe since the producer implements Send + Sync, the history is only written by this handle and
+// shared_state ensures the lifetime of the producer and the history (struct fields are dropped in
+// the same order as declared)
 unsafe impl<
     Service: service::Service,
     KeyType: Send + Sync + Eq + Clone + Debug + 'static + Hash + ZeroCopySend,
@@ -407,14 +545,19 @@ impl<
     fn new(
         writer_state: Service::ArcThreadSafetyPolicy<WriterSharedState<Service, KeyType>>,
         offset: u64,
+        history_offset: u64,
     ) -> Result<Self, EntryHandleMutError> {
-        let atomic = (writer_state
+        let payload_start_address = writer_state
             .lock()
             .service_state
             .additional_resource()
             .data
-            .payload_start_address() as u64
-            + offset) as *mut UnrestrictedAtomic<ValueType>;
+            .payload_start_address() as u64;
+        let atomic = (payload_start_address + offset) as *mut UnrestrictedAtomic<ValueType>;
+        let history = match history_offset {
+            NO_HISTORY => core::ptr::null(),
+            _ => (payload_start_address + history_offset) as *const History<ValueType>,
+        };
         match unsafe { (*atomic).acquire_producer() } {
             None => Err(EntryHandleMutError::HandleAlreadyExists),
             Some(producer) => {
@@ -424,7 +567,9 @@ impl<
                 let p: Producer<'static, ValueType> = unsafe { core::mem::transmute(producer) };
                 Ok(Self {
                     producer: p,
-                    _shared_state: writer_state.clone(),
+                    history,
+                    notify_on_update: writer_state.lock().update_notifier.is_some(),
+                    shared_state: writer_state.clone(),
                     entry_id: EventId::new(offset as _),
                 })
             }
@@ -452,6 +597,20 @@ impl<
     /// ```
     pub fn update_with_copy(&self, value: ValueType) {
         self.producer.store(value);
+        self.record_history(value);
+        self.notify_update();
+    }
+
+    fn record_history(&self, value: ValueType) {
+        if !self.history.is_null() {
+            unsafe { (*self.history).push(value) };
+        }
+    }
+
+    fn notify_update(&self) {
+        if self.notify_on_update {
+            self.shared_state.lock().notify_update(self.entry_id);
+        }
     }
 
     /// Consumes the [`EntryHandleMut`] and loans an uninitialized entry value that can be used to update without copy.
@@ -556,6 +715,8 @@ impl<
                 .producer
                 .__internal_update_write_cell()
         };
+        self.entry_handle_mut.record_history(value);
+        self.entry_handle_mut.notify_update();
         self.entry_handle_mut
     }
 
@@ -642,11 +803,14 @@ impl<
     /// # }
     /// ```
     pub unsafe fn assume_init_and_update(self) -> EntryHandleMut<Service, KeyType, ValueType> {
+        let value = unsafe { self.ptr.read() };
         unsafe {
             self.entry_handle_mut
                 .producer
                 .__internal_update_write_cell();
         }
+        self.entry_handle_mut.record_history(value);
+        self.entry_handle_mut.notify_update();
         self.entry_handle_mut
     }
 }
@@ -683,7 +847,7 @@ impl<Service: service::Service> Writer<Service, CustomKeyMarker> {
             }
         };
 
-        let offset = self.get_entry_offset(&key_mem, value_type_details, msg)?;
+        let (offset, _) = self.get_entry_offset(&key_mem, UNHASHED_KEY, value_type_details, msg)?;
 
         let atomic_mgmt_ptr = (shared_state
             .service_state
@@ -717,7 +881,8 @@ pub struct __InternalEntryHandleMut<Service: service::Service> {
     atomic_mgmt_ptr: *const UnrestrictedAtomicMgmt,
     data_ptr: *mut u8,
     entry_id: EventId,
-    _shared_state: Service::ArcThreadSafetyPolicy<WriterSharedState<Service, CustomKeyMarker>>,
+    notify_on_update: bool,
+    shared_state: Service::ArcThreadSafetyPolicy<WriterSharedState<Service, CustomKeyMarker>>,
 }
 
 impl<Service: service::Service> Drop for __InternalEntryHandleMut<Service> {
@@ -744,7 +909,8 @@ impl<Service: service::Service> __InternalEntryHandleMut<Service> {
                 atomic_mgmt_ptr,
                 data_ptr,
                 entry_id,
-                _shared_state: writer_state.clone(),
+                notify_on_update: writer_state.lock().update_notifier.is_some(),
+                shared_state: writer_state.clone(),
             }),
             Err(_) => Err(EntryHandleMutError::HandleAlreadyExists),
         }
@@ -795,6 +961,13 @@ impl<Service: service::Service> __InternalEntryHandleMut<Service> {
     ///   __internal_get_ptr_to_write_cell
     pub unsafe fn __internal_update_write_cell(&self) {
         unsafe { (*self.atomic_mgmt_ptr).__internal_update_write_cell() };
+        self.notify_update();
+    }
+
+    fn notify_update(&self) {
+        if self.notify_on_update {
+            self.shared_state.lock().notify_update(self.entry_id);
+        }
     }
 }
 
@@ -843,6 +1016,7 @@ impl<Service: service::Service> __InternalEntryValueUninit<Service> {
         unsafe {
             (*self.entry_handle_mut.atomic_mgmt_ptr).__internal_update_write_cell();
         }
+        self.entry_handle_mut.notify_update();
         self.entry_handle_mut
     }
 
@@ -13,8 +13,8 @@
 pub use crate::config::Config;
 pub use crate::node::{Node, NodeBuilder, NodeState, node_name::NodeName};
 pub use crate::port::{
-    EventActivation, backpressure_strategy::BackpressureStrategy, event_id::EventId,
-    port_name::PortName,
+    EventActivation, backpressure_strategy::BackpressureStrategy, copy_strategy::CopyStrategy,
+    delivery_mode::DeliveryMode, event_id::EventId, port_name::PortName,
 };
 pub use crate::service::messaging_pattern::MessagingPattern;
 pub use crate::service::{
@@ -37,6 +37,9 @@ pub use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
 pub use iceoryx2_bb_posix::process::ProcessId;
 pub use iceoryx2_bb_print::{cerr, cerrln, cout, coutln};
 pub use iceoryx2_bb_system_types::{file_name::FileName, file_path::FilePath, path::Path};
+pub use iceoryx2_cal::reactor::ReactorBackend;
+pub use iceoryx2_cal::resizable_shared_memory::{SegmentStatistics, ShrinkPolicy};
+pub use iceoryx2_cal::shared_memory::{NumaPolicy, PageSize};
 pub use iceoryx2_cal::shm_allocator::AllocationStrategy;
 pub use iceoryx2_log::LogLevel;
 pub use iceoryx2_log::set_log_level;
@@ -51,6 +51,7 @@ use crate::{
     pending_response::PendingResponse,
     port::client::{ClientSharedState, RequestSendError},
     raw_sample::RawSampleMut,
+    response_gather::{GatherCondition, ResponseGather},
     service,
 };
 
@@ -256,4 +257,51 @@ impl<
             Err(e) => Err(e),
         }
     }
+
+    /// Sends the [`RequestMut`] to all connected
+    /// [`Server`](crate::port::server::Server)s of the
+    /// [`Service`](crate::service::Service) and returns a [`ResponseGather`] that aggregates
+    /// their [`Response`](crate::response::Response)s per
+    /// [`UniqueServerId`](crate::identifiers::UniqueServerId) until the [`GatherCondition`] is
+    /// satisfied. The request is not copied, all [`Server`](crate::port::server::Server)s share
+    /// the same chunk.
+    pub fn send_to_all(
+        self,
+        condition: GatherCondition,
+    ) -> Result<
+        ResponseGather<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+        RequestSendError,
+    > {
+        Ok(ResponseGather::new(self.send()?, condition))
+    }
+
+    /// Sends the [`RequestMut`] to all connected
+    /// [`Server`](crate::port::server::Server)s of the
+    /// [`Service`](crate::service::Service) without expecting a
+    /// [`Response`](crate::response::Response). In contrast to [`RequestMut::send()`], no
+    /// [`PendingResponse`] is created and the request does not count towards the active requests
+    /// of the [`Client`](crate::port::client::Client), so the number of requests in flight is
+    /// only limited by the buffers of the [`Server`](crate::port::server::Server)s. Returns the
+    /// number of [`Server`](crate::port::server::Server)s that received the request.
+    ///
+    /// The [`Service`](crate::service::Service) must be created with
+    /// [`enable_fire_and_forget_requests()`](crate::service::builder::request_response::Builder::enable_fire_and_forget_requests()),
+    /// otherwise [`RequestSendError::FireAndForgetNotSupported`] is returned.
+    pub fn send_and_forget(self) -> Result<usize, RequestSendError> {
+        let client_shared_state = self.client_shared_state.lock();
+        let number_of_server_connections =
+            client_shared_state.send_request_and_forget(self.offset_to_chunk, self.sample_size)?;
+
+        self.was_sample_sent.store(true, Ordering::Relaxed);
+        client_shared_state
+            .request_sender
+            .loan_counter
+            .fetch_sub(1, Ordering::Relaxed);
+        drop(client_shared_state);
+
+        // Returns the response channel and the client's reference to the chunk right away. The
+        // servers hold their own references until they release the request.
+        drop(self);
+        Ok(number_of_server_connections)
+    }
 }
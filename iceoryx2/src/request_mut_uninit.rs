@@ -38,9 +38,12 @@
 //! ```
 
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_log::warn;
 
+use crate::service::header::request_response::NO_DEADLINE;
 use crate::{port::client::ClientSharedState, request_mut::RequestMut, service};
-use core::{fmt::Debug, mem::MaybeUninit};
+use core::{fmt::Debug, mem::MaybeUninit, time::Duration};
 
 /// A version of the [`RequestMut`] where the payload is not initialized which allows
 /// true zero copy usage. To send a [`RequestMutUninit`] it must be first initialized
@@ -116,6 +119,48 @@ impl<
     pub fn payload_mut(&mut self) -> &mut RequestPayload {
         self.request.payload_mut()
     }
+
+    /// Sets the deadline of the request to `timeout` from now. A
+    /// [`Server`](crate::port::server::Server) with deadline scheduling enabled, see
+    /// [`PortFactoryServer::enable_deadline_scheduling()`](crate::service::port_factory::server::PortFactoryServer::enable_deadline_scheduling()),
+    /// hands out requests in earliest-deadline-first order and rejects the request when its
+    /// deadline has passed.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use core::time::Duration;
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node
+    /// #   .service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #   .request_response::<u64, u64>()
+    /// #   .open_or_create()?;
+    /// #
+    /// # let client = service.client_builder().create()?;
+    /// let mut request = client.loan_uninit()?;
+    /// request.set_deadline(Duration::from_millis(10));
+    ///
+    /// let pending_response = request.write_payload(55712).send()?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn set_deadline(&mut self, timeout: Duration) {
+        match Time::now_with_clock(ClockType::Monotonic) {
+            Ok(now) => {
+                let deadline = now.as_duration().saturating_add(timeout).as_nanos();
+                self.request.ptr.as_header_mut().deadline =
+                    deadline.min((NO_DEADLINE - 1) as u128) as u64;
+            }
+            Err(e) => {
+                warn!(from self,
+                    "The request is sent without a deadline since the current time could not be acquired ({:?}).", e);
+            }
+        }
+    }
 }
 
 impl<
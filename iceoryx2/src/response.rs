@@ -131,6 +131,15 @@ impl<
     ResponseHeader: Debug + ZeroCopySend,
 > Response<Service, ResponsePayload, ResponseHeader>
 {
+    /// Returns true when the [`Server`](crate::port::server::Server) that sent the
+    /// [`Response`] is still connected to the [`Client`](crate::port::client::Client).
+    pub(crate) fn is_origin_connected(&self) -> bool {
+        self.client_shared_state
+            .lock()
+            .response_receiver
+            .is_origin_connected(&self.details)
+    }
+
     /// Returns a reference to the
     /// [`ResponseHeader`](service::header::request_response::ResponseHeader).
     pub fn header(&self) -> &service::header::request_response::ResponseHeader {
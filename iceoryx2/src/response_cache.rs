@@ -0,0 +1,245 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use core::time::Duration;
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::response_cache::{CachedResponse, ResponseCache};
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! #
+//! let service = node
+//!    .service_builder(&"My/Funk/ServiceName".try_into()?)
+//!    .request_response::<u64, u64>()
+//!    .open_or_create()?;
+//!
+//! let client = service.client_builder().create()?;
+//! let mut cache = ResponseCache::new(4, Duration::from_secs(10));
+//!
+//! match cache.send_copy(&client, 123)? {
+//!     CachedResponse::Hit(response) => println!("cached response: {}", *response),
+//!     CachedResponse::Pending(pending_response) => {
+//!         if let Some(response) = pending_response.receive()? {
+//!             let response = cache.insert(123, response);
+//!             println!("received response: {}", *response);
+//!         }
+//!     }
+//! }
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::sync::Arc;
+use alloc::vec::Vec;
+use core::fmt::Debug;
+use core::time::Duration;
+
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_log::warn;
+
+use crate::pending_response::PendingResponse;
+use crate::port::client::{Client, RequestSendError};
+use crate::port::update_connections::UpdateConnections;
+use crate::response::Response;
+use crate::service;
+
+/// The result of [`ResponseCache::send_copy()`].
+#[derive(Debug)]
+pub enum CachedResponse<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> {
+    /// A valid [`Response`] to an identical request was cached, no request was sent.
+    Hit(Arc<Response<Service, ResponsePayload, ResponseHeader>>),
+    /// No valid [`Response`] was cached and the request was sent. The received [`Response`]
+    /// can be added with [`ResponseCache::insert()`].
+    Pending(
+        PendingResponse<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+    ),
+}
+
+#[derive(Debug)]
+struct CacheEntry<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> {
+    request: RequestPayload,
+    response: Arc<Response<Service, ResponsePayload, ResponseHeader>>,
+    insertion_time: Time,
+}
+
+/// A bounded cache of [`Response`]s for idempotent services, keyed by the payload of the
+/// request. The [`Response`]s are not copied, the cache holds the received [`Response`]s and
+/// therefore their chunks in the data segment of the [`Server`](crate::port::server::Server).
+/// A cached [`Response`] is valid until its time to live has expired or the
+/// [`Server`](crate::port::server::Server) that sent it is no longer connected, for instance
+/// since it was restarted.
+///
+/// # Important
+///
+/// Every cached [`Response`] stays borrowed by the [`Client`] until it is evicted. The capacity
+/// must not exceed the number of [`Response`]s the [`Client`] can borrow, see
+/// [`crate::service::builder::request_response::Builder::max_borrowed_responses_per_pending_response()`],
+/// otherwise the [`Server`](crate::port::server::Server) may run out of memory to loan new
+/// responses.
+#[derive(Debug)]
+pub struct ResponseCache<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> {
+    entries: Vec<CacheEntry<Service, RequestPayload, ResponsePayload, ResponseHeader>>,
+    capacity: usize,
+    time_to_live: Duration,
+}
+
+impl<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + PartialEq,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> ResponseCache<Service, RequestPayload, ResponsePayload, ResponseHeader>
+{
+    /// Creates a new [`ResponseCache`] that holds at most `capacity` [`Response`]s, each for
+    /// at most `time_to_live`. A capacity of `0` is adjusted to `1`.
+    pub fn new(capacity: usize, time_to_live: Duration) -> Self {
+        Self {
+            entries: Vec::with_capacity(capacity.max(1)),
+            capacity: capacity.max(1),
+            time_to_live,
+        }
+    }
+
+    /// Returns the maximum number of [`Response`]s the [`ResponseCache`] can hold.
+    pub fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    /// Returns the number of cached [`Response`]s, including the ones that are no longer valid
+    /// but were not yet evicted.
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Returns true when no [`Response`] is cached.
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Returns the cached [`Response`] to the request with the provided payload if it is still
+    /// valid, otherwise it is evicted and [`None`] is returned.
+    pub fn get(
+        &mut self,
+        request: &RequestPayload,
+    ) -> Option<Arc<Response<Service, ResponsePayload, ResponseHeader>>> {
+        let idx = self.entries.iter().position(|e| e.request == *request)?;
+        let entry = &self.entries[idx];
+
+        if self.is_valid(entry) {
+            Some(entry.response.clone())
+        } else {
+            self.entries.remove(idx);
+            None
+        }
+    }
+
+    /// Adds the [`Response`] to the request with the provided payload and returns a shared
+    /// handle to it. A previously cached [`Response`] to the same request is replaced. When
+    /// the [`ResponseCache`] is full, the oldest [`Response`] is evicted.
+    pub fn insert(
+        &mut self,
+        request: RequestPayload,
+        response: Response<Service, ResponsePayload, ResponseHeader>,
+    ) -> Arc<Response<Service, ResponsePayload, ResponseHeader>> {
+        let response = Arc::new(response);
+        let insertion_time = match Time::now_with_clock(ClockType::Monotonic) {
+            Ok(now) => now,
+            Err(e) => {
+                warn!(from self, "The response is not cached since the current time could not be acquired ({:?}).", e);
+                return response;
+            }
+        };
+
+        self.entries.retain(|e| e.request != request);
+        if self.entries.len() == self.capacity {
+            self.entries.remove(0);
+        }
+
+        self.entries.push(CacheEntry {
+            request,
+            response: response.clone(),
+            insertion_time,
+        });
+
+        response
+    }
+
+    /// Removes the cached [`Response`] to the request with the provided payload.
+    pub fn invalidate(&mut self, request: &RequestPayload) {
+        self.entries.retain(|e| e.request != *request);
+    }
+
+    /// Removes all cached [`Response`]s.
+    pub fn clear(&mut self) {
+        self.entries.clear();
+    }
+
+    /// Removes all [`Response`]s that are no longer valid.
+    pub fn evict_expired(&mut self) {
+        let mut entries = core::mem::take(&mut self.entries);
+        entries.retain(|e| self.is_valid(e));
+        self.entries = entries;
+    }
+
+    fn is_valid(
+        &self,
+        entry: &CacheEntry<Service, RequestPayload, ResponsePayload, ResponseHeader>,
+    ) -> bool {
+        let is_alive = match entry.insertion_time.elapsed() {
+            Ok(elapsed) => elapsed < self.time_to_live,
+            Err(_) => false,
+        };
+
+        is_alive && entry.response.is_origin_connected()
+    }
+
+    /// Returns the cached [`Response`] to an identical request if it is still valid. Otherwise,
+    /// the request is sent with [`Client::send_copy()`] and the [`PendingResponse`] is
+    /// returned.
+    #[allow(clippy::type_complexity)] // type alias would require 5 generic parameters which hardly reduces complexity
+    pub fn send_copy<RequestHeader: Default + Debug + ZeroCopySend>(
+        &mut self,
+        client: &Client<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+        value: RequestPayload,
+    ) -> Result<
+        CachedResponse<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+        RequestSendError,
+    > {
+        // connect to new servers and detect the removed ones before the validity is checked
+        client.update_connections()?;
+
+        match self.get(&value) {
+            Some(response) => Ok(CachedResponse::Hit(response)),
+            None => Ok(CachedResponse::Pending(client.send_copy(value)?)),
+        }
+    }
+}
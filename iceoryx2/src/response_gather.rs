@@ -0,0 +1,273 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use core::time::Duration;
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::response_gather::GatherCondition;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! #
+//! let service = node
+//!    .service_builder(&"My/Funk/ServiceName".try_into()?)
+//!    .request_response::<u64, u64>()
+//!    .open_or_create()?;
+//!
+//! let client = service.client_builder().create()?;
+//!
+//! // the request is stored once and shared by all servers
+//! let mut gather = client.send_to_all(123, GatherCondition::Timeout(Duration::from_millis(10)))?;
+//!
+//! while !gather.is_complete() {
+//!     if let Some(response) = gather.receive()? {
+//!         println!("server {} responded with {}", response.origin(), *response);
+//!     }
+//! }
+//!
+//! println!("{} of {} servers responded",
+//!     gather.number_of_responding_servers(),
+//!     gather.pending_response().number_of_server_connections());
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::vec::Vec;
+use core::fmt::Debug;
+use core::time::Duration;
+
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::{ClockType, Time};
+use iceoryx2_log::warn;
+
+use crate::identifiers::UniqueServerId;
+use crate::pending_response::PendingResponse;
+use crate::port::ReceiveError;
+use crate::response::Response;
+use crate::service;
+
+/// Defines when a [`ResponseGather`] has collected all [`Response`]s it waits for.
+/// Independent of the condition, the [`ResponseGather`] is complete as soon as all
+/// [`Server`](crate::port::server::Server)s disconnected and no [`Response`] is left.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum GatherCondition {
+    /// Every [`Server`](crate::port::server::Server) that received the request has sent at
+    /// least one [`Response`].
+    AllServers,
+    /// The provided number of distinct [`Server`](crate::port::server::Server)s has sent at
+    /// least one [`Response`]. It is limited to the number of
+    /// [`Server`](crate::port::server::Server)s that received the request.
+    FirstServers(usize),
+    /// The provided duration has passed since the request was sent.
+    Timeout(Duration),
+}
+
+/// Sends one request to all connected [`Server`](crate::port::server::Server)s and aggregates
+/// their [`Response`]s per [`UniqueServerId`]. The request is stored once in the data segment
+/// of the [`Client`](crate::port::client::Client) and every
+/// [`Server`](crate::port::server::Server) holds a reference to it. Is created with
+/// [`Client::send_to_all()`](crate::port::client::Client::send_to_all()) or
+/// [`RequestMut::send_to_all()`](crate::request_mut::RequestMut::send_to_all()).
+pub struct ResponseGather<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> {
+    pending_response:
+        PendingResponse<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>,
+    condition: GatherCondition,
+    send_time: Option<Time>,
+    responses_per_server: Vec<(UniqueServerId, usize)>,
+}
+
+impl<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> Debug
+    for ResponseGather<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+{
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "ResponseGather<{}, {}, {}, {}, {}> {{ condition: {:?}, responses_per_server: {:?} }}",
+            core::any::type_name::<Service>(),
+            core::any::type_name::<RequestPayload>(),
+            core::any::type_name::<RequestHeader>(),
+            core::any::type_name::<ResponsePayload>(),
+            core::any::type_name::<ResponseHeader>(),
+            self.condition,
+            self.responses_per_server
+        )
+    }
+}
+
+impl<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + ?Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> ResponseGather<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+{
+    pub(crate) fn new(
+        pending_response: PendingResponse<
+            Service,
+            RequestPayload,
+            RequestHeader,
+            ResponsePayload,
+            ResponseHeader,
+        >,
+        condition: GatherCondition,
+    ) -> Self {
+        let send_time = match Time::now_with_clock(ClockType::Monotonic) {
+            Ok(now) => Some(now),
+            Err(e) => {
+                if let GatherCondition::Timeout(_) = condition {
+                    warn!(from "ResponseGather::new()",
+                        "The gather timeout is treated as passed since the current time could not be acquired ({:?}).", e);
+                }
+                None
+            }
+        };
+
+        Self {
+            responses_per_server: Vec::with_capacity(
+                pending_response.number_of_server_connections(),
+            ),
+            pending_response,
+            condition,
+            send_time,
+        }
+    }
+
+    /// Returns the underlying [`PendingResponse`] of the request.
+    pub fn pending_response(
+        &self,
+    ) -> &PendingResponse<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+    {
+        &self.pending_response
+    }
+
+    /// Returns the [`GatherCondition`] of the [`ResponseGather`].
+    pub fn condition(&self) -> GatherCondition {
+        self.condition
+    }
+
+    /// Returns the number of distinct [`Server`](crate::port::server::Server)s that have sent
+    /// at least one [`Response`].
+    pub fn number_of_responding_servers(&self) -> usize {
+        self.responses_per_server.len()
+    }
+
+    /// Returns the number of [`Response`]s that were received from the
+    /// [`Server`](crate::port::server::Server) with the provided [`UniqueServerId`].
+    pub fn number_of_responses_from(&self, server_id: &UniqueServerId) -> usize {
+        self.responses_per_server
+            .iter()
+            .find(|(id, _)| id == server_id)
+            .map(|(_, n)| *n)
+            .unwrap_or(0)
+    }
+
+    /// Calls the callback with the [`UniqueServerId`] and the number of received [`Response`]s
+    /// of every [`Server`](crate::port::server::Server) that has responded, in the order of
+    /// their first [`Response`].
+    pub fn responding_servers<F: FnMut(&UniqueServerId, usize)>(&self, mut callback: F) {
+        for (id, n) in &self.responses_per_server {
+            callback(id, *n);
+        }
+    }
+
+    /// Returns [`true`] when the [`GatherCondition`] is satisfied or when no further
+    /// [`Response`] can arrive since all [`Server`](crate::port::server::Server)s disconnected.
+    pub fn is_complete(&self) -> bool {
+        let number_of_servers = self.pending_response.number_of_server_connections();
+        let is_satisfied = match self.condition {
+            GatherCondition::AllServers => self.responses_per_server.len() >= number_of_servers,
+            GatherCondition::FirstServers(n) => {
+                self.responses_per_server.len() >= n.min(number_of_servers)
+            }
+            GatherCondition::Timeout(timeout) => match &self.send_time {
+                Some(send_time) => match send_time.elapsed() {
+                    Ok(elapsed) => elapsed >= timeout,
+                    Err(_) => true,
+                },
+                None => true,
+            },
+        };
+
+        is_satisfied
+            || (!self.pending_response.is_connected() && !self.pending_response.has_response())
+    }
+
+    fn record(&mut self, server_id: UniqueServerId) {
+        match self
+            .responses_per_server
+            .iter_mut()
+            .find(|(id, _)| *id == server_id)
+        {
+            Some((_, n)) => *n += 1,
+            None => self.responses_per_server.push((server_id, 1)),
+        }
+    }
+}
+
+impl<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend + Sized,
+    ResponseHeader: Debug + ZeroCopySend,
+> ResponseGather<Service, RequestPayload, RequestHeader, ResponsePayload, ResponseHeader>
+{
+    /// Receives a [`Response`] from one of the [`Server`](crate::port::server::Server)s and
+    /// accounts it to its [`UniqueServerId`]. See [`PendingResponse::receive()`].
+    pub fn receive(
+        &mut self,
+    ) -> Result<Option<Response<Service, ResponsePayload, ResponseHeader>>, ReceiveError> {
+        let response = self.pending_response.receive()?;
+        if let Some(response) = &response {
+            self.record(response.origin());
+        }
+
+        Ok(response)
+    }
+}
+
+impl<
+    Service: service::Service,
+    RequestPayload: Debug + ZeroCopySend + ?Sized,
+    RequestHeader: Debug + ZeroCopySend,
+    ResponsePayload: Debug + ZeroCopySend,
+    ResponseHeader: Debug + ZeroCopySend,
+> ResponseGather<Service, RequestPayload, RequestHeader, [ResponsePayload], ResponseHeader>
+{
+    /// Receives a [`Response`] from one of the [`Server`](crate::port::server::Server)s and
+    /// accounts it to its [`UniqueServerId`]. See [`PendingResponse::receive()`].
+    pub fn receive(
+        &mut self,
+    ) -> Result<Option<Response<Service, [ResponsePayload], ResponseHeader>>, ReceiveError> {
+        let response = self.pending_response.receive()?;
+        if let Some(response) = &response {
+            self.record(response.origin());
+        }
+
+        Ok(response)
+    }
+}
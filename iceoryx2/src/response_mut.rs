@@ -57,6 +57,7 @@ use iceoryx2_log::fail;
 use crate::{
     port::{
         SendError,
+        details::request_coalescing::RequestKey,
         server::{INVALID_CONNECTION_ID, SharedServerState},
     },
     raw_sample::RawSampleMut,
@@ -330,7 +331,7 @@ impl<
     /// # Ok(())
     /// # }
     /// ```
-    pub fn send(self) -> Result<(), SendError> {
+    pub fn send(mut self) -> Result<(), SendError> {
         let msg = "Unable to send response";
 
         let shared_state = self.shared_state.lock();
@@ -338,12 +339,35 @@ impl<
             "{} since the connections could not be updated.", msg);
 
         if self.connection_id != INVALID_CONNECTION_ID {
-            shared_state.response_sender.deliver_offset_to_connection(
-                self.offset_to_chunk,
-                self.sample_size,
-                self.channel_id,
-                self.connection_id,
-            )?;
+            if shared_state.config.enable_request_coalescing {
+                let key = RequestKey {
+                    connection_id: self.connection_id,
+                    channel_id: self.channel_id,
+                    request_id: self.ptr.as_header_ref().request_id,
+                };
+                shared_state.prepare_coalesced_response(self.ptr.as_header_mut(), &key);
+
+                let result = shared_state.response_sender.deliver_offset_to_connection(
+                    self.offset_to_chunk,
+                    self.sample_size,
+                    self.channel_id,
+                    self.connection_id,
+                );
+                let coalesced_result = shared_state.deliver_to_coalesced_requests(
+                    self.offset_to_chunk,
+                    self.sample_size,
+                    &key,
+                );
+                result?;
+                coalesced_result?;
+            } else {
+                shared_state.response_sender.deliver_offset_to_connection(
+                    self.offset_to_chunk,
+                    self.sample_size,
+                    self.channel_id,
+                    self.connection_id,
+                )?;
+            }
         }
 
         Ok(())
@@ -35,13 +35,13 @@ use core::{fmt::Debug, ops::Deref};
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
 use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
-use iceoryx2_cal::zero_copy_connection::ChannelId;
 
 use crate::identifiers::UniquePublisherId;
 use crate::port::details::chunk_details::ChunkDetails;
 use crate::port::subscriber::SubscriberSharedState;
 use crate::raw_sample::RawSample;
 use crate::service::header::publish_subscribe::Header;
+use crate::tracepoint::tracepoint;
 
 /// It stores the payload and is acquired by the [`Subscriber`](crate::port::subscriber::Subscriber) whenever
 /// it receives new data from a [`Publisher`](crate::port::publisher::Publisher) via
@@ -105,10 +105,11 @@ impl<
 > Drop for Sample<Service, Payload, UserHeader>
 {
     fn drop(&mut self) {
+        tracepoint!(subscriber_release, self.details.offset.as_value());
         self.subscriber_shared_state
             .lock()
             .receiver
-            .release_offset(&self.details, ChannelId::new(0));
+            .release_offset(&self.details, self.details.channel_id);
     }
 }
 
@@ -166,6 +166,10 @@ impl<
     UserHeader: ZeroCopySend,
 > SampleMut<Service, M, UserHeader>
 {
+    pub(crate) fn user_header_ptr(&self) -> *const u8 {
+        (self.ptr.as_user_header_ref() as *const UserHeader).cast()
+    }
+
     /// Returns a reference to the header of the sample.
     ///
     /// # Example
@@ -191,6 +195,40 @@ impl<
         self.ptr.as_header_ref()
     }
 
+    /// Sets the priority of the sample, which is stored in its [`Header`]. When the service
+    /// was created with multiple
+    /// [`priority_lanes()`](crate::service::builder::publish_subscribe::Builder::priority_lanes()),
+    /// the sample is delivered into the lane of its priority and every
+    /// [`crate::port::subscriber::Subscriber`] receives it before all samples with a lower
+    /// priority. Priorities beyond the number of lanes are delivered into the highest lane.
+    /// The default priority is `0`.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .priority_lanes(2)
+    /// #     .open_or_create()?;
+    /// # let publisher = service.publisher_builder().create()?;
+    ///
+    /// let mut sample = publisher.loan()?;
+    /// *sample.payload_mut() = 911;
+    /// sample.set_priority(1);
+    /// sample.send()?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn set_priority(&mut self, value: u8) {
+        self.ptr.as_header_mut().set_priority(value);
+    }
+
     /// Returns a reference to the user_header of the sample.
     ///
     /// # Example
@@ -331,9 +369,14 @@ impl<
     /// # Ok(())
     /// # }
     /// ```
-    pub fn send(self) -> Result<usize, SendError> {
-        self.publisher_shared_state
-            .lock()
-            .send_sample(self.offset_to_chunk, self.sample_size)
+    pub fn send(mut self) -> Result<usize, SendError> {
+        let shared_state = self.publisher_shared_state.lock();
+        shared_state.stamp_header(self.ptr.as_header_mut());
+        shared_state.send_sample(
+            self.offset_to_chunk,
+            self.sample_size,
+            self.user_header_ptr(),
+            shared_state.priority_lane(self.header()),
+        )
     }
 }
@@ -157,6 +157,33 @@ impl<
         self.sample.header()
     }
 
+    /// Sets the priority of the sample, see [`SampleMut::set_priority()`].
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// #
+    /// # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+    /// #     .publish_subscribe::<u64>()
+    /// #     .priority_lanes(2)
+    /// #     .open_or_create()?;
+    /// # let publisher = service.publisher_builder().create()?;
+    ///
+    /// let mut sample = publisher.loan_uninit()?;
+    /// sample.set_priority(1);
+    /// sample.write_payload(911).send()?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn set_priority(&mut self, value: u8) {
+        self.sample.set_priority(value)
+    }
+
     /// Returns a reference to the user_header of the sample.
     ///
     /// # Example
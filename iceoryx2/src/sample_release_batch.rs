@@ -0,0 +1,166 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! # Example
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! # let service = node.service_builder(&"My/Funk/ServiceName".try_into()?)
+//! #   .publish_subscribe::<u64>()
+//! #   .open_or_create()?;
+//! # let subscriber = service.subscriber_builder().create()?;
+//!
+//! let mut release_batch = subscriber.sample_release_batch(16);
+//! while let Some(sample) = subscriber.receive()? {
+//!     println!("received: {:?}", *sample);
+//!     // the sample is returned to the publisher together with up to 15 other samples
+//!     release_batch.push(sample);
+//! }
+//!
+//! // returns all remaining samples to their publishers
+//! release_batch.release();
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::vec::Vec;
+use core::fmt::Debug;
+use core::mem::ManuallyDrop;
+
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_cal::arc_sync_policy::ArcSyncPolicy;
+
+use crate::port::details::chunk_details::ChunkDetails;
+use crate::port::subscriber::SubscriberSharedState;
+use crate::sample::Sample;
+use crate::service;
+use crate::tracepoint::tracepoint;
+
+/// Collects received [`Sample`]s of a [`Subscriber`](crate::port::subscriber::Subscriber)
+/// and returns them to their [`Publisher`](crate::port::publisher::Publisher)s in one pass
+/// instead of one by one when each [`Sample`] is dropped. This reduces the synchronization
+/// with the [`Publisher`](crate::port::publisher::Publisher) when many small [`Sample`]s are
+/// received.
+///
+/// The [`Sample`]s are released as soon as the capacity of the [`SampleReleaseBatch`] is
+/// reached, when [`SampleReleaseBatch::release()`] is called or when the
+/// [`SampleReleaseBatch`] goes out of scope. Released [`Sample`]s still count towards the
+/// borrowed samples of the [`Subscriber`](crate::port::subscriber::Subscriber) until then.
+///
+/// Created with [`Subscriber::sample_release_batch()`](crate::port::subscriber::Subscriber::sample_release_batch()).
+pub struct SampleReleaseBatch<Service: service::Service> {
+    subscriber_shared_state: Service::ArcThreadSafetyPolicy<SubscriberSharedState<Service>>,
+    receiver_port_id: u128,
+    chunks: Vec<ChunkDetails>,
+    capacity: usize,
+}
+
+unsafe impl<Service: service::Service> Send for SampleReleaseBatch<Service> where
+    Service::ArcThreadSafetyPolicy<SubscriberSharedState<Service>>: Send + Sync
+{
+}
+
+impl<Service: service::Service> Debug for SampleReleaseBatch<Service> {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(
+            f,
+            "SampleReleaseBatch<{}> {{ capacity: {}, len: {} }}",
+            core::any::type_name::<Service>(),
+            self.capacity,
+            self.chunks.len()
+        )
+    }
+}
+
+impl<Service: service::Service> Drop for SampleReleaseBatch<Service> {
+    fn drop(&mut self) {
+        self.release();
+    }
+}
+
+impl<Service: service::Service> SampleReleaseBatch<Service> {
+    pub(crate) fn new(
+        subscriber_shared_state: Service::ArcThreadSafetyPolicy<SubscriberSharedState<Service>>,
+        capacity: usize,
+    ) -> Self {
+        let capacity = capacity.max(1);
+        let receiver_port_id = subscriber_shared_state.lock().receiver.receiver_port_id;
+        Self {
+            subscriber_shared_state,
+            receiver_port_id,
+            chunks: Vec::with_capacity(capacity),
+            capacity,
+        }
+    }
+
+    /// Returns the number of [`Sample`]s after which the collected [`Sample`]s are released.
+    pub fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    /// Returns the number of collected [`Sample`]s that were not yet released.
+    pub fn len(&self) -> usize {
+        self.chunks.len()
+    }
+
+    /// Returns true when the [`SampleReleaseBatch`] contains no unreleased [`Sample`]s.
+    pub fn is_empty(&self) -> bool {
+        self.chunks.is_empty()
+    }
+
+    /// Adds the [`Sample`] to the [`SampleReleaseBatch`] and releases all collected
+    /// [`Sample`]s when the capacity is reached. A [`Sample`] that was received by another
+    /// [`Subscriber`](crate::port::subscriber::Subscriber) is released right away.
+    pub fn push<Payload: Debug + ZeroCopySend + ?Sized, UserHeader: ZeroCopySend>(
+        &mut self,
+        sample: Sample<Service, Payload, UserHeader>,
+    ) {
+        if sample
+            .subscriber_shared_state
+            .lock()
+            .receiver
+            .receiver_port_id
+            != self.receiver_port_id
+        {
+            return;
+        }
+
+        // the ownership of the chunk is transferred to the batch, therefore the sample must
+        // not release it on drop and only its reference to the shared state is dropped
+        let sample = ManuallyDrop::new(sample);
+        let details = unsafe { core::ptr::read(&sample.details) };
+        drop(unsafe { core::ptr::read(&sample.subscriber_shared_state) });
+
+        tracepoint!(subscriber_release, details.offset.as_value());
+        self.chunks.push(details);
+        if self.chunks.len() >= self.capacity {
+            self.release();
+        }
+    }
+
+    /// Returns all collected [`Sample`]s to their
+    /// [`Publisher`](crate::port::publisher::Publisher)s.
+    pub fn release(&mut self) {
+        if self.chunks.is_empty() {
+            return;
+        }
+
+        self.subscriber_shared_state
+            .lock()
+            .receiver
+            .release_offsets(&self.chunks);
+        self.chunks.clear();
+    }
+}
@@ -355,19 +355,14 @@ impl AttributeVerifier {
         rhs: &AttributeSet,
     ) -> Result<(), AttributeVerificationError> {
         let msg = "The verification of attribute requirements failed";
-        // Implementation utilizes nested loops, however since MAX_ATTRIBUTES is small and
-        // the method is not expected to be used in a hot path, performance should be fine.
+        // The AttributeSet is kept sorted, therefore every requirement is looked up with a
+        // binary search instead of scanning all attributes of the target AttributeSet.
 
         // Check if the required key-value pair exists in the target AttributeSet.
         for attribute in self.required_attributes().iter() {
-            let key = attribute.key();
-            let value = attribute.value();
-
-            let attribute_present = rhs
-                .iter()
-                .any(|attr| attr.key() == key && attr.value() == value);
-
-            if !attribute_present {
+            if rhs.binary_search(attribute).is_err() {
+                let key = attribute.key();
+                let value = attribute.value();
                 fail!(from self,
                     with AttributeVerificationError::IncompatibleAttribute((*key, *value)),
                     "{msg} due to the incompatible attribute {} = {}.",
@@ -377,9 +372,7 @@ impl AttributeVerifier {
 
         // Ensure keys without values are also present in the target AttributeSet.
         for key in self.required_keys() {
-            let key_exists = rhs.iter().any(|attr| attr.key == *key);
-
-            if !key_exists {
+            if rhs.key_values(key).is_empty() {
                 fail!(from self,
                     with AttributeVerificationError::NonExistingKey(*key),
                     "{msg} due to a missing key {}.", key);
@@ -435,7 +428,7 @@ impl AttributeSet {
     /// Returns the number of values stored under a specific key. If the key does not exist it
     /// returns 0.
     pub fn number_of_key_values(&self, key: &AttributeKey) -> usize {
-        self.iter().filter(|element| element.key() == key).count()
+        self.key_values(key).len()
     }
 
     /// Returns a value of a key at a specific index. The index enumerates the values of the key
@@ -445,11 +438,7 @@ impl AttributeSet {
     /// If the key does not exist or it does not have a value at the specified index, it returns
     /// [`None`].
     pub fn key_value(&self, key: &AttributeKey, idx: usize) -> Option<&AttributeValue> {
-        self.0
-            .iter()
-            .filter(|attr| attr.key() == key)
-            .map(|attr| attr.value())
-            .nth(idx)
+        self.key_values(key).get(idx).map(|attr| attr.value())
     }
 
     /// Iterates over all values of a specific key
@@ -458,14 +447,18 @@ impl AttributeSet {
         key: &AttributeKey,
         mut callback: F,
     ) {
-        for element in self.iter() {
-            if element.key() != key {
-                continue;
-            }
-
+        for element in self.key_values(key) {
             if callback(element.value()) == CallbackProgression::Stop {
                 break;
             }
         }
     }
+
+    // The attributes are sorted by key and value, therefore all attributes of a key are stored
+    // consecutively and can be found with a binary search.
+    fn key_values(&self, key: &AttributeKey) -> &[Attribute] {
+        let start = self.partition_point(|attr| attr.key() < key);
+        let len = self[start..].partition_point(|attr| attr.key() == key);
+        &self[start..start + len]
+    }
 }
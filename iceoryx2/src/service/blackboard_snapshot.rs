@@ -0,0 +1,195 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A [`BlackboardSnapshot`] contains a consistent copy of all values of a blackboard
+//! [`Service`](crate::service::Service). It is acquired with
+//! [`Reader::create_snapshot()`](crate::port::reader::Reader::create_snapshot()), can be
+//! stored in a binary file and is used to initialize a new blackboard with
+//! [`Creator::restore_from_snapshot()`](crate::service::builder::blackboard::Creator::restore_from_snapshot())
+//! so that the state of the blackboard survives a restart without writing every entry
+//! again.
+//!
+//! Since [`Reader`](crate::port::reader::Reader)s can be moved into another thread, the
+//! snapshot can be created and stored while the
+//! [`Writer`](crate::port::writer::Writer) continues to update the blackboard.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::service::blackboard_snapshot::BlackboardSnapshot;
+//! use iceoryx2_bb_system_types::file_path::FilePath;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc::Service>()?;
+//! let snapshot_file = FilePath::new(b"/tmp/parameters.snapshot")?;
+//!
+//! // the previous instance stored the blackboard in the snapshot file
+//! # {
+//! # let service = node.service_builder(&"My/Parameters".try_into()?)
+//! #     .blackboard_creator::<u64>()
+//! #     .add::<f32>(0, 0.0)
+//! #     .create()?;
+//! # let reader = service.reader_builder().create()?;
+//! reader.create_snapshot().write_to_file(&snapshot_file)?;
+//! # }
+//!
+//! // the restarted instance creates the blackboard with the stored values
+//! let snapshot = BlackboardSnapshot::read_from_file(&snapshot_file)?;
+//! let service = node.service_builder(&"My/Parameters".try_into()?)
+//!     .blackboard_creator::<u64>()
+//!     .add::<f32>(0, 0.0)
+//!     .restore_from_snapshot(snapshot)
+//!     .create()?;
+//! # Ok(())
+//! # }
+//! ```
+
+use alloc::vec;
+use alloc::vec::Vec;
+
+use iceoryx2_bb_posix::creation_mode::CreationMode;
+use iceoryx2_bb_posix::file::{AccessMode, FileBuilder};
+use iceoryx2_bb_posix::permission::Permission;
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_cal::serialize::Serialize;
+use iceoryx2_cal::serialize::postcard::Postcard;
+use iceoryx2_log::fail;
+use serde::{Deserialize, Serialize as SerdeSerialize};
+
+use crate::service::static_config::message_type_details::TypeDetail;
+
+// is increased whenever the binary representation of the snapshot changes
+const SNAPSHOT_FORMAT_VERSION: u32 = 1;
+
+/// Defines a failure that can occur when a [`BlackboardSnapshot`] is stored or loaded.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum BlackboardSnapshotError {
+    /// The data is not a [`BlackboardSnapshot`] or was stored by an incompatible version.
+    InvalidSnapshot,
+    /// The snapshot file could not be created, written or read.
+    FileAccessFailed,
+    /// The [`BlackboardSnapshot`] could not be serialized.
+    InternalFailure,
+}
+
+impl core::fmt::Display for BlackboardSnapshotError {
+    fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
+        write!(f, "BlackboardSnapshotError::{self:?}")
+    }
+}
+
+impl core::error::Error for BlackboardSnapshotError {}
+
+#[derive(Debug, Clone, PartialEq, Eq, SerdeSerialize, Deserialize)]
+pub(crate) struct SnapshotEntry {
+    pub(crate) key: Vec<u8>,
+    pub(crate) value_type: TypeDetail,
+    pub(crate) value: Vec<u8>,
+}
+
+/// A copy of all values of a blackboard, see the [module documentation](self) for details.
+#[derive(Debug, Clone, PartialEq, Eq, SerdeSerialize, Deserialize)]
+pub struct BlackboardSnapshot {
+    format_version: u32,
+    pub(crate) key_type: TypeDetail,
+    pub(crate) entries: Vec<SnapshotEntry>,
+}
+
+impl BlackboardSnapshot {
+    pub(crate) fn new(key_type: TypeDetail, entries: Vec<SnapshotEntry>) -> Self {
+        Self {
+            format_version: SNAPSHOT_FORMAT_VERSION,
+            key_type,
+            entries,
+        }
+    }
+
+    /// Returns the number of entries in the [`BlackboardSnapshot`].
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Returns true when the [`BlackboardSnapshot`] contains no entries.
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Returns the binary representation of the [`BlackboardSnapshot`].
+    pub fn to_bytes(&self) -> Result<Vec<u8>, BlackboardSnapshotError> {
+        Ok(fail!(from self, when Postcard::serialize(self),
+                with BlackboardSnapshotError::InternalFailure,
+                "Unable to serialize the blackboard snapshot."))
+    }
+
+    /// Creates a [`BlackboardSnapshot`] from the binary representation acquired with
+    /// [`BlackboardSnapshot::to_bytes()`].
+    pub fn from_bytes(bytes: &[u8]) -> Result<Self, BlackboardSnapshotError> {
+        let origin = "BlackboardSnapshot::from_bytes()";
+        let snapshot: Self = fail!(from origin, when Postcard::deserialize(bytes),
+                with BlackboardSnapshotError::InvalidSnapshot,
+                "Unable to deserialize the blackboard snapshot since the data is corrupted.");
+
+        if snapshot.format_version != SNAPSHOT_FORMAT_VERSION {
+            fail!(from origin, with BlackboardSnapshotError::InvalidSnapshot,
+                "Unable to deserialize the blackboard snapshot since it has the format version {} but {} is required.",
+                snapshot.format_version, SNAPSHOT_FORMAT_VERSION);
+        }
+
+        if snapshot
+            .entries
+            .iter()
+            .any(|entry| entry.value.len() != entry.value_type.size)
+        {
+            fail!(from origin, with BlackboardSnapshotError::InvalidSnapshot,
+                "Unable to deserialize the blackboard snapshot since the size of a value does not match its type.");
+        }
+
+        Ok(snapshot)
+    }
+
+    /// Stores the [`BlackboardSnapshot`] in the file `path`. An existing file is replaced.
+    pub fn write_to_file(&self, path: &FilePath) -> Result<(), BlackboardSnapshotError> {
+        let msg = "Unable to write the blackboard snapshot";
+        let bytes = self.to_bytes()?;
+
+        let mut file = fail!(from self, when FileBuilder::new(path)
+                .creation_mode(CreationMode::PurgeAndCreate)
+                .permission(Permission::OWNER_READ | Permission::OWNER_WRITE)
+                .create(),
+            with BlackboardSnapshotError::FileAccessFailed,
+            "{msg} since the file {} could not be created.", path);
+
+        fail!(from self, when file.write(&bytes),
+            with BlackboardSnapshotError::FileAccessFailed,
+            "{msg} since the file {} could not be written.", path);
+
+        Ok(())
+    }
+
+    /// Loads a [`BlackboardSnapshot`] that was stored with
+    /// [`BlackboardSnapshot::write_to_file()`]. The file is read in one pass.
+    pub fn read_from_file(path: &FilePath) -> Result<Self, BlackboardSnapshotError> {
+        let origin = "BlackboardSnapshot::read_from_file()";
+        let msg = "Unable to read the blackboard snapshot";
+
+        let file = fail!(from origin, when FileBuilder::new(path).open_existing(AccessMode::Read),
+            with BlackboardSnapshotError::FileAccessFailed,
+            "{msg} since the file {} could not be opened.", path);
+
+        let mut bytes = vec![];
+        fail!(from origin, when file.read_to_vector(&mut bytes),
+            with BlackboardSnapshotError::FileAccessFailed,
+            "{msg} since the file {} could not be read.", path);
+
+        Self::from_bytes(&bytes)
+    }
+}
@@ -15,7 +15,7 @@
 //! See [`crate::service`]
 //!
 use core::alloc::Layout;
-use core::hash::Hash;
+use core::hash::{Hash, Hasher};
 use core::marker::PhantomData;
 use core::mem::MaybeUninit;
 use core::ptr::NonNull;
@@ -24,8 +24,12 @@ use alloc::boxed::Box;
 use alloc::format;
 use alloc::vec::Vec;
 
-use crate::constants::{MAX_BLACKBOARD_KEY_ALIGNMENT, MAX_BLACKBOARD_KEY_SIZE};
+use crate::constants::{
+    BLACKBOARD_CACHE_LINE_SIZE, MAX_BLACKBOARD_KEY_ALIGNMENT, MAX_BLACKBOARD_KEY_SIZE,
+};
+use crate::port::details::blackboard_history::{History, NO_HISTORY};
 use crate::service;
+use crate::service::blackboard_snapshot::{BlackboardSnapshot, SnapshotEntry};
 use crate::service::builder::{
     CustomKeyMarker, DynamicConfigCreationArgs, ServiceCreateError, ServiceOpenError,
 };
@@ -37,12 +41,13 @@ use crate::service::port_factory::blackboard;
 use crate::service::static_config::message_type_details::TypeDetail;
 use crate::service::static_config::messaging_pattern::MessagingPattern;
 use crate::service::*;
-use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_concurrency::atomic::{AtomicU64, Ordering, fence};
 use iceoryx2_bb_container::flatmap::RelocatableFlatMap;
 use iceoryx2_bb_container::queue::RelocatableContainer;
 use iceoryx2_bb_container::string::String;
 use iceoryx2_bb_container::vector::relocatable_vec::*;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
+use iceoryx2_bb_elementary::math::align;
 use iceoryx2_bb_elementary::static_assert::static_assert_eq;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_lock_free::spmc::unrestricted_atomic::*;
@@ -324,14 +329,81 @@ impl<const CAPACITY: usize> KeyMemory<CAPACITY> {
     }
 }
 
+/// The hash of keys which are only available as raw memory, like the keys of the language
+/// bindings. All of them end up in the same probe sequence of the key index, therefore, they are
+/// found with a linear search.
+#[doc(hidden)]
+pub const UNHASHED_KEY: u64 = 0;
+
+const FNV_OFFSET_BASIS: u64 = 0xcbf29ce484222325;
+const FNV_PRIME: u64 = 0x100000001b3;
+
+/// FNV-1a hasher for the key index in the blackboard management segment. In contrast to the
+/// default hasher it is not randomized and produces therefore the same hash in every process.
+struct KeyHasher {
+    state: u64,
+}
+
+impl Hasher for KeyHasher {
+    fn finish(&self) -> u64 {
+        self.state
+    }
+
+    fn write(&mut self, bytes: &[u8]) {
+        self.state = bytes.iter().fold(self.state, |hash, byte| {
+            (hash ^ *byte as u64).wrapping_mul(FNV_PRIME)
+        });
+    }
+}
+
+pub(crate) fn key_hash<KeyType: Hash>(key: &KeyType) -> u64 {
+    let mut hasher = KeyHasher {
+        state: FNV_OFFSET_BASIS,
+    };
+    key.hash(&mut hasher);
+    hasher.finish()
+}
+
+// Stores the value of the snapshot entry in the freshly initialized UnrestrictedAtomic at
+// atomic_ptr. The value type of the entry must match the type of the UnrestrictedAtomic.
+unsafe fn restore_value(atomic_ptr: *mut u8, entry: &SnapshotEntry) {
+    let atomic_mgmt = unsafe { &*(atomic_ptr as *const UnrestrictedAtomicMgmt) };
+    let data_ptr = align(
+        atomic_ptr as usize + core::mem::size_of::<UnrestrictedAtomicMgmt>(),
+        entry.value_type.alignment,
+    ) as *mut u8;
+
+    if unsafe { atomic_mgmt.__internal_acquire_producer() }.is_err() {
+        return;
+    }
+    unsafe {
+        let cell = atomic_mgmt.__internal_get_ptr_to_write_cell(
+            entry.value_type.size,
+            entry.value_type.alignment,
+            data_ptr,
+        );
+        core::ptr::copy_nonoverlapping(entry.value.as_ptr(), cell, entry.value_type.size);
+        atomic_mgmt.__internal_update_write_cell();
+        atomic_mgmt.__internal_release_producer();
+    }
+}
+
+// Describes the history ring of an entry that was added with Creator::add_with_history().
+struct HistoryInternals {
+    layout: Layout,
+    initializer: Box<dyn Fn(*mut u8)>,
+}
+
 #[doc(hidden)]
 pub struct BuilderInternals {
     key: KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+    key_hash: u64,
     value_type_details: TypeDetail,
     value_writer: Box<dyn Fn(*mut u8)>,
     internal_value_size: usize,
     internal_value_alignment: usize,
     internal_value_cleanup_callback: Box<dyn FnMut()>,
+    history: Option<HistoryInternals>,
 }
 
 impl Debug for BuilderInternals {
@@ -349,6 +421,7 @@ impl Drop for BuilderInternals {
 impl BuilderInternals {
     pub fn new(
         key: KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+        key_hash: u64,
         value_type_details: TypeDetail,
         value_writer: Box<dyn Fn(*mut u8)>,
         value_size: usize,
@@ -357,11 +430,13 @@ impl BuilderInternals {
     ) -> Self {
         Self {
             key,
+            key_hash,
             value_type_details,
             value_writer,
             internal_value_size: value_size,
             internal_value_alignment: value_alignment,
             internal_value_cleanup_callback: value_cleanup_callback,
+            history: None,
         }
     }
 }
@@ -371,6 +446,26 @@ impl BuilderInternals {
 pub(crate) struct Entry {
     pub(crate) type_details: TypeDetail,
     pub(crate) offset: AtomicU64,
+    pub(crate) key: KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+    pub(crate) history_offset: u64,
+}
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, ZeroCopySend)]
+pub(crate) struct IndexSlot {
+    key_hash: u64,
+    entry_index: u64,
+}
+
+impl IndexSlot {
+    const EMPTY: Self = Self {
+        key_hash: 0,
+        entry_index: u64::MAX,
+    };
+
+    fn is_empty(&self) -> bool {
+        self.entry_index == u64::MAX
+    }
 }
 
 #[repr(C)]
@@ -378,6 +473,87 @@ pub(crate) struct Entry {
 pub(crate) struct Mgmt {
     pub(crate) map: RelocatableFlatMap<KeyMemory<MAX_BLACKBOARD_KEY_SIZE>, usize>,
     pub(crate) entries: RelocatableVec<Entry>,
+    // open addressing hash table with linear probing that maps the key hash to the index in
+    // entries, it is never full so that every probe sequence ends at an empty slot
+    index: RelocatableVec<IndexSlot>,
+    // sequence lock of the writer transactions, it is odd while a transaction is in progress
+    transaction_counter: AtomicU64,
+}
+
+impl Mgmt {
+    const fn index_capacity(number_of_entries: usize) -> usize {
+        (2 * number_of_entries).next_power_of_two()
+    }
+
+    fn insert_into_index(&mut self, key_hash: u64, entry_index: usize) {
+        let mask = self.index.len() - 1;
+        let mut position = key_hash as usize & mask;
+        while !self.index[position].is_empty() {
+            position = (position + 1) & mask;
+        }
+
+        self.index[position] = IndexSlot {
+            key_hash,
+            entry_index: entry_index as u64,
+        };
+    }
+
+    /// Returns the index of the entry with the given key in O(1). Keys that were hashed
+    /// differently, for instance when the blackboard was created by another language binding,
+    /// are found with a linear search.
+    pub(crate) fn find_entry<F: Fn(*const u8, *const u8) -> bool + ?Sized>(
+        &self,
+        key: &KeyMemory<MAX_BLACKBOARD_KEY_SIZE>,
+        key_hash: u64,
+        key_eq_func: &F,
+    ) -> Option<usize> {
+        let key_ptr = key as *const KeyMemory<MAX_BLACKBOARD_KEY_SIZE> as *const u8;
+        let mask = self.index.len() - 1;
+        let mut position = key_hash as usize & mask;
+        loop {
+            let slot = self.index[position];
+            if slot.is_empty() {
+                break;
+            }
+
+            let entry_index = slot.entry_index as usize;
+            let entry_key_ptr = &self.entries[entry_index].key
+                as *const KeyMemory<MAX_BLACKBOARD_KEY_SIZE>
+                as *const u8;
+            if slot.key_hash == key_hash && key_eq_func(entry_key_ptr, key_ptr) {
+                return Some(entry_index);
+            }
+            position = (position + 1) & mask;
+        }
+
+        unsafe { self.map.__internal_get(key, key_eq_func) }
+    }
+
+    pub(crate) fn begin_transaction(&self) {
+        self.transaction_counter.fetch_add(1, Ordering::Relaxed);
+        fence(Ordering::Release);
+    }
+
+    pub(crate) fn end_transaction(&self) {
+        self.transaction_counter.fetch_add(1, Ordering::Release);
+    }
+
+    /// Waits until no transaction is in progress and returns the transaction counter that has
+    /// to be passed to [`Mgmt::is_snapshot_consistent()`] after all entries were read.
+    pub(crate) fn begin_snapshot(&self) -> u64 {
+        loop {
+            let transaction_counter = self.transaction_counter.load(Ordering::Acquire);
+            if transaction_counter % 2 == 0 {
+                return transaction_counter;
+            }
+            core::hint::spin_loop();
+        }
+    }
+
+    pub(crate) fn is_snapshot_consistent(&self, transaction_counter: u64) -> bool {
+        fence(Ordering::Acquire);
+        self.transaction_counter.load(Ordering::Relaxed) == transaction_counter
+    }
 }
 
 pub(crate) struct BlackboardResources<ServiceType: service::Service> {
@@ -556,6 +732,8 @@ pub struct Creator<
     ServiceType: service::Service,
 > {
     builder: Builder<KeyType, ServiceType>,
+    cache_line_aligned_entries: bool,
+    snapshot: Option<BlackboardSnapshot>,
 }
 
 impl<
@@ -566,6 +744,8 @@ impl<
     pub(crate) fn new(base: builder::BuilderWithServiceType<ServiceType>) -> Self {
         Self {
             builder: Builder::new(base),
+            cache_line_aligned_entries: false,
+            snapshot: None,
         }
     }
 
@@ -581,12 +761,145 @@ impl<
         self
     }
 
+    /// Pads and aligns every entry, consisting of its generation counter and value, to
+    /// [`BLACKBOARD_CACHE_LINE_SIZE`] so that updates of different entries never touch the same
+    /// cache line. Trades memory for a lower write latency when neighbouring entries are
+    /// updated concurrently. Disabled by default.
+    pub fn cache_line_aligned_entries(mut self, value: bool) -> Self {
+        self.cache_line_aligned_entries = value;
+        self
+    }
+
+    /// Initializes the entries with the values stored in the [`BlackboardSnapshot`] instead of
+    /// the values passed to [`Creator::add()`]. Only entries whose key and value type match
+    /// are restored, entries of the snapshot that were not added are ignored. The history of
+    /// an entry starts with the value passed to [`Creator::add_with_history()`].
+    pub fn restore_from_snapshot(mut self, snapshot: BlackboardSnapshot) -> Self {
+        self.snapshot = Some(snapshot);
+        self
+    }
+
+    // Returns the snapshot entry for every entry added to the builder or None, when the
+    // snapshot does not contain it. The snapshot is usually created by a blackboard with the
+    // same entries, therefore, the entry at the same position is checked first.
+    fn restored_entries(&self) -> Vec<Option<&SnapshotEntry>> {
+        let internals = &self.builder.internals;
+        let snapshot = match &self.snapshot {
+            None => return alloc::vec![None; internals.len()],
+            Some(snapshot) => snapshot,
+        };
+
+        if snapshot.key_type != self.builder.config_details().type_details {
+            warn!(from self,
+                "The blackboard snapshot is ignored since it was created with a different key type.");
+            return alloc::vec![None; internals.len()];
+        }
+
+        let matches = |internal: &BuilderInternals, entry: &SnapshotEntry| {
+            let key = match unsafe {
+                KeyMemory::<MAX_BLACKBOARD_KEY_SIZE>::try_from_ptr(
+                    entry.key.as_ptr(),
+                    Layout::from_size_align_unchecked(
+                        entry.key.len().min(MAX_BLACKBOARD_KEY_SIZE),
+                        1,
+                    ),
+                )
+            } {
+                Ok(key) => key,
+                Err(_) => return false,
+            };
+
+            internal.value_type_details == entry.value_type
+                && (*self.builder.key_eq_func)(
+                    &internal.key as *const KeyMemory<MAX_BLACKBOARD_KEY_SIZE> as *const u8,
+                    &key as *const KeyMemory<MAX_BLACKBOARD_KEY_SIZE> as *const u8,
+                )
+        };
+
+        internals
+            .iter()
+            .enumerate()
+            .map(|(n, internal)| match snapshot.entries.get(n) {
+                Some(entry) if matches(internal, entry) => Some(entry),
+                _ => snapshot
+                    .entries
+                    .iter()
+                    .find(|entry| matches(internal, *entry)),
+            })
+            .collect()
+    }
+
+    // Returns the layout of the memory that is allocated for the entry and the alignment of the
+    // entry inside of it. The allocator of the payload segment supports only a small alignment,
+    // therefore, cache line aligned entries allocate an additional cache line and are placed at
+    // the first cache line boundary inside the allocation.
+    fn entry_layout(&self, entry: &BuilderInternals) -> (Layout, usize) {
+        match self.cache_line_aligned_entries {
+            true => (
+                unsafe {
+                    Layout::from_size_align_unchecked(
+                        align(entry.internal_value_size, BLACKBOARD_CACHE_LINE_SIZE)
+                            + BLACKBOARD_CACHE_LINE_SIZE,
+                        entry.internal_value_alignment,
+                    )
+                },
+                entry
+                    .internal_value_alignment
+                    .max(BLACKBOARD_CACHE_LINE_SIZE),
+            ),
+            false => (
+                unsafe {
+                    Layout::from_size_align_unchecked(
+                        entry.internal_value_size,
+                        entry.internal_value_alignment,
+                    )
+                },
+                entry.internal_value_alignment,
+            ),
+        }
+    }
+
     /// Adds key-value pairs to the blackboard.
     pub fn add<ValueType: ZeroCopySend + Copy + 'static>(
         mut self,
         key: KeyType,
         value: ValueType,
     ) -> Self {
+        let internals = self.create_internals(key, value);
+        self.builder.internals.push(internals);
+        self
+    }
+
+    /// Adds key-value pairs to the blackboard and keeps the latest `history_depth` values,
+    /// including the current one, so that
+    /// [`EntryHandle::history()`](crate::port::reader::EntryHandle::history()) can iterate
+    /// over updates that were missed by a [`Reader`](crate::port::reader::Reader). A depth of
+    /// zero is equal to [`Creator::add()`].
+    pub fn add_with_history<ValueType: ZeroCopySend + Copy + 'static>(
+        mut self,
+        key: KeyType,
+        value: ValueType,
+        history_depth: usize,
+    ) -> Self {
+        let mut internals = self.create_internals(key, value);
+        if history_depth != 0 {
+            internals.history = Some(HistoryInternals {
+                layout: History::<ValueType>::layout(history_depth),
+                initializer: Box::new(move |mem: *mut u8| unsafe {
+                    History::init(mem as *mut History<ValueType>, history_depth, value)
+                }),
+            });
+        }
+
+        self.builder.internals.push(internals);
+        self
+    }
+
+    fn create_internals<ValueType: ZeroCopySend + Copy + 'static>(
+        &self,
+        key: KeyType,
+        value: ValueType,
+    ) -> BuilderInternals {
         let key_mem = match KeyMemory::try_from(&key) {
             Err(_) => {
                 fatal_panic!(from self,
@@ -595,8 +908,9 @@ impl<
             Ok(mem) => mem,
         };
 
-        let internals = BuilderInternals {
+        BuilderInternals {
             key: key_mem,
+            key_hash: key_hash(&key),
             value_type_details: TypeDetail::new::<ValueType>(
                 message_type_details::TypeVariant::FixedSize,
             ),
@@ -608,10 +922,8 @@ impl<
             internal_value_size: core::mem::size_of::<UnrestrictedAtomic<ValueType>>(),
             internal_value_alignment: core::mem::align_of::<UnrestrictedAtomic<ValueType>>(),
             internal_value_cleanup_callback: Box::new(|| {}),
-        };
-
-        self.builder.internals.push(internals);
-        self
+            history: None,
+        }
     }
 
     /// Adds key-value pairs to the blackboard where value is a default value.
@@ -664,13 +976,18 @@ impl<
         let blackboard_config = *self.builder.config_details();
         let key_eq_func = self.builder.key_eq_func.clone();
         let builder_internals = self.builder.internals.as_slice();
+        let restored_entries = self.restored_entries();
         let shared_node = &self.builder.base.shared_node;
         // create the payload data segment for the writer
         let name = blackboard_name(service_config.unique_service_id());
         let shm_config = blackboard_data_config::<ServiceType>(shared_node.config());
         let mut payload_size = 0;
         for i in builder_internals.iter() {
-            payload_size += i.internal_value_size + i.internal_value_alignment - 1;
+            let (layout, _) = self.entry_layout(i);
+            payload_size += layout.size() + layout.align() - 1;
+            if let Some(history) = &i.history {
+                payload_size += history.layout.size() + history.layout.align() - 1;
+            }
         }
         let payload_shm = match <<ServiceType::BlackboardPayload as SharedMemory<
             iceoryx2_cal::shm_allocator::shm_bump_allocator::BumpAllocator,
@@ -709,20 +1026,29 @@ impl<
             >>::Builder::new(&name)
                 .config(&mgmt_config)
                 .has_ownership(true)
-                .supplementary_size(RelocatableFlatMap::<KeyMemory<MAX_BLACKBOARD_KEY_SIZE>, usize>::const_memory_size(capacity)+RelocatableVec::<Entry>::const_memory_size(capacity))
+                .supplementary_size(RelocatableFlatMap::<KeyMemory<MAX_BLACKBOARD_KEY_SIZE>, usize>::const_memory_size(capacity)+RelocatableVec::<Entry>::const_memory_size(capacity)+RelocatableVec::<IndexSlot>::const_memory_size(Mgmt::index_capacity(capacity)))
                 .initializer(|mgmt: &mut MaybeUninit<Mgmt>, allocator: &mut BumpAllocator| {
                     mgmt.write(Mgmt {
                         map: unsafe { RelocatableFlatMap::<KeyMemory<MAX_BLACKBOARD_KEY_SIZE>, usize>::new_uninit(capacity) },
                         entries: unsafe { RelocatableVec::<Entry>::new_uninit(capacity) },
+                        index: unsafe { RelocatableVec::<IndexSlot>::new_uninit(Mgmt::index_capacity(capacity)) },
+                        transaction_counter: AtomicU64::new(0),
                     });
                     let mgmt = unsafe { mgmt.assume_init_mut() };
 
-                    if unsafe {mgmt.map.init(allocator)}.is_err() || unsafe {mgmt.entries.init(allocator).is_err()} {
+                    if unsafe {mgmt.map.init(allocator)}.is_err() || unsafe {mgmt.entries.init(allocator).is_err()} || unsafe {mgmt.index.init(allocator).is_err()} {
                         return false
                     }
-                    for entry in builder_internals.iter() {
+                    while mgmt.index.len() < mgmt.index.capacity() {
+                        if mgmt.index.push(IndexSlot::EMPTY).is_err() {
+                            error!(from self, "Initializing the key index in the blackboard management segment failed.");
+                            return false
+                        }
+                    }
+                    for (entry, restored_entry) in builder_internals.iter().zip(restored_entries.iter()) {
                         // write value passed to add() to payload_shm
-                        let mem = match payload_shm.allocate(unsafe { Layout::from_size_align_unchecked(entry.internal_value_size, entry.internal_value_alignment) })
+                        let (layout, entry_alignment) = self.entry_layout(entry);
+                        let mem = match payload_shm.allocate(layout)
                         {
                             Ok(m) => m,
                             Err(_) => {
@@ -730,9 +1056,30 @@ impl<
                                 return false
                             }
                         };
-                        (*entry.value_writer)(mem.data_ptr);
+                        let padding = align(mem.data_ptr as usize, entry_alignment) - mem.data_ptr as usize;
+                        (*entry.value_writer)(unsafe { mem.data_ptr.add(padding) });
+                        if let Some(restored_entry) = restored_entry {
+                            unsafe { restore_value(mem.data_ptr.add(padding), restored_entry) };
+                        }
                         // write offset to value in payload_shm to entries vector
-                        let res = mgmt.entries.push(Entry{type_details: entry.value_type_details, offset: AtomicU64::new(mem.offset.offset() as u64)});
+                        // write the history ring behind the value, the allocator supports only
+                        // a small alignment, therefore, it is aligned inside of the allocation
+                        let history_offset = match &entry.history {
+                            None => NO_HISTORY,
+                            Some(history) => {
+                                let history_mem = match payload_shm.allocate(unsafe { Layout::from_size_align_unchecked(history.layout.size() + history.layout.align() - 1, 1) }) {
+                                    Ok(m) => m,
+                                    Err(_) => {
+                                        error!(from self, "Writing the history to the blackboard data segment failed.");
+                                        return false
+                                    }
+                                };
+                                let history_padding = align(history_mem.data_ptr as usize, history.layout.align()) - history_mem.data_ptr as usize;
+                                (*history.initializer)(unsafe { history_mem.data_ptr.add(history_padding) });
+                                (history_mem.offset.offset() + history_padding) as u64
+                            }
+                        };
+                        let res = mgmt.entries.push(Entry{type_details: entry.value_type_details, offset: AtomicU64::new((mem.offset.offset() + padding) as u64), key: entry.key, history_offset});
                         if res.is_err() {
                             error!(from self, "Writing the value offset to the blackboard management segment failed.");
                             return false
@@ -743,6 +1090,7 @@ impl<
                             error!(from self, "Inserting the key-value pair into the blackboard management segment failed.");
                             return false
                         }
+                        mgmt.insert_into_index(entry.key_hash, mgmt.entries.len() - 1);
                     }
                     true})
                 .create(),
@@ -865,6 +1213,7 @@ impl<ServiceType: service::Service> Creator<CustomKeyMarker, ServiceType> {
 
         let internals = BuilderInternals::new(
             key_mem,
+            UNHASHED_KEY,
             value_details,
             value_writer,
             value_size,
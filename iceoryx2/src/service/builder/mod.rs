@@ -32,7 +32,6 @@ use core::marker::PhantomData;
 use core::mem::MaybeUninit;
 
 use alloc::format;
-use alloc::string::String;
 use alloc::vec;
 
 use iceoryx2_bb_container::vector::StaticVec;
@@ -63,15 +62,16 @@ use iceoryx2_log::warn;
 use crate::config::IO_TICK_TIME;
 use crate::identifiers::UniqueNodeId;
 use crate::identifiers::UniqueServiceId;
-use crate::node::NodeState;
+use crate::node::NodeView;
 use crate::node::SharedNode;
 use crate::prelude::AttributeSpecifier;
 use crate::prelude::AttributeVerifier;
 use crate::service;
-use crate::service::__internal_details;
+use crate::service::dead_nodes_of_service;
 use crate::service::dynamic_config::DynamicConfig;
 use crate::service::dynamic_config::MessagingPatternSettings;
 use crate::service::dynamic_config::RegisterNodeResult;
+use crate::service::messaging_pattern::MessagingPattern;
 use crate::service::naming_scheme::dynamic_config_name;
 use crate::service::naming_scheme::static_config_name;
 use crate::service::static_config::*;
@@ -222,8 +222,10 @@ impl<S: Service> Builder<S> {
         self,
     ) -> request_response::Builder<RequestPayload, (), ResponsePayload, (), S> {
         BuilderWithServiceType::new(
-            StaticConfig::new_request_response::<S::ServiceNameHasher>(
+            StaticConfig::new_request_response(
                 &self.name,
+                self.shared_node
+                    .service_hash(&self.name, MessagingPattern::RequestResponse),
                 self.shared_node.config(),
             ),
             self.shared_node,
@@ -237,8 +239,10 @@ impl<S: Service> Builder<S> {
         self,
     ) -> publish_subscribe::Builder<PayloadType, (), S> {
         BuilderWithServiceType::new(
-            StaticConfig::new_publish_subscribe::<S::ServiceNameHasher>(
+            StaticConfig::new_publish_subscribe(
                 &self.name,
+                self.shared_node
+                    .service_hash(&self.name, MessagingPattern::PublishSubscribe),
                 self.shared_node.config(),
             ),
             self.shared_node,
@@ -250,7 +254,12 @@ impl<S: Service> Builder<S> {
     /// [`MessagingPattern::Event`](crate::service::messaging_pattern::MessagingPattern::Event) [`Service`].
     pub fn event(self) -> event::Builder<S> {
         BuilderWithServiceType::new(
-            StaticConfig::new_event::<S::ServiceNameHasher>(&self.name, self.shared_node.config()),
+            StaticConfig::new_event(
+                &self.name,
+                self.shared_node
+                    .service_hash(&self.name, MessagingPattern::Event),
+                self.shared_node.config(),
+            ),
             self.shared_node,
         )
         .event()
@@ -264,8 +273,10 @@ impl<S: Service> Builder<S> {
         self,
     ) -> blackboard::Creator<KeyType, S> {
         BuilderWithServiceType::new(
-            StaticConfig::new_blackboard::<S::ServiceNameHasher>(
+            StaticConfig::new_blackboard(
                 &self.name,
+                self.shared_node
+                    .service_hash(&self.name, MessagingPattern::Blackboard),
                 self.shared_node.config(),
             ),
             self.shared_node,
@@ -281,8 +292,10 @@ impl<S: Service> Builder<S> {
         self,
     ) -> blackboard::Opener<KeyType, S> {
         BuilderWithServiceType::new(
-            StaticConfig::new_blackboard::<S::ServiceNameHasher>(
+            StaticConfig::new_blackboard(
                 &self.name,
+                self.shared_node
+                    .service_hash(&self.name, MessagingPattern::Blackboard),
                 self.shared_node.config(),
             ),
             self.shared_node,
@@ -486,26 +499,21 @@ impl<ServiceType: service::Service> BuilderWithServiceType<ServiceType> {
         let config = self.shared_node.config();
 
         if config.global.service.cleanup_dead_nodes_on_open {
-            match __internal_details::<ServiceType>(config, self.service_config.service_hash()) {
-                Ok(Some(service)) => {
-                    if let Some(dynamic_details) = service.dynamic_details {
-                        for node in dynamic_details.nodes {
-                            let node_id = *node.node_id();
-                            if let NodeState::Dead(node) = node {
-                                warn!(from origin,
-                                    "Detected dead node {} in service {}. Trying to cleanup stale resources.",
-                                    node_id, self.service_config.service_hash());
-                                if let Err(e) = node
-                                    .blocking_remove_stale_resources(config.global.creation_timeout)
-                                {
-                                    warn!(from origin,
-                                        "Detected dead node ({}) in service {} but failed to cleanup the resources. This might cause problems when stale port resources block the creation of new ones. [{e:?}]", node_id, self.service_config.service_hash())
-                                }
-                            }
+            match dead_nodes_of_service::<ServiceType>(config, self.service_config.service_hash()) {
+                Ok(dead_nodes) => {
+                    for node in dead_nodes {
+                        let node_id = *node.id();
+                        warn!(from origin,
+                            "Detected dead node {} in service {}. Trying to cleanup stale resources.",
+                            node_id, self.service_config.service_hash());
+                        if let Err(e) =
+                            node.blocking_remove_stale_resources(config.global.creation_timeout)
+                        {
+                            warn!(from origin,
+                                "Detected dead node ({}) in service {} but failed to cleanup the resources. This might cause problems when stale port resources block the creation of new ones. [{e:?}]", node_id, self.service_config.service_hash())
                         }
                     }
                 }
-                Ok(None) => (),
                 Err(e) => {
                     warn!(from origin,
                         "Failed to check if the service {} contains dead nodes. [{e:?}]",
@@ -834,15 +842,13 @@ impl<ServiceType: service::Service> BuilderWithServiceType<ServiceType> {
                         }
                     };
 
-                let mut read_content =
-                    String::from_utf8(vec![b' '; storage.len() as usize]).expect("");
-                if let Err(e) = storage.read(unsafe { read_content.as_mut_vec() }.as_mut_slice()) {
+                let mut read_content = vec![0u8; storage.len() as usize];
+                if let Err(e) = storage.read(read_content.as_mut_slice()) {
                     fail!(from self, with ServiceState::InsufficientPermissions,
                             "{} since it is not possible to read the services underlying static details. Is the service accessible? [{e:?}]", msg);
                 }
 
-                let service_config = fail!(from self, when ServiceType::ConfigSerializer::deserialize::<StaticConfig>(unsafe {
-                                            read_content.as_mut_vec() }),
+                let service_config = fail!(from self, when ServiceType::ConfigSerializer::deserialize::<StaticConfig>(&read_content),
                                      with ServiceState::Corrupted, "Unable to deserialize the service config. Is the service corrupted?");
 
                 if service_config.service_hash() != expected_service_config.service_hash() {
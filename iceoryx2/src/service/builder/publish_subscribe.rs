@@ -455,6 +455,11 @@ impl<
     /// an existing [`Service`] is opened it requires the service to have at least the defined
     /// [`Alignment`]. If the Payload [`Alignment`] is greater than the provided [`Alignment`]
     /// then the Payload [`Alignment`] is used.
+    ///
+    /// An [`Alignment`] of a cache line or a page separates the hot header from the payload:
+    /// the samples are aligned like the payload, so the header and user header never share a
+    /// cache line with a payload and reading only the headers does not pull payload into
+    /// the cache.
     pub fn payload_alignment(mut self, alignment: Alignment) -> Self {
         self.override_alignment = Some(alignment.value());
         self
@@ -468,6 +473,30 @@ impl<
         self
     }
 
+    /// If the [`Service`] is created, defines if every [`crate::sample::Sample`] carries the
+    /// point in time when it was sent, acquired with a monotonic clock. It can be read with
+    /// [`crate::service::header::publish_subscribe::Header::send_timestamp()`] to measure the
+    /// end-to-end latency without an additional user header. If an existing [`Service`] is
+    /// opened, the setting of the existing [`Service`] is used.
+    pub fn enable_send_timestamps(mut self, value: bool) -> Self {
+        self.config_details_mut().enable_send_timestamps = value;
+        self
+    }
+
+    /// If the [`Service`] is created, defines the number of priority lanes in the buffer of
+    /// every [`crate::port::subscriber::Subscriber`]. A [`crate::sample::Sample`] is sent into
+    /// the lane that corresponds to its priority, see
+    /// [`crate::sample_mut::SampleMut::set_priority()`], and all samples of a higher lane are
+    /// received before the samples of a lower lane. Every lane has the buffer size of the
+    /// [`crate::port::subscriber::Subscriber`], therefore the data segment of every
+    /// [`crate::port::publisher::Publisher`] grows with the number of lanes. Smallest possible
+    /// value is `1`. If an existing [`Service`] is opened, the setting of the existing
+    /// [`Service`] is used.
+    pub fn priority_lanes(mut self, value: usize) -> Self {
+        self.config_details_mut().number_of_priority_lanes = value.max(1);
+        self
+    }
+
     /// If the [`Service`] is created it defines how many [`crate::sample::Sample`] a
     /// [`crate::port::subscriber::Subscriber`] can borrow at most in parallel. If an existing
     /// [`Service`] is opened it defines the minimum required.
@@ -28,6 +28,7 @@
 //! ```
 
 use iceoryx2_bb_concurrency::atomic::AtomicU64;
+use iceoryx2_bb_container::vector::{RelocatableVec, Vector};
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
@@ -37,6 +38,7 @@ use iceoryx2_log::{error, fatal_panic};
 
 use crate::identifiers::{UniqueListenerId, UniqueNodeId, UniqueNotifierId, UniquePortId};
 use crate::port::port_name::PortName;
+use crate::port::statistics::{PortStatistics, PortStatisticsCounters};
 
 use super::PortCleanupAction;
 
@@ -55,6 +57,12 @@ pub struct DynamicConfig {
     pub(crate) listeners: Container<ListenerDetails>,
     pub(crate) notifiers: Container<NotifierDetails>,
     pub(crate) elapsed_time_since_last_notification: AtomicU64,
+    // monotonic time in nanoseconds of the latest notification, only stamped by the notifiers
+    // while at least one listener tracks its wake up latency
+    pub(crate) last_notification_timestamp: AtomicU64,
+    pub(crate) number_of_wake_up_latency_trackers: AtomicU64,
+    // the statistics of a listener are stored at the index of its container handle
+    listener_statistics: RelocatableVec<PortStatisticsCounters>,
 }
 
 /// Contains the communication settings of the connected
@@ -91,6 +99,9 @@ impl DynamicConfig {
             listeners: unsafe { Container::new_uninit(config.number_of_listeners) },
             notifiers: unsafe { Container::new_uninit(config.number_of_notifiers) },
             elapsed_time_since_last_notification: AtomicU64::new(0),
+            last_notification_timestamp: AtomicU64::new(0),
+            number_of_wake_up_latency_trackers: AtomicU64::new(0),
+            listener_statistics: unsafe { RelocatableVec::new_uninit(config.number_of_listeners) },
         }
     }
 
@@ -102,12 +113,23 @@ impl DynamicConfig {
             fatal_panic!(from "event::DynamicConfig::init",
             when self.notifiers.init(allocator),
             "This should never happen! Unable to initialize notifier port id container.");
+            fatal_panic!(from "event::DynamicConfig::init",
+            when self.listener_statistics.init(allocator),
+            "This should never happen! Unable to initialize listener statistics.");
+        }
+
+        while !self.listener_statistics.is_full() {
+            unsafe {
+                self.listener_statistics
+                    .push_unchecked(PortStatisticsCounters::default())
+            };
         }
     }
 
     pub(crate) fn memory_size(config: &DynamicConfigSettings) -> usize {
         Container::<ListenerDetails>::memory_size(config.number_of_listeners)
             + Container::<NotifierDetails>::memory_size(config.number_of_notifiers)
+            + RelocatableVec::<PortStatisticsCounters>::memory_size(config.number_of_listeners)
     }
 
     /// Returns how many [`Listener`](crate::port::listener::Listener) ports are currently connected.
@@ -133,6 +155,19 @@ impl DynamicConfig {
         state.for_each(|_, details| callback(details));
     }
 
+    /// Returns the accumulated [`PortStatistics`] of all connected
+    /// [`Listener`](crate::port::listener::Listener)s.
+    pub fn listener_statistics(&self) -> PortStatistics {
+        let mut statistics = PortStatistics::default();
+        let state = unsafe { self.listeners.get_state() };
+        state.for_each(|index, _| {
+            statistics += self.listener_statistics[index].load();
+            CallbackProgression::Continue
+        });
+
+        statistics
+    }
+
     /// Iterates over all [`Notifier`](crate::port::notifier::Notifier)s and calls the
     /// callback with the corresponding [`NotifierDetails`].
     /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
@@ -187,7 +222,19 @@ impl DynamicConfig {
         unsafe { self.listeners.add(details, details.node_id.owner_id()).ok() }
     }
 
+    /// Returns the [`PortStatisticsCounters`] of the listener with the provided handle. They
+    /// are reset, since the slot could have been used by a listener of a dead node.
+    pub(crate) fn listener_statistics_of(
+        &self,
+        handle: ContainerHandle,
+    ) -> &PortStatisticsCounters {
+        let counters = &self.listener_statistics[handle.index()];
+        counters.reset();
+        counters
+    }
+
     pub(crate) fn release_listener_handle(&self, handle: ContainerHandle) {
+        self.listener_statistics[handle.index()].reset();
         if let Err(e) = unsafe { self.listeners.remove(handle, ReleaseMode::Default) } {
             error!(from self, "Unable to deregister listener from service. This could indicate a corrupted system! [{e:?}]");
         }
@@ -23,19 +23,25 @@
 //!
 //! println!("number of active publishers:      {:?}", pubsub.dynamic_config().number_of_publishers());
 //! println!("number of active subscribers:     {:?}", pubsub.dynamic_config().number_of_subscribers());
+//! println!("statistics of all publishers:     {:?}", pubsub.dynamic_config().publisher_statistics());
 //! # Ok(())
 //! # }
 //! ```
 use crate::{
     identifiers::{UniqueNodeId, UniquePortId, UniquePublisherId, UniqueSubscriberId},
+    port::content_filter::ContentFilter,
     port::details::data_segment::DataSegmentType,
     port::port_name::PortName,
+    port::statistics::{PortStatistics, PortStatisticsCounters},
 };
+use iceoryx2_bb_container::vector::{RelocatableVec, Vector};
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::relocatable_container::RelocatableContainer;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_lock_free::mpmc::{container::*, unique_index_set_enums::ReleaseMode};
 use iceoryx2_bb_memory::bump_allocator::BumpAllocator;
+use iceoryx2_bb_posix::clock::Time;
+use iceoryx2_cal::shared_memory::NumaPolicy;
 use iceoryx2_log::{error, fatal_panic};
 
 use super::PortCleanupAction;
@@ -71,6 +77,9 @@ pub struct PublisherDetails {
     /// [`DataSegmentType::Dynamic`] it defines how many segment the
     /// [`Publisher`](crate::port::publisher::Publisher) can have at most.
     pub max_number_of_segments: u8,
+    /// The effective [`NumaPolicy`] of the data segment of the
+    /// [`Publisher`](crate::port::publisher::Publisher).
+    pub numa_policy: NumaPolicy,
 }
 
 /// Contains the communication settings of the connected
@@ -89,6 +98,15 @@ pub struct SubscriberDetails {
     pub buffer_size: usize,
     /// The requested amount of [`Sample`](crate::sample::Sample) to get as history.
     pub history_request: usize,
+    /// Only history [`Sample`](crate::sample::Sample)s that were sent at or after this point in
+    /// time are requested.
+    pub history_since: Time,
+    /// The [`ContentFilter`] the [`Publisher`](crate::port::publisher::Publisher) applies
+    /// before delivering a [`Sample`](crate::sample::Sample).
+    pub content_filter: ContentFilter,
+    /// Defines if the [`Subscriber`](crate::port::subscriber::Subscriber) has a wake up channel
+    /// that the [`Publisher`](crate::port::publisher::Publisher) signals after every delivery.
+    pub has_wake_up_channel: bool,
 }
 
 /// The dynamic configuration of an
@@ -99,6 +117,9 @@ pub struct SubscriberDetails {
 pub struct DynamicConfig {
     pub(crate) subscribers: Container<SubscriberDetails>,
     pub(crate) publishers: Container<PublisherDetails>,
+    // the statistics of a port are stored at the index of its container handle
+    subscriber_statistics: RelocatableVec<PortStatisticsCounters>,
+    publisher_statistics: RelocatableVec<PortStatisticsCounters>,
 }
 
 impl DynamicConfig {
@@ -106,6 +127,12 @@ impl DynamicConfig {
         Self {
             subscribers: unsafe { Container::new_uninit(config.number_of_subscribers) },
             publishers: unsafe { Container::new_uninit(config.number_of_publishers) },
+            subscriber_statistics: unsafe {
+                RelocatableVec::new_uninit(config.number_of_subscribers)
+            },
+            publisher_statistics: unsafe {
+                RelocatableVec::new_uninit(config.number_of_publishers)
+            },
         }
     }
 
@@ -117,12 +144,33 @@ impl DynamicConfig {
             fatal_panic!(from self,
             when self.publishers.init(allocator),
             "This should never happen! Unable to initialize publisher port id container.");
+            fatal_panic!(from self,
+            when self.subscriber_statistics.init(allocator),
+            "This should never happen! Unable to initialize subscriber statistics.");
+            fatal_panic!(from self,
+            when self.publisher_statistics.init(allocator),
+            "This should never happen! Unable to initialize publisher statistics.");
+        }
+
+        while !self.subscriber_statistics.is_full() {
+            unsafe {
+                self.subscriber_statistics
+                    .push_unchecked(PortStatisticsCounters::default())
+            };
+        }
+        while !self.publisher_statistics.is_full() {
+            unsafe {
+                self.publisher_statistics
+                    .push_unchecked(PortStatisticsCounters::default())
+            };
         }
     }
 
     pub(crate) fn memory_size(config: &DynamicConfigSettings) -> usize {
         Container::<SubscriberDetails>::memory_size(config.number_of_subscribers)
             + Container::<PublisherDetails>::memory_size(config.number_of_publishers)
+            + RelocatableVec::<PortStatisticsCounters>::memory_size(config.number_of_subscribers)
+            + RelocatableVec::<PortStatisticsCounters>::memory_size(config.number_of_publishers)
     }
 
     pub(crate) unsafe fn remove_dead_node_id<
@@ -195,6 +243,65 @@ impl DynamicConfig {
         state.for_each(|_, details| callback(details));
     }
 
+    /// Iterates over all [`Publisher`](crate::port::publisher::Publisher)s and calls the
+    /// callback with the corresponding [`PublisherDetails`] and the current [`PortStatistics`]
+    /// of the [`Publisher`](crate::port::publisher::Publisher).
+    /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
+    /// continue otherwise [`CallbackProgression::Stop`].
+    pub fn list_publisher_statistics<
+        F: FnMut(&PublisherDetails, PortStatistics) -> CallbackProgression,
+    >(
+        &self,
+        mut callback: F,
+    ) {
+        let state = unsafe { self.publishers.get_state() };
+
+        state.for_each(|index, details| callback(details, self.publisher_statistics[index].load()));
+    }
+
+    /// Iterates over all [`Subscriber`](crate::port::subscriber::Subscriber)s and calls the
+    /// callback with the corresponding [`SubscriberDetails`] and the current
+    /// [`PortStatistics`] of the [`Subscriber`](crate::port::subscriber::Subscriber).
+    /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
+    /// continue otherwise [`CallbackProgression::Stop`].
+    pub fn list_subscriber_statistics<
+        F: FnMut(&SubscriberDetails, PortStatistics) -> CallbackProgression,
+    >(
+        &self,
+        mut callback: F,
+    ) {
+        let state = unsafe { self.subscribers.get_state() };
+
+        state
+            .for_each(|index, details| callback(details, self.subscriber_statistics[index].load()));
+    }
+
+    /// Returns the accumulated [`PortStatistics`] of all connected
+    /// [`Publisher`](crate::port::publisher::Publisher)s.
+    pub fn publisher_statistics(&self) -> PortStatistics {
+        let mut statistics = PortStatistics::default();
+        let state = unsafe { self.publishers.get_state() };
+        state.for_each(|index, _| {
+            statistics += self.publisher_statistics[index].load();
+            CallbackProgression::Continue
+        });
+
+        statistics
+    }
+
+    /// Returns the accumulated [`PortStatistics`] of all connected
+    /// [`Subscriber`](crate::port::subscriber::Subscriber)s.
+    pub fn subscriber_statistics(&self) -> PortStatistics {
+        let mut statistics = PortStatistics::default();
+        let state = unsafe { self.subscribers.get_state() };
+        state.for_each(|index, _| {
+            statistics += self.subscriber_statistics[index].load();
+            CallbackProgression::Continue
+        });
+
+        statistics
+    }
+
     pub(crate) fn add_subscriber_id(
         &self,
         details: SubscriberDetails,
@@ -206,7 +313,19 @@ impl DynamicConfig {
         }
     }
 
+    /// Returns the [`PortStatisticsCounters`] of the subscriber with the provided handle. They
+    /// are reset, since the slot could have been used by a subscriber of a dead node.
+    pub(crate) fn subscriber_statistics_of(
+        &self,
+        handle: ContainerHandle,
+    ) -> &PortStatisticsCounters {
+        let counters = &self.subscriber_statistics[handle.index()];
+        counters.reset();
+        counters
+    }
+
     pub(crate) fn release_subscriber_handle(&self, handle: ContainerHandle) {
+        self.subscriber_statistics[handle.index()].reset();
         if let Err(e) = unsafe { self.subscribers.remove(handle, ReleaseMode::Default) } {
             error!(from self, "Unable to deregister subscriber from service. This could indicate a corrupted system! [{e:?}]");
         }
@@ -223,7 +342,19 @@ impl DynamicConfig {
         }
     }
 
+    /// Returns the [`PortStatisticsCounters`] of the publisher with the provided handle. They
+    /// are reset, since the slot could have been used by a publisher of a dead node.
+    pub(crate) fn publisher_statistics_of(
+        &self,
+        handle: ContainerHandle,
+    ) -> &PortStatisticsCounters {
+        let counters = &self.publisher_statistics[handle.index()];
+        counters.reset();
+        counters
+    }
+
     pub(crate) fn release_publisher_handle(&self, handle: ContainerHandle) {
+        self.publisher_statistics[handle.index()].reset();
         if let Err(e) = unsafe { self.publishers.remove(handle, ReleaseMode::Default) } {
             error!(from self, "Unable to deregister publisher from service. This could indicate a corrupted system! [{e:?}]");
         }
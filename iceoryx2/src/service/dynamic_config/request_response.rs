@@ -11,6 +11,7 @@
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
 use iceoryx2_bb_container::queue::RelocatableContainer;
+use iceoryx2_bb_container::vector::{RelocatableVec, Vector};
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary::CallbackProgression;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
@@ -25,6 +26,7 @@ use crate::{
     identifiers::{UniqueClientId, UniqueNodeId, UniquePortId, UniqueServerId},
     port::details::data_segment::DataSegmentType,
     port::port_name::PortName,
+    port::statistics::{PortStatistics, PortStatisticsCounters},
 };
 
 use super::PortCleanupAction;
@@ -55,6 +57,9 @@ pub struct ServerDetails {
     /// [`DataSegmentType::Dynamic`] it defines how many segment the
     /// [`Server`](crate::port::server::Server) can have at most.
     pub max_number_of_segments: u8,
+    /// Defines if the [`Server`](crate::port::server::Server) has a wake up channel that the
+    /// [`Client`](crate::port::client::Client) signals after every delivered request.
+    pub has_wake_up_channel: bool,
 }
 
 /// Contains the communication settings of the connected
@@ -103,6 +108,8 @@ pub(crate) struct DynamicConfigSettings {
 pub struct DynamicConfig {
     pub(crate) servers: Container<ServerDetails>,
     pub(crate) clients: Container<ClientDetails>,
+    // the statistics of a server are stored at the index of its container handle
+    server_statistics: RelocatableVec<PortStatisticsCounters>,
 }
 
 impl DynamicConfig {
@@ -110,6 +117,7 @@ impl DynamicConfig {
         Self {
             servers: unsafe { Container::new_uninit(config.number_of_servers) },
             clients: unsafe { Container::new_uninit(config.number_of_clients) },
+            server_statistics: unsafe { RelocatableVec::new_uninit(config.number_of_servers) },
         }
     }
 
@@ -121,12 +129,23 @@ impl DynamicConfig {
             fatal_panic!(from self,
             when self.clients.init(allocator),
             "This should never happen! Unable to initialize clients port id container.");
+            fatal_panic!(from self,
+            when self.server_statistics.init(allocator),
+            "This should never happen! Unable to initialize server statistics.");
+        }
+
+        while !self.server_statistics.is_full() {
+            unsafe {
+                self.server_statistics
+                    .push_unchecked(PortStatisticsCounters::default())
+            };
         }
     }
 
     pub(crate) fn memory_size(config: &DynamicConfigSettings) -> usize {
         Container::<ServerDetails>::memory_size(config.number_of_servers)
             + Container::<ClientDetails>::memory_size(config.number_of_clients)
+            + RelocatableVec::<PortStatisticsCounters>::memory_size(config.number_of_servers)
     }
 
     /// Returns how many [`crate::port::client::Client`] ports are currently connected.
@@ -191,7 +210,16 @@ impl DynamicConfig {
         unsafe { self.servers.add(details, details.node_id.owner_id()).ok() }
     }
 
+    /// Returns the [`PortStatisticsCounters`] of the server with the provided handle. They
+    /// are reset, since the slot could have been used by a server of a dead node.
+    pub(crate) fn server_statistics_of(&self, handle: ContainerHandle) -> &PortStatisticsCounters {
+        let counters = &self.server_statistics[handle.index()];
+        counters.reset();
+        counters
+    }
+
     pub(crate) fn release_server_handle(&self, handle: ContainerHandle) {
+        self.server_statistics[handle.index()].reset();
         if let Err(e) = unsafe { self.servers.remove(handle, ReleaseMode::Default) } {
             error!(from self, "Unable to deregister server from service. This could indicate a corrupted system! [{e:?}]");
         }
@@ -207,6 +235,19 @@ impl DynamicConfig {
         state.for_each(|_, details| callback(details));
     }
 
+    /// Returns the accumulated [`PortStatistics`] of all connected
+    /// [`Server`](crate::port::server::Server)s.
+    pub fn server_statistics(&self) -> PortStatistics {
+        let mut statistics = PortStatistics::default();
+        let state = unsafe { self.servers.get_state() };
+        state.for_each(|index, _| {
+            statistics += self.server_statistics[index].load();
+            CallbackProgression::Continue
+        });
+
+        statistics
+    }
+
     /// Iterates over all [`Client`](crate::port::client::Client)s and calls the
     /// callback with the corresponding [`ClientDetails`].
     /// The callback shall return [`CallbackProgression::Continue`] when the iteration shall
@@ -33,6 +33,7 @@
 
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::{ClockType, Time, TimeBuilder};
 
 use crate::identifiers::{UniqueNodeId, UniquePublisherId};
 
@@ -44,6 +45,9 @@ pub struct Header {
     node_id: UniqueNodeId,
     publisher_port_id: UniquePublisherId,
     number_of_elements: u64,
+    sequence_number: u64,
+    send_timestamp: u64,
+    priority: u8,
 }
 
 impl Header {
@@ -56,9 +60,24 @@ impl Header {
             node_id,
             publisher_port_id,
             number_of_elements,
+            sequence_number: 0,
+            send_timestamp: 0,
+            priority: 0,
         }
     }
 
+    pub(crate) fn set_sequence_number(&mut self, value: u64) {
+        self.sequence_number = value;
+    }
+
+    pub(crate) fn set_send_timestamp(&mut self, timestamp: Time) {
+        self.send_timestamp = timestamp.as_duration().as_nanos() as u64;
+    }
+
+    pub(crate) fn set_priority(&mut self, value: u8) {
+        self.priority = value;
+    }
+
     /// Returns the [`UniqueNodeId`] of the source node that published the
     /// [`Sample`](crate::sample::Sample).
     pub fn node_id(&self) -> UniqueNodeId {
@@ -83,4 +102,40 @@ impl Header {
     pub fn number_of_elements(&self) -> u64 {
         self.number_of_elements
     }
+
+    /// Returns the sequence number of the [`Sample`](crate::sample::Sample). Every
+    /// [`Publisher`](crate::port::publisher::Publisher) numbers its sent samples consecutively,
+    /// starting from `0`. A gap between two received samples of the same
+    /// [`Publisher`](crate::port::publisher::Publisher) means that samples were lost.
+    pub fn sequence_number(&self) -> u64 {
+        self.sequence_number
+    }
+
+    /// Returns the priority of the [`Sample`](crate::sample::Sample) that was set with
+    /// [`SampleMut::set_priority()`](crate::sample_mut::SampleMut::set_priority()). The
+    /// default priority is `0`.
+    pub fn priority(&self) -> u8 {
+        self.priority
+    }
+
+    /// Returns the point in time, based on [`ClockType::Monotonic`], when the
+    /// [`Sample`](crate::sample::Sample) was sent. It is only available when the
+    /// [`Service`](crate::service::Service) was created with
+    /// [`enable_send_timestamps()`](crate::service::builder::publish_subscribe::Builder::enable_send_timestamps()),
+    /// otherwise [`None`] is returned. The end-to-end latency can be acquired with
+    /// [`Time::elapsed()`].
+    pub fn send_timestamp(&self) -> Option<Time> {
+        const NANOSECONDS_PER_SECOND: u64 = 1_000_000_000;
+        if self.send_timestamp == 0 {
+            return None;
+        }
+
+        Some(
+            TimeBuilder::new()
+                .clock_type(ClockType::Monotonic)
+                .seconds(self.send_timestamp / NANOSECONDS_PER_SECOND)
+                .nanoseconds((self.send_timestamp % NANOSECONDS_PER_SECOND) as u32)
+                .create(),
+        )
+    }
 }
@@ -10,9 +10,12 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+use core::time::Duration;
+
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
-use iceoryx2_cal::zero_copy_connection::ChannelId;
+use iceoryx2_bb_posix::unique_system_id::UniqueSystemId;
+use iceoryx2_cal::zero_copy_connection::{CHANNEL_STATE_CLOSED, ChannelId};
 
 use crate::{
     active_request::RequestId,
@@ -29,8 +32,12 @@ pub struct RequestHeader {
     pub(crate) channel_id: ChannelId,
     pub(crate) request_id: RequestId,
     pub(crate) number_of_elements: u64,
+    pub(crate) deadline: u64,
 }
 
+/// Marks a [`RequestHeader`] without a deadline.
+pub(crate) const NO_DEADLINE: u64 = u64::MAX;
+
 impl RequestHeader {
     /// Returns the [`UniqueClientId`] of the [`Client`](crate::port::client::Client)
     /// which sent the [`RequestMut`](crate::request_mut::RequestMut)
@@ -56,6 +63,41 @@ impl RequestHeader {
     pub fn node_id(&self) -> UniqueNodeId {
         self.node_id
     }
+
+    /// Returns the deadline of the [`RequestMut`](crate::request_mut::RequestMut) as point in
+    /// time of the monotonic clock or [`None`] when no deadline was set, see
+    /// [`RequestMutUninit::set_deadline()`](crate::request_mut_uninit::RequestMutUninit::set_deadline()).
+    pub fn deadline(&self) -> Option<Duration> {
+        if self.deadline == NO_DEADLINE {
+            None
+        } else {
+            Some(Duration::from_nanos(self.deadline))
+        }
+    }
+}
+
+/// The maximum number of identical requests that can be served by a single
+/// [`Response`](crate::response::Response) when the
+/// [`Server`](crate::port::server::Server) coalesces requests, see
+/// [`PortFactoryServer::enable_request_coalescing()`](crate::service::port_factory::server::PortFactoryServer::enable_request_coalescing()).
+pub const MAX_NUMBER_OF_COALESCED_REQUESTS: usize = 4;
+
+/// Identifies one request that is served by a coalesced
+/// [`Response`](crate::response::Response).
+#[derive(Debug, Copy, Clone, PartialEq, Eq, ZeroCopySend)]
+#[repr(C)]
+pub(crate) struct CoalescedRequestId {
+    pub(crate) client_id: UniqueClientId,
+    pub(crate) request_id: RequestId,
+}
+
+impl Default for CoalescedRequestId {
+    fn default() -> Self {
+        Self {
+            client_id: UniqueClientId(UniqueSystemId::from(0)),
+            request_id: CHANNEL_STATE_CLOSED,
+        }
+    }
 }
 
 /// Response header used by
@@ -67,6 +109,8 @@ pub struct ResponseHeader {
     pub(crate) server_id: UniqueServerId,
     pub(crate) request_id: RequestId,
     pub(crate) number_of_elements: u64,
+    pub(crate) number_of_coalesced_requests: u64,
+    pub(crate) coalesced_requests: [CoalescedRequestId; MAX_NUMBER_OF_COALESCED_REQUESTS],
 }
 
 impl ResponseHeader {
@@ -95,4 +139,42 @@ impl ResponseHeader {
     pub fn number_of_elements(&self) -> u64 {
         self.number_of_elements
     }
+
+    /// Returns the number of requests that are served by this
+    /// [`Response`](crate::response::Response). It is `0` when the
+    /// [`Server`](crate::port::server::Server) did not coalesce the request, otherwise it
+    /// counts the original request plus all identical requests that were attached to it.
+    pub fn number_of_coalesced_requests(&self) -> usize {
+        self.number_of_coalesced_requests as usize
+    }
+
+    pub(crate) fn new(
+        node_id: UniqueNodeId,
+        server_id: UniqueServerId,
+        request_id: RequestId,
+        number_of_elements: u64,
+    ) -> Self {
+        Self {
+            node_id,
+            server_id,
+            request_id,
+            number_of_elements,
+            number_of_coalesced_requests: 0,
+            coalesced_requests: [CoalescedRequestId::default(); MAX_NUMBER_OF_COALESCED_REQUESTS],
+        }
+    }
+
+    /// Returns true when the response is addressed to the request with the provided
+    /// [`RequestId`] of the [`Client`](crate::port::client::Client) with the provided
+    /// [`UniqueClientId`]. A coalesced response must match the client as well, since the
+    /// [`RequestId`]s of different clients are independent of each other.
+    pub(crate) fn is_addressed_to(&self, client_id: UniqueClientId, request_id: RequestId) -> bool {
+        if self.number_of_coalesced_requests == 0 {
+            return self.request_id == request_id;
+        }
+
+        self.coalesced_requests[..self.number_of_coalesced_requests as usize]
+            .iter()
+            .any(|r| r.client_id == client_id && r.request_id == request_id)
+    }
 }
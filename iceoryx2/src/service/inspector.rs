@@ -0,0 +1,284 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+use alloc::vec::Vec;
+
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_cal::dynamic_storage::DynamicStorage;
+use iceoryx2_cal::zero_copy_connection::common::details::SharedManagementData;
+
+use crate::config::Config;
+use crate::identifiers::{UniqueNodeId, UniquePortId};
+use crate::service::service_hash::ServiceHash;
+use crate::service::static_config::StaticConfig;
+use crate::service::static_config::messaging_pattern::MessagingPattern;
+use crate::service::{
+    Service, ServiceDetailsError, open_dynamic_config, read_static_service_config,
+};
+
+use super::dynamic_config::{
+    DynamicConfig, blackboard, event, publish_subscribe, request_response,
+};
+
+/// The estimated shared memory footprint of a port in bytes, see
+/// [`ServiceInspector::memory_footprint()`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct PortMemoryFootprint {
+    /// The [`UniquePortId`] of the port.
+    pub port_id: UniquePortId,
+    /// The size of the data segment the port loans its samples from. For ports with a
+    /// dynamic data segment it is the size of the current segment, additional segments can
+    /// be allocated when it is exhausted.
+    pub data_segment: usize,
+    /// The management data of the connections to all receivers of the port.
+    pub connections: usize,
+}
+
+/// The estimated shared memory footprint of a [`Service`] in bytes, acquired with
+/// [`ServiceInspector::memory_footprint()`]. The overhead of the underlying shared memory
+/// concept, like the alignment to the page size, is not contained.
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct ServiceMemoryFootprint {
+    /// The size of the dynamic config, which is determined by the configured maximum number
+    /// of nodes and ports.
+    pub dynamic_config: usize,
+    /// The footprint of every port that owns shared memory. Only the
+    /// [`Publisher`](crate::port::publisher::Publisher)s of a
+    /// [`MessagingPattern::PublishSubscribe`](crate::service::messaging_pattern::MessagingPattern::PublishSubscribe)
+    /// service are covered.
+    pub ports: Vec<PortMemoryFootprint>,
+}
+
+impl ServiceMemoryFootprint {
+    /// Returns the accumulated size of the data segments of all ports.
+    pub fn data_segments(&self) -> usize {
+        self.ports.iter().map(|port| port.data_segment).sum()
+    }
+
+    /// Returns the accumulated size of the connections of all ports.
+    pub fn connections(&self) -> usize {
+        self.ports.iter().map(|port| port.connections).sum()
+    }
+
+    /// Returns the accumulated size of the dynamic config, the data segments and the
+    /// connections.
+    pub fn total(&self) -> usize {
+        self.dynamic_config + self.data_segments() + self.connections()
+    }
+}
+
+/// A read-only view of the static and dynamic configuration of an existing [`Service`],
+/// acquired with [`Service::inspect()`].
+///
+/// In contrast to a port factory, the [`Node`](crate::node::Node) is not registered at the
+/// [`Service`]. The inspector does not occupy one of the `max_nodes` slots and does not
+/// keep the [`Service`] alive, therefore it is suited to monitor a large number of
+/// [`Service`]s.
+///
+/// # Example
+///
+/// ```
+/// use iceoryx2::prelude::*;
+/// use iceoryx2::config::Config;
+///
+/// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+/// let node = NodeBuilder::new().create::<ipc::Service>()?;
+/// let service_name = ServiceName::new("My/Funk/ServiceName")?;
+/// let _service = node.service_builder(&service_name)
+///     .publish_subscribe::<u64>()
+///     .open_or_create()?;
+///
+/// if let Some(inspector) = ipc::Service::inspect(
+///     &service_name,
+///     Config::global_config(),
+///     MessagingPattern::PublishSubscribe,
+/// )? {
+///     if let Some(dynamic_config) = inspector.publish_subscribe() {
+///         println!("number of publishers: {}", dynamic_config.number_of_publishers());
+///     }
+/// }
+/// # Ok(())
+/// # }
+/// ```
+#[derive(Debug)]
+pub struct ServiceInspector<S: Service> {
+    static_config: StaticConfig,
+    dynamic_storage: S::DynamicStorage<DynamicConfig>,
+}
+
+impl<S: Service> ServiceInspector<S> {
+    /// Returns [`None`] when the [`Service`] or its dynamic configuration does not exist.
+    pub(crate) fn open(
+        config: &Config,
+        service_hash: &ServiceHash,
+    ) -> Result<Option<Self>, ServiceDetailsError> {
+        let static_config = match read_static_service_config::<S>(config, service_hash)? {
+            Some(static_config) => static_config,
+            None => return Ok(None),
+        };
+
+        Ok(
+            open_dynamic_config::<S>(config, static_config.unique_service_id())?.map(
+                |dynamic_storage| Self {
+                    static_config,
+                    dynamic_storage,
+                },
+            ),
+        )
+    }
+
+    /// Returns the [`StaticConfig`] of the [`Service`].
+    pub fn static_config(&self) -> &StaticConfig {
+        &self.static_config
+    }
+
+    /// Calls the callback with the [`UniqueNodeId`] of every [`Node`](crate::node::Node)
+    /// that is registered at the [`Service`].
+    pub fn list_node_ids<F: FnMut(&UniqueNodeId) -> CallbackProgression>(&self, callback: F) {
+        self.dynamic_storage.get().list_node_ids(callback)
+    }
+
+    /// Returns the dynamic configuration when the [`Service`] is a
+    /// [`MessagingPattern::PublishSubscribe`](crate::service::messaging_pattern::MessagingPattern::PublishSubscribe)
+    /// service.
+    pub fn publish_subscribe(&self) -> Option<&publish_subscribe::DynamicConfig> {
+        match self.static_config.messaging_pattern() {
+            MessagingPattern::PublishSubscribe(_) => {
+                Some(self.dynamic_storage.get().publish_subscribe())
+            }
+            _ => None,
+        }
+    }
+
+    /// Returns the dynamic configuration when the [`Service`] is a
+    /// [`MessagingPattern::Event`](crate::service::messaging_pattern::MessagingPattern::Event)
+    /// service.
+    pub fn event(&self) -> Option<&event::DynamicConfig> {
+        match self.static_config.messaging_pattern() {
+            MessagingPattern::Event(_) => Some(self.dynamic_storage.get().event()),
+            _ => None,
+        }
+    }
+
+    /// Returns the dynamic configuration when the [`Service`] is a
+    /// [`MessagingPattern::RequestResponse`](crate::service::messaging_pattern::MessagingPattern::RequestResponse)
+    /// service.
+    pub fn request_response(&self) -> Option<&request_response::DynamicConfig> {
+        match self.static_config.messaging_pattern() {
+            MessagingPattern::RequestResponse(_) => {
+                Some(self.dynamic_storage.get().request_response())
+            }
+            _ => None,
+        }
+    }
+
+    /// Returns the dynamic configuration when the [`Service`] is a
+    /// [`MessagingPattern::Blackboard`](crate::service::messaging_pattern::MessagingPattern::Blackboard)
+    /// service.
+    pub fn blackboard(&self) -> Option<&blackboard::DynamicConfig> {
+        match self.static_config.messaging_pattern() {
+            MessagingPattern::Blackboard(_) => Some(self.dynamic_storage.get().blackboard()),
+            _ => None,
+        }
+    }
+
+    /// Estimates the shared memory footprint of the [`Service`] from its configuration and
+    /// the currently connected ports.
+    pub fn memory_footprint(&self) -> ServiceMemoryFootprint {
+        let mut footprint = ServiceMemoryFootprint {
+            dynamic_config: self.dynamic_config_memory_size(),
+            ports: Vec::new(),
+        };
+
+        let MessagingPattern::PublishSubscribe(static_config) =
+            self.static_config.messaging_pattern()
+        else {
+            return footprint;
+        };
+
+        let dynamic_config = self.dynamic_storage.get().publish_subscribe();
+        let mut buffer_sizes = Vec::new();
+        dynamic_config.list_subscribers(|details| {
+            buffer_sizes.push(details.buffer_size);
+            CallbackProgression::Continue
+        });
+
+        dynamic_config.list_publishers(|details| {
+            let sample_size = static_config
+                .message_type_details()
+                .sample_layout(details.max_slice_len)
+                .size();
+            let connections = buffer_sizes
+                .iter()
+                .map(|buffer_size| {
+                    SharedManagementData::required_memory_size(
+                        *buffer_size,
+                        static_config.subscriber_max_borrowed_samples,
+                        details.number_of_samples,
+                        details.max_number_of_segments,
+                        1,
+                    )
+                })
+                .sum();
+
+            footprint.ports.push(PortMemoryFootprint {
+                port_id: UniquePortId::Publisher(details.publisher_id),
+                data_segment: details.number_of_samples * sample_size,
+                connections,
+            });
+            CallbackProgression::Continue
+        });
+
+        footprint
+    }
+
+    fn dynamic_config_memory_size(&self) -> usize {
+        let (max_nodes, messaging_pattern_size) = match self.static_config.messaging_pattern() {
+            MessagingPattern::PublishSubscribe(c) => (
+                c.max_nodes,
+                publish_subscribe::DynamicConfig::memory_size(
+                    &publish_subscribe::DynamicConfigSettings {
+                        number_of_publishers: c.max_publishers,
+                        number_of_subscribers: c.max_subscribers,
+                    },
+                ),
+            ),
+            MessagingPattern::Event(c) => (
+                c.max_nodes,
+                event::DynamicConfig::memory_size(&event::DynamicConfigSettings {
+                    number_of_listeners: c.max_listeners,
+                    number_of_notifiers: c.max_notifiers,
+                }),
+            ),
+            MessagingPattern::RequestResponse(c) => (
+                c.max_nodes,
+                request_response::DynamicConfig::memory_size(
+                    &request_response::DynamicConfigSettings {
+                        number_of_clients: c.max_clients,
+                        number_of_servers: c.max_servers,
+                    },
+                ),
+            ),
+            MessagingPattern::Blackboard(c) => (
+                c.max_nodes,
+                blackboard::DynamicConfig::memory_size(&blackboard::DynamicConfigSettings {
+                    number_of_writers: c.max_writers,
+                    number_of_readers: c.max_readers,
+                }),
+            ),
+        };
+
+        core::mem::size_of::<DynamicConfig>()
+            + DynamicConfig::memory_size(max_nodes)
+            + messaging_pattern_size
+    }
+}
@@ -30,6 +30,40 @@
 //! # }
 //! ```
 //!
+//! ## Share one Publisher between Threads
+//!
+//! The ports of this service variant implement [`Send`] and [`Sync`]. Multiple producer threads
+//! can therefore share a single [`Publisher`](crate::port::publisher::Publisher) instead of
+//! creating one port per thread, which would quickly exhaust the `max_publishers` limit.
+//!
+//! ```
+//! use iceoryx2::prelude::*;
+//!
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! let node = NodeBuilder::new().create::<local_threadsafe::Service>()?;
+//!
+//! let service = node.service_builder(&"My/Funk/SharedPublisher".try_into()?)
+//!     .publish_subscribe::<u64>()
+//!     .open_or_create()?;
+//!
+//! let publisher = service.publisher_builder().create()?;
+//! let subscriber = service.subscriber_builder().create()?;
+//!
+//! std::thread::scope(|s| {
+//!     for value in 0..4 {
+//!         let publisher = &publisher;
+//!         s.spawn(move || publisher.send_copy(value).expect("failed to send sample"));
+//!     }
+//! });
+//!
+//! while let Some(sample) = subscriber.receive()? {
+//!     println!("received: {}", *sample);
+//! }
+//!
+//! # Ok(())
+//! # }
+//! ```
+//!
 //! See [`Service`](crate::service) for more detailed examples.
 
 use core::fmt::Debug;
@@ -46,6 +46,7 @@
 //! [`Reader`](crate::port::reader::Reader)s. Updates and reads are made on a key basis, not
 //! on the entire shared memory.
 
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use serde::{Deserialize, Serialize};
 
 /// Identifies the kind of messaging pattern the [`Service`](crate::service::Service) will use.
@@ -73,3 +74,6 @@ pub enum MessagingPattern {
     /// [`Reader`](crate::port::reader::Reader)s.
     Blackboard,
 }
+
+// a field-less enum with a fixed representation can be shared between processes
+unsafe impl ZeroCopySend for MessagingPattern {}
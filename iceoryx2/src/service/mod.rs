@@ -202,9 +202,18 @@ pub(crate) mod stale_resource_cleanup;
 /// The builder to create or open [`Service`]s
 pub mod builder;
 
+/// A persistent copy of the values of a
+/// [`MessagingPattern::Blackboard`](crate::service::messaging_pattern::MessagingPattern::Blackboard)
+/// based [`Service`]
+pub mod blackboard_snapshot;
+
 /// The dynamic configuration of a [`Service`]
 pub mod dynamic_config;
 
+/// A read-only view of an existing [`Service`] that does not register the
+/// [`Node`](crate::node::Node) at the [`Service`]
+pub mod inspector;
+
 /// Defines the sample headers for various
 /// [`MessagingPattern`]s
 pub mod header;
@@ -257,8 +266,8 @@ use core::fmt::Debug;
 use core::ptr::NonNull;
 use core::time::Duration;
 
+use alloc::collections::BTreeMap;
 use alloc::format;
-use alloc::string::String as CoreString;
 use alloc::sync::Arc;
 use alloc::vec;
 use alloc::vec::Vec;
@@ -271,7 +280,8 @@ use iceoryx2_bb_posix::file::AccessMode;
 
 use crate::config;
 use crate::identifiers::UniqueServiceId;
-use crate::node::{NodeListFailure, NodeState, SharedNode};
+use crate::node::global_management_segment::GlobalManagementSegment;
+use crate::node::{DeadNodeView, NodeListFailure, NodeState, SharedNode};
 use crate::service::config_scheme::dynamic_config_storage_config;
 use crate::service::dynamic_config::DynamicConfig;
 use crate::service::naming_scheme::dynamic_config_name;
@@ -286,7 +296,10 @@ use crate::service::static_config::*;
 use crate::{
     identifiers::{UniqueNodeId, UniquePortId},
     node::NodeBuilder,
-    port::{listener::remove_connection_of_listener, notifier::Notifier},
+    port::{
+        listener::remove_connection_of_listener, notifier::Notifier,
+        wake_up_channel::remove_wake_up_channel_of_receiver,
+    },
     prelude::EventId,
     service::stale_resource_cleanup::{remove_port_tag, remove_receiver_port_from_all_connections},
 };
@@ -628,6 +641,7 @@ pub mod internal {
             NotifierConfig {
                 default_event_id: EventId::new(0),
                 port_name: PortName::new_empty(),
+                coalescing_window: None,
             },
         ) {
             Ok(notifier) => notifier,
@@ -882,6 +896,13 @@ pub mod internal {
                             debug!(from origin, "Failed to remove the subscriber ({:?}) from all of its connections ({:?}).", id, e);
                             return PortCleanupAction::SkipPort;
                         }
+
+                        if let Err(e) =
+                            unsafe { remove_wake_up_channel_of_receiver::<S>(id.value(), config) }
+                        {
+                            debug!(from origin, "Failed to remove the wake up channel of the subscriber ({:?}) ({:?}).", id, e);
+                            return PortCleanupAction::SkipPort;
+                        }
                     }
                     UniquePortId::Notifier(_) => {
                         number_of_dead_node_notifications += 1;
@@ -915,6 +936,13 @@ pub mod internal {
                         {
                             return PortCleanupAction::SkipPort;
                         }
+
+                        if let Err(e) =
+                            unsafe { remove_wake_up_channel_of_receiver::<S>(id.value(), config) }
+                        {
+                            debug!(from origin, "Failed to remove the wake up channel of the server ({:?}) ({:?}).", id, e);
+                            return PortCleanupAction::SkipPort;
+                        }
                     }
                     UniquePortId::Reader(ref _id) => {}
                     UniquePortId::Writer(ref _id) => {}
@@ -1030,7 +1058,9 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> + Clone {
     /// Defines the construct used to store the payload data of the blackboard service.
     type BlackboardPayload: SharedMemory<BumpAllocator>;
 
-    /// Checks if a service under a given [`config::Config`] does exist
+    /// Checks if a service under a given [`config::Config`] does exist. In contrast to
+    /// [`Service::details()`] only the existence of the static service information is verified,
+    /// the content, the dynamic service information and the [`NodeState`]s are not acquired.
     ///
     /// # Example
     ///
@@ -1053,7 +1083,9 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> + Clone {
         config: &config::Config,
         messaging_pattern: MessagingPattern,
     ) -> Result<bool, ServiceDetailsError> {
-        Ok(Self::details(service_name, config, messaging_pattern)?.is_some())
+        let service_hash =
+            ServiceHash::new::<Self::ServiceNameHasher>(service_name, messaging_pattern);
+        __internal_does_exist::<Self>(config, &service_hash)
     }
 
     /// Acquires the [`ServiceDetails`] of a [`Service`].
@@ -1088,6 +1120,76 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> + Clone {
         __internal_details::<Self>(config, &service_hash)
     }
 
+    /// Opens a read-only [`ServiceInspector`](inspector::ServiceInspector) of an existing
+    /// [`Service`] to acquire its static and dynamic configuration, like the number of
+    /// connected ports. In contrast to opening the [`Service`] with a
+    /// [`Node`](crate::node::Node), no [`Node`](crate::node::Node) is registered at the
+    /// [`Service`]. Returns [`None`] when the [`Service`] does not exist.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// let name = ServiceName::new("Some/Name")?;
+    /// if let Some(inspector) =
+    ///     ipc::Service::inspect(&name, Config::global_config(), MessagingPattern::Event)?
+    /// {
+    ///     if let Some(dynamic_config) = inspector.event() {
+    ///         println!("number of listeners: {}", dynamic_config.number_of_listeners());
+    ///     }
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    fn inspect(
+        service_name: &ServiceName,
+        config: &config::Config,
+        messaging_pattern: MessagingPattern,
+    ) -> Result<Option<inspector::ServiceInspector<Self>>, ServiceDetailsError> {
+        let service_hash =
+            ServiceHash::new::<Self::ServiceNameHasher>(service_name, messaging_pattern);
+        inspector::ServiceInspector::open(config, &service_hash)
+    }
+
+    /// Opens a read-only [`ServiceInspector`](inspector::ServiceInspector) of the [`Service`]
+    /// with the provided [`ServiceHash`], e.g. one that was reported by
+    /// [`Service::list_service_hashes()`]. Returns [`None`] when the [`Service`] does not
+    /// exist.
+    fn inspect_from_service_hash(
+        config: &config::Config,
+        service_hash: &ServiceHash,
+    ) -> Result<Option<inspector::ServiceInspector<Self>>, ServiceDetailsError> {
+        inspector::ServiceInspector::open(config, service_hash)
+    }
+
+    /// Returns the number of bytes the data segments of the domain, defined by the
+    /// [`config::Global::prefix`], currently reserve from the
+    /// [`config::Global::shared_memory_quota`]. Returns [`None`] when no quota is configured,
+    /// since the data segments are only accounted when it is.
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// let mut config = Config::default();
+    /// config.global.shared_memory_quota = Some(64 * 1024 * 1024);
+    ///
+    /// if let Some(reserved) = ipc::Service::reserved_shared_memory(&config) {
+    ///     println!("reserved shared memory: {reserved} bytes");
+    /// }
+    /// ```
+    fn reserved_shared_memory(config: &config::Config) -> Option<usize> {
+        config.global.shared_memory_quota?;
+        GlobalManagementSegment::<Self>::open_or_create(config)
+            .ok()
+            .map(|segment| segment.reserved_shared_memory())
+    }
+
     /// Returns a list of all services created under a given [`config::Config`].
     ///
     /// # Example
@@ -1107,9 +1209,44 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> + Clone {
     fn list<F: FnMut(ServiceDetails<Self>) -> CallbackProgression>(
         config: &config::Config,
         mut callback: F,
+    ) -> Result<(), ServiceListError> {
+        // nodes are usually attached to many services, acquire the state of every node only
+        // once instead of once per service
+        let mut node_states = BTreeMap::new();
+        Self::list_service_hashes(config, |hash| {
+            match details_with_node_state_cache::<Self>(config, &hash, &mut node_states) {
+                Ok(Some(service_details)) => callback(service_details),
+                _ => CallbackProgression::Continue,
+            }
+        })
+    }
+
+    /// Calls the callback with the [`ServiceHash`] of every service created under a given
+    /// [`config::Config`]. In contrast to [`Service::list()`] the [`ServiceDetails`] are not
+    /// acquired, therefore it is cheap enough to detect added and removed services by
+    /// comparing the [`ServiceHash`]es of consecutive calls. The [`ServiceDetails`] of a
+    /// newly detected service can be acquired with [`Service::details_from_service_hash()`].
+    ///
+    /// # Example
+    ///
+    /// ```
+    /// use iceoryx2::prelude::*;
+    /// use iceoryx2::config::Config;
+    ///
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// ipc::Service::list_service_hashes(Config::global_config(), |service_hash| {
+    ///     println!("{}", service_hash.as_str());
+    ///     CallbackProgression::Continue
+    /// })?;
+    /// # Ok(())
+    /// # }
+    /// ```
+    fn list_service_hashes<F: FnMut(ServiceHash) -> CallbackProgression>(
+        config: &config::Config,
+        mut callback: F,
     ) -> Result<(), ServiceListError> {
         let msg = "Unable to list all services";
-        let origin = "Service::list_from_config()";
+        let origin = "Service::list_service_hashes()";
         let static_storage_config = config_scheme::static_config_storage_config::<Self>(config);
 
         let service_uuids = fail!(from origin,
@@ -1127,21 +1264,70 @@ pub trait Service: Debug + Sized + internal::ServiceInternal<Self> + Clone {
                     continue;
                 }
             };
-            if let Ok(Some(service_details)) = __internal_details::<Self>(config, &hash) {
-                if callback(service_details) == CallbackProgression::Stop {
-                    break;
-                }
+            if callback(hash) == CallbackProgression::Stop {
+                break;
             }
         }
 
         Ok(())
     }
+
+    /// Acquires the [`ServiceDetails`] of the [`Service`] with the provided [`ServiceHash`],
+    /// e.g. one that was reported by [`Service::list_service_hashes()`].
+    fn details_from_service_hash(
+        config: &config::Config,
+        service_hash: &ServiceHash,
+    ) -> Result<Option<ServiceDetails<Self>>, ServiceDetailsError> {
+        __internal_details::<Self>(config, service_hash)
+    }
+}
+
+#[doc(hidden)]
+pub fn __internal_does_exist<S: Service>(
+    config: &config::Config,
+    service_hash: &ServiceHash,
+) -> Result<bool, ServiceDetailsError> {
+    let msg = "Unable to check if the service exists";
+    let origin = "Service::does_exist()";
+    let static_storage_config = config_scheme::static_config_storage_config::<S>(config);
+    let name = static_config_name(service_hash);
+
+    match <S::StaticStorage as NamedConceptMgmt>::does_exist_cfg(&name, &static_storage_config) {
+        Ok(does_exist) => Ok(does_exist),
+        Err(NamedConceptDoesExistError::UnderlyingResourcesBeingSetUp) => Ok(false),
+        Err(NamedConceptDoesExistError::Interrupt) => {
+            fail!(from origin, with ServiceDetailsError::Interrupt,
+                "{msg} since an interrupt signal was raised while checking the static service info \"{name}\".");
+        }
+        Err(NamedConceptDoesExistError::InsufficientPermissions) => {
+            fail!(from origin, with ServiceDetailsError::InsufficientPermissions,
+                "{msg} since the process does not have the permission to access the static service info \"{name}\".");
+        }
+        Err(NamedConceptDoesExistError::UnderlyingResourcesCorrupted) => {
+            fail!(from origin, with ServiceDetailsError::ServiceInInconsistentState,
+                "{msg} since the static service info \"{name}\" is corrupted.");
+        }
+        Err(NamedConceptDoesExistError::InternalError) => {
+            fail!(from origin, with ServiceDetailsError::InternalError,
+                "{msg} due to an internal failure while checking the static service info \"{name}\".");
+        }
+    }
 }
 
 #[doc(hidden)]
 pub fn __internal_details<S: Service>(
     config: &config::Config,
     service_hash: &ServiceHash,
+) -> Result<Option<ServiceDetails<S>>, ServiceDetailsError> {
+    details_with_node_state_cache(config, service_hash, &mut BTreeMap::new())
+}
+
+/// Acquires the [`ServiceDetails`] and reuses the [`NodeState`]s in `node_states` that were
+/// already acquired for other services.
+fn details_with_node_state_cache<S: Service>(
+    config: &config::Config,
+    service_hash: &ServiceHash,
+    node_states: &mut BTreeMap<UniqueNodeId, Option<NodeState<S>>>,
 ) -> Result<Option<ServiceDetails<S>>, ServiceDetailsError> {
     let msg = "Unable to acquire service details";
     let origin = "Service::details()";
@@ -1158,11 +1344,21 @@ pub fn __internal_details<S: Service>(
     let dynamic_details = if let Some(d) = dynamic_config {
         let mut nodes = vec![];
         d.get().list_node_ids(|node_id| {
+            if let Some(state) = node_states.get(node_id) {
+                if let Some(state) = state {
+                    nodes.push(state.clone());
+                }
+                return CallbackProgression::Continue;
+            }
+
             match NodeState::new(node_id, config) {
-                Ok(Some(state)) => nodes.push(state),
-                Ok(None)
-                | Err(NodeListFailure::InsufficientPermissions)
-                | Err(NodeListFailure::Interrupt) => (),
+                Ok(state) => {
+                    if let Some(state) = &state {
+                        nodes.push(state.clone());
+                    }
+                    node_states.insert(*node_id, state);
+                }
+                Err(NodeListFailure::InsufficientPermissions) | Err(NodeListFailure::Interrupt) => (),
                 Err(NodeListFailure::InternalError) => {
                     debug!(from origin, "Unable to acquire NodeState for service \"{:?}\"", service_hash);
                 }
@@ -1180,6 +1376,32 @@ pub fn __internal_details<S: Service>(
     }))
 }
 
+/// Returns all dead nodes of the [`Service`]. In contrast to [`__internal_details()`] the
+/// details of the nodes that are alive are not acquired.
+pub(crate) fn dead_nodes_of_service<S: Service>(
+    config: &config::Config,
+    service_hash: &ServiceHash,
+) -> Result<Vec<DeadNodeView<S>>, ServiceDetailsError> {
+    let service_config = match read_static_service_config::<S>(config, service_hash)? {
+        Some(c) => c,
+        None => return Ok(vec![]),
+    };
+
+    let mut dead_nodes = vec![];
+    if let Some(dynamic_config) =
+        open_dynamic_config::<S>(config, service_config.unique_service_id())?
+    {
+        dynamic_config.get().list_node_ids(|node_id| {
+            if let Some(node) = DeadNodeView::new_if_dead(node_id, config) {
+                dead_nodes.push(node);
+            }
+            CallbackProgression::Continue
+        });
+    }
+
+    Ok(dead_nodes)
+}
+
 fn read_static_service_config<S: Service>(
     config: &config::Config,
     service_hash: &ServiceHash,
@@ -1217,8 +1439,8 @@ fn read_static_service_config<S: Service>(
         }
     };
 
-    let mut content = CoreString::from_utf8(vec![b' '; reader.len() as usize]).unwrap();
-    match reader.read(unsafe { content.as_mut_vec().as_mut_slice() }) {
+    let mut content = vec![0u8; reader.len() as usize];
+    match reader.read(content.as_mut_slice()) {
         Ok(_) => (),
         Err(StaticStorageReadError::Interrupt) => {
             fail!(from origin, with ServiceDetailsError::Interrupt,
@@ -1232,15 +1454,14 @@ fn read_static_service_config<S: Service>(
         }
     }
 
-    let service_config =
-        match S::ConfigSerializer::deserialize::<StaticConfig>(unsafe { content.as_mut_vec() }) {
-            Ok(service_config) => service_config,
-            Err(e) => {
-                fail!(from origin, with ServiceDetailsError::FailedToDeserializeStaticServiceInfo,
+    let service_config = match S::ConfigSerializer::deserialize::<StaticConfig>(&content) {
+        Ok(service_config) => service_config,
+        Err(e) => {
+            fail!(from origin, with ServiceDetailsError::FailedToDeserializeStaticServiceInfo,
                     "{} since the static service info \"{}\" could not be deserialized ({:?}).",
                        msg, name, e );
-            }
-        };
+        }
+    };
 
     if service_hash != service_config.service_hash() {
         fail!(from origin, with ServiceDetailsError::ServiceInInconsistentState,
@@ -47,6 +47,14 @@ pub(crate) fn event_concept_name(listener_id: &UniqueListenerId) -> FileName {
                  "{}", msg)
 }
 
+pub(crate) fn receiver_wake_up_name(receiver_port_id: u128) -> FileName {
+    let msg = "The system does not support the required file name length for the receivers wake up event concept name.";
+    let origin = "receiver_wake_up_name()";
+    fatal_panic!(from origin,
+                 when FileName::new(receiver_port_id.to_string().as_bytes()),
+                 "{}", msg)
+}
+
 pub(crate) fn connection_name(sender_port_id: u128, receiver_port_id: u128) -> FileName {
     let mut file = FileName::new(sender_port_id.to_string().as_bytes()).unwrap();
     file.push(b'_').unwrap();
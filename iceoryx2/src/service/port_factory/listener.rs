@@ -37,6 +37,7 @@ use super::event::PortFactory;
 #[derive(Debug, Clone)]
 pub(crate) struct ListenerConfig {
     pub(crate) port_name: PortName,
+    pub(crate) track_wake_up_latency: bool,
 }
 
 /// Factory to create a new [`Listener`] port/endpoint for
@@ -56,6 +57,7 @@ impl<'factory, Service: service::Service> PortFactoryListener<'factory, Service>
             factory,
             config: ListenerConfig {
                 port_name: PortName::new_empty(),
+                track_wake_up_latency: false,
             },
         }
     }
@@ -66,6 +68,14 @@ impl<'factory, Service: service::Service> PortFactoryListener<'factory, Service>
         self
     }
 
+    /// Defines if the [`Listener`] records the time from a notification until it woke up, see
+    /// [`wake_up_latency`](crate::port::wake_up_latency) for details. While a tracking
+    /// [`Listener`] exists, every notification of the service acquires the current time.
+    pub fn track_wake_up_latency(mut self, value: bool) -> Self {
+        self.config.track_wake_up_latency = value;
+        self
+    }
+
     /// Creates the [`Listener`] port or returns a [`ListenerCreateError`] on failure.
     pub fn create(self) -> Result<Listener<Service>, ListenerCreateError> {
         Ok(
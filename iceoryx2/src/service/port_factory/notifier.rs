@@ -29,6 +29,7 @@
 //! # }
 //! ```
 use core::fmt::Debug;
+use core::time::Duration;
 
 use crate::port::{
     event_id::EventId, notifier::Notifier, notifier::NotifierCreateError, port_name::PortName,
@@ -43,6 +44,7 @@ use super::event::PortFactory;
 pub(crate) struct NotifierConfig {
     pub(crate) default_event_id: EventId,
     pub(crate) port_name: PortName,
+    pub(crate) coalescing_window: Option<Duration>,
 }
 
 /// Factory to create a new [`Notifier`] port/endpoint for
@@ -63,6 +65,7 @@ impl<'factory, Service: service::Service> PortFactoryNotifier<'factory, Service>
             config: NotifierConfig {
                 default_event_id: EventId::default(),
                 port_name: PortName::new_empty(),
+                coalescing_window: None,
             },
         }
     }
@@ -80,6 +83,20 @@ impl<'factory, Service: service::Service> PortFactoryNotifier<'factory, Service>
         self
     }
 
+    /// Merges all notifications that are sent within the provided window after a delivered
+    /// notification into one trigger, so that a [`Listener`](crate::port::listener::Listener)
+    /// is woken up at most once per window. The held back notifications are delivered with
+    /// the first notification after the window has ended, with
+    /// [`Notifier::deliver_pending_notifications()`] or when the [`Notifier`] is dropped.
+    /// A notification that is held back reports zero notified listeners.
+    ///
+    /// When the service defines a deadline, the window is limited to the deadline so that
+    /// the deadline contract still holds.
+    pub fn coalescing_window(mut self, value: Duration) -> Self {
+        self.config.coalescing_window = Some(value);
+        self
+    }
+
     /// Creates a new [`Notifier`] port or returns a [`NotifierCreateError`] on failure.
     pub fn create(self) -> Result<Notifier<Service>, NotifierCreateError> {
         Ok(
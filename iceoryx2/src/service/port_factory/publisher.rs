@@ -58,6 +58,7 @@ use crate::{
     port::{
         BackpressureFn, BackpressureHandler, DegradationAction, DegradationFn, DegradationHandler,
         backpressure_strategy::BackpressureStrategy,
+        copy_strategy::CopyStrategy,
         port_name::PortName,
         publisher::{Publisher, PublisherCreateError},
     },
@@ -65,7 +66,12 @@ use crate::{
 };
 use alloc::format;
 use core::fmt::Debug;
+use core::time::Duration;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::adaptive_wait::AdaptiveWaitStrategy;
+use iceoryx2_bb_system_types::file_path::FilePath;
+use iceoryx2_cal::resizable_shared_memory::ShrinkPolicy;
+use iceoryx2_cal::shared_memory::{NumaPolicy, PageSize};
 use iceoryx2_cal::shm_allocator::AllocationStrategy;
 use iceoryx2_log::fail;
 use tiny_fn::tiny_fn;
@@ -98,8 +104,20 @@ impl<'a> Debug for PreallocatedSamplesOverride<'a> {
 pub(crate) struct LocalPublisherConfig {
     pub(crate) max_loaned_samples: usize,
     pub(crate) backpressure_strategy: BackpressureStrategy,
+    pub(crate) backpressure_wait_strategy: AdaptiveWaitStrategy,
+    pub(crate) backpressure_wake_up_timeout: Option<Duration>,
     pub(crate) initial_max_slice_len: usize,
     pub(crate) allocation_strategy: AllocationStrategy,
+    pub(crate) copy_strategy: CopyStrategy,
+    pub(crate) page_size: PageSize,
+    pub(crate) numa_policy: NumaPolicy,
+    pub(crate) typed_memory: Option<FilePath>,
+    pub(crate) prefault: bool,
+    pub(crate) lock_in_memory: bool,
+    pub(crate) chunk_cache_size: usize,
+    pub(crate) shrink_policy: ShrinkPolicy,
+    pub(crate) history_delivery_batch_size: usize,
+    pub(crate) enable_loan_from_last_sent: bool,
     pub(crate) port_name: PortName,
 }
 
@@ -170,6 +188,23 @@ impl<
                 initial_max_slice_len: 1,
                 max_loaned_samples: defaults.publisher_max_loaned_samples,
                 backpressure_strategy: defaults.backpressure_strategy,
+                backpressure_wait_strategy: factory
+                    .service
+                    .shared_node()
+                    .config()
+                    .global
+                    .backpressure_wait_strategy,
+                backpressure_wake_up_timeout: None,
+                copy_strategy: CopyStrategy::default(),
+                page_size: defaults.publisher_page_size,
+                numa_policy: NumaPolicy::Default,
+                typed_memory: None,
+                prefault: false,
+                lock_in_memory: false,
+                chunk_cache_size: 0,
+                shrink_policy: ShrinkPolicy::Never,
+                history_delivery_batch_size: usize::MAX,
+                enable_loan_from_last_sent: false,
                 port_name: PortName::new_empty(),
             },
             degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
@@ -214,6 +249,129 @@ impl<
         self
     }
 
+    /// Defines how the [`Publisher`] waits until a
+    /// [`crate::port::subscriber::Subscriber`] has space in its buffer when it uses
+    /// [`BackpressureStrategy::RetryUntilDelivered`]. On isolated cores a strategy that spins
+    /// longer reduces the latency, on shared cores a strategy that sleeps early reduces the
+    /// cpu load. By default it is set to the value of
+    /// [`crate::config::Global::backpressure_wait_strategy`].
+    pub fn backpressure_wait_strategy(mut self, value: AdaptiveWaitStrategy) -> Self {
+        self.config.backpressure_wait_strategy = value;
+        self
+    }
+
+    /// When [`BackpressureStrategy::RetryUntilDelivered`] is used and the buffer of a
+    /// [`crate::port::subscriber::Subscriber`] is full, the [`Publisher`] sleeps until the
+    /// [`crate::port::subscriber::Subscriber`] receives a sample instead of waiting with the
+    /// [`PortFactoryPublisher::backpressure_wait_strategy()`]. The
+    /// [`crate::port::subscriber::Subscriber`] wakes the [`Publisher`] up only when it is
+    /// sleeping. A single sleep lasts at most `timeout`, afterwards the [`Publisher`] checks the
+    /// buffer and calls the backpressure handler again.
+    ///
+    /// Only supported on linux, on other platforms the
+    /// [`PortFactoryPublisher::backpressure_wait_strategy()`] is used.
+    pub fn backpressure_wake_up(mut self, timeout: Duration) -> Self {
+        self.config.backpressure_wake_up_timeout = Some(timeout);
+        self
+    }
+
+    /// Sets the [`CopyStrategy`] that is used when the [`Publisher`] copies the payload into
+    /// the data segment, e.g. in [`Publisher::send_copy()`].
+    pub fn copy_strategy(mut self, value: CopyStrategy) -> Self {
+        self.config.copy_strategy = value;
+        self
+    }
+
+    /// Sets the [`PageSize`] of the pages that back the data segment of the [`Publisher`].
+    /// When huge pages are requested but not available, the [`Publisher`] falls back to
+    /// [`PageSize::Regular`].
+    pub fn page_size(mut self, value: PageSize) -> Self {
+        self.config.page_size = value;
+        self
+    }
+
+    /// Sets the [`NumaPolicy`] of the data segment of the [`Publisher`].
+    /// [`NumaPolicy::CreatingThreadNode`] is resolved when the [`Publisher`] is created so that
+    /// segments that are acquired later are placed on the same node. The effective policy is
+    /// published in the
+    /// [`PublisherDetails`](crate::service::dynamic_config::publish_subscribe::PublisherDetails).
+    pub fn numa_policy(mut self, value: NumaPolicy) -> Self {
+        self.config.numa_policy = value;
+        self
+    }
+
+    /// Allocates the data segment of the [`Publisher`] from the provided QNX typed memory
+    /// pool, for instance `/memory/below4G`, instead of the general purpose memory. On
+    /// platforms without typed memory the creation of the [`Publisher`] fails.
+    pub fn typed_memory(mut self, value: &FilePath) -> Self {
+        self.config.typed_memory = Some(*value);
+        self
+    }
+
+    /// Touches every page of the data segment and of the connections to the
+    /// [`crate::port::subscriber::Subscriber`]s when they are created, so that the first
+    /// [`Publisher::loan()`] or [`Publisher::send_copy()`] does not cause page faults. This moves
+    /// the cost of the page faults into the creation of the [`Publisher`] and the establishment
+    /// of new connections. By default it is disabled.
+    pub fn prefault(mut self, value: bool) -> Self {
+        self.config.prefault = value;
+        self
+    }
+
+    /// Locks the data segment and the connections to the
+    /// [`crate::port::subscriber::Subscriber`]s into memory so that they cannot be swapped out.
+    /// When the memory cannot be locked, e.g. since `RLIMIT_MEMLOCK` is exceeded, the creation
+    /// of the [`Publisher`] fails. By default it is disabled.
+    pub fn lock_in_memory(mut self, value: bool) -> Self {
+        self.config.lock_in_memory = value;
+        self
+    }
+
+    /// Defines how many released samples the [`Publisher`] keeps in a port-local cache. A
+    /// [`Publisher::loan()`] is served from this cache first and does not touch the allocator
+    /// of the shared data segment. The value is clamped to the number of samples of the data
+    /// segment. The cache is only used with [`AllocationStrategy::Static`]. By default it is
+    /// disabled.
+    pub fn chunk_cache_size(mut self, value: usize) -> Self {
+        self.config.chunk_cache_size = value;
+        self
+    }
+
+    /// Sets the [`ShrinkPolicy`] of the data segment of the [`Publisher`]. With
+    /// [`ShrinkPolicy::AfterIdleTime`] a segment that was enlarged by a load spike is released
+    /// when none of its samples were in use for the provided duration. The release happens
+    /// with the next loan and the [`crate::port::subscriber::Subscriber`]s unmap the segment
+    /// as soon as they receive a sample from the replacement segment. The current state can be
+    /// inspected with [`Publisher::data_segment_statistics()`]. By default it is set to
+    /// [`ShrinkPolicy::Never`].
+    pub fn shrink_policy(mut self, value: ShrinkPolicy) -> Self {
+        self.config.shrink_policy = value;
+        self
+    }
+
+    /// Defines how many history samples are delivered at most to a newly connected
+    /// [`crate::port::subscriber::Subscriber`] with every call to
+    /// [`crate::port::update_connections::UpdateConnections::update_connections()`] or send.
+    /// A large history is then handed out incrementally instead of in one go, which avoids a
+    /// latency spike in the [`Publisher`]. Samples that are evicted from the history before
+    /// they were delivered are skipped. When the history is delivered in more than one batch,
+    /// newly sent samples may arrive before the remaining history samples.
+    /// By default, the whole history is delivered at once. Smallest possible value is `1`.
+    pub fn history_delivery_batch_size(mut self, value: usize) -> Self {
+        self.config.history_delivery_batch_size = value.max(1);
+        self
+    }
+
+    /// Defines if the [`Publisher`] retains the last sent sample so that
+    /// [`Publisher::loan_from_last_sent()`] can initialize a new sample with its payload. The
+    /// retained sample occupies one additional preallocated sample of the data segment.
+    /// By default, it is disabled and [`Publisher::loan_from_last_sent()`] behaves like
+    /// [`Publisher::loan()`].
+    pub fn enable_loan_from_last_sent(mut self, value: bool) -> Self {
+        self.config.enable_loan_from_last_sent = value;
+        self
+    }
+
     /// Sets the [`DegradationHandler`] of the [`Publisher`]. Whenever a connection to a
     /// [`crate::port::subscriber::Subscriber`] is corrupted or it seems to be dead, this handler
     /// is called and depending on the returned [`DegradationAction`] measures will be taken.
@@ -37,7 +37,9 @@ use super::request_response::PortFactory;
 use crate::{
     port::{
         BackpressureFn, BackpressureHandler, DegradationAction, DegradationFn, DegradationHandler,
-        port_name::PortName, server::Server,
+        port_name::PortName,
+        receive_policy::{ClientWeightFn, ClientWeightHandler, ReceivePolicy},
+        server::Server,
     },
     prelude::BackpressureStrategy,
     service,
@@ -55,7 +57,13 @@ pub(crate) struct LocalServerConfig {
     pub(crate) initial_max_slice_len: usize,
     pub(crate) allocation_strategy: AllocationStrategy,
     pub(crate) max_loaned_responses_per_request: usize,
+    pub(crate) enable_request_coalescing: bool,
+    pub(crate) enable_deadline_scheduling: bool,
+    pub(crate) receive_policy: ReceivePolicy,
     pub(crate) port_name: PortName,
+    pub(crate) enable_wake_up: bool,
+    pub(crate) enable_ready_client_tracking: bool,
+    pub(crate) preloaned_responses: usize,
 }
 
 /// Defines a failure that can occur when a [`Server`] is created with
@@ -73,6 +81,8 @@ pub enum ServerCreateError {
     FailedToDeployThreadsafetyPolicy,
     /// The tracking port tag, required for cleanup, could not be created.
     UnableToCreatePortTag,
+    /// The wake up channel, see [`PortFactoryServer::enable_wake_up()`], could not be created.
+    UnableToCreateWakeUpChannel,
 }
 
 impl core::fmt::Display for ServerCreateError {
@@ -130,6 +140,7 @@ pub struct PortFactoryServer<
     pub(crate) response_degradation_handler: DegradationHandler<'static>,
     pub(crate) backpressure_handler: Option<BackpressureHandler<'static>>,
     pub(crate) preallocated_number_of_responses_override: PreallocatedResponseOverride<'static>,
+    pub(crate) client_weight_handler: Option<ClientWeightHandler<'static>>,
 }
 
 unsafe impl<
@@ -170,7 +181,7 @@ impl<
     #[doc(hidden)]
     /// # Safety
     ///
-    ///   * does not clone the degradation callback
+    ///   * does not clone the degradation and client weight callbacks
     pub unsafe fn __internal_partial_clone(&self) -> Self {
         Self {
             factory: self.factory,
@@ -179,6 +190,7 @@ impl<
             response_degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
             backpressure_handler: None,
             preallocated_number_of_responses_override: PreallocatedResponseOverride::new(|v| v),
+            client_weight_handler: None,
         }
     }
 
@@ -205,12 +217,19 @@ impl<
                 initial_max_slice_len: 1,
                 allocation_strategy: defs.server_allocation_strategy,
                 max_loaned_responses_per_request: defs.server_max_loaned_responses_per_request,
+                enable_request_coalescing: false,
+                enable_deadline_scheduling: false,
+                receive_policy: ReceivePolicy::FixedOrder,
                 port_name: PortName::new_empty(),
+                enable_wake_up: false,
+                enable_ready_client_tracking: false,
+                preloaned_responses: 0,
             },
             request_degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
             response_degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
             backpressure_handler: None,
             preallocated_number_of_responses_override: PreallocatedResponseOverride::new(|v| v),
+            client_weight_handler: None,
         }
     }
 
@@ -256,6 +275,97 @@ impl<
         self
     }
 
+    /// Defines how many [`ResponseMut`](crate::response_mut::ResponseMut)s the [`Server`]
+    /// loans from its data segment at creation and keeps in a port-local cache. A loan with
+    /// [`ActiveRequest::loan_uninit()`](crate::active_request::ActiveRequest::loan_uninit())
+    /// is served from this cache first and does not touch the allocator of the shared data
+    /// segment. Responses that were received and released by the
+    /// [`Client`](crate::port::client::Client) refill the cache. The value is clamped to the
+    /// number of responses of the data segment. The cache is only used with
+    /// [`AllocationStrategy::Static`]. By default it is disabled.
+    pub fn preloaned_responses(mut self, value: usize) -> Self {
+        self.config.preloaned_responses = value;
+        self
+    }
+
+    /// Enables or disables request coalescing. When enabled, a received request whose user
+    /// header and payload are byte-wise identical to a request that is still in-flight, meaning
+    /// its [`ActiveRequest`](crate::active_request::ActiveRequest) was not yet dropped, is not
+    /// handed out by [`Server::receive()`] but attached to the in-flight request instead. Every
+    /// [`ResponseMut`](crate::response_mut::ResponseMut) sent via the in-flight request is
+    /// delivered to the [`PendingResponse`](crate::pending_response::PendingResponse)s of all
+    /// attached requests as well, without being computed or copied again.
+    ///
+    /// At most
+    /// [`MAX_NUMBER_OF_COALESCED_REQUESTS`](crate::service::header::request_response::MAX_NUMBER_OF_COALESCED_REQUESTS)
+    /// requests are served by one in-flight request, further identical requests are handed out
+    /// as usual. An attached request receives only the responses that are sent after it was
+    /// attached and it is completed when the in-flight request is dropped.
+    pub fn enable_request_coalescing(mut self, value: bool) -> Self {
+        self.config.enable_request_coalescing = value;
+        self
+    }
+
+    /// Enables or disables deadline scheduling. When enabled, [`Server::receive()`] hands out
+    /// the received requests in earliest-deadline-first order. Requests without a deadline,
+    /// see
+    /// [`RequestMutUninit::set_deadline()`](crate::request_mut_uninit::RequestMutUninit::set_deadline()),
+    /// are handed out after all requests with a deadline and requests with the same deadline
+    /// in the order of their arrival.
+    ///
+    /// Requests whose deadline has already passed are not handed out but rejected. The
+    /// [`PendingResponse`](crate::pending_response::PendingResponse) of a rejected request
+    /// is no longer connected and
+    /// [`PendingResponse::has_missed_deadline()`](crate::pending_response::PendingResponse::has_missed_deadline())
+    /// returns [`true`].
+    pub fn enable_deadline_scheduling(mut self, value: bool) -> Self {
+        self.config.enable_deadline_scheduling = value;
+        self
+    }
+
+    /// Enables the wake up channel of the [`Server`]. Every
+    /// [`Client`](crate::port::client::Client) signals it after a request was delivered, so
+    /// that the [`Server`] can be attached to a [`WaitSet`](crate::waitset::WaitSet) with
+    /// [`WaitSet::attach_server()`](crate::waitset::WaitSet::attach_server()) without an
+    /// additional event service. By default, it is disabled.
+    pub fn enable_wake_up(mut self, value: bool) -> Self {
+        self.config.enable_wake_up = value;
+        self
+    }
+
+    /// Enables or disables ready client tracking. When enabled, every
+    /// [`Client`](crate::port::client::Client) marks its connection as ready on the wake up
+    /// channel of the [`Server`] after a request was delivered and [`Server::receive()`]
+    /// visits only the marked connections instead of checking the connections of all
+    /// [`Client`](crate::port::client::Client)s. This reduces the receive cost of services
+    /// with many [`Client`](crate::port::client::Client)s at the price of resetting the wake
+    /// up channel on every receive call. It implies [`PortFactoryServer::enable_wake_up()`].
+    /// By default, it is disabled.
+    pub fn enable_ready_client_tracking(mut self, value: bool) -> Self {
+        self.config.enable_ready_client_tracking = value;
+        self
+    }
+
+    /// Defines in which order [`Server::receive()`] takes the requests of the connected
+    /// [`Client`](crate::port::client::Client)s. With the default
+    /// [`ReceivePolicy::FixedOrder`], a [`Client`](crate::port::client::Client) that sends
+    /// continuously can starve the others, the other policies ensure that every
+    /// [`Client`](crate::port::client::Client) with pending requests is served.
+    pub fn receive_policy(mut self, value: ReceivePolicy) -> Self {
+        self.config.receive_policy = value;
+        self
+    }
+
+    /// Sets the [`ClientWeightHandler`] that defines the weight of a
+    /// [`Client`](crate::port::client::Client) for [`ReceivePolicy::WeightedFair`] and
+    /// [`ReceivePolicy::Priority`]. It is called once when the connection to a
+    /// [`Client`](crate::port::client::Client) is established. If no handler is set, all
+    /// [`Client`](crate::port::client::Client)s have the weight `1`.
+    pub fn set_client_weight_handler<F: ClientWeightFn + 'static>(mut self, handler: F) -> Self {
+        self.client_weight_handler = Some(ClientWeightHandler::new(handler));
+        self
+    }
+
     /// Sets the [`DegradationHandler`] for receiving [`ActiveRequest`](crate::active_request::ActiveRequest)s
     /// from a [`Client`](crate::port::client::Client). Whenever a request connection to a
     /// [`Client`](crate::port::client::Client) is corrupted or it seems to be dead, this handler
@@ -33,11 +33,14 @@ use core::fmt::Debug;
 use alloc::format;
 
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_posix::clock::Time;
 use iceoryx2_log::fail;
 
 use crate::{
     port::{
-        DegradationAction, DegradationFn, DegradationHandler,
+        DegradationAction, DegradationFn, DegradationHandler, SampleLossFn, SampleLossHandler,
+        content_filter::ContentFilter,
+        delivery_mode::DeliveryMode,
         port_name::PortName,
         subscriber::{Subscriber, SubscriberCreateError},
     },
@@ -50,8 +53,16 @@ use super::publish_subscribe::PortFactory;
 pub(crate) struct SubscriberConfig {
     pub(crate) buffer_size: Option<usize>,
     pub(crate) history_request: Option<usize>,
+    pub(crate) history_since: Option<Time>,
     pub(crate) degradation_handler: DegradationHandler<'static>,
+    pub(crate) sample_loss_handler: Option<SampleLossHandler<'static>>,
     pub(crate) port_name: PortName,
+    pub(crate) delivery_mode: DeliveryMode,
+    pub(crate) content_filter: ContentFilter,
+    pub(crate) enable_wake_up: bool,
+    pub(crate) prefetch_size: usize,
+    pub(crate) receive_in_send_order: bool,
+    pub(crate) enable_buffer_resizing: bool,
 }
 
 /// Factory to create a new [`Subscriber`] port/endpoint for
@@ -86,14 +97,22 @@ impl<
     #[doc(hidden)]
     /// # Safety
     ///
-    ///   * does not clone the degradation callback
+    ///   * does not clone the degradation and the sample loss callback
     pub unsafe fn __internal_partial_clone(&self) -> Self {
         Self {
             config: SubscriberConfig {
                 buffer_size: self.config.buffer_size,
                 history_request: self.config.history_request,
+                history_since: self.config.history_since,
                 degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
+                sample_loss_handler: None,
                 port_name: self.config.port_name,
+                delivery_mode: self.config.delivery_mode,
+                content_filter: self.config.content_filter,
+                enable_wake_up: self.config.enable_wake_up,
+                prefetch_size: self.config.prefetch_size,
+                receive_in_send_order: self.config.receive_in_send_order,
+                enable_buffer_resizing: self.config.enable_buffer_resizing,
             },
             factory: self.factory,
         }
@@ -104,8 +123,16 @@ impl<
             config: SubscriberConfig {
                 buffer_size: None,
                 history_request: None,
+                history_since: None,
                 degradation_handler: DegradationHandler::new_with(DegradationAction::Warn),
+                sample_loss_handler: None,
                 port_name: PortName::new_empty(),
+                delivery_mode: DeliveryMode::default(),
+                content_filter: ContentFilter::accept_all(),
+                enable_wake_up: false,
+                prefetch_size: 0,
+                receive_in_send_order: false,
+                enable_buffer_resizing: false,
             },
             factory,
         }
@@ -117,6 +144,17 @@ impl<
         self
     }
 
+    /// Enables [`Subscriber::resize_buffer()`] up to the `subscriber_max_buffer_size` of the
+    /// service. The connections to the [`Publisher`](crate::port::publisher::Publisher)s reserve
+    /// the memory for the maximum buffer size, so that the buffer can grow without recreating
+    /// the [`Subscriber`] and without losing the samples that are already queued. When it is
+    /// disabled, the buffer can only be resized up to the size it was created with.
+    /// By default, it is disabled.
+    pub fn enable_buffer_resizing(mut self, value: bool) -> Self {
+        self.config.enable_buffer_resizing = value;
+        self
+    }
+
     /// Defines the amount of requested history samples. By default the value defined with the
     /// service's `history_size` is used.
     pub fn history_request(mut self, value: usize) -> Self {
@@ -124,6 +162,70 @@ impl<
         self
     }
 
+    /// Requests only the history samples that were sent at or after the provided point in time.
+    /// It is combined with [`PortFactorySubscriber::history_request()`], so that at most the
+    /// requested number of samples is delivered. The time must be acquired with
+    /// [`Time::now()`] since the [`Publisher`](crate::port::publisher::Publisher) timestamps
+    /// its history with the default clock. By default, the whole history is requested.
+    pub fn history_since(mut self, value: Time) -> Self {
+        self.config.history_since = Some(value);
+        self
+    }
+
+    /// Defines the [`DeliveryMode`] of the [`Subscriber`]. With [`DeliveryMode::LatestOnly`]
+    /// every receive call acquires only the most recent sample of a [`Publisher`](crate::port::publisher::Publisher)
+    /// and returns all older samples to it at once. Best combined with a service that
+    /// enables safe overflow so that a slow [`Subscriber`] never blocks the
+    /// [`Publisher`](crate::port::publisher::Publisher).
+    pub fn delivery_mode(mut self, value: DeliveryMode) -> Self {
+        self.config.delivery_mode = value;
+        self
+    }
+
+    /// Defines the [`ContentFilter`] of the [`Subscriber`]. It is evaluated by every
+    /// [`Publisher`](crate::port::publisher::Publisher) when a sample is sent, samples that are
+    /// not accepted are not delivered to the [`Subscriber`]. By default, all samples are
+    /// accepted.
+    pub fn content_filter(mut self, value: ContentFilter) -> Self {
+        self.config.content_filter = value;
+        self
+    }
+
+    /// Enables the wake up channel of the [`Subscriber`]. Every
+    /// [`Publisher`](crate::port::publisher::Publisher) signals it after a sample was delivered,
+    /// so that the [`Subscriber`] can be attached to a [`WaitSet`](crate::waitset::WaitSet) via
+    /// [`Subscriber::wake_up_channel()`] without an additional event service. The signal costs
+    /// no system call as long as the [`Subscriber`] did not consume the previous one.
+    /// By default, it is disabled.
+    pub fn enable_wake_up(mut self, value: bool) -> Self {
+        self.config.enable_wake_up = value;
+        self
+    }
+
+    /// Defines how many bytes of the next pending sample are prefetched into the CPU cache
+    /// whenever a sample was received, starting at the sample header. It hides the cache misses
+    /// of the next receive call when the [`Subscriber`] processes a stream of samples. Only
+    /// samples of [`Publisher`](crate::port::publisher::Publisher)s with a static data segment
+    /// are prefetched. By default, it is `0` and nothing is prefetched.
+    pub fn prefetch_next_sample(mut self, number_of_bytes: usize) -> Self {
+        self.config.prefetch_size = number_of_bytes;
+        self
+    }
+
+    /// Defines if the [`Subscriber`] merges the samples of all connected
+    /// [`Publisher`](crate::port::publisher::Publisher)s by their send timestamp, see
+    /// [`Header::send_timestamp()`](crate::service::header::publish_subscribe::Header::send_timestamp()).
+    /// Every receive call compares the next sample of every
+    /// [`Publisher`](crate::port::publisher::Publisher) and takes the oldest one, so that the
+    /// samples are received in the order in which they were sent. It requires a service that
+    /// was created with
+    /// [`enable_send_timestamps()`](crate::service::builder::publish_subscribe::Builder::enable_send_timestamps()),
+    /// otherwise the samples are received in the default order. By default, it is disabled.
+    pub fn receive_in_send_order(mut self, value: bool) -> Self {
+        self.config.receive_in_send_order = value;
+        self
+    }
+
     /// Sets the [`DegradationHandler`] of the [`Subscriber`]. Whenever a connection to a
     /// [`crate::port::subscriber::Subscriber`] is corrupted or it seems to be dead, this handler
     /// is called and depending on the returned [`DegradationAction`] measures will be taken.
@@ -133,6 +235,16 @@ impl<
         self
     }
 
+    /// Sets the [`SampleLossHandler`] of the [`Subscriber`]. Whenever the [`Subscriber`] detects
+    /// a gap in the sequence numbers of the received samples of a
+    /// [`Publisher`](crate::port::publisher::Publisher), this handler is called with the number
+    /// of lost samples, see [`Subscriber::lost_samples()`].
+    pub fn set_sample_loss_handler<F: SampleLossFn + 'static>(mut self, handler: F) -> Self {
+        self.config.sample_loss_handler = Some(SampleLossHandler::new(handler));
+
+        self
+    }
+
     /// Sets the [`PortName`] of the  [`Subscriber`].
     pub fn name(mut self, name: &PortName) -> Self {
         self.config.port_name = *name;
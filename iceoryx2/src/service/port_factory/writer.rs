@@ -38,6 +38,7 @@ use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_log::fail;
 
 use super::blackboard::PortFactory;
+use crate::port::notifier::Notifier;
 use crate::port::port_name::PortName;
 use crate::port::writer::{Writer, WriterCreateError};
 use crate::service;
@@ -50,7 +51,7 @@ pub(crate) struct WriterConfig {
 /// Factory to create a new [`Writer`] port/endpoint for
 /// [`MessagingPattern::Blackboard`](crate::service::messaging_pattern::MessagingPattern::Blackboard)
 /// based communication.
-#[derive(Debug, Clone)]
+#[derive(Debug)]
 pub struct PortFactoryWriter<
     'factory,
     Service: service::Service,
@@ -58,6 +59,7 @@ pub struct PortFactoryWriter<
 > {
     pub(crate) factory: &'factory PortFactory<Service, KeyType>,
     config: WriterConfig,
+    update_notifier: Option<Notifier<Service>>,
 }
 
 impl<
@@ -72,6 +74,7 @@ impl<
             config: WriterConfig {
                 port_name: PortName::new_empty(),
             },
+            update_notifier: None,
         }
     }
 
@@ -81,11 +84,21 @@ impl<
         self
     }
 
+    /// Every update of an entry of the [`Writer`] notifies the passed [`Notifier`] with the
+    /// [`EntryHandleMut::entry_id()`](crate::port::writer::EntryHandleMut::entry_id()) of the
+    /// updated entry, so that [`Reader`](crate::port::reader::Reader)s can wait on the
+    /// corresponding [`Listener`](crate::port::listener::Listener) instead of polling. The
+    /// event service must support the largest entry id as event id.
+    pub fn notify_on_update(mut self, notifier: Notifier<Service>) -> Self {
+        self.update_notifier = Some(notifier);
+        self
+    }
+
     /// Creates a new [`Writer`] or returns a [`WriterCreateError`] on failure.
     pub fn create(self) -> Result<Writer<Service, KeyType>, WriterCreateError> {
         let origin = format!("{self:?}");
         Ok(
-            fail!(from origin, when Writer::new(self.factory.service.clone(), self.config.clone()),"Failed to create new Writer port."),
+            fail!(from origin, when Writer::new(self.factory.service.clone(), self.config, self.update_notifier),"Failed to create new Writer port."),
         )
     }
 }
@@ -16,7 +16,7 @@ use iceoryx2_bb_container::semantic_string::*;
 use iceoryx2_bb_derive_macros::ZeroCopySend;
 use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
 use iceoryx2_bb_system_types::file_name::RestrictedFileName;
-use iceoryx2_cal::hash::Hash;
+use iceoryx2_cal::hash::{Hash, HashKind};
 use iceoryx2_log::fatal_panic;
 
 use serde::{Deserialize, Serialize};
@@ -63,6 +63,13 @@ impl ServiceHash {
         SERVICE_HASH_CAPACITY
     }
 
+    /// Returns the [`HashKind`] that created the [`ServiceHash`]. Processes that were built
+    /// with a different [`Service::ServiceNameHasher`](crate::service::Service::ServiceNameHasher)
+    /// cannot open each others services. If the [`HashKind`] is unknown, [`None`] is returned.
+    pub fn hash_kind(&self) -> Option<HashKind> {
+        HashKind::from_value(self.0.as_bytes())
+    }
+
     /// Returns a str reference to the [`ServiceHash`]
     pub fn as_str(&self) -> &str {
         // SAFETY: a SemanticString is always a valid UTF-8 string
@@ -154,7 +154,12 @@ impl MessageTypeDetails {
     }
 
     pub(crate) fn payload_ptr_from_header(&self, header: *const u8) -> *const u8 {
-        let user_header = self.user_header_ptr_from_header(header) as usize;
+        self.payload_ptr_from_user_header(self.user_header_ptr_from_header(header))
+    }
+
+    /// returns the pointer to the payload
+    pub(crate) fn payload_ptr_from_user_header(&self, user_header: *const u8) -> *const u8 {
+        let user_header = user_header as usize;
         let payload_start = align(user_header + self.user_header.size, self.payload.alignment);
         payload_start as *const u8
     }
@@ -166,7 +171,13 @@ impl MessageTypeDetails {
         user_header_start as *const u8
     }
 
+    /// Returns the [`Layout`] of a sample with `number_of_elements` payload elements. When the
+    /// payload alignment exceeds the header alignment, e.g. a cache line or page with
+    /// [`Builder::payload_alignment()`](crate::service::builder::publish_subscribe::Builder::payload_alignment()),
+    /// the samples are aligned like the payload. The header and user header then occupy
+    /// their own cache lines and never share one with a payload.
     pub(crate) fn sample_layout(&self, number_of_elements: usize) -> Layout {
+        let alignment = self.header.alignment.max(self.payload.alignment);
         unsafe {
             Layout::from_size_align_unchecked(
                 align(
@@ -174,9 +185,9 @@ impl MessageTypeDetails {
                         + self.payload.size * number_of_elements
                         + self.payload.alignment
                         - 1,
-                    self.header.alignment,
+                    alignment,
                 ),
-                self.header.alignment,
+                alignment,
             )
         }
     }
@@ -378,6 +389,23 @@ mod tests {
         assert_that!(sut.size(), eq expected);
     }
 
+    #[test]
+    fn sample_layout_is_aligned_like_an_overaligned_payload() {
+        const CACHE_LINE_SIZE: usize = 64;
+        let mut details = MessageTypeDetails::from::<i64, i64, i64>(TypeVariant::FixedSize);
+        assert_that!(details.sample_layout(1).align(), eq details.header.alignment);
+
+        details.payload.alignment = CACHE_LINE_SIZE;
+        let sut = details.sample_layout(1);
+        assert_that!(sut.align(), eq CACHE_LINE_SIZE);
+        assert_that!(sut.size() % CACHE_LINE_SIZE, eq 0);
+
+        let header = CACHE_LINE_SIZE as *const u8;
+        let payload = details.payload_ptr_from_header(header) as usize;
+        assert_that!(payload, eq 2 * CACHE_LINE_SIZE);
+        assert_that!(payload + details.payload.size, le header as usize + sut.size());
+    }
+
     #[test]
     fn test_is_compatible_to_failed_when_types_differ() {
         let left = MessageTypeDetails::from::<i64, i64, i8>(TypeVariant::FixedSize);
@@ -59,18 +59,16 @@ pub struct StaticConfig {
 }
 
 impl StaticConfig {
-    pub(crate) fn new_request_response<Hasher: Hash>(
+    pub(crate) fn new_request_response(
         service_name: &ServiceName,
+        service_hash: ServiceHash,
         config: &config::Config,
     ) -> Self {
         let messaging_pattern =
             MessagingPattern::RequestResponse(request_response::StaticConfig::new(config));
         Self {
             iceoryx2_version: PackageVersion::get(),
-            service_hash: ServiceHash::new::<Hasher>(
-                service_name,
-                crate::service::messaging_pattern::MessagingPattern::RequestResponse,
-            ),
+            service_hash,
             unique_service_id: UniqueServiceId::new(),
             service_name: *service_name,
             messaging_pattern,
@@ -78,17 +76,15 @@ impl StaticConfig {
         }
     }
 
-    pub(crate) fn new_event<Hasher: Hash>(
+    pub(crate) fn new_event(
         service_name: &ServiceName,
+        service_hash: ServiceHash,
         config: &config::Config,
     ) -> Self {
         let messaging_pattern = MessagingPattern::Event(event::StaticConfig::new(config));
         Self {
             iceoryx2_version: PackageVersion::get(),
-            service_hash: ServiceHash::new::<Hasher>(
-                service_name,
-                crate::service::messaging_pattern::MessagingPattern::Event,
-            ),
+            service_hash,
             unique_service_id: UniqueServiceId::new(),
             service_name: *service_name,
             messaging_pattern,
@@ -96,18 +92,16 @@ impl StaticConfig {
         }
     }
 
-    pub(crate) fn new_publish_subscribe<Hasher: Hash>(
+    pub(crate) fn new_publish_subscribe(
         service_name: &ServiceName,
+        service_hash: ServiceHash,
         config: &config::Config,
     ) -> Self {
         let messaging_pattern =
             MessagingPattern::PublishSubscribe(publish_subscribe::StaticConfig::new(config));
         Self {
             iceoryx2_version: PackageVersion::get(),
-            service_hash: ServiceHash::new::<Hasher>(
-                service_name,
-                crate::service::messaging_pattern::MessagingPattern::PublishSubscribe,
-            ),
+            service_hash,
             unique_service_id: UniqueServiceId::new(),
             service_name: *service_name,
             messaging_pattern,
@@ -129,7 +123,11 @@ impl StaticConfig {
         payload: message_type_details::TypeDetail,
         user_header: message_type_details::TypeDetail,
     ) -> Self {
-        let mut new_self = Self::new_publish_subscribe::<Hasher>(service_name, config);
+        let service_hash = ServiceHash::new::<Hasher>(
+            service_name,
+            crate::service::messaging_pattern::MessagingPattern::PublishSubscribe,
+        );
+        let mut new_self = Self::new_publish_subscribe(service_name, service_hash, config);
         match &mut new_self.messaging_pattern {
             MessagingPattern::PublishSubscribe(pattern_config) => {
                 pattern_config.message_type_details.user_header = user_header;
@@ -141,17 +139,15 @@ impl StaticConfig {
         new_self
     }
 
-    pub(crate) fn new_blackboard<Hasher: Hash>(
+    pub(crate) fn new_blackboard(
         service_name: &ServiceName,
+        service_hash: ServiceHash,
         config: &config::Config,
     ) -> Self {
         let messaging_pattern = MessagingPattern::Blackboard(blackboard::StaticConfig::new(config));
         Self {
             iceoryx2_version: PackageVersion::get(),
-            service_hash: ServiceHash::new::<Hasher>(
-                service_name,
-                crate::service::messaging_pattern::MessagingPattern::Blackboard,
-            ),
+            service_hash,
             unique_service_id: UniqueServiceId::new(),
             service_name: *service_name,
             messaging_pattern,
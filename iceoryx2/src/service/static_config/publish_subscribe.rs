@@ -28,6 +28,7 @@
 //! println!("history size:                     {:?}", pubsub.static_config().history_size());
 //! println!("subscriber max borrowed samples:  {:?}", pubsub.static_config().subscriber_max_borrowed_samples());
 //! println!("safe overflow:                    {:?}", pubsub.static_config().has_safe_overflow());
+//! println!("priority lanes:                   {:?}", pubsub.static_config().number_of_priority_lanes());
 //!
 //! # Ok(())
 //! # }
@@ -53,6 +54,8 @@ pub struct StaticConfig {
     pub(crate) subscriber_max_buffer_size: usize,
     pub(crate) subscriber_max_borrowed_samples: usize,
     pub(crate) enable_safe_overflow: bool,
+    pub(crate) enable_send_timestamps: bool,
+    pub(crate) number_of_priority_lanes: usize,
     pub(crate) message_type_details: MessageTypeDetails,
 }
 
@@ -72,6 +75,8 @@ impl StaticConfig {
                 .publish_subscribe
                 .subscriber_max_borrowed_samples,
             enable_safe_overflow: config.defaults.publish_subscribe.enable_safe_overflow,
+            enable_send_timestamps: false,
+            number_of_priority_lanes: 1,
             message_type_details: MessageTypeDetails::default(),
         }
     }
@@ -80,7 +85,9 @@ impl StaticConfig {
         &self,
         publisher_max_loaned_data: usize,
     ) -> usize {
+        // every priority lane has its own buffer and borrow limit
         self.max_subscribers
+            * self.number_of_priority_lanes
             * (self.subscriber_max_buffer_size + self.subscriber_max_borrowed_samples)
             + self.history_size
             + publisher_max_loaned_data
@@ -126,6 +133,19 @@ impl StaticConfig {
         self.enable_safe_overflow
     }
 
+    /// Returns true if every [`crate::sample::Sample`] carries the point in time when it was
+    /// sent, see [`crate::service::header::publish_subscribe::Header::send_timestamp()`].
+    pub fn has_send_timestamps(&self) -> bool {
+        self.enable_send_timestamps
+    }
+
+    /// Returns the number of priority lanes of every [`crate::port::subscriber::Subscriber`].
+    /// Samples in a higher lane are received before all samples in a lower lane, see
+    /// [`crate::sample_mut::SampleMut::set_priority()`].
+    pub fn number_of_priority_lanes(&self) -> usize {
+        self.number_of_priority_lanes
+    }
+
     /// Returns the type details of the [`crate::service::Service`].
     pub fn message_type_details(&self) -> &MessageTypeDetails {
         &self.message_type_details
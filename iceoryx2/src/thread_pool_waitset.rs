@@ -0,0 +1,442 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! A [`ThreadPoolWaitSet`] is a [`WaitSet`] that distributes the processing of the
+//! triggered attachments to a pool of threads. It is meant for applications that multiplex
+//! many attachments with expensive callbacks where a single thread becomes the bottleneck.
+//!
+//! The calling thread waits on the underlying [`WaitSet`]. Whenever it wakes up, all triggered
+//! [`WaitSetAttachmentId`]s are collected and every one of them is handed to exactly one
+//! thread of the pool, the calling thread included. The next wait only starts after all
+//! callbacks of the current wake up have returned, therefore a callback for one attachment
+//! never runs concurrently with itself.
+//!
+//! Since the callback is called from multiple threads, it must be [`Sync`]. The
+//! [`WaitSetGuard`] cannot be shared between threads, the origin of an event is determined
+//! by comparing it with the [`WaitSetAttachmentId`] that was acquired via
+//! [`WaitSetAttachmentId::from_guard()`] before the processing starts.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use iceoryx2::prelude::*;
+//! use iceoryx2::thread_pool_waitset::ThreadPoolWaitSetBuilder;
+//! # fn main() -> Result<(), Box<dyn core::error::Error>> {
+//! # let node = NodeBuilder::new().create::<ipc_threadsafe::Service>()?;
+//! # let event = node.service_builder(&"MyEventName_1".try_into()?)
+//! #     .event()
+//! #     .open_or_create()?;
+//!
+//! let listener = event.listener_builder().create()?;
+//!
+//! let waitset = ThreadPoolWaitSetBuilder::new()
+//!     .number_of_threads(4)
+//!     .create::<ipc_threadsafe::Service>()?;
+//! let guard = waitset.attach_notification(&listener)?;
+//! let listener_id = WaitSetAttachmentId::from_guard(&guard);
+//!
+//! waitset.wait_and_process(|attachment_id| {
+//!     if attachment_id == listener_id {
+//!         listener.try_wait(|event| {
+//!             println!("received notification {:?} {} times", event.id, event.count);
+//!         });
+//!     }
+//!     CallbackProgression::Continue
+//! })?;
+//!
+//! # Ok(())
+//! # }
+//! ```
+
+use core::{fmt::Debug, time::Duration};
+
+use alloc::vec::Vec;
+
+use iceoryx2_bb_concurrency::atomic::{AtomicBool, Ordering};
+use iceoryx2_bb_concurrency::cell::RefCell;
+use iceoryx2_bb_concurrency::spin_lock::SpinLock;
+use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_posix::file_descriptor_set::SynchronousMultiplexing;
+use iceoryx2_bb_posix::semaphore::{
+    Handle, SemaphoreInterface, SemaphoreWaitError, UnnamedSemaphore, UnnamedSemaphoreBuilder,
+    UnnamedSemaphoreHandle,
+};
+use iceoryx2_bb_posix::system_configuration::SystemInfo;
+use iceoryx2_bb_posix::thread::{MAX_SCOPED_THREADS, thread_scope};
+use iceoryx2_cal::reactor::ReactorBackend;
+use iceoryx2_log::{fail, fatal_panic, warn};
+
+use crate::signal_handling_mode::SignalHandlingMode;
+use crate::waitset::{
+    WaitSet, WaitSetAttachmentError, WaitSetAttachmentId, WaitSetBuilder, WaitSetCreateError,
+    WaitSetGuard, WaitSetRunError, WaitSetRunResult,
+};
+
+/// The builder for the [`ThreadPoolWaitSet`].
+#[derive(Debug)]
+pub struct ThreadPoolWaitSetBuilder {
+    waitset_builder: WaitSetBuilder,
+    number_of_threads: usize,
+}
+
+impl Default for ThreadPoolWaitSetBuilder {
+    fn default() -> Self {
+        Self {
+            waitset_builder: WaitSetBuilder::new(),
+            number_of_threads: SystemInfo::NumberOfCpuCores.value(),
+        }
+    }
+}
+
+impl ThreadPoolWaitSetBuilder {
+    /// Creates a new [`ThreadPoolWaitSetBuilder`]. By default, the pool uses as many threads
+    /// as the system has cpu cores.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Defines the number of threads, including the calling thread, that process the
+    /// triggered attachments. It must be at least 1 and at most
+    /// [`MAX_SCOPED_THREADS`] + 1, other values are clamped.
+    pub fn number_of_threads(mut self, value: usize) -> Self {
+        self.number_of_threads = value;
+        self
+    }
+
+    /// See [`WaitSetBuilder::signal_handling_mode()`].
+    pub fn signal_handling_mode(mut self, value: SignalHandlingMode) -> Self {
+        self.waitset_builder = self.waitset_builder.signal_handling_mode(value);
+        self
+    }
+
+    /// See [`WaitSetBuilder::reactor_backend()`].
+    pub fn reactor_backend(mut self, value: ReactorBackend) -> Self {
+        self.waitset_builder = self.waitset_builder.reactor_backend(value);
+        self
+    }
+
+    /// Creates the [`ThreadPoolWaitSet`].
+    pub fn create<Service: crate::service::Service>(
+        self,
+    ) -> Result<ThreadPoolWaitSet<Service>, WaitSetCreateError> {
+        let number_of_threads = self.number_of_threads.clamp(1, MAX_SCOPED_THREADS + 1);
+        if number_of_threads != self.number_of_threads {
+            warn!(from self,
+                "The number of threads {} is not supported, using {} threads instead.",
+                self.number_of_threads, number_of_threads);
+        }
+
+        let waitset = fail!(from self, when self.waitset_builder.clone().create(),
+                "Unable to create ThreadPoolWaitSet since the underlying WaitSet could not be created.");
+
+        Ok(ThreadPoolWaitSet {
+            waitset,
+            number_of_threads,
+            pending_buffer: RefCell::new(Vec::new()),
+        })
+    }
+}
+
+/// The [`ThreadPoolWaitSet`] waits like the [`WaitSet`] on all attachments but processes the
+/// triggered attachments concurrently on a pool of threads. Every triggered attachment is
+/// handed to exactly one thread and the callbacks of one attachment are never executed
+/// concurrently.
+///
+/// The threads of the pool live as long as one `wait_and_process*()` call. To avoid that the
+/// pool is recreated on every wake up, [`ThreadPoolWaitSet::wait_and_process()`] shall be
+/// preferred over calling [`ThreadPoolWaitSet::wait_and_process_once()`] in a loop.
+///
+/// Can be created via the [`ThreadPoolWaitSetBuilder`].
+#[derive(Debug)]
+pub struct ThreadPoolWaitSet<Service: crate::service::Service> {
+    waitset: WaitSet<Service>,
+    number_of_threads: usize,
+    pending_buffer: RefCell<Vec<WaitSetAttachmentId<Service>>>,
+}
+
+impl<Service: crate::service::Service> ThreadPoolWaitSet<Service>
+where
+    WaitSetAttachmentId<Service>: Send,
+{
+    /// Waits on the [`ThreadPoolWaitSet`] and processes all triggered attachments on the
+    /// thread pool until the user returns [`CallbackProgression::Stop`] or a signal was
+    /// received. See [`WaitSet::wait_and_process()`].
+    ///
+    /// When one callback returns [`CallbackProgression::Stop`], all callbacks that are
+    /// currently executed are completed, the remaining events of the wake up are discarded
+    /// and [`WaitSetRunResult::StopRequest`] is returned.
+    pub fn wait_and_process<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync>(
+        &self,
+        fn_call: F,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        self.run(&fn_call, Duration::MAX, true)
+    }
+
+    /// Waits until an event arrives, processes all triggered attachments on the thread pool
+    /// and then returns. See [`WaitSet::wait_and_process_once()`].
+    pub fn wait_and_process_once<
+        F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync,
+    >(
+        &self,
+        fn_call: F,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        self.run(&fn_call, Duration::MAX, false)
+    }
+
+    /// Waits until an event arrives or the timeout has passed, processes all triggered
+    /// attachments on the thread pool and then returns.
+    /// See [`WaitSet::wait_and_process_once_with_timeout()`].
+    pub fn wait_and_process_once_with_timeout<
+        F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync,
+    >(
+        &self,
+        fn_call: F,
+        timeout: Duration,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        self.run(&fn_call, timeout, false)
+    }
+
+    fn run<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync>(
+        &self,
+        fn_call: &F,
+        timeout: Duration,
+        repeat: bool,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        let msg = "Unable to run the ThreadPoolWaitSet";
+        let round_start_handle = UnnamedSemaphoreHandle::new();
+        let round_done_handle = UnnamedSemaphoreHandle::new();
+        let round_start = fail!(from self, when UnnamedSemaphoreBuilder::new()
+                    .is_interprocess_capable(false)
+                    .create(&round_start_handle),
+                with WaitSetRunError::InternalError,
+                "{msg} since the worker start semaphore could not be created.");
+        let round_done = fail!(from self, when UnnamedSemaphoreBuilder::new()
+                    .is_interprocess_capable(false)
+                    .create(&round_done_handle),
+                with WaitSetRunError::InternalError,
+                "{msg} since the worker done semaphore could not be created.");
+
+        let mut pending = core::mem::take(&mut *self.pending_buffer.borrow_mut());
+        pending.clear();
+        let round = Round {
+            pending: SpinLock::new(pending),
+            stop_requested: AtomicBool::new(false),
+            shutdown: AtomicBool::new(false),
+            round_start,
+            round_done,
+        };
+
+        let mut result = Err(WaitSetRunError::InternalError);
+        let spawn_result = thread_scope(|s| {
+            let mut number_of_workers = 0;
+            for _ in 1..self.number_of_threads {
+                if let Err(e) = s.thread_builder().spawn(|| round.work(fn_call)) {
+                    round.shutdown(number_of_workers);
+                    return Err(e);
+                }
+                number_of_workers += 1;
+            }
+
+            result = self.dispatch(&round, fn_call, number_of_workers, timeout, repeat);
+            round.shutdown(number_of_workers);
+            Ok(())
+        });
+
+        *self.pending_buffer.borrow_mut() = core::mem::take(&mut *round.pending.blocking_lock());
+
+        if let Err(e) = spawn_result {
+            fail!(from self, with WaitSetRunError::InternalError,
+                "{msg} since the worker threads could not be spawned ({e:?}).");
+        }
+
+        result
+    }
+
+    fn dispatch<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression + Sync>(
+        &self,
+        round: &Round<'_, Service>,
+        fn_call: &F,
+        number_of_workers: usize,
+        timeout: Duration,
+        repeat: bool,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        loop {
+            let result = self.waitset.wait_and_process_batch_once_with_timeout(
+                |attachment_ids| {
+                    round
+                        .pending
+                        .blocking_lock()
+                        .extend_from_slice(attachment_ids);
+
+                    // the calling thread processes events as well, therefore only as many
+                    // workers as there are additional events are woken up
+                    let number_of_helpers = number_of_workers.min(attachment_ids.len() - 1);
+                    for _ in 0..number_of_helpers {
+                        round.post(&round.round_start);
+                    }
+                    round.process(fn_call);
+                    for _ in 0..number_of_helpers {
+                        round.wait(&round.round_done);
+                    }
+
+                    if round.stop_requested.swap(false, Ordering::Relaxed) {
+                        CallbackProgression::Stop
+                    } else {
+                        CallbackProgression::Continue
+                    }
+                },
+                timeout,
+            );
+
+            match result {
+                Ok(WaitSetRunResult::AllEventsHandled) if repeat => (),
+                Ok(v) => return Ok(v),
+                Err(e) => {
+                    fail!(from self, with e,
+                        "Unable to run in ThreadPoolWaitSet::wait_and_process() loop since ({:?}) has occurred.", e);
+                }
+            }
+        }
+    }
+}
+
+impl<Service: crate::service::Service> ThreadPoolWaitSet<Service> {
+    /// Returns the number of threads, including the calling thread, that process the
+    /// triggered attachments.
+    pub fn number_of_threads(&self) -> usize {
+        self.number_of_threads
+    }
+
+    /// See [`WaitSet::attach_notification()`].
+    pub fn attach_notification<
+        'waitset,
+        'attachment,
+        T: SynchronousMultiplexing + Debug + ?Sized,
+    >(
+        &'waitset self,
+        attachment: &'attachment T,
+    ) -> Result<WaitSetGuard<'waitset, 'attachment, Service>, WaitSetAttachmentError> {
+        self.waitset.attach_notification(attachment)
+    }
+
+    /// See [`WaitSet::attach_deadline()`].
+    pub fn attach_deadline<'waitset, 'attachment, T: SynchronousMultiplexing + Debug + ?Sized>(
+        &'waitset self,
+        attachment: &'attachment T,
+        deadline: Duration,
+    ) -> Result<WaitSetGuard<'waitset, 'attachment, Service>, WaitSetAttachmentError> {
+        self.waitset.attach_deadline(attachment, deadline)
+    }
+
+    /// See [`WaitSet::attach_interval()`].
+    pub fn attach_interval(
+        &self,
+        interval: Duration,
+    ) -> Result<WaitSetGuard<'_, '_, Service>, WaitSetAttachmentError> {
+        self.waitset.attach_interval(interval)
+    }
+
+    /// Returns the capacity of the [`ThreadPoolWaitSet`]
+    pub fn capacity(&self) -> usize {
+        self.waitset.capacity()
+    }
+
+    /// Returns the number of attachments.
+    pub fn len(&self) -> usize {
+        self.waitset.len()
+    }
+
+    /// Returns true if the [`ThreadPoolWaitSet`] has no attachments, otherwise false.
+    pub fn is_empty(&self) -> bool {
+        self.waitset.is_empty()
+    }
+
+    /// Returns the [`SignalHandlingMode`] with which the [`ThreadPoolWaitSet`] was created.
+    pub fn signal_handling_mode(&self) -> SignalHandlingMode {
+        self.waitset.signal_handling_mode()
+    }
+}
+
+/// The state that is shared between the calling thread and the workers. A worker is woken
+/// up via `round_start`, takes events from `pending` until it is empty and reports the
+/// completion via `round_done`. Since the calling thread waits for as many completions as it
+/// has issued wake ups, no callback is running anymore when the next wait starts.
+#[derive(Debug)]
+struct Round<'semaphore, Service: crate::service::Service> {
+    pending: SpinLock<Vec<WaitSetAttachmentId<Service>>>,
+    stop_requested: AtomicBool,
+    shutdown: AtomicBool,
+    round_start: UnnamedSemaphore<'semaphore>,
+    round_done: UnnamedSemaphore<'semaphore>,
+}
+
+impl<Service: crate::service::Service> Round<'_, Service> {
+    fn work<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression>(&self, fn_call: &F) {
+        loop {
+            self.wait(&self.round_start);
+            if self.shutdown.load(Ordering::Relaxed) {
+                return;
+            }
+
+            self.process(fn_call);
+            self.post(&self.round_done);
+        }
+    }
+
+    fn process<F: Fn(WaitSetAttachmentId<Service>) -> CallbackProgression>(&self, fn_call: &F) {
+        loop {
+            let attachment_id = {
+                let mut pending = self.pending.blocking_lock();
+                if self.stop_requested.load(Ordering::Relaxed) {
+                    pending.clear();
+                }
+                pending.pop()
+            };
+
+            match attachment_id {
+                Some(attachment_id) => {
+                    if let CallbackProgression::Stop = fn_call(attachment_id) {
+                        self.stop_requested.store(true, Ordering::Relaxed);
+                    }
+                }
+                None => return,
+            }
+        }
+    }
+
+    fn shutdown(&self, number_of_workers: usize) {
+        self.shutdown.store(true, Ordering::Relaxed);
+        for _ in 0..number_of_workers {
+            self.post(&self.round_start);
+        }
+    }
+
+    fn post(&self, semaphore: &UnnamedSemaphore) {
+        if let Err(e) = semaphore.post() {
+            fatal_panic!(from self,
+                "This should never happen! Unable to wake up the ThreadPoolWaitSet worker ({e:?}).");
+        }
+    }
+
+    fn wait(&self, semaphore: &UnnamedSemaphore) {
+        loop {
+            match semaphore.blocking_wait() {
+                Ok(()) => return,
+                Err(SemaphoreWaitError::Interrupt) => (),
+                Err(e) => {
+                    fatal_panic!(from self,
+                        "This should never happen! Unable to wait for the ThreadPoolWaitSet worker ({e:?}).");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache Software License 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0, or the MIT license
+// which is available at https://opensource.org/licenses/MIT.
+//
+// SPDX-License-Identifier: Apache-2.0 OR MIT
+
+//! Static tracepoints on the hot paths of the ports.
+//!
+//! With the `tracepoints` feature on Linux x86_64 and aarch64 every [`tracepoint!`] is
+//! compiled into a USDT probe of the provider `iceoryx2`. A probe is a single `nop`
+//! instruction and a `.note.stapsdt` ELF note that describes where the arguments are stored,
+//! so that tools like `bpftrace`, `perf` or SystemTap can attach to it at runtime without
+//! recompiling the application. All arguments are passed as 64-bit unsigned integers.
+//!
+//! Without the feature, or on any other platform, the macro expands to dead code and the
+//! arguments are never evaluated.
+//!
+//! | Probe                | Arguments                                         |
+//! | -------------------- | ------------------------------------------------- |
+//! | `publisher_loan`     | sample offset, sample size                        |
+//! | `publisher_send`     | sample offset, sample size                        |
+//! | `subscriber_receive` | sample offset                                     |
+//! | `subscriber_release` | sample offset                                     |
+//! | `notifier_notify`    | number of event ids, number of woken up listeners |
+//! | `listener_wake`      | number of received notifications                  |
+//! | `waitset_dispatch`   | number of triggered attachments                   |
+//!
+//! ```text
+//! bpftrace -e 'usdt:./my_app:iceoryx2:publisher_send { @[tid] = count(); }'
+//! ```
+
+#[cfg(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+))]
+macro_rules! __usdt {
+    ($name:ident, $arguments:literal $(, $arg:expr)*) => {{
+        #[allow(named_asm_labels)]
+        unsafe {
+            core::arch::asm!(
+                "990: nop",
+                ".pushsection .note.stapsdt, \"\", \"note\"",
+                ".balign 4",
+                ".4byte 992f-991f, 994f-993f, 3",
+                "991: .asciz \"stapsdt\"",
+                "992: .balign 4",
+                "993: .8byte 990b",
+                ".8byte _.stapsdt.base",
+                ".8byte 0",
+                ".asciz \"iceoryx2\"",
+                concat!(".asciz \"", stringify!($name), "\""),
+                concat!(".asciz \"", $arguments, "\""),
+                "994: .balign 4",
+                ".popsection",
+                ".ifndef _.stapsdt.base",
+                ".pushsection .stapsdt.base, \"aG\", \"progbits\", .stapsdt.base, comdat",
+                ".weak _.stapsdt.base",
+                ".hidden _.stapsdt.base",
+                "_.stapsdt.base: .space 1",
+                ".size _.stapsdt.base, 1",
+                ".popsection",
+                ".endif",
+                $(in(reg) ($arg) as u64,)*
+                options(nomem, nostack, preserves_flags)
+            );
+        };
+    }};
+}
+
+// The argument descriptors use the register names of the assembler, x86_64 requires the
+// AT&T '%' prefix.
+#[cfg(all(feature = "tracepoints", target_os = "linux", target_arch = "x86_64"))]
+macro_rules! tracepoint {
+    ($name:ident) => {
+        $crate::tracepoint::__usdt!($name, "")
+    };
+    ($name:ident, $a0:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@%{0}", $a0)
+    };
+    ($name:ident, $a0:expr, $a1:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@%{0} 8@%{1}", $a0, $a1)
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@%{0} 8@%{1} 8@%{2}", $a0, $a1, $a2)
+    };
+}
+
+#[cfg(all(feature = "tracepoints", target_os = "linux", target_arch = "aarch64"))]
+macro_rules! tracepoint {
+    ($name:ident) => {
+        $crate::tracepoint::__usdt!($name, "")
+    };
+    ($name:ident, $a0:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@{0}", $a0)
+    };
+    ($name:ident, $a0:expr, $a1:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@{0} 8@{1}", $a0, $a1)
+    };
+    ($name:ident, $a0:expr, $a1:expr, $a2:expr) => {
+        $crate::tracepoint::__usdt!($name, "8@{0} 8@{1} 8@{2}", $a0, $a1, $a2)
+    };
+}
+
+#[cfg(not(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+)))]
+macro_rules! tracepoint {
+    ($name:ident $(, $arg:expr)*) => {
+        if false {
+            $(let _ = $arg;)*
+        }
+    };
+}
+
+#[cfg(all(
+    feature = "tracepoints",
+    target_os = "linux",
+    any(target_arch = "x86_64", target_arch = "aarch64")
+))]
+pub(crate) use __usdt;
+pub(crate) use tracepoint;
@@ -219,20 +219,31 @@ use alloc::collections::BTreeMap;
 use alloc::vec;
 use alloc::vec::Vec;
 
+use iceoryx2_bb_concurrency::atomic::AtomicBool;
 use iceoryx2_bb_concurrency::atomic::AtomicUsize;
 use iceoryx2_bb_concurrency::atomic::Ordering;
 use iceoryx2_bb_concurrency::cell::RefCell;
 use iceoryx2_bb_elementary::CallbackProgression;
+use iceoryx2_bb_elementary_traits::zero_copy_send::ZeroCopySend;
+use iceoryx2_bb_lock_free::mpmc::counting_bit_set::RelocatableCountingBitSet;
 use iceoryx2_bb_posix::{
     deadline_queue::{DeadlineQueue, DeadlineQueueBuilder, DeadlineQueueGuard, DeadlineQueueIndex},
     file_descriptor::FileDescriptor,
     file_descriptor_set::SynchronousMultiplexing,
+    memory_lock::{LockMode, MemoryLock, MemoryLockAllError},
+    scheduler::Scheduler,
     signal::SignalHandler,
+    thread::{ThreadHandle, ThreadProperties, ThreadSetSchedulerError},
 };
+use iceoryx2_cal::event::Event;
 use iceoryx2_cal::reactor::*;
 use iceoryx2_log::fail;
 
+use crate::config::Config;
+use crate::port::server::Server;
+use crate::port::subscriber::Subscriber;
 use crate::signal_handling_mode::SignalHandlingMode;
+use crate::tracepoint::tracepoint;
 
 /// States why the [`WaitSet::wait_and_process()`] method returned.
 #[derive(Debug, PartialEq, Eq, Copy, Clone)]
@@ -259,6 +270,8 @@ pub enum WaitSetAttachmentError {
     InternalError,
     /// Insufficient resources to add another attachment to the [`WaitSet`].
     InsufficientResources,
+    /// The port was created without a wake up channel and cannot be attached.
+    NoWakeUpChannel,
 }
 
 impl core::fmt::Display for WaitSetAttachmentError {
@@ -472,10 +485,26 @@ impl<Service: crate::service::Service> Drop for WaitSetGuard<'_, '_, Service> {
     }
 }
 
+/// The settings that are applied to the thread that waits on the [`WaitSet`].
+#[derive(Default, Debug, Clone)]
+struct WaitingThreadSettings {
+    affinity: Option<Vec<usize>>,
+    scheduler: Option<(Scheduler, u8)>,
+    memory_lock: Vec<LockMode>,
+}
+
+impl WaitingThreadSettings {
+    fn is_empty(&self) -> bool {
+        self.affinity.is_none() && self.scheduler.is_none() && self.memory_lock.is_empty()
+    }
+}
+
 /// The builder for the [`WaitSet`].
 #[derive(Default, Debug, Clone)]
 pub struct WaitSetBuilder {
     signal_handling_mode: SignalHandlingMode,
+    reactor_backend: Option<ReactorBackend>,
+    waiting_thread_settings: WaitingThreadSettings,
 }
 
 impl WaitSetBuilder {
@@ -493,6 +522,42 @@ impl WaitSetBuilder {
         self
     }
 
+    /// Defines the [`ReactorBackend`] the [`WaitSet`] uses to wait on its attachments. When it
+    /// is not set, the value of the [`Config`](crate::config::Config) entry
+    /// `defaults.waitset.reactor-backend` is used. Backends that are not available on the
+    /// platform fall back to [`ReactorBackend::Recommended`].
+    pub fn reactor_backend(mut self, value: ReactorBackend) -> Self {
+        self.reactor_backend = Some(value);
+        self
+    }
+
+    /// Pins the thread that waits on the [`WaitSet`] to the provided CPU cores. The affinity
+    /// is applied on the first call of [`WaitSet::wait_and_process_once_with_timeout()`], or
+    /// one of the other wait calls, from within the calling thread.
+    pub fn waiting_thread_affinity(mut self, cpu_core_ids: &[usize]) -> Self {
+        self.waiting_thread_settings.affinity = Some(cpu_core_ids.to_vec());
+        self
+    }
+
+    /// Sets the [`Scheduler`], e.g. [`Scheduler::Fifo`], and priority of the thread that waits
+    /// on the [`WaitSet`]. The priority is mapped uniformly onto the priority range of the
+    /// [`Scheduler`]. Like [`WaitSetBuilder::waiting_thread_affinity()`] it is applied on the
+    /// first wait call. A realtime [`Scheduler`] usually requires elevated privileges.
+    pub fn waiting_thread_scheduler(mut self, scheduler: Scheduler, priority: u8) -> Self {
+        self.waiting_thread_settings.scheduler = Some((scheduler, priority));
+        self
+    }
+
+    /// Excludes the memory of the process from paging with the provided [`LockMode`] on the first
+    /// wait call, so that the waiting thread does not run into page faults when it wakes up.
+    /// Can be called multiple times to combine [`LockMode`]s.
+    pub fn lock_memory(mut self, mode: LockMode) -> Self {
+        if !self.waiting_thread_settings.memory_lock.contains(&mode) {
+            self.waiting_thread_settings.memory_lock.push(mode);
+        }
+        self
+    }
+
     /// Creates the [`WaitSet`].
     pub fn create<Service: crate::service::Service>(
         self,
@@ -502,14 +567,26 @@ impl WaitSetBuilder {
                 with WaitSetCreateError::InternalError,
                 "{msg} since the underlying Timer could not be created.");
 
-        match <Service::Reactor as Reactor>::Builder::new().create() {
+        let reactor_backend = self
+            .reactor_backend
+            .unwrap_or(Config::global_config().defaults.waitset.reactor_backend);
+
+        match <Service::Reactor as Reactor>::Builder::new()
+            .backend(reactor_backend)
+            .create()
+        {
             Ok(reactor) => Ok(WaitSet {
                 reactor,
                 deadline_queue,
                 attachment_to_deadline: RefCell::new(BTreeMap::new()),
                 deadline_to_attachment: RefCell::new(BTreeMap::new()),
                 attachment_counter: AtomicUsize::new(0),
+                attachment_id_batch: RefCell::new(Vec::new()),
                 signal_handling_mode: self.signal_handling_mode,
+                has_configured_waiting_thread: AtomicBool::new(
+                    self.waiting_thread_settings.is_empty(),
+                ),
+                waiting_thread_settings: self.waiting_thread_settings,
             }),
             Err(ReactorCreateError::InternalError) => {
                 fail!(from self, with WaitSetCreateError::InternalError,
@@ -541,7 +618,10 @@ pub struct WaitSet<Service: crate::service::Service> {
     attachment_to_deadline: RefCell<BTreeMap<i32, DeadlineQueueIndex>>,
     deadline_to_attachment: RefCell<BTreeMap<DeadlineQueueIndex, i32>>,
     attachment_counter: AtomicUsize,
+    attachment_id_batch: RefCell<Vec<WaitSetAttachmentId<Service>>>,
     signal_handling_mode: SignalHandlingMode,
+    waiting_thread_settings: WaitingThreadSettings,
+    has_configured_waiting_thread: AtomicBool,
 }
 
 impl<Service: crate::service::Service> WaitSet<Service> {
@@ -559,6 +639,56 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         Ok(())
     }
 
+    fn configure_waiting_thread(&self) -> Result<(), WaitSetRunError> {
+        if self.has_configured_waiting_thread.load(Ordering::Relaxed) {
+            return Ok(());
+        }
+
+        let msg = "Unable to configure the waiting thread";
+        let settings = &self.waiting_thread_settings;
+        let mut thread = ThreadHandle::from_self();
+
+        if let Some(affinity) = &settings.affinity {
+            fail!(from self, when thread.set_affinity(affinity),
+                with WaitSetRunError::InternalError,
+                "{msg} since the cpu affinity {:?} could not be applied.", affinity);
+        }
+
+        if let Some((scheduler, priority)) = settings.scheduler {
+            match thread.set_scheduler(scheduler, priority) {
+                Ok(()) => (),
+                Err(ThreadSetSchedulerError::InsufficientPermissions) => {
+                    fail!(from self, with WaitSetRunError::InsufficientPermissions,
+                        "{msg} since the scheduler {:?} with priority {} requires elevated privileges.",
+                        scheduler, priority);
+                }
+                Err(e) => {
+                    fail!(from self, with WaitSetRunError::InternalError,
+                        "{msg} since the scheduler {:?} with priority {} could not be applied ({:?}).",
+                        scheduler, priority, e);
+                }
+            }
+        }
+
+        for mode in &settings.memory_lock {
+            match MemoryLock::lock_all(*mode) {
+                Ok(()) => (),
+                Err(MemoryLockAllError::InsufficientPermissions) => {
+                    fail!(from self, with WaitSetRunError::InsufficientPermissions,
+                        "{msg} since the memory lock {:?} requires elevated privileges.", mode);
+                }
+                Err(e) => {
+                    fail!(from self, with WaitSetRunError::InternalError,
+                        "{msg} since the memory could not be locked with {:?} ({:?}).", mode, e);
+                }
+            }
+        }
+
+        self.has_configured_waiting_thread
+            .store(true, Ordering::Relaxed);
+        Ok(())
+    }
+
     fn remove_deadline(&self, reactor_idx: i32, deadline_queue_idx: DeadlineQueueIndex) {
         self.attachment_to_deadline
             .borrow_mut()
@@ -568,20 +698,23 @@ impl<Service: crate::service::Service> WaitSet<Service> {
             .remove(&deadline_queue_idx);
     }
 
-    fn reset_deadline(
-        &self,
-        reactor_idx: i32,
-    ) -> Result<Option<DeadlineQueueIndex>, WaitSetRunError> {
-        let msg = "Unable to reset deadline";
-        if let Some(deadline_queue_idx) = self.attachment_to_deadline.borrow().get(&reactor_idx) {
-            fail!(from self,
-                  when self.deadline_queue.reset(*deadline_queue_idx),
-                  with WaitSetRunError::InternalError,
-                  "{msg} since the deadline_queue guard could not be reset for the attachment {reactor_idx}. Continuing operations will lead to invalid deadline failures.");
-            Ok(Some(*deadline_queue_idx))
-        } else {
-            Ok(None)
+    fn reset_deadlines(&self, triggered_file_descriptors: &[i32]) -> Result<(), WaitSetRunError> {
+        let attachment_to_deadline = self.attachment_to_deadline.borrow();
+        if attachment_to_deadline.is_empty() {
+            return Ok(());
         }
+
+        let deadline_queue_indices = triggered_file_descriptors
+            .iter()
+            .filter_map(|fd| attachment_to_deadline.get(fd).copied());
+
+        fail!(from self,
+              when self.deadline_queue.reset_deadlines(deadline_queue_indices),
+              with WaitSetRunError::InternalError,
+              "Unable to reset deadlines since the deadline_queue guards could not be reset for the attachments {:?}. Continuing operations will lead to invalid deadline failures.",
+              triggered_file_descriptors);
+
+        Ok(())
     }
 
     fn handle_deadlines<F: FnMut(WaitSetAttachmentId<Service>) -> CallbackProgression>(
@@ -619,13 +752,11 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         fn_call: &mut F,
         error_msg: &str,
     ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        tracepoint!(waitset_dispatch, triggered_file_descriptors.len());
+
         // we need to reset the deadlines first, otherwise a long fn_call may extend the
         // deadline unintentionally
-        let mut fd_and_deadline_queue_idx = Vec::with_capacity(triggered_file_descriptors.len());
-
-        for fd in triggered_file_descriptors {
-            fd_and_deadline_queue_idx.push((fd, self.reset_deadline(*fd)?));
-        }
+        self.reset_deadlines(triggered_file_descriptors)?;
 
         // must be called after the deadlines have been reset, in the case that the
         // event has been received shortly before the deadline ended.
@@ -666,6 +797,68 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         })
     }
 
+    /// Attaches a [`Subscriber`] as notification to the [`WaitSet`]. The [`WaitSet`] informs the
+    /// user in [`WaitSet::wait_and_process()`] whenever a
+    /// [`Publisher`](crate::port::publisher::Publisher) delivered a sample. The [`Subscriber`]
+    /// must be created with
+    /// [`PortFactorySubscriber::enable_wake_up()`](crate::service::port_factory::subscriber::PortFactorySubscriber::enable_wake_up()),
+    /// otherwise [`WaitSetAttachmentError::NoWakeUpChannel`] is returned.
+    pub fn attach_subscriber<
+        'waitset,
+        'attachment,
+        Payload: Debug + ZeroCopySend + ?Sized,
+        UserHeader: Debug + ZeroCopySend,
+    >(
+        &'waitset self,
+        subscriber: &'attachment Subscriber<Service, Payload, UserHeader>,
+    ) -> Result<WaitSetGuard<'waitset, 'attachment, Service>, WaitSetAttachmentError>
+    where
+        <Service::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        match subscriber.wake_up_channel() {
+            Some(wake_up_channel) => self.attach_notification(wake_up_channel),
+            None => {
+                fail!(from self, with WaitSetAttachmentError::NoWakeUpChannel,
+                    "Unable to attach the subscriber {:?} since it has no wake up channel.", subscriber.id());
+            }
+        }
+    }
+
+    /// Attaches a [`Server`] as notification to the [`WaitSet`]. The [`WaitSet`] informs the
+    /// user in [`WaitSet::wait_and_process()`] whenever a
+    /// [`Client`](crate::port::client::Client) delivered a request. The [`Server`] must be
+    /// created with
+    /// [`PortFactoryServer::enable_wake_up()`](crate::service::port_factory::server::PortFactoryServer::enable_wake_up()),
+    /// otherwise [`WaitSetAttachmentError::NoWakeUpChannel`] is returned.
+    pub fn attach_server<
+        'waitset,
+        'attachment,
+        RequestPayload: Debug + ZeroCopySend + ?Sized,
+        RequestHeader: Debug + ZeroCopySend,
+        ResponsePayload: Debug + ZeroCopySend + ?Sized,
+        ResponseHeader: Debug + ZeroCopySend,
+    >(
+        &'waitset self,
+        server: &'attachment Server<
+            Service,
+            RequestPayload,
+            RequestHeader,
+            ResponsePayload,
+            ResponseHeader,
+        >,
+    ) -> Result<WaitSetGuard<'waitset, 'attachment, Service>, WaitSetAttachmentError>
+    where
+        <Service::Event as Event<RelocatableCountingBitSet>>::Listener: SynchronousMultiplexing,
+    {
+        match server.wake_up_channel() {
+            Some(wake_up_channel) => self.attach_notification(wake_up_channel),
+            None => {
+                fail!(from self, with WaitSetAttachmentError::NoWakeUpChannel,
+                    "Unable to attach the server {:?} since it has no wake up channel.", server.id());
+            }
+        }
+    }
+
     /// Attaches an object as deadline to the [`WaitSet`]. Whenever the event is received or the
     /// deadline is hit, the user is informed in [`WaitSet::wait_and_process()`].
     /// The object cannot be attached twice and the
@@ -711,6 +904,35 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         })
     }
 
+    /// Attaches a tick event to the [`WaitSet`] that is aligned to the absolute time of the
+    /// clock. It triggers at `phase + n * interval`, independent of when it was attached or
+    /// when the [`WaitSet`] woke up the last time. Intervals with the same `interval` and
+    /// `phase` trigger at the same time points, even in different processes. Whenever the
+    /// timeout is reached the [`WaitSet`] informs the user in [`WaitSet::wait_and_process()`].
+    pub fn attach_interval_with_phase(
+        &self,
+        interval: Duration,
+        phase: Duration,
+    ) -> Result<WaitSetGuard<'_, 'static, Service>, WaitSetAttachmentError> {
+        let msg = "Unable to attach interval with phase to underlying Timer";
+        let deadline_queue_guard = match self
+            .deadline_queue
+            .add_deadline_interval_with_phase(interval, phase)
+        {
+            Ok(guard) => guard,
+            Err(e) => {
+                fail!(from self, with WaitSetAttachmentError::InternalError,
+                    "{msg} since the interval could not be attached to the underlying deadline_queue due to ({:?}).", e);
+            }
+        };
+        self.attach()?;
+
+        Ok(WaitSetGuard {
+            waitset: self,
+            guard_type: GuardType::Tick(deadline_queue_guard),
+        })
+    }
+
     /// Waits until an event arrives on the [`WaitSet`], then collects all events by calling the
     /// provided `fn_call` callback with the corresponding [`WaitSetAttachmentId`]. In contrast
     /// to [`WaitSet::wait_and_process_once()`] it will never return until the user explicitly
@@ -896,6 +1118,8 @@ impl<Service: crate::service::Service> WaitSet<Service> {
                 "{msg} since the WaitSet has no attachments, therefore the call would end up in a deadlock.");
         }
 
+        self.configure_waiting_thread()?;
+
         let next_timeout = fail!(from self,
                                  when self.deadline_queue.duration_until_next_deadline(),
                                  with WaitSetRunError::InternalError,
@@ -932,6 +1156,110 @@ impl<Service: crate::service::Service> WaitSet<Service> {
         }
     }
 
+    /// Like [`WaitSet::wait_and_process()`] but instead of calling `fn_call` once for every
+    /// event, it collects all [`WaitSetAttachmentId`]s of a wake up and provides them together
+    /// in one slice. The slice is backed by a buffer that is owned by the [`WaitSet`] and reused
+    /// in every cycle, so that no allocation is required per wake up.
+    ///
+    /// The loop continues until `fn_call` returns [`CallbackProgression::Stop`] or a signal was
+    /// received.
+    ///
+    /// # Example
+    ///
+    /// ```no_run
+    /// use iceoryx2::prelude::*;
+    /// # use core::time::Duration;
+    /// # fn main() -> Result<(), Box<dyn core::error::Error>> {
+    /// # let node = NodeBuilder::new().create::<ipc::Service>()?;
+    /// # let event = node.service_builder(&"MyEventName_1".try_into()?)
+    /// #     .event()
+    /// #     .open_or_create()?;
+    ///
+    /// # let mut listener = event.listener_builder().create()?;
+    ///
+    /// let waitset = WaitSetBuilder::new().create::<ipc::Service>()?;
+    /// # let guard = waitset.attach_notification(&listener)?;
+    ///
+    /// let on_events = |attachment_ids: &[WaitSetAttachmentId<ipc::Service>]| {
+    ///     if attachment_ids.iter().any(|id| id.has_event_from(&guard)) {
+    ///         CallbackProgression::Stop
+    ///     } else {
+    ///         CallbackProgression::Continue
+    ///     }
+    /// };
+    ///
+    /// waitset.wait_and_process_batch(on_events)?;
+    ///
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn wait_and_process_batch<
+        F: FnMut(&[WaitSetAttachmentId<Service>]) -> CallbackProgression,
+    >(
+        &self,
+        mut fn_call: F,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        loop {
+            match self.wait_and_process_batch_once(&mut fn_call) {
+                Ok(WaitSetRunResult::AllEventsHandled) => (),
+                Ok(v) => return Ok(v),
+                Err(e) => {
+                    fail!(from self, with e,
+                            "Unable to run in WaitSet::wait_and_process_batch() loop since ({:?}) has occurred.", e);
+                }
+            }
+        }
+    }
+
+    /// Like [`WaitSet::wait_and_process_once()`] but provides all [`WaitSetAttachmentId`]s of
+    /// the wake up in one slice to `fn_call`. See [`WaitSet::wait_and_process_batch()`].
+    pub fn wait_and_process_batch_once<
+        F: FnMut(&[WaitSetAttachmentId<Service>]) -> CallbackProgression,
+    >(
+        &self,
+        fn_call: F,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        self.wait_and_process_batch_once_with_timeout(fn_call, Duration::MAX)
+    }
+
+    /// Like [`WaitSet::wait_and_process_once_with_timeout()`] but provides all
+    /// [`WaitSetAttachmentId`]s of the wake up in one slice to `fn_call`. When the timeout
+    /// passed without any event, `fn_call` is not called. See
+    /// [`WaitSet::wait_and_process_batch()`].
+    pub fn wait_and_process_batch_once_with_timeout<
+        F: FnMut(&[WaitSetAttachmentId<Service>]) -> CallbackProgression,
+    >(
+        &self,
+        mut fn_call: F,
+        timeout: Duration,
+    ) -> Result<WaitSetRunResult, WaitSetRunError> {
+        // the buffer is taken out of the WaitSet so that the callback can call the WaitSet
+        // again without running into a borrow conflict
+        let mut attachment_ids = core::mem::take(&mut *self.attachment_id_batch.borrow_mut());
+        attachment_ids.clear();
+
+        let result = self.wait_and_process_once_with_timeout(
+            |attachment_id| {
+                attachment_ids.push(attachment_id);
+                CallbackProgression::Continue
+            },
+            timeout,
+        );
+
+        let result = match result {
+            Ok(WaitSetRunResult::AllEventsHandled) if !attachment_ids.is_empty() => {
+                match fn_call(&attachment_ids) {
+                    CallbackProgression::Continue => Ok(WaitSetRunResult::AllEventsHandled),
+                    CallbackProgression::Stop => Ok(WaitSetRunResult::StopRequest),
+                }
+            }
+            v => v,
+        };
+
+        *self.attachment_id_batch.borrow_mut() = attachment_ids;
+        result
+    }
+
     /// Returns the capacity of the [`WaitSet`]
     pub fn capacity(&self) -> usize {
         self.reactor.capacity()
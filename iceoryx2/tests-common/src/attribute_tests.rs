@@ -241,3 +241,42 @@ fn set_verify_requirements_fails_when_key_does_not_exist() {
         ))
     );
 }
+
+#[test]
+fn set_lookups_work_with_many_interleaved_keys() {
+    let mut sut_specifier = AttributeSpecifier::new();
+    let mut sut_verifier = AttributeVerifier::new();
+    for n in (0..AttributeSet::capacity()).rev() {
+        let key = (n % 3).to_string();
+        let value = n.to_string();
+        sut_specifier = sut_specifier
+            .define(
+                &key.as_str().try_into().unwrap(),
+                &value.as_str().try_into().unwrap(),
+            )
+            .unwrap();
+
+        if n % 2 == 0 {
+            sut_verifier = sut_verifier
+                .require(
+                    &key.as_str().try_into().unwrap(),
+                    &value.as_str().try_into().unwrap(),
+                )
+                .unwrap();
+        }
+    }
+    let attributes = sut_specifier.attributes();
+
+    assert_that!(sut_verifier.verify_requirements(attributes), is_ok);
+    for k in 0..3 {
+        let key = k.to_string().as_str().try_into().unwrap();
+        let expected_values = (0..AttributeSet::capacity()).filter(|n| n % 3 == k).count();
+
+        assert_that!(attributes.number_of_key_values(&key), eq expected_values);
+        for idx in 0..expected_values {
+            assert_that!(attributes.key_value(&key, idx), is_some);
+        }
+        assert_that!(attributes.key_value(&key, expected_values), is_none);
+    }
+    assert_that!(attributes.number_of_key_values(&"3".try_into().unwrap()), eq 0);
+}
@@ -29,6 +29,8 @@ use core::time::Duration;
 
 use demo_nodes_iceoryx2::{RosHeader, SERVICE_NAME, StdMsgStringByte, as_bytes};
 use iceoryx2::prelude::*;
+use iceoryx2_cal::serialize::Serialize;
+use iceoryx2_cal::serialize::cdr::Cdr;
 
 const CYCLE_TIME: Duration = Duration::from_millis(100);
 
@@ -48,7 +50,7 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
     coutln!("waiting for messages on {SERVICE_NAME}");
     while node.wait(CYCLE_TIME).is_ok() {
         while let Some(sample) = subscriber.receive()? {
-            let message: std_msgs::msg::String = cdr::deserialize(as_bytes(sample.payload()))?;
+            let message: std_msgs::msg::String = Cdr::deserialize(as_bytes(sample.payload()))?;
             let header = sample.user_header();
 
             coutln!(
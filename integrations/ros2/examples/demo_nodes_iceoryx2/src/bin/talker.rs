@@ -27,9 +27,9 @@
 
 use core::time::Duration;
 
-use cdr::{CdrLe, Infinite};
-use demo_nodes_iceoryx2::{RosHeader, SERVICE_NAME, StdMsgStringByte};
+use demo_nodes_iceoryx2::{RosHeader, SERVICE_NAME, StdMsgStringByte, as_uninit_bytes_mut};
 use iceoryx2::prelude::*;
+use iceoryx2_cal::serialize::cdr::Cdr;
 
 const CYCLE_TIME: Duration = Duration::from_secs(1);
 const INITIAL_MAX_PAYLOAD_SIZE: usize = 64;
@@ -56,16 +56,20 @@ fn main() -> Result<(), Box<dyn core::error::Error>> {
         let message = std_msgs::msg::String {
             data: format!("Hello from iceoryx2: {counter}"),
         };
-        let payload = cdr::serialize::<_, _, CdrLe>(&message, Infinite)?;
+        // The size is computed up front so that the message is serialized
+        // once, directly into the loaned payload.
+        let payload_size = Cdr::serialized_size(&message)?;
 
-        let mut sample = publisher.loan_slice_uninit(payload.len())?;
+        let mut sample = publisher.loan_slice_uninit(payload_size)?;
         // Outgoing samples carry no origin information; the header exists
         // so that the service type matches the bridged subscriber side.
         *sample.user_header_mut() = RosHeader::default();
-        let sample = sample.write_from_fn(|index| StdMsgStringByte(payload[index]));
+        Cdr::serialize_into(&message, as_uninit_bytes_mut(sample.payload_mut()))?;
+        // SAFETY: serialize_into() initialized the whole payload
+        let sample = unsafe { sample.assume_init() };
         sample.send()?;
 
-        coutln!("sent: \"{}\" ({} bytes)", message.data, payload.len());
+        coutln!("sent: \"{}\" ({} bytes)", message.data, payload_size);
         counter += 1;
     }
 
@@ -13,6 +13,8 @@
 //! The bridge contract for the `/chatter` demo, shared by the publisher and
 //! subscriber binaries.
 
+use core::mem::MaybeUninit;
+
 use iceoryx2::prelude::*;
 use rosidl_runtime_rs::{Message, RmwMessage};
 
@@ -39,6 +41,21 @@ pub fn as_bytes(payload: &[StdMsgStringByte]) -> &[u8] {
     unsafe { core::slice::from_raw_parts(payload.as_ptr().cast::<u8>(), payload.len()) }
 }
 
+/// Uninitialized byte view of a loaned CDR payload slice, the destination
+/// the message is serialized into.
+pub fn as_uninit_bytes_mut(
+    payload: &mut [MaybeUninit<StdMsgStringByte>],
+) -> &mut [MaybeUninit<u8>] {
+    // SAFETY: StdMsgStringByte is #[repr(transparent)] over u8, so length and
+    // alignment carry over.
+    unsafe {
+        core::slice::from_raw_parts_mut(
+            payload.as_mut_ptr().cast::<MaybeUninit<u8>>(),
+            payload.len(),
+        )
+    }
+}
+
 // TODO: Move to common library.
 /// User header of bridged services, written by the tunnel when ingesting a
 /// ROS 2 message so subscribers can identify the remote origin.
@@ -12,10 +12,14 @@
 
 use std::rc::Rc;
 
+use std::ffi::c_void;
+
 use r2r_rcl::{
-    RCL_RET_OK, rcl_get_zero_initialized_publisher, rcl_publish_serialized_message,
+    RCL_RET_OK, rcl_borrow_loaned_message, rcl_get_zero_initialized_publisher, rcl_publish,
+    rcl_publish_loaned_message, rcl_publish_serialized_message, rcl_publisher_can_loan_messages,
     rcl_publisher_fini, rcl_publisher_get_default_options, rcl_publisher_init, rcl_ret_t,
-    rcl_serialized_message_t, rcutils_get_default_allocator,
+    rcl_return_loaned_message_from_publisher, rcl_serialized_message_t,
+    rcutils_get_default_allocator,
 };
 
 use iceoryx2_bb_concurrency::cell::UnsafeCell;
@@ -40,6 +44,8 @@ impl core::error::Error for CreationError {}
 
 #[derive(Debug, Eq, PartialEq, Clone, Copy)]
 pub enum PublishError {
+    /// The rmw failed to loan a message for publishing.
+    Loan,
     Publish,
 }
 
@@ -96,18 +102,19 @@ impl<'a> RclPublisherBuilder<'a> {
             Ok(RclPublisher {
                 node: self.node,
                 publisher,
-                _type_support: self.type_support,
+                type_support: self.type_support,
             })
         }
     }
 }
 
-/// Publishes pre-serialized messages on a ROS 2 topic.
+/// Publishes pre-serialized or in-memory messages on a ROS 2 topic.
 pub struct RclPublisher {
     node: Rc<RclNode>,
     publisher: Box<UnsafeCell<r2r_rcl::rcl_publisher_t>>,
-    /// Keeps the typesupport library loaded while the endpoint uses it.
-    _type_support: Rc<TypeSupport>,
+    /// Borrows loaned messages and keeps the typesupport library loaded
+    /// while the endpoint uses it.
+    type_support: Rc<TypeSupport>,
 }
 
 impl core::fmt::Debug for RclPublisher {
@@ -115,7 +122,7 @@ impl core::fmt::Debug for RclPublisher {
         f.debug_struct("RclPublisher")
             .field("publisher", &self.publisher.get())
             .field("node", &self.node)
-            .field("_type_support", &self._type_support)
+            .field("type_support", &self.type_support)
             .finish()
     }
 }
@@ -147,6 +154,90 @@ impl RclPublisher {
 
         Ok(())
     }
+
+    /// Whether the rmw can loan messages to the publisher, i.e. supports
+    /// [`RclPublisher::publish_message()`] without serializing on the
+    /// caller's side of the middleware.
+    pub fn can_loan_messages(&self) -> bool {
+        unsafe { rcl_publisher_can_loan_messages(self.publisher.get()) }
+    }
+
+    /// Publishes an in-memory message; `message` must contain the rosidl C
+    /// struct of the publisher's type and the type must not own any heap
+    /// memory (no strings or unbounded sequences).
+    ///
+    /// When the rmw can loan messages, the message is copied into a loan of
+    /// the middleware and handed over without serialization. Otherwise rcl
+    /// serializes it straight from `message`.
+    pub fn publish_message(&self, message: &[u8]) -> Result<(), PublishError> {
+        let origin = "RclPublisher::publish_message";
+
+        if !self.can_loan_messages() {
+            let ret = unsafe {
+                rcl_publish(
+                    self.publisher.get(),
+                    message.as_ptr().cast::<c_void>(),
+                    core::ptr::null_mut(),
+                )
+            };
+            if ret != RCL_RET_OK as rcl_ret_t {
+                fail!(
+                    from origin,
+                    with PublishError::Publish,
+                    "Failed to publish message: {}",
+                    RclError::from(ret)
+                );
+            }
+
+            return Ok(());
+        }
+
+        let mut loaned_message: *mut c_void = core::ptr::null_mut();
+        let ret = unsafe {
+            rcl_borrow_loaned_message(
+                self.publisher.get(),
+                self.type_support.handle(),
+                &mut loaned_message,
+            )
+        };
+        if ret != RCL_RET_OK as rcl_ret_t || loaned_message.is_null() {
+            fail!(
+                from origin,
+                with PublishError::Loan,
+                "Failed to borrow loaned message: {}",
+                RclError::from(ret)
+            );
+        }
+
+        // The rmw allocates the loan for the publisher's type, i.e. it is at
+        // least as large as the message.
+        unsafe {
+            core::ptr::copy_nonoverlapping(
+                message.as_ptr(),
+                loaned_message.cast::<u8>(),
+                message.len(),
+            );
+        }
+
+        let ret = unsafe {
+            rcl_publish_loaned_message(self.publisher.get(), loaned_message, core::ptr::null_mut())
+        };
+        if ret != RCL_RET_OK as rcl_ret_t {
+            // Ownership of the loan only moves to the rmw on success.
+            unsafe {
+                let _ =
+                    rcl_return_loaned_message_from_publisher(self.publisher.get(), loaned_message);
+            }
+            fail!(
+                from origin,
+                with PublishError::Publish,
+                "Failed to publish loaned message: {}",
+                RclError::from(ret)
+            );
+        }
+
+        Ok(())
+    }
 }
 
 impl Drop for RclPublisher {
@@ -16,10 +16,11 @@ use std::rc::Rc;
 
 use r2r_rcl::{
     RCL_RET_OK, RCL_RET_SUBSCRIPTION_TAKE_FAILED, RMW_GID_STORAGE_SIZE,
-    rcl_get_zero_initialized_subscription, rcl_serialized_message_t, rcl_subscription_fini,
+    rcl_get_zero_initialized_subscription, rcl_return_loaned_message_from_subscription,
+    rcl_serialized_message_t, rcl_subscription_can_loan_messages, rcl_subscription_fini,
     rcl_subscription_get_default_options, rcl_subscription_init,
-    rcl_subscription_set_on_new_message_callback, rcl_take_serialized_message, rcutils_allocator_t,
-    rmw_message_info_t,
+    rcl_subscription_set_on_new_message_callback, rcl_take, rcl_take_loaned_message,
+    rcl_take_serialized_message, rcutils_allocator_t, rmw_message_info_t,
 };
 
 use iceoryx2_log::fail;
@@ -146,7 +147,7 @@ impl<'a> RclSubscriptionBuilder<'a> {
     }
 }
 
-/// Receives serialized messages from a ROS 2 topic.
+/// Receives serialized or in-memory messages from a ROS 2 topic.
 pub struct RclSubscription {
     subscription: *mut r2r_rcl::rcl_subscription_t,
     /// The new-message callback while one is registered, kept alive and pinned
@@ -259,6 +260,108 @@ impl RclSubscription {
             MessageInfo::from(&message_info),
         )))
     }
+
+    /// Whether the rmw can loan received messages to the subscription.
+    pub fn can_loan_messages(&self) -> bool {
+        unsafe { rcl_subscription_can_loan_messages(self.subscription) }
+    }
+
+    /// Takes the next message from the subscription's queue as the in-memory
+    /// rosidl C struct of `size` bytes into a caller-provided buffer, i.e.
+    /// loaned iceoryx2 payload memory. The type must not own any heap memory
+    /// (no strings or unbounded sequences).
+    ///
+    /// When the rmw can loan messages, the message is taken as a loan of
+    /// the middleware and `loan` is only called when a message is available;
+    /// the message is copied into the buffer and the middleware loan is
+    /// returned right away. Otherwise `loan` is called up-front and rcl
+    /// deserializes into the buffer directly.
+    ///
+    /// `loan` must return a buffer of at least `size` bytes (or [`None`] to
+    /// abort the take). Returns the message info, or [`None`] when the queue
+    /// is empty.
+    pub fn take_message_into<F>(
+        &self,
+        size: usize,
+        loan: F,
+    ) -> Result<Option<MessageInfo>, TakeError>
+    where
+        F: FnOnce(usize) -> Option<*mut u8>,
+    {
+        let origin = "RclSubscription::take_message_into";
+
+        let mut message_info = rmw_message_info_t::default();
+
+        if !self.can_loan_messages() {
+            let Some(buffer) = loan(size) else {
+                fail!(from origin,
+                    with TakeError::LoanDeclined,
+                    "Failed to take message into loaned buffer"
+                );
+            };
+
+            let ret = unsafe {
+                rcl_take(
+                    self.subscription,
+                    buffer.cast::<c_void>(),
+                    &mut message_info,
+                    core::ptr::null_mut(),
+                )
+            };
+            if ret == RCL_RET_SUBSCRIPTION_TAKE_FAILED as i32 {
+                return Ok(None);
+            }
+            if ret != RCL_RET_OK as i32 {
+                fail!(from origin,
+                    with TakeError::Take,
+                    "Failed to take message: {}",
+                    RclError::from(ret)
+                );
+            }
+
+            return Ok(Some(MessageInfo::from(&message_info)));
+        }
+
+        let mut loaned_message: *mut c_void = core::ptr::null_mut();
+        let ret = unsafe {
+            rcl_take_loaned_message(
+                self.subscription,
+                &mut loaned_message,
+                &mut message_info,
+                core::ptr::null_mut(),
+            )
+        };
+        if ret == RCL_RET_SUBSCRIPTION_TAKE_FAILED as i32 {
+            return Ok(None);
+        }
+        if ret != RCL_RET_OK as i32 || loaned_message.is_null() {
+            fail!(from origin,
+                with TakeError::Take,
+                "Failed to take loaned message: {}",
+                RclError::from(ret)
+            );
+        }
+
+        let buffer = loan(size);
+        if let Some(buffer) = buffer {
+            unsafe {
+                core::ptr::copy_nonoverlapping(loaned_message.cast::<u8>(), buffer, size);
+            }
+        }
+
+        unsafe {
+            let _ = rcl_return_loaned_message_from_subscription(self.subscription, loaned_message);
+        }
+
+        if buffer.is_none() {
+            fail!(from origin,
+                with TakeError::LoanDeclined,
+                "Failed to take loaned message into loaned buffer"
+            );
+        }
+
+        Ok(Some(MessageInfo::from(&message_info)))
+    }
 }
 
 impl Drop for RclSubscription {
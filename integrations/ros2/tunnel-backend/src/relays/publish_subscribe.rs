@@ -13,6 +13,7 @@
 use std::rc::Rc;
 use std::sync::Arc;
 
+use iceoryx2::service::static_config::message_type_details::TypeVariant;
 use iceoryx2::service::{Service, local_threadsafe, static_config::StaticConfig};
 use iceoryx2_log::fail;
 use iceoryx2_services_tunnel_backend::traits::{PublishSubscribeRelay, RelayBuilder};
@@ -83,6 +84,10 @@ pub struct Relay<S: Service> {
     /// Whether the service's user-header type is [`RosHeader`], i.e. the
     /// relay may write the remote origin into received samples.
     write_ros_header: bool,
+    /// The payload size of services with a fixed-size payload. Their payload
+    /// is the in-memory rosidl C struct and is exchanged as a message, via
+    /// rmw loans where available, instead of as a serialized CDR buffer.
+    message_size: Option<usize>,
     _phantom: core::marker::PhantomData<S>,
 }
 
@@ -93,8 +98,14 @@ impl<S: Service> PublishSubscribeRelay<S> for Relay<S> {
     fn send(&self, sample: Sample<S>) -> Result<(), Self::SendError> {
         let origin = "publish_subscribe::Relay::send";
 
+        let payload = payload::as_bytes(sample.payload());
+        let result = match self.message_size {
+            Some(_) => self.publisher.publish_message(payload),
+            None => self.publisher.publish(payload),
+        };
+
         fail!(from origin,
-            when self.publisher.publish(payload::as_bytes(sample.payload())),
+            when result,
             with SendError::Publish,
             "Failed to relay sample to ROS 2"
         );
@@ -107,14 +118,21 @@ impl<S: Service> PublishSubscribeRelay<S> for Relay<S> {
         loan: &mut LoanFn<'_, S, LoanError>,
     ) -> Result<Option<SampleMut<S>>, Self::ReceiveError> {
         let mut loaned: Option<SampleMutUninit<S>> = None;
-        let result = self.subscription.take_into(|size| match loan(size) {
+        let loan_buffer = |size| match loan(size) {
             Ok(mut sample) => {
                 let buffer = payload::uninit_bytes_ptr(sample.payload_mut());
                 loaned = Some(sample);
                 Some(buffer)
             }
             Err(_) => None,
-        });
+        };
+        let result = match self.message_size {
+            Some(message_size) => self
+                .subscription
+                .take_message_into(message_size, loan_buffer)
+                .map(|taken| taken.map(|message_info| (message_size, message_info))),
+            None => self.subscription.take_into(loan_buffer),
+        };
 
         match result {
             Ok(Some((size, message_info))) => {
@@ -242,10 +260,23 @@ impl<S: Service> RelayBuilder for Builder<'_, S> {
             .user_header
             == RosHeader::type_detail();
 
+        // Fixed-size payloads are plain rosidl C structs; dynamic payloads
+        // are byte slices carrying serialized messages.
+        let payload_type = &self
+            .static_config
+            .publish_subscribe()
+            .message_type_details()
+            .payload;
+        let message_size = match payload_type.variant() {
+            TypeVariant::FixedSize => Some(payload_type.size()),
+            TypeVariant::Dynamic => None,
+        };
+
         Ok(Relay {
             publisher,
             subscription,
             write_ros_header,
+            message_size,
             _phantom: core::marker::PhantomData,
         })
     }
@@ -19,6 +19,7 @@ use iceoryx2_services_common::{DiscoveryEvent, DiscoveryEventRef};
 
 use zenoh::{
     Session, Wait,
+    bytes::ZBytes,
     handlers::FifoChannelHandler,
     liveliness::LivelinessToken,
     pubsub::Subscriber,
@@ -188,14 +189,14 @@ impl Discovery {
         let key = keys::service_details(&service_hash);
         let serialized = fail!(
             from self,
-            when serde_json::to_string(static_config),
+            when postcard::to_allocvec(static_config),
             with AnnouncementError::Serialization,
             "Failed to serialize service config"
         );
 
         // Declare the queryable **before** the liveliness token. Peers
         // receive the token's Put as soon as it is declared.
-        let queryable = self.declare_queryable(&key, serialized)?;
+        let queryable = self.declare_queryable(&key, ZBytes::from(serialized))?;
         let token = self.declare_liveliness_token(&key)?;
 
         self.announced.borrow_mut().insert(
@@ -216,11 +217,12 @@ impl Discovery {
     }
 
     /// Declares a queryable that responds to remote peers' `get` requests for
-    /// a service's StaticConfig with the pre-serialised JSON payload.
+    /// a service's StaticConfig with the pre-serialised postcard payload.
+    /// The payload is shared by all replies and not copied.
     fn declare_queryable(
         &self,
         key: &str,
-        serialized: String,
+        serialized: ZBytes,
     ) -> Result<Queryable<()>, AnnouncementError> {
         let reply_key = key.to_string();
         let queryable = fail!(
@@ -389,7 +391,7 @@ fn check_pending(
             }
         };
 
-        match serde_json::from_slice::<StaticConfig>(&sample.payload().to_bytes()) {
+        match postcard::from_bytes::<StaticConfig>(&sample.payload().to_bytes()) {
             Ok(static_config) => return Ok(Some(static_config)),
             Err(e) => warn!(
                 "Skipping unparseable reply for service {}: {}",
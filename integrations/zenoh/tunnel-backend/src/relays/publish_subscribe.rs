@@ -10,6 +10,13 @@
 //
 // SPDX-License-Identifier: Apache-2.0 OR MIT
 
+//! Publish-subscribe samples are aggregated into frames before they are put
+//! into zenoh, so that many small samples share one network message. Every
+//! entry of a frame consists of the payload length as little endian `u64`,
+//! followed by the user header and the payload.
+
+use core::cell::RefCell;
+use std::io::{Read, Seek, SeekFrom};
 use std::sync::Arc;
 
 use iceoryx2::service::{
@@ -36,6 +43,13 @@ use zenoh::{
 use crate::keys;
 use crate::relays::wake_handler::{WakeAwareChannel, WakeAwareReceiver};
 
+/// The default size up to which samples are aggregated into one frame. It
+/// corresponds to the default batch size of zenoh. Samples that are larger
+/// are sent in a frame of their own.
+pub const DEFAULT_MAX_FRAME_SIZE: usize = 65535;
+
+const LEN_FIELD_SIZE: usize = core::mem::size_of::<u64>();
+
 #[derive(Debug, Eq, PartialEq, Clone, Copy)]
 pub enum CreationError {
     PublisherDeclaration,
@@ -68,6 +82,7 @@ impl core::error::Error for SendError {}
 pub enum ReceiveError {
     SampleReceive,
     IceoryxLoan,
+    MalformedFrame,
 }
 
 impl core::fmt::Display for ReceiveError {
@@ -83,6 +98,8 @@ pub struct Builder<'a, S: Service> {
     session: &'a Session,
     static_config: &'a StaticConfig,
     wake: Option<Arc<WakeHandle<local_threadsafe::Service>>>,
+    max_frame_size: usize,
+    express: bool,
     _phantom: core::marker::PhantomData<S>,
 }
 
@@ -96,9 +113,27 @@ impl<'a, S: Service> Builder<'a, S> {
             session,
             static_config,
             wake,
+            max_frame_size: DEFAULT_MAX_FRAME_SIZE,
+            express: true,
             _phantom: core::marker::PhantomData,
         }
     }
+
+    /// Defines the size up to which samples are aggregated into one frame
+    /// before they are put into zenoh.
+    pub fn max_frame_size(mut self, value: usize) -> Self {
+        self.max_frame_size = value;
+        self
+    }
+
+    /// Defines whether the frames are sent as express messages. Express
+    /// messages are transmitted immediately instead of waiting in the
+    /// transport batch of zenoh. Since the relay already aggregates the
+    /// samples into frames, it is enabled by default.
+    pub fn express(mut self, value: bool) -> Self {
+        self.express = value;
+        self
+    }
 }
 
 impl<S: Service> RelayBuilder for Builder<'_, S> {
@@ -115,6 +150,7 @@ impl<S: Service> RelayBuilder for Builder<'_, S> {
                 .declare_publisher(key.clone())
                 .allowed_destination(Locality::Remote)
                 .reliability(Reliability::Reliable)
+                .express(self.express)
                 .wait(),
             with CreationError::PublisherDeclaration,
             "Failed to create zenoh publisher for publish-subscribe payloads"
@@ -136,19 +172,92 @@ impl<S: Service> RelayBuilder for Builder<'_, S> {
             static_config: self.static_config.clone(),
             publisher,
             subscriber,
+            max_frame_size: self.max_frame_size,
+            outgoing_frame: RefCell::new(Vec::new()),
+            incoming_frame: RefCell::new(IncomingFrame::default()),
             _phantom: core::marker::PhantomData,
         })
     }
 }
 
+#[derive(Debug, Default)]
+struct IncomingFrame {
+    bytes: ZBytes,
+    offset: usize,
+}
+
+impl IncomingFrame {
+    fn is_consumed(&self) -> bool {
+        self.offset >= self.bytes.len()
+    }
+
+    /// Returns the payload length of the next entry when the entry is
+    /// completely contained in the frame.
+    fn next_payload_len(&self, user_header_size: usize) -> Option<usize> {
+        let mut len = [0u8; LEN_FIELD_SIZE];
+        self.reader_at(self.offset)?.read_exact(&mut len).ok()?;
+        let payload_len = usize::try_from(u64::from_le_bytes(len)).ok()?;
+
+        let end = (self.offset + LEN_FIELD_SIZE + user_header_size).checked_add(payload_len)?;
+        (end <= self.bytes.len()).then_some(payload_len)
+    }
+
+    /// Reads the user header and the payload of the next entry directly from
+    /// the received zenoh buffers into the provided memory and advances to
+    /// the following entry.
+    fn read_entry_into(&mut self, user_header: &mut [u8], payload: &mut [u8]) -> Option<()> {
+        let mut reader = self.reader_at(self.offset + LEN_FIELD_SIZE)?;
+        reader.read_exact(user_header).ok()?;
+        reader.read_exact(payload).ok()?;
+
+        self.offset += LEN_FIELD_SIZE + user_header.len() + payload.len();
+        Some(())
+    }
+
+    fn reader_at(&self, offset: usize) -> Option<impl Read + '_> {
+        let mut reader = self.bytes.reader();
+        reader.seek(SeekFrom::Start(offset as u64)).ok()?;
+        Some(reader)
+    }
+}
+
 #[derive(Debug)]
 pub struct Relay<S: Service> {
     static_config: StaticConfig,
     publisher: Publisher<'static>,
     subscriber: Subscriber<WakeAwareReceiver<Sample>>,
+    max_frame_size: usize,
+    outgoing_frame: RefCell<Vec<u8>>,
+    incoming_frame: RefCell<IncomingFrame>,
     _phantom: core::marker::PhantomData<S>,
 }
 
+impl<S: Service> Relay<S> {
+    fn put_frame(&self, frame: &mut Vec<u8>) -> Result<(), SendError> {
+        if frame.is_empty() {
+            return Ok(());
+        }
+
+        trace!(
+            from self,
+            "Putting frame of {} bytes for {}({})",
+            frame.len(),
+            self.static_config.messaging_pattern(),
+            self.static_config.name()
+        );
+
+        let bytes = ZBytes::from(core::mem::take(frame));
+        fail!(
+            from self,
+            when self.publisher.put(bytes).wait(),
+            with SendError::PayloadPut,
+            "Failed to propagate publish-subscribe payload to zenoh"
+        );
+
+        Ok(())
+    }
+}
+
 impl<S: Service> PublishSubscribeRelay<S> for Relay<S> {
     type SendError = SendError;
     type ReceiveError = ReceiveError;
@@ -166,90 +275,114 @@ impl<S: Service> PublishSubscribeRelay<S> for Relay<S> {
 
         let user_header = sample.user_header();
         let payload = sample.payload();
+        let user_header_size = user_header_size(&self.static_config);
+        let entry_size = LEN_FIELD_SIZE + user_header_size + payload.len();
 
-        let mut writer = ZBytes::writer();
-        writer.append(unsafe {
+        let mut frame = self.outgoing_frame.borrow_mut();
+        if frame.len() + entry_size > self.max_frame_size {
+            self.put_frame(&mut frame)?;
+        }
+
+        frame.extend_from_slice(&(payload.len() as u64).to_le_bytes());
+        frame.extend_from_slice(unsafe {
             core::slice::from_raw_parts(
                 user_header as *const CustomHeaderMarker as *const u8,
-                user_header_size(&self.static_config),
+                user_header_size,
             )
-            .into()
         });
-        writer.append(unsafe {
-            core::slice::from_raw_parts(payload.as_ptr() as *mut u8, payload.len()).into()
+        frame.extend_from_slice(unsafe {
+            core::slice::from_raw_parts(payload.as_ptr() as *const u8, payload.len())
         });
 
-        fail!(
-            from self,
-            when self.publisher.put(writer).wait(),
-            with SendError::PayloadPut,
-            "Failed to propagate publish-subscribe payload to zenoh"
-        );
+        if frame.len() >= self.max_frame_size {
+            self.put_frame(&mut frame)?;
+        }
 
         Ok(())
     }
 
+    fn flush(&self) -> Result<(), Self::SendError> {
+        self.put_frame(&mut self.outgoing_frame.borrow_mut())
+    }
+
     fn receive<LoanError>(
         &self,
         loan: &mut LoanFn<'_, S, LoanError>,
     ) -> Result<Option<SampleMut<S>>, Self::ReceiveError> {
-        let zenoh_sample = fail!(
-            from self,
-            when self.subscriber.try_recv(),
-            with ReceiveError::SampleReceive,
-            "Failed to receive sample from Zenoh"
-        );
-
-        if let Some(zenoh_sample) = zenoh_sample {
-            trace!(
+        let mut frame = self.incoming_frame.borrow_mut();
+        if frame.is_consumed() {
+            let zenoh_sample = fail!(
                 from self,
-                "Ingesting {}({})",
-                self.static_config.messaging_pattern(),
-                self.static_config.name()
+                when self.subscriber.try_recv(),
+                with ReceiveError::SampleReceive,
+                "Failed to receive sample from Zenoh"
             );
 
-            let bytes_received = zenoh_sample.payload().to_bytes();
+            match zenoh_sample {
+                Some(zenoh_sample) => {
+                    *frame = IncomingFrame {
+                        bytes: zenoh_sample.payload().clone(),
+                        offset: 0,
+                    }
+                }
+                None => return Ok(None),
+            }
+        }
 
-            let user_header_size = user_header_size(&self.static_config);
-            let user_header_received = &bytes_received[0..user_header_size];
-            let payload_received = &bytes_received[user_header_size..];
+        trace!(
+            from self,
+            "Ingesting {}({})",
+            self.static_config.messaging_pattern(),
+            self.static_config.name()
+        );
 
-            let mut iceoryx_sample = fail!(
-                from self,
-                when loan(payload_received.len()),
-                with ReceiveError::IceoryxLoan,
-                "Failed to loan sample from iceoryx"
-            );
+        let msg = "Failed to ingest received frame";
+        let user_header_size = user_header_size(&self.static_config);
+        let Some(payload_len) = frame.next_payload_len(user_header_size) else {
+            let frame_size = frame.bytes.len();
+            *frame = IncomingFrame::default();
+            fail!(from self, with ReceiveError::MalformedFrame,
+                "{msg} of {frame_size} bytes since it contains a truncated entry");
+        };
 
-            let payload = iceoryx_sample.payload_mut();
+        let mut iceoryx_sample = fail!(
+            from self,
+            when loan(payload_len),
+            with ReceiveError::IceoryxLoan,
+            "Failed to loan sample from iceoryx"
+        );
 
-            debug_assert!(
-                payload.len() >= payload_received.len(),
-                "Loaned payload size ({}) is too small for received payload ({})",
-                payload.len(),
-                payload_received.len()
-            );
+        let payload = iceoryx_sample.payload_mut();
 
-            unsafe {
-                core::ptr::copy_nonoverlapping(
-                    user_header_received.as_ptr(),
-                    iceoryx_sample.user_header_mut() as *mut CustomHeaderMarker as *mut u8,
-                    user_header_size,
-                );
-            }
-            unsafe {
-                core::ptr::copy_nonoverlapping(
-                    payload_received.as_ptr(),
-                    iceoryx_sample.payload_mut().as_mut_ptr().cast::<u8>(),
-                    payload_received.len(),
-                );
-            }
-            let initialized_sample = unsafe { iceoryx_sample.assume_init() };
+        debug_assert!(
+            payload.len() >= payload_len,
+            "Loaned payload size ({}) is too small for received payload ({})",
+            payload.len(),
+            payload_len
+        );
 
-            return Ok(Some(initialized_sample));
+        // The entry is read straight from the zenoh buffers into the shared
+        // memory of the loaned sample, without an intermediate copy.
+        let payload = unsafe {
+            core::slice::from_raw_parts_mut(payload.as_mut_ptr().cast::<u8>(), payload_len)
         };
+        let user_header = unsafe {
+            core::slice::from_raw_parts_mut(
+                iceoryx_sample.user_header_mut() as *mut CustomHeaderMarker as *mut u8,
+                user_header_size,
+            )
+        };
+
+        if frame.read_entry_into(user_header, payload).is_none() {
+            let frame_size = frame.bytes.len();
+            *frame = IncomingFrame::default();
+            fail!(from self, with ReceiveError::MalformedFrame,
+                "{msg} of {frame_size} bytes since the entry could not be read");
+        }
+
+        let initialized_sample = unsafe { iceoryx_sample.assume_init() };
 
-        Ok(None)
+        Ok(Some(initialized_sample))
     }
 }
 
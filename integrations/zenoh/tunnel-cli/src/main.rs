@@ -55,6 +55,7 @@ fn main() -> anyhow::Result<()> {
         } else {
             Some(cli.services)
         },
+        ..Default::default()
     };
     let iceoryx_config = iceoryx2::config::Config::default();
     let zenoh_config = parse_zenoh_config(cli.zenoh_config.as_deref())?;